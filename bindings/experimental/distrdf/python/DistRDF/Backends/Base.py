@@ -157,6 +157,18 @@ def distrdf_reducer(results_inout: TaskResult,
     return TaskResult(mergeables_updated, entries_in_trees_out)
 
 
+def get_reduction_depth(npartitions: int, fan_in: int) -> int:
+    """
+    Returns the number of levels of a tree reduction of npartitions results in
+    which every reduction merges about fan_in results. The minimum is two
+    levels, the default of Spark's treeReduce.
+    """
+    depth = 2
+    while max(2, fan_in) ** depth < npartitions:
+        depth += 1
+    return depth
+
+
 class BaseBackend(ABC):
     """
     Base class for RDataFrame distributed backends.
@@ -170,10 +182,15 @@ class BaseBackend(ABC):
             analysis.
         shared_libraries (list): List of shared libraries needed for the
             analysis.
+        reduction_fan_in (int): Number of partial results merged together by
+            each task of the tree reduction on the workers. A large fan-in
+            means less reduction tasks, a small one less data per task.
     """
 
     initialization = staticmethod(lambda: None)
 
+    reduction_fan_in = 8
+
     headers = set()
     shared_libraries = set()
 
@@ -12,10 +12,12 @@
 from __future__ import annotations
 
 import os
+from functools import reduce
 from typing import Any, Dict, Optional, TYPE_CHECKING
 
 from DistRDF import DataFrame
 from DistRDF import HeadNode
+from DistRDF import Ranges
 from DistRDF.Backends import Base
 from DistRDF.Backends import Utils
 
@@ -170,14 +172,38 @@ class DaskBackend(Base.BaseBackend):
 
             return mapper(current_range)
 
-        dmapper = dask.delayed(dask_mapper)
-        dreducer = dask.delayed(reducer)
+        def dask_reducer(*results):
+            """
+            Merges a group of partial results into the first one.
+            """
+            return reduce(reducer, results)
 
-        mergeables_lists = [dmapper(range) for range in ranges]
+        dmapper = dask.delayed(dask_mapper)
+        dreducer = dask.delayed(dask_reducer)
 
+        def submit_mapper(current_range):
+            """
+            Creates the delayed task of a range. If the files of the range are
+            stored on known hosts, the task preferably runs on the workers of
+            those hosts, but can still be stolen by any other worker.
+            """
+            hosts = Ranges.get_preferred_hosts(current_range)
+            if not hosts:
+                return dmapper(current_range)
+            with dask.annotate(workers=hosts, allow_other_workers=True):
+                return dmapper(current_range)
+
+        mergeables_lists = [submit_mapper(range) for range in ranges]
+        # Graph optimization would drop the worker annotations of the tasks
+        has_locality_hints = any(Ranges.get_preferred_hosts(range) for range in ranges)
+
+        # Merge the partial results in a tree on the workers, every reduction
+        # task merges up to `reduction_fan_in` results of neighbouring ranges.
+        # Only the final result is sent back to the client.
+        fan_in = max(2, self.reduction_fan_in)
         while len(mergeables_lists) > 1:
-            mergeables_lists.append(
-                dreducer(mergeables_lists.pop(0), mergeables_lists.pop(0)))
+            groups = [mergeables_lists[i:i + fan_in] for i in range(0, len(mergeables_lists), fan_in)]
+            mergeables_lists = [dreducer(*group) if len(group) > 1 else group[0] for group in groups]
 
         # Here we start the progressbar for the current RDF computation graph
         # running on the Dask client. This expects a future object, so we need
@@ -188,7 +214,7 @@ class DaskBackend(Base.BaseBackend):
         # shown only if it's the last call in a cell. Since we're encapsulating
         # it in this class, it won't be shown. Full details at
         # https://docs.dask.org/en/latest/diagnostics-distributed.html#dask.distributed.progress
-        final_results = mergeables_lists.pop().persist()
+        final_results = mergeables_lists.pop().persist(optimize_graph=not has_locality_hints)
         progress(final_results)
 
         return final_results.compute()
@@ -211,5 +237,7 @@ class DaskBackend(Base.BaseBackend):
         # Set the number of partitions for this dataframe, one of the following:
         # 1. User-supplied `npartitions` optional argument
         npartitions = kwargs.pop("npartitions", None)
-        headnode = HeadNode.get_headnode(self, npartitions, *args)
+        # How the partitions are balanced, either "files" or "bytes"
+        partition_by = kwargs.pop("partition_by", "files")
+        headnode = HeadNode.get_headnode(self, npartitions, *args, partition_by=partition_by)
         return DataFrame.RDataFrame(headnode)
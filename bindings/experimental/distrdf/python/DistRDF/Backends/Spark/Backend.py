@@ -128,11 +128,15 @@ class SparkBackend(Base.BaseBackend):
 
             return mapper(current_range)
 
-        # Build parallel collection
+        # Build parallel collection. PySpark does not allow setting preferred
+        # locations for the partitions of a parallelized collection, so the
+        # locality hints of the ranges are not used with this backend.
         parallel_collection = self.sc.parallelize(ranges, len(ranges))
 
-        # Map-Reduce using Spark
-        return parallel_collection.map(spark_mapper).treeReduce(reducer)
+        # Map-Reduce using Spark. The partial results are merged on the
+        # executors in a tree, the driver only merges the last few of them.
+        depth = Base.get_reduction_depth(len(ranges), self.reduction_fan_in)
+        return parallel_collection.map(spark_mapper).treeReduce(reducer, depth)
 
     def distribute_unique_paths(self, paths):
         """
@@ -157,5 +161,7 @@ class SparkBackend(Base.BaseBackend):
         # Set the number of partitions for this dataframe, one of the following:
         # 1. User-supplied `npartitions` optional argument
         npartitions = kwargs.pop("npartitions", None)
-        headnode = HeadNode.get_headnode(self, npartitions, *args)
+        # How the partitions are balanced, either "files" or "bytes"
+        partition_by = kwargs.pop("partition_by", "files")
+        headnode = HeadNode.get_headnode(self, npartitions, *args, partition_by=partition_by)
         return DataFrame.RDataFrame(headnode)
@@ -91,7 +91,8 @@ class HeadNode(Node, ABC):
         self.graph_nodes: Deque[Node] = deque([self])
 
         # Uniquely identify each computation graph execution of this RDataFrame
-        # The uuid can be set here
+        # The uuid can be set here, the head nodes of data sources that can be
+        # described override it in _get_dataset_identifier
         self.rdf_uuid = uuid.uuid4()
         # The full identifier is created at the beginning of each execution
         self.exec_id: _graph_cache.ExecutionIdentifier = None
@@ -154,6 +155,14 @@ class HeadNode(Node, ABC):
         # serialization of the parent(s) of parent(s) nodes.
         return {node.node_id: node for node in reversed(self.graph_nodes)}
 
+    def _get_dataset_identifier(self) -> str:
+        """
+        Identifier of the dataset processed by this head node. Executions of the
+        same graph on the same dataset reuse the cached RDataFrame of the
+        worker processes, see _graph_cache.
+        """
+        return self.rdf_uuid.hex
+
     @abstractmethod
     def _build_ranges(self) -> List[Ranges.DataRange]:
         pass
@@ -194,10 +203,11 @@ class HeadNode(Node, ABC):
         # between runs (e.g. changing the number of available cores).
         self.npartitions = self.backend.optimize_npartitions()
 
-        self.exec_id = _graph_cache.ExecutionIdentifier(self.rdf_uuid, uuid.uuid4())
-
+        graph_dict = self._generate_graph_dict()
+        self.exec_id = _graph_cache.ExecutionIdentifier(self._get_dataset_identifier(),
+                                                        _graph_cache.get_graph_identifier(graph_dict))
 
-        computation_graph_callable = partial(ComputationGraphGenerator.trigger_computation_graph, self._generate_graph_dict())
+        computation_graph_callable = partial(ComputationGraphGenerator.trigger_computation_graph, graph_dict)
 
         mapper = partial(distrdf_mapper,
                          build_rdf_from_range=self._generate_rdf_creator(),
@@ -220,13 +230,16 @@ class HeadNode(Node, ABC):
         return self._localdf.GetColumnNames()
 
 
-def get_headnode(backend: BaseBackend, npartitions: int, *args) -> HeadNode:
+def get_headnode(backend: BaseBackend, npartitions: int, *args, partition_by: str = "files") -> HeadNode:
     """
     A factory for different kinds of head nodes of the RDataFrame computation
     graph, depending on the arguments to the RDataFrame constructor. Currently
     can return a TreeHeadNode or an EmptySourceHeadNode. Parses the arguments and
-    compares them against the possible RDataFrame constructors.
+    compares them against the possible RDataFrame constructors. The
+    partition_by argument is only relevant for TTree datasets, see TreeHeadNode.
     """
+    if partition_by not in ("files", "bytes"):
+        raise ValueError(f"Unknown value '{partition_by}' for 'partition_by', use either 'files' or 'bytes'.")
 
     # Early check that arguments are accepted by RDataFrame
     try:
@@ -244,7 +257,7 @@ def get_headnode(backend: BaseBackend, npartitions: int, *args) -> HeadNode:
         # RDataFrame(std::string_view treename, filenames, defaultBranches = {})
         # RDataFrame(std::string_view treeName, dirPtr, defaultBranches = {})
         # RDataFrame(TTree &tree, const ColumnNames_t &defaultBranches = {})
-        return TreeHeadNode(backend, npartitions, localdf, *args)
+        return TreeHeadNode(backend, npartitions, localdf, *args, partition_by=partition_by)
     else:
         raise RuntimeError(
             ("First argument {} of type {} is not recognised as a supported "
@@ -282,6 +295,10 @@ class EmptySourceHeadNode(HeadNode):
 
         self.nentries = nentries
 
+    def _get_dataset_identifier(self) -> str:
+        """The RDataFrame of the tasks only depends on the number of entries."""
+        return _graph_cache.get_identifier(("EmptySource", self.nentries))
+
     def _build_ranges(self) -> List[Ranges.DataRange]:
         """Build the ranges for this dataset."""
         # Empty datasets cannot be processed distributedly
@@ -313,11 +330,10 @@ class EmptySourceHeadNode(HeadNode):
             """
             Builds an RDataFrame instance for a distributed mapper.
             """
-            if current_range.exec_id not in _graph_cache._RDF_REGISTER:
+            rdf_toprocess = _graph_cache.get_cached_rdf(current_range.exec_id)
+            if rdf_toprocess is None:
                 rdf_toprocess = ROOT.RDataFrame(nentries)
-                _graph_cache._RDF_REGISTER[current_range.exec_id] = rdf_toprocess
-            else:
-                rdf_toprocess = _graph_cache._RDF_REGISTER[current_range.exec_id]
+                _graph_cache.cache_rdf(current_range.exec_id, rdf_toprocess)
 
             ROOT.Internal.RDF.ChangeEmptyEntryRange(
                 ROOT.RDF.AsRNode(rdf_toprocess), (current_range.start, current_range.end))
@@ -366,9 +382,16 @@ class TreeHeadNode(HeadNode):
             information about friend trees of the dataset. Retrieved only if a
             TTree or TChain is passed to the constructor. Defaults to None.
 
+        partition_by (str): How the dataset is split in partitions. With
+            "files", every file weighs the same. With "bytes", the partitions
+            get the same amount of compressed bytes, which requires opening all
+            the input files when the ranges are built. In both cases the ranges
+            are aligned to the cluster boundaries of the trees.
+
     """
 
-    def __init__(self, backend: BaseBackend, npartitions: Optional[int], localdf: ROOT.RDataFrame, *args):
+    def __init__(self, backend: BaseBackend, npartitions: Optional[int], localdf: ROOT.RDataFrame, *args,
+                 partition_by: str = "files"):
         """
         Creates a new RDataFrame instance for the given arguments.
 
@@ -377,9 +400,13 @@ class TreeHeadNode(HeadNode):
 
             npartitions (int): The number of partitions the dataset will be
                 split in for distributed execution.
+
+            partition_by (str): Either "files" or "bytes".
         """
         super().__init__(backend, npartitions, localdf)
 
+        self.partition_by = partition_by
+
         self.defaultbranches = None
         # Information about friend trees, if they are present.
         self.friendinfo: Optional[ROOT.Internal.TreeUtils.RFriendInfo] = None
@@ -431,6 +458,23 @@ class TreeHeadNode(HeadNode):
         self.subtreenames = [str(treename) for treename in ROOT.Internal.TreeUtils.GetTreeFullPaths(self.tree)]
         self.inputfiles = [str(filename) for filename in ROOT.Internal.TreeUtils.GetFileNamesFromTree(self.tree)]
 
+    def _get_dataset_identifier(self) -> str:
+        """
+        The RDataFrame of the tasks depends on the trees, on the friends and on
+        the default branches.
+        """
+        friends = None
+        if self.friendinfo is not None:
+            friends = [
+                ((str(name), str(alias)), [str(f) for f in filenames], [str(n) for n in subnames])
+                for (name, alias), filenames, subnames in zip(self.friendinfo.fFriendNames,
+                                                              self.friendinfo.fFriendFileNames,
+                                                              self.friendinfo.fFriendChainSubNames)
+            ]
+        defaultbranches = [str(b) for b in self.defaultbranches] if self.defaultbranches is not None else None
+        return _graph_cache.get_identifier(
+            ("TTree", self.maintreename, self.subtreenames, self.inputfiles, friends, defaultbranches))
+
     def _build_ranges(self) -> List[Ranges.DataRange]:
         """Build the ranges for this dataset."""
         logger.debug("Building ranges from dataset info:\n"
@@ -455,7 +499,15 @@ class TreeHeadNode(HeadNode):
                         "chunks the dataset can be split in. Some tasks could be doing no work. Consider "
                         "setting the 'npartitions' parameter of the RDataFrame constructor to a lower value.")
 
-        return Ranges.get_percentage_ranges(self.subtreenames, self.inputfiles, self.npartitions, self.friendinfo, self.exec_id)
+        weights = None
+        if self.partition_by == "bytes":
+            weights = [
+                Ranges.get_compressed_bytes(treename, filename)
+                for treename, filename in zip(self.subtreenames, self.inputfiles)
+            ]
+
+        return Ranges.get_percentage_ranges(self.subtreenames, self.inputfiles, self.npartitions, self.friendinfo,
+                                            self.exec_id, weights)
 
     def _generate_rdf_creator(self) -> Callable[[Ranges.DataRange], TaskObjects]:
         """
@@ -509,13 +561,13 @@ class TreeHeadNode(HeadNode):
 
             attach_friend_info_if_present(clustered_range, ds)
 
-            if current_range.exec_id not in _graph_cache._RDF_REGISTER:
+            # Retrieve an already present RDataFrame from the cache
+            rdf_toprocess = _graph_cache.get_cached_rdf(current_range.exec_id)
+            if rdf_toprocess is None:
                 rdf_toprocess = ROOT.RDataFrame(ds)
                 # Fill the cache with the new RDataFrame
-                _graph_cache._RDF_REGISTER[current_range.exec_id] = rdf_toprocess
+                _graph_cache.cache_rdf(current_range.exec_id, rdf_toprocess)
             else:
-                # Retrieve an already present RDataFrame from the cache
-                rdf_toprocess = _graph_cache._RDF_REGISTER[current_range.exec_id]
                 # Update it to the range of entries for this task
                 ROOT.Internal.RDF.ChangeSpec(ROOT.RDF.AsRNode(rdf_toprocess), ROOT.std.move(ds))
 
@@ -2,10 +2,11 @@ from __future__ import annotations
 
 import logging
 
-from bisect import bisect_left
+from bisect import bisect_left, bisect_right
 from dataclasses import dataclass, field
 from itertools import accumulate
 from math import floor
+from urllib.parse import urlsplit
 
 from typing import Dict, List, Optional, Tuple, TYPE_CHECKING
 
@@ -73,6 +74,9 @@ class TreeRangePerc(DataRange):
     friendinfo: Information about friend trees of the chain built for this
         range. Not None if the user provided a TTree or TChain in the
         distributed RDataFrame constructor.
+
+    hosts: Names of the hosts storing the files read by this range. The
+        backends can use them as a hint to schedule the task close to the data.
     """
     treenames: List[str]
     filenames: List[str]
@@ -81,6 +85,7 @@ class TreeRangePerc(DataRange):
     first_tree_start_perc: float
     last_tree_end_perc: float
     friendinfo: Optional[ROOT.Internal.TreeUtils.RFriendInfo]
+    hosts: List[str] = field(default_factory=list)
 
 
 @dataclass
@@ -193,12 +198,77 @@ def get_clusters_and_entries(treename: str, filename: str) -> Tuple[List[int], i
     return clusters, entries
 
 
+def get_compressed_bytes(treename: str, filename: str) -> int:
+    """
+    Retrieve the size on disk of the baskets of a TTree.
+    """
+
+    with ROOT.TFile.Open(filename, "READ_WITHOUT_GLOBALREGISTRATION") as tfile:
+        return tfile.Get(treename).GetZipBytes()
+
+
+def get_file_host(filename: str) -> str:
+    """
+    Retrieve the name of the host storing a file from its URL, e.g. 'eosuser.cern.ch'
+    for 'root://eosuser.cern.ch//eos/user/file.root'. Local files have no host,
+    in that case an empty string is returned.
+    """
+    try:
+        return urlsplit(filename).hostname or ""
+    except ValueError:
+        return ""
+
+
+def get_preferred_hosts(datarange: DataRange) -> List[str]:
+    """
+    Retrieve the hosts where a range should preferably be processed, an empty
+    list means that the range has no preference.
+    """
+    return datarange.hosts if isinstance(datarange, TreeRangePerc) else []
+
+
+def get_weighted_percentages(weights: List[float], npartitions: int) -> List[float]:
+    """
+    Split a list of files in npartitions, so that each partition gets the same
+    share of the total weight of the files. The weight of a file is assumed to
+    be uniformly distributed across its entries.
+
+    Returns:
+        The npartitions+1 boundaries of the partitions, expressed as in
+        get_percentage_ranges: the integer part is the index of a file and the
+        fractional part is the percentage of that file. The first and last
+        boundaries are always 0 and the number of files.
+
+    Example with weights = [2, 1, 1] and npartitions = 4:
+        [0., 0.5, 1., 2., 3.]
+    """
+    nfiles = len(weights)
+    cumulative_weights = list(accumulate([0] + list(weights)))
+    total_weight = cumulative_weights[-1]
+    if total_weight <= 0:
+        # Nothing to balance, e.g. all the trees are empty
+        return [nfiles / npartitions * i for i in range(npartitions+1)]
+
+    percentages = [0.]
+    for i in range(1, npartitions):
+        boundary = total_weight * i / npartitions
+        # The last file starting at or before the boundary. Files without weight
+        # are skipped, so that they always fall entirely inside a partition.
+        file_idx = bisect_right(cumulative_weights, boundary) - 1
+        percentages.append(file_idx + (boundary - cumulative_weights[file_idx]) / weights[file_idx])
+    percentages.append(float(nfiles))
+    return percentages
+
+
 def get_percentage_ranges(treenames: List[str], filenames: List[str], npartitions: int,
                           friendinfo: Optional[ROOT.Internal.TreeUtils.RFriendInfo],
-                          exec_id: ExecutionIdentifier) -> List[TreeRangePerc]:
+                          exec_id: ExecutionIdentifier,
+                          weights: Optional[List[float]] = None) -> List[TreeRangePerc]:
     """
     Create a list of tasks that will process the given trees partitioning them
-    by percentages.
+    by percentages. By default, every file weighs the same. If weights are given,
+    e.g. the compressed bytes of each tree, the partitions are balanced according
+    to them instead.
     """
     nfiles = len(filenames)
     files_per_partition = nfiles / npartitions
@@ -212,7 +282,10 @@ def get_percentage_ranges(treenames: List[str], filenames: List[str], npartition
     # percentages = [0., 1.428, 2.857, 4.285, 5.714, 7.142, 8.571, 10.]
     # files_of_percentages = [0, 1, 2, 4, 5, 7, 8, 10]
     # percentages_wrt_files = [0., 0.428, 0.857, 0.285, 0.714, 0.142, 0.571, 0.]
-    percentages = [files_per_partition * i for i in range(npartitions+1)]
+    if weights is None:
+        percentages = [files_per_partition * i for i in range(npartitions+1)]
+    else:
+        percentages = get_weighted_percentages(weights, npartitions)
     files_of_percentages = [floor(percentage) for percentage in percentages]
     percentages_wrt_files = [perc - file for perc, file in zip(percentages, files_of_percentages)]
 
@@ -240,13 +313,21 @@ def get_percentage_ranges(treenames: List[str], filenames: List[str], npartition
     # thus we set it to one.
     last_tree_end_perc_tasks = [perc if perc > 0 else 1 for perc in percentages_wrt_files[1:]]
 
+    # The hosts storing the files of each task, in the order of the files
+    file_hosts = [get_file_host(filename) for filename in filenames]
+    hosts_tasks = [
+        list(dict.fromkeys(host for host in file_hosts[s:e] if host))
+        for s, e in zip(start_sample_idxs, end_sample_idxs)
+    ]
+
     if friendinfo is not None:
         # We need to transmit the full list of treenames and filenames to each
         # task, in order to properly align the full dataset considering friends.
         return [
             TreeRangePerc(
                 exec_id, rangeid, treenames, filenames, start_sample_idxs[rangeid], end_sample_idxs[rangeid],
-                first_tree_start_perc_tasks[rangeid], last_tree_end_perc_tasks[rangeid], friendinfo)
+                first_tree_start_perc_tasks[rangeid], last_tree_end_perc_tasks[rangeid], friendinfo,
+                hosts_tasks[rangeid])
             for rangeid in range(npartitions)
         ]
     else:
@@ -263,7 +344,8 @@ def get_percentage_ranges(treenames: List[str], filenames: List[str], npartition
         return [
             TreeRangePerc(
                 exec_id, rangeid, tasktreenames[rangeid], taskfilenames[rangeid], 0, len(taskfilenames[rangeid]),
-                first_tree_start_perc_tasks[rangeid], last_tree_end_perc_tasks[rangeid], friendinfo
+                first_tree_start_perc_tasks[rangeid], last_tree_end_perc_tasks[rangeid], friendinfo,
+                hosts_tasks[rangeid]
             )
             for rangeid in range(npartitions)
         ]
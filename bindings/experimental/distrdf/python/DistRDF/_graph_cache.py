@@ -1,11 +1,14 @@
 from __future__ import annotations
 from dataclasses import dataclass
 
+import hashlib
+import pickle
 import uuid
-from typing import Dict, TYPE_CHECKING
+from typing import Dict, Optional, TYPE_CHECKING
 
 if TYPE_CHECKING:
     import ROOT
+    from DistRDF.Node import Node
     from DistRDF.PythonMergeables import RDataFrameFutureResult
 
 
@@ -18,13 +21,69 @@ class ExecutionIdentifier:
 
     Attributes:
 
-    rdf_uuid: An identifier for the specific RDataFrame instance.
+    rdf_uuid: An identifier for the dataset of the RDataFrame instance.
     graph_uuid: An identifier for the computation graph sent to the workers for
-        the current execution.
+        the current execution. Executions of the same graph on the same dataset,
+        also from different RDataFrame instances, share it so that the worker
+        processes can reuse the RDataFrame and the jitted code they already built.
     """
-    rdf_uuid: uuid.UUID
-    graph_uuid: uuid.UUID
+    rdf_uuid: str
+    graph_uuid: str
 
 
+# Maximum number of executions cached in a worker process. The least recently
+# used ones are evicted first, together with their actions.
+_MAX_CACHED_EXECUTIONS = 32
+
 _RDF_REGISTER: Dict[ExecutionIdentifier, ROOT.RDataFrame] = {}
 _ACTIONS_REGISTER: Dict[ExecutionIdentifier, RDataFrameFutureResult] = {}
+
+
+def get_identifier(description) -> str:
+    """
+    Hash of a picklable description of a dataset or of a computation graph. If
+    the description cannot be pickled, e.g. because it contains a Python
+    callable, a unique identifier is returned instead, which disables the reuse.
+    """
+    try:
+        return hashlib.sha256(pickle.dumps(description)).hexdigest()
+    except (pickle.PicklingError, TypeError, AttributeError):
+        return uuid.uuid4().hex
+
+
+def get_graph_identifier(graph: Dict[int, Node]) -> str:
+    """
+    Identifier of a computation graph. It depends on the operations and on the
+    structure of the graph but not on the ids of its nodes, which grow with
+    every node created by the application.
+    """
+    positions = {node_id: position for position, node_id in enumerate(graph)}
+    description = [
+        (positions.get(node.parent_id), type(node.operation).__name__, node.operation.name,
+         node.operation.args, node.operation.kwargs) if node.operation is not None else None
+        for node in graph.values()
+    ]
+    return get_identifier(description)
+
+
+def get_cached_rdf(exec_id: ExecutionIdentifier) -> Optional[ROOT.RDataFrame]:
+    """
+    Returns the RDataFrame cached for this execution, or None. The execution
+    is marked as the most recently used one.
+    """
+    rdf = _RDF_REGISTER.pop(exec_id, None)
+    if rdf is not None:
+        _RDF_REGISTER[exec_id] = rdf
+    return rdf
+
+
+def cache_rdf(exec_id: ExecutionIdentifier, rdf: ROOT.RDataFrame) -> None:
+    """
+    Caches the RDataFrame of this execution, evicting the least recently used
+    executions if the cache is full.
+    """
+    while len(_RDF_REGISTER) >= _MAX_CACHED_EXECUTIONS:
+        oldest = next(iter(_RDF_REGISTER))
+        del _RDF_REGISTER[oldest]
+        _ACTIONS_REGISTER.pop(oldest, None)
+    _RDF_REGISTER[exec_id] = rdf
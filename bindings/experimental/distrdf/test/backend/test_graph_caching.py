@@ -187,6 +187,29 @@ class GraphCaching(unittest.TestCase):
                 for cached_rdf in _RDF_REGISTER.values():
                     self.assertEqual(cached_rdf.GetNRuns(), npartitions)
 
+    def test_same_graph_different_dataframes(self):
+        """The caches are reused by the executions of the same graph on the same dataset."""
+        treename = "myTree"
+        filenames = ["4clusters.root"] * 2
+        nentries = 2000
+        backend = GraphCaching.TestBackend()
+        npartitions = 4
+
+        for _ in range(2):
+            headnode = get_headnode(backend, npartitions, treename, filenames)
+            distrdf = RDataFrame(headnode).Define("x", "2")
+            self.assertEqual(distrdf.Sum("x").GetValue(), 2 * nentries)
+
+        # The second execution reused the RDataFrame built by the first one
+        self.assertEqual(len(_RDF_REGISTER), 1)
+        self.assertEqual(len(_ACTIONS_REGISTER), len(_RDF_REGISTER))
+        cached_rdf = tuple(_RDF_REGISTER.values())[0]
+        self.assertEqual(cached_rdf.GetNRuns(), 2 * npartitions)
+
+        # A different graph on the same dataset is cached separately
+        self.assertEqual(distrdf.Define("y", "x*2").Sum("y").GetValue(), 4 * nentries)
+        self.assertEqual(len(_RDF_REGISTER), 2)
+
 
 if __name__ == "__main__":
     unittest.main()
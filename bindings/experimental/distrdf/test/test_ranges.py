@@ -416,6 +416,51 @@ class TreeRanges(unittest.TestCase):
 
         self.assertListEqual(ranges, ranges_reqd)
 
+    def test_three_files_weighted_partitions(self):
+        """
+        Create partitions balanced according to the weights of the files.
+        """
+        nfiles = 3
+        treenames = [f"tree_{i}" for i in range(nfiles)]
+        filenames = [f"distrdf_unittests_file_{i}.root" for i in range(nfiles)]
+        npartitions = 4
+
+        percranges = Ranges.get_percentage_ranges(treenames, filenames, npartitions, friendinfo=None, exec_id=None,
+                                                  weights=[2, 1, 1])
+        clusteredranges = [Ranges.get_clustered_range_from_percs(percrange)[0] for percrange in percranges]
+
+        ranges = treeranges_to_tuples(clusteredranges)
+        ranges_reqd = [
+            (0, 50, [filenames[0]]),
+            (50, 100, [filenames[0]]),
+            (0, 100, [filenames[1]]),
+            (0, 100, [filenames[2]]),
+        ]
+
+        self.assertListEqual(ranges, ranges_reqd)
+
+    def test_weighted_percentages(self):
+        """
+        Files without weight are never split and uniform weights are the
+        same as the default partitioning.
+        """
+        self.assertListEqual(Ranges.get_weighted_percentages([1, 0, 1], 2), [0., 2., 3.])
+        self.assertListEqual(Ranges.get_weighted_percentages([5, 5, 5], 3), [0., 1., 2., 3.])
+        self.assertListEqual(Ranges.get_weighted_percentages([0, 0], 2), [0., 1., 2.])
+
+    def test_hosts_of_ranges(self):
+        """
+        The ranges carry the hosts of the remote files they read.
+        """
+        treenames = ["tree"] * 3
+        filenames = ["root://host1.cern.ch//data/f0.root", "root://host2.cern.ch:1094//data/f1.root",
+                     "localfile.root"]
+
+        percranges = Ranges.get_percentage_ranges(treenames, filenames, 2, friendinfo=None, exec_id=None)
+
+        self.assertListEqual([Ranges.get_preferred_hosts(r) for r in percranges],
+                             [["host1.cern.ch", "host2.cern.ch"], ["host2.cern.ch"]])
+
     def test_three_files_partitions_equal_clusters(self):
         """
         Create as many partitions as clusters in the dataset.
@@ -0,0 +1,226 @@
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_RNTUPLEBATCHREADER
+#define ROOT_RNTUPLEBATCHREADER
+
+#include "ROOT/RNTuple.hxx"
+#include "ROOT/RNTupleDescriptor.hxx"
+#include "ROOT/RNTupleView.hxx"
+#include "ROOT/RSpan.hxx"
+#include "ROOT/RTreeBatchReader.hxx"
+
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace ROOT {
+
+namespace Internal {
+
+namespace PyROOT {
+
+/// Reads the values of a field of an RNTuple for a range of entries into an RBatchColumn
+class RNTupleColumnReaderBase {
+public:
+   virtual ~RNTupleColumnReaderBase() = default;
+   virtual void Read(ROOT::Experimental::NTupleSize_t begin, ROOT::Experimental::NTupleSize_t end,
+                     RBatchColumn &column) = 0;
+};
+
+/// Reads a field of a fundamental type, copying the values page by page
+template <typename T>
+class RNTupleScalarReader final : public RNTupleColumnReaderBase {
+   ROOT::Experimental::RNTupleView<T> fView;
+
+public:
+   RNTupleScalarReader(ROOT::Experimental::RNTupleReader &reader, const std::string &name)
+      : fView(reader.GetView<T>(name))
+   {
+   }
+
+   void Read(ROOT::Experimental::NTupleSize_t begin, ROOT::Experimental::NTupleSize_t end,
+             RBatchColumn &column) final
+   {
+      column.fValues.resize((end - begin) * sizeof(T));
+      fView.ReadV(begin, std::span<T>(reinterpret_cast<T *>(column.fValues.data()), end - begin));
+   }
+};
+
+/// Reads a field of collections of a fundamental type, e.g. std::vector<float>, copying the items of the
+/// collections page by page
+template <typename T>
+class RNTupleCollectionReader final : public RNTupleColumnReaderBase {
+   ROOT::Experimental::RNTupleViewCollection fCollection;
+   ROOT::Experimental::RNTupleView<T> fItems;
+
+public:
+   RNTupleCollectionReader(ROOT::Experimental::RNTupleReader &reader, const std::string &name)
+      : fCollection(reader.GetViewCollection(name)), fItems(fCollection.GetView<T>("_0"))
+   {
+   }
+
+   void Read(ROOT::Experimental::NTupleSize_t begin, ROOT::Experimental::NTupleSize_t end,
+             RBatchColumn &column) final
+   {
+      column.fValues.clear();
+      column.fOffsets.assign(1, 0);
+      for (auto entry = begin; entry < end; ++entry) {
+         auto range = fCollection.GetCollectionRange(entry);
+         const ROOT::Experimental::RClusterIndex first = *range.begin();
+         const auto size = (*range.end()).GetIndex() - first.GetIndex();
+         const auto nBytes = column.fValues.size();
+         column.fValues.resize(nBytes + size * sizeof(T));
+         auto dest = reinterpret_cast<T *>(column.fValues.data() + nBytes);
+         for (ROOT::Experimental::NTupleSize_t nCopied = 0; nCopied < size;) {
+            ROOT::Experimental::NTupleSize_t nItems = 0;
+            const T *items = fItems.MapV(
+               ROOT::Experimental::RClusterIndex(first.GetClusterId(), first.GetIndex() + nCopied), nItems);
+            const auto nCopy = std::min<ROOT::Experimental::NTupleSize_t>(nItems, size - nCopied);
+            std::copy(items, items + nCopy, dest + nCopied);
+            nCopied += nCopy;
+         }
+         column.fOffsets.push_back(column.fOffsets.back() + size);
+      }
+   }
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////
+/// \brief Reads batches of consecutive entries of the top-level fields of an RNTuple
+///
+/// The values are copied from the pages with RNTupleView::MapV, without going through an
+/// REntry. It supports the fields of fundamental types and the std::vector and ROOT::RVec
+/// collections of fundamental types other than bool.
+class R__CLING_PTRCHECK(off) RNTupleBatchReader {
+   ROOT::Experimental::RNTupleReader &fReader;
+   std::vector<RBatchColumn> fColumns;
+   std::vector<std::unique_ptr<RNTupleColumnReaderBase>> fColumnReaders;
+
+   template <typename T>
+   static std::unique_ptr<RNTupleColumnReaderBase>
+   MakeColumnReader(ROOT::Experimental::RNTupleReader &reader, const std::string &name, bool isCollection)
+   {
+      if (isCollection)
+         return std::make_unique<RNTupleCollectionReader<T>>(reader, name);
+      return std::make_unique<RNTupleScalarReader<T>>(reader, name);
+   }
+
+   std::unique_ptr<RNTupleColumnReaderBase> MakeColumnReader(RBatchColumn &column, const std::string &typeName)
+   {
+      std::string itemType = typeName;
+      column.fLength = 1;
+      for (const std::string prefix : {"std::vector<", "ROOT::VecOps::RVec<"}) {
+         if (typeName.compare(0, prefix.size(), prefix) == 0 && typeName.back() == '>') {
+            itemType = typeName.substr(prefix.size(), typeName.size() - prefix.size() - 1);
+            column.fLength = 0;
+         }
+      }
+      const bool isCollection = column.fLength == 0;
+      const auto &name = column.fName;
+
+      if (itemType == "bool" && !isCollection) {
+         column.fDType = "b1";
+         return MakeColumnReader<bool>(fReader, name, false);
+      }
+      if (itemType == "char" || itemType == "std::int8_t") {
+         column.fDType = "i1";
+         return itemType == "char" ? MakeColumnReader<char>(fReader, name, isCollection)
+                                   : MakeColumnReader<std::int8_t>(fReader, name, isCollection);
+      }
+      if (itemType == "std::uint8_t") {
+         column.fDType = "u1";
+         return MakeColumnReader<std::uint8_t>(fReader, name, isCollection);
+      }
+      if (itemType == "std::int16_t") {
+         column.fDType = "i2";
+         return MakeColumnReader<std::int16_t>(fReader, name, isCollection);
+      }
+      if (itemType == "std::uint16_t") {
+         column.fDType = "u2";
+         return MakeColumnReader<std::uint16_t>(fReader, name, isCollection);
+      }
+      if (itemType == "std::int32_t") {
+         column.fDType = "i4";
+         return MakeColumnReader<std::int32_t>(fReader, name, isCollection);
+      }
+      if (itemType == "std::uint32_t") {
+         column.fDType = "u4";
+         return MakeColumnReader<std::uint32_t>(fReader, name, isCollection);
+      }
+      if (itemType == "std::int64_t") {
+         column.fDType = "i8";
+         return MakeColumnReader<std::int64_t>(fReader, name, isCollection);
+      }
+      if (itemType == "std::uint64_t") {
+         column.fDType = "u8";
+         return MakeColumnReader<std::uint64_t>(fReader, name, isCollection);
+      }
+      if (itemType == "float") {
+         column.fDType = "f4";
+         return MakeColumnReader<float>(fReader, name, isCollection);
+      }
+      if (itemType == "double") {
+         column.fDType = "f8";
+         return MakeColumnReader<double>(fReader, name, isCollection);
+      }
+      throw std::runtime_error("RNTupleBatchReader: field \"" + name + "\" of type " + typeName +
+                               " cannot be read in batches, only fundamental types and their std::vectors and "
+                               "RVecs are supported; use RDataFrame.AsNumpy instead");
+   }
+
+public:
+   RNTupleBatchReader(ROOT::Experimental::RNTupleReader &reader, const std::vector<std::string> &fields)
+      : fReader(reader)
+   {
+      const auto *descriptor = fReader.GetDescriptor();
+      for (const auto &name : fields) {
+         const auto fieldId = descriptor->FindFieldId(name);
+         if (fieldId == ROOT::Experimental::kInvalidDescriptorId)
+            throw std::runtime_error("RNTupleBatchReader: no field named \"" + name + "\"");
+         fColumns.emplace_back();
+         fColumns.back().fName = name;
+         fColumnReaders.emplace_back(
+            MakeColumnReader(fColumns.back(), descriptor->GetFieldDescriptor(fieldId).GetTypeName()));
+      }
+   }
+
+   /// Read the entries [begin, begin + maxEntries), or less at the end of the RNTuple.
+   /// Returns the number of entries read, 0 at the end of the RNTuple.
+   Long64_t ReadBatch(Long64_t begin, Long64_t maxEntries)
+   {
+      const Long64_t nEntries = fReader.GetNEntries();
+      if (begin >= nEntries)
+         return 0;
+      const Long64_t end = std::min(begin + maxEntries, nEntries);
+      for (std::size_t i = 0; i < fColumns.size(); ++i)
+         fColumnReaders[i]->Read(begin, end, fColumns[i]);
+      return end - begin;
+   }
+
+   const std::vector<RBatchColumn> &GetColumns() const { return fColumns; }
+
+   /// The names of the top-level fields of the given RNTuple
+   static std::vector<std::string> GetFieldNames(ROOT::Experimental::RNTupleReader &reader)
+   {
+      std::vector<std::string> names;
+      for (const auto &field : reader.GetDescriptor()->GetTopLevelFields())
+         names.emplace_back(field.GetFieldName());
+      return names;
+   }
+};
+
+} // namespace PyROOT
+
+} // namespace Internal
+
+} // namespace ROOT
+
+#endif // ROOT_RNTUPLEBATCHREADER
@@ -42,19 +42,15 @@ namespace RDF {
 /// arrays, with RVecs allows to read arbitrary data from memory.
 /// In addition, the data source has to keep a reference on the Python owned data
 /// so that the lifetime of the data is tied to the datasource.
+/// The values are not copied: the column readers point directly to the current
+/// element of the arrays.
 template <typename... ColumnTypes>
 class RNumpyDS final : public ROOT::RDF::RDataSource {
-   using PointerHolderPtrs_t = std::vector<ROOT::Internal::TDS::TPointerHolder *>;
-
    std::tuple<ROOT::RVec<ColumnTypes>*...> fColumns;
    const std::vector<std::string> fColNames;
    const std::map<std::string, std::string> fColTypesMap;
-   // The role of the fPointerHoldersModels is to be initialised with the pack
-   // of arguments in the constrcutor signature at construction time
-   // Once the number of slots is known, the fPointerHolders are initialised
-   // according to the models.
-   const PointerHolderPtrs_t fPointerHoldersModels;
-   std::vector<PointerHolderPtrs_t> fPointerHolders;
+   // Address of the current element of each column, per slot: fValuePtrs[column][slot]
+   std::vector<std::vector<void *>> fValuePtrs;
    std::vector<std::pair<ULong64_t, ULong64_t>> fEntryRanges{};
    unsigned int fNSlots{0};
    // Pointer to PyObject holding RVecs
@@ -87,7 +83,7 @@ class RNumpyDS final : public ROOT::RDF::RDataSource {
 
       Record_t ret(fNSlots);
       for (auto slot : ROOT::TSeqU(fNSlots)) {
-         ret[slot] = fPointerHolders[index][slot]->GetPointerAddr();
+         ret[slot] = &fValuePtrs[index][slot];
       }
       return ret;
    }
@@ -96,8 +92,7 @@ class RNumpyDS final : public ROOT::RDF::RDataSource {
    template <std::size_t... S>
    void SetEntryHelper(unsigned int slot, ULong64_t entry, std::index_sequence<S...>)
    {
-      std::initializer_list<int> expander{
-         (*static_cast<ColumnTypes *>(fPointerHolders[S][slot]->GetPointer()) = (*std::get<S>(fColumns))[entry], 0)...};
+      std::initializer_list<int> expander{(fValuePtrs[S][slot] = std::get<S>(fColumns)->data() + entry, 0)...};
       (void)expander; // avoid unused variable warnings
    }
 
@@ -131,7 +126,6 @@ public:
       : fColumns(std::tuple<ROOT::RVec<ColumnTypes>*...>(colsNameVals.second...)),
         fColNames({colsNameVals.first...}),
         fColTypesMap({{colsNameVals.first, ROOT::Internal::RDF::TypeID2TypeName(typeid(ColumnTypes))}...}),
-        fPointerHoldersModels({new ROOT::Internal::TDS::TTypedPointerHolder<ColumnTypes>(new ColumnTypes())...}),
         fPyRVecs(pyRVecs)
    {
       // Take a reference to the data associated with this data source
@@ -140,11 +134,6 @@ public:
 
    ~RNumpyDS()
    {
-      for (auto &&ptrHolderv : fPointerHolders) {
-         for (auto &&ptrHolder : ptrHolderv) {
-            delete ptrHolder;
-         }
-      }
       // Release the data associated to this data source
       Py_DECREF(fPyRVecs);
    }
@@ -179,19 +168,7 @@ public:
    void SetNSlots(unsigned int nSlots)
    {
       fNSlots = nSlots;
-      const auto nCols = fColNames.size();
-      fPointerHolders.resize(nCols); // now we need to fill it with the slots, all of the same type
-      auto colIndex = 0U;
-      for (auto &&ptrHolderv : fPointerHolders) {
-         for (auto slot : ROOT::TSeqI(fNSlots)) {
-            auto ptrHolder = fPointerHoldersModels[colIndex]->GetDeepCopy();
-            ptrHolderv.emplace_back(ptrHolder);
-            (void)slot;
-         }
-         colIndex++;
-      }
-      for (auto &&ptrHolder : fPointerHoldersModels)
-         delete ptrHolder;
+      fValuePtrs.assign(fColNames.size(), std::vector<void *>(fNSlots, nullptr));
    }
 
    void Initialize()
@@ -0,0 +1,115 @@
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_RTAKEFLATHELPER
+#define ROOT_RTAKEFLATHELPER
+
+#include "ROOT/RDataFrame.hxx"
+#include "ROOT/RDF/RActionImpl.hxx"
+#include "ROOT/TypeTraits.hxx"
+
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace ROOT {
+
+namespace Internal {
+
+namespace RDF {
+
+////////////////////////////////////////////////////////////////////////////////////////////////
+/// \brief The content of a column of collections in the offsets and values layout
+///
+/// The elements of all the collections are stored one after the other in fValues, the elements
+/// of the i-th collection are in the range [fOffsets[i], fOffsets[i+1]). This is the layout of
+/// the ListOffsetArray of awkward-array.
+template <typename T>
+struct RFlatColumn {
+   std::vector<T> fValues;
+   std::vector<Long64_t> fOffsets{0};
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////
+/// \brief An action helper which takes the collections of a column into an RFlatColumn
+///
+/// Each slot appends the elements of its collections to its own buffers, which are concatenated
+/// in the order of the slots at the end of the event loop, as Take does. It avoids the creation
+/// of one object per collection, so the values can be read out in Python as numpy arrays
+/// without conversion.
+template <typename COLL>
+class R__CLING_PTRCHECK(off) TakeFlatHelper : public ROOT::Detail::RDF::RActionImpl<TakeFlatHelper<COLL>> {
+public:
+   using Value_t = typename COLL::value_type;
+   using Result_t = RFlatColumn<Value_t>;
+   using ColumnTypes_t = ROOT::TypeTraits::TypeList<COLL>;
+   static_assert(std::is_arithmetic<Value_t>::value && !std::is_same<Value_t, bool>::value,
+                 "TakeFlat requires collections of numbers");
+
+private:
+   std::shared_ptr<Result_t> fResult;
+   std::vector<Result_t> fPartials; ///< Buffers of the slots other than the first one
+
+public:
+   TakeFlatHelper(unsigned int nSlots) : fResult(std::make_shared<Result_t>()), fPartials(nSlots > 1 ? nSlots - 1 : 0)
+   {
+   }
+   TakeFlatHelper(TakeFlatHelper &&) = default;
+   TakeFlatHelper(const TakeFlatHelper &) = delete;
+
+   std::shared_ptr<Result_t> GetResultPtr() const { return fResult; }
+
+   void Initialize() {}
+
+   void InitTask(TTreeReader *, unsigned int) {}
+
+   void Exec(unsigned int slot, const COLL &coll)
+   {
+      auto &result = slot == 0 ? *fResult : fPartials[slot - 1];
+      result.fValues.insert(result.fValues.end(), coll.begin(), coll.end());
+      result.fOffsets.push_back(result.fValues.size());
+   }
+
+   void Finalize()
+   {
+      auto nValues = fResult->fValues.size();
+      auto nOffsets = fResult->fOffsets.size();
+      for (const auto &partial : fPartials) {
+         nValues += partial.fValues.size();
+         nOffsets += partial.fOffsets.size() - 1;
+      }
+      fResult->fValues.reserve(nValues);
+      fResult->fOffsets.reserve(nOffsets);
+      for (auto &partial : fPartials) {
+         const Long64_t start = fResult->fValues.size();
+         fResult->fValues.insert(fResult->fValues.end(), partial.fValues.begin(), partial.fValues.end());
+         for (std::size_t i = 1; i < partial.fOffsets.size(); ++i)
+            fResult->fOffsets.push_back(start + partial.fOffsets[i]);
+         partial = Result_t();
+      }
+   }
+
+   std::string GetActionName() { return "TakeFlat"; }
+};
+
+/// Book a TakeFlatHelper on the given column of collections, e.g. of type ROOT::RVec<float>
+template <typename COLL>
+ROOT::RDF::RResultPtr<RFlatColumn<typename COLL::value_type>>
+TakeFlat(ROOT::RDF::RNode df, const std::string &column)
+{
+   return df.Book<COLL>(TakeFlatHelper<COLL>(df.GetNSlots()), {column});
+}
+
+} // namespace RDF
+
+} // namespace Internal
+
+} // namespace ROOT
+
+#endif // ROOT_RTAKEFLATHELPER
@@ -0,0 +1,216 @@
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_RTREEBATCHREADER
+#define ROOT_RTREEBATCHREADER
+
+#include "TBranch.h"
+#include "TBufferFile.h"
+#include "TClass.h"
+#include "TDataType.h"
+#include "TLeaf.h"
+#include "TMath.h"
+#include "TTree.h"
+#include "TVirtualCollectionProxy.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace ROOT {
+
+namespace Internal {
+
+namespace PyROOT {
+
+////////////////////////////////////////////////////////////////////////////////////////////////
+/// \brief The values of a column for a batch of entries, to be read out in Python as numpy arrays
+///
+/// The values of all the entries are stored one after the other in fValues, in the native byte
+/// order. For columns of collections, the values of the i-th entry are in the range
+/// [fOffsets[i], fOffsets[i+1]), the layout of the ListOffsetArray of awkward-array.
+struct RBatchColumn {
+   std::string fName;
+   /// The numpy kind and size of the values, e.g. "f4" for float or "b1" for bool
+   std::string fDType;
+   /// Number of values per entry: 1 for scalars, the array size for fixed-size arrays, 0 for collections
+   Long64_t fLength = 1;
+   std::vector<char> fValues;
+   std::vector<Long64_t> fOffsets; ///< Only filled for collections, starts with 0
+
+   std::size_t GetNValues() const { return fDType.empty() ? 0 : fValues.size() / std::stoi(fDType.substr(1)); }
+   std::uintptr_t GetValuesAddress() const { return reinterpret_cast<std::uintptr_t>(fValues.data()); }
+   std::uintptr_t GetOffsetsAddress() const { return reinterpret_cast<std::uintptr_t>(fOffsets.data()); }
+};
+
+/// The numpy kind and size of the given fundamental type, or an empty string if numpy has no equivalent
+inline std::string GetNumpyDType(EDataType type)
+{
+   switch (type) {
+   case kBool_t: return "b1";
+   case kChar_t: return "i1";
+   case kUChar_t: return "u1";
+   case kShort_t: return "i2";
+   case kUShort_t: return "u2";
+   case kInt_t: return "i4";
+   case kUInt_t: return "u4";
+   case kLong_t:
+   case kLong64_t: return "i8";
+   case kULong_t:
+   case kULong64_t: return "u8";
+   case kFloat_t: return "f4";
+   case kDouble_t: return "f8";
+   default: return "";
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////
+/// \brief Reads batches of consecutive entries of the branches of a TTree or TChain with bulk I/O
+///
+/// The branches are read one basket at a time with TBranch::GetBulkEntries, which deserializes
+/// all the entries of a basket in one go instead of one entry at a time. It supports the
+/// branches of fundamental types, their fixed-size and variable-size arrays and std::vectors of
+/// fundamental types, see TBranch::SupportsBulkReadWithOffsets(). A batch never spans two trees
+/// of a TChain.
+class R__CLING_PTRCHECK(off) RTreeBatchReader {
+   /// A branch of the current tree and the last basket read from it
+   struct RBranchState {
+      TBranch *fBranch = nullptr;
+      Int_t fElementSize = 0;
+      TBufferFile fBuffer{TBuffer::kWrite, 32 * 1024};
+      std::vector<Int_t> fBasketOffsets;
+      Long64_t fBasketFirst = -1; ///< First entry of the basket in the buffer, in the current tree
+      Int_t fBasketEntries = 0;
+   };
+
+   TTree *fTree;
+   std::vector<RBatchColumn> fColumns;
+   std::vector<std::unique_ptr<RBranchState>> fBranches;
+   Int_t fTreeNumber = -1;
+   TTree *fCurrentTree = nullptr;
+
+   void ConnectBranches()
+   {
+      for (std::size_t i = 0; i < fColumns.size(); ++i) {
+         auto &column = fColumns[i];
+         TBranch *branch = fCurrentTree->GetBranch(column.fName.c_str());
+         if (!branch)
+            throw std::runtime_error("RTreeBatchReader: no branch named \"" + column.fName + "\" in tree \"" +
+                                     fCurrentTree->GetName() + "\"");
+         if (!branch->GetBulkRead().SupportsBulkReadWithOffsets())
+            throw std::runtime_error("RTreeBatchReader: branch \"" + column.fName +
+                                     "\" cannot be read in batches, only fundamental types, their arrays and "
+                                     "std::vectors are supported; use RDataFrame.AsNumpy instead");
+
+         TClass *cl = nullptr;
+         EDataType type = kOther_t;
+         branch->GetExpectedType(cl, type);
+         Long64_t length = 0;
+         if (cl) {
+            type = cl->GetCollectionProxy()->GetType();
+         } else {
+            auto leaf = static_cast<TLeaf *>(branch->GetListOfLeaves()->At(0));
+            length = leaf->GetLeafCount() ? 0 : leaf->GetLenStatic();
+         }
+         const auto dtype = GetNumpyDType(type);
+         if (dtype.empty())
+            throw std::runtime_error("RTreeBatchReader: the type of branch \"" + column.fName +
+                                     "\" has no numpy equivalent");
+         if (!column.fDType.empty() && (dtype != column.fDType || length != column.fLength))
+            throw std::runtime_error("RTreeBatchReader: branch \"" + column.fName +
+                                     "\" changes type between the trees of the chain");
+         column.fDType = dtype;
+         column.fLength = length;
+
+         auto &state = *fBranches[i];
+         state.fBranch = branch;
+         state.fElementSize = std::stoi(dtype.substr(1));
+         state.fBasketFirst = -1;
+         state.fBasketEntries = 0;
+      }
+   }
+
+   void LoadBasket(RBranchState &state, Long64_t entry)
+   {
+      // The last basket of a tree can still be in memory, it starts at fBasketEntry[fWriteBasket]
+      const Long64_t nBaskets = state.fBranch->GetWriteBasket() + 1;
+      const Long64_t index = TMath::BinarySearch(nBaskets, state.fBranch->GetBasketEntry(), entry);
+      const Long64_t first = state.fBranch->GetBasketEntry()[std::max(index, Long64_t(0))];
+      const Int_t n = state.fBranch->GetBulkRead().GetBulkEntries(first, state.fBuffer, state.fBasketOffsets);
+      if (n <= 0 || entry >= first + n)
+         throw std::runtime_error(std::string("RTreeBatchReader: failed to read entry ") + std::to_string(entry) +
+                                  " of branch \"" + state.fBranch->GetName() + "\"");
+      state.fBasketFirst = first;
+      state.fBasketEntries = n;
+   }
+
+   void ReadColumn(RBatchColumn &column, RBranchState &state, Long64_t begin, Long64_t end)
+   {
+      column.fValues.clear();
+      column.fOffsets.clear();
+      if (column.fLength == 0)
+         column.fOffsets.push_back(0);
+      for (Long64_t entry = begin; entry < end;) {
+         if (entry < state.fBasketFirst || entry >= state.fBasketFirst + state.fBasketEntries)
+            LoadBasket(state, entry);
+         const Long64_t stop = std::min(end, state.fBasketFirst + state.fBasketEntries);
+         const auto first = entry - state.fBasketFirst;
+         const auto last = stop - state.fBasketFirst;
+         const char *values = state.fBuffer.GetCurrent();
+         column.fValues.insert(column.fValues.end(), values + state.fBasketOffsets[first] * state.fElementSize,
+                               values + state.fBasketOffsets[last] * state.fElementSize);
+         if (column.fLength == 0) {
+            const Long64_t shift = column.fOffsets.back() - state.fBasketOffsets[first];
+            for (auto i = first + 1; i <= last; ++i)
+               column.fOffsets.push_back(state.fBasketOffsets[i] + shift);
+         }
+         entry = stop;
+      }
+   }
+
+public:
+   RTreeBatchReader(TTree &tree, const std::vector<std::string> &branches) : fTree(&tree)
+   {
+      for (const auto &name : branches) {
+         fColumns.emplace_back();
+         fColumns.back().fName = name;
+         fBranches.emplace_back(new RBranchState());
+      }
+   }
+
+   /// Read the entries [begin, begin + maxEntries), or less if the tree of a chain that contains begin ends before.
+   /// Returns the number of entries read, 0 at the end of the tree.
+   Long64_t ReadBatch(Long64_t begin, Long64_t maxEntries)
+   {
+      const Long64_t localBegin = fTree->LoadTree(begin);
+      if (localBegin < 0)
+         return 0;
+      if (fTree->GetTreeNumber() != fTreeNumber || fTree->GetTree() != fCurrentTree) {
+         fTreeNumber = fTree->GetTreeNumber();
+         fCurrentTree = fTree->GetTree();
+         ConnectBranches();
+      }
+      const Long64_t localEnd = std::min(localBegin + maxEntries, fCurrentTree->GetEntries());
+      for (std::size_t i = 0; i < fColumns.size(); ++i)
+         ReadColumn(fColumns[i], *fBranches[i], localBegin, localEnd);
+      return localEnd - localBegin;
+   }
+
+   const std::vector<RBatchColumn> &GetColumns() const { return fColumns; }
+};
+
+} // namespace PyROOT
+
+} // namespace Internal
+
+} // namespace ROOT
+
+#endif // ROOT_RTREEBATCHREADER
@@ -0,0 +1,160 @@
+################################################################################
+# Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.                      #
+# All rights reserved.                                                         #
+#                                                                              #
+# For the licensing terms see $ROOTSYS/LICENSE.                                #
+# For the list of contributors see $ROOTSYS/README/CREDITS.                    #
+################################################################################
+
+# numpy is imported lazily: the TTree pythonizations use this module too and
+# do not depend on it otherwise.
+
+
+class RaggedArray(object):
+    """
+    A column of collections of numbers in the offsets and values layout, as
+    returned by `AsNumpy` with `ragged="offsets"` and by `AsNumpyBatches`. The
+    elements of all the collections are stored one after the other in the
+    `values` numpy array, the elements of the i-th collection are
+    `values[offsets[i]:offsets[i+1]]`. This is the layout of the
+    `ListOffsetArray` of awkward-array, see `to_awkward`.
+
+    Attributes:
+        offsets (numpy.ndarray): int64 array with one entry more than the
+            number of collections, the first one is zero.
+        values (numpy.ndarray): the elements of all the collections.
+    """
+    def __init__(self, offsets, values):
+        self.offsets = offsets
+        self.values = values
+
+    def __len__(self):
+        return len(self.offsets) - 1
+
+    def __getitem__(self, index):
+        """
+        Returns the collection at the given index as a view of `values`.
+        """
+        if index < 0:
+            index += len(self)
+        if index < 0 or index >= len(self):
+            raise IndexError("RaggedArray index out of range")
+        return self.values[self.offsets[index]:self.offsets[index + 1]]
+
+    def __iter__(self):
+        for i in range(len(self)):
+            yield self[i]
+
+    def counts(self):
+        """
+        Returns the number of elements of every collection.
+        """
+        import numpy
+        return numpy.diff(self.offsets)
+
+    def concatenate(self, other):
+        """
+        Returns a new RaggedArray with the collections of this array followed
+        by the ones of the other array.
+        """
+        import numpy
+        offsets = numpy.concatenate([self.offsets, other.offsets[1:] + self.offsets[-1]])
+        return RaggedArray(offsets, numpy.concatenate([self.values, other.values]))
+
+    def to_awkward(self):
+        """
+        Returns an awkward array sharing the memory of this array. Requires the
+        awkward package (version 2).
+        """
+        import awkward
+        layout = awkward.contents.ListOffsetArray(awkward.index.Index64(self.offsets),
+                                                  awkward.contents.NumpyArray(self.values))
+        return awkward.Array(layout)
+
+
+class _ArrayView(object):
+    """
+    Exposes a C++ buffer through the numpy array interface, see
+    https://numpy.org/doc/stable/reference/arrays.interface.html
+    """
+    def __init__(self, address, shape, dtype):
+        from libROOTPythonizations import GetEndianess
+        # Numpy breaks for data pointer of 0 even though the array is empty.
+        # We set the pointer to 1 but the value itself is arbitrary and never accessed.
+        self.__array_interface__ = {
+            "shape": shape,
+            "typestr": GetEndianess() + dtype,
+            "version": 3,
+            "data": (address if address else 1, True)
+        }
+
+
+def _batch_to_arrays(columns, n_entries, library):
+    """
+    Copies the columns of a batch read by a RTreeBatchReader or a
+    RNTupleBatchReader into numpy arrays: 1D arrays for the columns of scalars,
+    2D arrays for the fixed-size arrays and RaggedArray for the collections.
+    With library="ak", the batch is returned as an awkward record array.
+    """
+    import numpy
+
+    arrays = {}
+    for column in columns:
+        name = str(column.fName)
+        dtype = str(column.fDType)
+        length = column.fLength
+        if length == 0:
+            offsets = numpy.array(_ArrayView(column.GetOffsetsAddress(), (n_entries + 1, ), "i8"))
+            values = numpy.array(_ArrayView(column.GetValuesAddress(), (column.GetNValues(), ), dtype))
+            arrays[name] = RaggedArray(offsets, values)
+        else:
+            shape = (n_entries, ) if length == 1 else (n_entries, length)
+            arrays[name] = numpy.array(_ArrayView(column.GetValuesAddress(), shape, dtype))
+
+    if library == "ak":
+        import awkward
+        return awkward.Array({name: array.to_awkward() if isinstance(array, RaggedArray) else array
+                              for name, array in arrays.items()})
+    return arrays
+
+
+def iterate_batches(reader, entry_start, entry_stop, batch_size, library):
+    """
+    Generator of the batches of the entries [entry_start, entry_stop) read by
+    the given RTreeBatchReader or RNTupleBatchReader, see AsNumpyBatches.
+    """
+    entry = entry_start
+    while entry < entry_stop:
+        n_entries = reader.ReadBatch(entry, min(batch_size, entry_stop - entry))
+        if n_entries <= 0:
+            break
+        yield _batch_to_arrays(reader.GetColumns(), n_entries, library)
+        entry += n_entries
+
+
+def make_batch_reader(class_name, header, source, columns, batch_size, library, default_columns):
+    """
+    Checks the arguments of AsNumpyBatches and creates the given C++ batch
+    reader class for the columns of the source, declaring its header to the
+    interpreter the first time. If columns is None, the columns to read are
+    the ones returned by default_columns, called with the reader class.
+    """
+    if isinstance(columns, str):
+        raise TypeError("The columns argument requires a list of strings")
+    if batch_size <= 0:
+        raise ValueError("The batch_size argument must be positive")
+    if library not in ("np", "ak"):
+        raise ValueError("The library argument must be either \"np\" or \"ak\"")
+    try:
+        import numpy
+    except ImportError:
+        raise ImportError("Failed to import numpy during call of AsNumpyBatches.")
+
+    import ROOT
+    if not hasattr(ROOT.Internal, "PyROOT") or not hasattr(ROOT.Internal.PyROOT, class_name):
+        if not ROOT.gInterpreter.Declare('#include "{}"'.format(header)):
+            raise RuntimeError("Failed to find \"{}\".".format(header))
+    reader_class = getattr(ROOT.Internal.PyROOT, class_name)
+    if columns is None:
+        columns = [str(name) for name in default_columns(reader_class)]
+    return reader_class(source, ROOT.std.vector["std::string"](columns))
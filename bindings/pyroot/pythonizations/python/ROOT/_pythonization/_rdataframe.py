@@ -172,12 +172,33 @@ df2_transformed = ROOT.MyTransformation(ROOT.RDF.AsRNode(df2))
 \anchor reference
 */
 '''
+import re
 import sys
 from . import pythonization
 from ._pyz_utils import MethodTemplateGetter, MethodTemplateWrapper
 
 
-def RDataFrameAsNumpy(df, columns=None, exclude=None, lazy=False):
+# Element types of the collections that AsNumpy can return in the offsets and values layout
+_flat_element_types = {
+    "short", "unsigned short", "int", "unsigned int", "long", "unsigned long", "long long", "unsigned long long",
+    "float", "double", "Short_t", "UShort_t", "Int_t", "UInt_t", "Long_t", "ULong_t", "Long64_t", "ULong64_t",
+    "Float_t", "Double_t", "std::int16_t", "std::uint16_t", "std::int32_t", "std::uint32_t", "std::int64_t",
+    "std::uint64_t", "int16_t", "uint16_t", "int32_t", "uint32_t", "int64_t", "uint64_t"
+}
+_collection_type_regex = re.compile(r"^(?:std::)?vector<(.+?)(?:,.*)?>$|^(?:ROOT::)?(?:VecOps::)?RVec<(.+)>$")
+
+
+def _is_flat_collection_type(column_type):
+    """Returns whether the column type is a std::vector or an RVec of numbers, which AsNumpy can
+    read out in the offsets and values layout."""
+    match = _collection_type_regex.match(column_type.strip())
+    if not match:
+        return False
+    element_type = (match.group(1) or match.group(2)).strip()
+    return element_type in _flat_element_types
+
+
+def RDataFrameAsNumpy(df, columns=None, exclude=None, lazy=False, ragged="objects"):
     """Read-out the RDataFrame as a collection of numpy arrays.
 
     The values of the dataframe are read out as numpy array of the respective type
@@ -188,6 +209,12 @@ def RDataFrameAsNumpy(df, columns=None, exclude=None, lazy=False):
     Be aware that reading out custom types is much less performant than reading out
     fundamental types, such as int or float, which are supported directly by numpy.
 
+    Columns of collections of numbers, such as ROOT::RVec<float> or std::vector<int>,
+    can instead be read out with `ragged="offsets"` as a RaggedArray: the elements of
+    all collections are filled during the event loop into one numpy array `values`,
+    next to an array of `offsets`, without creating one object per row. This is the
+    layout of awkward-array, see RaggedArray.to_awkward().
+
     The reading is performed in multiple threads if the implicit multi-threading of
     ROOT is enabled.
 
@@ -198,6 +225,8 @@ def RDataFrameAsNumpy(df, columns=None, exclude=None, lazy=False):
         columns: If None return all branches as columns, otherwise specify names in iterable.
         exclude: Exclude branches from selection.
         lazy: Determines whether this action is instant (False, default) or lazy (True).
+        ragged: How columns of collections of numbers are returned: as numpy arrays of
+            the C++ collections ("objects", default) or as RaggedArray ("offsets").
 
     Returns:
         dict or AsNumpyResult: if instant (default), dict with column names as keys and
@@ -209,6 +238,8 @@ def RDataFrameAsNumpy(df, columns=None, exclude=None, lazy=False):
         raise TypeError("The columns argument requires a list of strings")
     if isinstance(exclude, str):
         raise TypeError("The exclude argument requires a list of strings")
+    if ragged not in ("objects", "offsets"):
+        raise ValueError("The ragged argument must be either \"objects\" or \"offsets\"")
 
     # Early check for numpy
     try:
@@ -229,7 +260,13 @@ def RDataFrameAsNumpy(df, columns=None, exclude=None, lazy=False):
     result_ptrs = {}
     for column in columns:
         column_type = df.GetColumnType(column)
-        result_ptrs[column] = df.Take[column_type](column)
+        if ragged == "offsets" and _is_flat_collection_type(column_type):
+            import ROOT
+            if not hasattr(ROOT.Internal.RDF, "TakeFlat"):
+                ROOT.gInterpreter.Declare('#include "ROOT/RTakeFlatHelper.hxx"')
+            result_ptrs[column] = ROOT.Internal.RDF.TakeFlat[column_type](ROOT.RDF.AsRNode(df), column)
+        else:
+            result_ptrs[column] = df.Take[column_type](column)
 
     result = AsNumpyResult(result_ptrs, columns)
 
@@ -277,13 +314,18 @@ class AsNumpyResult(object):
 
         if self._py_arrays is None:
             import numpy
-            from ROOT._pythonization._rdf_utils import ndarray
+            from ROOT._pythonization._rdf_utils import ndarray, RaggedArray
 
             # Convert the C++ vectors to numpy arrays
             self._py_arrays = {}
             for column in self._columns:
                 cpp_reference = self._result_ptrs[column].GetValue()
-                if hasattr(cpp_reference, "__array_interface__"):
+                if hasattr(cpp_reference, "fOffsets"):
+                    # Result of TakeFlat: both arrays adopt the memory of the C++ vectors
+                    offsets = ndarray(numpy.asarray(cpp_reference.fOffsets), self._result_ptrs[column])
+                    values = ndarray(numpy.asarray(cpp_reference.fValues), self._result_ptrs[column])
+                    self._py_arrays[column] = RaggedArray(offsets, values)
+                elif hasattr(cpp_reference, "__array_interface__"):
                     tmp = numpy.asarray(cpp_reference) # This adopts the memory of the C++ object.
                     self._py_arrays[column] = ndarray(tmp, self._result_ptrs[column])
                 else:
@@ -321,9 +363,12 @@ class AsNumpyResult(object):
         if not self._py_arrays.keys() == other._py_arrays.keys():
             raise ValueError("The two dictionary of numpy arrays have different keys.")
 
+        from ROOT._pythonization._rdf_utils import RaggedArray
+
         self._py_arrays = {
-            key: numpy.concatenate([self._py_arrays[key],
-                                    other._py_arrays[key]])
+            key: self._py_arrays[key].concatenate(other._py_arrays[key])
+            if isinstance(self._py_arrays[key], RaggedArray)
+            else numpy.concatenate([self._py_arrays[key], other._py_arrays[key]])
             for key in self._py_arrays
         }
 
@@ -10,6 +10,8 @@
 
 import numpy
 
+from ._batch_utils import RaggedArray
+
 
 class ndarray(numpy.ndarray):
     """
@@ -0,0 +1,46 @@
+################################################################################
+# Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.                      #
+# All rights reserved.                                                         #
+#                                                                              #
+# For the licensing terms see $ROOTSYS/LICENSE.                                #
+# For the list of contributors see $ROOTSYS/README/CREDITS.                    #
+################################################################################
+
+from . import pythonization
+from ._batch_utils import iterate_batches, make_batch_reader
+
+
+def _RNTupleReaderAsNumpyBatches(self, columns=None, batch_size=100000, entry_start=0, entry_stop=None,
+                                 library="np"):
+    """Iterate over the entries of the RNTuple in batches of numpy arrays.
+
+    The values are copied from the pages of the fields, without reading the
+    entries one by one. Fields of fundamental types are read out as numpy
+    arrays, their std::vector and RVec collections as RaggedArray.
+
+    Parameters:
+        columns: If None all the top-level fields, otherwise the names of the
+            fields to read.
+        batch_size: Maximum number of entries of a batch.
+        entry_start: First entry to read.
+        entry_stop: Entry after the last one to read, by default the end of the RNTuple.
+        library: "np" (default) for dicts of numpy arrays and RaggedArray, "ak"
+            for awkward arrays of records.
+
+    Returns:
+        generator: the batches, as dicts with the field names as keys.
+    """
+    reader = make_batch_reader("RNTupleBatchReader", "ROOT/RNTupleBatchReader.hxx", self, columns, batch_size, library,
+                               lambda reader_class: reader_class.GetFieldNames(self))
+    if entry_stop is None:
+        entry_stop = self.GetNEntries()
+    return iterate_batches(reader, entry_start, entry_stop, batch_size, library)
+
+
+@pythonization("RNTupleReader", ns="ROOT::Experimental")
+def pythonize_rntuplereader(klass):
+    # Parameters:
+    # klass: class to be pythonized
+
+    # Iteration in batches of numpy arrays
+    klass.AsNumpyBatches = _RNTupleReaderAsNumpyBatches
@@ -101,6 +101,7 @@ class BaseGenerator:
         validation_split: float = 0.0,
         max_chunks: int = 0,
         shuffle: bool = True,
+        num_loading_threads: int = 1,
     ):
         """Wrapper around the Cpp RBatchGenerator
 
@@ -135,6 +136,10 @@ class BaseGenerator:
             shuffle (bool):
                 Batches consist of random events and are shuffled every epoch.
                 Defaults to True.
+            num_loading_threads (int):
+                The number of chunks loaded at the same time, each one on its
+                own thread. Only used when no filters are given. Higher values
+                result in faster loading, but higher memory usage. Defaults to 1.
         """
 
         try:
@@ -212,6 +217,7 @@ class BaseGenerator:
             max_chunks,
             self.num_columns,
             shuffle,
+            num_loading_threads,
         )
 
         atexit.register(self.DeActivate)
@@ -565,6 +571,7 @@ def CreateNumPyGenerators(
     validation_split: float = 0.0,
     max_chunks: int = 0,
     shuffle: bool = True,
+    num_loading_threads: int = 1,
 ) -> Tuple[TrainRBatchGenerator, ValidationRBatchGenerator]:
     """
     Return two batch generators based on the given ROOT file and tree.
@@ -598,6 +605,9 @@ def CreateNumPyGenerators(
             If not given, the whole file is used
         shuffle (bool):
             randomize the training batches every epoch. Defaults to True
+        num_loading_threads (int):
+            The number of chunks loaded at the same time, each one on its own
+            thread. Only used when no filters are given. Defaults to 1
 
     Returns:
         Tuple[TrainRBatchGenerator, ValidationRBatchGenerator]:
@@ -620,6 +630,7 @@ def CreateNumPyGenerators(
         validation_split,
         max_chunks,
         shuffle,
+        num_loading_threads,
     )
 
     train_generator = TrainRBatchGenerator(
@@ -646,6 +657,7 @@ def CreateTFDatasets(
     validation_split: float = 0.0,
     max_chunks: int = 0,
     shuffle: bool = True,
+    num_loading_threads: int = 1,
 ) -> Tuple[tf.data.Dataset, tf.data.Dataset]:
     """
     Return two Tensorflow Datasets based on the given ROOT file and tree
@@ -679,6 +691,9 @@ def CreateTFDatasets(
             If not given, the whole file is used
         shuffle (bool):
             randomize the training batches every epoch. Defaults to True
+        num_loading_threads (int):
+            The number of chunks loaded at the same time, each one on its own
+            thread. Only used when no filters are given. Defaults to 1
 
     Returns:
         Tuple[TrainRBatchGenerator, ValidationRBatchGenerator]:
@@ -703,6 +718,7 @@ def CreateTFDatasets(
         validation_split,
         max_chunks,
         shuffle,
+        num_loading_threads,
     )
 
     train_generator = TrainRBatchGenerator(
@@ -772,6 +788,7 @@ def CreatePyTorchGenerators(
     validation_split: float = 0.0,
     max_chunks: int = 0,
     shuffle: bool = True,
+    num_loading_threads: int = 1,
 ) -> Tuple[TrainRBatchGenerator, ValidationRBatchGenerator]:
     """
     Return two Tensorflow Datasets based on the given ROOT file and tree
@@ -805,6 +822,9 @@ def CreatePyTorchGenerators(
             If not given, the whole file is used
         shuffle (bool):
             randomize the training batches every epoch. Defaults to True
+        num_loading_threads (int):
+            The number of chunks loaded at the same time, each one on its own
+            thread. Only used when no filters are given. Defaults to 1
 
     Returns:
         Tuple[TrainRBatchGenerator, ValidationRBatchGenerator]:
@@ -827,6 +847,7 @@ def CreatePyTorchGenerators(
         validation_split,
         max_chunks,
         shuffle,
+        num_loading_threads,
     )
 
     train_generator = TrainRBatchGenerator(
@@ -36,7 +36,21 @@ with Python naming rules, with e.g. "getattr(entry, '1_branch_name')".
 <em>Please note</em> that iterating in Python can be slow, so only iterate over
 a tree as described above if performance is not an issue or when dealing with
 a small dataset. To read and process the entries of a tree in a much faster
-way, please use ROOT::RDataFrame.
+way, please use ROOT::RDataFrame, or read the entries in batches of numpy
+arrays with `AsNumpyBatches`:
+\code{.py}
+for batch in t.AsNumpyBatches(["pt", "tracks_eta"], batch_size=100000):
+    pt = batch["pt"]          # numpy array, one value per entry
+    eta = batch["tracks_eta"] # RaggedArray, for a std::vector<float> or eta[n]/F branch
+    for tracks in eta:        # numpy array of the values of an entry
+        ...
+\endcode
+The baskets of the branches are deserialized all at once with the bulk I/O of
+TBranch, without reading the entries one by one. Branches of fundamental types,
+their fixed-size arrays (2D numpy arrays), their variable-size arrays and their
+`std::vector`s (RaggedArray) are supported. With `library="ak"`, every batch is
+an awkward array of records instead. The same method is available for
+ROOT::Experimental::RNTupleReader.
 
 Second, a couple of TTree methods have been modified to facilitate their use
 from Python: TTree::Branch and TTree::SetBranchAddress.
@@ -132,6 +146,7 @@ ds.SetBranchAddress('structb', ms)
 
 from libROOTPythonizations import AddBranchAttrSyntax, SetBranchAddressPyz, BranchPyz
 from . import pythonization
+from ._batch_utils import iterate_batches, make_batch_reader
 
 # TTree iterator
 def _TTree__iter__(self):
@@ -145,6 +160,34 @@ def _TTree__iter__(self):
     if bytes_read == -1:
         raise RuntimeError("TTree I/O error")
 
+def _TTreeAsNumpyBatches(self, columns=None, batch_size=100000, entry_start=0, entry_stop=None, library="np"):
+    """Iterate over the entries of the tree in batches of numpy arrays.
+
+    The branches are read with the bulk I/O of TBranch, one basket at a time.
+    A batch never spans two trees of a TChain, so it can hold less than
+    `batch_size` entries.
+
+    Parameters:
+        columns: If None all the top-level branches that can be read in
+            batches, otherwise the names of the branches to read.
+        batch_size: Maximum number of entries of a batch.
+        entry_start: First entry to read.
+        entry_stop: Entry after the last one to read, by default the end of the tree.
+        library: "np" (default) for dicts of numpy arrays and RaggedArray, "ak"
+            for awkward arrays of records.
+
+    Returns:
+        generator: the batches, as dicts with the branch names as keys.
+    """
+    def default_columns(reader_class):
+        return [b.GetName() for b in self.GetListOfBranches() if b.GetBulkRead().SupportsBulkReadWithOffsets()]
+
+    reader = make_batch_reader("RTreeBatchReader", "ROOT/RTreeBatchReader.hxx", self, columns, batch_size, library,
+                               default_columns)
+    if entry_stop is None:
+        entry_stop = self.GetEntries()
+    return iterate_batches(reader, entry_start, entry_stop, batch_size, library)
+
 def _SetBranchAddress(self, *args):
     # Modify the behaviour if args is (const char*, void*)
     res = SetBranchAddressPyz(self, *args)
@@ -182,6 +225,9 @@ def pythonize_ttree(klass, name):
     # Pythonic iterator
     klass.__iter__ = _TTree__iter__
 
+    # Iteration in batches of numpy arrays
+    klass.AsNumpyBatches = _TTreeAsNumpyBatches
+
     # tree.branch syntax
     AddBranchAttrSyntax(klass)
 
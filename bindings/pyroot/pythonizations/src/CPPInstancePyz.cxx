@@ -19,6 +19,10 @@
 #include "PyzCppHelpers.hxx"
 #include "TBufferFile.h"
 #include "CustomPyTypes.h"
+#include "RZip.h"
+
+#include <algorithm>
+#include <vector>
 
 using namespace CPyCppyy;
 
@@ -26,6 +30,54 @@ namespace PyROOT {
 extern PyObject *gRootModule;
 }
 
+namespace {
+/// Streamed objects larger than this are compressed when pickled, e.g. the partial results of distributed tasks
+constexpr int kMinCompressedPickleSize = 64 * 1024;
+
+/// Compresses the buffer with LZ4 in blocks of at most kMAXZIPBUF bytes, as TKey does. Returns false if the
+/// compressed buffer is not smaller than the input.
+bool CompressPickle(const char *src, int srcSize, std::vector<char> &tgt)
+{
+   tgt.resize(srcSize);
+   int nzip = 0;
+   int noutot = 0;
+   while (nzip < srcSize) {
+      int nin = std::min<int>(srcSize - nzip, kMAXZIPBUF);
+      int tgtSize = srcSize - noutot;
+      int nout = 0;
+      R__zipMultipleAlgorithm(1, &nin, const_cast<char *>(src) + nzip, &tgtSize, tgt.data() + noutot, &nout,
+                              ROOT::RCompressionSetting::EAlgorithm::kLZ4);
+      if (nout == 0)
+         return false;
+      nzip += nin;
+      noutot += nout;
+   }
+   tgt.resize(noutot);
+   return true;
+}
+
+/// Inverse of CompressPickle, returns false if the buffer does not decompress to exactly objlen bytes
+bool DecompressPickle(const char *src, int srcSize, std::vector<char> &tgt, int objlen)
+{
+   tgt.resize(objlen);
+   auto bufcur = reinterpret_cast<unsigned char *>(const_cast<char *>(src));
+   int nread = 0;
+   int noutot = 0;
+   while (nread < srcSize && noutot < objlen) {
+      int nin = 0, nbuf = 0, nout = 0;
+      if (R__unzip_header(&nin, bufcur, &nbuf) != 0 || nin > srcSize - nread || nbuf > objlen - noutot)
+         return false;
+      R__unzip(&nin, bufcur, &nbuf, reinterpret_cast<unsigned char *>(tgt.data()) + noutot, &nout);
+      if (nout == 0)
+         return false;
+      bufcur += nin;
+      nread += nin;
+      noutot += nout;
+   }
+   return noutot == objlen;
+}
+} // anonymous namespace
+
 ////////////////////////////////////////////////////////////////////////////
 /// \brief Deserialize pickled objects
 /// \param[in] self Always null, since this is a module function.
@@ -36,23 +88,37 @@ extern PyObject *gRootModule;
 /// included in the extension module API because otherwise it is not
 /// callable from Python. This is important because it will be Python
 /// itself calling it when trying to expand a serialized object.
+/// The optional third argument is the size of the streamed object if the
+/// buffer is compressed.
 PyObject *PyROOT::CPPInstanceExpand(PyObject * /*self*/, PyObject *args)
 {
    PyObject *pybuf = 0, *pyname = 0;
-   if (!PyArg_ParseTuple(args, const_cast<char *>("O!O!:__expand__"), &PyBytes_Type, &pybuf, &PyBytes_Type, &pyname))
+   int objlen = 0;
+   if (!PyArg_ParseTuple(args, const_cast<char *>("O!O!|i:__expand__"), &PyBytes_Type, &pybuf, &PyBytes_Type, &pyname,
+                         &objlen))
       return 0;
    const char *clname = PyBytes_AS_STRING(pyname);
+   const char *data = PyBytes_AS_STRING(pybuf);
+   int nbytes = PyBytes_GET_SIZE(pybuf);
+   std::vector<char> unzipped;
+   if (objlen > 0) {
+      if (!DecompressPickle(data, nbytes, unzipped, objlen)) {
+         PyErr_Format(PyExc_IOError, "could not decompress the pickled object of type %s", clname);
+         return 0;
+      }
+      data = unzipped.data();
+      nbytes = objlen;
+   }
    // TBuffer and its derived classes can't write themselves, but can be created
    // directly from the buffer, so handle them in a special case
    void *newObj = 0;
    if (strcmp(clname, "TBufferFile") == 0) {
       TBufferFile *buf = new TBufferFile(TBuffer::kWrite);
-      buf->WriteFastArray(PyBytes_AS_STRING(pybuf), PyBytes_GET_SIZE(pybuf));
+      buf->WriteFastArray(data, nbytes);
       newObj = buf;
    } else {
-      // use the PyString macro's to by-pass error checking; do not adopt the buffer,
-      // as the local TBufferFile can go out of scope (there is no copying)
-      TBufferFile buf(TBuffer::kRead, PyBytes_GET_SIZE(pybuf), PyBytes_AS_STRING(pybuf), kFALSE);
+      // do not adopt the buffer, as the local TBufferFile can go out of scope (there is no copying)
+      TBufferFile buf(TBuffer::kRead, nbytes, const_cast<char *>(data), kFALSE);
       newObj = buf.ReadObjectAny(0);
    }
    PyObject *result = BindCppObject(newObj, Cppyy::GetScope(clname));
@@ -103,12 +169,25 @@ PyObject *op_reduce(CPPInstance *self, PyObject * /*args*/)
       }
       buff = &s_buff;
    }
+   // large objects, e.g. histograms with many bins, are compressed; the size of
+   // the streamed object is then passed to CPPInstanceExpand as third argument
+   const char *data = buff->Buffer();
+   int nbytes = buff->Length();
+   int objlen = 0;
+   std::vector<char> zipped;
+   if (nbytes >= kMinCompressedPickleSize && CompressPickle(data, nbytes, zipped)) {
+      data = zipped.data();
+      objlen = nbytes;
+      nbytes = zipped.size();
+   }
    // use a string for the serialized result, as a python buffer will not copy
    // the buffer contents; use a string for the class name, used when casting
    // on reading back in (see CPPInstanceExpand defined above)
-   PyObject *res2 = PyTuple_New(2);
-   PyTuple_SET_ITEM(res2, 0, PyBytes_FromStringAndSize(buff->Buffer(), buff->Length()));
+   PyObject *res2 = PyTuple_New(objlen > 0 ? 3 : 2);
+   PyTuple_SET_ITEM(res2, 0, PyBytes_FromStringAndSize(data, nbytes));
    PyTuple_SET_ITEM(res2, 1, PyBytes_FromString(Cppyy::GetScopedFinalName(self->ObjectIsA()).c_str()));
+   if (objlen > 0)
+      PyTuple_SET_ITEM(res2, 2, PyLong_FromLong(objlen));
 
    PyObject *result = PyTuple_New(2);
    Py_INCREF(s_expand);
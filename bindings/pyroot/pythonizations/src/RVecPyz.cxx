@@ -25,7 +25,8 @@
 ///
 /// This function returns an RVec which adopts the memory of the given
 /// PyObject. The RVec takes the data pointer and the size from the array
-/// interface dictionary.
+/// interface dictionary. The memory must be contiguous, as the RVec cannot
+/// represent strided data.
 PyObject *PyROOT::AsRVec(PyObject * /*self*/, PyObject * obj)
 {
    if (!obj) {
@@ -67,6 +68,21 @@ PyObject *PyROOT::AsRVec(PyObject * /*self*/, PyObject * obj)
    if (cppdtype.compare("") == 0)
       return NULL;
 
+   // Strides are None for C-contiguous arrays, otherwise they have to match the contiguous layout
+   auto pystrides = PyDict_GetItemString(pyinterface, "strides");
+   if (pystrides && pystrides != Py_None) {
+      long stride = GetDatatypeSizeFromTypestr(typestr);
+      for (int i = PyTuple_Size(pyshape) - 1; i >= 0; i--) {
+         const auto extent = PyLong_AsLong(PyTuple_GetItem(pyshape, i));
+         if (extent > 1 && PyLong_AsLong(PyTuple_GetItem(pystrides, i)) != stride) {
+            PyErr_SetString(PyExc_RuntimeError,
+                            "Object not convertible: The data is not contiguous, use numpy.ascontiguousarray.");
+            return NULL;
+         }
+         stride *= extent;
+      }
+   }
+
    // Construct an RVec of the correct data-type
    const std::string klassname = "ROOT::VecOps::RVec<" + cppdtype + ">";
    std::stringstream prefix;
@@ -0,0 +1,40 @@
+import pickle
+import unittest
+
+import ROOT
+
+
+class CPPInstancePickle(unittest.TestCase):
+    """
+    Test the pickling of C++ objects, which are streamed in a TBufferFile
+    """
+
+    # Tests
+    def test_small_object(self):
+        h = ROOT.TH1F("h_small", "h_small", 10, 0, 1)
+        h.Fill(0.5)
+        # Small objects are not compressed
+        self.assertEqual(len(h.__reduce__()[1]), 2)
+
+        h2 = pickle.loads(pickle.dumps(h))
+        self.assertEqual(h2.GetNbinsX(), 10)
+        self.assertEqual(h2.GetBinContent(6), 1)
+
+    def test_large_object_is_compressed(self):
+        h = ROOT.TH2D("h_large", "h_large", 300, 0, 1, 300, 0, 1)
+        h.Fill(0.5, 0.5, 3)
+        # The streamed histogram, mostly made of empty bins, is compressed and
+        # the size of the uncompressed buffer is passed along
+        args = h.__reduce__()[1]
+        self.assertEqual(len(args), 3)
+        self.assertLess(len(args[0]), args[2])
+
+        h2 = pickle.loads(pickle.dumps(h))
+        self.assertEqual(h2.GetNbinsX(), 300)
+        self.assertEqual(h2.GetNbinsY(), 300)
+        self.assertEqual(h2.GetBinContent(h2.FindBin(0.5, 0.5)), 3)
+        self.assertEqual(h2.GetEntries(), 1)
+
+
+if __name__ == '__main__':
+    unittest.main()
@@ -308,6 +308,47 @@ class RDataFrameAsNumpy(unittest.TestCase):
         pyarr[0][0] = 42
         self.assertTrue(cpparr[0][0] == pyarr[0][0])
 
+    def test_read_ragged_offsets(self):
+        """
+        Testing reading collections of numbers in the offsets and values layout
+        """
+        df = ROOT.ROOT.RDataFrame(5).Define("x", "ROOT::RVec<float>(rdfentry_, 0.5f * rdfentry_)")\
+                                    .Define("y", "std::vector<int>(2, rdfentry_)")\
+                                    .Define("z", "(int)rdfentry_")
+        npy = df.AsNumpy(ragged="offsets")
+        self.assertEqual(len(npy["x"]), 5)
+        self.assertEqual(list(npy["x"].offsets), [0, 0, 1, 3, 6, 10])
+        self.assertEqual(npy["x"].values.dtype, np.float32)
+        self.assertEqual(list(npy["x"][3]), [1.5, 1.5, 1.5])
+        self.assertEqual(list(npy["y"].counts()), [2] * 5)
+        self.assertEqual(list(npy["y"].values), [0, 0, 1, 1, 2, 2, 3, 3, 4, 4])
+        # Columns that are not collections are returned as usual
+        self.assertEqual(list(npy["z"]), [0, 1, 2, 3, 4])
+
+    def test_merge_ragged_offsets(self):
+        """
+        Testing the merge of two results in the offsets and values layout
+        """
+        df = ROOT.ROOT.RDataFrame(3).Define("x", "ROOT::RVec<double>(rdfentry_, 1.)")
+        res1 = df.AsNumpy(lazy=True, ragged="offsets")
+        res2 = df.AsNumpy(lazy=True, ragged="offsets")
+        res1.GetValue()
+        res2.GetValue()
+        res1.Merge(res2)
+        merged = res1.GetValue()["x"]
+        self.assertEqual(list(merged.offsets), [0, 0, 1, 3, 3, 4, 6])
+        self.assertEqual(merged.values.size, 6)
+
+    def test_numpy_datasource_strided(self):
+        """
+        Testing that strided arrays are rejected by MakeNumpyDataFrame instead of being misread
+        """
+        x = np.arange(10, dtype=np.float64)
+        df = ROOT.RDF.FromNumpy({"x": x[::2].copy()})
+        self.assertEqual(list(df.AsNumpy()["x"]), [0, 2, 4, 6, 8])
+        with self.assertRaises(RuntimeError):
+            ROOT.RDF.FromNumpy({"x": x[::2]})
+
 
 if __name__ == '__main__':
     unittest.main()
@@ -0,0 +1,117 @@
+import os
+import unittest
+
+import numpy as np
+
+import ROOT
+
+
+class TTreeAsNumpyBatches(unittest.TestCase):
+    """
+    Tests for the AsNumpyBatches pythonization of TTree, which reads the
+    entries of a tree in batches of numpy arrays with bulk I/O.
+    """
+
+    filename = "ttree_asnumpybatches.root"
+    treename = "tree"
+    nentries = 1000
+
+    @classmethod
+    def setUpClass(cls):
+        ROOT.gInterpreter.Declare("""
+        void CreateAsNumpyBatchesTree(const char *filename, const char *treename, int nentries)
+        {
+           TFile f(filename, "RECREATE");
+           TTree t(treename, treename);
+           float x;
+           int arr[3];
+           int n;
+           double var[10];
+           std::vector<float> vec;
+           t.Branch("x", &x);
+           t.Branch("arr", arr, "arr[3]/I");
+           t.Branch("n", &n);
+           t.Branch("var", var, "var[n]/D");
+           t.Branch("vec", &vec);
+           // Small baskets, so that the batches span several baskets
+           t.SetBasketSize("*", 1024);
+           for (int i = 0; i < nentries; ++i) {
+              x = i;
+              for (int j = 0; j < 3; ++j)
+                 arr[j] = 3 * i + j;
+              n = i % 10;
+              vec.clear();
+              for (int j = 0; j < n; ++j) {
+                 var[j] = i + 0.5 * j;
+                 vec.push_back(-i - j);
+              }
+              t.Fill();
+           }
+           t.Write();
+        }
+        """)
+        ROOT.CreateAsNumpyBatchesTree(cls.filename, cls.treename, cls.nentries)
+
+    @classmethod
+    def tearDownClass(cls):
+        os.remove(cls.filename)
+
+    def check_entries(self, batches, first):
+        entry = first
+        for batch in batches:
+            n = len(batch["x"])
+            np.testing.assert_equal(batch["x"], np.arange(entry, entry + n, dtype=np.float32))
+            self.assertEqual(batch["x"].dtype, np.float32)
+            self.assertEqual(batch["arr"].shape, (n, 3))
+            np.testing.assert_equal(batch["arr"][:, 1], 3 * np.arange(entry, entry + n) + 1)
+            self.assertEqual(len(batch["var"]), n)
+            self.assertEqual(len(batch["vec"]), n)
+            for i in range(n):
+                size = (entry + i) % 10
+                np.testing.assert_equal(batch["var"][i], entry + i + 0.5 * np.arange(size))
+                np.testing.assert_equal(batch["vec"][i], -(entry + i) - np.arange(size, dtype=np.float32))
+            entry += n
+        return entry
+
+    def test_tree(self):
+        f = ROOT.TFile(self.filename)
+        t = f.Get(self.treename)
+        batches = list(t.AsNumpyBatches(["x", "arr", "var", "vec"], batch_size=300))
+        self.assertEqual([len(b["x"]) for b in batches], [300, 300, 300, 100])
+        self.assertEqual(self.check_entries(batches, 0), self.nentries)
+
+    def test_entry_range(self):
+        f = ROOT.TFile(self.filename)
+        t = f.Get(self.treename)
+        batches = t.AsNumpyBatches(["x", "arr", "var", "vec"], batch_size=64, entry_start=123, entry_stop=789)
+        self.assertEqual(self.check_entries(batches, 123), 789)
+
+    def test_default_columns(self):
+        f = ROOT.TFile(self.filename)
+        t = f.Get(self.treename)
+        batch = next(t.AsNumpyBatches(batch_size=10))
+        self.assertEqual(sorted(batch.keys()), ["arr", "n", "var", "vec", "x"])
+
+    def test_chain(self):
+        c = ROOT.TChain(self.treename)
+        c.Add(self.filename)
+        c.Add(self.filename)
+        batches = list(c.AsNumpyBatches(["x", "arr", "var", "vec"], batch_size=700))
+        # A batch does not span two trees of the chain
+        self.assertEqual([len(b["x"]) for b in batches], [700, 300, 700, 300])
+        self.assertEqual(self.check_entries(batches[:2], 0), self.nentries)
+        self.assertEqual(self.check_entries(batches[2:], 0), self.nentries)
+
+    def test_errors(self):
+        f = ROOT.TFile(self.filename)
+        t = f.Get(self.treename)
+        with self.assertRaises(TypeError):
+            t.AsNumpyBatches("x")
+        with self.assertRaises(ValueError):
+            t.AsNumpyBatches(["x"], batch_size=0)
+        with self.assertRaises(ValueError):
+            t.AsNumpyBatches(["x"], library="pandas")
+
+
+if __name__ == '__main__':
+    unittest.main()
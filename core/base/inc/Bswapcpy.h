@@ -33,15 +33,79 @@
 // For arrays of short type (2 bytes in size) use bswapcpy16().         //
 // For arrays of of 4-byte types (int, float) use bswapcpy32().         //
 //                                                                      //
+// These are only available on i386. ROOT::Internal::ByteSwapCopy<N>()  //
+// is the portable version for 2, 4 and 8-byte types: it swaps 16 bytes //
+// at a time with SSE2 or NEON instructions when they are available.    //
+//                                                                      //
 //                                                                      //
 // Author: Alexandre V. Vaniachine <AVVaniachine@lbl.gov>               //
 //                                                                      //
 //////////////////////////////////////////////////////////////////////////
 
+#include "Byteswap.h"
+
+#include <cstddef>
+#include <cstring>
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define R__BSWAPCPY_SSE2
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#define R__BSWAPCPY_NEON
+#endif
+
 #if !defined(__CINT__)
 #include <sys/types.h>
 #endif
 
+namespace ROOT {
+namespace Internal {
+
+/// Copy n values of N bytes (N = 2, 4 or 8) from `from` to `to`, reversing the
+/// byte order of each value. The buffers need not be aligned and may be the same.
+template <unsigned N>
+inline void *ByteSwapCopy(void *to, const void *from, std::size_t n)
+{
+   static_assert(N == 2 || N == 4 || N == 8, "ByteSwapCopy supports 2, 4 and 8-byte values");
+   auto dst = static_cast<unsigned char *>(to);
+   auto src = static_cast<const unsigned char *>(from);
+   constexpr std::size_t kPerVector = 16 / N;
+   std::size_t i = 0;
+#if defined(R__BSWAPCPY_SSE2)
+   for (; i + kPerVector <= n; i += kPerVector) {
+      __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i * N));
+      // swap the bytes of each 16-bit word, then the words of each value
+      v = _mm_or_si128(_mm_slli_epi16(v, 8), _mm_srli_epi16(v, 8));
+      if (N > 2) {
+         v = _mm_shufflelo_epi16(v, N == 4 ? 0xB1 : 0x1B);
+         v = _mm_shufflehi_epi16(v, N == 4 ? 0xB1 : 0x1B);
+      }
+      _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + i * N), v);
+   }
+#elif defined(R__BSWAPCPY_NEON)
+   for (; i + kPerVector <= n; i += kPerVector) {
+      uint8x16_t v = vld1q_u8(src + i * N);
+      v = N == 2 ? vrev16q_u8(v) : (N == 4 ? vrev32q_u8(v) : vrev64q_u8(v));
+      vst1q_u8(dst + i * N, v);
+   }
+#endif
+   using Value_t = typename RByteSwap<N>::value_type;
+   for (; i < n; ++i) {
+      Value_t x;
+      std::memcpy(&x, src + i * N, N);
+      x = RByteSwap<N>::bswap(x);
+      std::memcpy(dst + i * N, &x, N);
+   }
+   (void)kPerVector;
+   return to;
+}
+
+} // namespace Internal
+} // namespace ROOT
+
+#if defined(__GNUC__) && defined(__i386__)
+
 extern inline void * bswapcpy16(void * to, const void * from, size_t n)
 {
 int d0, d1, d2, d3;
@@ -78,4 +142,6 @@ __asm__ __volatile__(
         :"memory");
 return (to);
 }
+#endif // __GNUC__ && __i386__
+
 #endif
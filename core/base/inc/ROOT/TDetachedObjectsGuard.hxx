@@ -0,0 +1,50 @@
+// @(#)root/base:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_TDetachedObjectsGuard
+#define ROOT_TDetachedObjectsGuard
+
+namespace ROOT {
+
+/**
+\class ROOT::TDetachedObjectsGuard
+\ingroup Base
+
+While an instance of this class is alive, the objects created by the current thread are not registered with any
+global list, so that their construction and destruction take no global lock:
+ - they are not added to the TObjectTable (if object statistics are enabled);
+ - histograms are not added to gDirectory, as with TH1::AddDirectory(kFALSE) but for this thread only;
+ - functions and formulas are not added to gROOT->GetListOfFunctions().
+
+Objects explicitly attached afterwards, e.g. with TH1::SetDirectory(), and objects referenced by a TRef (which get a
+TProcessID object number) are still registered. Guards can be nested; the destructor restores the previous state.
+
+~~~{.cpp}
+// in a task of a multi-threaded event loop
+ROOT::TDetachedObjectsGuard detached;
+TH1D h("h", "h", 100, 0, 1); // not in gDirectory, no locking
+~~~
+*/
+class TDetachedObjectsGuard {
+   bool fWasActive;
+
+public:
+   TDetachedObjectsGuard();
+   ~TDetachedObjectsGuard();
+   TDetachedObjectsGuard(const TDetachedObjectsGuard &) = delete;
+   TDetachedObjectsGuard &operator=(const TDetachedObjectsGuard &) = delete;
+
+   /// Returns true if objects created by the current thread must not be registered with global lists
+   static bool IsActive();
+};
+
+} // namespace ROOT
+
+#endif
@@ -67,6 +67,9 @@ public:
    static void           ObjectDealloc(void *vp, size_t size);
 #endif
    static void           ObjectDealloc(void *vp, void *ptr);
+   static void          *ObjectPoolAlloc(size_t size);
+   static void           ObjectPoolDealloc(void *vp, size_t size);
+   static Bool_t         IsObjectPoolEnabled();
 
    static void EnterStat(size_t size, void *p);
    static void RemoveStat(void *p);
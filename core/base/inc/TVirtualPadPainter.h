@@ -14,6 +14,8 @@
 
 #include "Rtypes.h"
 
+#include <vector>
+
 class TVirtualPad;
 
 class TVirtualPadPainter {
@@ -96,6 +98,8 @@ public:
 
    //gif, jpg, png, bmp output.
    virtual void     SaveImage(TVirtualPad *pad, const char *fileName, Int_t type) const = 0;
+   //several pads at once, returns kFALSE if not supported by the painter.
+   virtual Bool_t   SaveImages(const std::vector<TVirtualPad *> & /*pads*/, const char * /*fileName*/) const { return kFALSE; }
 
 
    static TVirtualPadPainter *PadPainter(Option_t *opt = "");
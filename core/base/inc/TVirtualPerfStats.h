@@ -88,6 +88,14 @@ public:
    virtual void SetUsed(size_t bi, size_t basketNumber) = 0;
    virtual void UpdateBranchIndices(TObjArray *branches) = 0;
 
+   /// Called after the compressed data of the basket at pos of branch b was read, from the cache or the file;
+   /// start is the TTimeStamp at which the read began. The default implementation does nothing.
+   virtual void BasketReadEvent(TBranch * /*b*/, Long64_t /*pos*/, Int_t /*len*/, Double_t /*start*/) {}
+   /// Called after the basket at pos of branch b was uncompressed from complen to objlen bytes; start is the
+   /// TTimeStamp at which the decompression began. The default implementation does nothing.
+   virtual void BasketUnzipEvent(TBranch * /*b*/, Long64_t /*pos*/, Double_t /*start*/, Int_t /*complen*/,
+                                 Int_t /*objlen*/) {}
+
    static const char *EventType(EEventType type);
 
    ClassDefOverride(TVirtualPerfStats,0)  // ABC for collecting PROOF statistics
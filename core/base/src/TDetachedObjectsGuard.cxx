@@ -0,0 +1,30 @@
+// @(#)root/base:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include "ROOT/TDetachedObjectsGuard.hxx"
+
+namespace {
+thread_local bool gIsDetached = false;
+}
+
+ROOT::TDetachedObjectsGuard::TDetachedObjectsGuard() : fWasActive(gIsDetached)
+{
+   gIsDetached = true;
+}
+
+ROOT::TDetachedObjectsGuard::~TDetachedObjectsGuard()
+{
+   gIsDetached = fWasActive;
+}
+
+bool ROOT::TDetachedObjectsGuard::IsActive()
+{
+   return gIsDetached;
+}
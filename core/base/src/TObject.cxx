@@ -50,6 +50,7 @@ class hierarchies (watch out for overlaps).
 #include "TMemberInspector.h"
 #include "TRefTable.h"
 #include "TProcessID.h"
+#include "ROOT/TDetachedObjectsGuard.hxx"
 
 Longptr_t TObject::fgDtorOnly = 0;
 Bool_t TObject::fgObjectStat = kTRUE;
@@ -171,9 +172,12 @@ TObject::~TObject()
 /// Private helper function which will dispatch to
 /// TObjectTable::AddObj.
 /// Included here to avoid circular dependency between header files.
+/// Objects created in the scope of a ROOT::TDetachedObjectsGuard are not added.
 
 void TObject::AddToTObjectTable(TObject *op)
 {
+   if (ROOT::TDetachedObjectsGuard::IsActive())
+      return;
    TObjectTable::AddObj(op);
 }
 
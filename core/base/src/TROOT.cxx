@@ -525,6 +525,10 @@ namespace Internal {
    /// variable `ROOT_MAX_THREADS`: `export ROOT_MAX_THREADS=2` will try to set
    /// the maximum number of active threads to 2, if the scheduling library
    /// (such as tbb) "permits".
+   /// On machines with several NUMA domains, `export ROOT_TASKARENA_NUMA=1`
+   /// partitions the threads per domain and keeps the reading and processing
+   /// of each TTreeProcessorMT (and thus RDataFrame) task on a single domain
+   /// (requires oneTBB built with hwloc support).
    ///
    /// \note Use `DisableImplicitMT()` to disable multi-threading (some locks will remain in place as
    /// described in EnableThreadSafety()). `EnableImplicitMT(1)` creates a thread-pool of size 1.
@@ -2010,6 +2014,12 @@ void TROOT::InitThreads()
 ////////////////////////////////////////////////////////////////////////////////
 /// Initialize the interpreter. Should be called only after main(),
 /// to make sure LLVM/Clang is fully initialized.
+///
+/// For short jobs, the environment variable `ROOT_FAST_START=1` reduces the
+/// work done here: only the core C++ modules are preloaded (the others are
+/// loaded on demand through the global module index) and the rootmap files
+/// are only read at the first autoload request. Compiled programs which only
+/// use dictionaries of linked libraries then never read them.
 
 void TROOT::InitInterpreter()
 {
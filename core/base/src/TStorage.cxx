@@ -28,9 +28,19 @@ occur.
 
 Set the compile option R__NOSTATS to de-activate all memory checking
 and statistics gathering in the system.
+
+Small objects that are created and deleted at a high rate (e.g. the
+TKey and TBasket instances of the I/O) can be allocated from a pool
+with size classes via ObjectPoolAlloc() and ObjectPoolDealloc(). The
+pool is enabled by setting the environment variable ROOT_OBJECT_POOL=1
+before the start of the process; otherwise these functions fall back
+to ObjectAlloc() and ObjectDealloc().
 */
 
 #include <stdlib.h>
+#include <cstring>
+#include <mutex>
+#include <vector>
 
 #include "TROOT.h"
 #include "TObjectTable.h"
@@ -343,6 +353,208 @@ void TStorage::ObjectDealloc(void *vp, size_t size)
 }
 #endif
 
+namespace {
+
+////////////////////////////////////////////////////////////////////////////////
+/// Pool of memory blocks of up to kMaxSize bytes, in size classes of kGranularity bytes. Every thread keeps a cache
+/// of free blocks per size class, which exchanges lists of kBatchSize blocks with the global depot; the depot carves
+/// new blocks out of chunks of kChunkSize bytes. The memory of the pool is never returned to the system.
+
+class TObjectPool {
+public:
+   static constexpr size_t kGranularity = 16;
+   static constexpr size_t kMaxSize = 1024;
+   static constexpr size_t kNClasses = kMaxSize / kGranularity;
+   static constexpr size_t kBatchSize = 64;
+   static constexpr size_t kChunkSize = 64 * 1024;
+
+private:
+   struct FreeBlock {
+      FreeBlock *fNext;
+   };
+
+   /// The free blocks of a size class owned by a thread
+   struct ThreadList {
+      FreeBlock *fHead = nullptr;
+      size_t fCount = 0;
+   };
+
+   /// The free blocks of a size class shared by all threads, as lists of blocks
+   struct DepotClass {
+      std::mutex fMutex;
+      std::vector<ThreadList> fLists;
+
+      void Put(const ThreadList &list)
+      {
+         std::lock_guard<std::mutex> lock(fMutex);
+         fLists.emplace_back(list);
+      }
+   };
+
+   struct ThreadCache {
+      ThreadList fClasses[kNClasses];
+      ~ThreadCache()
+      {
+         for (size_t i = 0; i < kNClasses; ++i) {
+            if (fClasses[i].fHead)
+               GetDepot()[i].Put(fClasses[i]);
+         }
+      }
+   };
+
+   static DepotClass *GetDepot()
+   {
+      // Leaked on purpose: blocks can be freed by static destructors
+      static DepotClass *depot = new DepotClass[kNClasses];
+      return depot;
+   }
+
+   static inline thread_local ThreadCache *tlCache = nullptr;
+   static inline thread_local bool tlIsCacheDestroyed = false;
+
+   /// Returns the cache of the current thread, or nullptr during the destruction of the thread
+   static ThreadCache *GetThreadCache()
+   {
+      struct CacheOwner {
+         ThreadCache fCache;
+         ~CacheOwner()
+         {
+            tlIsCacheDestroyed = true;
+            tlCache = nullptr;
+         }
+      };
+      if (tlCache)
+         return tlCache;
+      if (tlIsCacheDestroyed)
+         return nullptr;
+      static thread_local CacheOwner owner;
+      tlCache = &owner.fCache;
+      return tlCache;
+   }
+
+   static size_t GetClassIndex(size_t size) { return size ? (size - 1) / kGranularity : 0; }
+
+   /// Fills the (empty) list from the depot or with the blocks of a new chunk
+   static void Refill(size_t idx, ThreadList &list)
+   {
+      DepotClass &depot = GetDepot()[idx];
+      std::lock_guard<std::mutex> lock(depot.fMutex);
+      if (!depot.fLists.empty()) {
+         list = depot.fLists.back();
+         depot.fLists.pop_back();
+         return;
+      }
+      const size_t blockSize = (idx + 1) * kGranularity;
+      char *chunk = static_cast<char *>(::operator new(kChunkSize));
+      for (size_t offset = 0; offset + blockSize <= kChunkSize; offset += blockSize) {
+         auto block = reinterpret_cast<FreeBlock *>(chunk + offset);
+         block->fNext = list.fHead;
+         list.fHead = block;
+         ++list.fCount;
+      }
+   }
+
+public:
+   static bool IsEnabled()
+   {
+      static const bool isEnabled = [] {
+         const char *env = getenv("ROOT_OBJECT_POOL");
+         return env && strcmp(env, "1") == 0;
+      }();
+      return isEnabled;
+   }
+
+   static void *Alloc(size_t size)
+   {
+      if (size > kMaxSize)
+         return ::operator new(size);
+      const size_t idx = GetClassIndex(size);
+      ThreadCache *cache = GetThreadCache();
+      ThreadList local;
+      ThreadList &list = cache ? cache->fClasses[idx] : local;
+      if (!list.fHead)
+         Refill(idx, list);
+      FreeBlock *block = list.fHead;
+      list.fHead = block->fNext;
+      --list.fCount;
+      if (!cache && list.fHead)
+         GetDepot()[idx].Put(list);
+      return block;
+   }
+
+   static void Dealloc(void *vp, size_t size)
+   {
+      if (size > kMaxSize) {
+         ::operator delete(vp);
+         return;
+      }
+      const size_t idx = GetClassIndex(size);
+      auto block = static_cast<FreeBlock *>(vp);
+      ThreadCache *cache = GetThreadCache();
+      if (!cache) {
+         ThreadList single{block, 1};
+         block->fNext = nullptr;
+         GetDepot()[idx].Put(single);
+         return;
+      }
+      ThreadList &list = cache->fClasses[idx];
+      block->fNext = list.fHead;
+      list.fHead = block;
+      if (++list.fCount < 2 * kBatchSize)
+         return;
+      // Hand over a batch to the depot, where it can be reused by the other threads
+      ThreadList batch{list.fHead, kBatchSize};
+      FreeBlock *last = list.fHead;
+      for (size_t i = 1; i < kBatchSize; ++i)
+         last = last->fNext;
+      list.fHead = last->fNext;
+      list.fCount -= kBatchSize;
+      last->fNext = nullptr;
+      GetDepot()[idx].Put(batch);
+   }
+};
+
+} // anonymous namespace
+
+////////////////////////////////////////////////////////////////////////////////
+/// Used to allocate a small TObject that is frequently created and deleted
+/// (via a class specific operator new()) from the object pool, if it is enabled
+/// with ROOT_OBJECT_POOL=1; otherwise same as ObjectAlloc(). Blocks must be
+/// released with ObjectPoolDealloc() and the same size, i.e. the class needs
+/// a sized operator delete(void*, size_t).
+
+void *TStorage::ObjectPoolAlloc(size_t sz)
+{
+   if (!TObjectPool::IsEnabled())
+      return ObjectAlloc(sz);
+   void *space = TObjectPool::Alloc(sz);
+   memset(space, kObjectAllocMemValue, sz);
+   return space;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Used to deallocate a TObject allocated with ObjectPoolAlloc(). The block is
+/// kept in the pool of the calling thread for later allocations of objects in
+/// the same size class.
+
+void TStorage::ObjectPoolDealloc(void *vp, size_t size)
+{
+   if (!vp)
+      return;
+   if (!TObjectPool::IsEnabled())
+      ObjectDealloc(vp);
+   else
+      TObjectPool::Dealloc(vp, size);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return true if ObjectPoolAlloc() allocates from the object pool.
+
+Bool_t TStorage::IsObjectPoolEnabled()
+{
+   return TObjectPool::IsEnabled();
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Set a free handler.
 
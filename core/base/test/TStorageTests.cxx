@@ -0,0 +1,54 @@
+#include "gtest/gtest.h"
+
+#include "TStorage.h"
+
+#include <cstdlib>
+#include <set>
+#include <thread>
+#include <vector>
+
+// The object pool is configured once per process, by the first use of ObjectPoolAlloc()
+TEST(TStorage, ObjectPool)
+{
+   setenv("ROOT_OBJECT_POOL", "1", 1);
+   ASSERT_TRUE(TStorage::IsObjectPoolEnabled());
+
+   void *p = TStorage::ObjectPoolAlloc(40);
+   EXPECT_EQ(*static_cast<UInt_t *>(p), TStorage::kObjectAllocMemValue);
+   TStorage::ObjectPoolDealloc(p, 40);
+   // Freed blocks are reused for the same size class
+   void *q = TStorage::ObjectPoolAlloc(48);
+   EXPECT_EQ(p, q);
+   TStorage::ObjectPoolDealloc(q, 48);
+
+   // Large objects are not pooled
+   void *large = TStorage::ObjectPoolAlloc(4096);
+   TStorage::ObjectPoolDealloc(large, 4096);
+}
+
+TEST(TStorage, ObjectPoolThreads)
+{
+   setenv("ROOT_OBJECT_POOL", "1", 1);
+   ASSERT_TRUE(TStorage::IsObjectPoolEnabled());
+
+   // Blocks allocated in one thread and freed in another one end up in the depot shared by all threads
+   std::vector<void *> blocks;
+   std::thread producer([&blocks] {
+      for (int i = 0; i < 1000; ++i)
+         blocks.push_back(TStorage::ObjectPoolAlloc(24 + i % 200));
+   });
+   producer.join();
+   EXPECT_EQ(std::set<void *>(blocks.begin(), blocks.end()).size(), blocks.size());
+
+   std::vector<std::thread> consumers;
+   for (int t = 0; t < 4; ++t) {
+      consumers.emplace_back([&blocks, t] {
+         for (std::size_t i = t; i < blocks.size(); i += 4)
+            TStorage::ObjectPoolDealloc(blocks[i], 24 + i % 200);
+         for (int i = 0; i < 1000; ++i)
+            TStorage::ObjectPoolDealloc(TStorage::ObjectPoolAlloc(100), 100);
+      });
+   }
+   for (auto &thread : consumers)
+      thread.join();
+}
@@ -22,6 +22,10 @@
 // Hash() function. Each class inheriting from TObject can override     //
 // Hash() as it sees fit.                                               //
 //                                                                      //
+// The lookups go through a contiguous open addressing index of         //
+// (hash value, object) pairs, the slots of TLists are kept for the     //
+// users of GetListForObject().                                         //
+//                                                                      //
 //////////////////////////////////////////////////////////////////////////
 
 #include "TCollection.h"
@@ -37,17 +41,35 @@ class THashTable : public TCollection {
 friend class  THashTableIter;
 
 private:
+   // Entry of the open addressing index. An entry with a null fObject is empty
+   // if fHash is 0 and deleted (a tombstone) otherwise.
+   struct TIndexEntry {
+      ULong_t  fHash;          //Full hash value of the object when it was added
+      TObject *fObject;        //The object
+   };
+
    TList     **fCont;          //Hash table (table of lists)
    Int_t       fEntries;       //Number of objects in table
    Int_t       fUsedSlots;     //Number of used slots
    Int_t       fRehashLevel;   //Average collision rate which triggers rehash
+   TIndexEntry *fIndex = nullptr;  //!Open addressing index of the objects, with linear probing
+   Int_t       fIndexCapacity = 0; //!Number of index entries, a power of two
+   Int_t       fIndexUsed = 0;     //!Number of non-empty index entries, including tombstones
+   Int_t       fIndexShift = 0;    //!Shift turning a mixed hash value into an index position
 
    Int_t       GetCheckedHashValue(TObject *obj) const;
    Int_t       GetHashValue(const TObject *obj) const;
    Int_t       GetHashValue(TString &s) const { return s.Hash() % fSize; }
    Int_t       GetHashValue(const char *str) const { return ::Hash(str) % fSize; }
 
-   void        AddImpl(Int_t slot, TObject *object);
+   void        AddImpl(Int_t slot, ULong_t hash, TObject *object);
+
+   Int_t       IndexPosition(ULong_t hash) const;
+   void        IndexInsert(ULong_t hash, TObject *obj);
+   void        IndexRemove(ULong_t hash, TObject *obj);
+   void        IndexRemoveSlow(TObject *obj);
+   void        IndexResize(Int_t minEntries);
+   void        IndexClear();
 
    THashTable(const THashTable&) = delete;
    THashTable& operator=(const THashTable&) = delete;
@@ -90,6 +112,13 @@ inline Float_t THashTable::AverageCollisions() const
       return 0.0;
 }
 
+inline Int_t THashTable::IndexPosition(ULong_t hash) const
+{
+   // Fibonacci hashing: the upper bits of the product depend on all bits of the hash value,
+   // which also spreads the pointer based hash values of TObject::Hash().
+   return Int_t((ULong64_t(hash) * 0x9E3779B97F4A7C15ull) >> fIndexShift);
+}
+
 inline Int_t THashTable::GetCheckedHashValue(TObject *obj) const
 {
    Int_t i = Int_t(obj->CheckedHash() % fSize); // need intermediary i for Linux g++
@@ -19,6 +19,14 @@ Hash() as it sees fit.
 THashTable does not preserve the insertion order of the objects.
 If the insertion order is important AND fast retrieval is needed
 use THashList instead.
+
+Besides the slots of TLists, which are returned by GetListForObject(),
+the table keeps an open addressing index storing the full hash value and
+the address of every object contiguously in memory. FindObject() probes
+this index, which usually touches a single cache line and compares the
+names or the objects only for matching hash values, instead of walking
+the linked list of a slot. If several objects match, e.g. several cycles
+of a key, the first match in the slot's list is returned as before.
 */
 
 #include "THashTable.h"
@@ -27,8 +35,19 @@ use THashList instead.
 #include "TError.h"
 #include "TROOT.h"
 
+#include <cstring>
+
 ClassImp(THashTable);
 
+namespace {
+
+/// Marks a deleted index entry, see THashTable::TIndexEntry
+constexpr ULong_t kIndexTombstone = 1;
+/// Smallest size of a non-empty index
+constexpr Int_t kIndexMinCapacity = 16;
+
+} // anonymous namespace
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Create a THashTable object. Capacity is the initial hashtable capacity
 /// (i.e. number of slots), by default kInitHashTableCapacity = 17, and
@@ -68,23 +87,134 @@ THashTable::~THashTable()
    delete [] fCont;
    fCont = nullptr;
    fSize = 0;
+   delete [] fIndex;
+   fIndex = nullptr;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
-/// Helper function doing the actual add to the table give a slot and object.
-/// This does not take any lock.
+/// Helper function doing the actual add to the table give a slot, the full
+/// hash value and object. This does not take any lock.
 
 inline
-void THashTable::AddImpl(Int_t slot, TObject *obj)
+void THashTable::AddImpl(Int_t slot, ULong_t hash, TObject *obj)
 {
    if (!fCont[slot]) {
       fCont[slot] = new TList;
       ++fUsedSlots;
    }
    fCont[slot]->Add(obj);
+   IndexInsert(hash, obj);
    ++fEntries;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Add the object with the given full hash value to the index. The index is
+/// grown such that at most half of its entries are used. This does not take
+/// any lock.
+
+void THashTable::IndexInsert(ULong_t hash, TObject *obj)
+{
+   if (2 * (fIndexUsed + 1) > fIndexCapacity)
+      IndexResize(fEntries + 1);
+
+   const Int_t mask = fIndexCapacity - 1;
+   for (Int_t i = IndexPosition(hash);; i = (i + 1) & mask) {
+      TIndexEntry &entry = fIndex[i];
+      if (!entry.fObject) {
+         if (entry.fHash != kIndexTombstone)
+            ++fIndexUsed;
+         entry.fHash = hash;
+         entry.fObject = obj;
+         return;
+      }
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Remove the object from the index, leaving a tombstone. The object is
+/// looked up with the given hash value first; if it was added with another
+/// hash value (e.g. it was renamed), the whole index is searched. This does
+/// not take any lock.
+
+void THashTable::IndexRemove(ULong_t hash, TObject *obj)
+{
+   if (!fIndex)
+      return;
+
+   const Int_t mask = fIndexCapacity - 1;
+   for (Int_t i = IndexPosition(hash);; i = (i + 1) & mask) {
+      TIndexEntry &entry = fIndex[i];
+      if (entry.fObject == obj) {
+         entry.fHash = kIndexTombstone;
+         entry.fObject = nullptr;
+         return;
+      }
+      if (!entry.fObject && entry.fHash != kIndexTombstone)
+         break;
+   }
+   IndexRemoveSlow(obj);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Remove the object from the index without using its hash value. This does
+/// not take any lock.
+
+void THashTable::IndexRemoveSlow(TObject *obj)
+{
+   for (Int_t i = 0; i < fIndexCapacity; ++i) {
+      if (fIndex[i].fObject == obj) {
+         fIndex[i].fHash = kIndexTombstone;
+         fIndex[i].fObject = nullptr;
+         return;
+      }
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Reallocate the index for at least minEntries objects, re-inserting the
+/// objects and dropping the tombstones. This does not take any lock.
+
+void THashTable::IndexResize(Int_t minEntries)
+{
+   Int_t capacity = kIndexMinCapacity;
+   Int_t shift = 64 - 4;
+   while (capacity < 4 * minEntries) {
+      capacity *= 2;
+      --shift;
+   }
+
+   TIndexEntry *oldIndex = fIndex;
+   const Int_t oldCapacity = fIndexCapacity;
+   fIndex = new TIndexEntry[capacity]();
+   fIndexCapacity = capacity;
+   fIndexShift = shift;
+   fIndexUsed = 0;
+
+   const Int_t mask = fIndexCapacity - 1;
+   for (Int_t j = 0; j < oldCapacity; ++j) {
+      if (!oldIndex[j].fObject)
+         continue;
+      Int_t i = IndexPosition(oldIndex[j].fHash);
+      while (fIndex[i].fObject)
+         i = (i + 1) & mask;
+      fIndex[i] = oldIndex[j];
+      ++fIndexUsed;
+   }
+   delete [] oldIndex;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Release the index. This does not take any lock.
+
+void THashTable::IndexClear()
+{
+   delete [] fIndex;
+   fIndex = nullptr;
+   fIndexCapacity = 0;
+   fIndexUsed = 0;
+   fIndexShift = 0;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Add object to the hash table. Its position in the table will be
 /// determined by the value returned by its Hash() function.
@@ -93,11 +223,12 @@ void THashTable::Add(TObject *obj)
 {
    if (IsArgNull("Add", obj)) return;
 
-   Int_t slot = GetCheckedHashValue(obj);
+   ULong_t hash = obj->CheckedHash();
+   Int_t slot = Int_t(hash % fSize);
 
    R__COLLECTION_WRITE_LOCKGUARD(ROOT::gCoreMutex);
 
-   AddImpl(slot,obj);
+   AddImpl(slot,hash,obj);
 
    if (fRehashLevel && AverageCollisions() > fRehashLevel)
       Rehash(fEntries);
@@ -113,7 +244,8 @@ void THashTable::AddBefore(const TObject *before, TObject *obj)
 {
    if (IsArgNull("Add", obj)) return;
 
-   Int_t slot = GetCheckedHashValue(obj);
+   ULong_t hash = obj->CheckedHash();
+   Int_t slot = Int_t(hash % fSize);
 
    R__COLLECTION_WRITE_LOCKGUARD(ROOT::gCoreMutex);
    if (!fCont[slot]) {
@@ -125,6 +257,7 @@ void THashTable::AddBefore(const TObject *before, TObject *obj)
    } else {
       fCont[slot]->Add(obj);
    }
+   IndexInsert(hash, obj);
    fEntries++;
 
    if (fRehashLevel && AverageCollisions() > fRehashLevel)
@@ -178,6 +311,7 @@ void THashTable::Clear(Option_t *option)
       }
       SafeDelete(fCont[i]);
    }
+   IndexClear();
 
    fEntries   = 0;
    fUsedSlots = 0;
@@ -226,6 +360,7 @@ void THashTable::Delete(Option_t *)
          fCont[i]->Delete();
          SafeDelete(fCont[i]);
       }
+   IndexClear();
 
    fEntries   = 0;
    fUsedSlots = 0;
@@ -237,12 +372,27 @@ void THashTable::Delete(Option_t *)
 
 TObject *THashTable::FindObject(const char *name) const
 {
-   Int_t slot = GetHashValue(name);
+   ULong_t hash = ::Hash(name);
 
    R__COLLECTION_READ_LOCKGUARD(ROOT::gCoreMutex);
 
-   if (fCont[slot]) return fCont[slot]->FindObject(name);
-   return nullptr;
+   if (!fIndex) return nullptr;
+
+   TObject *found = nullptr;
+   const Int_t mask = fIndexCapacity - 1;
+   for (Int_t i = IndexPosition(hash);; i = (i + 1) & mask) {
+      const TIndexEntry &entry = fIndex[i];
+      if (!entry.fObject) {
+         if (entry.fHash != kIndexTombstone) break;
+         continue;
+      }
+      if (entry.fHash == hash && !strcmp(name, entry.fObject->GetName())) {
+         // Several objects with this name: return the first one of the slot's list.
+         if (found) return fCont[hash % fSize] ? fCont[hash % fSize]->FindObject(name) : found;
+         found = entry.fObject;
+      }
+   }
+   return found;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -252,12 +402,27 @@ TObject *THashTable::FindObject(const TObject *obj) const
 {
    if (IsArgNull("FindObject", obj)) return nullptr;
 
-   Int_t slot = GetHashValue(obj);
+   ULong_t hash = obj->Hash();
 
    R__COLLECTION_READ_LOCKGUARD(ROOT::gCoreMutex);
 
-   if (fCont[slot]) return fCont[slot]->FindObject(obj);
-   return nullptr;
+   if (!fIndex) return nullptr;
+
+   TObject *found = nullptr;
+   const Int_t mask = fIndexCapacity - 1;
+   for (Int_t i = IndexPosition(hash);; i = (i + 1) & mask) {
+      const TIndexEntry &entry = fIndex[i];
+      if (!entry.fObject) {
+         if (entry.fHash != kIndexTombstone) break;
+         continue;
+      }
+      if (entry.fHash == hash && entry.fObject->IsEqual(obj)) {
+         // Several equal objects: return the first one of the slot's list.
+         if (found) return fCont[hash % fSize] ? fCont[hash % fSize]->FindObject(obj) : found;
+         found = entry.fObject;
+      }
+   }
+   return found;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -373,13 +538,18 @@ void THashTable::Rehash(Int_t newCapacity, Bool_t checkObjValidity)
 
    auto initialSize = GetEntries();
 
+   auto addToNewTable = [ht](TObject *o) {
+      ULong_t hash = o->Hash();
+      ht->AddImpl(Int_t(hash % ht->fSize), hash, o);
+   };
+
    if (checkObjValidity && TObject::GetObjectStat() && gObjectTable) {
       while ((obj = next()))
          if (gObjectTable->PtrIsValid(obj))
-            ht->AddImpl(ht->GetHashValue(obj),obj);
+            addToNewTable(obj);
    } else {
       while ((obj = next()))
-         ht->AddImpl(ht->GetHashValue(obj),obj);
+         addToNewTable(obj);
    }
 
    if (initialSize != GetEntries()) {
@@ -398,6 +568,11 @@ void THashTable::Rehash(Int_t newCapacity, Bool_t checkObjValidity)
    delete [] fCont;
    fCont = ht->fCont;
    ht->fCont = nullptr;
+   fIndex = ht->fIndex;         // Clear() released our index
+   fIndexCapacity = ht->fIndexCapacity;
+   fIndexUsed = ht->fIndexUsed;
+   fIndexShift = ht->fIndexShift;
+   ht->fIndex = nullptr;
 
    fSize      = ht->fSize;     // idem
    fEntries   = ht->fEntries;
@@ -416,7 +591,8 @@ void THashTable::Rehash(Int_t newCapacity, Bool_t checkObjValidity)
 
 TObject *THashTable::Remove(TObject *obj)
 {
-   Int_t slot = GetHashValue(obj);
+   ULong_t hash = obj->Hash();
+   Int_t slot = Int_t(hash % fSize);
 
    R__COLLECTION_READ_LOCKGUARD(ROOT::gCoreMutex);
 
@@ -425,6 +601,7 @@ TObject *THashTable::Remove(TObject *obj)
 
       TObject *ob = fCont[slot]->Remove(obj);
       if (ob) {
+         IndexRemove(hash, ob);
          fEntries--;
          if (fCont[slot]->GetSize() == 0) {
             SafeDelete(fCont[slot]);
@@ -448,6 +625,7 @@ TObject *THashTable::RemoveSlow(TObject *obj)
       if (fCont[i]) {
          TObject *ob = fCont[i]->Remove(obj);
          if (ob) {
+            IndexRemoveSlow(ob);
             fEntries--;
             if (fCont[i]->GetSize() == 0) {
                SafeDelete(fCont[i]);
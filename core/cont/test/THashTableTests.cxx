@@ -0,0 +1,146 @@
+#include "THashList.h"
+#include "THashTable.h"
+#include "TList.h"
+#include "TNamed.h"
+#include "TObjString.h"
+
+#include "gtest/gtest.h"
+
+#include <chrono>
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <vector>
+
+TEST(THashTable, AddFindRemove)
+{
+   THashTable table;
+   std::vector<std::unique_ptr<TNamed>> objects;
+   for (int i = 0; i < 1000; ++i) {
+      objects.emplace_back(new TNamed(("obj" + std::to_string(i)).c_str(), "title"));
+      table.Add(objects.back().get());
+   }
+   EXPECT_EQ(table.GetSize(), 1000);
+
+   for (int i = 0; i < 1000; ++i) {
+      EXPECT_EQ(table.FindObject(("obj" + std::to_string(i)).c_str()), objects[i].get());
+      EXPECT_EQ(table.FindObject(objects[i].get()), objects[i].get());
+   }
+   EXPECT_EQ(table.FindObject("missing"), nullptr);
+
+   for (int i = 0; i < 1000; i += 2)
+      EXPECT_EQ(table.Remove(objects[i].get()), objects[i].get());
+   EXPECT_EQ(table.GetSize(), 500);
+   for (int i = 0; i < 1000; ++i) {
+      TObject *expected = (i % 2) ? objects[i].get() : nullptr;
+      EXPECT_EQ(table.FindObject(("obj" + std::to_string(i)).c_str()), expected);
+   }
+
+   // Re-adding after the removals reuses the deleted index entries
+   for (int i = 0; i < 1000; i += 2)
+      table.Add(objects[i].get());
+   for (int i = 0; i < 1000; ++i)
+      EXPECT_EQ(table.FindObject(("obj" + std::to_string(i)).c_str()), objects[i].get());
+
+   table.Clear();
+   EXPECT_EQ(table.GetSize(), 0);
+   EXPECT_EQ(table.FindObject("obj1"), nullptr);
+}
+
+TEST(THashTable, Rehash)
+{
+   THashTable table(16, 2);
+   std::vector<std::unique_ptr<TObjString>> objects;
+   for (int i = 0; i < 500; ++i) {
+      objects.emplace_back(new TObjString(("str" + std::to_string(i)).c_str()));
+      table.Add(objects.back().get());
+   }
+   EXPECT_GT(table.Capacity(), 17);
+   table.Rehash(2000);
+   EXPECT_EQ(table.GetSize(), 500);
+
+   for (int i = 0; i < 500; ++i) {
+      TObjString probe(("str" + std::to_string(i)).c_str());
+      EXPECT_EQ(table.FindObject(&probe), objects[i].get());
+   }
+}
+
+TEST(THashTable, RemoveSlow)
+{
+   THashTable table;
+   TNamed a("a", ""), b("b", "");
+   table.Add(&a);
+   table.Add(&b);
+   // After a rename the object is no longer in the slot of its hash value
+   a.SetName("renamed");
+   EXPECT_EQ(table.RemoveSlow(&a), &a);
+   EXPECT_EQ(table.FindObject("renamed"), nullptr);
+   EXPECT_EQ(table.FindObject("b"), &b);
+   EXPECT_EQ(table.GetSize(), 1);
+}
+
+TEST(THashList, DuplicateNamesKeepSlotOrder)
+{
+   // Several objects with the same name, like the cycles of a key in a directory:
+   // FindObject returns the first one in the list of the hash table slot.
+   THashList list;
+   TNamed cycle1("key", "1"), cycle2("key", "2"), cycle3("key", "3");
+   list.Add(&cycle1);
+   list.Add(&cycle2);
+   EXPECT_EQ(list.FindObject("key"), &cycle1);
+   list.AddBefore(&cycle1, &cycle3);
+   EXPECT_EQ(list.FindObject("key"), &cycle3);
+   EXPECT_EQ(list.FindObject("key"), list.GetListForObject("key")->First());
+   list.Remove(&cycle3);
+   EXPECT_EQ(list.FindObject("key"), &cycle1);
+   list.Remove(&cycle1);
+   EXPECT_EQ(list.FindObject("key"), &cycle2);
+}
+
+// Measures the insert and lookup throughput of THashTable and THashList.
+// Run with --gtest_also_run_disabled_tests.
+TEST(THashTable, DISABLED_Benchmark)
+{
+   using clock = std::chrono::steady_clock;
+   const int nObjects = 100000;
+   const int nLookups = 10;
+
+   std::vector<std::string> names;
+   std::vector<std::unique_ptr<TNamed>> objects;
+   for (int i = 0; i < nObjects; ++i) {
+      names.emplace_back("histogram_" + std::to_string(i));
+      objects.emplace_back(new TNamed(names.back().c_str(), ""));
+   }
+
+   for (Int_t rehashLevel : {0, 2}) {
+      THashTable table(TCollection::kInitHashTableCapacity, rehashLevel);
+      auto start = clock::now();
+      for (auto &obj : objects)
+         table.Add(obj.get());
+      const double tInsert = std::chrono::duration<double>(clock::now() - start).count();
+
+      start = clock::now();
+      std::size_t nFound = 0;
+      for (int n = 0; n < nLookups; ++n)
+         for (auto &name : names)
+            nFound += table.FindObject(name.c_str()) != nullptr;
+      const double tFind = std::chrono::duration<double>(clock::now() - start).count();
+      EXPECT_EQ(nFound, std::size_t(nObjects) * nLookups);
+
+      printf("THashTable (rehash level %d): %.1f Minserts/s, %.1f Mlookups/s\n", rehashLevel,
+             nObjects / tInsert * 1e-6, nObjects * nLookups / tFind * 1e-6);
+   }
+
+   THashList hashList;
+   auto start = clock::now();
+   for (auto &obj : objects)
+      hashList.Add(obj.get());
+   const double tInsert = std::chrono::duration<double>(clock::now() - start).count();
+   start = clock::now();
+   for (int n = 0; n < nLookups; ++n)
+      for (auto &name : names)
+         EXPECT_NE(hashList.FindObject(name.c_str()), nullptr);
+   const double tFind = std::chrono::duration<double>(clock::now() - start).count();
+   printf("THashList: %.1f Minserts/s, %.1f Mlookups/s\n", nObjects / tInsert * 1e-6,
+          nObjects * nLookups / tFind * 1e-6);
+}
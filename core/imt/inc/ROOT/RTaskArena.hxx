@@ -24,7 +24,9 @@
 #define ROOT_RTaskArena
 
 #include "RConfigure.h"
+#include <functional>
 #include <memory>
+#include <vector>
 
 // exclude in case ROOT does not have IMT support
 #ifndef R__USE_IMT
@@ -59,16 +61,27 @@ int LogicalCPUBandwidthControl();
 ///
 /// Necessary in order to keep tbb away from ROOT headers.
 /// This class is thought out to be used as a singleton.
+///
+/// If the environment variable `ROOT_TASKARENA_NUMA` is set to 1, one additional
+/// arena per NUMA domain, with threads pinned to the domain, is created and
+/// shares the workers of the global arena. Work that should stay on one domain
+/// (e.g. reading, decompressing and processing one entry range) can be
+/// dispatched there with ExecuteInNumaDomain().
 ////////////////////////////////////////////////////////////////////////////////
 class RTaskArenaWrapper {
 public:
    ~RTaskArenaWrapper(); // necessary to set size back to zero
    static unsigned TaskArenaSize(); // A static getter lets us check for RTaskArenaWrapper's existence
    ROOT::ROpaqueTaskArena &Access();
+   unsigned GetNNumaDomains() const { return fNumaArenas.size(); }
+   void ExecuteInNumaDomain(unsigned affinityHint, const std::function<void()> &f);
 private:
    RTaskArenaWrapper(unsigned maxConcurrency = 0);
+   void CreateNumaArenas(unsigned maxConcurrency);
    friend std::shared_ptr<ROOT::Internal::RTaskArenaWrapper> GetGlobalTaskArena(unsigned maxConcurrency);
    std::unique_ptr<ROOT::ROpaqueTaskArena> fTBBArena;
+   /// One arena per NUMA domain, empty unless NUMA partitioning is enabled and supported
+   std::vector<std::unique_ptr<ROOT::ROpaqueTaskArena>> fNumaArenas;
    static unsigned fNWorkers;
 };
 
@@ -0,0 +1,90 @@
+// @(#)root/thread:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_RTaskTracer
+#define ROOT_RTaskTracer
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+
+namespace ROOT {
+namespace Experimental {
+
+/**
+\class ROOT::Experimental::RTaskTracer
+\ingroup Parallelism
+\brief Records the begin, the end and the payload size of ROOT's internal tasks and exports them in the Chrome trace
+event format.
+
+The tasks of implicit multi-threading are instrumented with RTaskTracer::RScope objects: basket unzipping in
+TTreeCacheUnzip, basket compression in TTree::FlushBaskets, page unzipping in RNTuple and the processing of an entry
+range by an RDataFrame slot. Tracing is off by default and an instrumented task then only pays for one relaxed atomic
+load. When tracing is enabled, every thread records its tasks in its own buffer.
+
+The trace, written by WriteChromeTrace(), can be loaded in chrome://tracing or https://ui.perfetto.dev. Tracing of
+the whole process is enabled with the environment variable `ROOT_TASK_TRACE=<file.json>`: the trace is then written
+to the given file at the end of the process.
+
+~~~{.cpp}
+ROOT::Experimental::RTaskTracer::Enable();
+df.Histo1D("x")->Draw();
+ROOT::Experimental::RTaskTracer::WriteChromeTrace("trace.json");
+~~~
+*/
+class RTaskTracer {
+   static std::atomic<bool> fgIsEnabled;
+
+   static std::int64_t Now();
+   static void Record(const char *category, const char *name, std::uint64_t payload, std::int64_t begin);
+
+public:
+   /// Traces a task from construction to destruction, if tracing is enabled at construction
+   class RScope {
+      const char *fCategory;
+      const char *fName;
+      std::uint64_t fPayload;
+      std::int64_t fBegin = -1;
+
+   public:
+      /// The category and the name must be string literals or otherwise outlive the tracer.
+      /// The payload is e.g. the number of bytes (un)compressed or of entries processed by the task.
+      RScope(const char *category, const char *name, std::uint64_t payload = 0)
+         : fCategory(category), fName(name), fPayload(payload)
+      {
+         if (IsEnabled())
+            fBegin = Now();
+      }
+      ~RScope()
+      {
+         if (fBegin >= 0)
+            Record(fCategory, fName, fPayload, fBegin);
+      }
+      RScope(const RScope &) = delete;
+      RScope &operator=(const RScope &) = delete;
+      /// Sets the payload if it is only known at the end of the task
+      void SetPayload(std::uint64_t payload) { fPayload = payload; }
+   };
+
+   static bool IsEnabled() { return fgIsEnabled.load(std::memory_order_relaxed); }
+   static void Enable() { fgIsEnabled = true; }
+   static void Disable() { fgIsEnabled = false; }
+   /// Drops the tasks recorded so far
+   static void Clear();
+   /// Returns the number of tasks recorded so far
+   static std::uint64_t GetNTasks();
+   /// Writes the recorded tasks as a JSON trace in the Chrome trace event format. Returns false on I/O errors.
+   static bool WriteChromeTrace(const std::string &path);
+};
+
+} // namespace Experimental
+} // namespace ROOT
+
+#endif
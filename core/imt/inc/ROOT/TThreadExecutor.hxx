@@ -128,10 +128,13 @@ namespace ROOT {
 
       // Functions that interface with the parallel library used as a backend
       void   ParallelFor(unsigned start, unsigned end, unsigned step, const std::function<void(unsigned int i)> &f);
+      void   ParallelForChunks(unsigned nItems, const std::function<void(unsigned int begin, unsigned int end)> &f);
       double ParallelReduce(const std::vector<double> &objs, const std::function<double(double a, double b)> &redfunc);
       float  ParallelReduce(const std::vector<float> &objs, const std::function<float(float a, float b)> &redfunc);
       template<class T, class R>
       auto SeqReduce(const std::vector<T> &objs, R redfunc) -> decltype(redfunc(objs));
+      template <class T, class BINARYOP>
+      T ParallelTreeReduce(const std::vector<T> &objs, BINARYOP redfunc);
 
       /// Pointer to the TBB task arena wrapper
       std::shared_ptr<ROOT::Internal::RTaskArenaWrapper> fTaskArenaW = nullptr;
@@ -145,10 +148,14 @@ namespace ROOT {
    /// \param func Function to be executed.
    /// \param nTimes Number of times function should be called.
    /// \param nChunks Number of chunks to split the input data for processing.
+   /// With the default, 0, the chunks are tuned automatically, see ParallelForChunks().
    template<class F>
    void TThreadExecutor::Foreach(F func, unsigned nTimes, unsigned nChunks) {
       if (nChunks == 0) {
-         ParallelFor(0U, nTimes, 1, [&](unsigned int){func();});
+         ParallelForChunks(nTimes, [&](unsigned int begin, unsigned int end) {
+            for (unsigned int i = begin; i < end; ++i)
+               func();
+         });
          return;
       }
 
@@ -168,10 +175,14 @@ namespace ROOT {
    /// \param func Function to be executed. Must take an element of the sequence passed assecond argument as a parameter.
    /// \param args Sequence of indexes to execute `func` on.
    /// \param nChunks Number of chunks to split the input data for processing.
+   /// With the default, 0, the chunks are tuned automatically, see ParallelForChunks().
    template<class F, class INTEGER>
    void TThreadExecutor::Foreach(F func, ROOT::TSeq<INTEGER> args, unsigned nChunks) {
       if (nChunks == 0) {
-         ParallelFor(*args.begin(), *args.end(), args.step(), [&](unsigned int i){func(i);});
+         ParallelForChunks(args.size(), [&](unsigned int begin, unsigned int end) {
+            for (unsigned int i = begin; i < end; ++i)
+               func(args[i]);
+         });
          return;
       }
       unsigned start = *args.begin();
@@ -194,6 +205,7 @@ namespace ROOT {
    /// \param func Function to be executed on the elements of the initializer_list passed as second parameter.
    /// \param args initializer_list for a vector to apply `func` on.
    /// \param nChunks Number of chunks to split the input data for processing.
+   /// With the default, 0, the chunks are tuned automatically, see ParallelForChunks().
    template<class F, class T>
    void TThreadExecutor::Foreach(F func, std::initializer_list<T> args, unsigned nChunks) {
       std::vector<T> vargs(std::move(args));
@@ -206,11 +218,15 @@ namespace ROOT {
    /// \param func Function to be executed on the elements of the vector passed as second parameter.
    /// \param args Vector of elements passed as an argument to `func`.
    /// \param nChunks Number of chunks to split the input data for processing.
+   /// With the default, 0, the chunks are tuned automatically, see ParallelForChunks().
    template<class F, class T>
    void TThreadExecutor::Foreach(F func, std::vector<T> &args, unsigned nChunks) {
       unsigned int nToProcess = args.size();
       if (nChunks == 0) {
-         ParallelFor(0U, nToProcess, 1, [&](unsigned int i){func(args[i]);});
+         ParallelForChunks(nToProcess, [&](unsigned int begin, unsigned int end) {
+            for (unsigned int i = begin; i < end; ++i)
+               func(args[i]);
+         });
          return;
       }
 
@@ -230,11 +246,15 @@ namespace ROOT {
    /// \param func Function to be executed on the elements of the vector passed as second parameter.
    /// \param args Immutable vector of elements passed as an argument to `func`.
    /// \param nChunks Number of chunks to split the input data for processing.
+   /// With the default, 0, the chunks are tuned automatically, see ParallelForChunks().
    template<class F, class T>
    void TThreadExecutor::Foreach(F func, const std::vector<T> &args, unsigned nChunks) {
       unsigned int nToProcess = args.size();
       if (nChunks == 0) {
-         ParallelFor(0U, nToProcess, 1, [&](unsigned int i){func(args[i]);});
+         ParallelForChunks(nToProcess, [&](unsigned int begin, unsigned int end) {
+            for (unsigned int i = begin; i < end; ++i)
+               func(args[i]);
+         });
          return;
       }
 
@@ -258,11 +278,10 @@ namespace ROOT {
    {
       using retType = decltype(func());
       std::vector<retType> reslist(nTimes);
-      auto lambda = [&](unsigned int i)
-      {
-         reslist[i] = func();
-      };
-      ParallelFor(0U, nTimes, 1, lambda);
+      ParallelForChunks(nTimes, [&](unsigned int begin, unsigned int end) {
+         for (unsigned int i = begin; i < end; ++i)
+            reslist[i] = func();
+      });
 
       return reslist;
    }
@@ -277,8 +296,10 @@ namespace ROOT {
    {
       using retType = decltype(func(*args.begin()));
       std::vector<retType> reslist(args.size());
-      auto lambda = [&](unsigned int i) { reslist[i] = func(args[i]); };
-      ParallelFor(0U, args.size(), 1, lambda);
+      ParallelForChunks(args.size(), [&](unsigned int begin, unsigned int end) {
+         for (unsigned int i = begin; i < end; ++i)
+            reslist[i] = func(args[i]);
+      });
 
       return reslist;
    }
@@ -328,12 +349,10 @@ namespace ROOT {
       unsigned int nToProcess = args.size();
       std::vector<retType> reslist(nToProcess);
 
-      auto lambda = [&](unsigned int i)
-      {
-         reslist[i] = func(args[i]);
-      };
-
-      ParallelFor(0U, nToProcess, 1, lambda);
+      ParallelForChunks(nToProcess, [&](unsigned int begin, unsigned int end) {
+         for (unsigned int i = begin; i < end; ++i)
+            reslist[i] = func(args[i]);
+      });
 
       return reslist;
    }
@@ -352,12 +371,10 @@ namespace ROOT {
       unsigned int nToProcess = args.size();
       std::vector<retType> reslist(nToProcess);
 
-      auto lambda = [&](unsigned int i)
-      {
-         reslist[i] = func(args[i]);
-      };
-
-      ParallelFor(0U, nToProcess, 1, lambda);
+      ParallelForChunks(nToProcess, [&](unsigned int begin, unsigned int end) {
+         for (unsigned int i = begin; i < end; ++i)
+            reslist[i] = func(args[i]);
+      });
 
       return reslist;
    }
@@ -577,6 +594,9 @@ namespace ROOT {
    /// \brief "Reduce" an std::vector into a single object in parallel by passing a
    /// binary function as the second argument defining the reduction operation.
    ///
+   /// Floating point values are reduced with tbb::parallel_reduce, other types (e.g. pointers to histograms)
+   /// through a pairwise reduction of logarithmic depth, see ParallelTreeReduce().
+   ///
    /// \param objs A vector of elements to combine.
    /// \param redfunc Binary reduction function to combine the elements of the vector `objs`.
    /// \return A value result of combining the vector elements into a single object of the same type.
@@ -585,7 +605,32 @@ namespace ROOT {
    {
       // check we can apply reduce to objs
       static_assert(std::is_same<decltype(redfunc(objs.front(), objs.front())), T>::value, "redfunc does not have the correct signature");
-      return ParallelReduce(objs, redfunc);
+      if constexpr (std::is_same<T, double>::value || std::is_same<T, float>::value)
+         return ParallelReduce(objs, redfunc);
+      else
+         return ParallelTreeReduce(objs, redfunc);
+   }
+
+   //////////////////////////////////////////////////////////////////////////
+   /// \brief "Reduce" an std::vector in parallel, pairwise: at each of the log2(N) levels, the partial results are
+   /// combined two by two in parallel, `redfunc` is applied N-1 times in total.
+   ///
+   /// The order of the elements is preserved, `redfunc` needs to be associative but not commutative.
+   /// \param objs A vector of elements to combine.
+   /// \param redfunc Binary reduction function to combine the elements of the vector `objs`.
+   /// \return The combination of the vector elements, a default constructed object for an empty vector.
+   template <class T, class BINARYOP>
+   T TThreadExecutor::ParallelTreeReduce(const std::vector<T> &objs, BINARYOP redfunc)
+   {
+      if (objs.empty())
+         return T{};
+      std::vector<T> partials(objs);
+      const unsigned nObjs = partials.size();
+      for (unsigned stride = 1; stride < nObjs; stride *= 2) {
+         ParallelFor(0U, nObjs - stride, 2 * stride,
+                     [&](unsigned int i) { partials[i] = redfunc(partials[i], partials[i + stride]); });
+      }
+      return partials[0];
    }
 
    //////////////////////////////////////////////////////////////////////////
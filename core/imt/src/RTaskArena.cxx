@@ -15,6 +15,15 @@
 #define TBB_PREVIEW_GLOBAL_CONTROL 1 // required for TBB versions preceding 2019_U4
 #include "tbb/global_control.h"
 
+// NUMA constrained arenas are available since oneTBB 2021, which also introduced tbb/version.h
+#if __has_include("tbb/version.h")
+#include "tbb/version.h"
+#endif
+#if defined(TBB_INTERFACE_VERSION) && TBB_INTERFACE_VERSION >= 12010
+#define R__TBB_NUMA_ARENAS
+#include "tbb/info.h"
+#endif
+
 //////////////////////////////////////////////////////////////////////////
 ///
 /// \class ROOT::Internal::RTaskArenaWrapper
@@ -40,6 +49,15 @@
 /// root[] gTA->Access().max_concurrency() // call to tbb::task_arena::max_concurrency()
 /// ~~~
 ///
+/// #### NUMA domains
+/// With `ROOT_TASKARENA_NUMA=1` in the environment, the workers are partitioned
+/// over additional arenas, one per NUMA domain, whose threads are pinned to the
+/// domain. The split follows the share of cores of each domain. Tasks entering
+/// such an arena through ExecuteInNumaDomain(), and all tasks they spawn, e.g.
+/// for decompression, then run on the same domain as the memory they touch.
+/// This requires oneTBB with the hwloc based tbbbind library; otherwise the
+/// setting is ignored and ExecuteInNumaDomain() runs the function directly.
+///
 //////////////////////////////////////////////////////////////////////////
 
 namespace ROOT {
@@ -105,9 +123,62 @@ RTaskArenaWrapper::RTaskArenaWrapper(unsigned maxConcurrency) : fTBBArena(new RO
    }
    fTBBArena->initialize(maxConcurrency);
    fNWorkers = maxConcurrency;
+   if (const char *envNuma = gSystem->Getenv("ROOT_TASKARENA_NUMA")) {
+      if (std::string(envNuma) == "1")
+         CreateNumaArenas(maxConcurrency);
+   }
    ROOT::EnableThreadSafety();
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Creates one arena per NUMA domain, sharing maxConcurrency threads
+/// proportionally to the number of cores of each domain.
+////////////////////////////////////////////////////////////////////////////////
+void RTaskArenaWrapper::CreateNumaArenas(unsigned maxConcurrency)
+{
+#ifdef R__TBB_NUMA_ARENAS
+   const auto numaNodes = tbb::info::numa_nodes();
+   // Without tbbbind the topology is unknown and a single node with id -1 is reported
+   if (numaNodes.size() < 2 || maxConcurrency < numaNodes.size())
+      return;
+
+   std::vector<unsigned> nodeCores;
+   unsigned totalCores = 0;
+   for (auto node : numaNodes) {
+      nodeCores.emplace_back(std::max(1, tbb::info::default_concurrency(node)));
+      totalCores += nodeCores.back();
+   }
+   unsigned nAssigned = 0;
+   for (std::size_t i = 0; i < numaNodes.size(); ++i) {
+      // the last domain gets the remainder of the integer division
+      const unsigned nThreads = (i + 1 == numaNodes.size())
+                                   ? maxConcurrency - nAssigned
+                                   : std::max(1u, maxConcurrency * nodeCores[i] / totalCores);
+      nAssigned += nThreads;
+      fNumaArenas.emplace_back(new ROpaqueTaskArena(tbb::task_arena::constraints(numaNodes[i], nThreads)));
+      fNumaArenas.back()->initialize();
+   }
+#else
+   (void)maxConcurrency;
+   Warning("RTaskArenaWrapper", "NUMA aware task arenas require oneTBB, ignoring ROOT_TASKARENA_NUMA");
+#endif
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Runs f in the arena of the NUMA domain selected by affinityHint (modulo the
+/// number of domains), so that f and the tasks it spawns stay on that domain.
+/// Successive hints, e.g. the index of an entry range, spread the work evenly.
+/// Without NUMA arenas, f is executed directly.
+////////////////////////////////////////////////////////////////////////////////
+void RTaskArenaWrapper::ExecuteInNumaDomain(unsigned affinityHint, const std::function<void()> &f)
+{
+   if (fNumaArenas.empty()) {
+      f();
+      return;
+   }
+   fNumaArenas[affinityHint % fNumaArenas.size()]->execute(f);
+}
+
 RTaskArenaWrapper::~RTaskArenaWrapper()
 {
    fNWorkers = 0u;
@@ -0,0 +1,157 @@
+// @(#)root/thread:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include "ROOT/RTaskTracer.hxx"
+
+#include "TError.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#ifdef _WIN32
+#include <process.h>
+#define getpid _getpid
+#else
+#include <unistd.h>
+#endif
+
+std::atomic<bool> ROOT::Experimental::RTaskTracer::fgIsEnabled{false};
+
+namespace {
+
+struct RTaskEvent {
+   const char *fCategory;
+   const char *fName;
+   std::uint64_t fPayload;
+   std::int64_t fBegin; ///< in nanoseconds since the start of the tracer
+   std::int64_t fEnd;
+};
+
+/// The tasks recorded by one thread. The mutex is only contended while the trace is written or cleared.
+struct RThreadBuffer {
+   unsigned int fThreadId;
+   std::mutex fMutex;
+   std::vector<RTaskEvent> fEvents;
+};
+
+struct RTracerState {
+   std::chrono::steady_clock::time_point fStart = std::chrono::steady_clock::now();
+   std::mutex fMutex;
+   /// Kept beyond the lifetime of their threads, so that the tasks of finished threads end up in the trace
+   std::vector<std::shared_ptr<RThreadBuffer>> fBuffers;
+};
+
+RTracerState &GetState()
+{
+   // Leaked on purpose: tasks can end during static destruction
+   static RTracerState *state = new RTracerState;
+   return *state;
+}
+
+RThreadBuffer &GetThreadBuffer()
+{
+   thread_local std::shared_ptr<RThreadBuffer> buffer = [] {
+      auto &state = GetState();
+      auto b = std::make_shared<RThreadBuffer>();
+      std::lock_guard<std::mutex> lock(state.fMutex);
+      b->fThreadId = state.fBuffers.size();
+      state.fBuffers.emplace_back(b);
+      return b;
+   }();
+   return *buffer;
+}
+
+/// Enables tracing if ROOT_TASK_TRACE is set and writes the trace to the given file at exit
+struct RTraceFromEnv {
+   RTraceFromEnv()
+   {
+      if (!GetPath())
+         return;
+      GetState();
+      ROOT::Experimental::RTaskTracer::Enable();
+      atexit([] {
+         if (!ROOT::Experimental::RTaskTracer::WriteChromeTrace(GetPath()))
+            ::Error("RTaskTracer", "cannot write the task trace to %s", GetPath());
+      });
+   }
+   static const char *GetPath() { return getenv("ROOT_TASK_TRACE"); }
+} gTraceFromEnv;
+
+} // anonymous namespace
+
+std::int64_t ROOT::Experimental::RTaskTracer::Now()
+{
+   return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - GetState().fStart)
+      .count();
+}
+
+void ROOT::Experimental::RTaskTracer::Record(const char *category, const char *name, std::uint64_t payload,
+                                             std::int64_t begin)
+{
+   const auto end = Now();
+   auto &buffer = GetThreadBuffer();
+   std::lock_guard<std::mutex> lock(buffer.fMutex);
+   buffer.fEvents.push_back({category, name, payload, begin, end});
+}
+
+void ROOT::Experimental::RTaskTracer::Clear()
+{
+   auto &state = GetState();
+   std::lock_guard<std::mutex> lock(state.fMutex);
+   for (auto &buffer : state.fBuffers) {
+      std::lock_guard<std::mutex> bufferLock(buffer->fMutex);
+      buffer->fEvents.clear();
+   }
+}
+
+std::uint64_t ROOT::Experimental::RTaskTracer::GetNTasks()
+{
+   auto &state = GetState();
+   std::lock_guard<std::mutex> lock(state.fMutex);
+   std::uint64_t nTasks = 0;
+   for (auto &buffer : state.fBuffers) {
+      std::lock_guard<std::mutex> bufferLock(buffer->fMutex);
+      nTasks += buffer->fEvents.size();
+   }
+   return nTasks;
+}
+
+/// Every task is written as a complete event ("ph": "X") with the payload in its arguments; times are in
+/// microseconds, as required by the format.
+bool ROOT::Experimental::RTaskTracer::WriteChromeTrace(const std::string &path)
+{
+   FILE *f = fopen(path.c_str(), "w");
+   if (!f)
+      return false;
+
+   const int pid = getpid();
+   fprintf(f, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n");
+   bool isFirst = true;
+   auto &state = GetState();
+   std::lock_guard<std::mutex> lock(state.fMutex);
+   for (auto &buffer : state.fBuffers) {
+      std::lock_guard<std::mutex> bufferLock(buffer->fMutex);
+      for (const auto &event : buffer->fEvents) {
+         fprintf(f,
+                 "%s{\"name\":\"%s\",\"cat\":\"%s\",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f,\"pid\":%d,\"tid\":%u,"
+                 "\"args\":{\"payload\":%llu}}",
+                 isFirst ? "" : ",\n", event.fName, event.fCategory, event.fBegin / 1000.,
+                 (event.fEnd - event.fBegin) / 1000., pid, buffer->fThreadId,
+                 (unsigned long long)event.fPayload);
+         isFirst = false;
+      }
+   }
+   fprintf(f, "\n]}\n");
+   return fclose(f) == 0;
+}
@@ -10,6 +10,9 @@
 #include "tbb/tbb.h"
 #define TBB_PREVIEW_GLOBAL_CONTROL 1 // required for TBB versions preceding 2019_U4
 #include "tbb/global_control.h"
+
+#include <algorithm>
+#include <chrono>
 #if !defined(_MSC_VER)
 #pragma GCC diagnostic pop
 #endif
@@ -174,6 +177,48 @@ void TThreadExecutor::ParallelFor(unsigned start, unsigned end, unsigned step,
    });
 }
 
+//////////////////////////////////////////////////////////////////////////
+/// \brief Execute a function in parallel over the items [0, nItems), in chunks of consecutive items whose size is
+/// tuned at run time.
+///
+/// The first item is processed by the calling thread and timed. The grain size is chosen such that a chunk lasts at
+/// least about 100 microseconds, which amortizes the scheduling overhead, but there are at least four chunks per
+/// thread, for load balancing. The TBB auto_partitioner then splits the range further only when threads are idle
+/// and steal work, hence imbalanced loads are still spread over the pool.
+///
+/// Calls can be nested, e.g. from within an RDataFrame action or another TThreadExecutor call: the inner chunks join
+/// the task arena of the outer ones instead of adding threads, and work isolation (see above) guarantees that a
+/// waiting thread only picks up chunks of its own loop.
+///
+/// \param nItems Number of items to process.
+/// \param f Function processing the items [begin, end).
+void TThreadExecutor::ParallelForChunks(unsigned int nItems,
+                                        const std::function<void(unsigned int begin, unsigned int end)> &f)
+{
+   if (nItems == 0)
+      return;
+   const auto start = std::chrono::steady_clock::now();
+   f(0, 1);
+   if (nItems == 1)
+      return;
+   const long long itemTime =
+      std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+
+   constexpr long long kMinChunkTime = 100000; // in nanoseconds
+   const unsigned int maxGrain = std::max(1U, (nItems - 1) / (4 * GetPoolSize()));
+   unsigned int grain = maxGrain;
+   if (itemTime > 0)
+      grain = std::min<long long>(maxGrain, kMinChunkTime / itemTime + 1);
+
+   fTaskArenaW->Access().execute([&] {
+      tbb::this_task_arena::isolate([&] {
+         tbb::parallel_for(
+            tbb::blocked_range<unsigned int>(1, nItems, grain),
+            [&](const tbb::blocked_range<unsigned int> &r) { f(r.begin(), r.end()); }, tbb::auto_partitioner());
+      });
+   });
+}
+
 //////////////////////////////////////////////////////////////////////////
 /// \brief "Reduce" in parallel an std::vector<double> into a single double value
 ///
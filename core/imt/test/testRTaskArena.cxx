@@ -1,10 +1,12 @@
 #include "TROOT.h"
+#include "TSystem.h"
 #include "ROOT/RTaskArena.hxx"
 #include "ROOT/TThreadExecutor.hxx"
 #include "../src/ROpaqueTaskArena.hxx"
 
 #include "ROOT/TestSupport.hxx"
 
+#include <atomic>
 #include <fstream>
 #include <random>
 #include <thread>
@@ -84,6 +86,20 @@ TEST(RTaskArena, KeepSize)
    ASSERT_EQ(ROOT::Internal::RTaskArenaWrapper::TaskArenaSize(), nCores);
 }
 
+TEST(RTaskArena, ExecuteInNumaDomain)
+{
+   auto gTAInstance = ROOT::Internal::GetGlobalTaskArena(plausibleNCores(randGenerator));
+   // NUMA arenas are only created on request, through ROOT_TASKARENA_NUMA=1, and on NUMA machines
+   if (!gSystem->Getenv("ROOT_TASKARENA_NUMA"))
+      EXPECT_EQ(gTAInstance->GetNNumaDomains(), 0u);
+
+   std::atomic<unsigned> nCalls{0u};
+   ROOT::TThreadExecutor pool;
+   pool.Foreach([&](unsigned i) { gTAInstance->ExecuteInNumaDomain(i, [&] { ++nCalls; }); },
+                ROOT::TSeqU(32));
+   EXPECT_EQ(nCalls, 32u);
+}
+
 ////////////////////////////////////////////////////////////////////////
 // Integration Tests
 
@@ -267,6 +283,57 @@ TEST(TThreadExecutor, StdVectorChunks)
    EXPECT_EQ(ttex.MapReduce(func, cvec, redfunc, 9), 5040);
 }
 
+TEST(TThreadExecutor, PairwiseReduce)
+{
+   ROOT::TThreadExecutor ttex;
+   // not commutative: checks that the order of the elements is preserved
+   std::vector<std::string> strs;
+   std::string expected;
+   for (char c = 'a'; c <= 'z'; ++c) {
+      strs.emplace_back(1, c);
+      expected += c;
+   }
+   auto concat = [](const std::string &a, const std::string &b) { return a + b; };
+   EXPECT_EQ(ttex.Reduce(strs, concat), expected);
+   EXPECT_EQ(ttex.Reduce(std::vector<std::string>{"x"}, concat), "x");
+   EXPECT_EQ(ttex.Reduce(std::vector<std::string>{}, concat), "");
+
+   std::vector<int> ints(1000);
+   std::iota(ints.begin(), ints.end(), 1);
+   EXPECT_EQ(ttex.Reduce(ints, std::plus<int>()), 500500);
+}
+
+TEST(TThreadExecutor, AutoChunksNested)
+{
+   ROOT::TThreadExecutor ttex(4);
+   constexpr unsigned int nOuter = 50;
+   constexpr unsigned int nInner = 1000;
+   std::vector<std::atomic<int>> counts(nOuter * nInner);
+   ttex.Foreach(
+      [&](unsigned int i) {
+         // Nested calls share the pool of the outer one
+         ttex.Foreach([&](unsigned int j) { ++counts[i * nInner + j]; }, ROOT::TSeqU(nInner));
+      },
+      ROOT::TSeqU(nOuter));
+   for (auto &c : counts)
+      EXPECT_EQ(c, 1);
+
+   // Every element is processed exactly once, also when the first one is much slower than the others
+   auto squares = ttex.Map(
+      [](unsigned int i) {
+         if (i == 0)
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+         return i * i;
+      },
+      ROOT::TSeqU(10000));
+   for (unsigned int i = 0; i < squares.size(); ++i)
+      EXPECT_EQ(squares[i], i * i);
+
+   std::atomic<int> nCalls{0};
+   ttex.Foreach([&] { ++nCalls; }, 12345);
+   EXPECT_EQ(nCalls, 12345);
+}
+
 TEST(TThreadExecutor, TSeqActions)
 {
    ROOT::TThreadExecutor ttex;
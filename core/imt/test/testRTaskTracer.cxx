@@ -0,0 +1,39 @@
+#include "ROOT/RTaskTracer.hxx"
+#include "ROOT/TThreadExecutor.hxx"
+
+#include "gtest/gtest.h"
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+using ROOT::Experimental::RTaskTracer;
+
+TEST(RTaskTracer, RecordAndExport)
+{
+   RTaskTracer::Clear();
+   {
+      RTaskTracer::RScope scope("test", "disabled");
+   }
+   EXPECT_EQ(RTaskTracer::GetNTasks(), 0u);
+
+   RTaskTracer::Enable();
+   ROOT::TThreadExecutor pool(4);
+   pool.Foreach([] { RTaskTracer::RScope scope("test", "task", 42); }, 16, 16);
+   RTaskTracer::Disable();
+   EXPECT_EQ(RTaskTracer::GetNTasks(), 16u);
+
+   const std::string path = "testRTaskTracer.json";
+   ASSERT_TRUE(RTaskTracer::WriteChromeTrace(path));
+   std::ifstream f(path);
+   std::stringstream content;
+   content << f.rdbuf();
+   EXPECT_NE(content.str().find("\"traceEvents\""), std::string::npos);
+   EXPECT_NE(content.str().find("\"name\":\"task\",\"cat\":\"test\",\"ph\":\"X\""), std::string::npos);
+   EXPECT_NE(content.str().find("\"args\":{\"payload\":42}"), std::string::npos);
+   std::remove(path.c_str());
+
+   RTaskTracer::Clear();
+   EXPECT_EQ(RTaskTracer::GetNTasks(), 0u);
+}
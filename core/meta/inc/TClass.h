@@ -326,6 +326,13 @@ private:
    static TDeclNameRegistry fNoInfoOrEmuOrFwdDeclNameRegistry; // Store decl names of the forwardd and no info instances
    static Bool_t HasNoInfoOrEmuOrFwdDeclaredDecl(const char*);
 
+   // The lookups behind the thread local caches of GetClass()
+   static TClass *GetClassUncached(const char *name, Bool_t load, Bool_t silent, size_t hint_pair_offset,
+                                   size_t hint_pair_size);
+   static TClass *GetClassUncached(const std::type_info &typeinfo, Bool_t load, size_t hint_pair_offset,
+                                   size_t hint_pair_size);
+   static void InvalidateLookupCaches();
+
    // Internal status bits, set and reset only during initialization and thus under the protection of the global lock.
    enum { kLoading = kReservedLoading, kUnloading = kReservedLoading };
    // Internal streamer type.
@@ -622,19 +629,39 @@ TClass *GetClassHelper(Bool_t, Bool_t, std::true_type)
    return T::Class();
 }
 
+/// Looks up the class by typeid and, if it is loaded, stores its persistent reference in slot
+TClass *GetClassAndFillSlot(std::atomic<TClass *const *> &slot, const std::type_info &typeinfo, Bool_t load,
+                            Bool_t silent, size_t hint_pair_offset = 0, size_t hint_pair_size = 0);
+
+/// Returns the class cached in slot, or nullptr. The persistent reference follows the replacements of the
+/// TClass object and is reset when it is deleted, like for TClassRef.
+inline TClass *GetClassFromSlot(const std::atomic<TClass *const *> &slot)
+{
+   auto ref = slot.load(std::memory_order_acquire);
+   return ref ? *ref : nullptr;
+}
+
+// Every type has its own lock free cache slot: once the class is loaded, a lookup is a single atomic load
+// instead of a hash lookup under ROOT::gCoreMutex
 template <typename T>
 struct TClassGetClassHelper {
    static TClass *GetClass(Bool_t load, Bool_t silent) {
-      return TClass::GetClass(typeid(T), load, silent);
+      static std::atomic<TClass *const *> slot{nullptr};
+      if (TClass *cl = GetClassFromSlot(slot))
+         return cl;
+      return GetClassAndFillSlot(slot, typeid(T), load, silent);
    }
 };
 
 template <typename F, typename S>
 struct TClassGetClassHelper<std::pair<F, S> > {
    static TClass *GetClass(Bool_t load, Bool_t silent) {
+      static std::atomic<TClass *const *> slot{nullptr};
+      if (TClass *cl = GetClassFromSlot(slot))
+         return cl;
       using pair_t = std::pair<F,S>;
       size_t hint_offset = offsetof(pair_t, second);
-      return TClass::GetClass(typeid(std::pair<F, S>), load, silent, hint_offset, sizeof(std::pair<F,S>));
+      return GetClassAndFillSlot(slot, typeid(std::pair<F, S>), load, silent, hint_offset, sizeof(std::pair<F,S>));
    }
 };
 
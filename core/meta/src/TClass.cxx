@@ -89,12 +89,14 @@ In order to access the name of a class within the ROOT type system, the method T
 
 #include <cstdio>
 #include <cctype>
+#include <cstdint>
 #include <set>
 #include <iostream>
 #include <sstream>
 #include <string>
 #include <map>
 #include <typeinfo>
+#include <unordered_map>
 #include <cmath>
 #include <cassert>
 #include <vector>
@@ -488,6 +490,46 @@ DeclIdMap_t *TClass::GetDeclIdMap() {
 #endif
 }
 
+namespace {
+   /// Incremented whenever a class is added, removed or unloaded and when a streamer info is removed: invalidates
+   /// the thread local lookup caches. It is written rarely, reading it does not contend between threads.
+   std::atomic<std::uint64_t> gLookupCacheEpoch{0};
+
+   /// Per thread caches of the results of the read-only metadata lookups: classes by name and by typeid, and
+   /// compiled streamer infos by checksum. Once filled, repeated lookups, e.g. when many threads attach to the
+   /// branches of a TTree, neither take ROOT::gCoreMutex nor gInterpreterMutex nor normalize the class names.
+   /// Only final results (loaded classes, compiled streamer infos) are cached.
+   struct TClassLookupCache {
+      std::uint64_t fEpoch = 0;
+      std::unordered_map<std::string, TClass *> fClassByName;
+      std::unordered_map<const std::type_info *, TClass *> fClassByTypeInfo;
+      std::map<std::pair<const TClass *, UInt_t>, TVirtualStreamerInfo *> fInfoByChecksum;
+
+      /// Returns the cache of this thread, emptied if the epoch changed. Must be called before the lookup whose
+      /// result is to be cached, so that the result is dropped if the epoch changes meanwhile.
+      static TClassLookupCache &Get()
+      {
+         thread_local TClassLookupCache cache;
+         const auto epoch = gLookupCacheEpoch.load(std::memory_order_acquire);
+         if (cache.fEpoch != epoch) {
+            cache.fClassByName.clear();
+            cache.fClassByTypeInfo.clear();
+            cache.fInfoByChecksum.clear();
+            cache.fEpoch = epoch;
+         }
+         return cache;
+      }
+   };
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// static: Invalidate the thread local caches of the class and streamer info lookups
+
+void TClass::InvalidateLookupCaches()
+{
+   gLookupCacheEpoch.fetch_add(1, std::memory_order_acq_rel);
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// static: Add a class to the list and map of classes.
 
@@ -496,6 +538,7 @@ void TClass::AddClass(TClass *cl)
    if (!cl) return;
 
    R__LOCKGUARD(gInterpreterMutex);
+   InvalidateLookupCaches();
    gROOT->GetListOfClasses()->Add(cl);
    if (cl->GetTypeInfo()) {
       GetIdMap()->Add(cl->GetTypeInfo()->name(),cl);
@@ -522,6 +565,7 @@ void TClass::RemoveClass(TClass *oldcl)
    if (!oldcl) return;
 
    R__LOCKGUARD(gInterpreterMutex);
+   InvalidateLookupCaches();
    gROOT->GetListOfClasses()->Remove(oldcl);
    if (oldcl->GetTypeInfo()) {
       GetIdMap()->Remove(oldcl->GetTypeInfo()->name());
@@ -2981,6 +3025,24 @@ TClass *TClass::GetClass(const char *name, Bool_t load, Bool_t silent, size_t hi
 
    if (!gROOT->GetListOfClasses())  return nullptr;
 
+   // Names which are not normalized, e.g. "std::vector<float>", would otherwise take the write lock at every call
+   auto &lookupCache = TClassLookupCache::Get();
+   auto iter = lookupCache.fClassByName.find(name);
+   if (iter != lookupCache.fClassByName.end())
+      return iter->second;
+
+   TClass *cl = GetClassUncached(name, load, silent, hint_pair_offset, hint_pair_size);
+   if (cl && cl->IsLoaded() && !cl->TestBit(kUnloading))
+      lookupCache.fClassByName.emplace(name, cl);
+   return cl;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Look up the class by name without the thread local cache, see GetClass()
+
+TClass *TClass::GetClassUncached(const char *name, Bool_t load, Bool_t silent, size_t hint_pair_offset,
+                                 size_t hint_pair_size)
+{
    // FindObject will take the read lock before actually getting the
    // TClass pointer so we will need not get a partially initialized
    // object.
@@ -3256,6 +3318,37 @@ TClass *TClass::GetClass(const std::type_info& typeinfo, Bool_t load, Bool_t /*
    if (!gROOT->GetListOfClasses())
       return nullptr;
 
+   auto &lookupCache = TClassLookupCache::Get();
+   auto iter = lookupCache.fClassByTypeInfo.find(&typeinfo);
+   if (iter != lookupCache.fClassByTypeInfo.end())
+      return iter->second;
+
+   TClass *cl = GetClassUncached(typeinfo, load, hint_pair_offset, hint_pair_size);
+   if (cl && cl->IsLoaded() && !cl->TestBit(kUnloading))
+      lookupCache.fClassByTypeInfo.emplace(&typeinfo, cl);
+   return cl;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Look up the class by typeid for TClass::GetClass<T>() and, if the class is loaded,
+/// cache its persistent reference in the per-type slot
+
+TClass *ROOT::Internal::GetClassAndFillSlot(std::atomic<TClass *const *> &slot, const std::type_info &typeinfo,
+                                            Bool_t load, Bool_t silent, size_t hint_pair_offset,
+                                            size_t hint_pair_size)
+{
+   TClass *cl = TClass::GetClass(typeinfo, load, silent, hint_pair_offset, hint_pair_size);
+   if (cl && cl->IsLoaded() && cl->GetPersistentRef())
+      slot.store(cl->GetPersistentRef(), std::memory_order_release);
+   return cl;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Look up the class by typeid without the thread local cache, see GetClass()
+
+TClass *TClass::GetClassUncached(const std::type_info &typeinfo, Bool_t load, size_t hint_pair_offset,
+                                 size_t hint_pair_size)
+{
    //protect access to TROOT::GetIdMap
    R__READ_LOCKGUARD(ROOT::gCoreMutex);
 
@@ -6313,6 +6406,7 @@ void TClass::SetUnloaded()
       return;
    }
    SetBit(kUnloading);
+   InvalidateLookupCaches();
 
    //R__ASSERT(fState == kLoaded);
    if (fState != kLoaded) {
@@ -7042,6 +7136,12 @@ TVirtualStreamerInfo *TClass::FindStreamerInfo(UInt_t checksum, Bool_t isTransie
       if (fCheckSum == checksum)
          return GetStreamerInfo(0, isTransient);
 
+      // Several layouts of the class are read alternately, e.g. from the files of a TChain
+      auto &lookupCache = TClassLookupCache::Get();
+      auto iter = lookupCache.fInfoByChecksum.find({this, checksum});
+      if (iter != lookupCache.fInfoByChecksum.end())
+         return iter->second;
+
       R__LOCKGUARD(gInterpreterMutex);
 
       Int_t ninfos = fStreamerInfo->GetEntriesFast()-1;
@@ -7052,7 +7152,10 @@ TVirtualStreamerInfo *TClass::FindStreamerInfo(UInt_t checksum, Bool_t isTransie
          if (info && info->GetCheckSum() == checksum) {
             // R__ASSERT(i==info->GetClassVersion() || (i==-1&&info->GetClassVersion()==1));
             info->BuildOld();
-            if (info->IsCompiled()) fLastReadInfo = info;
+            if (info->IsCompiled()) {
+               fLastReadInfo = info;
+               lookupCache.fInfoByChecksum.emplace(std::make_pair(this, checksum), info);
+            }
             return info;
          }
       }
@@ -7323,6 +7426,7 @@ void TClass::RemoveStreamerInfo(Int_t slot)
       R__LOCKGUARD(gInterpreterMutex);
       TVirtualStreamerInfo *info = (TVirtualStreamerInfo*)fStreamerInfo->At(slot);
       fStreamerInfo->RemoveAt(fClassVersion);
+      InvalidateLookupCaches();
       if (fLastReadInfo.load() == info)
          fLastReadInfo = nullptr;
       if (fCurrentInfo.load() == info)
@@ -1,9 +1,18 @@
 #include "TClass.h"
 #include "THashTable.h"
 #include "TInterpreter.h"
+#include "TROOT.h"
 
 #include "gtest/gtest.h"
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <iostream>
+#include <thread>
+#include <vector>
+
 TEST(TClass, DictCheck)
 {
    gInterpreter->ProcessLine(".L stlDictCheck.h+");
@@ -22,3 +31,64 @@ TEST(TClass, DictCheck)
 
    EXPECT_STREQ(errMsg.c_str(), "Missing dictionary for C, ") << errMsg;
 }
+
+TEST(TClass, ConcurrentLookups)
+{
+   ROOT::EnableThreadSafety();
+   auto vecByName = TClass::GetClass("vector<float>");
+   auto vecByTypeInfo = TClass::GetClass(typeid(std::vector<float>));
+   ASSERT_NE(vecByName, nullptr);
+   EXPECT_EQ(vecByName, vecByTypeInfo);
+
+   std::vector<std::thread> threads;
+   std::atomic<int> nMismatches{0};
+   for (int t = 0; t < 8; ++t) {
+      threads.emplace_back([&] {
+         // repeated lookups are served from the thread local cache, including non normalized names
+         for (int i = 0; i < 100; ++i) {
+            if (TClass::GetClass("std::vector<float>") != vecByName ||
+                TClass::GetClass(typeid(std::vector<float>)) != vecByTypeInfo ||
+                TClass::GetClass("TObject") != TObject::Class())
+               ++nMismatches;
+         }
+      });
+   }
+   for (auto &thr : threads)
+      thr.join();
+   EXPECT_EQ(nMismatches, 0);
+}
+
+// Compares the per-type slot of TClass::GetClass<T>() with the lookups by typeid, under thread contention
+TEST(TClass, GetClassTemplateSlotBenchmark)
+{
+   ROOT::EnableThreadSafety();
+   using Vec_t = std::vector<float>;
+   auto cl = TClass::GetClass(typeid(Vec_t));
+   ASSERT_NE(cl, nullptr);
+   EXPECT_EQ(TClass::GetClass<Vec_t>(), cl);
+
+   const int nThreads = std::max(2u, std::thread::hardware_concurrency());
+   const int nLookups = 100000;
+   std::atomic<int> nMismatches{0};
+   auto runConcurrently = [&](const std::function<TClass *()> &lookup) {
+      std::vector<std::thread> threads;
+      const auto start = std::chrono::steady_clock::now();
+      for (int t = 0; t < nThreads; ++t) {
+         threads.emplace_back([&] {
+            for (int i = 0; i < nLookups; ++i) {
+               if (lookup() != cl)
+                  ++nMismatches;
+            }
+         });
+      }
+      for (auto &thr : threads)
+         thr.join();
+      return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+   };
+
+   const auto msTypeInfo = runConcurrently([] { return TClass::GetClass(typeid(Vec_t)); });
+   const auto msSlot = runConcurrently([] { return TClass::GetClass<Vec_t>(); });
+   EXPECT_EQ(nMismatches, 0);
+   std::cout << nThreads << " threads x " << nLookups << " lookups: GetClass(typeid) " << msTypeInfo
+             << " ms, GetClass<T>() " << msSlot << " ms" << std::endl;
+}
@@ -1068,6 +1068,16 @@ static bool IsFromRootCling() {
   return foundSymbol;
 }
 
+/// The fast start mode, enabled by ROOT_FAST_START=1, is meant for short jobs: the interpreter only preloads the
+/// core C++ modules and reads the rootmap files on the first autoload request rather than at startup.
+static bool IsFastStart() {
+  const static bool isFastStart = [] {
+     const char *env = std::getenv("ROOT_FAST_START");
+     return env && !strcmp(env, "1");
+  }();
+  return isFastStart;
+}
+
 /// Checks if there is an ASTFile on disk for the given module \c M.
 static bool HasASTFileOnDisk(clang::Module *M, const clang::Preprocessor &PP, std::string *FullFileName = nullptr)
 {
@@ -1227,20 +1237,24 @@ static void RegisterCxxModules(cling::Interpreter &clingInterp)
 
    // Take this branch only from ROOT because we don't need to preload modules in rootcling
    if (!IsFromRootCling()) {
-      std::vector<std::string> CommonModules = {"MathCore"};
-      LoadModules(CommonModules, clingInterp);
-
-      // These modules should not be preloaded but they fix issues.
-      // FIXME: Hist is not a core module but is very entangled to MathCore and
-      // causes issues.
-      std::vector<std::string> FIXMEModules = {"Hist"};
       clang::CompilerInstance &CI = *clingInterp.getCI();
       clang::Preprocessor &PP = CI.getPreprocessor();
       ModuleMap &MMap = PP.getHeaderSearchInfo().getModuleMap();
-      if (MMap.findModule("RInterface"))
-         FIXMEModules.push_back("RInterface");
 
-      LoadModules(FIXMEModules, clingInterp);
+      // In fast start mode, these modules are loaded on demand through the global module index
+      if (!IsFastStart()) {
+         std::vector<std::string> CommonModules = {"MathCore"};
+         LoadModules(CommonModules, clingInterp);
+
+         // These modules should not be preloaded but they fix issues.
+         // FIXME: Hist is not a core module but is very entangled to MathCore and
+         // causes issues.
+         std::vector<std::string> FIXMEModules = {"Hist"};
+         if (MMap.findModule("RInterface"))
+            FIXMEModules.push_back("RInterface");
+
+         LoadModules(FIXMEModules, clingInterp);
+      }
 
       GlobalModuleIndex *GlobalIndex = nullptr;
       loadGlobalModuleIndex(clingInterp);
@@ -1655,10 +1669,33 @@ void TCling::Initialize()
    assert(GetRootMapFiles() == nullptr && "Must be called before LoadLibraryMap!");
    TClass::ReadRules(); // Read the default customization rules ...
 
-   LoadLibraryMap();
+   // Scanning the library path for rootmap files and declaring their forward declarations takes a large part of the
+   // startup time; programs using only compiled dictionaries never need them
+   if (IsFastStart())
+      fIsLibraryMapPending = true;
+   else
+      LoadLibraryMap();
    SetClassAutoLoading(true);
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Read the rootmap files if this was deferred by the fast start mode
+
+void TCling::LoadPendingLibraryMap()
+{
+   if (fIsLibraryMapPending)
+      LoadLibraryMap();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return the association of classes to libraries, read from the rootmap files
+
+TEnv *TCling::GetMapfile() const
+{
+   const_cast<TCling *>(this)->LoadPendingLibraryMap();
+   return fMapfile;
+}
+
 void TCling::ShutDown()
 {
    fIsShuttingDown = true;
@@ -5680,6 +5717,7 @@ Int_t TCling::LoadLibraryMap(const char* rootmapfile)
       return 0;
 
    R__LOCKGUARD(gInterpreterMutex);
+   fIsLibraryMapPending = false;
 
    // open the [system].rootmap files
    if (!fMapfile) {
@@ -5951,6 +5989,7 @@ Int_t TCling::UnloadAllSharedLibraryMaps()
 
 Int_t TCling::UnloadLibraryMap(const char* library)
 {
+   LoadPendingLibraryMap();
    if (!fMapfile || !library || !*library) {
       return 0;
    }
@@ -6025,6 +6064,7 @@ Int_t TCling::SetClassSharedLibs(const char *cls, const char *libs)
    key.ReplaceAll(" ", "-");
 
    R__LOCKGUARD(gInterpreterMutex);
+   LoadPendingLibraryMap();
    if (!fMapfile) {
       fMapfile = new TEnv();
       fMapfile->IgnoreDuplicates(kTRUE);
@@ -7024,6 +7064,7 @@ static std::string GetClassSharedLibsForModule(const char *cls, cling::LookupHel
 
 const char* TCling::GetClassSharedLibs(const char* cls)
 {
+   LoadPendingLibraryMap();
    if (fCxxModulesEnabled) {
       llvm::StringRef className = cls;
       // If we get a class name containing lambda, we cannot parse it and we
@@ -7213,6 +7254,7 @@ static bool hasPrecomputedLibraryDeps(llvm::StringRef lib)
 
 const char* TCling::GetSharedLibDeps(const char* lib, bool useDyld/* = false*/)
 {
+   LoadPendingLibraryMap();
    if (llvm::sys::path::is_absolute(lib) && !llvm::sys::fs::exists(lib))
       return nullptr;
 
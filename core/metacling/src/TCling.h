@@ -115,6 +115,7 @@ private: // Data Members
    TString         fIncludePath;      // Interpreter include path.
    TString         fRootmapLoadPath;  // Dynamic load path for rootmap files.
    TEnv*           fMapfile;          // Association of classes to libraries.
+   bool            fIsLibraryMapPending = false; // The rootmap files are read on first use (fast start mode).
    std::vector<std::string> fAutoLoadLibStorage; // A storage to return a const char* from GetClassSharedLibsForModule.
    std::map<size_t,std::vector<const char*>> fClassesHeadersMap; // Map of classes hashes and headers associated
    std::map<const cling::Transaction*,size_t> fTransactionHeadersMap; // Map which transaction contains which autoparse.
@@ -209,7 +210,7 @@ public: // Public Interface
    void    EndOfLineAction() final;
    TClass *GetClass(const std::type_info& typeinfo, Bool_t load) const final;
    Int_t   GetExitCode() const final { return fExitCode; }
-   TEnv*   GetMapfile() const final { return fMapfile; }
+   TEnv*   GetMapfile() const final;
    Int_t   GetMore() const final;
    TClass *GenerateTClass(const char *classname, Bool_t emulation, Bool_t silent = kFALSE) final;
    TClass *GenerateTClass(ClassInfo_t *classinfo, Bool_t silent = kFALSE) final;
@@ -635,6 +636,7 @@ private: // Private Utility Functions and Classes
    void RegisterRdictForLoadPCM(const std::string &pcmFileNameFullPath, llvm::StringRef *pcmContent);
    void LoadPCM(std::string pcmFileNameFullPath);
    void LoadPCMImpl(TFile &pcmFile);
+   void LoadPendingLibraryMap();
 
    void InitRootmapFile(const char *name);
    int  ReadRootmapFile(const char *rootmapfile, TUniqueString* uniqueString = nullptr);
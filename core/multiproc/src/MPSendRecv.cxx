@@ -12,7 +12,76 @@
 #include "MPSendRecv.h"
 #include "TBufferFile.h"
 #include "MPCode.h"
+#include <atomic>
+#include <cstring> //memcpy
 #include <memory> //unique_ptr
+#include <fcntl.h> //O_* constants
+#include <sys/mman.h> //shm_open, mmap
+#include <sys/stat.h> //fstat
+#include <unistd.h> //ftruncate, getpid
+
+namespace {
+/// Set in the size field of a message whose object is in a shared memory segment. The rest of the size field
+/// is then the length of the name of the segment, which follows in the message.
+constexpr ULong_t kSharedMemoryFlag = 1ULL << 63;
+
+/// Objects at least this large are sent through shared memory, zero disables it
+std::atomic<ULong_t> gSharedMemoryThreshold{0};
+/// Makes the names of the segments created by a process unique
+std::atomic<unsigned> gNSegments{0};
+
+/// The object of a message received through shared memory: the buffer is the mapping of the segment, which is
+/// unmapped when the buffer is deleted
+class TMPSharedBufferFile : public TBufferFile {
+   void *fAddr;
+   std::size_t fLength;
+
+public:
+   TMPSharedBufferFile(void *addr, std::size_t length)
+      : TBufferFile(TBuffer::kRead, length, addr, false), fAddr(addr), fLength(length)
+   {
+   }
+   ~TMPSharedBufferFile() override { munmap(fAddr, fLength); }
+};
+
+/// Writes the buffer to a new shared memory segment. Returns the name of the segment or an empty string on failure.
+std::string WriteSharedSegment(const TBufferFile &objBuf)
+{
+   std::string name = "/rootmp." + std::to_string(getpid()) + "." + std::to_string(gNSegments++);
+   int fd = shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+   if (fd < 0)
+      return "";
+   const std::size_t length = objBuf.Length();
+   void *addr = MAP_FAILED;
+   if (ftruncate(fd, length) == 0)
+      addr = mmap(nullptr, length, PROT_WRITE, MAP_SHARED, fd, 0);
+   close(fd);
+   if (addr == MAP_FAILED) {
+      shm_unlink(name.c_str());
+      return "";
+   }
+   memcpy(addr, objBuf.Buffer(), length);
+   munmap(addr, length);
+   return name;
+}
+
+/// Maps the shared memory segment of a received message and removes its name, so that it is freed when unmapped
+std::unique_ptr<TBufferFile> ReadSharedSegment(const std::string &name)
+{
+   int fd = shm_open(name.c_str(), O_RDONLY, 0);
+   if (fd < 0)
+      return nullptr;
+   shm_unlink(name.c_str());
+   struct stat st;
+   void *addr = MAP_FAILED;
+   if (fstat(fd, &st) == 0 && st.st_size > 0)
+      addr = mmap(nullptr, st.st_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+   close(fd);
+   if (addr == MAP_FAILED)
+      return nullptr;
+   return std::make_unique<TMPSharedBufferFile>(addr, st.st_size);
+}
+} // anonymous namespace
 
 //////////////////////////////////////////////////////////////////////////
 /// Send a message with the specified code on the specified socket.
@@ -38,6 +107,59 @@ int MPSend(TSocket *s, unsigned code)
 }
 
 
+//////////////////////////////////////////////////////////////////////////
+/// Send a message with a code and an object that was already streamed into
+/// objBuf, as the templated versions of MPSend() do.
+/// If the object is at least as large as the shared memory threshold (see
+/// MPSetSharedMemoryThreshold()), it is written to a POSIX shared memory
+/// segment and only the name of the segment is sent on the socket. MPRecv()
+/// maps the segment in the receiving process, so that the object is neither
+/// copied through the socket nor in the receiver. If the segment cannot be
+/// created, the object is sent on the socket.
+/// \param s a pointer to a valid TSocket. No validity checks are performed\n
+/// \param code the code to be sent
+/// \param objBuf the streamed object, possibly empty
+/// \return the number of bytes sent, as per TSocket::SendRaw
+int MPSendBuffer(TSocket *s, unsigned code, const TBufferFile &objBuf)
+{
+   TBufferFile wBuf(TBuffer::kWrite);
+   wBuf.WriteUInt(code);
+   const ULong_t threshold = gSharedMemoryThreshold;
+   if (threshold > 0 && static_cast<ULong_t>(objBuf.Length()) >= threshold) {
+      const auto name = WriteSharedSegment(objBuf);
+      if (!name.empty()) {
+         wBuf.WriteULong(kSharedMemoryFlag | name.size());
+         wBuf.WriteFastArray(name.data(), name.size());
+         const int nBytes = s->SendRaw(wBuf.Buffer(), wBuf.Length());
+         if (nBytes <= 0)
+            shm_unlink(name.c_str());
+         return nBytes;
+      }
+   }
+   wBuf.WriteULong(objBuf.Length());
+   if (objBuf.Length())
+      wBuf.WriteBuf(objBuf.Buffer(), objBuf.Length());
+   return s->SendRaw(wBuf.Buffer(), wBuf.Length());
+}
+
+//////////////////////////////////////////////////////////////////////////
+/// Set the size in bytes from which the objects sent by MPSend() go through
+/// shared memory instead of the socket, e.g. the large results returned by
+/// the workers of TProcessExecutor and TTreeProcessorMP. Zero, the default,
+/// disables the shared memory transport. The threshold must be set before
+/// forking the workers, since it is a setting of each process.
+void MPSetSharedMemoryThreshold(ULong_t nbytes)
+{
+   gSharedMemoryThreshold = nbytes;
+}
+
+//////////////////////////////////////////////////////////////////////////
+/// Return the threshold set with MPSetSharedMemoryThreshold().
+ULong_t MPGetSharedMemoryThreshold()
+{
+   return gSharedMemoryThreshold;
+}
+
 //////////////////////////////////////////////////////////////////////////
 /// Receive message from a socket.
 /// This standalone function can be used to read a message that
@@ -76,7 +198,16 @@ MPCodeBufPair MPRecv(TSocket *s)
 
    //receive object if needed
    std::unique_ptr<TBufferFile> objBuf; //defaults to nullptr
-   if (classBufSize != 0) {
+   if (classBufSize & kSharedMemoryFlag) {
+      //the object is in a shared memory segment, the name of which follows
+      std::string name(classBufSize & ~kSharedMemoryFlag, '\0');
+      s->RecvRaw(&name[0], name.size());
+      objBuf = ReadSharedSegment(name);
+      if (!objBuf) {
+         Error("MPRecv", "[E] Could not read the shared memory segment %s\n", name.c_str());
+         return std::make_pair(MPCode::kRecvError, nullptr);
+      }
+   } else if (classBufSize != 0) {
       char *classBuf = new char[classBufSize];
       s->RecvRaw(classBuf, classBufSize);
       objBuf.reset(new TBufferFile(TBuffer::kRead, classBufSize, classBuf, true)); //the buffer is deleted by TBuffer's dtor
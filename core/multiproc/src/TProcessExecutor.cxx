@@ -79,6 +79,16 @@
 /// root[] ROOT::TProcessExecutor pool; auto hist = pool.MapReduce(CreateAndFillHists, 10, PoolUtils::ReduceObjects);
 /// ~~~
 ///
+/// ###Large results
+/// The results are streamed by the workers and sent to the client through a
+/// socket. Large results, such as collections of histograms, can instead be
+/// passed through POSIX shared memory, which saves copying them through the
+/// socket and in the client. This is enabled by setting a size threshold in
+/// bytes before calling Map or MapReduce:
+/// ~~~{.cpp}
+/// root[] MPSetSharedMemoryThreshold(1024 * 1024); // results of 1 MB or more go through shared memory
+/// ~~~
+///
 //////////////////////////////////////////////////////////////////////////
 
 namespace ROOT {
@@ -130,6 +130,62 @@ namespace ROOT {
          }
          target->Merge(&objTList);
       }
+
+      /// Merge TObjects with a pairwise reduction of logarithmic depth. At each level, the objects are merged two
+      /// by two in parallel through `executor.Foreach()`, e.g. with a ROOT::TThreadExecutor, so that the merge of
+      /// N slots takes log2(N) steps instead of N: this pays off for large objects like THnSparse or TH3.
+      /// If the target is one of objs (TThreadedObject::Merge()), the other objects are modified as well,
+      /// otherwise (TThreadedObject::SnapshotMerge()) they are left untouched.
+      template <class T, class EXECUTOR>
+      void MergeTObjectsPairwise(std::shared_ptr<T> target, std::vector<std::shared_ptr<T>> &objs, EXECUTOR &executor)
+      {
+         if (!target) return;
+         const bool isTargetInObjs = std::find(objs.begin(), objs.end(), target) != objs.end();
+         std::vector<std::shared_ptr<T>> partials;
+         if (isTargetInObjs)
+            partials.emplace_back(target); // the target accumulates the result
+         for (auto &obj : objs) {
+            if (obj && obj != target) partials.emplace_back(obj);
+         }
+         if (!isTargetInObjs) {
+            // only the left objects of the pairs of the first level are ever merged into: work on copies of them
+            for (std::size_t i = 0; i + 1 < partials.size(); i += 2)
+               partials[i].reset(Internal::TThreadedObjectUtils::Cloner<T>::Clone(partials[i].get()));
+         }
+
+         for (std::size_t stride = 1; stride < partials.size(); stride *= 2) {
+            std::vector<std::size_t> lefts;
+            for (std::size_t i = 0; i + stride < partials.size(); i += 2 * stride)
+               lefts.emplace_back(i);
+            executor.Foreach(
+               [&](std::size_t i) {
+                  TList objTList;
+                  objTList.Add(partials[i + stride].get());
+                  partials[i]->Merge(&objTList);
+               },
+               lefts);
+         }
+
+         if (!isTargetInObjs && !partials.empty()) {
+            TList objTList;
+            objTList.Add(partials[0].get());
+            target->Merge(&objTList);
+         }
+      }
+
+      /// Returns a merge function for TThreadedObject::Merge() and TThreadedObject::SnapshotMerge() that merges the
+      /// slots in parallel with MergeTObjectsPairwise(). The executor must outlive the returned function.
+      /// ~~~{.cpp}
+      /// ROOT::TThreadExecutor pool;
+      /// auto hsum = tto.Merge(ROOT::TThreadedObjectUtils::ParallelMergeTObjects<TH3D>(pool));
+      /// ~~~
+      template <class T, class EXECUTOR>
+      MergeFunctionType<T> ParallelMergeTObjects(EXECUTOR &executor)
+      {
+         return [&executor](std::shared_ptr<T> target, std::vector<std::shared_ptr<T>> &objs) {
+            MergeTObjectsPairwise(target, objs, executor);
+         };
+      }
    } // end of namespace TThreadedObjectUtils
 
    /**
@@ -291,6 +347,8 @@ namespace ROOT {
       /// Merge all the thread private objects. Can be called once: it does not
       /// create any new object but destroys the present bookkeping collapsing
       /// all objects into the one at slot 0.
+      /// The default merge function is sequential; for many slots of large
+      /// objects, TThreadedObjectUtils::ParallelMergeTObjects() merges them in parallel.
       std::shared_ptr<T> Merge(TThreadedObjectUtils::MergeFunctionType<T> mergeFunction = TThreadedObjectUtils::MergeTObjects<T>)
       {
          // We do not return if we already merged.
@@ -309,6 +367,7 @@ namespace ROOT {
       /// does create a new instance of class T to represent the "Sum" object.
       /// This method is not thread safe: correct or acceptable behaviours
       /// depend on the nature of T and of the merging function.
+      /// As for Merge(), TThreadedObjectUtils::ParallelMergeTObjects() can be used to merge in parallel.
       std::unique_ptr<T> SnapshotMerge(TThreadedObjectUtils::MergeFunctionType<T> mergeFunction = TThreadedObjectUtils::MergeTObjects<T>)
       {
          if (fIsMerged) {
@@ -128,6 +128,43 @@ TEST(TThreadedObject, SnapshotMerge)
    EXPECT_TRUE(hsum1 != hsum0);
 }
 
+// Runs the merges of each level one after the other, the parallel executors are tested in core/imt
+struct SequentialExecutor {
+   unsigned fNCalls = 0;
+   template <class F, class T>
+   void Foreach(F func, std::vector<T> &args)
+   {
+      ++fNCalls;
+      for (auto &arg : args)
+         func(arg);
+   }
+};
+
+TEST(TThreadedObject, PairwiseMerge)
+{
+   TH1::AddDirectory(false);
+
+   const unsigned nSlots = 5;
+   TH1F ref("h", "h", 64, -4, 4);
+   ROOT::TThreadedObject<TH1F> tto(ROOT::TNumSlots{nSlots}, "h", "h", 64, -4, 4);
+   gRandom->SetSeed(1);
+   for (unsigned i = 0; i < nSlots; ++i) {
+      tto.GetAtSlot(i)->FillRandom("gaus", 100 * (i + 1));
+      ref.Add(tto.GetAtSlot(i).get());
+   }
+   const auto entriesSlot1 = tto.GetAtSlot(1)->GetEntries();
+
+   SequentialExecutor executor;
+   auto hsnap = tto.SnapshotMerge(ROOT::TThreadedObjectUtils::ParallelMergeTObjects<TH1F>(executor));
+   IsHistEqual(*hsnap, ref);
+   EXPECT_EQ(executor.fNCalls, 3u); // ceil(log2(5)) levels
+   // the slots are left untouched
+   EXPECT_EQ(tto.GetAtSlot(1)->GetEntries(), entriesSlot1);
+
+   auto hsum = tto.Merge(ROOT::TThreadedObjectUtils::ParallelMergeTObjects<TH1F>(executor));
+   IsHistEqual(*hsum, ref);
+}
+
 TEST(TThreadedObject, GrowSlots)
 {
    // create a TThreadedObject with 3 slots...
@@ -39,6 +39,10 @@ namespace ROOT {
 ///   [207 - 208]
 ///  - LZ4 is recommended to be used with compression level 4 [404]
 ///  - ZSTD is recommended to be used with compression level 5 [505]
+///
+/// The (de)compression of an algorithm can be offloaded, e.g. to a hardware
+/// accelerator, by a backend falling back to the software codec, see
+/// R__SetZipBackend in RZip.h.
 
 struct RCompressionSetting {
    struct EDefaults { /// Note: this is only temporarily a struct and will become a enum class hence the name convention
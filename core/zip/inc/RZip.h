@@ -23,6 +23,14 @@ extern "C" unsigned long R__memcompress(char *tgt, unsigned long tgtsize, char *
 
 extern "C" void R__zipMultipleAlgorithm(int cxlevel, int *srcsize, char *src, int *tgtsize, char *tgt, int *irep, ROOT::RCompressionSetting::EAlgorithm::EValues);
 
+/**
+ * Same as R__zipMultipleAlgorithm, but ZSTD compresses with the dictionary `dictId` registered with
+ * R__registerZSTDDictionary (see ZipZSTD.h). The other algorithms, and `dictId` 0, compress without dictionary.
+ */
+extern "C" void R__zipMultipleAlgorithmDictionary(int cxlevel, int *srcsize, char *src, int *tgtsize, char *tgt,
+                                                  int *irep, ROOT::RCompressionSetting::EAlgorithm::EValues,
+                                                  unsigned int dictId);
+
 /**
  * This is a historical definition, prior to ROOT supporting multiple algorithms in a single file.  Use
  * R__zipMultipleAlgorithm instead.
@@ -33,6 +41,26 @@ extern "C" void R__unzip(int *srcsize, unsigned char *src, int *tgtsize, unsigne
 
 extern "C" int R__unzip_header(int *srcsize, unsigned char *src, int *tgtsize);
 
+/**
+ * A (de)compression backend taking over the buffers of one algorithm, e.g. to offload them to a hardware accelerator.
+ * The hooks have the interface of R__zipMultipleAlgorithm and R__unzip; they return false if they did not process
+ * the buffer (e.g. no device is available or the buffer is too small to be worth it), in which case the software
+ * codec processes it. Either hook can be null. The buffers they compress must be readable by the software codec, and
+ * they must be thread-safe.
+ */
+struct R__ZipBackend {
+   const char *fName;
+   bool (*fZip)(int cxlevel, int *srcsize, char *src, int *tgtsize, char *tgt, int *irep);
+   bool (*fUnzip)(int *srcsize, unsigned char *src, int *tgtsize, unsigned char *tgt, int *irep);
+};
+
+/**
+ * Use `backend`, which must outlive its use, for the buffers of `algorithm`; nullptr restores the software codec.
+ * Returns the previous backend, if any. The dictionary compression of ZSTD always uses the software codec.
+ */
+extern "C" const R__ZipBackend *R__SetZipBackend(ROOT::RCompressionSetting::EAlgorithm::EValues algorithm,
+                                                 const R__ZipBackend *backend);
+
 enum { kMAXZIPBUF = 0xffffff };
 
 #endif
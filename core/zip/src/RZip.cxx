@@ -16,6 +16,7 @@
 
 #include "zlib.h"
 
+#include <atomic>
 #include <cstdio>
 #include <cassert>
 
@@ -64,6 +65,33 @@ extern "C" void R__SetZipMode(ROOT::RCompressionSetting::EAlgorithm::EValues mod
    R__ZipMode = mode;
 }
 
+/* ===========================================================================
+   The backends replacing the software codecs, by algorithm, see R__SetZipBackend
+ */
+static std::atomic<const R__ZipBackend *> gZipBackends[ROOT::RCompressionSetting::EAlgorithm::kUndefined];
+
+const R__ZipBackend *R__SetZipBackend(ROOT::RCompressionSetting::EAlgorithm::EValues algorithm,
+                                      const R__ZipBackend *backend)
+{
+   if (algorithm <= ROOT::RCompressionSetting::EAlgorithm::kUseGlobal ||
+       algorithm >= ROOT::RCompressionSetting::EAlgorithm::kUndefined)
+      return nullptr;
+   return gZipBackends[algorithm].exchange(backend);
+}
+
+static const R__ZipBackend *R__GetZipBackend(ROOT::RCompressionSetting::EAlgorithm::EValues algorithm)
+{
+   return gZipBackends[algorithm].load(std::memory_order_acquire);
+}
+
+/* Decompress with the backend of the algorithm, if any. Returns false if the software codec must do it. */
+static bool R__unzipBackend(ROOT::RCompressionSetting::EAlgorithm::EValues algorithm, int *srcsize, uch *src,
+                            int *tgtsize, uch *tgt, int *irep)
+{
+   const R__ZipBackend *backend = R__GetZipBackend(algorithm);
+   return backend && backend->fUnzip && backend->fUnzip(srcsize, src, tgtsize, tgt, irep);
+}
+
 unsigned long R__crc32(unsigned long crc, const unsigned char* buf, unsigned int len)
 {
    return crc32(crc, buf, len);
@@ -93,6 +121,13 @@ void R__zipMultipleAlgorithm(int cxlevel, int *srcsize, char *src, int *tgtsize,
     compressionAlgorithm = R__ZipMode;
   }
 
+  if (compressionAlgorithm > ROOT::RCompressionSetting::EAlgorithm::kUseGlobal &&
+      compressionAlgorithm < ROOT::RCompressionSetting::EAlgorithm::kUndefined) {
+    const R__ZipBackend *backend = R__GetZipBackend(compressionAlgorithm);
+    if (backend && backend->fZip && backend->fZip(cxlevel, srcsize, src, tgtsize, tgt, irep))
+      return;
+  }
+
   // The LZMA compression algorithm from the XZ package
   if (compressionAlgorithm == ROOT::RCompressionSetting::EAlgorithm::kLZMA) {
      R__zipLZMA(cxlevel, srcsize, src, tgtsize, tgt, irep);
@@ -110,6 +145,22 @@ void R__zipMultipleAlgorithm(int cxlevel, int *srcsize, char *src, int *tgtsize,
   }
 }
 
+void R__zipMultipleAlgorithmDictionary(int cxlevel, int *srcsize, char *src, int *tgtsize, char *tgt, int *irep,
+                                       ROOT::RCompressionSetting::EAlgorithm::EValues compressionAlgorithm,
+                                       unsigned int dictId)
+{
+  if (compressionAlgorithm == ROOT::RCompressionSetting::EAlgorithm::kUseGlobal) {
+    compressionAlgorithm = R__ZipMode;
+  }
+
+  if (dictId == 0 || compressionAlgorithm != ROOT::RCompressionSetting::EAlgorithm::kZSTD ||
+      *srcsize < 1 + HDRSIZE + 1 || cxlevel <= 0) {
+     R__zipMultipleAlgorithm(cxlevel, srcsize, src, tgtsize, tgt, irep, compressionAlgorithm);
+     return;
+  }
+  R__zipZSTDDictionary(cxlevel, srcsize, src, tgtsize, tgt, irep, dictId);
+}
+
   // The very old algorithm for backward compatibility
   // 0 for selecting with R__ZipMode in a backward compatible way
   // 3 for selecting in other cases
@@ -358,16 +409,20 @@ void R__unzip(int *srcsize, uch *src, int *tgtsize, uch *tgt, int *irep)
 
    /* ZLIB and other standard compression algorithms */
    if (is_valid_header_zlib(src)) {
-      R__unzipZLIB(srcsize, src, tgtsize, tgt, irep);
+      if (!R__unzipBackend(ROOT::RCompressionSetting::EAlgorithm::kZLIB, srcsize, src, tgtsize, tgt, irep))
+         R__unzipZLIB(srcsize, src, tgtsize, tgt, irep);
       return;
    } else if (is_valid_header_lzma(src)) {
-      R__unzipLZMA(srcsize, src, tgtsize, tgt, irep);
+      if (!R__unzipBackend(ROOT::RCompressionSetting::EAlgorithm::kLZMA, srcsize, src, tgtsize, tgt, irep))
+         R__unzipLZMA(srcsize, src, tgtsize, tgt, irep);
       return;
    } else if (is_valid_header_lz4(src)) {
-      R__unzipLZ4(srcsize, src, tgtsize, tgt, irep);
+      if (!R__unzipBackend(ROOT::RCompressionSetting::EAlgorithm::kLZ4, srcsize, src, tgtsize, tgt, irep))
+         R__unzipLZ4(srcsize, src, tgtsize, tgt, irep);
       return;
    } else if (is_valid_header_zstd(src)) {
-      R__unzipZSTD(srcsize, src, tgtsize, tgt, irep);
+      if (!R__unzipBackend(ROOT::RCompressionSetting::EAlgorithm::kZSTD, srcsize, src, tgtsize, tgt, irep))
+         R__unzipZSTD(srcsize, src, tgtsize, tgt, irep);
       return;
    }
 
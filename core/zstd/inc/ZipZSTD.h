@@ -17,6 +17,13 @@ extern "C" {
 #endif
 void R__zipZSTD(int cxlevel, int *srcsize, char *src, int *tgtsize, char *tgt, int *irep);
 void R__unzipZSTD(int *srcsize, unsigned char *src, int *tgtsize, unsigned char *tgt, int *irep);
+
+// Dictionary compression: the dictionaries are registered once per process and identified by their ZSTD
+// dictionary ID, which ZSTD stores in the compressed frames; R__unzipZSTD uses it to find the dictionary.
+unsigned int R__registerZSTDDictionary(const char *dict, int dictSize);
+int R__trainZSTDDictionary(char *dict, int dictCapacity, const char *samples, const int *sampleSizes, int nSamples);
+void R__zipZSTDDictionary(int cxlevel, int *srcsize, char *src, int *tgtsize, char *tgt, int *irep,
+                          unsigned int dictId);
 #ifdef __cplusplus
 }
 #endif
@@ -14,7 +14,11 @@
 
 #include "zdict.h"
 #include <zstd.h>
+#include <map>
 #include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
 
 #include <iostream>
 
@@ -22,17 +26,82 @@ static const int kHeaderSize = 9;
 
 static const size_t errorCodeSmallBuffer = (size_t)-70;
 
-void R__zipZSTD(int cxlevel, int *srcsize, char *src, int *tgtsize, char *tgt, int *irep)
+namespace {
+
+/// A dictionary registered with R__registerZSTDDictionary. Its digested forms can be shared by threads.
+struct RZSTDDictionary {
+    struct RDDictDeleter {
+        void operator()(ZSTD_DDict *ddict) const { ZSTD_freeDDict(ddict); }
+    };
+    struct RCDictDeleter {
+        void operator()(ZSTD_CDict *cdict) const { ZSTD_freeCDict(cdict); }
+    };
+
+    std::vector<char> fContent;
+    std::unique_ptr<ZSTD_DDict, RDDictDeleter> fDDict;
+    /// Digested for compression at a given level, created on first use.
+    std::map<int, std::unique_ptr<ZSTD_CDict, RCDictDeleter>> fCDicts;
+};
+
+/// Registered dictionaries by dictionary ID. They are never unregistered, so pointers to them stay valid.
+std::unordered_map<unsigned int, std::unique_ptr<RZSTDDictionary>> gDictionaries;
+std::mutex gDictionariesMutex;
+
+const ZSTD_DDict *GetDDict(unsigned int dictId)
 {
-    using Ctx_ptr = std::unique_ptr<ZSTD_CCtx, decltype(&ZSTD_freeCCtx)>;
-    Ctx_ptr fCtx{ZSTD_createCCtx(), &ZSTD_freeCCtx};
+    std::lock_guard<std::mutex> lock(gDictionariesMutex);
+    auto it = gDictionaries.find(dictId);
+    return it == gDictionaries.end() ? nullptr : it->second->fDDict.get();
+}
+
+const ZSTD_CDict *GetCDict(unsigned int dictId, int level)
+{
+    std::lock_guard<std::mutex> lock(gDictionariesMutex);
+    auto it = gDictionaries.find(dictId);
+    if (it == gDictionaries.end())
+        return nullptr;
+    auto &cdict = it->second->fCDicts[level];
+    if (!cdict) {
+        const auto &content = it->second->fContent;
+        cdict.reset(ZSTD_createCDict(content.data(), content.size(), level));
+    }
+    return cdict.get();
+}
+
+/// The contexts are reused by the calls on the same thread: creating them for every buffer is significant for small
+/// buffers. Each call sets all the parameters of the (de)compression.
+ZSTD_CCtx *GetThreadCCtx()
+{
+    struct RCCtxDeleter {
+        void operator()(ZSTD_CCtx *ctx) const { ZSTD_freeCCtx(ctx); }
+    };
+    thread_local std::unique_ptr<ZSTD_CCtx, RCCtxDeleter> ctx{ZSTD_createCCtx()};
+    return ctx.get();
+}
+
+ZSTD_DCtx *GetThreadDCtx()
+{
+    struct RDCtxDeleter {
+        void operator()(ZSTD_DCtx *ctx) const { ZSTD_freeDCtx(ctx); }
+    };
+    thread_local std::unique_ptr<ZSTD_DCtx, RDCtxDeleter> ctx{ZSTD_createDCtx()};
+    return ctx.get();
+}
+
+/// Compress with `cdict` if not null, without dictionary otherwise.
+void ZipZSTDImpl(int cxlevel, int *srcsize, char *src, int *tgtsize, char *tgt, int *irep, const ZSTD_CDict *cdict)
+{
+    ZSTD_CCtx *ctx = GetThreadCCtx();
 
     *irep = 0;
 
-    size_t retval = ZSTD_compressCCtx(fCtx.get(),
-                                        &tgt[kHeaderSize], static_cast<size_t>(*tgtsize - kHeaderSize),
-                                        src, static_cast<size_t>(*srcsize),
-                                        2*cxlevel);
+    size_t retval = cdict ? ZSTD_compress_usingCDict(ctx,
+                                                     &tgt[kHeaderSize], static_cast<size_t>(*tgtsize - kHeaderSize),
+                                                     src, static_cast<size_t>(*srcsize), cdict)
+                          : ZSTD_compressCCtx(ctx,
+                                              &tgt[kHeaderSize], static_cast<size_t>(*tgtsize - kHeaderSize),
+                                              src, static_cast<size_t>(*srcsize),
+                                              2*cxlevel);
 
     if (R__unlikely(ZSTD_isError(retval))) {
         if (R__unlikely(retval != errorCodeSmallBuffer)) {
@@ -58,10 +127,61 @@ void R__zipZSTD(int cxlevel, int *srcsize, char *src, int *tgtsize, char *tgt, i
     tgt[8] = (inflate_size >> 16) & 0xff;
 }
 
+} // anonymous namespace
+
+void R__zipZSTD(int cxlevel, int *srcsize, char *src, int *tgtsize, char *tgt, int *irep)
+{
+    ZipZSTDImpl(cxlevel, srcsize, src, tgtsize, tgt, irep, nullptr);
+}
+
+/// Compress with the registered dictionary `dictId`; without dictionary if it is not registered.
+void R__zipZSTDDictionary(int cxlevel, int *srcsize, char *src, int *tgtsize, char *tgt, int *irep,
+                          unsigned int dictId)
+{
+    ZipZSTDImpl(cxlevel, srcsize, src, tgtsize, tgt, irep, dictId ? GetCDict(dictId, 2*cxlevel) : nullptr);
+}
+
+/// Register a dictionary trained by ZSTD, e.g. with R__trainZSTDDictionary, for compression and decompression.
+/// Returns its dictionary ID, or 0 if it is not a valid ZSTD dictionary. Registering a dictionary again is harmless.
+unsigned int R__registerZSTDDictionary(const char *dict, int dictSize)
+{
+    if (!dict || dictSize <= 0)
+        return 0;
+    const unsigned int dictId = ZDICT_getDictID(dict, dictSize);
+    if (dictId == 0)
+        return 0;
+
+    std::lock_guard<std::mutex> lock(gDictionariesMutex);
+    auto &entry = gDictionaries[dictId];
+    if (!entry) {
+        std::unique_ptr<RZSTDDictionary> newEntry(new RZSTDDictionary());
+        newEntry->fContent.assign(dict, dict + dictSize);
+        newEntry->fDDict.reset(ZSTD_createDDict(newEntry->fContent.data(), newEntry->fContent.size()));
+        if (!newEntry->fDDict) {
+            gDictionaries.erase(dictId);
+            return 0;
+        }
+        entry = std::move(newEntry);
+    }
+    return dictId;
+}
+
+/// Train a dictionary of at most `dictCapacity` bytes from `nSamples` samples, stored one after the other in
+/// `samples`. Returns the size of the dictionary written to `dict`, or 0 if there are not enough samples.
+int R__trainZSTDDictionary(char *dict, int dictCapacity, const char *samples, const int *sampleSizes, int nSamples)
+{
+    if (!dict || dictCapacity <= 0 || nSamples <= 0)
+        return 0;
+    std::vector<size_t> sizes(sampleSizes, sampleSizes + nSamples);
+    size_t retval = ZDICT_trainFromBuffer(dict, dictCapacity, samples, sizes.data(), nSamples);
+    if (ZDICT_isError(retval))
+        return 0;
+    return static_cast<int>(retval);
+}
+
 void R__unzipZSTD(int *srcsize, unsigned char *src, int *tgtsize, unsigned char *tgt, int *irep)
 {
-    using Ctx_ptr = std::unique_ptr<ZSTD_DCtx, decltype(&ZSTD_freeDCtx)>;
-    Ctx_ptr fCtx{ZSTD_createDCtx(), &ZSTD_freeDCtx};
+    ZSTD_DCtx *ctx = GetThreadDCtx();
     *irep = 0;
 
     if (R__unlikely(src[0] != 'Z' || src[1] != 'S')) {
@@ -77,9 +197,23 @@ void R__unzipZSTD(int *srcsize, unsigned char *src, int *tgtsize, unsigned char
       return;
     }
 
-    size_t retval = ZSTD_decompressDCtx(fCtx.get(),
-                                        (char *)tgt, static_cast<size_t>(*tgtsize),
-                                        (char *)&src[kHeaderSize], static_cast<size_t>(*srcsize - kHeaderSize));
+    // Frames compressed with a dictionary carry its ID
+    const unsigned int dictId =
+      ZSTD_getDictID_fromFrame(&src[kHeaderSize], static_cast<size_t>(*srcsize - kHeaderSize));
+    const ZSTD_DDict *ddict = dictId ? GetDDict(dictId) : nullptr;
+    if (R__unlikely(dictId && !ddict)) {
+      std::cerr << "R__unzipZSTD: the buffer was compressed with the dictionary " << dictId <<
+      ", which is not registered." << std::endl;
+      return;
+    }
+
+    size_t retval = ddict ? ZSTD_decompress_usingDDict(ctx,
+                                                       (char *)tgt, static_cast<size_t>(*tgtsize),
+                                                       (char *)&src[kHeaderSize],
+                                                       static_cast<size_t>(*srcsize - kHeaderSize), ddict)
+                          : ZSTD_decompressDCtx(ctx,
+                                                (char *)tgt, static_cast<size_t>(*tgtsize),
+                                                (char *)&src[kHeaderSize], static_cast<size_t>(*srcsize - kHeaderSize));
 
     /* The error code 18446744073709551546 arises when the tgt buffer is too small
      * However this error is already handled outside of the compression algorithm
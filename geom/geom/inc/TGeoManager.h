@@ -12,6 +12,7 @@
 #ifndef ROOT_TGeoManager
 #define ROOT_TGeoManager
 
+#include <atomic>
 #include <mutex>
 #include <thread>
 #include <map>
@@ -51,6 +52,9 @@ public:
 
 protected:
    static std::mutex     fgMutex;           //! mutex for navigator booking in MT mode
+   static std::mutex     fgThreadIdMutex;   //! mutex for the map of thread ids
+   static std::atomic<Long64_t> fgNavigatorsGeneration; //! changes when navigators are added, removed or switched
+   static std::atomic<Long64_t> fgThreadsGeneration;    //! changes when the map of thread ids is cleared
    static Bool_t         fgLock;            //! Lock preventing a second geometry to be loaded
    static Int_t          fgVerboseLevel;    //! Verbosity level for Info messages (no IO).
    static Int_t          fgMaxLevel;        //! Maximum level in geometry
@@ -107,8 +107,12 @@ public :
    TGeoNode              *FindNextBoundary(Double_t stepmax=TGeoShape::Big(),const char *path="", Bool_t frombdr=kFALSE);
    TGeoNode              *FindNextDaughterBoundary(Double_t *point, Double_t *dir, Int_t &idaughter, Bool_t compmatrix=kFALSE);
    TGeoNode              *FindNextBoundaryAndStep(Double_t stepmax=TGeoShape::Big(), Bool_t compsafe=kFALSE);
+   void                   FindNextBoundaryAndStep_v(Int_t ntracks, Double_t *points, const Double_t *dirs,
+                                                    const Double_t *stepmax, Double_t *steps, TGeoNode **nodes,
+                                                    Bool_t compsafe=kFALSE, Double_t *safeties=nullptr);
    TGeoNode              *FindNode(Bool_t safe_start=kTRUE);
    TGeoNode              *FindNode(Double_t x, Double_t y, Double_t z);
+   void                   FindNode_v(Int_t npoints, const Double_t *points, TGeoNode **nodes);
    Double_t              *FindNormal(Bool_t forward=kTRUE);
    Double_t              *FindNormalFast();
    TGeoNode              *InitTrack(const Double_t *point, const Double_t *dir);
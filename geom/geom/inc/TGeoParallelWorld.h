@@ -13,6 +13,8 @@
 
 #include "TNamed.h"
 
+#include <vector>
+
 // forward declarations
 class TGeoManager;
 class TGeoPhysicalNode;
@@ -28,13 +30,21 @@ protected :
    TGeoVolume        *fVolume;         //! helper volume
    TGeoPhysicalNode  *fLastState;      //! Last PN touched
    TObjArray         *fPhysical;       //! array of physical nodes
+   Int_t              fSafetyNbins[3]; // number of cells of the safety grid along X, Y, Z (0 if no grid)
+   Double_t           fSafetyMin[3];   // lower corner of the safety grid
+   Double_t           fSafetyCell[3];  // cell sizes of the safety grid
+   std::vector<Float_t> fSafetyGrid;   // safety to the parallel world at the cell centers, X index fastest
 
    TGeoParallelWorld(const TGeoParallelWorld&) = delete;
    TGeoParallelWorld& operator=(const TGeoParallelWorld&) = delete;
 
+   Double_t          SafetyToNodes(const Double_t *point) const;
+   Double_t          SafetyFromGrid(const Double_t *point) const;
+
 public:
    // constructors
-   TGeoParallelWorld() : TNamed(),fGeoManager(nullptr),fPaths(nullptr),fUseOverlaps(kFALSE),fIsClosed(kFALSE),fVolume(nullptr),fLastState(nullptr),fPhysical(nullptr) {}
+   TGeoParallelWorld() : TNamed(),fGeoManager(nullptr),fPaths(nullptr),fUseOverlaps(kFALSE),fIsClosed(kFALSE),fVolume(nullptr),fLastState(nullptr),
+                         fPhysical(nullptr),fSafetyNbins{0, 0, 0},fSafetyMin{0., 0., 0.},fSafetyCell{0., 0., 0.} {}
    TGeoParallelWorld(const char *name, TGeoManager *mgr);
 
    // destructor
@@ -61,6 +71,11 @@ public:
    TGeoPhysicalNode *FindNextBoundary(Double_t point[3], Double_t dir[3], Double_t &step, Double_t stepmax=1.E30);
    Double_t          Safety(Double_t point[3], Double_t safmax=1.E30);
 
+   // Precomputed safety grid
+   Bool_t            BuildSafetyGrid(Int_t nx=32, Int_t ny=32, Int_t nz=32);
+   void              ClearSafetyGrid();
+   Bool_t            HasSafetyGrid() const {return !fSafetyGrid.empty();}
+
    // Getters
    TGeoManager      *GetGeometry() const {return fGeoManager;}
    Bool_t            IsClosed() const    {return fIsClosed;}
@@ -70,7 +85,7 @@ public:
    void              CheckOverlaps(Double_t ovlp=0.001); // default 10 microns
    void              Draw(Option_t *option) override;
 
-   ClassDefOverride(TGeoParallelWorld, 3)     // parallel world base class
+   ClassDefOverride(TGeoParallelWorld, 4)     // parallel world base class
 };
 
 #endif
@@ -107,6 +107,15 @@ class TGeoTessellated : public TGeoBBox {
 public:
    using Vertex_t = Tessellated::Vertex_t;
 
+   /// Node of the bounding volume hierarchy of the facets. A leaf holds fNfacets facets listed from fFirst in
+   /// fBVHFacets; an inner node has fNfacets = 0 and its two children at fFirst and fFirst + 1.
+   struct BVHNode_t {
+      double fMin[3] = {0., 0., 0.};
+      double fMax[3] = {0., 0., 0.};
+      int fFirst = 0;
+      int fNfacets = 0;
+   };
+
 private:
    int fNfacets = 0;                // Number of facets
    int fNvert = 0;                  // Number of vertices
@@ -115,10 +124,17 @@ private:
    bool fClosedBody = false;        // The faces are making a closed body
    std::vector<Vertex_t> fVertices; // List of vertices
    std::vector<TGeoFacet> fFacets;  // List of facets
+   std::vector<Vertex_t> fOutwardNormals; //! Facet normals
+   std::vector<BVHNode_t> fBVHNodes;      //! Bounding volume hierarchy of the facets, root first
+   std::vector<int> fBVHFacets;           //! Facet indices ordered by BVH leaf
 
    TGeoTessellated(const TGeoTessellated&) = delete;
    TGeoTessellated& operator=(const TGeoTessellated&) = delete;
 
+   void BuildBVH();
+   int FindCrossing(const double *point, const double *dir, int orientation, double stepmax, double &dist) const;
+   int FindClosestFacet(const double *point, double &dist) const;
+
 public:
    // constructors
    TGeoTessellated() {}
@@ -145,6 +161,18 @@ public:
    const Vertex_t &GetVertex(int i) const { return fVertices[i]; }
 
    void AfterStreamer() override;
+   void ComputeNormal(const Double_t *point, const Double_t *dir, Double_t *norm) override;
+   void ComputeNormal_v(const Double_t *points, const Double_t *dirs, Double_t *norms, Int_t vecsize) override;
+   Bool_t Contains(const Double_t *point) const override;
+   void Contains_v(const Double_t *points, Bool_t *inside, Int_t vecsize) const override;
+   Double_t DistFromInside(const Double_t *point, const Double_t *dir, Int_t iact = 1,
+                           Double_t step = TGeoShape::Big(), Double_t *safe = nullptr) const override;
+   void DistFromInside_v(const Double_t *points, const Double_t *dirs, Double_t *dists, Int_t vecsize,
+                         Double_t *step) const override;
+   Double_t DistFromOutside(const Double_t *point, const Double_t *dir, Int_t iact = 1,
+                            Double_t step = TGeoShape::Big(), Double_t *safe = nullptr) const override;
+   void DistFromOutside_v(const Double_t *points, const Double_t *dirs, Double_t *dists, Int_t vecsize,
+                          Double_t *step) const override;
    int DistancetoPrimitive(int, int) override { return 99999; }
    const TBuffer3D &GetBuffer3D(int reqSections, Bool_t localFrame) const override;
    void GetMeshNumbers(int &nvert, int &nsegs, int &npols) const override;
@@ -152,6 +180,8 @@ public:
    void InspectShape() const override {}
    TBuffer3D *MakeBuffer3D() const override;
    void Print(Option_t *option = "") const override;
+   Double_t Safety(const Double_t *point, Bool_t in = kTRUE) const override;
+   void Safety_v(const Double_t *points, const Bool_t *inside, Double_t *safe, Int_t vecsize) const override;
    void SavePrimitive(std::ostream &, Option_t *) override {}
    void SetPoints(double *points) const override;
    void SetPoints(Float_t *points) const override;
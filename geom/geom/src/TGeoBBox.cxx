@@ -1078,7 +1078,18 @@ void TGeoBBox::FillBuffer3D(TBuffer3D & buffer, Int_t reqSections, Bool_t localF
 
 void TGeoBBox::Contains_v(const Double_t *points, Bool_t *inside, Int_t vecsize) const
 {
-   for (Int_t i=0; i<vecsize; i++) inside[i] = Contains(&points[3*i]);
+   // Derived shapes not overriding the vector methods use their scalar methods
+   if (IsA() != TGeoBBox::Class()) {
+      for (Int_t i=0; i<vecsize; i++) inside[i] = Contains(&points[3*i]);
+      return;
+   }
+   // Branch-free loop, vectorizable by the compiler
+   const Double_t dx = fDX, dy = fDY, dz = fDZ;
+   const Double_t ox = fOrigin[0], oy = fOrigin[1], oz = fOrigin[2];
+   for (Int_t i=0; i<vecsize; i++) {
+      const Double_t *point = &points[3*i];
+      inside[i] = (TMath::Abs(point[0]-ox) <= dx) & (TMath::Abs(point[1]-oy) <= dy) & (TMath::Abs(point[2]-oz) <= dz);
+   }
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -1096,7 +1107,26 @@ void TGeoBBox::ComputeNormal_v(const Double_t *points, const Double_t *dirs, Dou
 
 void TGeoBBox::DistFromInside_v(const Double_t *points, const Double_t *dirs, Double_t *dists, Int_t vecsize, Double_t* step) const
 {
-   for (Int_t i=0; i<vecsize; i++) dists[i] = DistFromInside(&points[3*i], &dirs[3*i], 3, step[i]);
+   if (IsA() != TGeoBBox::Class()) {
+      for (Int_t i=0; i<vecsize; i++) dists[i] = DistFromInside(&points[3*i], &dirs[3*i], 3, step[i]);
+      return;
+   }
+   // Branch-free version of DistFromInside(), giving the same results
+   const Double_t par[3] = {fDX, fDY, fDZ};
+   for (Int_t i=0; i<vecsize; i++) {
+      Double_t smin = TGeoShape::Big();
+      Bool_t outside = kFALSE;
+      for (Int_t j=0; j<3; j++) {
+         const Double_t newpt = points[3*i+j] - fOrigin[j];
+         const Double_t d = dirs[3*i+j];
+         const Bool_t valid = (d != 0);
+         const Double_t dsafe = valid ? d : 1.;
+         const Double_t s = (d > 0) ? (par[j]-newpt)/dsafe : -(par[j]+newpt)/dsafe;
+         outside |= valid & (s < 0);
+         smin = (valid && s < smin) ? s : smin;
+      }
+      dists[i] = outside ? 0. : smin;
+   }
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -1104,7 +1134,37 @@ void TGeoBBox::DistFromInside_v(const Double_t *points, const Double_t *dirs, Do
 
 void TGeoBBox::DistFromOutside_v(const Double_t *points, const Double_t *dirs, Double_t *dists, Int_t vecsize, Double_t* step) const
 {
-   for (Int_t i=0; i<vecsize; i++) dists[i] = DistFromOutside(&points[3*i], &dirs[3*i], 3, step[i]);
+   if (IsA() != TGeoBBox::Class()) {
+      for (Int_t i=0; i<vecsize; i++) dists[i] = DistFromOutside(&points[3*i], &dirs[3*i], 3, step[i]);
+      return;
+   }
+   // Branch-free version of DistFromOutside(), giving the same results: the first crossed face
+   // in the order x, y, z is kept
+   const Double_t par[3] = {fDX, fDY, fDZ};
+   for (Int_t i=0; i<vecsize; i++) {
+      const Double_t *dir = &dirs[3*i];
+      Double_t newpt[3], saf[3];
+      for (Int_t j=0; j<3; j++) {
+         newpt[j] = points[3*i+j] - fOrigin[j];
+         saf[j] = TMath::Abs(newpt[j]) - par[j];
+      }
+      const Bool_t far = (saf[0] >= step[i]) | (saf[1] >= step[i]) | (saf[2] >= step[i]);
+      const Bool_t in = (saf[0] <= 0) & (saf[1] <= 0) & (saf[2] <= 0);
+      // point inside: exiting or on the boundary of the closest face
+      const Int_t jmax = (saf[2] > TMath::Max(saf[0], saf[1])) ? 2 : ((saf[1] > saf[0]) ? 1 : 0);
+      const Double_t sin = (newpt[jmax]*dir[jmax] > 0) ? TGeoShape::Big() : 0.;
+      Double_t snext = TGeoShape::Big();
+      for (Int_t j=2; j>=0; j--) {
+         const Bool_t valid = (saf[j] >= 0) & (newpt[j]*dir[j] < 0);
+         const Double_t snxt = saf[j]/(valid ? TMath::Abs(dir[j]) : 1.);
+         Bool_t hit = valid;
+         for (Int_t k=0; k<3; k++) {
+            if (k != j) hit &= (TMath::Abs(newpt[k]+snxt*dir[k]) <= par[k]);
+         }
+         snext = hit ? snxt : snext;
+      }
+      dists[i] = far ? TGeoShape::Big() : (in ? sin : snext);
+   }
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -1114,5 +1174,18 @@ void TGeoBBox::DistFromOutside_v(const Double_t *points, const Double_t *dirs, D
 
 void TGeoBBox::Safety_v(const Double_t *points, const Bool_t *inside, Double_t *safe, Int_t vecsize) const
 {
-   for (Int_t i=0; i<vecsize; i++) safe[i] = Safety(&points[3*i], inside[i]);
+   if (IsA() != TGeoBBox::Class()) {
+      for (Int_t i=0; i<vecsize; i++) safe[i] = Safety(&points[3*i], inside[i]);
+      return;
+   }
+   const Double_t dx = fDX, dy = fDY, dz = fDZ;
+   const Double_t ox = fOrigin[0], oy = fOrigin[1], oz = fOrigin[2];
+   for (Int_t i=0; i<vecsize; i++) {
+      const Double_t *point = &points[3*i];
+      const Double_t safx = TMath::Abs(point[0]-ox) - dx;
+      const Double_t safy = TMath::Abs(point[1]-oy) - dy;
+      const Double_t safz = TMath::Abs(point[2]-oz) - dz;
+      const Double_t safmax = TMath::Max(safx, TMath::Max(safy, safz));
+      safe[i] = inside[i] ? -safmax : safmax;
+   }
 }
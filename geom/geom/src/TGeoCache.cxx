@@ -62,7 +62,8 @@ TGeoNodeCache::TGeoNodeCache(TGeoNode *top, Bool_t nodeid, Int_t capacity)
 {
    fGeoCacheMaxLevels    = capacity;
    fGeoCacheStackSize    = 10;
-   fGeoInfoStackSize     = 100;
+   // Size the info stack once from the geometry depth, so that it does not grow during navigation
+   fGeoInfoStackSize     = TMath::Max(100, 2*capacity);
    fLevel       = 0;
    fStackLevel  = 0;
    fInfoLevel   = 0;
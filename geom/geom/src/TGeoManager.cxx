@@ -237,6 +237,7 @@ in order to enhance rays.
 #include <cstdlib>
 #include <iostream>
 #include <fstream>
+#include <vector>
 
 #include "TROOT.h"
 #include "TGeoManager.h"
@@ -284,6 +285,11 @@ in order to enhance rays.
 #include "TGDMLMatrix.h"
 #include "TGeoOpticalSurface.h"
 
+#ifdef R__USE_IMT
+#include "ROOT/TThreadExecutor.hxx"
+#include "ROOT/TSeq.hxx"
+#endif
+
 // statics and globals
 
 TGeoManager *gGeoManager = nullptr;
@@ -291,6 +297,9 @@ TGeoManager *gGeoManager = nullptr;
 ClassImp(TGeoManager);
 
 std::mutex TGeoManager::fgMutex;
+std::mutex TGeoManager::fgThreadIdMutex;
+std::atomic<Long64_t> TGeoManager::fgNavigatorsGeneration{0};
+std::atomic<Long64_t> TGeoManager::fgThreadsGeneration{0};
 Bool_t TGeoManager::fgLock            = kFALSE;
 Bool_t TGeoManager::fgLockNavigators  = kFALSE;
 Int_t  TGeoManager::fgVerboseLevel    = 1;
@@ -728,25 +737,38 @@ TGeoNavigator *TGeoManager::AddNavigator()
    }
    TGeoNavigator *nav = array->AddNavigator();
    if (fClosed) nav->GetCache()->BuildInfoBranch();
+   fgNavigatorsGeneration++;
    if (fMultiThread) fgMutex.unlock();
    return nav;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
-/// Returns current navigator for the calling thread.
+/// Returns current navigator for the calling thread. In MT mode the navigator is
+/// cached per thread and the cache is valid until a navigator of any thread is added,
+/// removed or switched, so that the map of navigators is looked up (under lock) only
+/// after such changes.
 
 TGeoNavigator *TGeoManager::GetCurrentNavigator() const
 {
-   TTHREAD_TLS(TGeoNavigator*) tnav = 0;
    if (!fMultiThread) return fCurrentNavigator;
-   TGeoNavigator *nav = tnav; // TTHREAD_TLS_GET(TGeoNavigator*,tnav);
-   if (nav) return nav;
-   std::thread::id threadId = std::this_thread::get_id();
-   NavigatorsMap_t::const_iterator it = fNavigators.find(threadId);
-   if (it == fNavigators.end()) return 0;
-   TGeoNavigatorArray *array = it->second;
-   nav = array->GetCurrentNavigator();
-   tnav = nav; // TTHREAD_TLS_SET(TGeoNavigator*,tnav,nav);
+   struct NavigatorCache_t {
+      const TGeoManager *fManager = nullptr;
+      Long64_t fGeneration = -1;
+      TGeoNavigator *fNavigator = nullptr;
+   };
+   TTHREAD_TLS(NavigatorCache_t) cache;
+   // The generation is read before the lookup, a concurrent change forces a new lookup at the next call
+   const Long64_t generation = fgNavigatorsGeneration.load(std::memory_order_acquire);
+   if (cache.fManager == this && cache.fGeneration == generation) return cache.fNavigator;
+   TGeoNavigator *nav = 0;
+   {
+      std::lock_guard<std::mutex> lock(fgMutex);
+      NavigatorsMap_t::const_iterator it = fNavigators.find(std::this_thread::get_id());
+      if (it != fNavigators.end()) nav = it->second->GetCurrentNavigator();
+   }
+   cache.fManager = this;
+   cache.fGeneration = generation;
+   cache.fNavigator = nav;
    return nav;
 }
 
@@ -755,6 +777,8 @@ TGeoNavigator *TGeoManager::GetCurrentNavigator() const
 
 TGeoNavigatorArray *TGeoManager::GetListOfNavigators() const
 {
+   std::unique_lock<std::mutex> lock(fgMutex, std::defer_lock);
+   if (fMultiThread) lock.lock();
    std::thread::id threadId = std::this_thread::get_id();
    NavigatorsMap_t::const_iterator it = fNavigators.find(threadId);
    if (it == fNavigators.end()) return 0;
@@ -768,14 +792,19 @@ TGeoNavigatorArray *TGeoManager::GetListOfNavigators() const
 Bool_t TGeoManager::SetCurrentNavigator(Int_t index)
 {
    std::thread::id threadId = std::this_thread::get_id();
+   std::unique_lock<std::mutex> lock(fgMutex, std::defer_lock);
+   if (fMultiThread) lock.lock();
    NavigatorsMap_t::const_iterator it = fNavigators.find(threadId);
    if (it == fNavigators.end()) {
+      if (lock.owns_lock()) lock.unlock();
       Error("SetCurrentNavigator", "No navigator defined for this thread\n");
       std::cout << "  thread id: " << threadId << std::endl;
       return kFALSE;
    }
    TGeoNavigatorArray *array = it->second;
    TGeoNavigator *nav = array->SetCurrentNavigator(index);
+   fgNavigatorsGeneration++;
+   if (lock.owns_lock()) lock.unlock();
    if (!nav) {
       Error("SetCurrentNavigator", "Navigator %d not existing for this thread\n", index);
       std::cout << "  thread id: " << threadId << std::endl;
@@ -806,6 +835,7 @@ void TGeoManager::ClearNavigators()
       if (arr) delete arr;
    }
    fNavigators.clear();
+   fgNavigatorsGeneration++;
    if (fMultiThread) fgMutex.unlock();
 }
 
@@ -821,6 +851,7 @@ void TGeoManager::RemoveNavigator(const TGeoNavigator *nav)
          if ((TGeoNavigator*)arr->Remove((TObject*)nav)) {
             delete nav;
             if (!arr->GetEntries()) fNavigators.erase(it);
+            fgNavigatorsGeneration++;
             if (fMultiThread) fgMutex.unlock();
             return;
          }
@@ -892,32 +923,41 @@ void TGeoManager::CreateThreadData() const
 void TGeoManager::ClearThreadsMap()
 {
    if (gGeoManager && !gGeoManager->IsMultiThread()) return;
-   fgMutex.lock();
+   std::lock_guard<std::mutex> lock(fgThreadIdMutex);
    if (!fgThreadId->empty()) fgThreadId->clear();
    fgNumThreads = 0;
-   fgMutex.unlock();
+   fgThreadsGeneration++;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 /// Translates the current thread id to an ordinal number. This can be used to
-/// manage data which is specific for a given thread.
+/// manage data which is specific for a given thread. The number is cached per
+/// thread until the map of threads is cleared.
 
 Int_t TGeoManager::ThreadId()
 {
-   TTHREAD_TLS(Int_t) tid = -1;
-   Int_t ttid = tid; // TTHREAD_TLS_GET(Int_t,tid);
-   if (ttid > -1) return ttid;
+   struct ThreadIdCache_t {
+      Long64_t fGeneration = -1;
+      Int_t fId = -1;
+   };
+   TTHREAD_TLS(ThreadIdCache_t) cache;
+   const Long64_t generation = fgThreadsGeneration.load(std::memory_order_acquire);
+   if (cache.fGeneration == generation) return cache.fId;
    if (gGeoManager && !gGeoManager->IsMultiThread()) return 0;
    std::thread::id threadId = std::this_thread::get_id();
-   TGeoManager::ThreadsMapIt_t it = fgThreadId->find(threadId);
-   if (it != fgThreadId->end()) return it->second;
-   // Map needs to be updated.
-   fgMutex.lock();
-   (*fgThreadId)[threadId] = fgNumThreads;
-   tid = fgNumThreads; // TTHREAD_TLS_SET(Int_t,tid,fgNumThreads);
-   ttid = fgNumThreads++;
-   fgMutex.unlock();
-   return ttid;
+   std::lock_guard<std::mutex> lock(fgThreadIdMutex);
+   TGeoManager::ThreadsMap_t::iterator it = fgThreadId->find(threadId);
+   Int_t tid;
+   if (it != fgThreadId->end()) {
+      tid = it->second;
+   } else {
+      // Map needs to be updated.
+      tid = fgNumThreads++;
+      (*fgThreadId)[threadId] = tid;
+   }
+   cache.fGeneration = generation;
+   cache.fId = tid;
+   return tid;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -1356,6 +1396,11 @@ void TGeoManager::ClearAttributes()
 /// with negative parameters (run-time shapes)building the cache manager,
 /// voxelizing all volumes, counting the total number of physical nodes and
 /// registering the manager class to the browser.
+///
+/// The volumes are voxelized in parallel when implicit multi-threading is
+/// enabled. To avoid the voxelization at every job start, export the closed
+/// geometry with the voxels (option "v" of Export()): when reading it back, only
+/// the volumes without valid voxels are voxelized.
 
 void TGeoManager::CloseGeometry(Option_t *option)
 {
@@ -2888,21 +2933,50 @@ void TGeoManager::RestoreMasterVolume()
 }
 
 ////////////////////////////////////////////////////////////////////////////////
-/// Voxelize all non-divided volumes.
+/// Voxelize all non-divided volumes. If the voxels were retrieved from file,
+/// only the volumes without valid voxels are voxelized. The voxelization of the
+/// volumes runs in parallel if implicit multi-threading is enabled.
 
 void TGeoManager::Voxelize(Option_t *option)
 {
    TGeoVolume *vol;
-//   TGeoVoxelFinder *vox = 0;
    if (!fStreamVoxels && fgVerboseLevel>0) Info("Voxelize","Voxelizing...");
-//   Int_t nentries = fVolumes->GetSize();
+   std::vector<TGeoVolume *> tovoxelize;
    TIter next(fVolumes);
    while ((vol = (TGeoVolume*)next())) {
       if (!fIsGeomReading) vol->SortNodes();
-      if (!fStreamVoxels) {
-         vol->Voxelize(option);
+      if (fStreamVoxels) {
+         TGeoVoxelFinder *voxels = vol->GetVoxels();
+         if (!vol->GetNdaughters() || vol->GetFinder() || (voxels && !voxels->NeedRebuild())) continue;
       }
-      if (!fIsGeomReading) vol->FindOverlaps();
+      tovoxelize.push_back(vol);
+   }
+   if (fStreamVoxels && !tovoxelize.empty() && fgVerboseLevel>0)
+      Info("Voxelize","Voxelizing %d volumes without voxels from file...", (Int_t)tovoxelize.size());
+   auto voxelize = [&](Int_t i) { tovoxelize[i]->Voxelize(option); };
+   Bool_t done = kFALSE;
+#ifdef R__USE_IMT
+   if (ROOT::IsImplicitMTEnabled() && tovoxelize.size() > 1) {
+      // The bounding boxes of assemblies are computed on demand and shared by all
+      // their mother volumes: compute them before voxelizing concurrently
+      for (auto v : tovoxelize) {
+         if (v->IsAssembly()) v->GetShape()->ComputeBBox();
+         for (Int_t i=0; i<v->GetNdaughters(); i++) {
+            TGeoVolume *vd = v->GetNode(i)->GetVolume();
+            if (vd->IsAssembly()) vd->GetShape()->ComputeBBox();
+         }
+      }
+      ROOT::TThreadExecutor pool;
+      pool.Foreach(voxelize, ROOT::TSeq<Int_t>(0, tovoxelize.size()));
+      done = kTRUE;
+   }
+#endif
+   if (!done) {
+      for (Int_t i=0; i<(Int_t)tovoxelize.size(); i++) voxelize(i);
+   }
+   // Overlaps are stored in the nodes, which can be shared by several volumes
+   if (!fIsGeomReading) {
+      for (auto v : tovoxelize) v->FindOverlaps();
    }
 }
 
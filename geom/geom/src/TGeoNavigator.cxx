@@ -1114,6 +1114,32 @@ TGeoNode *TGeoNavigator::FindNextDaughterBoundary(Double_t *point, Double_t *dir
    return nodefound;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Basket version of FindNextBoundaryAndStep() for ntracks tracks given by their points
+/// and directions in MARS, as (x,y,z) triplets. Each track is located starting from the
+/// location of the previous one, then propagated to its next boundary within stepmax[i]
+/// (no limit if stepmax is null). The propagated points are written back to points, the
+/// steps to steps and the nodes reached to nodes. If compsafe is set, the safeties at the
+/// start points are filled in safeties, when given.
+///
+/// The navigator keeps a single state, so tracks are still transported one after the
+/// other; spatially coherent baskets, e.g. sorted by volume, benefit from the cheaper
+/// relocation. The navigator is left at the last propagated point.
+
+void TGeoNavigator::FindNextBoundaryAndStep_v(Int_t ntracks, Double_t *points, const Double_t *dirs,
+                                              const Double_t *stepmax, Double_t *steps, TGeoNode **nodes,
+                                              Bool_t compsafe, Double_t *safeties)
+{
+   for (Int_t i=0; i<ntracks; i++) {
+      FindNode(points[3*i], points[3*i+1], points[3*i+2]);
+      SetCurrentDirection(&dirs[3*i]);
+      nodes[i] = FindNextBoundaryAndStep(stepmax ? stepmax[i] : TGeoShape::Big(), compsafe);
+      steps[i] = fStep;
+      if (compsafe && safeties) safeties[i] = fSafety;
+      memcpy(&points[3*i], fPoint, kN3);
+   }
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Compute distance to next boundary within STEPMAX. If no boundary is found,
 /// propagate current point along current direction with fStep=STEPMAX. Otherwise
@@ -1519,6 +1545,18 @@ TGeoNode *TGeoNavigator::FindNode(Double_t x, Double_t y, Double_t z)
    return found;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Locate a basket of points given in MARS as (x,y,z) triplets and fill the deepest
+/// node containing each of them in nodes. The search for each point starts from the
+/// location of the previous one, so that baskets of nearby points are located faster
+/// than from the top volume. The navigator is left at the last point.
+
+void TGeoNavigator::FindNode_v(Int_t npoints, const Double_t *points, TGeoNode **nodes)
+{
+   for (Int_t i=0; i<npoints; i++)
+      nodes[i] = FindNode(points[3*i], points[3*i+1], points[3*i+2]);
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Computes fast normal to next crossed boundary, assuming that the current point
 /// is close enough to the boundary. Works only after calling FindNextBoundary.
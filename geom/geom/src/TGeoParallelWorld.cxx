@@ -21,6 +21,8 @@ volume of the main geometry.
 the parallel world which acts as a navigation helper in this parallel
 world. The parallel world has to be closed before calling any navigation
 method.
+
+  Safety queries can be accelerated by a precomputed grid, see BuildSafetyGrid().
 */
 
 #include "TGeoParallelWorld.h"
@@ -31,6 +33,16 @@ method.
 #include "TGeoMatrix.h"
 #include "TGeoPhysicalNode.h"
 #include "TGeoNavigator.h"
+#include "TGeoBBox.h"
+#include "TMath.h"
+#include "TROOT.h"
+
+#ifdef R__USE_IMT
+#include "ROOT/TThreadExecutor.hxx"
+#include "ROOT/TSeq.hxx"
+#endif
+
+#include <cmath>
 
 ClassImp(TGeoParallelWorld);
 
@@ -45,7 +57,10 @@ TGeoParallelWorld::TGeoParallelWorld(const char *name, TGeoManager *mgr)
                     fIsClosed(kFALSE),
                     fVolume(0),
                     fLastState(0),
-                    fPhysical(new TObjArray(256))
+                    fPhysical(new TObjArray(256)),
+                    fSafetyNbins{0, 0, 0},
+                    fSafetyMin{0., 0., 0.},
+                    fSafetyCell{0., 0., 0.}
 {
 }
 
@@ -156,6 +171,11 @@ Bool_t TGeoParallelWorld::CloseGeometry()
 
 void TGeoParallelWorld::RefreshPhysicalNodes()
 {
+   // The safety grid is kept when closing a parallel world read from a file, but not after re-alignment
+   if (fIsClosed && HasSafetyGrid()) {
+      Info("RefreshPhysicalNodes", "Clearing the safety grid of %s, call BuildSafetyGrid() to rebuild it", GetName());
+      ClearSafetyGrid();
+   }
    delete fVolume;
    fVolume = new TGeoVolumeAssembly(GetName());
    fGeoManager->GetListOfVolumes()->Remove(fVolume);
@@ -306,11 +326,16 @@ Double_t TGeoParallelWorld::Safety(Double_t point[3], Double_t safmax)
    if (fLastState && fLastState->IsMatchingState(nav)) return TGeoShape::Big();
    // Fast return if not in an overlapping candidate
    if (fUseOverlaps && !nav->GetCurrentVolume()->IsOverlappingCandidate()) return TGeoShape::Big();
+   const Double_t tolerance = TGeoShape::Tolerance();
+   // Fast return if the point is safely away from all nodes according to the grid
+   if (HasSafetyGrid()) {
+      Double_t safgrid = SafetyFromGrid(point);
+      if (safgrid > tolerance) return TMath::Min(safgrid, safmax);
+   }
    Double_t local[3];
    Double_t safe = safmax;
    Double_t safnext;
    TGeoPhysicalNode *pnode = 0;
-   const Double_t tolerance = TGeoShape::Tolerance();
    Int_t nd = fVolume->GetNdaughters();
    TGeoNode *current;
    TGeoVoxelFinder *voxels = fVolume->GetVoxels();
@@ -342,6 +367,124 @@ Double_t TGeoParallelWorld::Safety(Double_t point[3], Double_t safmax)
    return safe;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Safety from a point in the master frame to the closest node of the parallel world,
+/// regardless of the navigation state. Returns 0 for a point inside a node.
+
+Double_t TGeoParallelWorld::SafetyToNodes(const Double_t *point) const
+{
+   Double_t local[3];
+   Double_t safe = TGeoShape::Big();
+   Int_t nd = fVolume->GetNdaughters();
+   Double_t *boxes = fVolume->GetVoxels()->GetBoxes();
+   for (Int_t id=0; id<nd; id++) {
+      // The distance to the bounding box of the node is a lower bound of its safety
+      Int_t ist = 6*id;
+      Double_t dxyz = 0.;
+      for (Int_t i=0; i<3; i++) {
+         Double_t d = TMath::Abs(point[i]-boxes[ist+3+i])-boxes[ist+i];
+         if (d>0) dxyz += d*d;
+      }
+      if (dxyz >= safe*safe) continue;
+      TGeoNode *current = fVolume->GetNode(id);
+      current->MasterToLocal(point, local);
+      Double_t safnext = current->Safety(local, kFALSE);
+      if (safnext <= 0) return 0.;
+      if (safnext < safe) safe = safnext;
+   }
+   return safe;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Conservative safety from the grid: the safety at the center of the cell containing
+/// the point minus the distance to the center. Returns 0 outside the grid.
+
+Double_t TGeoParallelWorld::SafetyFromGrid(const Double_t *point) const
+{
+   Int_t index[3];
+   Double_t dist2 = 0.;
+   for (Int_t i=0; i<3; i++) {
+      Double_t u = (point[i]-fSafetyMin[i])/fSafetyCell[i];
+      if (!(u >= 0) || u >= fSafetyNbins[i]) return 0.;
+      index[i] = TMath::Min(Int_t(u), fSafetyNbins[i]-1);
+      Double_t d = point[i] - (fSafetyMin[i] + (index[i]+0.5)*fSafetyCell[i]);
+      dist2 += d*d;
+   }
+   Int_t icell = index[0] + fSafetyNbins[0]*(index[1] + fSafetyNbins[1]*index[2]);
+   return fSafetyGrid[icell] - TMath::Sqrt(dist2);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Build a grid of nx*ny*nz cells covering the top volume of the main geometry, holding
+/// the safety to the parallel world nodes at the cell centers. Safety() then answers in
+/// constant time with the conservative value given by the cell containing the point,
+/// falling back to the computation over the nodes only close to them. The parallel world
+/// must be closed.
+///
+/// The grid is written with the geometry and used again when reading it back; it is
+/// cleared when the physical nodes are refreshed after re-alignment. The cells are filled
+/// in parallel if implicit multi-threading is enabled and the geometry is set up for
+/// more threads than the thread pool has (see TGeoManager::SetMaxThreads).
+
+Bool_t TGeoParallelWorld::BuildSafetyGrid(Int_t nx, Int_t ny, Int_t nz)
+{
+   if (!fIsClosed) {
+      Error("BuildSafetyGrid", "Parallel geometry must be closed first");
+      return kFALSE;
+   }
+   if (nx<1 || ny<1 || nz<1) {
+      Error("BuildSafetyGrid", "Invalid number of cells %d x %d x %d", nx, ny, nz);
+      return kFALSE;
+   }
+   TGeoBBox *box = (TGeoBBox*)fGeoManager->GetTopVolume()->GetShape();
+   const Double_t *origin = box->GetOrigin();
+   const Double_t halfSize[3] = {box->GetDX(), box->GetDY(), box->GetDZ()};
+   const Int_t nbins[3] = {nx, ny, nz};
+   for (Int_t i=0; i<3; i++) {
+      fSafetyNbins[i] = nbins[i];
+      fSafetyMin[i] = origin[i] - halfSize[i];
+      fSafetyCell[i] = 2.*halfSize[i]/nbins[i];
+   }
+   fSafetyGrid.assign(nx*ny*nz, 0.);
+
+   auto fillSlice = [&](Int_t iz) {
+      Double_t point[3];
+      point[2] = fSafetyMin[2] + (iz+0.5)*fSafetyCell[2];
+      for (Int_t iy=0; iy<ny; iy++) {
+         point[1] = fSafetyMin[1] + (iy+0.5)*fSafetyCell[1];
+         for (Int_t ix=0; ix<nx; ix++) {
+            point[0] = fSafetyMin[0] + (ix+0.5)*fSafetyCell[0];
+            Double_t safe = SafetyToNodes(point);
+            // Round down so that the stored value stays conservative
+            Float_t fsafe = safe;
+            if (fsafe > safe) fsafe = std::nextafter(fsafe, 0.f);
+            fSafetyGrid[ix + nx*(iy + ny*iz)] = fsafe;
+         }
+      }
+   };
+#ifdef R__USE_IMT
+   // Shapes keep per-thread navigation data, indexed by TGeoManager::ThreadId()
+   if (ROOT::IsImplicitMTEnabled() && fGeoManager->IsMultiThread() &&
+       Int_t(ROOT::GetThreadPoolSize()) < fGeoManager->GetMaxThreads()) {
+      ROOT::TThreadExecutor pool;
+      pool.Foreach(fillSlice, ROOT::TSeq<Int_t>(0, nz));
+      return kTRUE;
+   }
+#endif
+   for (Int_t iz=0; iz<nz; iz++) fillSlice(iz);
+   return kTRUE;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Remove the safety grid
+
+void TGeoParallelWorld::ClearSafetyGrid()
+{
+   fSafetyGrid.clear();
+   fSafetyGrid.shrink_to_fit();
+   for (Int_t i=0; i<3; i++) fSafetyNbins[i] = 0;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Check overlaps within a tolerance value.
 
@@ -14,8 +14,13 @@
 \ingroup Geometry_classes
 
 Tessellated solid class. It is composed by a set of planar faces having triangular or
-quadrilateral shape. The class does not provide navigation functionality, it just wraps the data
-for the composing faces.
+quadrilateral shape.
+
+Navigation queries (Contains, DistFromInside, DistFromOutside, Safety and ComputeNormal) use a
+bounding volume hierarchy of the facets built by CloseShape(), so their cost grows logarithmically
+with the number of facets. A point is considered inside when the nearest facet crossed by a ray
+leaving it is oriented outwards, so the queries need a closed body with consistently oriented
+facets (see CheckClosure()). Quadrilateral facets are assumed to be planar and convex.
 */
 
 #include <iostream>
@@ -30,13 +35,152 @@ for the composing faces.
 #include "TBuffer3DTypes.h"
 #include "TMath.h"
 
+#include <algorithm>
 #include <array>
+#include <cmath>
 #include <vector>
 
 ClassImp(TGeoTessellated)
 
    using Vertex_t = Tessellated::Vertex_t;
 
+namespace {
+
+/// Maximum number of facets in a leaf of the bounding volume hierarchy
+constexpr int kMaxFacetsPerLeaf = 4;
+/// Size of the fixed traversal stack buffers, larger than the depth of the balanced hierarchy of any realistic shape
+constexpr int kMaxStackSize = 128;
+
+////////////////////////////////////////////////////////////////////////////////
+/// Stack of the hierarchy nodes still to visit, with their distance. Uses a fixed-size buffer and only moves
+/// to the heap for (degenerate) hierarchies that are deeper than the buffer.
+
+class NodeStack {
+   std::array<std::pair<int, double>, kMaxStackSize> fBuffer;
+   std::vector<std::pair<int, double>> fHeap;
+   std::pair<int, double> *fData = fBuffer.data();
+   size_t fSize = 0;
+   size_t fCapacity = kMaxStackSize;
+
+   void Grow()
+   {
+      if (fHeap.empty())
+         fHeap.assign(fBuffer.begin(), fBuffer.end());
+      fHeap.resize(2 * fCapacity);
+      fData = fHeap.data();
+      fCapacity = fHeap.size();
+   }
+
+public:
+   bool Empty() const { return fSize == 0; }
+   void Push(int inode, double dist)
+   {
+      if (fSize == fCapacity)
+         Grow();
+      fData[fSize++] = {inode, dist};
+   }
+   std::pair<int, double> Pop() { return fData[--fSize]; }
+};
+
+////////////////////////////////////////////////////////////////////////////////
+/// Distance along the ray to the triangle (v0, v1, v2), -Big() if the triangle is missed (Moller-Trumbore).
+/// Points on the edges are considered as crossing, so that a ray cannot leak between neighbour facets.
+
+double RayTriangle(const Vertex_t &point, const Vertex_t &dir, const Vertex_t &v0, const Vertex_t &v1,
+                   const Vertex_t &v2)
+{
+   constexpr double kEdgeTolerance = 1.e-12;
+   const Vertex_t e1 = v1 - v0;
+   const Vertex_t e2 = v2 - v0;
+   const Vertex_t p = Vertex_t::Cross(dir, e2);
+   const double det = e1.Dot(p);
+   if (std::abs(det) < 1.e-30)
+      return -TGeoShape::Big();
+   const double invDet = 1. / det;
+   const Vertex_t s = point - v0;
+   const double u = s.Dot(p) * invDet;
+   if (u < -kEdgeTolerance || u > 1. + kEdgeTolerance)
+      return -TGeoShape::Big();
+   const Vertex_t q = Vertex_t::Cross(s, e1);
+   const double v = dir.Dot(q) * invDet;
+   if (v < -kEdgeTolerance || u + v > 1. + kEdgeTolerance)
+      return -TGeoShape::Big();
+   return e2.Dot(q) * invDet;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Squared distance from the point p to the triangle (a, b, c), from the closest point algorithm of
+/// C. Ericson, Real-Time Collision Detection.
+
+double PointTriangleDist2(const Vertex_t &p, const Vertex_t &a, const Vertex_t &b, const Vertex_t &c)
+{
+   const Vertex_t ab = b - a;
+   const Vertex_t ac = c - a;
+   const Vertex_t ap = p - a;
+   const double d1 = ab.Dot(ap);
+   const double d2 = ac.Dot(ap);
+   if (d1 <= 0. && d2 <= 0.)
+      return ap.Mag2();
+   const Vertex_t bp = p - b;
+   const double d3 = ab.Dot(bp);
+   const double d4 = ac.Dot(bp);
+   if (d3 >= 0. && d4 <= d3)
+      return bp.Mag2();
+   const double vc = d1 * d4 - d3 * d2;
+   if (vc <= 0. && d1 >= 0. && d3 <= 0.)
+      return (ap - (d1 / (d1 - d3)) * ab).Mag2();
+   const Vertex_t cp = p - c;
+   const double d5 = ab.Dot(cp);
+   const double d6 = ac.Dot(cp);
+   if (d6 >= 0. && d5 <= d6)
+      return cp.Mag2();
+   const double vb = d5 * d2 - d1 * d6;
+   if (vb <= 0. && d2 >= 0. && d6 <= 0.)
+      return (ap - (d2 / (d2 - d6)) * ac).Mag2();
+   const double va = d3 * d6 - d5 * d4;
+   if (va <= 0. && d4 - d3 >= 0. && d5 - d6 >= 0.)
+      return (bp - ((d4 - d3) / ((d4 - d3) + (d5 - d6))) * (c - b)).Mag2();
+   const double denom = 1. / (va + vb + vc);
+   return (ap - (vb * denom) * ab - (vc * denom) * ac).Mag2();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Distance along the ray to the entry in the box, Big() if the box is missed within [0, stepmax].
+/// The inverse direction components are infinite for null direction components.
+
+double RayBox(const double *point, const double *invdir, const double *bmin, const double *bmax, double stepmax)
+{
+   double tmin = 0.;
+   double tmax = stepmax;
+   for (int i = 0; i < 3; ++i) {
+      double t1 = (bmin[i] - point[i]) * invdir[i];
+      double t2 = (bmax[i] - point[i]) * invdir[i];
+      if (t1 > t2)
+         std::swap(t1, t2);
+      // NaN values, for a point on the slab boundary and a null direction component, are ignored
+      tmin = std::max(tmin, t1);
+      tmax = std::min(tmax, t2);
+      if (tmin > tmax)
+         return TGeoShape::Big();
+   }
+   return tmin;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Squared distance from the point to the box
+
+double PointBoxDist2(const double *point, const double *bmin, const double *bmax)
+{
+   double dist2 = 0.;
+   for (int i = 0; i < 3; ++i) {
+      const double d = std::max({bmin[i] - point[i], 0., point[i] - bmax[i]});
+      dist2 += d * d;
+   }
+   return dist2;
+}
+
+} // anonymous namespace
+
 std::ostream &operator<<(std::ostream &os, TGeoFacet const &facet)
 {
    os << "{";
@@ -208,9 +352,11 @@ TGeoTessellated::TGeoTessellated(const char *name, const std::vector<Vertex_t> &
 void TGeoTessellated::AfterStreamer()
 {
    // The pointer to the array of vertices is not streamed so update it to facets
-   for (auto facet : fFacets)
-      facet.SetVertices(&fVertices);
+   for (auto &facet : fFacets)
+      facet.SetVertices(&fVertices, facet.GetNvert(), facet.GetVertexIndex(0), facet.GetVertexIndex(1),
+                        facet.GetVertexIndex(2), facet.GetVertexIndex(3));
    fDefined = true;
+   BuildBVH();
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -332,14 +478,14 @@ void TGeoTessellated::CloseShape(bool check, bool fixFlipped, bool verbose)
 
    if (fVertices.size() > 0) {
       fDefined = true;
-      if (!check)
-         return;
-
-      // Check facets
-      for (auto &facet : fFacets) {
-         facet.Check();
+      if (check) {
+         // Check facets
+         for (auto &facet : fFacets) {
+            facet.Check();
+         }
+         fClosedBody = CheckClosure(fixFlipped, verbose);
       }
-      fClosedBody = CheckClosure(fixFlipped, verbose);
+      BuildBVH();
       return;
    }
 
@@ -411,15 +557,15 @@ void TGeoTessellated::CloseShape(bool check, bool fixFlipped, bool verbose)
    fNvert = fVertices.size();
    fNfacets = fFacets.size();
    fDefined = true;
-   if (!check)
-      return;
+   if (check) {
+      // Check facets
+      for (auto &facet : fFacets) {
+         facet.Check();
+      }
 
-   // Check facets
-   for (auto &facet : fFacets) {
-      facet.Check();
+      fClosedBody = CheckClosure(fixFlipped, verbose);
    }
-
-   fClosedBody = CheckClosure(fixFlipped, verbose);
+   BuildBVH();
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -511,6 +657,338 @@ void TGeoTessellated::ComputeBBox()
       fOrigin[i] = 0.5 * (vmax[i] + vmin[i]);
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Compute the facet normals and build the bounding volume hierarchy of the facets, splitting
+/// the nodes at the median facet center along their largest extent.
+
+void TGeoTessellated::BuildBVH()
+{
+   const int nfacets = fFacets.size();
+   const double kBig = TGeoShape::Big();
+   const double tolerance = TGeoShape::Tolerance();
+   std::vector<Vertex_t> centers(nfacets);
+   fOutwardNormals.resize(nfacets);
+   fBVHFacets.resize(nfacets);
+   fBVHNodes.clear();
+   for (int i = 0; i < nfacets; ++i) {
+      bool degenerated;
+      fOutwardNormals[i] = fFacets[i].ComputeNormal(degenerated);
+      for (int j = 0; j < fFacets[i].GetNvert(); ++j)
+         centers[i] += fFacets[i].GetVertex(j);
+      centers[i] /= fFacets[i].GetNvert();
+      fBVHFacets[i] = i;
+   }
+   if (nfacets == 0)
+      return;
+
+   fBVHNodes.reserve(2 * (nfacets / kMaxFacetsPerLeaf + 1));
+   fBVHNodes.emplace_back();
+   fBVHNodes[0].fNfacets = nfacets;
+   std::vector<int> tosplit{0};
+   while (!tosplit.empty()) {
+      const int inode = tosplit.back();
+      tosplit.pop_back();
+      const int first = fBVHNodes[inode].fFirst;
+      const int n = fBVHNodes[inode].fNfacets;
+      double cmin[3] = {kBig, kBig, kBig};
+      double cmax[3] = {-kBig, -kBig, -kBig};
+      auto &node = fBVHNodes[inode];
+      for (int j = 0; j < 3; ++j) {
+         node.fMin[j] = kBig;
+         node.fMax[j] = -kBig;
+      }
+      for (int i = first; i < first + n; ++i) {
+         const auto &facet = fFacets[fBVHFacets[i]];
+         for (int j = 0; j < 3; ++j) {
+            for (int k = 0; k < facet.GetNvert(); ++k) {
+               node.fMin[j] = std::min(node.fMin[j], facet.GetVertex(k)[j]);
+               node.fMax[j] = std::max(node.fMax[j], facet.GetVertex(k)[j]);
+            }
+            cmin[j] = std::min(cmin[j], centers[fBVHFacets[i]][j]);
+            cmax[j] = std::max(cmax[j], centers[fBVHFacets[i]][j]);
+         }
+      }
+      // Pad the boxes so that rays along the facets do not miss them
+      for (int j = 0; j < 3; ++j) {
+         node.fMin[j] -= tolerance;
+         node.fMax[j] += tolerance;
+      }
+      if (n <= kMaxFacetsPerLeaf)
+         continue;
+      int axis = 0;
+      for (int j = 1; j < 3; ++j) {
+         if (cmax[j] - cmin[j] > cmax[axis] - cmin[axis])
+            axis = j;
+      }
+      if (cmax[axis] - cmin[axis] <= 0.)
+         continue;
+
+      const int mid = first + n / 2;
+      std::nth_element(fBVHFacets.begin() + first, fBVHFacets.begin() + mid, fBVHFacets.begin() + first + n,
+                       [&](int a, int b) { return centers[a][axis] < centers[b][axis]; });
+      const int ichild = fBVHNodes.size();
+      fBVHNodes.resize(ichild + 2);
+      fBVHNodes[ichild].fFirst = first;
+      fBVHNodes[ichild].fNfacets = mid - first;
+      fBVHNodes[ichild + 1].fFirst = mid;
+      fBVHNodes[ichild + 1].fNfacets = first + n - mid;
+      fBVHNodes[inode].fFirst = ichild;
+      fBVHNodes[inode].fNfacets = 0;
+      tosplit.push_back(ichild);
+      tosplit.push_back(ichild + 1);
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Find the nearest facet crossed by the ray within stepmax. Only facets having the ray exiting
+/// (orientation > 0) or entering (orientation < 0) are considered, any facet for orientation = 0.
+/// Returns the facet index and its distance in dist, or -1 if no facet is crossed.
+
+int TGeoTessellated::FindCrossing(const double *point, const double *dir, int orientation, double stepmax,
+                                  double &dist) const
+{
+   int ifound = -1;
+   dist = stepmax;
+   if (fBVHNodes.empty())
+      return ifound;
+   const double tolerance = TGeoShape::Tolerance();
+   const Vertex_t pt(point[0], point[1], point[2]);
+   const Vertex_t vdir(dir[0], dir[1], dir[2]);
+   const double invdir[3] = {1. / dir[0], 1. / dir[1], 1. / dir[2]};
+
+   // The stack holds the nodes to visit with their entry distance, the nearest one on top
+   NodeStack stack;
+   const double troot = RayBox(point, invdir, fBVHNodes[0].fMin, fBVHNodes[0].fMax, dist);
+   if (troot < TGeoShape::Big())
+      stack.Push(0, troot);
+   while (!stack.Empty()) {
+      const auto current = stack.Pop();
+      if (current.second > dist)
+         continue;
+      const auto &node = fBVHNodes[current.first];
+      if (node.fNfacets == 0) {
+         int ichild[2] = {node.fFirst, node.fFirst + 1};
+         double tchild[2];
+         for (int i = 0; i < 2; ++i)
+            tchild[i] = RayBox(point, invdir, fBVHNodes[ichild[i]].fMin, fBVHNodes[ichild[i]].fMax, dist);
+         if (tchild[0] < tchild[1]) {
+            std::swap(ichild[0], ichild[1]);
+            std::swap(tchild[0], tchild[1]);
+         }
+         for (int i = 0; i < 2; ++i) {
+            if (tchild[i] < TGeoShape::Big())
+               stack.Push(ichild[i], tchild[i]);
+         }
+         continue;
+      }
+      for (int i = node.fFirst; i < node.fFirst + node.fNfacets; ++i) {
+         const int ifacet = fBVHFacets[i];
+         const double cosa = fOutwardNormals[ifacet].Dot(vdir);
+         if ((orientation > 0 && cosa <= 0.) || (orientation < 0 && cosa >= 0.))
+            continue;
+         const auto &facet = fFacets[ifacet];
+         for (int k = 1; k < facet.GetNvert() - 1; ++k) {
+            const double t = RayTriangle(pt, vdir, facet.GetVertex(0), facet.GetVertex(k), facet.GetVertex(k + 1));
+            if (t >= -tolerance && t < dist) {
+               dist = t;
+               ifound = ifacet;
+            }
+         }
+      }
+   }
+   if (ifound >= 0)
+      dist = std::max(dist, 0.);
+   return ifound;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Find the facet closest to the point. Returns the facet index and its distance in dist,
+/// or -1 for a shape without facets.
+
+int TGeoTessellated::FindClosestFacet(const double *point, double &dist) const
+{
+   int ifound = -1;
+   dist = TGeoShape::Big();
+   if (fBVHNodes.empty())
+      return ifound;
+   const Vertex_t pt(point[0], point[1], point[2]);
+   double dist2 = TGeoShape::Big();
+
+   NodeStack stack;
+   stack.Push(0, PointBoxDist2(point, fBVHNodes[0].fMin, fBVHNodes[0].fMax));
+   while (!stack.Empty()) {
+      const auto current = stack.Pop();
+      if (current.second >= dist2)
+         continue;
+      const auto &node = fBVHNodes[current.first];
+      if (node.fNfacets == 0) {
+         int ichild[2] = {node.fFirst, node.fFirst + 1};
+         double dchild[2];
+         for (int i = 0; i < 2; ++i)
+            dchild[i] = PointBoxDist2(point, fBVHNodes[ichild[i]].fMin, fBVHNodes[ichild[i]].fMax);
+         if (dchild[0] < dchild[1]) {
+            std::swap(ichild[0], ichild[1]);
+            std::swap(dchild[0], dchild[1]);
+         }
+         for (int i = 0; i < 2; ++i) {
+            if (dchild[i] < dist2)
+               stack.Push(ichild[i], dchild[i]);
+         }
+         continue;
+      }
+      for (int i = node.fFirst; i < node.fFirst + node.fNfacets; ++i) {
+         const auto &facet = fFacets[fBVHFacets[i]];
+         for (int k = 1; k < facet.GetNvert() - 1; ++k) {
+            const double d2 =
+               PointTriangleDist2(pt, facet.GetVertex(0), facet.GetVertex(k), facet.GetVertex(k + 1));
+            if (d2 < dist2) {
+               dist2 = d2;
+               ifound = fBVHFacets[i];
+            }
+         }
+      }
+   }
+   dist = std::sqrt(dist2);
+   return ifound;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Test if point is inside this shape: the nearest facet crossed by a ray leaving an
+/// inside point is exiting the solid.
+
+Bool_t TGeoTessellated::Contains(const Double_t *point) const
+{
+   if (!TGeoBBox::Contains(point))
+      return kFALSE;
+   // The direction is skewed to avoid running along the facets of axis-aligned shapes
+   static const Double_t dir[3] = {1. / std::sqrt(14.), 2. / std::sqrt(14.), 3. / std::sqrt(14.)};
+   Double_t dist;
+   const int ifacet = FindCrossing(point, dir, 0, TGeoShape::Big(), dist);
+   return ifacet >= 0 && fOutwardNormals[ifacet].Dot(Vertex_t(dir[0], dir[1], dir[2])) > 0.;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Check the inside status for each of the points in the array.
+
+void TGeoTessellated::Contains_v(const Double_t *points, Bool_t *inside, Int_t vecsize) const
+{
+   for (Int_t i = 0; i < vecsize; i++)
+      inside[i] = Contains(&points[3 * i]);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Compute normal to the closest facet from POINT, oriented along DIR.
+
+void TGeoTessellated::ComputeNormal(const Double_t *point, const Double_t *dir, Double_t *norm)
+{
+   Double_t dist;
+   const int ifacet = FindClosestFacet(point, dist);
+   if (ifacet < 0) {
+      TGeoBBox::ComputeNormal(point, dir, norm);
+      return;
+   }
+   fOutwardNormals[ifacet].CopyTo(norm);
+   if (norm[0] * dir[0] + norm[1] * dir[1] + norm[2] * dir[2] < 0) {
+      for (int i = 0; i < 3; ++i)
+         norm[i] = -norm[i];
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Compute the normal for an array o points so that norm.dot.dir is positive
+
+void TGeoTessellated::ComputeNormal_v(const Double_t *points, const Double_t *dirs, Double_t *norms, Int_t vecsize)
+{
+   for (Int_t i = 0; i < vecsize; i++)
+      ComputeNormal(&points[3 * i], &dirs[3 * i], &norms[3 * i]);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Compute distance from inside point to the surface, which is the distance to the nearest
+/// facet crossed outwards. Returns 0 if there is no such facet, i.e. the point is outside.
+
+Double_t TGeoTessellated::DistFromInside(const Double_t *point, const Double_t *dir, Int_t iact, Double_t step,
+                                         Double_t *safe) const
+{
+   if (iact < 3 && safe) {
+      *safe = Safety(point, kTRUE);
+      if (iact == 0)
+         return TGeoShape::Big();
+      if (iact == 1 && step < *safe)
+         return TGeoShape::Big();
+   }
+   Double_t dist;
+   if (FindCrossing(point, dir, 1, TGeoShape::Big(), dist) < 0)
+      return 0.;
+   return dist;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Compute distance from array of input points having directions specified by dirs. Store output in dists
+
+void TGeoTessellated::DistFromInside_v(const Double_t *points, const Double_t *dirs, Double_t *dists, Int_t vecsize,
+                                       Double_t *step) const
+{
+   for (Int_t i = 0; i < vecsize; i++)
+      dists[i] = DistFromInside(&points[3 * i], &dirs[3 * i], 3, step[i]);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Compute distance from outside point to the surface, which is the distance to the nearest
+/// facet crossed inwards. Returns Big() if the shape is not hit within step.
+
+Double_t TGeoTessellated::DistFromOutside(const Double_t *point, const Double_t *dir, Int_t iact, Double_t step,
+                                          Double_t *safe) const
+{
+   if (iact < 3 && safe) {
+      *safe = Safety(point, kFALSE);
+      if (iact == 0)
+         return TGeoShape::Big();
+      if (iact == 1 && step < *safe)
+         return TGeoShape::Big();
+   }
+   // Check the bounding box first
+   if (TGeoBBox::DistFromOutside(point, dir, fDX, fDY, fDZ, fOrigin, step) >= TGeoShape::Big())
+      return TGeoShape::Big();
+   Double_t dist;
+   if (FindCrossing(point, dir, -1, step, dist) < 0)
+      return TGeoShape::Big();
+   return dist;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Compute distance from array of input points having directions specified by dirs. Store output in dists
+
+void TGeoTessellated::DistFromOutside_v(const Double_t *points, const Double_t *dirs, Double_t *dists,
+                                        Int_t vecsize, Double_t *step) const
+{
+   for (Int_t i = 0; i < vecsize; i++)
+      dists[i] = DistFromOutside(&points[3 * i], &dirs[3 * i], 3, step[i]);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Computes the closest distance from given point to the facets. The inside flag is not
+/// used, the distance is the same on both sides.
+
+Double_t TGeoTessellated::Safety(const Double_t *point, Bool_t) const
+{
+   Double_t dist;
+   if (FindClosestFacet(point, dist) < 0)
+      return 0.;
+   return dist;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Compute safe distance from each of the points in the input array.
+/// Input: Array of point coordinates, array of statuses for these points, size of the arrays
+/// Output: Safety values
+
+void TGeoTessellated::Safety_v(const Double_t *points, const Bool_t *inside, Double_t *safe, Int_t vecsize) const
+{
+   for (Int_t i = 0; i < vecsize; i++)
+      safe[i] = Safety(&points[3 * i], inside[i]);
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Returns numbers of vertices, segments and polygons composing the shape mesh.
 
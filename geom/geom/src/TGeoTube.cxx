@@ -1200,7 +1200,18 @@ const TBuffer3D & TGeoTube::GetBuffer3D(Int_t reqSections, Bool_t localFrame) co
 
 void TGeoTube::Contains_v(const Double_t *points, Bool_t *inside, Int_t vecsize) const
 {
-   for (Int_t i=0; i<vecsize; i++) inside[i] = Contains(&points[3*i]);
+   // Derived shapes not overriding the vector methods use their scalar methods
+   if (IsA() != TGeoTube::Class()) {
+      for (Int_t i=0; i<vecsize; i++) inside[i] = Contains(&points[3*i]);
+      return;
+   }
+   // Branch-free loop, vectorizable by the compiler
+   const Double_t rmin2 = fRmin*fRmin, rmax2 = fRmax*fRmax, dz = fDz;
+   for (Int_t i=0; i<vecsize; i++) {
+      const Double_t *point = &points[3*i];
+      const Double_t r2 = point[0]*point[0]+point[1]*point[1];
+      inside[i] = (TMath::Abs(point[2]) <= dz) & (r2 >= rmin2) & (r2 <= rmax2);
+   }
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -1218,7 +1229,50 @@ void TGeoTube::ComputeNormal_v(const Double_t *points, const Double_t *dirs, Dou
 
 void TGeoTube::DistFromInside_v(const Double_t *points, const Double_t *dirs, Double_t *dists, Int_t vecsize, Double_t* step) const
 {
-   for (Int_t i=0; i<vecsize; i++) dists[i] = DistFromInside(&points[3*i], &dirs[3*i], 3, step[i]);
+   if (IsA() != TGeoTube::Class()) {
+      for (Int_t i=0; i<vecsize; i++) dists[i] = DistFromInside(&points[3*i], &dirs[3*i], 3, step[i]);
+      return;
+   }
+   // Branch-free version of DistFromInsideS(), giving the same results: the first condition
+   // met in the order of the scalar algorithm sets the distance
+   const Double_t tolerance = TGeoShape::Tolerance();
+   const Double_t rmin2 = fRmin*fRmin, rmax2 = fRmax*fRmax;
+   const Bool_t hasRmin = (fRmin > 0);
+   for (Int_t i=0; i<vecsize; i++) {
+      const Double_t *point = &points[3*i];
+      const Double_t *dir = &dirs[3*i];
+      Double_t snxt = 0.;
+      Bool_t done = kFALSE;
+      auto setIf = [&](Bool_t condition, Double_t value) {
+         snxt = (!done && condition) ? value : snxt;
+         done |= condition;
+      };
+      // Z planes
+      const Bool_t hasDirZ = (dir[2] != 0);
+      const Double_t sz = hasDirZ ? (TMath::Sign(fDz, dir[2])-point[2])/(hasDirZ ? dir[2] : 1.) : TGeoShape::Big();
+      setIf(hasDirZ && sz <= 0, 0.);
+      const Double_t nsq = dir[0]*dir[0]+dir[1]*dir[1];
+      const Bool_t alongZ = (TMath::Abs(nsq) < tolerance);
+      setIf(alongZ, sz);
+      const Double_t rsq = point[0]*point[0]+point[1]*point[1];
+      const Double_t rdotn = point[0]*dir[0]+point[1]*dir[1];
+      const Double_t t1 = 1./(alongZ ? 1. : nsq);
+      const Double_t b = t1*rdotn;
+      // inner cylinder
+      if (hasRmin) {
+         const Bool_t inRmin = (rsq <= rmin2+tolerance);
+         setIf(inRmin && rdotn < 0, 0.);
+         const Double_t delta = b*b-t1*(rsq-rmin2);
+         const Double_t sr = -b-TMath::Sqrt(TMath::Max(delta, 0.));
+         setIf(!inRmin && rdotn < 0 && delta > 0 && sr > 0, TMath::Min(sz, sr));
+      }
+      // outer cylinder
+      setIf(rsq >= rmax2-tolerance && rdotn >= 0, 0.);
+      const Double_t delta = b*b-t1*(rsq-rmax2);
+      const Double_t sr = -b+TMath::Sqrt(TMath::Max(delta, 0.));
+      setIf(delta > 0 && sr > 0, TMath::Min(sz, sr));
+      dists[i] = snxt;
+   }
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -1236,7 +1290,20 @@ void TGeoTube::DistFromOutside_v(const Double_t *points, const Double_t *dirs, D
 
 void TGeoTube::Safety_v(const Double_t *points, const Bool_t *inside, Double_t *safe, Int_t vecsize) const
 {
-   for (Int_t i=0; i<vecsize; i++) safe[i] = Safety(&points[3*i], inside[i]);
+   if (IsA() != TGeoTube::Class()) {
+      for (Int_t i=0; i<vecsize; i++) safe[i] = Safety(&points[3*i], inside[i]);
+      return;
+   }
+   // Same as Safety(), the outside safety being the opposite of the inside one
+   const Bool_t hasRmin = (fRmin > 1E-10);
+   for (Int_t i=0; i<vecsize; i++) {
+      const Double_t *point = &points[3*i];
+      const Double_t r = TMath::Sqrt(point[0]*point[0]+point[1]*point[1]);
+      Double_t saf = fDz-TMath::Abs(point[2]);
+      if (hasRmin) saf = TMath::Min(saf, r-fRmin);
+      saf = TMath::Min(saf, fRmax-r);
+      safe[i] = inside[i] ? saf : -saf;
+   }
 }
 
 ClassImp(TGeoTubeSeg);
@@ -0,0 +1,136 @@
+#include <gtest/gtest.h>
+
+#include <TGeoManager.h>
+#include <TGeoMaterial.h>
+#include <TGeoMedium.h>
+#include <TGeoMatrix.h>
+#include <TGeoNavigator.h>
+#include <TGeoVolume.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <set>
+#include <thread>
+#include <vector>
+
+namespace {
+
+/// A world box with a 10x10 grid of slabs
+TGeoManager *MakeGeometry()
+{
+   auto geom = new TGeoManager("mtnav", "MT navigation test");
+   auto mat = new TGeoMaterial("Al", 26.98, 13, 2.7);
+   auto med = new TGeoMedium("Al", 1, mat);
+   auto top = geom->MakeBox("top", med, 100, 100, 100);
+   geom->SetTopVolume(top);
+   auto slab = geom->MakeBox("slab", med, 4, 4, 90);
+   int copy = 0;
+   for (int i = 0; i < 10; ++i) {
+      for (int j = 0; j < 10; ++j)
+         top->AddNode(slab, copy++, new TGeoTranslation(-90 + 20 * i, -90 + 20 * j, 0));
+   }
+   geom->CloseGeometry();
+   return geom;
+}
+
+/// Number of steps done by the tracks of one thread
+int TransportTracks(TGeoManager *geom, int ntracks, int seed)
+{
+   int nsteps = 0;
+   for (int i = 0; i < ntracks; ++i) {
+      const double phi = 0.1 * (i + seed);
+      geom->InitTrack(0, 0, 0, std::cos(phi), std::sin(phi), 0.);
+      while (!geom->IsOutside() && nsteps < 1000000) {
+         geom->FindNextBoundaryAndStep();
+         ++nsteps;
+      }
+   }
+   return nsteps;
+}
+
+} // anonymous namespace
+
+TEST(MTNavigation, ThreadLocalNavigators)
+{
+   auto geom = MakeGeometry();
+   const int nthreads = std::max(2u, std::min(8u, std::thread::hardware_concurrency()));
+   geom->SetMaxThreads(nthreads);
+
+   std::vector<TGeoNavigator *> navigators(nthreads, nullptr);
+   std::vector<int> threadIds(nthreads, -1);
+   std::vector<int> steps(nthreads, 0);
+   std::vector<bool> sameNavigator(nthreads, false);
+   auto work = [&](int ithread) {
+      navigators[ithread] = geom->AddNavigator();
+      threadIds[ithread] = TGeoManager::ThreadId();
+      sameNavigator[ithread] = (geom->GetCurrentNavigator() == navigators[ithread]);
+      steps[ithread] = TransportTracks(geom, 100, ithread);
+      sameNavigator[ithread] = sameNavigator[ithread] && (geom->GetCurrentNavigator() == navigators[ithread]);
+   };
+   std::vector<std::thread> threads;
+   for (int i = 0; i < nthreads; ++i)
+      threads.emplace_back(work, i);
+   for (auto &t : threads)
+      t.join();
+
+   std::set<TGeoNavigator *> uniqueNavigators(navigators.begin(), navigators.end());
+   std::set<int> uniqueIds(threadIds.begin(), threadIds.end());
+   EXPECT_EQ(uniqueNavigators.size(), static_cast<std::size_t>(nthreads));
+   EXPECT_EQ(uniqueIds.size(), static_cast<std::size_t>(nthreads));
+   for (int i = 0; i < nthreads; ++i) {
+      EXPECT_TRUE(sameNavigator[i]);
+      EXPECT_GT(steps[i], 0);
+   }
+   delete geom;
+}
+
+TEST(MTNavigation, SwitchNavigator)
+{
+   auto geom = MakeGeometry();
+   geom->SetMaxThreads(2);
+   std::thread t([geom]() {
+      auto nav1 = geom->AddNavigator();
+      auto nav2 = geom->AddNavigator();
+      EXPECT_EQ(geom->GetCurrentNavigator(), nav2);
+      EXPECT_TRUE(geom->SetCurrentNavigator(0));
+      EXPECT_EQ(geom->GetCurrentNavigator(), nav1);
+      geom->RemoveNavigator(nav2);
+      EXPECT_EQ(geom->GetCurrentNavigator(), nav1);
+   });
+   t.join();
+   delete geom;
+}
+
+// Contention benchmark: time of the navigator lookup with an increasing number of threads
+TEST(MTNavigation, LookupScaling)
+{
+   auto geom = MakeGeometry();
+   const int maxthreads = std::max(1u, std::min(128u, std::thread::hardware_concurrency()));
+   geom->SetMaxThreads(maxthreads);
+   constexpr int kNlookups = 1000000;
+   for (int nthreads = 1; nthreads <= maxthreads; nthreads *= 2) {
+      std::vector<int> failures(nthreads, 0);
+      auto work = [&](int ithread) {
+         if (!geom->GetCurrentNavigator())
+            geom->AddNavigator();
+         auto nav = geom->GetCurrentNavigator();
+         for (int i = 0; i < kNlookups; ++i) {
+            if (geom->GetCurrentNavigator() != nav)
+               ++failures[ithread];
+         }
+      };
+      const auto start = std::chrono::steady_clock::now();
+      std::vector<std::thread> threads;
+      for (int i = 0; i < nthreads; ++i)
+         threads.emplace_back(work, i);
+      for (auto &t : threads)
+         t.join();
+      const std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+      for (auto f : failures)
+         EXPECT_EQ(f, 0);
+      std::cout << nthreads << " threads: " << elapsed.count() / kNlookups << " ns per lookup and thread" << std::endl;
+   }
+   delete geom;
+}
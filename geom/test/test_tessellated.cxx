@@ -0,0 +1,113 @@
+#include <gtest/gtest.h>
+
+#include <TGeoBBox.h>
+#include <TGeoTessellated.h>
+#include <TGeoTrd1.h>
+#include <TRandom3.h>
+
+#include <array>
+#include <cmath>
+#include <memory>
+
+using Vertex_t = Tessellated::Vertex_t;
+
+namespace {
+
+/// Builds a tessellated hexahedron from its 8 corners (4 at -z, then 4 at +z, both counterclockwise seen from +z).
+/// Each face is divided into ndiv x ndiv quadrilateral facets, so that the bounding volume hierarchy has several levels.
+std::unique_ptr<TGeoTessellated> MakeTessellatedHexahedron(const std::array<Vertex_t, 8> &v, int ndiv)
+{
+   // Corners of the faces, counterclockwise seen from outside
+   const int faces[6][4] = {{0, 3, 2, 1}, {4, 5, 6, 7}, {0, 1, 5, 4}, {1, 2, 6, 5}, {2, 3, 7, 6}, {3, 0, 4, 7}};
+   auto tsl = std::make_unique<TGeoTessellated>("tsl", 6 * ndiv * ndiv);
+   for (const auto &face : faces) {
+      auto at = [&](int i, int j) {
+         const double u = double(i) / ndiv;
+         const double w = double(j) / ndiv;
+         return (1 - u) * (1 - w) * v[face[0]] + u * (1 - w) * v[face[1]] + u * w * v[face[2]] +
+                (1 - u) * w * v[face[3]];
+      };
+      for (int i = 0; i < ndiv; ++i) {
+         for (int j = 0; j < ndiv; ++j)
+            tsl->AddFacet(at(i, j), at(i + 1, j), at(i + 1, j + 1), at(i, j + 1));
+      }
+   }
+   tsl->CloseShape(true, true, false);
+   return tsl;
+}
+
+Vertex_t RandomDirection(TRandom &rng)
+{
+   double dir[3];
+   rng.Sphere(dir[0], dir[1], dir[2], 1.);
+   return Vertex_t(dir[0], dir[1], dir[2]);
+}
+
+/// Compares the navigation functions of the tessellated shape to the ones of the equivalent primitive shape, for
+/// random points in and around the bounding box and random directions
+void CompareNavigation(const TGeoShape &ref, const TGeoTessellated &tsl, double dx, double dy, double dz)
+{
+   constexpr double kTolerance = 1.e-8;
+   constexpr int kNpoints = 5000;
+   TRandom3 rng(42);
+   int ninside = 0;
+   int noutside = 0;
+   for (int i = 0; i < kNpoints; ++i) {
+      double point[3] = {rng.Uniform(-1.5 * dx, 1.5 * dx), rng.Uniform(-1.5 * dy, 1.5 * dy),
+                         rng.Uniform(-1.5 * dz, 1.5 * dz)};
+      const bool inside = ref.Contains(point);
+      // Points on the surface may be classified either way
+      if (ref.Safety(point, inside) < kTolerance)
+         continue;
+      ASSERT_EQ(inside, tsl.Contains(point)) << point[0] << " " << point[1] << " " << point[2];
+
+      const Vertex_t vdir = RandomDirection(rng);
+      double dir[3] = {vdir[0], vdir[1], vdir[2]};
+      if (inside) {
+         ++ninside;
+         EXPECT_NEAR(ref.DistFromInside(point, dir), tsl.DistFromInside(point, dir), kTolerance);
+         // For inside points, the safety of the primitive shapes is the exact distance to the surface
+         EXPECT_NEAR(ref.Safety(point, kTRUE), tsl.Safety(point, kTRUE), kTolerance);
+      } else {
+         ++noutside;
+         const double refdist = ref.DistFromOutside(point, dir);
+         const double dist = tsl.DistFromOutside(point, dir);
+         if (refdist >= TGeoShape::Big())
+            EXPECT_GE(dist, TGeoShape::Big());
+         else
+            EXPECT_NEAR(refdist, dist, kTolerance);
+         // For outside points, the safety of the primitive shapes is only a lower bound
+         EXPECT_GE(tsl.Safety(point, kFALSE), ref.Safety(point, kFALSE) - kTolerance);
+      }
+   }
+   EXPECT_GT(ninside, kNpoints / 10);
+   EXPECT_GT(noutside, kNpoints / 10);
+}
+
+} // anonymous namespace
+
+TEST(TGeoTessellated, CompareToBox)
+{
+   const double dx = 3, dy = 2, dz = 1;
+   TGeoBBox box(dx, dy, dz);
+   const std::array<Vertex_t, 8> corners = {Vertex_t(-dx, -dy, -dz), Vertex_t(dx, -dy, -dz), Vertex_t(dx, dy, -dz),
+                                            Vertex_t(-dx, dy, -dz),  Vertex_t(-dx, -dy, dz), Vertex_t(dx, -dy, dz),
+                                            Vertex_t(dx, dy, dz),    Vertex_t(-dx, dy, dz)};
+   auto tsl = MakeTessellatedHexahedron(corners, 8);
+   CompareNavigation(box, *tsl, dx, dy, dz);
+
+   // For outside points, the safety is the exact distance to the box
+   double point[3] = {dx + 3, dy + 4, 0};
+   EXPECT_NEAR(5., tsl->Safety(point, kFALSE), 1.e-10);
+}
+
+TEST(TGeoTessellated, CompareToTrd)
+{
+   const double dx1 = 1, dx2 = 3, dy = 2, dz = 2;
+   TGeoTrd1 trd(dx1, dx2, dy, dz);
+   const std::array<Vertex_t, 8> corners = {
+      Vertex_t(-dx1, -dy, -dz), Vertex_t(dx1, -dy, -dz), Vertex_t(dx1, dy, -dz), Vertex_t(-dx1, dy, -dz),
+      Vertex_t(-dx2, -dy, dz),  Vertex_t(dx2, -dy, dz),  Vertex_t(dx2, dy, dz),  Vertex_t(-dx2, dy, dz)};
+   auto tsl = MakeTessellatedHexahedron(corners, 5);
+   CompareNavigation(trd, *tsl, dx2, dy, dz);
+}
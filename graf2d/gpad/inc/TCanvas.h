@@ -227,6 +227,7 @@ public:
    void                DeleteCanvasPainter();
 
    static TCanvas   *MakeDefCanvas();
+   static Bool_t     SaveAll(const std::vector<TPad *> &pads = {}, const char *filename = "", Option_t *option = "");
    static Bool_t     SupportAlpha();
 
    ClassDefOverride(TCanvas,8)  //Graphics canvas
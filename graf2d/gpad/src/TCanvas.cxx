@@ -1510,6 +1510,90 @@ TCanvas *TCanvas::MakeDefCanvas()
    return c;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Static function to save several pads or canvases at once.
+///
+/// If `pads` is empty, all canvases of gROOT->GetListOfCanvases() are saved.
+/// For a PDF or PostScript file, every pad is stored as a page of the same file.
+/// For other formats, one file per pad is produced: a `%` in the file name is
+/// replaced by the index of the pad, otherwise the index is inserted before the
+/// file extension. Default file name is "canvases.pdf". A non-empty `option`
+/// is passed to TPad::Print(), otherwise the format follows the file extension.
+///
+/// With web graphics, all images are produced by a single run of the headless
+/// browser, avoiding to start the browser for every image.
+///
+/// ~~~{.cpp}
+/// TCanvas::SaveAll({c1, c2, c3}, "plots/plot%.png"); // plot000.png, plot001.png, plot002.png
+/// TCanvas::SaveAll({}, "all.pdf"); // all existing canvases as pages of all.pdf
+/// ~~~
+
+Bool_t TCanvas::SaveAll(const std::vector<TPad *> &pads, const char *filename, Option_t *option)
+{
+   std::vector<TPad *> _pads = pads;
+   if (_pads.empty()) {
+      TIter next(gROOT->GetListOfCanvases());
+      while (auto c = dynamic_cast<TCanvas *>(next()))
+         _pads.emplace_back(c);
+   }
+
+   if (_pads.empty()) {
+      ::Warning("TCanvas::SaveAll", "No pads are provided");
+      return kFALSE;
+   }
+
+   TString fname = filename;
+   if (!fname.Length())
+      fname = "canvases.pdf";
+
+   // web graphics can produce all images with a single browser run
+   Bool_t isweb = kTRUE;
+   for (auto pad : _pads)
+      if (!pad || !pad->GetCanvas() || !pad->GetCanvas()->IsWeb())
+         isweb = kFALSE;
+   TString lname = fname;
+   lname.ToLower();
+   if (isweb && _pads[0]->GetPainter() && (lname.EndsWith(".png") || lname.EndsWith(".jpg") ||
+       lname.EndsWith(".jpeg") || lname.EndsWith(".svg") || lname.EndsWith(".pdf") || lname.EndsWith(".webp"))) {
+      std::vector<TVirtualPad *> vpads(_pads.begin(), _pads.end());
+      if (_pads[0]->GetPainter()->SaveImages(vpads, fname.Data()))
+         return kTRUE;
+   }
+
+   if (lname.EndsWith(".pdf") || lname.EndsWith(".ps")) {
+      for (unsigned n = 0; n < _pads.size(); ++n) {
+         TString pname = fname;
+         if ((_pads.size() > 1) && (n == 0))
+            pname.Append("(");
+         else if ((_pads.size() > 1) && (n == _pads.size() - 1))
+            pname.Append(")");
+         if (option && *option)
+            _pads[n]->Print(pname.Data(), option);
+         else
+            _pads[n]->SaveAs(pname.Data());
+      }
+      return kTRUE;
+   }
+
+   Ssiz_t pos = fname.Index("%");
+   if (pos != kNPOS)
+      fname.Remove(pos, 1);
+   else if (_pads.size() > 1)
+      pos = fname.Last('.');
+
+   for (unsigned n = 0; n < _pads.size(); ++n) {
+      TString pname = fname;
+      if (pos != kNPOS)
+         pname.Insert(pos, TString::Format("%03u", n));
+      if (option && *option)
+         _pads[n]->Print(pname.Data(), option);
+      else
+         _pads[n]->SaveAs(pname.Data());
+   }
+
+   return kTRUE;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Set option to move objects/pads in a canvas.
 ///
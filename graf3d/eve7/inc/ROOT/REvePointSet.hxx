@@ -48,6 +48,7 @@ protected:
    int                     fCapacity{0};
    int                     fSize{0};
    int                     fTexX{0}, fTexY{0};
+   int                     fMaxRenderPoints{0}; // Maximum number of points sent to the client, 0 for no limit.
 
 public:
    REvePointSet(const std::string& name="", const std::string& title="", Int_t n_points = 0);
@@ -67,6 +68,11 @@ public:
    int   GetCapacity() const { return fCapacity; }
    int   GetSize()     const { return fSize;     }
 
+   int   GetMaxRenderPoints() const { return fMaxRenderPoints; }
+   void  SetMaxRenderPoints(int n);
+   int   GetRenderStride() const;
+   int   GetRenderSize()   const { return (fSize + GetRenderStride() - 1) / GetRenderStride(); }
+
          REveVector& RefPoint(int n)       { assert (n < fSize); return fPoints[n]; }
    const REveVector& RefPoint(int n) const { assert (n < fSize); return fPoints[n]; }
 
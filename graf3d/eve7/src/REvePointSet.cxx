@@ -38,6 +38,12 @@ Setting of per-point TRef's is not supported.
 
 REvePointSet is a REveProjectable: it can be projected by using the
 REveProjectionManager class.
+
+Very large point sets can be thinned for display with SetMaxRenderPoints():
+only every n-th point is then sent to the client, so that the size of the
+render data stays bounded while the overall shape of the distribution is
+kept. Thinning is not applied when secondary selection is enabled, as the
+client reports point indices with respect to the points it received.
 */
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -71,6 +77,7 @@ REvePointSet::REvePointSet(const REvePointSet& e) :
    REveSecondarySelectable()
 {
    fAlwaysSecSelect = e.GetAlwaysSecSelect();
+   fMaxRenderPoints = e.fMaxRenderPoints;
    ClonePoints(e);
 }
 
@@ -178,6 +185,33 @@ void REvePointSet::SetMarkerSize(Size_t msize)
    StampObjProps();
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Set the maximum number of points sent to the client, 0 disables the limit.
+/// Larger sets are thinned by sending only every GetRenderStride()-th point.
+
+void REvePointSet::SetMaxRenderPoints(int n)
+{
+   for (auto &pi: fProjectedList)
+   {
+      REvePointSet* pt = dynamic_cast<REvePointSet *>(pi);
+      if (pt)
+         pt->SetMaxRenderPoints(n);
+   }
+   fMaxRenderPoints = n;
+   StampObjProps();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return the stride between the points sent to the client, 1 if all points
+/// are sent.
+
+int REvePointSet::GetRenderStride() const
+{
+   if (fMaxRenderPoints <= 0 || fSize <= fMaxRenderPoints || fAlwaysSecSelect)
+      return 1;
+   return (fSize + fMaxRenderPoints - 1) / fMaxRenderPoints;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Copy visualization parameters from element el.
 
@@ -214,12 +248,12 @@ TClass* REvePointSet::ProjectedClass(const REveProjection*) const
 Int_t REvePointSet::WriteCoreJson(nlohmann::json& j, Int_t rnr_offset)
 {
    if (gEve->IsRCore())
-      REveRenderData::CalcTextureSize(fSize, 1, fTexX, fTexY);
+      REveRenderData::CalcTextureSize(GetRenderSize(), 1, fTexX, fTexY);
 
    Int_t ret = REveElement::WriteCoreJson(j, rnr_offset);
 
    if (gEve->IsRCore()) {
-      j["fSize"] = fSize;
+      j["fSize"] = GetRenderSize();
       j["fTexX"] = fTexX;
       j["fTexY"] = fTexY;
    }
@@ -232,18 +266,25 @@ Int_t REvePointSet::WriteCoreJson(nlohmann::json& j, Int_t rnr_offset)
 
 ////////////////////////////////////////////////////////////////////////////////
 /// Crates 3D point array for rendering.
+/// If the number of points exceeds fMaxRenderPoints, only every
+/// GetRenderStride()-th point is included.
 
 void REvePointSet::BuildRenderData()
 {
    if (fSize > 0)
    {
+      const int stride = GetRenderStride();
       if (gEve->IsRCore()) {
          fRenderData = std::make_unique<REveRenderData>("makeHit", 4*fTexX*fTexY);
-         for (int i = 0; i < fSize; ++i) {
+         for (int i = 0; i < fSize; i += stride) {
             fRenderData->PushV(&fPoints[i].fX, 3);
             fRenderData->PushV(0);
          }
          fRenderData->ResizeV(4*fTexX*fTexY);
+      } else if (stride > 1) {
+         fRenderData = std::make_unique<REveRenderData>("makeHit", 3*GetRenderSize());
+         for (int i = 0; i < fSize; i += stride)
+            fRenderData->PushV(&fPoints[i].fX, 3);
       } else {
          fRenderData = std::make_unique<REveRenderData>("makeHit", 3*fSize);
          fRenderData->PushV(&fPoints[0].fX, 3*fSize);
@@ -568,6 +609,7 @@ void REvePointSetProjected::UpdateProjection()
    REveTrans      *tr   =   ps.PtrMainTrans(kFALSE);
 
    fAlwaysSecSelect = ps.GetAlwaysSecSelect();
+   fMaxRenderPoints = ps.GetMaxRenderPoints();
 
    // XXXX rewrite
 
@@ -60,6 +60,7 @@ protected:
       Long64_t fSendVersion{0};        ///<! canvas version send to the client
       Long64_t fDrawVersion{0};        ///<! canvas version drawn (confirmed) by client
       UInt_t fLastSendHash{0};         ///<! hash of last send draw message, avoid looping
+      std::map<std::string, std::map<std::string, std::size_t>> fObjHashes; ///<! per pad, hashes of objects send to the client
       std::map<std::string, std::string> fCtrl; ///<! different ctrl parameters which can be send at once
       std::queue<std::string> fSend;   ///<! send queue, processed after sending draw data
 
@@ -68,6 +69,7 @@ protected:
       {
          fCheckedVersion = fSendVersion = fDrawVersion = 0;
          fLastSendHash = 0;
+         fObjHashes.clear();
       }
    };
 
@@ -93,6 +95,7 @@ protected:
    Int_t fPaletteDelivery{1};      ///<! colors palette delivery 0:never, 1:once, 2:always, 3:per subpad
    Int_t fPrimitivesMerge{100};    ///<! number of PS primitives, which will be merged together
    Int_t fJsonComp{0};             ///<! compression factor for messages send to the client
+   Bool_t fDeltaUpdates{kTRUE};    ///<! send only objects modified since the last snapshot
    std::string fCustomScripts;     ///<! custom JavaScript code or URL on JavaScript files to load before start drawing
    std::vector<std::string> fCustomClasses;  ///<! list of custom classes, which can be delivered as is to client
    Bool_t fCanCreateObjects{kTRUE}; ///<! indicates if canvas allowed to create extra objects for interactive painting
@@ -137,6 +140,8 @@ protected:
 
    void CheckDataToSend(unsigned connid = 0);
 
+   void MarkUnchangedPrimitives(WebConn &conn, TPadWebSnapshot &paddata);
+
    Bool_t WaitWhenCanvasPainted(Long64_t ver);
 
    virtual Bool_t IsJSSupportedClass(TObject *obj, Bool_t many_primitives = kFALSE);
@@ -227,6 +232,9 @@ public:
    void SetPrimitivesMerge(Int_t cnt) { fPrimitivesMerge = cnt; }
    Int_t GetPrimitivesMerge() const { return fPrimitivesMerge; }
 
+   void SetDeltaUpdates(Bool_t on = kTRUE) { fDeltaUpdates = on; }
+   Bool_t GetDeltaUpdates() const { return fDeltaUpdates; }
+
    void SetLongerPolling(Bool_t on) { fLongerPolling = on; }
    Bool_t GetLongerPolling() const { return fLongerPolling; }
 
@@ -85,6 +85,7 @@ public:
 
    //jpg, png, bmp, gif output.
    void     SaveImage(TVirtualPad *, const char *, Int_t) const override;
+   Bool_t   SaveImages(const std::vector<TVirtualPad *> &, const char *) const override;
 
    //TASImage support (noop for a non-gl pad).
    void     DrawPixels(const unsigned char *pixelData, UInt_t width, UInt_t height,
@@ -36,7 +36,8 @@ public:
      kSVG = 2,         ///< list of SVG primitives
      kSubPad = 3,      ///< subpad
      kColors = 4,      ///< list of ROOT colors + palette
-     kStyle = 5        ///< gStyle object
+     kStyle = 5,       ///< gStyle object
+     kUnchanged = 6    ///< object not changed since last snapshot send to the client
    };
 
    ~TWebSnapshot() override;
@@ -46,8 +47,10 @@ public:
    const char* GetObjectID() const { return fObjectID.c_str(); }
 
    void SetOption(const std::string &opt) { fOption = opt; }
+   const char *GetOption() const { return fOption.c_str(); }
 
    void SetSnapshot(Int_t kind, TObject *snapshot, Bool_t owner = kFALSE);
+   void SetUnchanged() { SetSnapshot(kUnchanged, nullptr); }
    Int_t GetKind() const { return fKind; }
    TObject *GetSnapshot() const { return fSnapshot; }
 
@@ -93,6 +96,10 @@ public:
 
    TWebSnapshot &NewSpecials();
 
+   const std::vector<std::unique_ptr<TWebSnapshot>> &GetPrimitives() const { return fPrimitives; }
+
+   bool IsWithoutPrimitives() const { return fWithoutPrimitives; }
+
    ClassDefOverride(TPadWebSnapshot, 3) // Pad painting snapshot, used for JSROOT
 };
 
@@ -43,6 +43,7 @@
 #include "TScatter.h"
 #include "TCutG.h"
 #include "TBufferJSON.h"
+#include "TBufferFile.h"
 #include "TBase64.h"
 #include "TAtt3D.h"
 #include "TView.h"
@@ -57,6 +58,7 @@
 #include <iostream>
 #include <memory>
 #include <sstream>
+#include <string_view>
 
 class TWebCanvasTimer : public TTimer {
    TWebCanvas &fCanv;
@@ -114,6 +116,7 @@ TWebCanvas::TWebCanvas(TCanvas *c, const char *name, Int_t x, Int_t y, UInt_t wi
    fPrimitivesMerge = gEnv->GetValue("WebGui.PrimitivesMerge", 100);
    fTF1UseSave = gEnv->GetValue("WebGui.TF1UseSave", (Int_t) 0) > 0;
    fJsonComp = gEnv->GetValue("WebGui.JsonComp", TBufferJSON::kSameSuppression + TBufferJSON::kNoSpaces);
+   fDeltaUpdates = gEnv->GetValue("WebGui.DeltaUpdates", (Int_t) 1) > 0;
 }
 
 
@@ -868,6 +871,8 @@ void TWebCanvas::CheckDataToSend(unsigned connid)
             holder.SetHighlightConnect(Canvas()->HasConnection("Highlighted(TVirtualPad*,TObject*,Int_t,Int_t)"));
 
             CreatePadSnapshot(holder, Canvas(), conn.fSendVersion, [&buf, &conn, this](TPadWebSnapshot *snap) {
+               if (fDeltaUpdates)
+                  MarkUnchangedPrimitives(conn, *snap);
                auto json = TBufferJSON::ToJSON(snap, fJsonComp);
                auto hash = json.Hash();
                if (conn.fLastSendHash && (conn.fLastSendHash == hash) && conn.fSendVersion) {
@@ -906,6 +911,46 @@ void TWebCanvas::CheckDataToSend(unsigned connid)
 
 }
 
+//////////////////////////////////////////////////////////////////////////////////////////////////
+/// Replace objects which did not change since the last snapshot send to the client by kUnchanged entries
+/// Objects are compared by hash of their binary streaming and draw option, client just redraws them
+/// Hashes are kept per pad and replaced for every pad with primitives, unmodified pads keep them
+
+void TWebCanvas::MarkUnchangedPrimitives(WebConn &conn, TPadWebSnapshot &paddata)
+{
+   if (!paddata.IsWithoutPrimitives()) {
+      auto &prev = conn.fObjHashes[paddata.GetObjectID()];
+      std::map<std::string, std::size_t> hashes;
+      std::map<std::string, int> counts;
+
+      for (auto &item : paddata.GetPrimitives()) {
+         auto obj = item->GetSnapshot();
+         std::string id = item->GetObjectID();
+         if ((item->GetKind() != TWebSnapshot::kObject) || !obj || id.empty())
+            continue;
+
+         // same object can be drawn several times in the pad
+         auto key = id + "#"s + std::to_string(++counts[id]);
+
+         TBufferFile buf(TBuffer::kWrite);
+         buf.WriteObjectAny(obj, obj->IsA());
+         auto hash = std::hash<std::string_view>{}(std::string_view(buf.Buffer(), buf.Length())) ^
+                     std::hash<std::string>{}(item->GetOption());
+
+         auto iter = prev.find(key);
+         if ((iter != prev.end()) && (iter->second == hash))
+            item->SetUnchanged();
+         hashes[key] = hash;
+      }
+
+      prev = std::move(hashes);
+   }
+
+   for (auto &item : paddata.GetPrimitives())
+      if (item->GetKind() == TWebSnapshot::kSubPad)
+         MarkUnchangedPrimitives(conn, static_cast<TPadWebSnapshot &>(*item));
+}
+
 //////////////////////////////////////////////////////////////////////////////////////////
 /// Close web canvas - not implemented
 
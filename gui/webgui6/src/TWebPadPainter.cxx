@@ -298,3 +298,16 @@ void TWebPadPainter::SaveImage(TVirtualPad *pad, const char *fileName, Int_t gty
    TWebCanvas::ProduceImage(dynamic_cast<TPad *>(pad), fileName);
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Produce images of several pads with a single run of the headless browser
+
+Bool_t TWebPadPainter::SaveImages(const std::vector<TVirtualPad *> &pads, const char *fileName) const
+{
+   std::vector<TPad *> webpads;
+   for (auto pad : pads)
+      if (auto webpad = dynamic_cast<TPad *>(pad))
+         webpads.emplace_back(webpad);
+
+   return TWebCanvas::ProduceImages(webpads, fileName);
+}
+
@@ -282,6 +282,28 @@ namespace ROOT {
          return *this;
       }
 
+      // struct for dealing with the gradient generated by automatic differentiation, since it is available
+      // only in TFormula
+      template <class T>
+      struct GeneralGradientCalc {
+         static bool Gradient(TF1 *, const T *, const double *, T *) { return false; }
+      };
+
+      template <>
+      struct GeneralGradientCalc<double> {
+         static bool Gradient(TF1 *func, const double *x, const double *par, double *grad)
+         {
+            // the generated gradient takes the parameters as argument, so the TF1 is not modified and
+            // the gradient can be evaluated concurrently in multi-thread fits
+            auto formula = func->GetFormula();
+            if (!formula || !formula->HasGeneratedGradient() || func->IsEvalNormalized())
+               return false;
+            std::fill(grad, grad + func->GetNpar(), 0.);
+            formula->GradientPar(x, par, grad);
+            return true;
+         }
+      };
+
       template <class T>
       void WrappedMultiTF1Templ<T>::ParameterGradient(const T *x, const double *par, T *grad) const
       {
@@ -291,6 +313,8 @@ namespace ROOT {
          //  so in case of fLinear (or fPolynomial) a non-zero value will be returned for fixed parameters
 
          if (!fLinear) {
+            if (GeneralGradientCalc<T>::Gradient(fFunc, x, par, grad))
+               return;
             // need to set parameter values
             fFunc->SetParameters(par);
             // no need to call InitArgs (it is called in TF1::GradientPar)
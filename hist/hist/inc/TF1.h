@@ -40,6 +40,7 @@ class TF1;
 class TH1;
 class TAxis;
 class TRandom;
+class TSpline3;
 
 namespace ROOT {
    namespace Fit {
@@ -268,6 +269,10 @@ protected:
    std::unique_ptr<TFormula>   fFormula;            ///<  Pointer to TFormula in case when user define formula
    std::unique_ptr<TF1Parameters> fParams;          ///<  Pointer to Function parameters object (exists only for not-formula functions)
    std::unique_ptr<TF1AbsComposition> fComposition; ///<  Pointer to composition (NSUM or CONV)
+   Double_t    fInterpolationTol{0};                ///<! Tolerance of the interpolation table (0 = not used)
+   TSpline3    *fInterpolation{nullptr};            ///<! Interpolation table of the function in its range
+   std::vector<Double_t>  fInterpolationParams;     ///<! Parameter values used to build the interpolation table
+   Bool_t      fInBuildInterpolation{false};        ///<! True while the interpolation table is being built
 
    /// General constructor for TF1. Most of the other constructors delegate on it
    TF1(EFType functionType, const char *name, Double_t xmin, Double_t xmax, Int_t npar, Int_t ndim, EAddToList addToGlobList, TF1Parameters *params = nullptr, TF1FunctorPointer * functor = nullptr):
@@ -313,6 +318,8 @@ protected:
    void IntegrateForNormalization();
    // tabulate the cumulative function integral at  fNpx points. Used by GetRandom
    Bool_t ComputeCdfTable(Option_t * opt);
+   // build the interpolation table for the given parameters. Used by EvalPar when SetInterpolation is active
+   Bool_t BuildInterpolation(const Double_t *params);
 
    virtual Double_t GetMinMaxNDim(Double_t *x , Bool_t findmax, Double_t epsilon = 0, Int_t maxiter = 0) const;
    virtual void GetRange(Double_t *xmin, Double_t *xmax) const;
@@ -438,6 +445,7 @@ public:
    //template <class T> T Eval(T x, T y = 0, T z = 0, T t = 0) const;
    virtual Double_t EvalPar(const Double_t *x, const Double_t *params = nullptr);
    template <class T> T EvalPar(const T *x, const Double_t *params = nullptr);
+   void     EvalParBatch(Int_t n, const Double_t *x, Double_t *result, const Double_t *params = nullptr);
    virtual Double_t operator()(Double_t x, Double_t y = 0, Double_t z = 0, Double_t t = 0) const;
    template <class T> T operator()(const T *x, const Double_t *params = nullptr);
    void     ExecuteEvent(Int_t event, Int_t px, Int_t py) override;
@@ -496,6 +504,10 @@ public:
    {
       return fNpx;
    }
+   Double_t         GetInterpolationTolerance() const
+   {
+      return fInterpolationTol;
+   }
    TMethodCall    *GetMethodCall() const
    {
       return fMethodCall.get();
@@ -636,6 +648,7 @@ public:
       Update();
    }
    virtual void     SetNpx(Int_t npx = 100); // *MENU*
+   virtual void     SetInterpolation(Double_t tolerance = 1.E-6);
    virtual void     SetParameter(Int_t param, Double_t value)
    {
       (fFormula) ? fFormula->SetParameter(param, value) : fParams->SetParameter(param, value);
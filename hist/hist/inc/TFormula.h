@@ -105,6 +105,8 @@ private:
    CallFuncSignature fFuncPtr = nullptr;           ///<! Function pointer, owned by the JIT.
    CallFuncSignature fGradFuncPtr = nullptr;       ///<! Function pointer, owned by the JIT.
    CallFuncSignature fHessFuncPtr = nullptr;       ///<! Function pointer, owned by the JIT.
+   std::string       fBatchGenerationInput;        ///<! Input query declaring the loop of EvalParBatch
+   CallFuncSignature fBatchFuncPtr = nullptr;      ///<! Function pointer to the loop of EvalParBatch, owned by the JIT.
    void *   fLambdaPtr = nullptr;                  ///<! Pointer to the lambda function
    static bool       fIsCladRuntimeIncluded;
 
@@ -131,6 +133,10 @@ private:
       assert(fClingName.Length() && "TFormula is not initialized yet!");
       return std::string(fClingName.Data()) + "_hessian_1";
    }
+   std::string GetBatchFuncName() const {
+      assert(fClingName.Length() && "TFormula is not initialized yet!");
+      return std::string(fClingName.Data()) + "_batch";
+   }
    bool HasGradientGenerationFailed() const {
       return !fGradFuncPtr && !fGradGenerationInput.empty();
    }
@@ -202,6 +208,11 @@ public:
    Double_t       Eval(Double_t x, Double_t y , Double_t z) const;
    Double_t       Eval(Double_t x, Double_t y , Double_t z , Double_t t ) const;
    Double_t       EvalPar(const Double_t *x, const Double_t *params = nullptr) const;
+   void           EvalParBatch(Int_t n, const Double_t *x, Double_t *result, const Double_t *params = nullptr) const;
+
+   /// Generate the compiled loop over the points used by EvalParBatch.
+   /// \returns true if the loop was generated, otherwise EvalParBatch evaluates the points one by one.
+   bool GenerateEvalParBatch();
 
    /// Generate gradient computation routine with respect to the parameters.
    /// \returns true if a gradient was generated and GradientPar can be called.
@@ -220,6 +231,11 @@ public:
 
    void GradientPar(const Double_t *x, Double_t *result);
 
+   /// Compute the gradient employing automatic differentiation for the given
+   /// parameters, without changing the stored ones. GenerateGradientPar must
+   /// have succeeded; the result buffer must be initialized to zero.
+   void GradientPar(const Double_t *x, const Double_t *params, Double_t *result);
+
    /// Compute the gradient employing automatic differentiation.
    ///
    /// \param[in] x - The given variables, if nullptr the already stored
@@ -83,6 +83,7 @@ public:
    };
 
    friend class TH1Merger;
+   friend class TH1ConcurrentFill;
 
 protected:
     Int_t         fNcells;          ///<  Number of bins(1D), cells (2D) +U/Overflows
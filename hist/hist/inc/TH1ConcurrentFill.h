@@ -0,0 +1,113 @@
+// @(#)root/hist:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_TH1ConcurrentFill
+#define ROOT_TH1ConcurrentFill
+
+#include "Rtypes.h"
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+class TH1;
+
+/** \class TH1ConcurrentFill
+\ingroup Histograms
+
+Fills one TH1, TH2 or TH3 concurrently from several threads, instead of filling one clone per thread and merging
+them afterwards. This saves the memory of the clones for large multi-dimensional histograms.
+
+Every thread fills through its own TH1ConcurrentFill::TFiller, which buffers the bins and weights of the fills and
+accumulates the statistics (sum of weights, sums of w*x, ...) locally. When its buffer is full, and on Flush() or
+destruction, a filler adds its bins to the histogram while holding one of a fixed set of locks, each protecting an
+interleaved subset of the bins; fillers of different threads thus rarely wait for each other. The statistics and
+the number of entries are then added once per flush.
+
+~~~{.cpp}
+TH3D h("h", "h", 200, 0, 1, 200, 0, 1, 200, 0, 1);
+TH1ConcurrentFill concurrentFill(h);
+ROOT::TThreadExecutor pool;
+pool.Foreach([&](int) {
+   auto filler = concurrentFill.MakeFiller();
+   for (int i = 0; i < 1000000; ++i)
+      filler.Fill(gRandom->Rndm(), gRandom->Rndm(), gRandom->Rndm());
+}, ROOT::TSeqI(8));
+~~~
+
+The histogram must not be used otherwise while fillers are alive. Fills never extend the axes: values outside of
+the axis range go to the underflow and overflow bins. Profiles are not supported.
+*/
+class TH1ConcurrentFill {
+public:
+   class TFiller {
+      friend class TH1ConcurrentFill;
+
+      TH1ConcurrentFill *fConcurrentFill;
+      /// The buffered fills as (global bin, weight)
+      std::vector<std::pair<Int_t, Double_t>> fFills;
+      /// The local statistics, in the layout of TH1::GetStats()
+      Double_t fStats[11] = {};
+      Double_t fNEntries = 0;
+      bool fHasWeights = false;
+
+      explicit TFiller(TH1ConcurrentFill &concurrentFill);
+      void Buffer(Int_t bin, Double_t w)
+      {
+         fFills.emplace_back(bin, w);
+         if (w != 1.)
+            fHasWeights = true;
+         if (fFills.size() >= fFills.capacity())
+            Flush();
+      }
+
+   public:
+      TFiller(TFiller &&other);
+      TFiller &operator=(TFiller &&other) = delete;
+      TFiller(const TFiller &) = delete;
+      TFiller &operator=(const TFiller &) = delete;
+      ~TFiller() { Flush(); }
+
+      void Fill(Double_t x, Double_t w = 1.);
+      void Fill(Double_t x, Double_t y, Double_t w);
+      void Fill(Double_t x, Double_t y, Double_t z, Double_t w);
+      /// Adds the buffered fills and statistics to the histogram
+      void Flush();
+   };
+
+private:
+   static constexpr std::size_t kNLocks = 64;
+
+   TH1 *fHist;
+   Int_t fDimension;
+   std::size_t fBufferSize;
+   /// Whether under- and overflows enter the statistics, see TH1::StatOverflows()
+   Bool_t fUseOverflowsInStats;
+   /// The bin b is protected by fBinLocks[b % kNLocks]
+   std::unique_ptr<std::mutex[]> fBinLocks;
+   /// Protects the statistics, the number of entries and the creation of the sum of squares of weights
+   std::mutex fStatsLock;
+
+   void Flush(TFiller &filler);
+
+public:
+   /// bufferSize is the number of fills buffered by every filler
+   explicit TH1ConcurrentFill(TH1 &hist, std::size_t bufferSize = 1024);
+   TH1ConcurrentFill(const TH1ConcurrentFill &) = delete;
+   TH1ConcurrentFill &operator=(const TH1ConcurrentFill &) = delete;
+
+   /// Returns a filler for the calling thread. Fillers must not be shared by threads.
+   TFiller MakeFiller() { return TFiller(*this); }
+   TH1 *GetHist() const { return fHist; }
+};
+
+#endif
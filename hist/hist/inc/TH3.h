@@ -30,6 +30,8 @@ class TProfile2D;
 
 class TH3 : public TH1, public TAtt3D {
 
+   friend class TH1ConcurrentFill;
+
 protected:
    Double_t     fTsumwy;          ///< Total Sum of weight*Y
    Double_t     fTsumwy2;         ///< Total Sum of weight*Y*Y
@@ -130,6 +130,7 @@ public:
    Double_t operator()(const Double_t* x, const Double_t* p = nullptr) const;  // Needed for creating TF1
 
    Double_t GetValue(Double_t x) const { return (*this)(x); }
+   void GetValues(UInt_t n, const Double_t *x, Double_t *result) const; ///< Evaluates the estimate at n points
    Double_t GetError(Double_t x) const;
 
    Double_t GetBias(Double_t x) const;
@@ -168,6 +169,9 @@ public:
       TKernel(Double_t weight, TKDE *kde);
       void ComputeAdaptiveWeights();
       Double_t operator()(Double_t x) const;
+      void Evaluate(UInt_t n, const Double_t *x, Double_t *result) const;
+      template <class Kernel>
+      void Evaluate(const Kernel &kernel, UInt_t n, const Double_t *x, Double_t *result) const;
       Double_t GetWeight(Double_t x) const;
       Double_t GetFixedWeight() const;
       const std::vector<Double_t> &GetAdaptiveWeights() const;
@@ -230,6 +230,15 @@ TFitResultPtr HFit::Fit(FitObject * h1, TF1 *f1 , Foption_t & fitOption , const
    }
 
 
+   // with the gradient option, functions based on a formula expression use the gradient generated by
+   // automatic differentiation (Clad) when it can be generated, otherwise TF1::GradientPar is numerical
+   if (fitOption.Gradient && !linear) {
+      TFormula *formula = f1->GetFormula();
+      if (formula && formula->IsValid() && formula->GetNpar() > 0 && !formula->TestBit(TFormula::kLambda) &&
+          !formula->HasGeneratedGradient() && !formula->GenerateGradientPar() && !fitOption.Quiet)
+         Info("Fit", "Cannot generate the gradient of %s, numerical derivatives are used", f1->GetName());
+   }
+
    // set the fit function
    // if option grad is specified use gradient
    if ( (linear || fitOption.Gradient) )
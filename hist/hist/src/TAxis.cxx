@@ -434,6 +434,46 @@ Int_t TAxis::FindFixBin(Double_t x) const
    return bin;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Find the bin numbers of the n abscissas x[0], x[stride], ..., as TAxis::FindFixBin does
+///
+/// The loops have no branches that depend on x, so that the compiler can vectorise the
+/// computation of fix bins; variable bins are found by a branchless binary search.
+
+void TAxis::FindFixBins(Int_t n, const Double_t *x, Int_t *bins, Int_t stride) const
+{
+   const Double_t xmin = fXmin;
+   const Double_t xmax = fXmax;
+   const Int_t nbins = fNbins;
+   if (!fXbins.fN) {
+      const Double_t width = xmax - xmin;
+      for (Int_t i = 0; i < n; ++i) {
+         const Double_t xi = x[i * stride];
+         const bool isUnderflow = xi < xmin;
+         const bool isOverflow = !(xi < xmax); // also catches NaN
+         // Out of range values are replaced by xmin to keep the conversion to int defined
+         const Double_t xc = (isUnderflow || isOverflow) ? xmin : xi;
+         const Int_t bin = 1 + int(nbins * (xc - xmin) / width);
+         bins[i] = isUnderflow ? 0 : (isOverflow ? nbins + 1 : bin);
+      }
+   } else {
+      const Double_t *edges = fXbins.fArray;
+      const Int_t nedges = fXbins.fN;
+      for (Int_t i = 0; i < n; ++i) {
+         const Double_t xi = x[i * stride];
+         // Find the last edge <= xi, assuming edges[0] <= xi
+         const Double_t *base = edges;
+         for (Int_t len = nedges; len > 1;) {
+            const Int_t half = len / 2;
+            base = (base[half] <= xi) ? base + half : base;
+            len -= half;
+         }
+         const Int_t bin = 1 + Int_t(base - edges);
+         bins[i] = (xi < xmin) ? 0 : (!(xi < xmax) ? nbins + 1 : bin);
+      }
+   }
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Return label for bin
 
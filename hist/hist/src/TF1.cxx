@@ -18,6 +18,7 @@
 #include "TF1.h"
 #include "TH1.h"
 #include "TGraph.h"
+#include "TSpline.h"
 #include "TVirtualPad.h"
 #include "TStyle.h"
 #include "TRandom.h"
@@ -31,6 +32,7 @@
 #include "TF1NormSum.h"
 #include "TF1Convolution.h"
 #include "TVirtualMutex.h"
+#include "ROOT/TDetachedObjectsGuard.hxx"
 #include "Math/WrappedFunction.h"
 #include "Math/WrappedTF1.h"
 #include "Math/BrentRootFinder.h"
@@ -802,9 +804,10 @@ TF1::TF1(const char *name, ROOT::Math::ParamFunctor f, Double_t xmin, Double_t x
 
 void TF1::DoInitialize(EAddToList addToGlobalList)
 {
-   // add to global list of functions if default adding is on OR if bit is set
+   // add to global list of functions if default adding is on OR if bit is set,
+   // but never in the scope of a ROOT::TDetachedObjectsGuard
    bool doAdd = ((addToGlobalList == EAddToList::kDefault && fgAddToGlobList)
-                 || addToGlobalList == EAddToList::kAdd);
+                 || addToGlobalList == EAddToList::kAdd) && !ROOT::TDetachedObjectsGuard::IsActive();
    if (doAdd && gROOT) {
       SetBit(kNotGlobal, kFALSE);
       R__LOCKGUARD(gROOTMutex);
@@ -954,6 +957,7 @@ TF1 &TF1::operator=(const TF1 &rhs)
 TF1::~TF1()
 {
    if (fHistogram) delete fHistogram;
+   delete fInterpolation;
 
    // this was before in TFormula destructor
    {
@@ -1032,6 +1036,9 @@ void TF1::Copy(TObject &obj) const
    ((TF1 &)obj).fMethodCall = 0;
    ((TF1 &)obj).fNormalized = fNormalized;
    ((TF1 &)obj).fNormIntegral = fNormIntegral;
+   ((TF1 &)obj).fInterpolationTol = fInterpolationTol;
+   delete ((TF1 &)obj).fInterpolation;
+   ((TF1 &)obj).fInterpolation = nullptr;
    ((TF1 &)obj).fFormula   = 0;
 
    if (fFormula) assert(fFormula->GetNpar() == fNpar);
@@ -1470,6 +1477,16 @@ Double_t TF1::EvalPar(const Double_t *x, const Double_t *params)
 {
    //fgCurrent = this;
 
+   // use the interpolation table in the function range, rebuilt when the parameters have changed
+   if (fInterpolationTol > 0 && !fInBuildInterpolation && fNdim == 1 && x[0] >= fXmin && x[0] <= fXmax) {
+      const Double_t *pars = params ? params : GetParameters();
+      if (!fInterpolation ||
+          (fNpar > 0 && pars && !std::equal(pars, pars + fNpar, fInterpolationParams.begin())))
+         BuildInterpolation(pars);
+      if (fInterpolation)
+         return fInterpolation->Eval(x[0]);
+   }
+
    if (fType == EFType::kFormula) {
       assert(fFormula);
 
@@ -1529,6 +1546,27 @@ Double_t TF1::EvalPar(const Double_t *x, const Double_t *params)
    return result;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Evaluate this function at the n points of array x, stored point after point
+/// (x[i * GetNdim() + d]), and write the n values into array result.
+/// Formula based functions are evaluated with TFormula::EvalParBatch, which
+/// compiles the loop over the points; the other types call EvalPar per point.
+
+void TF1::EvalParBatch(Int_t n, const Double_t *x, Double_t *result, const Double_t *params)
+{
+   if (fType == EFType::kFormula) {
+      assert(fFormula);
+      fFormula->EvalParBatch(n, x, result, params);
+      if (fNormalized && fNormIntegral != 0) {
+         for (Int_t i = 0; i < n; ++i)
+            result[i] /= fNormIntegral;
+      }
+      return;
+   }
+   for (Int_t i = 0; i < n; ++i)
+      result[i] = EvalPar(x + i * fNdim, params);
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Execute action corresponding to one event.
 ///
@@ -3441,6 +3479,118 @@ void TF1::SetNpx(Int_t npx)
    }
    Update();
 }
+////////////////////////////////////////////////////////////////////////////////
+/// Evaluate this 1-dim function in its range from an interpolation table.
+///
+/// This is meant for expensive functions, for example convolutions (TF1Convolution)
+/// or functions computing numerical integrals, which are evaluated many times at nearby points.
+/// The function is tabulated on an adaptive grid and interpolated with a cubic spline (TSpline3):
+/// starting from fNpx equidistant intervals, an interval is split in two as long as at its
+/// midpoint the spline differs from the function by more than tolerance times the maximum
+/// absolute value of the function, up to 65536 knots.
+///
+/// The table is built at the first evaluation and it is built again when the parameters
+/// change, also when EvalPar is called with other parameter values as in a fit, or when
+/// the range or fNpx change. All the evaluations in the range, therefore also GetRandom,
+/// Integral and the drawing, use the table; outside the range the function is evaluated
+/// as usual. A tolerance <= 0 switches the interpolation off.
+
+void TF1::SetInterpolation(Double_t tolerance)
+{
+   if (tolerance > 0 && fNdim != 1) {
+      Warning("SetInterpolation", "interpolation is supported only for 1-dim functions");
+      return;
+   }
+   fInterpolationTol = std::max(tolerance, 0.);
+   Update();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Build the interpolation table used by EvalPar, see SetInterpolation.
+/// In case the function is not finite in its range the interpolation is switched off.
+
+Bool_t TF1::BuildInterpolation(const Double_t *params)
+{
+   const size_t maxKnots = 1 << 16;
+
+   delete fInterpolation;
+   fInterpolation = nullptr;
+   if (fNpar > 0 && params)
+      fInterpolationParams.assign(params, params + fNpar);
+   else
+      fInterpolationParams.clear();
+   const Double_t *pars = fInterpolationParams.empty() ? nullptr : fInterpolationParams.data();
+
+   fInBuildInterpolation = true;
+   bool isFinite = true;
+   Double_t scale = 0;
+   auto eval = [&](Double_t x) {
+      Double_t y = EvalPar(&x, pars);
+      isFinite &= std::isfinite(y);
+      scale = std::max(scale, std::abs(y));
+      return y;
+   };
+
+   // knots and flags of the intervals still to be checked
+   const size_t n0 = std::max(4, std::min(fNpx, Int_t(maxKnots / 4)));
+   std::vector<Double_t> xk(n0 + 1), yk(n0 + 1);
+   for (size_t i = 0; i <= n0; ++i) {
+      xk[i] = (i == n0) ? fXmax : fXmin + i * (fXmax - fXmin) / n0;
+      yk[i] = eval(xk[i]);
+   }
+   std::vector<bool> toCheck(n0, true);
+
+   std::vector<Double_t> xn, yn;
+   std::vector<bool> toCheckNew;
+   while (isFinite) {
+      TSpline3 spline("interpolation", xk.data(), yk.data(), xk.size());
+      xn.clear();
+      yn.clear();
+      toCheckNew.clear();
+      for (size_t i = 0; i + 1 < xk.size(); ++i) {
+         xn.push_back(xk[i]);
+         yn.push_back(yk[i]);
+         if (!toCheck[i]) {
+            toCheckNew.push_back(false);
+            continue;
+         }
+         const Double_t xm = 0.5 * (xk[i] + xk[i + 1]);
+         const Double_t ym = eval(xm);
+         if (std::abs(spline.Eval(xm) - ym) > fInterpolationTol * (scale > 0 ? scale : 1.)) {
+            xn.push_back(xm);
+            yn.push_back(ym);
+            toCheckNew.push_back(true);
+            toCheckNew.push_back(true);
+         } else {
+            toCheckNew.push_back(false);
+         }
+      }
+      xn.push_back(xk.back());
+      yn.push_back(yk.back());
+
+      const bool isConverged = xn.size() == xk.size();
+      if (isConverged || xn.size() > maxKnots) {
+         if (!isConverged)
+            Warning("BuildInterpolation", "tolerance %g not reached with %d knots", fInterpolationTol,
+                    int(xn.size()));
+         fInterpolation = new TSpline3("interpolation", xn.data(), yn.data(), xn.size());
+         break;
+      }
+      std::swap(xk, xn);
+      std::swap(yk, yn);
+      std::swap(toCheck, toCheckNew);
+   }
+   fInBuildInterpolation = false;
+
+   if (!isFinite) {
+      Warning("BuildInterpolation", "function %s is not finite in its range, interpolation is switched off",
+              GetName());
+      fInterpolationTol = 0;
+      return kFALSE;
+   }
+   return kTRUE;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Set name of parameter number ipar
 
@@ -3611,6 +3761,8 @@ void TF1::Update()
 {
    delete fHistogram;
    fHistogram = 0;
+   delete fInterpolation;
+   fInterpolation = nullptr;
    if (!fIntegral.empty()) {
       fIntegral.clear();
       fAlpha.clear();
@@ -3633,6 +3785,9 @@ void TF1::Update()
 
       fComposition->Update(); // should not be necessary, but just to be safe
    }
+   // the interpolation table built by the normalization integral contains the not-normalized values
+   delete fInterpolation;
+   fInterpolation = nullptr;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
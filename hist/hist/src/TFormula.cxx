@@ -23,6 +23,7 @@
 #include "TRegexp.h"
 
 #include "ROOT/StringUtils.hxx"
+#include "ROOT/TDetachedObjectsGuard.hxx"
 
 #include <array>
 #include <cassert>
@@ -494,6 +495,8 @@ TFormula::TFormula(const char *name, const char *formula, bool addToGlobList, bo
 #ifndef R__HAS_VECCORE
    fVectorized = false;
 #endif
+   if (ROOT::TDetachedObjectsGuard::IsActive())
+      addToGlobList = false;
 
    FillDefaults();
 
@@ -539,6 +542,8 @@ TFormula::TFormula(const char *name, const char *formula, int ndim, int npar, bo
    fGradFuncPtr = nullptr;
    fHessFuncPtr = nullptr;
 
+   if (ROOT::TDetachedObjectsGuard::IsActive())
+      addToGlobList = false;
 
    fNdim = ndim;
    for (int i = 0; i < npar; ++i) {
@@ -578,6 +583,9 @@ TFormula::TFormula(const TFormula &formula) :
 {
    formula.TFormula::Copy(*this);
 
+   if (ROOT::TDetachedObjectsGuard::IsActive())
+      SetBit(TFormula::kNotGlobal);
+
    if (!TestBit(TFormula::kNotGlobal) && gROOT ) {
       R__LOCKGUARD(gROOTMutex);
       TFormula *old = (TFormula*)gROOT->GetListOfFunctions()->FindObject(formula.GetName());
@@ -758,6 +766,8 @@ void TFormula::Copy(TObject &obj) const
    fnew.fHessGenerationInput = fHessGenerationInput;
    fnew.fGradFuncPtr = fGradFuncPtr;
    fnew.fHessFuncPtr = fHessFuncPtr;
+   fnew.fBatchGenerationInput = fBatchGenerationInput;
+   fnew.fBatchFuncPtr = fBatchFuncPtr;
 
 }
 
@@ -774,6 +784,8 @@ void TFormula::Clear(Option_t * )
    fClingName = "";
 
    fMethod.reset();
+   fBatchGenerationInput.clear();
+   fBatchFuncPtr = nullptr;
 
    fClingVariables.clear();
    fClingParameters.clear();
@@ -3309,8 +3321,15 @@ void TFormula::GradientPar(const Double_t *x, TFormula::CladStorage& result)
 /// a buffer with a size at least equal to the number of parameters.
 /// Note that the result buffer needs to be initialized to zero before passed to this function.
 void TFormula::GradientPar(const Double_t *x, Double_t *result) {
+   GradientPar(x, nullptr, result);
+}
+
+/// Compute the gradient with respect to the parameters at the given parameter
+/// values; if params is nullptr the stored parameters are used.
+/// Note that the result buffer needs to be initialized to zero before passed to this function.
+void TFormula::GradientPar(const Double_t *x, const Double_t *params, Double_t *result) {
    const Double_t *vars = (x) ? x : fClingVariables.data();
-   const Double_t *pars = (fNpar <= 0) ? nullptr : fClingParameters.data();
+   const Double_t *pars = (fNpar <= 0) ? nullptr : ((params) ? params : fClingParameters.data());
    CallCladFunction(fGradFuncPtr, vars, pars, result, fNpar);
 }
 
@@ -3345,6 +3364,86 @@ bool TFormula::GenerateHessianPar()
    return true;
 }
 
+/// returns true on success.
+bool TFormula::GenerateEvalParBatch()
+{
+   R__LOCKGUARD(gROOTMutex);
+   // We already have generated the loop.
+   if (fBatchFuncPtr)
+      return true;
+
+   // A previous generation failed, or there is no compiled scalar function to call from the loop
+   if (!fBatchGenerationInput.empty() || !fClingInitialized || fClingName.IsNull() || fVectorized ||
+       TestBit(TFormula::kLambda))
+      return false;
+
+   // The arguments of the formula function follow the prototype built in ProcessFormula
+   std::string arguments;
+   if (fNdim > 0 || fNpar > 0)
+      arguments = (fNdim > 0) ? "x + i * " + std::to_string(fNdim) : std::string("x");
+   if (fNpar > 0)
+      arguments += ", p";
+
+   const std::string funcName = GetBatchFuncName();
+   fBatchGenerationInput = "#pragma cling optimize(2)\n"
+                           "void " + funcName + "(Int_t n, Double_t *x, Double_t *p, Double_t *r) {\n"
+                           "   for (Int_t i = 0; i < n; ++i)\n"
+                           "      r[i] = " + fClingName.Data() + "(" + arguments + ");\n"
+                           "}";
+
+   // As for the gradient, formulas with an identical expression share the same loop
+   if (!functionExists(funcName) && !gInterpreter->Declare(fBatchGenerationInput.c_str()))
+      return false;
+
+   std::unique_ptr<TMethodCall> method(new TMethodCall());
+   method->InitWithPrototype(funcName.c_str(), "Int_t,Double_t*,Double_t*,Double_t*");
+   if (!method->IsValid()) {
+      Error("GenerateEvalParBatch", "Can't compile the batch evaluation function %s", funcName.c_str());
+      return false;
+   }
+   fBatchFuncPtr = prepareFuncPtr(method.get());
+   return fBatchFuncPtr;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Evaluate the formula on n points with a single call into the compiled code.
+///
+/// \param[in] n - The number of points.
+/// \param[in] x - The coordinates of the points, n * GetNdim() values stored point after point
+///                (x[i * ndim + d]); if nullptr the stored variables are used for all points.
+/// \param[out] result - The n values of the formula.
+/// \param[in] params - The parameters, if nullptr the stored parameters are used.
+///
+/// The loop over the points is compiled by Cling the first time (see GenerateEvalParBatch), which removes the
+/// overhead of a call through the interpreter per point. Vectorized formulas and lambda expressions are
+/// evaluated point by point with EvalPar.
+
+void TFormula::EvalParBatch(Int_t n, const Double_t *x, Double_t *result, const Double_t *params) const
+{
+   if (n <= 0)
+      return;
+
+   // The first point goes through EvalPar, which reports invalid formulas and does the lazy initialization
+   result[0] = EvalPar(x, params);
+   if (n == 1 || !fReadyToExecute)
+      return;
+
+   const Bool_t useBatch = !fVectorized && !TestBit(TFormula::kLambda) && (x || fNdim == 0) &&
+                           (fBatchFuncPtr || const_cast<TFormula *>(this)->GenerateEvalParBatch());
+   if (!useBatch) {
+      for (Int_t i = 1; i < n; ++i)
+         result[i] = EvalPar(x ? x + i * fNdim : nullptr, params);
+      return;
+   }
+
+   Int_t nRest = n - 1;
+   double *vars = x ? const_cast<double *>(x + fNdim) : const_cast<double *>(fClingVariables.data());
+   double *pars = params ? const_cast<double *>(params) : const_cast<double *>(fClingParameters.data());
+   double *res = result + 1;
+   void *args[4] = {&nRest, &vars, &pars, &res};
+   (*fBatchFuncPtr)(0, 4, args, /*ret*/ nullptr); // We do not use ret in a return-void func.
+}
+
 void TFormula::HessianPar(const Double_t *x, TFormula::CladStorage& result)
 {
    if (DoEval(x) == TMath::QuietNaN())
@@ -3572,6 +3671,8 @@ void TFormula::ReInitializeEvalMethod() {
       return;
    }
    fMethod.reset();
+   fBatchGenerationInput.clear();
+   fBatchFuncPtr = nullptr;
 
    if (!fLazyInitialization)   Warning("ReInitializeEvalMethod", "Formula is NOT properly initialized - try calling again TFormula::PrepareEvalMethod");
    //else  Info("ReInitializeEvalMethod", "Compile now the formula expression using Cling");
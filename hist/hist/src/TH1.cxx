@@ -9,6 +9,7 @@
  * For the list of contributors see $ROOTSYS/README/CREDITS.             *
  *************************************************************************/
 
+#include <algorithm>
 #include <cstdlib>
 #include <cstring>
 #include <cstdio>
@@ -28,6 +29,7 @@
 #include "TH2.h"
 #include "TH3.h"
 #include "TF2.h"
+#include "ROOT/TDetachedObjectsGuard.hxx"
 #include "TF3.h"
 #include "TPluginManager.h"
 #include "TVirtualPad.h"
@@ -731,10 +733,11 @@ TH1::TH1(const char *name,const char *title,Int_t nbins,const Double_t *xbins)
 
 ////////////////////////////////////////////////////////////////////////////////
 /// Static function: cannot be inlined on Windows/NT.
+/// Returns false in the scope of a ROOT::TDetachedObjectsGuard of the calling thread.
 
 Bool_t TH1::AddDirectoryStatus()
 {
-   return fgAddDirectory;
+   return fgAddDirectory && !ROOT::TDetachedObjectsGuard::IsActive();
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -2713,7 +2716,7 @@ void TH1::Copy(TObject &obj) const
    // will be added to gDirectory independently of the fDirectory stored.
    // and if the AddDirectoryStatus() is false it will not be added to
    // any directory (fDirectory = nullptr)
-   if (fgAddDirectory && gDirectory) {
+   if (AddDirectoryStatus() && gDirectory) {
       gDirectory->Append(&obj);
       ((TH1&)obj).fFunctions->UseRWLock();
       ((TH1&)obj).fDirectory = gDirectory;
@@ -3465,31 +3468,79 @@ void TH1::FillN(Int_t ntimes, const Double_t *x, const Double_t *w, Int_t stride
 ////////////////////////////////////////////////////////////////////////////////
 /// Internal method to fill histogram content from a vector
 /// called directly by TH1::BufferEmpty
+///
+/// The entries are processed in blocks: the bins of a block are found at once by
+/// TAxis::FindFixBins, the statistics are summed locally and the bin contents are
+/// updated afterwards. Blocks with entries outside of an extendable axis are filled
+/// entry by entry, since every such entry can extend the axis.
 
 void TH1::DoFillN(Int_t ntimes, const Double_t *x, const Double_t *w, Int_t stride)
 {
-   Int_t bin,i;
+   constexpr Int_t kBlockSize = 256;
+   Int_t bins[kBlockSize];
 
    fEntries += ntimes;
-   Double_t ww = 1;
-   Int_t nbins   = fXaxis.GetNbins();
-   ntimes *= stride;
-   for (i=0;i<ntimes;i+=stride) {
-      bin =fXaxis.FindBin(x[i]);
-      if (bin <0) continue;
-      if (w) ww = w[i];
-      if (!fSumw2.fN && ww != 1.0 && !TestBit(TH1::kIsNotW))  Sumw2();
-      if (fSumw2.fN) fSumw2.fArray[bin] += ww*ww;
-      AddBinContent(bin, ww);
-      if (bin == 0 || bin > nbins) {
-         if (!GetStatOverflowsBehaviour()) continue;
+   const Bool_t useOverflows = GetStatOverflowsBehaviour();
+   Double_t sumw = 0, sumw2 = 0, sumwx = 0, sumwx2 = 0;
+   for (Int_t first = 0; first < ntimes; first += kBlockSize) {
+      const Int_t n = std::min(kBlockSize, ntimes - first);
+      const Double_t *xb = x + first * stride;
+      const Double_t *wb = w ? w + first * stride : nullptr;
+      Int_t nbins = fXaxis.GetNbins();
+      fXaxis.FindFixBins(n, xb, bins, stride);
+
+      Bool_t hasOutOfRange = kFALSE;
+      for (Int_t i = 0; i < n; ++i)
+         hasOutOfRange |= (bins[i] == 0 || bins[i] > nbins);
+      if (hasOutOfRange && fXaxis.CanExtend()) {
+         for (Int_t i = 0; i < n; ++i) {
+            const Double_t xi = xb[i * stride];
+            const Int_t bin = fXaxis.FindBin(xi);
+            const Double_t ww = wb ? wb[i * stride] : 1.;
+            if (!fSumw2.fN && ww != 1.0 && !TestBit(TH1::kIsNotW))  Sumw2();
+            if (fSumw2.fN) fSumw2.fArray[bin] += ww*ww;
+            AddBinContent(bin, ww);
+            nbins = fXaxis.GetNbins();
+            if ((bin == 0 || bin > nbins) && !useOverflows) continue;
+            sumw   += ww;
+            sumw2  += ww*ww;
+            sumwx  += ww*xi;
+            sumwx2 += ww*xi*xi;
+         }
+         continue;
+      }
+
+      if (wb && !fSumw2.fN && !TestBit(TH1::kIsNotW)) {
+         for (Int_t i = 0; i < n; ++i) {
+            if (wb[i * stride] != 1.0) {
+               Sumw2();
+               break;
+            }
+         }
+      }
+      for (Int_t i = 0; i < n; ++i) {
+         // Entries not entering the statistics are zeroed, also the abscissa which may be infinite
+         const Bool_t inStats = useOverflows || (bins[i] > 0 && bins[i] <= nbins);
+         const Double_t xi = inStats ? xb[i * stride] : 0.;
+         const Double_t z = inStats ? (wb ? wb[i * stride] : 1.) : 0.;
+         sumw   += z;
+         sumw2  += z*z;
+         sumwx  += z*xi;
+         sumwx2 += z*xi*xi;
+      }
+      if (fSumw2.fN) {
+         for (Int_t i = 0; i < n; ++i) {
+            const Double_t ww = wb ? wb[i * stride] : 1.;
+            fSumw2.fArray[bins[i]] += ww*ww;
+         }
       }
-      Double_t z= ww;
-      fTsumw   += z;
-      fTsumw2  += z*z;
-      fTsumwx  += z*x[i];
-      fTsumwx2 += z*x[i]*x[i];
+      for (Int_t i = 0; i < n; ++i)
+         AddBinContent(bins[i], wb ? wb[i * stride] : 1.);
    }
+   fTsumw   += sumw;
+   fTsumw2  += sumw2;
+   fTsumwx  += sumwx;
+   fTsumwx2 += sumwx2;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -3957,7 +4008,7 @@ TFitResultPtr TH1::Fit(const char *fname ,Option_t *option ,Option_t *goption, D
 ///   "R"  | Fit using a fitting range specified in the function range with `TF1::SetRange`.
 ///   "B"  | Use this option when you want to fix or set limits on one or more parameters and the fitting function is a predefined one (e.g gaus, expo,..), otherwise in case of pre-defined functions, some default initial values and limits will be used.
 ///   "C"  | In case of linear fitting, do no calculate the chisquare (saves CPU time).
-///   "G"  | Uses the gradient implemented in `TF1::GradientPar` for the minimization. This allows to use Automatic Differentiation when it is supported by the provided TF1 function.
+///   "G"  | Uses the gradient implemented in `TF1::GradientPar` for the minimization. For functions based on a formula expression, the gradient is generated with Automatic Differentiation (Clad); its evaluation is thread safe and runs in parallel over the bins with "MULTITHREAD".
 ///   "WIDTH" | Scales the histogran bin content by the bin width (useful for variable bins histograms)
 ///   "SERIAL" | Runs in serial mode. By defult if ROOT is built with MT support and MT is enables, the fit is perfomed in multi-thread     - "E"  Perform better Errors estimation using Minos technique
 ///   "MULTITHREAD" | Forces usage of multi-thread execution whenever possible
@@ -0,0 +1,208 @@
+// @(#)root/hist:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include "TH1ConcurrentFill.h"
+#include "TAxis.h"
+#include "TError.h"
+#include "TH1.h"
+#include "TH2.h"
+#include "TH3.h"
+
+#include <algorithm>
+
+////////////////////////////////////////////////////////////////////////////////
+/// Prepares the concurrent fill of hist. A histogram buffer is emptied first, since the fills go directly to the
+/// bins. Profiles and histograms with a non-rectangular binning (TH2Poly) cannot be filled concurrently.
+
+TH1ConcurrentFill::TH1ConcurrentFill(TH1 &hist, std::size_t bufferSize)
+   : fHist(&hist), fDimension(hist.GetDimension()), fBufferSize(std::max<std::size_t>(1, bufferSize)),
+     fUseOverflowsInStats(hist.GetStatOverflowsBehaviour()), fBinLocks(new std::mutex[kNLocks])
+{
+   if (hist.InheritsFrom("TProfile") || hist.InheritsFrom("TProfile2D") || hist.InheritsFrom("TProfile3D") ||
+       hist.InheritsFrom("TH2Poly")) {
+      ::Error("TH1ConcurrentFill", "%s of class %s cannot be filled concurrently", hist.GetName(),
+              hist.ClassName());
+      fHist = nullptr;
+      return;
+   }
+   if (hist.GetBuffer())
+      hist.BufferEmpty(1);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Adds the buffered fills and the local statistics of filler to the histogram.
+
+void TH1ConcurrentFill::Flush(TFiller &filler)
+{
+   if (filler.fFills.empty() && filler.fNEntries == 0)
+      return;
+
+   {
+      std::lock_guard<std::mutex> statsGuard(fStatsLock);
+      // As in TH1::Fill(), weights other than 1 create the sum of squares of weights. No filler may add to the bins
+      // meanwhile.
+      if (filler.fHasWeights && !fHist->fSumw2.fN && !fHist->TestBit(TH1::kIsNotW)) {
+         for (std::size_t i = 0; i < kNLocks; ++i)
+            fBinLocks[i].lock();
+         if (!fHist->fSumw2.fN)
+            fHist->Sumw2();
+         for (std::size_t i = 0; i < kNLocks; ++i)
+            fBinLocks[i].unlock();
+      }
+
+      // The sums are added directly, as in TH1::Fill(). TH1::GetStats() could recompute them from the bin contents,
+      // which other fillers modify meanwhile, and restricted to the axis ranges set by the user.
+      const Double_t *stats = filler.fStats;
+      fHist->fTsumw += stats[0];
+      fHist->fTsumw2 += stats[1];
+      fHist->fTsumwx += stats[2];
+      fHist->fTsumwx2 += stats[3];
+      if (fDimension == 2) {
+         auto hist2 = static_cast<TH2 *>(fHist);
+         hist2->fTsumwy += stats[4];
+         hist2->fTsumwy2 += stats[5];
+         hist2->fTsumwxy += stats[6];
+      } else if (fDimension == 3) {
+         auto hist3 = static_cast<TH3 *>(fHist);
+         hist3->fTsumwy += stats[4];
+         hist3->fTsumwy2 += stats[5];
+         hist3->fTsumwxy += stats[6];
+         hist3->fTsumwz += stats[7];
+         hist3->fTsumwz2 += stats[8];
+         hist3->fTsumwxz += stats[9];
+         hist3->fTsumwyz += stats[10];
+      }
+      fHist->fEntries += filler.fNEntries;
+   }
+
+   // Group the fills by lock, so that every lock is taken once per flush
+   auto &fills = filler.fFills;
+   std::sort(fills.begin(), fills.end(), [](const std::pair<Int_t, Double_t> &a, const std::pair<Int_t, Double_t> &b) {
+      return a.first % kNLocks < b.first % kNLocks;
+   });
+   for (std::size_t begin = 0; begin < fills.size();) {
+      const std::size_t lockIdx = fills[begin].first % kNLocks;
+      std::size_t end = begin;
+      std::lock_guard<std::mutex> binGuard(fBinLocks[lockIdx]);
+      const bool hasSumw2 = fHist->fSumw2.fN > 0;
+      for (; end < fills.size() && fills[end].first % kNLocks == lockIdx; ++end) {
+         fHist->AddBinContent(fills[end].first, fills[end].second);
+         if (hasSumw2)
+            fHist->fSumw2.fArray[fills[end].first] += fills[end].second * fills[end].second;
+      }
+      begin = end;
+   }
+
+   fills.clear();
+   std::fill(std::begin(filler.fStats), std::end(filler.fStats), 0.);
+   filler.fNEntries = 0;
+   filler.fHasWeights = false;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+TH1ConcurrentFill::TFiller::TFiller(TH1ConcurrentFill &concurrentFill) : fConcurrentFill(&concurrentFill)
+{
+   fFills.reserve(concurrentFill.fBufferSize);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+TH1ConcurrentFill::TFiller::TFiller(TFiller &&other)
+   : fConcurrentFill(other.fConcurrentFill), fFills(std::move(other.fFills)), fNEntries(other.fNEntries),
+     fHasWeights(other.fHasWeights)
+{
+   std::copy(std::begin(other.fStats), std::end(other.fStats), std::begin(fStats));
+   std::fill(std::begin(other.fStats), std::end(other.fStats), 0.);
+   other.fFills.clear();
+   other.fNEntries = 0;
+   other.fHasWeights = false;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Fills a one-dimensional histogram, see TH1::Fill(Double_t, Double_t).
+
+void TH1ConcurrentFill::TFiller::Fill(Double_t x, Double_t w)
+{
+   const TH1 *hist = fConcurrentFill->fHist;
+   if (!hist)
+      return;
+   const Int_t binx = hist->GetXaxis()->FindFixBin(x);
+   fNEntries++;
+   if (fConcurrentFill->fUseOverflowsInStats || (binx > 0 && binx <= hist->GetXaxis()->GetNbins())) {
+      fStats[0] += w;
+      fStats[1] += w * w;
+      fStats[2] += w * x;
+      fStats[3] += w * x * x;
+   }
+   Buffer(binx, w);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Fills a two-dimensional histogram, see TH2::Fill(Double_t, Double_t, Double_t).
+
+void TH1ConcurrentFill::TFiller::Fill(Double_t x, Double_t y, Double_t w)
+{
+   const TH1 *hist = fConcurrentFill->fHist;
+   if (!hist)
+      return;
+   const Int_t binx = hist->GetXaxis()->FindFixBin(x);
+   const Int_t biny = hist->GetYaxis()->FindFixBin(y);
+   fNEntries++;
+   if (fConcurrentFill->fUseOverflowsInStats || (binx > 0 && binx <= hist->GetXaxis()->GetNbins() && biny > 0 &&
+                                                 biny <= hist->GetYaxis()->GetNbins())) {
+      fStats[0] += w;
+      fStats[1] += w * w;
+      fStats[2] += w * x;
+      fStats[3] += w * x * x;
+      fStats[4] += w * y;
+      fStats[5] += w * y * y;
+      fStats[6] += w * x * y;
+   }
+   Buffer(hist->GetBin(binx, biny), w);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Fills a three-dimensional histogram, see TH3::Fill(Double_t, Double_t, Double_t, Double_t).
+
+void TH1ConcurrentFill::TFiller::Fill(Double_t x, Double_t y, Double_t z, Double_t w)
+{
+   const TH1 *hist = fConcurrentFill->fHist;
+   if (!hist)
+      return;
+   const Int_t binx = hist->GetXaxis()->FindFixBin(x);
+   const Int_t biny = hist->GetYaxis()->FindFixBin(y);
+   const Int_t binz = hist->GetZaxis()->FindFixBin(z);
+   fNEntries++;
+   if (fConcurrentFill->fUseOverflowsInStats ||
+       (binx > 0 && binx <= hist->GetXaxis()->GetNbins() && biny > 0 && biny <= hist->GetYaxis()->GetNbins() &&
+        binz > 0 && binz <= hist->GetZaxis()->GetNbins())) {
+      fStats[0] += w;
+      fStats[1] += w * w;
+      fStats[2] += w * x;
+      fStats[3] += w * x * x;
+      fStats[4] += w * y;
+      fStats[5] += w * y * y;
+      fStats[6] += w * x * y;
+      fStats[7] += w * z;
+      fStats[8] += w * z * z;
+      fStats[9] += w * x * z;
+      fStats[10] += w * y * z;
+   }
+   Buffer(hist->GetBin(binx, biny, binz), w);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void TH1ConcurrentFill::TFiller::Flush()
+{
+   if (fConcurrentFill->fHist)
+      fConcurrentFill->Flush(*this);
+}
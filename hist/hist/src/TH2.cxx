@@ -28,6 +28,8 @@
 #include "TVirtualHistPainter.h"
 #include "snprintf.h"
 
+#include <algorithm>
+
 ClassImp(TH2);
 
 /** \addtogroup Histograms
@@ -618,32 +620,96 @@ void TH2::FillN(Int_t ntimes, const Double_t *x, const Double_t *y, const Double
          return;
    }
 
-   Double_t ww = 1;
-   for (i=ifirst;i<ntimes;i+=stride) {
-      fEntries++;
-      binx = fXaxis.FindBin(x[i]);
-      biny = fYaxis.FindBin(y[i]);
-      if (binx <0 || biny <0) continue;
-      bin  = biny*(fXaxis.GetNbins()+2) + binx;
-      if (w) ww = w[i];
-      if (!fSumw2.fN && ww != 1.0 && !TestBit(TH1::kIsNotW))  Sumw2();
-      if (fSumw2.fN) fSumw2.fArray[bin] += ww*ww;
-      AddBinContent(bin,ww);
-      if (binx == 0 || binx > fXaxis.GetNbins()) {
-         if (!GetStatOverflowsBehaviour()) continue;
+   // As in TH1::DoFillN, the bins of blocks of entries are found at once and the statistics are summed locally
+   constexpr Int_t kBlockSize = 256;
+   Int_t binsx[kBlockSize];
+   Int_t binsy[kBlockSize];
+   const Bool_t canExtend = fXaxis.CanExtend() || fYaxis.CanExtend();
+   const Bool_t useOverflows = GetStatOverflowsBehaviour();
+   Double_t sumw = 0, sumw2 = 0, sumwx = 0, sumwx2 = 0, sumwy = 0, sumwy2 = 0, sumwxy = 0;
+   ntimes = (ntimes - ifirst) / stride;
+   x += ifirst;
+   y += ifirst;
+   if (w) w += ifirst;
+   fEntries += ntimes;
+   for (Int_t first = 0; first < ntimes; first += kBlockSize) {
+      const Int_t n = std::min(kBlockSize, ntimes - first);
+      const Double_t *xb = x + first * stride;
+      const Double_t *yb = y + first * stride;
+      const Double_t *wb = w ? w + first * stride : nullptr;
+      Int_t nbinsx = fXaxis.GetNbins();
+      Int_t nbinsy = fYaxis.GetNbins();
+      fXaxis.FindFixBins(n, xb, binsx, stride);
+      fYaxis.FindFixBins(n, yb, binsy, stride);
+
+      Bool_t hasOutOfRange = kFALSE;
+      for (i = 0; i < n; ++i)
+         hasOutOfRange |= (binsx[i] == 0 || binsx[i] > nbinsx || binsy[i] == 0 || binsy[i] > nbinsy);
+      if (hasOutOfRange && canExtend) {
+         for (i = 0; i < n; ++i) {
+            const Double_t xi = xb[i * stride];
+            const Double_t yi = yb[i * stride];
+            binx = fXaxis.FindBin(xi);
+            biny = fYaxis.FindBin(yi);
+            nbinsx = fXaxis.GetNbins();
+            nbinsy = fYaxis.GetNbins();
+            bin  = biny*(nbinsx+2) + binx;
+            const Double_t ww = wb ? wb[i * stride] : 1.;
+            if (!fSumw2.fN && ww != 1.0 && !TestBit(TH1::kIsNotW))  Sumw2();
+            if (fSumw2.fN) fSumw2.fArray[bin] += ww*ww;
+            AddBinContent(bin,ww);
+            if ((binx == 0 || binx > nbinsx || biny == 0 || biny > nbinsy) && !useOverflows) continue;
+            sumw   += ww;
+            sumw2  += ww*ww;
+            sumwx  += ww*xi;
+            sumwx2 += ww*xi*xi;
+            sumwy  += ww*yi;
+            sumwy2 += ww*yi*yi;
+            sumwxy += ww*xi*yi;
+         }
+         continue;
       }
-      if (biny == 0 || biny > fYaxis.GetNbins()) {
-         if (!GetStatOverflowsBehaviour()) continue;
+
+      if (wb && !fSumw2.fN && !TestBit(TH1::kIsNotW)) {
+         for (i = 0; i < n; ++i) {
+            if (wb[i * stride] != 1.0) {
+               Sumw2();
+               break;
+            }
+         }
+      }
+      for (i = 0; i < n; ++i) {
+         // Entries not entering the statistics are zeroed, also the coordinates which may be infinite
+         const Bool_t inStats =
+            useOverflows || (binsx[i] > 0 && binsx[i] <= nbinsx && binsy[i] > 0 && binsy[i] <= nbinsy);
+         const Double_t xi = inStats ? xb[i * stride] : 0.;
+         const Double_t yi = inStats ? yb[i * stride] : 0.;
+         const Double_t z = inStats ? (wb ? wb[i * stride] : 1.) : 0.;
+         sumw   += z;
+         sumw2  += z*z;
+         sumwx  += z*xi;
+         sumwx2 += z*xi*xi;
+         sumwy  += z*yi;
+         sumwy2 += z*yi*yi;
+         sumwxy += z*xi*yi;
+         binsx[i] += binsy[i] * (nbinsx + 2);
+      }
+      if (fSumw2.fN) {
+         for (i = 0; i < n; ++i) {
+            const Double_t ww = wb ? wb[i * stride] : 1.;
+            fSumw2.fArray[binsx[i]] += ww*ww;
+         }
       }
-      Double_t z= ww; //(ww > 0 ? ww : -ww);
-      fTsumw   += z;
-      fTsumw2  += z*z;
-      fTsumwx  += z*x[i];
-      fTsumwx2 += z*x[i]*x[i];
-      fTsumwy  += z*y[i];
-      fTsumwy2 += z*y[i]*y[i];
-      fTsumwxy += z*x[i]*y[i];
+      for (i = 0; i < n; ++i)
+         AddBinContent(binsx[i], wb ? wb[i * stride] : 1.);
    }
+   fTsumw   += sumw;
+   fTsumw2  += sumw2;
+   fTsumwx  += sumwx;
+   fTsumwx2 += sumwx2;
+   fTsumwy  += sumwy;
+   fTsumwy2 += sumwy2;
+   fTsumwxy += sumwxy;
 }
 
 
@@ -24,6 +24,9 @@
 #include "TError.h"
 #include "TMath.h"
 #include "TObjString.h"
+#include "THistImtHelper.h"
+
+#include <vector>
 
 ClassImp(TH3);
 
@@ -1939,24 +1942,19 @@ TH1D *TH3::DoProject1D(const char* name, const char * title, const TAxis* projX,
    }
    R__ASSERT(out1 != nullptr && out2 != nullptr);
 
-   Int_t *refX = 0, *refY = 0, *refZ = 0;
-   Int_t ixbin, out1bin, out2bin;
-   if (projX == GetXaxis()) {
-      refX = &ixbin;
-      refY = &out1bin;
-      refZ = &out2bin;
-   }
+   // Positions of the projected and of the integrated bin numbers in the (x, y, z) bin numbers
+   Int_t iProj = 0, iOut1 = 1, iOut2 = 2;
    if (projX == GetYaxis()) {
-      refX = &out1bin;
-      refY = &ixbin;
-      refZ = &out2bin;
+      iProj = 1;
+      iOut1 = 0;
+      iOut2 = 2;
    }
    if (projX == GetZaxis()) {
-      refX = &out1bin;
-      refY = &out2bin;
-      refZ = &ixbin;
+      iProj = 2;
+      iOut1 = 0;
+      iOut2 = 1;
    }
-   R__ASSERT (refX != 0 && refY != 0 && refZ != 0);
+   R__ASSERT (projX == GetXaxis() || projX == GetYaxis() || projX == GetZaxis());
 
    // Fill the projected histogram excluding underflow/overflows if considered in the option
    // if specified in the option (by default they considered)
@@ -1975,17 +1973,21 @@ TH1D *TH3::DoProject1D(const char* name, const char * title, const TAxis* projX,
    if (useUF && !out2->TestBit(TAxis::kAxisRange) )  out2min -= 1;
    if (useOF && !out2->TestBit(TAxis::kAxisRange) )  out2max += 1;
 
-   for (ixbin=0;ixbin<=1+projX->GetNbins();ixbin++) {
-      if ( projX->TestBit(TAxis::kAxisRange) && ( ixbin < ixmin || ixbin > ixmax )) continue;
-
+   // The sums for the bins of projX are independent, with implicit MT they are computed in parallel
+   const Int_t nProjBins = projX->GetNbins() + 2;
+   std::vector<Double_t> conts(nProjBins, 0.);
+   std::vector<Double_t> errs2(nProjBins, 0.);
+   auto sumBins = [&](Int_t ixbin) {
+      Int_t bins[3];
+      bins[iProj] = ixbin;
       Double_t cont = 0;
       Double_t err2 = 0;
 
       // loop on the bins to be integrated (outbin should be called inbin)
-      for (out1bin = out1min; out1bin <= out1max; out1bin++) {
-         for (out2bin = out2min; out2bin <= out2max; out2bin++) {
+      for (bins[iOut1] = out1min; bins[iOut1] <= out1max; bins[iOut1]++) {
+         for (bins[iOut2] = out2min; bins[iOut2] <= out2max; bins[iOut2]++) {
 
-            Int_t bin = GetBin(*refX, *refY, *refZ);
+            Int_t bin = GetBin(bins[0], bins[1], bins[2]);
 
             // sum the bin contents and errors if needed
             cont += RetrieveBinContent(bin);
@@ -1995,11 +1997,29 @@ TH1D *TH3::DoProject1D(const char* name, const char * title, const TAxis* projX,
             }
          }
       }
+      conts[ixbin] = cont;
+      errs2[ixbin] = err2;
+   };
+   const Long64_t nSummedBins = Long64_t(nProjBins) * std::max(out1max - out1min + 1, 0) *
+                                std::max(out2max - out2min + 1, 0);
+   const unsigned nTasks =
+      fBuffer ? 1 : std::min<Long64_t>(ROOT::Internal::HistImt::GetNTasks(nSummedBins), nProjBins);
+   ROOT::Internal::HistImt::ForeachTask(nTasks, [&](unsigned task) {
+      const Int_t end = ROOT::Internal::HistImt::GetTaskBegin(task + 1, nTasks, nProjBins);
+      for (Int_t ixbin = ROOT::Internal::HistImt::GetTaskBegin(task, nTasks, nProjBins); ixbin < end; ++ixbin) {
+         if ( projX->TestBit(TAxis::kAxisRange) && ( ixbin < ixmin || ixbin > ixmax )) continue;
+         sumBins(ixbin);
+      }
+   });
+
+   for (Int_t ixbin=0;ixbin<=1+projX->GetNbins();ixbin++) {
+      if ( projX->TestBit(TAxis::kAxisRange) && ( ixbin < ixmin || ixbin > ixmax )) continue;
+
       Int_t ix    = h1->FindBin( projX->GetBinCenter(ixbin) );
-      h1->SetBinContent(ix ,cont);
-      if (computeErrors) h1->SetBinError(ix, TMath::Sqrt(err2) );
+      h1->SetBinContent(ix ,conts[ixbin]);
+      if (computeErrors) h1->SetBinError(ix, TMath::Sqrt(errs2[ixbin]) );
       // sum all content
-      totcont += cont;
+      totcont += conts[ixbin];
 
    }
 
@@ -2179,15 +2199,12 @@ TH2D *TH3::DoProject2D(const char* name, const char * title, const TAxis* projX,
       out = GetZaxis();
    }
 
-   Int_t *refX = 0, *refY = 0, *refZ = 0;
-   Int_t ixbin, iybin, outbin;
-   if ( projX == GetXaxis() && projY == GetYaxis() ) { refX = &ixbin;  refY = &iybin;  refZ = &outbin; }
-   if ( projX == GetYaxis() && projY == GetXaxis() ) { refX = &iybin;  refY = &ixbin;  refZ = &outbin; }
-   if ( projX == GetXaxis() && projY == GetZaxis() ) { refX = &ixbin;  refY = &outbin; refZ = &iybin;  }
-   if ( projX == GetZaxis() && projY == GetXaxis() ) { refX = &iybin;  refY = &outbin; refZ = &ixbin;  }
-   if ( projX == GetYaxis() && projY == GetZaxis() ) { refX = &outbin; refY = &ixbin;  refZ = &iybin;  }
-   if ( projX == GetZaxis() && projY == GetYaxis() ) { refX = &outbin; refY = &iybin;  refZ = &ixbin;  }
-   R__ASSERT (refX != 0 && refY != 0 && refZ != 0);
+   // Positions of the bin numbers of projX, projY and of the integrated axis in the (x, y, z) bin numbers
+   auto axisPosition = [this](const TAxis *axis) { return axis == GetXaxis() ? 0 : (axis == GetYaxis() ? 1 : 2); };
+   const Int_t iProjX = axisPosition(projX);
+   const Int_t iProjY = axisPosition(projY);
+   const Int_t iOut = 3 - iProjX - iProjY;
+   R__ASSERT (iProjX != iProjY);
 
    // Fill the projected histogram excluding underflow/overflows if considered in the option
    // if specified in the option (by default they considered)
@@ -2201,21 +2218,25 @@ TH2D *TH3::DoProject2D(const char* name, const char * title, const TAxis* projX,
    if (useUF && !out->TestBit(TAxis::kAxisRange) )  outmin -= 1;
    if (useOF && !out->TestBit(TAxis::kAxisRange) )  outmax += 1;
 
-   for (ixbin=0;ixbin<=1+projX->GetNbins();ixbin++) {
-      if ( projX->TestBit(TAxis::kAxisRange) && ( ixbin < ixmin || ixbin > ixmax )) continue;
-      Int_t ix = h2->GetYaxis()->FindBin( projX->GetBinCenter(ixbin) );
-
-      for (iybin=0;iybin<=1+projY->GetNbins();iybin++) {
+   // The sums for the bins of projX are independent, with implicit MT they are computed in parallel
+   const Int_t nProjXBins = projX->GetNbins() + 2;
+   const Int_t nProjYBins = projY->GetNbins() + 2;
+   std::vector<Double_t> conts(Long64_t(nProjXBins) * nProjYBins, 0.);
+   std::vector<Double_t> errs2(Long64_t(nProjXBins) * nProjYBins, 0.);
+   auto sumBins = [&](Int_t ixbin) {
+      Int_t bins[3];
+      bins[iProjX] = ixbin;
+      for (Int_t iybin=0;iybin<=1+projY->GetNbins();iybin++) {
          if ( projY->TestBit(TAxis::kAxisRange) && ( iybin < iymin || iybin > iymax )) continue;
-         Int_t iy = h2->GetXaxis()->FindBin( projY->GetBinCenter(iybin) );
+         bins[iProjY] = iybin;
 
          Double_t cont = 0;
          Double_t err2 = 0;
 
          // loop on the bins to be integrated (outbin should be called inbin)
-         for (outbin = outmin; outbin <= outmax; outbin++) {
+         for (bins[iOut] = outmin; bins[iOut] <= outmax; bins[iOut]++) {
 
-            Int_t bin = GetBin(*refX,*refY,*refZ);
+            Int_t bin = GetBin(bins[0], bins[1], bins[2]);
 
             // sum the bin contents and errors if needed
             cont += RetrieveBinContent(bin);
@@ -2225,10 +2246,33 @@ TH2D *TH3::DoProject2D(const char* name, const char * title, const TAxis* projX,
             }
 
          }
+         conts[Long64_t(ixbin) * nProjYBins + iybin] = cont;
+         errs2[Long64_t(ixbin) * nProjYBins + iybin] = err2;
+      }
+   };
+   const Long64_t nSummedBins = Long64_t(nProjXBins) * nProjYBins * std::max(outmax - outmin + 1, 0);
+   const unsigned nTasks =
+      fBuffer ? 1 : std::min<Long64_t>(ROOT::Internal::HistImt::GetNTasks(nSummedBins), nProjXBins);
+   ROOT::Internal::HistImt::ForeachTask(nTasks, [&](unsigned task) {
+      const Int_t end = ROOT::Internal::HistImt::GetTaskBegin(task + 1, nTasks, nProjXBins);
+      for (Int_t ixbin = ROOT::Internal::HistImt::GetTaskBegin(task, nTasks, nProjXBins); ixbin < end; ++ixbin) {
+         if ( projX->TestBit(TAxis::kAxisRange) && ( ixbin < ixmin || ixbin > ixmax )) continue;
+         sumBins(ixbin);
+      }
+   });
+
+   for (Int_t ixbin=0;ixbin<=1+projX->GetNbins();ixbin++) {
+      if ( projX->TestBit(TAxis::kAxisRange) && ( ixbin < ixmin || ixbin > ixmax )) continue;
+      Int_t ix = h2->GetYaxis()->FindBin( projX->GetBinCenter(ixbin) );
+
+      for (Int_t iybin=0;iybin<=1+projY->GetNbins();iybin++) {
+         if ( projY->TestBit(TAxis::kAxisRange) && ( iybin < iymin || iybin > iymax )) continue;
+         Int_t iy = h2->GetXaxis()->FindBin( projY->GetBinCenter(iybin) );
 
+         const Double_t cont = conts[Long64_t(ixbin) * nProjYBins + iybin];
          // remember axis are inverted
          h2->SetBinContent(iy , ix, cont);
-         if (computeErrors) h2->SetBinError(iy, ix, TMath::Sqrt(err2) );
+         if (computeErrors) h2->SetBinError(iy, ix, TMath::Sqrt(errs2[Long64_t(ixbin) * nProjYBins + iybin]) );
          // sum all content
          totcont += cont;
 
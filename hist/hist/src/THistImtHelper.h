@@ -0,0 +1,78 @@
+// @(#)root/hist:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+// helper functions used internally to run histogram operations on the implicit MT pool
+
+#ifndef ROOT_THistImtHelper
+#define ROOT_THistImtHelper
+
+#include "RConfigure.h"
+#include "TROOT.h"
+
+#ifdef R__USE_IMT
+#include "ROOT/TSeq.hxx"
+#include "ROOT/TThreadExecutor.hxx"
+#endif
+
+#include <algorithm>
+
+namespace ROOT {
+namespace Internal {
+namespace HistImt {
+
+/// Below this number of visited bins, operations stay on the calling thread
+constexpr Long64_t kMinBinsPerTask = 1 << 16;
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return the number of tasks to split the work on nBins bins into: 1 unless implicit MT is
+/// enabled, at most one task per thread of the pool and per kMinBinsPerTask bins.
+
+inline unsigned GetNTasks(Long64_t nBins)
+{
+#ifdef R__USE_IMT
+   if (ROOT::IsImplicitMTEnabled() && nBins >= 2 * kMinBinsPerTask)
+      return std::min<Long64_t>(ROOT::GetThreadPoolSize(), nBins / kMinBinsPerTask);
+#else
+   (void)nBins;
+#endif
+   return 1;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Call func(task) for every task in [0, nTasks), on the implicit MT pool if nTasks > 1.
+
+template <typename F>
+void ForeachTask(unsigned nTasks, F &&func)
+{
+#ifdef R__USE_IMT
+   if (nTasks > 1) {
+      ROOT::TThreadExecutor pool;
+      pool.Foreach([&func](unsigned task) { func(task); }, ROOT::TSeqU(nTasks), nTasks);
+      return;
+   }
+#endif
+   for (unsigned task = 0; task < nTasks; ++task)
+      func(task);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return the first element of the range of task out of nTasks over [0, n); the range
+/// of the task ends at the first element of task + 1.
+
+inline Long64_t GetTaskBegin(unsigned task, unsigned nTasks, Long64_t n)
+{
+   return n / nTasks * task + std::min<Long64_t>(task, n % nTasks);
+}
+
+} // namespace HistImt
+} // namespace Internal
+} // namespace ROOT
+
+#endif
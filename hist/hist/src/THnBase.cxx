@@ -10,6 +10,7 @@
  *************************************************************************/
 
 #include "THnBase.h"
+#include "THistImtHelper.h"
 
 #include "TAxis.h"
 #include "TBrowser.h"
@@ -31,6 +32,83 @@
 #include "Math/MinimizerOptions.h"
 #include "Math/WrappedMultiTF1.h"
 
+#include <algorithm>
+#include <vector>
+
+namespace {
+
+////////////////////////////////////////////////////////////////////////////////
+/// Project the bins of hn on its dimensions dim into the TH1, TH2 or TH3 hist, as
+/// THnBase::ProjectionAny() does, with the bins of hn split in nTasks ranges that
+/// are processed in parallel. Every task sums into its own copy of the target bins;
+/// the copies are added in the order of the tasks.
+/// Return whether bins outside of the axis ranges were skipped.
+
+Bool_t ProjectToHistImt(const THnBase &hn, TH1 *hist, Int_t ndim, const Int_t *dim, unsigned nTasks,
+                        Bool_t keepTargetAxis, Bool_t wantErrors)
+{
+   const Long64_t nbins = hn.GetNbins();
+   const Int_t ncells = hist->GetNcells();
+   const Bool_t haveErrors = hn.GetCalculateErrors();
+
+   Int_t binOffsets[3] = {0, 0, 0};
+   for (Int_t d = 0; d < ndim; ++d) {
+      const TAxis *axis = hn.GetAxis(dim[d]);
+      // Don't subtract even more if underflow is already included
+      if (!keepTargetAxis && axis->TestBit(TAxis::kAxisRange))
+         binOffsets[d] = std::max(axis->GetFirst() - 1, 0);
+   }
+
+   // Set up the lazily created helpers of hn, e.g. the compact coordinates of THnSparse
+   std::vector<Int_t> firstCoord(hn.GetNdimensions());
+   hn.GetBinContent(0, firstCoord.data());
+
+   std::vector<std::vector<Double_t>> contents(nTasks);
+   std::vector<std::vector<Double_t>> errors2(nTasks);
+   std::vector<char> haveSkipped(nTasks, 0);
+   ROOT::Internal::HistImt::ForeachTask(nTasks, [&](unsigned task) {
+      std::vector<Double_t> &content = contents[task];
+      std::vector<Double_t> &error2 = errors2[task];
+      content.assign(ncells, 0.);
+      if (wantErrors)
+         error2.assign(ncells, 0.);
+      std::vector<Int_t> coord(hn.GetNdimensions());
+      const Long64_t end = ROOT::Internal::HistImt::GetTaskBegin(task + 1, nTasks, nbins);
+      for (Long64_t i = ROOT::Internal::HistImt::GetTaskBegin(task, nTasks, nbins); i < end; ++i) {
+         const Double_t v = hn.GetBinContent(i, coord.data());
+         if (!hn.IsInRange(coord.data())) {
+            haveSkipped[task] = 1;
+            continue;
+         }
+         Int_t bins[3] = {0, 0, 0};
+         for (Int_t d = 0; d < ndim; ++d)
+            bins[d] = coord[dim[d]] - binOffsets[d];
+         const Int_t targetBin = hist->GetBin(bins[0], bins[1], bins[2]);
+         if (wantErrors)
+            error2[targetBin] += haveErrors ? hn.GetBinError2(i) : v;
+         content[targetBin] += v;
+      }
+   });
+
+   for (unsigned task = 1; task < nTasks; ++task) {
+      for (Int_t bin = 0; bin < ncells; ++bin) {
+         contents[0][bin] += contents[task][bin];
+         if (wantErrors)
+            errors2[0][bin] += errors2[task][bin];
+      }
+   }
+   for (Int_t bin = 0; bin < ncells; ++bin) {
+      if (contents[0][bin] == 0. && (!wantErrors || errors2[0][bin] == 0.))
+         continue;
+      if (wantErrors)
+         hist->SetBinError(bin, TMath::Sqrt(errors2[0][bin]));
+      hist->AddBinContent(bin, contents[0][bin]);
+   }
+   return std::find(haveSkipped.begin(), haveSkipped.end(), 1) != haveSkipped.end();
+}
+
+} // anonymous namespace
+
 
 /** \class THnBase
     \ingroup Hist
@@ -620,12 +698,23 @@ TObject* THnBase::ProjectionAny(Int_t ndim, const Int_t* dim,
    Bool_t haveErrors = GetCalculateErrors();
    Bool_t wantErrors = haveErrors || (option && (strchr(option, 'E') || strchr(option, 'e')));
 
+   // Projections to histograms are split in ranges of bins of this for implicit MT; the tasks
+   // together must not use more memory for their target bins than the bins of this
+   unsigned nTasks = 1;
+   if (!wantNDim && hist && GetNbins() > 0) {
+      nTasks = ROOT::Internal::HistImt::GetNTasks(GetNbins());
+      nTasks = std::min<Long64_t>(nTasks, std::max<Long64_t>(1, GetNbins() / hist->GetNcells()));
+   }
+   Bool_t haveSkippedBin = kFALSE;
+   if (nTasks > 1)
+      haveSkippedBin = ProjectToHistImt(*this, hist, ndim, dim, nTasks, keepTargetAxis, wantErrors);
+
    Int_t* bins  = new Int_t[ndim];
    Long64_t myLinBin = 0;
 
    THnIter iter(this, kTRUE /*use axis range*/);
 
-   while ((myLinBin = iter.Next()) >= 0) {
+   while (nTasks == 1 && (myLinBin = iter.Next()) >= 0) {
       Double_t v = GetBinContent(myLinBin);
 
       for (Int_t d = 0; d < ndim; ++d) {
@@ -674,7 +763,7 @@ TObject* THnBase::ProjectionAny(Int_t ndim, const Int_t* dim,
    if (wantNDim) {
       hn->SetEntries(fEntries);
    } else {
-      if (!iter.HaveSkippedBin()) {
+      if (!iter.HaveSkippedBin() && !haveSkippedBin) {
          hist->SetEntries(fEntries);
       } else {
          // re-compute the entries
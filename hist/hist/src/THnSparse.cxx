@@ -16,6 +16,8 @@
 #include "TDataMember.h"
 #include "TDataType.h"
 
+#include <vector>
+
 namespace {
 //______________________________________________________________________________
 //
@@ -409,6 +411,101 @@ THnSparseCompactBinCoord::~THnSparseCompactBinCoord()
    delete [] fCurrentBin;
 }
 
+/** \class THnSparseBinIndex
+THnSparseBinIndex is used internally by THnSparse. It maps the hash of the
+compact coordinate of a filled bin to its linear bin index, in a single hash
+table with open addressing and linear probing: a lookup touches few
+consecutive slots of 16 bytes instead of following the chains of separate
+maps. Compact coordinates of up to 8 bytes are their own hash; longer ones
+can collide, the colliding bins then occupy further slots and are told apart
+by comparing the coordinates stored in the chunks. The table is never
+streamed; it is rebuilt from the chunks after reading.
+*/
+
+class THnSparseBinIndex {
+public:
+   Long64_t GetSize() const { return fSize; }
+   Long64_t GetCapacity() const { return fSlots.size(); }
+   Long64_t GetSlotSize() const { return sizeof(TSlot); }
+
+   /// Return the linear index of the bin with the given hash for which
+   /// matches(linidx) is true, or -1.
+   template <typename MATCHES>
+   Long64_t Find(ULong64_t hash, MATCHES &&matches) const
+   {
+      if (fSlots.empty())
+         return -1;
+      const ULong64_t mask = fSlots.size() - 1;
+      for (ULong64_t i = Mix(hash) & mask;; i = (i + 1) & mask) {
+         const TSlot &slot = fSlots[i];
+         if (slot.fBin < 0)
+            return -1;
+         if (slot.fHash == hash && matches(slot.fBin))
+            return slot.fBin;
+      }
+   }
+
+   /// Add the bin with linear index linidx; it must not be in the table yet.
+   void Add(ULong64_t hash, Long64_t linidx)
+   {
+      Reserve(fSize + 1);
+      const ULong64_t mask = fSlots.size() - 1;
+      ULong64_t i = Mix(hash) & mask;
+      while (fSlots[i].fBin >= 0)
+         i = (i + 1) & mask;
+      fSlots[i].fHash = hash;
+      fSlots[i].fBin = linidx;
+      ++fSize;
+   }
+
+   /// Make room for nbins bins, keeping the table at most half full.
+   void Reserve(Long64_t nbins)
+   {
+      ULong64_t capacity = fSlots.empty() ? 16 : fSlots.size();
+      while (capacity < 2 * (ULong64_t)nbins)
+         capacity *= 2;
+      if (capacity == fSlots.size())
+         return;
+
+      std::vector<TSlot> oldSlots(capacity);
+      std::swap(oldSlots, fSlots);
+      const ULong64_t mask = capacity - 1;
+      for (const TSlot &slot : oldSlots) {
+         if (slot.fBin < 0)
+            continue;
+         ULong64_t i = Mix(slot.fHash) & mask;
+         while (fSlots[i].fBin >= 0)
+            i = (i + 1) & mask;
+         fSlots[i] = slot;
+      }
+   }
+
+   void Clear()
+   {
+      std::vector<TSlot>().swap(fSlots);
+      fSize = 0;
+   }
+
+private:
+   struct TSlot {
+      ULong64_t fHash = 0;
+      Long64_t  fBin = -1; ///< Linear bin index, -1 for an empty slot
+   };
+
+   /// The compact coordinates of neighbouring bins differ in a few low bits
+   /// only; spread them over the whole table (finalizer of splitmix64).
+   static ULong64_t Mix(ULong64_t h)
+   {
+      h = (h ^ (h >> 30)) * 0xbf58476d1ce4e5b9ULL;
+      h = (h ^ (h >> 27)) * 0x94d049bb133111ebULL;
+      return h ^ (h >> 31);
+   }
+
+   std::vector<TSlot> fSlots;
+   Long64_t fSize = 0;
+};
+
+
 /** \class THnSparseArrayChunk
 THnSparseArrayChunk is used internally by THnSparse.
 THnSparse stores its (dynamic size) array of bin coordinates and their
@@ -570,14 +667,12 @@ Translation from an n-dimensional bin coordinate to the linear index within
 the chunks is done by GetBin(). It creates a hash from the compacted bin
 coordinates (the hash of a bin coordinate is the compacted coordinate itself
 if it takes less than 8 bytes, the size of a Long64_t.
-This hash is used to lookup the linear index in the TExMap member fBins;
-the coordinates of the entry fBins points to is compared to the coordinates
-passed to GetBin(). If they do not match, these two coordinates have the same
-hash - which is extremely unlikely but (for the case where the compact bin
-coordinates are larger than 4 bytes) possible. In this case, fBinsContinued
-contains a chain of linear indexes with the same hash. Iterating through this
-chain and comparing each bin coordinates with the one passed to GetBin() will
-retrieve the matching bin.
+This hash is used to lookup the linear index in the open-addressing hash
+table fBinIndex (see THnSparseBinIndex); the coordinates of the bins found
+for the hash are compared to the coordinates passed to GetBin(). Two
+different coordinates can only have the same hash if the compact bin
+coordinates are larger than 8 bytes; this is extremely unlikely, and the
+comparison retrieves the matching bin.
 */
 
 
@@ -587,7 +682,7 @@ ClassImp(THnSparse);
 /// Construct an empty THnSparse.
 
 THnSparse::THnSparse():
-   fChunkSize(1024), fFilledBins(0), fCompactCoord(0)
+   fChunkSize(1024), fFilledBins(0), fBinIndex(new THnSparseBinIndex), fCompactCoord(0)
 {
    fBinContent.SetOwner();
 }
@@ -604,7 +699,7 @@ THnSparse::THnSparse(const char* name, const char* title, Int_t dim,
                      const Int_t* nbins, const Double_t* xmin, const Double_t* xmax,
                      Int_t chunksize):
    THnBase(name, title, dim, nbins, xmin, xmax),
-   fChunkSize(chunksize), fFilledBins(0), fCompactCoord(0)
+   fChunkSize(chunksize), fFilledBins(0), fBinIndex(new THnSparseBinIndex), fCompactCoord(0)
 {
    fCompactCoord = new THnSparseCompactBinCoord(dim, nbins);
    fBinContent.SetOwner();
@@ -614,6 +709,7 @@ THnSparse::THnSparse(const char* name, const char* title, Int_t dim,
 /// Destruct a THnSparse
 
 THnSparse::~THnSparse() {
+   delete fBinIndex;
    delete fCompactCoord;
 }
 
@@ -650,7 +746,7 @@ void THnSparse::InitStorage(Int_t* nbins, Int_t chunkSize)
 }
 
 ////////////////////////////////////////////////////////////////////////////////
-///We have been streamed; set up fBins
+///We have been streamed; set up fBinIndex
 
 void THnSparse::FillExMap()
 {
@@ -658,28 +754,14 @@ void THnSparse::FillExMap()
    THnSparseArrayChunk* chunk = 0;
    THnSparseCoordCompression compactCoord(*GetCompactCoord());
    Long64_t idx = 0;
-   if (2 * GetNbins() > fBins.Capacity())
-      fBins.Expand(3 * GetNbins());
+   fBinIndex->Reserve(GetNbins());
    while ((chunk = (THnSparseArrayChunk*) iChunk())) {
       const Int_t chunkSize = chunk->GetEntries();
       Char_t* buf = chunk->fCoordinates;
       const Int_t singleCoordSize = chunk->fSingleCoordinateSize;
       const Char_t* endbuf = buf + singleCoordSize * chunkSize;
-      for (; buf < endbuf; buf += singleCoordSize, ++idx) {
-         Long64_t hash = compactCoord.GetHashFromBuffer(buf);
-         Long64_t linidx = fBins.GetValue(hash);
-         if (linidx) {
-            Long64_t nextidx = linidx;
-            while (nextidx) {
-               // must be a collision, so go to fBinsContinued.
-               linidx = nextidx;
-               nextidx = fBinsContinued.GetValue(linidx);
-            }
-            fBinsContinued.Add(linidx, idx + 1);
-         } else {
-            fBins.Add(hash, idx + 1);
-         }
-      }
+      for (; buf < endbuf; buf += singleCoordSize, ++idx)
+         fBinIndex->Add(compactCoord.GetHashFromBuffer(buf), idx);
    }
 }
 
@@ -687,12 +769,10 @@ void THnSparse::FillExMap()
 /// Initialize storage for nbins
 
 void THnSparse::Reserve(Long64_t nbins) {
-   if (!fBins.GetSize() && fBinContent.GetSize()) {
+   if (!fBinIndex->GetSize() && fBinContent.GetSize()) {
       FillExMap();
    }
-   if (2 * nbins > fBins.Capacity()) {
-      fBins.Expand(3 * nbins);
-   }
+   fBinIndex->Reserve(nbins);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -790,20 +870,12 @@ Long64_t THnSparse::GetBinIndexForCurrentBin(Bool_t allocate)
 {
    THnSparseCompactBinCoord* cc = GetCompactCoord();
    ULong64_t hash = cc->GetHash();
-   if (fBinContent.GetSize() && !fBins.GetSize())
+   if (fBinContent.GetSize() && !fBinIndex->GetSize())
       FillExMap();
-   Long64_t linidx = (Long64_t) fBins.GetValue(hash);
-   while (linidx) {
-      // fBins stores index + 1!
-      THnSparseArrayChunk* chunk = GetChunk((linidx - 1)/ fChunkSize);
-      if (chunk->Matches((linidx - 1) % fChunkSize, cc->GetBuffer()))
-         return linidx - 1; // we store idx+1, 0 is "TExMap: not found"
-
-      Long64_t nextlinidx = fBinsContinued.GetValue(linidx);
-      if (!nextlinidx) break;
-
-      linidx = nextlinidx;
-   }
+   const Long64_t linidx = fBinIndex->Find(hash, [this, cc](Long64_t idx) {
+      return GetChunk(idx / fChunkSize)->Matches(idx % fChunkSize, cc->GetBuffer());
+   });
+   if (linidx >= 0) return linidx;
    if (!allocate) return -1;
 
    ++fFilledBins;
@@ -819,16 +891,7 @@ Long64_t THnSparse::GetBinIndexForCurrentBin(Bool_t allocate)
 
    // store translation between hash and bin
    newidx += (fBinContent.GetEntriesFast() - 1) * fChunkSize;
-   if (!linidx) {
-      // fBins didn't find it
-      if (2 * GetNbins() > fBins.Capacity())
-         fBins.Expand(3 * GetNbins());
-      fBins.Add(hash, newidx + 1);
-   } else {
-      // fBins contains one, but it's the wrong one;
-      // add entry to fBinsContinued.
-      fBinsContinued.Add(linidx, newidx + 1);
-   }
+   fBinIndex->Add(hash, newidx);
    return newidx;
 }
 
@@ -880,7 +943,7 @@ Double_t THnSparse::GetSparseFractionMem() const {
 
    Double_t size = 0.;
    size += fBinContent.GetEntries() * (GetChunkSize() * sizePerChunkElement + sizeof(THnSparseArrayChunk));
-   size += + 3 * sizeof(Long64_t) * fBins.GetSize() /* TExMap */;
+   size += fBinIndex->GetSlotSize() * fBinIndex->GetCapacity();
 
    Double_t nbinsTotal = 1.;
    for (Int_t d = 0; d < fNdimensions; ++d)
@@ -962,8 +1025,7 @@ void THnSparse::Sumw2()
 void THnSparse::Reset(Option_t *option /*= ""*/)
 {
    fFilledBins = 0;
-   fBins.Delete();
-   fBinsContinued.Clear();
+   fBinIndex->Clear();
    fBinContent.Delete();
    ResetBase(option);
 }
@@ -43,6 +43,12 @@
 #include "TH1.h"
 #include "TVirtualPad.h"
 #include "TKDE.h"
+#include "TROOT.h"
+
+#ifdef R__USE_IMT
+#include "ROOT/TSeq.hxx"
+#include "ROOT/TThreadExecutor.hxx"
+#endif
 
 ClassImp(TKDE);
 
@@ -748,6 +754,22 @@ Double_t TKDE::operator()(Double_t x) const {
    return (*fKernel)(x);
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Evaluates the kernel density estimate at the n points x, which is much faster than
+/// calling operator() for every point. The points are evaluated in parallel if implicit
+/// multi-threading is enabled and a built-in kernel is used.
+
+void TKDE::GetValues(UInt_t n, const Double_t *x, Double_t *result) const {
+   if (!fKernel) {
+      (const_cast<TKDE*>(this))->ReInit();
+      if (!fKernel) {
+         std::fill(result, result + n, TMath::QuietNaN());
+         return;
+      }
+   }
+   fKernel->Evaluate(n, x, result);
+}
+
 Double_t TKDE::GetMean() const {
    // return the mean of the data
    if (fNewData) (const_cast<TKDE*>(this))->InitFromNewData();
@@ -780,6 +802,9 @@ void TKDE::TKernel::ComputeAdaptiveWeights() {
    // we will store computed adaptive weights in weights
    std::vector<Double_t> weights(n, fWeights[0]);
    bool useDataWeights = (fKDE->fBinCount.size() == n);
+   // the fixed kernel estimate at all the data points, the O(n^2) part of the computation
+   std::vector<Double_t> kdeValues(n);
+   Evaluate(n, fKDE->fData.data(), kdeValues.data());
    Double_t f = 0.0;
    for (unsigned int i = 0; i < n; ++i) {
       // for negative or null bin contents use the fixed weight value (fWeights[0])
@@ -787,7 +812,7 @@ void TKDE::TKernel::ComputeAdaptiveWeights() {
          weights[i] = fWeights[0];
          continue; // skip negative or null weights
       }
-      f = (*fKDE->fKernel)(fKDE->fData[i]);
+      f = kdeValues[i];
       if (f <= 0) {
          // this can happen when data are outside range and fAsymLeft or fAsymRight is on
          fKDE->Warning("ComputeAdativeWeights","function value is zero or negative for x = %f w = %f - set their bandwidth to zero",
@@ -1045,6 +1070,94 @@ Double_t TKDE::TKernel::operator()(Double_t x) const {
    return result / nSum;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Evaluates the estimate at the n points x, as operator() does for each point. The loops are
+/// interchanged: every data point is prepared once and added to all the points in the inner
+/// loop, which calls the kernel function directly and can be vectorized. The contributions
+/// to every point are summed in the same order as in operator().
+
+template <class Kernel>
+void TKDE::TKernel::Evaluate(const Kernel &kernel, UInt_t n, const Double_t *x, Double_t *result) const {
+   const UInt_t nData = fKDE->fData.size();
+   const Bool_t useCount = (fKDE->fBinCount.size() == nData);
+   const Bool_t hasAdaptiveWeights = (fWeights.size() == nData);
+   const Bool_t asymLeft = fKDE->fAsymLeft;
+   const Bool_t asymRight = fKDE->fAsymRight;
+   std::fill(result, result + n, 0.);
+   for (UInt_t i = 0; i < nData; ++i) {
+      const Double_t binCount = (useCount) ? fKDE->fBinCount[i] : 1.0;
+      const Double_t weight = hasAdaptiveWeights ? fWeights[i] : fWeights[0];
+      // skip data points that have 0 bandwidth (this can happen, see TKernel::ComputeAdaptiveWeight)
+      if (hasAdaptiveWeights && weight == 0) continue;
+      const Double_t invWeight = 1. / weight;
+      const Double_t norm = binCount * invWeight;
+      const Double_t data = fKDE->fData[i];
+      const Double_t dataLeft = 2. * fKDE->fXMin - data;
+      const Double_t dataRight = 2. * fKDE->fXMax - data;
+      for (UInt_t j = 0; j < n; ++j) {
+         result[j] += norm * kernel((x[j] - data) * invWeight);
+         if (asymLeft)
+            result[j] += norm * kernel((x[j] - dataLeft) * invWeight);
+         if (asymRight)
+            result[j] += norm * kernel((x[j] - dataRight) * invWeight);
+      }
+   }
+   const Double_t nSum = fKDE->fSumOfCounts;
+   for (UInt_t j = 0; j < n; ++j) {
+      if (TMath::IsNaN(result[j])) {
+         fKDE->Warning("Evaluate", "Result is NaN for  x %f \n", x[j]);
+      }
+      result[j] /= nSum;
+   }
+}
+
+void TKDE::TKernel::Evaluate(UInt_t n, const Double_t *x, Double_t *result) const {
+   const TKDE *kde = fKDE;
+   std::function<void(UInt_t, const Double_t *, Double_t *)> evaluate;
+   switch (kde->fKernelType) {
+      case kGaussian:
+         evaluate = [this, kde](UInt_t m, const Double_t *xx, Double_t *r) {
+            Evaluate([kde](Double_t u) { return kde->GaussianKernel(u); }, m, xx, r);
+         };
+         break;
+      case kEpanechnikov:
+         evaluate = [this, kde](UInt_t m, const Double_t *xx, Double_t *r) {
+            Evaluate([kde](Double_t u) { return kde->EpanechnikovKernel(u); }, m, xx, r);
+         };
+         break;
+      case kBiweight:
+         evaluate = [this, kde](UInt_t m, const Double_t *xx, Double_t *r) {
+            Evaluate([kde](Double_t u) { return kde->BiweightKernel(u); }, m, xx, r);
+         };
+         break;
+      case kCosineArch:
+         evaluate = [this, kde](UInt_t m, const Double_t *xx, Double_t *r) {
+            Evaluate([kde](Double_t u) { return kde->CosineArchKernel(u); }, m, xx, r);
+         };
+         break;
+      default:
+         // user defined kernels are not assumed to be thread safe
+         Evaluate([kde](Double_t u) { return (*kde->fKernelFunction)(u); }, n, x, result);
+         return;
+   }
+#ifdef R__USE_IMT
+   // points evaluated by one task; each point is computed by exactly one task
+   const UInt_t chunkSize = 256;
+   const UInt_t nChunks = (n + chunkSize - 1) / chunkSize;
+   if (nChunks > 1 && Double_t(n) * kde->fData.size() > 1.E6 && ROOT::IsImplicitMTEnabled()) {
+      ROOT::TThreadExecutor pool;
+      pool.Foreach(
+         [&](UInt_t iChunk) {
+            const UInt_t first = iChunk * chunkSize;
+            evaluate(std::min(chunkSize, n - first), x + first, result + first);
+         },
+         ROOT::TSeq<UInt_t>(0, nChunks));
+      return;
+   }
+#endif
+   evaluate(n, x, result);
+}
+
 ////////////////////////////////////////////////////
 /// compute the bin index given a data point x
 UInt_t TKDE::Index(Double_t x) const {
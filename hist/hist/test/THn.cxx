@@ -1,8 +1,14 @@
 #include "gtest/gtest.h"
 
 #include "THn.h"
+#include "THnSparse.h"
 #include "TH1.h"
 #include "TH2.h"
+#include "TH3.h"
+#include "TROOT.h"
+
+#include <memory>
+#include <vector>
 
 // Filling THn
 TEST(THn, Fill) {
@@ -111,3 +117,92 @@ TEST(THn, Projection) {
    }
 
 }
+
+// Lookup of THnSparse bins, also for compact coordinates longer than 8 bytes and after streaming
+TEST(THnSparse, BinIndex) {
+   for (Int_t nbins : {10, 1000}) {
+      const Int_t dim = 10;
+      std::vector<Int_t> bins(dim, nbins);
+      std::vector<Double_t> xmin(dim, 0.);
+      std::vector<Double_t> xmax(dim, 1.);
+      THnSparseD hs("hs", "hs", dim, bins.data(), xmin.data(), xmax.data(), 64);
+
+      const Int_t nfills = 5000;
+      std::vector<Int_t> coord(dim);
+      // Distinct coordinates for distinct i: the digits of i in base nbins
+      auto setCoord = [&](Int_t i) {
+         for (Int_t d = 0; d < dim; ++d, i /= nbins)
+            coord[d] = 1 + i % nbins;
+      };
+      for (Int_t i = 0; i < nfills; ++i) {
+         setCoord(i);
+         hs.AddBinContent(coord.data(), i % 2 + 1);
+      }
+      // Every coordinate was filled twice
+      for (Int_t i = 0; i < nfills; ++i) {
+         setCoord(i);
+         hs.AddBinContent(coord.data(), 1.);
+      }
+
+      std::unique_ptr<THnSparse> clone(static_cast<THnSparse *>(hs.Clone("clone")));
+      for (THnSparse *h : {static_cast<THnSparse *>(&hs), clone.get()}) {
+         EXPECT_EQ(nfills, h->GetNbins());
+         for (Int_t i = 0; i < nfills; ++i) {
+            setCoord(i);
+            const Long64_t bin = h->GetBin(coord.data(), kFALSE);
+            ASSERT_EQ(i, bin);
+            EXPECT_DOUBLE_EQ(i % 2 + 2., h->GetBinContent(bin));
+         }
+         coord.assign(dim, 0);
+         EXPECT_EQ(-1, h->GetBin(coord.data(), kFALSE));
+      }
+   }
+}
+
+#ifdef R__USE_IMT
+// Projections with implicit MT give the same result as sequential ones
+TEST(THn, ProjectionImt) {
+   Int_t bins[3] = {60, 60, 60};
+   Double_t xmin[3] = {0., 0., 0.};
+   Double_t xmax[3] = {1., 1., 1.};
+   THnD hn("hn", "hn", 3, bins, xmin, xmax);
+   THnSparseD hs("hs", "hs", 3, bins, xmin, xmax);
+   TH3D h3("h3", "h3", 60, 0., 1., 60, 0., 1., 60, 0., 1.);
+   hn.Sumw2();
+   hs.Sumw2();
+   h3.Sumw2();
+   for (Int_t i = 0; i < 400000; ++i) {
+      Double_t x[3] = {(i % 997) / 997., (i % 631) / 631., (i % 1201) / 1201.};
+      const Double_t w = 1. + i % 3;
+      hn.Fill(x, w);
+      hs.Fill(x, w);
+      h3.Fill(x[0], x[1], x[2], w);
+   }
+   hn.GetAxis(2)->SetRange(10, 40);
+   hs.GetAxis(2)->SetRange(10, 40);
+   h3.GetZaxis()->SetRange(10, 40);
+
+   std::unique_ptr<TH1D> seqN(hn.Projection(0));
+   std::unique_ptr<TH2D> seqS(hs.Projection(1, 0));
+   std::unique_ptr<TH1> seq3(h3.Project3D("yx"));
+   // Project3D() reuses existing histograms of the same name
+   seq3->SetName("seq3");
+   ROOT::EnableImplicitMT(4);
+   std::unique_ptr<TH1D> imtN(hn.Projection(0));
+   std::unique_ptr<TH2D> imtS(hs.Projection(1, 0));
+   std::unique_ptr<TH1> imt3(h3.Project3D("yx"));
+   ROOT::DisableImplicitMT();
+
+   auto expectEqual = [](const TH1 &a, const TH1 &b) {
+      ASSERT_EQ(a.GetNcells(), b.GetNcells());
+      EXPECT_NEAR(a.GetEntries(), b.GetEntries(), 1e-6 * a.GetEntries());
+      for (Int_t bin = 0; bin < a.GetNcells(); ++bin) {
+         EXPECT_NEAR(a.GetBinContent(bin), b.GetBinContent(bin), 1e-9);
+         EXPECT_NEAR(a.GetBinError(bin), b.GetBinError(bin), 1e-9);
+      }
+   };
+   expectEqual(*seqN, *imtN);
+   expectEqual(*seqS, *imtS);
+   expectEqual(*seq3, *imt3);
+}
+#endif
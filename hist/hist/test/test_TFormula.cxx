@@ -2,8 +2,31 @@
 
 #include "TFormula.h"
 
+#include <vector>
+
 // Test that autoloading works (ROOT-9840)
 TEST(TFormula, Interp)
 {
   TFormula f("func", "TGeoBBox::DeclFileLine()");
 }
+
+TEST(TFormula, EvalParBatch)
+{
+   TFormula f("batchFunc", "[0] + [1] * x + y * y");
+   f.SetParameters(1., 2.);
+   const int n = 5;
+   std::vector<double> x(2 * n);
+   for (int i = 0; i < n; ++i) {
+      x[2 * i] = 0.5 * i;
+      x[2 * i + 1] = -1. * i;
+   }
+   std::vector<double> result(n);
+   f.EvalParBatch(n, x.data(), result.data());
+   for (int i = 0; i < n; ++i)
+      EXPECT_DOUBLE_EQ(f.EvalPar(&x[2 * i]), result[i]);
+
+   const double params[2] = {-3., 0.5};
+   f.EvalParBatch(n, x.data(), result.data(), params);
+   for (int i = 0; i < n; ++i)
+      EXPECT_DOUBLE_EQ(f.EvalPar(&x[2 * i], params), result[i]);
+}
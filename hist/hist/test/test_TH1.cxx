@@ -2,7 +2,17 @@
 
 #include "TH1.h"
 #include "TH1F.h"
+#include "TH1ConcurrentFill.h"
+#include "TH2.h"
 #include "THLimitsFinder.h"
+#include "TDirectory.h"
+#include "TF1.h"
+#include "TROOT.h"
+#include "ROOT/TDetachedObjectsGuard.hxx"
+
+#include <limits>
+#include <thread>
+#include <vector>
 
 // StatOverflows TH1
 TEST(TH1, StatOverflows)
@@ -46,3 +56,165 @@ TEST(THLimitsFinder, Degenerate)
    EXPECT_LE(xmin, centralValue - 5.);
    EXPECT_GE(xmax, centralValue + 5.);
 }
+
+// Objects created in the scope of a TDetachedObjectsGuard are not registered with global lists
+TEST(TH1, DetachedObjectsGuard)
+{
+   ASSERT_TRUE(TH1::AddDirectoryStatus());
+   {
+      ROOT::TDetachedObjectsGuard detached;
+      EXPECT_FALSE(TH1::AddDirectoryStatus());
+      TH1F h("hdetached", "h", 10, 0, 1);
+      EXPECT_EQ(h.GetDirectory(), nullptr);
+      EXPECT_EQ(gDirectory->FindObject("hdetached"), nullptr);
+      TH1F hcopy(h);
+      EXPECT_EQ(hcopy.GetDirectory(), nullptr);
+      TF1 f("fdetached", "x", 0, 1);
+      EXPECT_EQ(gROOT->GetListOfFunctions()->FindObject("fdetached"), nullptr);
+
+      // The guard only affects the thread that created it
+      std::thread([] { EXPECT_TRUE(TH1::AddDirectoryStatus()); }).join();
+   }
+   EXPECT_TRUE(TH1::AddDirectoryStatus());
+   TH1F h("hattached", "h", 10, 0, 1);
+   EXPECT_EQ(h.GetDirectory(), gDirectory);
+}
+
+// Concurrent fills give the same bins and statistics as sequential fills
+TEST(TH1, ConcurrentFill)
+{
+   auto value = [](int i, int j) { return ((i * 7919 + j * 104729) % 1200) / 1000. - 0.1; };
+   TH2D hseq("hseq", "h", 20, 0, 1, 20, 0, 1);
+   TH2D hconc("hconc", "h", 20, 0, 1, 20, 0, 1);
+   const int nThreads = 4;
+   const int nFills = 10000;
+   for (int t = 0; t < nThreads; ++t)
+      for (int i = 0; i < nFills; ++i)
+         hseq.Fill(value(t, i), value(i, t), 0.5);
+
+   {
+      TH1ConcurrentFill concurrentFill(hconc, 100);
+      std::vector<std::thread> threads;
+      for (int t = 0; t < nThreads; ++t) {
+         threads.emplace_back([&, t] {
+            auto filler = concurrentFill.MakeFiller();
+            for (int i = 0; i < nFills; ++i)
+               filler.Fill(value(t, i), value(i, t), 0.5);
+         });
+      }
+      for (auto &thread : threads)
+         thread.join();
+   }
+
+   EXPECT_DOUBLE_EQ(hseq.GetEntries(), hconc.GetEntries());
+   EXPECT_NEAR(hseq.GetMean(1), hconc.GetMean(1), 1e-12);
+   EXPECT_NEAR(hseq.GetMean(2), hconc.GetMean(2), 1e-12);
+   EXPECT_NEAR(hseq.GetCorrelationFactor(), hconc.GetCorrelationFactor(), 1e-12);
+   ASSERT_EQ(hseq.GetSumw2N(), hconc.GetSumw2N());
+   for (int bin = 0; bin < hseq.GetNcells(); ++bin) {
+      EXPECT_DOUBLE_EQ(hseq.GetBinContent(bin), hconc.GetBinContent(bin));
+      EXPECT_DOUBLE_EQ(hseq.GetBinError(bin), hconc.GetBinError(bin));
+   }
+}
+
+// The statistics of concurrent fills are the ones of sequential fills also with an axis range set and after flushes
+// of only under- and overflows, where TH1::GetStats() would recompute them from the bin contents
+TEST(TH1, ConcurrentFillStats)
+{
+   auto expectSameStats = [](const TH1 &expected, const TH1 &actual) {
+      Double_t expectedStats[TH1::kNstat] = {};
+      Double_t actualStats[TH1::kNstat] = {};
+      expected.GetStats(expectedStats);
+      actual.GetStats(actualStats);
+      for (int i = 0; i < TH1::kNstat; ++i)
+         EXPECT_NEAR(expectedStats[i], actualStats[i], 1e-9) << "statistic " << i;
+      EXPECT_DOUBLE_EQ(expected.GetEntries(), actual.GetEntries());
+   };
+
+   // Axis range set while filling
+   {
+      TH2D hseq("hseqRange", "h", 10, 0, 1, 10, 0, 1);
+      TH2D hconc("hconcRange", "h", 10, 0, 1, 10, 0, 1);
+      for (auto h : {&hseq, &hconc}) {
+         h->GetXaxis()->SetRange(3, 8);
+         h->GetYaxis()->SetRange(2, 5);
+      }
+      TH1ConcurrentFill concurrentFill(hconc, 16);
+      {
+         auto filler = concurrentFill.MakeFiller();
+         for (int i = 0; i < 1000; ++i) {
+            const double x = (i % 97) / 97.;
+            const double y = (i % 89) / 89.;
+            hseq.Fill(x, y, 0.5 + (i % 3));
+            filler.Fill(x, y, 0.5 + (i % 3));
+         }
+      }
+      for (auto h : {&hseq, &hconc}) {
+         h->GetXaxis()->SetRange();
+         h->GetYaxis()->SetRange();
+      }
+      expectSameStats(hseq, hconc);
+   }
+
+   // First flush with only overflows, so that the sum of weights is zero with entries
+   {
+      TH1D hseq("hseqOverflow", "h", 10, 0, 1);
+      TH1D hconc("hconcOverflow", "h", 10, 0, 1);
+      TH1ConcurrentFill concurrentFill(hconc, 1000);
+      auto filler = concurrentFill.MakeFiller();
+      for (int i = 0; i < 10; ++i) {
+         hseq.Fill(1.5 + i);
+         filler.Fill(1.5 + i);
+      }
+      filler.Flush();
+      for (int i = 0; i < 100; ++i) {
+         hseq.Fill(i / 101.);
+         filler.Fill(i / 101.);
+      }
+      filler.Flush();
+      expectSameStats(hseq, hconc);
+      EXPECT_DOUBLE_EQ(hseq.GetBinContent(11), hconc.GetBinContent(11));
+   }
+}
+
+// FillN gives the same bins and statistics as Fill, for fix and variable bins, weights and extendable axes
+TEST(TH1, FillNBlocks)
+{
+   const int n = 1000;
+   const double edges[] = {0., 0.1, 0.15, 0.5, 0.7, 1.};
+   for (int mode = 0; mode < 3; ++mode) {
+      const bool isExtendable = (mode == 2);
+      std::vector<double> x(2 * n), w(2 * n);
+      for (int i = 0; i < 2 * n; ++i) {
+         x[i] = ((i * 7919) % 1300) / 1000. - 0.15;
+         w[i] = (i % 3) ? 1. : 0.5;
+      }
+      if (!isExtendable) {
+         x[10] = std::numeric_limits<double>::infinity();
+         x[20] = std::numeric_limits<double>::quiet_NaN();
+      }
+
+      TH1D hfill("hfill", "h", 5, 0, 1);
+      TH1D hfilln("hfilln", "h", 5, 0, 1);
+      if (mode == 1) {
+         hfill.SetBins(5, edges);
+         hfilln.SetBins(5, edges);
+      } else if (isExtendable) {
+         hfill.SetCanExtend(TH1::kXaxis);
+         hfilln.SetCanExtend(TH1::kXaxis);
+      }
+      for (int i = 0; i < 2 * n; i += 2)
+         hfill.Fill(x[i], w[i]);
+      hfilln.FillN(n, x.data(), w.data(), 2);
+
+      EXPECT_DOUBLE_EQ(hfill.GetEntries(), hfilln.GetEntries());
+      EXPECT_NEAR(hfill.GetMean(), hfilln.GetMean(), 1e-12);
+      EXPECT_NEAR(hfill.GetStdDev(), hfilln.GetStdDev(), 1e-12);
+      ASSERT_EQ(hfill.GetNcells(), hfilln.GetNcells());
+      EXPECT_DOUBLE_EQ(hfill.GetXaxis()->GetXmax(), hfilln.GetXaxis()->GetXmax());
+      for (int bin = 0; bin < hfill.GetNcells(); ++bin) {
+         EXPECT_DOUBLE_EQ(hfill.GetBinContent(bin), hfilln.GetBinContent(bin));
+         EXPECT_DOUBLE_EQ(hfill.GetBinError(bin), hfilln.GetBinError(bin));
+      }
+   }
+}
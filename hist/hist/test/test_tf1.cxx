@@ -223,3 +223,47 @@ TEST(TF1, Constructors)
    for (auto tf1 : vtf1)
       EXPECT_EQ(tf1(&x, &p), 2);
 }
+
+TEST(TF1, Interpolation)
+{
+   int ncalls = 0;
+   TF1 f("interpolated",
+         [&](double *x, double *p) {
+            ++ncalls;
+            return p[0] * std::exp(-0.5 * x[0] * x[0] / (p[1] * p[1]));
+         },
+         -5, 5, 2);
+   f.SetParameters(2, 1);
+   TF1 fexact("exact", "[0]*exp(-0.5*x*x/([1]*[1]))", -5, 5);
+   fexact.SetParameters(2, 1);
+
+   const double tol = 1.E-6;
+   f.SetInterpolation(tol);
+   EXPECT_EQ(f.GetInterpolationTolerance(), tol);
+   for (double x = -5; x <= 5; x += 0.0137)
+      EXPECT_NEAR(f.Eval(x), fexact.Eval(x), 10 * tol * 2);
+
+   // the table is reused for further evaluations
+   const int ncallsBuild = ncalls;
+   EXPECT_GT(ncallsBuild, 0);
+   for (double x = -4.99; x <= 5; x += 0.1)
+      f.Eval(x);
+   EXPECT_EQ(ncalls, ncallsBuild);
+   EXPECT_NEAR(f.Integral(-5, 5), fexact.Integral(-5, 5), 1.E-4);
+
+   // parameters passed to EvalPar, as done in the fits, rebuild the table
+   double x = 0.5;
+   double p[2] = {1, 2};
+   EXPECT_NEAR(f.EvalPar(&x, p), 1 * std::exp(-0.5 * 0.25 / 4), 10 * tol);
+   EXPECT_GT(ncalls, ncallsBuild);
+
+   // outside the range the function is evaluated
+   ncalls = 0;
+   f.SetParameters(2, 1);
+   EXPECT_DOUBLE_EQ(f.Eval(6), fexact.Eval(6));
+
+   f.SetInterpolation(0);
+   ncalls = 0;
+   EXPECT_DOUBLE_EQ(f.Eval(0.3), fexact.Eval(0.3));
+   EXPECT_EQ(ncalls, 1);
+}
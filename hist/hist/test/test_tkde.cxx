@@ -496,4 +496,25 @@ TEST(TKDE, tkde_io_mirror)
    for (size_t i = 0; i < t.xtest.size(); ++i) {
       EXPECT_NEAR(t.values1[i], t.values2[i], delta);
    }
-}
\ No newline at end of file
+}
+/// The batch evaluation must give the same values as the evaluation point by point
+TEST(TKDE, tkde_getvalues)
+{
+   TRandom3 r(1111);
+   std::vector<double> data(1000);
+   for (auto &x : data)
+      x = r.Gaus(0, 1);
+   std::vector<double> xtest(300);
+   for (size_t i = 0; i < xtest.size(); ++i)
+      xtest[i] = -4. + 8. * i / xtest.size();
+
+   for (const char *option : {"KernelType:Gaussian;Iteration:Fixed;Mirror:noMirror;Binning:Unbinned",
+                              "KernelType:Epanechnikov;Iteration:Adaptive;Mirror:MirrorAsymBoth;Binning:Unbinned",
+                              "KernelType:Biweight;Iteration:Adaptive;Mirror:noMirror;Binning:ForcedBinning"}) {
+      TKDE kde(data.size(), data.data(), -5., 5., option);
+      std::vector<double> values(xtest.size());
+      kde.GetValues(xtest.size(), xtest.data(), values.data());
+      for (size_t i = 0; i < xtest.size(); ++i)
+         EXPECT_DOUBLE_EQ(kde(xtest[i]), values[i]) << option << " x = " << xtest[i];
+   }
+}
@@ -37,6 +37,8 @@ public:
    ~TGraphPainter() override;
 
    void           ComputeLogs(Int_t npoints, Int_t opt);
+   Int_t          DecimatePolyLine(Int_t n, Double_t *x, Double_t *y, Bool_t alongY = kFALSE);
+   Int_t          DecimatePolyMarker(Int_t n, Double_t *x, Double_t *y);
    Int_t          DistancetoPrimitiveHelper(TGraph *theGraph, Int_t px, Int_t py) override;
    void           DrawPanelHelper(TGraph *theGraph) override;
    void           ExecuteEventHelper(TGraph *theGraph, Int_t event, Int_t px, Int_t py) override;
@@ -61,10 +63,12 @@ public:
    void           SetHighlight(TGraph *theGraph) override;
    void           Smooth(TGraph *theGraph, Int_t npoints, Double_t *x, Double_t *y, Int_t drawtype);
    static void    SetMaxPointsPerLine(Int_t maxp=50);
+   static void    SetDecimationResolution(Int_t res=2);
 
 protected:
 
    static Int_t   fgMaxPointsPerLine;  ///< Number of points per chunks' line when drawing a graph.
+   static Int_t   fgDecimationResolution; ///< Number of decimation cells per pixel, 0 to disable the decimation.
 
    std::vector<Double_t> gxwork, gywork, gxworkl, gyworkl; ///< Internal buffers for coordinates. Used for graphs painting.
 
@@ -39,9 +39,12 @@
 #include "TRegexp.h"
 #include "strlcpy.h"
 #include "snprintf.h"
+#include <cmath>
 #include <memory>
+#include <vector>
 
 Int_t TGraphPainter::fgMaxPointsPerLine = 50;
+Int_t TGraphPainter::fgDecimationResolution = 2;
 
 static Int_t    gHighlightPoint  = -1;         // highlight point of graph
 static TGraph  *gHighlightGraph  = nullptr;    // pointer to graph with highlight point
@@ -707,6 +710,104 @@ void TGraphPainter::ComputeLogs(Int_t npoints, Int_t opt)
    }
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Reduce a polyline given in pad coordinates to the points needed to paint it
+/// at the pad resolution. Consecutive points falling in the same pixel column
+/// (pixel row if `alongY` is true) are replaced by the first, the lowest, the
+/// highest and the last of them, in their original order, so that the painted
+/// polyline covers the same pixels. Nothing is done unless there are more than 4
+/// points per column. Returns the new number of points.
+/// See SetDecimationResolution().
+
+Int_t TGraphPainter::DecimatePolyLine(Int_t n, Double_t *x, Double_t *y, Bool_t alongY)
+{
+   if (fgDecimationResolution <= 0 || !gPad) return n;
+   Double_t *u = alongY ? y : x; // coordinate defining the columns
+   Double_t *v = alongY ? x : y;
+   Double_t u1, u2;
+   Int_t npix;
+   if (alongY) {
+      u1 = gPad->GetY1(); u2 = gPad->GetY2();
+      npix = TMath::Abs(gPad->YtoAbsPixel(u2) - gPad->YtoAbsPixel(u1));
+   } else {
+      u1 = gPad->GetX1(); u2 = gPad->GetX2();
+      npix = TMath::Abs(gPad->XtoAbsPixel(u2) - gPad->XtoAbsPixel(u1));
+   }
+   if (u2 <= u1 || npix <= 0) return n;
+   Double_t ncols = Double_t(npix) * fgDecimationResolution;
+   if (n <= 4*ncols) return n;
+   Double_t scale = ncols/(u2-u1);
+   // Points outside the pad go to the columns -1 and ncols, their segments are clipped anyway
+   auto column = [&](Double_t uu) {
+      return (Long64_t)std::floor(TMath::Min(TMath::Max((uu-u1)*scale, -1.), ncols));
+   };
+
+   Int_t nout = 0;
+   Int_t i = 0;
+   while (i < n) {
+      if (!std::isfinite(u[i])) {
+         x[nout] = x[i]; y[nout] = y[i];
+         nout++; i++;
+         continue;
+      }
+      Long64_t col = column(u[i]);
+      Int_t imin = i, imax = i;
+      Int_t j = i+1;
+      while (j < n && std::isfinite(u[j]) && column(u[j]) == col) {
+         if (v[j] < v[imin]) imin = j;
+         if (v[j] > v[imax]) imax = j;
+         j++;
+      }
+      Int_t sel[4] = {i, TMath::Min(imin, imax), TMath::Max(imin, imax), j-1};
+      Double_t xs[4], ys[4];
+      Int_t ns = 0;
+      for (Int_t k=0; k<4; k++) {
+         if (k && sel[k] == sel[k-1]) continue;
+         xs[ns] = x[sel[k]]; ys[ns] = y[sel[k]];
+         ns++;
+      }
+      for (Int_t k=0; k<ns; k++) {
+         x[nout] = xs[k]; y[nout] = ys[k];
+         nout++;
+      }
+      i = j;
+   }
+   return nout;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Reduce a set of markers given in pad coordinates to one marker per pixel:
+/// markers falling in an already painted pixel of the pad are removed. Markers
+/// outside the pad are kept. Nothing is done unless there are more than 4 points
+/// per pixel column. Returns the new number of points.
+/// See SetDecimationResolution().
+
+Int_t TGraphPainter::DecimatePolyMarker(Int_t n, Double_t *x, Double_t *y)
+{
+   if (fgDecimationResolution <= 0 || !gPad) return n;
+   Double_t x1 = gPad->GetX1(), x2 = gPad->GetX2();
+   Double_t y1 = gPad->GetY1(), y2 = gPad->GetY2();
+   Long64_t nx = TMath::Abs(gPad->XtoAbsPixel(x2) - gPad->XtoAbsPixel(x1)) * (Long64_t)fgDecimationResolution;
+   Long64_t ny = TMath::Abs(gPad->YtoAbsPixel(y2) - gPad->YtoAbsPixel(y1)) * (Long64_t)fgDecimationResolution;
+   if (x2 <= x1 || y2 <= y1 || nx <= 0 || ny <= 0 || n <= 4*nx) return n;
+   Double_t scalex = nx/(x2-x1);
+   Double_t scaley = ny/(y2-y1);
+
+   std::vector<bool> painted(nx*ny, false);
+   Int_t nout = 0;
+   for (Int_t i=0; i<n; i++) {
+      Double_t ux = (x[i]-x1)*scalex;
+      Double_t uy = (y[i]-y1)*scaley;
+      if (ux >= 0 && ux < nx && uy >= 0 && uy < ny) {
+         Long64_t cell = (Long64_t)uy*nx + (Long64_t)ux;
+         if (painted[cell]) continue;
+         painted[cell] = true;
+      }
+      x[nout] = x[i]; y[nout] = y[i];
+      nout++;
+   }
+   return nout;
+}
 
 ////////////////////////////////////////////////////////////////////////////////
 /// Compute distance from point px,py to a graph.
@@ -1474,7 +1575,8 @@ void TGraphPainter::PaintGraph(TGraph *theGraph, Int_t npoints, const Double_t *
                }
                if (optionLine) {
                   if (TMath::Abs(theGraph->GetLineWidth())>99) PaintPolyLineHatches(theGraph, npt, gyworkl.data(), gxworkl.data());
-                  gPad->PaintPolyLine(npt,gyworkl.data(),gxworkl.data());
+                  Int_t nptl = DecimatePolyLine(npt, gyworkl.data(), gxworkl.data());
+                  gPad->PaintPolyLine(nptl,gyworkl.data(),gxworkl.data());
                }
             } else {
                if (optionFill) {
@@ -1483,7 +1585,8 @@ void TGraphPainter::PaintGraph(TGraph *theGraph, Int_t npoints, const Double_t *
                }
                if (optionLine) {
                   if (TMath::Abs(theGraph->GetLineWidth())>99) PaintPolyLineHatches(theGraph, npt, gxworkl.data(), gyworkl.data());
-                  gPad->PaintPolyLine(npt,gxworkl.data(),gyworkl.data());
+                  Int_t nptl = DecimatePolyLine(npt, gxworkl.data(), gyworkl.data());
+                  gPad->PaintPolyLine(nptl,gxworkl.data(),gyworkl.data());
                }
             }
             gxwork[0] = gxwork[npt-1];  gywork[0] = gywork[npt-1];
@@ -1567,6 +1670,8 @@ void TGraphPainter::PaintGraph(TGraph *theGraph, Int_t npoints, const Double_t *
          npt++;
          if (i == npoints) {
             ComputeLogs(npt, optionZ);
+            if (optionR)  npt = DecimatePolyMarker(npt,gyworkl.data(),gxworkl.data());
+            else          npt = DecimatePolyMarker(npt,gxworkl.data(),gyworkl.data());
             if (optionR)  gPad->PaintPolyMarker(npt,gyworkl.data(),gxworkl.data());
             else          gPad->PaintPolyMarker(npt,gxworkl.data(),gyworkl.data());
             npt = 0;
@@ -1582,6 +1687,8 @@ void TGraphPainter::PaintGraph(TGraph *theGraph, Int_t npoints, const Double_t *
          npt++;
          if (i == npoints) {
             ComputeLogs(npt, optionZ);
+            if (optionR) npt = DecimatePolyMarker(npt,gyworkl.data(),gxworkl.data());
+            else         npt = DecimatePolyMarker(npt,gxworkl.data(),gyworkl.data());
             if (optionR) gPad->PaintPolyMarker(npt,gyworkl.data(),gxworkl.data());
             else         gPad->PaintPolyMarker(npt,gxworkl.data(),gyworkl.data());
             npt = 0;
@@ -2021,6 +2128,7 @@ void TGraphPainter::PaintGrapHist(TGraph *theGraph, Int_t npoints, const Double_
                   if (gxwork[nbpoints] < gPad->GetUxmax()) nbpoints++;
                }
 
+               nbpoints = DecimatePolyLine(nbpoints, gxworkl.data() + point1, gyworkl.data() + point1);
                gPad->PaintPolyLine(nbpoints,gxworkl.data() + point1, gyworkl.data() + point1, noClip);
                continue;
             }
@@ -2051,7 +2159,8 @@ void TGraphPainter::PaintGrapHist(TGraph *theGraph, Int_t npoints, const Double_
                gywork[npt-1] = gywork[npt-2];
                gxwork[npt-1] = xwmin;
                ComputeLogs(npt, optionZ);
-               gPad->PaintPolyLine(npt,gxworkl.data(),gyworkl.data(),noClip);
+               Int_t nptl = DecimatePolyLine(npt, gxworkl.data(), gyworkl.data(), kTRUE);
+               gPad->PaintPolyLine(nptl,gxworkl.data(),gyworkl.data(),noClip);
                continue;
             }
          }  //endfor (i=first; i<=last;i++)
@@ -5288,3 +5397,18 @@ void TGraphPainter::SetMaxPointsPerLine(Int_t maxp)
    fgMaxPointsPerLine = maxp;
    if (maxp < 50) fgMaxPointsPerLine = 50;
 }
+
+////////////////////////////////////////////////////////////////////////////////
+/// Set the resolution used to decimate the graphs and histograms having many
+/// more points than the pad has pixels. Polylines keep the first, lowest,
+/// highest and last point of each run of points in one pixel column, polymarkers
+/// keep one marker per pixel, where pixels are divided in `res` x `res` cells.
+/// This bounds the painting cost, on screen and in PDF/SVG files, by the pad
+/// resolution. Increase `res` to keep more details when zooming deeply in vector
+/// output, `res` <= 0 disables the decimation:
+/// `TGraphPainter::SetDecimationResolution(0)`.
+
+void TGraphPainter::SetDecimationResolution(Int_t res)
+{
+   fgDecimationResolution = res;
+}
@@ -7,8 +7,17 @@
 #include "TList.h"
 #include "TH1.h"
 #include "TMath.h"
+#include "TROOT.h"
 #include "snprintf.h"
 
+#ifdef R__USE_IMT
+#include "ROOT/TThreadExecutor.hxx"
+#include "ROOT/TSeq.hxx"
+#endif
+
+#include <algorithm>
+#include <vector>
+
 /** \class TSpectrum
     \ingroup Spectrum
     \brief Advanced Spectra Processing
@@ -44,6 +53,33 @@
 Int_t TSpectrum::fgIterations    = 3;
 Int_t TSpectrum::fgAverageWindow = 3;
 
+namespace {
+/// Call f(i) for every spectrum i in [0, n), in parallel if implicit multi-threading is enabled
+template <typename F>
+void ForEachSpectrum(Int_t n, const F &f)
+{
+#ifdef R__USE_IMT
+   if (n > 1 && ROOT::IsImplicitMTEnabled()) {
+      ROOT::TThreadExecutor pool;
+      pool.Foreach(f, ROOT::TSeq<Int_t>(0, n));
+      return;
+   }
+#endif
+   for (Int_t i = 0; i < n; i++)
+      f(i);
+}
+
+/// Return the first error message of the spectra, or nullptr if all of them succeeded
+const char *FirstError(const std::vector<const char *> &messages)
+{
+   for (auto msg : messages) {
+      if (msg)
+         return msg;
+   }
+   return nullptr;
+}
+} // anonymous namespace
+
 #define PEAK_WINDOW 1024
 ClassImp(TSpectrum);
 
@@ -2574,6 +2610,84 @@ Int_t TSpectrum::Search1HighRes(Double_t *source,Double_t *destVector, int ssize
                         deconIterations,markov,averWindow);
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Estimate the background of nspectra spectra of ssize channels each, stored one after the other in the array
+/// spectra (nspectra*ssize values). Every spectrum is processed as by
+/// Background(Double_t *spectrum, Int_t ssize, ...) and replaced by its background.
+/// The spectra are processed in parallel if implicit multi-threading is enabled (ROOT::EnableImplicitMT()).
+///
+/// Returns nullptr on success, or the error message of the first spectrum that failed.
+
+const char *TSpectrum::Background(Int_t nspectra, Double_t *spectra, Int_t ssize,
+                                  Int_t numberIterations,
+                                  Int_t direction, Int_t filterOrder,
+                                  bool smoothing, Int_t smoothWindow,
+                                  bool compton)
+{
+   std::vector<const char *> messages(nspectra > 0 ? nspectra : 0);
+   ForEachSpectrum(nspectra, [&](Int_t i) {
+      messages[i] = Background(spectra + (Long64_t)i * ssize, ssize, numberIterations, direction, filterOrder,
+                               smoothing, smoothWindow, compton);
+   });
+   return FirstError(messages);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Deconvolve nspectra spectra of ssize channels each, stored one after the other in the array sources
+/// (nspectra*ssize values), with the same response function. Every spectrum is processed as by
+/// Deconvolution(Double_t *source, const Double_t *response, Int_t ssize, ...) and replaced by the deconvolved
+/// spectrum. The response vector is not modified.
+/// The spectra are processed in parallel if implicit multi-threading is enabled (ROOT::EnableImplicitMT()).
+///
+/// Returns nullptr on success, or the error message of the first spectrum that failed.
+
+const char *TSpectrum::Deconvolution(Int_t nspectra, Double_t *sources, const Double_t *response, Int_t ssize,
+                                     Int_t numberIterations, Int_t numberRepetitions, Double_t boost)
+{
+   std::vector<const char *> messages(nspectra > 0 ? nspectra : 0);
+   ForEachSpectrum(nspectra, [&](Int_t i) {
+      messages[i] = Deconvolution(sources + (Long64_t)i * ssize, response, ssize, numberIterations,
+                                  numberRepetitions, boost);
+   });
+   return FirstError(messages);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Search the peaks of nspectra spectra of ssize channels each, stored one after the other in the array sources
+/// (nspectra*ssize values). Every spectrum is processed as by
+/// SearchHighRes(Double_t *source, Double_t *destVector, Int_t ssize, ...), the deconvolved spectra are stored one
+/// after the other in destVectors (nspectra*ssize values).
+///
+/// The number of peaks found in the spectrum i is returned in npeaks[i] and their positions in
+/// positions[i*fMaxPeaks] ... positions[i*fMaxPeaks+npeaks[i]-1]; the arrays are provided by the user and must hold
+/// nspectra and nspectra*fMaxPeaks values. The peak positions of this object (GetPositionX()) are not modified.
+/// The spectra are processed in parallel if implicit multi-threading is enabled (ROOT::EnableImplicitMT()).
+///
+/// Returns the total number of peaks found.
+
+Int_t TSpectrum::SearchHighRes(Int_t nspectra, Double_t *sources, Double_t *destVectors, Int_t ssize,
+                               Double_t sigma, Double_t threshold,
+                               bool backgroundRemove, Int_t deconIterations,
+                               bool markov, Int_t averWindow,
+                               Int_t *npeaks, Double_t *positions)
+{
+   if (!npeaks || !positions) {
+      Error("SearchHighRes", "The arrays of the peaks must be allocated by the user");
+      return 0;
+   }
+   ForEachSpectrum(nspectra, [&](Int_t i) {
+      // the peaks are stored in the searching object, every spectrum uses its own one
+      TSpectrum spectrum(fMaxPeaks);
+      npeaks[i] = spectrum.SearchHighRes(sources + (Long64_t)i * ssize, destVectors + (Long64_t)i * ssize, ssize,
+                                         sigma, threshold, backgroundRemove, deconIterations, markov, averWindow);
+      std::copy(spectrum.GetPositionX(), spectrum.GetPositionX() + npeaks[i], positions + (Long64_t)i * fMaxPeaks);
+   });
+   Int_t ntotal = 0;
+   for (Int_t i = 0; i < nspectra; i++)
+      ntotal += npeaks[i];
+   return ntotal;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Static function, interface to TSpectrum::Search.
 
@@ -29,6 +29,7 @@
 #pragma link C++ class TMapFile;
 #pragma link C++ class TMapRec;
 #pragma link C++ class TMemFile;
+#pragma link C++ class TSharedMemFile;
 #pragma link C++ class TArchiveFile+;
 #pragma link C++ class TArchiveMember+;
 #pragma link C++ class TZIPFile+;
@@ -51,6 +52,9 @@
 #pragma link C++ class TStreamerInfoActions::TActionSequence+;
 #pragma link C++ class TStreamerInfoActions::TConfiguration-;
 #pragma link C++ class ROOT::Internal::RRawFile+;
+#pragma link C++ class ROOT::Experimental::RIOMetrics-;
+#pragma link C++ class ROOT::Experimental::RIOFileMetrics-;
+#pragma link C++ class ROOT::Experimental::RIOLatencyHistogram-;
 #pragma link C++ class ROOT::TBufferMerger;
 #pragma link C++ class ROOT::TBufferMergerFile;
 
@@ -0,0 +1,97 @@
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_RBlockCache
+#define ROOT_RBlockCache
+
+#include <ROOT/RRawFile.hxx>
+#include <ROOT/RStringView.hxx>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+
+namespace ROOT {
+namespace Internal {
+
+/**
+ * \class RBlockCache RBlockCache.hxx
+ * \ingroup IO
+ *
+ * A block cache on the local disk for the vector reads of remote files. Files are cut in blocks of fixed size; every
+ * block is stored in its own file in the cache directory, named after a hash of the file identity (e.g. the URL plus
+ * the size and the modification time of the file) and of the block index. Reads are served from the cached blocks
+ * when available, the missing blocks are read from the remote file in one vector read and added to the cache.
+ *
+ * The directory can be shared by the processes of a node: blocks are written to a temporary file that is atomically
+ * renamed, and a block file carries its full key so that a hash collision is treated as a cache miss. When the
+ * cache grows larger than its size limit, the least recently used blocks, according to the modification time of the
+ * block files which is refreshed on every hit, are removed until the cache is 10% under the limit.
+ *
+ * The global block cache, used by the remote RRawFile and TNetXNGFile instances, is configured by the
+ * `BlockCache.Dir`, `BlockCache.MaxSize` (MB) and `BlockCache.BlockSize` (bytes) rootrc settings.
+ *
+ * RBlockCache objects are thread safe.
+ */
+class RBlockCache {
+public:
+   static constexpr std::size_t kDefaultBlockSize = 256 * 1024;
+   /// Reads the given ranges from the remote file. A short read (fOutBytes < fSize) means that the block could not
+   /// be read, such a block is not cached.
+   using ReadFunc_t = std::function<void(RRawFile::RIOVec *ioVec, unsigned int nReq)>;
+
+private:
+   std::string fDirectory;
+   std::uint64_t fMaxSize;
+   std::size_t fBlockSize;
+   /// The bytes added to the cache by this process since the last eviction; eviction runs every 5% of fMaxSize
+   std::atomic<std::uint64_t> fBytesSinceEviction{0};
+   std::atomic<std::uint64_t> fNHits{0};
+   std::atomic<std::uint64_t> fNMisses{0};
+   std::mutex fEvictionMutex;
+
+   std::string GetBlockPath(const std::string &key) const;
+   bool LoadBlock(const std::string &path, const std::string &key, unsigned char *buffer, std::size_t size) const;
+   void StoreBlock(const std::string &path, const std::string &key, const unsigned char *buffer,
+                   std::size_t size) const;
+
+public:
+   /// The cache directory is created if needed. A maxSize of zero disables eviction.
+   RBlockCache(std::string_view directory, std::uint64_t maxSize, std::size_t blockSize = kDefaultBlockSize);
+   RBlockCache(const RBlockCache &) = delete;
+   RBlockCache &operator=(const RBlockCache &) = delete;
+   ~RBlockCache() = default;
+
+   /// Returns the cache configured in rootrc, or nullptr if BlockCache.Dir is not set
+   static std::shared_ptr<RBlockCache> GetGlobal();
+   /// Replaces the global cache, nullptr disables it. Affects files opened afterwards.
+   static void SetGlobal(std::shared_ptr<RBlockCache> cache);
+
+   /// Fills the requests from the cache and from readFunc, as RRawFile::ReadV() does. The fileId must change when
+   /// the content of the file changes. Without a known fileSize, the cache is bypassed.
+   void ReadV(const std::string &fileId, std::uint64_t fileSize, RRawFile::RIOVec *ioVec, unsigned int nReq,
+              const ReadFunc_t &readFunc);
+   /// Removes the least recently used blocks if the cache is larger than its size limit
+   void Evict();
+
+   const std::string &GetDirectory() const { return fDirectory; }
+   std::uint64_t GetMaxSize() const { return fMaxSize; }
+   std::size_t GetBlockSize() const { return fBlockSize; }
+   /// The number of blocks served from the cache and read from the remote file, respectively
+   std::uint64_t GetNHits() const { return fNHits; }
+   std::uint64_t GetNMisses() const { return fNMisses; }
+}; // class RBlockCache
+
+} // namespace Internal
+} // namespace ROOT
+
+#endif
@@ -0,0 +1,186 @@
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_RIOMetrics
+#define ROOT_RIOMetrics
+
+#include <ROOT/RStringView.hxx>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+
+namespace ROOT {
+namespace Experimental {
+
+/**
+ * \class RIOLatencyHistogram RIOMetrics.hxx
+ * \ingroup IO
+ *
+ * A histogram of durations with fixed bucket bounds: bucket i counts the durations up to 2^i microseconds, the last
+ * bucket counts the longer ones. Observe() is lock-free and can be called concurrently.
+ */
+class RIOLatencyHistogram {
+public:
+   /// Number of bounded buckets, the largest bound is 2^(kNBuckets - 1) microseconds (about 8 seconds)
+   static constexpr int kNBuckets = 24;
+
+private:
+   std::atomic<std::uint64_t> fBuckets[kNBuckets + 1] = {};
+   std::atomic<std::uint64_t> fSumNs{0};
+
+public:
+   void Observe(std::chrono::nanoseconds duration);
+   void Reset();
+
+   /// The number of durations in bucket i (not cumulative); i == kNBuckets is the unbounded bucket
+   std::uint64_t GetBucketCount(int i) const { return fBuckets[i].load(std::memory_order_relaxed); }
+   /// The upper bound of bucket i < kNBuckets in seconds
+   static double GetBucketBound(int i) { return 1e-6 * (std::uint64_t(1) << i); }
+   std::uint64_t GetCount() const;
+   std::uint64_t GetSumNs() const { return fSumNs.load(std::memory_order_relaxed); }
+};
+
+/**
+ * \class RIOFileMetrics RIOMetrics.hxx
+ * \ingroup IO
+ *
+ * The I/O metrics of one file as seen by one I/O layer (the "component", e.g. TFile or TTreeCache). The counters are
+ * relaxed atomics, such that different threads can update the metrics of the same file. Every component updates the
+ * counters that make sense for it, e.g. TTreeCache only counts cache hits and misses.
+ */
+class RIOFileMetrics {
+public:
+   using Clock_t = std::chrono::steady_clock;
+
+private:
+   std::string fComponent;
+   std::string fFile;
+   std::atomic<std::uint64_t> fBytesRead{0};
+   std::atomic<std::uint64_t> fReadCalls{0};
+   std::atomic<std::uint64_t> fBytesWritten{0};
+   std::atomic<std::uint64_t> fWriteCalls{0};
+   std::atomic<std::uint64_t> fCacheHits{0};
+   std::atomic<std::uint64_t> fCacheMisses{0};
+   std::atomic<std::uint64_t> fBytesUnzipped{0};
+   RIOLatencyHistogram fReadLatency;
+   RIOLatencyHistogram fWriteLatency;
+   RIOLatencyHistogram fUnzipTime;
+
+   static void Inc(std::atomic<std::uint64_t> &counter, std::uint64_t value)
+   {
+      counter.fetch_add(value, std::memory_order_relaxed);
+   }
+
+public:
+   RIOFileMetrics(std::string_view component, std::string_view file) : fComponent(component), fFile(file) {}
+   RIOFileMetrics(const RIOFileMetrics &) = delete;
+   RIOFileMetrics &operator=(const RIOFileMetrics &) = delete;
+
+   /// Start time for the Add...() methods that measure a duration
+   static Clock_t::time_point Now() { return Clock_t::now(); }
+
+   /// Records a read call of nbytes that began at start
+   void AddRead(std::uint64_t nbytes, Clock_t::time_point start)
+   {
+      Inc(fBytesRead, nbytes);
+      Inc(fReadCalls, 1);
+      fReadLatency.Observe(Clock_t::now() - start);
+   }
+   /// Records a write call of nbytes that began at start
+   void AddWrite(std::uint64_t nbytes, Clock_t::time_point start)
+   {
+      Inc(fBytesWritten, nbytes);
+      Inc(fWriteCalls, 1);
+      fWriteLatency.Observe(Clock_t::now() - start);
+   }
+   void AddCacheHit() { Inc(fCacheHits, 1); }
+   void AddCacheMiss() { Inc(fCacheMisses, 1); }
+   /// Records the decompression, begun at start, of a buffer to nbytes
+   void AddUnzip(std::uint64_t nbytes, Clock_t::time_point start)
+   {
+      Inc(fBytesUnzipped, nbytes);
+      fUnzipTime.Observe(Clock_t::now() - start);
+   }
+   void Reset();
+
+   const std::string &GetComponent() const { return fComponent; }
+   const std::string &GetFile() const { return fFile; }
+   std::uint64_t GetBytesRead() const { return fBytesRead.load(std::memory_order_relaxed); }
+   std::uint64_t GetReadCalls() const { return fReadCalls.load(std::memory_order_relaxed); }
+   std::uint64_t GetBytesWritten() const { return fBytesWritten.load(std::memory_order_relaxed); }
+   std::uint64_t GetWriteCalls() const { return fWriteCalls.load(std::memory_order_relaxed); }
+   std::uint64_t GetCacheHits() const { return fCacheHits.load(std::memory_order_relaxed); }
+   std::uint64_t GetCacheMisses() const { return fCacheMisses.load(std::memory_order_relaxed); }
+   std::uint64_t GetBytesUnzipped() const { return fBytesUnzipped.load(std::memory_order_relaxed); }
+   const RIOLatencyHistogram &GetReadLatency() const { return fReadLatency; }
+   const RIOLatencyHistogram &GetWriteLatency() const { return fWriteLatency; }
+   const RIOLatencyHistogram &GetUnzipTime() const { return fUnzipTime; }
+};
+
+/**
+ * \class RIOMetrics RIOMetrics.hxx
+ * \ingroup IO
+ *
+ * The process-wide registry of I/O metrics, with one RIOFileMetrics per component and file name. TFile, RRawFile,
+ * TTreeCache, TTreeCacheUnzip and the RNTuple file page source record their reads, cache hits and decompression in
+ * the registry if it is enabled when the file, cache or page source is opened. The registry is enabled by the
+ * `IO.Metrics` rootrc setting or by SetEnabled(); when it is disabled, the I/O layers only pay for a null pointer
+ * check.
+ *
+ * The metrics are kept for the lifetime of the process, also after the files are closed, and can be exported in the
+ * Prometheus text format or as JSON, e.g. for the textfile collector of a Prometheus node exporter:
+ * ~~~{.cpp}
+ * ROOT::Experimental::RIOMetrics::SetEnabled(true);
+ * // ... process files ...
+ * ROOT::Experimental::RIOMetrics::Instance().WriteToFile("/var/lib/node_exporter/root_io.prom");
+ * ~~~
+ */
+class RIOMetrics {
+private:
+   mutable std::mutex fMutex;
+   /// Keys are (component, file); the metrics objects stay at the same address for the lifetime of the registry
+   std::map<std::pair<std::string, std::string>, std::unique_ptr<RIOFileMetrics>> fFileMetrics;
+
+   RIOMetrics() = default;
+
+public:
+   RIOMetrics(const RIOMetrics &) = delete;
+   RIOMetrics &operator=(const RIOMetrics &) = delete;
+
+   static RIOMetrics &Instance();
+   /// Whether the I/O layers record metrics; the default is taken from the `IO.Metrics` rootrc setting
+   static bool IsEnabled();
+   /// Affects the files, caches and page sources opened afterwards
+   static void SetEnabled(bool enabled);
+   /// Returns the metrics of the file for the component, or nullptr if the registry is disabled
+   static RIOFileMetrics *GetFileMetricsIfEnabled(std::string_view component, std::string_view file);
+
+   /// Returns the metrics of the file for the component, creating them if needed
+   RIOFileMetrics &GetFileMetrics(std::string_view component, std::string_view file);
+   /// Sets all the metrics to zero
+   void Reset();
+
+   /// The metrics in the Prometheus text exposition format; all metric names start with `root_io_`
+   std::string ToPrometheus() const;
+   /// The metrics as a JSON array with one object per component and file
+   std::string ToJSON() const;
+   /// Atomically replaces the given file by the metrics, as JSON if the file name ends in `.json` and in the
+   /// Prometheus format otherwise. Returns false on error.
+   bool WriteToFile(std::string_view path) const;
+};
+
+} // namespace Experimental
+} // namespace ROOT
+
+#endif
@@ -9,6 +9,7 @@
 #ifndef ROOT_RIoUring
 #define ROOT_RIoUring
 
+#include <cerrno>
 #include <cstdint>
 #include <cstring>
 #include <stdexcept>
@@ -94,33 +95,33 @@ public:
       int fFileDes = -1;
    };
 
-   /// Submit a number of read events and wait for completion. Events are submitted in batches if
-   /// the number of events is larger than the submission queue depth.
+   /// Submit a number of read events and wait for completion. If the number of events is larger than the
+   /// submission queue depth, the queue is kept filled: as soon as a read completes, the next pending read event
+   /// is submitted. Thus up to GetQueueDepth() reads are in flight at any point in time.
    void SubmitReadsAndWait(RReadEvent* readEvents, unsigned int nReads) {
-      unsigned int batch = 0;
-      unsigned int batchSize = fDepth;
-      unsigned int readPos = 0;
+      unsigned int nSubmitted = 0;
+      unsigned int nCompleted = 0;
 
-      while (readPos < nReads) {
-         if (readPos + batchSize > nReads) {
-            batchSize = nReads - readPos;
-         }
-         // prep reads
+      while (nCompleted < nReads) {
+         // prep reads until either all reads are submitted or the queue is full
+         unsigned int nPrepared = 0;
          struct io_uring_sqe *sqe;
-         for (std::size_t i = readPos; i < readPos + batchSize; ++i) {
-            sqe = io_uring_get_sqe(&fRing);
-            if (!sqe) {
-               throw std::runtime_error("batch " + std::to_string(batch) + ": "
-                  + "get SQE failed for read request '" + std::to_string(i)
-                  + "', error: " + std::string(strerror(errno)));
-            }
+         while ((nSubmitted + nPrepared < nReads) && (nSubmitted + nPrepared - nCompleted < fDepth)) {
+            const std::size_t i = nSubmitted + nPrepared;
             if (readEvents[i].fFileDes == -1) {
-               throw std::runtime_error("batch " + std::to_string(batch) + ": "
-                  + "bad fd (-1) for read request '" + std::to_string(i) + "'");
+               throw std::runtime_error("bad fd (-1) for read request '" + std::to_string(i) + "'");
             }
             if (readEvents[i].fBuffer == nullptr) {
-               throw std::runtime_error("batch " + std::to_string(batch) + ": "
-                  + "null read buffer for read request '" + std::to_string(i) + "'");
+               throw std::runtime_error("null read buffer for read request '" + std::to_string(i) + "'");
+            }
+            sqe = io_uring_get_sqe(&fRing);
+            if (!sqe) {
+               // the submission queue is full, submit what we have so far
+               if (nPrepared == 0) {
+                  throw std::runtime_error("get SQE failed for read request '" + std::to_string(i) +
+                                           "', error: " + std::string(strerror(errno)));
+               }
+               break;
             }
             io_uring_prep_read(sqe,
                readEvents[i].fFileDes,
@@ -130,42 +131,44 @@ public:
             );
             sqe->flags |= IOSQE_ASYNC; // maximize read event throughput
             sqe->user_data = i;
+            nPrepared++;
          }
 
-         // todo(max) check for any difference between submit vs. submit and wait for large nReq
-         int submitted = io_uring_submit_and_wait(&fRing, batchSize);
-         if (submitted <= 0) {
-            throw std::runtime_error("batch " + std::to_string(batch) + ": "
-               "ring submit failed, error: " + std::string(strerror(errno)));
-         }
-         if (submitted != static_cast<int>(batchSize)) {
-            throw std::runtime_error("ring submitted " + std::to_string(submitted) +
-               " events but requested " + std::to_string(batchSize));
+         if (nPrepared > 0) {
+            int submitted = io_uring_submit(&fRing);
+            if (submitted <= 0) {
+               throw std::runtime_error("ring submit failed, error: " + std::string(strerror(errno)));
+            }
+            if (submitted != static_cast<int>(nPrepared)) {
+               throw std::runtime_error("ring submitted " + std::to_string(submitted) +
+                  " events but requested " + std::to_string(nPrepared));
+            }
+            nSubmitted += nPrepared;
          }
-         // reap reads
+
+         // reap at least one read, then all further reads that are already completed
          struct io_uring_cqe *cqe;
-         int ret;
-         for (int i = 0; i < submitted; ++i) {
-            ret = io_uring_wait_cqe(&fRing, &cqe);
-            if (ret < 0) {
-               throw std::runtime_error("wait cqe failed, error: " + std::string(std::strerror(-ret)));
-            }
+         int ret = io_uring_wait_cqe(&fRing, &cqe);
+         while (ret == 0) {
             auto index = reinterpret_cast<std::size_t>(io_uring_cqe_get_data(cqe));
             if (index >= nReads) {
                throw std::runtime_error("bad cqe user data: " + std::to_string(index));
             }
             if (cqe->res < 0) {
-               throw std::runtime_error("batch " + std::to_string(batch) + ": "
-                  + "read failed for ReadEvent[" + std::to_string(index) + "], "
+               throw std::runtime_error("read failed for ReadEvent[" + std::to_string(index) + "], "
                   "error: " + std::string(std::strerror(-cqe->res)));
             }
             readEvents[index].fOutBytes = static_cast<std::size_t>(cqe->res);
             io_uring_cqe_seen(&fRing, cqe);
+            nCompleted++;
+            if (nCompleted == nSubmitted)
+               break;
+            ret = io_uring_peek_cqe(&fRing, &cqe);
+         }
+         if (ret < 0 && ret != -EAGAIN) {
+            throw std::runtime_error("wait cqe failed, error: " + std::string(std::strerror(-ret)));
          }
-         readPos += batchSize;
-         batch += 1;
       }
-      return;
    }
 };
 
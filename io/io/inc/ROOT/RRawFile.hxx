@@ -16,12 +16,19 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <future>
 #include <memory>
 #include <string>
 
 namespace ROOT {
+namespace Experimental {
+class RIOFileMetrics;
+}
+
 namespace Internal {
 
+class RBlockCache;
+
 /**
  * \class RRawFile RRawFile.hxx
  * \ingroup IO
@@ -37,6 +44,12 @@ namespace Internal {
  *
  * RRawFiles manage system resources and are therefore made non-copyable. They can be explicitly cloned though.
  *
+ * Vector reads of remote files go through the local disk block cache if one is configured, see RBlockCache.
+ *
+ * ReadVAsync() submits a vector read without waiting for it, so that I/O overlaps with computation. Backends with
+ * native asynchronous I/O (kFeatureHasAsyncIo) complete it in the background: the local file with io_uring, XRootD
+ * with the asynchronous XrdCl calls. The others complete the read before ReadVAsync() returns.
+ *
  * RRawFile objects are conditionally thread safe. See the user manual for further details:
  * https://root.cern/manual/thread_safety/
  */
@@ -108,6 +121,13 @@ private:
    std::uint64_t fFileSize;
    /// Files are opened lazily and only when required; the open state is kept by this flag
    bool fIsOpen;
+   /// The local disk cache for the vector reads of remote files, if configured
+   std::shared_ptr<RBlockCache> fBlockCache;
+   /// Records the reads from the file if ROOT::Experimental::RIOMetrics was enabled when the file was created
+   ROOT::Experimental::RIOFileMetrics *fIOMetrics = nullptr;
+
+   /// Calls ReadAtImpl() and records the read in fIOMetrics
+   size_t ReadAtRecorded(void *buffer, size_t nbytes, std::uint64_t offset);
 
 protected:
    std::string fUrl;
@@ -137,6 +157,9 @@ protected:
 
    /// By default implemented as a loop of ReadAt calls but can be overwritten, e.g. XRootD or DAVIX implementations
    virtual void ReadVImpl(RIOVec *ioVec, unsigned int nReq);
+   /// By default calls ReadVImpl() and returns a ready future. Derived classes with kFeatureHasAsyncIo submit the
+   /// reads and fulfill the future from the completion of the last one, without blocking the calling thread.
+   virtual std::future<void> ReadVAsyncImpl(RIOVec *ioVec, unsigned int nReq);
 
 public:
    RRawFile(std::string_view url, ROptions options);
@@ -169,9 +192,15 @@ public:
    std::uint64_t GetSize();
    /// Returns the url of the file
    std::string GetUrl() const;
+   /// Returns the options, in particular the line break detected by the first Readln call in kAuto mode
+   const ROptions &GetOptions() const { return fOptions; }
 
-   /// Opens the file if necessary and calls ReadVImpl
+   /// Opens the file if necessary and calls ReadVImpl, through the block cache if there is one
    void ReadV(RIOVec *ioVec, unsigned int nReq);
+   /// Like ReadV() but returns once the reads are submitted. The future becomes ready when the fOutBytes of all the
+   /// requests are set, or holds the exception of a failed read. The requests and their buffers must stay valid
+   /// until then. Reads through the block cache are synchronous.
+   std::future<void> ReadVAsync(RIOVec *ioVec, unsigned int nReq);
 
    /// Memory mapping according to POSIX standard; in particular, new mappings of the same range replace older ones.
    /// Mappings need to be aligned at page boundaries, therefore the real offset can be smaller than the desired value.
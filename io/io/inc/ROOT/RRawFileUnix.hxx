@@ -15,27 +15,46 @@
 #include <ROOT/RRawFile.hxx>
 #include <ROOT/RStringView.hxx>
 
+#include "RConfigure.h" // for R__HAS_URING
+
 #include <cstddef>
 #include <cstdint>
+#include <memory>
+#include <mutex>
 
 namespace ROOT {
 namespace Internal {
 
+class RIoUring;
+
 /**
  * \class RRawFileUnix RRawFileUnix.hxx
  * \ingroup IO
  *
  * The RRawFileUnix class uses POSIX calls to read from a mounted file system. Thus the path name can refer,
  * for instance, to a named pipe instead of a regular file.
+ *
+ * If ROOT is built with io_uring support, vector reads are submitted to an io_uring instance that is created
+ * on the first call to ReadV() and kept for the lifetime of the file object. Thus repeated vector reads,
+ * e.g. of the clusters of an RNTuple, don't pay for the ring setup and keep the device queue filled.
+ * ReadVAsync() uses a ring shared by all files, whose completions are reaped by a single background thread;
+ * the file object must outlive the returned future.
  */
 class RRawFileUnix : public RRawFile {
 private:
    int fFileDes;
+#ifdef R__HAS_URING
+   /// Persistent io_uring instance used by ReadVImpl(); created on first use
+   std::unique_ptr<RIoUring> fIoUring; //!
+   /// Protects fIoUring, which must not be used concurrently
+   std::mutex fIoUringLock; //!
+#endif
 
 protected:
    void OpenImpl() final;
    size_t ReadAtImpl(void *buffer, size_t nbytes, std::uint64_t offset) final;
    void ReadVImpl(RIOVec *ioVec, unsigned int nReq) final;
+   std::future<void> ReadVAsyncImpl(RIOVec *ioVec, unsigned int nReq) final;
    std::uint64_t GetSizeImpl() final;
    void *MapImpl(size_t nbytes, std::uint64_t offset, std::uint64_t &mapdOffset) final;
    void UnmapImpl(void *region, size_t nbytes) final;
@@ -15,10 +15,13 @@
 #include "TFileMerger.h"
 #include "TMemFile.h"
 
+#include <atomic>
+#include <condition_variable>
 #include <functional>
 #include <memory>
 #include <mutex>
-#include <queue>
+#include <thread>
+#include <vector>
 
 namespace ROOT {
 
@@ -35,6 +38,13 @@ class TBufferMergerFile;
  * socket, TBufferMerger uses threads that each write to a
  * TBufferMergerFile, which in turn push data into a queue
  * managed by the TBufferMerger.
+ *
+ * Pushing to the queue is lock-free, so writers do not wait for each
+ * other. By default, the buffers are merged by the writer that pushes
+ * data while no other thread is merging; SetMergeInBackground() moves
+ * the merging to a dedicated thread instead. SetMaxBuffered() bounds
+ * the memory held by the queue: writers that push data beyond that
+ * limit wait until it has been merged.
  */
 
 class TBufferMerger {
@@ -70,7 +80,7 @@ public:
    /** Returns the number of buffers currently in the queue. */
    size_t GetQueueSize() const;
 
-   /** Returns the number of bytes currently buffered (i.e. in the queue). */
+   /** Returns the number of bytes currently buffered (i.e. in the queue or being merged). */
    size_t GetBuffered() const
    {
       return fBuffered;
@@ -79,6 +89,12 @@ public:
    /** Returns the current value of the auto save setting in bytes (default = 0). */
    size_t GetAutoSave() const;
 
+   /** Returns the maximum number of bytes buffered before writers wait for the merge (default = 0, no limit). */
+   size_t GetMaxBuffered() const { return fMaxBuffered; }
+
+   /** Returns whether the buffers are merged by a dedicated thread, see SetMergeInBackground(). */
+   Bool_t GetMergeInBackground() const { return fMergeThread.joinable(); }
+
    /** Returns the current merge options. */
    const char* GetMergeOptions();
 
@@ -92,6 +108,24 @@ public:
     */
    void SetAutoSave(size_t size);
 
+   /** Bounds the memory used by the buffers waiting to be merged. A
+    *  TBufferMergerFile::Write() that brings the buffered size above size
+    *  bytes returns only once enough data has been merged, merging it itself
+    *  if no other thread is doing so. The queue thus holds at most size
+    *  bytes plus one buffer per writer. 0 (the default) means no limit.
+    */
+   void SetMaxBuffered(size_t size);
+
+   /** Merges the buffers in a dedicated thread, started by this call, instead
+    *  of in the writer threads. TBufferMergerFile::Write() then only copies
+    *  the data and pushes it to the queue, and the merge thread wakes up
+    *  once the buffered size exceeds the auto save setting.
+    *  Passing false stops the merge thread; the buffers it did not merge are
+    *  merged by the next writer or by the destructor.
+    *  Must not be called while TBufferMergerFiles are being written.
+    */
+   void SetMergeInBackground(Bool_t enable = kTRUE);
+
    /** Sets the merge options. SetMergeOptions("fast") will disable
     * recompression of input data into the output if they have different
     * compression settings.
@@ -151,19 +185,33 @@ private:
 
    void Init(std::unique_ptr<TFile>);
 
+   /** Element of the merge queue, a singly linked list of the pushed buffers, most recent first */
+   struct QueueNode {
+      TBufferFile *fBuffer;
+      QueueNode *fNext;
+   };
+
    void MergeImpl();
 
    void Merge();
+   void MergeThreadLoop();
+   void NotifyWaiting();
    void Push(TBufferFile *buffer);
    bool TryMerge(TBufferMergerFile *memfile);
+   void WaitForMerge();
 
    bool fCompressTemporaryKeys{false};                           //< Enable compression of the TKeys in the TMemFile (save memory at the expense of time, end result is unchanged)
    size_t fAutoSave{0};                                          //< AutoSave only every fAutoSave bytes
+   size_t fMaxBuffered{0};                                       //< Writers wait for the merge above this size (0: no limit)
    std::atomic<size_t> fBuffered{0};                             //< Number of bytes currently buffered
    TFileMerger fMerger{false, false};                            //< TFileMerger used to merge all buffers
    std::mutex fMergeMutex;                                       //< Mutex used to lock fMerger
-   mutable std::mutex fQueueMutex;                               //< Mutex used to lock fQueue
-   std::queue<TBufferFile *> fQueue;                             //< Queue to which data is pushed and merged
+   std::atomic<QueueNode *> fQueue{nullptr};                     //< Lock-free queue to which data is pushed and merged
+   std::atomic<size_t> fQueueSize{0};                            //< Number of buffers in fQueue
+   std::mutex fWaitMutex;                                        //< Mutex used with fWaitCondition
+   std::condition_variable fWaitCondition;                       //< Wakes up the merge thread and the waiting writers
+   bool fStopMergeThread{false};                                 //< Stops the merge thread, protected by fWaitMutex
+   std::thread fMergeThread;                                     //< Dedicated merge thread, see SetMergeInBackground()
    std::vector<std::weak_ptr<TBufferMergerFile>> fAttachedFiles; //< Attached files
 };
 
@@ -17,6 +17,8 @@
 
 #include <deque>
 #include <memory>
+#include <cstddef>
+#include <functional>
 #include <string>
 #include <vector>
 
@@ -48,10 +50,14 @@ public:
      kSkipTypeInfo  = 100            ///< do not store typenames in JSON
    };
 
+   /// Receives the JSON code produced by StoreObject() piece by piece, see SetOutputSink()
+   using OutputSink_t = std::function<void(const char *data, std::size_t len)>;
+
    TBufferJSON(TBuffer::EMode mode = TBuffer::kWrite);
    ~TBufferJSON() override;
 
    void SetCompact(int level);
+   void SetOutputSink(OutputSink_t sink, Int_t chunkSize = 65536);
    void SetTypenameTag(const char *tag = "_typename");
    void SetTypeversionTag(const char *tag = nullptr);
    void SetSkipClassInfo(const TClass *cl);
@@ -295,6 +301,7 @@ protected:
    void *JsonReadObject(void *obj, const TClass *objClass = nullptr, TClass **readClass = nullptr);
 
    void AppendOutput(const char *line0, const char *line1 = nullptr);
+   void FlushOutputSink();
 
    void JsonPushValue();
 
@@ -317,6 +324,9 @@ protected:
    TString fOutBuffer;                 ///<!  main output buffer for json code
    TString *fOutput{nullptr};          ///<!  current output buffer for json code
    TString fValue;                     ///<!  buffer for current value
+   OutputSink_t fOutputSink;           ///<!  when set, receives fOutBuffer once it exceeds fSinkChunkSize
+   Int_t fSinkChunkSize{65536};        ///<!  size of the pieces of JSON code passed to fOutputSink
+   Long64_t fSinkBytes{0};             ///<!  number of bytes passed to fOutputSink
    unsigned fJsonrCnt{0};              ///<!  counter for all objects, used for referencing
    std::deque<std::unique_ptr<TJSONStackObj>> fStack; ///<!  hierarchy of currently streamed element
    Int_t fCompact{0};                  ///<!  0 - no any compression, 1 - no spaces in the begin, 2 - no new lines, 3 - no spaces at all
@@ -29,6 +29,12 @@
 class TKey;
 class TFile;
 
+namespace ROOT {
+namespace Internal {
+class RKeyIndex;
+}
+} // namespace ROOT
+
 class TDirectoryFile : public TDirectory {
 
 protected:
@@ -44,8 +50,13 @@ protected:
    Long64_t    fSeekKeys{0};             ///< Location of Keys record on file
    TFile      *fFile{nullptr};           ///< Pointer to current file in memory
    TList      *fKeys{nullptr};           ///< Pointer to keys list in memory
+   mutable ROOT::Internal::RKeyIndex *fKeyIndex{nullptr}; ///<! Index of the keys not yet in fKeys, see ReadKeys()
 
    void        CleanTargets();
+   Int_t       CountKeysOfClass(const char *classname) const;
+   void        DeleteKeyIndex();
+   TList      *GetListOfKeysNamed(const char *name) const;
+   void        MaterializeKeys() const;
    void        InitDirectoryFile(TClass *cl = nullptr);
    void        BuildDirectoryFile(TFile* motherFile, TDirectory* motherDir);
 
@@ -91,10 +102,10 @@ public:
    const TDatime      &GetCreationDate() const { return fDatimeC; }
            TFile      *GetFile() const override { return fFile; }
            TKey       *GetKey(const char *name, Short_t cycle=9999) const override;
-           TList      *GetListOfKeys() const override { return fKeys; }
+           TList      *GetListOfKeys() const override { if (fKeyIndex) MaterializeKeys(); return fKeys; }
    const TDatime      &GetModificationDate() const { return fDatimeM; }
            Int_t       GetNbytesKeys() const override { return fNbytesKeys; }
-           Int_t       GetNkeys() const override { return fKeys->GetSize(); }
+           Int_t       GetNkeys() const override;
            Long64_t    GetSeekDir() const override { return fSeekDir; }
            Long64_t    GetSeekParent() const override { return fSeekParent; }
            Long64_t    GetSeekKeys() const override { return fSeekKeys; }
@@ -51,9 +51,21 @@ class TProcessID;
 class TStopwatch;
 class TFilePrefetch;
 
+namespace ROOT {
+namespace Internal {
+class TKeyCompressor;
+}
+namespace Experimental {
+class RIOFileMetrics;
+}
+}
+
 class TFile : public TDirectoryFile {
   friend class TDirectoryFile;
+  friend class TKey;
+  friend class ROOT::Internal::TKeyCompressor;
   friend class TFilePrefetch;
+  friend class TFileCacheWrite;
 // TODO: We need to make sure only one TBasket is being written at a time
 // if we are writing multiple baskets in parallel.
 #ifdef R__USE_IMT
@@ -114,6 +126,8 @@ protected:
    TList           *fOpenPhases{nullptr};     ///<!Time info about open phases
 
    bool             fGlobalRegistration = true; ///<! if true, bypass use of global lists
+   ROOT::Internal::TKeyCompressor *fKeyCompressor{nullptr}; ///<!Compresses the keys written by TDirectoryFile::Write() in parallel
+   ROOT::Experimental::RIOFileMetrics *fIOMetrics{nullptr}; ///<!Metrics of the reads and writes, if ROOT::Experimental::RIOMetrics is enabled
 
 #ifdef R__USE_IMT
    std::mutex                                 fWriteMutex;  ///<!Lock for writing baskets / keys into the file.
@@ -16,6 +16,12 @@
 
 class TFile;
 
+namespace ROOT {
+namespace Internal {
+class RFileCacheWriteFlusher;
+}
+} // namespace ROOT
+
 class TFileCacheWrite : public TObject {
 
 protected:
@@ -25,6 +31,10 @@ protected:
    TFile        *fFile;           ///< Pointer to file
    char         *fBuffer;         ///< [fBufferSize] buffer of contiguous prefetched blocks
    Bool_t        fRecursive;      ///< flag to avoid recursive calls
+   ROOT::Internal::RFileCacheWriteFlusher *fFlusher{nullptr}; ///<! Background writer, see SetAsyncFlush()
+
+   Bool_t        FlushAsync();
+   Bool_t        WaitForFlush();
 
 private:
    TFileCacheWrite(const TFileCacheWrite &) = delete;            //cannot be copied
@@ -35,10 +45,12 @@ public:
    TFileCacheWrite(TFile *file, Int_t buffersize);
    ~TFileCacheWrite() override;
    virtual Bool_t      Flush();
-   virtual Int_t       GetBytesInCache() const { return fNtot; }
+           Bool_t      GetAsyncFlush() const { return fFlusher != nullptr; }
+   virtual Int_t       GetBytesInCache() const;
            void        Print(Option_t *option="") const override;
    virtual Int_t       ReadBuffer(char *buf, Long64_t pos, Int_t len);
    virtual Int_t       WriteBuffer(const char *buf, Long64_t pos, Int_t len);
+   virtual void        SetAsyncFlush(Bool_t async = kTRUE);
    virtual void        SetFile(TFile *file);
 
    ClassDefOverride(TFileCacheWrite,1)  //TFile cache when writing
@@ -54,10 +54,13 @@ protected:
    TString        fObjectNames;               ///< List of object names to be either merged exclusively or skipped
    TList          fMergeList;                 ///< list of TObjString containing the name of the files need to be merged
    TList          fExcessFiles;               ///<! List of TObjString containing the name of the files not yet added to fFileList due to user or system limitation on the max number of files opened.
+   UInt_t         fNThreads{1};               ///<! Number of threads reading and merging the histograms (default 1)
 
    Bool_t         OpenExcessFiles();
    virtual Bool_t AddFile(TFile *source, Bool_t own, Bool_t cpProgress);
    virtual Bool_t MergeRecursive(TDirectory *target, TList *sourcelist, Int_t type = kRegular | kAll);
+   Bool_t         MergeHistogramsInParallel(TDirectory *target, TList *sourcelist, Int_t type, const TString &path,
+                                            THashList &allNames);
 
    virtual Bool_t MergeOne(TDirectory *target, TList *sourcelist, Int_t type,
                 TFileMergeInfo &info, TString &oldkeyname, THashList &allNames, Bool_t &status, Bool_t &onlyListed,
@@ -92,6 +95,8 @@ public:
    TFile      *GetOutputFile() const { return fOutputFile; }
    Int_t       GetMaxOpenedFiles() const { return fMaxOpenedFiles; }
    void        SetMaxOpenedFiles(Int_t newmax);
+   UInt_t      GetNThreads() const { return fNThreads; }
+   void        SetNThreads(UInt_t nThreads);
    const char *GetMsgPrefix() const { return fMsgPrefix; }
    void        SetMsgPrefix(const char *prefix);
    const char *GetMergeOptions() { return fMergeOptions; }
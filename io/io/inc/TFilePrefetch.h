@@ -15,7 +15,6 @@
 #include "TObject.h"
 #include "TString.h"
 #include "TStopwatch.h"
-#include "TThread.h"
 #include "TFile.h"
 
 #include <atomic>
@@ -23,10 +22,8 @@
 #include <mutex>
 
 #ifdef R__LESS_INCLUDES
-class TSemaphore;
 class TFPBlock;
 #else
-#include "TSemaphore.h"
 #include "TFPBlock.h"
 #endif
 
@@ -36,25 +33,21 @@ private:
    TFile      *fFile;                       ///< reference to the file
    TList      *fPendingBlocks;              ///< list of pending blocks to be read
    TList      *fReadBlocks;                 ///< list of blocks read
-   TThread    *fConsumer;                   ///< consumer thread
    std::mutex fMutexPendingList;            ///< mutex for the pending list
    std::mutex fMutexReadList;               ///< mutex for the list of read blocks
-   std::condition_variable fNewBlockAdded;  ///< signal the addition of a new pending block
    std::condition_variable fReadBlockAdded; ///< signal the addition of a new red block
-   TSemaphore *fSemChangeFile;              ///< semaphore used when changing a file in TChain
    TString     fPathCache;                  ///< path to the cache directory
    TStopwatch  fWaitTime;                   ///< time waiting to prefetch a buffer (in usec)
-   Bool_t      fThreadJoined;               ///< mark if async thread was joined
-   std::atomic<Bool_t> fPrefetchFinished;   ///< true if prefetching is over
-
-   static TThread::VoidRtnFunc_t ThreadProc(void*);  //create a joinable worker thread
+   Long64_t    fReadBytes;                  ///< size of the blocks in the read list, counted in the memory budget
+   Bool_t      fStarted;                    ///< true if blocks are sent to the shared prefetch engine
+   std::atomic<Bool_t> fWaitingForBlock;    ///< true while ReadBuffer waits for a block that is not read yet
 
 public:
    TFilePrefetch(TFile*);
    ~TFilePrefetch() override;
 
    void      ReadAsync(TFPBlock*, Bool_t&);
-   void      ReadListOfBlocks();
+   Bool_t    ReadListOfBlocks();
 
    void      AddPendingBlock(TFPBlock*);
    TFPBlock *GetPendingBlock();
@@ -64,7 +57,6 @@ public:
    void      ReadBlock(Long64_t*, Int_t*, Int_t);
    TFPBlock *CreateBlockObj(Long64_t*, Int_t*, Int_t);
 
-   TThread  *GetThread() const;
    Int_t     ThreadStart();
 
    Bool_t    SetCache(const char*);
@@ -77,9 +69,7 @@ public:
    Long64_t  GetWaitTime();
 
    void      SetFile(TFile* file, TFile::ECacheAction action = TFile::kDisconnect);
-   std::condition_variable &GetCondNewBlock() { return fNewBlockAdded; };
    void      WaitFinishPrefetch();
-   Bool_t    IsPrefetchFinished() const { return fPrefetchFinished; }
 
    ClassDefOverride(TFilePrefetch, 0);  // File block prefetcher
 };
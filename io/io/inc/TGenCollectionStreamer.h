@@ -42,6 +42,21 @@ protected:
    void ReadBufferDefault(TBuffer &b, void *obj, const TClass *onFileClass);
    void ReadBufferGeneric(TBuffer &b, void *obj, const TClass *onFileClass);
 
+   /// Consecutive fundamental data members of the value class with the same size, see HasTrivialValueLayout()
+   struct TrivialRun_t {
+      Int_t fOffset;    ///< Offset of the first member in the object
+      Int_t fTypeSize;  ///< Size of one value in bytes
+      Int_t fCount;     ///< Number of values
+   };
+   std::vector<TrivialRun_t> fTrivialRuns; ///< Data members of the value class, in streaming order
+   Int_t fTrivialPayload{0};               ///< Number of bytes of the data members of one object in the buffer
+   std::atomic<Int_t> fTrivialState{0};    ///< 1 if the value class has a trivial layout, -1 if not, 0 if unknown
+
+   Bool_t HasTrivialValueLayout(TBuffer &b);
+   Int_t  FillTrivialHeader(char *header) const;
+   Int_t  ReadTrivialObjects(int nElements, TBuffer &b, char *first);
+   Bool_t WriteTrivialObjects(int nElements, TBuffer &b, const char *first);
+
 private:
    TGenCollectionStreamer &operator=(const TGenCollectionStreamer&); // Not implemented.
 
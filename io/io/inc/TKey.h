@@ -25,7 +25,14 @@ class TBrowser;
 class TDirectory;
 class TFile;
 
+namespace ROOT {
+namespace Internal {
+class TKeyCompressor;
+}
+}
+
 class TKey : public TNamed {
+   friend class ROOT::Internal::TKeyCompressor;
 
 private:
    enum EStatusBits {
@@ -56,6 +63,8 @@ protected:
            void     Build(TDirectory* motherDir, const char* classname, Long64_t filepos);
            void     Reset(); // Currently only for the use of TBasket.
    virtual Int_t    WriteFileKeepBuffer(TFile *f = nullptr);
+           Int_t    ZipObject(Int_t cxlevel, Int_t cxAlgorithm, Bool_t parallel = kTRUE);
+           void     CreateWithBuffer(Int_t nzip);
 
  public:
    TKey();
@@ -68,6 +77,12 @@ protected:
    TKey(Long64_t pointer, Int_t nbytes, TDirectory* motherDir = nullptr);
    ~TKey() override;
 
+   // Keys (and baskets) are allocated from the object pool of TStorage, if enabled
+   void       *operator new(size_t sz) { return TStorage::ObjectPoolAlloc(sz); }
+   void       *operator new(size_t sz, void *vp) { return TStorage::ObjectAlloc(sz, vp); }
+   void        operator delete(void *ptr, size_t sz);
+   void        operator delete(void *ptr, void *vp) { TStorage::ObjectDealloc(ptr, vp); }
+
            void        Browse(TBrowser *b) override;
            void        Delete(Option_t *option="") override;
    virtual void        DeleteBuffer();
@@ -0,0 +1,36 @@
+// @(#)root/io:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_TSharedMemFile
+#define ROOT_TSharedMemFile
+
+#include "TMemFile.h"
+
+class TSharedMemFile : public TMemFile {
+private:
+   void    *fMapping{nullptr};   ///<! Start of the mapped shared memory segment
+   Long64_t fMappingSize{0};     ///<! Size of the mapped shared memory segment
+
+   static ZeroCopyView_t MapSegment(const char *name, Bool_t unlinkSegment);
+
+   TSharedMemFile(const TSharedMemFile &) = delete;
+   TSharedMemFile &operator=(const TSharedMemFile &) = delete;
+
+public:
+   TSharedMemFile(const char *name, Bool_t unlinkSegment = kTRUE);
+   ~TSharedMemFile() override;
+
+   static Bool_t Publish(const TMemFile &file, const char *name);
+   static Bool_t Unlink(const char *name);
+
+   ClassDefOverride(TSharedMemFile, 0) // A read-only ROOT file in a POSIX shared memory segment
+};
+
+#endif
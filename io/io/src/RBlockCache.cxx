@@ -0,0 +1,249 @@
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include <ROOT/RBlockCache.hxx>
+
+#include "TEnv.h"
+#include "TError.h"
+#include "TSystem.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <ctime>
+#include <map>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace {
+const char kBlockMagic[8] = {'R', 'B', 'L', 'K', 'C', 'A', 'C', '1'};
+const char *kBlockSuffix = ".blk";
+const char *kTmpInfix = ".tmp.";
+/// Temporary files of crashed writers older than this are removed on eviction
+constexpr long kTmpFileMaxAge = 3600;
+
+std::mutex gGlobalCacheMutex;
+bool gIsGlobalCacheInitialized = false;
+std::shared_ptr<ROOT::Internal::RBlockCache> gGlobalCache;
+
+std::uint64_t HashFNV1a(const std::string &key, std::uint64_t seed)
+{
+   std::uint64_t h = seed;
+   for (unsigned char c : key) {
+      h ^= c;
+      h *= 0x100000001b3ULL;
+   }
+   return h;
+}
+
+bool EndsWith(const std::string &s, const char *suffix)
+{
+   const auto len = strlen(suffix);
+   return s.size() >= len && s.compare(s.size() - len, len, suffix) == 0;
+}
+} // anonymous namespace
+
+ROOT::Internal::RBlockCache::RBlockCache(std::string_view directory, std::uint64_t maxSize, std::size_t blockSize)
+   : fDirectory(directory), fMaxSize(maxSize), fBlockSize(blockSize > 0 ? blockSize : kDefaultBlockSize)
+{
+   if (gSystem->AccessPathName(fDirectory.c_str()) && gSystem->mkdir(fDirectory.c_str(), kTRUE) != 0)
+      ::Error("RBlockCache", "cannot create the cache directory %s", fDirectory.c_str());
+}
+
+std::shared_ptr<ROOT::Internal::RBlockCache> ROOT::Internal::RBlockCache::GetGlobal()
+{
+   std::lock_guard<std::mutex> lock(gGlobalCacheMutex);
+   if (!gIsGlobalCacheInitialized) {
+      gIsGlobalCacheInitialized = true;
+      std::string directory = gEnv->GetValue("BlockCache.Dir", "");
+      if (!directory.empty()) {
+         std::uint64_t maxSize = std::max(0, gEnv->GetValue("BlockCache.MaxSize", 10240));
+         std::size_t blockSize = std::max(0, gEnv->GetValue("BlockCache.BlockSize", int(kDefaultBlockSize)));
+         gGlobalCache = std::make_shared<RBlockCache>(gSystem->ExpandPathName(directory.c_str()),
+                                                      maxSize * 1024 * 1024, blockSize);
+      }
+   }
+   return gGlobalCache;
+}
+
+void ROOT::Internal::RBlockCache::SetGlobal(std::shared_ptr<RBlockCache> cache)
+{
+   std::lock_guard<std::mutex> lock(gGlobalCacheMutex);
+   gIsGlobalCacheInitialized = true;
+   gGlobalCache = std::move(cache);
+}
+
+std::string ROOT::Internal::RBlockCache::GetBlockPath(const std::string &key) const
+{
+   char name[33];
+   snprintf(name, sizeof(name), "%016llx%016llx", (unsigned long long)HashFNV1a(key, 0xcbf29ce484222325ULL),
+            (unsigned long long)HashFNV1a(key, 0x84222325cbf29ce4ULL));
+   return fDirectory + "/" + name + kBlockSuffix;
+}
+
+/// A block file consists of the magic bytes, the length of the key, the key and the block content
+bool ROOT::Internal::RBlockCache::LoadBlock(const std::string &path, const std::string &key, unsigned char *buffer,
+                                            std::size_t size) const
+{
+   FILE *f = fopen(path.c_str(), "rb");
+   if (!f)
+      return false;
+
+   bool isValid = false;
+   char magic[sizeof(kBlockMagic)];
+   std::uint32_t keySize = 0;
+   if (fread(magic, sizeof(magic), 1, f) == 1 && memcmp(magic, kBlockMagic, sizeof(magic)) == 0 &&
+       fread(&keySize, sizeof(keySize), 1, f) == 1 && keySize == key.size()) {
+      std::string storedKey(keySize, '\0');
+      isValid = fread(&storedKey[0], keySize, 1, f) == 1 && storedKey == key &&
+                fread(buffer, 1, size, f) == size && fgetc(f) == EOF;
+   }
+   fclose(f);
+
+   // Refresh the modification time, which is the last access time for the eviction
+   if (isValid)
+      gSystem->Utime(path.c_str(), time(nullptr), 0);
+   return isValid;
+}
+
+void ROOT::Internal::RBlockCache::StoreBlock(const std::string &path, const std::string &key,
+                                             const unsigned char *buffer, std::size_t size) const
+{
+   // Other processes and threads can store the same block at the same time, each one uses its own temporary file
+   const auto tmpPath = path + kTmpInfix + std::to_string(gSystem->GetPid()) + "." +
+                        std::to_string(std::hash<std::thread::id>()(std::this_thread::get_id()));
+   FILE *f = fopen(tmpPath.c_str(), "wb");
+   if (!f)
+      return;
+
+   const std::uint32_t keySize = key.size();
+   bool isWritten = fwrite(kBlockMagic, sizeof(kBlockMagic), 1, f) == 1 &&
+                    fwrite(&keySize, sizeof(keySize), 1, f) == 1 && fwrite(key.data(), keySize, 1, f) == 1 &&
+                    fwrite(buffer, 1, size, f) == size;
+   isWritten = (fclose(f) == 0) && isWritten;
+   if (!isWritten || gSystem->Rename(tmpPath.c_str(), path.c_str()) != 0)
+      gSystem->Unlink(tmpPath.c_str());
+}
+
+void ROOT::Internal::RBlockCache::ReadV(const std::string &fileId, std::uint64_t fileSize, RRawFile::RIOVec *ioVec,
+                                        unsigned int nReq, const ReadFunc_t &readFunc)
+{
+   if (fileSize == RRawFile::kUnknownFileSize) {
+      readFunc(ioVec, nReq);
+      return;
+   }
+
+   struct RBlock {
+      std::unique_ptr<unsigned char[]> fBuffer;
+      std::size_t fSize = 0;
+      std::string fKey;
+   };
+   std::map<std::uint64_t, RBlock> blocks;
+   for (unsigned int i = 0; i < nReq; ++i) {
+      if (ioVec[i].fSize == 0 || ioVec[i].fOffset >= fileSize)
+         continue;
+      const std::uint64_t end = std::min<std::uint64_t>(ioVec[i].fOffset + ioVec[i].fSize, fileSize);
+      for (auto idx = ioVec[i].fOffset / fBlockSize; idx <= (end - 1) / fBlockSize; ++idx)
+         blocks.emplace(idx, RBlock());
+   }
+
+   std::vector<RRawFile::RIOVec> missingVec;
+   std::vector<RBlock *> missingBlocks;
+   for (auto &[idx, block] : blocks) {
+      block.fSize = std::min<std::uint64_t>(fBlockSize, fileSize - idx * fBlockSize);
+      block.fBuffer.reset(new unsigned char[block.fSize]);
+      block.fKey = fileId + "\n" + std::to_string(fBlockSize) + "\n" + std::to_string(idx);
+      if (LoadBlock(GetBlockPath(block.fKey), block.fKey, block.fBuffer.get(), block.fSize)) {
+         ++fNHits;
+         continue;
+      }
+      RRawFile::RIOVec iov;
+      iov.fBuffer = block.fBuffer.get();
+      iov.fOffset = idx * fBlockSize;
+      iov.fSize = block.fSize;
+      missingVec.emplace_back(iov);
+      missingBlocks.emplace_back(&block);
+   }
+
+   if (!missingVec.empty()) {
+      fNMisses += missingVec.size();
+      readFunc(missingVec.data(), missingVec.size());
+      std::uint64_t nBytesStored = 0;
+      for (std::size_t i = 0; i < missingVec.size(); ++i) {
+         if (missingVec[i].fOutBytes < missingBlocks[i]->fSize) {
+            missingBlocks[i]->fSize = missingVec[i].fOutBytes;
+            continue;
+         }
+         StoreBlock(GetBlockPath(missingBlocks[i]->fKey), missingBlocks[i]->fKey, missingBlocks[i]->fBuffer.get(),
+                    missingBlocks[i]->fSize);
+         nBytesStored += missingBlocks[i]->fSize;
+      }
+      if (fMaxSize > 0 && (fBytesSinceEviction += nBytesStored) > fMaxSize / 20)
+         Evict();
+   }
+
+   // Copy out the requests, stopping at the first short block
+   for (unsigned int i = 0; i < nReq; ++i) {
+      ioVec[i].fOutBytes = 0;
+      auto offset = ioVec[i].fOffset;
+      while (ioVec[i].fOutBytes < ioVec[i].fSize && offset < fileSize) {
+         const auto &block = blocks[offset / fBlockSize];
+         const std::size_t offsetInBlock = offset % fBlockSize;
+         if (offsetInBlock >= block.fSize)
+            break;
+         const auto nbytes = std::min(ioVec[i].fSize - ioVec[i].fOutBytes, block.fSize - offsetInBlock);
+         memcpy(static_cast<unsigned char *>(ioVec[i].fBuffer) + ioVec[i].fOutBytes,
+                block.fBuffer.get() + offsetInBlock, nbytes);
+         ioVec[i].fOutBytes += nbytes;
+         offset += nbytes;
+         if (offsetInBlock + nbytes < fBlockSize)
+            break;
+      }
+   }
+}
+
+void ROOT::Internal::RBlockCache::Evict()
+{
+   // Concurrent evictions by other processes are harmless: removing the same file twice fails silently
+   std::lock_guard<std::mutex> lock(fEvictionMutex);
+   fBytesSinceEviction = 0;
+
+   void *dir = gSystem->OpenDirectory(fDirectory.c_str());
+   if (!dir)
+      return;
+   std::vector<std::pair<Long_t, std::string>> blockFiles; // (mtime, path)
+   std::uint64_t totalSize = 0;
+   const auto now = time(nullptr);
+   while (const char *entry = gSystem->GetDirEntry(dir)) {
+      const std::string name = entry;
+      const std::string path = fDirectory + "/" + name;
+      FileStat_t stat;
+      if (name[0] == '.' || gSystem->GetPathInfo(path.c_str(), stat) != 0)
+         continue;
+      if (EndsWith(name, kBlockSuffix)) {
+         blockFiles.emplace_back(stat.fMtime, path);
+         totalSize += stat.fSize;
+      } else if (name.find(kTmpInfix) != std::string::npos && now - stat.fMtime > kTmpFileMaxAge) {
+         gSystem->Unlink(path.c_str());
+      }
+   }
+   gSystem->FreeDirectory(dir);
+
+   if (totalSize <= fMaxSize)
+      return;
+   std::sort(blockFiles.begin(), blockFiles.end());
+   const std::uint64_t targetSize = fMaxSize - fMaxSize / 10;
+   for (const auto &blockFile : blockFiles) {
+      if (totalSize <= targetSize)
+         break;
+      FileStat_t stat;
+      if (gSystem->GetPathInfo(blockFile.second.c_str(), stat) == 0 && gSystem->Unlink(blockFile.second.c_str()) == 0)
+         totalSize -= std::min<std::uint64_t>(totalSize, stat.fSize);
+   }
+}
@@ -0,0 +1,287 @@
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include <ROOT/RIOMetrics.hxx>
+
+#include "TEnv.h"
+#include "TSystem.h"
+
+#include <nlohmann/json.hpp>
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <functional>
+#include <vector>
+
+namespace {
+/// -1: not yet initialized from gEnv, 0: disabled, 1: enabled
+std::atomic<int> gIsEnabled{-1};
+
+using Snapshot_t = std::vector<const ROOT::Experimental::RIOFileMetrics *>;
+
+struct RCounterFamily {
+   const char *fName;
+   const char *fHelp;
+   std::function<std::uint64_t(const ROOT::Experimental::RIOFileMetrics &)> fGetter;
+};
+
+struct RHistogramFamily {
+   const char *fName;
+   const char *fJSONName;
+   const char *fHelp;
+   std::function<const ROOT::Experimental::RIOLatencyHistogram &(const ROOT::Experimental::RIOFileMetrics &)> fGetter;
+};
+
+const RCounterFamily kCounterFamilies[] = {
+   {"root_io_read_bytes_total", "Bytes read", [](const auto &m) { return m.GetBytesRead(); }},
+   {"root_io_read_calls_total", "Number of read calls", [](const auto &m) { return m.GetReadCalls(); }},
+   {"root_io_written_bytes_total", "Bytes written", [](const auto &m) { return m.GetBytesWritten(); }},
+   {"root_io_write_calls_total", "Number of write calls", [](const auto &m) { return m.GetWriteCalls(); }},
+   {"root_io_cache_hits_total", "Number of reads served by the cache", [](const auto &m) { return m.GetCacheHits(); }},
+   {"root_io_cache_misses_total", "Number of reads not served by the cache",
+    [](const auto &m) { return m.GetCacheMisses(); }},
+   {"root_io_unzipped_bytes_total", "Bytes after decompression", [](const auto &m) { return m.GetBytesUnzipped(); }},
+};
+
+const RHistogramFamily kHistogramFamilies[] = {
+   {"root_io_read_duration_seconds", "readLatency", "Duration of the read calls",
+    [](const auto &m) -> const auto & { return m.GetReadLatency(); }},
+   {"root_io_write_duration_seconds", "writeLatency", "Duration of the write calls",
+    [](const auto &m) -> const auto & { return m.GetWriteLatency(); }},
+   {"root_io_unzip_duration_seconds", "unzipTime", "Duration of the decompression of buffers",
+    [](const auto &m) -> const auto & { return m.GetUnzipTime(); }},
+};
+
+std::string EscapeLabel(const std::string &value)
+{
+   std::string result;
+   result.reserve(value.size());
+   for (char c : value) {
+      switch (c) {
+      case '\\': result += "\\\\"; break;
+      case '"': result += "\\\""; break;
+      case '\n': result += "\\n"; break;
+      default: result += c;
+      }
+   }
+   return result;
+}
+
+std::string FormatDouble(double value)
+{
+   char buffer[32];
+   snprintf(buffer, sizeof(buffer), "%.9g", value);
+   return buffer;
+}
+} // anonymous namespace
+
+void ROOT::Experimental::RIOLatencyHistogram::Observe(std::chrono::nanoseconds duration)
+{
+   const auto ns = std::max<std::int64_t>(0, duration.count());
+   // Bucket i holds the durations in (2^(i-1), 2^i] microseconds
+   const std::uint64_t us = (ns + 999) / 1000;
+   int bucket = 0;
+   while (bucket < kNBuckets && (std::uint64_t(1) << bucket) < us)
+      ++bucket;
+   fBuckets[bucket].fetch_add(1, std::memory_order_relaxed);
+   fSumNs.fetch_add(ns, std::memory_order_relaxed);
+}
+
+void ROOT::Experimental::RIOLatencyHistogram::Reset()
+{
+   for (auto &b : fBuckets)
+      b.store(0, std::memory_order_relaxed);
+   fSumNs.store(0, std::memory_order_relaxed);
+}
+
+std::uint64_t ROOT::Experimental::RIOLatencyHistogram::GetCount() const
+{
+   std::uint64_t count = 0;
+   for (const auto &b : fBuckets)
+      count += b.load(std::memory_order_relaxed);
+   return count;
+}
+
+void ROOT::Experimental::RIOFileMetrics::Reset()
+{
+   for (auto counter :
+        {&fBytesRead, &fReadCalls, &fBytesWritten, &fWriteCalls, &fCacheHits, &fCacheMisses, &fBytesUnzipped})
+      counter->store(0, std::memory_order_relaxed);
+   fReadLatency.Reset();
+   fWriteLatency.Reset();
+   fUnzipTime.Reset();
+}
+
+ROOT::Experimental::RIOMetrics &ROOT::Experimental::RIOMetrics::Instance()
+{
+   static RIOMetrics instance;
+   return instance;
+}
+
+bool ROOT::Experimental::RIOMetrics::IsEnabled()
+{
+   int isEnabled = gIsEnabled.load(std::memory_order_relaxed);
+   if (isEnabled < 0) {
+      if (!gEnv)
+         return false;
+      isEnabled = gEnv->GetValue("IO.Metrics", 0) ? 1 : 0;
+      int expected = -1;
+      // SetEnabled() called concurrently takes precedence
+      if (!gIsEnabled.compare_exchange_strong(expected, isEnabled))
+         isEnabled = expected;
+   }
+   return isEnabled > 0;
+}
+
+void ROOT::Experimental::RIOMetrics::SetEnabled(bool enabled)
+{
+   gIsEnabled = enabled ? 1 : 0;
+}
+
+ROOT::Experimental::RIOFileMetrics *
+ROOT::Experimental::RIOMetrics::GetFileMetricsIfEnabled(std::string_view component, std::string_view file)
+{
+   if (!IsEnabled())
+      return nullptr;
+   return &Instance().GetFileMetrics(component, file);
+}
+
+ROOT::Experimental::RIOFileMetrics &
+ROOT::Experimental::RIOMetrics::GetFileMetrics(std::string_view component, std::string_view file)
+{
+   std::lock_guard<std::mutex> lock(fMutex);
+   auto &metrics = fFileMetrics[{std::string(component), std::string(file)}];
+   if (!metrics)
+      metrics = std::make_unique<RIOFileMetrics>(component, file);
+   return *metrics;
+}
+
+void ROOT::Experimental::RIOMetrics::Reset()
+{
+   std::lock_guard<std::mutex> lock(fMutex);
+   for (auto &entry : fFileMetrics)
+      entry.second->Reset();
+}
+
+std::string ROOT::Experimental::RIOMetrics::ToPrometheus() const
+{
+   Snapshot_t snapshot;
+   {
+      std::lock_guard<std::mutex> lock(fMutex);
+      for (const auto &entry : fFileMetrics)
+         snapshot.emplace_back(entry.second.get());
+   }
+
+   auto labels = [](const RIOFileMetrics &m) {
+      return "component=\"" + EscapeLabel(m.GetComponent()) + "\",file=\"" + EscapeLabel(m.GetFile()) + "\"";
+   };
+
+   // Series that are zero are left out, e.g. the read counters of TTreeCache
+   std::string result;
+   for (const auto &family : kCounterFamilies) {
+      result += std::string("# HELP ") + family.fName + " " + family.fHelp + "\n";
+      result += std::string("# TYPE ") + family.fName + " counter\n";
+      for (const auto *m : snapshot) {
+         if (const auto value = family.fGetter(*m))
+            result += std::string(family.fName) + "{" + labels(*m) + "} " + std::to_string(value) + "\n";
+      }
+   }
+   for (const auto &family : kHistogramFamilies) {
+      result += std::string("# HELP ") + family.fName + " " + family.fHelp + "\n";
+      result += std::string("# TYPE ") + family.fName + " histogram\n";
+      for (const auto *m : snapshot) {
+         const auto &histogram = family.fGetter(*m);
+         std::uint64_t cumulative = 0;
+         std::string series;
+         for (int i = 0; i <= RIOLatencyHistogram::kNBuckets; ++i) {
+            cumulative += histogram.GetBucketCount(i);
+            const std::string bound =
+               (i < RIOLatencyHistogram::kNBuckets) ? FormatDouble(RIOLatencyHistogram::GetBucketBound(i)) : "+Inf";
+            series += std::string(family.fName) + "_bucket{" + labels(*m) + ",le=\"" + bound + "\"} " +
+                      std::to_string(cumulative) + "\n";
+         }
+         if (cumulative == 0)
+            continue;
+         result += series;
+         result += std::string(family.fName) + "_sum{" + labels(*m) + "} " +
+                   FormatDouble(1e-9 * histogram.GetSumNs()) + "\n";
+         result += std::string(family.fName) + "_count{" + labels(*m) + "} " + std::to_string(cumulative) + "\n";
+      }
+   }
+   return result;
+}
+
+std::string ROOT::Experimental::RIOMetrics::ToJSON() const
+{
+   Snapshot_t snapshot;
+   {
+      std::lock_guard<std::mutex> lock(fMutex);
+      for (const auto &entry : fFileMetrics)
+         snapshot.emplace_back(entry.second.get());
+   }
+
+   auto json = nlohmann::json::array();
+   for (const auto *m : snapshot) {
+      nlohmann::json entry;
+      entry["component"] = m->GetComponent();
+      entry["file"] = m->GetFile();
+      entry["bytesRead"] = m->GetBytesRead();
+      entry["readCalls"] = m->GetReadCalls();
+      entry["bytesWritten"] = m->GetBytesWritten();
+      entry["writeCalls"] = m->GetWriteCalls();
+      entry["cacheHits"] = m->GetCacheHits();
+      entry["cacheMisses"] = m->GetCacheMisses();
+      entry["bytesUnzipped"] = m->GetBytesUnzipped();
+      for (const auto &family : kHistogramFamilies) {
+         const auto &histogram = family.fGetter(*m);
+         // Non-empty buckets only, not cumulative; "le" is the upper bound of the bucket in seconds
+         auto buckets = nlohmann::json::array();
+         for (int i = 0; i <= RIOLatencyHistogram::kNBuckets; ++i) {
+            const auto count = histogram.GetBucketCount(i);
+            if (count == 0)
+               continue;
+            nlohmann::json bucket;
+            if (i < RIOLatencyHistogram::kNBuckets)
+               bucket["le"] = RIOLatencyHistogram::GetBucketBound(i);
+            else
+               bucket["le"] = "+Inf";
+            bucket["count"] = count;
+            buckets.push_back(bucket);
+         }
+         entry[family.fJSONName] = {{"count", histogram.GetCount()},
+                                    {"sumSeconds", 1e-9 * histogram.GetSumNs()},
+                                    {"buckets", buckets}};
+      }
+      json.push_back(entry);
+   }
+   return json.dump(1);
+}
+
+bool ROOT::Experimental::RIOMetrics::WriteToFile(std::string_view path) const
+{
+   const std::string target(path);
+   const bool isJSON = target.size() >= 5 && target.compare(target.size() - 5, 5, ".json") == 0;
+   const std::string content = isJSON ? ToJSON() : ToPrometheus();
+
+   // Write a temporary file first, so that readers never see a partially written file
+   const std::string tmpPath = target + "." + std::to_string(gSystem->GetPid()) + ".tmp";
+   {
+      std::ofstream out(tmpPath, std::ios::binary);
+      out << content;
+      if (!out) {
+         gSystem->Unlink(tmpPath.c_str());
+         return false;
+      }
+   }
+   if (gSystem->Rename(tmpPath.c_str(), target.c_str()) != 0) {
+      gSystem->Unlink(tmpPath.c_str());
+      return false;
+   }
+   return true;
+}
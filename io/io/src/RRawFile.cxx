@@ -10,6 +10,8 @@
  *************************************************************************/
 
 #include <ROOT/RConfig.h>
+#include <ROOT/RBlockCache.hxx>
+#include <ROOT/RIOMetrics.hxx>
 #include <ROOT/RRawFile.hxx>
 #ifdef _WIN32
 #include <ROOT/RRawFileWin.hxx>
@@ -27,6 +29,8 @@
 #include <cstddef>
 #include <cstdint>
 #include <cstring>
+#include <exception>
+#include <future>
 #include <stdexcept>
 #include <string>
 
@@ -41,6 +45,20 @@ const char *kLineBreakTokens[] = {"", "\n", "\n", "\r\n"};
 constexpr unsigned int kLineBreakTokenSizes[] = {0, 1, 1, 2};
 #endif
 constexpr unsigned int kLineBuffer = 128; // On Readln, look for line-breaks in chunks of 128 bytes
+
+/// Runs a synchronous read and returns its outcome as a ready future
+template <typename FuncT>
+std::future<void> ReadToReadyFuture(FuncT &&readFunc)
+{
+   std::promise<void> promise;
+   try {
+      readFunc();
+      promise.set_value();
+   } catch (...) {
+      promise.set_exception(std::current_exception());
+   }
+   return promise.get_future();
+}
 } // anonymous namespace
 
 size_t ROOT::Internal::RRawFile::RBlockBuffer::CopyTo(void *buffer, size_t nbytes, std::uint64_t offset)
@@ -62,6 +80,9 @@ ROOT::Internal::RRawFile::RRawFile(std::string_view url, ROptions options)
    : fBlockBufferIdx(0), fBufferSpace(nullptr), fFileSize(kUnknownFileSize), fIsOpen(false), fUrl(url),
      fOptions(options), fFilePos(0)
 {
+   if (GetTransport(url) != "file")
+      fBlockCache = RBlockCache::GetGlobal();
+   fIOMetrics = ROOT::Experimental::RIOMetrics::GetFileMetricsIfEnabled("RRawFile", fUrl);
 }
 
 ROOT::Internal::RRawFile::~RRawFile()
@@ -109,6 +130,11 @@ void ROOT::Internal::RRawFile::ReadVImpl(RIOVec *ioVec, unsigned int nReq)
    }
 }
 
+std::future<void> ROOT::Internal::RRawFile::ReadVAsyncImpl(RIOVec *ioVec, unsigned int nReq)
+{
+   return ReadToReadyFuture([&] { ReadVImpl(ioVec, nReq); });
+}
+
 void ROOT::Internal::RRawFile::UnmapImpl(void * /* region */, size_t /* nbytes */)
 {
    throw std::runtime_error("Memory mapping unsupported");
@@ -155,6 +181,16 @@ void *ROOT::Internal::RRawFile::Map(size_t nbytes, std::uint64_t offset, std::ui
    return MapImpl(nbytes, offset, mapdOffset);
 }
 
+size_t ROOT::Internal::RRawFile::ReadAtRecorded(void *buffer, size_t nbytes, std::uint64_t offset)
+{
+   if (!fIOMetrics)
+      return ReadAtImpl(buffer, nbytes, offset);
+   const auto start = ROOT::Experimental::RIOFileMetrics::Now();
+   const auto res = ReadAtImpl(buffer, nbytes, offset);
+   fIOMetrics->AddRead(res, start);
+   return res;
+}
+
 size_t ROOT::Internal::RRawFile::Read(void *buffer, size_t nbytes)
 {
    size_t res = ReadAt(buffer, nbytes, fFilePos);
@@ -171,7 +207,7 @@ size_t ROOT::Internal::RRawFile::ReadAt(void *buffer, size_t nbytes, std::uint64
 
    // "Large" reads are served directly, bypassing the cache
    if (nbytes > static_cast<unsigned int>(fOptions.fBlockSize))
-      return ReadAtImpl(buffer, nbytes, offset);
+      return ReadAtRecorded(buffer, nbytes, offset);
 
    if (fBufferSpace == nullptr) {
       fBufferSpace = new unsigned char[kNumBlockBuffers * fOptions.fBlockSize];
@@ -199,7 +235,7 @@ size_t ROOT::Internal::RRawFile::ReadAt(void *buffer, size_t nbytes, std::uint64
 
    /// The remaining bytes populate the newly promoted main buffer
    RBlockBuffer *thisBuffer = &fBlockBuffers[fBlockBufferIdx % kNumBlockBuffers];
-   size_t res = ReadAtImpl(thisBuffer->fBuffer, fOptions.fBlockSize, offset);
+   size_t res = ReadAtRecorded(thisBuffer->fBuffer, fOptions.fBlockSize, offset);
    thisBuffer->fBufferOffset = offset;
    thisBuffer->fBufferSize = res;
    size_t remainingBytes = std::min(res, nbytes);
@@ -213,7 +249,33 @@ void ROOT::Internal::RRawFile::ReadV(RIOVec *ioVec, unsigned int nReq)
    if (!fIsOpen)
       OpenImpl();
    fIsOpen = true;
-   ReadVImpl(ioVec, nReq);
+   ROOT::Experimental::RIOFileMetrics::Clock_t::time_point start;
+   if (fIOMetrics)
+      start = ROOT::Experimental::RIOFileMetrics::Now();
+   if (fBlockCache) {
+      // The content of a remote file is identified by its size, RRawFile knows nothing about modification times
+      const auto fileSize = GetSize();
+      fBlockCache->ReadV(fUrl + "#" + std::to_string(fileSize), fileSize, ioVec, nReq,
+                         [this](RIOVec *v, unsigned int n) { ReadVImpl(v, n); });
+   } else {
+      ReadVImpl(ioVec, nReq);
+   }
+   if (fIOMetrics) {
+      std::uint64_t nbytes = 0;
+      for (unsigned int i = 0; i < nReq; ++i)
+         nbytes += ioVec[i].fOutBytes;
+      fIOMetrics->AddRead(nbytes, start);
+   }
+}
+
+std::future<void> ROOT::Internal::RRawFile::ReadVAsync(RIOVec *ioVec, unsigned int nReq)
+{
+   if (fBlockCache)
+      return ReadToReadyFuture([&] { ReadV(ioVec, nReq); });
+   if (!fIsOpen)
+      OpenImpl();
+   fIsOpen = true;
+   return ReadVAsyncImpl(ioVec, nReq);
 }
 
 bool ROOT::Internal::RRawFile::Readln(std::string &line)
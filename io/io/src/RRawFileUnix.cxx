@@ -18,11 +18,19 @@
 
 #include "TError.h"
 
+#include <algorithm>
+#include <atomic>
 #include <cerrno>
+#include <condition_variable>
+#include <cstdint>
 #include <cstring>
+#include <future>
 #include <memory>
+#include <mutex>
 #include <stdexcept>
 #include <string>
+#include <thread>
+#include <unordered_set>
 #include <utility>
 #include <vector>
 
@@ -33,6 +41,227 @@
 
 namespace {
 constexpr int kDefaultBlockSize = 4096; // If fstat() does not provide a block size hint, use this value instead
+
+#ifdef R__HAS_URING
+/// The io_uring instance shared by the asynchronous vector reads of all files. The calling thread submits the reads,
+/// a single thread reaps the completions and fulfills the future of a vector read once all its reads are done.
+class RAsyncIoUring {
+   using RIOVec = ROOT::Internal::RRawFile::RIOVec;
+
+   struct RPendingReadV;
+   /// Identifies a single read in the io_uring user data
+   struct RReadSlot {
+      RPendingReadV *fReadV;
+      unsigned int fIndex;
+   };
+   struct RPendingReadV {
+      RIOVec *fIoVec = nullptr;
+      std::string fUrl;
+      /// The result of every read: the number of bytes read or a negative errno
+      std::vector<int> fResults;
+      std::vector<RReadSlot> fSlots;
+      /// The reads in flight plus one held by the submitting thread
+      std::atomic<unsigned int> fNRemaining{0};
+      std::promise<void> fPromise;
+   };
+
+   ROOT::Internal::RIoUring fRing;
+   /// Protects the submission queue, fInFlight and fError
+   std::mutex fMutex;
+   std::condition_variable fCvSlotFree;
+   /// Reads submitted and not yet reaped, at most the queue depth so that the completion queue cannot overflow
+   std::unordered_set<RReadSlot *> fInFlight;
+   /// The negative errno once waiting for completions failed; no more reads are submitted afterwards
+   std::atomic<int> fError{0};
+   std::thread fReaper;
+
+   /// Called for every finished read and by the submitter; the last call sets the outcome of the vector read
+   static void Release(RPendingReadV *readV)
+   {
+      if (readV->fNRemaining.fetch_sub(1, std::memory_order_acq_rel) != 1)
+         return;
+      std::string error;
+      for (std::size_t i = 0; i < readV->fResults.size(); ++i) {
+         if (readV->fResults[i] < 0 && error.empty())
+            error = "Cannot read from '" + readV->fUrl + "', error: " + std::string(strerror(-readV->fResults[i]));
+         readV->fIoVec[i].fOutBytes = readV->fResults[i] < 0 ? 0 : readV->fResults[i];
+      }
+      if (error.empty())
+         readV->fPromise.set_value();
+      else
+         readV->fPromise.set_exception(std::make_exception_ptr(std::runtime_error(error)));
+      delete readV;
+   }
+
+   /// Records the error of a read that is not in flight and releases it
+   static void Fail(RReadSlot *slot, int error)
+   {
+      slot->fReadV->fResults[slot->fIndex] = error;
+      Release(slot->fReadV);
+   }
+
+   /// Submits the last nPrepared entries of the submission queue. Returns 0 on success or the negative errno.
+   /// On failure, nPrepared is set to the number of trailing entries that the kernel did not take. These entries
+   /// are removed from the submission queue again, so that they never read into buffers that the caller
+   /// releases once told that the reads failed.
+   int Submit(unsigned int &nPrepared)
+   {
+      auto ring = fRing.GetRawRing();
+      while (nPrepared > 0) {
+         const int ret = io_uring_submit(ring);
+         if (ret == -EINTR || ret == -EAGAIN || ret == -EBUSY) {
+            std::this_thread::yield();
+            continue;
+         }
+         if (ret < 0) {
+            // Without a kernel polling thread, the queue is only consumed on submission, so the tail can move back
+            const unsigned int tail = *ring->sq.ktail - nPrepared;
+            ring->sq.sqe_head = ring->sq.sqe_tail = tail;
+            io_uring_smp_store_release(ring->sq.ktail, tail);
+            return ret;
+         }
+         // A short submission leaves the remaining entries in the queue for the next call
+         nPrepared -= std::min(nPrepared, static_cast<unsigned int>(ret));
+      }
+      return 0;
+   }
+
+   /// Submits the prepared reads [end - nPrepared, end) of readV and fails the ones that could not be submitted
+   int SubmitReads(RPendingReadV *readV, unsigned int end, unsigned int nPrepared)
+   {
+      const int error = Submit(nPrepared);
+      for (unsigned int i = end - nPrepared; i < end; ++i) {
+         fInFlight.erase(&readV->fSlots[i]);
+         Fail(&readV->fSlots[i], error);
+      }
+      if (nPrepared > 0)
+         fCvSlotFree.notify_all();
+      return error;
+   }
+
+   void Reap()
+   {
+      while (true) {
+         struct io_uring_cqe *cqe;
+         int ret = io_uring_wait_cqe(fRing.GetRawRing(), &cqe);
+         if (ret == -EINTR)
+            continue;
+         if (ret < 0) {
+            // No completion can be reaped anymore: fail the reads in flight and every read submitted later
+            std::unordered_set<RReadSlot *> inFlight;
+            {
+               std::lock_guard<std::mutex> lock(fMutex);
+               fError = ret;
+               std::swap(inFlight, fInFlight);
+            }
+            fCvSlotFree.notify_all();
+            Error("RRawFileUnix", "io_uring completion failed, error: %s", strerror(-ret));
+            for (auto slot : inFlight)
+               Fail(slot, ret);
+            return;
+         }
+         auto slot = static_cast<RReadSlot *>(io_uring_cqe_get_data(cqe));
+         const int res = cqe->res;
+         io_uring_cqe_seen(fRing.GetRawRing(), cqe);
+         if (!slot)
+            return; // stop request from the destructor
+         slot->fReadV->fResults[slot->fIndex] = res;
+         {
+            std::lock_guard<std::mutex> lock(fMutex);
+            fInFlight.erase(slot);
+         }
+         fCvSlotFree.notify_all();
+         Release(slot->fReadV);
+      }
+   }
+
+public:
+   RAsyncIoUring() : fRing(1024) { fReaper = std::thread([this] { Reap(); }); }
+   ~RAsyncIoUring()
+   {
+      std::unique_lock<std::mutex> lock(fMutex);
+      if (fError == 0) {
+         struct io_uring_sqe *sqe = io_uring_get_sqe(fRing.GetRawRing());
+         io_uring_prep_nop(sqe);
+         io_uring_sqe_set_data(sqe, nullptr);
+         unsigned int nPrepared = 1;
+         if (const int ret = Submit(nPrepared)) {
+            // The reaper cannot be woken up anymore; it ends with the process
+            Error("RRawFileUnix", "cannot stop the io_uring completion thread, error: %s", strerror(-ret));
+            fReaper.detach();
+            return;
+         }
+      }
+      lock.unlock();
+      fReaper.join();
+   }
+
+   /// Returns nullptr if io_uring is not available
+   static RAsyncIoUring *Get()
+   {
+      static std::unique_ptr<RAsyncIoUring> gRing = []() -> std::unique_ptr<RAsyncIoUring> {
+         try {
+            return std::make_unique<RAsyncIoUring>();
+         } catch (const std::runtime_error &e) {
+            Warning("RRawFileUnix", "io_uring setup failed, asynchronous vector reads are synchronous:\n%s",
+                    e.what());
+            return nullptr;
+         }
+      }();
+      return gRing.get();
+   }
+
+   /// False once waiting for completions failed
+   bool IsUsable() const { return fError == 0; }
+
+   std::future<void> ReadV(int fd, const std::string &url, RIOVec *ioVec, unsigned int nReq)
+   {
+      auto readV = new RPendingReadV;
+      readV->fIoVec = ioVec;
+      readV->fUrl = url;
+      readV->fResults.resize(nReq, 0);
+      readV->fSlots.resize(nReq);
+      readV->fNRemaining = nReq + 1;
+      auto future = readV->fPromise.get_future();
+
+      std::unique_lock<std::mutex> lock(fMutex);
+      int error = fError;
+      unsigned int nPrepared = 0;
+      unsigned int i = 0;
+      while (i < nReq && error == 0) {
+         if (fInFlight.size() >= fRing.GetQueueDepth()) {
+            if (nPrepared > 0) {
+               error = SubmitReads(readV, i, nPrepared);
+               nPrepared = 0;
+            } else {
+               fCvSlotFree.wait(lock);
+               error = fError;
+            }
+            continue;
+         }
+         struct io_uring_sqe *sqe = io_uring_get_sqe(fRing.GetRawRing());
+         readV->fSlots[i] = RReadSlot{readV, i};
+         io_uring_prep_read(sqe, fd, ioVec[i].fBuffer, ioVec[i].fSize, ioVec[i].fOffset);
+         io_uring_sqe_set_data(sqe, &readV->fSlots[i]);
+         fInFlight.insert(&readV->fSlots[i]);
+         ++nPrepared;
+         ++i;
+      }
+      if (nPrepared > 0)
+         error = SubmitReads(readV, i, nPrepared);
+      lock.unlock();
+
+      // Reads that were never prepared share the error that stopped the submission
+      for (; i < nReq; ++i) {
+         readV->fSlots[i] = RReadSlot{readV, i};
+         Fail(&readV->fSlots[i], error);
+      }
+      Release(readV);
+      return future;
+   }
+};
+#endif
+
 } // anonymous namespace
 
 ROOT::Internal::RRawFileUnix::RRawFileUnix(std::string_view url, ROptions options)
@@ -52,6 +281,10 @@ std::unique_ptr<ROOT::Internal::RRawFile> ROOT::Internal::RRawFileUnix::Clone()
 }
 
 int ROOT::Internal::RRawFileUnix::GetFeatures() const {
+#ifdef R__HAS_URING
+   if (RAsyncIoUring::Get())
+      return kFeatureHasSize | kFeatureHasMmap | kFeatureHasAsyncIo;
+#endif
    return kFeatureHasSize | kFeatureHasMmap;
 }
 
@@ -118,7 +351,9 @@ void ROOT::Internal::RRawFileUnix::ReadVImpl(RIOVec *ioVec, unsigned int nReq)
    thread_local bool uring_failed = false;
    if (!uring_failed) {
       try {
-         RIoUring ring; // throws std::runtime_error
+         std::lock_guard<std::mutex> guard(fIoUringLock);
+         if (!fIoUring)
+            fIoUring = std::make_unique<RIoUring>(); // throws std::runtime_error
          std::vector<RIoUring::RReadEvent> reads;
          reads.reserve(nReq);
          for (std::size_t i = 0; i < nReq; ++i) {
@@ -129,7 +364,7 @@ void ROOT::Internal::RRawFileUnix::ReadVImpl(RIOVec *ioVec, unsigned int nReq)
             ev.fFileDes = fFileDes;
             reads.push_back(ev);
          }
-         ring.SubmitReadsAndWait(reads.data(), nReq);
+         fIoUring->SubmitReadsAndWait(reads.data(), nReq);
          for (std::size_t i = 0; i < nReq; ++i) {
             ioVec[i].fOutBytes = reads.at(i).fOutBytes;
          }
@@ -140,12 +375,25 @@ void ROOT::Internal::RRawFileUnix::ReadVImpl(RIOVec *ioVec, unsigned int nReq)
          Warning("RRawFileUnix",
               "io_uring setup failed, falling back to blocking I/O in ReadV");
          uring_failed = true;
+         // The ring may be in an inconsistent state if the failure happened during the reads
+         std::lock_guard<std::mutex> guard(fIoUringLock);
+         fIoUring.reset();
       }
    }
 #endif
    RRawFile::ReadVImpl(ioVec, nReq);
 }
 
+std::future<void> ROOT::Internal::RRawFileUnix::ReadVAsyncImpl(RIOVec *ioVec, unsigned int nReq)
+{
+#ifdef R__HAS_URING
+   auto ring = RAsyncIoUring::Get();
+   if (ring && ring->IsUsable())
+      return ring->ReadV(fFileDes, fUrl, ioVec, nReq);
+#endif
+   return RRawFile::ReadVAsyncImpl(ioVec, nReq);
+}
+
 size_t ROOT::Internal::RRawFileUnix::ReadAtImpl(void *buffer, size_t nbytes, std::uint64_t offset)
 {
    size_t total_bytes = 0;
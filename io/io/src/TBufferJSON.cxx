@@ -92,6 +92,7 @@ class Container {
 
 #include "TBufferJSON.h"
 
+#include <charconv>
 #include <typeinfo>
 #include <string>
 #include <cstring>
@@ -133,6 +134,15 @@ ClassImp(TBufferJSON);
 
 enum { json_TArray = 100, json_TCollection = -130, json_TString = 110, json_stdstring = 120 };
 
+/// Append the decimal representation of an integer, std::to_chars is much faster than snprintf
+template <typename T>
+static void JsonAppendInteger(TString &out, T value)
+{
+   char buf[32];
+   auto res = std::to_chars(buf, buf + sizeof(buf), value);
+   out.Append(buf, res.ptr - buf);
+}
+
 ///////////////////////////////////////////////////////////////
 // TArrayIndexProducer is used to correctly create
 /// JSON array separators for multi-dimensional JSON arrays
@@ -371,7 +381,7 @@ public:
 
    void PushValue(TString &v)
    {
-      fValues.emplace_back(v.Data());
+      fValues.emplace_back(v.Data(), v.Length());
       v.Clear();
    }
 
@@ -684,6 +694,37 @@ TString TBufferJSON::ConvertToJSON(const void *obj, const TClass *cl, Int_t comp
    return buf.StoreObject(actualStart, clActual);
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Direct the JSON code produced by StoreObject() to the sink instead of the
+/// returned string. The sink is called each time at least chunkSize bytes of
+/// JSON code are ready and once at the end, so that the complete JSON code of
+/// large objects, e.g. histograms with many bins, is never kept in memory.
+/// For instance, to write directly into a file:
+///
+///   std::ofstream ofs("hist.json");
+///   TBufferJSON buf;
+///   buf.SetOutputSink([&ofs](const char *data, std::size_t len) { ofs.write(data, len); });
+///   buf.StoreObject(hist, hist->IsA());
+///
+
+void TBufferJSON::SetOutputSink(OutputSink_t sink, Int_t chunkSize)
+{
+   fOutputSink = std::move(sink);
+   fSinkChunkSize = chunkSize;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Pass the content of the main output buffer to the output sink
+
+void TBufferJSON::FlushOutputSink()
+{
+   if (fOutBuffer.Length() == 0)
+      return;
+   fOutputSink(fOutBuffer.Data(), fOutBuffer.Length());
+   fSinkBytes += fOutBuffer.Length();
+   fOutBuffer.Clear();
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Store provided object as JSON structure
 /// Allows to configure different TBufferJSON properties before converting object into JSON
@@ -696,6 +737,8 @@ TString TBufferJSON::ConvertToJSON(const void *obj, const TClass *cl, Int_t comp
 ///   buf.SetCompact(TBufferJSON::kNoSpaces); // change any other settings in TBufferJSON
 ///   auto json = buf.StoreObject(obj, TClass::GetClass<UserClass>());
 ///
+/// If an output sink is set, the JSON code is passed to the sink and an empty
+/// string is returned.
 
 TString TBufferJSON::StoreObject(const void *obj, const TClass *cl)
 {
@@ -712,6 +755,14 @@ TString TBufferJSON::StoreObject(const void *obj, const TClass *cl)
       Error("StoreObject", "Can not store object into TBuffer for reading");
    }
 
+   if (fOutputSink) {
+      if (fOutBuffer.Length() || fSinkBytes)
+         FlushOutputSink();
+      else if (fValue.Length())
+         fOutputSink(fValue.Data(), fValue.Length());
+      return TString();
+   }
+
    return fOutBuffer.Length() ? fOutBuffer : fValue;
 }
 
@@ -1170,6 +1221,9 @@ void TBufferJSON::AppendOutput(const char *line0, const char *line1)
          fOutput->Append(line1);
       }
    }
+
+   if (fOutputSink && (fOutput == &fOutBuffer) && (fOutBuffer.Length() >= fSinkChunkSize))
+      FlushOutputSink();
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -3039,7 +3093,7 @@ R__ALWAYS_INLINE void TBufferJSON::JsonWriteArrayCompress(const T *vname, Int_t
       fValue.Append("[");
       for (Int_t indx = 0; indx < arrsize; indx++) {
          if (indx > 0)
-            fValue.Append(fArraySepar.Data());
+            fValue.Append(fArraySepar);
          JsonWriteBasic(vname[indx]);
       }
       fValue.Append("]");
@@ -3120,7 +3174,7 @@ R__ALWAYS_INLINE void TBufferJSON::JsonWriteArrayCompress(const T *vname, Int_t
                fValue.Append("[");
                for (Int_t indx = p0; indx < pp; indx++) {
                   if (indx > p0)
-                     fValue.Append(fArraySepar.Data());
+                     fValue.Append(fArraySepar);
                   JsonWriteBasic(vname[indx]);
                }
                fValue.Append("]");
@@ -3880,9 +3934,7 @@ void TBufferJSON::WriteCharStar(char *s)
 
 void TBufferJSON::JsonWriteBasic(Char_t value)
 {
-   char buf[50];
-   snprintf(buf, sizeof(buf), "%d", value);
-   fValue.Append(buf);
+   JsonAppendInteger(fValue, (Int_t) value);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -3890,9 +3942,7 @@ void TBufferJSON::JsonWriteBasic(Char_t value)
 
 void TBufferJSON::JsonWriteBasic(Short_t value)
 {
-   char buf[50];
-   snprintf(buf, sizeof(buf), "%hd", value);
-   fValue.Append(buf);
+   JsonAppendInteger(fValue, value);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -3900,9 +3950,7 @@ void TBufferJSON::JsonWriteBasic(Short_t value)
 
 void TBufferJSON::JsonWriteBasic(Int_t value)
 {
-   char buf[50];
-   snprintf(buf, sizeof(buf), "%d", value);
-   fValue.Append(buf);
+   JsonAppendInteger(fValue, value);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -3910,9 +3958,7 @@ void TBufferJSON::JsonWriteBasic(Int_t value)
 
 void TBufferJSON::JsonWriteBasic(Long_t value)
 {
-   char buf[50];
-   snprintf(buf, sizeof(buf), "%ld", value);
-   fValue.Append(buf);
+   JsonAppendInteger(fValue, value);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -3920,7 +3966,7 @@ void TBufferJSON::JsonWriteBasic(Long_t value)
 
 void TBufferJSON::JsonWriteBasic(Long64_t value)
 {
-   fValue.Append(std::to_string(value).c_str());
+   JsonAppendInteger(fValue, value);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -3968,9 +4014,7 @@ void TBufferJSON::JsonWriteBasic(Bool_t value)
 
 void TBufferJSON::JsonWriteBasic(UChar_t value)
 {
-   char buf[50];
-   snprintf(buf, sizeof(buf), "%u", value);
-   fValue.Append(buf);
+   JsonAppendInteger(fValue, value);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -3978,9 +4022,7 @@ void TBufferJSON::JsonWriteBasic(UChar_t value)
 
 void TBufferJSON::JsonWriteBasic(UShort_t value)
 {
-   char buf[50];
-   snprintf(buf, sizeof(buf), "%hu", value);
-   fValue.Append(buf);
+   JsonAppendInteger(fValue, value);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -3988,9 +4030,7 @@ void TBufferJSON::JsonWriteBasic(UShort_t value)
 
 void TBufferJSON::JsonWriteBasic(UInt_t value)
 {
-   char buf[50];
-   snprintf(buf, sizeof(buf), "%u", value);
-   fValue.Append(buf);
+   JsonAppendInteger(fValue, value);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -3998,9 +4038,7 @@ void TBufferJSON::JsonWriteBasic(UInt_t value)
 
 void TBufferJSON::JsonWriteBasic(ULong_t value)
 {
-   char buf[50];
-   snprintf(buf, sizeof(buf), "%lu", value);
-   fValue.Append(buf);
+   JsonAppendInteger(fValue, value);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -4008,7 +4046,7 @@ void TBufferJSON::JsonWriteBasic(ULong_t value)
 
 void TBufferJSON::JsonWriteBasic(ULong64_t value)
 {
-   fValue.Append(std::to_string(value).c_str());
+   JsonAppendInteger(fValue, value);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -16,6 +16,7 @@
 #include "TROOT.h"
 #include "TVirtualMutex.h"
 
+#include <chrono>
 #include <utility>
 
 namespace ROOT {
@@ -46,7 +47,8 @@ TBufferMerger::~TBufferMerger()
    for (const auto &f : fAttachedFiles)
       if (!f.expired()) Fatal("TBufferMerger", " TBufferMergerFiles must be destroyed before the server");
 
-   if (!fQueue.empty())
+   SetMergeInBackground(kFALSE);
+   if (fQueueSize > 0)
       Merge();
 
    // Since we support purely incremental merging, Merge does not write the target objects
@@ -67,20 +69,73 @@ std::shared_ptr<TBufferMergerFile> TBufferMerger::GetFile()
 
 size_t TBufferMerger::GetQueueSize() const
 {
-   std::lock_guard<std::mutex> lock(fQueueMutex);
-   return fQueue.size();
+   return fQueueSize;
 }
 
 void TBufferMerger::Push(TBufferFile *buffer)
 {
+   fBuffered += buffer->BufferSize();
+   auto node = new QueueNode{buffer, fQueue.load(std::memory_order_relaxed)};
+   while (!fQueue.compare_exchange_weak(node->fNext, node, std::memory_order_release, std::memory_order_relaxed))
+      ;
+   ++fQueueSize;
+
+   const bool overLimit = fMaxBuffered > 0 && fBuffered > fMaxBuffered;
+   if (GetMergeInBackground()) {
+      if (overLimit || fBuffered > fAutoSave)
+         NotifyWaiting();
+   } else if (fBuffered > fAutoSave) {
+      Merge();
+   }
+
+   if (fMaxBuffered > 0 && fBuffered > fMaxBuffered)
+      WaitForMerge();
+}
+
+/// Wake up the merge thread and the writers waiting for the merge.
+void TBufferMerger::NotifyWaiting()
+{
+   // Taking the lock makes sure that a thread that just found nothing to do is already waiting.
    {
-      std::lock_guard<std::mutex> lock(fQueueMutex);
-      fBuffered += buffer->BufferSize();
-      fQueue.push(buffer);
+      std::lock_guard<std::mutex> lock(fWaitMutex);
    }
+   fWaitCondition.notify_all();
+}
 
-   if (fBuffered > fAutoSave)
-      Merge();
+/// Block until the buffered size is below fMaxBuffered. Without merge thread, the
+/// calling thread merges the queue whenever no other thread is doing so.
+void TBufferMerger::WaitForMerge()
+{
+   while (fBuffered > fMaxBuffered) {
+      if (!GetMergeInBackground() && fMergeMutex.try_lock()) {
+         MergeImpl();
+         fMergeMutex.unlock();
+         continue;
+      }
+      // Wake up regularly: the merge that would have notified us may have
+      // finished in the meantime, leaving the next one to this thread.
+      std::unique_lock<std::mutex> lock(fWaitMutex);
+      fWaitCondition.wait_for(lock, std::chrono::milliseconds(10), [this] { return fBuffered <= fMaxBuffered; });
+   }
+}
+
+void TBufferMerger::MergeThreadLoop()
+{
+   std::unique_lock<std::mutex> lock(fWaitMutex);
+   while (true) {
+      fWaitCondition.wait(lock, [this] {
+         return fStopMergeThread ||
+                (fQueueSize > 0 && (fBuffered > fAutoSave || (fMaxBuffered > 0 && fBuffered > fMaxBuffered)));
+      });
+      if (fStopMergeThread)
+         return;
+      lock.unlock();
+      {
+         std::lock_guard<std::mutex> merge(fMergeMutex);
+         MergeImpl();
+      }
+      lock.lock();
+   }
 }
 
 size_t TBufferMerger::GetAutoSave() const
@@ -99,6 +154,32 @@ void TBufferMerger::SetAutoSave(size_t size)
    fAutoSave = size;
 }
 
+void TBufferMerger::SetMaxBuffered(size_t size)
+{
+   fMaxBuffered = size;
+}
+
+void TBufferMerger::SetMergeInBackground(Bool_t enable)
+{
+   if (enable == GetMergeInBackground())
+      return;
+
+   if (enable) {
+      {
+         std::lock_guard<std::mutex> lock(fWaitMutex);
+         fStopMergeThread = false;
+      }
+      fMergeThread = std::thread(&TBufferMerger::MergeThreadLoop, this);
+   } else {
+      {
+         std::lock_guard<std::mutex> lock(fWaitMutex);
+         fStopMergeThread = true;
+      }
+      fWaitCondition.notify_all();
+      fMergeThread.join();
+   }
+}
+
 void TBufferMerger::SetMergeOptions(const TString& options)
 {
    fMerger.SetMergeOptions(options);
@@ -114,22 +195,34 @@ void TBufferMerger::Merge()
 
 void TBufferMerger::MergeImpl()
 {
-   std::queue<TBufferFile *> queue;
-   {
-      std::lock_guard<std::mutex> q(fQueueMutex);
-      std::swap(queue, fQueue);
-      fBuffered = 0;
+   // Take the whole queue at once and reverse it, to merge the buffers in the order they were pushed.
+   QueueNode *pushed = fQueue.exchange(nullptr, std::memory_order_acquire);
+   QueueNode *queue = nullptr;
+   while (pushed) {
+      auto next = pushed->fNext;
+      pushed->fNext = queue;
+      queue = pushed;
+      pushed = next;
    }
 
-   while (!queue.empty()) {
-      std::unique_ptr<TBufferFile> buffer{queue.front()};
+   size_t merged = 0;
+   while (queue) {
+      std::unique_ptr<QueueNode> node{queue};
+      queue = node->fNext;
+      std::unique_ptr<TBufferFile> buffer{node->fBuffer};
+      merged += buffer->BufferSize();
+      --fQueueSize;
       fMerger.AddAdoptFile(new TMemFile(fMerger.GetOutputFileName(), std::move(buffer)));
-      queue.pop();
    }
 
    fMerger.PartialMerge(TFileMerger::kAll | TFileMerger::kIncremental | TFileMerger::kDelayWrite |
                         TFileMerger::kKeepCompression);
    fMerger.Reset();
+
+   // The buffers are only released by the merge, so they count until then.
+   fBuffered -= merged;
+   if (merged > 0 && fMaxBuffered > 0)
+      NotifyWaiting();
 }
 
 bool TBufferMerger::TryMerge(ROOT::TBufferMergerFile *memfile)
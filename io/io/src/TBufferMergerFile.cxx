@@ -35,8 +35,8 @@ Int_t TBufferMergerFile::Write(const char *name, Int_t opt, Int_t bufsize)
 
    // Instead of Writing the TTree, doing a memcpy, Pushing to the queue
    // then Reading and then deleting, let's see if we can just merge using
-   // the live TTree.
-   if (fMerger.TryMerge(this)) {
+   // the live TTree. The merge thread, if any, only takes buffers from the queue.
+   if (!fMerger.GetMergeInBackground() && fMerger.TryMerge(this)) {
       ResetAfterMerge(0);
       return 0;
    }
@@ -37,6 +37,7 @@ End_Macro
 #include "TBrowser.h"
 #include "TFree.h"
 #include "TKey.h"
+#include "TKeyCompressor.h"
 #include "TStreamerInfo.h"
 #include "TROOT.h"
 #include "TError.h"
@@ -49,11 +50,177 @@ End_Macro
 #include "TVirtualMutex.h"
 #include "TEmulatedCollectionProxy.h"
 
+#include <cstring>
+#include <memory>
+#include <vector>
+
 const UInt_t kIsBigFile = BIT(16);
 const Int_t  kMaxLen = 2048;
 
 ClassImp(TDirectoryFile);
 
+namespace ROOT {
+namespace Internal {
+
+////////////////////////////////////////////////////////////////////////////////
+/// Compact index of the keys record of a directory of a file opened for reading.
+///
+/// Instead of creating one TKey per entry of the keys record when the
+/// directory is read, TDirectoryFile::ReadKeys keeps a copy of the record, a
+/// flat array of entries pointing into it and an open addressing hash table
+/// of the key names. The TKey objects are only created when a key is looked
+/// up by name, or when the full list of keys is requested.
+
+class RKeyIndex {
+   struct REntry {
+      Int_t fKeyOffset;    ///< Position of the key in fBuffer
+      Int_t fNameOffset;   ///< Position of the characters of the key name in fBuffer
+      Int_t fNameLength;
+      Int_t fClassOffset;  ///< Position of the characters of the class name in fBuffer
+      Int_t fClassLength;
+      TKey *fKey{nullptr}; ///< The key once created, owned by the list of keys of the directory
+   };
+
+   std::vector<char> fBuffer;    ///< Copy of the keys record, without its header
+   std::vector<REntry> fEntries; ///< In file order, i.e. with the highest cycles first
+   std::vector<Int_t> fTable;    ///< Hash table of the entry indices, with linear probing; -1 marks empty slots
+
+   /// Skip a string written by TString::FillBuffer, returning the position and length of its characters.
+   bool SkipString(char *&buffer, Int_t &offset, Int_t &length) const
+   {
+      const char *end = fBuffer.data() + fBuffer.size();
+      if (buffer >= end)
+         return false;
+      UChar_t nwh;
+      frombuf(buffer, &nwh);
+      length = nwh;
+      if (nwh == 255) {
+         if (end - buffer < (Long64_t)sizeof(Int_t))
+            return false;
+         frombuf(buffer, &length);
+      }
+      offset = buffer - fBuffer.data();
+      if (length < 0 || end - buffer < length)
+         return false;
+      buffer += length;
+      return true;
+   }
+
+   bool IsNamed(const REntry &entry, const char *name, Int_t length) const
+   {
+      return entry.fNameLength == length && memcmp(&fBuffer[entry.fNameOffset], name, length) == 0;
+   }
+
+   TKey *GetKey(REntry &entry, TDirectory *dir)
+   {
+      if (!entry.fKey) {
+         char *buffer = &fBuffer[entry.fKeyOffset];
+         entry.fKey = new TKey(dir);
+         entry.fKey->ReadKeyBuffer(buffer);
+      }
+      return entry.fKey;
+   }
+
+public:
+   RKeyIndex(const char *buffer, const char *end) : fBuffer(buffer, end) {}
+
+   /// Index the first `nkeys` keys of the record. Indexing stops at the first key that does not fit in the record or
+   /// whose position is not in [64, fsize], like TDirectoryFile::ReadKeys does. Return the number of keys indexed.
+   Int_t Fill(Int_t nkeys, Long64_t fsize)
+   {
+      const ULong64_t kPidOffsetMask = 0xffffffffffffULL;
+      // Key header up to the seek offsets, see TKey::ReadKeyBuffer
+      const Long64_t kFixedLength = 2 * sizeof(Int_t) + sizeof(UInt_t) + 3 * sizeof(Short_t);
+      const char *end = fBuffer.data() + fBuffer.size();
+      char *buffer = fBuffer.data();
+      fEntries.reserve(nkeys);
+      for (Int_t i = 0; i < nkeys; ++i) {
+         REntry entry;
+         entry.fKeyOffset = buffer - fBuffer.data();
+         if (end - buffer < kFixedLength)
+            break;
+         Short_t version;
+         char *versionBuffer = buffer + sizeof(Int_t);
+         frombuf(versionBuffer, &version);
+         buffer += kFixedLength;
+         Long64_t seekKey, seekPdir;
+         if (version > 1000) {
+            if (end - buffer < 2 * (Long64_t)sizeof(Long64_t))
+               break;
+            frombuf(buffer, &seekKey);
+            frombuf(buffer, &seekPdir);
+            seekPdir &= kPidOffsetMask;
+         } else {
+            if (end - buffer < 2 * (Long64_t)sizeof(UInt_t))
+               break;
+            UInt_t seekkey, seekdir;
+            frombuf(buffer, &seekkey);
+            frombuf(buffer, &seekdir);
+            seekKey = seekkey;
+            seekPdir = seekdir;
+         }
+         if (seekKey < 64 || seekKey > fsize || seekPdir < 64 || seekPdir > fsize)
+            break;
+         Int_t titleOffset, titleLength;
+         if (!SkipString(buffer, entry.fClassOffset, entry.fClassLength) ||
+             !SkipString(buffer, entry.fNameOffset, entry.fNameLength) ||
+             !SkipString(buffer, titleOffset, titleLength))
+            break;
+         fEntries.push_back(entry);
+      }
+
+      UInt_t size = 16;
+      while (size < 2 * fEntries.size())
+         size *= 2;
+      fTable.assign(size, -1);
+      const UInt_t mask = size - 1;
+      for (Int_t i = 0; i < (Int_t)fEntries.size(); ++i) {
+         const auto &entry = fEntries[i];
+         UInt_t slot = TString::Hash(&fBuffer[entry.fNameOffset], entry.fNameLength) & mask;
+         while (fTable[slot] != -1)
+            slot = (slot + 1) & mask;
+         fTable[slot] = i;
+      }
+      return fEntries.size();
+   }
+
+   Int_t GetSize() const { return fEntries.size(); }
+
+   Int_t CountKeysOfClass(const char *classname) const
+   {
+      const Int_t length = strlen(classname);
+      Int_t nkeys = 0;
+      for (const auto &entry : fEntries) {
+         if (entry.fClassLength == length && memcmp(&fBuffer[entry.fClassOffset], classname, length) == 0)
+            ++nkeys;
+      }
+      return nkeys;
+   }
+
+   /// Create the keys called `name` that are not in memory yet and add them, in file order, to `keys`.
+   void AddKeys(const char *name, TList &keys, TDirectory *dir)
+   {
+      const Int_t length = strlen(name);
+      const UInt_t mask = fTable.size() - 1;
+      // The entries with the same name are met in file order along the probe sequence
+      for (UInt_t slot = TString::Hash(name, length) & mask; fTable[slot] != -1; slot = (slot + 1) & mask) {
+         auto &entry = fEntries[fTable[slot]];
+         if (!entry.fKey && IsNamed(entry, name, length))
+            keys.Add(GetKey(entry, dir));
+      }
+   }
+
+   /// Add all the keys to `keys`, in file order, creating those that are not in memory yet.
+   void AddAllKeys(TList &keys, TDirectory *dir)
+   {
+      for (auto &entry : fEntries)
+         keys.Add(GetKey(entry, dir));
+   }
+};
+
+} // namespace Internal
+} // namespace ROOT
+
 
 ////////////////////////////////////////////////////////////////////////////////
 /// Default TDirectoryFile constructor
@@ -177,6 +344,7 @@ void TDirectoryFile::InitDirectoryFile(TClass *cl)
 
 TDirectoryFile::~TDirectoryFile()
 {
+   DeleteKeyIndex();
    if (fKeys) {
       fKeys->Delete("slow");
       SafeDelete(fKeys);
@@ -229,6 +397,8 @@ Int_t TDirectoryFile::AppendKey(TKey *key)
       Error("AppendKey","TDirectoryFile not initialized yet.");
       return 0;
    }
+   if (fKeyIndex)
+      MaterializeKeys();
 
    fModified = kTRUE;
 
@@ -266,7 +436,7 @@ void TDirectoryFile::Browse(TBrowser *b)
       TObject *obj = nullptr;
       TIter nextin(fList);
       TKey *key = nullptr, *keyo = nullptr;
-      TIter next(fKeys);
+      TIter next(GetListOfKeys());
 
       cd();
 
@@ -588,6 +758,7 @@ void TDirectoryFile::Close(Option_t *option)
    }
 
    // Delete keys from key list (but don't delete the list header)
+   DeleteKeyIndex();
    if (fKeys) {
       fKeys->Delete("slow");
    }
@@ -595,6 +766,33 @@ void TDirectoryFile::Close(Option_t *option)
    TDirectoryFile::CleanTargets();
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Return the number of keys of class `classname` in this directory, without
+/// creating the keys that are not in memory yet.
+
+Int_t TDirectoryFile::CountKeysOfClass(const char *classname) const
+{
+   if (fKeyIndex)
+      return fKeyIndex->CountKeysOfClass(classname);
+
+   Int_t nkeys = 0;
+   for (auto key : TRangeDynCast<TKey>(fKeys)) {
+      if (key && !strcmp(key->GetClassName(), classname))
+         ++nkeys;
+   }
+   return nkeys;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Forget the keys of the index that are not in memory yet, e.g. before the
+/// keys in memory are deleted.
+
+void TDirectoryFile::DeleteKeyIndex()
+{
+   delete fKeyIndex;
+   fKeyIndex = nullptr;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Delete Objects or/and keys in a directory
 ///
@@ -801,7 +999,7 @@ TKey *TDirectoryFile::FindKeyAny(const char *keyname) const
 
    DecodeNameCycle(keyname, name, cycle, kMaxLen);
 
-   auto listOfKeys = dynamic_cast<THashList *>(GetListOfKeys());
+   auto listOfKeys = dynamic_cast<THashList *>(GetListOfKeysNamed(name));
    if (!listOfKeys) {
       Error("FindKeyAny", "Unexpected type of TDirectoryFile::fKeys!");
       return nullptr;
@@ -853,7 +1051,7 @@ TObject *TDirectoryFile::FindObjectAny(const char *aname) const
 
    DecodeNameCycle(aname, name, cycle, kMaxLen);
 
-   auto listOfKeys = dynamic_cast<THashList *>(GetListOfKeys());
+   auto listOfKeys = dynamic_cast<THashList *>(GetListOfKeysNamed(name));
    if (!listOfKeys) {
       Error("FindObjectAny", "Unexpected type of TDirectoryFile::fKeys!");
       return nullptr;
@@ -974,7 +1172,7 @@ TObject *TDirectoryFile::Get(const char *namecycle)
 
 //*-*---------------------Case of Key---------------------
 //                        ===========
-   auto listOfKeys = dynamic_cast<THashList *>(GetListOfKeys());
+   auto listOfKeys = dynamic_cast<THashList *>(GetListOfKeysNamed(namobj));
    if (!listOfKeys) {
       Error("Get", "Unexpected type of TDirectoryFile::fKeys!");
       return nullptr;
@@ -1097,7 +1295,7 @@ void *TDirectoryFile::GetObjectChecked(const char *namecycle, const TClass* expe
 
 //*-*---------------------Case of Key---------------------
 //                        ===========
-   auto listOfKeys = dynamic_cast<THashList *>(GetListOfKeys());
+   auto listOfKeys = dynamic_cast<THashList *>(GetListOfKeysNamed(namobj));
    if (!listOfKeys) {
       Error("GetObjectChecked", "Unexpected type of TDirectoryFile::fKeys!");
       return nullptr;
@@ -1138,7 +1336,7 @@ TKey *TDirectoryFile::GetKey(const char *name, Short_t cycle) const
 {
    if (!fKeys) return nullptr;
 
-   auto listOfKeys = dynamic_cast<THashList *>(GetListOfKeys());
+   auto listOfKeys = dynamic_cast<THashList *>(GetListOfKeysNamed(name));
    if (!listOfKeys) {
       Error("GetKey", "Unexpected type of TDirectoryFile::fKeys!");
       return nullptr;
@@ -1156,6 +1354,41 @@ TKey *TDirectoryFile::GetKey(const char *name, Short_t cycle) const
    return nullptr;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Return the list of keys, in which at least all the keys called `name` are
+/// present.
+///
+/// Contrary to GetListOfKeys(), this only creates the keys called `name` when
+/// the directory has been read from a file opened for reading, see ReadKeys().
+
+TList *TDirectoryFile::GetListOfKeysNamed(const char *name) const
+{
+   if (fKeyIndex)
+      fKeyIndex->AddKeys(name, *fKeys, const_cast<TDirectoryFile *>(this));
+   return fKeys;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return the number of keys in this directory.
+
+Int_t TDirectoryFile::GetNkeys() const
+{
+   return fKeyIndex ? fKeyIndex->GetSize() : fKeys->GetSize();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Create the keys of the index that are not in memory yet, and put all the
+/// keys in the list of keys, in file order.
+
+void TDirectoryFile::MaterializeKeys() const
+{
+   // Reset fKeyIndex first: the code below accesses the list of keys through GetListOfKeys().
+   std::unique_ptr<ROOT::Internal::RKeyIndex> index(fKeyIndex);
+   fKeyIndex = nullptr;
+   fKeys->Clear("nodelete");
+   index->AddAllKeys(*fKeys, const_cast<TDirectoryFile *>(this));
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// List Directory contents
 ///
@@ -1203,7 +1436,7 @@ void TDirectoryFile::ls(Option_t *option) const
       }
    }
 
-   if (diskobj && fKeys) {
+   if (diskobj && GetListOfKeys()) {
       //*-* Loop on all the keys
       for (TObjLink *lnk = fKeys->FirstLink(); lnk != nullptr; lnk = lnk->Next()) {
          TKey *key = (TKey*)lnk->GetObject();
@@ -1371,6 +1604,12 @@ void TDirectoryFile::ReadAll(Option_t* opt)
 /// This is an efficient way (without opening/closing files) to view
 /// the latest updates of a file being modified by another process
 /// as it is typically the case in a data acquisition system.
+///
+/// When the file is opened for reading, no TKey is created here: the keys
+/// record is kept in memory together with a compact index of the key names,
+/// and the keys are only created when they are looked up by name (e.g. by
+/// Get() or GetKey()), or all together when the list of keys is requested
+/// with GetListOfKeys(). This keeps opening directories with many keys fast.
 
 Int_t TDirectoryFile::ReadKeys(Bool_t forceRead)
 {
@@ -1383,6 +1622,7 @@ Int_t TDirectoryFile::ReadKeys(Bool_t forceRead)
 
    char *buffer;
    if (forceRead) {
+      DeleteKeyIndex();
       fKeys->Delete();
       //In case directory was updated by another process, read new
       //position for the keys
@@ -1425,6 +1665,18 @@ Int_t TDirectoryFile::ReadKeys(Bool_t forceRead)
 
       TKey *key;
       frombuf(buffer, &nkeys);
+      // Keys of files opened for reading are indexed, and only created when they are needed
+      if (!fFile->IsWritable() && GetListOfKeys()->IsEmpty()) {
+         auto index = std::make_unique<ROOT::Internal::RKeyIndex>(buffer, headerkey->GetBuffer() + fNbytesKeys);
+         delete headerkey; // before setting fKeyIndex: ~TKey accesses the list of keys
+         const Int_t nindexed = index->Fill(nkeys, fsize);
+         if (nindexed < nkeys) {
+            Error("ReadKeys","reading illegal key, exiting after %d keys",nindexed);
+            nkeys = nindexed;
+         }
+         fKeyIndex = index.release();
+         return nkeys;
+      }
       for (Int_t i = 0; i < nkeys; i++) {
          key = new TKey(this);
          key->ReadKeyBuffer(buffer);
@@ -1461,7 +1713,7 @@ Int_t TDirectoryFile::ReadKeys(Bool_t forceRead)
 Int_t TDirectoryFile::ReadTObject(TObject *obj, const char *keyname)
 {
    if (!fFile) { Error("ReadTObject","No file open"); return 0; }
-   auto listOfKeys = dynamic_cast<THashList *>(GetListOfKeys());
+   auto listOfKeys = dynamic_cast<THashList *>(GetListOfKeysNamed(keyname));
    if (!listOfKeys) {
       Error("ReadTObject", "Unexpected type of TDirectoryFile::fKeys!");
       return 0;
@@ -1502,13 +1754,14 @@ void TDirectoryFile::ResetAfterMerge(TFileMergeInfo *info)
    fSeekParent = 0; // updated by Init
    fSeekKeys = 0;   // updated by Init
    // Does not change: fFile
-   TKey *key = fKeys ? (TKey*)fKeys->FindObject(fName) : nullptr;
+   TKey *key = fKeys ? (TKey*)GetListOfKeysNamed(fName)->FindObject(fName) : nullptr;
    TClass *cl = IsA();
    if (key) {
       cl = TClass::GetClass(key->GetClassName());
    }
    // NOTE: We should check that the content is really mergeable and in
    // the in-mmeory list, before deleting the keys.
+   DeleteKeyIndex();
    if (fKeys) {
       fKeys->Delete("slow");
    }
@@ -1679,6 +1932,9 @@ void TDirectoryFile::SetWritable(Bool_t writable)
    TDirectory::TContext ctxt(this);
 
    fWritable = writable;
+   // Writing needs all the keys in memory
+   if (writable && fKeyIndex)
+      MaterializeKeys();
 
    // recursively set all sub-directories
    if (fList) {
@@ -1827,12 +2083,21 @@ void TDirectoryFile::Streamer(TBuffer &b)
 /// A new key is created in the keys linked list for each object.
 /// For allowed options see TObject::Write().
 /// The directory header info is rewritten on the directory header record.
+///
+/// If implicit multi-threading is enabled (see ROOT::EnableImplicitMT()) and the file is compressed,
+/// the objects are streamed one after the other, but their keys are compressed in parallel before
+/// being written to the file.
 
 Int_t TDirectoryFile::Write(const char *, Int_t opt, Int_t bufsize)
 {
    if (!IsWritable()) return 0;
    TDirectory::TContext ctxt(this);
 
+   std::unique_ptr<ROOT::Internal::TKeyCompressor> compressor;
+   if (fFile && !fFile->fKeyCompressor && fFile->IsBinary() && fFile->GetCompressionLevel() > 0 &&
+       ROOT::IsImplicitMTEnabled() && fList->GetSize() > 1 && !(opt & kOnlyPrepStep))
+      compressor = std::make_unique<ROOT::Internal::TKeyCompressor>(*fFile);
+
    // Loop on all objects (including subdirs)
    TIter next(fList);
    TObject *obj;
@@ -1840,6 +2105,11 @@ Int_t TDirectoryFile::Write(const char *, Int_t opt, Int_t bufsize)
    while ((obj=next())) {
       nbytes += obj->Write(0,opt,bufsize);
    }
+   // The keys of this directory, possibly installed by a parent directory, must be written before the directory
+   if (fFile && fFile->fKeyCompressor) {
+      Int_t nzip = fFile->fKeyCompressor->Finish();
+      if (nzip > 0) nbytes += nzip;
+   }
    if (R__likely(!(opt & kOnlyPrepStep)))
       SaveSelf(kTRUE);   // force save itself
 
@@ -1947,6 +2217,13 @@ Int_t TDirectoryFile::WriteTObject(const TObject *obj, const char *name, Option_
       oname = newName;
    }
 
+   Int_t nbytes = 0;
+   auto compressor = fFile->fKeyCompressor;
+   if (compressor && (opt.Contains("overwrite") || opt.Contains("writedelete"))) {
+      // The key to replace might still wait for its compression
+      nbytes = compressor->Finish();
+      if (nbytes < 0) nbytes = 0;
+   }
    if (opt.Contains("overwrite")) {
       //One must use GetKey. FindObject would return the lowest cycle of the key!
       //key = (TKey*)gDirectory->GetListOfKeys()->FindObject(oname);
@@ -1962,6 +2239,25 @@ Int_t TDirectoryFile::WriteTObject(const TObject *obj, const char *name, Option_
    key = fFile->CreateKey(this, obj, oname, bsize);
    if (newName) delete [] newName;
 
+   if (compressor && compressor->IsPending(key)) {
+      // Compressed and written together with the keys of the other objects, see TDirectoryFile::Write(),
+      // unless the old key must be deleted after writing the new one
+      fFile->SumBuffer(key->GetObjlen());
+      if (oldkey || compressor->IsFull()) {
+         Int_t nzip = compressor->Finish();
+         if (nzip < 0) {
+            if (bufsize) fFile->SetBufferSize(bufsize);
+            return 0;
+         }
+         if (oldkey) {
+            oldkey->Delete();
+            delete oldkey;
+         }
+         nbytes += nzip;
+      }
+      if (bufsize) fFile->SetBufferSize(bufsize);
+      return nbytes;
+   }
    if (!key->GetSeekKey()) {
       fKeys->Remove(key);
       delete key;
@@ -1969,7 +2265,7 @@ Int_t TDirectoryFile::WriteTObject(const TObject *obj, const char *name, Option_
       return 0;
    }
    fFile->SumBuffer(key->GetObjlen());
-   Int_t nbytes = key->WriteFile(0);
+   nbytes += key->WriteFile(0);
    if (fFile->TestBit(TFile::kWriteError)) {
       if (bufsize) fFile->SetBufferSize(bufsize);
       return 0;
@@ -2096,6 +2392,13 @@ Int_t TDirectoryFile::WriteObjectAny(const void *obj, const TClass *cl, const ch
       oname = newName;
    }
 
+   Int_t nbytes = 0;
+   auto compressor = fFile->fKeyCompressor;
+   if (compressor && (opt.Contains("overwrite") || opt.Contains("writedelete"))) {
+      // The key to replace might still wait for its compression
+      nbytes = compressor->Finish();
+      if (nbytes < 0) nbytes = 0;
+   }
    if (opt.Contains("overwrite")) {
       //One must use GetKey. FindObject would return the lowest cycle of the key!
       //key = (TKey*)gDirectory->GetListOfKeys()->FindObject(oname);
@@ -2111,13 +2414,28 @@ Int_t TDirectoryFile::WriteObjectAny(const void *obj, const TClass *cl, const ch
    key = fFile->CreateKey(this, obj, cl, oname, bsize);
    if (newName) delete [] newName;
 
+   if (compressor && compressor->IsPending(key)) {
+      // Compressed and written together with the keys of the other objects, see TDirectoryFile::Write(),
+      // unless the old key must be deleted after writing the new one
+      fFile->SumBuffer(key->GetObjlen());
+      if (oldkey || compressor->IsFull()) {
+         Int_t nzip = compressor->Finish();
+         if (nzip < 0) return 0;
+         if (oldkey) {
+            oldkey->Delete();
+            delete oldkey;
+         }
+         nbytes += nzip;
+      }
+      return nbytes;
+   }
    if (!key->GetSeekKey()) {
       fKeys->Remove(key);
       delete key;
       return 0;
    }
    fFile->SumBuffer(key->GetObjlen());
-   Int_t nbytes = key->WriteFile(0);
+   nbytes += key->WriteFile(0);
    if (fFile->TestBit(TFile::kWriteError)) return 0;
 
    if (oldkey) {
@@ -136,11 +136,14 @@ The structure of a directory is shown in TDirectoryFile::TDirectoryFile
 #include <cmath>
 #include <iostream>
 #include <set>
+#include <string>
+#include <unordered_map>
 #include "TSchemaRule.h"
 #include "TSchemaRuleSet.h"
 #include "TThreadSlots.h"
 #include "TGlobal.h"
 #include "ROOT/RConcurrentHashColl.hxx"
+#include "ROOT/RIOMetrics.hxx"
 #include <memory>
 
 #ifdef R__FBSD
@@ -188,6 +191,69 @@ AddPseudoGlobals() {
 }
 } gAddPseudoGlobals;
 }
+
+namespace {
+/// A StreamerInfo read from a file and already checked against the in-memory class by TStreamerInfo::BuildCheck()
+struct CheckedStreamerInfo {
+   Int_t fNumber;          ///< Number of the StreamerInfo that represents it in memory
+   TClass::EState fState;  ///< State of the class when it was checked
+};
+
+/// StreamerInfos checked by TFile::ReadStreamerInfo(), by class name, version and checksum. Protected by
+/// gInterpreterMutex.
+std::unordered_map<std::string, CheckedStreamerInfo> &GetCheckedStreamerInfos()
+{
+   static std::unordered_map<std::string, CheckedStreamerInfo> infos;
+   return infos;
+}
+
+std::string GetCheckedStreamerInfoKey(const TStreamerInfo &info)
+{
+   return std::string(info.GetName()) + ';' + std::to_string(info.GetClassVersion()) + ';' +
+          std::to_string(info.GetCheckSum());
+}
+
+/// Returns the number of the in-memory StreamerInfo equivalent to the given StreamerInfo read from a file if an
+/// identical StreamerInfo was already checked with TStreamerInfo::BuildCheck() for another file, and if neither
+/// that StreamerInfo nor its class changed since; -1 otherwise.
+Int_t FindCheckedStreamerInfo(const TStreamerInfo &info)
+{
+   R__LOCKGUARD(gInterpreterMutex);
+   auto &infos = GetCheckedStreamerInfos();
+   if (infos.empty())
+      return -1;
+   auto it = infos.find(GetCheckedStreamerInfoKey(info));
+   if (it == infos.end())
+      return -1;
+   auto registered = dynamic_cast<TStreamerInfo *>(gROOT->GetListOfStreamerInfo()->At(it->second.fNumber));
+   TClass *cl = registered ? registered->GetClass() : nullptr;
+   if (!cl || cl->GetState() != it->second.fState || registered->GetCheckSum() != info.GetCheckSum() ||
+       registered->GetClassVersion() != info.GetClassVersion() ||
+       cl->FindStreamerInfo(info.GetCheckSum()) != registered) {
+      infos.erase(it);
+      return -1;
+   }
+   return it->second.fNumber;
+}
+
+/// Remember the StreamerInfo read from a file after TStreamerInfo::BuildCheck(), if it is represented in memory by a
+/// StreamerInfo with the same version and checksum.
+void AddCheckedStreamerInfo(const TStreamerInfo &info)
+{
+   R__LOCKGUARD(gInterpreterMutex);
+   const Int_t number = info.GetNumber();
+   if (number < 0 || number >= gROOT->GetListOfStreamerInfo()->GetSize())
+      return;
+   auto registered = dynamic_cast<TStreamerInfo *>(gROOT->GetListOfStreamerInfo()->At(number));
+   TClass *cl = registered ? registered->GetClass() : nullptr;
+   if (!cl || registered->GetCheckSum() != info.GetCheckSum() ||
+       registered->GetClassVersion() != info.GetClassVersion() ||
+       cl->FindStreamerInfo(info.GetCheckSum()) != registered)
+      return;
+   GetCheckedStreamerInfos()[GetCheckedStreamerInfoKey(info)] = {number, cl->GetState()};
+}
+} // anonymous namespace
+
 ////////////////////////////////////////////////////////////////////////////////
 /// File default Constructor.
 
@@ -613,6 +679,8 @@ void TFile::Init(Bool_t create)
       return;
    fInitDone = kTRUE;
 
+   fIOMetrics = ROOT::Experimental::RIOMetrics::GetFileMetricsIfEnabled("TFile", GetName());
+
    if (!fIsRootFile) {
       gDirectory = gROOT;
       return;
@@ -887,7 +955,7 @@ void TFile::Init(Bool_t create)
             }
          } else if (fVersion != gROOT->GetVersionInt() && fVersion > 30000) {
             // Don't complain about missing streamer info for empty files.
-            if (fKeys->GetSize()) {
+            if (GetNkeys()) {
                Warning("Init","no StreamerInfo found in %s therefore preventing schema evolution when reading this file."
                               " The file was produced with version %d.%02d/%02d of ROOT.",
                               GetName(),  fVersion / 10000, (fVersion / 100) % (100), fVersion  % 100);
@@ -898,11 +966,7 @@ void TFile::Init(Bool_t create)
 
    // Count number of TProcessIDs in this file
    {
-      TIter next(fKeys);
-      TKey *key;
-      while ((key = (TKey*)next())) {
-         if (!strcmp(key->GetClassName(),"TProcessID")) fNProcessIDs++;
-      }
+      fNProcessIDs += CountKeysOfClass("TProcessID");
       fProcessIDs = new TObjArray(fNProcessIDs+1);
    }
 
@@ -1719,6 +1783,8 @@ Bool_t TFile::ReadBuffer(char *buf, Long64_t pos, Int_t len)
 
       Seek(pos);
       ssize_t siz;
+      ROOT::Experimental::RIOFileMetrics::Clock_t::time_point metricsStart;
+      if (fIOMetrics) metricsStart = ROOT::Experimental::RIOFileMetrics::Now();
 
       while ((siz = SysRead(fD, buf, len)) < 0 && GetErrno() == EINTR)
          ResetErrno();
@@ -1736,6 +1802,8 @@ Bool_t TFile::ReadBuffer(char *buf, Long64_t pos, Int_t len)
       fgBytesRead += siz;
       fReadCalls++;
       fgReadCalls++;
+      if (fIOMetrics)
+         fIOMetrics->AddRead(siz, metricsStart);
 
       if (gMonitoringWriter)
          gMonitoringWriter->SendFileReadProgress(this);
@@ -1764,8 +1832,10 @@ Bool_t TFile::ReadBuffer(char *buf, Int_t len)
 
       ssize_t siz;
       Double_t start = 0;
+      ROOT::Experimental::RIOFileMetrics::Clock_t::time_point metricsStart;
 
       if (gPerfStats) start = TTimeStamp();
+      if (fIOMetrics) metricsStart = ROOT::Experimental::RIOFileMetrics::Now();
 
       while ((siz = SysRead(fD, buf, len)) < 0 && GetErrno() == EINTR)
          ResetErrno();
@@ -1783,6 +1853,8 @@ Bool_t TFile::ReadBuffer(char *buf, Int_t len)
       fgBytesRead += siz;
       fReadCalls++;
       fgReadCalls++;
+      if (fIOMetrics)
+         fIOMetrics->AddRead(siz, metricsStart);
 
       if (gMonitoringWriter)
          gMonitoringWriter->SendFileReadProgress(this);
@@ -2469,6 +2541,8 @@ Bool_t TFile::WriteBuffer(const char *buf, Int_t len)
       }
 
       ssize_t siz;
+      ROOT::Experimental::RIOFileMetrics::Clock_t::time_point metricsStart;
+      if (fIOMetrics) metricsStart = ROOT::Experimental::RIOFileMetrics::Now();
       gSystem->IgnoreInterrupt();
       while ((siz = SysWrite(fD, buf, len)) < 0 && GetErrno() == EINTR)  // NOLINT: silence clang-tidy warnings
          ResetErrno();                                                   // NOLINT: silence clang-tidy warnings
@@ -2487,6 +2561,8 @@ Bool_t TFile::WriteBuffer(const char *buf, Int_t len)
       }
       fBytesWrite  += siz;
       fgBytesWrite += siz;
+      if (fIOMetrics)
+         fIOMetrics->AddWrite(siz, metricsStart);
 
       if (gMonitoringWriter)
          gMonitoringWriter->SendFileWriteProgress(this);
@@ -3676,8 +3752,16 @@ void TFile::ReadStreamerInfo()
          if ( (!isstl && mode ==0) || (isstl && mode ==1) ) {
                // Skip the STL container the first time around
                // Skip the regular classes the second time around;
-            info->BuildCheck(this);
-            Int_t uid = info->GetNumber();
+            // Identical StreamerInfos found in other files, e.g. of the same TChain, are checked only once
+            Int_t uid = isstl ? -1 : FindCheckedStreamerInfo(*info);
+            if (uid >= 0) {
+               info->SetBit(kCanDelete);
+            } else {
+               info->BuildCheck(this);
+               uid = info->GetNumber();
+               if (!isstl)
+                  AddCheckedStreamerInfo(*info);
+            }
             Int_t asize = fClassIndex->GetSize();
             if (uid >= asize && uid <100000) fClassIndex->Set(2*asize);
             if (uid >= 0 && uid < fClassIndex->GetSize()) fClassIndex->fArray[uid] = 1;
@@ -23,14 +23,143 @@ TXNetFile and TWebFile (via TFile::WriteBuffers()).
 
 The write cache is automatically created when writing a remote file
 (created in TFile::Open()).
+
+By default, a full cache is written to the file by the thread that fills
+it. SetAsyncFlush() hands full caches over to a background thread
+instead, which writes them while the next cache is being filled: the
+filling thread then only waits for the disk when the previous cache has
+not been written yet. Only two buffers are used, so at most one cache is
+in flight at any time. Asynchronous flushing is supported for local files
+(TFile itself, not its subclasses) on POSIX systems.
 */
 
 
 #include "TFile.h"
 #include "TFileCacheWrite.h"
 
+#include <cerrno>
+#include <condition_variable>
+#include <cstring>
+#include <mutex>
+#include <thread>
+
+#ifndef WIN32
+#include <unistd.h>
+#endif
+
 ClassImp(TFileCacheWrite);
 
+namespace ROOT {
+namespace Internal {
+
+////////////////////////////////////////////////////////////////////////////////
+/// Background writer of a TFileCacheWrite, see TFileCacheWrite::SetAsyncFlush().
+///
+/// The writer owns a second buffer of the size of the cache, which it swaps
+/// with the buffer of the cache when a write is handed over. It writes with
+/// pwrite(), which does not touch the offset of the file descriptor, so the
+/// filling thread can keep using the file meanwhile.
+
+class RFileCacheWriteFlusher {
+   Int_t fFd;                          ///< Descriptor of the file
+   char *fBuffer;                      ///< Buffer being written, or spare buffer when idle
+   Long64_t fPos{0};                   ///< Position of the write in flight
+   Int_t fLen{0};                      ///< Length of the write in flight, 0 when idle; protected by fMutex
+   Long64_t fWritten{0};               ///< Bytes written by the last write; protected by fMutex
+   Int_t fErrno{0};                    ///< Error of the last write; protected by fMutex
+   Int_t fNflushing{0};                ///< Bytes handed over and not collected yet, only used by the filling thread
+   bool fStop{false};                  ///< Stops the writer thread; protected by fMutex
+   std::mutex fMutex;
+   std::condition_variable fCondition; ///< Wakes up the writer thread and the thread waiting for the write
+   std::thread fThread;
+
+   void WriterLoop()
+   {
+      std::unique_lock<std::mutex> lock(fMutex);
+      while (true) {
+         fCondition.wait(lock, [this] { return fStop || fLen > 0; });
+         // A write in flight is completed even when stopping
+         if (fLen == 0)
+            return;
+         const char *buffer = fBuffer;
+         const Long64_t pos = fPos;
+         const Int_t len = fLen;
+         lock.unlock();
+         Long64_t written = 0;
+         Int_t error = 0;
+#ifndef WIN32
+         while (written < len) {
+            auto siz = ::pwrite(fFd, buffer + written, len - written, pos + written);
+            if (siz < 0 && errno == EINTR)
+               continue;
+            if (siz <= 0) {
+               error = siz < 0 ? errno : 0;
+               break;
+            }
+            written += siz;
+         }
+#endif
+         lock.lock();
+         fWritten = written;
+         fErrno = error;
+         fLen = 0;
+         fCondition.notify_all();
+      }
+   }
+
+public:
+   RFileCacheWriteFlusher(Int_t fd, Int_t bufferSize)
+      : fFd(fd), fBuffer(new char[bufferSize]), fThread(&RFileCacheWriteFlusher::WriterLoop, this)
+   {
+   }
+   RFileCacheWriteFlusher(const RFileCacheWriteFlusher &) = delete;
+   RFileCacheWriteFlusher &operator=(const RFileCacheWriteFlusher &) = delete;
+   ~RFileCacheWriteFlusher()
+   {
+      {
+         std::lock_guard<std::mutex> lock(fMutex);
+         fStop = true;
+      }
+      fCondition.notify_all();
+      fThread.join();
+      delete[] fBuffer;
+   }
+
+   Int_t GetBytesInFlight() const { return fNflushing; }
+
+   /// Hand the `len` bytes of `buffer` over to the writer, to be written at `pos`. `buffer` is replaced by the spare
+   /// buffer. The result of the previous write must have been collected with Wait().
+   void Start(char *&buffer, Long64_t pos, Int_t len)
+   {
+      {
+         std::lock_guard<std::mutex> lock(fMutex);
+         std::swap(buffer, fBuffer);
+         fPos = pos;
+         fLen = len;
+      }
+      fNflushing = len;
+      fCondition.notify_all();
+   }
+
+   /// Wait for the write handed over by Start(), if any. Return its length, the number of bytes actually written and
+   /// the error number in case of failure; return false if no write was in flight.
+   bool Wait(Int_t &len, Long64_t &written, Int_t &error)
+   {
+      if (fNflushing == 0)
+         return false;
+      std::unique_lock<std::mutex> lock(fMutex);
+      fCondition.wait(lock, [this] { return fLen == 0; });
+      len = fNflushing;
+      written = fWritten;
+      error = fErrno;
+      fNflushing = 0;
+      return true;
+   }
+};
+
+} // namespace Internal
+} // namespace ROOT
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Default Constructor.
 
@@ -69,15 +198,22 @@ TFileCacheWrite::TFileCacheWrite(TFile *file, Int_t buffersize)
 
 TFileCacheWrite::~TFileCacheWrite()
 {
+   // Completes the write in flight, if any
+   delete fFlusher;
    delete [] fBuffer;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 /// Flush the current write buffer to the file.
+/// The write in flight, if asynchronous flushing is enabled, is completed first.
 /// Returns kTRUE in case of error.
 
 Bool_t TFileCacheWrite::Flush()
 {
+   if (WaitForFlush()) {
+      fNtot = 0;
+      return kTRUE;
+   }
    if (!fNtot) return kFALSE;
    fFile->Seek(fSeekStart);
    //printf("Flushing buffer at fSeekStart=%lld, fNtot=%d\n",fSeekStart,fNtot);
@@ -88,6 +224,58 @@ Bool_t TFileCacheWrite::Flush()
    return status;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Hand the current write buffer over to the background writer, after the
+/// previous write has completed.
+/// Returns kTRUE in case of error.
+
+Bool_t TFileCacheWrite::FlushAsync()
+{
+   if (WaitForFlush()) {
+      fNtot = 0;
+      return kTRUE;
+   }
+   fFlusher->Start(fBuffer, fSeekStart, fNtot);
+   fNtot = 0;
+   return kFALSE;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Wait for the write in flight, if any, and account for it in the file.
+/// Returns kTRUE in case of error.
+
+Bool_t TFileCacheWrite::WaitForFlush()
+{
+   Int_t len = 0, error = 0;
+   Long64_t written = 0;
+   if (!fFlusher || !fFlusher->Wait(len, written, error))
+      return kFALSE;
+
+   fFile->fBytesWrite += written;
+   TFile::fgBytesWrite += written;
+   if (error) {
+      fFile->SetBit(TFile::kWriteError);
+      fFile->SetWritable(kFALSE);
+      Error("Flush", "error writing to file %s: %s", fFile->GetName(), strerror(error));
+      return kTRUE;
+   }
+   if (written != len) {
+      fFile->SetBit(TFile::kWriteError);
+      Error("Flush", "error writing all requested bytes to file %s, wrote %lld of %d", fFile->GetName(), written, len);
+      return kTRUE;
+   }
+   return kFALSE;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return the number of bytes in the cache, including the bytes of the write
+/// in flight.
+
+Int_t TFileCacheWrite::GetBytesInCache() const
+{
+   return fNtot + (fFlusher ? fFlusher->GetBytesInFlight() : 0);
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Print class internal structure.
 
@@ -96,6 +284,8 @@ void TFileCacheWrite::Print(Option_t *option) const
    TString opt = option;
    printf("Write cache for file %s\n",fFile->GetName());
    printf("Size of write cache: %d bytes to be written at %lld\n",fNtot,fSeekStart);
+   if (fFlusher)
+      printf("Asynchronous flushing: %d bytes in flight\n", fFlusher->GetBytesInFlight());
    opt.ToLower();
 }
 
@@ -107,6 +297,8 @@ void TFileCacheWrite::Print(Option_t *option) const
 
 Int_t TFileCacheWrite::ReadBuffer(char *buf, Long64_t pos, Int_t len)
 {
+   // The data in flight can be read from the file once written
+   WaitForFlush();
    if (pos < fSeekStart || pos+len > fSeekStart+fNtot) return -1;
    memcpy(buf,fBuffer+pos-fSeekStart,len);
    return 0;
@@ -129,7 +321,10 @@ Int_t TFileCacheWrite::WriteBuffer(const char *buf, Long64_t pos, Int_t len)
       if (Flush()) return -1; //failure
    }
    if (fNtot + len >= fBufferSize) {
-      if (Flush()) return -1; //failure
+      if (fFlusher && len < fBufferSize) {
+         //the data follow the cache: write the cache in the background
+         if (FlushAsync()) return -1; //failure
+      } else if (Flush()) return -1; //failure
       if (len >= fBufferSize) {
          //buffer larger than the cache itself: direct write to file
          fRecursive = kTRUE;
@@ -146,11 +341,48 @@ Int_t TFileCacheWrite::WriteBuffer(const char *buf, Long64_t pos, Int_t len)
    return 1;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Enable or disable asynchronous flushing.
+///
+/// When enabled, a full cache followed by more data is handed over to a
+/// background thread that writes it, while the next data fill the cache.
+/// Flush() and reads from the cache wait for the write in flight. Writing an
+/// other part of the file than the end of the cache flushes the cache
+/// synchronously, so the order of the writes to the same region is kept.
+///
+/// Only supported for local files: for other files this is ignored, with a
+/// warning.
+
+void TFileCacheWrite::SetAsyncFlush(Bool_t async)
+{
+   if (async == GetAsyncFlush())
+      return;
+   if (!async) {
+      WaitForFlush();
+      delete fFlusher;
+      fFlusher = nullptr;
+      return;
+   }
+#ifndef WIN32
+   if (fFile && fFile->IsA() == TFile::Class() && fFile->GetFd() >= 0) {
+      fFlusher = new ROOT::Internal::RFileCacheWriteFlusher(fFile->GetFd(), fBufferSize);
+      return;
+   }
+#endif
+   Warning("SetAsyncFlush", "asynchronous flushing is only supported for local files, %s is flushed synchronously",
+           fFile ? fFile->GetName() : "");
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Set the file using this cache.
 /// Any write not yet flushed will be lost.
+/// With asynchronous flushing, the write in flight is completed first.
 
 void TFileCacheWrite::SetFile(TFile *file)
 {
+   const Bool_t async = GetAsyncFlush();
+   SetAsyncFlush(kFALSE);
    fFile = file;
+   if (async && file)
+      SetAsyncFlush(kTRUE);
 }
@@ -20,6 +20,15 @@ any of its remote file access plugins. It is therefore useful in
 a Grid environment where the files might be accessible only remotely.
 The merging interface allows files containing histograms and trees
 to be merged, like the standalone hadd program.
+
+With SetNThreads(), the histograms of each directory are read from the
+source files and merged by several threads, without the partial output
+files of a multi-process merge. Trees and the other objects are still
+merged by the calling thread. When the baskets of the trees cannot be
+copied as they are, e.g. because the compression of the output file
+differs from the one of the inputs, implicit multi-threading is enabled
+with the same number of threads: the baskets are then unzipped and
+compressed again by tasks, and written in order by the calling thread.
 */
 
 #include "TFileMerger.h"
@@ -49,7 +58,13 @@ to be merged, like the standalone hadd program.
 #include <sys/resource.h>
 #endif
 
+#include <algorithm>
+#include <atomic>
 #include <cstring>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
 
 ClassImp(TFileMerger);
 
@@ -374,16 +389,31 @@ Bool_t TFileMerger::Merge(Bool_t)
 
 namespace {
 
-/// Merge a list of RNTuples
-Long64_t MergeRNTuples(TClass* rntupleHandle, const TString& /* target */, const TList& /* sources */) {
-   if (!rntupleHandle) {
+/// Merge the RNTuples with the given name found at `path` in the source files into the target directory.
+/// The RNTuple merge function expects the ntuple name and the target followed by the source directories as input.
+Long64_t MergeRNTuples(TClass *rntupleHandle, const char *ntupleName, const TString &path, TDirectory *target,
+                       const TList &sources)
+{
+   if (!rntupleHandle || !rntupleHandle->GetMerge())
       return Long64_t(-1);
+
+   TNamed name(ntupleName, "");
+   TList inputs;
+   inputs.Add(&name);
+   inputs.Add(target);
+   for (auto obj : sources) {
+      auto file = static_cast<TFile *>(obj);
+      TDirectory *dir = path.IsNull() ? file : file->GetDirectory(path);
+      if (!dir)
+         return Long64_t(-1);
+      inputs.Add(dir);
    }
-   // todo(max) implement rntuple merger
-   // [ ] build complete list of sources (some sources may actually be a directory with RNTuples inside)
-   // [ ] merge them
-   ROOT::MergeFunc_t func = rntupleHandle->GetMerge();
-   return func(static_cast<void*>(rntupleHandle), nullptr, nullptr);
+
+   TFileMergeInfo info(target);
+   void *ntuple = rntupleHandle->New();
+   Long64_t result = rntupleHandle->GetMerge()(ntuple, &inputs, &info);
+   rntupleHandle->Destructor(ntuple);
+   return result;
 }
 
 Bool_t IsMergeable(TClass *cl)
@@ -445,6 +475,26 @@ Bool_t WriteCycleInOrder(const TString &name, TIter &nextkey, TIter &peeknextkey
    return WriteOneAndDelete(name, cl, obj, kFALSE, kTRUE, target) && result;
 };
 
+/// Call `func(i)` for all i in [0, n) from at most `nThreads` threads, including the calling one.
+template <typename F>
+void ParallelFor(UInt_t nThreads, std::size_t n, F &&func)
+{
+   std::atomic<std::size_t> next{0};
+   auto work = [&]() {
+      for (auto i = next++; i < n; i = next++)
+         func(i);
+   };
+   std::vector<std::thread> threads;
+   for (std::size_t t = 1; t < std::min<std::size_t>(nThreads, n); ++t)
+      threads.emplace_back(work);
+   work();
+   for (auto &thread : threads)
+      thread.join();
+}
+
+/// Uncompressed size of the histograms read at once by TFileMerger::MergeHistogramsInParallel, summed over the sources.
+constexpr Long64_t kParallelMergeBatchBytes = 256 * 1024 * 1024;
+
 } // anonymous namespace
 
 Bool_t TFileMerger::MergeOne(TDirectory *target, TList *sourcelist, Int_t type, TFileMergeInfo &info,
@@ -519,6 +569,19 @@ Bool_t TFileMerger::MergeOne(TDirectory *target, TList *sourcelist, Int_t type,
          }
       }
    }
+   if (strcmp(keyclassname, "ROOT::Experimental::RNTuple") == 0) {
+      // RNTuples are merged page by page directly from the source files; the anchor need not be read here
+      oldkeyname = keyname;
+      if (alreadyseen)
+         return kTRUE;
+      Warning("MergeRecursive", "merging RNTuples is experimental");
+      if (MergeRNTuples(cl, keyname, path, target, *sourcelist) < 0) {
+         Error("MergeRecursive", "error merging RNTuple %s", keyname);
+         return kFALSE;
+      }
+      return kTRUE;
+   }
+
    // read object from first source file
    if (type & kIncremental) {
       if (!obj)
@@ -595,21 +658,10 @@ Bool_t TFileMerger::MergeOne(TDirectory *target, TList *sourcelist, Int_t type,
       if (!status) return kFALSE;
    } else if (!cl->IsTObject() && cl->GetMerge()) {
       // merge objects that don't derive from TObject
-      if (std::string(keyclassname) == "ROOT::Experimental::RNTuple") {
-         Warning("MergeRecursive", "merging RNTuples is experimental");
-         // todo(max): check if this works when a TDirectory is passed as the first
-         // input argument
-         Long64_t mergeResult = MergeRNTuples(cl, *path, *sourcelist);
-         if (mergeResult < 0) {
-            Error("MergeRecursive", "error merging RNTuples");
-            return kFALSE;
-         }
-      } else {
-         TFile *nextsource = current_file ? (TFile*)sourcelist->After( current_file ) : (TFile*)sourcelist->First();
-         Error("MergeRecursive", "Merging objects that don't inherit from TObject is unimplemented (key: %s of type %s in file %s)",
-                  keyname, keyclassname, nextsource->GetName());
-         canBeMerged = kFALSE;
-      }
+      TFile *nextsource = current_file ? (TFile*)sourcelist->After( current_file ) : (TFile*)sourcelist->First();
+      Error("MergeRecursive", "Merging objects that don't inherit from TObject is unimplemented (key: %s of type %s in file %s)",
+               keyname, keyclassname, nextsource->GetName());
+      canBeMerged = kFALSE;
    } else if (cl->IsTObject() && cl->GetMerge()) {
       // Check if already treated
       if (alreadyseen) return kTRUE;
@@ -804,6 +856,131 @@ Bool_t TFileMerger::MergeOne(TDirectory *target, TList *sourcelist, Int_t type,
    return kTRUE;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Merge with fNThreads threads the histograms in directory `path` of the first
+/// source file, before MergeRecursive() processes the other keys. A TFile cannot be
+/// read by several threads at once, so each thread reads the histograms of one source
+/// file at a time; the histograms with different names are then merged concurrently
+/// and written, in order, by the calling thread. The names of the histograms are
+/// added to allNames so that MergeRecursive() skips them. Histograms are processed in
+/// batches of about kParallelMergeBatchBytes uncompressed bytes over all sources.
+/// Returns kFALSE if writing a merged histogram failed.
+
+Bool_t TFileMerger::MergeHistogramsInParallel(TDirectory *target, TList *sourcelist, Int_t type, const TString &path,
+                                              THashList &allNames)
+{
+   std::vector<TFile *> sources;
+   for (auto file : *sourcelist)
+      sources.push_back(static_cast<TFile *>(file));
+   TDirectory *firstdir = sources.empty() ? nullptr : sources[0]->GetDirectory(path);
+   if (!firstdir)
+      return kTRUE;
+
+   // Select the histograms as MergeOne() would, keeping only their highest cycle
+   std::vector<TKey *> keys;
+   std::set<std::string> seen;
+   TIter nextkey(firstdir->GetListOfKeys());
+   while (auto key = static_cast<TKey *>(nextkey())) {
+      const char *keyname = key->GetName();
+      if (!seen.insert(keyname).second || allNames.FindObject(keyname) || firstdir->GetList()->FindObject(keyname))
+         continue;
+      TClass *cl = TClass::GetClass(key->GetClassName());
+      if (!cl || !cl->InheritsFrom(R__TH1_Class) || !cl->GetMerge())
+         continue;
+      if ((type & kOnlyListed) && !fObjectNames.Contains(TString(keyname) + " "))
+         continue;
+      if (!(type & kResetable && type & kNonResetable)) {
+         if (!(type & kResetable) && cl->GetResetAfterMerge())
+            continue;
+         if (!(type & kNonResetable) && !cl->GetResetAfterMerge())
+            continue;
+      }
+      keys.push_back(key);
+   }
+
+   Bool_t status = kTRUE;
+   std::size_t batchBegin = 0;
+   while (batchBegin < keys.size()) {
+      std::size_t batchEnd = batchBegin + 1;
+      Long64_t batchBytes = Long64_t(keys[batchBegin]->GetObjlen()) * sources.size();
+      while (batchEnd < keys.size()) {
+         batchBytes += Long64_t(keys[batchEnd]->GetObjlen()) * sources.size();
+         if (batchBytes > kParallelMergeBatchBytes)
+            break;
+         ++batchEnd;
+      }
+      const auto nKeys = batchEnd - batchBegin;
+
+      // objects[s][k] is the histogram of the k-th key of the batch in the s-th source
+      std::vector<std::vector<TObject *>> objects(sources.size(), std::vector<TObject *>(nKeys, nullptr));
+      ParallelFor(fNThreads, sources.size(), [&](std::size_t s) {
+         TDirectory::TContext ctxt(nullptr);
+         TDirectory *dir = s == 0 ? firstdir : sources[s]->GetDirectory(path);
+         if (!dir)
+            return;
+         for (std::size_t k = 0; k < nKeys; ++k) {
+            TKey *key = keys[batchBegin + k];
+            if (s > 0)
+               key = static_cast<TKey *>(dir->GetListOfKeys()->FindObject(key->GetName()));
+            TObject *obj = key ? key->ReadObj() : nullptr;
+            if (obj)
+               obj->ResetBit(kMustCleanup);
+            objects[s][k] = obj;
+         }
+      });
+
+      std::vector<Long64_t> results(nKeys, 0);
+      ParallelFor(fNThreads, nKeys, [&](std::size_t k) {
+         TObject *obj = objects[0][k];
+         if (!obj)
+            return;
+         TDirectory::TContext ctxt(nullptr);
+         TFileMergeInfo info(target);
+         info.fIOFeatures = fIOFeatures;
+         info.fOptions = fMergeOptions;
+         ROOT::MergeFunc_t func = obj->IsA()->GetMerge();
+         TList inputs;
+         for (std::size_t s = 1; s < sources.size(); ++s) {
+            if (!objects[s][k])
+               continue;
+            inputs.Add(objects[s][k]);
+            if (!fHistoOneGo) {
+               results[k] = std::min(results[k], func(obj, &inputs, &info));
+               info.fIsFirst = kFALSE;
+               inputs.Clear();
+            }
+         }
+         if (fHistoOneGo || info.fIsFirst)
+            results[k] = std::min(results[k], func(obj, &inputs, &info));
+      });
+
+      target->cd();
+      for (std::size_t k = 0; k < nKeys; ++k) {
+         TKey *key = keys[batchBegin + k];
+         const TString keyname = key->GetName();
+         allNames.Add(new TObjString(keyname));
+         for (std::size_t s = 1; s < sources.size(); ++s) {
+            if (!objects[s][k] && sources[s]->GetDirectory(path) &&
+                sources[s]->GetDirectory(path)->GetListOfKeys()->FindObject(keyname))
+               Info("MergeRecursive", "could not read object for key {%s, %s}; skipping file %s", keyname.Data(),
+                    key->GetTitle(), sources[s]->GetName());
+            delete objects[s][k];
+         }
+         TObject *obj = objects[0][k];
+         if (!obj) {
+            Info("MergeRecursive", "could not read object for key {%s, %s}", keyname.Data(), key->GetTitle());
+            continue;
+         }
+         if (results[k] < 0)
+            Error("MergeRecursive", "calling Merge() on '%s' with the corresponding objects of the other sources",
+                  keyname.Data());
+         status = WriteOneAndDelete(keyname, obj->IsA(), obj, kTRUE, kTRUE, target) && status;
+      }
+      batchBegin = batchEnd;
+   }
+   return status;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Merge all objects in a directory
 ///
@@ -843,6 +1020,9 @@ Bool_t TFileMerger::MergeRecursive(TDirectory *target, TList *sourcelist, Int_t
       info.fOptions.Append(" fast");
    }
 
+   if (fNThreads > 1 && !(type & kIncremental) && sourcelist->GetSize() > 1)
+      status = MergeHistogramsInParallel(target, sourcelist, type, path, allNames);
+
    TFile      *current_file;
    TDirectory *current_sourcedir;
    if (type & kIncremental) {
@@ -962,6 +1142,14 @@ Bool_t TFileMerger::PartialMerge(Int_t in_type)
 
    TDirectory::TContext ctxt;
 
+#ifdef R__USE_IMT
+   // Trees that cannot be fast merged are unzipped and compressed again, entry by entry:
+   // implicit multi-threading lets TTree::CopyEntries do that with our threads.
+   const Bool_t enableIMT = fNThreads > 1 && (!fFastMethod || fCompressionChange) && !ROOT::IsImplicitMTEnabled();
+   if (enableIMT)
+      ROOT::EnableImplicitMT(fNThreads);
+#endif
+
    Bool_t result = kTRUE;
    Int_t type = in_type;
    while (result && fFileList.GetEntries()>0) {
@@ -1015,6 +1203,11 @@ Bool_t TFileMerger::PartialMerge(Int_t in_type)
       }
    }
 
+#ifdef R__USE_IMT
+   if (enableIMT)
+      ROOT::DisableImplicitMT();
+#endif
+
    // Cleanup
    if (in_type & kIncremental) {
       Clear();
@@ -1102,6 +1295,20 @@ void TFileMerger::SetMaxOpenedFiles(Int_t newmax)
    }
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Set the number of threads reading and merging the histograms of each
+/// directory, see MergeHistogramsInParallel(). 0 means the number of cores.
+/// Enables the thread safety of ROOT if more than one thread is requested.
+
+void TFileMerger::SetNThreads(UInt_t nThreads)
+{
+   if (nThreads == 0)
+      nThreads = std::max(1u, std::thread::hardware_concurrency());
+   fNThreads = nThreads;
+   if (fNThreads > 1)
+      ROOT::EnableThreadSafety();
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Set the prefix to be used when printing informational message.
 
@@ -10,17 +10,24 @@
  *************************************************************************/
 
 #include "TFilePrefetch.h"
+#include "TEnv.h"
+#include "TROOT.h"
 #include "TTimeStamp.h"
 #include "TSystem.h"
 #include "TMD5.h"
 #include "TVirtualPerfStats.h"
 #include "TVirtualMonitoring.h"
-#include "TSemaphore.h"
 #include "TFPBlock.h"
 #include "strlcpy.h"
 
+#include <algorithm>
+#include <chrono>
+#include <deque>
 #include <string>
 #include <sstream>
+#include <thread>
+#include <unordered_map>
+#include <vector>
 #include <cstdio>
 #include <cstdlib>
 #include <cctype>
@@ -32,6 +39,156 @@ inline int xtod(char c) { return (c>='0' && c<='9') ? c-'0' : ((c>='A' && c<='F'
 
 using namespace std;
 
+namespace {
+
+////////////////////////////////////////////////////////////////////////////////
+/// The prefetch engine shared by all the TFilePrefetch objects of the process.
+///
+/// A fixed pool of I/O threads reads the pending blocks of the prefetchers. The
+/// blocks of one file are read in order by one thread at a time, since a TFile
+/// cannot serve concurrent reads, while different files are read concurrently.
+/// The engine also enforces a global budget on the memory held by the blocks
+/// that were read and a global limit on the bandwidth used for prefetching.
+///
+/// The configuration is taken from the environment:
+///  - TFile.PrefetchThreads: number of I/O threads (default 4)
+///  - TFile.PrefetchMemoryLimit: memory budget in MB (default 256, 0 means no limit)
+///  - TFile.PrefetchBandwidthLimit: bandwidth limit in MB/s (default 0, no limit)
+
+class RPrefetchEngine {
+   enum class EState { kQueued, kRunning, kRequeue, kDeferred };
+
+   std::mutex fMutex;
+   std::condition_variable fWorkAvailable;
+   std::condition_variable fStateChanged;
+   std::deque<TFilePrefetch *> fQueue;
+   /// Prefetchers that are queued, being served or waiting for memory: idle prefetchers are not in the map.
+   std::unordered_map<TFilePrefetch *, EState> fStates;
+   std::vector<std::thread> fWorkers;
+   const unsigned int fNThreads;
+   const Long64_t fMemoryLimit;   ///< In bytes, 0 means no limit.
+   Long64_t fMemoryUsed = 0;
+   const double fBandwidthLimit;  ///< In bytes per second, 0 means no limit.
+   std::mutex fBandwidthMutex;
+   std::chrono::steady_clock::time_point fNextReadTime;
+
+   RPrefetchEngine()
+      : fNThreads(std::max(1, gEnv->GetValue("TFile.PrefetchThreads", 4))),
+        fMemoryLimit(Long64_t(std::max(0, gEnv->GetValue("TFile.PrefetchMemoryLimit", 256))) * 1024 * 1024),
+        fBandwidthLimit(std::max(0., gEnv->GetValue("TFile.PrefetchBandwidthLimit", 0.)) * 1024 * 1024)
+   {
+   }
+
+   /// Must be called with fMutex locked.
+   void Enqueue(TFilePrefetch *prefetch)
+   {
+      fStates[prefetch] = EState::kQueued;
+      fQueue.push_back(prefetch);
+      // the I/O threads are only started when prefetching is actually used
+      if (fWorkers.empty()) {
+         ROOT::EnableThreadSafety();
+         for (unsigned int i = 0; i < fNThreads; ++i)
+            fWorkers.emplace_back(&RPrefetchEngine::Work, this);
+      }
+      fWorkAvailable.notify_one();
+   }
+
+   void Work()
+   {
+      std::unique_lock<std::mutex> lk(fMutex);
+      while (true) {
+         fWorkAvailable.wait(lk, [this] { return !fQueue.empty(); });
+         TFilePrefetch *prefetch = fQueue.front();
+         fQueue.pop_front();
+         fStates[prefetch] = EState::kRunning;
+         lk.unlock();
+         const Bool_t done = prefetch->ReadListOfBlocks();
+         lk.lock();
+         auto &state = fStates[prefetch];
+         if (state == EState::kRequeue)
+            Enqueue(prefetch);
+         else if (!done)
+            state = EState::kDeferred;
+         else
+            fStates.erase(prefetch);
+         fStateChanged.notify_all();
+      }
+   }
+
+public:
+   static RPrefetchEngine &Instance()
+   {
+      // Never destroyed, together with its threads: files can still be closed during the teardown of ROOT at exit.
+      static RPrefetchEngine *engine = new RPrefetchEngine();
+      return *engine;
+   }
+
+   /// Make sure the pending blocks of the prefetcher are going to be read.
+   void Schedule(TFilePrefetch *prefetch)
+   {
+      std::lock_guard<std::mutex> lk(fMutex);
+      auto it = fStates.find(prefetch);
+      if (it == fStates.end() || it->second == EState::kDeferred)
+         Enqueue(prefetch);
+      else if (it->second == EState::kRunning)
+         it->second = EState::kRequeue; // blocks might have been added after the thread looked for them
+   }
+
+   /// Stop serving the prefetcher, waiting for the block that is being read, if any.
+   /// Pending blocks stay in the prefetcher and are read when it is scheduled again.
+   void Cancel(TFilePrefetch *prefetch)
+   {
+      std::unique_lock<std::mutex> lk(fMutex);
+      fStateChanged.wait(lk, [this, prefetch] {
+         auto it = fStates.find(prefetch);
+         return it == fStates.end() || (it->second != EState::kRunning && it->second != EState::kRequeue);
+      });
+      fQueue.erase(std::remove(fQueue.begin(), fQueue.end(), prefetch), fQueue.end());
+      fStates.erase(prefetch);
+   }
+
+   /// Reserve memory for a block about to be read. Forced reservations always succeed: they are needed to make
+   /// progress, e.g. because the reader is waiting for the block.
+   bool AcquireMemory(Long64_t bytes, bool force)
+   {
+      std::lock_guard<std::mutex> lk(fMutex);
+      if (!force && fMemoryLimit > 0 && fMemoryUsed + bytes > fMemoryLimit)
+         return false;
+      fMemoryUsed += bytes;
+      return true;
+   }
+
+   /// Release the memory of blocks that are dropped, and resume the prefetchers deferred for lack of memory.
+   void ReleaseMemory(Long64_t bytes)
+   {
+      if (bytes == 0)
+         return;
+      std::lock_guard<std::mutex> lk(fMutex);
+      fMemoryUsed -= bytes;
+      for (auto &state : fStates) {
+         if (state.second == EState::kDeferred)
+            Enqueue(state.first);
+      }
+   }
+
+   /// Wait until reading `bytes` more bytes does not exceed the bandwidth limit.
+   void Throttle(Long64_t bytes)
+   {
+      if (fBandwidthLimit <= 0.)
+         return;
+      std::chrono::steady_clock::time_point start;
+      {
+         std::lock_guard<std::mutex> lk(fBandwidthMutex);
+         start = std::max(std::chrono::steady_clock::now(), fNextReadTime);
+         fNextReadTime = start + std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                                    std::chrono::duration<double>(bytes / fBandwidthLimit));
+      }
+      std::this_thread::sleep_until(start);
+   }
+};
+
+} // anonymous namespace
+
 ClassImp(TFilePrefetch);
 
 /**
@@ -39,14 +196,18 @@ ClassImp(TFilePrefetch);
 \ingroup IO
 
 The prefetching mechanism uses two classes (TFilePrefetch and
-TFPBlock) to prefetch in advance a block of tree entries. There is
-a thread which takes care of actually transferring the blocks and
-making them available to the main requesting thread. Therefore,
-the time spent by the main thread waiting for the data before
-processing considerably decreases. Besides the prefetching
-mechanisms there is also a local caching option which can be
-enabled by the user. Both capabilities are disabled by default
-and must be explicitly enabled by the user.
+TFPBlock) to prefetch in advance a block of tree entries. A pool of
+I/O threads, shared by all the files of the process, takes care of
+actually transferring the blocks and making them available to the
+main requesting thread. Therefore, the time spent by the main thread
+waiting for the data before processing considerably decreases. The
+blocks of different files are read concurrently, within a global
+memory budget and bandwidth limit (see the TFile.PrefetchThreads,
+TFile.PrefetchMemoryLimit and TFile.PrefetchBandwidthLimit
+environment variables). Besides the prefetching mechanisms there is
+also a local caching option which can be enabled by the user. Both
+capabilities are disabled by default and must be explicitly enabled
+by the user.
 */
 
 
@@ -55,17 +216,15 @@ and must be explicitly enabled by the user.
 
 TFilePrefetch::TFilePrefetch(TFile* file) :
   fFile(file),
-  fConsumer(0),
-  fThreadJoined(kTRUE),
-  fPrefetchFinished(kFALSE)
+  fReadBytes(0),
+  fStarted(kFALSE),
+  fWaitingForBlock(kFALSE)
 {
    fPendingBlocks    = new TList();
    fReadBlocks       = new TList();
 
    fPendingBlocks->SetOwner();
    fReadBlocks->SetOwner();
-
-   fSemChangeFile    = new TSemaphore(0);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -73,32 +232,22 @@ TFilePrefetch::TFilePrefetch(TFile* file) :
 
 TFilePrefetch::~TFilePrefetch()
 {
-   if (!fThreadJoined) {
-     WaitFinishPrefetch();
-   }
+   RPrefetchEngine::Instance().Cancel(this);
+   RPrefetchEngine::Instance().ReleaseMemory(fReadBytes);
 
-   SafeDelete(fConsumer);
    SafeDelete(fPendingBlocks);
    SafeDelete(fReadBlocks);
-   SafeDelete(fSemChangeFile);
 }
 
 
 ////////////////////////////////////////////////////////////////////////////////
-/// Killing the async prefetching thread
+/// Stop the asynchronous prefetching, waiting for the block being read if any.
+///
+/// Blocks that are still pending are read if they are requested later on.
 
 void TFilePrefetch::WaitFinishPrefetch()
 {
-   // Inform the consumer thread that prefetching is over
-   {
-      std::lock_guard<std::mutex> lk(fMutexPendingList);
-      fPrefetchFinished = kTRUE;
-   }
-   fNewBlockAdded.notify_one();
-
-   fConsumer->Join();
-   fThreadJoined = kTRUE;
-   fPrefetchFinished = kFALSE;
+   RPrefetchEngine::Instance().Cancel(this);
 }
 
 
@@ -114,6 +263,7 @@ void TFilePrefetch::ReadAsync(TFPBlock* block, Bool_t &inCache)
       inCache = kTRUE;
    }
    else{
+      RPrefetchEngine::Instance().Throttle(block->GetDataSize());
       fFile->ReadBuffers(block->GetBuffer(), block->GetPos(), block->GetLen(), block->GetNoElem());
       if (fFile->GetArchive()) {
          for (Int_t i = 0; i < block->GetNoElem(); i++)
@@ -125,19 +275,37 @@ void TFilePrefetch::ReadAsync(TFPBlock* block, Bool_t &inCache)
 }
 
 ////////////////////////////////////////////////////////////////////////////////
-/// Get blocks specified in prefetchBlocks.
+/// Get blocks specified in prefetchBlocks. Called by the threads of the
+/// prefetch engine.
+///
+/// Returns false if a block could not be read because of the memory budget:
+/// the block is left pending and the engine resumes reading once memory is
+/// released. A block is always read when the read list is empty or when the
+/// main thread waits for it, so that reading can progress.
 
-void TFilePrefetch::ReadListOfBlocks()
+Bool_t TFilePrefetch::ReadListOfBlocks()
 {
    Bool_t inCache = kFALSE;
    TFPBlock*  block = 0;
 
    while((block = GetPendingBlock())){
+      Bool_t force = fWaitingForBlock;
+      if (!force) {
+         std::lock_guard<std::mutex> lk(fMutexReadList);
+         force = fReadBlocks->GetSize() == 0;
+      }
+      if (!RPrefetchEngine::Instance().AcquireMemory(block->GetDataSize(), force)) {
+         std::lock_guard<std::mutex> lk(fMutexPendingList);
+         fPendingBlocks->AddFirst(block);
+         return kFALSE;
+      }
       ReadAsync(block, inCache);
-      AddReadBlock(block);
+      // save the block before it is made available: afterwards it can be recycled at any time
       if (!inCache)
          SaveBlockInCache(block);
+      AddReadBlock(block);
    }
+   return kTRUE;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -196,11 +364,20 @@ Bool_t TFilePrefetch::ReadBuffer(char* buf, Long64_t offset, Int_t len)
       if (found)
          break;
       else{
+         if (!fWaitingForBlock) {
+            // the block might be pending because of the memory budget, or because prefetching was stopped
+            fWaitingForBlock = kTRUE;
+            lk.unlock();
+            RPrefetchEngine::Instance().Schedule(this);
+            lk.lock();
+            continue;
+         }
          fWaitTime.Start(kFALSE);
          fReadBlockAdded.wait(lk); //wait for a new block to be added
          fWaitTime.Stop();
       }
    }
+   fWaitingForBlock = kFALSE;
 
    if (found){
       char *pBuff = blockObj->GetPtrToPiece(index);
@@ -228,26 +405,20 @@ void TFilePrefetch::AddPendingBlock(TFPBlock* block)
    fPendingBlocks->Add(block);
    fMutexPendingList.unlock();
 
-   fNewBlockAdded.notify_one();
+   if (fStarted)
+      RPrefetchEngine::Instance().Schedule(this);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 /// Safe method to remove a block from the pendingList.
+///
+/// Returns a null pointer if there are no pending blocks.
 
 TFPBlock* TFilePrefetch::GetPendingBlock()
 {
    TFPBlock* block = 0;
 
-   // Use the semaphore to deal with the case when the file pointer
-   // is changed on the fly by TChain
-   fSemChangeFile->Post();
-   std::unique_lock<std::mutex> lk(fMutexPendingList);
-   // Wait unless there is a pending block or prefetching is over
-   fNewBlockAdded.wait(lk, [&]{ return fPendingBlocks->GetSize() > 0 || fPrefetchFinished; });
-   lk.unlock();
-   fSemChangeFile->Wait();
-
-   lk.lock();
+   std::lock_guard<std::mutex> lk(fMutexPendingList);
    if (fPendingBlocks->GetSize()){
       block = (TFPBlock*)fPendingBlocks->First();
       block = (TFPBlock*)fPendingBlocks->Remove(block);
@@ -260,20 +431,25 @@ TFPBlock* TFilePrefetch::GetPendingBlock()
 
 void TFilePrefetch::AddReadBlock(TFPBlock* block)
 {
+   Long64_t released = 0;
    fMutexReadList.lock();
 
    if (fReadBlocks->GetSize() >= kMAX_READ_SIZE){
       TFPBlock* movedBlock = (TFPBlock*) fReadBlocks->First();
       movedBlock = (TFPBlock*)fReadBlocks->Remove(movedBlock);
+      released = movedBlock->GetDataSize();
+      fReadBytes -= released;
       delete movedBlock;
       movedBlock = 0;
    }
 
    fReadBlocks->Add(block);
+   fReadBytes += block->GetDataSize();
    fMutexReadList.unlock();
 
    //signal the addition of a new block
    fReadBlockAdded.notify_one();
+   RPrefetchEngine::Instance().ReleaseMemory(released);
 }
 
 
@@ -289,7 +465,10 @@ TFPBlock* TFilePrefetch::CreateBlockObj(Long64_t* offset, Int_t* len, Int_t nobl
    if (fReadBlocks->GetSize() >= kMAX_READ_SIZE){
       blockObj = static_cast<TFPBlock*>(fReadBlocks->First());
       fReadBlocks->Remove(blockObj);
+      const Long64_t released = blockObj->GetDataSize();
+      fReadBytes -= released;
       fMutexReadList.unlock();
+      RPrefetchEngine::Instance().ReleaseMemory(released);
       blockObj->ReallocBlock(offset, len, noblock);
    }
    else{
@@ -299,29 +478,19 @@ TFPBlock* TFilePrefetch::CreateBlockObj(Long64_t* offset, Int_t* len, Int_t nobl
    return blockObj;
 }
 
-////////////////////////////////////////////////////////////////////////////////
-/// Return reference to the consumer thread.
-
-TThread* TFilePrefetch::GetThread() const
-{
-   return fConsumer;
-}
-
 
 ////////////////////////////////////////////////////////////////////////////////
 /// Change the file
 ///
 /// When prefetching is enabled we also need to:
-///  - make sure the async thread is not doing any work
+///  - make sure the prefetch engine is not doing any work for this file
 ///  - clear all blocks from prefetching and read list
 ///  - reset the file pointer
 
 void TFilePrefetch::SetFile(TFile *file, TFile::ECacheAction action)
 {
    if (action == TFile::kDisconnect) {
-      if (!fThreadJoined) {
-        fSemChangeFile->Wait();
-      }
+      RPrefetchEngine::Instance().Cancel(this);
 
       if (fFile) {
         // Remove all pending and read blocks
@@ -331,13 +500,13 @@ void TFilePrefetch::SetFile(TFile *file, TFile::ECacheAction action)
 
         fMutexReadList.lock();
         fReadBlocks->Clear();
+        const Long64_t released = fReadBytes;
+        fReadBytes = 0;
         fMutexReadList.unlock();
+        RPrefetchEngine::Instance().ReleaseMemory(released);
       }
 
       fFile = file;
-      if (!fThreadJoined) {
-        fSemChangeFile->Post();
-      }
    } else {
       // kDoNotDisconnect must reconnect to the same file
       assert((fFile == file) && "kDoNotDisconnect must reattach to the same file");
@@ -346,33 +515,20 @@ void TFilePrefetch::SetFile(TFile *file, TFile::ECacheAction action)
 
 
 ////////////////////////////////////////////////////////////////////////////////
-/// Used to start the consumer thread.
+/// Start prefetching: from now on, pending blocks are read by the threads of
+/// the prefetch engine shared by all files. Returns 0 on success.
 
 Int_t TFilePrefetch::ThreadStart()
 {
-   int rc;
-
-   fConsumer = new TThread((TThread::VoidRtnFunc_t) ThreadProc, (void*) this);
-   rc = fConsumer->Run();
-   if ( !rc ) {
-      fThreadJoined = kFALSE;
-   }
-   return rc;
-}
-
-
-////////////////////////////////////////////////////////////////////////////////
-/// Execution loop of the consumer thread.
-
-TThread::VoidRtnFunc_t TFilePrefetch::ThreadProc(void* arg)
-{
-   TFilePrefetch* pClass = (TFilePrefetch*) arg;
-
-   while (!pClass->IsPrefetchFinished()) {
-      pClass->ReadListOfBlocks();
+   fStarted = kTRUE;
+   Bool_t hasPending;
+   {
+      std::lock_guard<std::mutex> lk(fMutexPendingList);
+      hasPending = fPendingBlocks->GetSize() > 0;
    }
-
-   return (TThread::VoidRtnFunc_t) 1;
+   if (hasPending)
+      RPrefetchEngine::Instance().Schedule(this);
+   return 0;
 }
 
 //############################# CACHING PART ###################################
@@ -23,15 +23,49 @@ size(), clear(), resize(). resize() may be a void operation.
 **/
 
 #include "TGenCollectionStreamer.h"
+#include "Bytes.h"
+#include "TBufferFile.h"
 #include "TClassEdit.h"
 #include "TError.h"
 #include "TROOT.h"
+#include "TSchemaRuleSet.h"
 #include "TStreamerInfo.h"
 #include "TStreamerElement.h"
 #include "TVirtualCollectionIterators.h"
+#include "TVirtualMutex.h"
 
+#include <cstring>
 #include <memory>
 
+namespace {
+
+/// Or-ed to the byte count that precedes every object in the buffer, see TBufferFile::SetByteCount()
+constexpr UInt_t kByteCountMask = 0x40000000;
+
+/// Copy n values of type T from the object to the buffer, in big endian
+template <typename T>
+void WriteSwapped(char *&buf, const char *src, Int_t n)
+{
+   for (Int_t i = 0; i < n; ++i) {
+      T value;
+      memcpy(&value, src + i * sizeof(T), sizeof(T));
+      tobuf(buf, value);
+   }
+}
+
+/// Copy n values of type T from the buffer, in big endian, to the object
+template <typename T>
+void ReadSwapped(char *&buf, char *dest, Int_t n)
+{
+   for (Int_t i = 0; i < n; ++i) {
+      T value;
+      frombuf(buf, &value);
+      memcpy(dest + i * sizeof(T), &value, sizeof(T));
+   }
+}
+
+} // anonymous namespace
+
 TGenCollectionStreamer::TGenCollectionStreamer(const TGenCollectionStreamer& copy)
       : TGenCollectionProxy(copy), fReadBufferFunc(&TGenCollectionStreamer::ReadBufferDefault)
 {
@@ -363,6 +397,163 @@ void TGenCollectionStreamer::ReadPrimitives(int nElements, TBuffer &b, const TCl
    }
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Return true if the objects of the value class can be copied from and to the buffer without their streamer.
+///
+/// This is the case if the value class is streamed object-wise by its StreamerInfo, without schema evolution rules,
+/// and if all its persistent data members are fundamental types (or fixed-size arrays thereof) whose size is the
+/// same in memory and in the buffer. Each object then occupies a fixed-size record in the buffer: the byte count,
+/// the version and the data members in big endian. Only TBufferFile uses this binary format.
+
+Bool_t TGenCollectionStreamer::HasTrivialValueLayout(TBuffer &b)
+{
+   Int_t state = fTrivialState.load(std::memory_order_acquire);
+   if (state < 0 || !dynamic_cast<TBufferFile *>(&b))
+      return kFALSE;
+   if (state > 0)
+      return kTRUE;
+
+   TClass *cl = fVal->fType;
+   TVirtualStreamerInfo *info = cl ? cl->GetCurrentStreamerInfo() : nullptr;
+   if (!info || !info->IsCompiled())
+      return kFALSE; // decide once the regular streaming has built the StreamerInfo
+
+   R__LOCKGUARD(gInterpreterMutex);
+   state = fTrivialState.load();
+   if (state != 0)
+      return state > 0;
+
+   const ROOT::Detail::TSchemaRuleSet *rules = cl->GetSchemaRules();
+   Bool_t isTrivial = cl->IsLoaded() && !cl->IsTObject() && !cl->GetCollectionProxy() && !cl->GetStreamer() &&
+                      !cl->GetStreamerFunc() && !cl->GetConvStreamerFunc() &&
+                      !cl->TestBit(TClass::kHasCustomStreamerMember) &&
+                      (!rules || !rules->GetRules() || rules->GetRules()->GetEntriesFast() == 0);
+   fTrivialRuns.clear();
+   fTrivialPayload = 0;
+   TIter next(info->GetElements());
+   while (isTrivial) {
+      auto element = static_cast<TStreamerElement *>(next());
+      if (!element)
+         break;
+      Int_t type = element->GetType();
+      if (type > TVirtualStreamerInfo::kOffsetL && type < TVirtualStreamerInfo::kOffsetP)
+         type -= TVirtualStreamerInfo::kOffsetL;
+      switch (type) {
+      case TVirtualStreamerInfo::kChar:
+      case TVirtualStreamerInfo::kUChar:
+      case TVirtualStreamerInfo::kBool:
+      case TVirtualStreamerInfo::kShort:
+      case TVirtualStreamerInfo::kUShort:
+      case TVirtualStreamerInfo::kInt:
+      case TVirtualStreamerInfo::kUInt:
+      case TVirtualStreamerInfo::kFloat:
+      case TVirtualStreamerInfo::kLong64:
+      case TVirtualStreamerInfo::kULong64:
+      case TVirtualStreamerInfo::kDouble: break;
+      default: isTrivial = kFALSE; continue;
+      }
+      const Int_t count = std::max(1, element->GetArrayLength());
+      const Int_t typeSize = element->GetSize() / count;
+      const Int_t offset = element->GetOffset();
+      if (!fTrivialRuns.empty() && fTrivialRuns.back().fTypeSize == typeSize &&
+          fTrivialRuns.back().fOffset + fTrivialRuns.back().fTypeSize * fTrivialRuns.back().fCount == offset) {
+         fTrivialRuns.back().fCount += count;
+      } else {
+         fTrivialRuns.push_back({offset, typeSize, count});
+      }
+      fTrivialPayload += element->GetSize();
+   }
+   isTrivial = isTrivial && !fTrivialRuns.empty();
+   fTrivialState.store(isTrivial ? 1 : -1, std::memory_order_release);
+   return isTrivial;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Fill the header that precedes every object of the value class in the buffer, as written by
+/// TBufferFile::WriteVersion() and TBufferFile::SetByteCount(). Returns the length of the header.
+
+Int_t TGenCollectionStreamer::FillTrivialHeader(char *header) const
+{
+   TClass *cl = fVal->fType;
+   char *buf = header;
+   if (cl->IsVersioned()) {
+      tobuf(buf, UInt_t((sizeof(Version_t) + fTrivialPayload) | kByteCountMask));
+      tobuf(buf, Version_t(cl->GetClassVersion()));
+   } else {
+      tobuf(buf, UInt_t((sizeof(Version_t) + sizeof(UInt_t) + fTrivialPayload) | kByteCountMask));
+      tobuf(buf, Version_t(0));
+      tobuf(buf, cl->GetCheckSum());
+   }
+   return buf - header;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Read the objects of a vector whose value class has a trivial layout, see HasTrivialValueLayout().
+/// Stops at the first object that was not written with the current layout of the value class, e.g. because
+/// it was written with another class version. Returns the number of objects read.
+
+Int_t TGenCollectionStreamer::ReadTrivialObjects(int nElements, TBuffer &b, char *first)
+{
+   char header[12];
+   const Int_t headerLen = FillTrivialHeader(header);
+   const Int_t recordLen = headerLen + fTrivialPayload;
+   char *buf = b.Buffer() + b.Length();
+   const char *end = b.Buffer() + b.BufferSize();
+   int idx = 0;
+   for (; idx < nElements; ++idx) {
+      if (end - buf < recordLen || memcmp(buf, header, headerLen) != 0)
+         break;
+      buf += headerLen;
+      char *obj = first + fValDiff * idx;
+      for (const auto &run : fTrivialRuns) {
+         char *dest = obj + run.fOffset;
+         switch (run.fTypeSize) {
+         case 1: memcpy(dest, buf, run.fCount); buf += run.fCount; break;
+         case 2: ReadSwapped<UShort_t>(buf, dest, run.fCount); break;
+         case 4: ReadSwapped<UInt_t>(buf, dest, run.fCount); break;
+         case 8: ReadSwapped<ULong64_t>(buf, dest, run.fCount); break;
+         }
+      }
+   }
+   b.SetBufferOffset(buf - b.Buffer());
+   return idx;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Write the objects of a vector whose value class has a trivial layout, see HasTrivialValueLayout(),
+/// with the same result as streaming them one by one. Returns false, without writing anything, if the objects
+/// do not fit in the buffer.
+
+Bool_t TGenCollectionStreamer::WriteTrivialObjects(int nElements, TBuffer &b, const char *first)
+{
+   char header[12];
+   const Int_t headerLen = FillTrivialHeader(header);
+   const Int_t recordLen = headerLen + fTrivialPayload;
+   const Long64_t length = b.Length() + Long64_t(recordLen) * nElements;
+   if (length > kMaxInt)
+      return kFALSE;
+   b.TagStreamerInfo(fVal->fType->GetCurrentStreamerInfo());
+   if (length > b.BufferSize())
+      b.AutoExpand(length);
+   char *buf = b.Buffer() + b.Length();
+   for (int idx = 0; idx < nElements; ++idx) {
+      memcpy(buf, header, headerLen);
+      buf += headerLen;
+      const char *obj = first + fValDiff * idx;
+      for (const auto &run : fTrivialRuns) {
+         const char *src = obj + run.fOffset;
+         switch (run.fTypeSize) {
+         case 1: memcpy(buf, src, run.fCount); buf += run.fCount; break;
+         case 2: WriteSwapped<UShort_t>(buf, src, run.fCount); break;
+         case 4: WriteSwapped<UInt_t>(buf, src, run.fCount); break;
+         case 8: WriteSwapped<ULong64_t>(buf, src, run.fCount); break;
+         }
+      }
+   }
+   b.SetBufferOffset(buf - b.Buffer());
+   return kTRUE;
+}
+
 void TGenCollectionStreamer::ReadObjects(int nElements, TBuffer &b, const TClass *onFileClass)
 {
    // Object input streamer.
@@ -388,6 +579,12 @@ void TGenCollectionStreamer::ReadObjects(int nElements, TBuffer &b, const TClass
          fEnv->fStart = itm;
          switch (fVal->fCase) {
             case kIsClass:
+               if (!onFileValClass && HasTrivialValueLayout(b)) {
+                  int idx = ReadTrivialObjects(nElements, b, (char*)itm);
+                  for (; idx < nElements; ++idx)
+                     b.StreamObject(((char*)itm) + fValDiff*idx, fVal->fType);
+                  break;
+               }
                DOLOOP(b.StreamObject(i, fVal->fType, onFileValClass ));
             case kBIT_ISSTRING:
                DOLOOP(i->read_std_string(b));
@@ -973,6 +1170,8 @@ void TGenCollectionStreamer::WriteObjects(int nElements, TBuffer &b)
          itm = (StreamHelper*)fFirst.invoke(fEnv);
          switch (fVal->fCase) {
             case kIsClass:
+               if (HasTrivialValueLayout(b) && WriteTrivialObjects(nElements, b, (const char*)itm))
+                  break;
                DOLOOP(b.StreamObject(i, fVal->fType));
                break;
             case kBIT_ISSTRING:
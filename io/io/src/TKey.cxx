@@ -47,14 +47,18 @@
  See also TTree.
 */
 
+#include <algorithm>
 #include <atomic>
 #include <iostream>
+#include <thread>
+#include <vector>
 
 #include "TROOT.h"
 #include "TClass.h"
 #include "TDirectoryFile.h"
 #include "TFile.h"
 #include "TKey.h"
+#include "TKeyCompressor.h"
 #include "TBufferFile.h"
 #include "TFree.h"
 #include "TBrowser.h"
@@ -82,6 +86,89 @@ const UChar_t kPidOffsetShift = 48;
 const static TString gTDirectoryString("TDirectory");
 std::atomic<UInt_t> keyAbsNumber{0};
 
+namespace {
+
+/// Whether the nblocks compressed blocks of an object are (un)compressed in parallel: only for objects larger than
+/// kMAXZIPBUF and with implicit multi-threading.
+bool IsParallelZip(Long64_t nblocks)
+{
+   return nblocks > 1 && ROOT::IsImplicitMTEnabled() && ROOT::GetThreadPoolSize() > 1;
+}
+
+/// Calls work(i) for i in [0, n) on the calling thread and on as many other threads as the implicit multi-threading
+/// pool has. The Imt library depends on RIO, so plain threads are used, like in TKeyCompressor.
+template <typename F>
+void ForEachBlock(std::size_t n, F &&work)
+{
+   const auto nThreads = std::min<std::size_t>(std::max(1u, ROOT::GetThreadPoolSize()), n);
+   std::atomic<std::size_t> next{0};
+   auto run = [&]() {
+      for (auto i = next++; i < n; i = next++)
+         work(i);
+   };
+   std::vector<std::thread> threads;
+   for (std::size_t i = 1; i < nThreads; ++i)
+      threads.emplace_back(run);
+   run();
+   for (auto &thread : threads)
+      thread.join();
+}
+
+/// Uncompress the object of a key, stored as a sequence of compressed blocks at src, into tgt, which has room for
+/// objlen bytes. Returns the uncompressed size of the last block, or 0 in case of error.
+///
+/// The blocks are independent, so the blocks of objects larger than kMAXZIPBUF are uncompressed in parallel with
+/// implicit multi-threading, once their position is known from the block headers.
+Int_t UnzipObject(UChar_t *src, char *tgt, Int_t objlen)
+{
+   Int_t nin, nbuf, nout = 0;
+   Int_t noutot = 0;
+   if (IsParallelZip(1 + (objlen - 1) / kMAXZIPBUF)) {
+      struct RBlock {
+         UChar_t *fSrc;
+         char *fTgt;
+         Int_t fNin;
+         Int_t fNbuf;
+         Int_t fNout;
+      };
+      std::vector<RBlock> blocks;
+      while (noutot < objlen && R__unzip_header(&nin, src, &nbuf) == 0) {
+         if (nbuf <= 0 || nbuf > objlen - noutot)
+            return 0;
+         blocks.push_back({src, tgt + noutot, nin, nbuf, 0});
+         noutot += nbuf;
+         src += nin;
+      }
+      if (blocks.empty())
+         return 0;
+      ForEachBlock(blocks.size(), [&blocks](std::size_t i) {
+         auto &block = blocks[i];
+         Int_t srcsize = block.fNin;
+         Int_t tgtsize = block.fNbuf;
+         R__unzip(&srcsize, block.fSrc, &tgtsize, (unsigned char *)block.fTgt, &block.fNout);
+      });
+      for (const auto &block : blocks) {
+         if (block.fNout != block.fNbuf)
+            return 0;
+      }
+      return blocks.back().fNout;
+   }
+
+   while (1) {
+      Int_t hc = R__unzip_header(&nin, src, &nbuf);
+      if (hc!=0) break;
+      R__unzip(&nin, src, &nbuf, (unsigned char*) tgt, &nout);
+      if (!nout) break;
+      noutot += nout;
+      if (noutot >= objlen) break;
+      src += nin;
+      tgt += nout;
+   }
+   return nout;
+}
+
+} // anonymous namespace
+
 ClassImp(TKey);
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -238,7 +325,7 @@ TKey::TKey(const TObject *obj, const char *name, Int_t bufsize, TDirectory* moth
 
    Build(motherDir, obj->ClassName(), -1);
 
-   Int_t lbuf, nout, noutot, bufmax, nzip;
+   Int_t lbuf;
    fBufferRef = new TBufferFile(TBuffer::kWrite, bufsize);
    fBufferRef->SetParent(GetFile());
    fCycle     = fMotherDir->AppendKey(this);
@@ -251,41 +338,15 @@ TKey::TKey(const TObject *obj, const char *name, Int_t bufsize, TDirectory* moth
    fObjlen    = lbuf - fKeylen;
 
    Int_t cxlevel = GetFile() ? GetFile()->GetCompressionLevel() : 0;
-   ROOT::RCompressionSetting::EAlgorithm::EValues cxAlgorithm = static_cast<ROOT::RCompressionSetting::EAlgorithm::EValues>(GetFile() ? GetFile()->GetCompressionAlgorithm() : 0);
    if (cxlevel > 0 && fObjlen > 256) {
-      Int_t nbuffers = 1 + (fObjlen - 1)/kMAXZIPBUF;
-      Int_t buflen = TMath::Max(512,fKeylen + fObjlen + 9*nbuffers + 28); //add 28 bytes in case object is placed in a deleted gap
-      fBuffer = new char[buflen];
-      char *objbuf = fBufferRef->Buffer() + fKeylen;
-      char *bufcur = &fBuffer[fKeylen];
-      noutot = 0;
-      nzip   = 0;
-      for (Int_t i = 0; i < nbuffers; ++i) {
-         if (i == nbuffers - 1) bufmax = fObjlen - nzip;
-         else               bufmax = kMAXZIPBUF;
-         R__zipMultipleAlgorithm(cxlevel, &bufmax, objbuf, &bufmax, bufcur, &nout, cxAlgorithm);
-         if (nout == 0 || nout >= fObjlen) { //this happens when the buffer cannot be compressed
-            fBuffer = fBufferRef->Buffer();
-            Create(fObjlen);
-            fBufferRef->SetBufferOffset(0);
-            Streamer(*fBufferRef);         //write key itself again
-            return;
-         }
-         bufcur += nout;
-         noutot += nout;
-         objbuf += kMAXZIPBUF;
-         nzip   += kMAXZIPBUF;
+      if (auto compressor = GetFile()->fKeyCompressor) {
+         // Compressed in parallel with the other objects written by TDirectoryFile::Write()
+         compressor->Add(this);
+         return;
       }
-      Create(noutot);
-      fBufferRef->SetBufferOffset(0);
-      Streamer(*fBufferRef);         //write key itself again
-      memcpy(fBuffer,fBufferRef->Buffer(),fKeylen);
-      delete fBufferRef; fBufferRef = 0;
+      CreateWithBuffer(ZipObject(cxlevel, GetFile()->GetCompressionAlgorithm()));
    } else {
-      fBuffer = fBufferRef->Buffer();
-      Create(fObjlen);
-      fBufferRef->SetBufferOffset(0);
-      Streamer(*fBufferRef);         //write key itself again
+      CreateWithBuffer(0);
    }
 }
 
@@ -334,7 +395,7 @@ TKey::TKey(const void *obj, const TClass *cl, const char *name, Int_t bufsize, T
    Streamer(*fBufferRef);         //write key itself
    fKeylen    = fBufferRef->Length();
 
-   Int_t lbuf, nout, noutot, bufmax, nzip;
+   Int_t lbuf;
 
    fBufferRef->MapObject(actualStart,clActual);         //register obj in map in case of self reference
    clActual->Streamer((void*)actualStart, *fBufferRef); //write object
@@ -342,32 +403,88 @@ TKey::TKey(const void *obj, const TClass *cl, const char *name, Int_t bufsize, T
    fObjlen    = lbuf - fKeylen;
 
    Int_t cxlevel = GetFile() ? GetFile()->GetCompressionLevel() : 0;
-   ROOT::RCompressionSetting::EAlgorithm::EValues cxAlgorithm = static_cast<ROOT::RCompressionSetting::EAlgorithm::EValues>(GetFile() ? GetFile()->GetCompressionAlgorithm() : 0);
    if (cxlevel > 0 && fObjlen > 256) {
-      Int_t nbuffers = 1 + (fObjlen - 1)/kMAXZIPBUF;
-      Int_t buflen = TMath::Max(512,fKeylen + fObjlen + 9*nbuffers + 28); //add 28 bytes in case object is placed in a deleted gap
-      fBuffer = new char[buflen];
-      char *objbuf = fBufferRef->Buffer() + fKeylen;
-      char *bufcur = &fBuffer[fKeylen];
-      noutot = 0;
-      nzip   = 0;
+      if (auto compressor = GetFile()->fKeyCompressor) {
+         // Compressed in parallel with the other objects written by TDirectoryFile::Write()
+         compressor->Add(this);
+         return;
+      }
+      CreateWithBuffer(ZipObject(cxlevel, GetFile()->GetCompressionAlgorithm()));
+   } else {
+      CreateWithBuffer(0);
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Compress the object streamed after the key header in fBufferRef into fBuffer, leaving room for the key header.
+/// Returns the number of bytes of the compressed object, or 0 if the object cannot be compressed.
+///
+/// Only accesses the buffers of this key, so that the keys of different objects can be compressed in parallel.
+/// If parallel is true and implicit multi-threading is enabled, the kMAXZIPBUF blocks of objects larger than one
+/// block are compressed in parallel.
+
+Int_t TKey::ZipObject(Int_t cxlevel, Int_t cxAlgorithm, Bool_t parallel)
+{
+   Int_t nout, bufmax;
+   Int_t nbuffers = 1 + (fObjlen - 1)/kMAXZIPBUF;
+   Int_t buflen = TMath::Max(512,fKeylen + fObjlen + 9*nbuffers + 28); //add 28 bytes in case object is placed in a deleted gap
+   fBuffer = new char[buflen];
+   char *objbuf = fBufferRef->Buffer() + fKeylen;
+
+   if (parallel && IsParallelZip(nbuffers)) {
+      // Every block is compressed at the offset of its uncompressed data, where it fits because a compressed block
+      // larger than its input is an error; then the blocks are moved next to each other. The result is the same as
+      // the one of the sequential compression below.
+      std::vector<Int_t> nouts(nbuffers, 0);
+      ForEachBlock(nbuffers, [&](std::size_t i) {
+         const Long64_t offset = Long64_t(i) * kMAXZIPBUF;
+         Int_t srcsize = (i == std::size_t(nbuffers - 1)) ? Int_t(fObjlen - offset) : Int_t(kMAXZIPBUF);
+         Int_t tgtsize = srcsize;
+         R__zipMultipleAlgorithm(cxlevel, &srcsize, objbuf + offset, &tgtsize, &fBuffer[fKeylen + offset], &nouts[i],
+                                 static_cast<ROOT::RCompressionSetting::EAlgorithm::EValues>(cxAlgorithm));
+      });
+      Int_t noutot = 0;
       for (Int_t i = 0; i < nbuffers; ++i) {
-         if (i == nbuffers - 1) bufmax = fObjlen - nzip;
-         else               bufmax = kMAXZIPBUF;
-         R__zipMultipleAlgorithm(cxlevel, &bufmax, objbuf, &bufmax, bufcur, &nout, cxAlgorithm);
-         if (nout == 0 || nout >= fObjlen) { //this happens when the buffer cannot be compressed
-            fBuffer = fBufferRef->Buffer();
-            Create(fObjlen);
-            fBufferRef->SetBufferOffset(0);
-            Streamer(*fBufferRef);         //write key itself again
-            return;
+         if (nouts[i] == 0 || nouts[i] >= fObjlen) {
+            delete [] fBuffer;
+            fBuffer = nullptr;
+            return 0;
          }
-         bufcur += nout;
-         noutot += nout;
-         objbuf += kMAXZIPBUF;
-         nzip   += kMAXZIPBUF;
+         memmove(&fBuffer[fKeylen + noutot], &fBuffer[fKeylen + Long64_t(i) * kMAXZIPBUF], nouts[i]);
+         noutot += nouts[i];
       }
-      Create(noutot);
+      return noutot;
+   }
+
+   char *bufcur = &fBuffer[fKeylen];
+   Int_t noutot = 0;
+   Int_t nzip   = 0;
+   for (Int_t i = 0; i < nbuffers; ++i) {
+      if (i == nbuffers - 1) bufmax = fObjlen - nzip;
+      else               bufmax = kMAXZIPBUF;
+      R__zipMultipleAlgorithm(cxlevel, &bufmax, objbuf, &bufmax, bufcur, &nout,
+                              static_cast<ROOT::RCompressionSetting::EAlgorithm::EValues>(cxAlgorithm));
+      if (nout == 0 || nout >= fObjlen) { //this happens when the buffer cannot be compressed
+         delete [] fBuffer;
+         fBuffer = nullptr;
+         return 0;
+      }
+      bufcur += nout;
+      noutot += nout;
+      objbuf += kMAXZIPBUF;
+      nzip   += kMAXZIPBUF;
+   }
+   return noutot;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Allocate the space of the key in the file and write the key header, for an object compressed into fBuffer by
+/// ZipObject() to nzip bytes, or for the uncompressed object in fBufferRef if nzip is 0.
+
+void TKey::CreateWithBuffer(Int_t nzip)
+{
+   if (nzip > 0) {
+      Create(nzip);
       fBufferRef->SetBufferOffset(0);
       Streamer(*fBufferRef);         //write key itself again
       memcpy(fBuffer,fBufferRef->Buffer(),fKeylen);
@@ -519,6 +636,20 @@ void TKey::Create(Int_t nbytes, TFile* externFile)
    fSeekPdir = externFile ? externFile->GetSeekDir() : fMotherDir->GetSeekDir();
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Operator delete, sized to return the memory to the size class of the object
+/// pool it was allocated from (see TStorage::ObjectPoolAlloc()). As the sized
+/// operator delete is the only usual one of TKey, it is also used for the
+/// classes deriving from TKey, with the size of the most derived object.
+
+void TKey::operator delete(void *ptr, size_t sz)
+{
+   if ((Longptr_t) ptr != TObject::GetDtorOnly())
+      TStorage::ObjectPoolDealloc(ptr, sz);
+   else
+      TObject::SetDtorOnly(nullptr);
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// TKey default destructor.
 
@@ -823,20 +954,7 @@ TObject *TKey::ReadObj()
       bufferRef.MapObject(pobj,cl);  //register obj in map to handle self reference
 
    if (fObjlen > fNbytes-fKeylen) {
-      char *objbuf = bufferRef.Buffer() + fKeylen;
-      UChar_t *bufcur = (UChar_t *)&compressedBuffer[fKeylen];
-      Int_t nin, nout = 0, nbuf;
-      Int_t noutot = 0;
-      while (1) {
-         Int_t hc = R__unzip_header(&nin, bufcur, &nbuf);
-         if (hc!=0) break;
-         R__unzip(&nin, bufcur, &nbuf, (unsigned char*) objbuf, &nout);
-         if (!nout) break;
-         noutot += nout;
-         if (noutot >= fObjlen) break;
-         bufcur += nin;
-         objbuf += nout;
-      }
+      Int_t nout = UnzipObject((UChar_t *)&compressedBuffer[fKeylen], bufferRef.Buffer() + fKeylen, fObjlen);
       compressedBuffer.reset(nullptr);
       if (nout) {
          tobj->Streamer(bufferRef); //does not work with example 2 above
@@ -948,20 +1066,7 @@ TObject *TKey::ReadObjWithBuffer(char *bufferRead)
       bufferRef.MapObject(pobj,cl);  //register obj in map to handle self reference
 
    if (fObjlen > fNbytes-fKeylen) {
-      char *objbuf = bufferRef.Buffer() + fKeylen;
-      UChar_t *bufcur = (UChar_t *)&bufferRead[fKeylen];
-      Int_t nin, nout = 0, nbuf;
-      Int_t noutot = 0;
-      while (1) {
-         Int_t hc = R__unzip_header(&nin, bufcur, &nbuf);
-         if (hc!=0) break;
-         R__unzip(&nin, bufcur, &nbuf, (unsigned char*) objbuf, &nout);
-         if (!nout) break;
-         noutot += nout;
-         if (noutot >= fObjlen) break;
-         bufcur += nin;
-         objbuf += nout;
-      }
+      Int_t nout = UnzipObject((UChar_t *)&bufferRead[fKeylen], bufferRef.Buffer() + fKeylen, fObjlen);
       if (nout) {
          tobj->Streamer(bufferRef); //does not work with example 2 above
       } else {
@@ -1092,20 +1197,7 @@ void *TKey::ReadObjectAny(const TClass* expectedClass)
       bufferRef.MapObject(pobj,cl);  //register obj in map to handle self reference
 
    if (fObjlen > fNbytes-fKeylen) {
-      char *objbuf = bufferRef.Buffer() + fKeylen;
-      UChar_t *bufcur = (UChar_t *)&compressedBuffer[fKeylen];
-      Int_t nin, nout = 0, nbuf;
-      Int_t noutot = 0;
-      while (1) {
-         Int_t hc = R__unzip_header(&nin, bufcur, &nbuf);
-         if (hc!=0) break;
-         R__unzip(&nin, bufcur, &nbuf, (unsigned char*) objbuf, &nout);
-         if (!nout) break;
-         noutot += nout;
-         if (noutot >= fObjlen) break;
-         bufcur += nin;
-         objbuf += nout;
-      }
+      Int_t nout = UnzipObject((UChar_t *)&compressedBuffer[fKeylen], bufferRef.Buffer() + fKeylen, fObjlen);
       if (nout) {
          cl->Streamer((void*)pobj, bufferRef, clOnfile);    //read object
       } else {
@@ -1180,20 +1272,7 @@ Int_t TKey::Read(TObject *obj)
 
    bufferRef.SetBufferOffset(fKeylen);
    if (fObjlen > fNbytes-fKeylen) {
-      char *objbuf = bufferRef.Buffer() + fKeylen;
-      UChar_t *bufcur = (UChar_t *)&compressedBuffer[fKeylen];
-      Int_t nin, nout = 0, nbuf;
-      Int_t noutot = 0;
-      while (1) {
-         Int_t hc = R__unzip_header(&nin, bufcur, &nbuf);
-         if (hc!=0) break;
-         R__unzip(&nin, bufcur, &nbuf, (unsigned char*) objbuf, &nout);
-         if (!nout) break;
-         noutot += nout;
-         if (noutot >= fObjlen) break;
-         bufcur += nin;
-         objbuf += nout;
-      }
+      Int_t nout = UnzipObject((UChar_t *)&compressedBuffer[fKeylen], bufferRef.Buffer() + fKeylen, fObjlen);
       if (nout) obj->Streamer(bufferRef);
    } else {
       obj->Streamer(bufferRef);
@@ -0,0 +1,95 @@
+// @(#)root/io:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include "TKeyCompressor.h"
+
+#include "TFile.h"
+#include "TKey.h"
+#include "TList.h"
+#include "TROOT.h"
+
+#include <algorithm>
+#include <atomic>
+#include <thread>
+
+namespace ROOT {
+namespace Internal {
+
+TKeyCompressor::TKeyCompressor(TFile &file) : fFile(file)
+{
+   R__ASSERT(!fFile.fKeyCompressor);
+   fFile.fKeyCompressor = this;
+}
+
+TKeyCompressor::~TKeyCompressor()
+{
+   Finish();
+   fFile.fKeyCompressor = nullptr;
+}
+
+void TKeyCompressor::Add(TKey *key)
+{
+   fPending.emplace_back(key);
+   fPendingBytes += key->GetObjlen();
+}
+
+Bool_t TKeyCompressor::IsPending(const TKey *key) const
+{
+   return std::find(fPending.rbegin(), fPending.rend(), key) != fPending.rend();
+}
+
+Int_t TKeyCompressor::Finish()
+{
+   if (fPending.empty())
+      return 0;
+
+   const Int_t cxlevel = fFile.GetCompressionLevel();
+   const Int_t cxAlgorithm = fFile.GetCompressionAlgorithm();
+   std::vector<Int_t> nzip(fPending.size(), 0);
+   // The Imt library depends on RIO, so plain threads are used, as many as the implicit multi-threading pool has.
+   const auto nThreads = std::min<std::size_t>(std::max(1u, ROOT::GetThreadPoolSize()), fPending.size());
+   std::atomic<std::size_t> next{0};
+   // A single key uses the threads for the blocks of its object instead
+   const bool isParallelKey = nThreads == 1;
+   auto compress = [&]() {
+      for (auto i = next++; i < fPending.size(); i = next++)
+         nzip[i] = fPending[i]->ZipObject(cxlevel, cxAlgorithm, isParallelKey);
+   };
+   std::vector<std::thread> threads;
+   for (std::size_t i = 1; i < nThreads; ++i)
+      threads.emplace_back(compress);
+   compress();
+   for (auto &thread : threads)
+      thread.join();
+
+   Int_t nbytes = 0;
+   bool isError = false;
+   for (std::size_t i = 0; i < fPending.size(); ++i) {
+      TKey *key = fPending[i];
+      key->CreateWithBuffer(nzip[i]);
+      if (!key->GetSeekKey()) {
+         // Create() failed and reported the error, drop the key like TDirectoryFile::WriteTObject() does
+         key->GetMotherDir()->GetListOfKeys()->Remove(key);
+         delete key;
+         continue;
+      }
+      const Int_t nout = key->WriteFile(0);
+      if (nout < 0 || fFile.TestBit(TFile::kWriteError))
+         isError = true;
+      else
+         nbytes += nout;
+   }
+   fPending.clear();
+   fPendingBytes = 0;
+   return isError ? -1 : nbytes;
+}
+
+} // namespace Internal
+} // namespace ROOT
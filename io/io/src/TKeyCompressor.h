@@ -0,0 +1,57 @@
+// @(#)root/io:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_TKeyCompressor
+#define ROOT_TKeyCompressor
+
+#include "RtypesCore.h"
+
+#include <vector>
+
+class TFile;
+class TKey;
+
+namespace ROOT {
+namespace Internal {
+
+/** \class ROOT::Internal::TKeyCompressor
+ Compresses the keys of the objects written by TDirectoryFile::Write() in parallel when implicit multi-threading is
+ enabled. While the compressor is installed in a file, the TKey constructors stream the object as usual but hand
+ the key over instead of compressing it. Finish() compresses the pending keys in parallel, then allocates their space
+ in the file and writes them in the order in which they were handed over, so only the compression runs concurrently.
+*/
+
+class TKeyCompressor {
+   TFile &fFile;
+   std::vector<TKey *> fPending; ///< Keys whose object is streamed but not yet compressed
+   Long64_t fPendingBytes = 0;   ///< Sum of the uncompressed sizes of the pending objects
+
+   /// Above this size of pending objects, the keys are written without waiting for the end of TDirectoryFile::Write()
+   static constexpr Long64_t kMaxPendingBytes = 256 * 1024 * 1024;
+
+public:
+   /// Install the compressor in the file, which must not have one yet.
+   explicit TKeyCompressor(TFile &file);
+   TKeyCompressor(const TKeyCompressor &) = delete;
+   TKeyCompressor &operator=(const TKeyCompressor &) = delete;
+   /// Finish the pending keys and uninstall the compressor.
+   ~TKeyCompressor();
+
+   void Add(TKey *key);
+   Bool_t IsPending(const TKey *key) const;
+   Bool_t IsFull() const { return fPendingBytes > kMaxPendingBytes; }
+   /// Compress and write the pending keys. Returns the number of bytes written, or -1 in case of error.
+   Int_t Finish();
+};
+
+} // namespace Internal
+} // namespace ROOT
+
+#endif
@@ -0,0 +1,165 @@
+// @(#)root/io:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+/**
+\class TSharedMemFile TSharedMemFile.cxx
+\ingroup IO
+
+A read-only TMemFile whose content lives in a named POSIX shared memory
+segment, to hand ROOT files between the processes of a node without
+sending them through a socket.
+
+The producer writes a TMemFile and publishes it; the consumer, e.g. the
+parent of the TProcessExecutor workers, only needs the name of the
+segment to open the file, which is read in place:
+~~~{.cpp}
+// producer
+TMemFile f("results", "RECREATE");
+hist.Write();
+f.Write();
+TSharedMemFile::Publish(f, "/myjob-worker3");
+
+// consumer
+TSharedMemFile in("/myjob-worker3");
+auto h = in.Get<TH1D>("hist");
+~~~
+By default the consumer removes the name of the segment once it is
+mapped: the memory is then released when the last process using it
+unmaps it.
+
+Not available on Windows.
+*/
+
+#include "TSharedMemFile.h"
+#include "TError.h"
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include <string>
+
+ClassImp(TSharedMemFile);
+
+namespace {
+/// Names of POSIX shared memory segments start with a slash
+std::string GetSegmentName(const char *name)
+{
+   return name[0] == '/' ? std::string(name) : std::string("/") + name;
+}
+} // anonymous namespace
+
+////////////////////////////////////////////////////////////////////////////////
+/// Map the segment for reading; returns an empty view in case of failure.
+
+TMemFile::ZeroCopyView_t TSharedMemFile::MapSegment(const char *name, Bool_t unlinkSegment)
+{
+#ifndef _WIN32
+   const auto segmentName = GetSegmentName(name);
+   int fd = shm_open(segmentName.c_str(), O_RDONLY, 0);
+   if (fd < 0) {
+      ::SysError("TSharedMemFile", "cannot open the shared memory segment %s", segmentName.c_str());
+      return ZeroCopyView_t(nullptr, 0);
+   }
+   struct stat info;
+   void *mapping = MAP_FAILED;
+   if (fstat(fd, &info) == 0 && info.st_size > 0)
+      mapping = mmap(nullptr, info.st_size, PROT_READ, MAP_SHARED, fd, 0);
+   close(fd);
+   if (mapping == MAP_FAILED) {
+      ::SysError("TSharedMemFile", "cannot map the shared memory segment %s", segmentName.c_str());
+      return ZeroCopyView_t(nullptr, 0);
+   }
+   if (unlinkSegment)
+      shm_unlink(segmentName.c_str());
+   return ZeroCopyView_t(static_cast<const char *>(mapping), info.st_size);
+#else
+   (void)unlinkSegment;
+   ::Error("TSharedMemFile", "shared memory segments are not supported on this platform, cannot open %s", name);
+   return ZeroCopyView_t(nullptr, 0);
+#endif
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Open the file published in the shared memory segment `name`. If
+/// `unlinkSegment` is true, the name of the segment is removed once the
+/// segment is mapped. The object is a zombie if the segment cannot be mapped.
+
+TSharedMemFile::TSharedMemFile(const char *name, Bool_t unlinkSegment)
+   : TMemFile(name, MapSegment(name, unlinkSegment))
+{
+   fMapping = fBlockList.fBuffer;
+   fMappingSize = fBlockList.fSize;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Close the file and unmap the segment.
+
+TSharedMemFile::~TSharedMemFile()
+{
+   // The file must be closed while the segment is still mapped
+   Close();
+#ifndef _WIN32
+   if (fMapping)
+      munmap(fMapping, fMappingSize);
+#endif
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Copy the content of `file` into a new shared memory segment `name`, which
+/// must not exist. The objects must have been written to the file, e.g. by
+/// TMemFile::Write(). The segment exists until it is unlinked, by Unlink() or
+/// by a consumer opening it. Returns kTRUE on success.
+
+Bool_t TSharedMemFile::Publish(const TMemFile &file, const char *name)
+{
+#ifndef _WIN32
+   const auto segmentName = GetSegmentName(name);
+   const Long64_t size = file.GetSize();
+   int fd = shm_open(segmentName.c_str(), O_RDWR | O_CREAT | O_EXCL, 0600);
+   if (fd < 0) {
+      ::SysError("TSharedMemFile::Publish", "cannot create the shared memory segment %s", segmentName.c_str());
+      return kFALSE;
+   }
+   void *mapping = MAP_FAILED;
+   if (ftruncate(fd, size) == 0)
+      mapping = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+   close(fd);
+   if (mapping == MAP_FAILED) {
+      ::SysError("TSharedMemFile::Publish", "cannot map the shared memory segment %s", segmentName.c_str());
+      shm_unlink(segmentName.c_str());
+      return kFALSE;
+   }
+   file.CopyTo(mapping, size);
+   munmap(mapping, size);
+   return kTRUE;
+#else
+   (void)file;
+   ::Error("TSharedMemFile::Publish", "shared memory segments are not supported on this platform, cannot create %s",
+           name);
+   return kFALSE;
+#endif
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Remove the name of the shared memory segment `name`. Returns kTRUE on success.
+
+Bool_t TSharedMemFile::Unlink(const char *name)
+{
+#ifndef _WIN32
+   return shm_unlink(GetSegmentName(name).c_str()) == 0;
+#else
+   (void)name;
+   return kFALSE;
+#endif
+}
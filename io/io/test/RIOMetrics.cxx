@@ -0,0 +1,139 @@
+#include "gtest/gtest.h"
+
+#include <ROOT/RIOMetrics.hxx>
+#include <ROOT/RRawFile.hxx>
+
+#include "TFile.h"
+#include "TNamed.h"
+#include "TSystem.h"
+
+#include <chrono>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+using ROOT::Experimental::RIOFileMetrics;
+using ROOT::Experimental::RIOLatencyHistogram;
+using ROOT::Experimental::RIOMetrics;
+
+namespace {
+
+/// Enables the metrics for the duration of a test
+class RMetricsGuard {
+public:
+   RMetricsGuard() { RIOMetrics::SetEnabled(true); }
+   ~RMetricsGuard() { RIOMetrics::SetEnabled(false); }
+};
+
+} // anonymous namespace
+
+TEST(RIOMetrics, LatencyHistogram)
+{
+   RIOLatencyHistogram histogram;
+   histogram.Observe(std::chrono::nanoseconds(500));
+   histogram.Observe(std::chrono::microseconds(3));
+   histogram.Observe(std::chrono::seconds(100));
+   EXPECT_EQ(3u, histogram.GetCount());
+   EXPECT_EQ(1u, histogram.GetBucketCount(0));
+   EXPECT_EQ(1u, histogram.GetBucketCount(2));
+   EXPECT_EQ(1u, histogram.GetBucketCount(RIOLatencyHistogram::kNBuckets));
+   EXPECT_EQ(100000003500u, histogram.GetSumNs());
+   histogram.Reset();
+   EXPECT_EQ(0u, histogram.GetCount());
+}
+
+TEST(RIOMetrics, ConcurrentUpdates)
+{
+   auto &metrics = RIOMetrics::Instance().GetFileMetrics("test", "concurrent");
+   metrics.Reset();
+   std::vector<std::thread> threads;
+   for (int t = 0; t < 4; ++t) {
+      threads.emplace_back([&metrics] {
+         for (int i = 0; i < 1000; ++i) {
+            metrics.AddRead(10, RIOFileMetrics::Now());
+            metrics.AddCacheHit();
+         }
+      });
+   }
+   for (auto &t : threads)
+      t.join();
+   EXPECT_EQ(40000u, metrics.GetBytesRead());
+   EXPECT_EQ(4000u, metrics.GetReadCalls());
+   EXPECT_EQ(4000u, metrics.GetCacheHits());
+   EXPECT_EQ(4000u, metrics.GetReadLatency().GetCount());
+   EXPECT_EQ(&metrics, &RIOMetrics::Instance().GetFileMetrics("test", "concurrent"));
+}
+
+TEST(RIOMetrics, Disabled)
+{
+   RIOMetrics::SetEnabled(false);
+   EXPECT_EQ(nullptr, RIOMetrics::GetFileMetricsIfEnabled("test", "disabled"));
+}
+
+TEST(RIOMetrics, TFile)
+{
+   const std::string fileName = "test_riometrics_tfile.root";
+   RMetricsGuard guard;
+   {
+      TFile f(fileName.c_str(), "RECREATE");
+      TNamed named("name", "title");
+      f.WriteObject(&named, "named");
+   }
+   {
+      TFile f(fileName.c_str());
+      auto named = std::unique_ptr<TNamed>(f.Get<TNamed>("named"));
+      ASSERT_TRUE(named);
+   }
+   const auto &metrics = RIOMetrics::Instance().GetFileMetrics("TFile", fileName);
+   EXPECT_GT(metrics.GetBytesWritten(), 0u);
+   EXPECT_GT(metrics.GetWriteCalls(), 0u);
+   EXPECT_GT(metrics.GetBytesRead(), 0u);
+   EXPECT_EQ(metrics.GetReadCalls(), metrics.GetReadLatency().GetCount());
+
+   const auto prometheus = RIOMetrics::Instance().ToPrometheus();
+   EXPECT_NE(std::string::npos,
+             prometheus.find("root_io_read_bytes_total{component=\"TFile\",file=\"" + fileName + "\"} " +
+                             std::to_string(metrics.GetBytesRead()) + "\n"));
+   EXPECT_NE(std::string::npos, prometheus.find("# TYPE root_io_read_duration_seconds histogram\n"));
+   EXPECT_NE(std::string::npos, prometheus.find("root_io_read_duration_seconds_count{component=\"TFile\""));
+
+   const auto json = RIOMetrics::Instance().ToJSON();
+   EXPECT_NE(std::string::npos, json.find("\"file\": \"" + fileName + "\""));
+
+   const std::string exportName = "test_riometrics_export.prom";
+   EXPECT_TRUE(RIOMetrics::Instance().WriteToFile(exportName));
+   std::ifstream in(exportName);
+   const std::string content((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+   EXPECT_NE(std::string::npos, content.find("root_io_read_bytes_total"));
+
+   gSystem->Unlink(exportName.c_str());
+   gSystem->Unlink(fileName.c_str());
+}
+
+TEST(RIOMetrics, RRawFile)
+{
+   const std::string fileName = "test_riometrics_rawfile.txt";
+   {
+      std::ofstream out(fileName);
+      out << std::string(10000, 'x');
+   }
+   RMetricsGuard guard;
+   {
+      auto f = ROOT::Internal::RRawFile::Create(fileName);
+      char buffer[100];
+      EXPECT_EQ(100u, f->ReadAt(buffer, 100, 0));
+      ROOT::Internal::RRawFile::RIOVec ioVec[2];
+      char buffer2[2][50];
+      ioVec[0] = {buffer2[0], 1000, 50, 0};
+      ioVec[1] = {buffer2[1], 2000, 50, 0};
+      f->ReadV(ioVec, 2);
+   }
+   const auto &metrics = RIOMetrics::Instance().GetFileMetrics("RRawFile", fileName);
+   // One block read by ReadAt, one vector read
+   EXPECT_EQ(2u, metrics.GetReadCalls());
+   EXPECT_GE(metrics.GetBytesRead(), 100u + 2 * 50u);
+   EXPECT_EQ(2u, metrics.GetReadLatency().GetCount());
+   gSystem->Unlink(fileName.c_str());
+}
@@ -43,6 +43,60 @@ TEST(RRawFileUnix, ReadV)
    }
 }
 
+TEST(RRawFileUnix, ReadVRepeated)
+{
+   auto file = "test_uring_readv_repeated";
+   auto filesize = 2 << 20;
+   FileRaii fileGuard(file, std::string(filesize, 'b')); // ~2MB
+   auto f = RRawFileUnix::Create(file);
+
+   // The same io_uring instance is reused across calls
+   for (int round = 0; round < 10; ++round) {
+      auto iovecs = make_iovecs(50, filesize);
+      f->ReadV(iovecs.data(), iovecs.size());
+      for (auto iovec : iovecs) {
+         EXPECT_GT(iovec.fOutBytes, 0u);
+         for (std::size_t i = 0; i < iovec.fOutBytes; ++i) {
+            EXPECT_EQ('b', ((unsigned char *)iovec.fBuffer)[i]);
+         }
+         free(iovec.fBuffer);
+      }
+   }
+}
+
+TEST(RIoUring, SubmitMoreThanQueueDepth)
+{
+   auto file = "test_uring_small_queue";
+   auto filesize = 2 << 20;
+   FileRaii fileGuard(file, std::string(filesize, 'c')); // ~2MB
+   RRawFileUnix f(file, RRawFile::ROptions());
+   auto size = f.GetSize();
+
+   RIoUring ring(4);
+   ASSERT_EQ(4u, ring.GetQueueDepth());
+
+   // The ring keeps at most 4 reads in flight and refills the queue as reads complete
+   unsigned int nReads = 100;
+   auto iovecs = make_iovecs(nReads, size);
+   std::vector<RIoUring::RReadEvent> reads;
+   for (const auto &iovec : iovecs) {
+      RIoUring::RReadEvent ev;
+      ev.fBuffer = iovec.fBuffer;
+      ev.fOffset = iovec.fOffset;
+      ev.fSize = iovec.fSize;
+      ev.fFileDes = f.GetFd();
+      reads.push_back(ev);
+   }
+   ring.SubmitReadsAndWait(reads.data(), nReads);
+   for (std::size_t r = 0; r < nReads; ++r) {
+      EXPECT_EQ(std::min<std::uint64_t>(iovecs[r].fSize, size - iovecs[r].fOffset), reads[r].fOutBytes);
+      for (std::size_t i = 0; i < reads[r].fOutBytes; ++i) {
+         EXPECT_EQ('c', ((unsigned char *)reads[r].fBuffer)[i]);
+      }
+      free(iovecs[r].fBuffer);
+   }
+}
+
 TEST(RawUring, NopRoundTrip)
 {
    struct io_uring ring;
@@ -1,5 +1,10 @@
 #include "io_test.hxx"
 
+#include "ROOT/RBlockCache.hxx"
+#include "TSystem.h"
+
+#include <vector>
+
 namespace {
 
 /**
@@ -138,6 +143,34 @@ TEST(RRawFile, ReadV)
 }
 
 
+TEST(RRawFile, ReadVAsync)
+{
+   FileRaii readvGuard("test_rawfile_readv_async", "Hello, World");
+   auto f = RRawFile::Create("test_rawfile_readv_async");
+
+   // More reads than fit in one io_uring submission queue
+   constexpr unsigned int nReq = 3000;
+   std::vector<char> buffer(nReq, 0);
+   std::vector<RRawFile::RIOVec> iovec(nReq);
+   for (unsigned int i = 0; i < nReq; ++i) {
+      iovec[i].fBuffer = &buffer[i];
+      iovec[i].fOffset = i % 13;
+      iovec[i].fSize = 1;
+   }
+   auto future = f->ReadVAsync(iovec.data(), nReq);
+   future.get();
+
+   for (unsigned int i = 0; i < nReq; ++i) {
+      if (i % 13 < 12) {
+         EXPECT_EQ(1U, iovec[i].fOutBytes);
+         EXPECT_EQ("Hello, World"[i % 13], buffer[i]);
+      } else {
+         EXPECT_EQ(0U, iovec[i].fOutBytes);
+      }
+   }
+}
+
+
 TEST(RRawFile, SplitUrl)
 {
    EXPECT_STREQ("C:\\Data\\events.root", RRawFile::GetLocation("C:\\Data\\events.root").c_str());
@@ -228,3 +261,63 @@ TEST(RRawFile, Mmap)
    auto mapdLength = 2 + innerOffset;
    f->Unmap(region, mapdLength);
 }
+
+
+TEST(RRawFile, BlockCache)
+{
+   using ROOT::Internal::RBlockCache;
+   std::unique_ptr<RRawFileMock> m(new RRawFileMock("0123456789abcdefghij", RRawFile::ROptions()));
+   unsigned int nFetchedBlocks = 0;
+   auto readFunc = [&](RRawFile::RIOVec *ioVec, unsigned int nReq) {
+      nFetchedBlocks += nReq;
+      m->ReadV(ioVec, nReq);
+   };
+
+   const std::string dir = "test_rawfile_blockcache";
+   char buffer[11];
+   RRawFile::RIOVec iovec[2];
+   auto readV = [&](RBlockCache &cache) {
+      memset(buffer, 0, sizeof(buffer));
+      iovec[0].fBuffer = &buffer[0];
+      iovec[0].fOffset = 2;
+      iovec[0].fSize = 5;
+      iovec[1].fBuffer = &buffer[5];
+      iovec[1].fOffset = 17;
+      iovec[1].fSize = 5;
+      cache.ReadV("mock", m->GetSize(), iovec, 2, readFunc);
+      EXPECT_EQ(5U, iovec[0].fOutBytes);
+      EXPECT_EQ(3U, iovec[1].fOutBytes);
+      EXPECT_STREQ("23456hij", buffer);
+   };
+
+   {
+      RBlockCache cache(dir, 0, 4);
+      readV(cache);
+      EXPECT_EQ(3U, nFetchedBlocks);
+      EXPECT_EQ(0U, cache.GetNHits());
+      EXPECT_EQ(3U, cache.GetNMisses());
+
+      nFetchedBlocks = 0;
+      readV(cache);
+      EXPECT_EQ(0U, nFetchedBlocks);
+      EXPECT_EQ(3U, cache.GetNHits());
+
+      // Another file content must not be served from the blocks of the first one
+      nFetchedBlocks = 0;
+      cache.ReadV("mock#2", m->GetSize(), iovec, 2, readFunc);
+      EXPECT_EQ(3U, nFetchedBlocks);
+   }
+
+   {
+      // The blocks of the other cache instance are shared through the directory. A size limit of 1 byte evicts all
+      // of them.
+      RBlockCache cache(dir, 1, 4);
+      nFetchedBlocks = 0;
+      readV(cache);
+      EXPECT_EQ(0U, nFetchedBlocks);
+      cache.Evict();
+      readV(cache);
+      EXPECT_EQ(3U, nFetchedBlocks);
+   }
+   EXPECT_EQ(0, gSystem->Unlink(dir.c_str()));
+}
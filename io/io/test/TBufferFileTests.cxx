@@ -26,3 +26,52 @@ TEST(TBufferFile, ROOT_8367)
    EXPECT_FLOAT_EQ(v2[6], 7.);
    EXPECT_EQ(v2.size(), 7);
 }
+
+template <typename T>
+static void CheckFastArrayRoundTrip()
+{
+   // Sizes around the 16 bytes processed at once by the byte swapping kernels
+   for (Int_t n : {1, 2, 3, 7, 8, 9, 16, 17, 100}) {
+      std::vector<T> in(n);
+      for (Int_t i = 0; i < n; ++i)
+         in[i] = static_cast<T>((i + 1) * 37 - 500);
+
+      TBufferFile buf(TBuffer::kWrite);
+      Char_t offset = 1; // have the arrays start at an odd position in the buffer
+      buf << offset;
+      buf.WriteFastArray(in.data(), n);
+      ASSERT_EQ(1 + n * sizeof(T), static_cast<std::size_t>(buf.Length()));
+
+      // the data is stored in big-endian byte order
+      for (Int_t i = 0; i < n; ++i) {
+         const auto *bytes = reinterpret_cast<const unsigned char *>(&in[i]);
+         for (std::size_t b = 0; b < sizeof(T); ++b) {
+#ifdef R__BYTESWAP
+            const unsigned char expected = bytes[sizeof(T) - 1 - b];
+#else
+            const unsigned char expected = bytes[b];
+#endif
+            EXPECT_EQ(expected, static_cast<unsigned char>(buf.Buffer()[1 + i * sizeof(T) + b]));
+         }
+      }
+
+      buf.SetReadMode();
+      buf.Reset();
+      buf >> offset;
+      std::vector<T> out(n);
+      buf.ReadFastArray(out.data(), n);
+      EXPECT_EQ(in, out);
+   }
+}
+
+TEST(TBufferFile, FastArrayByteSwap)
+{
+   CheckFastArrayRoundTrip<Short_t>();
+   CheckFastArrayRoundTrip<UShort_t>();
+   CheckFastArrayRoundTrip<Int_t>();
+   CheckFastArrayRoundTrip<UInt_t>();
+   CheckFastArrayRoundTrip<Long64_t>();
+   CheckFastArrayRoundTrip<ULong64_t>();
+   CheckFastArrayRoundTrip<Float_t>();
+   CheckFastArrayRoundTrip<Double_t>();
+}
@@ -1,4 +1,6 @@
 #include "TBufferJSON.h"
+#include "TArrayD.h"
+#include "TList.h"
 #include "TNamed.h"
 #include <string>
 
@@ -47,3 +49,39 @@ TEST(TBufferJSON, utf8_3)
    EXPECT_EQ(str0, named1->GetTitle());
 }
 
+
+// check that the JSON code passed to an output sink is the same as the returned one
+TEST(TBufferJSON, OutputSink)
+{
+   TArrayD arr(10000);
+   for (Int_t i = 0; i < arr.GetSize(); ++i)
+      arr[i] = (i % 3 == 0) ? i : i / 7.;
+   TList list;
+   list.SetOwner(kTRUE);
+   for (Int_t i = 0; i < 1000; ++i)
+      list.Add(new TNamed(("name" + std::to_string(i)).c_str(), "title"));
+
+   auto checkSink = [](const void *obj, const TClass *cl, Int_t compact) {
+      auto json = TBufferJSON::ConvertToJSON(obj, cl, compact);
+
+      std::string streamed;
+      int nCalls = 0;
+      TBufferJSON buf;
+      buf.SetCompact(compact);
+      buf.SetOutputSink(
+         [&](const char *data, std::size_t len) {
+            streamed.append(data, len);
+            ++nCalls;
+         },
+         1000);
+      EXPECT_TRUE(buf.StoreObject(obj, cl).IsNull());
+      EXPECT_EQ(std::string(json.Data()), streamed);
+      EXPECT_GE(nCalls, 1);
+      return nCalls;
+   };
+
+   for (Int_t compact : {0, 3, 23}) {
+      checkSink(&arr, TArrayD::Class(), compact);
+      EXPECT_GT(checkSink(&list, TList::Class(), compact), 1);
+   }
+}
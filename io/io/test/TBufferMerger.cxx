@@ -7,10 +7,12 @@
 #include "TROOT.h"
 #include "TTree.h"
 
+#include <algorithm>
 #include <atomic>
 #include <cstdio>
 #include <future>
 #include <memory>
+#include <mutex>
 #include <thread>
 #include <sys/stat.h>
 
@@ -160,6 +162,68 @@ TEST(TBufferMerger, AutoSave)
    RemoveFile("tbuffermerger_autosave.root");
 }
 
+TEST(TBufferMerger, MaxBuffered)
+{
+   int nthreads = 16;
+   int nwrites = 8;
+   int events_per_write = 1024;
+
+   ROOT::EnableThreadSafety();
+
+   for (bool background : {false, true}) {
+      std::atomic<size_t> maxBuffered{0};
+      size_t maxFileSize = 0;
+      {
+         TBufferMerger merger("tbuffermerger_maxbuffered.root");
+         merger.SetAutoSave(256 * 1024);
+         merger.SetMaxBuffered(1024 * 1024);
+         merger.SetMergeInBackground(background);
+         EXPECT_EQ(background, merger.GetMergeInBackground());
+
+         std::mutex sizeMutex;
+         std::vector<std::thread> threads;
+         for (int i = 0; i < nthreads; ++i) {
+            threads.emplace_back([=, &merger, &maxBuffered, &maxFileSize, &sizeMutex]() {
+               auto myfile = merger.GetFile();
+               auto mytree = new TTree("mytree", "mytree");
+               int n = 0;
+               mytree->Branch("n", &n, "n/I");
+               for (int w = 0; w < nwrites; ++w) {
+                  for (int e = 0; e < events_per_write; ++e) {
+                     n = (i * nwrites + w) * events_per_write + e;
+                     mytree->Fill();
+                  }
+                  {
+                     std::lock_guard<std::mutex> lock(sizeMutex);
+                     maxFileSize = std::max<size_t>(maxFileSize, myfile->GetSize());
+                  }
+                  myfile->Write();
+                  // Write() returns below the limit, but other writers may push meanwhile
+                  auto buffered = merger.GetBuffered();
+                  auto prev = maxBuffered.load();
+                  while (buffered > prev && !maxBuffered.compare_exchange_weak(prev, buffered))
+                     ;
+               }
+               mytree->ResetBranchAddresses();
+            });
+         }
+
+         for (auto &&t : threads)
+            t.join();
+         // The queue never holds more than the limit plus one buffer per writer
+         EXPECT_LE(maxBuffered, 1024 * 1024 + nthreads * maxFileSize);
+      }
+
+      {
+         TFile f("tbuffermerger_maxbuffered.root");
+         auto t = f.Get<TTree>("mytree");
+         ASSERT_TRUE(t != nullptr);
+         EXPECT_EQ(nthreads * nwrites * events_per_write, t->GetEntries());
+      }
+      RemoveFile("tbuffermerger_maxbuffered.root");
+   }
+}
+
 TEST(TBufferMerger, CheckTreeFillResults)
 {
    int sum_s, sum_p;
@@ -1,10 +1,17 @@
 #include "ROOT/TestSupport.hxx"
 
+#include "Compression.h"
 #include "TFileMerger.h"
 
+#include "TH1F.h"
 #include "TMemFile.h"
+#include "TROOT.h"
 #include "TTree.h"
 
+#include <memory>
+#include <string>
+#include <vector>
+
 static void CreateATuple(TMemFile &file, const char *name, double value)
 {
    auto mytree = new TTree(name, "A tree");
@@ -68,3 +75,108 @@ TEST(TFileMerger, CreateWithUnwritableTFilePointer)
    ROOT_EXPECT_ERROR(merger.OutputFile(std::move(output)), "TFileMerger::OutputFile",
                      "output file output.root is not writable");
 }
+
+/// Histograms are written by the next file.Write().
+static void CreateHistograms(TMemFile &file, int nHistograms, double value)
+{
+   auto subdir = file.mkdir("subdir");
+   for (auto dir : {static_cast<TDirectory *>(&file), subdir}) {
+      for (int i = 0; i < nHistograms; ++i) {
+         const auto name = "h" + std::to_string(i);
+         auto h = new TH1F(name.c_str(), "A histogram", 10, 0., 10.);
+         h->SetDirectory(dir);
+         h->Fill(i % 10, value);
+      }
+   }
+}
+
+TEST(TFileMerger, MergeHistogramsInParallel)
+{
+   constexpr int kNFiles = 5;
+   constexpr int kNHistograms = 20;
+   std::vector<std::unique_ptr<TMemFile>> sources;
+   for (int f = 0; f < kNFiles; ++f) {
+      sources.emplace_back(new TMemFile(("source" + std::to_string(f) + ".root").c_str(), "RECREATE"));
+      CreateHistograms(*sources.back(), kNHistograms, f + 1.);
+      CreateATuple(*sources.back(), "a_tree", f + 1.);
+   }
+
+   TFileMerger merger;
+   merger.SetNThreads(4);
+   EXPECT_EQ(4u, merger.GetNThreads());
+   ASSERT_TRUE(merger.OutputFile(std::unique_ptr<TMemFile>(new TMemFile("output_mt.root", "CREATE"))));
+   for (auto &source : sources)
+      merger.AddFile(source.get(), false);
+   ASSERT_TRUE(merger.PartialMerge(TFileMerger::kAll | TFileMerger::kRegular));
+
+   auto &result = *static_cast<TMemFile *>(merger.GetOutputFile());
+   for (auto dir : {static_cast<TDirectory *>(&result), result.GetDirectory("subdir")}) {
+      ASSERT_TRUE(dir != nullptr);
+      // one key per histogram, plus the subdirectory and the tree at the top level
+      EXPECT_EQ(kNHistograms + (dir == &result ? 2 : 0), dir->GetListOfKeys()->GetEntries());
+      for (int i = 0; i < kNHistograms; ++i) {
+         const auto name = "h" + std::to_string(i);
+         auto h = dir->Get<TH1F>(name.c_str());
+         ASSERT_TRUE(h != nullptr) << name;
+         EXPECT_EQ(kNFiles, h->GetEntries()) << name;
+         // sum of the weights 1 + 2 + ... + kNFiles
+         EXPECT_DOUBLE_EQ(kNFiles * (kNFiles + 1) / 2., h->GetBinContent(h->FindBin(i % 10))) << name;
+      }
+   }
+   auto t = result.Get<TTree>("a_tree");
+   ASSERT_TRUE(t != nullptr);
+   EXPECT_EQ(kNFiles, t->GetEntries());
+}
+
+#ifdef R__USE_IMT
+TEST(TFileMerger, RecompressTreesInParallel)
+{
+   constexpr int kNFiles = 3;
+   constexpr int kNEntries = 20000;
+   std::vector<std::unique_ptr<TMemFile>> sources;
+   for (int f = 0; f < kNFiles; ++f) {
+      sources.emplace_back(new TMemFile(("recompress" + std::to_string(f) + ".root").c_str(), "RECREATE", "",
+                                        ROOT::RCompressionSetting::EDefaults::kUseGeneralPurpose));
+      auto t = new TTree("t", "A tree");
+      t->SetDirectory(sources.back().get());
+      int i = 0;
+      double x = 0.;
+      // Small baskets, so that many of them are compressed again
+      t->Branch("i", &i, 4000);
+      t->Branch("x", &x, 4000);
+      for (int e = 0; e < kNEntries; ++e) {
+         i = f * kNEntries + e;
+         x = 0.5 * i;
+         t->Fill();
+      }
+      sources.back()->Write();
+   }
+
+   TFileMerger merger;
+   merger.SetNThreads(4);
+   ASSERT_TRUE(merger.OutputFile(std::unique_ptr<TMemFile>(
+      new TMemFile("recompressed.root", "CREATE", "", ROOT::RCompressionSetting::EDefaults::kUseAnalysis))));
+   for (auto &source : sources)
+      merger.AddFile(source.get(), false);
+   EXPECT_TRUE(merger.HasCompressionChange());
+   ASSERT_TRUE(merger.PartialMerge(TFileMerger::kAll | TFileMerger::kRegular));
+   // Implicit multi-threading was only enabled during the merge
+   EXPECT_FALSE(ROOT::IsImplicitMTEnabled());
+
+   auto &result = *static_cast<TMemFile *>(merger.GetOutputFile());
+   auto t = result.Get<TTree>("t");
+   ASSERT_TRUE(t != nullptr);
+   ASSERT_EQ(kNFiles * kNEntries, t->GetEntries());
+   EXPECT_EQ(ROOT::RCompressionSetting::EDefaults::kUseAnalysis, t->GetBranch("x")->GetCompressionSettings());
+   int i = -1;
+   double x = -1.;
+   t->SetBranchAddress("i", &i);
+   t->SetBranchAddress("x", &x);
+   for (Long64_t e = 0; e < t->GetEntries(); ++e) {
+      ASSERT_GT(t->GetEntry(e), 0);
+      ASSERT_EQ(e, i);
+      ASSERT_EQ(0.5 * e, x);
+   }
+   t->ResetBranchAddresses();
+}
+#endif
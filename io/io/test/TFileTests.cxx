@@ -1,14 +1,21 @@
+#include <atomic>
 #include <memory>
+#include <string>
 #include <vector>
 
 #include "gtest/gtest.h"
 
+#include "TArrayC.h"
 #include "TFile.h"
+#include "TFileCacheWrite.h"
+#include "TFilePrefetch.h"
 #include "TKey.h"
 #include "TNamed.h"
+#include "TObjString.h"
 #include "TPluginManager.h"
 #include "TROOT.h" // gROOT
 #include "TSystem.h"
+#include "RZip.h"
 
 TEST(TFile, WriteObjectTObject)
 {
@@ -69,6 +76,90 @@ TEST(TFile, WriteObjectVector)
 }
 
 // Tests ROOT-9857
+TEST(TFile, ReadManyKeys)
+{
+    auto filename{"tfile_readmanykeys.root"};
+    const int nobjects = 2000;
+
+    {
+        TFile f{filename, "recreate"};
+        for (int i = 0; i < nobjects; ++i) {
+            TNamed named{("obj" + std::to_string(i)).c_str(), std::to_string(i).c_str()};
+            named.Write();
+        }
+        for (int cycle = 1; cycle <= 3; ++cycle) {
+            TNamed named{"multi", std::to_string(cycle).c_str()};
+            named.Write();
+        }
+        auto dir = f.mkdir("dir");
+        TNamed inner{"inner", "inner"};
+        dir->WriteObject(&inner, "inner");
+        f.Write();
+    }
+
+    TFile input{filename};
+    EXPECT_EQ(nobjects + 4, input.GetNkeys());
+
+    auto named = input.Get<TNamed>("obj1234");
+    ASSERT_NE(nullptr, named);
+    EXPECT_STREQ("1234", named->GetTitle());
+    EXPECT_EQ(nullptr, input.Get<TNamed>("obj5000"));
+
+    auto key = input.GetKey("multi");
+    ASSERT_NE(nullptr, key);
+    EXPECT_EQ(3, key->GetCycle());
+    EXPECT_STREQ("2", input.Get<TNamed>("multi;2")->GetTitle());
+    ASSERT_NE(nullptr, input.FindKey("multi;1"));
+    EXPECT_EQ(1, input.FindKey("multi;1")->GetCycle());
+    EXPECT_STREQ("inner", input.Get<TNamed>("dir/inner")->GetTitle());
+    EXPECT_EQ(nobjects + 4, input.GetNkeys());
+
+    // The full list of keys is in file order, with the highest cycles first
+    auto keys = input.GetListOfKeys();
+    ASSERT_EQ(nobjects + 4, keys->GetSize());
+    EXPECT_STREQ("obj0", keys->At(0)->GetName());
+    EXPECT_EQ(3, static_cast<TKey *>(keys->At(nobjects))->GetCycle());
+    EXPECT_EQ(2, static_cast<TKey *>(keys->At(nobjects + 1))->GetCycle());
+    EXPECT_STREQ("dir", keys->At(nobjects + 3)->GetName());
+    EXPECT_EQ(key, input.GetKey("multi"));
+    EXPECT_NE(nullptr, input.FindKeyAny("inner"));
+
+    input.Close();
+    gSystem->Unlink(filename);
+}
+
+TEST(TFileCacheWrite, AsyncFlush)
+{
+    auto filename{"tfilecachewrite_asyncflush.root"};
+    const int nobjects = 500;
+
+    {
+        TFile f{filename, "recreate", "", 0}; // uncompressed, to fill the cache several times
+        auto cache = new TFileCacheWrite(&f, 32000); // owned by the file
+        cache->SetAsyncFlush();
+        EXPECT_TRUE(cache->GetAsyncFlush());
+        for (int i = 0; i < nobjects; ++i) {
+            TNamed named{("obj" + std::to_string(i)).c_str(), std::string(1000, 'a' + i % 26).c_str()};
+            named.Write();
+        }
+        // Objects still in the cache, or being written, can be read back
+        auto named = f.Get<TNamed>("obj499");
+        ASSERT_NE(nullptr, named);
+        EXPECT_EQ(std::string(1000, 'a' + 499 % 26), named->GetTitle());
+        f.Close();
+    }
+
+    TFile input{filename};
+    ASSERT_FALSE(input.IsZombie());
+    for (int i = 0; i < nobjects; ++i) {
+        auto named = input.Get<TNamed>(("obj" + std::to_string(i)).c_str());
+        ASSERT_NE(nullptr, named);
+        EXPECT_EQ(std::string(1000, 'a' + i % 26), named->GetTitle());
+    }
+    input.Close();
+    gSystem->Unlink(filename);
+}
+
 TEST(TFile, ReadFromSameFile)
 {
    const auto filename = "ReadFromSameFile.root";
@@ -135,3 +226,193 @@ TEST(TFile, ReadWithoutGlobalRegistrationNet)
    const auto netFile = "root://eospublic.cern.ch//eos/root-eos/h1/dstarmb.root";
    TestReadWithoutGlobalRegistrationIfPossible(netFile);
 }
+
+TEST(TFilePrefetch, ConcurrentFiles)
+{
+   constexpr int kNFiles = 4;
+   std::vector<std::string> filenames;
+   std::vector<std::unique_ptr<TFile>> files;
+   std::vector<std::unique_ptr<TFilePrefetch>> prefetchers;
+   for (int i = 0; i < kNFiles; ++i) {
+      filenames.emplace_back("tfileprefetch_concurrent_" + std::to_string(i) + ".root");
+      {
+         TNamed named{"named", std::string(20000, 'a' + i).c_str()};
+         TFile f{filenames.back().c_str(), "recreate", "", 0}; // uncompressed, to have enough bytes to read
+         f.WriteObject(&named, named.GetName());
+      }
+      files.emplace_back(TFile::Open(filenames.back().c_str()));
+      ASSERT_TRUE(files.back() && !files.back()->IsZombie());
+      prefetchers.emplace_back(new TFilePrefetch(files.back().get()));
+      EXPECT_EQ(prefetchers.back()->ThreadStart(), 0);
+   }
+
+   // two blocks of two pieces per file, requested for all files before reading any of them
+   Long64_t pos[2][2] = {{0, 1000}, {3000, 5000}};
+   Int_t len[2][2] = {{100, 500}, {1000, 200}};
+   for (auto &prefetcher : prefetchers) {
+      for (int b = 0; b < 2; ++b)
+         prefetcher->ReadBlock(pos[b], len[b], 2);
+   }
+
+   for (int i = 0; i < kNFiles; ++i) {
+      for (int b = 0; b < 2; ++b) {
+         for (int p = 0; p < 2; ++p) {
+            std::vector<char> prefetched(len[b][p]);
+            EXPECT_TRUE(prefetchers[i]->ReadBuffer(prefetched.data(), pos[b][p], len[b][p]));
+            std::vector<char> expected(len[b][p]);
+            // only read through the file once the prefetcher is done with it
+            prefetchers[i]->WaitFinishPrefetch();
+            EXPECT_FALSE(files[i]->ReadBuffer(expected.data(), pos[b][p], len[b][p]));
+            EXPECT_EQ(prefetched, expected);
+         }
+      }
+   }
+
+   prefetchers.clear();
+   files.clear();
+   for (const auto &filename : filenames)
+      gSystem->Unlink(filename.c_str());
+}
+
+namespace {
+std::atomic<int> gBackendZipCalls{0};
+std::atomic<int> gBackendUnzipCalls{0};
+
+// Lets the software codec do the work, as an accelerator without a device would
+bool CountingZip(int, int *, char *, int *, char *, int *)
+{
+   ++gBackendZipCalls;
+   return false;
+}
+
+bool CountingUnzip(int *, unsigned char *, int *, unsigned char *, int *)
+{
+   ++gBackendUnzipCalls;
+   return false;
+}
+} // anonymous namespace
+
+TEST(TFile, ZipBackendFallback)
+{
+   auto filename{"tfile_zipbackend.root"};
+   const std::string title(10000, 'x');
+   const R__ZipBackend backend{"counting", &CountingZip, &CountingUnzip};
+   auto previous = R__SetZipBackend(ROOT::RCompressionSetting::EAlgorithm::kZLIB, &backend);
+
+   {
+      TFile f{filename, "recreate", "", ROOT::CompressionSettings(ROOT::RCompressionSetting::EAlgorithm::kZLIB, 1)};
+      TNamed named{"named", title.c_str()};
+      f.WriteObject(&named, named.GetName());
+   }
+   EXPECT_GT(gBackendZipCalls, 0);
+   {
+      TFile f{filename};
+      auto named = f.Get<TNamed>("named");
+      ASSERT_NE(named, nullptr);
+      EXPECT_EQ(title, named->GetTitle());
+      delete named;
+   }
+   EXPECT_GT(gBackendUnzipCalls, 0);
+
+   EXPECT_EQ(R__SetZipBackend(ROOT::RCompressionSetting::EAlgorithm::kZLIB, previous), &backend);
+   gSystem->Unlink(filename);
+}
+
+#ifdef R__USE_IMT
+TEST(TFile, WriteParallelKeyCompression)
+{
+   auto filename{"tfile_parallelkeys.root"};
+   ROOT::EnableImplicitMT(4);
+   {
+      TFile f{filename, "recreate"};
+      auto subdir = f.mkdir("subdir");
+      for (int i = 0; i < 100; ++i) {
+         auto dir = i % 2 ? subdir : &f;
+         dir->Append(new TNamed(("named" + std::to_string(i)).c_str(), std::string(1000 + i, 'a' + i % 26).c_str()));
+      }
+      EXPECT_GT(f.Write(), 0);
+      // the keys replaced with "WriteDelete" are written before the old ones are deleted
+      EXPECT_GT(f.Write(nullptr, TObject::kWriteDelete), 0);
+   }
+   ROOT::DisableImplicitMT();
+
+   TFile f{filename};
+   for (int i = 0; i < 100; ++i) {
+      const std::string name = (i % 2 ? "subdir/named" : "named") + std::to_string(i);
+      auto named = f.Get<TNamed>(name.c_str());
+      ASSERT_NE(named, nullptr) << name;
+      EXPECT_EQ(std::string(1000 + i, 'a' + i % 26), named->GetTitle());
+      delete named;
+   }
+   EXPECT_EQ(f.GetListOfKeys()->GetSize(), 51);
+   gSystem->Unlink(filename);
+}
+
+// Objects larger than kMAXZIPBUF are compressed in several blocks, which are (un)compressed in parallel with IMT
+TEST(TFile, ParallelBlockCompression)
+{
+   std::string title(3 * kMAXZIPBUF + 1000, ' ');
+   for (std::size_t i = 0; i < title.size(); ++i)
+      title[i] = 'a' + (i * i / 1000) % 26;
+   TNamed named{"named", title.c_str()};
+
+   const std::vector<std::string> filenames{"tfile_blocks_sequential.root", "tfile_blocks_parallel.root"};
+   std::vector<Int_t> nbytes;
+   for (const auto &filename : filenames) {
+      if (&filename == &filenames.back())
+         ROOT::EnableImplicitMT(4);
+      TFile f{filename.c_str(), "recreate"};
+      f.WriteObject(&named, named.GetName());
+      nbytes.push_back(f.GetKey("named")->GetNbytes());
+   }
+   // The blocks are the same as the ones compressed sequentially
+   EXPECT_EQ(nbytes[0], nbytes[1]);
+   EXPECT_LT(nbytes[0], 3 * kMAXZIPBUF);
+
+   // Read with IMT still enabled, then without
+   for (const auto &filename : filenames) {
+      TFile f{filename.c_str()};
+      std::unique_ptr<TNamed> read{f.Get<TNamed>("named")};
+      ASSERT_NE(read, nullptr);
+      EXPECT_EQ(title, read->GetTitle());
+   }
+   ROOT::DisableImplicitMT();
+   for (const auto &filename : filenames) {
+      TFile f{filename.c_str()};
+      std::unique_ptr<TNamed> read{f.Get<TNamed>("named")};
+      ASSERT_NE(read, nullptr);
+      EXPECT_EQ(title, read->GetTitle());
+      gSystem->Unlink(filename.c_str());
+   }
+}
+#endif
+
+// The StreamerInfos of the second file are recognized as the ones already checked for the first file
+TEST(TFile, ReadStreamerInfoOfIdenticalFiles)
+{
+   const std::vector<std::string> filenames{"tfile_streamerinfo_0.root", "tfile_streamerinfo_1.root"};
+   for (const auto &filename : filenames) {
+      TFile f{filename.c_str(), "recreate"};
+      TNamed named{"named", filename.c_str()};
+      f.WriteObject(&named, named.GetName());
+      // make the StreamerInfo records differ, such that they are not skipped as a whole
+      if (&filename == &filenames.back()) {
+         TObjString str{"str"};
+         f.WriteObject(&str, "str");
+      }
+   }
+   const Int_t number = TNamed::Class()->GetStreamerInfo()->GetNumber();
+   for (const auto &filename : filenames) {
+      TFile f{filename.c_str()};
+      if (&filename == &filenames.back()) {
+         ASSERT_NE(f.GetClassIndex(), nullptr);
+         ASSERT_LT(number, f.GetClassIndex()->GetSize());
+         EXPECT_EQ(f.GetClassIndex()->fArray[number], 1);
+      }
+      auto named = f.Get<TNamed>("named");
+      ASSERT_NE(named, nullptr);
+      EXPECT_EQ(filename, named->GetTitle());
+      delete named;
+      gSystem->Unlink(filename.c_str());
+   }
+}
@@ -0,0 +1,97 @@
+#include "gtest/gtest.h"
+
+#include "TBufferFile.h"
+#include "TClass.h"
+#include "TFile.h"
+#include "TSystem.h"
+
+#include "TrivialHit.h"
+
+#include <cstring>
+#include <vector>
+
+namespace {
+std::vector<TrivialHit> MakeHits(int n)
+{
+   std::vector<TrivialHit> hits(n);
+   for (int i = 0; i < n; ++i) {
+      auto &hit = hits[i];
+      hit.fX = 0.5f * i;
+      hit.fY = -1.f * i;
+      hit.fZ = 3.25f;
+      hit.fId = i;
+      hit.fIsNoise = i % 3 == 0;
+      hit.fEnergy = 1e3 * i;
+      hit.fChannels[0] = i;
+      hit.fChannels[1] = -i;
+      hit.fChannels[2] = 7;
+      hit.fCache = 42;
+   }
+   return hits;
+}
+} // anonymous namespace
+
+// The objects in a vector of trivial structs are written with the same bytes as by the struct's streamer
+TEST(TGenCollectionStreamer, TrivialVectorLayout)
+{
+   auto hits = MakeHits(2);
+   TClass *hitClass = TClass::GetClass<TrivialHit>();
+   TClass *vecClass = TClass::GetClass<std::vector<TrivialHit>>();
+   ASSERT_NE(hitClass, nullptr);
+   ASSERT_NE(vecClass, nullptr);
+
+   TBufferFile single(TBuffer::kWrite);
+   single.StreamObject(&hits[1], hitClass);
+   // write twice: the first time builds the StreamerInfo, the second uses the fast path
+   for (int i = 0; i < 2; ++i) {
+      TBufferFile collection(TBuffer::kWrite);
+      collection.StreamObject(&hits, vecClass);
+      ASSERT_GE(collection.Length(), 2 * single.Length());
+      EXPECT_EQ(0, memcmp(collection.Buffer() + collection.Length() - single.Length(), single.Buffer(),
+                          single.Length()));
+   }
+}
+
+TEST(TGenCollectionStreamer, TrivialVectorRoundTrip)
+{
+   auto filename{"tgencollectionstreamer_trivial.root"};
+   const auto hits = MakeHits(1000);
+   std::vector<NonTrivialHit> nonTrivial(10);
+   for (int i = 0; i < 10; ++i) {
+      nonTrivial[i].fX = i;
+      nonTrivial[i].fDetector = "det" + std::to_string(i);
+   }
+   {
+      TFile f(filename, "RECREATE");
+      f.WriteObject(&hits, "hits");
+      f.WriteObject(&hits, "hits2");
+      f.WriteObject(&nonTrivial, "nonTrivial");
+   }
+
+   TFile f(filename);
+   for (auto name : {"hits", "hits2"}) {
+      auto read = f.Get<std::vector<TrivialHit>>(name);
+      ASSERT_NE(read, nullptr);
+      ASSERT_EQ(read->size(), hits.size());
+      for (std::size_t i = 0; i < hits.size(); ++i) {
+         const auto &a = hits[i];
+         const auto &b = (*read)[i];
+         EXPECT_EQ(a.fX, b.fX);
+         EXPECT_EQ(a.fY, b.fY);
+         EXPECT_EQ(a.fZ, b.fZ);
+         EXPECT_EQ(a.fId, b.fId);
+         EXPECT_EQ(a.fIsNoise, b.fIsNoise);
+         EXPECT_EQ(a.fEnergy, b.fEnergy);
+         for (int c = 0; c < 3; ++c)
+            EXPECT_EQ(a.fChannels[c], b.fChannels[c]);
+         EXPECT_EQ(0, b.fCache);
+      }
+      delete read;
+   }
+   auto readNonTrivial = f.Get<std::vector<NonTrivialHit>>("nonTrivial");
+   ASSERT_NE(readNonTrivial, nullptr);
+   ASSERT_EQ(readNonTrivial->size(), 10u);
+   EXPECT_EQ((*readNonTrivial)[9].fDetector, "det9");
+   delete readNonTrivial;
+   gSystem->Unlink(filename);
+}
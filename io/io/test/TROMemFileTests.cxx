@@ -1,7 +1,12 @@
 #include "TMemFile.h"
+#include "TSharedMemFile.h"
 
 #include "TError.h"
 #include <cstring>
+#ifndef _WIN32
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
 
 #include "gtest/gtest.h"
 
@@ -84,3 +89,40 @@ TEST(TROMemFile, RealNoMemCopy)
    };
    ASSERT_EQ(expected.c_str(), MemBlockPtrGetter::GetBlockStart(&rosmf));
 }
+
+#ifndef _WIN32
+TEST(TROMemFile, SharedMemory)
+{
+   constexpr const char title[] = "This is a title for TMemFile shared memory test";
+   const std::string segment = "/TROMemFileTests-" + std::to_string(getpid());
+
+   // The file is produced by a child process, like a TProcessExecutor worker
+   auto pid = fork();
+   ASSERT_NE(-1, pid);
+   if (pid == 0) {
+      TNamed n("name", title);
+      TMemFile memFile("a.root", "RECREATE");
+      memFile.WriteTObject(&n);
+      memFile.Write();
+      _exit(TSharedMemFile::Publish(memFile, segment.c_str()) ? 0 : 1);
+   }
+   int status = 0;
+   ASSERT_EQ(pid, waitpid(pid, &status, 0));
+   ASSERT_TRUE(WIFEXITED(status));
+   ASSERT_EQ(0, WEXITSTATUS(status));
+
+   {
+      TSharedMemFile shmFile(segment.c_str(), kFALSE);
+      ASSERT_FALSE(shmFile.IsZombie());
+      TObject *readN = shmFile.Get("name");
+      ASSERT_NE(nullptr, readN);
+      EXPECT_STREQ(title, readN->GetTitle());
+   }
+   {
+      // Opening it again, the segment is unlinked
+      TSharedMemFile shmFile(segment.c_str());
+      ASSERT_FALSE(shmFile.IsZombie());
+   }
+   EXPECT_FALSE(TSharedMemFile::Unlink(segment.c_str()));
+}
+#endif
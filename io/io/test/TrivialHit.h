@@ -0,0 +1,24 @@
+#ifndef ROOT_TEST_TrivialHit
+#define ROOT_TEST_TrivialHit
+
+#include <string>
+
+// Streamed by copying its data members, see TGenCollectionStreamer::HasTrivialValueLayout()
+struct TrivialHit {
+   float fX = 0;
+   float fY = 0;
+   float fZ = 0;
+   int fId = 0;
+   bool fIsNoise = false;
+   double fEnergy = 0;
+   short fChannels[3] = {0, 0, 0};
+   int fCache = 0; //! transient, not streamed
+};
+
+// Streamed member-wise by its StreamerInfo
+struct NonTrivialHit {
+   float fX = 0;
+   std::string fDetector;
+};
+
+#endif
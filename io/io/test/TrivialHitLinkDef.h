@@ -0,0 +1,8 @@
+#ifdef __CLING__
+
+#pragma link C++ class TrivialHit+;
+#pragma link C++ class NonTrivialHit+;
+#pragma link C++ class std::vector<TrivialHit>+;
+#pragma link C++ class std::vector<NonTrivialHit>+;
+
+#endif
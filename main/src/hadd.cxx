@@ -27,6 +27,9 @@
   \param -O   Re-optimize basket size when merging TTree
   \param -v   Explicitly set the verbosity level: 0 request no output, 99 is the default
   \param -j   Parallelise the execution in multiple processes
+  \param -mt  Read and merge the histograms with `n` threads (0 or no number: one per logical core), without
+              partial files. Trees that are recompressed (e.g. with -f) also use these threads to unzip and
+              compress their baskets
   \param -dbg  Parallelise the execution in multiple processes in debug mode (Does not delete  partial  files  stored
               inside working directory)
   \param -d   Carry out the partial multiprocess execution in the specified directory
@@ -140,6 +143,7 @@ int main( int argc, char **argv )
    Bool_t useFirstInputCompression = kFALSE;
    Bool_t multiproc = kFALSE;
    Bool_t debug = kFALSE;
+   UInt_t nThreads = 1;
    Int_t maxopenedfiles = 0;
    Int_t verbosity = 99;
    TString cacheSize;
@@ -213,6 +217,22 @@ int main( int argc, char **argv )
          }
          multiproc = kTRUE;
          ++ffirst;
+      } else if (strcmp(argv[a], "-mt") == 0) {
+         // If the number of threads is not specified, use one per logical core.
+         nThreads = 0;
+         if (a + 1 != argc && isdigit(argv[a + 1][0])) {
+            char *end = nullptr;
+            const auto request = strtol(argv[a + 1], &end, 10);
+            if (*end == '\0' && request < kMaxInt) {
+               nThreads = (UInt_t)request;
+               ++a;
+               ++ffirst;
+            } else {
+               std::cerr << "Error: could not parse the number of threads passed after -mt: " << argv[a + 1]
+                         << ". We will use the default value (number of logical cores).\n";
+            }
+         }
+         ++ffirst;
       } else if ( strcmp(argv[a],"-cachesize=") == 0 ) {
          int size;
          static const size_t arglen = strlen("-cachesize=");
@@ -377,6 +397,7 @@ int main( int argc, char **argv )
    TFileMerger fileMerger(kFALSE, kFALSE);
    fileMerger.SetMsgPrefix("hadd");
    fileMerger.SetPrintLevel(verbosity - 1);
+   fileMerger.SetNThreads(nThreads);
    if (maxopenedfiles > 0) {
       fileMerger.SetMaxOpenedFiles(maxopenedfiles);
    }
@@ -20,7 +20,15 @@ int main(int argc, char **argv)
    if (!args.fShouldRun)
       return 1; // ParseArgs has printed the --help, has run the --test or has encountered an issue and logged about it
 
-   PrintThroughput(EvalThroughput(args.fData, args.fNThreads));
+   if (args.fScalingNThreads.empty()) {
+      PrintThroughput(EvalThroughput(args.fData, args.fNThreads));
+      return 0;
+   }
+
+   std::vector<Result> results;
+   for (auto nThreads : args.fScalingNThreads)
+      results.emplace_back(EvalThroughput(args.fData, nThreads));
+   PrintScaling(results);
 
    return 0;
 }
@@ -0,0 +1,96 @@
+// @(#)root/fft:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include "FFTWPlanCache.h"
+
+#include "TEnv.h"
+#include "TError.h"
+#ifdef R__USE_IMT
+#include "TROOT.h"
+#endif
+
+#include <mutex>
+#include <unordered_map>
+
+namespace {
+
+class TPlanCache {
+private:
+   std::mutex fMutex;
+   std::unordered_map<std::string, fftw_plan> fPlans;
+   std::string fWisdomFile;
+   Int_t fNThreads = 1;
+   Long64_t fThreadsMinSize = 0;
+   bool fHasNewPlans = false;
+
+public:
+   TPlanCache()
+   {
+      fWisdomFile = gEnv->GetValue("FFTW.WisdomFile", "");
+      if (!fWisdomFile.empty())
+         fftw_import_wisdom_from_filename(fWisdomFile.c_str());
+#ifdef R__HAS_FFTW_THREADS
+      fNThreads = gEnv->GetValue("FFTW.NThreads", 1);
+#ifdef R__USE_IMT
+      if (fNThreads == 0)
+         fNThreads = ROOT::IsImplicitMTEnabled() ? ROOT::GetThreadPoolSize() : 1;
+#endif
+      fThreadsMinSize = gEnv->GetValue("FFTW.ThreadsMinSize", 65536);
+      if (fNThreads > 1 && !fftw_init_threads()) {
+         ::Warning("TPlanCache", "FFTW could not initialize its threads, using one thread");
+         fNThreads = 1;
+      }
+#endif
+   }
+
+   // The plans are not destroyed, as static transform objects might still use them
+   ~TPlanCache()
+   {
+      if (fHasNewPlans && !fWisdomFile.empty() && !fftw_export_wisdom_to_filename(fWisdomFile.c_str()))
+         ::Warning("TPlanCache", "FFTW could not write its wisdom to %s", fWisdomFile.c_str());
+   }
+
+   fftw_plan GetPlan(const std::string &key, Long64_t totalSize, const std::function<fftw_plan()> &makePlan)
+   {
+      // the FFTW planner is not thread safe
+      std::lock_guard<std::mutex> lock(fMutex);
+      auto &plan = fPlans[key];
+      if (!plan) {
+#ifdef R__HAS_FFTW_THREADS
+         if (fNThreads > 1)
+            fftw_plan_with_nthreads(totalSize >= fThreadsMinSize ? fNThreads : 1);
+#else
+         (void)totalSize;
+#endif
+         plan = makePlan();
+         fHasNewPlans = true;
+      }
+      return plan;
+   }
+};
+
+} // namespace
+
+fftw_plan ROOT::Internal::FFTW::GetPlan(const std::string &key, Long64_t totalSize,
+                                         const std::function<fftw_plan()> &makePlan)
+{
+   static TPlanCache cache;
+   return cache.GetPlan(key, totalSize, makePlan);
+}
+
+std::string ROOT::Internal::FFTW::MakeKey(const char *kind, Int_t ndim, const Int_t *n, bool inPlace, UInt_t flags)
+{
+   std::string key = kind;
+   for (Int_t i = 0; i < ndim; i++)
+      key += "_" + std::to_string(n[i]);
+   key += inPlace ? "_inplace_" : "_outofplace_";
+   key += std::to_string(flags);
+   return key;
+}
@@ -0,0 +1,41 @@
+// @(#)root/fft:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_FFTWPlanCache
+#define ROOT_FFTWPlanCache
+
+#include "RtypesCore.h"
+#include "fftw3.h"
+
+#include <functional>
+#include <string>
+
+namespace ROOT {
+namespace Internal {
+namespace FFTW {
+
+/// Returns the plan of the transform identified by `key`, which must encode the kind, direction, sizes, in-place
+/// property and planner flags of the transform. The plan is created with `makePlan` if it is not cached yet.
+///
+/// The plans are shared by all the transform objects of the process and live until the end of the process; they
+/// must be executed with the new-array execute functions (e.g. fftw_execute_dft()) on arrays allocated with
+/// fftw_malloc(). Transforms with at least `FFTW.ThreadsMinSize` points are planned with `FFTW.NThreads` threads
+/// if FFTW was built with thread support. If `FFTW.WisdomFile` is set in the rootrc, the wisdom is read from the
+/// file before the first plan is created and written back at the end of the process.
+fftw_plan GetPlan(const std::string &key, Long64_t totalSize, const std::function<fftw_plan()> &makePlan);
+
+/// Appends the sizes of a transform to a plan cache key
+std::string MakeKey(const char *kind, Int_t ndim, const Int_t *n, bool inPlace, UInt_t flags);
+
+} // namespace FFTW
+} // namespace Internal
+} // namespace ROOT
+
+#endif
@@ -37,9 +37,15 @@
 ///       2. FFTW computes unnormalized transform, so doing a transform followed by
 ///          its inverse will lead to the original array scaled by the transform size
 ///
+/// The plans of all the FFTW interface classes are kept in a process-wide cache, so
+/// that transforms of the same size, type and flags are only planned once. The cache
+/// can persist the FFTW wisdom in a file, and plan large transforms to run on several
+/// threads, see the `FFTW.*` settings in the system.rootrc.
+///
 ////////////////////////////////////////////////////////////////////////////////
 
 #include "TFFTComplex.h"
+#include "FFTWPlanCache.h"
 #include "fftw3.h"
 #include "TComplex.h"
 
@@ -102,13 +108,11 @@ TFFTComplex::TFFTComplex(Int_t ndim, Int_t *n, Bool_t inPlace)
 }
 
 ////////////////////////////////////////////////////////////////////////////////
-///Destroys the data arrays and the plan. However, some plan information stays around
-///until the root session is over, and is reused if other plans of the same size are
-///created
+///Destroys the data arrays. The plan stays in the plan cache until the root session
+///is over, and is reused by other transforms of the same size and type
 
 TFFTComplex::~TFFTComplex()
 {
-   fftw_destroy_plan((fftw_plan)fPlan);
    fPlan = 0;
    fftw_free((fftw_complex*)fIn);
    if (fOut)
@@ -142,14 +146,11 @@ void TFFTComplex::Init( Option_t *flags, Int_t sign,const Int_t* /*kind*/)
    fSign = sign;
    fFlags = flags;
 
-   if (fPlan)
-      fftw_destroy_plan((fftw_plan)fPlan);
-   fPlan = 0;
-
-   if (fOut)
-      fPlan = (void*)fftw_plan_dft(fNdim, fN, (fftw_complex*)fIn, (fftw_complex*)fOut, sign,MapFlag(flags));
-   else
-      fPlan = (void*)fftw_plan_dft(fNdim, fN, (fftw_complex*)fIn, (fftw_complex*)fIn, sign, MapFlag(flags));
+   const UInt_t flag = MapFlag(flags);
+   const std::string key = ROOT::Internal::FFTW::MakeKey(sign == FFTW_FORWARD ? "c2c_fw" : "c2c_bw", fNdim, fN, !fOut, flag);
+   fPlan = (void*)ROOT::Internal::FFTW::GetPlan(key, fTotalSize, [&]() {
+      return fftw_plan_dft(fNdim, fN, (fftw_complex*)fIn, (fftw_complex*)(fOut ? fOut : fIn), sign, flag);
+   });
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -158,7 +159,7 @@ void TFFTComplex::Init( Option_t *flags, Int_t sign,const Int_t* /*kind*/)
 void TFFTComplex::Transform()
 {
    if (fPlan)
-      fftw_execute((fftw_plan)fPlan);
+      fftw_execute_dft((fftw_plan)fPlan, (fftw_complex*)fIn, (fftw_complex*)(fOut ? fOut : fIn));
    else {
       Error("Transform", "transform not initialised");
       return;
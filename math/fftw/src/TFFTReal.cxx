@@ -59,6 +59,7 @@
 ////////////////////////////////////////////////////////////////////////////////
 
 #include "TFFTReal.h"
+#include "FFTWPlanCache.h"
 #include "fftw3.h"
 
 ClassImp(TFFTReal);
@@ -123,7 +124,6 @@ TFFTReal::TFFTReal(Int_t ndim, Int_t *n, Bool_t inPlace)
 
 TFFTReal::~TFFTReal()
 {
-   fftw_destroy_plan((fftw_plan)fPlan);
    fPlan = 0;
    fftw_free(fIn);
    fIn = 0;
@@ -175,18 +175,20 @@ TFFTReal::~TFFTReal()
 
 void TFFTReal::Init( Option_t* flags,Int_t /*sign*/, const Int_t *kind)
 {
-   if (fPlan)
-      fftw_destroy_plan((fftw_plan)fPlan);
    fPlan = 0;
 
    if (!fKind)
       fKind = (fftw_r2r_kind*)fftw_malloc(sizeof(fftw_r2r_kind)*fNdim);
 
    if (MapOptions(kind)){
-      if (fOut)
-         fPlan = (void*)fftw_plan_r2r(fNdim, fN, (Double_t*)fIn, (Double_t*)fOut, (fftw_r2r_kind*)fKind, MapFlag(flags));
-      else
-         fPlan = (void*)fftw_plan_r2r(fNdim, fN, (Double_t*)fIn, (Double_t*)fIn, (fftw_r2r_kind*)fKind, MapFlag(flags));
+      const UInt_t flag = MapFlag(flags);
+      std::string kindName = "r2r";
+      for (Int_t i=0; i<fNdim; i++)
+         kindName += "_" + std::to_string(((fftw_r2r_kind*)fKind)[i]);
+      const std::string key = ROOT::Internal::FFTW::MakeKey(kindName.c_str(), fNdim, fN, !fOut, flag);
+      fPlan = (void*)ROOT::Internal::FFTW::GetPlan(key, fTotalSize, [&]() {
+         return fftw_plan_r2r(fNdim, fN, (Double_t*)fIn, (Double_t*)(fOut ? fOut : fIn), (fftw_r2r_kind*)fKind, flag);
+      });
       fFlags = flags;
    }
 }
@@ -197,7 +199,7 @@ void TFFTReal::Init( Option_t* flags,Int_t /*sign*/, const Int_t *kind)
 void TFFTReal::Transform()
 {
    if (fPlan)
-      fftw_execute((fftw_plan)fPlan);
+      fftw_execute_r2r((fftw_plan)fPlan, (Double_t*)fIn, (Double_t*)(fOut ? fOut : fIn));
    else {
       Error("Transform", "transform hasn't been initialised");
       return;
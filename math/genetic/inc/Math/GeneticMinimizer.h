@@ -42,6 +42,10 @@ struct GeneticMinimizerParameters {
    Double_t fSC_factor;
    Double_t fConvCrit;
    Int_t fSeed;
+   bool fParallel;            ///< evaluate in parallel with implicit multi-threading; the function must be thread safe
+   Int_t fNIslands;           ///< number of populations evolved independently (island model)
+   Int_t fMigrationInterval;  ///< number of iterations between two migrations of individuals between the islands
+   Int_t fNMigrants;          ///< number of best individuals copied from every island to the next one
 
 
    // constructor with default value
@@ -56,6 +60,12 @@ struct GeneticMinimizerParameters {
 
    Minimizer class based on the Gentic algorithm implemented in TMVA
 
+   With the option `Parallel` (GeneticMinimizerParameters::fParallel) and implicit multi-threading enabled, the
+   fitness of the individuals of the population is evaluated in parallel; the objective function must then be
+   thread safe. With `Islands` larger than one, several populations are evolved independently, in parallel if
+   `Parallel` is set, and the best `Migrants` individuals of every island are copied to the next island every
+   `MigrationInterval` iterations. The best individual of all islands is the result.
+
    @ingroup MultiMin
 */
 class GeneticMinimizer: public ROOT::Math::Minimizer {
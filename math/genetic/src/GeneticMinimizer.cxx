@@ -7,8 +7,18 @@
 #include "Math/GenAlgoOptions.h"
 
 #include "TError.h"
+#include "TROOT.h"
 
+#ifdef R__USE_IMT
+#include "ROOT/TThreadExecutor.hxx"
+#include "ROOT/TSeq.hxx"
+#endif
+
+#include <algorithm>
+#include <atomic>
 #include <cassert>
+#include <cfloat>
+#include <memory>
 
 namespace ROOT {
 namespace Math {
@@ -17,17 +27,21 @@ namespace Math {
 // wrapper class for TMVA interface to evaluate objective function
 class MultiGenFunctionFitness : public TMVA::IFitterTarget {
 private:
-   unsigned int fNCalls;
+   std::atomic<unsigned int> fNCalls;
    unsigned int fNFree;
    const ROOT::Math::IMultiGenFunction& fFunc;
    std::vector<int> fFixedParFlag;
    mutable std::vector<double> fValues;
+   bool fThreadSafe; // the function is evaluated concurrently
 
 public:
    MultiGenFunctionFitness(const ROOT::Math::IMultiGenFunction& function) : fNCalls(0),
-                                                                            fFunc(function)
+                                                                            fFunc(function),
+                                                                            fThreadSafe(false)
    { fNFree = fFunc.NDim(); }
 
+   void SetThreadSafe(bool on) { fThreadSafe = on; }
+
    unsigned int NCalls() const { return fNCalls; }
    unsigned int NDims() const { return fNFree; }
 
@@ -73,9 +87,60 @@ public:
       return fFunc(&x[0]);
    }
 
+   // same as Evaluate, without using the internal vector of parameter values, so that it can be called concurrently
+   Double_t EvaluateThreadSafe(const std::vector<double> & factors ) const {
+      unsigned int n = fValues.size();
+      if (n == 0 || fNFree == n )
+         return fFunc(&factors[0]);
+
+      std::vector<double> x(fValues);
+      for (unsigned int i = 0, j = 0; i < n ; ++i) {
+         if (!fFixedParFlag[i] ) {
+            assert (j < fNFree);
+            x[i] = factors[j];
+            j++;
+         }
+      }
+      return fFunc(&x[0]);
+   }
+
    Double_t EstimatorFunction(std::vector<double> & factors ) override{
       fNCalls += 1;
-      return Evaluate( factors);
+      return (fThreadSafe) ? EvaluateThreadSafe( factors) : Evaluate( factors);
+   }
+};
+
+// genetic algorithm evaluating the fitness of the individuals of the population in parallel
+class ParallelGeneticAlgorithm : public TMVA::GeneticAlgorithm {
+private:
+   bool fParallel;
+
+public:
+   ParallelGeneticAlgorithm(TMVA::IFitterTarget& target, Int_t populationSize,
+                            const std::vector<TMVA::Interval*>& ranges, UInt_t seed, bool parallel) :
+      TMVA::GeneticAlgorithm(target, populationSize, ranges, seed),
+      fParallel(parallel)
+   {}
+
+   Double_t CalculateFitness() override {
+#ifdef R__USE_IMT
+      if (fParallel && ROOT::IsImplicitMTEnabled()) {
+         // every individual is evaluated by one task, the result does not depend on the number of threads
+         ROOT::TThreadExecutor pool;
+         pool.Foreach([this](Int_t index) {
+               TMVA::GeneticGenes* genes = fPopulation.GetGenes(index);
+               genes->SetFitness( NewFitness( genes->GetFitness(),
+                                              fFitterTarget.EstimatorFunction(genes->GetFactors()) ) );
+            }, ROOT::TSeq<Int_t>(0, fPopulation.GetPopulationSize()));
+
+         fBestFitness = DBL_MAX;
+         for ( int index = 0; index < fPopulation.GetPopulationSize(); ++index )
+            fBestFitness = std::min(fBestFitness, fPopulation.GetGenes(index)->GetFitness());
+         fPopulation.Sort();
+         return fBestFitness;
+      }
+#endif
+      return TMVA::GeneticAlgorithm::CalculateFitness();
    }
 };
 
@@ -92,6 +157,10 @@ GeneticMinimizerParameters::GeneticMinimizerParameters()
    fConvCrit =10.0 * ROOT::Math::MinimizerOptions::DefaultTolerance(); // default is 0.001
    if (fConvCrit <=0 ) fConvCrit = 0.001;
    fSeed=0;  // random seed
+   fParallel = false;
+   fNIslands = 1;
+   fMigrationInterval = 10;
+   fNMigrants = 5;
 }
 
 // genetic minimizer class
@@ -211,6 +280,10 @@ void  GeneticMinimizer::GetGeneticOptions(ROOT::Math::MinimizerOptions & opt) co
    geneticOpt.SetValue("SC_factor",fParameters.fSC_factor);
    geneticOpt.SetValue("ConvCrit",fParameters.fConvCrit);
    geneticOpt.SetValue("RandomSeed",fParameters.fSeed);
+   geneticOpt.SetValue("Parallel",int(fParameters.fParallel));
+   geneticOpt.SetValue("Islands",fParameters.fNIslands);
+   geneticOpt.SetValue("MigrationInterval",fParameters.fMigrationInterval);
+   geneticOpt.SetValue("Migrants",fParameters.fNMigrants);
 
    opt.SetExtraOptions(geneticOpt);
 }
@@ -240,6 +313,12 @@ void GeneticMinimizer::SetOptions(const ROOT::Math::MinimizerOptions & opt)
    geneticOpt->GetValue("SC_factor",fParameters.fSC_factor);
    geneticOpt->GetValue("ConvCrit",fParameters.fConvCrit);
    geneticOpt->GetValue("RandomSeed",fParameters.fSeed);
+   int parallel = fParameters.fParallel;
+   geneticOpt->GetValue("Parallel",parallel);
+   fParameters.fParallel = parallel;
+   geneticOpt->GetValue("Islands",fParameters.fNIslands);
+   geneticOpt->GetValue("MigrationInterval",fParameters.fMigrationInterval);
+   geneticOpt->GetValue("Migrants",fParameters.fNMigrants);
 
    // use same of options in base class
    int maxiter = opt.MaxIterations();
@@ -262,16 +341,39 @@ bool GeneticMinimizer::Minimize()
    if (MaxIterations() > 0) fParameters.fNsteps = MaxIterations();
    if (Tolerance() > 0) fParameters.fConvCrit = 10* Tolerance();
 
-   TMVA::GeneticAlgorithm mg( *fFitness, fParameters.fPopSize, fRanges, fParameters.fSeed );
+   // with several islands, the islands are evolved in parallel, otherwise the individuals of the population are
+   // evaluated in parallel
+   const int nIslands = std::max(1, fParameters.fNIslands);
+   const bool parallelIslands = fParameters.fParallel && nIslands > 1;
+   static_cast<MultiGenFunctionFitness*>(fFitness)->SetThreadSafe(fParameters.fParallel);
+   std::vector<std::unique_ptr<ParallelGeneticAlgorithm>> islands;
+   for (int i = 0; i < nIslands; ++i) {
+      // a seed of zero gives a different random sequence to every population
+      UInt_t seed = (fParameters.fSeed != 0) ? fParameters.fSeed + i : 0;
+      islands.emplace_back(new ParallelGeneticAlgorithm(*fFitness, fParameters.fPopSize, fRanges, seed,
+                                                        fParameters.fParallel && !parallelIslands));
+   }
 
    if (PrintLevel() > 0) {
       std::cout << "GeneticMinimizer::Minimize  - Start iterating - max iterations = " <<  MaxIterations()
                 << " conv criteria (tolerance) =  "   << fParameters.fConvCrit << std::endl;
+      if (nIslands > 1)
+         std::cout << "\tusing " << nIslands << " islands, exchanging " << fParameters.fNMigrants
+                   << " individuals every " << fParameters.fMigrationInterval << " iterations" << std::endl;
    }
 
-   fStatus = 0;
-   unsigned int niter = 0;
-   do {
+   // the island with the best individual
+   auto bestIsland = [&]() -> TMVA::GeneticAlgorithm & {
+      int best = 0;
+      for (int i = 1; i < nIslands; ++i) {
+         if (islands[i]->GetGeneticPopulation().GetFitness() < islands[best]->GetGeneticPopulation().GetFitness())
+            best = i;
+      }
+      return *islands[best];
+   };
+
+   auto evolve = [&](int i) {
+      TMVA::GeneticAlgorithm &mg = *islands[i];
       mg.Init();
 
       mg.CalculateFitness();
@@ -282,10 +384,26 @@ bool GeneticMinimizer::Minimize()
       mg.GetGeneticPopulation().TrimPopulation();
 
       mg.SpreadControl( fParameters.fSC_steps, fParameters.fSC_rate, fParameters.fSC_factor );
+   };
+
+   fStatus = 0;
+   unsigned int niter = 0;
+   bool converged = false;
+   do {
+#ifdef R__USE_IMT
+      if (parallelIslands && ROOT::IsImplicitMTEnabled()) {
+         ROOT::TThreadExecutor pool;
+         pool.Foreach(evolve, ROOT::TSeq<int>(0, nIslands));
+      } else
+#endif
+      {
+         for (int i = 0; i < nIslands; ++i)
+            evolve(i);
+      }
 
       if (PrintLevel() > 2) {
          std::cout << "New Iteration " << niter << " with  parameter values :" << std::endl;
-         TMVA::GeneticGenes* genes = mg.GetGeneticPopulation().GetGenes( 0 );
+         TMVA::GeneticGenes* genes = bestIsland().GetGeneticPopulation().GetGenes( 0 );
          if (genes) {
             std::vector<Double_t> gvec;
             gvec = genes->GetFactors();
@@ -297,6 +415,24 @@ bool GeneticMinimizer::Minimize()
          }
       }
       niter++;
+
+      // migration: the best individuals of every island are copied to the next island (ring topology), where
+      // they replace the worst ones
+      if (nIslands > 1 && fParameters.fMigrationInterval > 0 && niter % fParameters.fMigrationInterval == 0) {
+         std::vector<std::vector<TMVA::GeneticGenes>> migrants(nIslands);
+         for (int i = 0; i < nIslands; ++i) {
+            const auto &pool = islands[i]->GetGeneticPopulation().GetGenePool();
+            const int nMigrants = std::min<int>(fParameters.fNMigrants, pool.size());
+            migrants[i].assign(pool.begin(), pool.begin() + nMigrants);
+         }
+         for (int i = 0; i < nIslands; ++i) {
+            TMVA::GeneticPopulation &population = islands[(i + 1) % nIslands]->GetGeneticPopulation();
+            for (auto &genes : migrants[i])
+               population.GiveHint(genes.GetFactors(), genes.GetFitness());
+            population.TrimPopulation();
+         }
+      }
+
       if ( niter > MaxIterations() && MaxIterations() > 0) {
          if (PrintLevel() > 0) {
             Info("GeneticMinimizer::Minimize","Max number of iterations %d reached - stop iterating",MaxIterations());
@@ -305,9 +441,13 @@ bool GeneticMinimizer::Minimize()
          break;
       }
 
-   } while (!mg.HasConverged( fParameters.fNsteps, fParameters.fConvCrit ));  // converged if: fitness-improvement < CONVCRIT within the last CONVSTEPS loops
+      // converged if: fitness-improvement < CONVCRIT within the last CONVSTEPS loops, for every island
+      converged = true;
+      for (int i = 0; i < nIslands; ++i)
+         converged &= islands[i]->HasConverged( fParameters.fNsteps, fParameters.fConvCrit );
+   } while (!converged);
 
-   TMVA::GeneticGenes* genes = mg.GetGeneticPopulation().GetGenes( 0 );
+   TMVA::GeneticGenes* genes = bestIsland().GetGeneticPopulation().GetGenes( 0 );
    std::vector<Double_t> gvec;
    gvec = genes->GetFactors();
 
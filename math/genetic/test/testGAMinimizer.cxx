@@ -3,6 +3,7 @@
 #include "Math/GeneticMinimizer.h"
 
 #include "TMath.h"
+#include "TROOT.h"
 
 using std::cout;
 using std::endl;
@@ -121,6 +122,32 @@ int testGAMinimizer(int verbose = 0) {
    if (!ok) Error("testGAMinimizer","Test failed for MultiMin");
    status |= !ok;
 
+   if (verbose) {
+      cout << "****************************************************\n";
+      cout << "MultiMinima Function Minimization with parallel islands \n";
+   }
+#ifdef R__USE_IMT
+   ROOT::EnableImplicitMT(4);
+#endif
+   ROOT::Math::GeneticMinimizer gaIslands;
+   ROOT::Math::GeneticMinimizerParameters islandParams;
+   islandParams.fParallel = true;
+   islandParams.fNIslands = 4;
+   islandParams.fPopSize = 100;
+   islandParams.fSeed = 111;
+   gaIslands.SetParameters(islandParams);
+   gaIslands.SetFunction(multimin);
+   gaIslands.SetLimitedVariable(0, "x", 0, 0, -5, +5);
+   gaIslands.SetPrintLevel(verbose);
+   gaIslands.Minimize();
+#ifdef R__USE_IMT
+   ROOT::DisableImplicitMT();
+#endif
+   cout << "MultiMin (islands) min:" << gaIslands.MinValue() << "  x = [" << gaIslands.X()[0] << "]" << endl;
+   ok =  (std::abs(gaIslands.MinValue() + 0.8982) < 1.E-3 );
+   if (!ok) Error("testGAMinimizer","Test failed for MultiMin with parallel islands");
+   status |= !ok;
+
    if (status) cout << "Test Failed !" << endl;
    else cout << "Done!" << endl;
 
@@ -234,6 +234,26 @@ public :
       return &fDataPtr[ipoint];
    }
 
+   /**
+      return the values of all the fit points, stored contiguously
+   */
+   std::span<const double> GetValueData() const
+   {
+      return std::span<const double>(fDataPtr, fNPoints);
+   }
+
+   /**
+      return the inverse errors on the values of all the fit points, stored contiguously.
+      They are stored only for the data with value errors (e.g. from histograms) which are not wrapped;
+      for the other data an empty span is returned and InvError() must be used.
+   */
+   std::span<const double> GetInvErrorData() const
+   {
+      if (fErrorType != kValueError || fWrapped)
+         return std::span<const double>();
+      return std::span<const double>(fDataErrorPtr, fNPoints);
+   }
+
    /**
       Return a pointer to the error (or the inverse error) on the value for a given point
       depending on the type of data.
@@ -126,6 +126,18 @@ public:
                                              fExecutionPolicy);
    }
 
+   /// evaluate the chi2 and its gradient in a single pass over the data
+   virtual void FdF(const double *x, double &f, double *g) const {
+      if (BaseFCN::Data().HaveCoordErrors() || BaseFCN::Data().HaveAsymErrors()) {
+         f = DoEval(x);
+         Gradient(x, g);
+         return;
+      }
+      this->UpdateNCalls();
+      f = FitUtil::Evaluate<T>::EvalChi2AndGradient(BaseFCN::ModelFunction(), BaseFCN::Data(), x, g, fNEffPoints,
+                                                    fExecutionPolicy);
+   }
+
 
    /// get type of fit method function
    virtual  typename BaseObjFunction::Type_t Type() const { return BaseObjFunction::kLeastSquare; }
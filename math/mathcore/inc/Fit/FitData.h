@@ -26,6 +26,8 @@ Classes for describing the input data for fitting
 #include "Fit/DataRange.h"
 #include "Math/Types.h"
 
+#include "ROOT/RSpan.hxx"
+
 #include <vector>
 #include <cassert>
 #include <iostream>
@@ -331,6 +333,17 @@ namespace ROOT {
             return fCoordsPtr;
          }
 
+         /**
+           direct access to the data of the coordinate icoord for all the points, stored contiguously.
+           Data which are not wrapped are padded to a multiple of the SIMD vector size after the last point.
+         */
+         std::span<const double> GetCoordData(unsigned int icoord) const
+         {
+            assert(icoord < fDim);
+            assert(fCoordsPtr.size() == fDim);
+            return std::span<const double>(fCoordsPtr[icoord], fNPoints);
+         }
+
 
       protected:
          void UnWrap()
@@ -286,6 +286,15 @@ namespace FitUtil {
                             ::ROOT::EExecutionPolicy executionPolicy = ::ROOT::EExecutionPolicy::kSequential,
                             unsigned nChunks = 0);
 
+  /**
+      evaluate the Chi2 and its gradient given a model function and the data at the point p, in a single pass
+      over the data. Return the Chi2 and also nPoints as the effective number of used points in the gradient
+  */
+  double EvaluateChi2AndGradient(const IModelFunction &func, const BinData &data, const double *p, double *grad,
+                                 unsigned int &nPoints,
+                                 ::ROOT::EExecutionPolicy executionPolicy = ::ROOT::EExecutionPolicy::kSequential,
+                                 unsigned nChunks = 0);
+
   /**
       evaluate the LogL given a model function and the data at the point x.
       return also nPoints as the effective number of used points in the LogL evaluation
@@ -389,27 +398,40 @@ namespace FitUtil {
          (const_cast<IModelFunctionTempl<T> &>(func)).SetParameters(p);
 
          double maxResValue = std::numeric_limits<double>::max() / n;
-         std::vector<double> ones{1., 1., 1., 1.};
          auto vecSize = vecCore::VectorSize<T>();
 
+         // contiguous (padded) arrays of the coordinates, values and inverse errors
+         const unsigned int ndim = data.NDim();
+         std::vector<const double *> coords(ndim);
+         for (unsigned int j = 0; j < ndim; ++j)
+            coords[j] = data.GetCoordData(j).data();
+         const double *values = data.GetValueData().data();
+         const double *invErrors = data.GetInvErrorData().data();
+         // wrapped data store the errors and not their inverse
+         const double *errors = (!invErrors && data.GetErrorType() != BinData::kNoError) ? data.ErrorPtr(0) : nullptr;
+
          auto mapFunction = [&](unsigned int i) {
-            // in case of no error in y invError=1 is returned
-            T x1, y, invErrorVec;
-            vecCore::Load<T>(x1, data.GetCoordComponent(i * vecSize, 0));
-            vecCore::Load<T>(y, data.ValuePtr(i * vecSize));
-            const auto invError = data.ErrorPtr(i * vecSize);
-            auto invErrorptr = (invError != nullptr) ? invError : &ones.front();
-            vecCore::Load<T>(invErrorVec, invErrorptr);
+            // in case of no error in y invError=1 is used
+            T y, invErrorVec(1.);
+            vecCore::Load<T>(y, values + i * vecSize);
+            if (invErrors) {
+               vecCore::Load<T>(invErrorVec, invErrors + i * vecSize);
+            } else if (errors) {
+               T errorVec;
+               vecCore::Load<T>(errorVec, errors + i * vecSize);
+               invErrorVec = T(1.) / errorVec;
+            }
 
             const T *x;
+            T x1;
             std::vector<T> xc;
-            if(data.NDim() > 1) {
-               xc.resize(data.NDim());
-               xc[0] = x1;
-               for (unsigned int j = 1; j < data.NDim(); ++j)
-                  vecCore::Load<T>(xc[j], data.GetCoordComponent(i * vecSize, j));
+            if (ndim > 1) {
+               xc.resize(ndim);
+               for (unsigned int j = 0; j < ndim; ++j)
+                  vecCore::Load<T>(xc[j], coords[j] + i * vecSize);
                x = xc.data();
             } else {
+               vecCore::Load<T>(x1, coords[0] + i * vecSize);
                x = &x1;
             }
 
@@ -908,29 +930,37 @@ namespace FitUtil {
          // numVectors + 1 because of the padded data (call to mapFunction with i = numVectors after the main loop)
          std::vector<vecCore::Mask<T>> validPointsMasks(numVectors + 1);
 
+         // contiguous (padded) arrays of the coordinates, values and inverse errors
+         const unsigned int ndim = data.NDim();
+         std::vector<const double *> coords(ndim);
+         for (unsigned int j = 0; j < ndim; ++j)
+            coords[j] = data.GetCoordData(j).data();
+         const double *values = data.GetValueData().data();
+         const double *invErrors = data.GetInvErrorData().data();
+         // wrapped data store the errors and not their inverse
+         const double *errors = (!invErrors && data.GetErrorType() != BinData::kNoError) ? data.ErrorPtr(0) : nullptr;
+
          auto mapFunction = [&](const unsigned int i) {
             // set all vector values to zero
             std::vector<T> gradFunc(npar);
             std::vector<T> pointContributionVec(npar);
 
-            T x1, y, invError;
+            T x1, y, invError(1.);
 
-            vecCore::Load<T>(x1, data.GetCoordComponent(i * vecSize, 0));
-            vecCore::Load<T>(y, data.ValuePtr(i * vecSize));
-            const auto invErrorPtr = data.ErrorPtr(i * vecSize);
-
-            if (invErrorPtr == nullptr)
-               invError = 1;
-            else
-               vecCore::Load<T>(invError, invErrorPtr);
-
-            // TODO: Check error options and invert if needed
+            vecCore::Load<T>(x1, coords[0] + i * vecSize);
+            vecCore::Load<T>(y, values + i * vecSize);
+            if (invErrors) {
+               vecCore::Load<T>(invError, invErrors + i * vecSize);
+            } else if (errors) {
+               T error;
+               vecCore::Load<T>(error, errors + i * vecSize);
+               invError = T(1.) / error;
+            }
 
             T fval = 0;
 
             const T *x = nullptr;
 
-            unsigned int ndim = data.NDim();
             // need to declare vector outside if statement
             // otherwise pointer will be invalid
             std::vector<T> xc;
@@ -938,7 +968,7 @@ namespace FitUtil {
                xc.resize(ndim);
                xc[0] = x1;
                for (unsigned int j = 1; j < ndim; ++j)
-                  vecCore::Load<T>(xc[j], data.GetCoordComponent(i * vecSize, j));
+                  vecCore::Load<T>(xc[j], coords[j] + i * vecSize);
                x = xc.data();
             } else {
                x = &x1;
@@ -1054,6 +1084,18 @@ namespace FitUtil {
          }
       }
 
+      static double EvalChi2AndGradient(const IModelFunctionTempl<T> &f, const BinData &data, const double *p,
+                                        double *grad, unsigned int &nPoints,
+                                        ::ROOT::EExecutionPolicy executionPolicy =
+                                           ::ROOT::EExecutionPolicy::kSequential,
+                                        unsigned nChunks = 0)
+      {
+         // the vectorized implementation evaluates the chi2 and its gradient in two passes
+         double chi2 = EvalChi2(f, data, p, nPoints, executionPolicy, nChunks);
+         EvalChi2Gradient(f, data, p, grad, nPoints, executionPolicy, nChunks);
+         return chi2;
+      }
+
       static double EvalChi2Residual(const IModelFunctionTempl<T> &, const BinData &, const double *, unsigned int, double *, double *, bool, bool)
       {
          Error("FitUtil::Evaluate<T>::EvalChi2Residual", "The vectorized evaluation of the Chi2 with the ith residual is still not supported");
@@ -1432,6 +1474,14 @@ namespace FitUtil {
       {
          FitUtil::EvaluateChi2Gradient(func, data, p, g, nPoints, executionPolicy, nChunks);
       }
+      static double EvalChi2AndGradient(const IModelFunctionTempl<double> &func, const BinData &data, const double *p,
+                                        double *g, unsigned int &nPoints,
+                                        ::ROOT::EExecutionPolicy executionPolicy =
+                                           ::ROOT::EExecutionPolicy::kSequential,
+                                        unsigned nChunks = 0)
+      {
+         return FitUtil::EvaluateChi2AndGradient(func, data, p, g, nPoints, executionPolicy, nChunks);
+      }
 
       static double EvalChi2Residual(const IModelFunctionTempl<double> &func, const BinData & data, const double * p, unsigned int i, double *g, double * h,
                                     bool hasGrad, bool fullHessian)
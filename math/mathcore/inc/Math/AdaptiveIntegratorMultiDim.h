@@ -18,6 +18,8 @@
 
 #include "Math/VirtualIntegrator.h"
 
+#include <functional>
+
 namespace ROOT {
 namespace Math {
 
@@ -127,6 +129,20 @@ public:
    /// set the integration function (must implement multi-dim function interface: IBaseFunctionMultiDim)
    void SetFunction(const IMultiGenFunction &f) override;
 
+   /// Function computing the integrand at npoints points, whose coordinates are stored one point after the other
+   /// in x (npoints * dimension values)
+   using BatchFunction_t = std::function<void(unsigned int npoints, const double *x, double *result)>;
+
+   /// Set a function computing the integrand at many points at once. It is then used instead of the function
+   /// given with SetFunction() to evaluate the nodes of the integration rule, which are evaluated together for every
+   /// region. SetFunction() must still be called, as it defines the dimension. Pass an empty function to unset it.
+   void SetBatchFunction(BatchFunction_t f) { fBatchFun = std::move(f); }
+
+   /// Evaluate the nodes of the integration rule of every region in parallel, on the implicit multi-threading pool
+   /// (if enabled). The integrand function must then be thread safe. The results do not depend on the number of
+   /// threads.
+   void SetParallel(bool on = true) { fParallel = on; }
+
    /// return result of integration
    double Result() const override { return fResult; }
 
@@ -177,6 +193,9 @@ protected:
    // internal function to compute the integral (if absVal is true compute abs value of function integral
    double DoIntegral(const double* xmin, const double * xmax, bool absVal = false);
 
+   // evaluate the integrand at the npoints points x
+   void EvaluateNodes(unsigned int npoints, const double *x, double *result) const;
+
  private:
 
    unsigned int fDim;     ///< dimensionality of integrand
@@ -193,6 +212,8 @@ protected:
    int fStatus;           ///< status of algorithm (error if not zero)
 
    const IMultiGenFunction* fFun;   // pointer to integrand function
+   BatchFunction_t fBatchFun;       // optional function computing the integrand at many points
+   bool fParallel;                  // evaluate the nodes of a region in parallel
 
 };
 
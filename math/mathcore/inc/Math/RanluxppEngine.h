@@ -38,10 +38,14 @@ public:
    double Rndm() override;
    /// Generate a double-precision random number (non-virtual method)
    double operator()();
+   /// Generate `n` double-precision random numbers, the same as `n` calls to Rndm()
+   void RndmArray(int n, double *array);
    /// Generate a random integer value with 48 bits
    uint64_t IntRndm();
 
-   /// Initialize and seed the state of the generator
+   /// Initialize and seed the state of the generator. The sequences of different
+   /// seeds start 2^96 states apart, hence e.g. the thread index can be used as
+   /// seed to get independent streams for parallel generation.
    void SetSeed(uint64_t seed);
    /// Skip `n` random numbers without generating them
    void Skip(uint64_t n);
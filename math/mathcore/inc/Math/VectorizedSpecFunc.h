@@ -0,0 +1,54 @@
+// @(#)root/mathcore:$Id$
+
+/**********************************************************************
+ *                                                                    *
+ * Copyright (c) 2026 , LCG ROOT MathLib Team                         *
+ *                                                                    *
+ *                                                                    *
+ **********************************************************************/
+
+// Header file for the vectorized special, pdf and cdf functions
+
+#ifndef ROOT_Math_VectorizedSpecFunc
+#define ROOT_Math_VectorizedSpecFunc
+
+#include "RtypesCore.h"
+#include "Math/Types.h"
+
+#include "Math/SpecFuncMathCore.h"
+#include "Math/PdfFuncMathCore.h"
+#include "Math/ProbFuncMathCore.h"
+
+#if defined(R__HAS_VECCORE) && defined(R__HAS_VC)
+
+namespace ROOT {
+namespace Math {
+
+/**
+   Overloads of the special, pdf and cdf functions of MathCore for ROOT::Double_v, evaluating the function for all
+   the elements of the SIMD vector at once. They use the same algorithms (the Cephes and CERNLIB approximations) as
+   the scalar functions, with the exponential, logarithm and trigonometric functions of the SIMD backend, and agree
+   with the scalar functions up to rounding.
+
+   @ingroup SpecFunc
+*/
+///@{
+::ROOT::Double_v erf(const ::ROOT::Double_v &x);
+::ROOT::Double_v erfc(const ::ROOT::Double_v &x);
+::ROOT::Double_v lgamma(const ::ROOT::Double_v &x);
+
+::ROOT::Double_v landau_pdf(const ::ROOT::Double_v &x, double xi = 1, double x0 = 0);
+::ROOT::Double_v crystalball_function(const ::ROOT::Double_v &x, double alpha, double n, double sigma,
+                                      double mean = 0);
+::ROOT::Double_v normal_pdf(const ::ROOT::Double_v &x, double sigma = 1, double x0 = 0);
+/// The number of occurrences n must be a non-negative integer value
+::ROOT::Double_v poisson_pdf(const ::ROOT::Double_v &n, double mu);
+::ROOT::Double_v normal_cdf(const ::ROOT::Double_v &x, double sigma = 1, double x0 = 0);
+///@}
+
+} // namespace Math
+} // namespace ROOT
+
+#endif // VECCORE and VC exist check
+
+#endif // ROOT_Math_VectorizedSpecFunc
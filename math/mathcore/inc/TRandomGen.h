@@ -50,6 +50,19 @@ class TRandomGen : public TRandom {
 protected:
 
    Engine  fEngine;   // random number generator engine
+
+private:
+   // use the bulk generation of the engine if it has one (e.g. MixMaxEngine, RanluxppEngine)
+   template <class E>
+   static auto FillArray(E &engine, Int_t n, Double_t *array, int)
+      -> decltype(engine.RndmArray(n, array), void()) {
+      engine.RndmArray(n, array);
+   }
+   template <class E>
+   static void FillArray(E &engine, Int_t n, Double_t *array, long) {
+      for (int i = 0; i < n; ++i) array[i] = engine();
+   }
+
 public:
 
    TRandomGen(ULong_t seed=1) {
@@ -64,7 +77,7 @@ public:
       for (int i = 0; i < n; ++i) array[i] = fEngine();
    }
     void     RndmArray(Int_t n, Double_t *array) override {
-            for (int i = 0; i < n; ++i) array[i] = fEngine();
+      FillArray(fEngine, n, array, 0);
    }
     void     SetSeed(ULong_t seed=0) override {
       fEngine.SetSeed(seed);
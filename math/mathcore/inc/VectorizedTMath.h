@@ -11,6 +11,7 @@ namespace TMath {
 ::ROOT::Double_v Log2(::ROOT::Double_v &x);
 ::ROOT::Double_v BreitWigner(::ROOT::Double_v &x, Double_t mean = 0, Double_t gamma = 1);
 ::ROOT::Double_v Gaus(::ROOT::Double_v &x, Double_t mean = 0, Double_t sigma = 1, Bool_t norm = kFALSE);
+::ROOT::Double_v Landau(::ROOT::Double_v &x, Double_t mu = 0, Double_t sigma = 1, Bool_t norm = kFALSE);
 ::ROOT::Double_v LaplaceDist(::ROOT::Double_v &x, Double_t alpha = 0, Double_t beta = 1);
 ::ROOT::Double_v LaplaceDistI(::ROOT::Double_v &x, Double_t alpha = 0, Double_t beta = 1);
 ::ROOT::Double_v Freq(::ROOT::Double_v &x);
@@ -6,8 +6,17 @@
 #include "Math/IntegratorOptions.h"
 #include "Math/Error.h"
 
+#include "TROOT.h"
+
+#ifdef R__USE_IMT
+#include "ROOT/TThreadExecutor.hxx"
+#include "ROOT/TSeq.hxx"
+#endif
+
 #include <cmath>
 #include <algorithm>
+#include <cassert>
+#include <vector>
 
 namespace ROOT {
 namespace Math {
@@ -25,7 +34,8 @@ AdaptiveIntegratorMultiDim::AdaptiveIntegratorMultiDim(double absTol, double rel
    fError(0), fRelError(0),
    fNEval(0),
    fStatus(-1),
-   fFun(0)
+   fFun(0),
+   fParallel(false)
 {
    // constructor - without passing a function
    if (fAbsTol < 0) fAbsTol = ROOT::Math::IntegratorMultiDimOptions::DefaultAbsTolerance();
@@ -45,7 +55,8 @@ AdaptiveIntegratorMultiDim::AdaptiveIntegratorMultiDim( const IMultiGenFunction
    fError(0), fRelError(0),
    fNEval(0),
    fStatus(-1),
-   fFun(&f)
+   fFun(&f),
+   fParallel(false)
 {
    // constructur passing a multi-dimensional function interface
    // constructor - without passing a function
@@ -73,6 +84,35 @@ void AdaptiveIntegratorMultiDim::SetRelTolerance(double relTol){ this->fRelTol =
 void AdaptiveIntegratorMultiDim::SetAbsTolerance(double absTol){ this->fAbsTol = absTol; }
 
 
+void AdaptiveIntegratorMultiDim::EvaluateNodes(unsigned int npoints, const double *x, double *result) const
+{
+   // evaluate the integrand at the npoints nodes x of a region
+   if (fBatchFun) {
+      fBatchFun(npoints, x, result);
+      return;
+   }
+   const unsigned int n = fDim;
+#ifdef R__USE_IMT
+   // one task per group of nodes; every node is evaluated by exactly one task, so the result does not depend on
+   // the number of threads
+   const unsigned int nodesPerTask = 16;
+   const unsigned int nTasks = (npoints + nodesPerTask - 1) / nodesPerTask;
+   if (fParallel && nTasks > 1 && ROOT::IsImplicitMTEnabled()) {
+      ROOT::TThreadExecutor pool;
+      pool.Foreach(
+         [&](unsigned int iTask) {
+            const unsigned int end = std::min(npoints, (iTask + 1) * nodesPerTask);
+            for (unsigned int i = iTask * nodesPerTask; i < end; ++i)
+               result[i] = (*fFun)(x + i * n);
+         },
+         ROOT::TSeq<unsigned int>(0, nTasks));
+      return;
+   }
+#endif
+   for (unsigned int i = 0; i < npoints; ++i)
+      result[i] = (*fFun)(x + i * n);
+}
+
 double AdaptiveIntegratorMultiDim::DoIntegral(const double* xmin, const double * xmax, bool absValue)
 {
    // References:
@@ -184,45 +224,37 @@ double AdaptiveIntegratorMultiDim::DoIntegral(const double* xmin, const double *
 
    //InitArgs(z,fParams);
 
+   // nodes of the integration rule of the current region, in the order in which their values are summed, and the
+   // function values at the nodes
+   std::vector<double> nodes;
+   nodes.reserve(irlcls * n);
+   std::vector<double> fvalues(irlcls);
+   const auto addNode = [&]() { nodes.insert(nodes.end(), z, z + n); };
+   const auto value = [absValue](double f) { return absValue ? std::abs(f) : f; };
+
 L20:
    rgnvol = twondm;//=2^n
    for (j=0; j<n; j++) {
       rgnvol *= wth[j]; //region volume
       z[j]    = ctr[j]; //temporary node
    }
-   sum1 = (*fFun)((const double*)z);//EvalPar(z,fParams); //evaluate function
-
-   difmax = 0;
-   sum2   = 0;
-   sum3   = 0;
+   nodes.clear();
+   addNode(); // centre of the region
 
    //loop over coordinates
    for (j=0; j<n; j++) {
       z[j]    = ctr[j] - xl2*wth[j];
-      if (absValue) f2 = std::abs((*fFun)(z));
-      else          f2 = (*fFun)(z);
+      addNode();
       z[j]    = ctr[j] + xl2*wth[j];
-      if (absValue) f2 += std::abs((*fFun)(z));
-      else          f2 += (*fFun)(z);
+      addNode();
       wthl[j] = xl4*wth[j];
       z[j]    = ctr[j] - wthl[j];
-      if (absValue) f3 = std::abs((*fFun)(z));
-      else          f3 = (*fFun)(z);
+      addNode();
       z[j]    = ctr[j] + wthl[j];
-      if (absValue) f3 += std::abs((*fFun)(z));
-      else          f3 += (*fFun)(z);
-      sum2   += f2;//sum func eval with different weights separately
-      sum3   += f3;//for a given region
-      dif     = std::abs(7*f2-f3-12*sum1);
-      //storing dimension with biggest error/difference (?)
-      if (dif >= difmax) {
-         difmax=dif;
-         idvaxn=j+1;
-      }
+      addNode();
       z[j]    = ctr[j];
    }
 
-   sum4 = 0;
    for (j=1;j<n;j++) {
       j1 = j-1;
       for (k=j;k<n;k++) {
@@ -232,8 +264,7 @@ L20:
             for (m=0;m<2;m++) {
                wthl[k] = -wthl[k];
                z[k]    = ctr[k] + wthl[k];
-               if (absValue) sum4 += std::abs((*fFun)(z));
-               else            sum4 += (*fFun)(z);
+               addNode();
             }
          }
          z[k] = ctr[k];
@@ -241,21 +272,52 @@ L20:
       z[j1] = ctr[j1];
    }
 
-   sum5 = 0;
-
    for (j=0;j<n;j++) {
       wthl[j] = -xl5*wth[j];
       z[j] = ctr[j] + wthl[j];
    }
-L90: //sum over end nodes ~gray codes
-   if (absValue) sum5 += std::abs((*fFun)(z));
-   else          sum5 += (*fFun)(z);
+L90: //end nodes ~gray codes
+   addNode();
    for (j=0;j<n;j++) {
       wthl[j] = -wthl[j];
       z[j] = ctr[j] + wthl[j];
       if (wthl[j] > 0) goto L90;
    }
 
+   assert(nodes.size() == irlcls * n);
+   EvaluateNodes(irlcls, nodes.data(), fvalues.data());
+   {
+      const double *fval = fvalues.data();
+      sum1 = *fval++; //function value at the centre
+
+      difmax = 0;
+      sum2   = 0;
+      sum3   = 0;
+      for (j=0; j<n; j++) {
+         f2      = value(fval[0]);
+         f2     += value(fval[1]);
+         f3      = value(fval[2]);
+         f3     += value(fval[3]);
+         fval   += 4;
+         sum2   += f2;//sum func eval with different weights separately
+         sum3   += f3;//for a given region
+         dif     = std::abs(7*f2-f3-12*sum1);
+         //storing dimension with biggest error/difference (?)
+         if (dif >= difmax) {
+            difmax=dif;
+            idvaxn=j+1;
+         }
+      }
+
+      sum4 = 0;
+      for (j=0; j<2*n*(n-1); j++)
+         sum4 += value(*fval++);
+
+      sum5 = 0;
+      for (; fval < fvalues.data() + irlcls; fval++)
+         sum5 += value(*fval);
+   }
+
    rgncmp  = rgnvol*(wpn1[n-2]*sum1+wp2*sum2+wpn3[n-2]*sum3+wp4*sum4);
    rgnval  = wn1[n-2]*sum1+w2*sum2+wn3[n-2]*sum3+w4*sum4+wn5[n-2]*sum5;
    rgnval *= rgnvol;
@@ -276,14 +276,19 @@ double FitUtil::EvaluateChi2(const IModelFunction &func, const BinData &data, co
 
    (const_cast<IModelFunction &>(func)).SetParameters(p);
 
+   // contiguous arrays of the x coordinates, values and inverse errors (when stored)
+   const double *coords0 = data.GetCoordData(0).data();
+   const double *values = data.GetValueData().data();
+   const double *invErrors = data.GetInvErrorData().data();
+
    auto mapFunction = [&](const unsigned i){
 
       double chi2{};
       double fval{};
 
-      const auto x1 = data.GetCoordComponent(i, 0);
-      const auto y = data.Value(i);
-      auto invError = data.InvError(i);
+      const auto x1 = coords0 + i;
+      const auto y = values[i];
+      auto invError = invErrors ? invErrors[i] : data.InvError(i);
 
       //invError = (invError!= 0.0) ? 1.0/invError :1;
 
@@ -879,6 +884,174 @@ void FitUtil::EvaluateChi2Gradient(const IModelFunction &f, const BinData &data,
    std::copy(g.begin(), g.end(), grad);
 }
 
+double FitUtil::EvaluateChi2AndGradient(const IModelFunction &f, const BinData &data, const double *p, double *grad,
+                                        unsigned int &nPoints, ROOT::EExecutionPolicy executionPolicy,
+                                        unsigned nChunks)
+{
+   // evaluate the chi2 and its gradient in a single pass over the data: the function value and the function
+   // gradient of every point are computed once. The points are processed in chunks and every chunk accumulates
+   // into a single buffer holding the gradient, the chi2 and the number of rejected points.
+   //
+   // the chi2 with coordinate errors or expected errors needs the separate evaluations
+
+   if (data.HaveCoordErrors() || data.Opt().fExpErrors) {
+      double chi2 = EvaluateChi2(f, data, p, nPoints, executionPolicy, nChunks);
+      EvaluateChi2Gradient(f, data, p, grad, nPoints, executionPolicy, nChunks);
+      return chi2;
+   }
+
+   const IGradModelFunction *fg = dynamic_cast<const IGradModelFunction *>(&f);
+   assert(fg != nullptr); // must be called by a gradient function
+
+   const IGradModelFunction &func = *fg;
+
+   const DataOptions &fitOpt = data.Opt();
+   bool useBinIntegral = fitOpt.fIntegral && data.HasBinEdges();
+   bool useBinVolume = (fitOpt.fBinVolume && data.HasBinEdges());
+
+   double wrefVolume = 1.0;
+   if (useBinVolume) {
+      if (fitOpt.fNormBinVolume) wrefVolume /= data.RefVolume();
+   }
+
+#ifndef R__USE_IMT
+   // If IMT is disabled, force the execution policy to the serial case
+   if (executionPolicy == ROOT::EExecutionPolicy::kMultiThread) {
+      Warning("FitUtil::EvaluateChi2AndGradient", "Multithread execution policy requires IMT, which is disabled. "
+                                                  "Changing to ROOT::EExecutionPolicy::kSequential.");
+      executionPolicy = ROOT::EExecutionPolicy::kSequential;
+   }
+   (void)nChunks;
+#endif
+
+   ROOT::Math::IntegrationOneDim::Type igType = ROOT::Math::IntegrationOneDim::kDEFAULT;
+   if (executionPolicy == ROOT::EExecutionPolicy::kMultiThread) {
+      // do not use GSL integrator which is not thread safe
+      igType = ROOT::Math::IntegrationOneDim::kGAUSS;
+   }
+   IntegralEvaluator<> igEval(func, p, useBinIntegral, igType);
+
+   const unsigned int npar = func.NPar();
+   const unsigned int ndim = data.NDim();
+   const unsigned int n = data.Size();
+   const double maxResValue = std::numeric_limits<double>::max() / n;
+
+   unsigned int nTasks = 1;
+#ifdef R__USE_IMT
+   if (executionPolicy == ROOT::EExecutionPolicy::kMultiThread)
+      nTasks = std::max(1u, std::min(n, nChunks != 0 ? nChunks : setAutomaticChunking(n)));
+#endif
+   const unsigned int chunkSize = (n + nTasks - 1) / nTasks;
+
+   // the returned buffer holds the npar gradient components, the chi2 and the number of rejected points
+   auto mapFunction = [&](const unsigned int iTask) {
+      std::vector<double> result(npar + 2);
+      std::vector<double> gradFunc(npar);
+      std::vector<double> xc(ndim);
+      std::vector<double> x2(ndim);
+
+      const unsigned int end = std::min(n, (iTask + 1) * chunkSize);
+      for (unsigned int i = iTask * chunkSize; i < end; ++i) {
+         const auto x1 = data.GetCoordComponent(i, 0);
+         const auto y = data.Value(i);
+         const auto invError = data.InvError(i);
+
+         const double *x = nullptr;
+         double binVolume = 1;
+         if (useBinVolume) {
+            for (unsigned int j = 0; j < ndim; ++j) {
+               double x1_j = *data.GetCoordComponent(i, j);
+               double x2_j = data.GetBinUpEdgeComponent(i, j);
+               binVolume *= std::abs(x2_j - x1_j);
+               xc[j] = (useBinIntegral) ? x1_j : 0.5 * (x2_j + x1_j);
+            }
+            x = xc.data();
+            // normalize the bin volume using a reference value
+            binVolume *= wrefVolume;
+         } else if (ndim > 1) {
+            xc[0] = *x1;
+            for (unsigned int j = 1; j < ndim; ++j)
+               xc[j] = *data.GetCoordComponent(i, j);
+            x = xc.data();
+         } else {
+            x = x1;
+         }
+
+         double fval = 0;
+         if (!useBinIntegral) {
+            fval = func(x, p);
+            func.ParameterGradient(x, p, gradFunc.data());
+         } else {
+            data.GetBinUpEdgeCoordinates(i, x2.data());
+            fval = igEval(x, x2.data());
+            CalculateGradientIntegral(func, x, x2.data(), p, gradFunc.data());
+         }
+         if (useBinVolume)
+            fval *= binVolume;
+
+         // chi2 contribution, as in EvaluateChi2
+         if (invError > 0) {
+            double tmp = (y - fval) * invError;
+            double resval = tmp * tmp;
+            result[npar] += (resval < maxResValue) ? resval : maxResValue;
+         }
+
+         // gradient contribution, as in EvaluateChi2Gradient
+         if (!CheckInfNaNValue(fval)) {
+            result[npar + 1] += 1;
+            continue;
+         }
+         unsigned int ipar = 0;
+         for (; ipar < npar; ++ipar) {
+            if (useBinVolume)
+               gradFunc[ipar] *= binVolume;
+            if (!CheckInfNaNValue(gradFunc[ipar]))
+               break;
+            result[ipar] += -2.0 * (y - fval) * invError * invError * gradFunc[ipar];
+         }
+         if (ipar < npar)
+            result[npar + 1] += 1;
+      }
+      return result;
+   };
+
+   auto redFunction = [&](const std::vector<std::vector<double>> &taskResults) {
+      std::vector<double> result(npar + 2);
+      for (auto const &taskResult : taskResults) {
+         for (unsigned int k = 0; k < npar + 2; ++k)
+            result[k] += taskResult[k];
+      }
+      return result;
+   };
+
+   std::vector<double> res;
+   if (executionPolicy == ROOT::EExecutionPolicy::kSequential) {
+      res = mapFunction(0);
+   }
+#ifdef R__USE_IMT
+   else if (executionPolicy == ROOT::EExecutionPolicy::kMultiThread) {
+      ROOT::TThreadExecutor pool;
+      res = pool.MapReduce(mapFunction, ROOT::TSeq<unsigned>(0, nTasks), redFunction);
+   }
+#endif
+   else {
+      Error("FitUtil::EvaluateChi2AndGradient",
+            "Execution policy unknown. Available choices:\n 0: Serial (default)\n 1: MultiThread (requires IMT)\n");
+      res.resize(npar + 2);
+   }
+
+   // correct the number of points
+   const unsigned int nRejected = res[npar + 1];
+   assert(nRejected <= n);
+   nPoints = n - nRejected;
+   if (nRejected > 0 && nPoints < npar)
+      MATH_ERROR_MSG("FitUtil::EvaluateChi2AndGradient",
+                     "Error - too many points rejected for overflow in gradient calculation");
+
+   std::copy(res.begin(), res.begin() + npar, grad);
+   return res[npar];
+}
+
 //______________________________________________________________________________________________________
 //
 //  Log Likelihood functions
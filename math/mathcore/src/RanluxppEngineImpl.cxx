@@ -419,6 +419,15 @@ double RanluxppEngine<p>::operator()()
    return fImpl->NextRandomFloat();
 }
 
+template <int p>
+void RanluxppEngine<p>::RndmArray(int n, double *array)
+{
+   // The loop is in the same translation unit as the implementation, which inlines the generation of the numbers.
+   for (int i = 0; i < n; i++) {
+      array[i] = fImpl->NextRandomFloat();
+   }
+}
+
 template <int p>
 uint64_t RanluxppEngine<p>::IntRndm()
 {
@@ -13,11 +13,55 @@
 #include "TRandom.h"
 
 #include "TString.h"
+#include "TROOT.h"
+
+#ifdef R__USE_IMT
+#include "ROOT/TThreadExecutor.hxx"
+#include "ROOT/TSeq.hxx"
+#endif
+
 #include <string.h>
+#include <algorithm>
 #include <limits>
 
 templateClassImp(TKDTree);
 
+namespace {
+/// Minimal number of points for building the rows of the tree in parallel
+constexpr Int_t kMinParallelBuildPoints = 1 << 15;
+/// Number of query points handled by one task of the batched queries
+constexpr Int_t kQueryChunkSize = 64;
+
+/// A node of the tree that still has to be divided
+struct RBuildNode {
+   Int_t fNode;    ///< index of the node
+   Int_t fPos;     ///< position of the first point of the node in fIndPoints
+   Int_t fNPoints; ///< number of points of the node
+   Int_t fRow;     ///< row of the node
+};
+
+/// Call f(i) for i in [0, n), in parallel by chunks of kQueryChunkSize if implicit multi-threading is enabled
+template <typename F>
+void ForEachQuery(Int_t n, const F &f)
+{
+#ifdef R__USE_IMT
+   if (n > kQueryChunkSize && ROOT::IsImplicitMTEnabled()) {
+      ROOT::TThreadExecutor pool;
+      pool.Foreach(
+         [&](Int_t chunk) {
+            const Int_t end = std::min(n, (chunk + 1) * kQueryChunkSize);
+            for (Int_t i = chunk * kQueryChunkSize; i < end; i++)
+               f(i);
+         },
+         ROOT::TSeq<Int_t>(0, (n + kQueryChunkSize - 1) / kQueryChunkSize));
+      return;
+   }
+#endif
+   for (Int_t i = 0; i < n; i++)
+      f(i);
+}
+} // anonymous namespace
+
 
 /**
 \class TKDTree
@@ -159,6 +203,15 @@ in the 2 subtrees as close as possible. The following section gives more details
     part of the index array. To find the number of point in the node
     (not only terminal), call TKDTree::GetNpointsNode(Index inode).
 
+#### 3c. Batched queries
+
+    The nearest neighbours and the points within a range of many query points can be found with one call to
+    FindNearestNeighbors(Index npoints, const Value *points, Int_t k, Index *ind, Value *dist) and
+    FindInRange(Index npoints, const Value *points, Value range, std::vector<std::vector<Index>> &res).
+    The query points are stored one after the other in the points array. If implicit multi-threading is enabled
+    (ROOT::EnableImplicitMT()), the queries are processed in parallel; the kd-tree is also built in parallel for
+    large numbers of points. The results do not depend on the number of threads.
+
 ### 4.  TKDtree implementation details - internal information, not needed to use the kd-tree.
 
 ####  4a. Order of nodes in the node information arrays:
@@ -449,89 +502,92 @@ void TKDTree<Index, Value>::Build()
    //
    //
    //4.
-   //    stack for non recursive build - size 128 bytes enough
-   Int_t rowStack[128];
-   Int_t nodeStack[128];
-   Int_t npointStack[128];
-   Int_t posStack[128];
-   Int_t currentIndex = 0;
-   rowStack[0]    = 0;
-   nodeStack[0]   = 0;
-   npointStack[0] = fNPoints;
-   posStack[0]   = 0;
-   //
-   while (currentIndex>=0){
-      //
-      Int_t npoints  = npointStack[currentIndex];
-      if (npoints<=fBucketSize) {
-         currentIndex--;
-         continue; // terminal node
-      }
-      Int_t crow     = rowStack[currentIndex];
-      Int_t cpos     = posStack[currentIndex];
-      Int_t cnode    = nodeStack[currentIndex];
-      //printf("currentIndex %d npoints %d node %d\n", currentIndex, npoints, cnode);
-      //
-      // divide points
-      Int_t nbuckets0 = npoints/fBucketSize;           //current number of  buckets
-      if (npoints%fBucketSize) nbuckets0++;            //
-      Int_t restRows = fRowT0-rowStack[currentIndex];  // rest of fully occupied node row
-      if (restRows<0) restRows =0;
-      for (;nbuckets0>(2<<restRows); restRows++) {}
-      Int_t nfull = 1<<restRows;
-      Int_t nrest = nbuckets0-nfull;
-      Int_t nleft =0, nright =0;
-      //
-      if (nrest>(nfull/2)){
-         nleft  = nfull*fBucketSize;
-         nright = npoints-nleft;
-      }else{
-         nright = nfull*fBucketSize/2;
-         nleft  = npoints-nright;
+   //    the tree is built row by row: the nodes of a row work on disjoint parts of fIndPoints and of the node
+   //    arrays, so that they can be divided in parallel
+   std::vector<RBuildNode> row, nextRow;
+   std::vector<Int_t> nleft, nright;
+   if (fNPoints > fBucketSize)
+      row.push_back({0, 0, fNPoints, 0});
+   while (!row.empty()) {
+      const Int_t nnodes = row.size();
+      nleft.resize(nnodes);
+      nright.resize(nnodes);
+      auto divide = [&](Int_t i) { DivideNode(row[i].fNode, row[i].fPos, row[i].fNPoints, row[i].fRow,
+                                              nleft[i], nright[i]); };
+#ifdef R__USE_IMT
+      if (nnodes > 1 && fNPoints >= kMinParallelBuildPoints && ROOT::IsImplicitMTEnabled()) {
+         ROOT::TThreadExecutor pool;
+         pool.Foreach(divide, ROOT::TSeq<Int_t>(0, nnodes));
+      } else
+#endif
+      {
+         for (Int_t i = 0; i < nnodes; i++)
+            divide(i);
       }
 
-      //
-      //find the axis with biggest spread
-      Value maxspread=0;
-      Value tempspread, min, max;
-      Index axspread=0;
-      Value *array;
-      for (Int_t idim=0; idim<fNDim; idim++){
-         array = fData[idim];
-         Spread(npoints, array, fIndPoints+cpos, min, max);
-         tempspread = max - min;
-         if (maxspread < tempspread) {
-            maxspread=tempspread;
-            axspread = idim;
-         }
-         if(cnode) continue;
-         //printf("set %d %6.3f %6.3f\n", idim, min, max);
-         fRange[2*idim] = min; fRange[2*idim+1] = max;
+      nextRow.clear();
+      for (Int_t i = 0; i < nnodes; i++) {
+         // nodes with at most fBucketSize points are terminal
+         if (nleft[i] > fBucketSize)
+            nextRow.push_back({row[i].fNode * 2 + 1, row[i].fPos, nleft[i], row[i].fRow + 1});
+         if (nright[i] > fBucketSize)
+            nextRow.push_back({row[i].fNode * 2 + 2, row[i].fPos + nleft[i], nright[i], row[i].fRow + 1});
       }
-      array = fData[axspread];
-      KOrdStat(npoints, array, nleft, fIndPoints+cpos);
-      fAxis[cnode]  = axspread;
-      fValue[cnode] = array[fIndPoints[cpos+nleft]];
-      //printf("Set node %d : ax %d val %f\n", cnode, node->fAxis, node->fValue);
-      //
-      //
-      npointStack[currentIndex] = nleft;
-      rowStack[currentIndex]    = crow+1;
-      posStack[currentIndex]    = cpos;
-      nodeStack[currentIndex]   = cnode*2+1;
-      currentIndex++;
-      npointStack[currentIndex] = nright;
-      rowStack[currentIndex]    = crow+1;
-      posStack[currentIndex]    = cpos+nleft;
-      nodeStack[currentIndex]   = (cnode*2)+2;
-      //
-      if (0){
-         // consistency check
-         Info("Build()", "%s", Form("points %d left %d right %d", npoints, nleft, nright));
-         if (nleft<nright) Warning("Build", "Problem Left-Right");
-         if (nleft<0 || nright<0) Warning("Build()", "Problem Negative number");
+      std::swap(row, nextRow);
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Divide the npoints points of node cnode, of row crow, starting at position cpos of fIndPoints, on the axis with
+/// the biggest spread. The numbers of points of the left and right children are returned in nleft and nright.
+
+template <typename  Index, typename Value>
+void TKDTree<Index, Value>::DivideNode(Int_t cnode, Int_t cpos, Int_t npoints, Int_t crow, Int_t &nleft,
+                                       Int_t &nright)
+{
+   //
+   // divide points
+   Int_t nbuckets0 = npoints/fBucketSize;           //current number of  buckets
+   if (npoints%fBucketSize) nbuckets0++;            //
+   Int_t restRows = fRowT0-crow;                    // rest of fully occupied node row
+   if (restRows<0) restRows =0;
+   for (;nbuckets0>(2<<restRows); restRows++) {}
+   Int_t nfull = 1<<restRows;
+   Int_t nrest = nbuckets0-nfull;
+   nleft =0;
+   nright =0;
+   //
+   if (nrest>(nfull/2)){
+      nleft  = nfull*fBucketSize;
+      nright = npoints-nleft;
+   }else{
+      nright = nfull*fBucketSize/2;
+      nleft  = npoints-nright;
+   }
+
+   //
+   //find the axis with biggest spread
+   Value maxspread=0;
+   Value tempspread, min, max;
+   Index axspread=0;
+   Value *array;
+   for (Int_t idim=0; idim<fNDim; idim++){
+      array = fData[idim];
+      Spread(npoints, array, fIndPoints+cpos, min, max);
+      tempspread = max - min;
+      if (maxspread < tempspread) {
+         maxspread=tempspread;
+         axspread = idim;
       }
+      if(cnode) continue;
+      //printf("set %d %6.3f %6.3f\n", idim, min, max);
+      fRange[2*idim] = min; fRange[2*idim+1] = max;
    }
+   array = fData[axspread];
+   KOrdStat(npoints, array, nleft, fIndPoints+cpos);
+   fAxis[cnode]  = axspread;
+   fValue[cnode] = array[fIndPoints[cpos+nleft]];
+   //printf("Set node %d : ax %d val %f\n", cnode, node->fAxis, node->fValue);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -556,6 +612,34 @@ void TKDTree<Index, Value>::FindNearestNeighbors(const Value *point, const Int_t
 
 }
 
+////////////////////////////////////////////////////////////////////////////////
+///Find the kNN nearest neighbors of each of the npoints points stored one after the other in the array points
+///(npoints*fNDim values). The indexes and distances of the neighbors of the point i are returned in
+///ind[i*kNN] ... ind[i*kNN+kNN-1] and dist[i*kNN] ... dist[i*kNN+kNN-1]; the arrays are provided by the user and are
+///assumed to be at least npoints*kNN elements long.
+///The points are processed in parallel if implicit multi-threading is enabled.
+
+template <typename  Index, typename Value>
+void TKDTree<Index, Value>::FindNearestNeighbors(Index npoints, const Value *points, const Int_t kNN, Index *ind,
+                                                 Value *dist)
+{
+   if (!ind || !dist) {
+      Error("FindNearestNeighbors", "Working arrays must be allocated by the user!");
+      return;
+   }
+   // the boundaries are computed once; the searches only read the tree afterwards
+   MakeBoundariesExact();
+   ForEachQuery(npoints, [&](Int_t ipoint) {
+      Index *pind = ind + ipoint * kNN;
+      Value *pdist = dist + ipoint * kNN;
+      for (Int_t i = 0; i < kNN; i++) {
+         pdist[i] = std::numeric_limits<Value>::max();
+         pind[i] = -1;
+      }
+      UpdateNearestNeighbors(0, points + ipoint * fNDim, kNN, pind, pdist);
+   });
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 ///Update the nearest neighbors values by examining the node inode
 
@@ -752,11 +836,29 @@ void TKDTree<Index, Value>::FindInRange(Value * point, Value range, std::vector<
    UpdateRange(0, point, range, res);
 }
 
+////////////////////////////////////////////////////////////////////////////////
+///Find all points in the sphere of radius range around each of the npoints points stored one after the other in
+///the array points (npoints*fNDim values). res is resized to npoints, res[i] contains the indexes of the points
+///found around the point i, in the same order as FindInRange() for a single point.
+///The points are processed in parallel if implicit multi-threading is enabled.
+
+template <typename  Index, typename Value>
+void TKDTree<Index, Value>::FindInRange(Index npoints, const Value *points, Value range,
+                                        std::vector<std::vector<Index>> &res)
+{
+   MakeBoundariesExact();
+   res.resize(npoints);
+   ForEachQuery(npoints, [&](Int_t ipoint) {
+      res[ipoint].clear();
+      UpdateRange(0, points + ipoint * fNDim, range, res[ipoint]);
+   });
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 ///Internal recursive function with the implementation of range searches
 
 template <typename  Index, typename Value>
-void TKDTree<Index, Value>::UpdateRange(Index inode, Value* point, Value range, std::vector<Index> &res)
+void TKDTree<Index, Value>::UpdateRange(Index inode, const Value* point, Value range, std::vector<Index> &res)
 {
    Value min, max;
    DistanceToNode(point, inode, min, max);
@@ -0,0 +1,341 @@
+// @(#)root/mathcore:$Id$
+
+/**********************************************************************
+ *                                                                    *
+ * Copyright (c) 2026 , LCG ROOT MathLib Team                         *
+ *                                                                    *
+ *                                                                    *
+ **********************************************************************/
+
+// Implementation of the vectorized special, pdf and cdf functions
+
+#include "Math/VectorizedSpecFunc.h"
+
+#if defined(R__HAS_VECCORE) && defined(R__HAS_VC)
+
+#include <limits>
+
+namespace {
+
+using ::ROOT::Double_v;
+using Mask_v = vecCore::Mask<Double_v>;
+
+// coefficients of SpecFuncCephes.cxx
+
+constexpr double kMAXLOG = 709.782712893383973096206318587;
+constexpr double kMAXLGM = 2.556348e305;
+constexpr double kLS2PI = 0.91893853320467274178; // log(sqrt(2*pi))
+constexpr double kPi = 3.14159265358979323846;
+
+constexpr double kErfP[] = {2.46196981473530512524E-10, 5.64189564831068821977E-1, 7.46321056442269912687E0,
+                            4.86371970985681366614E1,   1.96520832956077098242E2,  5.26445194995477358631E2,
+                            9.34528527171957607540E2,   1.02755188689515710272E3,  5.57535335369399327526E2};
+constexpr double kErfQ[] = {1.32281951154744992508E1, 8.67072140885989742329E1, 3.54937778887819891062E2,
+                            9.75708501743205489753E2, 1.82390916687909736289E3, 2.24633760818710981792E3,
+                            1.65666309194161350182E3, 5.57535340817727675546E2};
+constexpr double kErfR[] = {5.64189583547755073984E-1, 1.27536670759978104416E0, 5.01905042251180477414E0,
+                            6.16021097993053585195E0,  7.40974269950448939160E0, 2.97886665372100240670E0};
+constexpr double kErfS[] = {2.26052863220117276590E0, 9.39603524938001434673E0, 1.20489539808096656605E1,
+                            1.70814450747565897222E1, 9.60896809063285878198E0, 3.36907645100081516050E0};
+constexpr double kErfT[] = {9.60497373987051638749E0, 9.00260197203842689217E1, 2.23200534594684319226E3,
+                            7.00332514112805075473E3, 5.55923013010394962768E4};
+constexpr double kErfU[] = {3.35617141647503099647E1, 5.21357949780152679795E2, 4.59432382970980127987E3,
+                            2.26290000613890934246E4, 4.92673942608635921086E4};
+
+constexpr double kLgamA[] = {8.11614167470508450300E-4, -5.95061904284301438324E-4, 7.93650340457716943945E-4,
+                             -2.77777777730099687205E-3, 8.33333333333331927722E-2};
+constexpr double kLgamB[] = {-1.37825152569120859100E3, -3.88016315134637840924E4, -3.31612992738871184744E5,
+                             -1.16237097492762307383E6, -1.72173700820839662146E6, -8.53555664245765465627E5};
+constexpr double kLgamC[] = {-3.51815701436523470549E2, -1.70642106651881159223E4, -2.20528590553854454839E5,
+                             -1.13933444367982507207E6, -2.53252307177582951285E6, -2.01889141433532773231E6};
+
+/// Polynomial of degree N-1 with coefficients a, highest degree first (Cephes Polynomialeval)
+template <std::size_t N>
+Double_v Polynomial(const Double_v &x, const double (&a)[N])
+{
+   Double_v ans(a[0]);
+   for (std::size_t i = 1; i < N; ++i)
+      ans = ans * x + a[i];
+   return ans;
+}
+
+/// Polynomial of degree N with leading coefficient 1 and the other coefficients a (Cephes Polynomial1eval)
+template <std::size_t N>
+Double_v Polynomial1(const Double_v &x, const double (&a)[N])
+{
+   Double_v ans = x + a[0];
+   for (std::size_t i = 1; i < N; ++i)
+      ans = ans * x + a[i];
+   return ans;
+}
+
+/// erf for |x| <= 1
+Double_v ErfSmall(const Double_v &x)
+{
+   Double_v z = x * x;
+   return x * Polynomial(z, kErfT) / Polynomial1(z, kErfU);
+}
+
+/// erfc for |a| >= 1
+Double_v ErfcLarge(const Double_v &a)
+{
+   Double_v x = vecCore::math::Abs(a);
+   Double_v z = vecCore::math::Exp(-a * a);
+   Mask_v near = x < Double_v(8.0);
+   Double_v p = vecCore::Blend(near, Polynomial(x, kErfP), Polynomial(x, kErfR));
+   Double_v q = vecCore::Blend(near, Polynomial1(x, kErfQ), Polynomial1(x, kErfS));
+   Double_v y = (z * p) / q;
+   y = vecCore::Blend(a < Double_v(0.0), Double_v(2.0) - y, y);
+   // underflow of the exponential
+   Mask_v under = -a * a < Double_v(-kMAXLOG) || y == Double_v(0.0);
+   return vecCore::Blend(under, vecCore::Blend(a < Double_v(0.0), Double_v(2.0), Double_v(0.0)), y);
+}
+
+/// Stirling's formula for lgamma, for x >= 13
+Double_v LgammaStirling(const Double_v &x)
+{
+   Double_v q = (x - 0.5) * vecCore::math::Log(x) - x + kLS2PI;
+   Double_v p = Double_v(1.0) / (x * x);
+   Double_v large = ((7.9365079365079365079365e-4 * p - 2.7777777777777777777778e-3) * p + 0.0833333333333333333333);
+   q += vecCore::Blend(x >= Double_v(1000.0), large, Polynomial(p, kLgamA)) / x;
+   q = vecCore::Blend(x > Double_v(1.0e8), (x - 0.5) * vecCore::math::Log(x) - x + kLS2PI, q);
+   return vecCore::Blend(x > Double_v(kMAXLGM), Double_v(std::numeric_limits<double>::infinity()), q);
+}
+
+} // anonymous namespace
+
+namespace ROOT {
+namespace Math {
+
+////////////////////////////////////////////////////////////////////////////////
+/// Vectorized error function, see ROOT::Math::erf(double)
+
+::ROOT::Double_v erf(const ::ROOT::Double_v &x)
+{
+   Mask_v small = vecCore::math::Abs(x) <= Double_v(1.0);
+   if (vecCore::MaskFull(small))
+      return ErfSmall(x);
+   Double_v large = Double_v(1.0) - ErfcLarge(x);
+   if (vecCore::MaskEmpty(small))
+      return large;
+   return vecCore::Blend(small, ErfSmall(x), large);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Vectorized complementary error function, see ROOT::Math::erfc(double)
+
+::ROOT::Double_v erfc(const ::ROOT::Double_v &x)
+{
+   Mask_v small = vecCore::math::Abs(x) < Double_v(1.0);
+   if (vecCore::MaskFull(small))
+      return Double_v(1.0) - ErfSmall(x);
+   Double_v large = ErfcLarge(x);
+   if (vecCore::MaskEmpty(small))
+      return large;
+   return vecCore::Blend(small, Double_v(1.0) - ErfSmall(x), large);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Vectorized logarithm of the absolute value of the gamma function, see ROOT::Math::lgamma(double).
+/// The argument reduction of the Cephes algorithm is done for all the elements together, the number of steps is
+/// the largest one of the elements.
+
+::ROOT::Double_v lgamma(const ::ROOT::Double_v &x)
+{
+   const Double_v inf(std::numeric_limits<double>::infinity());
+   Double_v result(0.0);
+
+   // x >= 13, and -x for the reflection formula for x < -34
+   Mask_v negative = x < Double_v(-34.0);
+   Mask_v stirling = x >= Double_v(13.0) || negative;
+   if (!vecCore::MaskEmpty(stirling)) {
+      Double_v q = vecCore::Blend(negative, -x, x);
+      Double_v w = LgammaStirling(vecCore::Blend(stirling, q, Double_v(13.0)));
+      vecCore::MaskedAssign(result, stirling, w);
+      if (!vecCore::MaskEmpty(negative)) {
+         Double_v p = vecCore::math::Floor(q);
+         Double_v z = q - p;
+         z = vecCore::Blend(z > Double_v(0.5), (p + 1.0) - q, z);
+         z = q * vecCore::math::Sin(kPi * z);
+         Double_v reflected = std::log(kPi) - vecCore::math::Log(z) - w;
+         reflected = vecCore::Blend(p == q || z == Double_v(0.0), inf, reflected);
+         vecCore::MaskedAssign(result, negative, reflected);
+      }
+   }
+
+   // -34 <= x < 13: reduction to [2, 3)
+   Mask_v recursion = !stirling;
+   if (!vecCore::MaskEmpty(recursion)) {
+      Double_v z(1.0), p(0.0), u = x;
+      Mask_v pole(false);
+      Mask_v loop = recursion && u >= Double_v(3.0);
+      while (!vecCore::MaskEmpty(loop)) {
+         vecCore::MaskedAssign(p, loop, p - 1.0);
+         vecCore::MaskedAssign(u, loop, x + p);
+         vecCore::MaskedAssign(z, loop, z * u);
+         loop = loop && u >= Double_v(3.0);
+      }
+      loop = recursion && u < Double_v(2.0);
+      while (!vecCore::MaskEmpty(loop)) {
+         pole = pole || (loop && u == Double_v(0.0));
+         loop = loop && !pole;
+         vecCore::MaskedAssign(z, loop, z / u);
+         vecCore::MaskedAssign(p, loop, p + 1.0);
+         vecCore::MaskedAssign(u, loop, x + p);
+         loop = loop && u < Double_v(2.0);
+      }
+      z = vecCore::math::Abs(z);
+      Double_v xr = x + (p - 2.0);
+      Double_v reduced = vecCore::math::Log(z) + xr * Polynomial(xr, kLgamB) / Polynomial1(xr, kLgamC);
+      reduced = vecCore::Blend(u == Double_v(2.0), vecCore::math::Log(z), reduced);
+      vecCore::MaskedAssign(result, recursion, vecCore::Blend(pole, inf, reduced));
+   }
+
+   return vecCore::Blend(x >= inf, inf, result);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Vectorized Landau probability density function, see ROOT::Math::landau_pdf(double, double, double).
+/// Only the approximations needed by at least one element are computed.
+
+::ROOT::Double_v landau_pdf(const ::ROOT::Double_v &x, double xi, double x0)
+{
+   // LANDAU pdf : algorithm from CERNLIB G110 denlan, as the scalar version
+   static const double p1[5] = {0.4259894875, -0.1249762550, 0.03984243700, -0.006298287635, 0.001511162253};
+   static const double q1[5] = {1.0, -0.3388260629, 0.09594393323, -0.01608042283, 0.003778942063};
+
+   static const double p2[5] = {0.1788541609, 0.1173957403, 0.01488850518, -0.001394989411, 0.0001283617211};
+   static const double q2[5] = {1.0, 0.7428795082, 0.3153932961, 0.06694219548, 0.008790609714};
+
+   static const double p3[5] = {0.1788544503, 0.09359161662, 0.006325387654, 0.00006611667319, -0.000002031049101};
+   static const double q3[5] = {1.0, 0.6097809921, 0.2560616665, 0.04746722384, 0.006957301675};
+
+   static const double p4[5] = {0.9874054407, 118.6723273, 849.2794360, -743.7792444, 427.0262186};
+   static const double q4[5] = {1.0, 106.8615961, 337.6496214, 2016.712389, 1597.063511};
+
+   static const double p5[5] = {1.003675074, 167.5702434, 4789.711289, 21217.86767, -22324.94910};
+   static const double q5[5] = {1.0, 156.9424537, 3745.310488, 9834.698876, 66924.28357};
+
+   static const double p6[5] = {1.000827619, 664.9143136, 62972.92665, 475554.6998, -5743609.109};
+   static const double q6[5] = {1.0, 651.4101098, 56974.73333, 165917.4725, -2815759.939};
+
+   static const double a1[3] = {0.04166666667, -0.01996527778, 0.02709538966};
+
+   static const double a2[2] = {-1.845568670, -4.284640743};
+
+   if (xi <= 0)
+      return Double_v(0.0);
+   const Double_v v = (x - x0) / xi;
+   Double_v denlan(0.0);
+
+   // rational approximation (p[0]+(p[1]+(p[2]+(p[3]+p[4]*t)*t)*t)*t)/(q[0]+...) in the interval [low, high)
+   auto interval = [&](double low, double high, auto &&approximation) {
+      Mask_v mask = v >= Double_v(low) && v < Double_v(high);
+      if (!vecCore::MaskEmpty(mask))
+         vecCore::MaskedAssign(denlan, mask, approximation());
+   };
+   auto rational = [](const double *p, const double *q, const Double_v &t) {
+      return (p[0] + (p[1] + (p[2] + (p[3] + p[4] * t) * t) * t) * t) /
+             (q[0] + (q[1] + (q[2] + (q[3] + q[4] * t) * t) * t) * t);
+   };
+   const double lowest = -std::numeric_limits<double>::infinity();
+   const double highest = std::numeric_limits<double>::infinity();
+
+   interval(lowest, -5.5, [&]() {
+      Double_v u = vecCore::math::Exp(v + 1.0);
+      Double_v ue = vecCore::math::Exp(-1.0 / u);
+      Double_v us = vecCore::math::Sqrt(u);
+      Double_v res = 0.3989422803 * (ue / us) * (1.0 + (a1[0] + (a1[1] + a1[2] * u) * u) * u);
+      return vecCore::Blend(u < Double_v(1e-10), Double_v(0.0), res);
+   });
+   interval(-5.5, -1, [&]() {
+      Double_v u = vecCore::math::Exp(-v - 1.0);
+      return vecCore::math::Exp(-u) * vecCore::math::Sqrt(u) * rational(p1, q1, v);
+   });
+   interval(-1, 1, [&]() { return rational(p2, q2, v); });
+   interval(1, 5, [&]() { return rational(p3, q3, v); });
+   interval(5, 12, [&]() {
+      Double_v u = 1.0 / v;
+      return u * u * rational(p4, q4, u);
+   });
+   interval(12, 50, [&]() {
+      Double_v u = 1.0 / v;
+      return u * u * rational(p5, q5, u);
+   });
+   interval(50, 300, [&]() {
+      Double_v u = 1.0 / v;
+      return u * u * rational(p6, q6, u);
+   });
+   interval(300, highest, [&]() {
+      Double_v u = 1.0 / (v - v * vecCore::math::Log(v) / (v + 1.0));
+      return u * u * (1.0 + (a2[0] + a2[1] * u) * u);
+   });
+   return denlan / xi;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Vectorized crystal ball function, see ROOT::Math::crystalball_function(double, double, double, double, double)
+
+::ROOT::Double_v crystalball_function(const ::ROOT::Double_v &x, double alpha, double n, double sigma, double mean)
+{
+   if (sigma < 0.)
+      return Double_v(0.0);
+   Double_v z = (x - mean) / sigma;
+   if (alpha < 0)
+      z = -z;
+   double abs_alpha = std::abs(alpha);
+   Mask_v core = z > Double_v(-abs_alpha);
+   Double_v gauss = vecCore::math::Exp(-0.5 * z * z);
+   if (vecCore::MaskFull(core))
+      return gauss;
+   double nDivAlpha = n / abs_alpha;
+   double AA = std::exp(-0.5 * abs_alpha * abs_alpha);
+   double B = nDivAlpha - abs_alpha;
+   Double_v arg = nDivAlpha / (B - z);
+   // arg^n as exp(n log(arg)) for the elements of the tail, where arg is positive
+   Double_v tail = AA * vecCore::math::Exp(n * vecCore::math::Log(vecCore::Blend(core, Double_v(1.0), arg)));
+   return vecCore::Blend(core, gauss, tail);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Vectorized normal probability density function, see ROOT::Math::normal_pdf(double, double, double)
+
+::ROOT::Double_v normal_pdf(const ::ROOT::Double_v &x, double sigma, double x0)
+{
+   Double_v tmp = (x - x0) / sigma;
+   return (1.0 / (std::sqrt(2 * M_PI) * std::fabs(sigma))) * vecCore::math::Exp(-tmp * tmp / 2.0);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Vectorized Poisson probability density function, see ROOT::Math::poisson_pdf(unsigned int, double)
+
+::ROOT::Double_v poisson_pdf(const ::ROOT::Double_v &n, double mu)
+{
+   if (mu < 0)
+      return Double_v(std::numeric_limits<double>::quiet_NaN());
+   //  when  n = 0 and mu = 0,  1 is returned
+   if (mu == 0)
+      return vecCore::Blend(n > Double_v(0.0), Double_v(0.0), Double_v(1.0));
+   Double_v res = vecCore::math::Exp(n * std::log(mu) - lgamma(n + 1.0) - mu);
+   return vecCore::Blend(n > Double_v(0.0), res, Double_v(std::exp(-mu)));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Vectorized normal cumulative distribution function (lower tail), see ROOT::Math::normal_cdf(double, double,
+/// double)
+
+::ROOT::Double_v normal_cdf(const ::ROOT::Double_v &x, double sigma, double x0)
+{
+   Double_v z = (x - x0) / (sigma * M_SQRT2);
+   Mask_v lower = z < Double_v(-1.0);
+   if (vecCore::MaskEmpty(lower))
+      return 0.5 * (1.0 + erf(z));
+   if (vecCore::MaskFull(lower))
+      return 0.5 * erfc(-z);
+   return vecCore::Blend(lower, 0.5 * erfc(-z), 0.5 * (1.0 + erf(z)));
+}
+
+} // namespace Math
+} // namespace ROOT
+
+#endif // VECCORE and VC exist check
@@ -1,4 +1,5 @@
 #include "VectorizedTMath.h"
+#include "Math/VectorizedSpecFunc.h"
 
 #if defined(R__HAS_VECCORE) && defined(R__HAS_VC)
 
@@ -37,6 +38,19 @@ namespace TMath {
    return out;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// The LANDAU function with mu and sigma, see TMath::Landau(Double_t, Double_t, Double_t, Bool_t).
+/// If norm=kTRUE (default is kFALSE) the result is divided by sigma.
+::ROOT::Double_v Landau(::ROOT::Double_v &x, Double_t mu, Double_t sigma, Bool_t norm)
+{
+   if (sigma <= 0)
+      return ::ROOT::Double_v(0.0);
+   ::ROOT::Double_v den = ::ROOT::Math::landau_pdf((x - mu) / sigma);
+   if (!norm)
+      return den;
+   return den / sigma;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Computes the probability density function of Laplace distribution
 /// at point x, with location parameter alpha and shape parameter beta.
@@ -47,6 +47,20 @@ TEST(RanluxppEngine, random2048)
    EXPECT_EQ(rng.Rndm(), 0.74670661284082484599);
 }
 
+TEST(RanluxppEngine, RndmArray)
+{
+   RanluxppEngine2048 rng(314159265);
+   RanluxppEngine2048 rngArray(314159265);
+
+   // Cross the block boundary several times.
+   double array[100];
+   rngArray.RndmArray(100, array);
+   for (int i = 0; i < 100; i++) {
+      EXPECT_EQ(rng.Rndm(), array[i]);
+   }
+   EXPECT_EQ(rng.IntRndm(), rngArray.IntRndm());
+}
+
 TEST(RanluxppCompatEngineJames, P3)
 {
    RanluxppCompatEngineJamesP3 rng(314159265);
@@ -0,0 +1,43 @@
+#include "Fit/BinData.h"
+
+#include "gtest/gtest.h"
+
+#include <vector>
+
+using ROOT::Fit::BinData;
+
+TEST(BinData, ContiguousData)
+{
+   BinData data(4, 2);
+   for (int i = 0; i < 4; ++i) {
+      const double x[2] = {1. * i, 10. * i};
+      data.Add(x, 2. * i, 0.5 * (i + 1));
+   }
+
+   ASSERT_EQ(4u, data.GetCoordData(0).size());
+   ASSERT_EQ(4u, data.GetValueData().size());
+   ASSERT_EQ(4u, data.GetInvErrorData().size());
+   for (unsigned int i = 0; i < 4; ++i) {
+      EXPECT_EQ(*data.GetCoordComponent(i, 0), data.GetCoordData(0)[i]);
+      EXPECT_EQ(*data.GetCoordComponent(i, 1), data.GetCoordData(1)[i]);
+      EXPECT_EQ(data.Value(i), data.GetValueData()[i]);
+      EXPECT_DOUBLE_EQ(data.InvError(i), data.GetInvErrorData()[i]);
+   }
+}
+
+TEST(BinData, ContiguousWrappedData)
+{
+   const std::vector<double> x{1., 2., 3.};
+   const std::vector<double> y{4., 5., 6.};
+   const std::vector<double> ey{0.5, 1., 2.};
+   BinData data(3, x.data(), y.data(), nullptr, ey.data());
+
+   EXPECT_EQ(x.data(), data.GetCoordData(0).data());
+   EXPECT_EQ(y.data(), data.GetValueData().data());
+   // wrapped errors are not inverted, InvError() must be used instead
+   EXPECT_TRUE(data.GetInvErrorData().empty());
+   EXPECT_DOUBLE_EQ(2., data.InvError(0));
+
+   BinData noErrors(3, x.data(), y.data(), nullptr, nullptr);
+   EXPECT_TRUE(noErrors.GetInvErrorData().empty());
+}
@@ -497,6 +497,19 @@ TYPED_TEST(Chi2GradientTest, Chi2Gradient)
    }
 }
 
+// Test that the single pass evaluation of the chi2 and its gradient matches the separate evaluations.
+TYPED_TEST(Chi2GradientTest, Chi2FdF)
+{
+   std::vector<Double_t> gradient(TestFixture::fNumParams);
+   Double_t chi2 = 0;
+   TestFixture::fFitter->FdF(TestFixture::fModel->fParams, chi2, gradient.data());
+
+   EXPECT_NEAR(chi2, (*TestFixture::fFitter)(TestFixture::fModel->fParams), 1e-6 * std::abs(chi2));
+   for (unsigned i = 0; i < TestFixture::fNumParams; i++) {
+      EXPECT_NEAR(gradient[i], TestFixture::fReferenceSolution[i], 1e-6);
+   }
+}
+
 TYPED_TEST_SUITE(PoissonLikelihoodGradientTest, TestTypes);
 
 // Test EvalChi2Gradient and outputs its speedup against the scalar serial case.
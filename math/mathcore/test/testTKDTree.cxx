@@ -0,0 +1,96 @@
+#include "TKDTree.h"
+#include "TRandom3.h"
+#include "TROOT.h"
+
+#include "gtest/gtest.h"
+
+#include <vector>
+
+namespace {
+struct TreeData {
+   static constexpr Int_t kNDim = 3;
+   std::vector<Double_t> fCoords;
+   Double_t *fData[kNDim];
+
+   TreeData(Int_t npoints, UInt_t seed) : fCoords(npoints * kNDim)
+   {
+      TRandom3 rnd(seed);
+      for (auto &c : fCoords)
+         c = rnd.Gaus();
+      for (Int_t idim = 0; idim < kNDim; idim++)
+         fData[idim] = fCoords.data() + idim * npoints;
+   }
+};
+
+void CheckBatchedQueries(Int_t npoints)
+{
+   const Int_t k = 5;
+   const Int_t nqueries = 500;
+   TreeData data(npoints, 1);
+   TKDTreeID tree(npoints, TreeData::kNDim, 10, data.fData);
+   tree.Build();
+
+   TRandom3 rnd(2);
+   std::vector<Double_t> queries(nqueries * TreeData::kNDim);
+   for (auto &q : queries)
+      q = rnd.Gaus();
+
+   std::vector<Int_t> ind(nqueries * k);
+   std::vector<Double_t> dist(nqueries * k);
+   tree.FindNearestNeighbors(nqueries, queries.data(), k, ind.data(), dist.data());
+   std::vector<std::vector<Int_t>> inRange;
+   tree.FindInRange(nqueries, queries.data(), 0.3, inRange);
+   ASSERT_EQ(inRange.size(), (std::size_t)nqueries);
+
+   for (Int_t i = 0; i < nqueries; i++) {
+      Double_t *point = &queries[i * TreeData::kNDim];
+      Int_t ind1[k];
+      Double_t dist1[k];
+      tree.FindNearestNeighbors(point, k, ind1, dist1);
+      for (Int_t j = 0; j < k; j++) {
+         EXPECT_EQ(ind[i * k + j], ind1[j]);
+         EXPECT_EQ(dist[i * k + j], dist1[j]);
+      }
+      // the nearest neighbour found by a brute-force search
+      Int_t nearest = 0;
+      for (Int_t ip = 1; ip < npoints; ip++) {
+         if (tree.Distance(point, ip) < tree.Distance(point, nearest))
+            nearest = ip;
+      }
+      EXPECT_EQ(ind[i * k], nearest);
+
+      std::vector<Int_t> inRange1;
+      tree.FindInRange(point, 0.3, inRange1);
+      EXPECT_EQ(inRange[i], inRange1);
+   }
+}
+} // anonymous namespace
+
+TEST(TKDTree, BatchedQueries)
+{
+   CheckBatchedQueries(1000);
+}
+
+#ifdef R__USE_IMT
+TEST(TKDTree, ParallelBuild)
+{
+   const Int_t npoints = 100000;
+   TreeData data(npoints, 3);
+   TKDTreeID sequential(npoints, TreeData::kNDim, 8, data.fData);
+   sequential.Build();
+
+   ROOT::EnableImplicitMT(4);
+   TKDTreeID parallel(npoints, TreeData::kNDim, 8, data.fData);
+   parallel.Build();
+   CheckBatchedQueries(npoints);
+   ROOT::DisableImplicitMT();
+
+   ASSERT_EQ(parallel.GetNNodes(), sequential.GetNNodes());
+   for (Int_t inode = 0; inode < sequential.GetNNodes(); inode++) {
+      EXPECT_EQ(parallel.GetNodeAxis(inode), sequential.GetNodeAxis(inode));
+      EXPECT_EQ(parallel.GetNodeValue(inode), sequential.GetNodeValue(inode));
+   }
+   for (Int_t i = 0; i < npoints; i++)
+      EXPECT_EQ(parallel.GetIndPoints()[i], sequential.GetIndPoints()[i]);
+}
+#endif
@@ -0,0 +1,111 @@
+// Tests of the accuracy and of the throughput of the vectorized special functions of ROOT::Math
+
+#include "Math/VectorizedSpecFunc.h"
+#include "TStopwatch.h"
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <iostream>
+#include <random>
+#include <vector>
+
+namespace {
+
+constexpr int kN = 1 << 16;
+
+/// Evaluate the vectorized and the scalar function for kN values uniformly distributed in [a, b], compare them and
+/// report the time per value of both
+template <typename VecFunc, typename ScalarFunc>
+void CompareToScalar(const char *name, VecFunc vecFunc, ScalarFunc scalarFunc, double a, double b, double tolerance)
+{
+   const std::size_t kVS = vecCore::VectorSize<ROOT::Double_v>();
+   std::mt19937_64 gen(42);
+   std::uniform_real_distribution<double> dist(a, b);
+   std::vector<double> input(kN), vecOutput(kN), scalarOutput(kN);
+   for (auto &x : input)
+      x = dist(gen);
+
+   TStopwatch vecTimer;
+   for (std::size_t j = 0; j + kVS <= input.size(); j += kVS) {
+      ROOT::Double_v x;
+      vecCore::Load<ROOT::Double_v>(x, &input[j]);
+      vecCore::Store<ROOT::Double_v>(vecFunc(x), &vecOutput[j]);
+   }
+   vecTimer.Stop();
+
+   TStopwatch scalarTimer;
+   for (std::size_t j = 0; j < input.size(); ++j)
+      scalarOutput[j] = scalarFunc(input[j]);
+   scalarTimer.Stop();
+
+   for (std::size_t j = 0; j < input.size(); ++j) {
+      const double s = scalarOutput[j];
+      const double v = vecOutput[j];
+      if (std::isinf(s)) {
+         EXPECT_EQ(v, s) << name << " at x = " << input[j];
+         continue;
+      }
+      EXPECT_NEAR(v, s, tolerance * std::max(1.0, std::abs(s))) << name << " at x = " << input[j];
+   }
+
+   std::cout << name << ": " << 1e9 * scalarTimer.RealTime() / kN << " ns per value for the scalar function, "
+             << 1e9 * vecTimer.RealTime() / kN << " ns per value for the vectorized function" << std::endl;
+}
+
+constexpr double kTolerance = 1e-14;
+
+} // anonymous namespace
+
+TEST(VectorizedSpecFunc, Erf)
+{
+   CompareToScalar(
+      "erf", [](const ROOT::Double_v &x) { return ROOT::Math::erf(x); },
+      [](double x) { return ROOT::Math::erf(x); }, -7, 7, kTolerance);
+   CompareToScalar(
+      "erfc", [](const ROOT::Double_v &x) { return ROOT::Math::erfc(x); },
+      [](double x) { return ROOT::Math::erfc(x); }, -7, 30, kTolerance);
+}
+
+TEST(VectorizedSpecFunc, Lgamma)
+{
+   auto vecFunc = [](const ROOT::Double_v &x) { return ROOT::Math::lgamma(x); };
+   auto scalarFunc = [](double x) { return ROOT::Math::lgamma(x); };
+   CompareToScalar("lgamma", vecFunc, scalarFunc, 1e-3, 2000, kTolerance);
+   CompareToScalar("lgamma (negative)", vecFunc, scalarFunc, -60, 0, kTolerance);
+   CompareToScalar("lgamma (large)", vecFunc, scalarFunc, 1e7, 1e10, kTolerance);
+
+   // poles
+   EXPECT_TRUE(std::isinf(vecCore::Get(ROOT::Math::lgamma(ROOT::Double_v(0.0)), 0)));
+   EXPECT_TRUE(std::isinf(vecCore::Get(ROOT::Math::lgamma(ROOT::Double_v(-3.0)), 0)));
+}
+
+TEST(VectorizedSpecFunc, Pdf)
+{
+   CompareToScalar(
+      "landau_pdf", [](const ROOT::Double_v &x) { return ROOT::Math::landau_pdf(x, 1.5, 0.3); },
+      [](double x) { return ROOT::Math::landau_pdf(x, 1.5, 0.3); }, -20, 1000, kTolerance);
+   CompareToScalar(
+      "crystalball_function",
+      [](const ROOT::Double_v &x) { return ROOT::Math::crystalball_function(x, 1.2, 3.5, 0.7, 0.1); },
+      [](double x) { return ROOT::Math::crystalball_function(x, 1.2, 3.5, 0.7, 0.1); }, -20, 5, kTolerance);
+   CompareToScalar(
+      "crystalball_function (alpha < 0)",
+      [](const ROOT::Double_v &x) { return ROOT::Math::crystalball_function(x, -1.2, 3.5, 0.7, 0.1); },
+      [](double x) { return ROOT::Math::crystalball_function(x, -1.2, 3.5, 0.7, 0.1); }, -5, 20, kTolerance);
+   CompareToScalar(
+      "normal_pdf", [](const ROOT::Double_v &x) { return ROOT::Math::normal_pdf(x, 2, 1); },
+      [](double x) { return ROOT::Math::normal_pdf(x, 2, 1); }, -20, 20, kTolerance);
+   CompareToScalar(
+      "poisson_pdf",
+      [](const ROOT::Double_v &x) { return ROOT::Math::poisson_pdf(vecCore::math::Floor(x), 7.3); },
+      [](double x) { return ROOT::Math::poisson_pdf(static_cast<unsigned int>(std::floor(x)), 7.3); }, 0, 60,
+      kTolerance);
+}
+
+TEST(VectorizedSpecFunc, Cdf)
+{
+   CompareToScalar(
+      "normal_cdf", [](const ROOT::Double_v &x) { return ROOT::Math::normal_cdf(x, 2, 1); },
+      [](double x) { return ROOT::Math::normal_cdf(x, 2, 1); }, -20, 20, kTolerance);
+}
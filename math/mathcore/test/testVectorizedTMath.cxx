@@ -87,6 +87,7 @@ protected:
 TEST_VECTORIZED_TMATH_FUNCTION_FLT_LOG(Log2);
 TEST_VECTORIZED_TMATH_FUNCTION_FLT_RANGE(BreitWigner);
 TEST_VECTORIZED_TMATH_FUNCTION_FLT_RANGE(Gaus);
+TEST_VECTORIZED_TMATH_FUNCTION(Landau, -20, 1000);
 TEST_VECTORIZED_TMATH_FUNCTION_FLT_EXP(LaplaceDist);
 TEST_VECTORIZED_TMATH_FUNCTION_FLT_EXP(LaplaceDistI);
 
@@ -30,6 +30,14 @@ See the \ref Matrix page for the documentation of the linear algebra package
 #include "TDecompLU.h"
 #include "TMatrixDEigen.h"
 #include "TMath.h"
+#include "TROOT.h"
+
+#ifdef R__USE_IMT
+#include "ROOT/TSeq.hxx"
+#include "ROOT/TThreadExecutor.hxx"
+#endif
+
+#include <algorithm>
 
 templateClassImp(TMatrixT);
 
@@ -3071,74 +3079,146 @@ TMatrixT<Element> &TMatrixTAutoloadOps::ElementDiv(TMatrixT<Element> &target,con
    return target;
 }
 
+namespace {
+
+/// Number of rows of C computed by one task, and sizes of the blocks of the inner dimension and of the columns of C
+/// that are kept in cache while a block of rows is processed
+constexpr Int_t kMultRowBlock = 64;
+constexpr Int_t kMultInnerBlock = 256;
+constexpr Int_t kMultColBlock = 512;
+/// Products with fewer multiply-adds are not worth distributing over threads
+constexpr Double_t kMultMinParallelOps = 1 << 22;
+
+////////////////////////////////////////////////////////////////////////////////
+/// Call func(firstRow, endRow) for the blocks of kMultRowBlock rows of a product with nrows rows and nOps
+/// multiply-adds, in parallel if implicit multi-threading is enabled and the product is large enough.
+/// Every row of the product is computed by exactly one call, so the result does not depend on the parallelization.
+
+template <class F>
+void ForEachRowBlock(Int_t nrows, Double_t nOps, F &&func)
+{
+   const Int_t nBlocks = (nrows + kMultRowBlock - 1) / kMultRowBlock;
+   const auto block = [&](Int_t iBlock) {
+      const Int_t firstRow = iBlock * kMultRowBlock;
+      func(firstRow, std::min(nrows, firstRow + kMultRowBlock));
+   };
+#ifdef R__USE_IMT
+   if (nBlocks > 1 && nOps >= kMultMinParallelOps && ROOT::IsImplicitMTEnabled()) {
+      ROOT::TThreadExecutor pool;
+      pool.Foreach(block, ROOT::TSeq<Int_t>(0, nBlocks));
+      return;
+   }
+#else
+   (void)nOps;
+#endif
+   for (Int_t iBlock = 0; iBlock < nBlocks; iBlock++)
+      block(iBlock);
+}
+
+} // anonymous namespace
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Elementary routine to calculate matrix multiplication A*B
+///
+/// The rows of C are accumulated from the rows of B, C[i,] += A[i,k] * B[k,], over blocks of k and of the columns
+/// of C that fit in cache; the inner loop runs over contiguous memory and can be vectorized. Every element of C is
+/// summed over k in increasing order, as in the plain triple loop.
 
 template<class Element>
 void TMatrixTAutoloadOps::AMultB(const Element * const ap,Int_t na,Int_t ncolsa,
             const Element * const bp,Int_t nb,Int_t ncolsb,Element *cp)
 {
-   const Element *arp0 = ap;                     // Pointer to  A[i,0];
-   while (arp0 < ap+na) {
-      for (const Element *bcp = bp; bcp < bp+ncolsb; ) { // Pointer to the j-th column of B, Start bcp = B[0,0]
-         const Element *arp = arp0;                       // Pointer to the i-th row of A, reset to A[i,0]
-         Element cij = 0;
-         while (bcp < bp+nb) {                     // Scan the i-th row of A and
-            cij += *arp++ * *bcp;                   // the j-th col of B
-            bcp += ncolsb;
+   if (ncolsa <= 0 || ncolsb <= 0)
+      return;
+   const Int_t nrowsa = na / ncolsa;
+   const Int_t nrowsb = nb / ncolsb;
+
+   ForEachRowBlock(nrowsa, Double_t(nrowsa) * nrowsb * ncolsb, [=](Int_t firstRow, Int_t endRow) {
+      std::fill(cp + firstRow * ncolsb, cp + endRow * ncolsb, Element(0));
+      for (Int_t k0 = 0; k0 < nrowsb; k0 += kMultInnerBlock) {
+         const Int_t k1 = std::min(nrowsb, k0 + kMultInnerBlock);
+         for (Int_t j0 = 0; j0 < ncolsb; j0 += kMultColBlock) {
+            const Int_t j1 = std::min(ncolsb, j0 + kMultColBlock);
+            for (Int_t i = firstRow; i < endRow; i++) {
+               const Element *arp = ap + i * ncolsa;
+               Element *crp = cp + i * ncolsb;
+               for (Int_t k = k0; k < k1; k++) {
+                  const Element aik = arp[k];
+                  const Element *brp = bp + k * ncolsb;
+                  for (Int_t j = j0; j < j1; j++)
+                     crp[j] += aik * brp[j];
+               }
+            }
          }
-         *cp++ = cij;
-         bcp -= nb-1;                              // Set bcp to the (j+1)-th col
       }
-      arp0 += ncolsa;                             // Set ap to the (i+1)-th row
-   }
+   });
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 /// Elementary routine to calculate matrix multiplication A^T*B
+///
+/// Computed as AMultB with C[i,] += A[k,i] * B[k,], with the same summation order as the plain triple loop.
 
 template<class Element>
 void TMatrixTAutoloadOps::AtMultB(const Element * const ap,Int_t ncolsa,
              const Element * const bp,Int_t nb,Int_t ncolsb,Element *cp)
 {
-   const Element *acp0 = ap;           // Pointer to  A[i,0];
-   while (acp0 < ap+ncolsa) {
-      for (const Element *bcp = bp; bcp < bp+ncolsb; ) { // Pointer to the j-th column of B, Start bcp = B[0,0]
-         const Element *acp = acp0;                       // Pointer to the i-th column of A, reset to A[0,i]
-         Element cij = 0;
-         while (bcp < bp+nb) {           // Scan the i-th column of A and
-            cij += *acp * *bcp;           // the j-th col of B
-            acp += ncolsa;
-            bcp += ncolsb;
+   if (ncolsa <= 0 || ncolsb <= 0)
+      return;
+   const Int_t nrowsb = nb / ncolsb;
+
+   ForEachRowBlock(ncolsa, Double_t(ncolsa) * nrowsb * ncolsb, [=](Int_t firstRow, Int_t endRow) {
+      std::fill(cp + firstRow * ncolsb, cp + endRow * ncolsb, Element(0));
+      for (Int_t k0 = 0; k0 < nrowsb; k0 += kMultInnerBlock) {
+         const Int_t k1 = std::min(nrowsb, k0 + kMultInnerBlock);
+         for (Int_t j0 = 0; j0 < ncolsb; j0 += kMultColBlock) {
+            const Int_t j1 = std::min(ncolsb, j0 + kMultColBlock);
+            for (Int_t i = firstRow; i < endRow; i++) {
+               Element *crp = cp + i * ncolsb;
+               for (Int_t k = k0; k < k1; k++) {
+                  const Element aki = ap[k * ncolsa + i];
+                  const Element *brp = bp + k * ncolsb;
+                  for (Int_t j = j0; j < j1; j++)
+                     crp[j] += aki * brp[j];
+               }
+            }
          }
-         *cp++ = cij;
-         bcp -= nb-1;                    // Set bcp to the (j+1)-th col
       }
-      acp0++;                           // Set acp0 to the (i+1)-th col
-   }
+   });
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 /// Elementary routine to calculate matrix multiplication A*B^T
+///
+/// Every element of C is the scalar product of a row of A and a row of B. The rows of B are processed in blocks
+/// that stay in cache while the rows of A of a block of rows of C are scanned.
 
 template<class Element>
 void TMatrixTAutoloadOps::AMultBt(const Element * const ap,Int_t na,Int_t ncolsa,
              const Element * const bp,Int_t nb,Int_t ncolsb,Element *cp)
 {
-   const Element *arp0 = ap;                    // Pointer to  A[i,0];
-   while (arp0 < ap+na) {
-      const Element *brp0 = bp;                  // Pointer to  B[j,0];
-      while (brp0 < bp+nb) {
-         const Element *arp = arp0;               // Pointer to the i-th row of A, reset to A[i,0]
-         const Element *brp = brp0;               // Pointer to the j-th row of B, reset to B[j,0]
-         Element cij = 0;
-         while (brp < brp0+ncolsb)                 // Scan the i-th row of A and
-            cij += *arp++ * *brp++;                 // the j-th row of B
-         *cp++ = cij;
-         brp0 += ncolsb;                           // Set brp0 to the (j+1)-th row
+   if (ncolsa <= 0 || ncolsb <= 0)
+      return;
+   const Int_t nrowsa = na / ncolsa;
+   const Int_t nrowsb = nb / ncolsb;
+   // Rows of B per block, such that a block has about kMultInnerBlock * kMultColBlock elements
+   const Int_t rowBlockb = std::max(1, kMultInnerBlock * kMultColBlock / ncolsb);
+
+   ForEachRowBlock(nrowsa, Double_t(nrowsa) * nrowsb * ncolsb, [=](Int_t firstRow, Int_t endRow) {
+      for (Int_t j0 = 0; j0 < nrowsb; j0 += rowBlockb) {
+         const Int_t j1 = std::min(nrowsb, j0 + rowBlockb);
+         for (Int_t i = firstRow; i < endRow; i++) {
+            const Element *arp = ap + i * ncolsa;
+            for (Int_t j = j0; j < j1; j++) {
+               const Element *brp = bp + j * ncolsb;
+               Element cij = 0;
+               for (Int_t k = 0; k < ncolsb; k++)
+                  cij += arp[k] * brp[k];
+               cp[i * nrowsb + j] = cij;
+            }
+         }
       }
-      arp0 += ncolsa;                             // Set arp0 to the (i+1)-th row
-   }
+   });
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -104,6 +104,13 @@ public:
        Re-implement this function if needed.
    */
    virtual void SetErrorDef(double){};
+
+   /**
+       Return true if operator() can be called concurrently from several threads.
+       The numerical gradient components are then computed in parallel, using the ROOT
+       implicit multi-threading pool when it is enabled. Re-implement this function to opt in.
+   */
+   virtual bool IsThreadSafe() const { return false; }
 };
 
 } // namespace Minuit2
@@ -22,6 +22,7 @@
 #include <vector>
 #include <string>
 #include <functional>
+#include <memory>
 
 namespace ROOT {
 
@@ -30,6 +31,8 @@ namespace Minuit2 {
 class ModularFunctionMinimizer;
 class FCNBase;
 class FunctionMinimum;
+class MinosError;
+class MnPrint;
 class MnTraceObject;
 
 // enumeration specifying the type of Minuit2 minimizers
@@ -89,6 +92,10 @@ public:
    /// set the function to minimize
    void SetFunction(const ROOT::Math::IMultiGenFunction &func) override;
 
+   /// set directly a Minuit2 FCN of dimension nDim to minimize, the minimizer takes its ownership.
+   /// This allows for example to use a thread safe FCN (see FCNBase::IsThreadSafe)
+   void SetFCN(unsigned int nDim, std::unique_ptr<ROOT::Minuit2::FCNBase> fcn);
+
    /// set the function implementing Hessian computation
    void SetHessianFunction(std::function<bool(const std::vector<double> &, double *)> hfunc) override;
 
@@ -237,6 +244,16 @@ public:
    */
    bool GetMinosError(unsigned int i, double &errLow, double &errUp, int = 0) override;
 
+   /**
+      get the lower and upper minos errors for the parameters ipars, return false if Minos failed for any of them.
+      All the Minos minimizations are independent: they are run concurrently when the FCN is thread safe and
+      ROOT implicit multi-threading is enabled. Fixed or constant parameters get zero errors.
+      If a new minimum is found, the minimization is run again and the errors are computed one parameter at
+      a time as in GetMinosError. The status is updated as in GetMinosError
+   */
+   bool GetMinosErrors(const std::vector<unsigned int> &ipars, std::vector<double> &errLow,
+                       std::vector<double> &errUp);
+
    /**
       MINOS status code of last Minos run
        `status & 1 > 0`  : invalid lower error
@@ -306,6 +323,13 @@ protected:
    // internal function to compute Minos errors
    int RunMinosError(unsigned int i, double &errLow, double &errUp, int runopt);
 
+   // internal function to report a Minos result and return its status
+   int ProcessMinosError(const ROOT::Minuit2::MinosError &me, bool runLower, bool runUpper, double &errLow,
+                         double &errUp);
+
+   // internal function to check that a valid minimum exists before running Minos
+   bool CheckMinimumForMinos(MnPrint &print);
+
 private:
    unsigned int fDim; // dimension of the function to be minimized
    bool fUseFumili;
@@ -34,7 +34,9 @@ class FCNGradientBase;
 /**
     API class for calculating the numerical covariance matrix
     (== 2x Inverse Hessian == 2x Inverse 2nd derivative); can be used by the
-    user or Minuit itself
+    user or Minuit itself.
+    When the FCN is thread safe (see FCNBase::IsThreadSafe) and ROOT implicit
+    multi-threading is enabled, the second derivatives are computed concurrently.
  */
 
 class MnHesse {
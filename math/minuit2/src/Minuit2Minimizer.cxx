@@ -408,6 +408,15 @@ void Minuit2Minimizer::SetFunction(const ROOT::Math::IMultiGenFunction &func)
    }
 }
 
+void Minuit2Minimizer::SetFCN(unsigned int nDim, std::unique_ptr<ROOT::Minuit2::FCNBase> fcn)
+{
+   // set the Minuit2 FCN to be minimized
+   if (fMinuitFCN)
+      delete fMinuitFCN;
+   fDim = nDim;
+   fMinuitFCN = fcn.release();
+}
+
 void Minuit2Minimizer::SetHessianFunction(std::function<bool(const std::vector<double> &, double *)> hfunc)
 {
    // for Fumili not supported for the time being
@@ -859,20 +868,8 @@ bool Minuit2Minimizer::GetMinosError(unsigned int i, double &errLow, double &err
    //       GetMinimizer()->Minimize(*GetFCN(),fState, ROOT::Minuit2::MnStrategy(strategy), MaxFunctionCalls(),
    //       Tolerance());
    //    fState = min.UserState();
-   if (fMinimum == 0) {
-      print.Error("Failed - no function minimum existing");
-      return false;
-   }
-
-   if (!fMinimum->IsValid()) {
-      print.Error("Failed - invalid function minimum");
+   if (!CheckMinimumForMinos(print))
       return false;
-   }
-
-   fMinuitFCN->SetErrorDef(ErrorDef());
-   // if error def has been changed update it in FunctionMinimum
-   if (ErrorDef() != fMinimum->Up())
-      fMinimum->SetErrorDef(ErrorDef());
 
    int mstatus = RunMinosError(i, errLow, errUp, runopt);
 
@@ -906,6 +903,103 @@ bool Minuit2Minimizer::GetMinosError(unsigned int i, double &errLow, double &err
    return isValid;
 }
 
+bool Minuit2Minimizer::GetMinosErrors(const std::vector<unsigned int> &ipars, std::vector<double> &errLow,
+                                      std::vector<double> &errUp)
+{
+   // return the minos errors for the parameters ipars, computing all of them in a single MnMinos call
+   errLow.assign(ipars.size(), 0);
+   errUp.assign(ipars.size(), 0);
+
+   assert(fMinuitFCN);
+
+   MnPrint print("Minuit2Minimizer::GetMinosErrors", PrintLevel());
+
+   if (!CheckMinimumForMinos(print))
+      return false;
+
+   // skip const or fixed parameters
+   std::vector<unsigned int> pars;
+   std::vector<unsigned int> index;
+   for (unsigned int k = 0; k < ipars.size(); ++k) {
+      if (ipars[k] >= fDim || fState.Parameter(ipars[k]).IsConst() || fState.Parameter(ipars[k]).IsFixed())
+         continue;
+      pars.push_back(ipars[k]);
+      index.push_back(k);
+   }
+   bool isValid = pars.size() == ipars.size();
+   if (pars.empty())
+      return false;
+
+   const int debugLevel = PrintLevel();
+   // switch off Minuit2 printing
+   const int prev_level = (debugLevel <= 0) ? TurnOffPrintInfoLevel() : -2;
+   const int prevGlobalLevel = MnPrint::SetGlobalLevel(debugLevel);
+
+   // set the precision if needed
+   if (Precision() > 0)
+      fState.SetPrecision(Precision());
+
+   ROOT::Minuit2::MnMinos minos(*fMinuitFCN, *fMinimum);
+   // same tolerance cut off as in RunMinosError
+   std::vector<ROOT::Minuit2::MinosError> mes = minos.Minos(pars, MaxFunctionCalls(), std::max(Tolerance(), 0.01));
+
+   // restore global print level
+   if (prev_level > -2)
+      RestoreGlobalPrintLevel(prev_level);
+   MnPrint::SetGlobalLevel(prevGlobalLevel);
+
+   int mstatus = 0;
+   for (unsigned int k = 0; k < pars.size(); ++k) {
+      int status = ProcessMinosError(mes[k], true, true, errLow[index[k]], errUp[index[k]]);
+      if ((status & 1) != 0 || (status & 2) != 0)
+         isValid = false;
+      mstatus |= status;
+   }
+
+   // in case of a new minimum run again the minimization and then Minos one parameter at a time
+   if ((mstatus & 8) != 0) {
+      print.Info("Found a new minimum: run again the Minimization and Minos starting from the new point");
+      // release the parameters fixed in the states returned from Minos
+      for (auto ipar : pars)
+         ReleaseVariable(ipar);
+      if (!Minimize())
+         return false;
+      isValid = pars.size() == ipars.size();
+      mstatus = 8;
+      for (unsigned int k = 0; k < pars.size(); ++k) {
+         isValid &= GetMinosError(pars[k], errLow[index[k]], errUp[index[k]]);
+         mstatus |= fMinosStatus;
+      }
+      fMinosStatus = mstatus;
+      return isValid;
+   }
+
+   fStatus += 10 * mstatus;
+   fMinosStatus = mstatus;
+
+   return isValid;
+}
+
+bool Minuit2Minimizer::CheckMinimumForMinos(MnPrint &print)
+{
+   // check that a valid function minimum exists and update its error definition
+   if (fMinimum == 0) {
+      print.Error("Failed - no function minimum existing");
+      return false;
+   }
+
+   if (!fMinimum->IsValid()) {
+      print.Error("Failed - invalid function minimum");
+      return false;
+   }
+
+   fMinuitFCN->SetErrorDef(ErrorDef());
+   // if error def has been changed update it in FunctionMinimum
+   if (ErrorDef() != fMinimum->Up())
+      fMinimum->SetErrorDef(ErrorDef());
+   return true;
+}
+
 int Minuit2Minimizer::RunMinosError(unsigned int i, double &errLow, double &errUp, int runopt)
 {
 
@@ -923,9 +1017,6 @@ int Minuit2Minimizer::RunMinosError(unsigned int i, double &errLow, double &errU
 
    ROOT::Minuit2::MnMinos minos(*fMinuitFCN, *fMinimum);
 
-   // run MnCross
-   MnCross low;
-   MnCross up;
    int maxfcn = MaxFunctionCalls();
    double tol = Tolerance();
 
@@ -943,32 +1034,45 @@ int Minuit2Minimizer::RunMinosError(unsigned int i, double &errLow, double &errU
       maxfcn_used = 2 * (nvar + 1) * (200 + 100 * nvar + 5 * nvar * nvar);
    }
 
-   if (runLower) {
-      if (debugLevel >= 1) {
-         std::cout << "************************************************************************************************"
-                      "******\n";
-         std::cout << "Minuit2Minimizer::GetMinosError - Run MINOS LOWER error for parameter #" << i << " : "
-                   << par_name << " using max-calls " << maxfcn_used << ", tolerance " << tol << std::endl;
-      }
-      low = minos.Loval(i, maxfcn, tol);
+   if (runLower && debugLevel >= 1) {
+      std::cout << "************************************************************************************************"
+                   "******\n";
+      std::cout << "Minuit2Minimizer::GetMinosError - Run MINOS LOWER error for parameter #" << i << " : " << par_name
+                << " using max-calls " << maxfcn_used << ", tolerance " << tol << std::endl;
    }
-   if (runUpper) {
-      if (debugLevel >= 1) {
-         std::cout << "************************************************************************************************"
-                      "******\n";
-         std::cout << "Minuit2Minimizer::GetMinosError - Run MINOS UPPER error for parameter #" << i << " : "
-                   << par_name << " using max-calls " << maxfcn_used << ", tolerance " << tol << std::endl;
-      }
-      up = minos.Upval(i, maxfcn, tol);
+   if (runUpper && debugLevel >= 1) {
+      std::cout << "************************************************************************************************"
+                   "******\n";
+      std::cout << "Minuit2Minimizer::GetMinosError - Run MINOS UPPER error for parameter #" << i << " : " << par_name
+                << " using max-calls " << maxfcn_used << ", tolerance " << tol << std::endl;
    }
 
-   ROOT::Minuit2::MinosError me(i, fMinimum->UserState().Value(i), low, up);
+   // when both are needed, MnMinos computes the lower and upper crossings concurrently if the FCN allows it
+   ROOT::Minuit2::MinosError me;
+   if (runLower && runUpper)
+      me = minos.Minos(i, maxfcn, tol);
+   else if (runLower)
+      me = ROOT::Minuit2::MinosError(i, fMinimum->UserState().Value(i), minos.Loval(i, maxfcn, tol), MnCross());
+   else
+      me = ROOT::Minuit2::MinosError(i, fMinimum->UserState().Value(i), MnCross(), minos.Upval(i, maxfcn, tol));
 
    // restore global print level
    if (prev_level > -2)
       RestoreGlobalPrintLevel(prev_level);
    MnPrint::SetGlobalLevel(prevGlobalLevel);
 
+   return ProcessMinosError(me, runLower, runUpper, errLow, errUp);
+}
+
+int Minuit2Minimizer::ProcessMinosError(const ROOT::Minuit2::MinosError &me, bool runLower, bool runUpper,
+                                        double &errLow, double &errUp)
+{
+   // print the result of a Minos run, update the state in case of a new minimum and return the Minos status
+
+   const int debugLevel = PrintLevel();
+   const unsigned int i = me.Parameter();
+   const char *par_name = fState.Name(i);
+
    // debug result of Minos
    // print error message in Minos
    // Note that the only invalid condition can happen when the (npar-1) minimization fails
@@ -1062,11 +1166,11 @@ int Minuit2Minimizer::RunMinosError(unsigned int i, double &errLow, double &errU
    // in case of new minimum found update also the  minimum state
    if ((runLower && me.LowerNewMin()) && (runUpper && me.UpperNewMin())) {
       // take state with lower function value
-      fState = (low.State().Fval() < up.State().Fval()) ? low.State() : up.State();
+      fState = (me.LowerState().Fval() < me.UpperState().Fval()) ? me.LowerState() : me.UpperState();
    } else if (runLower && me.LowerNewMin()) {
-      fState = low.State();
+      fState = me.LowerState();
    } else if (runUpper && me.UpperNewMin()) {
-      fState = up.State();
+      fState = me.UpperState();
    }
 
    return mstatus;
@@ -18,6 +18,13 @@
 #include "Minuit2/ContoursError.h"
 #include "Minuit2/MnPrint.h"
 
+#ifdef R__USE_IMT
+#include "ROOT/TThreadExecutor.hxx"
+#include "TROOT.h"
+#endif
+
+#include <memory>
+
 namespace ROOT {
 
 namespace Minuit2 {
@@ -56,7 +63,9 @@ ContoursError MnContours::Contour(unsigned int px, unsigned int py, unsigned int
    double valx = fMinimum.UserState().Value(px);
    double valy = fMinimum.UserState().Value(py);
 
-   MinosError mex = minos.Minos(px);
+   // the Minos errors of the two parameters are computed together, concurrently when possible
+   std::vector<MinosError> mexy = minos.Minos(std::vector<unsigned int>{px, py});
+   MinosError mex = mexy[0];
    nfcn += mex.NFcn();
    if (!mex.IsValid()) {
       print.Error("unable to find first two points");
@@ -64,7 +73,7 @@ ContoursError MnContours::Contour(unsigned int px, unsigned int py, unsigned int
    }
    std::pair<double, double> ex = mex();
 
-   MinosError mey = minos.Minos(py);
+   MinosError mey = mexy[1];
    nfcn += mey.NFcn();
    if (!mey.IsValid()) {
       print.Error("unable to find second two points");
@@ -72,42 +81,49 @@ ContoursError MnContours::Contour(unsigned int px, unsigned int py, unsigned int
    }
    std::pair<double, double> ey = mey();
 
-   MnMigrad migrad(fFCN, fMinimum.UserState(), MnStrategy(std::max(0, int(fStrategy.Strategy() - 1))));
-
-   migrad.Fix(px);
-   migrad.SetValue(px, valx + ex.second);
-   FunctionMinimum exy_up = migrad();
-   nfcn += exy_up.NFcn();
-   if (!exy_up.IsValid()) {
-      print.Error("unable to find Upper y Value for x Parameter", px);
-      return ContoursError(px, py, result, mex, mey, nfcn);
-   }
-
-   migrad.SetValue(px, valx + ex.first);
-   FunctionMinimum exy_lo = migrad();
-   nfcn += exy_lo.NFcn();
-   if (!exy_lo.IsValid()) {
-      print.Error("unable to find Lower y Value for x Parameter", px);
-      return ContoursError(px, py, result, mex, mey, nfcn);
+   // the four minimizations with x (y) fixed at its upper and lower Minos value are independent:
+   // they all start from the minimum and, with a thread-safe FCN and implicit multi-threading, run concurrently
+   const MnStrategy migradStrategy(std::max(0, int(fStrategy.Strategy() - 1)));
+   const unsigned int fixedPar[4] = {px, px, py, py};
+   const double fixedValue[4] = {valx + ex.second, valx + ex.first, valy + ey.second, valy + ey.first};
+   std::unique_ptr<FunctionMinimum> edgeMin[4];
+   auto minimizeEdge = [&](unsigned int k) {
+      MnMigrad migrad(fFCN, fMinimum.UserState(), migradStrategy);
+      migrad.Fix(fixedPar[k]);
+      migrad.SetValue(fixedPar[k], fixedValue[k]);
+      edgeMin[k].reset(new FunctionMinimum(migrad()));
+   };
+#ifdef R__USE_IMT
+   if (fFCN.IsThreadSafe() && ROOT::IsImplicitMTEnabled()) {
+      const int printLevel = MnPrint::GlobalLevel();
+      ROOT::TThreadExecutor pool;
+      pool.Foreach(
+         [&](unsigned int k) {
+            const int prevLevel = MnPrint::SetGlobalLevel(printLevel);
+            minimizeEdge(k);
+            MnPrint::SetGlobalLevel(prevLevel);
+         },
+         ROOT::TSeqU(4));
+   } else
+#endif
+   {
+      for (unsigned int k = 0; k < 4; ++k)
+         minimizeEdge(k);
    }
 
-   MnMigrad migrad1(fFCN, fMinimum.UserState(), MnStrategy(std::max(0, int(fStrategy.Strategy() - 1))));
-   migrad1.Fix(py);
-   migrad1.SetValue(py, valy + ey.second);
-   FunctionMinimum eyx_up = migrad1();
-   nfcn += eyx_up.NFcn();
-   if (!eyx_up.IsValid()) {
-      print.Error("unable to find Upper x Value for y Parameter", py);
-      return ContoursError(px, py, result, mex, mey, nfcn);
-   }
-
-   migrad1.SetValue(py, valy + ey.first);
-   FunctionMinimum eyx_lo = migrad1();
-   nfcn += eyx_lo.NFcn();
-   if (!eyx_lo.IsValid()) {
-      print.Error("unable to find Lower x Value for y Parameter", py);
-      return ContoursError(px, py, result, mex, mey, nfcn);
+   const char *edgeName[4] = {"Upper y Value for x", "Lower y Value for x", "Upper x Value for y",
+                              "Lower x Value for y"};
+   for (unsigned int k = 0; k < 4; ++k) {
+      nfcn += edgeMin[k]->NFcn();
+      if (!edgeMin[k]->IsValid()) {
+         print.Error("unable to find", edgeName[k], "Parameter", fixedPar[k]);
+         return ContoursError(px, py, result, mex, mey, nfcn);
+      }
    }
+   const FunctionMinimum &exy_up = *edgeMin[0];
+   const FunctionMinimum &exy_lo = *edgeMin[1];
+   const FunctionMinimum &eyx_up = *edgeMin[2];
+   const FunctionMinimum &eyx_lo = *edgeMin[3];
 
    double scalx = 1. / (ex.second - ex.first);
    double scaly = 1. / (ey.second - ey.first);
@@ -24,6 +24,13 @@
 #include "Minuit2/MnPrint.h"
 #include "Minuit2/MPIProcess.h"
 
+#ifdef R__USE_IMT
+#include "ROOT/TThreadExecutor.hxx"
+#include "TROOT.h"
+#endif
+
+#include <vector>
+
 namespace ROOT {
 
 namespace Minuit2 {
@@ -228,29 +235,40 @@ MinimumState MnHesse::ComputeNumerical(const MnFcn &mfcn, const MinimumState &st
    print.Debug("Gradient is", st.Gradient().IsAnalytical() ? "analytical" : "numerical", "\n  point:", x,
                "\n  fcn  :", amin, "\n  grad :", grd, "\n  step :", gst, "\n  g2   :", g2);
 
-   for (unsigned int i = 0; i < n; i++) {
+   // returns the diagonal matrix used as error matrix when the Hessian cannot be computed
+   auto diagonalMatrix = [&]() {
+      MnAlgebraicSymMatrix diag(n);
+      for (unsigned int j = 0; j < n; j++) {
+         double tmp = g2(j) < prec.Eps2() ? 1. : 1. / g2(j);
+         diag(j, j) = tmp < prec.Eps2() ? 1. : tmp;
+      }
+      return diag;
+   };
 
-      double xtf = x(i);
+   // compute the second derivative of parameter i; xpar is modified during the computation and restored at the end.
+   // Returns false if the second derivative is zero.
+   auto computeDiagonal = [&](unsigned int i, MnAlgebraicVector &xpar, MnPrint &printer) {
+      double xtf = xpar(i);
       double dmin = 8. * prec.Eps2() * (std::fabs(xtf) + prec.Eps2());
       double d = std::fabs(gst(i));
       if (d < dmin)
          d = dmin;
 
-      print.Debug("Derivative parameter", i, "d =", d, "dmin =", dmin);
+      printer.Debug("Derivative parameter", i, "d =", d, "dmin =", dmin);
 
       for (unsigned int icyc = 0; icyc < Ncycles(); icyc++) {
          double sag = 0.;
          double fs1 = 0.;
          double fs2 = 0.;
          for (unsigned int multpy = 0; multpy < 5; multpy++) {
-            x(i) = xtf + d;
-            fs1 = mfcn(x);
-            x(i) = xtf - d;
-            fs2 = mfcn(x);
-            x(i) = xtf;
+            xpar(i) = xtf + d;
+            fs1 = mfcn(xpar);
+            xpar(i) = xtf - d;
+            fs2 = mfcn(xpar);
+            xpar(i) = xtf;
             sag = 0.5 * (fs1 + fs2 - 2. * amin);
 
-            print.Debug("cycle", icyc, "mul", multpy, "\tsag =", sag, "d =", d);
+            printer.Debug("cycle", icyc, "mul", multpy, "\tsag =", sag, "d =", d);
 
             //  Now as F77 Minuit - check that sag is not zero
             if (sag != 0)
@@ -267,18 +285,7 @@ MinimumState MnHesse::ComputeNumerical(const MnFcn &mfcn, const MinimumState &st
          }
 
       L26:
-         // get parameter name for i
-         // (need separate scope for avoiding compl error when declaring name)
-         print.Warn("2nd derivative zero for parameter", trafo.Name(trafo.ExtOfInt(i)),
-                    "; MnHesse fails and will return diagonal matrix");
-
-         for (unsigned int j = 0; j < n; j++) {
-            double tmp = g2(j) < prec.Eps2() ? 1. : 1. / g2(j);
-            vhmat(j, j) = tmp < prec.Eps2() ? 1. : tmp;
-         }
-
-         return MinimumState(st.Parameters(), MinimumError(vhmat, MinimumError::MnHesseFailed), st.Gradient(), st.Edm(),
-                             mfcn.NumOfCalls());
+         return false;
 
       L30:
          double g2bfor = g2(i);
@@ -294,8 +301,8 @@ MinimumState MnHesse::ComputeNumerical(const MnFcn &mfcn, const MinimumState &st
          if (d < dmin)
             d = dmin;
 
-         print.Debug("g1 =", grd(i), "g2 =", g2(i), "step =", gst(i), "d =", d, "diffd =", std::fabs(d - dlast) / d,
-                     "diffg2 =", std::fabs(g2(i) - g2bfor) / g2(i));
+         printer.Debug("g1 =", grd(i), "g2 =", g2(i), "step =", gst(i), "d =", d, "diffd =", std::fabs(d - dlast) / d,
+                       "diffg2 =", std::fabs(g2(i) - g2bfor) / g2(i));
 
          // see if converged
          if (std::fabs((d - dlast) / d) < Tolerstp())
@@ -306,18 +313,60 @@ MinimumState MnHesse::ComputeNumerical(const MnFcn &mfcn, const MinimumState &st
          d = std::max(d, 0.1 * dlast);
       }
       vhmat(i, i) = g2(i);
-      if (mfcn.NumOfCalls() > maxcalls) {
-
-         // std::cout<<"maxcalls " << maxcalls << " " << mfcn.NumOfCalls() << "  " <<   st.NFcn() << std::endl;
-         print.Warn("Maximum number of allowed function calls exhausted; will return diagonal matrix");
-
-         for (unsigned int j = 0; j < n; j++) {
-            double tmp = g2(j) < prec.Eps2() ? 1. : 1. / g2(j);
-            vhmat(j, j) = tmp < prec.Eps2() ? 1. : tmp;
-         }
-
-         return MinimumState(st.Parameters(), MinimumError(vhmat, MinimumError::MnReachedCallLimit), st.Gradient(),
-                             st.Edm(), mfcn.NumOfCalls());
+      return true;
+   };
+
+   auto failZeroDerivative = [&](unsigned int i) {
+      // get parameter name for i
+      print.Warn("2nd derivative zero for parameter", trafo.Name(trafo.ExtOfInt(i)),
+                 "; MnHesse fails and will return diagonal matrix");
+
+      return MinimumState(st.Parameters(), MinimumError(diagonalMatrix(), MinimumError::MnHesseFailed), st.Gradient(),
+                          st.Edm(), mfcn.NumOfCalls());
+   };
+
+   auto failCallLimit = [&]() {
+      print.Warn("Maximum number of allowed function calls exhausted; will return diagonal matrix");
+
+      return MinimumState(st.Parameters(), MinimumError(diagonalMatrix(), MinimumError::MnReachedCallLimit),
+                          st.Gradient(), st.Edm(), mfcn.NumOfCalls());
+   };
+
+#ifdef R__USE_IMT
+   // the second derivatives are independent: with a thread-safe FCN compute them on the implicit multi-threading
+   // pool, each task on its own copy of the parameters. The call limit is then only checked once all are done.
+   const bool concurrent = n > 1 && mfcn.Fcn().IsThreadSafe() && ROOT::IsImplicitMTEnabled();
+#else
+   const bool concurrent = false;
+#endif
+
+   if (concurrent) {
+#ifdef R__USE_IMT
+      // the print level is thread local: propagate it to the worker threads
+      const int printLevel = MnPrint::GlobalLevel();
+      std::vector<char> isZero(n, 0);
+      ROOT::TThreadExecutor pool;
+      pool.Foreach(
+         [&](unsigned int i) {
+            const int prevLevel = MnPrint::SetGlobalLevel(printLevel);
+            MnPrint printtl("MnHesse[MT]");
+            MnAlgebraicVector xtl = x;
+            isZero[i] = !computeDiagonal(i, xtl, printtl);
+            MnPrint::SetGlobalLevel(prevLevel);
+         },
+         ROOT::TSeqU(n));
+      for (unsigned int i = 0; i < n; i++)
+         if (isZero[i])
+            return failZeroDerivative(i);
+      if (mfcn.NumOfCalls() > maxcalls)
+         return failCallLimit();
+#endif
+   } else {
+      for (unsigned int i = 0; i < n; i++) {
+         if (!computeDiagonal(i, x, print))
+            return failZeroDerivative(i);
+         if (mfcn.NumOfCalls() > maxcalls)
+            return failCallLimit();
       }
    }
 
@@ -334,7 +383,24 @@ MinimumState MnHesse::ComputeNumerical(const MnFcn &mfcn, const MinimumState &st
 
    // off-diagonal Elements
    // initial starting values
-   if (n > 0) {
+   if (concurrent) {
+#ifdef R__USE_IMT
+      // one task per row of the upper triangle
+      ROOT::TThreadExecutor pool;
+      pool.Foreach(
+         [&](unsigned int i) {
+            MnAlgebraicVector xtl = x;
+            xtl(i) += dirin(i);
+            for (unsigned int j = i + 1; j < n; j++) {
+               xtl(j) += dirin(j);
+               double fs1 = mfcn(xtl);
+               vhmat(i, j) = (fs1 + amin - yy(i) - yy(j)) / (dirin(i) * dirin(j));
+               xtl(j) -= dirin(j);
+            }
+         },
+         ROOT::TSeqU(n - 1));
+#endif
+   } else if (n > 0) {
       MPIProcess mpiprocOffDiagonal(n * (n - 1) / 2, 0);
       unsigned int startParIndexOffDiagonal = mpiprocOffDiagonal.StartElementIndex();
       unsigned int endParIndexOffDiagonal = mpiprocOffDiagonal.EndElementIndex();
@@ -15,6 +15,11 @@
 #include "Minuit2/MinosError.h"
 #include "Minuit2/MnPrint.h"
 
+#ifdef R__USE_IMT
+#include "ROOT/TThreadExecutor.hxx"
+#include "TROOT.h"
+#endif
+
 namespace ROOT {
 
 namespace Minuit2 {
@@ -78,17 +83,50 @@ MinosError MnMinos::Minos(unsigned int par, unsigned int maxcalls, double toler)
 
    MnPrint print("MnMinos");
 
-   MnCross up = Upval(par, maxcalls, toler);
+   MinosError mnerr = Minos(std::vector<unsigned int>(1, par), maxcalls, toler).front();
 
-   print.Debug("Function calls to find upper error", up.NFcn());
+   print.Debug("Function calls to find lower and upper errors", mnerr.NFcn());
 
-   MnCross lo = Loval(par, maxcalls, toler);
+   print.Debug("return Minos error", mnerr.Lower(), ",", mnerr.Upper());
 
-   print.Debug("Function calls to find lower error", lo.NFcn());
+   return mnerr;
+}
 
-   print.Debug("return Minos error", lo.Value(), ",", up.Value());
+std::vector<MinosError> MnMinos::Minos(const std::vector<unsigned int> &pars, unsigned int maxcalls, double toler) const
+{
+   // do full minos error analysis for the given parameters
+   // the crossing 2*i is the upper and 2*i+1 the lower one of parameter pars[i]
+
+   const unsigned int ncross = 2 * pars.size();
+   std::vector<MnCross> crosses(ncross);
+   auto findCross = [&](unsigned int icross) {
+      crosses[icross] = FindCrossValue(icross % 2 == 0 ? 1 : -1, pars[icross / 2], maxcalls, toler);
+   };
+
+#ifdef R__USE_IMT
+   if (ncross > 1 && fFCN.IsThreadSafe() && ROOT::IsImplicitMTEnabled()) {
+      // the print level is thread local: propagate it to the worker threads
+      const int printLevel = MnPrint::GlobalLevel();
+      ROOT::TThreadExecutor pool;
+      pool.Foreach(
+         [&](unsigned int icross) {
+            const int prevLevel = MnPrint::SetGlobalLevel(printLevel);
+            findCross(icross);
+            MnPrint::SetGlobalLevel(prevLevel);
+         },
+         ROOT::TSeqU(ncross));
+   } else
+#endif
+   {
+      for (unsigned int icross = 0; icross < ncross; ++icross)
+         findCross(icross);
+   }
 
-   return MinosError(par, fMinimum.UserState().Value(par), lo, up);
+   std::vector<MinosError> result;
+   result.reserve(pars.size());
+   for (unsigned int i = 0; i < pars.size(); ++i)
+      result.emplace_back(pars[i], fMinimum.UserState().Value(pars[i]), crosses[2 * i + 1], crosses[2 * i]);
+   return result;
 }
 
 MnCross MnMinos::FindCrossValue(int direction, unsigned int par, unsigned int maxcalls, double toler) const
@@ -10,6 +10,7 @@
 #include "Minuit2/Numerical2PGradientCalculator.h"
 #include "Minuit2/InitialGradientCalculator.h"
 #include "Minuit2/MnFcn.h"
+#include "Minuit2/FCNBase.h"
 #include "Minuit2/MnUserTransformation.h"
 #include "Minuit2/MnMachinePrecision.h"
 #include "Minuit2/MinimumParameters.h"
@@ -21,9 +22,15 @@
 #include <omp.h>
 #endif
 
+#ifdef R__USE_IMT
+#include "ROOT/TThreadExecutor.hxx"
+#include "TROOT.h"
+#endif
+
 #include <cmath>
 #include <cassert>
 #include <iomanip>
+#include <mutex>
 
 #include "Minuit2/MPIProcess.h"
 
@@ -97,42 +104,34 @@ operator()(const MinimumParameters &par, const FunctionGradient &Gradient) const
 
    print.Debug("Calculating gradient around function value", fcnmin, "\n\t at point", par.Vec());
 
-#ifndef _OPENMP
-
-   MPIProcess mpiproc(n, 0);
-
-   // for serial execution this can be outside the loop
-   MnAlgebraicVector x = par.Vec();
-
-   unsigned int startElementIndex = mpiproc.StartElementIndex();
-   unsigned int endElementIndex = mpiproc.EndElementIndex();
-
-   for (unsigned int i = startElementIndex; i < endElementIndex; i++) {
-
-#else
-
-   // parallelize this loop using OpenMP
-//#define N_PARALLEL_PAR 5
-#pragma omp parallel
-#pragma omp for
-   //#pragma omp for schedule (static, N_PARALLEL_PAR)
-
-   for (int i = 0; i < int(n); i++) {
-
-#endif
-
-#ifdef _OPENMP
-      // create in loop since each thread will use its own copy
-      MnAlgebraicVector x = par.Vec();
-#endif
-
+   // printing of the steps, serialized when the gradient components are computed concurrently
+   std::mutex printMutex;
+   auto traceStep = [&](MnPrint &printer, unsigned int i, unsigned int j, const MnAlgebraicVector &x, double step,
+                        double fs1, double fs2) {
+      if (i == 0 && j == 0) {
+         printer.Trace([&](std::ostream &os) {
+            os << std::setw(10) << "parameter" << std::setw(6) << "cycle" << std::setw(15) << "x" << std::setw(15)
+               << "step" << std::setw(15) << "f1" << std::setw(15) << "f2" << std::setw(15) << "grd"
+               << std::setw(15) << "g2" << std::endl;
+         });
+      }
+      printer.Trace([&](std::ostream &os) {
+         const int pr = os.precision(13);
+         const int iext = Trafo().ExtOfInt(i);
+         os << std::setw(10) << Trafo().Name(iext) << std::setw(5) << j << "  " << x(i) << " " << step << " " << fs1
+            << " " << fs2 << " " << grd(i) << " " << g2(i) << std::endl;
+         os.precision(pr);
+      });
+   };
+
+   // compute the gradient component i; x is modified during the computation and restored at the end
+   auto computeComponent = [&](unsigned int i, MnAlgebraicVector &x, bool concurrent) {
       double xtf = x(i);
       double epspri = eps2 + std::fabs(grd(i) * eps2);
       double stepb4 = 0.;
       for (unsigned int j = 0; j < ncycle; j++) {
          double optstp = std::sqrt(dfmin / (std::fabs(g2(i)) + epspri));
          double step = std::max(optstp, std::fabs(0.1 * gstep(i)));
-         //       std::cout<<"step: "<<step;
          if (Trafo().Parameter(Trafo().ExtOfInt(i)).HasLimits()) {
             if (step > 0.5)
                step = 0.5;
@@ -140,24 +139,14 @@ operator()(const MinimumParameters &par, const FunctionGradient &Gradient) const
          double stpmax = 10. * std::fabs(gstep(i));
          if (step > stpmax)
             step = stpmax;
-         //       std::cout<<" "<<step;
          double stpmin = std::max(vrysml, 8. * std::fabs(eps2 * x(i)));
          if (step < stpmin)
             step = stpmin;
-         //       std::cout<<" "<<step<<std::endl;
-         //       std::cout<<"step: "<<step<<std::endl;
          if (std::fabs((step - stepb4) / step) < StepTolerance()) {
-            //    std::cout<<"(step-stepb4)/step"<<std::endl;
-            //    std::cout<<"j= "<<j<<std::endl;
-            //    std::cout<<"step= "<<step<<std::endl;
             break;
          }
          gstep(i) = step;
          stepb4 = step;
-         //       MnAlgebraicVector pstep(n);
-         //       pstep(i) = step;
-         //       double fs1 = Fcn()(pstate + pstep);
-         //       double fs2 = Fcn()(pstate - pstep);
 
          x(i) = xtf + step;
          double fs1 = Fcn()(x);
@@ -169,56 +158,63 @@ operator()(const MinimumParameters &par, const FunctionGradient &Gradient) const
          grd(i) = 0.5 * (fs1 - fs2) / step;
          g2(i) = (fs1 + fs2 - 2. * fcnmin) / step / step;
 
-#ifdef _OPENMP
-#pragma omp critical
-#endif
-         {
-#ifdef _OPENMP
+         if (concurrent) {
+            std::lock_guard<std::mutex> lock(printMutex);
             // must create thread-local MnPrint instances when printing inside threads
-            MnPrint printtl("Numerical2PGradientCalculator[OpenMP]");
-#endif
-            if (i == 0 && j == 0) {
-#ifdef _OPENMP
-               printtl.Trace([&](std::ostream &os) {
-#else
-               print.Trace([&](std::ostream &os) {
-#endif
-                  os << std::setw(10) << "parameter" << std::setw(6) << "cycle" << std::setw(15) << "x" << std::setw(15)
-                     << "step" << std::setw(15) << "f1" << std::setw(15) << "f2" << std::setw(15) << "grd"
-                     << std::setw(15) << "g2" << std::endl;
-               });
-            }
-#ifdef _OPENMP
-            printtl.Trace([&](std::ostream &os) {
-#else
-            print.Trace([&](std::ostream &os) {
-#endif
-               const int pr = os.precision(13);
-               const int iext = Trafo().ExtOfInt(i);
-               os << std::setw(10) << Trafo().Name(iext) << std::setw(5) << j << "  " << x(i) << " " << step << " "
-                  << fs1 << " " << fs2 << " " << grd(i) << " " << g2(i) << std::endl;
-               os.precision(pr);
-            });
+            MnPrint printtl("Numerical2PGradientCalculator[MT]");
+            traceStep(printtl, i, j, x, step, fs1, fs2);
+         } else {
+            traceStep(print, i, j, x, step, fs1, fs2);
          }
 
          if (std::fabs(grdb4 - grd(i)) / (std::fabs(grd(i)) + dfmin / step) < GradTolerance()) {
-            //    std::cout<<"j= "<<j<<std::endl;
-            //    std::cout<<"step= "<<step<<std::endl;
-            //    std::cout<<"fs1, fs2: "<<fs1<<" "<<fs2<<std::endl;
-            //    std::cout<<"fs1-fs2: "<<fs1-fs2<<std::endl;
             break;
          }
       }
+   };
+
+#ifdef _OPENMP
+
+   // parallelize this loop using OpenMP
+#pragma omp parallel
+#pragma omp for
+   for (int i = 0; i < int(n); i++) {
+      // create in loop since each thread will use its own copy
+      MnAlgebraicVector x = par.Vec();
+      computeComponent(i, x, true);
+   }
+
+#else
+
+#ifdef R__USE_IMT
+   // the components are independent: with a thread-safe FCN compute them on the implicit multi-threading pool
+   if (n > 1 && Fcn().Fcn().IsThreadSafe() && ROOT::IsImplicitMTEnabled()) {
+      ROOT::TThreadExecutor pool;
+      pool.Foreach(
+         [&](unsigned int i) {
+            MnAlgebraicVector x = par.Vec();
+            computeComponent(i, x, true);
+         },
+         ROOT::TSeqU(n));
+   } else
+#endif
+   {
+      MPIProcess mpiproc(n, 0);
+
+      // for serial execution this can be outside the loop
+      MnAlgebraicVector x = par.Vec();
+
+      unsigned int startElementIndex = mpiproc.StartElementIndex();
+      unsigned int endElementIndex = mpiproc.EndElementIndex();
+
+      for (unsigned int i = startElementIndex; i < endElementIndex; i++)
+         computeComponent(i, x, false);
 
-      //     vgrd(i) = grd;
-      //     vgrd2(i) = g2;
-      //     vgstp(i) = gstep;
+      mpiproc.SyncVector(grd);
+      mpiproc.SyncVector(g2);
+      mpiproc.SyncVector(gstep);
    }
 
-#ifndef _OPENMP
-   mpiproc.SyncVector(grd);
-   mpiproc.SyncVector(g2);
-   mpiproc.SyncVector(gstep);
 #endif
 
    // print after parallel processing to avoid synchronization issues
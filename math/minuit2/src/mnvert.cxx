@@ -22,53 +22,68 @@ namespace Minuit2 {
 
 int mnvert(MnAlgebraicSymMatrix &a)
 {
+   // The matrix is stored packed by columns of its upper triangle: element (j, k) with j <= k is at
+   // k * (k + 1) / 2 + j. All the loops run over the rows of a column, so that they access contiguous
+   // memory without the index computation of the element accessor and can be vectorized.
 
-   unsigned int nrow = a.Nrow();
-   MnAlgebraicVector s(nrow);
-   MnAlgebraicVector q(nrow);
-   MnAlgebraicVector pp(nrow);
+   const unsigned int nrow = a.Nrow();
+   double *data = a.Data();
+   MnAlgebraicVector sv(nrow);
+   MnAlgebraicVector qv(nrow);
+   MnAlgebraicVector ppv(nrow);
+   double *s = sv.Data();
+   double *q = qv.Data();
+   double *pp = ppv.Data();
 
    for (unsigned int i = 0; i < nrow; i++) {
-      double si = a(i, i);
+      double si = data[i * (i + 1) / 2 + i];
       if (si < 0.)
          return 1;
-      s(i) = 1. / std::sqrt(si);
+      s[i] = 1. / std::sqrt(si);
    }
 
-   for (unsigned int i = 0; i < nrow; i++)
-      for (unsigned int j = i; j < nrow; j++)
-         a(i, j) *= (s(i) * s(j));
+   for (unsigned int k = 0; k < nrow; k++) {
+      double *col = data + k * (k + 1) / 2;
+      const double sk = s[k];
+      for (unsigned int j = 0; j <= k; j++)
+         col[j] *= s[j] * sk;
+   }
 
-   for (unsigned i = 0; i < nrow; i++) {
-      unsigned int k = i;
-      if (a(k, k) == 0.)
+   for (unsigned int k = 0; k < nrow; k++) {
+      double *colk = data + k * (k + 1) / 2;
+      if (colk[k] == 0.)
          return 1;
-      q(k) = 1. / a(k, k);
-      pp(k) = 1.;
-      a(k, k) = 0.;
-      unsigned int kp1 = k + 1;
-      if (k != 0) {
-         for (unsigned int j = 0; j < k; j++) {
-            pp(j) = a(j, k);
-            q(j) = a(j, k) * q(k);
-            a(j, k) = 0.;
-         }
+      q[k] = 1. / colk[k];
+      pp[k] = 1.;
+      colk[k] = 0.;
+      // column k above the diagonal
+      for (unsigned int j = 0; j < k; j++) {
+         pp[j] = colk[j];
+         q[j] = colk[j] * q[k];
+         colk[j] = 0.;
+      }
+      // row k right of the diagonal
+      for (unsigned int j = k + 1; j < nrow; j++) {
+         double &akj = data[j * (j + 1) / 2 + k];
+         pp[j] = akj;
+         q[j] = -akj * q[k];
+         akj = 0.;
       }
-      if (k != nrow - 1) {
-         for (unsigned int j = kp1; j < nrow; j++) {
-            pp(j) = a(k, j);
-            q(j) = -a(k, j) * q(k);
-            a(k, j) = 0.;
-         }
+      // rank one update a(j, l) += pp(j) * q(l) for j <= l
+      for (unsigned int l = 0; l < nrow; l++) {
+         double *col = data + l * (l + 1) / 2;
+         const double ql = q[l];
+         for (unsigned int j = 0; j <= l; j++)
+            col[j] += pp[j] * ql;
       }
-      for (unsigned int j = 0; j < nrow; j++)
-         for (k = j; k < nrow; k++)
-            a(j, k) += (pp(j) * q(k));
    }
 
-   for (unsigned int j = 0; j < nrow; j++)
-      for (unsigned int k = j; k < nrow; k++)
-         a(j, k) *= (s(j) * s(k));
+   for (unsigned int k = 0; k < nrow; k++) {
+      double *col = data + k * (k + 1) / 2;
+      const double sk = s[k];
+      for (unsigned int j = 0; j <= k; j++)
+         col[j] *= s[j] * sk;
+   }
 
    return 0;
 }
@@ -0,0 +1,220 @@
+// Tests of the Minos errors and contours of Minuit2Minimizer, computed serially and,
+// for a thread safe FCN with implicit multi-threading, concurrently
+
+#include "Minuit2/Minuit2Minimizer.h"
+#include "Minuit2/FCNBase.h"
+
+#include "RConfigure.h"
+#include "TROOT.h"
+
+#include "gtest/gtest.h"
+
+#include <cmath>
+#include <memory>
+#include <vector>
+
+using ROOT::Minuit2::FCNBase;
+using ROOT::Minuit2::Minuit2Minimizer;
+
+namespace {
+
+// chi2 of an exponential a * exp(-b * x) + c fitted to fixed data points: the Minos errors are asymmetric
+class ExpChi2FCN : public FCNBase {
+public:
+   double operator()(const std::vector<double> &p) const override
+   {
+      static const double y[10] = {11.3, 8.2, 6.8, 5.1, 4.3, 3.2, 2.9, 2.4, 2.3, 1.7};
+      double chi2 = 0;
+      for (int i = 0; i < 10; ++i) {
+         const double sigma = 0.1 * y[i] + 0.2;
+         const double r = (y[i] - p[0] * std::exp(-p[1] * i) - p[2]) / sigma;
+         chi2 += r * r;
+      }
+      return chi2;
+   }
+   double Up() const override { return 1.; }
+   bool IsThreadSafe() const override { return true; }
+};
+
+// quadratic form x^T V^-1 x of three correlated parameters with covariance V
+class QuadraticFCN : public FCNBase {
+public:
+   static constexpr double kCov[3][3] = {{4., 1.2, 0.5}, {1.2, 1., -0.3}, {0.5, -0.3, 2.}};
+
+   QuadraticFCN()
+   {
+      // inverse of the covariance matrix by cofactors
+      const double(&v)[3][3] = kCov;
+      const double det = v[0][0] * (v[1][1] * v[2][2] - v[1][2] * v[2][1]) -
+                         v[0][1] * (v[1][0] * v[2][2] - v[1][2] * v[2][0]) +
+                         v[0][2] * (v[1][0] * v[2][1] - v[1][1] * v[2][0]);
+      for (int i = 0; i < 3; ++i) {
+         for (int j = 0; j < 3; ++j) {
+            const int i1 = (j + 1) % 3, i2 = (j + 2) % 3, j1 = (i + 1) % 3, j2 = (i + 2) % 3;
+            fInv[i][j] = (v[i1][j1] * v[i2][j2] - v[i1][j2] * v[i2][j1]) / det;
+         }
+      }
+   }
+   double operator()(const std::vector<double> &p) const override
+   {
+      double f = 0;
+      for (int i = 0; i < 3; ++i) {
+         for (int j = 0; j < 3; ++j)
+            f += (p[i] - 1.) * fInv[i][j] * (p[j] - 1.);
+      }
+      return f;
+   }
+   double Up() const override { return 1.; }
+   bool IsThreadSafe() const override { return true; }
+
+private:
+   double fInv[3][3];
+};
+
+constexpr double QuadraticFCN::kCov[3][3];
+
+std::unique_ptr<Minuit2Minimizer> MakeMinimizer(std::unique_ptr<FCNBase> fcn)
+{
+   auto minimizer = std::make_unique<Minuit2Minimizer>(ROOT::Minuit2::kMigrad);
+   minimizer->SetFCN(3, std::move(fcn));
+   minimizer->SetPrintLevel(0);
+   minimizer->SetStrategy(1);
+   minimizer->SetTolerance(1.e-4);
+   minimizer->SetVariable(0, "a", 8., 0.5);
+   minimizer->SetVariable(1, "b", 0.5, 0.05);
+   minimizer->SetVariable(2, "c", 0.5, 0.1);
+   return minimizer;
+}
+
+struct MinosResult {
+   std::vector<double> errLow;
+   std::vector<double> errUp;
+   int status = -1;
+};
+
+MinosResult RunMinosErrors(bool useImt)
+{
+#ifdef R__USE_IMT
+   if (useImt)
+      ROOT::EnableImplicitMT(4);
+#endif
+   MinosResult result;
+   auto minimizer = MakeMinimizer(std::make_unique<ExpChi2FCN>());
+   EXPECT_TRUE(minimizer->Minimize());
+   EXPECT_TRUE(minimizer->GetMinosErrors({0, 1, 2}, result.errLow, result.errUp));
+   result.status = minimizer->MinosStatus();
+#ifdef R__USE_IMT
+   if (useImt)
+      ROOT::DisableImplicitMT();
+#endif
+   return result;
+}
+
+struct ContourResult {
+   std::vector<double> x;
+   std::vector<double> y;
+};
+
+ContourResult RunContour(bool useImt, unsigned int npoints)
+{
+#ifdef R__USE_IMT
+   if (useImt)
+      ROOT::EnableImplicitMT(4);
+#endif
+   auto minimizer = MakeMinimizer(std::make_unique<QuadraticFCN>());
+   EXPECT_TRUE(minimizer->Minimize());
+   ContourResult result;
+   result.x.resize(npoints);
+   result.y.resize(npoints);
+   unsigned int n = npoints;
+   EXPECT_TRUE(minimizer->Contour(0, 1, n, result.x.data(), result.y.data()));
+   EXPECT_EQ(n, npoints);
+   result.x.resize(n);
+   result.y.resize(n);
+#ifdef R__USE_IMT
+   if (useImt)
+      ROOT::DisableImplicitMT();
+#endif
+   return result;
+}
+
+} // namespace
+
+// GetMinosErrors gives the same errors as GetMinosError called for each parameter
+TEST(Minuit2Minos, GetMinosErrors)
+{
+   const MinosResult result = RunMinosErrors(false);
+   EXPECT_EQ(result.status, 0);
+
+   auto minimizer = MakeMinimizer(std::make_unique<ExpChi2FCN>());
+   ASSERT_TRUE(minimizer->Minimize());
+   for (unsigned int i = 0; i < 3; ++i) {
+      double errLow = 0, errUp = 0;
+      EXPECT_TRUE(minimizer->GetMinosError(i, errLow, errUp));
+      EXPECT_LT(errLow, 0.);
+      EXPECT_GT(errUp, 0.);
+      EXPECT_NEAR(result.errLow[i], errLow, 1.e-3 * std::abs(errLow)) << "parameter " << i;
+      EXPECT_NEAR(result.errUp[i], errUp, 1.e-3 * errUp) << "parameter " << i;
+   }
+   // the errors are asymmetric, so that the lower and upper crossings are really tested separately
+   EXPECT_GT(std::abs(result.errUp[2] + result.errLow[2]), 0.2 * result.errUp[2]);
+}
+
+#ifdef R__USE_IMT
+// the concurrent Minos minimizations of a thread safe FCN give the same errors as the serial ones
+TEST(Minuit2Minos, GetMinosErrorsIMT)
+{
+   const MinosResult serial = RunMinosErrors(false);
+   const MinosResult concurrent = RunMinosErrors(true);
+   EXPECT_EQ(serial.status, concurrent.status);
+   ASSERT_EQ(concurrent.errLow.size(), 3u);
+   ASSERT_EQ(concurrent.errUp.size(), 3u);
+   for (unsigned int i = 0; i < 3; ++i) {
+      EXPECT_NEAR(serial.errLow[i], concurrent.errLow[i], 1.e-6 * std::abs(serial.errLow[i])) << "parameter " << i;
+      EXPECT_NEAR(serial.errUp[i], concurrent.errUp[i], 1.e-6 * serial.errUp[i]) << "parameter " << i;
+   }
+}
+#endif
+
+// the contour of a quadratic FCN is the ellipse of the covariance of the two parameters, passing through the
+// Minos errors. The other parameter is profiled.
+TEST(Minuit2Contour, QuadraticEllipse)
+{
+   constexpr unsigned int npoints = 20;
+   const ContourResult result = RunContour(false, npoints);
+   ASSERT_EQ(result.x.size(), npoints);
+
+   const auto &v = QuadraticFCN::kCov;
+   const double det = v[0][0] * v[1][1] - v[0][1] * v[1][0];
+   double xmin = 1., xmax = 1., ymin = 1., ymax = 1.;
+   for (unsigned int i = 0; i < npoints; ++i) {
+      const double dx = result.x[i] - 1.;
+      const double dy = result.y[i] - 1.;
+      const double chi2 = (v[1][1] * dx * dx - 2. * v[0][1] * dx * dy + v[0][0] * dy * dy) / det;
+      EXPECT_NEAR(chi2, 1., 0.01) << "point " << i;
+      xmin = std::min(xmin, result.x[i]);
+      xmax = std::max(xmax, result.x[i]);
+      ymin = std::min(ymin, result.y[i]);
+      ymax = std::max(ymax, result.y[i]);
+   }
+   // the first points are at the Minos errors of the two parameters
+   EXPECT_NEAR(xmin, 1. - std::sqrt(v[0][0]), 0.01);
+   EXPECT_NEAR(xmax, 1. + std::sqrt(v[0][0]), 0.01);
+   EXPECT_NEAR(ymin, 1. - std::sqrt(v[1][1]), 0.01);
+   EXPECT_NEAR(ymax, 1. + std::sqrt(v[1][1]), 0.01);
+}
+
+#ifdef R__USE_IMT
+// the contour points found with the concurrent Minos and edge minimizations are the serial ones
+TEST(Minuit2Contour, IMT)
+{
+   constexpr unsigned int npoints = 12;
+   const ContourResult serial = RunContour(false, npoints);
+   const ContourResult concurrent = RunContour(true, npoints);
+   ASSERT_EQ(serial.x.size(), concurrent.x.size());
+   for (unsigned int i = 0; i < serial.x.size(); ++i) {
+      EXPECT_NEAR(serial.x[i], concurrent.x[i], 1.e-6) << "point " << i;
+      EXPECT_NEAR(serial.y[i], concurrent.y[i], 1.e-6) << "point " << i;
+   }
+}
+#endif
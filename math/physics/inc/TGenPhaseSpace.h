@@ -12,6 +12,8 @@
 
 #include "TLorentzVector.h"
 
+class TRandom;
+
 class TGenPhaseSpace : public TObject {
 private:
    Int_t        fNt;             // number of decay particles
@@ -21,7 +23,9 @@ private:
    Double_t     fWtMax;          // maximum weigth
    TLorentzVector  fDecPro[18];  //kinematics of the generated particles
 
-   Double_t PDK(Double_t a, Double_t b, Double_t c);
+   Double_t PDK(Double_t a, Double_t b, Double_t c) const;
+   void GenerateBlock(TRandom &rng, Long64_t nEvents, Long64_t first, Long64_t size, Double_t *weights,
+                      Double_t *px, Double_t *py, Double_t *pz, Double_t *e) const;
 
 public:
    TGenPhaseSpace(): fNt(0), fMass(), fBeta(), fTeCmTm(0.), fWtMax(0.) {}
@@ -31,6 +35,8 @@ public:
 
    Bool_t          SetDecay(TLorentzVector &P, Int_t nt, const Double_t *mass, Option_t *opt="");
    Double_t        Generate();
+   Bool_t          GenerateBatch(Long64_t nEvents, Double_t *weights, Double_t *px, Double_t *py, Double_t *pz,
+                                 Double_t *e, ULong64_t seed = 0) const;
    TLorentzVector *GetDecay(Int_t n);
 
    Int_t    GetNt()      const { return fNt;}
@@ -17,21 +17,53 @@
 
 see example of use in PhaseSpace.C
 
+Large samples are generated more efficiently with GenerateBatch(), which
+fills arrays with the momenta of many events, generating them in parallel
+if the implicit multi-threading is enabled.
+
 Note that Momentum, Energy units are Gev/C, GeV
 */
 
 #include "TGenPhaseSpace.h"
 #include "TRandom.h"
+#include "TRandomGen.h"
 #include "TMath.h"
 
+#ifdef R__USE_IMT
+#include "ROOT/TSeq.hxx"
+#include "ROOT/TThreadExecutor.hxx"
+#include "TROOT.h"
+#endif
+
+#include <algorithm>
+#include <vector>
+
 const Int_t kMAXP = 18;
 
+namespace {
+
+/// Number of events that GenerateBatch() generates together. The blocks are distributed to the threads, and each
+/// one uses its own random number stream, such that the events do not depend on the number of threads.
+constexpr Long64_t kBlockSize = 256;
+
+/// Seed of the random number stream of a block of events
+ULong64_t BlockSeed(ULong64_t seed, ULong64_t block)
+{
+   // SplitMix64 finalizer, to decorrelate the seeds of consecutive blocks
+   ULong64_t z = seed * 0x9E3779B97F4A7C15ULL + block + 1;
+   z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+   z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+   return z ^ (z >> 31);
+}
+
+} // namespace
+
 ClassImp(TGenPhaseSpace);
 
 ////////////////////////////////////////////////////////////////////////////////
 /// The PDK function.
 
-Double_t TGenPhaseSpace::PDK(Double_t a, Double_t b, Double_t c)
+Double_t TGenPhaseSpace::PDK(Double_t a, Double_t b, Double_t c) const
 {
    Double_t x = (a-b-c)*(a+b+c)*(a-b+c)*(a+b-c);
    x = TMath::Sqrt(x)/(2*a);
@@ -167,6 +199,177 @@ Double_t TGenPhaseSpace::Generate()
    return wt;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Generate nEvents random final states with the decay given to SetDecay().
+///
+/// The weights of the events are written to `weights`, which must have room
+/// for nEvents values. The momenta and energies of the decay products are
+/// written to `px`, `py`, `pz` and `e`, which must have room for
+/// nEvents * GetNt() values each: the value of decay product n in event i is
+/// at index n * nEvents + i.
+///
+/// The events are generated in blocks, each block with its own random number
+/// generator (TRandomMixMax) seeded from `seed` and the index of the block.
+/// The blocks are generated in parallel if the implicit multi-threading is
+/// enabled, and the events only depend on the seed, not on the number of
+/// threads. If `seed` is 0, the seed is taken from gRandom. The object is not
+/// modified, i.e. GetDecay() does not return the generated events.
+///
+/// Returns kFALSE if no decay is set.
+
+Bool_t TGenPhaseSpace::GenerateBatch(Long64_t nEvents, Double_t *weights, Double_t *px, Double_t *py, Double_t *pz,
+                                     Double_t *e, ULong64_t seed) const
+{
+   if (fNt < 2 || fNt > kMAXP || nEvents < 0)
+      return kFALSE;
+   if (seed == 0)
+      seed = 1 + gRandom->Integer(kMaxUInt);
+
+   const Long64_t nBlocks = (nEvents + kBlockSize - 1) / kBlockSize;
+   auto generateBlock = [&](Long64_t iBlock) {
+      TRandomMixMax rng(BlockSeed(seed, iBlock));
+      const Long64_t first = iBlock * kBlockSize;
+      GenerateBlock(rng, nEvents, first, std::min(kBlockSize, nEvents - first), weights, px, py, pz, e);
+   };
+
+#ifdef R__USE_IMT
+   if (ROOT::IsImplicitMTEnabled() && nBlocks > 1) {
+      ROOT::TThreadExecutor pool;
+      pool.Foreach(generateBlock, ROOT::TSeq<Long64_t>(nBlocks));
+      return kTRUE;
+   }
+#endif
+   for (Long64_t iBlock = 0; iBlock < nBlocks; iBlock++)
+      generateBlock(iBlock);
+   return kTRUE;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Generate the events first, ..., first + size - 1 of GenerateBatch().
+///
+/// This is the algorithm of Generate(), but every step is done for all the
+/// events of the block before the next one, such that the rotations and boosts
+/// are loops over the events that the compiler can vectorize.
+
+void TGenPhaseSpace::GenerateBlock(TRandom &rng, Long64_t nEvents, Long64_t first, Long64_t size, Double_t *weights,
+                                   Double_t *px, Double_t *py, Double_t *pz, Double_t *e) const
+{
+   Double_t *x[kMAXP], *y[kMAXP], *z[kMAXP], *t[kMAXP];
+   for (Int_t n = 0; n < fNt; n++) {
+      x[n] = px + n * nEvents + first;
+      y[n] = py + n * nEvents + first;
+      z[n] = pz + n * nEvents + first;
+      t[n] = e + n * nEvents + first;
+   }
+   Double_t *wt = weights + first;
+
+   // invariant masses of the subsystems, indexed by particle and event
+   std::vector<Double_t> invMas(fNt * size);
+   Double_t rno[kMAXP];
+   rno[0] = 0;
+   rno[fNt - 1] = 1;
+   for (Long64_t k = 0; k < size; k++) {
+      for (Int_t n = 1; n < fNt - 1; n++)
+         rno[n] = rng.Rndm();
+      std::sort(rno + 1, rno + fNt - 1);
+      Double_t sum = 0;
+      for (Int_t n = 0; n < fNt; n++) {
+         sum += fMass[n];
+         invMas[n * size + k] = rno[n] * fTeCmTm + sum;
+      }
+   }
+
+   //
+   //-----> compute the weights of the events
+   //
+   std::vector<Double_t> pd((fNt - 1) * size);
+   std::fill(wt, wt + size, fWtMax);
+   for (Int_t n = 0; n < fNt - 1; n++) {
+      for (Long64_t k = 0; k < size; k++) {
+         pd[n * size + k] = PDK(invMas[(n + 1) * size + k], invMas[n * size + k], fMass[n + 1]);
+         wt[k] *= pd[n * size + k];
+      }
+   }
+
+   //
+   //-----> complete specification of events (Raubold-Lynch method)
+   //
+   for (Long64_t k = 0; k < size; k++) {
+      x[0][k] = 0;
+      y[0][k] = pd[k];
+      z[0][k] = 0;
+      t[0][k] = TMath::Sqrt(pd[k] * pd[k] + fMass[0] * fMass[0]);
+   }
+
+   std::vector<Double_t> cZ(size), sZ(size), cY(size), sY(size);
+   for (Int_t i = 1;; i++) {
+      const Double_t *pdi = pd.data() + (i - 1) * size;
+      for (Long64_t k = 0; k < size; k++) {
+         x[i][k] = 0;
+         y[i][k] = -pdi[k];
+         z[i][k] = 0;
+         t[i][k] = TMath::Sqrt(pdi[k] * pdi[k] + fMass[i] * fMass[i]);
+      }
+
+      for (Long64_t k = 0; k < size; k++) {
+         cZ[k] = 2 * rng.Rndm() - 1;
+         sZ[k] = TMath::Sqrt(1 - cZ[k] * cZ[k]);
+         Double_t angY = 2 * TMath::Pi() * rng.Rndm();
+         cY[k] = TMath::Cos(angY);
+         sY[k] = TMath::Sin(angY);
+      }
+      for (Int_t j = 0; j <= i; j++) {
+         Double_t *xj = x[j], *yj = y[j], *zj = z[j];
+         for (Long64_t k = 0; k < size; k++) {
+            Double_t xr = cZ[k] * xj[k] - sZ[k] * yj[k];
+            yj[k] = sZ[k] * xj[k] + cZ[k] * yj[k]; // rotation around Z
+            xj[k] = cY[k] * xr - sY[k] * zj[k];
+            zj[k] = sY[k] * xr + cY[k] * zj[k]; // rotation around Y
+         }
+      }
+
+      if (i == (fNt - 1))
+         break;
+
+      // boost along Y, with the betas stored in cZ
+      const Double_t *pdn = pd.data() + i * size;
+      const Double_t *invMasi = invMas.data() + i * size;
+      for (Long64_t k = 0; k < size; k++)
+         cZ[k] = pdn[k] / TMath::Sqrt(pdn[k] * pdn[k] + invMasi[k] * invMasi[k]);
+      for (Int_t j = 0; j <= i; j++) {
+         Double_t *yj = y[j], *tj = t[j];
+         for (Long64_t k = 0; k < size; k++) {
+            Double_t beta = cZ[k];
+            Double_t b2 = beta * beta;
+            Double_t gamma = 1.0 / TMath::Sqrt(1.0 - b2);
+            Double_t bp = beta * yj[k];
+            Double_t gamma2 = b2 > 0 ? (gamma - 1.0) / b2 : 0.0;
+            yj[k] += gamma2 * bp * beta + gamma * beta * tj[k];
+            tj[k] = gamma * (tj[k] + bp);
+         }
+      }
+   }
+
+   //
+   //---> final boost of all particles
+   //
+   const Double_t b2 = fBeta[0] * fBeta[0] + fBeta[1] * fBeta[1] + fBeta[2] * fBeta[2];
+   if (b2 == 0)
+      return;
+   const Double_t gamma = 1.0 / TMath::Sqrt(1.0 - b2);
+   const Double_t gamma2 = (gamma - 1.0) / b2;
+   for (Int_t n = 0; n < fNt; n++) {
+      Double_t *xn = x[n], *yn = y[n], *zn = z[n], *tn = t[n];
+      for (Long64_t k = 0; k < size; k++) {
+         Double_t bp = fBeta[0] * xn[k] + fBeta[1] * yn[k] + fBeta[2] * zn[k];
+         xn[k] += gamma2 * bp * fBeta[0] + gamma * fBeta[0] * tn[k];
+         yn[k] += gamma2 * bp * fBeta[1] + gamma * fBeta[1] * tn[k];
+         zn[k] += gamma2 * bp * fBeta[2] + gamma * fBeta[2] * tn[k];
+         tn[k] = gamma * (tn[k] + bp);
+      }
+   }
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Return Lorentz vector corresponding to decay n
 
@@ -187,7 +187,7 @@ public:
   template <class MatrixRep>
   static bool Dinv(MatrixRep& rhs) {
 
-    if (rhs[0] == 0.) {
+    if (Impl::AnyOf(rhs[0] == 0.)) {
       return false;
     }
     rhs[0] = 1. / rhs[0];
@@ -215,7 +215,7 @@ public:
     typedef typename MatrixRep::value_type T;
     T det = rhs[0] * rhs[3] - rhs[2] * rhs[1];
 
-    if (det == T(0.) ) { return false; }
+    if (Impl::AnyOf(det == T(0.))) { return false; }
 
     T s = T(1.0) / det;
 
@@ -240,7 +240,7 @@ public:
     T det = rhs[0] * rhs[2] - rhs[1] * rhs[1];
 
 
-    if (det == T(0.)) { return false; }
+    if (Impl::AnyOf(det == T(0.))) { return false; }
 
     T s = T(1.0) / det;
     T c11 = s * rhs[2];
@@ -10,5 +10,41 @@
 #define UNSUPPORTED_TEMPLATE_EXPRESSION
 #endif
 
+#include <cmath>
+
+namespace ROOT {
+
+namespace Math {
+
+/**
+   Helpers for the element types of SMatrix and SVector. Besides the floating point types, the elements can be
+   SIMD types such as ROOT::Double_v, where each lane holds the element of a different matrix, to operate on
+   several matrices at once. Comparisons of SIMD types give masks, and their math functions (e.g. Vc::sqrt, Vc::iif)
+   are found by argument dependent lookup.
+*/
+namespace Impl {
+
+/// Returns whether the condition holds; for a SIMD mask, whether it holds in any lane
+inline bool AnyOf(bool cond) { return cond; }
+template <class Mask>
+inline bool AnyOf(const Mask &cond) { return any_of(cond); }
+
+/// Returns a if the condition holds and b otherwise; for a SIMD mask, lane by lane
+template <class T>
+inline T Select(bool cond, const T &a, const T &b) { return cond ? a : b; }
+template <class Mask, class T>
+inline T Select(const Mask &cond, const T &a, const T &b) { return iif(cond, a, b); }
+
+template <class T>
+inline T Sqrt(const T &x) { using std::sqrt; return sqrt(x); }
+template <class T>
+inline T Abs(const T &x) { using std::abs; return abs(x); }
+
+} // namespace Impl
+
+} // namespace Math
+
+} // namespace ROOT
+
 
 #endif
@@ -492,7 +492,9 @@ public:
       The method used is based on direct inversion using the Cramer rule for
       matrices upto 5x5. Afterwards the same default algorithm of Invert() is used.
       Note that this method is faster but can suffer from much larger numerical accuracy
-      when the condition of the matrix is large
+      when the condition of the matrix is large.
+      Up to 5x5 it also supports SIMD element types such as ROOT::Double_v, inverting one matrix per lane;
+      it then returns false if the inversion fails for any of the lanes.
    */
    bool InvertFast();
 
@@ -512,7 +514,8 @@ public:
       A compile error is given if the matrix is not of type symmetric and a run-time failure if the
       matrix is not positive defined.
       For solving  a linear system, it is possible to use also the function
-      ROOT::Math::SolveChol(matrix, vector) which will be faster than performing the inversion
+      ROOT::Math::SolveChol(matrix, vector) which will be faster than performing the inversion.
+      SIMD element types such as ROOT::Double_v are supported, see InvertFast().
    */
    bool InvertChol();
 
@@ -134,6 +134,20 @@ inline uint64_t NextPowerOf2(uint64_t A)
    return A + 1;
 }
 
+/// Allocate a heap buffer of at least `bytes` bytes for the elements of an RVec.
+/// If a buffer pool is enabled on the current thread, the buffer is taken from the pool when possible and `bytes`
+/// is updated to the actual size of the buffer, which can be larger than requested.
+void *AllocateBuffer(std::size_t &bytes);
+/// Release a buffer obtained from AllocateBuffer (or malloc), of which `bytes` bytes are in use.
+/// If a buffer pool is enabled on the current thread, the buffer is kept for reuse instead of being freed.
+void ReleaseBuffer(void *buffer, std::size_t bytes);
+/// Enable the buffer pool of the current thread, until the matching call to DisableBufferPool. Calls can be nested.
+/// Pooling removes the cost of the frequent allocations and deallocations of short-lived RVecs, e.g. the temporary
+/// results of the per-event computations of an RDataFrame event loop, which enables the pool in its tasks.
+void EnableBufferPool();
+/// Disable the buffer pool of the current thread. The buffers it holds are freed by the outermost call.
+void DisableBufferPool();
+
 /// This is all the stuff common to all SmallVectors.
 class R__CLING_PTRCHECK(off) SmallVectorBase {
 public:
@@ -401,8 +415,10 @@ void R__CLING_PTRCHECK(off) SmallVectorTemplateBase<T, TriviallyCopyable>::grow(
    // Always grow, even from zero.
    size_t NewCapacity = size_t(NextPowerOf2(this->capacity() + 2));
    NewCapacity = std::min(std::max(NewCapacity, MinSize), this->SizeTypeMax());
-   T *NewElts = static_cast<T *>(malloc(NewCapacity * sizeof(T)));
+   std::size_t NewBytes = NewCapacity * sizeof(T);
+   T *NewElts = static_cast<T *>(AllocateBuffer(NewBytes));
    R__ASSERT(NewElts != nullptr);
+   NewCapacity = std::min(NewBytes / sizeof(T), this->SizeTypeMax());
 
    // Move the elements over.
    this->uninitialized_move(this->begin(), this->end(), NewElts);
@@ -413,7 +429,7 @@ void R__CLING_PTRCHECK(off) SmallVectorTemplateBase<T, TriviallyCopyable>::grow(
 
       // If this wasn't grown from the inline copy, deallocate the old space.
       if (!this->isSmall())
-         free(this->begin());
+         ReleaseBuffer(this->begin(), this->capacity() * sizeof(T));
    }
 
    this->fBeginX = NewElts;
@@ -549,6 +565,85 @@ void ResetView(RVec<T> &v, T* addr, std::size_t sz)
    v.fSize = sz;
 }
 
+/// Copy to `out` the elements of `in` for which `conds` is true, and return the number of elements copied.
+/// `out` must have room for `n` elements. Every element is written and only the output position depends on the
+/// condition, so that there is no branch on the (typically unpredictable) values of the conditions.
+template <typename T, typename C>
+std::size_t CompressInto(const T *in, const C *conds, std::size_t n, T *out)
+{
+   std::size_t j = 0u;
+   for (std::size_t i = 0u; i < n; ++i) {
+      out[j] = in[i];
+      j += static_cast<bool>(conds[i]);
+   }
+   return j;
+}
+
+/// Set `out` to the elements of `in` for which `conds` is true. Arithmetic types use CompressInto.
+template <typename Out, typename In, typename Conds>
+void SelectInto(Out &out, const In &in, const Conds &conds, std::size_t nTrue, std::true_type /*isArithmetic*/)
+{
+   (void)nTrue;
+   out.resize(in.size());
+   out.resize(CompressInto(in.data(), conds.data(), in.size(), out.data()));
+}
+
+template <typename Out, typename In, typename Conds>
+void SelectInto(Out &out, const In &in, const Conds &conds, std::size_t nTrue, std::false_type /*isArithmetic*/)
+{
+   out.reserve(nTrue);
+   for (std::size_t i = 0u; i < in.size(); ++i) {
+      if (conds[i])
+         out.push_back(in[i]);
+   }
+}
+
+/// Fill `out` with the values `f(0), ..., f(n - 1)`. For arithmetic types the output is sized upfront and written
+/// through a pointer, a loop that compilers can vectorize, instead of being appended to element by element.
+template <typename T, typename F>
+void FillInto(RVec<T> &out, std::size_t n, F &&f, std::true_type /*isArithmetic*/)
+{
+   out.resize(n);
+   T *data = out.data();
+   for (std::size_t i = 0u; i < n; ++i)
+      data[i] = f(i);
+}
+
+template <typename T, typename F>
+void FillInto(RVec<T> &out, std::size_t n, F &&f, std::false_type /*isArithmetic*/)
+{
+   out.reserve(n);
+   for (std::size_t i = 0u; i < n; ++i)
+      out.emplace_back(f(i));
+}
+
+/// Sum of `init` and of the `n` values `f(0), ..., f(n - 1)`.
+/// Floating point sums are computed with several independent partial sums, as a single accumulator imposes the order
+/// of the additions and prevents vectorization. The result can differ from the sequential sum by rounding.
+template <typename T, typename F>
+T Accumulate(std::size_t n, T init, F &&f, std::true_type /*isFloatingPoint*/)
+{
+   constexpr std::size_t kNAcc = 8u;
+   T acc[kNAcc] = {};
+   acc[0] = init;
+   std::size_t i = 0u;
+   for (; i + kNAcc <= n; i += kNAcc) {
+      for (std::size_t j = 0u; j < kNAcc; ++j)
+         acc[j] += f(i + j);
+   }
+   for (; i < n; ++i)
+      acc[0] += f(i);
+   return ((acc[0] + acc[1]) + (acc[2] + acc[3])) + ((acc[4] + acc[5]) + (acc[6] + acc[7]));
+}
+
+template <typename T, typename F>
+T Accumulate(std::size_t n, T init, F &&f, std::false_type /*isFloatingPoint*/)
+{
+   for (std::size_t i = 0u; i < n; ++i)
+      init = init + f(i);
+   return init;
+}
+
 } // namespace VecOps
 } // namespace Internal
 
@@ -579,7 +674,7 @@ public:
       // Subclass has already destructed this vector's elements.
       // If this wasn't grown from the inline copy, deallocate the old space.
       if (!this->isSmall() && this->Owns())
-         free(this->begin());
+         ROOT::Internal::VecOps::ReleaseBuffer(this->begin(), this->capacity() * sizeof(T));
    }
 
    // also give up adopted memory if applicable
@@ -1056,7 +1151,7 @@ RVecImpl<T> &RVecImpl<T>::operator=(RVecImpl<T> &&RHS)
       if (this->Owns()) {
          this->destroy_range(this->begin(), this->end());
          if (!this->isSmall())
-            free(this->begin());
+            ROOT::Internal::VecOps::ReleaseBuffer(this->begin(), this->capacity() * sizeof(T));
       }
       this->fBeginX = RHS.fBeginX;
       this->fSize = RHS.fSize;
@@ -1264,14 +1359,7 @@ public:
          n_true += c; // relies on bool -> int conversion, faster than branching
 
       RVecN ret;
-      ret.reserve(n_true);
-      size_type j = 0u;
-      for (size_type i = 0u; i < n; ++i) {
-         if (conds[i]) {
-            ret.push_back(this->operator[](i));
-            ++j;
-         }
-      }
+      ROOT::Internal::VecOps::SelectInto(ret, *this, conds, n_true, std::is_arithmetic<T>{});
       return ret;
    }
 
@@ -1887,7 +1975,11 @@ auto Dot(const RVec<T> &v0, const RVec<V> &v1) -> decltype(v0[0] * v1[0])
 {
    if (v0.size() != v1.size())
       throw std::runtime_error("Cannot compute inner product of vectors of different sizes");
-   return std::inner_product(v0.begin(), v0.end(), v1.begin(), decltype(v0[0] * v1[0])(0));
+   using R_t = decltype(v0[0] * v1[0]);
+   const auto *p0 = v0.data();
+   const auto *p1 = v1.data();
+   return ROOT::Internal::VecOps::Accumulate(
+      v0.size(), R_t(0), [p0, p1](std::size_t i) { return p0[i] * p1[i]; }, std::is_floating_point<R_t>{});
 }
 
 /// Sum elements of an RVec
@@ -1916,7 +2008,9 @@ auto Dot(const RVec<T> &v0, const RVec<V> &v1) -> decltype(v0[0] * v1[0])
 template <typename T>
 T Sum(const RVec<T> &v, const T zero = T(0))
 {
-   return std::accumulate(v.begin(), v.end(), zero);
+   const T *data = v.data();
+   return ROOT::Internal::VecOps::Accumulate(
+      v.size(), zero, [data](std::size_t i) -> const T & { return data[i]; }, std::is_floating_point<T>{});
 }
 
 inline std::size_t Sum(const RVec<bool> &v, std::size_t zero = 0ul)
@@ -2144,12 +2238,19 @@ auto Map(Args &&... args)
 template <typename T, typename F>
 RVec<T> Filter(const RVec<T> &v, F &&f)
 {
-   const auto thisSize = v.size();
    RVec<T> w;
-   w.reserve(thisSize);
-   for (auto &&val : v) {
-      if (f(val))
-         w.emplace_back(val);
+   if (std::is_arithmetic<T>::value) {
+      // evaluate the predicate once per element, then select without branching
+      RVec<char> pass(v.size());
+      for (std::size_t i = 0u; i < v.size(); ++i)
+         pass[i] = static_cast<bool>(f(v[i]));
+      ROOT::Internal::VecOps::SelectInto(w, v, pass, v.size(), std::is_arithmetic<T>{});
+   } else {
+      w.reserve(v.size());
+      for (auto &&val : v) {
+         if (f(val))
+            w.emplace_back(val);
+      }
    }
    return w;
 }
@@ -2754,13 +2855,12 @@ RVec<T> Intersect(const RVec<T>& v1, const RVec<T>& v2, bool v2_is_sorted = fals
 template <typename T>
 RVec<T> Where(const RVec<int>& c, const RVec<T>& v1, const RVec<T>& v2)
 {
-   using size_type = typename RVec<T>::size_type;
-   const size_type size = c.size();
    RVec<T> r;
-   r.reserve(size);
-   for (size_type i=0; i<size; i++) {
-      r.emplace_back(c[i] != 0 ? v1[i] : v2[i]);
-   }
+   const int *cp = c.data();
+   const T *v1p = v1.data();
+   const T *v2p = v2.data();
+   const auto element = [&](std::size_t i) { return cp[i] != 0 ? v1p[i] : v2p[i]; };
+   ROOT::Internal::VecOps::FillInto(r, c.size(), element, std::is_arithmetic<T>{});
    return r;
 }
 
@@ -2782,13 +2882,11 @@ RVec<T> Where(const RVec<int>& c, const RVec<T>& v1, const RVec<T>& v2)
 template <typename T>
 RVec<T> Where(const RVec<int> &c, const RVec<T> &v1, typename RVec<T>::value_type v2)
 {
-   using size_type = typename RVec<T>::size_type;
-   const size_type size = c.size();
    RVec<T> r;
-   r.reserve(size);
-   for (size_type i=0; i<size; i++) {
-      r.emplace_back(c[i] != 0 ? v1[i] : v2);
-   }
+   const int *cp = c.data();
+   const T *v1p = v1.data();
+   const auto element = [&](std::size_t i) { return cp[i] != 0 ? v1p[i] : v2; };
+   ROOT::Internal::VecOps::FillInto(r, c.size(), element, std::is_arithmetic<T>{});
    return r;
 }
 
@@ -2810,13 +2908,11 @@ RVec<T> Where(const RVec<int> &c, const RVec<T> &v1, typename RVec<T>::value_typ
 template <typename T>
 RVec<T> Where(const RVec<int>& c, typename RVec<T>::value_type v1, const RVec<T>& v2)
 {
-   using size_type = typename RVec<T>::size_type;
-   const size_type size = c.size();
    RVec<T> r;
-   r.reserve(size);
-   for (size_type i=0; i<size; i++) {
-      r.emplace_back(c[i] != 0 ? v1 : v2[i]);
-   }
+   const int *cp = c.data();
+   const T *v2p = v2.data();
+   const auto element = [&](std::size_t i) { return cp[i] != 0 ? v1 : v2p[i]; };
+   ROOT::Internal::VecOps::FillInto(r, c.size(), element, std::is_arithmetic<T>{});
    return r;
 }
 
@@ -2836,13 +2932,10 @@ RVec<T> Where(const RVec<int>& c, typename RVec<T>::value_type v1, const RVec<T>
 template <typename T>
 RVec<T> Where(const RVec<int>& c, T v1, T v2)
 {
-   using size_type = typename RVec<T>::size_type;
-   const size_type size = c.size();
    RVec<T> r;
-   r.reserve(size);
-   for (size_type i=0; i<size; i++) {
-      r.emplace_back(c[i] != 0 ? v1 : v2);
-   }
+   const int *cp = c.data();
+   const auto element = [&](std::size_t i) { return cp[i] != 0 ? v1 : v2; };
+   ROOT::Internal::VecOps::FillInto(r, c.size(), element, std::is_arithmetic<T>{});
    return r;
 }
 
@@ -2877,7 +2970,10 @@ T DeltaPhi(T v1, T v2, const T c = M_PI)
 {
    static_assert(std::is_floating_point<T>::value,
                  "DeltaPhi must be called with floating point values.");
-   auto r = std::fmod(v2 - v1, 2.0 * c);
+   using Diff_t = decltype(std::fmod(v2 - v1, 2.0 * c));
+   const Diff_t d = v2 - v1;
+   // fmod returns its argument unchanged if it is already in (-2c, 2c), by far the most common case: skip the call
+   Diff_t r = std::abs(d) < 2.0 * c ? d : std::fmod(d, 2.0 * c);
    if (r < -c) {
       r += 2.0 * c;
    }
@@ -2951,8 +3047,17 @@ RVec<T> DeltaPhi(T v1, const RVec<T>& v2, const T c = M_PI)
 template <typename T>
 RVec<T> DeltaR2(const RVec<T>& eta1, const RVec<T>& eta2, const RVec<T>& phi1, const RVec<T>& phi2, const T c = M_PI)
 {
-   const auto dphi = DeltaPhi(phi1, phi2, c);
-   return (eta1 - eta2) * (eta1 - eta2) + dphi * dphi;
+   const auto size = eta1.size();
+   if (eta2.size() != size || phi1.size() != size || phi2.size() != size)
+      throw std::runtime_error("Cannot compute DeltaR2 of collections of different sizes.");
+   // a single pass over the inputs, without the temporary collections of the vector expression
+   RVec<T> r(size);
+   for (std::size_t i = 0u; i < size; ++i) {
+      const T deta = eta1[i] - eta2[i];
+      const T dphi = DeltaPhi(phi1[i], phi2[i], c);
+      r[i] = deta * deta + dphi * dphi;
+   }
+   return r;
 }
 
 /// Return the distance on the \f$\eta\f$-\f$\phi\f$ plane (\f$\Delta R\f$) from
@@ -2965,7 +3070,10 @@ RVec<T> DeltaR2(const RVec<T>& eta1, const RVec<T>& eta2, const RVec<T>& phi1, c
 template <typename T>
 RVec<T> DeltaR(const RVec<T>& eta1, const RVec<T>& eta2, const RVec<T>& phi1, const RVec<T>& phi2, const T c = M_PI)
 {
-   return sqrt(DeltaR2(eta1, eta2, phi1, phi2, c));
+   auto r = DeltaR2(eta1, eta2, phi1, phi2, c);
+   for (auto &x : r)
+      x = std::sqrt(x);
+   return r;
 }
 
 /// Return the distance on the \f$\eta\f$-\f$\phi\f$ plane (\f$\Delta R\f$) from
@@ -3057,6 +3165,186 @@ T InvariantMass(const RVec<T>& pt, const RVec<T>& eta, const RVec<T>& phi, const
    return std::sqrt(e_sum * e_sum - x_sum * x_sum - y_sum * y_sum - z_sum * z_sum);
 }
 
+////////////////////////////////////////////////////////////////////////////
+/// \brief A collection of Lorentz vectors stored as a structure of arrays.
+/// \tparam T The floating point type of the components.
+///
+/// The vectors are stored as one RVec per Cartesian component (px, py, pz, e). Contrary to an
+/// RVec<ROOT::Math::PtEtaPhiMVector>, where each element is a separate object, sums, boosts and invariant masses
+/// then run as plain loops over contiguous arrays that compilers can vectorize. The conversions from and to the
+/// (pt, eta, phi, mass) coordinates are computed once per collection, in separate loops for each component.
+///
+/// Example code, in an RDataFrame computation graph:
+/// ~~~{.cpp}
+/// using ROOT::VecOps::RLorentzVectors;
+/// auto df2 = df.Define("jets", &RLorentzVectors<float>::FromPtEtaPhiM, {"Jet_pt", "Jet_eta", "Jet_phi", "Jet_mass"})
+///              .Define("goodJets", "jets[jets.Pt() > 30]")
+///              .Define("mjj", "goodJets.InvariantMass()");
+/// ~~~
+///
+/// Collections of GenVector objects can be built from the components with Construct, e.g.
+/// `Construct<ROOT::Math::PxPyPzEVector>(v.Px(), v.Py(), v.Pz(), v.E())`.
+template <typename T>
+class RLorentzVectors {
+   RVec<T> fPx;
+   RVec<T> fPy;
+   RVec<T> fPz;
+   RVec<T> fE;
+
+public:
+   RLorentzVectors() = default;
+
+   /// Build the collection from its Cartesian components. The RVecs are moved in, so that no copy is made when the
+   /// arguments are temporaries.
+   RLorentzVectors(RVec<T> px, RVec<T> py, RVec<T> pz, RVec<T> e)
+      : fPx(std::move(px)), fPy(std::move(py)), fPz(std::move(pz)), fE(std::move(e))
+   {
+      ::ROOT::Internal::VecOps::GetVectorsSize("RLorentzVectors", fPx, fPy, fPz, fE);
+   }
+
+   /// Build the collection from the transverse momenta, pseudorapidities, azimuths and masses of the vectors.
+   static RLorentzVectors FromPtEtaPhiM(const RVec<T> &pt, const RVec<T> &eta, const RVec<T> &phi, const RVec<T> &mass)
+   {
+      const std::size_t n = ::ROOT::Internal::VecOps::GetVectorsSize("FromPtEtaPhiM", pt, eta, phi, mass);
+      RVec<T> px(n), py(n), pz(n), e(n);
+      const T *ptp = pt.data();
+      const T *etap = eta.data();
+      const T *phip = phi.data();
+      const T *massp = mass.data();
+      T *pxp = px.data();
+      T *pyp = py.data();
+      T *pzp = pz.data();
+      T *ep = e.data();
+      for (std::size_t i = 0u; i < n; ++i)
+         pxp[i] = ptp[i] * std::cos(phip[i]);
+      for (std::size_t i = 0u; i < n; ++i)
+         pyp[i] = ptp[i] * std::sin(phip[i]);
+      for (std::size_t i = 0u; i < n; ++i)
+         pzp[i] = ptp[i] * std::sinh(etap[i]);
+      for (std::size_t i = 0u; i < n; ++i)
+         ep[i] = std::sqrt(ptp[i] * ptp[i] + pzp[i] * pzp[i] + massp[i] * massp[i]);
+      return RLorentzVectors(std::move(px), std::move(py), std::move(pz), std::move(e));
+   }
+
+   std::size_t size() const { return fPx.size(); }
+   bool empty() const { return fPx.empty(); }
+
+   const RVec<T> &Px() const { return fPx; }
+   const RVec<T> &Py() const { return fPy; }
+   const RVec<T> &Pz() const { return fPz; }
+   const RVec<T> &E() const { return fE; }
+
+   /// The transverse momenta of the vectors
+   RVec<T> Pt() const
+   {
+      const T *px = fPx.data();
+      const T *py = fPy.data();
+      RVec<T> r;
+      ::ROOT::Internal::VecOps::FillInto(
+         r, size(), [px, py](std::size_t i) { return std::sqrt(px[i] * px[i] + py[i] * py[i]); }, std::true_type{});
+      return r;
+   }
+
+   /// The pseudorapidities of the vectors; vectors along the beam axis have an infinite pseudorapidity, null
+   /// vectors a pseudorapidity of zero.
+   RVec<T> Eta() const
+   {
+      const T *px = fPx.data();
+      const T *py = fPy.data();
+      const T *pz = fPz.data();
+      const auto eta = [px, py, pz](std::size_t i) {
+         const T pt = std::sqrt(px[i] * px[i] + py[i] * py[i]);
+         return pz[i] == T(0) ? T(0) : std::asinh(pz[i] / pt);
+      };
+      RVec<T> r;
+      ::ROOT::Internal::VecOps::FillInto(r, size(), eta, std::true_type{});
+      return r;
+   }
+
+   /// The azimuths of the vectors, in (-pi, pi]
+   RVec<T> Phi() const
+   {
+      const T *px = fPx.data();
+      const T *py = fPy.data();
+      RVec<T> r;
+      ::ROOT::Internal::VecOps::FillInto(
+         r, size(), [px, py](std::size_t i) { return std::atan2(py[i], px[i]); }, std::true_type{});
+      return r;
+   }
+
+   /// The masses of the vectors. As for ROOT::Math::LorentzVector::M(), a negative squared mass gives a negative mass.
+   RVec<T> M() const
+   {
+      const T *px = fPx.data();
+      const T *py = fPy.data();
+      const T *pz = fPz.data();
+      const T *e = fE.data();
+      const auto mass = [px, py, pz, e](std::size_t i) {
+         const T m2 = e[i] * e[i] - px[i] * px[i] - py[i] * py[i] - pz[i] * pz[i];
+         return m2 < T(0) ? -std::sqrt(-m2) : std::sqrt(m2);
+      };
+      RVec<T> r;
+      ::ROOT::Internal::VecOps::FillInto(r, size(), mass, std::true_type{});
+      return r;
+   }
+
+   /// The invariant mass of the sum of all the vectors of the collection
+   T InvariantMass() const
+   {
+      const auto px = Sum(fPx);
+      const auto py = Sum(fPy);
+      const auto pz = Sum(fPz);
+      const auto e = Sum(fE);
+      const T m2 = e * e - px * px - py * py - pz * pz;
+      return m2 < T(0) ? -std::sqrt(-m2) : std::sqrt(m2);
+   }
+
+   /// Boost all the vectors of the collection by the velocity (bx, by, bz), as ROOT::Math::Boost does.
+   /// Throws if the velocity is not smaller than the speed of light.
+   void Boost(T bx, T by, T bz)
+   {
+      const T b2 = bx * bx + by * by + bz * bz;
+      if (b2 >= T(1))
+         throw std::runtime_error("RLorentzVectors::Boost: the boost velocity must be smaller than 1.");
+      const T gamma = T(1) / std::sqrt(T(1) - b2);
+      const T gamma2 = b2 > T(0) ? (gamma - T(1)) / b2 : T(0);
+      T *px = fPx.data();
+      T *py = fPy.data();
+      T *pz = fPz.data();
+      T *e = fE.data();
+      for (std::size_t i = 0u, n = size(); i < n; ++i) {
+         const T bp = bx * px[i] + by * py[i] + bz * pz[i];
+         const T t = e[i];
+         px[i] += gamma2 * bp * bx + gamma * bx * t;
+         py[i] += gamma2 * bp * by + gamma * by * t;
+         pz[i] += gamma2 * bp * bz + gamma * bz * t;
+         e[i] = gamma * (t + bp);
+      }
+   }
+
+   /// Return the vectors for which the corresponding condition is true, as RVec::operator[](conds) does
+   template <typename V>
+   RLorentzVectors operator[](const RVec<V> &conds) const
+   {
+      return RLorentzVectors(fPx[conds], fPy[conds], fPz[conds], fE[conds]);
+   }
+
+   /// Return the vectors at the given indices, as Take() does for an RVec
+   RLorentzVectors Take(const RVec<typename RVec<T>::size_type> &indices) const
+   {
+      return RLorentzVectors(::ROOT::VecOps::Take(fPx, indices), ::ROOT::VecOps::Take(fPy, indices),
+                             ::ROOT::VecOps::Take(fPz, indices), ::ROOT::VecOps::Take(fE, indices));
+   }
+
+   /// Element-wise sum of two collections of the same size, e.g. to compute the invariant masses of pairs
+   friend RLorentzVectors operator+(const RLorentzVectors &v1, const RLorentzVectors &v2)
+   {
+      if (v1.size() != v2.size())
+         throw std::runtime_error("Cannot sum collections of Lorentz vectors of different sizes.");
+      return RLorentzVectors(v1.fPx + v2.fPx, v1.fPy + v2.fPy, v1.fPz + v2.fPz, v1.fE + v2.fE);
+   }
+};
+
 ////////////////////////////////////////////////////////////////////////////
 /// \brief Build an RVec of objects starting from RVecs of input to their constructors.
 /// \tparam T Type of the objects contained in the created RVec.
@@ -11,6 +11,10 @@
  *************************************************************************/
 
 #include "ROOT/RVec.hxx"
+
+#include <array>
+#include <vector>
+
 using namespace ROOT::VecOps;
 
 // Check that no bytes are wasted and everything is well-aligned.
@@ -69,8 +73,10 @@ void ROOT::Internal::VecOps::SmallVectorBase::grow_pod(void *FirstEl, size_t Min
 
    void *NewElts;
    if (fBeginX == FirstEl || !this->Owns()) {
-      NewElts = malloc(NewCapacity * TSize);
+      std::size_t NewBytes = NewCapacity * TSize;
+      NewElts = AllocateBuffer(NewBytes);
       R__ASSERT(NewElts != nullptr);
+      NewCapacity = std::min(NewBytes / TSize, SizeTypeMax());
 
       // Copy the elements over.  No need to run dtors on PODs.
       memcpy(NewElts, this->fBeginX, size() * TSize);
@@ -84,6 +90,96 @@ void ROOT::Internal::VecOps::SmallVectorBase::grow_pod(void *FirstEl, size_t Min
    this->fCapacity = NewCapacity;
 }
 
+namespace {
+/// Heap buffers released by the RVecs of a thread, kept for reuse by the next allocations while the pool is enabled.
+/// Bucket k holds buffers of 2^k bytes. Buffers larger than the largest bucket are not pooled.
+struct RBufferPool {
+   static constexpr std::size_t kNBuckets = 21; // up to 1 MiB
+   static constexpr std::size_t kMaxPooledBytes = 16 * 1024 * 1024;
+
+   std::array<std::vector<void *>, kNBuckets> fBuckets;
+   std::size_t fPooledBytes = 0;
+   unsigned int fDepth = 0; ///< Number of nested EnableBufferPool calls.
+
+   ~RBufferPool() { Clear(); }
+
+   void Clear()
+   {
+      for (auto &bucket : fBuckets) {
+         for (auto *buffer : bucket)
+            free(buffer);
+         bucket.clear();
+      }
+      fPooledBytes = 0;
+   }
+};
+
+thread_local RBufferPool gBufferPool;
+
+/// Index of the smallest bucket with buffers of at least `bytes` bytes.
+std::size_t BucketForSize(std::size_t bytes)
+{
+   std::size_t bucket = 0;
+   while ((std::size_t(1) << bucket) < bytes)
+      ++bucket;
+   return bucket;
+}
+} // anonymous namespace
+
+void *ROOT::Internal::VecOps::AllocateBuffer(std::size_t &bytes)
+{
+   auto &pool = gBufferPool;
+   if (pool.fDepth == 0)
+      return malloc(bytes);
+
+   const auto bucket = BucketForSize(bytes);
+   if (bucket >= RBufferPool::kNBuckets)
+      return malloc(bytes);
+
+   bytes = std::size_t(1) << bucket;
+   auto &buffers = pool.fBuckets[bucket];
+   if (buffers.empty())
+      return malloc(bytes);
+   void *buffer = buffers.back();
+   buffers.pop_back();
+   pool.fPooledBytes -= bytes;
+   return buffer;
+}
+
+void ROOT::Internal::VecOps::ReleaseBuffer(void *buffer, std::size_t bytes)
+{
+   auto &pool = gBufferPool;
+   if (pool.fDepth == 0 || bytes == 0) {
+      free(buffer);
+      return;
+   }
+
+   // the buffer has at least `bytes` bytes, so it can serve requests up to the largest power of two not above that
+   auto bucket = BucketForSize(bytes);
+   if ((std::size_t(1) << bucket) > bytes)
+      --bucket;
+   const auto bucketBytes = std::size_t(1) << bucket;
+   if (bucket >= RBufferPool::kNBuckets || pool.fPooledBytes + bucketBytes > RBufferPool::kMaxPooledBytes) {
+      free(buffer);
+      return;
+   }
+   pool.fBuckets[bucket].emplace_back(buffer);
+   pool.fPooledBytes += bucketBytes;
+}
+
+void ROOT::Internal::VecOps::EnableBufferPool()
+{
+   ++gBufferPool.fDepth;
+}
+
+void ROOT::Internal::VecOps::DisableBufferPool()
+{
+   auto &pool = gBufferPool;
+   R__ASSERT(pool.fDepth > 0);
+   if (--pool.fDepth == 0)
+      pool.Clear();
+}
+
 #if (_VECOPS_USE_EXTERN_TEMPLATES)
 
 namespace ROOT {
@@ -1250,6 +1250,62 @@ TEST(VecOps, InvariantMass)
    EXPECT_NEAR(p5.M(), invMass3, 1e-4);
 }
 
+TEST(VecOps, LorentzVectors)
+{
+   RVec<double> mass1 = {50,  50,  50,   50,   100};
+   RVec<double> pt1 =   {0,   5,   5,    10,   10};
+   RVec<double> eta1 =  {0.0, 0.0, -1.0, 0.5,  2.5};
+   RVec<double> phi1 =  {0.0, 0.0, 0.0,  -0.5, -2.4};
+
+   RVec<double> mass2 = {40,  40,  40,  40,  30};
+   RVec<double> pt2 =   {0,   5,   5,   10,  2};
+   RVec<double> eta2 =  {0.0, 0.0, 0.5, 0.4, 1.2};
+   RVec<double> phi2 =  {0.0, 0.0, 0.0, 0.5, 2.4};
+
+   auto v1 = RLorentzVectors<double>::FromPtEtaPhiM(pt1, eta1, phi1, mass1);
+   const auto v2 = RLorentzVectors<double>::FromPtEtaPhiM(pt2, eta2, phi2, mass2);
+   ASSERT_EQ(v1.size(), 5u);
+
+   const auto pt = v1.Pt();
+   const auto eta = v1.Eta();
+   const auto phi = v1.Phi();
+   const auto mass = v1.M();
+   const auto pairMass = (v1 + v2).M();
+   for (std::size_t i = 0; i < v1.size(); i++) {
+      TLorentzVector p1, p2;
+      p1.SetPtEtaPhiM(pt1[i], eta1[i], phi1[i], mass1[i]);
+      p2.SetPtEtaPhiM(pt2[i], eta2[i], phi2[i], mass2[i]);
+      EXPECT_NEAR(p1.Px(), v1.Px()[i], 1e-9);
+      EXPECT_NEAR(p1.E(), v1.E()[i], 1e-9);
+      EXPECT_NEAR(pt1[i], pt[i], 1e-9);
+      EXPECT_NEAR(mass1[i], mass[i], 1e-9);
+      EXPECT_NEAR((p1 + p2).M(), pairMass[i], 1e-9);
+      if (pt1[i] > 0) {
+         EXPECT_NEAR(eta1[i], eta[i], 1e-9);
+         EXPECT_NEAR(phi1[i], phi[i], 1e-9);
+      }
+   }
+   EXPECT_NEAR(InvariantMass(pt1, eta1, phi1, mass1), v1.InvariantMass(), 1e-9);
+
+   const auto selected = v1[pt1 > 5];
+   ASSERT_EQ(selected.size(), 2u);
+   CheckEqual(selected.Px(), Take(v1.Px(), {3, 4}));
+   CheckEqual(v1.Take({4, 3}).E(), Take(v1.E(), {4, 3}));
+
+   v1.Boost(0.1, -0.2, 0.3);
+   for (std::size_t i = 0; i < v1.size(); i++) {
+      TLorentzVector p1;
+      p1.SetPtEtaPhiM(pt1[i], eta1[i], phi1[i], mass1[i]);
+      p1.Boost(0.1, -0.2, 0.3);
+      EXPECT_NEAR(p1.Px(), v1.Px()[i], 1e-9);
+      EXPECT_NEAR(p1.Py(), v1.Py()[i], 1e-9);
+      EXPECT_NEAR(p1.Pz(), v1.Pz()[i], 1e-9);
+      EXPECT_NEAR(p1.E(), v1.E()[i], 1e-9);
+   }
+   EXPECT_THROW(v1.Boost(0.6, 0.8, 0.), std::runtime_error);
+   EXPECT_THROW(v1 + v1[pt1 > 5], std::runtime_error);
+}
+
 TEST(VecOps, DeltaR)
 {
    RVec<double> eta1 =  {0.1, -1.0, -1.0, 0.5,  -2.5};
@@ -1273,6 +1329,62 @@ TEST(VecOps, DeltaR)
       auto dr4 = DeltaR(eta1[i], eta2[i], phi1[i], phi2[i]);
       EXPECT_NEAR(dr3, dr4, 1e-6);
    }
+
+   EXPECT_THROW(DeltaR(eta1, RVec<double>{0.}, phi1, phi2), std::runtime_error);
+}
+
+// The kernels of Sum, Dot, masked selection, Filter, Where and DeltaPhi have dedicated code paths for arithmetic
+// types: check them against straightforward implementations, for sizes with and without a remainder.
+TEST(VecOps, ArithmeticKernels)
+{
+   for (std::size_t size : {0u, 1u, 7u, 8u, 9u, 33u, 1000u}) {
+      RVecD v(size);
+      RVecI c(size);
+      RVec<bool> b(size);
+      for (std::size_t i = 0; i < size; ++i) {
+         v[i] = 0.1 * i - 3.;
+         c[i] = (i * 7) % 3 == 0;
+         b[i] = c[i] != 0;
+      }
+
+      double sum = 0.;
+      double dot = 0.;
+      RVecD selected;
+      RVecD where;
+      for (std::size_t i = 0; i < size; ++i) {
+         sum += v[i];
+         dot += v[i] * v[i];
+         if (c[i])
+            selected.push_back(v[i]);
+         where.push_back(c[i] ? v[i] : -1.);
+      }
+
+      EXPECT_NEAR(Sum(v), sum, 1e-9 * size);
+      EXPECT_NEAR(Sum(v, 1.5), sum + 1.5, 1e-9 * size);
+      EXPECT_NEAR(Mean(v), size > 0 ? sum / size : 0., 1e-9);
+      EXPECT_NEAR(Dot(v, v), dot, 1e-9 * size);
+      EXPECT_EQ(Sum(c), std::accumulate(c.begin(), c.end(), 0));
+      CheckEqual(v[c], selected);
+      CheckEqual(v[b], selected);
+      CheckEqual(Filter(v, [](double x) { return int(x * 10) % 3 == 0; }),
+                 RVecD(v[Map(v, [](double x) { return int(x * 10) % 3 == 0; })]));
+      CheckEqual(Where(c, v, -1.), where);
+      CheckEqual(Where(c, v, RVecD(size, -1.)), where);
+   }
+
+   // DeltaPhi skips the call to fmod for differences smaller than 2c, the results must not change
+   const auto referenceDeltaPhi = [](double v1, double v2) {
+      auto r = std::fmod(v2 - v1, 2.0 * M_PI);
+      if (r < -M_PI)
+         r += 2.0 * M_PI;
+      else if (r > M_PI)
+         r -= 2.0 * M_PI;
+      return r;
+   };
+   for (double phi = -20.; phi < 20.; phi += 0.37) {
+      EXPECT_EQ(DeltaPhi(0.3, phi), referenceDeltaPhi(0.3, phi));
+      EXPECT_EQ(DeltaPhi(-0.3f, float(phi)), float(referenceDeltaPhi(-0.3f, float(phi))));
+   }
 }
 
 TEST(VecOps, Map)
@@ -1376,6 +1488,45 @@ TEST(VecOps, MemoryAdoptionAndSBO)
    check(v2);
 }
 
+TEST(VecOps, BufferPool)
+{
+   ROOT::Internal::VecOps::EnableBufferPool();
+   const float *buffer = nullptr;
+   {
+      RVec<float> v(100, 1.f);
+      EXPECT_EQ(v.capacity(), 128u); // pooled buffers have power-of-two sizes
+      buffer = v.data();
+   }
+   {
+      // the buffer of the destroyed RVec is reused
+      RVec<float> v(120, 2.f);
+      EXPECT_EQ(v.data(), buffer);
+      EXPECT_EQ(v[119], 2.f);
+      RVec<float> w = v[v > 0.f];
+      EXPECT_NE(w.data(), buffer);
+      EXPECT_EQ(w.size(), 120u);
+      v = std::move(w);
+      EXPECT_EQ(Sum(v), 240.f);
+   }
+   {
+      // both buffers are back in the pool, including the one released by the move assignment
+      RVec<double> v1(64);
+      RVec<double> v2(64);
+      EXPECT_TRUE(v1.data() == static_cast<const void *>(buffer) || v2.data() == static_cast<const void *>(buffer));
+   }
+   {
+      // non-trivially-copyable elements
+      RVec<std::string> s(40, "abc");
+      s.emplace_back("def");
+      EXPECT_EQ(s.size(), 41u);
+      EXPECT_EQ(s.back(), "def");
+   }
+   ROOT::Internal::VecOps::DisableBufferPool();
+
+   RVec<float> v(100);
+   EXPECT_EQ(v.capacity(), 100u);
+}
+
 struct ThrowingCtor {
    ThrowingCtor() { throw std::runtime_error("This exception should have been caught."); }
 };
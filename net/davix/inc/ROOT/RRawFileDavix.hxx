@@ -30,12 +30,18 @@ The RRawFileDavix class provides read-only access to remote non-ROOT files.  It
 the transport layer.  It instructs the RRawFile base class to buffer in larger chunks than the default for
 local files, assuming that remote file access has high(er) latency.
 
+Vector reads are sent as one multi-range request by default. Setting Davix.ParallelRangeRequests to N > 1 in
+the rootrc sends them as independent range requests instead, by up to N threads in parallel; the number of threads
+adapts to the throughput.
+
 */
 
 class RRawFileDavix : public RRawFile {
 private:
    std::unique_ptr<Internal::RDavixFileDes> fFileDes;
 
+   void ReadVParallel(RIOVec *ioVec, unsigned int nReq);
+
 protected:
    void OpenImpl() final;
    size_t ReadAtImpl(void *buffer, size_t nbytes, std::uint64_t offset) final;
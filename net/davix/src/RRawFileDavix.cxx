@@ -11,10 +11,17 @@
 
 #include "ROOT/RRawFileDavix.hxx"
 
+#include <TEnv.h>
 #include <TError.h>
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
 #include <memory>
+#include <mutex>
 #include <stdexcept>
+#include <string>
+#include <thread>
 #include <vector>
 
 #include <davix.hpp>
@@ -22,6 +29,7 @@
 
 namespace {
 constexpr int kDefaultBlockSize = 128 * 1024; // Read in relatively large 128k blocks for better network utilization
+constexpr unsigned int kInitialParallelism = 4;
 } // anonymous namespace
 
 namespace ROOT {
@@ -36,6 +44,12 @@ struct RDavixFileDes {
    DAVIX_FD *fd;
    Davix::Context ctx;
    Davix::DavPosix pos;
+   /// Maximum number of concurrent range requests of a vector read, from Davix.ParallelRangeRequests;
+   /// 0 or 1 means a single multi-range request.
+   unsigned int fMaxParallelism = 0;
+   /// Current number of concurrent range requests, adapted to the throughput of the previous vector reads
+   unsigned int fParallelism = kInitialParallelism;
+   double fLastThroughput = 0.;
 };
 
 } // namespace Internal
@@ -77,6 +91,9 @@ void ROOT::Internal::RRawFileDavix::OpenImpl()
    }
    if (fOptions.fBlockSize < 0)
       fOptions.fBlockSize = kDefaultBlockSize;
+   const int maxParallelism = gEnv ? gEnv->GetValue("Davix.ParallelRangeRequests", 0) : 0;
+   fFileDes->fMaxParallelism = std::max(maxParallelism, 0);
+   fFileDes->fParallelism = std::min(kInitialParallelism, fFileDes->fMaxParallelism);
 }
 
 size_t ROOT::Internal::RRawFileDavix::ReadAtImpl(void *buffer, size_t nbytes, std::uint64_t offset)
@@ -91,6 +108,11 @@ size_t ROOT::Internal::RRawFileDavix::ReadAtImpl(void *buffer, size_t nbytes, st
 
 void ROOT::Internal::RRawFileDavix::ReadVImpl(RIOVec *ioVec, unsigned int nReq)
 {
+   if (fFileDes->fMaxParallelism > 1 && nReq > 1) {
+      ReadVParallel(ioVec, nReq);
+      return;
+   }
+
    Davix::DavixError *davixErr = NULL;
    std::vector<Davix::DavIOVecInput> in(nReq);
    std::vector<Davix::DavIOVecOuput> out(nReq);
@@ -111,3 +133,58 @@ void ROOT::Internal::RRawFileDavix::ReadVImpl(RIOVec *ioVec, unsigned int nReq)
       ioVec[i].fOutBytes = out[i].diov_size;
    }
 }
+
+/// Read the requests as independent range requests, issued by fParallelism threads in parallel. Many object stores
+/// serve these better than multi-range requests. The requests are sessions of the shared Davix context, which pools
+/// the connections. The number of threads is doubled (halved) when the throughput increases (decreases) by more than
+/// 10% with respect to the previous vector read, within [1, fMaxParallelism].
+void ROOT::Internal::RRawFileDavix::ReadVParallel(RIOVec *ioVec, unsigned int nReq)
+{
+   auto &des = *fFileDes;
+   const unsigned int nThreads = std::min(nReq, des.fParallelism);
+   std::atomic<unsigned int> nextReq{0};
+   std::atomic<std::uint64_t> nBytes{0};
+   std::mutex errorMutex;
+   std::string error;
+
+   auto readRequests = [&]() {
+      Davix::DavFile file(des.ctx, Davix::Uri(fUrl));
+      for (auto i = nextReq++; i < nReq; i = nextReq++) {
+         R__ASSERT(ioVec[i].fSize > 0);
+         Davix::DavixError *davixErr = nullptr;
+         auto retval = file.readPartial(nullptr, ioVec[i].fBuffer, ioVec[i].fSize, ioVec[i].fOffset, &davixErr);
+         if (retval < 0) {
+            std::lock_guard<std::mutex> lock(errorMutex);
+            if (error.empty())
+               error = davixErr ? davixErr->getErrMsg() : "unknown error";
+            Davix::DavixError::clearError(&davixErr);
+            nextReq = nReq; // stop the other threads
+            return;
+         }
+         ioVec[i].fOutBytes = retval;
+         nBytes += retval;
+      }
+   };
+
+   const auto start = std::chrono::steady_clock::now();
+   std::vector<std::thread> threads;
+   for (unsigned int i = 1; i < nThreads; ++i)
+      threads.emplace_back(readRequests);
+   readRequests();
+   for (auto &t : threads)
+      t.join();
+   if (!error.empty())
+      throw std::runtime_error("Cannot do parallel range read from '" + fUrl + "', error: " + error);
+
+   const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+   if (elapsed.count() <= 0.)
+      return;
+   const double throughput = nBytes / elapsed.count();
+   if (des.fLastThroughput > 0.) {
+      if (throughput > 1.1 * des.fLastThroughput && des.fParallelism < des.fMaxParallelism)
+         des.fParallelism = std::min(2 * des.fParallelism, des.fMaxParallelism);
+      else if (throughput < 0.9 * des.fLastThroughput && des.fParallelism > 1)
+         des.fParallelism /= 2;
+   }
+   des.fLastThroughput = throughput;
+}
@@ -16,6 +16,7 @@
 #include "TList.h"
 #include "THttpCallArg.h"
 
+#include <chrono>
 #include <mutex>
 #include <map>
 #include <string>
@@ -59,6 +60,19 @@ protected:
    std::mutex fWSMutex;                                      ///<! mutex to protect WS handler lists
    std::vector<std::shared_ptr<THttpWSHandler>> fWSHandlers; ///<! list of WS handlers
 
+   /** reply to a request, kept to serve identical requests from the engine threads */
+   struct TReplyCacheEntry {
+      std::chrono::steady_clock::time_point fTime; ///< when the reply was produced
+      std::string fContent;                        ///< reply content
+      TString fContentType;                        ///< reply content type
+      TString fHeader;                             ///< reply header
+      Int_t fZipping{0};                           ///< reply zipping mode
+   };
+
+   Long_t fReplyCacheTime{0};                                ///<! validity of cached replies in ms, 0 - no caching
+   std::mutex fReplyCacheMutex;                              ///<! mutex to protect the reply cache
+   std::map<std::string, TReplyCacheEntry> fReplyCache;      ///<! cached replies, key from GetReplyCacheKey()
+
    virtual void MissedRequest(THttpCallArg *arg);
 
    virtual void ProcessRequest(std::shared_ptr<THttpCallArg> arg);
@@ -73,6 +87,12 @@ protected:
 
    static Bool_t VerifyFilePath(const char *fname);
 
+   std::string GetReplyCacheKey(const THttpCallArg &arg) const;
+
+   Bool_t ReplyFromCache(THttpCallArg &arg);
+
+   void StoreReplyInCache(const THttpCallArg &arg);
+
    THttpServer(const THttpServer &) = delete;
    THttpServer &operator=(const THttpServer &) = delete;
 
@@ -140,6 +160,13 @@ public:
 
    void CreateServerThread();
 
+   void SetReplyCacheTime(Long_t milliSec = 1000);
+
+   /** returns validity of cached replies in ms, 0 when caching is disabled */
+   Long_t GetReplyCacheTime() const { return fReplyCacheTime; }
+
+   void ClearReplyCache();
+
    /** Check if file is requested, thread safe */
    Bool_t IsFileRequested(const char *uri, TString &res) const;
 
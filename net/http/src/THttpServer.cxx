@@ -87,6 +87,15 @@ If objects content is changing in the application, one could
 enable monitoring flag in the browser - than objects view
 will be regularly updated.
 
+Requests are processed in the main ROOT thread, one after the other.
+When many clients monitor the same objects, replies can be cached
+for a short time with:
+
+    serv->SetReplyCacheTime(500); // in ms, or "http:8080;cache=500"
+
+Identical requests are then served from the cache directly in the
+threads of the http engine, without waiting for the main thread.
+
 More information: https://root.cern/root/htmldoc/guides/HttpServer/HttpServer.html
 */
 
@@ -115,6 +124,7 @@ ClassImp(THttpServer);
 ///     cors           - enable CORS header with origin="*"
 ///     cors=domain    - enable CORS header with origin="domain"
 ///     basic_sniffer  - use basic sniffer without support of hist, gpad, graph classes
+///     cache=ms       - cache replies to object requests for ms milliseconds, see SetReplyCacheTime()
 ///
 /// For example, create http server, which allows cors headers and disable scan of global lists,
 /// one should provide "http:8080;cors;noglobal" as parameter
@@ -187,6 +197,8 @@ THttpServer::THttpServer(const char *engine) : TNamed("http", "ROOT http server"
             SetCors(opt + 5);
          } else if (strcmp(opt, "cors") == 0) {
             SetCors("*");
+         } else if (strncmp(opt, "cache=", 6) == 0) {
+            SetReplyCacheTime(std::atol(opt + 6));
          } else
             CreateEngine(opt);
       }
@@ -497,6 +509,121 @@ void THttpServer::CreateServerThread()
    fThrd = std::move(thrd);
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Cache replies to object requests during milliSec milliseconds
+///
+/// Replies to requests like root.json, root.bin, root.png or h.json without
+/// post data are kept, and identical requests coming in the meantime, from any
+/// client, are replied from the cache by the engine thread which received them.
+/// With many clients monitoring the same objects, the main thread then produces
+/// each reply only once per period. Objects changed in the application are
+/// seen with at most milliSec delay; changes done through the server (command
+/// execution, registration of objects) clear the cache.
+/// A value of 0 disables caching.
+
+void THttpServer::SetReplyCacheTime(Long_t milliSec)
+{
+   fReplyCacheTime = milliSec > 0 ? milliSec : 0;
+   ClearReplyCache();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Remove all cached replies
+///
+/// Can be used when the application changed objects which should not be
+/// delivered with the delay allowed by SetReplyCacheTime()
+
+void THttpServer::ClearReplyCache()
+{
+   std::lock_guard<std::mutex> grd(fReplyCacheMutex);
+   fReplyCache.clear();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Returns key for the reply cache, empty if the reply to the request cannot be cached
+
+std::string THttpServer::GetReplyCacheKey(const THttpCallArg &arg) const
+{
+   if ((fReplyCacheTime <= 0) || (arg.fWSId != 0) || !arg.fPostData.empty() ||
+       (!arg.fMethod.IsNull() && !arg.IsMethod("GET")))
+      return "";
+
+   TString filename = arg.fFileName;
+   if (filename.EndsWith(".gz"))
+      filename.Resize(filename.Length() - 3);
+
+   static const char *cacheable[] = {"root.json", "root.bin", "root.xml", "root.png", "root.gif", "root.jpeg",
+                                     "h.json", "h.xml", "get.xml"};
+   for (auto name : cacheable) {
+      if (filename == name) {
+         std::string key = arg.fUserName.Data();
+         key.append("\n").append(arg.fTopName.Data());
+         key.append("\n").append(arg.fPathName.Data());
+         key.append("\n").append(arg.fFileName.Data());
+         key.append("\n").append(arg.fQuery.Data());
+         return key;
+      }
+   }
+   return "";
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Fill reply from the cache, returns kTRUE if a valid cached reply was found
+///
+/// Method is thread safe and can be called from any thread
+
+Bool_t THttpServer::ReplyFromCache(THttpCallArg &arg)
+{
+   auto key = GetReplyCacheKey(arg);
+   if (key.empty())
+      return kFALSE;
+
+   std::lock_guard<std::mutex> grd(fReplyCacheMutex);
+   auto iter = fReplyCache.find(key);
+   if (iter == fReplyCache.end())
+      return kFALSE;
+   if (std::chrono::steady_clock::now() - iter->second.fTime > std::chrono::milliseconds(fReplyCacheTime)) {
+      fReplyCache.erase(iter);
+      return kFALSE;
+   }
+
+   arg.fContent = iter->second.fContent;
+   arg.fContentType = iter->second.fContentType;
+   arg.fHeader = iter->second.fHeader;
+   arg.fZipping = iter->second.fZipping;
+   return kTRUE;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Store reply in the cache, if the request can be cached
+
+void THttpServer::StoreReplyInCache(const THttpCallArg &arg)
+{
+   if (arg.Is404() || arg.IsPostponed() || arg.IsFile())
+      return;
+   auto key = GetReplyCacheKey(arg);
+   if (key.empty())
+      return;
+
+   auto now = std::chrono::steady_clock::now();
+   std::lock_guard<std::mutex> grd(fReplyCacheMutex);
+
+   // drop expired replies, the number of distinct requests is moderate
+   for (auto iter = fReplyCache.begin(); iter != fReplyCache.end();) {
+      if (now - iter->second.fTime > std::chrono::milliseconds(fReplyCacheTime))
+         iter = fReplyCache.erase(iter);
+      else
+         ++iter;
+   }
+
+   auto &entry = fReplyCache[key];
+   entry.fTime = now;
+   entry.fContent = arg.fContent;
+   entry.fContentType = arg.fContentType;
+   entry.fHeader = arg.fHeader;
+   entry.fZipping = arg.fZipping;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Stop server thread
 ///
@@ -602,6 +729,9 @@ Bool_t THttpServer::ExecuteHttp(std::shared_ptr<THttpCallArg> arg)
    if (fTerminated)
       return kFALSE;
 
+   if (ReplyFromCache(*arg))
+      return kTRUE;
+
    if ((fMainThrdId != 0) && (fMainThrdId == TThread::SelfId())) {
       // should not happen, but one could process requests directly without any signaling
 
@@ -638,6 +768,11 @@ Bool_t THttpServer::SubmitHttp(std::shared_ptr<THttpCallArg> arg, Bool_t can_run
    if (fTerminated)
       return kFALSE;
 
+   if (ReplyFromCache(*arg)) {
+      arg->NotifyCondition();
+      return kTRUE;
+   }
+
    if (can_run_immediately && (fMainThrdId != 0) && (fMainThrdId == TThread::SelfId())) {
       ProcessRequest(arg);
       arg->NotifyCondition();
@@ -693,6 +828,12 @@ Int_t THttpServer::ProcessRequests()
          continue;
       }
 
+      // identical request may be already replied while this one was waiting in the queue
+      if (ReplyFromCache(*arg)) {
+         arg->NotifyCondition();
+         continue;
+      }
+
       fSniffer->SetCurrentCallArg(arg.get());
 
       try {
@@ -703,6 +844,15 @@ Int_t THttpServer::ProcessRequests()
          fSniffer->SetCurrentCallArg(nullptr);
       }
 
+      if (fReplyCacheTime > 0) {
+         // executed commands may change objects
+         if (arg->fFileName.BeginsWith("exe.") || arg->fFileName.BeginsWith("cmd.") ||
+             (arg->fFileName == "multi.json"))
+            ClearReplyCache();
+         else
+            StoreReplyInCache(*arg);
+      }
+
       arg->NotifyCondition();
    }
 
@@ -1081,6 +1231,7 @@ void THttpServer::ProcessRequest(std::shared_ptr<THttpCallArg> arg)
 
 Bool_t THttpServer::Register(const char *subfolder, TObject *obj)
 {
+   ClearReplyCache();
    return fSniffer->RegisterObject(subfolder, obj);
 }
 
@@ -1091,6 +1242,7 @@ Bool_t THttpServer::Register(const char *subfolder, TObject *obj)
 
 Bool_t THttpServer::Unregister(TObject *obj)
 {
+   ClearReplyCache();
    return fSniffer->UnregisterObject(obj);
 }
 
@@ -1220,6 +1372,7 @@ Bool_t THttpServer::ExecuteWS(std::shared_ptr<THttpCallArg> &arg, Bool_t externa
 
 void THttpServer::Restrict(const char *path, const char *options)
 {
+   ClearReplyCache();
    fSniffer->Restrict(path, options);
 }
 
@@ -1297,6 +1450,7 @@ Bool_t THttpServer::CreateItem(const char *fullname, const char *title)
 
 Bool_t THttpServer::SetItemField(const char *fullname, const char *name, const char *value)
 {
+   ClearReplyCache();
    return fSniffer->SetItemField(fullname, name, value);
 }
 
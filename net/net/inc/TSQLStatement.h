@@ -16,10 +16,28 @@
 #include "TString.h"
 #include "TDatime.h"
 #include "TTimeStamp.h"
+#include <string>
 #include <vector>
 
 class TSQLStatement : public TObject {
 
+public:
+   /// The values of one field for a batch of result rows, filled by NextResultRows().
+   /// Depending on fType, the values are in fLong64, fDouble or fString; fIsNull flags the NULL values.
+   struct TColumn {
+      enum EType { kLong64, kDouble, kString };
+
+      Int_t                    fField{0};       ///< Index of the field in the result set
+      EType                    fType{kDouble};  ///< Type the values are retrieved as
+      std::vector<Long64_t>    fLong64;
+      std::vector<Double_t>    fDouble;
+      std::vector<std::string> fString;
+      std::vector<Bool_t>      fIsNull;
+
+      TColumn(Int_t field, EType type) : fField(field), fType(type) {}
+      void Clear();
+   };
+
 protected:
    TSQLStatement(Bool_t errout = kTRUE) { fErrorOut = errout; }
 
@@ -76,6 +94,7 @@ public:
    virtual const char *GetFieldName(Int_t) = 0;
    virtual Bool_t      SetMaxFieldSize(Int_t, Long_t) { return kFALSE; }
    virtual Bool_t      NextResultRow() = 0;
+   virtual Int_t       NextResultRows(std::vector<TColumn> &columns, Int_t maxrows);
 
    virtual Bool_t      IsNull(Int_t) { return kTRUE; }
    virtual Int_t       GetInt(Int_t) { return 0; }
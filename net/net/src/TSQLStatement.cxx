@@ -174,6 +174,17 @@
 //       }
 //    }
 //
+// Instead of one row at a time, the values of a batch of rows can be
+// retrieved column by column with NextResultRows(). This avoids one call per
+// row and per field, and fills arrays which can be used directly, e.g. by a
+// data source of RDataFrame:
+//
+//    std::vector<TSQLStatement::TColumn> columns{{0, TSQLStatement::TColumn::kDouble},
+//                                                {2, TSQLStatement::TColumn::kString}};
+//    while (stmt->NextResultRows(columns, 1000) > 0) {
+//       // columns[0].fDouble and columns[1].fString hold the values of up to 1000 rows
+//    }
+//
 // 4. Working with date/time parameters
 // ====================================
 // The current implementation supports date, time, date&time and timestamp
@@ -423,6 +434,53 @@ Bool_t TSQLStatement::SetTimestamp(Int_t, Int_t, Int_t, Int_t, Int_t, Int_t, Int
    return kFALSE;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Remove the values of the previous batch of rows
+
+void TSQLStatement::TColumn::Clear()
+{
+   fLong64.clear();
+   fDouble.clear();
+   fString.clear();
+   fIsNull.clear();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Fetch up to maxrows result rows at once. The values of the fields given
+/// in columns replace the content of the columns, see TSQLStatement::TColumn;
+/// NULL values are stored as 0 or as an empty string.
+/// Returns the number of fetched rows, 0 at the end of the result set, -1 on error.
+/// After the call, the getters such as GetDouble() return the values of the
+/// last fetched row.
+/// This implementation calls NextResultRow() for each row; drivers holding
+/// the complete result set in memory can provide a faster one.
+
+Int_t TSQLStatement::NextResultRows(std::vector<TColumn> &columns, Int_t maxrows)
+{
+   ClearError();
+   for (auto &col : columns)
+      col.Clear();
+
+   Int_t nrows = 0;
+   while ((nrows < maxrows) && NextResultRow()) {
+      for (auto &col : columns) {
+         const Bool_t isnull = IsNull(col.fField);
+         col.fIsNull.push_back(isnull);
+         switch (col.fType) {
+         case TColumn::kLong64: col.fLong64.push_back(isnull ? 0 : GetLong64(col.fField)); break;
+         case TColumn::kDouble: col.fDouble.push_back(isnull ? 0. : GetDouble(col.fField)); break;
+         case TColumn::kString: {
+            const char *value = isnull ? nullptr : GetString(col.fField);
+            col.fString.emplace_back(value ? value : "");
+            break;
+         }
+         }
+      }
+      nrows++;
+   }
+   return IsError() ? -1 : nrows;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Set parameter as TTimeStamp
 
@@ -26,12 +26,19 @@
 #ifndef __CLING__
 #include <XrdCl/XrdClFileSystem.hh>
 #endif
+#include <memory>
+#include <string>
 
 namespace XrdCl {
    class File;
    class URL;
 }
 class XrdSysCondVar;
+namespace ROOT {
+namespace Internal {
+class RBlockCache;
+}
+}
 
 #ifdef __CLING__
 namespace XrdCl {
@@ -50,13 +57,17 @@ private:
    // if requested
    Int_t                   fReadvIorMax; // Max size of a single readv chunk
    Int_t                   fReadvIovMax; // Max number of readv chunks
+   Int_t                   fReadvGapMax; // Max gap between two buffers read as one readv chunk
+   Int_t                   fReadvMaxInFlight; // Max number of readv requests in flight
    Int_t                   fQueryReadVParams;
    TString                 fNewUrl;
+   std::shared_ptr<ROOT::Internal::RBlockCache> fBlockCache; //! Local disk cache for the vector reads, if configured
+   std::string             fBlockCacheId; //! Identity of the file content in the block cache
 
 public:
    TNetXNGFile() : TFile(),
       fFile(nullptr), fUrl(nullptr), fMode(XrdCl::OpenFlags::None), fInitCondVar(nullptr),
-      fReadvIorMax(0), fReadvIovMax(0) {}
+      fReadvIorMax(0), fReadvIovMax(0), fReadvGapMax(0), fReadvMaxInFlight(1) {}
    TNetXNGFile(const char *url, const char *lurl, Option_t *mode, const char *title,
                Int_t compress, Int_t netopt, Bool_t parallelopen);
    TNetXNGFile(const char *url, Option_t *mode = "", const char *title = "",
@@ -85,6 +96,10 @@ private:
    virtual void   SetEnv();
    Int_t ParseOpenMode(Option_t *in, TString &modestr,
                        XrdCl::OpenFlags::Flags &mode, Bool_t assumeRead);
+   Bool_t ReadBuffersImpl(char *buffer, Long64_t *position, Int_t *length,
+                          Int_t nbuffs);
+   Bool_t ReadBuffersViaBlockCache(char *buffer, Long64_t *position,
+                                   Int_t *length, Int_t nbuffs);
 
    TNetXNGFile(const TNetXNGFile &other);             // Not implemented
    TNetXNGFile &operator =(const TNetXNGFile &other); // Not implemented
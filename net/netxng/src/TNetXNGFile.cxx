@@ -20,6 +20,7 @@
 
 #include "TArchiveFile.h"
 #include "TNetXNGFile.h"
+#include "ROOT/RBlockCache.hxx"
 #include "TEnv.h"
 #include "TSystem.h"
 #include "TTimeStamp.h"
@@ -30,7 +31,12 @@
 #include <XrdCl/XrdClXRootDResponses.hh>
 #include <XrdCl/XrdClDefaultEnv.hh>
 #include <XrdVersion.hh>
+#include <algorithm>
+#include <cstring>
 #include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
 
 //------------------------------------------------------------------------------
 // Open handler for async open requests
@@ -159,6 +165,8 @@ TNetXNGFile::TNetXNGFile(const char *url, const char *lurl, Option_t *mode, cons
    fQueryReadVParams = 1;
    fReadvIorMax = 2097136;
    fReadvIovMax = 1024;
+   fReadvGapMax = gEnv->GetValue("NetXNG.ReadVGapMax", 16384);
+   fReadvMaxInFlight = std::max(1, gEnv->GetValue("NetXNG.ReadVMaxInFlight", 8));
 
    if (ParseOpenMode(mode, fOption, fMode, kTRUE)<0) {
       Error("Open", "could not parse open mode %s", mode);
@@ -210,6 +218,10 @@ TNetXNGFile::TNetXNGFile(const char *url, const char *lurl, Option_t *mode, cons
        (fMode & OpenFlags::Update) )
       fWritable = true;
 
+   // Read-only files can be served from the local disk block cache
+   if (fMode == OpenFlags::Read)
+      fBlockCache = ROOT::Internal::RBlockCache::GetGlobal();
+
    // Initialize the file
    bool create = false;
    if( (fMode & OpenFlags::New) || (fMode & OpenFlags::Delete) )
@@ -467,18 +479,87 @@ Bool_t TNetXNGFile::ReadBuffer(char *buffer, Long64_t position, Int_t length)
 Bool_t TNetXNGFile::ReadBuffers(char *buffer, Long64_t *position, Int_t *length,
       Int_t nbuffs)
 {
-   using namespace XrdCl;
-
    // Check the file isn't a zombie or closed
    if (!IsUseable())
       return kTRUE;
 
+   if (fBlockCache && !fArchiveOffset)
+      return ReadBuffersViaBlockCache(buffer, position, length, nbuffs);
+   return ReadBuffersImpl(buffer, position, length, nbuffs);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Read scattered data chunks through the local disk block cache. The blocks
+/// missing from the cache are read with ReadBuffersImpl. The file content is
+/// identified by the URL, the size and the modification time of the file.
+
+Bool_t TNetXNGFile::ReadBuffersViaBlockCache(char *buffer, Long64_t *position,
+      Int_t *length, Int_t nbuffs)
+{
+   using namespace XrdCl;
+   using ROOT::Internal::RRawFile;
+
+   StatInfo *info = 0;
+   if (fBlockCacheId.empty()) {
+      if (!fFile->Stat(false, info).IsOK())
+         return ReadBuffersImpl(buffer, position, length, nbuffs);
+      fBlockCacheId = fUrl->GetURL() + "#" + std::to_string(info->GetSize()) +
+                      "#" + std::to_string(info->GetModTime());
+      delete info;
+   }
+
+   std::vector<RRawFile::RIOVec> ioVec(nbuffs);
+   char *cursor = buffer;
+   for (Int_t i = 0; i < nbuffs; ++i) {
+      ioVec[i].fBuffer = cursor;
+      ioVec[i].fOffset = position[i];
+      ioVec[i].fSize = length[i];
+      cursor += length[i];
+   }
+
+   auto readFunc = [this](RRawFile::RIOVec *blocks, unsigned int nblocks) {
+      std::vector<Long64_t> blockPositions(nblocks);
+      std::vector<Int_t> blockLengths(nblocks);
+      Long64_t totalSize = 0;
+      for (unsigned int i = 0; i < nblocks; ++i) {
+         blockPositions[i] = blocks[i].fOffset;
+         blockLengths[i] = blocks[i].fSize;
+         totalSize += blocks[i].fSize;
+      }
+      std::unique_ptr<char[]> blockBuffer(new char[totalSize]);
+      Bool_t failed = ReadBuffersImpl(blockBuffer.get(), blockPositions.data(),
+                                      blockLengths.data(), nblocks);
+      const char *source = blockBuffer.get();
+      for (unsigned int i = 0; i < nblocks; ++i) {
+         blocks[i].fOutBytes = failed ? 0 : blocks[i].fSize;
+         if (!failed)
+            memcpy(blocks[i].fBuffer, source, blocks[i].fSize);
+         source += blocks[i].fSize;
+      }
+   };
+   fBlockCache->ReadV(fBlockCacheId, GetSize(), ioVec.data(), nbuffs, readFunc);
+
+   for (Int_t i = 0; i < nbuffs; ++i) {
+      if (ioVec[i].fOutBytes != ioVec[i].fSize) {
+         Error("ReadBuffers", "could not read %d bytes at offset %lld",
+               length[i], position[i]);
+         return kTRUE;
+      }
+   }
+   return kFALSE;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Read scattered data chunks from the server in vector reads
+
+Bool_t TNetXNGFile::ReadBuffersImpl(char *buffer, Long64_t *position,
+      Int_t *length, Int_t nbuffs)
+{
+   using namespace XrdCl;
+
    std::vector<ChunkList>      chunkLists;
    ChunkList                   chunks;
-   std::vector<XRootDStatus*> *statuses;
-   TSemaphore                 *semaphore;
    Int_t                       totalBytes = 0;
-   Long64_t                    offset     = 0;
    char                       *cursor     = buffer;
 
    Double_t start = 0;
@@ -488,41 +569,67 @@ Bool_t TNetXNGFile::ReadBuffers(char *buffer, Long64_t *position, Int_t *length,
       for (Int_t i = 0; i < nbuffs; i++)
          position[i] += fArchiveOffset;
 
-   // Build a list of chunks. Put the buffers in the ChunkInfo's
-   for (Int_t i = 0; i < nbuffs; ++i) {
-      totalBytes += length[i];
-
-      // If the length is bigger than max readv size, split into smaller chunks
-      if (length[i] > fReadvIorMax) {
-         Int_t nsplit = length[i] / fReadvIorMax;
-         Int_t rem    = length[i] % fReadvIorMax;
-         Int_t j;
-
-         // Add as many max-size chunks as are divisible
-         for (j = 0; j < nsplit; ++j) {
-            offset = position[i] + (j * fReadvIorMax);
-            chunks.push_back(ChunkInfo(offset, fReadvIorMax, cursor));
-            cursor += fReadvIorMax;
+   // Add a chunk to the lists, split if bigger than the max readv size
+   auto addChunk = [&](Long64_t chunkOffset, Int_t chunkLength, char *target) {
+      while (chunkLength > 0) {
+         Int_t len = fReadvIorMax > 0 ? std::min(chunkLength, fReadvIorMax) : chunkLength;
+         chunks.push_back(ChunkInfo(chunkOffset, len, target));
+         chunkOffset += len;
+         chunkLength -= len;
+         target += len;
+
+         // If there are max chunks, make another chunk list
+         if ((Int_t) chunks.size() == fReadvIovMax) {
+            chunkLists.push_back(chunks);
+            chunks = ChunkList();
          }
-
-         // Add the remainder
-         offset = position[i] + (j * fReadvIorMax);
-         chunks.push_back(ChunkInfo(offset, rem, cursor));
-         cursor += rem;
-      } else {
-         chunks.push_back(ChunkInfo(position[i], length[i], cursor));
-         cursor += length[i];
+      }
+   };
+
+   // Build a list of chunks. Consecutive buffers separated by at most
+   // fReadvGapMax bytes are read as one chunk, saving the per-chunk overhead
+   // of the server: directly into the target buffers if they are adjacent in
+   // the file, otherwise into a scratch buffer from which they are copied.
+   struct TScatteredBuffer {
+      char       *fTarget;
+      const char *fSource;
+      Int_t       fLength;
+   };
+   std::vector<std::unique_ptr<char[]>> scratchBuffers;
+   std::vector<TScatteredBuffer>        scattered;
+   for (Int_t i = 0; i < nbuffs;) {
+      Long64_t first  = position[i];
+      Long64_t end    = position[i] + length[i];
+      Int_t    last   = i;
+      Bool_t   hasGap = kFALSE;
+      while (last + 1 < nbuffs) {
+         Long64_t gap = position[last + 1] - end;
+         if (gap < 0 || gap > fReadvGapMax)
+            break;
+         Long64_t newEnd = position[last + 1] + length[last + 1];
+         // A chunk read into a scratch buffer must fit in one readv chunk
+         if ((hasGap || gap > 0) && newEnd - first > fReadvIorMax)
+            break;
+         hasGap = hasGap || gap > 0;
+         end    = newEnd;
+         ++last;
       }
 
-      // If there are more than or equal to max chunks, make another chunk list
-      if ((Int_t) chunks.size() == fReadvIovMax) {
-         chunkLists.push_back(chunks);
-         chunks = ChunkList();
-      } else if ((Int_t) chunks.size() > fReadvIovMax) {
-         chunkLists.push_back(ChunkList(chunks.begin(),
-                                        chunks.begin() + fReadvIovMax));
-         chunks = ChunkList(chunks.begin() + fReadvIovMax, chunks.end());
+      if (!hasGap) {
+         addChunk(first, end - first, cursor);
+         cursor += end - first;
+      } else {
+         scratchBuffers.emplace_back(new char[end - first]);
+         char *scratch = scratchBuffers.back().get();
+         addChunk(first, end - first, scratch);
+         for (Int_t j = i; j <= last; ++j) {
+            scattered.push_back({cursor, scratch + (position[j] - first), length[j]});
+            cursor += length[j];
+         }
       }
+      for (Int_t j = i; j <= last; ++j)
+         totalBytes += length[j];
+      i = last + 1;
    }
 
    // Push back the last chunk list
@@ -531,46 +638,46 @@ Bool_t TNetXNGFile::ReadBuffers(char *buffer, Long64_t *position, Int_t *length,
 
    TAsyncReadvHandler *handler;
    XRootDStatus        status;
-   semaphore = new TSemaphore(0);
-   statuses  = new std::vector<XRootDStatus*>(chunkLists.size());
-
-   // Read asynchronously but wait for all responses
-   std::vector<ChunkList>::iterator it;
-   for (it = chunkLists.begin(); it != chunkLists.end(); ++it)
-   {
-      handler = new TAsyncReadvHandler(statuses, it - chunkLists.begin(),
-                                       semaphore);
-      status = fFile->VectorRead(*it, 0, handler);
-
+   TSemaphore          semaphore(0);
+   std::vector<XRootDStatus*> statuses(chunkLists.size(), nullptr);
+
+   // Read asynchronously, with at most fReadvMaxInFlight vector reads in
+   // flight, and wait for all responses
+   Int_t nInFlight = 0;
+   Bool_t failed = kFALSE;
+   for (size_t i = 0; i < chunkLists.size(); ++i) {
+      if (nInFlight == fReadvMaxInFlight) {
+         semaphore.Wait();
+         --nInFlight;
+      }
+      handler = new TAsyncReadvHandler(&statuses, i, &semaphore);
+      status = fFile->VectorRead(chunkLists[i], 0, handler);
       if (!status.IsOK()) {
          Error("ReadBuffers", "%s", status.ToStr().c_str());
-         return kTRUE;
+         delete handler;
+         failed = kTRUE;
+         break;
       }
+      ++nInFlight;
    }
 
    // Wait for all responses
-   for (it = chunkLists.begin(); it != chunkLists.end(); ++it) {
-      semaphore->Wait();
-   }
+   for (; nInFlight > 0; --nInFlight)
+      semaphore.Wait();
 
    // Check for errors
-   for (it = chunkLists.begin(); it != chunkLists.end(); ++it) {
-      XRootDStatus *st = statuses->at(it - chunkLists.begin());
-
-      if (!st->IsOK()) {
+   for (auto st : statuses) {
+      if (st && !st->IsOK() && !failed) {
          Error("ReadBuffers", "%s", st->ToStr().c_str());
-         for( ; it != chunkLists.end(); ++it )
-         {
-            st = statuses->at( it - chunkLists.begin() );
-            delete st;
-         }
-         delete statuses;
-         delete semaphore;
-
-         return kTRUE;
+         failed = kTRUE;
       }
       delete st;
    }
+   if (failed)
+      return kTRUE;
+
+   for (const auto &buf : scattered)
+      memcpy(buf.fTarget, buf.fSource, buf.fLength);
 
    // Bump the globals
    fBytesRead  += totalBytes;
@@ -586,8 +693,6 @@ Bool_t TNetXNGFile::ReadBuffers(char *buffer, Long64_t *position, Int_t *length,
    if (gMonitoringWriter)
       gMonitoringWriter->SendFileReadProgress(this);
 
-   delete statuses;
-   delete semaphore;
    return kFALSE;
 }
 
@@ -63,6 +63,7 @@ enum Computer {
    NegativeLogarithms,
    NormalizedPdf,
    Novosibirsk,
+   PiecewiseInterpolation,
    Poisson,
    Polynomial,
    ProdPdf,
@@ -38,6 +38,11 @@ typedef std::vector<double> ArgVector;
 typedef double *__restrict RestrictArr;
 typedef const double *__restrict InputArr;
 
+/// With CUDA, the inputs and the extra arguments of a computation are passed by value to the kernels in
+/// fixed-size buffers. Computations with more inputs can't be done with CUDA.
+constexpr std::size_t maxCudaParams = 8;
+constexpr std::size_t maxCudaExtraArgs = 16;
+
 } // namespace RooBatchCompute
 
 #endif
@@ -32,8 +32,8 @@ namespace RooBatchCompute {
 #ifdef __CUDACC__
 // In the CPU case we use std::vector instead of fixed size arrays to pass
 // around data, so no maximum size variables are necessary.
-constexpr std::size_t maxParams = 8;
-constexpr std::size_t maxExtraArgs = 16;
+constexpr std::size_t maxParams = maxCudaParams;
+constexpr std::size_t maxExtraArgs = maxCudaExtraArgs;
 #endif // #ifdef __CUDACC__
 constexpr std::size_t bufferSize = 64;
 
@@ -594,6 +594,56 @@ __rooglobal__ void computeNovosibirsk(BatchesHandle batches)
       batches._output[i] = fast_exp(batches._output[i]);
 }
 
+/// Inputs: the nominal values and, for every interpolation parameter, the low and high variations and the
+/// parameter. Extra arguments: the interpolation code of every parameter and the positive definite flag.
+/// Same interpolation as RooFit::Detail::EvaluateFuncs::piecewiseInterpolation().
+__rooglobal__ void computePiecewiseInterpolation(BatchesHandle batches)
+{
+   const int nParams = batches.getNExtraArgs() - 1;
+   const bool positiveDefinite = batches.extraArg(nParams);
+   Batch nominal = batches[0];
+
+   for (size_t i = BEGIN; i < batches.getNEvents(); i += STEP) {
+      batches._output[i] = nominal[i];
+   }
+
+   for (int k = 0; k < nParams; k++) {
+      Batch low = batches[1 + 3 * k];
+      Batch high = batches[2 + 3 * k];
+      Batch param = batches[3 + 3 * k];
+      const int code = batches.extraArg(k);
+      for (size_t i = BEGIN; i < batches.getNEvents(); i += STEP) {
+         const double x = param[i];
+         const double nom = nominal[i];
+         if (x > 1.0 || x < -1.0) {
+            batches._output[i] += x * (x > 0 ? high[i] - nom : nom - low[i]);
+            continue;
+         }
+         const double epsPlus = high[i] - nom;
+         const double epsMinus = nom - low[i];
+         const double S = 0.5 * (epsPlus + epsMinus);
+         double val = nom;
+         if (code == 4) {
+            // polynomial of 6th degree: function and first two derivatives are continuous at |x| = 1
+            const double A = 0.0625 * (epsPlus - epsMinus);
+            val += x * (S + x * A * (15 + x * x * (-10 + x * x * 3)));
+         } else if (nom != 0) {
+            // polynomial of 4th degree: function and first derivative are continuous at |x| = 1
+            const double A = 0.5 * (epsPlus - epsMinus);
+            val += S * x + 1.5 * A * x * x - 0.5 * A * x * x * x * x;
+         }
+         batches._output[i] += (val < 0 ? 0 : val) - nom;
+      }
+   }
+
+   if (positiveDefinite) {
+      for (size_t i = BEGIN; i < batches.getNEvents(); i += STEP) {
+         if (batches._output[i] < 0)
+            batches._output[i] = 0;
+      }
+   }
+}
+
 __rooglobal__ void computePoisson(BatchesHandle batches)
 {
    Batch x = batches[0], mean = batches[1];
@@ -809,6 +859,7 @@ std::vector<void (*)(BatchesHandle)> getFunctions()
            computeNegativeLogarithms,
            computeNormalizedPdf,
            computeNovosibirsk,
+           computePiecewiseInterpolation,
            computePoisson,
            computePolynomial,
            computeProdPdf,
@@ -81,10 +81,10 @@ public:
    void compute(cudaStream_t *, Computer computer, RestrictArr output, size_t nEvents, const VarVector &vars,
                 ArgVector &extraArgs) override
    {
-      static std::vector<double> buffer;
-      buffer.resize(vars.size() * bufferSize);
-
       if (ROOT::IsImplicitMTEnabled()) {
+         // With implicit multi-threading, several nodes can be computed
+         // concurrently by the RooFitDriver, so each call has its own buffer.
+         std::vector<double> buffer(vars.size() * bufferSize);
          ROOT::Internal::TExecutor ex;
          std::size_t nThreads = ex.GetPoolSize();
 
@@ -122,6 +122,9 @@ public:
          }
          ex.Map(task, indices);
       } else {
+         thread_local std::vector<double> buffer;
+         buffer.resize(vars.size() * bufferSize);
+
          // Fill a std::vector<Batches> with the same object and with ~nEvents/nThreads
          // Then advance every object but the first to split the work between threads
          Batches batches(output, nEvents, vars, extraArgs, buffer.data());
@@ -17,6 +17,8 @@
 #include "RooObjCacheManager.h"
 #include "RooDataHist.h"
 
+#include <vector>
+
 // Forward Declarations
 class RooRealVar;
 class RooWorkspace;
@@ -95,6 +97,7 @@ protected:
     int xyz = 0;
   };
   mutable NumBins _numBinsPerDim; //!
+  mutable std::vector<double> _paramValues; //! Parameter values used in computeBatch()
   mutable RooDataHist _dataSet;
 
   Int_t getCurrentBin() const;
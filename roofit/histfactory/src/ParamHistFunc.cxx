@@ -632,9 +632,13 @@ void ParamHistFunc::computeBatch(cudaStream_t*, double* output, size_t size, Roo
     _dataSet.getBinnings()[iVar]->binNumbers(dataMap.at(&_dataVars[iVar]).data(), indexBuffer, size, idxMult[iVar]);
   }
 
-  // Finally, look up the parameters and get their values to fill the output buffer
+  // Finally, look up the parameter values once and gather them to fill the output buffer
+  _paramValues.resize(_paramSet.size());
+  for (std::size_t iParam = 0; iParam < _paramSet.size(); ++iParam) {
+    _paramValues[iParam] = dataMap.at(&_paramSet[iParam])[0];
+  }
   for (std::size_t i = 0; i < size; ++i) {
-    output[i] = static_cast<RooAbsReal const&>(_paramSet[indexBuffer[i]]).getVal();
+    output[i] = _paramValues[indexBuffer[i]];
   }
 }
 
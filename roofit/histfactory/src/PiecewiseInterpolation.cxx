@@ -21,6 +21,7 @@
 #include "RooStats/HistFactory/PiecewiseInterpolation.h"
 
 #include "RooFit/Detail/EvaluateFuncs.h"
+#include "RooBatchCompute.h"
 
 #include "Riostream.h"
 #include "TBuffer.h"
@@ -238,38 +239,40 @@ void PiecewiseInterpolation::translate(RooFit::Detail::CodeSquashContext &ctx) c
 }
 
 ////////////////////////////////////////////////////////////////////////////////
-/// Interpolate between input distributions for all values of the observable in `evalData`.
-/// \param[in,out] evalData Struct holding spans pointing to input data. The results of this function will be stored here.
-/// \param[in] normSet Arguments to normalise over.
-void PiecewiseInterpolation::computeBatch(cudaStream_t*, double* sum, size_t /*size*/, RooFit::Detail::DataMap const& dataMap) const {
-  auto nominal = dataMap.at(_nominal);
-  for(unsigned int j=0; j < nominal.size(); ++j) {
-    sum[j] = nominal[j];
-  }
-
+/// Interpolate between input distributions for all values of the observable with
+/// the vectorised RooBatchCompute kernel (CPU or CUDA).
+void PiecewiseInterpolation::computeBatch(cudaStream_t* stream, double* sum, size_t size, RooFit::Detail::DataMap const& dataMap) const {
+  RooBatchCompute::VarVector vars;
+  RooBatchCompute::ArgVector extraArgs;
+  vars.reserve(1 + 3 * _paramSet.size());
+  extraArgs.reserve(_paramSet.size() + 1);
+
+  vars.push_back(dataMap.at(_nominal));
   for (unsigned int i=0; i < _paramSet.size(); ++i) {
-    const double param = static_cast<RooAbsReal*>(_paramSet.at(i))->getVal();
-    auto low   = dataMap.at(_lowSet.at(i));
-    auto high  = dataMap.at(_highSet.at(i));
     const int icode = _interpCode[i];
-
     if (icode < 0 || icode > 5) {
       coutE(InputArguments) << "PiecewiseInterpolation::computeBatch(): " << _paramSet[i].GetName()
                        << " with unknown interpolation code" << icode << std::endl;
       throw std::invalid_argument("PiecewiseInterpolation::computeBatch() got invalid interpolation code " + std::to_string(icode));
     }
-
-    for (unsigned int j=0; j < nominal.size(); ++j) {
-       sum[j] = piecewiseInterpolation(icode, low[j], high[j], nominal[j], param, sum[j]);
-    }
+    vars.push_back(dataMap.at(_lowSet.at(i)));
+    vars.push_back(dataMap.at(_highSet.at(i)));
+    vars.push_back(dataMap.at(_paramSet.at(i)));
+    extraArgs.push_back(icode);
   }
+  extraArgs.push_back(_positiveDefinite);
 
-  if (_positiveDefinite) {
-    for(unsigned int j=0; j < nominal.size(); ++j) {
-      if (sum[j] < 0.)
-        sum[j] = 0.;
-    }
-  }
+  auto dispatch = stream ? RooBatchCompute::dispatchCUDA : RooBatchCompute::dispatchCPU;
+  dispatch->compute(stream, RooBatchCompute::PiecewiseInterpolation, sum, size, vars, extraArgs);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// The CUDA kernels get their inputs in fixed-size buffers, which limits the number of parameters.
+
+bool PiecewiseInterpolation::canComputeBatchWithCuda() const
+{
+  return 1 + 3 * _paramSet.size() <= RooBatchCompute::maxCudaParams &&
+         _paramSet.size() + 1 <= RooBatchCompute::maxCudaExtraArgs;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -100,6 +100,8 @@ public:
                std::function<double(int)> getBinScale = [](int){ return 1.0; } );
 
   void weights(double* output, RooSpan<double const> xVals, int intOrder, bool correctForBinSize, bool cdfBoundaries);
+  void weights(double* output, std::vector<RooSpan<const double>> const& coords, std::size_t nEvents,
+               bool correctForBinSize, bool zeroOutOfRange) const;
   /// Return weight of i-th bin. \see getIndex()
   double weight(std::size_t i) const { return _wgt[i]; }
   double weightFast(const RooArgSet& bin, int intOrder, bool correctForBinSize, bool cdfBoundaries);
@@ -229,6 +231,8 @@ public:
   double interpolateDim(int iDim, double xval, size_t centralIdx, int intOrder, bool correctForBinSize, bool cdfBoundaries) ;
   const std::vector<double>& calculatePartialBinVolume(const RooArgSet& dimSet) const ;
   void checkBinBounds() const;
+  void shareArrays() const;
+  void unshareArrays();
 
   void adjustBinning(const RooArgList& vars, const TH1& href, Int_t* offset=nullptr) ;
   void importTH1(const RooArgList& vars, const TH1& histo, double initWgt, bool doDensityCorrection) ;
@@ -244,6 +248,10 @@ public:
   mutable double* _sumw2{nullptr}; ///<[_arrSize] Sum of weights^2
   double*         _binv {nullptr}; ///<[_arrSize] Bin volume array
 
+  /// Owner of the _wgt, _sumw2 and _binv arrays if they are shared with copies of this RooDataHist
+  struct SharedArrays;
+  mutable std::shared_ptr<SharedArrays> _sharedArrays; ///<!
+
   mutable ULong64_t _curIndex{std::numeric_limits<ULong64_t>::max()}; ///< Current index
 
   mutable std::unordered_map<int,std::vector<double>> _pbinvCache ; ///<! Cache for arrays of partial bin volumes
@@ -23,6 +23,7 @@
 #include "RooSetProxy.h"
 #include "RooListProxy.h"
 #include <list>
+#include <vector>
 
 class RooArgSet ;
 class TH1F ;
@@ -91,6 +92,10 @@ protected:
 
   const RooArgSet& parameters() const ;
 
+  void fillRecentNumIntKey() const ;
+  const double* findRecentNumInt() const ;
+  void addRecentNumInt(double value) const ;
+
   enum IntOperMode { Hybrid, Analytic, PassThrough } ;
   //friend class RooAbsPdf ;
 
@@ -145,6 +150,8 @@ protected:
   TNamed* _rangeName = nullptr;
 
   mutable std::unique_ptr<RooArgSet> _params; ///<! cache for set of parameters
+  mutable std::vector<std::vector<double>> _recentNumInts; ///<! parameter values and result of recent numeric integrals
+  mutable std::vector<double> _recentNumIntKey; ///<! current parameter values for lookup in _recentNumInts
 
   bool _cacheNum = false;           ///< Cache integral if numeric
   static Int_t _cacheAllNDim ; ///<! Cache all integrals with given numeric dimension
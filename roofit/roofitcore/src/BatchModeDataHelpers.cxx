@@ -26,7 +26,7 @@ namespace {
 
 std::map<RooFit::Detail::DataKey, RooSpan<const double>>
 getSingleDataSpans(RooAbsData const &data, std::string_view rangeName, std::string const &prefix,
-                   std::stack<std::vector<double>> &buffers, bool skipZeroWeights)
+                   std::stack<std::vector<double>> &buffers, bool skipZeroWeights, bool canReferenceData)
 {
    std::map<RooFit::Detail::DataKey, RooSpan<const double>> dataSpans; // output variable
 
@@ -55,39 +55,54 @@ getSingleDataSpans(RooAbsData const &data, std::string_view rangeName, std::stri
 
    std::vector<bool> hasZeroWeight;
    hasZeroWeight.resize(nEvents);
-   std::size_t nNonZeroWeight = 0;
+   std::size_t nNonZeroWeight = nEvents;
+   if (skipZeroWeights && !weight.empty()) {
+      for (std::size_t i = 0; i < nEvents; ++i) {
+         hasZeroWeight[i] = weight[i] == 0;
+         nNonZeroWeight -= hasZeroWeight[i];
+      }
+   }
+
+   // The columns of the dataset are only copied if entries need to be
+   // skipped. Otherwise, the spans point directly to the memory of the dataset
+   // such that large datasets are not duplicated.
+   const bool copyData = !canReferenceData || nNonZeroWeight < nEvents;
+
+   // The weights of a RooDataHist are shared with its copies until one of
+   // them is modified, after which the shared weights belong to the other
+   // copies only (see RooDataHist::unshareArrays()). They are therefore
+   // always copied, which is cheap for histograms, such that the spans stay
+   // valid and unchanged when the histogram is modified or its copies are
+   // deleted.
+   auto dataHist = dynamic_cast<RooDataHist const *>(&data);
+
+   auto copyColumn = [&](auto const &span) -> RooSpan<const double> {
+      buffers.emplace();
+      auto &buffer = buffers.top();
+      buffer.reserve(nNonZeroWeight);
+      for (std::size_t i = 0; i < nEvents; ++i) {
+         if (!hasZeroWeight[i]) {
+            buffer.push_back(static_cast<double>(span[i]));
+         }
+      }
+      return {buffer.data(), buffer.size()};
+   };
 
    // Add weights to the datamap. They should have the names expected by the
    // RooNLLVarNew. We also add the sumW2 weights here under a different name,
    // so we can apply the sumW2 correction by easily swapping the spans.
    {
-      buffers.emplace();
-      auto &buffer = buffers.top();
-      buffers.emplace();
-      auto &bufferSumW2 = buffers.top();
       if (weight.empty()) {
          // If the dataset has no weight, we fill the data spans with a scalar
          // unity weight so we don't need to check for the existance of weights
          // later in the likelihood.
-         buffer.push_back(1.0);
-         bufferSumW2.push_back(1.0);
-         weight = RooSpan<const double>(buffer.data(), 1);
-         weightSumW2 = RooSpan<const double>(bufferSumW2.data(), 1);
-         nNonZeroWeight = nEvents;
-      } else {
-         buffer.reserve(nEvents);
-         bufferSumW2.reserve(nEvents);
-         for (std::size_t i = 0; i < nEvents; ++i) {
-            if (!skipZeroWeights || weight[i] != 0) {
-               buffer.push_back(weight[i]);
-               bufferSumW2.push_back(weightSumW2[i]);
-               ++nNonZeroWeight;
-            } else {
-               hasZeroWeight[i] = true;
-            }
-         }
-         weight = RooSpan<const double>(buffer.data(), nNonZeroWeight);
-         weightSumW2 = RooSpan<const double>(bufferSumW2.data(), nNonZeroWeight);
+         buffers.emplace(1, 1.0);
+         weight = RooSpan<const double>(buffers.top().data(), 1);
+         buffers.emplace(1, 1.0);
+         weightSumW2 = RooSpan<const double>(buffers.top().data(), 1);
+      } else if (copyData || dataHist) {
+         weight = copyColumn(weight);
+         weightSumW2 = copyColumn(weightSumW2);
       }
       using namespace ROOT::Experimental;
       insert(RooNLLVarNew::weightVarName, weight);
@@ -95,7 +110,7 @@ getSingleDataSpans(RooAbsData const &data, std::string_view rangeName, std::stri
    }
 
    // Add also bin volume information if we are dealing with a RooDataHist
-   if (auto dataHist = dynamic_cast<RooDataHist const *>(&data)) {
+   if (dataHist) {
       buffers.emplace();
       auto &buffer = buffers.top();
       buffer.reserve(nNonZeroWeight);
@@ -112,37 +127,15 @@ getSingleDataSpans(RooAbsData const &data, std::string_view rangeName, std::stri
    // Get the real-valued batches and cast the also to double branches to put in
    // the data map
    for (auto const &item : data.getBatches(0, nEvents)) {
-
       RooSpan<const double> span{item.second};
-
-      buffers.emplace();
-      auto &buffer = buffers.top();
-      buffer.reserve(nNonZeroWeight);
-
-      for (std::size_t i = 0; i < nEvents; ++i) {
-         if (!hasZeroWeight[i]) {
-            buffer.push_back(span[i]);
-         }
-      }
-      insert(item.first->GetName(), {buffer.data(), buffer.size()});
+      insert(item.first->GetName(), copyData ? copyColumn(span) : span);
    }
 
    // Get the category batches and cast the also to double branches to put in
    // the data map
    for (auto const &item : data.getCategoryBatches(0, nEvents)) {
-
       RooSpan<const RooAbsCategory::value_type> intSpan{item.second};
-
-      buffers.emplace();
-      auto &buffer = buffers.top();
-      buffer.reserve(nNonZeroWeight);
-
-      for (std::size_t i = 0; i < nEvents; ++i) {
-         if (!hasZeroWeight[i]) {
-            buffer.push_back(static_cast<double>(intSpan[i]));
-         }
-      }
-      insert(item.first->GetName(), {buffer.data(), buffer.size()});
+      insert(item.first->GetName(), copyColumn(intSpan));
    }
 
    nEvents = nNonZeroWeight;
@@ -216,7 +209,9 @@ getSingleDataSpans(RooAbsData const &data, std::string_view rangeName, std::stri
 /// \param[in] buffers Pass here an empty stack of `double` vectors, which will
 ///            be used as memory for the data if the memory in the dataset
 ///            object can't be used directly (e.g. because you used the range
-///            selection or the splitting by categories).
+///            selection or the splitting by categories). Otherwise, the
+///            spans point to the memory of the input dataset, which then has
+///            to outlive them.
 std::map<RooFit::Detail::DataKey, RooSpan<const double>>
 RooFit::BatchModeDataHelpers::getDataSpans(RooAbsData const &data, std::string const &rangeName,
                                            RooSimultaneous const *simPdf, bool skipZeroWeights,
@@ -252,7 +247,7 @@ RooFit::BatchModeDataHelpers::getDataSpans(RooAbsData const &data, std::string c
       auto const &toAdd = datas[iData];
       auto spans = getSingleDataSpans(
          *toAdd.second, RooHelpers::getRangeNameForSimComponent(rangeName, splitRange, toAdd.second->GetName()),
-         toAdd.first, buffers, skipZeroWeights && !isBinnedL[iData]);
+         toAdd.first, buffers, skipZeroWeights && !isBinnedL[iData], /*canReferenceData=*/!simPdf);
       for (auto const &item : spans) {
          dataSpans.insert(item);
       }
@@ -103,11 +103,21 @@
 #include <iomanip>
 #include <iostream>
 #include <limits>
+#include <mutex>
 #include <sstream>
 #include <sys/types.h>
 
 namespace {
 
+// The evaluation errors can be logged concurrently by nodes that the
+// RooFitDriver evaluates in parallel. The mutex is recursive because printing
+// the server values can trigger the evaluation of other nodes.
+std::recursive_mutex &evalErrorMutex()
+{
+  static std::recursive_mutex mutex;
+  return mutex;
+}
+
 // Internal helper RooAbsFunc that evalutes the scaled data-weighted average of
 // given RooAbsReal as a function of a single variable using the RooFitDriver.
 class ScaledDataWeightedAverage : public RooAbsFunc {
@@ -3537,6 +3547,8 @@ void RooAbsReal::logEvalError(const RooAbsReal* originator, const char* origName
     return ;
   }
 
+  std::lock_guard<std::recursive_mutex> lock(evalErrorMutex());
+
   if (_evalErrorMode==CountErrors) {
     _evalErrorCount++ ;
     return ;
@@ -3592,6 +3604,8 @@ void RooAbsReal::logEvalError(const char* message, const char* serverValueString
     return ;
   }
 
+  std::lock_guard<std::recursive_mutex> lock(evalErrorMutex());
+
   if (_evalErrorMode==CountErrors) {
     _evalErrorCount++ ;
     return ;
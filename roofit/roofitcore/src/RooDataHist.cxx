@@ -62,6 +62,7 @@ See RooAbsData::plotOn().
 #include "RooTrace.h"
 #include "RooFormulaVar.h"
 #include "RooFormula.h"
+#include "RooNumber.h"
 #include "RooUniformBinning.h"
 #include "RooSpan.h"
 
@@ -838,6 +839,8 @@ void RooDataHist::initialize(const char* binningName, bool fillTree)
 
   if (!fillTree) return ;
 
+  unshareArrays();
+
   // Fill TTree with bin center coordinates
   // Calculate plot bins of components from master index
 
@@ -878,6 +881,69 @@ void RooDataHist::checkBinBounds() const
 }
 
 
+////////////////////////////////////////////////////////////////////////////////
+/// The weights, the squared weights and the bin volumes are shared between a
+/// RooDataHist and its copies until one of them modifies its bin contents,
+/// such that many copies of the same template histograms, e.g. for parallel
+/// workers, don't need to hold their own payload.
+
+struct RooDataHist::SharedArrays {
+  double* wgt = nullptr;
+  double* sumw2 = nullptr;
+  double* binv = nullptr;
+
+  ~SharedArrays() {
+    delete[] wgt;
+    delete[] sumw2;
+    delete[] binv;
+  }
+};
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// Move the ownership of the shareable arrays to a SharedArrays object, if
+/// this was not done already.
+
+void RooDataHist::shareArrays() const
+{
+  if (_sharedArrays) return;
+  _sharedArrays = std::make_shared<SharedArrays>();
+  _sharedArrays->wgt = _wgt;
+  _sharedArrays->sumw2 = _sumw2;
+  _sharedArrays->binv = _binv;
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// Take back the exclusive ownership of the shared arrays, copying them if
+/// they are still used by other RooDataHists. Needs to be called before the
+/// arrays are modified or reallocated.
+
+void RooDataHist::unshareArrays()
+{
+  if (!_sharedArrays) return;
+
+  if (_sharedArrays.use_count() == 1) {
+    _sharedArrays->wgt = nullptr;
+    _sharedArrays->sumw2 = nullptr;
+    _sharedArrays->binv = nullptr;
+  } else {
+    double* wgt = nullptr;
+    double* sumw2 = nullptr;
+    double* binv = nullptr;
+    cloneArray(wgt, _wgt, _arrSize);
+    cloneArray(sumw2, _sumw2, _arrSize);
+    cloneArray(binv, _binv, _arrSize);
+    _wgt = wgt;
+    _sumw2 = sumw2;
+    _binv = binv;
+  }
+  _sharedArrays.reset();
+
+  registerWeightArraysToDataStore();
+}
+
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Copy constructor
 
@@ -886,11 +952,13 @@ RooDataHist::RooDataHist(const RooDataHist& other, const char* newname) :
 {
   // Allocate and initialize weight array
   assert(_arrSize == other._arrSize);
-  cloneArray(_wgt, other._wgt, other._arrSize);
+  other.shareArrays();
+  _sharedArrays = other._sharedArrays;
+  _wgt = other._wgt;
+  _sumw2 = other._sumw2;
+  _binv = other._binv;
   cloneArray(_errLo, other._errLo, other._arrSize);
   cloneArray(_errHi, other._errHi, other._arrSize);
-  cloneArray(_binv, other._binv, other._arrSize);
-  cloneArray(_sumw2, other._sumw2, other._arrSize);
 
   // Fill array of LValue pointers to variables
   for (const auto rvarg : _vars) {
@@ -963,6 +1031,12 @@ RooAbsData* RooDataHist::reduceEng(const RooArgSet& varSubset, const RooFormulaV
 
 RooDataHist::~RooDataHist()
 {
+   if (_sharedArrays) {
+      // The arrays are deleted by the last owner
+      _wgt = nullptr;
+      _sumw2 = nullptr;
+      _binv = nullptr;
+   }
    delete[] _wgt;
    delete[] _errLo;
    delete[] _errHi;
@@ -1379,6 +1453,73 @@ void RooDataHist::weights(double* output, RooSpan<double const> xVals, int intOr
 }
 
 
+////////////////////////////////////////////////////////////////////////////////
+/// A vectorized version of RooDataHist::weight() without interpolation, for
+/// histograms of any dimension without category observables. The bin indices
+/// are computed for all events at once with RooAbsBinning::binNumbers(), one
+/// observable after the other.
+/// \param[out] output An array of size `nEvents` for the weights.
+/// \param[in] coords Coordinates for each histogram variable, in the order of
+///                   the histogram variables. Spans with a single value are
+///                   used for all events.
+/// \param[in] nEvents Number of events to compute.
+/// \param[in] correctForBinSize Enable the inverse bin volume correction factor.
+/// \param[in] zeroOutOfRange Return zero for events with coordinates outside
+///                           of the histogram range.
+
+void RooDataHist::weights(double* output, std::vector<RooSpan<const double>> const& coords, std::size_t nEvents,
+                          bool correctForBinSize, bool zeroOutOfRange) const
+{
+  if (coords.size() != _vars.size()) {
+    throw std::invalid_argument(std::string("RooDataHist::weights(") + GetName()
+                                + "): need one coordinate span per histogram variable");
+  }
+
+  std::vector<int> binIndices(nEvents, 0);
+  std::vector<bool> inRange(zeroOutOfRange ? nEvents : 0, true);
+
+  const double epsRel = RooNumber::rangeEpsRel();
+  const double epsAbs = RooNumber::rangeEpsAbs();
+
+  for (std::size_t iVar = 0; iVar < _vars.size(); ++iVar) {
+    RooAbsBinning const* binning = _lvbins[iVar].get();
+    if (!binning) {
+      throw std::invalid_argument(std::string("RooDataHist::weights(") + GetName()
+                                  + "): category observables are not supported");
+    }
+    RooSpan<const double> const& x = coords[iVar];
+    const bool isScalar = x.size() < nEvents;
+
+    if (isScalar) {
+      const int idx = _idxMult[iVar] * binning->binNumber(x[0]);
+      for (auto& binIdx : binIndices) binIdx += idx;
+    } else {
+      binning->binNumbers(x.data(), binIndices.data(), nEvents, _idxMult[iVar]);
+    }
+
+    if (zeroOutOfRange) {
+      const double xlo = binning->lowBound();
+      const double xhi = binning->highBound();
+      for (std::size_t i = 0; i < nEvents; ++i) {
+        const double val = x[isScalar ? 0 : i];
+        const double eps = std::max(epsRel * std::abs(val), epsAbs);
+        inRange[i] = inRange[i] && val >= xlo - eps && val <= xhi + eps;
+      }
+    }
+  }
+
+  for (std::size_t i = 0; i < nEvents; ++i) {
+    const int binIdx = binIndices[i];
+    output[i] = correctForBinSize ? _wgt[binIdx] / _binv[binIdx] : _wgt[binIdx];
+  }
+  if (zeroOutOfRange) {
+    for (std::size_t i = 0; i < nEvents; ++i) {
+      if (!inRange[i]) output[i] = 0.;
+    }
+  }
+}
+
+
 ////////////////////////////////////////////////////////////////////////////////
 /// A faster version of RooDataHist::weight that assumes the passed arguments
 /// are aligned with the histogram variables.
@@ -1701,6 +1842,7 @@ double RooDataHist::interpolateDim(int iDim, double xval, size_t centralIdx, int
 void RooDataHist::add(const RooArgSet& row, double wgt, double sumw2)
 {
   checkInit() ;
+  unshareArrays();
 
   if ((sumw2 > 0. || wgt != 1.) && !_sumw2) {
     // Receiving a weighted entry. SumW2 != sumw from now on.
@@ -1729,6 +1871,7 @@ void RooDataHist::add(const RooArgSet& row, double wgt, double sumw2)
 void RooDataHist::set(const RooArgSet& row, double wgt, double wgtErrLo, double wgtErrHi)
 {
   checkInit() ;
+  unshareArrays();
 
   initializeAsymErrArrays();
 
@@ -1750,6 +1893,7 @@ void RooDataHist::set(const RooArgSet& row, double wgt, double wgtErrLo, double
 /// \param[in] wgtErr Error of the new bin content. If the weight need not have an error, use 0. or a negative number.
 void RooDataHist::set(std::size_t binNumber, double wgt, double wgtErr) {
   checkInit() ;
+  unshareArrays();
 
   if (wgtErr > 0. && !_sumw2) {
     // Receiving a weighted entry. Need to track sumw2 from now on:
@@ -2156,6 +2300,7 @@ void RooDataHist::reset()
   // WVE DO NOT CALL RooTreeData::reset() for binned
   // datasets as this will delete the bin definitions
 
+  unshareArrays();
   std::fill(_wgt, _wgt + _arrSize, 0.);
   delete[] _errLo; _errLo = nullptr;
   delete[] _errHi; _errHi = nullptr;
@@ -2328,6 +2473,9 @@ void RooDataHist::printDataHistogram(ostream& os, RooRealVar* obs) const
 void RooDataHist::Streamer(TBuffer &R__b) {
   if (R__b.IsReading()) {
 
+    // Reading reallocates the arrays
+    unshareArrays();
+
     UInt_t R__s, R__c;
     Version_t R__v = R__b.ReadVersion(&R__s, &R__c);
 
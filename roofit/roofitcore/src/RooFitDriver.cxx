@@ -24,6 +24,10 @@ computations take place in the RooBatchCompute library and can be carried off
 by either the CPU or a CUDA-supporting GPU. The RooFitDriver class takes care
 of data transfers. An instance of this class is created every time
 RooAbsPdf::fitTo() is called and gets destroyed when the fitting ends.
+
+In CUDA mode, the observables are copied to the GPU only once per dataset, and
+the results of nodes that depend only on observables are computed once and kept
+on the device for all the evaluations during the minimization.
 **/
 
 #include "RooFitDriver.h"
@@ -43,6 +47,13 @@ RooAbsPdf::fitTo() is called and gets destroyed when the fitting ends.
 
 #include <TList.h>
 
+#ifdef R__USE_IMT
+#include <ROOT/TSeq.hxx>
+#include <ROOT/TThreadExecutor.hxx>
+#include <TROOT.h>
+#endif
+
+#include <algorithm>
 #include <iomanip>
 #include <numeric>
 #include <thread>
@@ -98,7 +109,7 @@ struct NodeInfo {
    /// if they are no longer needed.
    void decrementRemainingClients()
    {
-      if (--remClients == 0) {
+      if (--remClients == 0 && !isResident) {
          delete buffer;
          buffer = nullptr;
       }
@@ -120,9 +131,15 @@ struct NodeInfo {
    bool fromDataset = false;
    bool isVariable = false;
    bool isDirty = true;
+   bool hasScalarResult = false; ///< If scalarBuffer holds the result of a previous evaluation
    bool isCategory = false;
    bool hasLogged = false;
+   /// If the node only depends on observables from the dataset, such that its
+   /// result can be kept in the buffer across evaluations in CUDA mode.
+   bool isResident = false;
+   bool hasResidentResult = false; ///< If the buffer of a resident node holds its result
    std::size_t outputSize = 1;
+   std::size_t depth = 0; ///< Length of the longest path to a leaf of the computation graph
    std::size_t lastSetValCount = std::numeric_limits<std::size_t>::max();
    double scalarBuffer = 0.0;
    std::vector<NodeInfo *> serverInfos;
@@ -130,6 +147,7 @@ struct NodeInfo {
 
    ~NodeInfo()
    {
+      delete buffer;
       if (event)
          RooBatchCompute::dispatchCUDA->deleteCudaEvent(event);
       if (stream)
@@ -186,13 +204,21 @@ RooFitDriver::RooFitDriver(const RooAbsReal &absReal, RooFit::BatchModeOption ba
 
    for (NodeInfo &info : _nodes) {
       info.serverInfos.reserve(info.absArg->servers().size());
+      std::size_t depth = 0;
       for (RooAbsArg *server : info.absArg->servers()) {
          if (server->isValueServer(*info.absArg)) {
             auto *serverInfo = nodeInfos.at(server);
             info.serverInfos.emplace_back(serverInfo);
             serverInfo->clientInfos.emplace_back(&info);
+            // The nodes are sorted topologically, so the depth of the servers is already known
+            depth = std::max(depth, serverInfo->depth + 1);
          }
       }
+      info.depth = depth;
+      if (_nodesByDepth.size() <= depth) {
+         _nodesByDepth.resize(depth + 1);
+      }
+      _nodesByDepth[depth].emplace_back(&info);
    }
 
    syncDataTokens();
@@ -247,6 +273,7 @@ void RooFitDriver::setData(DataSpansMap const &dataSpans)
          delete info.buffer;
          info.buffer = nullptr;
       }
+      info.hasResidentResult = false;
       auto found = dataSpans.find(info.absArg->namePtr());
       if (found != dataSpans.end()) {
          info.absArg->setDataToken(iNode);
@@ -258,6 +285,7 @@ void RooFitDriver::setData(DataSpansMap const &dataSpans)
          info.fromDataset = false;
          info.isDirty = true;
       }
+      info.hasScalarResult = false;
       ++iNode;
    }
 
@@ -280,9 +308,23 @@ void RooFitDriver::setData(DataSpansMap const &dataSpans)
    if (_batchMode != RooFit::BatchModeOption::Cuda)
       return;
 
-   // copy observable data to the GPU
-   // TODO: use separate buffers here
-   _cudaMemDataset = static_cast<double *>(RooBatchCompute::dispatchCUDA->cudaMalloc(totalSize * sizeof(double)));
+   // Nodes that only depend on the observables are evaluated once, and their
+   // results stay on the device for all the following evaluations with the
+   // same data. The nodes are sorted topologically, so the servers come first.
+   for (auto &info : _nodes) {
+      info.isResident = !info.fromDataset && !info.isVariable && !info.serverInfos.empty() &&
+                        std::all_of(info.serverInfos.begin(), info.serverInfos.end(), [](NodeInfo const *serverInfo) {
+                           return serverInfo->fromDataset || serverInfo->isResident;
+                        });
+   }
+
+   // copy observable data to the GPU, reusing the device memory of the
+   // previous dataset if it is large enough
+   if (totalSize > _cudaMemDatasetSize) {
+      RooBatchCompute::dispatchCUDA->cudaFree(_cudaMemDataset);
+      _cudaMemDataset = static_cast<double *>(RooBatchCompute::dispatchCUDA->cudaMalloc(totalSize * sizeof(double)));
+      _cudaMemDatasetSize = totalSize;
+   }
    size_t idx = 0;
    for (auto &info : _nodes) {
       if (!info.fromDataset)
@@ -390,6 +432,31 @@ void RooFitDriver::setClientsDirty(NodeInfo &nodeInfo)
    }
 }
 
+/// Evaluates a dirty node and flags its clients dirty. The previous result of
+/// scalar nodes is kept, and if the new result is identical the clients are not
+/// flagged. Like this, a parameter change only triggers the re-evaluation of
+/// the part of the graph whose values actually change, e.g. not the clients of
+/// a function that is flat or saturated in the changed parameter.
+void RooFitDriver::processNode(NodeInfo &nodeInfo)
+{
+   const double oldValue = nodeInfo.scalarBuffer;
+   computeCPUNode(nodeInfo.absArg, nodeInfo);
+   finishNode(nodeInfo, oldValue);
+}
+
+/// Marks a node that was just evaluated clean, and its clients dirty if its
+/// result changed with respect to the given old value.
+void RooFitDriver::finishNode(NodeInfo &nodeInfo, double oldValue)
+{
+   nodeInfo.isDirty = false;
+   // Comparing the full output of vector nodes would cost about as much as
+   // evaluating the clients, so they always propagate.
+   if (!nodeInfo.isScalar() || nodeInfo.scalarBuffer != oldValue || !nodeInfo.hasScalarResult) {
+      setClientsDirty(nodeInfo);
+   }
+   nodeInfo.hasScalarResult = nodeInfo.isScalar();
+}
+
 /// Returns the value of the top node in the computation graph
 double RooFitDriver::getVal()
 {
@@ -399,15 +466,19 @@ double RooFitDriver::getVal()
       return getValHeterogeneous();
    }
 
+#ifdef R__USE_IMT
+   if (ROOT::IsImplicitMTEnabled()) {
+      return getValConcurrent();
+   }
+#endif
+
    for (auto &nodeInfo : _nodes) {
       if (!nodeInfo.fromDataset) {
          if (nodeInfo.isVariable) {
             processVariable(nodeInfo);
          } else {
             if (nodeInfo.isDirty) {
-               setClientsDirty(nodeInfo);
-               computeCPUNode(nodeInfo.absArg, nodeInfo);
-               nodeInfo.isDirty = false;
+               processNode(nodeInfo);
             }
          }
       }
@@ -417,15 +488,87 @@ double RooFitDriver::getVal()
    return _dataMapCPU.at(&topNode())[0];
 }
 
+#ifdef R__USE_IMT
+/// Returns the value of the top node in the computation graph, evaluating the
+/// independent nodes of the same depth concurrently with the implicit
+/// multi-threading pool. Like this, the channels of a large simultaneous fit
+/// are evaluated in parallel. Only nodes that compute their output from the
+/// data map alone, which is what canComputeBatchWithCuda() promises, are run
+/// concurrently. The other nodes might evaluate their servers in scalar mode,
+/// so they are evaluated sequentially.
+double RooFitDriver::getValConcurrent()
+{
+   std::vector<NodeInfo *> concurrentNodes;
+   std::vector<double> oldValues;
+
+   for (auto const &nodesAtDepth : _nodesByDepth) {
+      concurrentNodes.clear();
+      for (NodeInfo *nodeInfo : nodesAtDepth) {
+         if (nodeInfo->fromDataset) {
+            continue;
+         }
+         if (nodeInfo->isVariable) {
+            processVariable(*nodeInfo);
+         } else if (nodeInfo->isDirty) {
+            if (nodeInfo->absArg->canComputeBatchWithCuda()) {
+               concurrentNodes.push_back(nodeInfo);
+            } else {
+               processNode(*nodeInfo);
+            }
+         }
+      }
+
+      if (concurrentNodes.size() < 2) {
+         for (NodeInfo *nodeInfo : concurrentNodes) {
+            processNode(*nodeInfo);
+         }
+         continue;
+      }
+
+      // The buffer manager is not thread safe, so the buffers are created
+      // upfront. The dirty flags of the clients are also only set afterwards,
+      // as several nodes can share clients.
+      oldValues.resize(concurrentNodes.size());
+      for (std::size_t i = 0; i < concurrentNodes.size(); ++i) {
+         NodeInfo &info = *concurrentNodes[i];
+         oldValues[i] = info.scalarBuffer;
+         if (!info.isScalar() && !info.buffer) {
+            info.buffer = _bufferManager.makeCpuBuffer(info.outputSize);
+         }
+      }
+      ROOT::TThreadExecutor executor;
+      executor.Foreach(
+         [&](std::size_t i) { computeCPUNode(concurrentNodes[i]->absArg, *concurrentNodes[i]); },
+         ROOT::TSeq<std::size_t>(concurrentNodes.size()));
+      for (std::size_t i = 0; i < concurrentNodes.size(); ++i) {
+         finishNode(*concurrentNodes[i], oldValues[i]);
+      }
+   }
+
+   return _dataMapCPU.at(&topNode())[0];
+}
+#endif
+
 /// Returns the value of the top node in the computation graph
 double RooFitDriver::getValHeterogeneous()
 {
    for (auto &info : _nodes) {
       info.remClients = info.clientInfos.size();
       info.remServers = info.serverInfos.size();
-      if (info.buffer)
+      if (!info.hasResidentResult) {
          delete info.buffer;
-      info.buffer = nullptr;
+         info.buffer = nullptr;
+      }
+   }
+
+   // the resident nodes that were evaluated before are already finished
+   for (auto &info : _nodes) {
+      if (info.hasResidentResult) {
+         info.remServers = -2;
+         for (auto *infoClient : info.clientInfos) {
+            --infoClient->remServers;
+         }
+      }
    }
 
    // find initial GPU nodes and assign them to GPU
@@ -487,6 +630,11 @@ double RooFitDriver::getValHeterogeneous()
       }
    }
 
+   // all nodes are finished now, so the results of the resident nodes are valid
+   for (auto &info : _nodes) {
+      info.hasResidentResult = info.isResident;
+   }
+
    // return the final value
    return _dataMapCPU.at(&topNode())[0];
 }
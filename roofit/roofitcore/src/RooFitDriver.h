@@ -65,7 +65,10 @@ private:
 
    void processVariable(NodeInfo &nodeInfo);
    void setClientsDirty(NodeInfo &nodeInfo);
+   void processNode(NodeInfo &nodeInfo);
+   void finishNode(NodeInfo &nodeInfo, double oldValue);
    double getValHeterogeneous();
+   double getValConcurrent();
    void markGPUNodes();
    void assignToGPU(NodeInfo &info);
    void computeCPUNode(const RooAbsArg *node, NodeInfo &info);
@@ -81,6 +84,7 @@ private:
    const RooFit::BatchModeOption _batchMode = RooFit::BatchModeOption::Off;
    int _getValInvocations = 0;
    double *_cudaMemDataset = nullptr;
+   std::size_t _cudaMemDatasetSize = 0; // capacity of _cudaMemDataset in number of doubles
 
    // used for preserving static info about the computation graph
    RooFit::Detail::DataMap _dataMapCPU;
@@ -88,6 +92,8 @@ private:
 
    // the ordered computation graph
    std::vector<NodeInfo> _nodes;
+   // the nodes grouped by their depth in the graph, the nodes in one group don't depend on each other
+   std::vector<std::vector<NodeInfo *>> _nodesByDepth;
 
    // used for preserving resources
    std::stack<std::vector<double>> _vectorBuffers;
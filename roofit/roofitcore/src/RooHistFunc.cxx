@@ -207,6 +207,7 @@ void RooHistFunc::computeBatch(cudaStream_t*, double* output, size_t size, RooFi
   }
 
   std::vector<RooSpan<const double>> inputValues;
+  bool allReal = true;
   for (const auto& obs : _depList) {
     auto realObs = dynamic_cast<const RooAbsReal*>(obs);
     if (realObs) {
@@ -214,9 +215,16 @@ void RooHistFunc::computeBatch(cudaStream_t*, double* output, size_t size, RooFi
       inputValues.push_back(std::move(inputs));
     } else {
       inputValues.emplace_back();
+      allReal = false;
     }
   }
 
+  // Without interpolation, compute the bin indices for all events at once
+  if (_intOrder == 0 && allReal) {
+    _dataHist->weights(output, inputValues, size, false, true);
+    return;
+  }
+
   for (std::size_t i = 0; i < size; ++i) {
     bool skip = false;
 
@@ -197,14 +197,26 @@ RooDataHist* RooHistPdf::cloneAndOwnDataHist(const char* newname) {
 
 void RooHistPdf::computeBatch(cudaStream_t*, double* output, size_t nEvents, RooFit::Detail::DataMap const& dataMap) const {
 
-  // For interpolation and histograms of higher dimension, use base function
-  if(_pdfObsList.size() > 1) {
+  if(_pdfObsList.size() == 1) {
+      auto xVals = dataMap.at(_pdfObsList[0]);
+      _dataHist->weights(output, xVals, _intOrder, true, _cdfBoundaries);
+      return;
+  }
+
+  // For interpolation and histograms with categories, use base function
+  std::vector<RooSpan<const double>> inputValues;
+  for (const auto obs : _pdfObsList) {
+    if (_intOrder != 0 || !dynamic_cast<RooAbsReal const*>(obs)) {
       RooAbsReal::computeBatch(nullptr, output, nEvents, dataMap);
       return;
+    }
+    inputValues.push_back(dataMap.at(obs));
   }
 
-  auto xVals = dataMap.at(_pdfObsList[0]);
-  _dataHist->weights(output, xVals, _intOrder, true, _cdfBoundaries);
+  _dataHist->weights(output, inputValues, nEvents, !_unitNorm, true);
+  for (std::size_t i = 0; i < nEvents; ++i) {
+    output[i] = std::max(output[i], 0.0);
+  }
 }
 
 
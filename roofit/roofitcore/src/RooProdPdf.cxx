@@ -2349,6 +2349,26 @@ public:
       _prodPdf->calculateBatch(*_cache, stream, output, nEvents, dataMap);
    }
 
+   void translate(RooFit::Detail::CodeSquashContext &ctx) const override
+   {
+      // Same structure as RooProdPdf::calculateBatch: either the ratio of the
+      // rearranged numerator and denominator, or the product of the parts.
+      if (_cache->_isRearranged) {
+         ctx.addResult(this, "(" + ctx.getResult(*_cache->_rearrangedNum) + " / " +
+                                ctx.getResult(*_cache->_rearrangedDen) + ")");
+         return;
+      }
+      std::string result = "(";
+      for (const RooAbsArg *part : _cache->_partList) {
+         result += ctx.getResult(*part) + "*";
+      }
+      if (result.size() == 1) {
+         result += "1.0*";
+      }
+      result.back() = ')';
+      ctx.addResult(this, result);
+   }
+
    ExtendMode extendMode() const override { return _prodPdf->extendMode(); }
    double expectedEvents(const RooArgSet * /*nset*/) const override { return _prodPdf->expectedEvents(&_normSet); }
    std::unique_ptr<RooAbsReal> createExpectedEventsFunc(const RooArgSet * /*nset*/) const override
@@ -49,6 +49,7 @@ integration is performed in the various implementations of the RooAbsIntegrator
 
 #include "TClass.h"
 
+#include <algorithm>
 #include <iostream>
 #include <memory>
 
@@ -214,6 +215,9 @@ void fillAnIntOKDepList(RooAbsReal const &function, RooArgSet const &intDepList,
    }
 }
 
+/// Number of recent numeric integration results that are kept per integral
+constexpr std::size_t nRecentNumInts = 8;
+
 } // namespace
 
 
@@ -702,6 +706,7 @@ bool RooRealIntegral::initNumIntegrator() const
   // Create appropriate numeric integrator using factory
   bool isBinned = _function->isBinnedDistribution(_intList) ;
   _numIntEngine.reset(RooNumIntFactory::instance().createIntegrator(*_numIntegrand,*_iconfig,0,isBinned));
+  _recentNumInts.clear();
 
   if(_numIntEngine == nullptr || !_numIntEngine->isValid()) {
     coutE(Integration) << ClassName() << "::" << GetName() << ": failed to create valid integrator." << std::endl;
@@ -843,14 +848,25 @@ double RooRealIntegral::evaluate() const
   case Hybrid:
     {
       // Cache numeric integrals in >1d expensive object cache
+      const bool cacheNumInt = (_cacheNum && !_intList.empty()) || _intList.getSize()>=_cacheAllNDim ;
       RooDouble* cacheVal(0) ;
-      if ((_cacheNum && !_intList.empty()) || _intList.getSize()>=_cacheAllNDim) {
+      if (cacheNumInt) {
         cacheVal = (RooDouble*) expensiveObjectCache().retrieveObject(GetName(),RooDouble::Class(),parameters())  ;
       }
 
+      // The expensive object cache only knows the last result. During a fit,
+      // the numerical gradient varies one parameter at a time and goes back
+      // to previous parameter points, so a few recent results are kept too.
+      // The component selection is not part of the key, so this requires all
+      // components to be selected.
+      const bool cacheRecent = cacheNumInt && (_globalSelectComp || !_respectCompSelect) ;
+      const double* recentVal = (!cacheVal && cacheRecent) ? findRecentNumInt() : nullptr ;
+
       if (cacheVal) {
         retVal = *cacheVal ;
    // cout << "using cached value of integral" << GetName() << std::endl ;
+      } else if (recentVal) {
+        retVal = *recentVal ;
       } else {
 
 
@@ -887,6 +903,9 @@ double RooRealIntegral::evaluate() const
           expensiveObjectCache().registerObject(_function->GetName(),GetName(),*val,parameters())  ;
           //     cout << "### caching value of integral" << GetName() << " in " << &expensiveObjectCache() << std::endl ;
         }
+        if (cacheRecent) {
+          addRecentNumInt(retVal) ;
+        }
 
       }
       break ;
@@ -1035,6 +1054,7 @@ bool RooRealIntegral::redirectServersHook(const RooAbsCollection& newServerList,
 
   // Delete parameters cache if we have one
   _params.reset();
+  _recentNumInts.clear();
 
   return RooAbsReal::redirectServersHook(newServerList, mustReplaceAll, nameChange, isRecursive);
 }
@@ -1058,6 +1078,57 @@ const RooArgSet& RooRealIntegral::parameters() const
 }
 
 
+////////////////////////////////////////////////////////////////////////////////
+/// Fill the current values of the parameters into the key of the recent
+/// numeric integration results.
+
+void RooRealIntegral::fillRecentNumIntKey() const
+{
+  _recentNumIntKey.clear() ;
+  for (const auto param : parameters()) {
+    if (auto real = dynamic_cast<RooAbsReal*>(param)) {
+      _recentNumIntKey.push_back(real->getVal()) ;
+    } else if (auto cat = dynamic_cast<RooAbsCategory*>(param)) {
+      _recentNumIntKey.push_back(cat->getCurrentIndex()) ;
+    }
+  }
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return a pointer to the recent numeric integration result for the current
+/// parameter values, or a nullptr if there is none.
+
+const double* RooRealIntegral::findRecentNumInt() const
+{
+  fillRecentNumIntKey() ;
+  for (auto const& entry : _recentNumInts) {
+    // The last element of an entry is the integral value
+    if (std::equal(_recentNumIntKey.begin(), _recentNumIntKey.end(), entry.begin(), entry.end() - 1)) {
+      return &entry.back() ;
+    }
+  }
+  return nullptr ;
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// Store a numeric integration result for the parameter values of the last
+/// findRecentNumInt() call, replacing the oldest result if the cache is full.
+
+void RooRealIntegral::addRecentNumInt(double value) const
+{
+  if (_recentNumInts.size() < nRecentNumInts) {
+    _recentNumInts.emplace_back() ;
+  } else {
+    std::rotate(_recentNumInts.begin(), _recentNumInts.begin() + 1, _recentNumInts.end()) ;
+  }
+  auto& entry = _recentNumInts.back() ;
+  entry.assign(_recentNumIntKey.begin(), _recentNumIntKey.end()) ;
+  entry.push_back(value) ;
+}
+
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Check if current value is valid
 
@@ -52,6 +52,7 @@ to the fractions of the various functions. **This requires setting the last argu
 #include "RooRealVar.h"
 #include "RooMsgService.h"
 #include "RooNaNPacker.h"
+#include "RooBatchCompute.h"
 
 #include <TError.h>
 
@@ -272,28 +273,19 @@ double RooRealSumPdf::evaluate() const
 
 
 void RooRealSumPdf::computeBatch(cudaStream_t* /*stream*/, double* output, size_t nEvents, RooFit::Detail::DataMap const& dataMap) const {
-  // Do running sum of coef/func pairs, calculate lastCoef.
-  for (unsigned int j = 0; j < nEvents; ++j) {
-    output[j] = 0.0;
-  }
-
+  // Collect the coef/func pairs, calculate lastCoef.
+  RooBatchCompute::VarVector funcs;
+  RooBatchCompute::ArgVector coefs;
   double sumCoeff = 0.;
+  double nanPayload = 0.;
   for (unsigned int i = 0; i < _funcList.size(); ++i) {
     const auto func = static_cast<RooAbsReal*>(&_funcList[i]);
     const auto coef = static_cast<RooAbsReal*>(i < _coefList.size() ? &_coefList[i] : nullptr);
     const double coefVal = coef != nullptr ? dataMap.at(coef)[0] : (1. - sumCoeff);
 
     if (func->isSelectedComp()) {
-      auto funcValues = dataMap.at(func);
-      if(funcValues.size() == 1) {
-        for (unsigned int j = 0; j < nEvents; ++j) {
-          output[j] += funcValues[0] * coefVal;
-        }
-      } else {
-        for (unsigned int j = 0; j < nEvents; ++j) {
-          output[j] += funcValues[j] * coefVal;
-        }
-      }
+      funcs.push_back(dataMap.at(func));
+      coefs.push_back(coefVal);
     }
 
     // Warn about degeneration of last coefficient
@@ -304,19 +296,30 @@ void RooRealSumPdf::computeBatch(cudaStream_t* /*stream*/, double* output, size_
             << sumCoeff << ". This means that the PDF is not properly normalised. If the PDF was meant to be extended, provide as many coefficients as functions." << endl ;
         _haveWarned = true;
       }
-      // Signal that we are in an undefined region by handing back one NaN.
-      output[0] = RooNaNPacker::packFloatIntoNaN(100.f * (coefVal < 0. ? -coefVal : coefVal - 1.));
+      nanPayload = 100. * (coefVal < 0. ? -coefVal : coefVal - 1.);
     }
 
     sumCoeff += coefVal;
   }
 
+  // The weighted sum is the same computation as for the RooAddPdf
+  if (funcs.empty()) {
+    std::fill(output, output + nEvents, 0.0);
+  } else {
+    RooBatchCompute::dispatchCPU->compute(nullptr, RooBatchCompute::AddPdf, output, nEvents, funcs, coefs);
+  }
+
   // Introduce floor if so requested
   if (_doFloor || _doFloorGlobal) {
     for (unsigned int j = 0; j < nEvents; ++j) {
-      output[j] += std::max(0., output[j]);
+      output[j] = std::max(0., output[j]);
     }
   }
+
+  // Signal that we are in an undefined region by handing back one NaN.
+  if (nanPayload > 0.) {
+    output[0] = RooNaNPacker::packFloatIntoNaN(nanPayload);
+  }
 }
 
 void RooRealSumPdf::translateImpl(RooFit::Detail::CodeSquashContext &ctx, RooAbsArg const *klass,
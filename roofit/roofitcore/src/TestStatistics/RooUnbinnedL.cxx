@@ -34,6 +34,12 @@ In extended mode, a
 #include "RooNaNPacker.h"
 #include "../RooFitDriver.h"
 
+#ifdef R__USE_IMT
+#include "ROOT/TSeq.hxx"
+#include "ROOT/TThreadExecutor.hxx"
+#include "TROOT.h"
+#endif
+
 namespace RooFit {
 namespace TestStatistics {
 
@@ -126,6 +132,72 @@ RooNLLVar::ComputeResult computeBatchFunc(std::span<const double> probas, RooAbs
    return {kahanProb, kahanWeight.Sum()};
 }
 
+#ifdef R__USE_IMT
+/// Shards with fewer events are not worth a task.
+constexpr std::size_t minEventsPerShard = 16384;
+
+/// Thread-based variant of computeBatchFunc. The events are split in shards
+/// that are summed concurrently on the implicit multi-threading pool, using
+/// the event weights read once from the dataset, since the RooAbsData can't
+/// be accessed concurrently. The Kahan-summed partial results are combined in
+/// shard order, so the result doesn't depend on the scheduling.
+RooNLLVar::ComputeResult computeBatchFuncSharded(std::span<const double> probas, RooAbsData *dataClone, bool weightSq,
+                                                 std::size_t firstEvent, std::size_t lastEvent)
+{
+   const std::size_t nEvents = lastEvent - firstEvent;
+   // Empty spans mean that the data is unweighted
+   RooSpan<const double> weights = dataClone->getWeightBatch(firstEvent, nEvents, false);
+   RooSpan<const double> weightsSq = weightSq ? dataClone->getWeightBatch(firstEvent, nEvents, true) : weights;
+
+   struct ShardResult {
+      ROOT::Math::KahanSum<double> kahanWeight;
+      ROOT::Math::KahanSum<double> kahanProb;
+      RooNaNPacker packedNaN{0.f};
+   };
+
+   ROOT::TThreadExecutor executor;
+   const std::size_t nShards = std::min<std::size_t>(executor.GetPoolSize(), nEvents / minEventsPerShard);
+   std::vector<ShardResult> shards(nShards);
+
+   executor.Foreach(
+      [&](std::size_t iShard) {
+         ShardResult &shard = shards[iShard];
+         const std::size_t begin = iShard * nEvents / nShards;
+         const std::size_t end = (iShard + 1) * nEvents / nShards;
+         for (std::size_t i = begin; i < end; ++i) {
+            double weight = weights.empty() ? 1.0 : weights[i];
+            if (0. == weight * weight)
+               continue;
+            if (weightSq)
+               weight = weightsSq.empty() ? 1.0 : weightsSq[i];
+
+            const double term = -weight * std::log(probas[firstEvent + i]);
+
+            shard.kahanWeight.Add(weight);
+            shard.kahanProb.Add(term);
+            shard.packedNaN.accumulate(term);
+         }
+      },
+      ROOT::TSeq<std::size_t>(nShards));
+
+   ROOT::Math::KahanSum<double> kahanWeight;
+   ROOT::Math::KahanSum<double> kahanProb;
+   RooNaNPacker packedNaN(0.f);
+   for (ShardResult const &shard : shards) {
+      kahanWeight += shard.kahanWeight;
+      kahanProb += shard.kahanProb;
+      packedNaN += shard.packedNaN.getPayload();
+   }
+
+   if (packedNaN.getPayload() != 0.) {
+      // Some events with evaluation errors. Return "badness" of errors.
+      return {ROOT::Math::KahanSum<double>{packedNaN.getNaNWithPayload()}, kahanWeight.Sum()};
+   }
+
+   return {kahanProb, kahanWeight.Sum()};
+}
+#endif
+
 } // namespace
 
 //////////////////////////////////////////////////////////////////////////////////
@@ -153,8 +225,18 @@ RooUnbinnedL::evaluatePartition(Section events, std::size_t /*components_begin*/
       // Here, we have a memory allocation that should be avoided when this
       // code needs to be optimized.
       std::vector<double> probas = driver_->getValues();
-      std::tie(result, sumWeight) =
-         computeBatchFunc(probas, data_.get(), apply_weight_squared, 1, events.begin(N_events_), events.end(N_events_));
+      const std::size_t firstEvent = events.begin(N_events_);
+      const std::size_t lastEvent = events.end(N_events_);
+#ifdef R__USE_IMT
+      if (ROOT::IsImplicitMTEnabled() && lastEvent - firstEvent >= 2 * minEventsPerShard) {
+         std::tie(result, sumWeight) =
+            computeBatchFuncSharded(probas, data_.get(), apply_weight_squared, firstEvent, lastEvent);
+      } else
+#endif
+      {
+         std::tie(result, sumWeight) =
+            computeBatchFunc(probas, data_.get(), apply_weight_squared, 1, firstEvent, lastEvent);
+      }
    } else {
       data_->store()->recalculateCache(nullptr, events.begin(N_events_), events.end(N_events_), 1, true);
       std::tie(result, sumWeight) =
@@ -26,6 +26,7 @@
 #include <RooFit/TestStatistics/RooRealL.h>
 
 #include "Math/Util.h" // KahanSum
+#include "TROOT.h"        // EnableImplicitMT
 
 #include <stdexcept> // runtime_error
 
@@ -112,6 +113,28 @@ TEST_F(LikelihoodSerialTest, UnbinnedGaussian1D)
    EXPECT_EQ(nll0, nll1.Sum());
 }
 
+#ifdef R__USE_IMT
+/// With implicit multi-threading, the batch mode RooUnbinnedL sums the events
+/// in shards on several threads. Only the summation order may differ.
+TEST_F(LikelihoodSerialTest, UnbinnedGaussian1DShardedBatchMode)
+{
+   std::tie(nll, pdf, data, values) = generate_1D_gaussian_pdf_nll(w, 100000);
+   using RooFit::TestStatistics::RooAbsL;
+   using RooFit::TestStatistics::RooUnbinnedL;
+   RooAbsL::Section allEvents{0, 1};
+
+   RooUnbinnedL likelihoodSequential{pdf, data.get(), RooAbsL::Extended::Auto, RooFit::BatchModeOption::Cpu};
+   const double nll0 = likelihoodSequential.evaluatePartition(allEvents, 0, 0).Sum();
+
+   ROOT::EnableImplicitMT(4);
+   RooUnbinnedL likelihoodSharded{pdf, data.get(), RooAbsL::Extended::Auto, RooFit::BatchModeOption::Cpu};
+   const double nll1 = likelihoodSharded.evaluatePartition(allEvents, 0, 0).Sum();
+   ROOT::DisableImplicitMT();
+
+   EXPECT_NEAR(nll0, nll1, 1e-10 * std::abs(nll0));
+}
+#endif
+
 TEST_F(LikelihoodSerialTest, UnbinnedGaussianND)
 {
    unsigned int N = 4;
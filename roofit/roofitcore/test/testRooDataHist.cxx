@@ -760,6 +760,50 @@ INSTANTIATE_TEST_SUITE_P(RooDataHist, WeightsTest,
                             return ss.str();
                          });
 
+// Test that the vectorized bin lookup without interpolation gives the same
+// weights as the scalar evaluation for two-dimensional histograms.
+TEST(RooDataHist, VectorizedWeights2D)
+{
+   RooHelpers::LocalChangeMsgLevel chmsglvl{RooFit::WARNING, 0u, RooFit::Fitting, true};
+
+   std::vector<double> yBoundaries{0., 0.1, 0.3, 0.6, 1.};
+   TH2D h2("h2", "h2", 20, -1., 1., yBoundaries.size() - 1, yBoundaries.data());
+   for (int i = 0; i < 10000; ++i) {
+      h2.Fill(RooRandom::uniform() * 2. - 1., RooRandom::uniform());
+   }
+
+   RooRealVar x("x", "x", 0, -1., 1.);
+   RooRealVar y("y", "y", 0.5, 0., 1.);
+   RooDataHist dh{"dh", "dh", {x, y}, &h2};
+
+   RooHistFunc histFunc{"histFunc", "histFunc", {x, y}, dh};
+   RooHistPdf histPdf{"histPdf", "histPdf", {x, y}, dh};
+
+   std::size_t nVals = 1000;
+   RooDataSet data{"data", "data", {x, y}};
+   for (std::size_t i = 0; i < nVals; ++i) {
+      x.setVal(RooRandom::uniform() * 2. - 1.);
+      y.setVal(RooRandom::uniform());
+      data.add({x, y});
+   }
+
+   for (RooAbsReal *absReal : {static_cast<RooAbsReal *>(&histFunc), static_cast<RooAbsReal *>(&histPdf)}) {
+      std::vector<double> weightsGetVal(nVals);
+      for (std::size_t i = 0; i < nVals; ++i) {
+         RooArgSet const *row = data.get(i);
+         x.setVal(row->getRealValue("x"));
+         y.setVal(row->getRealValue("y"));
+         weightsGetVal[i] = absReal->getVal({x, y});
+      }
+
+      auto weightsGetValues = absReal->getValues(data);
+
+      for (std::size_t i = 0; i < nVals; ++i) {
+         EXPECT_NEAR(weightsGetVal[i], weightsGetValues[i], 1e-6) << absReal->GetName();
+      }
+   }
+}
+
 // Test that splitting a RooDataSet by index category does preserve the sum of
 // weights squared and weight errors.
 TEST(RooDataHist, SplitDataHistWithSumW2)
@@ -787,3 +831,33 @@ TEST(RooDataHist, SplitDataHistWithSumW2)
    EXPECT_DOUBLE_EQ(data2.weightSquared(), data1.weightSquared());
    EXPECT_DOUBLE_EQ(data2.weightError(), data1.weightError());
 }
+
+// Copies of a RooDataHist share the bin contents until one of them is
+// modified, which must not affect the others.
+TEST(RooDataHist, CopiesAreIndependent)
+{
+   RooRealVar x{"x", "x", 0, 0, 10};
+   x.setBins(10);
+
+   RooDataHist data1{"data", "data", x};
+   for (int i = 0; i < 10; ++i) {
+      data1.set(i, i + 1.0, 0.5);
+   }
+
+   RooDataHist data2{data1};
+   RooDataHist data3{data1};
+
+   EXPECT_EQ(data2.weightArray(), data1.weightArray());
+
+   data2.set(3, 100., 10.);
+   data3.reset();
+
+   EXPECT_NE(data2.weightArray(), data1.weightArray());
+   for (int i = 0; i < 10; ++i) {
+      EXPECT_DOUBLE_EQ(data1.weight(i), i + 1.0);
+      EXPECT_DOUBLE_EQ(data2.weight(i), i == 3 ? 100. : i + 1.0);
+      EXPECT_DOUBLE_EQ(data3.weight(i), 0.);
+   }
+   data1.get(3);
+   EXPECT_DOUBLE_EQ(data1.weightSquared(), 0.25);
+}
@@ -0,0 +1,87 @@
+// Tests for the RooFitDriver
+
+#include "../src/RooFitDriver.h"
+
+#include <RooAbsPdf.h>
+#include <RooDataSet.h>
+#include <RooFit/Detail/NormalizationHelpers.h>
+#include <RooHelpers.h>
+#include <RooRealVar.h>
+#include <RooWorkspace.h>
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <vector>
+
+namespace {
+
+/// Compares the values computed by the driver with the values of the pdf
+/// evaluated event by event.
+void checkValues(ROOT::Experimental::RooFitDriver &driver, RooAbsPdf &pdf, RooRealVar &x, RooDataSet const &data,
+                 const char *message)
+{
+   const std::vector<double> values = driver.getValues();
+   ASSERT_EQ(values.size(), static_cast<std::size_t>(data.numEntries())) << message;
+   for (int i = 0; i < data.numEntries(); ++i) {
+      x.setVal(static_cast<RooRealVar const &>((*data.get(i))[x.GetName()]).getVal());
+      EXPECT_NEAR(values[i], pdf.getVal(x), 1e-10) << message << ", event " << i;
+   }
+}
+
+} // namespace
+
+/// The driver does not flag the clients of a scalar node dirty if its value
+/// did not change. The downstream vector nodes must still be recomputed
+/// whenever one of their scalar inputs changes, also after an evaluation that
+/// stopped the propagation.
+TEST(RooFitDriver, ScalarResultDirtyPropagation)
+{
+   RooHelpers::LocalChangeMsgLevel changeMsgLvl(RooFit::WARNING);
+
+   RooWorkspace ws;
+   // The mean is saturated for negative a: changing a in that region doesn't change the mean
+   ws.factory("expr::mean('(a > 0) * a', a[1.0, -10, 10])");
+   ws.factory("prod::width(s[1.0, 0.1, 10], 1.5)");
+   ws.factory("Gaussian::gauss(x[-10, 10], mean, width)");
+
+   RooRealVar &x = *ws.var("x");
+   RooRealVar &a = *ws.var("a");
+   RooRealVar &s = *ws.var("s");
+   RooAbsPdf &gauss = *ws.pdf("gauss");
+
+   RooDataSet data{"data", "data", x};
+   for (int i = 0; i < 20; ++i) {
+      x.setVal(-4.75 + 0.5 * i);
+      data.add(x);
+   }
+
+   std::unique_ptr<RooAbsReal> compiled = RooFit::Detail::compileForNormSet<RooAbsReal>(gauss, *data.get());
+   ROOT::Experimental::RooFitDriver driver(*compiled, RooFit::BatchModeOption::Cpu);
+   driver.setData(data, "");
+
+   checkValues(driver, gauss, x, data, "initial values");
+   checkValues(driver, gauss, x, data, "no parameter changed");
+
+   // the scalar mean changes from 1 to 0
+   a.setVal(-1.0);
+   checkValues(driver, gauss, x, data, "mean changed");
+
+   // the mean is re-evaluated, but it is still 0, so the propagation stops
+   a.setVal(-2.0);
+   checkValues(driver, gauss, x, data, "mean unchanged");
+
+   // the mean is unchanged, but the other scalar input of the Gaussian changes
+   a.setVal(-3.0);
+   s.setVal(2.0);
+   checkValues(driver, gauss, x, data, "mean unchanged and width changed");
+
+   // the mean changes again after an evaluation where it stopped the propagation
+   a.setVal(0.5);
+   checkValues(driver, gauss, x, data, "mean changed after unchanged evaluation");
+
+   // back to a previous value
+   a.setVal(1.0);
+   s.setVal(1.0);
+   checkValues(driver, gauss, x, data, "back to the initial values");
+}
@@ -41,6 +41,9 @@
 
 #include <functional>
 #include <random>
+#include <string>
+#include <utility>
+#include <vector>
 
 #include "gtest_wrapper.h"
 
@@ -198,6 +201,44 @@ TEST(RooFuncWrapper, Exponential)
    }
 }
 
+/// RooProdPdf is translated via its normalized compiled form, for both a factorizing and a conditional product.
+TEST(RooFuncWrapper, ProdPdf)
+{
+   RooHelpers::LocalChangeMsgLevel changeMsgLvl(RooFit::WARNING);
+
+   // The mean of y is independent of x for the factorizing product, and proportional to x for the conditional one
+   const std::vector<std::pair<std::string, std::string>> specs{{"sum::my(a[0.5, -2, 2], 0.2)", "PROD::model(gx, gy)"},
+                                                                {"prod::my(a[0.5, -2, 2], x)", "PROD::model(gx, gy|x)"}};
+
+   for (auto const &[meanSpec, prodSpec] : specs) {
+      RooWorkspace ws;
+      ws.factory("Gaussian::gx(x[0.7, -10, 10], mx[1.0, -5, 5], sx[2.0, 0.1, 10])");
+      ws.factory(meanSpec.c_str());
+      ws.factory("Gaussian::gy(y[-0.3, -10, 10], my, sy[1.5, 0.1, 10])");
+      ws.factory(prodSpec.c_str());
+
+      RooAbsPdf &model = *ws.pdf("model");
+      RooArgSet normSet{*ws.var("x"), *ws.var("y")};
+
+      RooFuncWrapper modelFunc("model", "model", model, normSet);
+
+      RooArgSet params;
+      model.getParameters(nullptr, params);
+
+      EXPECT_NEAR(model.getVal(normSet), modelFunc.getVal(), 1e-8) << prodSpec;
+
+      // Get AD based derivative
+      std::vector<double> dModel(modelFunc.getNumParams(), 0);
+      modelFunc.gradient(dModel.data());
+
+      // Check if derivatives are equal
+      for (std::size_t i = 0; i < params.size(); ++i) {
+         EXPECT_NEAR(getNumDerivative(model, static_cast<RooRealVar &>(*params[i]), normSet), dModel[i], 1e-6)
+            << prodSpec << " " << params[i]->GetName();
+      }
+   }
+}
+
 using CreateNLLFunc =
    std::function<std::unique_ptr<RooAbsReal>(RooAbsPdf &, RooAbsData &, RooWorkspace &, std::string const &)>;
 using WorkspaceSetupFunc = std::function<void(RooWorkspace &)>;
@@ -554,9 +595,23 @@ FactoryTestParams param10{"PoissonNoRounding",
                           1e-4,
                           /*randomizeParameters=*/true};
 
+// A conditional RooProdPdf, where one term is only normalized over its own observable
+FactoryTestParams param11{"ProdPdf",
+                          [](RooWorkspace &ws) {
+                             ws.factory("Gaussian::gx(x[-5, 5], mx[0.5, -5, 5], sx[1.5, 0.1, 10])");
+                             ws.factory("Gaussian::gy(y[-5, 5], prod::my(a[0.5, -2, 2], x), sy[1.0, 0.1, 10])");
+                             ws.factory("PROD::model(gx, gy|x)");
+                             ws.defineSet("observables", "x,y");
+                          },
+                          [](RooAbsPdf &pdf, RooAbsData &data, RooWorkspace &, std::string const &backend) {
+                             return std::unique_ptr<RooAbsReal>{pdf.createNLL(data, RooFit::BatchMode(backend))};
+                          },
+                          5e-3,
+                          /*randomizeParameters=*/true};
+
 INSTANTIATE_TEST_SUITE_P(RooFuncWrapper, FactoryTest,
                          testing::Values(param1, param2, param3, param4, param5, param6, param7, param8, param9,
-                                         param10),
+                                         param10, param11),
                          [](testing::TestParamInfo<FactoryTest::ParamType> const &paramInfo) {
                             return paramInfo.param._name;
                          });
@@ -386,3 +386,40 @@ TEST(RooRealIntegral, RooLinearVarModelIntegratedOverVariableClones)
    std::unique_ptr<RooAbsReal> integral2{gauss.createIntegral({yCopy}, {xCopy, yCopy})};
    EXPECT_TRUE(static_cast<RooRealIntegral &>(*integral2).numIntRealVars().empty());
 }
+
+// Numeric integrals remember a few recent results, which must only be reused
+// for the exact parameter values they were computed with.
+TEST(RooRealIntegral, RecentNumericIntegrals)
+{
+   RooHelpers::LocalChangeMsgLevel changeMsgLvl(RooFit::WARNING);
+
+   RooRealVar x{"x", "x", 0, 10};
+   RooRealVar a{"a", "a", 1.0, 0.1, 10};
+   RooRealVar b{"b", "b", 2.0, 0.1, 10};
+   RooGenericPdf pdf{"pdf", "std::exp(-a * x) * (1 + std::sin(b * x))", {x, a, b}};
+
+   std::unique_ptr<RooAbsReal> integral{pdf.createIntegral(x)};
+   auto &realIntegral = static_cast<RooRealIntegral &>(*integral);
+   ASSERT_FALSE(realIntegral.numIntRealVars().empty());
+   realIntegral.setCacheNumeric(true);
+
+   auto freshValue = [&]() {
+      std::unique_ptr<RooAbsReal> ref{pdf.createIntegral(x)};
+      return ref->getVal();
+   };
+
+   const double val1 = integral->getVal();
+   b.setVal(2.5);
+   const double val2 = integral->getVal();
+   EXPECT_NE(val1, val2);
+   EXPECT_DOUBLE_EQ(val2, freshValue());
+
+   b.setVal(2.0);
+   EXPECT_DOUBLE_EQ(integral->getVal(), val1);
+   b.setVal(2.5);
+   EXPECT_DOUBLE_EQ(integral->getVal(), val2);
+
+   // A parameter point that was never integrated
+   a.setVal(1.5);
+   EXPECT_DOUBLE_EQ(integral->getVal(), freshValue());
+}
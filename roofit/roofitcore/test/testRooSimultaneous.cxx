@@ -14,6 +14,8 @@
 #include <RooWorkspace.h>
 #include <RooThresholdCategory.h>
 
+#include <TROOT.h>
+
 #include <gtest/gtest.h>
 
 #include <memory>
@@ -319,3 +321,48 @@ TEST(RooSimultaneous, NestedSimPdfGenContext)
    EXPECT_EQ(catIndex(data2->get(1), "c1"), catIndex(proto.get(1), "c1"));
    EXPECT_EQ(catIndex(data2->get(1), "c2"), catIndex(proto.get(1), "c2"));
 }
+
+#ifdef R__USE_IMT
+/// With implicit multi-threading, the RooFitDriver evaluates the channels of a
+/// simultaneous likelihood concurrently. The result must not change.
+TEST(RooSimultaneous, ConcurrentChannelEvaluation)
+{
+   using namespace RooFit;
+
+   RooHelpers::LocalChangeMsgLevel changeMsgLvl(RooFit::WARNING);
+
+   RooWorkspace ws;
+   ws.factory("x[0, 10]");
+   ws.factory("mean[5., 0., 10.]");
+   ws.factory("cat[c0, c1, c2, c3]");
+
+   RooCategory &cat = *ws.cat("cat");
+   RooSimultaneous simPdf{"simPdf", "", cat};
+   for (int i = 0; i < 4; ++i) {
+      std::string n = std::to_string(i);
+      ws.factory(("SUM::model" + n + "(nsig" + n + "[200, 0, 1000] * Gaussian::gauss" + n + "(x, mean, width" + n +
+                  "[1., 0.1, 10.]), nbkg" + n + "[100, 0, 1000] * Exponential::expo" + n + "(x, c" + n +
+                  "[-0.2, -1., 0.])")
+                    .c_str());
+      simPdf.addPdf(*ws.pdf(("model" + n).c_str()), ("c" + n).c_str());
+   }
+
+   std::unique_ptr<RooDataSet> data{simPdf.generate({*ws.var("x"), cat})};
+
+   std::unique_ptr<RooAbsReal> nllSequential{simPdf.createNLL(*data, BatchMode("cpu"))};
+   const double refVal = nllSequential->getVal();
+
+   ROOT::EnableImplicitMT(4);
+   std::unique_ptr<RooAbsReal> nllConcurrent{simPdf.createNLL(*data, BatchMode("cpu"))};
+   const double concurrentVal = nllConcurrent->getVal();
+
+   // Change a shared and a channel-specific parameter
+   ws.var("mean")->setVal(5.5);
+   ws.var("width2")->setVal(1.5);
+   const double concurrentVal2 = nllConcurrent->getVal();
+   ROOT::DisableImplicitMT();
+
+   EXPECT_DOUBLE_EQ(concurrentVal, refVal);
+   EXPECT_DOUBLE_EQ(concurrentVal2, nllSequential->getVal());
+}
+#endif
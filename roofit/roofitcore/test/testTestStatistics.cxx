@@ -335,6 +335,58 @@ TEST(RooNLLVar, CopyRangedNLL)
    EXPECT_FLOAT_EQ(nllrange->getVal(), nllrangeClone->getVal());
 }
 
+/// The batch mode NLL must not change when the RooDataHist it was created
+/// from is modified afterwards, also if the histogram shared its weights with
+/// a copy that is deleted in the meantime.
+TEST(RooNLLVarNew, ModifyDataHistAfterCreation)
+{
+   RooHelpers::LocalChangeMsgLevel changeMsgLvl(RooFit::WARNING);
+
+   RooWorkspace ws;
+   ws.factory("Gaussian::model(x[-10, 10], mean[1, -5, 5], sigma[2, 0.5, 5.0])");
+
+   RooRealVar &x = *ws.var("x");
+   RooRealVar &mean = *ws.var("mean");
+   RooAbsPdf &model = *ws.pdf("model");
+   x.setBins(20);
+
+   std::unique_ptr<RooDataHist> data{model.generateBinned(x, 1000)};
+   // independent histograms with the same content
+   auto makeHist = [&](const char *name) {
+      auto hist = std::make_unique<RooDataHist>(name, name, x);
+      for (int i = 0; i < data->numEntries(); ++i) {
+         hist->set(i, data->weight(i), -1);
+      }
+      return hist;
+   };
+   // the reference stays unchanged, and the second histogram doesn't share its weights
+   std::unique_ptr<RooDataHist> reference = makeHist("reference");
+   std::unique_ptr<RooDataHist> data2 = makeHist("data2");
+   // a copy that shares the weights with the first histogram
+   auto copy = std::make_unique<RooDataHist>(*data, "copy");
+
+   using namespace RooFit;
+   std::unique_ptr<RooAbsReal> nll{model.createNLL(*data, BatchMode("cpu"))};
+   std::unique_ptr<RooAbsReal> nll2{model.createNLL(*data2, BatchMode("cpu"))};
+   std::unique_ptr<RooAbsReal> nllRef{model.createNLL(*reference, BatchMode("cpu"))};
+   EXPECT_DOUBLE_EQ(nll->getVal(), nllRef->getVal());
+   EXPECT_DOUBLE_EQ(nll2->getVal(), nllRef->getVal());
+
+   // the first histogram gets its own weights, and the only other owner of
+   // the weights it had before is deleted
+   for (int i = 0; i < data->numEntries(); ++i) {
+      data->set(i, 2. * data->weight(i) + 1., -1);
+      data2->set(i, 2. * data2->weight(i) + 1., -1);
+   }
+   copy.reset();
+
+   for (double meanVal : {1.5, 1.}) {
+      mean.setVal(meanVal);
+      EXPECT_DOUBLE_EQ(nll->getVal(), nllRef->getVal());
+      EXPECT_DOUBLE_EQ(nll2->getVal(), nllRef->getVal());
+   }
+}
+
 /// When using the Integrate() command argument in chi2FitTo, the result should
 /// be identical to a fit without bin integration if the fit function is
 /// linear. This is a good cross check to see if the integration works.
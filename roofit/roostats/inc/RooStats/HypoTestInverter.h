@@ -22,6 +22,7 @@ class TGraphErrors;
 
 #include <memory>
 #include <string>
+#include <vector>
 
 namespace RooStats {
 
@@ -146,6 +147,12 @@ public:
    /// set numerical error in test statistic evaluation (default is zero)
    void SetNumErr(double err) { fNumErr = err; }
 
+   /// Run the points of a fixed scan in the given number of forked worker processes
+   /// (not available on Windows). Each point gets its own random seed, drawn before
+   /// the scan, so that the result does not depend on the number of workers.
+   void SetNWorkers(unsigned int nWorkers) { fNWorkers = nWorkers; }
+   unsigned int GetNWorkers() const { return fNWorkers; }
+
    /// set flag to close proof for every new run
    static void SetCloseProof(bool flag);
 
@@ -163,6 +170,15 @@ protected:
    /// run the hybrid at a single point
    HypoTestResult * Eval( HypoTestCalculatorGeneric &hc, bool adaptive , double clsTarget) const;
 
+   /// set the scanned variable and the snapshot of the null model to the given point
+   void SetScanPoint(double rVal) const;
+
+   /// check the result of the given point and add it to the result
+   bool AddPointResult(double rVal, std::unique_ptr<HypoTestResult> result) const;
+
+   /// run the given points in fNWorkers forked processes
+   void RunPointsMultiProcess(const std::vector<double> &xValues) const;
+
    /// helper functions
    static RooRealVar * GetVariableToScan(const HypoTestCalculatorGeneric &hc);
    static void CheckInputModels(const HypoTestCalculatorGeneric &hc, const RooRealVar & scanVar);
@@ -199,6 +215,7 @@ private:
    double fXmin;
    double fXmax;
    double fNumErr;
+   unsigned int fNWorkers = 1; ///<! number of worker processes for fixed scans
 
 protected:
 
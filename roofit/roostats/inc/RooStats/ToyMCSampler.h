@@ -80,6 +80,7 @@ class ToyMCSampler: public TestStatSampler {
       SamplingDistribution* GetSamplingDistribution(RooArgSet& paramPoint) override;
       virtual RooDataSet* GetSamplingDistributions(RooArgSet& paramPoint);
       virtual RooDataSet* GetSamplingDistributionsSingleWorker(RooArgSet& paramPoint);
+      RooDataSet* GetSamplingDistributionsMultiProcess(RooArgSet& paramPoint);
 
       virtual SamplingDistribution* AppendSamplingDistribution(
          RooArgSet& allParameters,
@@ -227,6 +228,10 @@ class ToyMCSampler: public TestStatSampler {
 
       /// calling with argument or nullptr deactivates proof
       void SetProofConfig(ProofConfig *pc = nullptr) { fProofConfig = pc; }
+      /// Distribute the toys over the given number of forked worker processes
+      /// (not available on Windows). Ignored if a ProofConfig is set.
+      void SetNWorkers(unsigned int nWorkers) { fNWorkers = nWorkers; }
+      unsigned int GetNWorkers() const { return fNWorkers; }
 
       void SetProtoData(const RooDataSet* d) { fProtoData = d; }
 
@@ -273,6 +278,7 @@ class ToyMCSampler: public TestStatSampler {
       const RooDataSet *fProtoData; ///< in dev
 
       ProofConfig *fProofConfig;   ///<!
+      unsigned int fNWorkers = 1;  ///<! number of worker processes
 
       mutable NuisanceParametersSampler *fNuisanceParametersSampler; ///<!
 
@@ -27,6 +27,9 @@ The  HypoTestInverter implements various options for performing the scan.
 optimally the curve. It will stop when the desired precision is obtained.
 - HypoTestInverter::RunOnePoint computes the confidence level at a given point.
 
+The points of a fixed scan can be run in forked worker processes, see
+HypoTestInverter::SetNWorkers.
+
 ### CLs presciption
 The class can scan the CLs+b values or alternatively CLs. For the latter,
 call HypoTestInverter::UseCLs().
@@ -64,6 +67,12 @@ call HypoTestInverter::UseCLs().
 
 #include "RooStats/ProofConfig.h"
 
+#ifndef R__WIN32
+#include "ROOT/TProcessExecutor.hxx"
+#include "ROOT/TSeq.hxx"
+#endif
+
+#include <algorithm>
 #include <cassert>
 #include <cmath>
 #include <memory>
@@ -405,6 +414,7 @@ HypoTestInverter & HypoTestInverter::operator= (const HypoTestInverter & rhs) {
    fXmin = rhs.fXmin;
    fXmax = rhs.fXmax;
    fNumErr = rhs.fNumErr;
+   fNWorkers = rhs.fNWorkers;
 
    return *this;
 }
@@ -642,15 +652,20 @@ bool HypoTestInverter::RunFixedScan( int nBins, double xMin, double xMax, bool s
      return false;
    }
 
-   double thisX = xMin;
-   for (int i=0; i<nBins; i++) {
+   std::vector<double> xValues(nBins, xMin);
+   for (int i=1; i<nBins; i++) { // avoids case of nBins = 1
+      if (scanLog)
+         xValues[i] = exp(  log(xMin) +  i*(log(xMax)-log(xMin))/(nBins-1)  );  // scan in log x
+      else
+         xValues[i] = xMin + i*(xMax-xMin)/(nBins-1);          // linear scan in x
+   }
 
-      if (i > 0) { // avoids case of nBins = 1
-         if (scanLog)
-            thisX = exp(  log(xMin) +  i*(log(xMax)-log(xMin))/(nBins-1)  );  // scan in log x
-         else
-            thisX = xMin + i*(xMax-xMin)/(nBins-1);          // linear scan in x
-      }
+   if (fNWorkers > 1 && nBins > 1) {
+      RunPointsMultiProcess(xValues);
+      return true;
+   }
+
+   for (double thisX : xValues) {
 
       const bool status = RunOnePoint(thisX);
 
@@ -663,6 +678,78 @@ bool HypoTestInverter::RunFixedScan( int nBins, double xMin, double xMax, bool s
    return true;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Run the given points in fNWorkers forked processes, each point being
+/// evaluated with its own random seed, and add the results in order.
+
+void HypoTestInverter::RunPointsMultiProcess(const std::vector<double> &xValues) const
+{
+#ifdef R__WIN32
+   oocoutW(nullptr, InputArguments)
+      << "HypoTestInverter: worker processes are not supported on Windows, the points are run serially." << endl;
+   for (double thisX : xValues) {
+      if (!RunOnePoint(thisX))
+         oocoutW(nullptr,Eval) << "HypoTestInverter::RunFixedScan - The hypo test for point " << thisX << " failed. Skipping." << std::endl;
+   }
+#else
+   CreateResults();
+   const unsigned int nPoints = xValues.size();
+
+   // Draw the seeds in the parent process, one per point, so that the result of a
+   // point does not depend on the number of workers. Zero is avoided, because it
+   // would make TRandom3 use a time-dependent seed.
+   std::vector<UInt_t> seeds(nPoints);
+   for (auto &seed : seeds) {
+      seed = RooRandom::randomGenerator()->Integer(TMath::Limits<unsigned int>::Max() - 1) + 1;
+   }
+
+   const double oldValue = fScannedVariable->getVal();
+   auto runPoint = [&](unsigned int iPoint) {
+      // This runs in the forked process, so the state can be changed freely
+      RooRandom::randomGenerator()->SetSeed(seeds[iPoint]);
+      SetScanPoint(xValues[iPoint]);
+      return Eval(*fCalculator0, false, -1);
+   };
+
+   ROOT::TProcessExecutor pool(std::min(fNWorkers, nPoints));
+   std::vector<HypoTestResult *> results = pool.Map(runPoint, ROOT::TSeqU(nPoints));
+
+   for (unsigned int i = 0; i < nPoints; ++i) {
+      std::unique_ptr<HypoTestResult> result(results[i]);
+      if (!result) {
+         oocoutE(nullptr,Eval) << "HypoTestInverter - Error running point " << fScannedVariable->GetName() << " = "
+                               << xValues[i] << " in a worker process" << endl;
+      } else {
+         // the toys were counted by the worker
+         if ((fCalcType == kFrequentist || fCalcType == kHybrid) && result->GetNullDistribution() &&
+             result->GetAltDistribution())
+            fTotalToysRun += result->GetAltDistribution()->GetSize() + result->GetNullDistribution()->GetSize();
+         if (AddPointResult(xValues[i], std::move(result)))
+            continue;
+      }
+      oocoutW(nullptr,Eval) << "HypoTestInverter::RunFixedScan - The hypo test for point " << xValues[i] << " failed. Skipping." << std::endl;
+   }
+   fScannedVariable->setVal(oldValue);
+#endif
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Set the scanned variable to the given value, and the snapshot of the
+/// parameters of interest of the null model (S+B) accordingly.
+
+void HypoTestInverter::SetScanPoint(double rVal) const
+{
+   // evaluate hybrid calculator at a single point
+   fScannedVariable->setVal(rVal);
+   // need to set value of rval in hybridcalculator
+   // assume null model is S+B and alternate is B only
+   const ModelConfig * sbModel = fCalculator0->GetNullModel();
+   RooArgSet poi; poi.add(*sbModel->GetParametersOfInterest());
+   // set poi to right values
+   poi.assign(RooArgSet(*fScannedVariable));
+   const_cast<ModelConfig*>(sbModel)->SetSnapshot(poi);
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// run only one point at the given POI value
 
@@ -690,15 +777,7 @@ bool HypoTestInverter::RunOnePoint( double rVal, bool adaptive, double clTarget)
    // save old value
    double oldValue = fScannedVariable->getVal();
 
-   // evaluate hybrid calculator at a single point
-   fScannedVariable->setVal(rVal);
-   // need to set value of rval in hybridcalculator
-   // assume null model is S+B and alternate is B only
-   const ModelConfig * sbModel = fCalculator0->GetNullModel();
-   RooArgSet poi; poi.add(*sbModel->GetParametersOfInterest());
-   // set poi to right values
-   poi.assign(RooArgSet(*fScannedVariable));
-   const_cast<ModelConfig*>(sbModel)->SetSnapshot(poi);
+   SetScanPoint(rVal);
 
    if (fVerbose > 0)
       oocoutP(nullptr,Eval) << "Running for " << fScannedVariable->GetName() << " = " << fScannedVariable->getVal() << endl;
@@ -710,12 +789,27 @@ bool HypoTestInverter::RunOnePoint( double rVal, bool adaptive, double clTarget)
    fScannedVariable->getVal() << endl;
       return false;
    }
+   if (!AddPointResult(rVal, std::move(result)))
+      return false;
+
+   fScannedVariable->setVal(oldValue);
+
+   return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Add the result of the hypothesis test at the given POI value to the
+/// HypoTestInverterResult, merging it with the last point if it has the same
+/// value. Returns false if the result is invalid.
+
+bool HypoTestInverter::AddPointResult(double rVal, std::unique_ptr<HypoTestResult> result) const
+{
    // in case of a dummy result
    const double nullPV = result->NullPValue();
    const double altPV = result->AlternatePValue();
    if (!std::isfinite(nullPV) || nullPV < 0. || nullPV > 1. || !std::isfinite(altPV) || altPV < 0. || altPV > 1.) {
       oocoutW(nullptr,Eval) << "HypoTestInverter - Skipping invalid result for  point " << fScannedVariable->GetName() << " = " <<
-         fScannedVariable->getVal() << ". null p-value=" << nullPV << ", alternate p-value=" << altPV << endl;
+         rVal << ". null p-value=" << nullPV << ", alternate p-value=" << altPV << endl;
       return false;
    }
 
@@ -749,8 +843,6 @@ bool HypoTestInverter::RunOnePoint( double rVal, bool adaptive, double clTarget)
 
    }
 
-   fScannedVariable->setVal(oldValue);
-
    return true;
 }
 
@@ -27,6 +27,12 @@ TestStatistic.
 For parallel runs, ToyMCSampler can be given an instance of ProofConfig
 and then run in parallel using proof or proof-lite. Internally, it uses
 ToyMCStudy with the RooStudyManager.
+
+Alternatively, SetNWorkers() distributes the toys over forked worker
+processes on the local machine, which don't need a PROOF setup. Each worker
+works on its own copy of the models, and the seeds of the workers are drawn
+from the random generator of the parent process, so the results only depend
+on its seed and on the number of workers.
 */
 
 #include "RooStats/ToyMCSampler.h"
@@ -50,6 +56,13 @@ ToyMCStudy with the RooStudyManager.
 
 #include "TMath.h"
 
+#ifndef R__WIN32
+#include "ROOT/TProcessExecutor.hxx"
+#include "ROOT/TSeq.hxx"
+#endif
+
+#include <algorithm>
+
 
 using namespace RooFit;
 using namespace std;
@@ -307,8 +320,11 @@ RooDataSet* ToyMCSampler::GetSamplingDistributions(RooArgSet& paramPointIn)
 {
 
    // ======= S I N G L E   R U N ? =======
-   if(!fProofConfig)
+   if(!fProofConfig) {
+      if(fNWorkers > 1)
+         return GetSamplingDistributionsMultiProcess(paramPointIn);
       return GetSamplingDistributionsSingleWorker(paramPointIn);
+   }
 
    // ======= P A R A L L E L   R U N =======
    if (!CheckConfig()){
@@ -350,6 +366,62 @@ RooDataSet* ToyMCSampler::GetSamplingDistributions(RooArgSet& paramPointIn)
    return output;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Generate the toys in fNWorkers forked processes, each running
+/// GetSamplingDistributionsSingleWorker() on its share of the toys, and merge
+/// the results.
+
+RooDataSet* ToyMCSampler::GetSamplingDistributionsMultiProcess(RooArgSet& paramPointIn)
+{
+#ifdef R__WIN32
+   oocoutW(nullptr, InputArguments)
+      << "ToyMCSampler: worker processes are not supported on Windows, the toys are generated serially."
+      << endl;
+   return GetSamplingDistributionsSingleWorker(paramPointIn);
+#else
+   // turn adaptive sampling off if given
+   if(fToysInTails) {
+      fToysInTails = 0;
+      oocoutW(nullptr, InputArguments)
+         << "Adaptive sampling in ToyMCSampler is not supported for parallel runs."
+         << endl;
+   }
+
+   const Int_t totToys = fNToys;
+   const unsigned int nWorkers = std::min<unsigned int>(fNWorkers, std::max(totToys, 1));
+
+   // Draw the seeds in the parent process. Zero is avoided, because it would
+   // make TRandom3 use a time-dependent seed.
+   std::vector<UInt_t> seeds(nWorkers);
+   for (auto &seed : seeds) {
+      seed = RooRandom::randomGenerator()->Integer(TMath::Limits<unsigned int>::Max() - 1) + 1;
+   }
+
+   auto runWorker = [&](unsigned int iWorker) {
+      // This runs in the forked process, so the state can be changed freely
+      RooRandom::randomGenerator()->SetSeed(seeds[iWorker]);
+      fNToys = (iWorker + 1) * totToys / nWorkers - iWorker * totToys / nWorkers;
+      return GetSamplingDistributionsSingleWorker(paramPointIn);
+   };
+
+   ROOT::TProcessExecutor pool(nWorkers);
+   std::vector<RooDataSet *> results = pool.Map(runWorker, ROOT::TSeqU(nWorkers));
+
+   RooDataSet* output = nullptr;
+   for (RooDataSet *result : results) {
+      if (!result) {
+         oocoutE(nullptr, Generation) << "ToyMCSampler: a worker process didn't return a sampling distribution" << endl;
+      } else if (!output) {
+         output = result;
+      } else {
+         output->append(*result);
+         delete result;
+      }
+   }
+   return output;
+#endif
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// This is the main function for serial runs. It is called automatically
 /// from inside GetSamplingDistribution when no ProofConfig is given.
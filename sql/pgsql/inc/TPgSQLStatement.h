@@ -88,6 +88,7 @@ public:
    Int_t       GetNumFields() final;
    const char *GetFieldName(Int_t nfield) final;
    Bool_t      NextResultRow() final;
+   Int_t       NextResultRows(std::vector<TColumn> &columns, Int_t maxrows) final;
 
    Bool_t      IsNull(Int_t npar) final;
    Int_t       GetInt(Int_t npar) final;
@@ -271,6 +271,46 @@ Bool_t TPgSQLStatement::NextResultRow()
    return res;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Fetch up to maxrows rows in the columns, see TSQLStatement::NextResultRows().
+/// The result set is already in memory, the values are converted directly
+/// from it, field by field.
+
+Int_t TPgSQLStatement::NextResultRows(std::vector<TColumn> &columns, Int_t maxrows)
+{
+   for (auto &col : columns)
+      col.Clear();
+   if (!fStmt || !IsResultSetMode() || (maxrows <= 0)) return 0;
+
+   const Int_t first = fIterationCount + 1;
+   const Int_t nrows = (first < fNumResultRows) ? TMath::Min(maxrows, fNumResultRows - first) : 0;
+   for (auto &col : columns) {
+      if ((col.fField < 0) || (col.fField >= fNumResultCols)) {
+         SetError(-1, "Invalid field number", "NextResultRows");
+         return -1;
+      }
+      col.fIsNull.resize(nrows);
+      switch (col.fType) {
+      case TColumn::kLong64: col.fLong64.resize(nrows); break;
+      case TColumn::kDouble: col.fDouble.resize(nrows); break;
+      case TColumn::kString: col.fString.resize(nrows); break;
+      }
+      for (Int_t n = 0; n < nrows; ++n) {
+         const Bool_t isnull = PQgetisnull(fStmt->fRes, first + n, col.fField);
+         col.fIsNull[n] = isnull;
+         if (isnull) continue;
+         const char *value = PQgetvalue(fStmt->fRes, first + n, col.fField);
+         switch (col.fType) {
+         case TColumn::kLong64: col.fLong64[n] = (Long64_t) strtoll(value, nullptr, 10); break;
+         case TColumn::kDouble: col.fDouble[n] = atof(value); break;
+         case TColumn::kString: col.fString[n] = value; break;
+         }
+      }
+   }
+   fIterationCount = (nrows > 0) ? first + nrows - 1 : fNumResultRows;
+   return nrows;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Increment iteration counter for statement, where parameter can be set.
 /// Statement with parameters of previous iteration
@@ -1026,6 +1066,14 @@ Bool_t TPgSQLStatement::NextResultRow()
    return kFALSE;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Fetch result rows in columns.
+
+Int_t TPgSQLStatement::NextResultRows(std::vector<TColumn> &, Int_t)
+{
+   return 0;
+}
+
 
 ////////////////////////////////////////////////////////////////////////////////
 /// Increment iteration counter for statement, where parameter can be set.
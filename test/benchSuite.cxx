@@ -0,0 +1,689 @@
+// Performance benchmark suite for regression tracking.
+//
+// Runs a fixed set of reproducible workloads and reports, for every benchmark,
+// the median real and CPU time of several repetitions and the throughput:
+//  - TTree and RNTuple write and read throughput for every compression algorithm
+//  - RDataFrame event-loop overhead for a growing number of nodes
+//  - TH1 and TH2 fill rates
+//  - Minuit2 fit and RooFit NLL evaluation
+//  - SOFIE inference of an ONNX model
+// The benchmarks of the components that are not built are left out.
+//
+// The results can be written as JSON in the format of google-benchmark, such
+// that the tools of google-benchmark and rootbench (e.g. compare.py) can be used
+// to compare two runs.
+//
+//  run with
+//     benchSuite                       run all the benchmarks
+//     benchSuite -l                    list the benchmarks
+//     benchSuite -f "TTree|RNTuple"    run the benchmarks matching a regular expression
+//     benchSuite -r 10                 repeat every benchmark 10 times (default 5)
+//     benchSuite -n 100000             number of events of the I/O and RDF benchmarks
+//     benchSuite -t 4                  run RDataFrame with 4 threads
+//     benchSuite -d /tmp               directory of the data files
+//     benchSuite -o results.json       write the results as JSON
+//
+// All the input data are generated with fixed seeds, so that two runs with
+// the same options process the same data.
+
+#include "Compression.h"
+#include "TFile.h"
+#include "TH1.h"
+#include "TH2.h"
+#include "TPRegexp.h"
+#include "TROOT.h"
+#include "TRandom3.h"
+#include "TStopwatch.h"
+#include "TSystem.h"
+#include "TTimeStamp.h"
+#include "TTree.h"
+
+#ifdef BENCHSUITE_WITH_NTUPLE
+#include <ROOT/RNTuple.hxx>
+#include <ROOT/RNTupleModel.hxx>
+#include <ROOT/RNTupleOptions.hxx>
+#endif
+#ifdef BENCHSUITE_WITH_DATAFRAME
+#include <ROOT/RDataFrame.hxx>
+#endif
+#ifdef BENCHSUITE_WITH_MINUIT2
+#include "Math/MinimizerOptions.h"
+#include "TF1.h"
+#include "TFitResult.h"
+#endif
+#ifdef BENCHSUITE_WITH_ROOFIT
+#include "RooDataSet.h"
+#include "RooGaussian.h"
+#include "RooMsgService.h"
+#include "RooRandom.h"
+#include "RooRealVar.h"
+#endif
+#ifdef BENCHSUITE_WITH_SOFIE
+#include "TMVA/RSofieReader.hxx"
+#include "TMVA/RTensor.hxx"
+#endif
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace {
+
+/// Options of the run, set from the command line
+struct BenchOptions {
+   Long64_t fNEvents = 200000;
+   Int_t fRepetitions = 5;
+   Int_t fNThreads = 0;
+   std::string fFilter;
+   std::string fDataDir;
+   std::string fOutput;
+   bool fList = false;
+};
+
+BenchOptions gOptions;
+
+/// Counters set by one iteration of a benchmark, to compute its throughput
+struct BenchCounters {
+   Long64_t fItems = 0;
+   Long64_t fBytes = 0;
+};
+
+/// A benchmark: fSetup and fTearDown are not timed, fRun is timed once per repetition
+struct Benchmark {
+   std::string fName;
+   std::function<void(BenchCounters &)> fRun;
+   std::function<void()> fSetup;
+   std::function<void()> fTearDown;
+};
+
+/// The result of one benchmark, times are in milliseconds
+struct BenchResult {
+   std::string fName;
+   Int_t fRepetitions = 0;
+   Double_t fRealMedian = 0;
+   Double_t fRealMean = 0;
+   Double_t fRealStddev = 0;
+   Double_t fCpuMedian = 0;
+   Double_t fItemsPerSecond = 0;
+   Double_t fBytesPerSecond = 0;
+};
+
+std::vector<Benchmark> &GetBenchmarks()
+{
+   static std::vector<Benchmark> benchmarks;
+   return benchmarks;
+}
+
+void AddBenchmark(const std::string &name, std::function<void(BenchCounters &)> run,
+                  std::function<void()> setup = nullptr, std::function<void()> tearDown = nullptr)
+{
+   GetBenchmarks().push_back({name, std::move(run), std::move(setup), std::move(tearDown)});
+}
+
+Double_t Median(std::vector<Double_t> values)
+{
+   std::sort(values.begin(), values.end());
+   const auto n = values.size();
+   return (n % 2) ? values[n / 2] : 0.5 * (values[n / 2 - 1] + values[n / 2]);
+}
+
+std::string DataFile(const std::string &name)
+{
+   return gOptions.fDataDir + "/benchSuite_" + name + "_" + std::to_string(gSystem->GetPid()) + ".root";
+}
+
+Long64_t FileSize(const std::string &path)
+{
+   FileStat_t stat;
+   if (gSystem->GetPathInfo(path.c_str(), stat) != 0)
+      return 0;
+   return stat.fSize;
+}
+
+//--TTree and RNTuple I/O---------------------------------------------------------------------------
+
+struct Compression {
+   const char *fName;
+   Int_t fSettings;
+};
+
+const Compression kCompressions[] = {
+   {"none", 0},
+   {"zlib", ROOT::CompressionSettings(ROOT::RCompressionSetting::EAlgorithm::kZLIB, 1)},
+   {"lzma", ROOT::CompressionSettings(ROOT::RCompressionSetting::EAlgorithm::kLZMA, 7)},
+   {"lz4", ROOT::CompressionSettings(ROOT::RCompressionSetting::EAlgorithm::kLZ4, 4)},
+   {"zstd", ROOT::CompressionSettings(ROOT::RCompressionSetting::EAlgorithm::kZSTD, 5)},
+};
+
+/// The content of one event of the I/O benchmarks
+struct IOEvent {
+   Float_t fPx, fPy, fPz, fE;
+   Int_t fNHits;
+   std::vector<Float_t> fHits;
+
+   void Generate(TRandom &rng)
+   {
+      fPx = rng.Gaus(0, 10);
+      fPy = rng.Gaus(0, 10);
+      fPz = rng.Gaus(0, 50);
+      fE = std::sqrt(fPx * fPx + fPy * fPy + fPz * fPz + 0.1);
+      fNHits = rng.Integer(20);
+      fHits.resize(fNHits);
+      for (auto &h : fHits)
+         h = rng.Exp(1.);
+   }
+};
+
+Long64_t WriteTree(const std::string &path, Int_t compression)
+{
+   TRandom3 rng(4357);
+   IOEvent event;
+   auto hits = &event.fHits;
+   TFile file(path.c_str(), "RECREATE", "", compression);
+   TTree tree("events", "benchSuite events");
+   tree.Branch("px", &event.fPx);
+   tree.Branch("py", &event.fPy);
+   tree.Branch("pz", &event.fPz);
+   tree.Branch("e", &event.fE);
+   tree.Branch("nhits", &event.fNHits);
+   tree.Branch("hits", &hits);
+   for (Long64_t i = 0; i < gOptions.fNEvents; ++i) {
+      event.Generate(rng);
+      tree.Fill();
+   }
+   tree.Write();
+   file.Close();
+   return FileSize(path);
+}
+
+Long64_t ReadTree(const std::string &path)
+{
+   IOEvent event;
+   auto hits = &event.fHits;
+   TFile file(path.c_str());
+   auto tree = file.Get<TTree>("events");
+   tree->SetBranchAddress("px", &event.fPx);
+   tree->SetBranchAddress("py", &event.fPy);
+   tree->SetBranchAddress("pz", &event.fPz);
+   tree->SetBranchAddress("e", &event.fE);
+   tree->SetBranchAddress("nhits", &event.fNHits);
+   tree->SetBranchAddress("hits", &hits);
+   Double_t sum = 0;
+   const auto nEntries = tree->GetEntries();
+   for (Long64_t i = 0; i < nEntries; ++i) {
+      tree->GetEntry(i);
+      sum += event.fE + event.fHits.size();
+   }
+   if (sum <= 0)
+      printf("Error in ReadTree: unexpected content of %s\n", path.c_str());
+   return file.GetBytesRead();
+}
+
+void AddTreeBenchmarks()
+{
+   for (const auto &c : kCompressions) {
+      const auto writePath = DataFile(std::string("tree_write_") + c.fName);
+      AddBenchmark(
+         std::string("TTree/Write/") + c.fName,
+         [writePath, c](BenchCounters &counters) {
+            counters.fBytes = WriteTree(writePath, c.fSettings);
+            counters.fItems = gOptions.fNEvents;
+         },
+         nullptr, [writePath] { gSystem->Unlink(writePath.c_str()); });
+
+      const auto readPath = DataFile(std::string("tree_read_") + c.fName);
+      AddBenchmark(
+         std::string("TTree/Read/") + c.fName,
+         [readPath](BenchCounters &counters) {
+            counters.fBytes = ReadTree(readPath);
+            counters.fItems = gOptions.fNEvents;
+         },
+         [readPath, c] { WriteTree(readPath, c.fSettings); }, [readPath] { gSystem->Unlink(readPath.c_str()); });
+   }
+}
+
+#ifdef BENCHSUITE_WITH_NTUPLE
+Long64_t WriteNTuple(const std::string &path, Int_t compression)
+{
+   using ROOT::Experimental::RNTupleModel;
+   using ROOT::Experimental::RNTupleWriter;
+
+   TRandom3 rng(4357);
+   IOEvent event;
+   auto model = RNTupleModel::Create();
+   auto px = model->MakeField<Float_t>("px");
+   auto py = model->MakeField<Float_t>("py");
+   auto pz = model->MakeField<Float_t>("pz");
+   auto e = model->MakeField<Float_t>("e");
+   auto hits = model->MakeField<std::vector<Float_t>>("hits");
+   ROOT::Experimental::RNTupleWriteOptions options;
+   options.SetCompression(compression);
+   {
+      auto writer = RNTupleWriter::Recreate(std::move(model), "events", path, options);
+      for (Long64_t i = 0; i < gOptions.fNEvents; ++i) {
+         event.Generate(rng);
+         *px = event.fPx;
+         *py = event.fPy;
+         *pz = event.fPz;
+         *e = event.fE;
+         *hits = event.fHits;
+         writer->Fill();
+      }
+   }
+   return FileSize(path);
+}
+
+Long64_t ReadNTuple(const std::string &path)
+{
+   auto reader = ROOT::Experimental::RNTupleReader::Open("events", path);
+   auto e = reader->GetView<Float_t>("e");
+   auto hits = reader->GetView<std::vector<Float_t>>("hits");
+   Double_t sum = 0;
+   for (auto i : reader->GetEntryRange())
+      sum += e(i) + hits(i).size();
+   if (sum <= 0)
+      printf("Error in ReadNTuple: unexpected content of %s\n", path.c_str());
+   return FileSize(path);
+}
+
+void AddNTupleBenchmarks()
+{
+   for (const auto &c : kCompressions) {
+      const auto writePath = DataFile(std::string("ntuple_write_") + c.fName);
+      AddBenchmark(
+         std::string("RNTuple/Write/") + c.fName,
+         [writePath, c](BenchCounters &counters) {
+            counters.fBytes = WriteNTuple(writePath, c.fSettings);
+            counters.fItems = gOptions.fNEvents;
+         },
+         nullptr, [writePath] { gSystem->Unlink(writePath.c_str()); });
+
+      const auto readPath = DataFile(std::string("ntuple_read_") + c.fName);
+      AddBenchmark(
+         std::string("RNTuple/Read/") + c.fName,
+         [readPath](BenchCounters &counters) {
+            counters.fBytes = ReadNTuple(readPath);
+            counters.fItems = gOptions.fNEvents;
+         },
+         [readPath, c] { WriteNTuple(readPath, c.fSettings); }, [readPath] { gSystem->Unlink(readPath.c_str()); });
+   }
+}
+#endif
+
+//--RDataFrame--------------------------------------------------------------------------------------
+
+#ifdef BENCHSUITE_WITH_DATAFRAME
+/// Event loop over an empty source with nNodes Define/Filter pairs, to measure the overhead per node
+void RunDataFrame(Int_t nNodes, BenchCounters &counters)
+{
+   ROOT::RDataFrame df(gOptions.fNEvents);
+   ROOT::RDF::RNode node = df.Define("x0", [](ULong64_t entry) { return Double_t(entry); }, {"rdfentry_"});
+   for (Int_t i = 1; i <= nNodes; ++i) {
+      const auto prev = "x" + std::to_string(i - 1);
+      node = node.Define("x" + std::to_string(i), [](Double_t x) { return x + 1; }, {prev})
+                .Filter([](Double_t x) { return x >= 0; }, {prev});
+   }
+   auto sum = node.Sum<Double_t>("x" + std::to_string(nNodes));
+   if (*sum < 0)
+      printf("Error in RunDataFrame: unexpected sum\n");
+   counters.fItems = gOptions.fNEvents;
+}
+
+void AddDataFrameBenchmarks()
+{
+   for (Int_t nNodes : {0, 1, 4, 16}) {
+      AddBenchmark("RDF/DefineFilter/" + std::to_string(nNodes),
+                   [nNodes](BenchCounters &counters) { RunDataFrame(nNodes, counters); });
+   }
+   AddBenchmark("RDF/Histo1D", [](BenchCounters &counters) {
+      ROOT::RDataFrame df(gOptions.fNEvents);
+      auto h = df.Define("x", [](ULong64_t entry) { return Double_t(entry % 100); }, {"rdfentry_"})
+                  .Histo1D<Double_t>({"h", "h", 100, 0, 100}, "x");
+      if (h->GetEntries() != gOptions.fNEvents)
+         printf("Error in RDF/Histo1D: unexpected number of entries\n");
+      counters.fItems = gOptions.fNEvents;
+   });
+}
+#endif
+
+//--Histograms--------------------------------------------------------------------------------------
+
+void AddHistogramBenchmarks()
+{
+   const Long64_t nFills = 10 * gOptions.fNEvents;
+   auto values = std::make_shared<std::vector<Double_t>>();
+   auto fillValues = [values, nFills] {
+      TRandom3 rng(4357);
+      values->resize(2 * nFills);
+      for (auto &v : *values)
+         v = rng.Gaus(0, 1);
+   };
+   auto clearValues = [values] { std::vector<Double_t>().swap(*values); };
+
+   AddBenchmark(
+      "TH1D/Fill",
+      [values, nFills](BenchCounters &counters) {
+         TH1D h("h", "h", 100, -5, 5);
+         h.SetDirectory(nullptr);
+         for (Long64_t i = 0; i < nFills; ++i)
+            h.Fill((*values)[i]);
+         counters.fItems = nFills;
+      },
+      fillValues, clearValues);
+   AddBenchmark(
+      "TH1D/FillN",
+      [values, nFills](BenchCounters &counters) {
+         TH1D h("h", "h", 100, -5, 5);
+         h.SetDirectory(nullptr);
+         const Long64_t batch = 1000;
+         for (Long64_t i = 0; i + batch <= nFills; i += batch)
+            h.FillN(batch, values->data() + i, nullptr);
+         counters.fItems = nFills - nFills % batch;
+      },
+      fillValues, clearValues);
+   AddBenchmark(
+      "TH2D/Fill",
+      [values, nFills](BenchCounters &counters) {
+         TH2D h("h2", "h2", 100, -5, 5, 100, -5, 5);
+         h.SetDirectory(nullptr);
+         for (Long64_t i = 0; i < nFills; ++i)
+            h.Fill((*values)[2 * i], (*values)[2 * i + 1]);
+         counters.fItems = nFills;
+      },
+      fillValues, clearValues);
+}
+
+//--Fitting-----------------------------------------------------------------------------------------
+
+#ifdef BENCHSUITE_WITH_MINUIT2
+void AddMinuit2Benchmarks()
+{
+   auto histogram = std::make_shared<std::unique_ptr<TH1D>>();
+   const Int_t nFits = 20;
+   AddBenchmark(
+      "Minuit2/BinnedLikelihoodFit",
+      [histogram, nFits](BenchCounters &counters) {
+         ROOT::Math::MinimizerOptions::SetDefaultMinimizer("Minuit2");
+         for (Int_t i = 0; i < nFits; ++i) {
+            TF1 f("f", "gaus", -5, 5);
+            f.SetParameters(1000, 0.5, 2);
+            auto result = (*histogram)->Fit(&f, "Q0LNS");
+            if (result->Status() != 0)
+               printf("Error in Minuit2/BinnedLikelihoodFit: fit status %d\n", result->Status());
+         }
+         counters.fItems = nFits;
+      },
+      [histogram] {
+         TRandom3 rng(4357);
+         histogram->reset(new TH1D("hfit", "hfit", 200, -5, 5));
+         (*histogram)->SetDirectory(nullptr);
+         for (Long64_t i = 0; i < gOptions.fNEvents; ++i)
+            (*histogram)->Fill(rng.Gaus(0.2, 1.3));
+      },
+      [histogram] { histogram->reset(); });
+}
+#endif
+
+#ifdef BENCHSUITE_WITH_ROOFIT
+/// The model and data of the RooFit NLL benchmark
+struct RooFitModel {
+   RooRealVar fX{"x", "x", -10, 10};
+   RooRealVar fMean{"mean", "mean", 0.2, -5, 5};
+   RooRealVar fSigma{"sigma", "sigma", 1.3, 0.1, 10};
+   RooGaussian fPdf{"gauss", "gauss", fX, fMean, fSigma};
+   std::unique_ptr<RooDataSet> fData;
+   std::unique_ptr<RooAbsReal> fNLL;
+};
+
+void AddRooFitBenchmarks()
+{
+   auto model = std::make_shared<std::unique_ptr<RooFitModel>>();
+   const Int_t nEvaluations = 200;
+   AddBenchmark(
+      "RooFit/NLL/Gaussian",
+      [model, nEvaluations](BenchCounters &counters) {
+         auto &m = **model;
+         Double_t sum = 0;
+         for (Int_t i = 0; i < nEvaluations; ++i) {
+            m.fMean.setVal(0.2 + 1e-3 * i);
+            sum += m.fNLL->getVal();
+         }
+         if (!std::isfinite(sum))
+            printf("Error in RooFit/NLL/Gaussian: NLL is not finite\n");
+         counters.fItems = nEvaluations;
+      },
+      [model] {
+         RooMsgService::instance().setGlobalKillBelow(RooFit::WARNING);
+         RooRandom::randomGenerator()->SetSeed(4357);
+         model->reset(new RooFitModel);
+         auto &m = **model;
+         m.fData = std::unique_ptr<RooDataSet>{m.fPdf.generate(m.fX, gOptions.fNEvents)};
+         m.fNLL = std::unique_ptr<RooAbsReal>{m.fPdf.createNLL(*m.fData)};
+      },
+      [model] { model->reset(); });
+}
+#endif
+
+//--SOFIE-------------------------------------------------------------------------------------------
+
+#ifdef BENCHSUITE_WITH_SOFIE
+void AddSofieBenchmarks()
+{
+   // Linear_16: dense network with 100 inputs, evaluated in batches of 16 events
+   const std::string modelPath = BENCHSUITE_SOFIE_MODEL;
+   const size_t nFeatures = 100;
+   const size_t nEvents = 16 * 256;
+   auto reader = std::make_shared<std::unique_ptr<TMVA::Experimental::RSofieReader>>();
+   auto input = std::make_shared<std::unique_ptr<TMVA::Experimental::RTensor<float>>>();
+   AddBenchmark(
+      "SOFIE/Linear_16",
+      [reader, input, nEvents](BenchCounters &counters) {
+         auto output = (*reader)->Compute(**input);
+         if (output.GetShape().empty() || output.GetShape()[0] != nEvents)
+            printf("Error in SOFIE/Linear_16: unexpected output shape\n");
+         counters.fItems = nEvents;
+      },
+      [reader, input, modelPath, nFeatures, nEvents] {
+         reader->reset(new TMVA::Experimental::RSofieReader(modelPath));
+         input->reset(new TMVA::Experimental::RTensor<float>({nEvents, nFeatures}));
+         TRandom3 rng(4357);
+         auto data = (*input)->GetData();
+         for (size_t i = 0; i < nEvents * nFeatures; ++i)
+            data[i] = rng.Gaus(0, 1);
+      },
+      [reader, input] {
+         reader->reset();
+         input->reset();
+      });
+}
+#endif
+
+//--Driver------------------------------------------------------------------------------------------
+
+BenchResult RunBenchmark(const Benchmark &benchmark)
+{
+   if (benchmark.fSetup)
+      benchmark.fSetup();
+
+   TStopwatch timer;
+   BenchCounters counters;
+   // Warm up the caches and the interpreter, e.g. for the RDataFrame JIT
+   benchmark.fRun(counters);
+
+   std::vector<Double_t> realTimes, cpuTimes;
+   for (Int_t i = 0; i < gOptions.fRepetitions; ++i) {
+      counters = BenchCounters();
+      timer.Start(kTRUE);
+      benchmark.fRun(counters);
+      timer.Stop();
+      realTimes.push_back(1e3 * timer.RealTime());
+      cpuTimes.push_back(1e3 * timer.CpuTime());
+   }
+
+   if (benchmark.fTearDown)
+      benchmark.fTearDown();
+
+   BenchResult result;
+   result.fName = benchmark.fName;
+   result.fRepetitions = gOptions.fRepetitions;
+   result.fRealMedian = Median(realTimes);
+   result.fCpuMedian = Median(cpuTimes);
+   for (auto t : realTimes)
+      result.fRealMean += t / realTimes.size();
+   for (auto t : realTimes)
+      result.fRealStddev += (t - result.fRealMean) * (t - result.fRealMean);
+   if (realTimes.size() > 1)
+      result.fRealStddev = std::sqrt(result.fRealStddev / (realTimes.size() - 1));
+   if (result.fRealMedian > 0) {
+      result.fItemsPerSecond = counters.fItems / (1e-3 * result.fRealMedian);
+      result.fBytesPerSecond = counters.fBytes / (1e-3 * result.fRealMedian);
+   }
+   return result;
+}
+
+std::string JSONString(const std::string &value)
+{
+   std::string result = "\"";
+   for (char c : value) {
+      if (c == '"' || c == '\\')
+         result += '\\';
+      result += c;
+   }
+   return result + "\"";
+}
+
+/// Writes the results in the JSON format of google-benchmark, with the median, mean and stddev aggregates
+bool WriteJSON(const std::string &path, const std::vector<BenchResult> &results)
+{
+   FILE *out = fopen(path.c_str(), "w");
+   if (!out)
+      return false;
+
+   SysInfo_t sysInfo;
+   gSystem->GetSysInfo(&sysInfo);
+   fprintf(out, "{\n  \"context\": {\n");
+   fprintf(out, "    \"date\": %s,\n", JSONString(TTimeStamp().AsString("s")).c_str());
+   fprintf(out, "    \"host_name\": %s,\n", JSONString(gSystem->HostName()).c_str());
+   fprintf(out, "    \"executable\": \"benchSuite\",\n");
+   fprintf(out, "    \"num_cpus\": %d,\n", sysInfo.fCpus);
+   fprintf(out, "    \"mhz_per_cpu\": %d,\n", sysInfo.fCpuSpeed);
+   fprintf(out, "    \"root_version\": %s,\n", JSONString(gROOT->GetVersion()).c_str());
+   fprintf(out, "    \"root_git_commit\": %s,\n", JSONString(gROOT->GetGitCommit()).c_str());
+   fprintf(out, "    \"num_events\": %lld,\n", gOptions.fNEvents);
+   fprintf(out, "    \"num_threads\": %d\n", gOptions.fNThreads);
+   fprintf(out, "  },\n  \"benchmarks\": [");
+
+   bool isFirst = true;
+   for (const auto &r : results) {
+      const std::pair<const char *, Double_t> aggregates[] = {
+         {"median", r.fRealMedian}, {"mean", r.fRealMean}, {"stddev", r.fRealStddev}};
+      for (const auto &aggregate : aggregates) {
+         fprintf(out, "%s\n    {\n", isFirst ? "" : ",");
+         isFirst = false;
+         fprintf(out, "      \"name\": %s,\n", JSONString(r.fName + "_" + aggregate.first).c_str());
+         fprintf(out, "      \"run_name\": %s,\n", JSONString(r.fName).c_str());
+         fprintf(out, "      \"run_type\": \"aggregate\",\n");
+         fprintf(out, "      \"aggregate_name\": \"%s\",\n", aggregate.first);
+         fprintf(out, "      \"repetitions\": %d,\n", r.fRepetitions);
+         fprintf(out, "      \"iterations\": 1,\n");
+         fprintf(out, "      \"real_time\": %.6f,\n", aggregate.second);
+         fprintf(out, "      \"cpu_time\": %.6f,\n", r.fCpuMedian);
+         fprintf(out, "      \"time_unit\": \"ms\",\n");
+         fprintf(out, "      \"items_per_second\": %.6e,\n", r.fItemsPerSecond);
+         fprintf(out, "      \"bytes_per_second\": %.6e\n", r.fBytesPerSecond);
+         fprintf(out, "    }");
+      }
+   }
+   fprintf(out, "\n  ]\n}\n");
+   return fclose(out) == 0;
+}
+
+void Usage()
+{
+   printf("Usage: benchSuite [-l] [-f regexp] [-r repetitions] [-n events] [-t threads] [-d dir] [-o file.json]\n");
+}
+
+} // anonymous namespace
+
+int main(int argc, char **argv)
+{
+   gOptions.fDataDir = gSystem->TempDirectory();
+   for (int i = 1; i < argc; ++i) {
+      const bool hasValue = i + 1 < argc;
+      if (!strcmp(argv[i], "-l")) {
+         gOptions.fList = true;
+      } else if (!strcmp(argv[i], "-f") && hasValue) {
+         gOptions.fFilter = argv[++i];
+      } else if (!strcmp(argv[i], "-r") && hasValue) {
+         gOptions.fRepetitions = std::max(1, atoi(argv[++i]));
+      } else if (!strcmp(argv[i], "-n") && hasValue) {
+         gOptions.fNEvents = std::max(1LL, atoll(argv[++i]));
+      } else if (!strcmp(argv[i], "-t") && hasValue) {
+         gOptions.fNThreads = atoi(argv[++i]);
+      } else if (!strcmp(argv[i], "-d") && hasValue) {
+         gOptions.fDataDir = argv[++i];
+      } else if (!strcmp(argv[i], "-o") && hasValue) {
+         gOptions.fOutput = argv[++i];
+      } else {
+         Usage();
+         return 1;
+      }
+   }
+
+   AddTreeBenchmarks();
+#ifdef BENCHSUITE_WITH_NTUPLE
+   AddNTupleBenchmarks();
+#endif
+#ifdef BENCHSUITE_WITH_DATAFRAME
+   AddDataFrameBenchmarks();
+#endif
+   AddHistogramBenchmarks();
+#ifdef BENCHSUITE_WITH_MINUIT2
+   AddMinuit2Benchmarks();
+#endif
+#ifdef BENCHSUITE_WITH_ROOFIT
+   AddRooFitBenchmarks();
+#endif
+#ifdef BENCHSUITE_WITH_SOFIE
+   AddSofieBenchmarks();
+#endif
+
+   TPRegexp filter(gOptions.fFilter.c_str());
+   std::vector<const Benchmark *> selected;
+   for (const auto &benchmark : GetBenchmarks()) {
+      if (gOptions.fFilter.empty() || filter.Match(benchmark.fName.c_str()))
+         selected.push_back(&benchmark);
+   }
+   if (gOptions.fList) {
+      for (const auto *benchmark : selected)
+         printf("%s\n", benchmark->fName.c_str());
+      return 0;
+   }
+
+#ifdef R__USE_IMT
+   if (gOptions.fNThreads > 0)
+      ROOT::EnableImplicitMT(gOptions.fNThreads);
+#endif
+
+   printf("%-32s %12s %12s %12s %14s %12s\n", "Benchmark", "Real [ms]", "Stddev [ms]", "CPU [ms]", "Items/s",
+          "MB/s");
+   std::vector<BenchResult> results;
+   for (const auto *benchmark : selected) {
+      results.push_back(RunBenchmark(*benchmark));
+      const auto &r = results.back();
+      printf("%-32s %12.2f %12.2f %12.2f %14.4g %12.2f\n", r.fName.c_str(), r.fRealMedian, r.fRealStddev,
+             r.fCpuMedian, r.fItemsPerSecond, 1e-6 * r.fBytesPerSecond);
+   }
+
+   if (!gOptions.fOutput.empty() && !WriteJSON(gOptions.fOutput, results)) {
+      printf("Error in benchSuite: cannot write %s\n", gOptions.fOutput.c_str());
+      return 1;
+   }
+   return 0;
+}
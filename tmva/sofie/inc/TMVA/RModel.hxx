@@ -9,6 +9,7 @@
 #include <memory>
 #include <ctime>
 #include <set>
+#include <map>
 #include <iomanip>
 #include <fstream>
 #include <sstream>
@@ -24,6 +25,13 @@ enum class Options {
    kDefault = 0x0,
    kNoSession = 0x1,
    kNoWeightFile = 0x2,
+   /// Generate CUDA code, to be compiled with nvcc and linked against cuBLAS. The weights are copied to the GPU when
+   /// the Session is created and the inference runs on the GPU; infer() copies the inputs to and the outputs from the
+   /// device. Requires a Session, float inputs, and operators supporting the GPU (ROperator::SupportsGPU()).
+   kGPU = 0x4,
+   /// Write the weights to a binary file that the generated Session memory maps instead of reading it, see
+   /// RWeightFile. All the sessions of a process share the weights, and only hold their intermediate tensors.
+   kMmapWeights = 0x8,
 };
 
 std::underlying_type_t<Options> operator|(Options opA, Options opB);
@@ -54,6 +62,21 @@ private:
    std::unordered_set<std::string> fCustomOpHeaders;
    bool fUseWeightFile = true;
    bool fUseSession = true;
+   bool fUseGPU = false; //!
+   bool fUseMmapWeights = false; //!
+   // offsets of the float weight tensors in the binary weight file, and the size of the file
+   std::map<std::string, size_t> fWeightOffsets; //!
+   size_t fWeightFileSize = 0; //!
+
+   // memory plan of the intermediate tensors: buffer holding each tensor and type and length of each buffer
+   std::unordered_map<std::string, std::string> fIntermediateTensorBuffers; //!
+   std::map<std::string, std::pair<ETensorType, size_t>> fIntermediateBuffers; //!
+
+   void FindOperatorTensors(std::vector<std::set<std::string>> &opTensors, std::set<std::string> &pinnedTensors);
+   void FuseOperators();
+   void PlanIntermediateMemory();
+   void GenerateGPUSessionCode();
+   void PlanWeightFile();
 
 public:
 
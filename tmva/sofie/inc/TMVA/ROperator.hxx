@@ -30,6 +30,13 @@ public:
    // generate session data members specific to operator
    virtual std::string GenerateSessionMembersCode(std::string /*opName*/) { return ""; }
    virtual std::string Header() { return "";}
+   // fuse an elementwise Relu of the output tensor nameX into the operator, writing the result into nameY
+   // returns false if the operator does not support it or does not produce nameX
+   virtual bool FuseRelu(const std::string & /*nameX*/, const std::string & /*nameY*/) { return false; }
+   // whether the operator can generate code for the CUDA backend (see Options::kGPU)
+   virtual bool SupportsGPU() const { return false; }
+   // generate the inference code for the CUDA backend, where the tensors d_tensor_<name> are device pointers
+   virtual std::string GenerateGPU(std::string /*OpName*/) { return ""; }
 
 
    //virtual void Forward_reference() = 0;
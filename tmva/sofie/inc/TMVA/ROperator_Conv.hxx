@@ -41,6 +41,7 @@ private:
    std::string fType;
 
    size_t fDim;   // dimension of the convolution
+   bool fFusedRelu = false; // apply a Relu on the output
 
 
 public:
@@ -531,11 +532,28 @@ public:
              << OpName << "_incx, tensor_" << fNY << " + out_offset, &" << OpName << "_incy);\n";
 
       }
+      if (fFusedRelu) {
+         // apply the Relu on the output of the current batch, which is still in the cache
+         size_t outputSize = fShapeY[1] * oDepth * oHeight * oWidth;
+         out << SP << SP << "for (size_t id = n * " << outputSize << "; id < (n + 1) * " << outputSize << "; id++) {\n";
+         out << SP << SP << SP << "tensor_" << fNY << "[id] = ((tensor_" << fNY << "[id] > 0 )? tensor_" << fNY
+             << "[id] : 0);\n";
+         out << SP << SP << "}\n";
+      }
       out << SP << "}\n"; // end of batch size loop
 
       return out.str();
       }
 
+   /*! \brief Fuses a Relu applied on the output, which is then written into nameY
+    */
+   bool FuseRelu(const std::string &nameX, const std::string &nameY) {
+      if (nameX != fNY) return false;
+      fNY = nameY;
+      fFusedRelu = true;
+      return true;
+   }
+
    /*! \brief Returns the blas routines needed to compile the generated code
     */
    std::vector<std::string> GetBlasRoutines() { return { std::string("Gemm"), std::string("Axpy") }; }
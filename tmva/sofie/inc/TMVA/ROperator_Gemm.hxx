@@ -39,6 +39,7 @@ namespace SOFIE{
       std::vector<size_t> fShapeY;
 
       std::string fType;
+      bool fFusedRelu = false; // apply a Relu on the output
 
    public:
 
@@ -222,11 +223,59 @@ namespace SOFIE{
              << ", &" << OpName << "_ldb, " << "tensor_" << fNA << ", &" << OpName << "_lda, &" << OpName << "_beta, " << "tensor_" << fNY << ", &"
              << OpName << "_n);\n";
           }
+         if (fFusedRelu) {
+            out << SP << "for (int id = 0; id < " << ConvertShapeToLength(fShapeY) << " ; id++){\n";
+            out << SP << SP << "tensor_" << fNY << "[id] = ((tensor_" << fNY << "[id] > 0 )? tensor_" << fNY
+                << "[id] : 0);\n";
+            out << SP << "}\n";
+         }
 
           return out.str();
 
          }
 
+         bool SupportsGPU() const { return fType == "float"; }
+
+         std::string GenerateGPU(std::string OpName){
+            OpName = "op_" + OpName;
+
+            if (fShapeA.empty() || fShapeB.empty() || fShapeY.empty() || (fNC != "" && fShapeC.empty())) {
+               throw std::runtime_error("TMVA SOFIE Gemm Op called to Generate without being initialized first");
+            }
+            if (fNC == "" && fAttrBeta != 0) {
+               throw std::runtime_error("TMVA SOFIE Gemm Op : Bias tensor is not present but beta value in Gemm is not zero");
+            }
+            int m = (fAttrTransA ? fShapeA[1] : fShapeA[0]);
+            int n = (fAttrTransB ? fShapeB[0] : fShapeB[1]);
+            int k = (fAttrTransA ? fShapeA[0] : fShapeA[1]);
+            size_t length = ConvertShapeToLength(fShapeY);
+            std::stringstream out;
+            out << "\n//--------- Gemm (CUDA)\n";
+            if (fNC != "") {
+               out << SP << "GPU::Check(cudaMemcpy(d_tensor_" << fNY << ", d_tensor_" << fNC2 << ", " << length
+                   << " * sizeof(float), cudaMemcpyDeviceToDevice));\n";
+            }
+            out << SP << "float " << OpName << "_alpha = " << std::setprecision(std::numeric_limits<float>::max_digits10) << fAttrAlpha << ";\n";
+            out << SP << "float " << OpName << "_beta = " << std::setprecision(std::numeric_limits<float>::max_digits10) << fAttrBeta << ";\n";
+            // cuBLAS is column major like the Fortran BLAS: compute Y^T = B^T A^T as the CPU code does
+            out << SP << "GPU::Check(cublasSgemm(fCublasHandle, " << (fAttrTransB ? "CUBLAS_OP_T" : "CUBLAS_OP_N") << ", "
+                << (fAttrTransA ? "CUBLAS_OP_T" : "CUBLAS_OP_N") << ", " << n << ", " << m << ", " << k << ", &" << OpName
+                << "_alpha, d_tensor_" << fNB << ", " << (fAttrTransB ? k : n) << ", d_tensor_" << fNA << ", "
+                << (fAttrTransA ? m : k) << ", &" << OpName << "_beta, d_tensor_" << fNY << ", " << n << "));\n";
+            if (fFusedRelu) {
+               out << SP << "GPU::Relu<<<GPU::NBlocks(" << length << "), GPU::kBlockSize>>>(" << length << ", d_tensor_"
+                   << fNY << ", d_tensor_" << fNY << ");\n";
+            }
+            return out.str();
+         }
+
+         bool FuseRelu(const std::string &nameX, const std::string &nameY) {
+            if (nameX != fNY || fType != "float") return false;
+            fNY = nameY;
+            fFusedRelu = true;
+            return true;
+         }
+
          std::vector<std::string> GetBlasRoutines() { return { std::string("Gemm"), std::string("Gemv") }; }
 
    };
@@ -0,0 +1,127 @@
+#ifndef TMVA_SOFIE_ROPERATOR_QLINEARMATMUL
+#define TMVA_SOFIE_ROPERATOR_QLINEARMATMUL
+
+#include "TMVA/SOFIE_common.hxx"
+#include "TMVA/ROperator.hxx"
+#include "TMVA/ROperator_QuantizeLinear.hxx"
+#include "TMVA/RModel.hxx"
+
+#include <limits>
+#include <sstream>
+
+namespace TMVA{
+namespace Experimental{
+namespace SOFIE{
+
+/// Matrix multiplication of int8 or uint8 tensors with per-tensor quantization parameters.
+/// The products are accumulated in 32 bit integers and requantized with the output scale and zero point.
+/// The second input must be a matrix, while the leading dimensions of the first input are flattened.
+template <typename T>
+class ROperator_QLinearMatMul final : public ROperator
+{
+
+private:
+
+   std::string fNA;
+   std::string fNAScale;
+   std::string fNAZeroPoint;
+   std::string fNB;
+   std::string fNBScale;
+   std::string fNBZeroPoint;
+   std::string fNYScale;
+   std::string fNYZeroPoint;
+   std::string fNY;
+   std::vector<size_t> fShapeA;
+   std::vector<size_t> fShapeB;
+   std::vector<size_t> fShapeY;
+   float fMultiplier = 1.; // a_scale * b_scale / y_scale
+   int fAZeroPoint = 0;
+   int fBZeroPoint = 0;
+   int fYZeroPoint = 0;
+
+public:
+   ROperator_QLinearMatMul(){}
+   ROperator_QLinearMatMul(std::string nameA, std::string nameAScale, std::string nameAZeroPoint,
+                           std::string nameB, std::string nameBScale, std::string nameBZeroPoint,
+                           std::string nameYScale, std::string nameYZeroPoint, std::string nameY):
+      fNA(UTILITY::Clean_name(nameA)), fNAScale(UTILITY::Clean_name(nameAScale)),
+      fNAZeroPoint(UTILITY::Clean_name(nameAZeroPoint)), fNB(UTILITY::Clean_name(nameB)),
+      fNBScale(UTILITY::Clean_name(nameBScale)), fNBZeroPoint(UTILITY::Clean_name(nameBZeroPoint)),
+      fNYScale(UTILITY::Clean_name(nameYScale)), fNYZeroPoint(UTILITY::Clean_name(nameYZeroPoint)),
+      fNY(UTILITY::Clean_name(nameY)){}
+
+   std::vector<ETensorType> TypeInference(std::vector<ETensorType> input){
+      return { input[0] };
+   }
+
+   std::vector<std::vector<size_t>> ShapeInference(std::vector<std::vector<size_t>> input){
+      if (input.size() != 2 || input[0].empty() || input[1].size() != 2 || input[0].back() != input[1][0]) {
+         throw std::runtime_error("TMVA SOFIE QLinearMatMul Op has invalid input shapes");
+      }
+      auto ret = input[0];
+      ret.back() = input[1][1];
+      return { ret };
+   }
+
+   void Initialize(RModel& model){
+      if (model.CheckIfTensorAlreadyExist(fNA) == false){
+         throw std::runtime_error("TMVA SOFIE QLinearMatMul Op Input Tensor " + fNA + " is not found in model");
+      }
+      if (model.CheckIfTensorAlreadyExist(fNB) == false){
+         throw std::runtime_error("TMVA SOFIE QLinearMatMul Op Input Tensor " + fNB + " is not found in model");
+      }
+      fShapeA = model.GetTensorShape(fNA);
+      fShapeB = model.GetTensorShape(fNB);
+      fShapeY = ShapeInference({fShapeA, fShapeB})[0];
+      fMultiplier = UTILITY::GetQuantizationScale(model, fNAScale) * UTILITY::GetQuantizationScale(model, fNBScale) /
+                    UTILITY::GetQuantizationScale(model, fNYScale);
+      fAZeroPoint = UTILITY::GetQuantizationZeroPoint(model, fNAZeroPoint);
+      fBZeroPoint = UTILITY::GetQuantizationZeroPoint(model, fNBZeroPoint);
+      fYZeroPoint = UTILITY::GetQuantizationZeroPoint(model, fNYZeroPoint);
+      model.AddIntermediateTensor(fNY, model.GetTensorType(fNA), fShapeY);
+   }
+
+   std::string Generate(std::string OpName){
+      OpName = "op_" + OpName;
+      if (fShapeY.empty()) {
+         throw std::runtime_error("TMVA SOFIE Operator QLinearMatMul called to Generate without being initialized first");
+      }
+      size_t k = fShapeB[0];
+      size_t n = fShapeB[1];
+      size_t m = ConvertShapeToLength(fShapeA) / k;
+      std::stringstream out;
+      out << "\n//------ QLINEARMATMUL\n";
+      // accumulate a row of the output at a time, the inner loop over the columns of B is vectorized
+      out << SP << "{\n";
+      out << SP << SP << "std::vector<int32_t> " << OpName << "_acc(" << n << ");\n";
+      out << SP << SP << "for (size_t i = 0; i < " << m << "; i++) {\n";
+      out << SP << SP << SP << "std::fill(" << OpName << "_acc.begin(), " << OpName << "_acc.end(), 0);\n";
+      out << SP << SP << SP << "for (size_t l = 0; l < " << k << "; l++) {\n";
+      out << SP << SP << SP << SP << "const int32_t a = int32_t(tensor_" << fNA << "[i * " << k << " + l]) - "
+          << fAZeroPoint << ";\n";
+      out << SP << SP << SP << SP << "const auto * b = tensor_" << fNB << " + l * " << n << ";\n";
+      out << SP << SP << SP << SP << "for (size_t j = 0; j < " << n << "; j++)\n";
+      out << SP << SP << SP << SP << SP << OpName << "_acc[j] += a * (int32_t(b[j]) - " << fBZeroPoint << ");\n";
+      out << SP << SP << SP << "}\n";
+      out << SP << SP << SP << "for (size_t j = 0; j < " << n << "; j++) {\n";
+      out << SP << SP << SP << SP << "float y = std::nearbyint(" << OpName << "_acc[j] * "
+          << std::setprecision(std::numeric_limits<float>::max_digits10) << fMultiplier << ") + " << fYZeroPoint
+          << ";\n";
+      out << SP << SP << SP << SP << "tensor_" << fNY << "[i * " << n << " + j] = std::min("
+          << int(std::numeric_limits<T>::max()) << ".f, std::max(" << int(std::numeric_limits<T>::min())
+          << ".f, y));\n";
+      out << SP << SP << SP << "}\n";
+      out << SP << SP << "}\n";
+      out << SP << "}\n";
+      return out.str();
+   }
+
+   std::vector<std::string> GetStdLibs() { return { std::string("cmath"), std::string("algorithm") };}
+};
+
+}//SOFIE
+}//Experimental
+}//TMVA
+
+
+#endif //TMVA_SOFIE_ROPERATOR_QLINEARMATMUL
@@ -0,0 +1,162 @@
+#ifndef TMVA_SOFIE_ROPERATOR_QUANTIZELINEAR
+#define TMVA_SOFIE_ROPERATOR_QUANTIZELINEAR
+
+#include "TMVA/SOFIE_common.hxx"
+#include "TMVA/ROperator.hxx"
+#include "TMVA/RModel.hxx"
+
+#include <limits>
+#include <sstream>
+
+namespace TMVA{
+namespace Experimental{
+namespace SOFIE{
+
+namespace UTILITY{
+// Scale of a per-tensor quantization, which must be an initialized scalar float tensor
+inline float GetQuantizationScale(RModel& model, const std::string& name){
+   if (!model.IsInitializedTensor(name) || model.GetTensorType(name) != ETensorType::FLOAT)
+      throw std::runtime_error("TMVA SOFIE quantization scale " + name + " is not an initialized float tensor");
+   if (ConvertShapeToLength(model.GetTensorShape(name)) != 1)
+      throw std::runtime_error("TMVA SOFIE quantization scale " + name + " : only per-tensor quantization is supported");
+   return static_cast<float *>(model.GetInitializedTensorData(name).get())[0];
+}
+
+// Zero point of a per-tensor quantization, which must be an initialized scalar int8 or uint8 tensor.
+// An empty name means a zero point of 0.
+inline int GetQuantizationZeroPoint(RModel& model, const std::string& name){
+   if (name.empty()) return 0;
+   if (!model.IsInitializedTensor(name))
+      throw std::runtime_error("TMVA SOFIE quantization zero point " + name + " is not an initialized tensor");
+   if (ConvertShapeToLength(model.GetTensorShape(name)) != 1)
+      throw std::runtime_error("TMVA SOFIE quantization zero point " + name + " : only per-tensor quantization is supported");
+   auto data = model.GetInitializedTensorData(name);
+   switch (model.GetTensorType(name)) {
+      case ETensorType::INT8: return static_cast<int8_t *>(data.get())[0];
+      case ETensorType::UNINT8: return static_cast<uint8_t *>(data.get())[0];
+      default:
+         throw std::runtime_error("TMVA SOFIE quantization zero point " + name + " is not of type int8 or uint8");
+   }
+}
+}//UTILITY
+
+/// Quantization of a float tensor to int8 or uint8: y = saturate(round(x / scale) + zero_point)
+template <typename T>
+class ROperator_QuantizeLinear final : public ROperator
+{
+
+private:
+
+   std::string fNX;
+   std::string fNScale;
+   std::string fNZeroPoint;
+   std::string fNY;
+   std::vector<size_t> fShape;
+   float fScale = 1.;
+   int fZeroPoint = 0;
+
+public:
+   ROperator_QuantizeLinear(){}
+   ROperator_QuantizeLinear(std::string nameX, std::string nameScale, std::string nameZeroPoint, std::string nameY):
+      fNX(UTILITY::Clean_name(nameX)), fNScale(UTILITY::Clean_name(nameScale)),
+      fNZeroPoint(UTILITY::Clean_name(nameZeroPoint)), fNY(UTILITY::Clean_name(nameY)){}
+
+   std::vector<ETensorType> TypeInference(std::vector<ETensorType> /*input*/){
+      return { GetTemplatedType(T()) };
+   }
+
+   std::vector<std::vector<size_t>> ShapeInference(std::vector<std::vector<size_t>> input){
+      return { input[0] };
+   }
+
+   void Initialize(RModel& model){
+      if (model.CheckIfTensorAlreadyExist(fNX) == false){
+         throw std::runtime_error("TMVA SOFIE QuantizeLinear Op Input Tensor " + fNX + " is not found in model");
+      }
+      fShape = model.GetTensorShape(fNX);
+      fScale = UTILITY::GetQuantizationScale(model, fNScale);
+      fZeroPoint = UTILITY::GetQuantizationZeroPoint(model, fNZeroPoint);
+      model.AddIntermediateTensor(fNY, GetTemplatedType(T()), fShape);
+   }
+
+   std::string Generate(std::string OpName){
+      OpName = "op_" + OpName;
+      if (fShape.empty()) {
+         throw std::runtime_error("TMVA SOFIE Operator QuantizeLinear called to Generate without being initialized first");
+      }
+      std::stringstream out;
+      size_t length = ConvertShapeToLength(fShape);
+      out << "\n//------ QUANTIZELINEAR\n";
+      out << SP << "for (int id = 0; id < " << length << " ; id++){\n";
+      out << SP << SP << "float y = std::nearbyint(tensor_" << fNX << "[id] / "
+          << std::setprecision(std::numeric_limits<float>::max_digits10) << fScale << ") + " << fZeroPoint << ";\n";
+      out << SP << SP << "tensor_" << fNY << "[id] = std::min(" << int(std::numeric_limits<T>::max())
+          << ".f, std::max(" << int(std::numeric_limits<T>::min()) << ".f, y));\n";
+      out << SP << "}\n";
+      return out.str();
+   }
+
+   std::vector<std::string> GetStdLibs() { return { std::string("cmath"), std::string("algorithm") };}
+};
+
+/// Dequantization of an int8 or uint8 tensor to float: y = (x - zero_point) * scale
+template <typename T>
+class ROperator_DequantizeLinear final : public ROperator
+{
+
+private:
+
+   std::string fNX;
+   std::string fNScale;
+   std::string fNZeroPoint;
+   std::string fNY;
+   std::vector<size_t> fShape;
+   float fScale = 1.;
+   int fZeroPoint = 0;
+
+public:
+   ROperator_DequantizeLinear(){}
+   ROperator_DequantizeLinear(std::string nameX, std::string nameScale, std::string nameZeroPoint, std::string nameY):
+      fNX(UTILITY::Clean_name(nameX)), fNScale(UTILITY::Clean_name(nameScale)),
+      fNZeroPoint(UTILITY::Clean_name(nameZeroPoint)), fNY(UTILITY::Clean_name(nameY)){}
+
+   std::vector<ETensorType> TypeInference(std::vector<ETensorType> /*input*/){
+      return { ETensorType::FLOAT };
+   }
+
+   std::vector<std::vector<size_t>> ShapeInference(std::vector<std::vector<size_t>> input){
+      return { input[0] };
+   }
+
+   void Initialize(RModel& model){
+      if (model.CheckIfTensorAlreadyExist(fNX) == false){
+         throw std::runtime_error("TMVA SOFIE DequantizeLinear Op Input Tensor " + fNX + " is not found in model");
+      }
+      fShape = model.GetTensorShape(fNX);
+      fScale = UTILITY::GetQuantizationScale(model, fNScale);
+      fZeroPoint = UTILITY::GetQuantizationZeroPoint(model, fNZeroPoint);
+      model.AddIntermediateTensor(fNY, ETensorType::FLOAT, fShape);
+   }
+
+   std::string Generate(std::string OpName){
+      OpName = "op_" + OpName;
+      if (fShape.empty()) {
+         throw std::runtime_error("TMVA SOFIE Operator DequantizeLinear called to Generate without being initialized first");
+      }
+      std::stringstream out;
+      size_t length = ConvertShapeToLength(fShape);
+      out << "\n//------ DEQUANTIZELINEAR\n";
+      out << SP << "for (int id = 0; id < " << length << " ; id++){\n";
+      out << SP << SP << "tensor_" << fNY << "[id] = float(int(tensor_" << fNX << "[id]) - " << fZeroPoint << ") * "
+          << std::setprecision(std::numeric_limits<float>::max_digits10) << fScale << ";\n";
+      out << SP << "}\n";
+      return out.str();
+   }
+};
+
+}//SOFIE
+}//Experimental
+}//TMVA
+
+
+#endif //TMVA_SOFIE_ROPERATOR_QUANTIZELINEAR
@@ -26,6 +26,9 @@ public:
    ROperator_Relu(std::string nameX, std::string nameY):
       fNX(UTILITY::Clean_name(nameX)), fNY(UTILITY::Clean_name(nameY)){}
 
+   const std::string &GetInputName() const { return fNX; }
+   const std::string &GetOutputName() const { return fNY; }
+
    std::vector<ETensorType> TypeInference(std::vector<ETensorType> input){
       return input;
    }
@@ -61,6 +64,21 @@ public:
       return out.str();
    }
 
+   bool SupportsGPU() const { return true; }
+
+   std::string GenerateGPU(std::string OpName){
+      OpName = "op_" + OpName;
+      if (fShape.empty()) {
+         throw std::runtime_error("TMVA SOFIE Operator Relu called to Generate without being initialized first");
+      }
+      std::stringstream out;
+      size_t length = ConvertShapeToLength(fShape);
+      out << "\n//------ RELU (CUDA)\n";
+      out << SP << "GPU::Relu<<<GPU::NBlocks(" << length << "), GPU::kBlockSize>>>(" << length << ", d_tensor_" << fNX
+          << ", d_tensor_" << fNY << ");\n";
+      return out.str();
+   }
+
 };
 
 }//SOFIE
@@ -60,6 +60,21 @@ public:
       return out.str();
    }
 
+   bool SupportsGPU() const { return true; }
+
+   std::string GenerateGPU(std::string OpName){
+      OpName = "op_" + OpName;
+      if (fShape.empty()) {
+         throw std::runtime_error("TMVA SOFIE Operator Tanh called to Generate without being initialized first");
+      }
+      std::stringstream out;
+      size_t length = ConvertShapeToLength(fShape);
+      out << "\n//------ TANH (CUDA)\n";
+      out << SP << "GPU::Tanh<<<GPU::NBlocks(" << length << "), GPU::kBlockSize>>>(" << length << ", d_tensor_" << fNX
+          << ", d_tensor_" << fNY << ");\n";
+      return out.str();
+   }
+
    std::vector<std::string> GetStdLibs() { return { std::string("cmath") };}
 };
 
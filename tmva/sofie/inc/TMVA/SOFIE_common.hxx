@@ -70,6 +70,8 @@ struct InitializedTensor{
          case ETensorType::DOUBLE: fSize*=sizeof(double); break;
          case ETensorType::INT32: fSize*=sizeof(int32_t); break;
          case ETensorType::INT64: fSize*=sizeof(int64_t); break;
+         case ETensorType::INT8: fSize*=sizeof(int8_t); break;
+         case ETensorType::UNINT8: fSize*=sizeof(uint8_t); break;
          default:
           throw std::runtime_error("TMVA::SOFIE doesn't yet supports serialising data-type " + ConvertTypeToString(fType));
       }
@@ -101,6 +103,13 @@ struct InitializedTensor{
           fData = tData;
           break;
       }
+      case ETensorType::INT8:
+      case ETensorType::UNINT8: {
+          std::shared_ptr<void> tData(malloc(fSize), free);
+          std::memcpy(tData.get(), fPersistentData, fSize);
+          fData = tData;
+          break;
+      }
       default: {
           throw std::runtime_error("TMVA::SOFIE doesn't yet supports serialising data-type " +
                                    ConvertTypeToString(fType));
@@ -127,6 +136,35 @@ ETensorType GetTemplatedType(T /*obj*/ ){
    //complex 64, 28, bfloat 16 unimplemented
 }
 
+/// Read-only view of a binary weight file, written by RModel for the generated code with Options::kMmapWeights.
+/// The file is memory mapped, and all the sessions of a process that open the same file share the same mapping,
+/// such that the weights exist only once in memory however many sessions are created.
+class RWeightFile {
+private:
+   char *fData = nullptr;
+   std::size_t fSize = 0;
+
+   RWeightFile(const std::string &filename, std::size_t size);
+
+public:
+   /// Size of the file header; the tensors are stored after it, each one starting at a multiple of kAlignment
+   static constexpr std::size_t kHeaderSize = 64;
+   static constexpr std::size_t kAlignment = 64;
+   /// Identifies the format of the weight files
+   static constexpr char kMagic[8] = {'S', 'O', 'F', 'I', 'E', 'W', '0', '1'};
+
+   RWeightFile(const RWeightFile &) = delete;
+   RWeightFile &operator=(const RWeightFile &) = delete;
+   ~RWeightFile();
+
+   /// Returns the mapping of the given file, which is shared with the other users of the same file. Throws if the
+   /// file cannot be read or if its size is not the given expected size.
+   static std::shared_ptr<const RWeightFile> Open(const std::string &filename, std::size_t size);
+
+   /// Returns the tensor stored at the given offset of the file. The tensor is shared and must not be modified.
+   float *GetTensor(std::size_t offset) const { return reinterpret_cast<float *>(fData + offset); }
+};
+
 namespace UTILITY{
 // Check if two shapes are equal
 bool AreSameShape(const std::vector<size_t>&, const std::vector<size_t>&);
@@ -4,6 +4,7 @@
 
 #include "TMVA/RModel.hxx"
 #include "TMVA/SOFIE_common.hxx"
+#include "TMVA/ROperator_Relu.hxx"
 
 
 
@@ -12,6 +13,53 @@ namespace TMVA{
 namespace Experimental{
 namespace SOFIE{
 
+namespace {
+
+bool IsNameChar(char c) {
+   return std::isalnum(static_cast<unsigned char>(c)) || c == '_';
+}
+
+// collect the names of the tensors referenced in generated code as tensor_<name> or fTensor_<name>.
+// Tensors accessed through their vector or whose pointer is reassigned (e.g. by Identity) can not
+// share their memory and are added to pinned.
+void FindTensorNames(const std::string &code, std::set<std::string> &names, std::set<std::string> &pinned) {
+   const std::string pointerPrefix = "tensor_";
+   const std::string vectorPrefix = "fTensor_";
+   size_t pos = 0;
+   while (pos < code.size()) {
+      if (!IsNameChar(code[pos])) {
+         pos++;
+         continue;
+      }
+      size_t end = pos;
+      while (end < code.size() && IsNameChar(code[end])) end++;
+      std::string identifier = code.substr(pos, end - pos);
+      pos = end;
+
+      bool isPointer = identifier.compare(0, pointerPrefix.size(), pointerPrefix) == 0;
+      bool isVector = identifier.compare(0, vectorPrefix.size(), vectorPrefix) == 0;
+      if (!isPointer && !isVector) continue;
+      std::string name = identifier.substr(isPointer ? pointerPrefix.size() : vectorPrefix.size());
+      names.insert(name);
+      if (isVector) pinned.insert(name);
+
+      // pointer assignment "tensor_A = tensor_B"
+      auto assignment = code.find_first_not_of(' ', end);
+      if (!isPointer || assignment == std::string::npos || code[assignment] != '=' ||
+          code.compare(assignment, 2, "==") == 0)
+         continue;
+      auto rhs = code.find_first_not_of(' ', assignment + 1);
+      if (rhs != std::string::npos && code.compare(rhs, pointerPrefix.size(), pointerPrefix) == 0) {
+         auto rhsEnd = rhs;
+         while (rhsEnd < code.size() && IsNameChar(code[rhsEnd])) rhsEnd++;
+         pinned.insert(name);
+         pinned.insert(code.substr(rhs + pointerPrefix.size(), rhsEnd - rhs - pointerPrefix.size()));
+      }
+   }
+}
+
+} // namespace
+
    std::underlying_type_t<Options> operator|(Options opA, Options opB) {
       return static_cast<std::underlying_type_t<Options>>(opA) | static_cast<std::underlying_type_t<Options>>(opB);
    }
@@ -33,6 +81,8 @@ namespace SOFIE{
       fGC = other.fGC;
       fNeededBlasRoutines = other.fNeededBlasRoutines;
       fNeededStdLib = other.fNeededStdLib;
+      fIntermediateTensorBuffers = std::move(other.fIntermediateTensorBuffers);
+      fIntermediateBuffers = std::move(other.fIntermediateBuffers);
    }
 
    RModel& RModel::operator=(RModel&& other){
@@ -49,6 +99,8 @@ namespace SOFIE{
       fGC = other.fGC;
       fNeededBlasRoutines = other.fNeededBlasRoutines;
       fNeededStdLib = other.fNeededStdLib;
+      fIntermediateTensorBuffers = std::move(other.fIntermediateTensorBuffers);
+      fIntermediateBuffers = std::move(other.fIntermediateBuffers);
       return *this;
    }
 
@@ -237,17 +289,155 @@ namespace SOFIE{
       }
    }
 
+   void RModel::FindOperatorTensors(std::vector<std::set<std::string>> &opTensors,
+                                    std::set<std::string> &pinnedTensors){
+      // find the tensors used by each operator from its generated inference code; the tensors used
+      // in the session members and in the initialization code are pinned
+      opTensors.assign(fOperators.size(), {});
+      pinnedTensors.clear();
+      for (auto &name : fOutputTensorNames)
+         pinnedTensors.insert(name);
+      for (size_t id = 0; id < fOperators.size(); id++) {
+         std::string opName = std::to_string(id);
+         std::set<std::string> sessionTensors;
+         FindTensorNames(fOperators[id]->GenerateSessionMembersCode(opName) + fOperators[id]->GenerateInitCode(),
+                         sessionTensors, pinnedTensors);
+         pinnedTensors.insert(sessionTensors.begin(), sessionTensors.end());
+         FindTensorNames(fOperators[id]->Generate(opName), opTensors[id], pinnedTensors);
+      }
+   }
+
+   void RModel::FuseOperators(){
+      // fuse a Relu into the operator producing its input, if the input is an intermediate tensor without
+      // other users; this saves a full pass over the tensor and its memory
+      std::vector<std::set<std::string>> opTensors;
+      std::set<std::string> pinnedTensors;
+      FindOperatorTensors(opTensors, pinnedTensors);
+      for (size_t id = 1; id < fOperators.size(); id++) {
+         auto relu = dynamic_cast<ROperator_Relu<float> *>(fOperators[id].get());
+         if (!relu) continue;
+         const std::string nameX = relu->GetInputName();
+         if (fIntermediateTensorInfos.find(nameX) == fIntermediateTensorInfos.end() || pinnedTensors.count(nameX))
+            continue;
+         bool hasOtherUsers = false;
+         for (size_t other = 0; other < fOperators.size(); other++) {
+            if (other != id && other != id - 1 && opTensors[other].count(nameX)) {
+               hasOtherUsers = true;
+               break;
+            }
+         }
+         if (hasOtherUsers || !fOperators[id - 1]->FuseRelu(nameX, relu->GetOutputName()))
+            continue;
+         fIntermediateTensorInfos.erase(nameX);
+         opTensors[id - 1].insert(opTensors[id].begin(), opTensors[id].end());
+         fOperators.erase(fOperators.begin() + id);
+         opTensors.erase(opTensors.begin() + id);
+         id--;
+      }
+   }
+
+   void RModel::PlanIntermediateMemory(){
+      // intermediate tensors with disjoint lifetimes, from the first to the last operator using them,
+      // share the same buffer. Buffers are assigned greedily in the order of execution.
+      fIntermediateTensorBuffers.clear();
+      fIntermediateBuffers.clear();
+      std::vector<std::set<std::string>> opTensors;
+      std::set<std::string> pinnedTensors;
+      FindOperatorTensors(opTensors, pinnedTensors);
+
+      std::map<std::string, std::pair<size_t, size_t>> lifetimes; // first and last operator
+      for (size_t id = 0; id < opTensors.size(); id++) {
+         for (auto &name : opTensors[id]) {
+            auto info = fIntermediateTensorInfos.find(name);
+            if (info == fIntermediateTensorInfos.end() || pinnedTensors.count(name)) continue;
+            auto type = info->second.type;
+            if (type != ETensorType::FLOAT && type != ETensorType::DOUBLE && type != ETensorType::INT64 &&
+                type != ETensorType::INT8 && type != ETensorType::UNINT8)
+               continue;
+            auto lifetime = lifetimes.emplace(name, std::make_pair(id, id)).first;
+            lifetime->second.second = id;
+         }
+      }
+
+      std::vector<std::string> freeBuffers;
+      std::multimap<size_t, std::string> busyBuffers; // last operator using the buffer
+      for (size_t id = 0; id < opTensors.size(); id++) {
+         for (auto it = busyBuffers.begin(); it != busyBuffers.end() && it->first < id; it = busyBuffers.erase(it))
+            freeBuffers.push_back(it->second);
+         for (auto &lifetime : lifetimes) {
+            if (lifetime.second.first != id) continue;
+            auto &info = fIntermediateTensorInfos[lifetime.first];
+            size_t length = ConvertShapeToLength(info.shape);
+            // take the smallest free buffer large enough, otherwise enlarge the largest one
+            auto best = freeBuffers.end();
+            for (auto buf = freeBuffers.begin(); buf != freeBuffers.end(); ++buf) {
+               auto &candidate = fIntermediateBuffers[*buf];
+               if (candidate.first != info.type) continue;
+               if (best == freeBuffers.end()) {
+                  best = buf;
+                  continue;
+               }
+               auto &current = fIntermediateBuffers[*best];
+               bool fits = candidate.second >= length;
+               bool currentFits = current.second >= length;
+               if ((fits && (!currentFits || candidate.second < current.second)) ||
+                   (!fits && !currentFits && candidate.second > current.second))
+                  best = buf;
+            }
+            std::string bufferName;
+            if (best == freeBuffers.end()) {
+               bufferName = "fBuffer_" + ConvertTypeToString(info.type) + "_" +
+                            std::to_string(fIntermediateBuffers.size());
+               fIntermediateBuffers[bufferName] = {info.type, length};
+            } else {
+               bufferName = *best;
+               freeBuffers.erase(best);
+               auto &buffer = fIntermediateBuffers[bufferName];
+               buffer.second = std::max(buffer.second, length);
+            }
+            fIntermediateTensorBuffers[lifetime.first] = bufferName;
+            busyBuffers.emplace(lifetime.second.second, bufferName);
+         }
+      }
+   }
+
    void RModel::Generate(std::underlying_type_t<Options> options, int batchSize){
       // session flag is used in operator initialize
       if (static_cast<std::underlying_type_t<Options>>(Options::kNoSession) & options)
          fUseSession = false;
       if (static_cast<std::underlying_type_t<Options>>(Options::kNoWeightFile) & options)
          fUseWeightFile = false;
+      fUseGPU = static_cast<std::underlying_type_t<Options>>(Options::kGPU) & options;
+      fUseMmapWeights = static_cast<std::underlying_type_t<Options>>(Options::kMmapWeights) & options;
+      if (fUseMmapWeights && !fUseWeightFile) {
+         throw std::runtime_error("TMVA-SOFIE: RModel::Generate: cannot memory map the weights without a separate weight file");
+      }
       if (fUseWeightFile && !fUseSession) {
          throw std::runtime_error("TMVA-SOFIE: RModel::Generate: cannot use a separate weight file without generating a Session class");
       }
+      if (fUseGPU && !fUseSession) {
+         throw std::runtime_error("TMVA-SOFIE: RModel::Generate: the GPU code requires a Session class holding the device memory");
+      }
       fGC.clear();
       Initialize(batchSize);
+      FuseOperators();
+      PlanIntermediateMemory();
+      if (!fUseWeightFile)
+         fUseMmapWeights = false;
+      if (fUseMmapWeights)
+         PlanWeightFile();
+      if (fUseGPU) {
+         for (size_t id = 0; id < fOperators.size(); id++) {
+            if (!fOperators[id]->SupportsGPU())
+               throw std::runtime_error("TMVA-SOFIE: RModel::Generate: operator " + std::to_string(id) +
+                                        " is not supported by the GPU code generation");
+         }
+         for (auto &name : fInputTensorNames) {
+            if (fReadyInputTensorInfos[name].type != ETensorType::FLOAT)
+               throw std::runtime_error("TMVA-SOFIE: RModel::Generate: input tensor " + name +
+                                        " is not of type float, which is required by the GPU code generation");
+         }
+      }
       fGC += ("//Code generated automatically by TMVA for Inference of Model file [" + fFileName + "] at [" + fParseTime.substr(0, fParseTime.length()-1) +"] \n");
       // add header guards
       std::string hgname = fName;
@@ -266,6 +456,12 @@ namespace SOFIE{
       fGC += "#include \"TMVA/SOFIE_common.hxx\"\n";
       if (fUseWeightFile)
          fGC += "#include <fstream>\n";
+      if (fUseGPU) {
+         fGC += "#include <cuda_runtime.h>\n";
+         fGC += "#include <cublas_v2.h>\n";
+         fGC += "#include <stdexcept>\n";
+         fGC += "#include <string>\n";
+      }
 
       fGC += "\nnamespace TMVA_SOFIE_" + fName + "{\n";
       if (!fNeededBlasRoutines.empty()) {
@@ -287,6 +483,43 @@ namespace SOFIE{
          }
          fGC += ("}//BLAS\n");
       }
+      if (fUseGPU) {
+         fGC += "namespace GPU{\n";
+         fGC += "constexpr int kBlockSize = 256;\n";
+         fGC += "inline int NBlocks(size_t n) { return (n + kBlockSize - 1) / kBlockSize; }\n";
+         fGC += "inline void Check(cudaError_t err) {\n";
+         fGC += "   if (err != cudaSuccess) throw std::runtime_error(std::string(\"TMVA-SOFIE CUDA error: \") + cudaGetErrorString(err));\n";
+         fGC += "}\n";
+         fGC += "inline void Check(cublasStatus_t status) {\n";
+         fGC += "   if (status != CUBLAS_STATUS_SUCCESS) throw std::runtime_error(\"TMVA-SOFIE cuBLAS error \" + std::to_string(status));\n";
+         fGC += "}\n";
+         fGC += "template <typename T>\n";
+         fGC += "T * Allocate(size_t n, std::vector<void *> & buffers) {\n";
+         fGC += "   void * ptr = nullptr;\n";
+         fGC += "   Check(cudaMalloc(&ptr, n * sizeof(T)));\n";
+         fGC += "   buffers.push_back(ptr);\n";
+         fGC += "   return static_cast<T *>(ptr);\n";
+         fGC += "}\n";
+         fGC += "template <typename T>\n";
+         fGC += "T * Upload(const T * data, size_t n, std::vector<void *> & buffers) {\n";
+         fGC += "   T * ptr = Allocate<T>(n, buffers);\n";
+         fGC += "   Check(cudaMemcpy(ptr, data, n * sizeof(T), cudaMemcpyHostToDevice));\n";
+         fGC += "   return ptr;\n";
+         fGC += "}\n";
+         fGC += "__global__ void Relu(size_t n, const float * x, float * y) {\n";
+         fGC += "   size_t i = blockIdx.x * blockDim.x + threadIdx.x;\n";
+         fGC += "   if (i < n) y[i] = x[i] > 0 ? x[i] : 0;\n";
+         fGC += "}\n";
+         fGC += "__global__ void Sigmoid(size_t n, const float * x, float * y) {\n";
+         fGC += "   size_t i = blockIdx.x * blockDim.x + threadIdx.x;\n";
+         fGC += "   if (i < n) y[i] = 1.f / (1.f + expf(-x[i]));\n";
+         fGC += "}\n";
+         fGC += "__global__ void Tanh(size_t n, const float * x, float * y) {\n";
+         fGC += "   size_t i = blockIdx.x * blockDim.x + threadIdx.x;\n";
+         fGC += "   if (i < n) y[i] = tanhf(x[i]);\n";
+         fGC += "}\n";
+         fGC += "}//GPU\n";
+      }
       if (fUseSession) {
          fGC += "struct Session {\n";
       }
@@ -307,14 +540,43 @@ namespace SOFIE{
                fGC += floats.str();
                fGC += "};\n";
             }
+            else if (fUseMmapWeights) {
+               fGC += "float * tensor_" + i.first + " = nullptr;\n";
+            }
             else {
                fGC += "std::vector<float> fTensor_" + i.first + " = std::vector<float>(" + std::to_string(length) + ");\n";
                fGC += "float * tensor_" + i.first + " = fTensor_" + i.first + ".data();\n";
             }
 
          }
+         // quantized weights are always written in the code, they are 4 times smaller than float weights
+         if (i.second.fType == ETensorType::INT8 || i.second.fType == ETensorType::UNINT8) {
+            size_t length = ConvertShapeToLength(i.second.fShape);
+            bool isSigned = i.second.fType == ETensorType::INT8;
+            fGC += ConvertTypeToString(i.second.fType) + " tensor_" + i.first + "[" + std::to_string(length) + "] = {";
+            std::stringstream ints;
+            for (size_t idx = 0; idx < length; idx++) {
+               if (isSigned)
+                  ints << int(static_cast<int8_t *>(i.second.fData.get())[idx]);
+               else
+                  ints << int(static_cast<uint8_t *>(i.second.fData.get())[idx]);
+               if (idx < length - 1) ints << ", ";
+            }
+            fGC += ints.str();
+            fGC += "};\n";
+         }
+      }
+      for (auto &i : fIntermediateBuffers) {
+         std::string type = ConvertTypeToString(i.second.first);
+         fGC += "std::vector<" + type + "> " + i.first + " = std::vector<" + type + ">(" +
+                std::to_string(i.second.second) + ");\n";
       }
       for (auto&i: fIntermediateTensorInfos){
+         auto buffer = fIntermediateTensorBuffers.find(i.first);
+         if (buffer != fIntermediateTensorBuffers.end()) {
+            fGC += ConvertTypeToString(i.second.type) + " * tensor_" + i.first + " = " + buffer->second + ".data();\n";
+            continue;
+         }
          size_t length = ConvertShapeToLength(i.second.shape);
          if (i.second.type == ETensorType::FLOAT){
             fGC += "std::vector<float> fTensor_" + i.first  + " = std::vector<float>(" + std::to_string(length) + ");\n";
@@ -328,6 +590,11 @@ namespace SOFIE{
             fGC += "std::vector<int64_t> fTensor_" + i.first  + " = std::vector<int64_t>(" + std::to_string(length) + ");\n";
             fGC += "int64_t * tensor_" + i.first + " = fTensor_" + i.first  + ".data();\n";
          }
+         if (i.second.type == ETensorType::INT8 || i.second.type == ETensorType::UNINT8){
+            std::string type = ConvertTypeToString(i.second.type);
+            fGC += "std::vector<" + type + "> fTensor_" + i.first  + " = std::vector<" + type + ">(" + std::to_string(length) + ");\n";
+            fGC += type + " * tensor_" + i.first + " = fTensor_" + i.first  + ".data();\n";
+         }
       }
       if (fUseSession) {
          // add here specific operator code that needs to define session data members
@@ -338,7 +605,17 @@ namespace SOFIE{
          }
          fGC += "\n";
          // here add initialization and reading of weight tensors
-         if (fUseWeightFile) {
+         if (fUseMmapWeights) {
+            // the weight file is shared by the copies of the session
+            fGC += "std::shared_ptr<const TMVA::Experimental::SOFIE::RWeightFile> fWeightFile;\n\n";
+            fGC += "Session(std::string filename =\"\") {\n";
+            fGC += "   if (filename.empty()) filename = \"" + fName + ".dat\";\n";
+            fGC += "   fWeightFile = TMVA::Experimental::SOFIE::RWeightFile::Open(filename, " +
+                   std::to_string(fWeightFileSize) + ");\n";
+            for (auto &i : fWeightOffsets) {
+               fGC += "   tensor_" + i.first + " = fWeightFile->GetTensor(" + std::to_string(i.second) + ");\n";
+            }
+         } else if (fUseWeightFile) {
             fGC += "Session(std::string filename =\"\") {\n";
             fGC += "   if (filename.empty()) filename = \"" + fName + ".dat\";\n";
             ReadInitializedTensorsFromFile();
@@ -352,7 +629,11 @@ namespace SOFIE{
          for (size_t id = 0; id < fOperators.size() ; id++){
             fGC += fOperators[id]->GenerateInitCode();
          }
-         fGC += "}\n\n";
+         if (fUseGPU) {
+            GenerateGPUSessionCode();
+         } else {
+            fGC += "}\n\n";
+         }
       }
 
       size_t outputSize = fOutputTensorNames.size();
@@ -416,22 +697,37 @@ namespace SOFIE{
 
       const std::string SP = "   ";
 
+      if (fUseGPU) {
+         for (auto &name : fInputTensorNames) {
+            size_t length = ConvertShapeToLength(fReadyInputTensorInfos[name].shape);
+            fGC += SP + "GPU::Check(cudaMemcpy(d_tensor_" + name + ", tensor_" + name + ", " + std::to_string(length) +
+                   " * sizeof(float), cudaMemcpyHostToDevice));\n";
+         }
+      }
       for (size_t id = 0; id < fOperators.size() ; id++){
-         fGC+= (fOperators[id]->Generate(std::to_string(id)));
+         if (fUseGPU)
+            fGC += fOperators[id]->GenerateGPU(std::to_string(id));
+         else
+            fGC+= (fOperators[id]->Generate(std::to_string(id)));
       }
+      // in the GPU code the outputs are copied from the device
+      auto generateOutput = [&](const std::string &retName, const std::string &tensorName) {
+         size_t outputLength = ConvertShapeToLength(GetTensorShape(tensorName));
+         if (fUseGPU) {
+            fGC += SP + "std::vector<" + outputType + "> " + retName + "(" + std::to_string(outputLength) + ");\n";
+            fGC += SP + "GPU::Check(cudaMemcpy(" + retName + ".data(), d_tensor_" + tensorName + ", " +
+                   std::to_string(outputLength) + " * sizeof(" + outputType + "), cudaMemcpyDeviceToHost));\n";
+         } else {
+            fGC += SP + "std::vector<" + outputType + "> " + retName + " (tensor_" + tensorName + ", tensor_" +
+                   tensorName + " + " + std::to_string(outputLength) + ");\n";
+         }
+      };
       if (outputSize == 1) {
-         size_t outputLength = ConvertShapeToLength(GetTensorShape(fOutputTensorNames[0]));
-
-         fGC += SP + "std::vector<" + outputType + "> ret (tensor_" + fOutputTensorNames[0] + ", tensor_" + fOutputTensorNames[0] + " + " +
-               std::to_string(outputLength) + ");\n";
+         generateOutput("ret", fOutputTensorNames[0]);
       } else {
          for (size_t i = 0; i < outputSize; i++) {
             if (!fOutputTensorNames[i].empty()) {
-               size_t outputLength = ConvertShapeToLength(GetTensorShape(fOutputTensorNames[i]));
-               fGC += SP + "std::vector<" + outputType + "> ret_";
-               fGC += std::to_string(i);
-               fGC += " (tensor_" + fOutputTensorNames[i] + ", tensor_" + fOutputTensorNames[i] + " + " +
-               std::to_string(outputLength) + ");\n";
+               generateOutput("ret_" + std::to_string(i), fOutputTensorNames[i]);
             }
          }
          fGC += SP + "std::vector<std::vector<" + outputType + ">> ret({";
@@ -457,6 +753,64 @@ namespace SOFIE{
       fGC += "\n#endif  // " + hgname + "\n";
    }
 
+   void RModel::GenerateGPUSessionCode() {
+      // generate the end of the Session constructor, copying the weights and the intermediate tensors, which
+      // might have been set by the initialization code, to the device, and the members holding the device memory
+      std::string members = "cublasHandle_t fCublasHandle = nullptr;\n";
+      members += "std::vector<void *> fDeviceBuffers;\n";
+      fGC += "   GPU::Check(cublasCreate(&fCublasHandle));\n";
+      for (auto &i : fInitializedTensors) {
+         if (i.second.fType != ETensorType::FLOAT) continue;
+         size_t length = ConvertShapeToLength(i.second.fShape);
+         members += "float * d_tensor_" + i.first + " = nullptr;\n";
+         fGC += "   d_tensor_" + i.first + " = GPU::Upload(tensor_" + i.first + ", " + std::to_string(length) +
+                ", fDeviceBuffers);\n";
+      }
+      for (auto &name : fInputTensorNames) {
+         size_t length = ConvertShapeToLength(fReadyInputTensorInfos[name].shape);
+         members += "float * d_tensor_" + name + " = nullptr;\n";
+         fGC += "   d_tensor_" + name + " = GPU::Allocate<float>(" + std::to_string(length) + ", fDeviceBuffers);\n";
+      }
+      for (auto &i : fIntermediateBuffers) {
+         std::string type = ConvertTypeToString(i.second.first);
+         members += type + " * d_" + i.first + " = nullptr;\n";
+         fGC += "   d_" + i.first + " = GPU::Upload(" + i.first + ".data(), " + std::to_string(i.second.second) +
+                ", fDeviceBuffers);\n";
+      }
+      for (auto &i : fIntermediateTensorInfos) {
+         std::string type = ConvertTypeToString(i.second.type);
+         members += type + " * d_tensor_" + i.first + " = nullptr;\n";
+         auto buffer = fIntermediateTensorBuffers.find(i.first);
+         if (buffer != fIntermediateTensorBuffers.end()) {
+            fGC += "   d_tensor_" + i.first + " = d_" + buffer->second + ";\n";
+         } else {
+            fGC += "   d_tensor_" + i.first + " = GPU::Upload(tensor_" + i.first + ", " +
+                   std::to_string(ConvertShapeToLength(i.second.shape)) + ", fDeviceBuffers);\n";
+         }
+      }
+      fGC += "}\n\n";
+      fGC += "~Session() {\n";
+      fGC += "   for (void * ptr : fDeviceBuffers) cudaFree(ptr);\n";
+      fGC += "   if (fCublasHandle) cublasDestroy(fCublasHandle);\n";
+      fGC += "}\n\n";
+      fGC += "Session(const Session &) = delete;\n";
+      fGC += "Session & operator=(const Session &) = delete;\n\n";
+      fGC += members + "\n";
+   }
+
+   void RModel::PlanWeightFile() {
+      // lay out the float weight tensors in the binary weight file, each one aligned for vectorized access
+      fWeightOffsets.clear();
+      size_t offset = RWeightFile::kHeaderSize;
+      for (auto &i : fInitializedTensors) {
+         if (i.second.fType != ETensorType::FLOAT) continue;
+         fWeightOffsets[i.first] = offset;
+         offset += ConvertShapeToLength(i.second.fShape) * sizeof(float);
+         offset = (offset + RWeightFile::kAlignment - 1) / RWeightFile::kAlignment * RWeightFile::kAlignment;
+      }
+      fWeightFileSize = offset;
+   }
+
    void RModel::ReadInitializedTensorsFromFile() {
       // generate the code to read initialized tensors from a text data file
       if (fInitializedTensors.empty()) return;
@@ -502,6 +856,22 @@ namespace SOFIE{
          filename = fName + ".data";
       }
 
+      if (fUseMmapWeights) {
+         // binary file with the layout planned by PlanWeightFile, for the generated code to memory map it
+         std::vector<char> content(fWeightFileSize, 0);
+         std::copy(std::begin(RWeightFile::kMagic), std::end(RWeightFile::kMagic), content.begin());
+         for (auto &i : fWeightOffsets) {
+            auto &tensor = fInitializedTensors.at(i.first);
+            const char *data = static_cast<const char *>(tensor.fData.get());
+            std::copy(data, data + ConvertShapeToLength(tensor.fShape) * sizeof(float), content.begin() + i.second);
+         }
+         std::ofstream f(filename, std::ios::binary);
+         if (!f.write(content.data(), content.size())) {
+            throw std::runtime_error("tmva-sofie failed to write the binary tensor weight data");
+         }
+         return;
+      }
+
       std::ofstream f;
       f.open(filename);
       if (!f.is_open()){
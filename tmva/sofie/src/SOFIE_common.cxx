@@ -3,6 +3,16 @@
 #include <sstream>
 #include <iostream>
 #include <stdexcept>
+#include <fstream>
+#include <map>
+#include <mutex>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
 
 namespace TMVA{
 namespace Experimental{
@@ -28,6 +38,12 @@ std::string ConvertTypeToString(ETensorType type){
       case ETensorType::FLOAT : {
          return "float";
       }
+      case ETensorType::INT8 : {
+         return "int8_t";
+      }
+      case ETensorType::UNINT8 : {
+         return "uint8_t";
+      }
       case ETensorType::INT16 : {
          return "int16_t";
       }
@@ -62,6 +78,12 @@ ETensorType ConvertStringToType(std::string type){
    else if(type == "int64"){
      return ETensorType::INT64;
    }
+   else if (type == "int8"){
+      return ETensorType::INT8;
+   }
+   else if (type == "uint8"){
+      return ETensorType::UNINT8;
+   }
    else if (type == "double" || type == "float64"){
       return ETensorType::DOUBLE;
    }
@@ -286,6 +308,70 @@ std::string UTILITY::Clean_name(std::string input_tensor_name){
    return s;
 }
 
+RWeightFile::RWeightFile(const std::string &filename, std::size_t size) : fSize(size)
+{
+   const std::string errMsg = "TMVA-SOFIE failed to read the weight file " + filename;
+#ifndef _WIN32
+   int fd = open(filename.c_str(), O_RDONLY);
+   if (fd < 0)
+      throw std::runtime_error(errMsg);
+   struct stat info;
+   if (fstat(fd, &info) != 0 || std::size_t(info.st_size) != size) {
+      close(fd);
+      throw std::runtime_error(errMsg + ": unexpected size");
+   }
+   // a private writable mapping does not write to the file, and its pages are shared with the page cache
+   // until they are modified
+   void *data = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+   close(fd);
+   if (data == MAP_FAILED)
+      throw std::runtime_error(errMsg + ": mmap failed");
+   fData = static_cast<char *>(data);
+#else
+   std::ifstream in(filename, std::ios::binary | std::ios::ate);
+   if (!in || std::size_t(in.tellg()) != size)
+      throw std::runtime_error(errMsg + ": unexpected size");
+   fData = new char[size];
+   in.seekg(0);
+   if (!in.read(fData, size)) {
+      delete[] fData;
+      throw std::runtime_error(errMsg);
+   }
+#endif
+   if (size < kHeaderSize || std::memcmp(fData, kMagic, sizeof(kMagic)) != 0) {
+#ifndef _WIN32
+      munmap(fData, fSize);
+#else
+      delete[] fData;
+#endif
+      throw std::runtime_error(errMsg + ": not a SOFIE weight file");
+   }
+}
+
+RWeightFile::~RWeightFile()
+{
+#ifndef _WIN32
+   munmap(fData, fSize);
+#else
+   delete[] fData;
+#endif
+}
+
+std::shared_ptr<const RWeightFile> RWeightFile::Open(const std::string &filename, std::size_t size)
+{
+   static std::mutex mutex;
+   static std::map<std::string, std::weak_ptr<const RWeightFile>> openFiles;
+
+   std::lock_guard<std::mutex> lock(mutex);
+   auto &weakFile = openFiles[filename];
+   auto file = weakFile.lock();
+   if (!file || file->fSize != size) {
+      file = std::shared_ptr<const RWeightFile>(new RWeightFile(filename, size));
+      weakFile = file;
+   }
+   return file;
+}
+
 std::vector<size_t> UTILITY::ComputeStrideFromShape(const std::vector<size_t> & shape) {
    // assume row major layout
    const auto size = shape.size();
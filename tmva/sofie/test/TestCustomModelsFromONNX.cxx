@@ -242,6 +242,9 @@
 #include "GatherNegativeIndices_FromONNX.hxx"
 #include "input_models/references/GatherNegativeIndices.ref.hxx"
 
+#include "QLinearMatMul_FromONNX.hxx"
+#include "input_models/references/QLinearMatMul.ref.hxx"
+
 #include "gtest/gtest.h"
 
 constexpr float DEFAULT_TOLERANCE = 1e-3f;
@@ -2334,3 +2337,30 @@ TEST(ONNX, GatherNegativeIndices) {
       EXPECT_LE(std::abs(output[i] - correct[i]), TOLERANCE);
    }
 }
+
+TEST(ONNX, QLinearMatMul)
+{
+   // The quantized results are exact multiples of the output scale
+   constexpr float TOLERANCE = 1.e-6;
+
+   // QuantizeLinear, QLinearMatMul with int8 weights and DequantizeLinear.
+   // The input 40 saturates on quantization, and the first output of the second row on requantization.
+   std::vector<float> input({
+      0.3, -1.1, 2.0, 0.9,
+      40.0, 2.6, -3.4, 1.7
+   });
+
+   TMVA_SOFIE_QLinearMatMul::Session s("QLinearMatMul_FromONNX.dat");
+
+   std::vector<float> output = s.infer(input.data());
+
+   // Checking output size
+   EXPECT_EQ(output.size(), sizeof(QLinearMatMul_ExpectedOutput::outputs) / sizeof(float));
+
+   float *correct = QLinearMatMul_ExpectedOutput::outputs;
+
+   // Checking every output value, one by one
+   for (size_t i = 0; i < output.size(); ++i) {
+      EXPECT_LE(std::abs(output[i] - correct[i]), TOLERANCE);
+   }
+}
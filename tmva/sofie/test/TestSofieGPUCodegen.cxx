@@ -0,0 +1,117 @@
+#include "TMVA/RModel.hxx"
+#include "TMVA/ROperator_Gemm.hxx"
+#include "TMVA/ROperator_Relu.hxx"
+#include "TMVA/ROperator_Selu.hxx"
+#include "TMVA/ROperator_Tanh.hxx"
+
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+using namespace TMVA::Experimental::SOFIE;
+
+namespace {
+
+void AddWeights(RModel &model, const std::string &name, std::vector<size_t> shape)
+{
+   const size_t length = ConvertShapeToLength(shape);
+   std::shared_ptr<void> data(malloc(length * sizeof(float)), free);
+   for (size_t i = 0; i < length; i++)
+      static_cast<float *>(data.get())[i] = 0.1 * i - 0.5;
+   model.AddInitializedTensor(name, ETensorType::FLOAT, shape, data);
+}
+
+/// Two fully connected layers, the first one with a Relu that is fused into the Gemm, the second one followed by
+/// a Tanh or, if the model is not to be supported on the GPU, by a Selu
+RModel MakeModel(const std::string &name, bool gpuSupport)
+{
+   RModel model(name + ".onnx", "Thu Oct 15 00:00:00 2026\n");
+   model.AddInputTensorInfo("X", ETensorType::FLOAT, std::vector<size_t>{2, 4});
+   model.AddInputTensorName("X");
+   AddWeights(model, "W1", {4, 3});
+   AddWeights(model, "W2", {3, 2});
+   model.AddOperator(std::make_unique<ROperator_Gemm<float>>(1., 0., 0, 0, "X", "W1", "H"));
+   model.AddOperator(std::make_unique<ROperator_Relu<float>>("H", "A"));
+   model.AddOperator(std::make_unique<ROperator_Gemm<float>>(1., 0., 0, 0, "A", "W2", "Y"));
+   if (gpuSupport)
+      model.AddOperator(std::make_unique<ROperator_Tanh<float>>("Y", "Z"));
+   else
+      model.AddOperator(std::make_unique<ROperator_Selu<float>>("Y", "Z"));
+   model.AddOutputTensorNameList({"Z"});
+   model.AddBlasRoutines({"Gemm", "Gemv"});
+   return model;
+}
+
+/// Returns the code written by RModel::OutputGenerated and removes the written files
+std::string GetGeneratedCode(RModel &model, const std::string &name)
+{
+   model.OutputGenerated(name + ".hxx");
+   std::ifstream f(name + ".hxx");
+   std::stringstream code;
+   code << f.rdbuf();
+   std::remove((name + ".hxx").c_str());
+   std::remove((name + ".dat").c_str());
+   return code.str();
+}
+
+} // anonymous namespace
+
+TEST(SOFIE, GPUCodegen)
+{
+   RModel model = MakeModel("SofieGPUCodegen", true);
+   model.Generate(Options::kGPU);
+   const std::string code = GetGeneratedCode(model, "SofieGPUCodegen");
+
+   const std::vector<std::string> expected = {
+      "#include <cuda_runtime.h>",
+      "#include <cublas_v2.h>",
+      // the weights are copied to the device once, in the constructor of the session
+      "GPU::Check(cublasCreate(&fCublasHandle));",
+      "d_tensor_W1 = GPU::Upload(tensor_W1, 12, fDeviceBuffers);",
+      "d_tensor_W2 = GPU::Upload(tensor_W2, 6, fDeviceBuffers);",
+      "d_tensor_X = GPU::Allocate<float>(8, fDeviceBuffers);",
+      "for (void * ptr : fDeviceBuffers) cudaFree(ptr);",
+      // infer() copies the input, runs the operators on the device and copies the output back
+      "GPU::Check(cudaMemcpy(d_tensor_X, tensor_X, 8 * sizeof(float), cudaMemcpyHostToDevice));",
+      "GPU::Check(cublasSgemm(fCublasHandle, CUBLAS_OP_N, CUBLAS_OP_N, 3, 2, 4, &op_0_alpha, d_tensor_W1, 3, "
+      "d_tensor_X, 4, &op_0_beta, d_tensor_A, 3));",
+      "GPU::Relu<<<GPU::NBlocks(6), GPU::kBlockSize>>>(6, d_tensor_A, d_tensor_A);",
+      "GPU::Check(cublasSgemm(fCublasHandle, CUBLAS_OP_N, CUBLAS_OP_N, 2, 2, 3, &op_1_alpha, d_tensor_W2, 2, "
+      "d_tensor_A, 3, &op_1_beta, d_tensor_Y, 2));",
+      "GPU::Tanh<<<GPU::NBlocks(4), GPU::kBlockSize>>>(4, d_tensor_Y, d_tensor_Z);",
+      "GPU::Check(cudaMemcpy(ret.data(), d_tensor_Z, 4 * sizeof(float), cudaMemcpyDeviceToHost));"};
+   for (const auto &line : expected)
+      EXPECT_NE(code.find(line), std::string::npos) << "missing in the generated code: " << line;
+
+   // no host code for the operators, and the Relu is fused into the Gemm
+   EXPECT_EQ(code.find("BLAS::sgemm_("), std::string::npos);
+   EXPECT_EQ(code.find("//------ RELU"), std::string::npos);
+   EXPECT_EQ(code.find("//------ TANH\n"), std::string::npos);
+}
+
+TEST(SOFIE, GPUCodegenDefault)
+{
+   // without the option, the code does not depend on CUDA
+   RModel model = MakeModel("SofieCPUCodegen", true);
+   model.Generate();
+   const std::string code = GetGeneratedCode(model, "SofieCPUCodegen");
+   EXPECT_NE(code.find("BLAS::sgemm_("), std::string::npos);
+   EXPECT_EQ(code.find("cuda"), std::string::npos);
+   EXPECT_EQ(code.find("GPU::"), std::string::npos);
+}
+
+TEST(SOFIE, GPUCodegenErrors)
+{
+   RModel unsupported = MakeModel("SofieGPUCodegenUnsupported", false);
+   EXPECT_THROW(unsupported.Generate(Options::kGPU), std::runtime_error);
+
+   RModel noSession = MakeModel("SofieGPUCodegenNoSession", true);
+   EXPECT_THROW(noSession.Generate(Options::kGPU | Options::kNoSession | Options::kNoWeightFile),
+                std::runtime_error);
+}
@@ -0,0 +1,6 @@
+namespace QLinearMatMul_ExpectedOutput{
+	float outputs[] = {
+      7.125, -6.0, -6.75,
+      45.75, -44.25, -15.75
+	};
+} // namespace QLinearMatMul_ExpectedOutput
@@ -0,0 +1,138 @@
+#include "TMVA/RModelParser_ONNX.hxx"
+#include "TMVA/ROperator_QuantizeLinear.hxx"
+#include "TMVA/ROperator_QLinearMatMul.hxx"
+#include "onnx_proto3.pb.h"
+
+namespace TMVA {
+namespace Experimental {
+namespace SOFIE {
+
+namespace {
+// type of the quantized tensor given by the zero point; ONNX defaults to uint8 without zero point
+ETensorType GetQuantizedType(RModelParser_ONNX &parser, const onnx::NodeProto &nodeproto, int zeroPointIndex)
+{
+   if (nodeproto.input_size() <= zeroPointIndex || nodeproto.input(zeroPointIndex).empty())
+      return ETensorType::UNINT8;
+   const auto &name = nodeproto.input(zeroPointIndex);
+   if (!parser.IsRegisteredTensorType(name)) {
+      throw std::runtime_error("TMVA::SOFIE ONNX Parser " + nodeproto.op_type() + " op has zero point tensor " + name +
+                               " but its type is not yet registered");
+   }
+   return parser.GetTensorType(name);
+}
+
+std::string GetOptionalInput(const onnx::NodeProto &nodeproto, int index)
+{
+   return (nodeproto.input_size() > index) ? nodeproto.input(index) : "";
+}
+} // namespace
+
+ParserFuncSignature ParseQuantizeLinear = [](RModelParser_ONNX &parser, const onnx::NodeProto &nodeproto) {
+   auto input_name = nodeproto.input(0);
+   if (!parser.IsRegisteredTensorType(input_name)) {
+      throw std::runtime_error("TMVA::SOFIE ONNX Parser QuantizeLinear op has input tensor " + input_name +
+                               " but its type is not yet registered");
+   }
+   if (parser.GetTensorType(input_name) != ETensorType::FLOAT) {
+      throw std::runtime_error("TMVA::SOFIE - Unsupported - Operator QuantizeLinear supports only float inputs");
+   }
+
+   std::unique_ptr<ROperator> op;
+   std::string output_name = nodeproto.output(0);
+   std::string zero_point_name = GetOptionalInput(nodeproto, 2);
+   ETensorType output_type = GetQuantizedType(parser, nodeproto, 2);
+
+   switch (output_type) {
+   case ETensorType::INT8:
+      op.reset(new ROperator_QuantizeLinear<int8_t>(input_name, nodeproto.input(1), zero_point_name, output_name));
+      break;
+   case ETensorType::UNINT8:
+      op.reset(new ROperator_QuantizeLinear<uint8_t>(input_name, nodeproto.input(1), zero_point_name, output_name));
+      break;
+   default:
+      throw std::runtime_error("TMVA::SOFIE - Unsupported - Operator QuantizeLinear does not yet support output type " +
+                               std::to_string(static_cast<int>(output_type)));
+   }
+
+   if (!parser.IsRegisteredTensorType(output_name)) {
+      parser.RegisterTensorType(output_name, output_type);
+   }
+
+   return op;
+};
+
+ParserFuncSignature ParseDequantizeLinear = [](RModelParser_ONNX &parser, const onnx::NodeProto &nodeproto) {
+   auto input_name = nodeproto.input(0);
+   if (!parser.IsRegisteredTensorType(input_name)) {
+      throw std::runtime_error("TMVA::SOFIE ONNX Parser DequantizeLinear op has input tensor " + input_name +
+                               " but its type is not yet registered");
+   }
+   ETensorType input_type = parser.GetTensorType(input_name);
+
+   std::unique_ptr<ROperator> op;
+   std::string output_name = nodeproto.output(0);
+   std::string zero_point_name = GetOptionalInput(nodeproto, 2);
+
+   switch (input_type) {
+   case ETensorType::INT8:
+      op.reset(new ROperator_DequantizeLinear<int8_t>(input_name, nodeproto.input(1), zero_point_name, output_name));
+      break;
+   case ETensorType::UNINT8:
+      op.reset(new ROperator_DequantizeLinear<uint8_t>(input_name, nodeproto.input(1), zero_point_name, output_name));
+      break;
+   default:
+      throw std::runtime_error("TMVA::SOFIE - Unsupported - Operator DequantizeLinear does not yet support input type " +
+                               std::to_string(static_cast<int>(input_type)));
+   }
+
+   if (!parser.IsRegisteredTensorType(output_name)) {
+      parser.RegisterTensorType(output_name, ETensorType::FLOAT);
+   }
+
+   return op;
+};
+
+ParserFuncSignature ParseQLinearMatMul = [](RModelParser_ONNX &parser, const onnx::NodeProto &nodeproto) {
+   if (nodeproto.input_size() != 8) {
+      throw std::runtime_error("TMVA::SOFIE ONNX Parser QLinearMatMul op needs 8 inputs");
+   }
+   for (int i : {0, 3}) {
+      if (!parser.IsRegisteredTensorType(nodeproto.input(i))) {
+         throw std::runtime_error("TMVA::SOFIE ONNX Parser QLinearMatMul op has input tensor " + nodeproto.input(i) +
+                                  " but its type is not yet registered");
+      }
+   }
+   ETensorType input_type = parser.GetTensorType(nodeproto.input(0));
+   if (parser.GetTensorType(nodeproto.input(3)) != input_type || GetQuantizedType(parser, nodeproto, 7) != input_type) {
+      throw std::runtime_error("TMVA::SOFIE - Unsupported - Operator QLinearMatMul with inputs and output of different types");
+   }
+
+   std::unique_ptr<ROperator> op;
+   std::string output_name = nodeproto.output(0);
+
+   switch (input_type) {
+   case ETensorType::INT8:
+      op.reset(new ROperator_QLinearMatMul<int8_t>(nodeproto.input(0), nodeproto.input(1), nodeproto.input(2),
+                                                   nodeproto.input(3), nodeproto.input(4), nodeproto.input(5),
+                                                   nodeproto.input(6), nodeproto.input(7), output_name));
+      break;
+   case ETensorType::UNINT8:
+      op.reset(new ROperator_QLinearMatMul<uint8_t>(nodeproto.input(0), nodeproto.input(1), nodeproto.input(2),
+                                                    nodeproto.input(3), nodeproto.input(4), nodeproto.input(5),
+                                                    nodeproto.input(6), nodeproto.input(7), output_name));
+      break;
+   default:
+      throw std::runtime_error("TMVA::SOFIE - Unsupported - Operator QLinearMatMul does not yet support input type " +
+                               std::to_string(static_cast<int>(input_type)));
+   }
+
+   if (!parser.IsRegisteredTensorType(output_name)) {
+      parser.RegisterTensorType(output_name, input_type);
+   }
+
+   return op;
+};
+
+} // namespace SOFIE
+} // namespace Experimental
+} // namespace TMVA
@@ -62,6 +62,9 @@ extern ParserFuncSignature ParseMatMul;
 extern ParserFuncSignature ParseLayerNormalization;
 extern ParserFuncSignature ParseGather;
 extern ParserFuncSignature ParseErf;
+extern ParserFuncSignature ParseQuantizeLinear;
+extern ParserFuncSignature ParseDequantizeLinear;
+extern ParserFuncSignature ParseQLinearMatMul;
 // Decalaration of fused operators
 extern ParserFuseFuncSignature ParseFuseConvAdd;
 extern ParserFuseFuncSignature ParseFuseConvTransposeAdd;
@@ -130,6 +133,9 @@ RModelParser_ONNX::RModelParser_ONNX() noexcept : fOperatorsMapImpl(std::make_un
    RegisterOperator("Expand", ParseExpand);
    RegisterOperator("Gather", ParseGather);
    RegisterOperator("Erf", ParseErf);
+   RegisterOperator("QuantizeLinear", ParseQuantizeLinear);
+   RegisterOperator("DequantizeLinear", ParseDequantizeLinear);
+   RegisterOperator("QLinearMatMul", ParseQLinearMatMul);
 }
 
 // Destructor of the parser
@@ -380,6 +386,30 @@ RModel RModelParser_ONNX::Parse(std::string filename, bool verbose)
          allInitializedTensors[input_name] = i;
          break;
       }
+      case ETensorType::INT8:
+      case ETensorType::UNINT8: {
+         // quantized weights and zero points
+         auto type = static_cast<ETensorType>(graph.initializer(i).data_type());
+         std::shared_ptr<void> data(malloc(fLength), free);
+
+         if (tensorproto->raw_data().empty() == false) {
+            std::memcpy(data.get(), tensorproto->raw_data().c_str(), fLength);
+         } else {
+            // small integer types are stored in the int32 field
+            for (std::size_t j = 0; j < fLength; j++) {
+               if (type == ETensorType::INT8)
+                  static_cast<int8_t *>(data.get())[j] = tensorproto->int32_data(j);
+               else
+                  static_cast<uint8_t *>(data.get())[j] = tensorproto->int32_data(j);
+            }
+         }
+
+         if (verbose) std::cout << "add " << ConvertTypeToString(type) << " initialized tensor " << input_name << " shape " << ConvertShapeToString(shape) << std::endl;
+         rmodel.AddInitializedTensor(input_name, type, shape, data);
+         RegisterTensorType(input_name, type);
+         allInitializedTensors[input_name] = i;
+         break;
+      }
       default:
          throw std::runtime_error("Data type in weight tensor " + graph.initializer(i).name() + " not supported!\n");
       }
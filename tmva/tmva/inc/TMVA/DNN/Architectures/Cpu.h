@@ -627,6 +627,16 @@ public:
                                            const Matrix_t &input,         // BxD
                                            Matrix_t &input_gradient);
 
+   /** Fused forward pass of the gates of a recurrent layer at one time step: the pre-activation of gate g,
+    *  input . weights[g]^T + state . stateWeights[g]^T + biases[g], is written into gates[g] (BxH) for all the gates
+    *  with one matrix product for the input and one for the state. The transposed weights and the biases of the
+    *  gates are stacked in the workspace, which is only refilled when restack is true (once per forward pass). */
+   static void RecurrentGatesForward(const std::vector<Matrix_t *> &gates, const Matrix_t &input, const Matrix_t &state,
+                                     const std::vector<const Matrix_t *> &weights,
+                                     const std::vector<const Matrix_t *> &stateWeights,
+                                     const std::vector<const Matrix_t *> &biases, std::vector<Matrix_t> &workspace,
+                                     bool restack);
+
    // dummy RNN functions
    static void RNNForward(const Tensor_t & /* x */, const Matrix_t & /* hx */, const Matrix_t & /* cx */,
                           const Matrix_t & /* weights */, Tensor_t & /* y */, Matrix_t & /* hy */, Matrix_t & /* cy */,
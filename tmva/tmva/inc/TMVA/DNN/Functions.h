@@ -18,6 +18,8 @@
 #ifndef TMVA_DNN_FUNCTIONS
 #define TMVA_DNN_FUNCTIONS
 
+#include <type_traits>
+
 namespace TMVA
 {
 namespace DNN
@@ -298,6 +300,22 @@ inline void initialize(typename Architecture_t::Matrix_t & A,
    }
 }
 
+//______________________________________________________________________________
+//
+//  Architecture Traits
+//______________________________________________________________________________
+
+/*! Whether the architecture provides RecurrentGatesForward(), computing the gates of
+ *  a recurrent layer with one matrix product for all the gates (see TCpu). */
+template <typename Architecture_t, typename = void>
+struct HasFusedRecurrentGates : std::false_type {
+};
+
+template <typename Architecture_t>
+struct HasFusedRecurrentGates<Architecture_t, decltype(void(&Architecture_t::RecurrentGatesForward))>
+   : std::true_type {
+};
+
 } // namespace DNN
 } // namespace TMVA
 
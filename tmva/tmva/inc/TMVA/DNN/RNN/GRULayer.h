@@ -134,6 +134,13 @@ private:
    TDescriptors *fDescriptors = nullptr; ///< Keeps all the RNN descriptors
    TWorkspace *fWorkspace = nullptr;     // workspace needed for GPU computation (CudNN)
 
+   std::vector<Matrix_t> fFusedGatesWorkspace; ///< stacked weights used by Architecture_t::RecurrentGatesForward
+
+   /*! Computes the values of the reset and update gates at time step t, in one matrix product
+    *  for the input and one for the state if the architecture supports it. */
+   void GatesForward(const Matrix_t &input, size_t t, std::true_type /* fused */);
+   void GatesForward(const Matrix_t &input, size_t t, std::false_type /* fused */);
+
 public:
 
    /*! Constructor */
@@ -489,6 +496,35 @@ auto inline TBasicGRULayer<Architecture_t>::CandidateValue(const Matrix_t &input
    DNN::evaluateMatrix<Architecture_t>(fCandidateValue, fCan);
 }
 
+//______________________________________________________________________________
+template <typename Architecture_t>
+auto inline TBasicGRULayer<Architecture_t>::GatesForward(const Matrix_t &input, size_t t, std::false_type)
+-> void
+{
+   ResetGate(input, fDerivativesReset[t]);
+   UpdateGate(input, fDerivativesUpdate[t]);
+}
+
+//______________________________________________________________________________
+template <typename Architecture_t>
+auto inline TBasicGRULayer<Architecture_t>::GatesForward(const Matrix_t &input, size_t t, std::true_type)
+-> void
+{
+   // Same as ResetGate() and UpdateGate() with the weights of both gates stacked. The candidate value depends on
+   // the reset gate and is computed separately. The weights are restacked at the first time step since they change
+   // between two forward passes in training.
+   Architecture_t::RecurrentGatesForward({&fResetValue, &fUpdateValue}, input, fState,
+                                         {&fWeightsResetGate, &fWeightsUpdateGate},
+                                         {&fWeightsResetGateState, &fWeightsUpdateGateState},
+                                         {&fResetGateBias, &fUpdateGateBias}, fFusedGatesWorkspace, t == 0);
+
+   const DNN::EActivationFunction fSig = this->GetActivationFunctionF1();
+   DNN::evaluateDerivativeMatrix<Architecture_t>(fDerivativesReset[t], fSig, fResetValue);
+   DNN::evaluateMatrix<Architecture_t>(fResetValue, fSig);
+   DNN::evaluateDerivativeMatrix<Architecture_t>(fDerivativesUpdate[t], fSig, fUpdateValue);
+   DNN::evaluateMatrix<Architecture_t>(fUpdateValue, fSig);
+}
+
  //______________________________________________________________________________
 template <typename Architecture_t>
 auto inline TBasicGRULayer<Architecture_t>::Forward(Tensor_t &input, bool isTraining )
@@ -552,9 +588,8 @@ auto inline TBasicGRULayer<Architecture_t>::Forward(Tensor_t &input, bool isTrai
     *  next hidden state and next cell state. */
    for (size_t t = 0; t < fTimeSteps; ++t) {
       /* Feed forward network: value of each gate being computed at each timestep t. */
-      ResetGate(arrInput[t], fDerivativesReset[t]);
+      GatesForward(arrInput[t], t, DNN::HasFusedRecurrentGates<Architecture_t>());
       Architecture_t::Copy(this->GetResetGateTensorAt(t), fResetValue);
-      UpdateGate(arrInput[t], fDerivativesUpdate[t]);
       Architecture_t::Copy(this->GetUpdateGateTensorAt(t), fUpdateValue);
 
       CandidateValue(arrInput[t], fDerivativesCandidate[t]);
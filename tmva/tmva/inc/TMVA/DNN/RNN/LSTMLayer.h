@@ -141,6 +141,13 @@ private:
    TDescriptors *fDescriptors = nullptr; ///< Keeps all the RNN descriptors
    TWorkspace *fWorkspace = nullptr;     // workspace needed for GPU computation (CudNN)
 
+   std::vector<Matrix_t> fFusedGatesWorkspace; ///< stacked weights used by Architecture_t::RecurrentGatesForward
+
+   /*! Computes the values of the four gates at time step t, in one matrix product for
+    *  the input and one for the state if the architecture supports it. */
+   void GatesForward(const Matrix_t &input, size_t t, std::true_type /* fused */);
+   void GatesForward(const Matrix_t &input, size_t t, std::false_type /* fused */);
+
 public:
 
    /*! Constructor */
@@ -548,6 +555,43 @@ auto inline TBasicLSTMLayer<Architecture_t>::OutputGate(const Matrix_t &input, M
 
 
 
+//______________________________________________________________________________
+template <typename Architecture_t>
+auto inline TBasicLSTMLayer<Architecture_t>::GatesForward(const Matrix_t &input, size_t t, std::false_type)
+-> void
+{
+   InputGate(input, fDerivativesInput[t]);
+   ForgetGate(input, fDerivativesForget[t]);
+   CandidateValue(input, fDerivativesCandidate[t]);
+   OutputGate(input, fDerivativesOutput[t]);
+}
+
+//______________________________________________________________________________
+template <typename Architecture_t>
+auto inline TBasicLSTMLayer<Architecture_t>::GatesForward(const Matrix_t &input, size_t t, std::true_type)
+-> void
+{
+   // Same as InputGate(), ForgetGate(), CandidateValue() and OutputGate() with the weights of all the gates
+   // stacked. They are restacked at the first time step since they change between two forward passes in training.
+   Architecture_t::RecurrentGatesForward({&fInputValue, &fForgetValue, &fCandidateValue, &fOutputValue}, input, fState,
+                                         {&fWeightsInputGate, &fWeightsForgetGate, &fWeightsCandidate, &fWeightsOutputGate},
+                                         {&fWeightsInputGateState, &fWeightsForgetGateState, &fWeightsCandidateState,
+                                          &fWeightsOutputGateState},
+                                         {&fInputGateBias, &fForgetGateBias, &fCandidateBias, &fOutputGateBias},
+                                         fFusedGatesWorkspace, t == 0);
+
+   const DNN::EActivationFunction fSig = this->GetActivationFunctionF1();
+   const DNN::EActivationFunction fTan = this->GetActivationFunctionF2();
+   DNN::evaluateDerivativeMatrix<Architecture_t>(fDerivativesInput[t], fSig, fInputValue);
+   DNN::evaluateMatrix<Architecture_t>(fInputValue, fSig);
+   DNN::evaluateDerivativeMatrix<Architecture_t>(fDerivativesForget[t], fSig, fForgetValue);
+   DNN::evaluateMatrix<Architecture_t>(fForgetValue, fSig);
+   DNN::evaluateDerivativeMatrix<Architecture_t>(fDerivativesCandidate[t], fTan, fCandidateValue);
+   DNN::evaluateMatrix<Architecture_t>(fCandidateValue, fTan);
+   DNN::evaluateDerivativeMatrix<Architecture_t>(fDerivativesOutput[t], fSig, fOutputValue);
+   DNN::evaluateMatrix<Architecture_t>(fOutputValue, fSig);
+}
+
  //______________________________________________________________________________
 template <typename Architecture_t>
 auto inline TBasicLSTMLayer<Architecture_t>::Forward(Tensor_t &input, bool  isTraining )
@@ -616,10 +660,7 @@ auto inline TBasicLSTMLayer<Architecture_t>::Forward(Tensor_t &input, bool  isTr
    for (size_t t = 0; t < fTimeSteps; ++t) {
       /* Feed forward network: value of each gate being computed at each timestep t. */
       Matrix_t arrInputMt = arrInput[t];
-      InputGate(arrInputMt, fDerivativesInput[t]);
-      ForgetGate(arrInputMt, fDerivativesForget[t]);
-      CandidateValue(arrInputMt, fDerivativesCandidate[t]);
-      OutputGate(arrInputMt, fDerivativesOutput[t]);
+      GatesForward(arrInputMt, t, DNN::HasFusedRecurrentGates<Architecture_t>());
 
       Architecture_t::Copy(this->GetInputGateTensorAt(t), fInputValue);
       Architecture_t::Copy(this->GetForgetGateTensorAt(t), fForgetValue);
@@ -219,6 +219,7 @@ namespace TMVA {
       Bool_t fComputeCorrelations = kFALSE;           ///< Whether to force computation of correlations or not
 
       Bool_t                     fScaleWithPreselEff; ///< how to deal with requested #events in connection with preselection cuts
+      Bool_t                     fReadRequestedOnly;  ///< stop reading the trees of a class once its requested events are read
 
       // the event
       TTree*                     fCurrentTree;        ///< the tree, events are currently read from
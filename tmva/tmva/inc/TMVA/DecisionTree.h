@@ -41,6 +41,7 @@
 //////////////////////////////////////////////////////////////////////////
 
 #include "TH2.h"
+#include <map>
 #include <vector>
 
 #include "TMVA/Types.h"
@@ -108,6 +109,7 @@ namespace TMVA {
       Double_t TrainNode( const EventConstList & eventSample,  DecisionTreeNode *node ) { return TrainNodeFast( eventSample, node ); }
       Double_t TrainNodeFast( const EventConstList & eventSample,  DecisionTreeNode *node );
       Double_t TrainNodeFull( const EventConstList & eventSample,  DecisionTreeNode *node );
+      Double_t TrainNodeHist( const EventConstList & eventSample,  DecisionTreeNode *node );
       void    GetRandomisedVariables(Bool_t *useVariable, UInt_t *variableMap, UInt_t & nVars);
       std::vector<Double_t>  GetFisherCoefficients(const EventConstList &eventSample, UInt_t nFisherVars, UInt_t *mapVarInFisher);
 
@@ -191,6 +193,7 @@ namespace TMVA {
       inline void SetUseFisherCuts(Bool_t t=kTRUE)  { fUseFisherCuts = t;}
       inline void SetMinLinCorrForFisher(Double_t min){fMinLinCorrForFisher = min;}
       inline void SetUseExclusiveVars(Bool_t t=kTRUE){fUseExclusiveVars = t;}
+      inline void SetUseHistogramSplits(Bool_t t=kTRUE){fUseHistogramSplits = t;}
       inline void SetNVars(Int_t n){fNvars = n;}
 
    private:
@@ -202,11 +205,21 @@ namespace TMVA {
       // calculates the purity S/(S+B) of a given event sample
       Double_t SamplePurity(EventList eventSample);
 
+      // histograms of the fixed binning used by TrainNodeHist
+      void FillNodeHistogram( const EventConstList & eventSample, std::vector<Double_t> & hist ) const;
+      void SplitNodeHistogram( const DecisionTreeNode *node,
+                               const EventConstList & leftSample, const DecisionTreeNode *leftNode,
+                               const EventConstList & rightSample, const DecisionTreeNode *rightNode );
+
       UInt_t    fNvars;               ///< number of variables used to separate S and B
       Int_t     fNCuts;               ///< number of grid point in variable cut scans
       Bool_t    fUseFisherCuts;       ///< use multivariate splits using the Fisher criterium
       Double_t  fMinLinCorrForFisher; ///< the minimum linear correlation between two variables demanded for use in fisher criterium in node splitting
       Bool_t    fUseExclusiveVars;    ///< individual variables already used in fisher criterium are not anymore analysed individually for node splitting
+      Bool_t    fUseHistogramSplits;  ///< find the node splits on a binning fixed for the whole tree, see TrainNodeHist
+      std::vector<Double_t> fHistXmin;        ///< lower edge of the fixed binning of each variable
+      std::vector<Double_t> fHistInvBinWidth; ///< inverse bin width of the fixed binning of each variable
+      std::map<const DecisionTreeNode*, std::vector<Double_t> > fNodeHistograms; ///< histograms of the nodes that are still to be split
 
       SeparationBase *fSepType;       ///< the separation criteria
       RegressionVariance *fRegType;   ///< the separation criteria used in Regression
@@ -107,6 +107,8 @@ namespace TMVA {
 
       // calculate the MVA value
       Double_t GetMvaValue( Double_t* err = nullptr, Double_t* errUpper = nullptr);
+      // calculate the MVA values of a batch of events, looping over the events inside the loop over the trees
+      std::vector<Double_t> GetBatchMvaValues( const std::vector<const TMVA::Event*>& events );
 
       // get the actual forest size (might be less than fNTrees, the requested one, if boosting is stopped early
       UInt_t   GetNTrees() const {return fForest.size();}
@@ -236,6 +238,7 @@ namespace TMVA {
       Bool_t                          fUseFisherCuts;       ///< use multivariate splits using the Fisher criterium
       Double_t                        fMinLinCorrForFisher; ///< the minimum linear correlation between two variables demanded for use in fisher criterium in node splitting
       Bool_t                          fUseExclusiveVars;    ///< individual variables already used in fisher criterium are not anymore analysed individually for node splitting
+      Bool_t                          fUseHistogramSplits;  ///< find the node splits on a binning fixed for the whole tree
       Bool_t                          fUseYesNoLeaf;        ///< use sig or bkg classification in leave nodes or sig/bkg
       Double_t                        fNodePurityLimit;     ///< purity limit for sig/bkg nodes
       UInt_t                          fNNodesMax;           ///< max # of nodes
@@ -200,6 +200,9 @@ namespace TMVA {
       // signal/background classification response
       Double_t GetMvaValue( const TMVA::Event* const ev, Double_t* err = nullptr, Double_t* errUpper = nullptr );
 
+      // signal/background classification response for a batch of untransformed events (no error calculation)
+      virtual std::vector<Double_t> GetBatchMvaValues( const std::vector<const TMVA::Event*>& events );
+
    protected:
       // helper function to set errors to -1
       void NoErrorCalc(Double_t* const err, Double_t* const errUpper);
@@ -421,6 +424,9 @@ namespace TMVA {
       const Event*     GetTrainingEvent( Long64_t ievt ) const;
       const Event*     GetTestingEvent ( Long64_t ievt ) const;
       const std::vector<TMVA::Event*>& GetEventCollection( Types::ETreeType type );
+      // transformed copies, owned by storage, of a batch of events (used by the GetBatchMvaValues implementations)
+      std::vector<TMVA::Event*> TransformBatch( const std::vector<const TMVA::Event*>& events,
+                                                std::vector<TMVA::Event>& storage ) const;
 
       TrainingHistory  fTrainHistory;
       // ---------- public auxiliary methods ---------------------------------------
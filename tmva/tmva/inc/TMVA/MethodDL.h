@@ -161,9 +161,16 @@ private:
    void TrainDeepNet();
 
    /// perform prediction of the deep neural network
-   /// using batches (called by GetMvaValues)
+   /// using batches of the given transformed events (called by GetMvaValues and GetBatchMvaValues)
    template <typename Architecture_t>
-   std::vector<Double_t> PredictDeepNet(Long64_t firstEvt, Long64_t lastEvt, size_t batchSize, Bool_t logProgress);
+   std::vector<Double_t> PredictDeepNet(const std::vector<Event *> &events, Long64_t firstEvt, Long64_t lastEvt,
+                                        size_t batchSize, Bool_t logProgress);
+
+   /// perform the batch prediction on the architecture used for the training
+   std::vector<Double_t> PredictDeepNet(const std::vector<Event *> &events, size_t batchSize);
+
+   /// batch size used by default for the evaluation
+   size_t GetEvaluationBatchSize() const;
 
    /// Get the input event tensor for evaluation
    /// Internal function to fill the fXInput tensor with the correct shape from TMVA current Event class
@@ -239,6 +246,8 @@ public:
    void Train();
 
    Double_t GetMvaValue(Double_t *err = nullptr, Double_t *errUpper = nullptr);
+   /*! Evaluate a batch of events with the network built for the evaluation batch size */
+   virtual std::vector<Double_t> GetBatchMvaValues(const std::vector<const Event *> &events);
    virtual const std::vector<Float_t>& GetRegressionValues();
    virtual const std::vector<Float_t>& GetMulticlassValues();
 
@@ -7,6 +7,9 @@
 #include <memory>
 #include <cmath>
 #include <mutex>
+#include <deque>
+#include <future>
+#include <algorithm>
 
 #include "TMVA/RTensor.hxx"
 #include "ROOT/RDF/RDatasetSpec.hxx"
@@ -48,7 +51,8 @@ private:
 
    bool fUseWholeFile = true;
 
-   std::unique_ptr<TMVA::Experimental::RTensor<float>> fChunkTensor;
+   /// One tensor per chunk that can be loaded at the same time
+   std::vector<std::unique_ptr<TMVA::Experimental::RTensor<float>>> fChunkTensors;
    std::unique_ptr<TMVA::Experimental::RTensor<float>> fCurrentBatch;
 
    std::vector<std::vector<std::size_t>> fTrainingIdxs;
@@ -68,7 +72,7 @@ public:
                    const std::size_t batchSize, const std::vector<std::string> &cols,
                    const std::vector<std::string> &filters = {}, const std::vector<std::size_t> &vecSizes = {},
                    const float vecPadding = 0.0, const float validationSplit = 0.0, const std::size_t maxChunks = 0,
-                   const std::size_t numColumns = 0, bool shuffle = true)
+                   const std::size_t numColumns = 0, bool shuffle = true, const std::size_t numLoadingThreads = 1)
       : fTreeName(treeName),
         fFileName(fileName),
         fChunkSize(chunkSize),
@@ -95,9 +99,13 @@ public:
          fTreeName, fFileName, fChunkSize, fCols, fFilters, fVecSizes, fVecPadding);
       fBatchLoader = std::make_unique<TMVA::Experimental::Internal::RBatchLoader>(fBatchSize, fNumColumns, fMaxBatches);
 
-      // Create tensor to load the chunk into
-      fChunkTensor =
-         std::make_unique<TMVA::Experimental::RTensor<float>>((std::vector<std::size_t>){fChunkSize, fNumColumns});
+      // Create the tensors to load the chunks into. With filters, the first entry of a chunk depends on the previous
+      // chunk and the chunks are loaded one after the other.
+      const std::size_t numChunkTensors = fFilters.empty() ? std::max<std::size_t>(numLoadingThreads, 1) : 1;
+      for (std::size_t i = 0; i < numChunkTensors; i++) {
+         fChunkTensors.emplace_back(
+            std::make_unique<TMVA::Experimental::RTensor<float>>((std::vector<std::size_t>){fChunkSize, fNumColumns}));
+      }
    }
 
    ~RBatchGenerator() { DeActivate(); }
@@ -163,6 +171,12 @@ public:
    {
       ROOT::EnableThreadSafety();
 
+      if (fChunkTensors.size() > 1) {
+         LoadChunksConcurrently();
+         fBatchLoader->DeActivate();
+         return;
+      }
+
       for (std::size_t current_chunk = 0; ((current_chunk < fMaxChunks) || fUseWholeFile) && fCurrentRow < fNumEntries;
            current_chunk++) {
 
@@ -174,10 +188,10 @@ public:
          }
 
          // A pair that consists the proccessed, and passed events while loading the chunk
-         std::pair<std::size_t, std::size_t> report = fChunkLoader->LoadChunk(*fChunkTensor, fCurrentRow);
+         std::pair<std::size_t, std::size_t> report = fChunkLoader->LoadChunk(*fChunkTensors[0], fCurrentRow);
          fCurrentRow += report.first;
 
-         CreateBatches(current_chunk, report.second);
+         CreateBatches(*fChunkTensors[0], current_chunk, report.second);
 
          // Stop loading if the number of processed events is smaller than the desired chunk size
          if (report.first < fChunkSize) {
@@ -188,20 +202,64 @@ public:
       fBatchLoader->DeActivate();
    }
 
+   /// \brief Load the chunks of an unfiltered dataset on one thread per chunk tensor. The first entry of every chunk
+   /// is known in advance, so that the next chunks are loaded while the batches of the current chunk are created.
+   void LoadChunksConcurrently()
+   {
+      std::size_t numChunks = (fNumEntries + fChunkSize - 1) / fChunkSize;
+      if (!fUseWholeFile)
+         numChunks = std::min(numChunks, fMaxChunks);
+
+      // The chunks are loaded in order, chunk i into fChunkTensors[i % fChunkTensors.size()]
+      std::deque<std::future<std::pair<std::size_t, std::size_t>>> loadingChunks;
+      std::size_t nextChunk = 0;
+      auto loadNextChunk = [&]() {
+         auto &chunkTensor = *fChunkTensors[nextChunk % fChunkTensors.size()];
+         const std::size_t firstRow = nextChunk * fChunkSize;
+         loadingChunks.emplace_back(std::async(std::launch::async, [this, &chunkTensor, firstRow]() {
+            return fChunkLoader->LoadChunk(chunkTensor, firstRow);
+         }));
+         nextChunk++;
+      };
+      while (nextChunk < std::min(numChunks, fChunkTensors.size()))
+         loadNextChunk();
+
+      for (std::size_t current_chunk = 0; current_chunk < numChunks; current_chunk++) {
+         std::pair<std::size_t, std::size_t> report = loadingChunks.front().get();
+         loadingChunks.pop_front();
+
+         // stop the loop when the loading is not active anymore, the destruction of the remaining futures waits for
+         // the chunks that are still being loaded
+         {
+            std::lock_guard<std::mutex> lock(fIsActiveLock);
+            if (!fIsActive)
+               return;
+         }
+
+         CreateBatches(*fChunkTensors[current_chunk % fChunkTensors.size()], current_chunk, report.second);
+
+         // The chunk tensor is free again once its batches are created
+         if (nextChunk < numChunks)
+            loadNextChunk();
+      }
+   }
+
    /// \brief Create batches for the current_chunk.
+   /// \param chunkTensor
    /// \param currentChunk
    /// \param processedEvents
-   void CreateBatches(std::size_t currentChunk, std::size_t processedEvents)
+   void CreateBatches(const TMVA::Experimental::RTensor<float> &chunkTensor, std::size_t currentChunk,
+                      std::size_t processedEvents)
    {
 
       // Check if the indices in this chunk where already split in train and validations
       if (fTrainingIdxs.size() > currentChunk) {
-         fBatchLoader->CreateTrainingBatches(*fChunkTensor, fTrainingIdxs[currentChunk], fShuffle);
+         fBatchLoader->CreateTrainingBatches(chunkTensor, fTrainingIdxs[currentChunk], fShuffle);
       } else {
          // Create the Validation batches if this is not the first epoch
          createIdxs(processedEvents);
-         fBatchLoader->CreateTrainingBatches(*fChunkTensor, fTrainingIdxs[currentChunk], fShuffle);
-         fBatchLoader->CreateValidationBatches(*fChunkTensor, fValidationIdxs[currentChunk]);
+         fBatchLoader->CreateTrainingBatches(chunkTensor, fTrainingIdxs[currentChunk], fShuffle);
+         fBatchLoader->CreateValidationBatches(chunkTensor, fValidationIdxs[currentChunk]);
       }
    }
 
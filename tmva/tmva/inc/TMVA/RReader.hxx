@@ -111,6 +111,7 @@ inline XMLConfig ParseXMLConfig(const std::string &filename)
 
 /// A replacement for the TMVA::Reader legacy interface.
 /// Performs inference for TMVA models stored as XML files.
+/// Classification models are evaluated on a RTensor in one batch, see TMVA::Reader::EvaluateMVA.
 /// For neural network inference consider using [SOFIE](https://github.com/root-project/root/blob/master/tmva/sofie/README.md) instead.
 class RReader {
 private:
@@ -198,18 +199,30 @@ public:
       if (fAnalysisType == Internal::AnalysisType::Multiclass)
          y = y.Reshape({numEntries, numClasses});
 
+      // Classification: evaluate all entries in one batch from the columns of the input
+      if (fAnalysisType == Internal::AnalysisType::Classification) {
+         std::vector<std::vector<float>> columns(numVars, std::vector<float>(numEntries));
+         std::vector<const float *> columnPtrs(numVars);
+         for (std::size_t j = 0; j < numVars; j++) {
+            for (std::size_t i = 0; i < numEntries; i++)
+               columns[j][i] = x(i, j);
+            columnPtrs[j] = columns[j].data();
+         }
+         R__WRITE_LOCKGUARD(ROOT::gCoreMutex);
+         const auto values = fReader->EvaluateMVA(columnPtrs, numEntries, name);
+         for (std::size_t i = 0; i < numEntries; i++)
+            y(i) = values[i];
+         return y;
+      }
+
       // Fill output tensor
       for (std::size_t i = 0; i < numEntries; i++) {
          for (std::size_t j = 0; j < numVars; j++) {
             fValues[j] = x(i, j);
          }
          R__WRITE_LOCKGUARD(ROOT::gCoreMutex);
-         // Classification
-         if (fAnalysisType == Internal::AnalysisType::Classification) {
-            y(i) = fReader->EvaluateMVA(name);
-         }
          // Regression
-         else if (fAnalysisType == Internal::AnalysisType::Regression) {
+         if (fAnalysisType == Internal::AnalysisType::Regression) {
             y(i) = fReader->EvaluateRegression(name)[0];
          }
          // Multiclass
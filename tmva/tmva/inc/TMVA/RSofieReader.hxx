@@ -17,6 +17,7 @@
 #define TMVA_RSOFIEREADER
 
 
+#include <algorithm>
 #include <string>
 #include <vector>
 #include <memory> // std::unique_ptr
@@ -41,6 +42,9 @@ namespace Experimental {
 /// and performing the inference using SOFIE
 /// It is reccomended to use ONNX if possible since there is a larger support for
 /// model operators.
+/// The batch size of the generated code is given by the first dimension of the first
+/// input shape (default is 1). Compute on a RTensor evaluates the model on blocks of
+/// batch size events, which amortises the cost of the BLAS calls for small networks.
 
 class RSofieReader  {
 
@@ -146,6 +150,7 @@ public:
          batchSize = inputShape[0][0];
          if (batchSize < 1) batchSize = 1;
       }
+      fBatchSize = batchSize;
       if (verbose) std::cout << "generating the code with batch size = " << batchSize << " ...\n";
       parserCode += "model.Generate(TMVA::Experimental::SOFIE::Options::kDefault,"
                    + ROOT::Math::Util::ToString(batchSize) + "); \n";
@@ -227,7 +232,14 @@ public:
       R__WRITE_LOCKGUARD(ROOT::gCoreMutex);
 
       // Evaluate TMVA model (need to add support for multiple outputs)
-      auto result =  fFuncPtr(fSessionPtr, x.data());
+      if (fBatchSize == 1)
+         return fFuncPtr(fSessionPtr, x.data());
+
+      // the model expects a full batch: pad with zeros after the event
+      std::vector<float> input(fBatchSize * x.size());
+      std::copy(x.begin(), x.end(), input.begin());
+      auto result = fFuncPtr(fSessionPtr, input.data());
+      result.resize(result.size() / fBatchSize);
       return result;
 
    }
@@ -241,15 +253,30 @@ public:
       }
       const auto nrows = x.GetShape()[0];
       const auto rowsize = x.GetStrides()[0];
-      auto result = fFuncPtr(fSessionPtr, x.GetData());
 
-      RTensor<float> y({nrows, result.size()}, MemoryLayout::ColumnMajor);
-      std::copy(result.begin(),result.end(), y.GetData());
+      // Take lock to protect model evaluation
+      R__WRITE_LOCKGUARD(ROOT::gCoreMutex);
+
       //const bool layout = x.GetMemoryLayout() == MemoryLayout::ColumnMajor ? false : true;
       // assume column major layout
-      for (size_t i = 1; i < nrows; i++) {
-         result = fFuncPtr(fSessionPtr, x.GetData() + i*rowsize);
-         std::copy(result.begin(),result.end(), y.GetData() + i*result.size());
+      // evaluate the model on blocks of fBatchSize events; the last block is padded with zeros
+      RTensor<float> y({0});
+      std::vector<float> lastBlock;
+      size_t noutputs = 0;
+      for (size_t i = 0; i == 0 || i < nrows; i += fBatchSize) {
+         const size_t nevents = std::min(fBatchSize, nrows - i);
+         const float *input = x.GetData() + i * rowsize;
+         if (nevents < fBatchSize) {
+            lastBlock.assign(fBatchSize * rowsize, 0.);
+            std::copy(input, input + nevents * rowsize, lastBlock.begin());
+            input = lastBlock.data();
+         }
+         auto result = fFuncPtr(fSessionPtr, input);
+         if (i == 0) {
+            noutputs = result.size() / fBatchSize;
+            y = RTensor<float>({nrows, noutputs}, MemoryLayout::ColumnMajor);
+         }
+         std::copy(result.begin(), result.begin() + nevents * noutputs, y.GetData() + i * noutputs);
       }
       return y;
    }
@@ -257,6 +284,7 @@ public:
 private:
 
    bool fInitialized = false;
+   size_t fBatchSize = 1;  // batch size of the generated model
    void * fSessionPtr = nullptr;
    std::function<std::vector<float> (void *, const float *)> fFuncPtr;
 
@@ -93,6 +93,10 @@ namespace TMVA {
       Double_t EvaluateMVA( MethodBase* method,           Double_t aux = 0 );
       Double_t EvaluateMVA( const TString& methodTag,     Double_t aux = 0 );
 
+      // returns the MVA responses for a batch of nEvents events, given as one array of values per variable
+      std::vector<Double_t> EvaluateMVA( const std::vector<const Float_t*>& columns, Long64_t nEvents,
+                                         const TString& methodTag, Double_t aux = 0 );
+
       // returns error on MVA response for given event
       // NOTE: must be called AFTER "EvaluateMVA(...)" call !
       Double_t GetMVAError() const { return fMvaEventError; }
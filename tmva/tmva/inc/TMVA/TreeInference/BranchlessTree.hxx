@@ -30,6 +30,10 @@ namespace Experimental {
 
 namespace Internal {
 
+/// Number of events evaluated together: a tree is traversed for a block of events at a time, which keeps
+/// it in the cache and allows to vectorize the traversal over the events
+constexpr int kBlockSize = 16;
+
 /// Fill the empty nodes of a sparse tree recursively
 template <typename T>
 void RecursiveFill(int thisIndex, int lastIndex, int treeDepth, int maxTreeDepth, std::vector<T> &thresholds,
@@ -65,6 +69,7 @@ struct BranchlessTree {
    std::vector<int> fInputs;   ///< Cut variables / inputs
 
    inline T Inference(const T *input, const int stride);
+   inline void InferenceBlock(const T *input, const int stride, const int strideBatch, const int n, T *predictions);
    inline void FillSparse();
    inline std::string GetInferenceCode(const std::string& funcName, const std::string& typeName);
 };
@@ -83,6 +88,27 @@ inline T BranchlessTree<T>::Inference(const T *input, const int stride)
    return fThresholds[index];
 }
 
+/// Perform inference on a block of input vectors, traversing the levels of the tree for all events together
+/// \param[in] input Pointer to data containing the input values of the first event of the block
+/// \param[in] stride Stride to go from one input variable to the next one
+/// \param[in] strideBatch Stride to go from one event to the next one
+/// \param[in] n Number of events in the block, at most Internal::kBlockSize
+/// \param[in,out] predictions Pointer to the predictions of the block, the tree scores are added to them
+template <typename T>
+inline void
+BranchlessTree<T>::InferenceBlock(const T *input, const int stride, const int strideBatch, const int n, T *predictions)
+{
+   int index[Internal::kBlockSize] = {};
+   for (int level = 0; level < fTreeDepth; ++level) {
+      for (int j = 0; j < n; ++j) {
+         index[j] = 2 * index[j] + 1 + (input[j * strideBatch + fInputs[index[j]] * stride] > fThresholds[index[j]]);
+      }
+   }
+   for (int j = 0; j < n; ++j) {
+      predictions[j] += fThresholds[index[j]];
+   }
+}
+
 /// Fill nodes of a sparse tree forming a full tree
 ///
 /// Sparse parts of the tree are marked with -1 values in the feature vector. The
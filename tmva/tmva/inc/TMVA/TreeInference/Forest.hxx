@@ -27,6 +27,7 @@
 #include <cmath>
 #include <algorithm>
 
+#include "RConfigure.h"
 #include "TFile.h"
 #include "TDirectory.h"
 #include "TInterpreter.h"
@@ -36,6 +37,12 @@
 #include "BranchlessTree.hxx"
 #include "Objectives.hxx"
 
+#ifdef R__USE_IMT
+#include "TROOT.h"
+#include "ROOT/TSeq.hxx"
+#include "ROOT/TThreadExecutor.hxx"
+#endif
+
 namespace TMVA {
 namespace Experimental {
 
@@ -49,6 +56,26 @@ T *GetObjectSafe(TFile *f, const std::string &n, const std::string &m)
    return v;
 }
 
+/// Minimum number of events evaluated by a task of the multi-threaded inference
+constexpr int kMinEventsPerTask = 4096;
+
+/// Call func(begin, end) on ranges of the rows, in parallel if implicit multi-threading is enabled
+template <typename F>
+void ForEachRowRange(const int rows, F &&func)
+{
+#ifdef R__USE_IMT
+   if (ROOT::IsImplicitMTEnabled() && rows >= 2 * kMinEventsPerTask) {
+      const int nTasks = std::min<int>(rows / kMinEventsPerTask, 4 * ROOT::GetThreadPoolSize());
+      ROOT::TThreadExecutor executor;
+      executor.Foreach([&](int task) { func(rows / nTasks * task + std::min(task, rows % nTasks),
+                                           rows / nTasks * (task + 1) + std::min(task + 1, rows % nTasks)); },
+                       ROOT::TSeqI(nTasks));
+      return;
+   }
+#endif
+   func(0, rows);
+}
+
 template <typename T>
 bool CompareTree(const BranchlessTree<T> &a, const BranchlessTree<T> &b)
 {
@@ -75,6 +102,10 @@ struct ForestBase {
 
 /// Perform inference of the forest on a batch of inputs
 ///
+/// The events are processed in blocks of Internal::kBlockSize events, each tree being evaluated for
+/// all events of a block before going to the next tree. With implicit multi-threading enabled,
+/// large batches are split in ranges of events evaluated in parallel.
+///
 /// \param[in] inputs Pointer to data containing the inputs
 /// \param[in] rows Number of events in inputs vector
 /// \param[in] layout Row major (true) or column major (false) memory layout
@@ -84,13 +115,18 @@ inline void ForestBase<T, ForestType>::Inference(const T *inputs, const int rows
 {
    const auto strideTree = layout ? 1 : rows;
    const auto strideBatch = layout ? fNumInputs : 1;
-   for (int i = 0; i < rows; i++) {
-      predictions[i] = 0.0;
-      for (auto &tree : fTrees) {
-         predictions[i] += tree.Inference(inputs + i * strideBatch, strideTree);
+   Internal::ForEachRowRange(rows, [&](int begin, int end) {
+      for (int i = begin; i < end; i += Internal::kBlockSize) {
+         const int n = std::min(Internal::kBlockSize, end - i);
+         std::fill(predictions + i, predictions + i + n, T(0.0));
+         for (auto &tree : fTrees) {
+            tree.InferenceBlock(inputs + i * strideBatch, strideTree, strideBatch, n, predictions + i);
+         }
+         for (int j = i; j < i + n; j++) {
+            predictions[j] = fObjectiveFunc(predictions[j]);
+         }
       }
-      predictions[i] = fObjectiveFunc(predictions[i]);
-   }
+   });
 }
 
 /// Forest using branchless trees
@@ -309,13 +345,18 @@ BranchlessJittedForest<T>::Load(const std::string &key, const std::string &filen
              << "\n{\n"
              << "   const auto strideTree = layout ? 1 : rows;\n"
              << "   const auto strideBatch = layout ? " << this->fNumInputs << " : 1;\n"
-             << "   for (int i = 0; i < rows; i++) {\n"
-             << "      predictions[i] = 0.0;\n";
+             << "   for (int i = 0; i < rows; i += " << Internal::kBlockSize << ") {\n"
+             << "      const int n = rows - i < " << Internal::kBlockSize << " ? rows - i : " << Internal::kBlockSize
+             << ";\n"
+             << "      const " << typeName << "* x = inputs + i * strideBatch;\n"
+             << "      " << typeName << "* y = predictions + i;\n"
+             << "      for (int j = 0; j < n; j++) y[j] = 0.0;\n";
+   // evaluate each tree on the block of events
    for (int i = 0; i < static_cast<int>(codes.size()); i++) {
       std::stringstream ss;
       ss << "tree" << i;
       const std::string funcName = ss.str();
-      jitForest << "      predictions[i] += " << funcName << "(inputs + i * strideBatch, strideTree);\n";
+      jitForest << "      for (int j = 0; j < n; j++) y[j] += " << funcName << "(x + j * strideBatch, strideTree);\n";
    }
    jitForest << "   }\n"
              << "}\n"
@@ -350,6 +391,9 @@ BranchlessJittedForest<T>::Load(const std::string &key, const std::string &filen
 
 /// Perform inference of the forest with the jitted branchless implementation on a batch of inputs
 ///
+/// With implicit multi-threading enabled, large batches of inputs in row major layout are split in ranges
+/// of events evaluated in parallel.
+///
 /// \param[in] inputs Pointer to data containing the inputs
 /// \param[in] rows Number of events in inputs vector
 /// \param[in] layout Row major (true) or column major (false) memory layout
@@ -357,9 +401,16 @@ BranchlessJittedForest<T>::Load(const std::string &key, const std::string &filen
 template <typename T>
 void BranchlessJittedForest<T>::Inference(const T *inputs, const int rows, bool layout, T *predictions)
 {
-   this->fTrees(inputs, rows, layout, predictions);
-   for (int i = 0; i < rows; i++)
-      predictions[i] = this->fObjectiveFunc(predictions[i]);
+   auto inferRange = [&](int begin, int end) {
+      this->fTrees(inputs + begin * this->fNumInputs, end - begin, layout, predictions + begin);
+      for (int i = begin; i < end; i++)
+         predictions[i] = this->fObjectiveFunc(predictions[i]);
+   };
+   // in column major layout the stride between the input variables is the number of rows
+   if (layout)
+      Internal::ForEachRowRange(rows, inferRange);
+   else
+      inferRange(0, rows);
 }
 
 } // namespace Experimental
@@ -359,8 +359,9 @@ void TMVA::CrossValidation::InitOptions()
    DeclareOptionRef(fNumWorkerProcs, "NumWorkerProcs",
       "Determines how many processes to use for evaluation. 1 means no"
       " parallelisation. 2 means use 2 processes. 0 means figure out the"
-      " number automatically based on the number of cpus available. Default"
-      " 1.");
+      " number automatically based on the number of cpus available. The"
+      " folds of all the booked methods are distributed over the processes."
+      " Default 1.");
 
    DeclareOptionRef(fFoldFileOutput, "FoldFileOutput",
                     "If given a TMVA output file will be generated for each fold. Filename will be the same as "
@@ -592,51 +593,70 @@ void TMVA::CrossValidation::Evaluate()
       fFoldStatus = kTRUE;
    }
 
-   fResults.reserve(fMethods.size());
    for (auto & methodInfo : fMethods) {
-      CrossValidationResult result{fNumFolds};
-
-      TString methodTypeName = methodInfo.GetValue<TString>("MethodName");
-      TString methodTitle = methodInfo.GetValue<TString>("MethodTitle");
-
-      if (methodTypeName == "") {
+      if (methodInfo.GetValue<TString>("MethodName") == "") {
          Log() << kFATAL << "No method booked for cross-validation" << Endl;
       }
+   }
 
+   // Process K folds
+   auto nWorkers = fNumWorkerProcs;
+   if (nWorkers == 1) {
+      // Fall back to global config
+      nWorkers = TMVA::gConfig().GetNumWorkers();
+   }
+#ifdef _MSC_VER
+   nWorkers = 1;
+#endif
+
+   // The fold results of all the methods, the folds of method i are at [i * fNumFolds, (i + 1) * fNumFolds)
+   std::vector<CrossValidationFoldResult> foldResults;
+   if (nWorkers == 1) {
+      for (auto & methodInfo : fMethods) {
+         TMVA::MsgLogger::EnableOutput();
+         Log() << kINFO << Endl;
+         Log() << kINFO << Endl;
+         Log() << kINFO << "========================================" << Endl;
+         Log() << kINFO << "Processing folds for method " << methodInfo.GetValue<TString>("MethodTitle") << Endl;
+         Log() << kINFO << "========================================" << Endl;
+         Log() << kINFO << Endl;
+
+         for (UInt_t iFold = 0; iFold < fNumFolds; ++iFold) {
+            foldResults.push_back(ProcessFold(iFold, methodInfo));
+         }
+      }
+   } else {
+#ifndef _MSC_VER
       TMVA::MsgLogger::EnableOutput();
       Log() << kINFO << Endl;
       Log() << kINFO << Endl;
       Log() << kINFO << "========================================" << Endl;
-      Log() << kINFO << "Processing folds for method " << methodTitle << Endl;
+      Log() << kINFO << "Processing folds for " << fMethods.size() << " methods with " << nWorkers << " workers" << Endl;
       Log() << kINFO << "========================================" << Endl;
       Log() << kINFO << Endl;
 
-      // Process K folds
-      auto nWorkers = fNumWorkerProcs;
-      if (nWorkers == 1) {
-         // Fall back to global config
-         nWorkers = TMVA::gConfig().GetNumWorkers();
-      }
-      if (nWorkers == 1) {
-         for (UInt_t iFold = 0; iFold < fNumFolds; ++iFold) {
-            auto fold_result = ProcessFold(iFold, methodInfo);
-            result.Fill(fold_result);
-         }
-      } else {
-#ifndef _MSC_VER
-         ROOT::TProcessExecutor workers(nWorkers);
-         std::vector<CrossValidationFoldResult> result_vector;
-
-         auto workItem = [this, methodInfo](UInt_t iFold) {
-            return ProcessFold(iFold, methodInfo);
-         };
+      // Distribute the folds of all the methods at once, so that e.g. 3 methods with 5 folds keep 15 workers busy.
+      // The workers are forked processes: they share the events of the data set, the folds are views on them.
+      ROOT::TProcessExecutor workers(nWorkers);
 
-         result_vector = workers.Map(workItem, ROOT::TSeqI(fNumFolds));
+      auto workItem = [this](UInt_t iWork) {
+         return ProcessFold(iWork % fNumFolds, fMethods[iWork / fNumFolds]);
+      };
 
-         for (auto && fold_result : result_vector) {
-            result.Fill(fold_result);
-         }
+      foldResults = workers.Map(workItem, ROOT::TSeqI(fMethods.size() * fNumFolds));
 #endif
+   }
+
+   fResults.reserve(fMethods.size());
+   for (UInt_t iMethod = 0; iMethod < fMethods.size(); ++iMethod) {
+      auto & methodInfo = fMethods[iMethod];
+      CrossValidationResult result{fNumFolds};
+
+      TString methodTypeName = methodInfo.GetValue<TString>("MethodName");
+      TString methodTitle = methodInfo.GetValue<TString>("MethodTitle");
+
+      for (UInt_t iFold = 0; iFold < fNumFolds; ++iFold) {
+         result.Fill(foldResults[iMethod * fNumFolds + iFold]);
       }
 
       fResults.push_back(result);
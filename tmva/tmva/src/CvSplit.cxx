@@ -62,12 +62,14 @@ void TMVA::CvSplit::PrepareFoldDataSet(DataSetInfo &dsi, UInt_t foldNumber, Type
       return;
    }
 
-   auto prepareDataSetInternal = [this, &dsi, foldNumber](std::vector<std::vector<Event *>> vec) {
+   // The folds only hold pointers to the events of the original data set, pass them by reference to avoid
+   // copying all of them for every fold
+   auto prepareDataSetInternal = [this, &dsi, foldNumber](const std::vector<std::vector<Event *>> &vec) {
       UInt_t numFolds = fTrainEvents.size();
 
       // Events in training set (excludes current fold)
       UInt_t nTotal = std::accumulate(vec.begin(), vec.end(), 0,
-                                      [&](UInt_t sum, std::vector<TMVA::Event *> v) { return sum + v.size(); });
+                                      [&](UInt_t sum, const std::vector<TMVA::Event *> &v) { return sum + v.size(); });
 
       UInt_t nTrain = nTotal - vec.at(foldNumber).size();
       UInt_t nTest = vec.at(foldNumber).size();
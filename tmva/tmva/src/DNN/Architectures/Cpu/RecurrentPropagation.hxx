@@ -17,11 +17,81 @@
 #include "TMVA/DNN/Architectures/Cpu.h"
 #include "TMVA/DNN/Architectures/Cpu/Blas.h"
 
+#include <algorithm>
+
 namespace TMVA
 {
 namespace DNN
 {
 
+template <typename AFloat>
+void TCpu<AFloat>::RecurrentGatesForward(const std::vector<TCpuMatrix<AFloat> *> &gates,
+                                         const TCpuMatrix<AFloat> &input, // BxD
+                                         const TCpuMatrix<AFloat> &state, // BxH
+                                         const std::vector<const TCpuMatrix<AFloat> *> &weights,      // HxD
+                                         const std::vector<const TCpuMatrix<AFloat> *> &stateWeights, // HxH
+                                         const std::vector<const TCpuMatrix<AFloat> *> &biases,       // Hx1
+                                         std::vector<TCpuMatrix<AFloat>> &workspace, bool restack)
+{
+   const size_t nGates = gates.size();
+   const size_t batchSize = input.GetNrows();
+   const size_t inputSize = input.GetNcols();
+   const size_t stateSize = state.GetNcols();
+
+   // workspace: the stacked input weights (D x nGates*H), state weights (H x nGates*H), biases and gate values
+   if (workspace.size() != 4 || workspace[3].GetNrows() != batchSize) {
+      workspace.clear();
+      workspace.emplace_back(inputSize, nGates * stateSize);
+      workspace.emplace_back(stateSize, nGates * stateSize);
+      workspace.emplace_back(nGates * stateSize, 1);
+      workspace.emplace_back(batchSize, nGates * stateSize);
+      restack = true;
+   }
+   auto &stackedWeights = workspace[0];
+   auto &stackedStateWeights = workspace[1];
+   auto &stackedBiases = workspace[2];
+   auto &gateValues = workspace[3];
+
+   // column block g of the stacked matrices is the transposed weight matrix of gate g
+   if (restack) {
+      for (size_t g = 0; g < nGates; g++) {
+         for (size_t i = 0; i < stateSize; i++) {
+            for (size_t j = 0; j < inputSize; j++)
+               stackedWeights(j, g * stateSize + i) = (*weights[g])(i, j);
+            for (size_t j = 0; j < stateSize; j++)
+               stackedStateWeights(j, g * stateSize + i) = (*stateWeights[g])(i, j);
+            stackedBiases(g * stateSize + i, 0) = (*biases[g])(i, 0);
+         }
+      }
+   }
+
+   // gate values = input . stacked weights + state . stacked state weights  (B x nGates*H)
+   Multiply(gateValues, input, stackedWeights);
+#ifdef R__HAS_TMVACPU
+   int m = (int)batchSize;
+   int k = (int)stateSize;
+   int n = (int)(nGates * stateSize);
+   char transa = 'N';
+   char transb = 'N';
+   AFloat alpha = 1.0;
+   AFloat beta = 1.0;
+   ::TMVA::DNN::Blas::Gemm(&transa, &transb, &m, &n, &k, &alpha, state.GetRawDataPointer(), &m,
+                           stackedStateWeights.GetRawDataPointer(), &k, &beta, gateValues.GetRawDataPointer(), &m);
+#else
+   TCpuMatrix<AFloat> tmpState(batchSize, nGates * stateSize);
+   Multiply(tmpState, state, stackedStateWeights);
+   ScaleAdd(gateValues, tmpState);
+#endif
+   AddRowWise(gateValues, stackedBiases);
+
+   // the gate values are stored column-major, the column block of each gate is contiguous
+   const AFloat *values = gateValues.GetRawDataPointer();
+   for (size_t g = 0; g < nGates; g++) {
+      std::copy(values + g * batchSize * stateSize, values + (g + 1) * batchSize * stateSize,
+                gates[g]->GetRawDataPointer());
+   }
+}
+
 template<typename AFloat>
 auto TCpu<AFloat>::RecurrentLayerBackward(TCpuMatrix<AFloat> & state_gradients_backward, // BxH
                                           TCpuMatrix<AFloat> & input_weight_gradients,
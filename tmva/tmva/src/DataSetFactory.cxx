@@ -94,6 +94,7 @@ TMVA::DataSetFactory::DataSetFactory() :
    fVerbose(kFALSE),
    fVerboseLevel(TString("Info")),
    fScaleWithPreselEff(0),
+   fReadRequestedOnly(kFALSE),
    fCurrentTree(0),
    fCurrentEvtIdx(0),
    fInputFormulas(0),
@@ -674,6 +675,8 @@ TMVA::DataSetFactory::InitOptions( TMVA::DataSetInfo& dsi,
 
    splitSpecs.DeclareOptionRef(fScaleWithPreselEff=kFALSE,"ScaleWithPreselEff","Scale the number of requested events by the eff. of the preselection cuts (or not)" );
 
+   splitSpecs.DeclareOptionRef(fReadRequestedOnly=kFALSE,"ReadRequestedOnly","With SplitMode=Block, stop reading the input trees of a class once nTrain+nTest of its events passed the cuts, instead of reading (and keeping in memory) all the events; the test events then directly follow the training events (default: false)" );
+
    // the number of events
 
    // fill in the numbers
@@ -718,6 +721,13 @@ TMVA::DataSetFactory::InitOptions( TMVA::DataSetInfo& dsi,
    else if (mixMode!=splitMode)
       Log() << kINFO << Form("Dataset[%s] : ",dsi.GetName()) << "DataSet splitmode="<<splitMode
             <<" differs from mixmode="<<mixMode<<Endl;
+
+   // the events which are not read must not change the selection of the training and testing events
+   if (fReadRequestedOnly && (splitMode != "BLOCK" || fScaleWithPreselEff)) {
+      Log() << kWARNING << Form("Dataset[%s] : ",dsi.GetName()) << "ReadRequestedOnly is only supported with"
+            << " SplitMode=Block and without ScaleWithPreselEff, all the events are read" << Endl;
+      fReadRequestedOnly = kFALSE;
+   }
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -773,8 +783,22 @@ TMVA::DataSetFactory::BuildEventVector( TMVA::DataSetInfo& dsi,
       // used for chains only
       TString currentFileName("");
 
+      // with ReadRequestedOnly, the number of events of the class after which the reading stops: only if the class
+      // has requested numbers of training and testing events and all its trees are split into training and testing
+      std::size_t maxEvents = 0;
+      if (fReadRequestedOnly && classEventCounts.nTrainingEventsRequested > 0 &&
+          classEventCounts.nTestingEventsRequested > 0 && classEventCounts.TrainTestSplitRequested == 0) {
+         maxEvents = classEventCounts.nTrainingEventsRequested + classEventCounts.nTestingEventsRequested;
+         const TString className = dsi.GetClassInfo(cl)->GetName();
+         for (auto it = dataInput.begin(className); it != dataInput.end(className); ++it) {
+            if (it->GetTreeType() != Types::kMaxTreeType) maxEvents = 0;
+         }
+      }
+      const EventVector &undefinedEvents = eventsmap[Types::kMaxTreeType].at(cl);
+      auto isClassFull = [&]() { return maxEvents > 0 && undefinedEvents.size() >= maxEvents; };
+
       std::vector<TreeInfo>::const_iterator treeIt(dataInput.begin(dsi.GetClassInfo(cl)->GetName()));
-      for (;treeIt!=dataInput.end(dsi.GetClassInfo(cl)->GetName()); ++treeIt) {
+      for (;treeIt!=dataInput.end(dsi.GetClassInfo(cl)->GetName()) && !isClassFull(); ++treeIt) {
 
          // read first the variables
          std::vector<Float_t> vars(nvars);
@@ -799,7 +823,7 @@ TMVA::DataSetFactory::BuildEventVector( TMVA::DataSetInfo& dsi,
 
          // loop over events in ntuple
          const UInt_t nEvts = currentInfo.GetTree()->GetEntries();
-         for (Long64_t evtIdx = 0; evtIdx < nEvts; evtIdx++) {
+         for (Long64_t evtIdx = 0; evtIdx < nEvts && !isClassFull(); evtIdx++) {
             currentInfo.GetTree()->LoadTree(evtIdx);
 
             // may need to reload tree in case of chains
@@ -854,7 +878,7 @@ TMVA::DataSetFactory::BuildEventVector( TMVA::DataSetInfo& dsi,
             }
 
             // now we read the information
-            for (Int_t idata = 0;  idata<sizeOfArrays; idata++) {
+            for (Int_t idata = 0;  idata<sizeOfArrays && !isClassFull(); idata++) {
                Bool_t contains_NaN_or_inf = kFALSE;
 
                auto checkNanInf = [&](std::map<TString, int> &msgMap, Float_t value, const char *what, const char *formulaTitle) {
@@ -981,6 +1005,10 @@ TMVA::DataSetFactory::BuildEventVector( TMVA::DataSetInfo& dsi,
          }
          currentInfo.GetTree()->ResetBranchAddresses();
       }
+
+      if (isClassFull())
+         Log() << kINFO << Form("Dataset[%s] : ",dsi.GetName()) << "Stopped reading the events of class "
+               << dsi.GetClassInfo(cl)->GetName() << " after the " << maxEvents << " requested ones" << Endl;
    }
 
    if (!nanInfWarnings.empty()) {
@@ -119,6 +119,7 @@ TMVA::DecisionTree::DecisionTree():
    fUseFisherCuts  (kFALSE),
    fMinLinCorrForFisher (1),
    fUseExclusiveVars (kTRUE),
+   fUseHistogramSplits (kFALSE),
    fSepType        (NULL),
    fRegType        (NULL),
    fMinSize        (0),
@@ -156,6 +157,7 @@ TMVA::DecisionTree::DecisionTree( TMVA::SeparationBase *sepType, Float_t minSize
    fUseFisherCuts  (kFALSE),
    fMinLinCorrForFisher (1),
    fUseExclusiveVars (kTRUE),
+   fUseHistogramSplits (kFALSE),
    fSepType        (sepType),
    fRegType        (NULL),
    fMinSize        (0),
@@ -204,6 +206,7 @@ TMVA::DecisionTree::DecisionTree( const DecisionTree &d ):
    fUseFisherCuts  (d.fUseFisherCuts),
    fMinLinCorrForFisher (d.fMinLinCorrForFisher),
    fUseExclusiveVars (d.fUseExclusiveVars),
+   fUseHistogramSplits (d.fUseHistogramSplits),
    fSepType    (d.fSepType),
    fRegType    (d.fRegType),
    fMinSize    (d.fMinSize),
@@ -515,7 +518,10 @@ UInt_t TMVA::DecisionTree::BuildTree( const std::vector<const TMVA::Event*> & ev
 
       // Train the node and figure out the separation gain and split points
       Double_t separationGain;
-      if (fNCuts > 0){
+      if (fNCuts > 0 && fUseHistogramSplits){
+         separationGain = this->TrainNodeHist(eventSample, node);
+      }
+      else if (fNCuts > 0){
          separationGain = this->TrainNodeFast(eventSample, node);
       }
       else {
@@ -594,6 +600,8 @@ UInt_t TMVA::DecisionTree::BuildTree( const std::vector<const TMVA::Event*> & ev
          node->SetLeft(leftNode);
          node->SetRight(rightNode);
 
+         if (fUseHistogramSplits) SplitNodeHistogram(node, leftSample, leftNode, rightSample, rightNode);
+
          this->BuildTree(rightSample, rightNode);
          this->BuildTree(leftSample,  leftNode );
 
@@ -625,6 +633,9 @@ UInt_t TMVA::DecisionTree::BuildTree( const std::vector<const TMVA::Event*> & ev
    }
 
    //   if (IsRootNode) this->CleanTree();
+   // drop the histograms of a node that was not split
+   if (fUseHistogramSplits) fNodeHistograms.erase(node);
+
    return fNNodes;
 }
 
@@ -759,7 +770,9 @@ UInt_t TMVA::DecisionTree::BuildTree( const std::vector<const TMVA::Event*> & ev
    if ((eventSample.size() >= 2*fMinSize  && s+b >= 2*fMinSize) && node->GetDepth() < fMaxDepth
        && ( ( s!=0 && b !=0 && !DoRegression()) || ( (s+b)!=0 && DoRegression()) ) ) {
       Double_t separationGain;
-      if (fNCuts > 0){
+      if (fNCuts > 0 && fUseHistogramSplits){
+         separationGain = this->TrainNodeHist(eventSample, node);
+      } else if (fNCuts > 0){
          separationGain = this->TrainNodeFast(eventSample, node);
       } else {
          separationGain = this->TrainNodeFull(eventSample, node);
@@ -837,6 +850,8 @@ UInt_t TMVA::DecisionTree::BuildTree( const std::vector<const TMVA::Event*> & ev
          node->SetLeft(leftNode);
          node->SetRight(rightNode);
 
+         if (fUseHistogramSplits) SplitNodeHistogram(node, leftSample, leftNode, rightSample, rightNode);
+
          this->BuildTree(rightSample, rightNode);
          this->BuildTree(leftSample,  leftNode );
 
@@ -868,6 +883,9 @@ UInt_t TMVA::DecisionTree::BuildTree( const std::vector<const TMVA::Event*> & ev
    }
 
    //   if (IsRootNode) this->CleanTree();
+   // drop the histograms of a node that was not split
+   if (fUseHistogramSplits) fNodeHistograms.erase(node);
+
    return fNNodes;
 }
 
@@ -2335,6 +2353,201 @@ Double_t TMVA::DecisionTree::TrainNodeFast( const EventConstList & eventSample,
 }
 #endif
 
+namespace {
+/// The quantities accumulated in the node histograms of TrainNodeHist()
+enum EHistQuantity { kHistSigW = 0, kHistBkgW, kHistSigN, kHistBkgN, kHistTarget, kHistTarget2, kNHistQuantities };
+} // anonymous namespace
+
+////////////////////////////////////////////////////////////////////////////////
+/// fill the histograms of a node: for each variable and each of the fNCuts+1 bins of the fixed binning, the
+/// weighted and unweighted numbers of signal and background events and, for regression, the sums of the target
+/// and of its square. The events are split in partitions filled in parallel, each into its own histograms.
+
+void TMVA::DecisionTree::FillNodeHistogram( const EventConstList & eventSample, std::vector<Double_t> & hist ) const
+{
+   const UInt_t nBins = fNCuts+1;
+   const std::size_t histSize = kNHistQuantities*fNvars*nBins;
+
+   // #### adding up the partial histograms costs about as much as filling them with histSize events
+   auto &executor = TMVA::Config::Instance().GetThreadExecutor();
+   UInt_t nPartitions = executor.GetPoolSize();
+   if (eventSample.size() < 2*histSize*nPartitions) nPartitions = 1;
+
+   auto fillPartition = [this, &eventSample, nPartitions, nBins, histSize](UInt_t partition = 0) {
+      std::vector<Double_t> histf(histSize, 0);
+      const std::size_t start = partition*eventSample.size()/nPartitions;
+      const std::size_t end = (partition+1)*eventSample.size()/nPartitions;
+      for (std::size_t iev=start; iev<end; iev++) {
+         const TMVA::Event *evt = eventSample[iev];
+         const Double_t weight = evt->GetWeight();
+         const Bool_t isSignal = evt->GetClass() == fSigClass;
+         const Double_t tgt = DoRegression() ? evt->GetTarget(0) : 0;
+         for (UInt_t ivar=0; ivar<fNvars; ivar++) {
+            const Int_t iBin = TMath::Min(Int_t(nBins-1),
+                                          TMath::Max(0, Int_t((evt->GetValueFast(ivar)-fHistXmin[ivar])*fHistInvBinWidth[ivar])));
+            const std::size_t offset = ivar*nBins + iBin;
+            histf[(isSignal ? kHistSigW : kHistBkgW)*fNvars*nBins + offset] += weight;
+            histf[(isSignal ? kHistSigN : kHistBkgN)*fNvars*nBins + offset] += 1;
+            if (DoRegression()) {
+               histf[kHistTarget*fNvars*nBins + offset] += weight*tgt;
+               histf[kHistTarget2*fNvars*nBins + offset] += weight*tgt*tgt;
+            }
+         }
+      }
+      return histf;
+   };
+   auto redfunc = [histSize](const std::vector<std::vector<Double_t>> &v) {
+      std::vector<Double_t> sum(histSize, 0);
+      for (const auto &histf : v)
+         for (std::size_t i=0; i<histSize; i++) sum[i] += histf[i];
+      return sum;
+   };
+
+   if (nPartitions == 1) hist = fillPartition(0);
+   else hist = executor.MapReduce(fillPartition, ROOT::TSeqU(nPartitions), redfunc);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Decide how to split a node like TrainNodeFast(), but on a binning of the variables that is fixed for the whole
+/// tree: the range of each variable in the root node is cut in fNCuts+1 bins of equal width. The histograms of a node
+/// are hence the sum of the histograms of its daughters, and SplitNodeHistogram() only fills the histograms of the
+/// smaller daughter node, those of the larger one are obtained by subtraction from the node histograms.
+/// Fisher cuts are not supported, integer variables are binned like the other variables.
+
+Double_t TMVA::DecisionTree::TrainNodeHist( const EventConstList & eventSample,
+                                            TMVA::DecisionTreeNode *node )
+{
+   const UInt_t nBins = fNCuts+1;
+   if (node == this->GetRoot()) {
+      fNodeHistograms.clear();
+      fHistXmin.resize(fNvars);
+      fHistInvBinWidth.resize(fNvars);
+      for (UInt_t ivar=0; ivar<fNvars; ivar++) {
+         fHistXmin[ivar] = node->GetSampleMin(ivar);
+         const Double_t range = node->GetSampleMax(ivar) - node->GetSampleMin(ivar);
+         // a variable without range has all its events in the first bin and can never be cut on
+         fHistInvBinWidth[ivar] = range > 0 ? nBins/range : 0;
+      }
+   }
+
+   std::vector<Double_t> &hist = fNodeHistograms[node];
+   if (hist.empty()) FillNodeHistogram(eventSample, hist);
+   auto histogram = [&hist, nBins, this](EHistQuantity q, UInt_t ivar) { return hist.data() + (q*fNvars + ivar)*nBins; };
+
+   // the totals of the node, every event is in one bin of the first variable
+   Double_t nTotS = 0, nTotB = 0, nTotS_unWeighted = 0, nTotB_unWeighted = 0, target = 0, target2 = 0;
+   for (UInt_t iBin=0; iBin<nBins; iBin++) {
+      nTotS += histogram(kHistSigW, 0)[iBin];
+      nTotB += histogram(kHistBkgW, 0)[iBin];
+      nTotS_unWeighted += histogram(kHistSigN, 0)[iBin];
+      nTotB_unWeighted += histogram(kHistBkgN, 0)[iBin];
+      target += histogram(kHistTarget, 0)[iBin];
+      target2 += histogram(kHistTarget2, 0)[iBin];
+   }
+
+   std::vector<Bool_t> useVariable(fNvars, kTRUE);
+   if (fRandomisedTree) { // choose for each node splitting a random subset of variables to choose from
+      std::unique_ptr<Bool_t[]> useVariableArr(new Bool_t[fNvars]);
+      std::unique_ptr<UInt_t[]> mapVariable(new UInt_t[fNvars]);
+      UInt_t tmp=fUseNvars;
+      GetRandomisedVariables(useVariableArr.get(), mapVariable.get(), tmp);
+      std::copy(useVariableArr.get(), useVariableArr.get() + fNvars, useVariable.begin());
+   }
+
+   // scan the cuts of each variable, the events below the cut are accumulated like in TrainNodeFast()
+   std::vector<Double_t> separationGain(fNvars, -1);
+   std::vector<Int_t> cutIndex(fNvars, -1);
+   auto fvarMaxSep = [&](UInt_t ivar = 0) {
+      if (!useVariable[ivar] || fHistInvBinWidth[ivar] == 0) return 0;
+      Double_t sl = 0, bl = 0, slW = 0, blW = 0, targetl = 0, target2l = 0;
+      for (UInt_t iBin=0; iBin<nBins-1; iBin++) { // the last bin contains "all events" -->skip
+         sl += histogram(kHistSigN, ivar)[iBin];
+         bl += histogram(kHistBkgN, ivar)[iBin];
+         slW += histogram(kHistSigW, ivar)[iBin];
+         blW += histogram(kHistBkgW, ivar)[iBin];
+         if (DoRegression()) {
+            targetl += histogram(kHistTarget, ivar)[iBin];
+            target2l += histogram(kHistTarget2, ivar)[iBin];
+         }
+         const Double_t sr = nTotS_unWeighted-sl;
+         const Double_t br = nTotB_unWeighted-bl;
+         const Double_t srW = nTotS-slW;
+         const Double_t brW = nTotB-blW;
+         if ( ((sl+bl)>=fMinSize && (sr+br)>=fMinSize) && ((slW+blW)>=fMinSize && (srW+brW)>=fMinSize) ) {
+            Double_t sepTmp;
+            if (DoRegression()) {
+               sepTmp = fRegType->GetSeparationGain(slW+blW, targetl, target2l, nTotS+nTotB, target, target2);
+            } else {
+               sepTmp = fSepType->GetSeparationGain(slW, blW, nTotS, nTotB);
+            }
+            if (separationGain[ivar] < sepTmp) {
+               separationGain[ivar] = sepTmp;
+               cutIndex[ivar] = iBin;
+            }
+         }
+      }
+      return 0;
+   };
+   TMVA::Config::Instance().GetThreadExecutor().Map(fvarMaxSep, ROOT::TSeqU(fNvars));
+
+   // you found the best separation cut for each variable, now compare the variables
+   Double_t separationGainTotal = -1;
+   Int_t mxVar = -1;
+   for (UInt_t ivar=0; ivar < fNvars; ivar++) {
+      if (useVariable[ivar] && separationGainTotal < separationGain[ivar]) {
+         separationGainTotal = separationGain[ivar];
+         mxVar = ivar;
+      }
+   }
+   if (mxVar < 0) return 0;
+
+   Bool_t cutType = kTRUE;
+   if (DoRegression()) {
+      const Double_t n = nTotS+nTotB;
+      node->SetSeparationIndex(fRegType->GetSeparationIndex(n,target,target2));
+      node->SetResponse(target/n);
+      if (almost_equal_double(target2/n, target/n*target/n)) node->SetRMS(0);
+      else node->SetRMS(TMath::Sqrt(target2/n - target/n*target/n));
+   }
+   else {
+      node->SetSeparationIndex(fSepType->GetSeparationIndex(nTotS,nTotB));
+      Double_t slW = 0, blW = 0;
+      for (Int_t iBin=0; iBin<=cutIndex[mxVar]; iBin++) {
+         slW += histogram(kHistSigW, mxVar)[iBin];
+         blW += histogram(kHistBkgW, mxVar)[iBin];
+      }
+      cutType = slW/nTotS > blW/nTotB;
+   }
+   node->SetSelector((UInt_t)mxVar);
+   node->SetCutValue(fHistXmin[mxVar] + (cutIndex[mxVar]+1)/fHistInvBinWidth[mxVar]);
+   node->SetCutType(cutType);
+   node->SetSeparationGain(separationGainTotal);
+   node->SetNFisherCoeff(0);
+   fVariableImportance[mxVar] += separationGainTotal*separationGainTotal * (nTotS+nTotB) * (nTotS+nTotB);
+
+   return separationGainTotal;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// derive the histograms of the daughter nodes from the ones of a node trained by TrainNodeHist(): only the
+/// histograms of the daughter with fewer events are filled, those of the other one are the difference
+
+void TMVA::DecisionTree::SplitNodeHistogram( const DecisionTreeNode *node,
+                                             const EventConstList & leftSample, const DecisionTreeNode *leftNode,
+                                             const EventConstList & rightSample, const DecisionTreeNode *rightNode )
+{
+   auto it = fNodeHistograms.find(node);
+   if (it == fNodeHistograms.end()) return;
+   std::vector<Double_t> hist = std::move(it->second);
+   fNodeHistograms.erase(it);
+
+   const Bool_t leftIsSmaller = leftSample.size() < rightSample.size();
+   std::vector<Double_t> &smallHist = fNodeHistograms[leftIsSmaller ? leftNode : rightNode];
+   FillNodeHistogram(leftIsSmaller ? leftSample : rightSample, smallHist);
+   for (std::size_t i=0; i<hist.size(); i++) hist[i] -= smallHist[i];
+   fNodeHistograms[leftIsSmaller ? rightNode : leftNode] = std::move(hist);
+}
+
 
 ////////////////////////////////////////////////////////////////////////////////
 /// calculate the fisher coefficients for the event sample and the variables used
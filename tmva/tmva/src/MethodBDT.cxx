@@ -181,6 +181,7 @@ TMVA::MethodBDT::MethodBDT( const TString& jobName,
    , fUseFisherCuts(0)        // don't use this initialisation, only here to make  Coverity happy. Is set in DeclarOptions()
    , fMinLinCorrForFisher(.8) // don't use this initialisation, only here to make  Coverity happy. Is set in DeclarOptions()
    , fUseExclusiveVars(0)     // don't use this initialisation, only here to make  Coverity happy. Is set in DeclarOptions()
+   , fUseHistogramSplits(kFALSE)
    , fUseYesNoLeaf(kFALSE)
    , fNodePurityLimit(0)
    , fNNodesMax(0)
@@ -236,6 +237,7 @@ TMVA::MethodBDT::MethodBDT( DataSetInfo& theData,
    , fUseFisherCuts(0)        // don't use this initialisation, only here to make  Coverity happy. Is set in DeclarOptions()
    , fMinLinCorrForFisher(.8) // don't use this initialisation, only here to make  Coverity happy. Is set in DeclarOptions()
    , fUseExclusiveVars(0)     // don't use this initialisation, only here to make  Coverity happy. Is set in DeclarOptions()
+   , fUseHistogramSplits(kFALSE)
    , fUseYesNoLeaf(kFALSE)
    , fNodePurityLimit(0)
    , fNNodesMax(0)
@@ -311,6 +313,7 @@ Bool_t TMVA::MethodBDT::HasAnalysisType( Types::EAnalysisType type, UInt_t numbe
 ///  - nCuts:           the number of steps in the optimisation of the cut for a node (if < 0, then
 ///                  step size is determined by the events)
 ///  - UseFisherCuts:   use multivariate splits using the Fisher criterion
+///  - UseHistogramSplits: find the cuts on a grid of nCuts fixed for the whole tree, see DecisionTree::TrainNodeHist
 ///  - UseYesNoLeaf     decide if the classification is done simply by the node type, or the S/B
 ///                  (from the training) in the leaf node
 ///  - NodePurityLimit  the minimum purity to classify a node as a signal node (used in pruning and boosting to determine
@@ -419,6 +422,7 @@ void TMVA::MethodBDT::DeclareOptions()
    DeclareOptionRef(fUseFisherCuts=kFALSE, "UseFisherCuts", "Use multivariate splits using the Fisher criterion");
    DeclareOptionRef(fMinLinCorrForFisher=.8,"MinLinCorrForFisher", "The minimum linear correlation between two variables demanded for use in Fisher criterion in node splitting");
    DeclareOptionRef(fUseExclusiveVars=kFALSE,"UseExclusiveVars","Variables already used in fisher criterion are not anymore analysed individually for node splitting");
+   DeclareOptionRef(fUseHistogramSplits=kFALSE,"UseHistogramSplits","Find the node splits on a grid of nCuts cuts fixed for the whole tree, with the histograms of the larger daughter node obtained by subtraction (faster for large samples)");
 
 
    DeclareOptionRef(fDoPreselection=kFALSE,"DoPreselection","and and apply automatic pre-selection for 100% efficient signal (bkg) cuts prior to training");
@@ -598,6 +602,15 @@ void TMVA::MethodBDT::ProcessOptions()
       //      fBoostType   = "Bagging";
    }
 
+   if (fUseHistogramSplits && fUseFisherCuts) {
+      Log() << kWARNING << "The option UseHistogramSplits is not available together with UseFisherCuts, I will ignore it!" << Endl;
+      fUseHistogramSplits = kFALSE;
+   }
+   if (fUseHistogramSplits && fNCuts <= 0) {
+      Log() << kWARNING << "The option UseHistogramSplits needs nCuts > 0, I will ignore it!" << Endl;
+      fUseHistogramSplits = kFALSE;
+   }
+
    if (fUseFisherCuts) {
       Log() << kWARNING << "When using the option UseFisherCuts, the other option nCuts<0 (i.e. using" << Endl;
       Log() << " a more elaborate node splitting algorithm) is not implemented. " << Endl;
@@ -1297,6 +1310,7 @@ void TMVA::MethodBDT::Train()
                                                  fRandomisedTrees, fUseNvars, fUsePoissonNvars, fMaxDepth,
                                                  itree*nClasses+i, fNodePurityLimit, itree*nClasses+1));
             fForest.back()->SetNVars(GetNvar());
+            fForest.back()->SetUseHistogramSplits(fUseHistogramSplits);
             if (fUseFisherCuts) {
                fForest.back()->SetUseFisherCuts();
                fForest.back()->SetMinLinCorrForFisher(fMinLinCorrForFisher);
@@ -1324,6 +1338,7 @@ void TMVA::MethodBDT::Train()
 
          fForest.push_back(dt);
          fForest.back()->SetNVars(GetNvar());
+         fForest.back()->SetUseHistogramSplits(fUseHistogramSplits);
          if (fUseFisherCuts) {
             fForest.back()->SetUseFisherCuts();
             fForest.back()->SetMinLinCorrForFisher(fMinLinCorrForFisher);
@@ -2488,6 +2503,40 @@ Double_t TMVA::MethodBDT::PrivateGetMvaValue(const TMVA::Event* ev, Double_t* er
    return ( norm > std::numeric_limits<double>::epsilon() ) ? myMVA /= norm : 0 ;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Return the MVA values of a batch of events, identical to the ones of
+/// GetMvaValue(). Every tree is evaluated on all the events before going to the
+/// next tree, so that the tree stays in the cache, and the events are
+/// transformed only once.
+
+std::vector<Double_t> TMVA::MethodBDT::GetBatchMvaValues( const std::vector<const TMVA::Event*>& events )
+{
+   // the preselection cuts are applied event by event
+   if (fDoPreselection) return MethodBase::GetBatchMvaValues(events);
+
+   std::vector<TMVA::Event> storage;
+   const std::vector<TMVA::Event*> transformed = TransformBatch(events, storage);
+
+   const Bool_t   isGrad       = (fBoostType=="Grad");
+   const Bool_t   useYesNoLeaf = isGrad ? kFALSE : fUseYesNoLeaf;
+   const UInt_t   nTrees       = fForest.size();
+   std::vector<Double_t> values(events.size(), 0);
+   Double_t norm = 0;
+   for (UInt_t itree=0; itree<nTrees; itree++) {
+      const Double_t weight = isGrad ? 1. : fBoostWeights[itree];
+      const TMVA::DecisionTree *tree = fForest[itree];
+      for (std::size_t ievt=0; ievt<transformed.size(); ievt++)
+         values[ievt] += weight * tree->CheckEvent(transformed[ievt],useYesNoLeaf);
+      norm += weight;
+   }
+
+   for (auto &value : values) {
+      if (isGrad) value = 2.0/(1.0+exp(-2.0*value))-1;
+      else        value = ( norm > std::numeric_limits<double>::epsilon() ) ? value / norm : 0;
+   }
+   return values;
+}
+
 
 ////////////////////////////////////////////////////////////////////////////////
 /// Get the multiclass MVA response for the BDT classifier.
@@ -848,6 +848,37 @@ Double_t TMVA::MethodBase::GetMvaValue( const Event* const ev, Double_t* err, Do
    return val;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// get the MVA values for a batch of (untransformed) events, e.g. from TMVA::Reader.
+/// This default evaluates the events one by one; methods with a faster batch
+/// evaluation (e.g. BDT, DL) override it.
+
+std::vector<Double_t> TMVA::MethodBase::GetBatchMvaValues( const std::vector<const Event*>& events )
+{
+   std::vector<Double_t> values(events.size());
+   for (std::size_t i = 0; i < events.size(); ++i)
+      values[i] = GetMvaValue(events[i]);
+   return values;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// apply the variable transformations of the method to a batch of events.
+/// The transformation handler returns its own buffer, hence the transformed
+/// events are copied into storage, which owns them.
+
+std::vector<TMVA::Event*> TMVA::MethodBase::TransformBatch( const std::vector<const Event*>& events,
+                                                            std::vector<Event>& storage ) const
+{
+   storage.clear();
+   storage.reserve(events.size());
+   std::vector<Event*> transformed(events.size());
+   for (std::size_t i = 0; i < events.size(); ++i) {
+      storage.emplace_back(*GetTransformationHandler().Transform(events[i]));
+      transformed[i] = &storage.back();
+   }
+   return transformed;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// uses a pre-set cut on the MVA output (SetSignalReferenceCut and SetSignalReferenceCutOrientation)
 /// for a quick determination if an event would be selected as signal or background
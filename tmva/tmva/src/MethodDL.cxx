@@ -53,6 +53,7 @@
 #endif
 #endif
 
+#include <algorithm>
 #include <chrono>
 
 REGISTER_METHOD(DL)
@@ -1825,7 +1826,8 @@ Double_t MethodDL::GetMvaValue(Double_t * /*errLower*/, Double_t * /*errUpper*/)
 /// Evaluate the DeepNet on a vector of input values stored in the TMVA Event class
 ////////////////////////////////////////////////////////////////////////////////
 template <typename Architecture_t>
-std::vector<Double_t> MethodDL::PredictDeepNet(Long64_t firstEvt, Long64_t lastEvt, size_t batchSize, Bool_t logProgress)
+std::vector<Double_t> MethodDL::PredictDeepNet(const std::vector<Event *> &events, Long64_t firstEvt, Long64_t lastEvt,
+                                               size_t batchSize, Bool_t logProgress)
 {
 
    // Check whether the model is setup
@@ -1876,7 +1878,7 @@ std::vector<Double_t> MethodDL::PredictDeepNet(Long64_t firstEvt, Long64_t lastE
    }
    //this->SetBatchDepth(n0);
    Long64_t nEvents = lastEvt - firstEvt;
-   TMVAInput_t testTuple = std::tie(GetEventCollection(Data()->GetCurrentType()), DataInfo());
+   TMVAInput_t testTuple = std::tie(events, DataInfo());
    TensorDataLoader_t testData(testTuple, nEvents, batchSize, {inputDepth, inputHeight, inputWidth}, {n0, n1, n2}, deepNet.GetOutputWidth(), 1);
 
 
@@ -1908,8 +1910,7 @@ std::vector<Double_t> MethodDL::PredictDeepNet(Long64_t firstEvt, Long64_t lastE
       if (ievt_end <=  lastEvt) {
 
          if (ievt == firstEvt) {
-            Data()->SetCurrentEvent(ievt);
-            size_t nVariables = GetEvent()->GetNVariables();
+            size_t nVariables = events[ievt]->GetNVariables();
 
             if (n1 == batchSize && n0 == 1)  {
                if (n2 != nVariables) {
@@ -1938,7 +1939,7 @@ std::vector<Double_t> MethodDL::PredictDeepNet(Long64_t firstEvt, Long64_t lastE
          }
       }
       else {
-         // case of remaining events: compute prediction by single event !
+         // case of remaining events: compute prediction by single event (from the current data set) !
          for (Long64_t i = ievt; i < lastEvt; ++i) {
             Data()->SetCurrentEvent(i);
             mvaValues[i] = GetMvaValue();
@@ -2027,25 +2028,79 @@ std::vector<Double_t> MethodDL::GetMvaValues(Long64_t firstEvt, Long64_t lastEvt
    if (firstEvt < 0) firstEvt = 0;
    nEvents = lastEvt-firstEvt;
 
-   // use same batch size as for training (from first strategy)
-   size_t defaultEvalBatchSize = (fXInput.GetSize() > 1000) ? 100 : 1000;
-   size_t batchSize = (fTrainingSettings.empty()) ? defaultEvalBatchSize :  fTrainingSettings.front().batchSize;
+   size_t batchSize = GetEvaluationBatchSize();
    if  ( size_t(nEvents) < batchSize ) batchSize = nEvents;
 
+   const std::vector<Event *> &events = GetEventCollection(Data()->GetCurrentType());
+
    // using for training same scalar type defined for the prediction
    if (this->GetArchitectureString() == "GPU") {
 #ifdef R__HAS_TMVAGPU
       Log() << kINFO << "Evaluate deep neural network on GPU using batches with size = " <<  batchSize << Endl << Endl;
 #ifdef R__HAS_CUDNN
-      return PredictDeepNet<DNN::TCudnn<ScalarImpl_t>>(firstEvt, lastEvt, batchSize, logProgress);
+      return PredictDeepNet<DNN::TCudnn<ScalarImpl_t>>(events, firstEvt, lastEvt, batchSize, logProgress);
 #else
-      return PredictDeepNet<DNN::TCuda<ScalarImpl_t>>(firstEvt, lastEvt, batchSize, logProgress);
+      return PredictDeepNet<DNN::TCuda<ScalarImpl_t>>(events, firstEvt, lastEvt, batchSize, logProgress);
 #endif
 
 #endif
    }
    Log() << kINFO << "Evaluate deep neural network on CPU using batches with size = " << batchSize << Endl << Endl;
-   return PredictDeepNet<DNN::TCpu<ScalarImpl_t> >(firstEvt, lastEvt, batchSize, logProgress);
+   return PredictDeepNet<DNN::TCpu<ScalarImpl_t> >(events, firstEvt, lastEvt, batchSize, logProgress);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Use the same batch size as for training (from first strategy)
+////////////////////////////////////////////////////////////////////////////////
+size_t MethodDL::GetEvaluationBatchSize() const
+{
+   size_t defaultEvalBatchSize = (fXInput.GetSize() > 1000) ? 100 : 1000;
+   return (fTrainingSettings.empty()) ? defaultEvalBatchSize : fTrainingSettings.front().batchSize;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Evaluate all the given events in batches of batchSize events, which must divide
+/// the number of events, on the architecture used for the training
+////////////////////////////////////////////////////////////////////////////////
+std::vector<Double_t> MethodDL::PredictDeepNet(const std::vector<Event *> &events, size_t batchSize)
+{
+   if (this->GetArchitectureString() == "GPU") {
+#ifdef R__HAS_TMVAGPU
+#ifdef R__HAS_CUDNN
+      return PredictDeepNet<DNN::TCudnn<ScalarImpl_t>>(events, 0, events.size(), batchSize, false);
+#else
+      return PredictDeepNet<DNN::TCuda<ScalarImpl_t>>(events, 0, events.size(), batchSize, false);
+#endif
+#endif
+   }
+   return PredictDeepNet<DNN::TCpu<ScalarImpl_t>>(events, 0, events.size(), batchSize, false);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Evaluate the DeepNet on a batch of events. The events are transformed once and
+/// evaluated in batches of the evaluation batch size; the remaining events are
+/// evaluated in one smaller batch. The network is rebuilt for every batch size,
+/// hence the batches should contain many events.
+////////////////////////////////////////////////////////////////////////////////
+std::vector<Double_t> MethodDL::GetBatchMvaValues(const std::vector<const Event *> &events)
+{
+   if (events.empty())
+      return {};
+
+   std::vector<Event> storage;
+   std::vector<Event *> transformed = TransformBatch(events, storage);
+
+   const size_t batchSize = std::min(GetEvaluationBatchSize(), transformed.size());
+   const size_t nFullBatches = transformed.size() - transformed.size() % batchSize;
+
+   std::vector<Event *> head(transformed.begin(), transformed.begin() + nFullBatches);
+   std::vector<Double_t> mvaValues = PredictDeepNet(head, batchSize);
+   if (nFullBatches < transformed.size()) {
+      std::vector<Event *> tail(transformed.begin() + nFullBatches, transformed.end());
+      std::vector<Double_t> tailValues = PredictDeepNet(tail, tail.size());
+      mvaValues.insert(mvaValues.end(), tailValues.begin(), tailValues.end());
+   }
+   return mvaValues;
 }
 ////////////////////////////////////////////////////////////////////////////////
 void MethodDL::AddWeightsXMLTo(void * parent) const
@@ -559,6 +559,66 @@ Double_t TMVA::Reader::EvaluateMVA( MethodBase* method, Double_t aux )
                                (fCalculateError?&fMvaEventErrorUpper:0) );
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Evaluate a batch of nEvents events for a given method. The input data are given
+/// by columns: columns[ivar][ievt] is the value of the variable ivar for the event ievt.
+/// The methods which support it (e.g. BDT, DL) evaluate the whole batch at once,
+/// which is much faster than calling EvaluateMVA for every event.
+/// As for the single event evaluation, events with a NaN variable get the value -999.
+/// The parameter aux is obligatory for the cuts method where it represents the efficiency cutoff.
+/// No per-event error is computed.
+
+std::vector<Double_t> TMVA::Reader::EvaluateMVA( const std::vector<const Float_t*>& columns, Long64_t nEvents,
+                                                 const TString& methodTag, Double_t aux )
+{
+   std::vector<Double_t> values(nEvents > 0 ? nEvents : 0, 0);
+   IMethod* imeth = FindMVA( methodTag );
+   MethodBase* meth = dynamic_cast<TMVA::MethodBase*>(imeth);
+   if (meth==0 || values.empty()) return values;
+
+   const UInt_t nVars = DataInfo().GetNVariables();
+   if (columns.size() != nVars) {
+      Log() << kFATAL << "<EvaluateMVA> got " << columns.size() << " input columns for " << nVars
+            << " variables" << Endl;
+      return values;
+   }
+
+   if (meth->GetMethodType() == TMVA::Types::kCuts) {
+      TMVA::MethodCuts* mc = dynamic_cast<TMVA::MethodCuts*>(meth);
+      if(mc)
+         mc->SetTestSignalEfficiency( aux );
+   }
+
+   // create the temporary events from the columns, skipping the ones with a NaN variable
+   std::vector<Event> events;
+   std::vector<const Event*> batch;
+   std::vector<Long64_t> batchIndex;
+   events.reserve(nEvents);
+   batch.reserve(nEvents);
+   batchIndex.reserve(nEvents);
+   std::vector<Float_t> inputVec(nVars);
+   for (Long64_t ievt=0; ievt<nEvents; ievt++) {
+      Bool_t isNaN = kFALSE;
+      for (UInt_t ivar=0; ivar<nVars; ivar++) {
+         inputVec[ivar] = columns[ivar][ievt];
+         isNaN = isNaN || TMath::IsNaN(inputVec[ivar]);
+      }
+      if (isNaN) {
+         Log() << kERROR << "a variable of the event " << ievt << " is NaN --> return MVA value -999, \n that's all I can do, please fix or remove this event." << Endl;
+         values[ievt] = -999;
+         continue;
+      }
+      events.emplace_back(inputVec, 0);
+      batch.push_back(&events.back());
+      batchIndex.push_back(ievt);
+   }
+
+   const std::vector<Double_t> batchValues = meth->GetBatchMvaValues(batch);
+   for (std::size_t i=0; i<batchIndex.size(); i++)
+      values[batchIndex[i]] = batchValues[i];
+   return values;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// evaluates MVA for given set of input variables
 
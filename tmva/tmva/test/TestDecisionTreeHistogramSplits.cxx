@@ -0,0 +1,108 @@
+// ROOT
+#include "TRandom3.h"
+
+// TMVA
+#include "TMVA/DataSetInfo.h"
+#include "TMVA/DecisionTree.h"
+#include "TMVA/DecisionTreeNode.h"
+#include "TMVA/Event.h"
+#include "TMVA/GiniIndex.h"
+
+// Stdlib
+#include <memory>
+#include <vector>
+
+// External
+#include "gtest/gtest.h"
+
+namespace {
+
+// The variables take kNValues equidistant values. The number of bins, kNCuts+1, is prime and larger than the number
+// of gaps between the values: every gap contains a bin edge, and no edge falls on a value, both for the binning of the
+// root node used by the histogram splits and for the binning of any node used otherwise. Both algorithms can
+// therefore find the same partitions of the events, only the cut values within a gap differ.
+constexpr int kNValues = 16;
+constexpr int kNCuts = 22;
+
+/// Signal for x >= 0.5 and y >= 0.3 with 20% of the labels flipped, pure background for x < 0.5
+std::vector<std::unique_ptr<TMVA::Event>> MakeEvents(int nEvents, bool weighted)
+{
+   TRandom3 rng(7);
+   std::vector<std::unique_ptr<TMVA::Event>> events;
+   for (int i = 0; i < nEvents; ++i) {
+      const Float_t x = (rng.Integer(kNValues) + 0.5) / kNValues;
+      const Float_t y = (rng.Integer(kNValues) + 0.5) / kNValues;
+      bool isSignal = x >= 0.5 && y >= 0.3;
+      if (x >= 0.5 && rng.Rndm() < 0.2)
+         isSignal = !isSignal;
+      const Double_t weight = weighted ? rng.Uniform(0.5, 2.) : 1.;
+      events.emplace_back(std::make_unique<TMVA::Event>(std::vector<Float_t>{x, y}, isSignal ? 0 : 1, weight));
+   }
+   return events;
+}
+
+void CompareNodes(const TMVA::DecisionTreeNode *node, const TMVA::DecisionTreeNode *histNode, Double_t binWidth)
+{
+   ASSERT_NE(histNode, nullptr);
+   EXPECT_FLOAT_EQ(node->GetPurity(), histNode->GetPurity());
+   EXPECT_FLOAT_EQ(node->GetResponse(), histNode->GetResponse());
+   ASSERT_EQ(node->GetLeft() == nullptr, histNode->GetLeft() == nullptr);
+   if (!node->GetLeft()) {
+      EXPECT_EQ(node->GetNodeType(), histNode->GetNodeType());
+      return;
+   }
+   EXPECT_EQ(node->GetSelector(), histNode->GetSelector());
+   EXPECT_EQ(node->GetCutType(), histNode->GetCutType());
+   EXPECT_NEAR(node->GetCutValue(), histNode->GetCutValue(), binWidth);
+   CompareNodes(node->GetLeft(), histNode->GetLeft(), binWidth);
+   CompareNodes(node->GetRight(), histNode->GetRight(), binWidth);
+}
+
+void CompareTrees(bool weighted)
+{
+   TMVA::DataSetInfo dsi("dataset");
+   dsi.AddVariable("x");
+   dsi.AddVariable("y");
+   TMVA::GiniIndex sepType;
+
+   const auto events = MakeEvents(20000, weighted);
+   TMVA::DecisionTree::EventConstList sample;
+   for (const auto &evt : events)
+      sample.emplace_back(evt.get());
+
+   TMVA::DecisionTree tree(&sepType, 2.5, kNCuts, &dsi, 0, kFALSE, 0, kFALSE, 4);
+   tree.BuildTree(sample);
+   TMVA::DecisionTree histTree(&sepType, 2.5, kNCuts, &dsi, 0, kFALSE, 0, kFALSE, 4);
+   histTree.SetUseHistogramSplits();
+   histTree.BuildTree(sample);
+
+   const TMVA::DecisionTreeNode *root = tree.GetRoot();
+   const TMVA::DecisionTreeNode *histRoot = histTree.GetRoot();
+   // the first split separates the pure background, a node of a single class that is not split further
+   ASSERT_NE(histRoot->GetLeft(), nullptr);
+   EXPECT_EQ(histRoot->GetSelector(), 0);
+   const auto pureNode = histRoot->GetLeft()->GetPurity() == 0 ? histRoot->GetLeft() : histRoot->GetRight();
+   EXPECT_EQ(pureNode->GetPurity(), 0);
+   EXPECT_EQ(pureNode->GetLeft(), nullptr);
+   // both variables have the same range in the root node
+   const Double_t binWidth = (1. - 1. / kNValues) / (kNCuts + 1);
+   CompareNodes(root, histRoot, binWidth);
+   EXPECT_EQ(tree.GetNNodes(), histTree.GetNNodes());
+
+   for (const auto evt : sample) {
+      EXPECT_FLOAT_EQ(tree.CheckEvent(evt), histTree.CheckEvent(evt));
+      EXPECT_EQ(tree.CheckEvent(evt, kTRUE), histTree.CheckEvent(evt, kTRUE));
+   }
+}
+
+} // anonymous namespace
+
+TEST(DecisionTree, HistogramSplits)
+{
+   CompareTrees(false);
+}
+
+TEST(DecisionTree, HistogramSplitsWeighted)
+{
+   CompareTrees(true);
+}
@@ -4,6 +4,7 @@
 #include "TMVA/RBDT.hxx"
 
 #include "ROOT/RVec.hxx"
+#include "TROOT.h"
 
 #include <cmath>
 
@@ -125,3 +126,36 @@ TEST(RBDT, ColumnMajorInput)
    EXPECT_FLOAT_EQ(y(0, 0), 1.0);
    EXPECT_FLOAT_EQ(y(1, 0), 1.0);
 }
+
+// Check the inference on batches spanning several blocks of events, with and
+// without multi-threading, for both backends
+template <typename Backend>
+void CheckLargeBatch(const std::string &filename)
+{
+   RBDT<Backend> bdt("myModel", filename);
+   const std::size_t rows = 20003;
+   RTensor<float> x({rows, 1});
+   for (std::size_t i = 0; i < rows; i++)
+      x(i, 0) = (i % 3 == 0) ? -1.0 : 1.0;
+   auto y = bdt.Compute(x);
+   for (std::size_t i = 0; i < rows; i++)
+      EXPECT_FLOAT_EQ(y(i, 0), (i % 3 == 0) ? 1.0 : -1.0) << "row " << i;
+}
+
+TEST(RBDT, LargeBatch)
+{
+   const auto maxDepth = 1;
+   const auto numInputs = 1;
+   const auto numTrees = 1;
+   WriteModel("myModel", "TestRBDT6.root", "identity", {0}, {0}, {0.0, 1.0, -1.0}, {maxDepth}, {numTrees}, {numInputs},
+              {1});
+
+   CheckLargeBatch<BranchlessForest<float>>("TestRBDT6.root");
+   CheckLargeBatch<BranchlessJittedForest<float>>("TestRBDT6.root");
+#ifdef R__USE_IMT
+   ROOT::EnableImplicitMT(4);
+   CheckLargeBatch<BranchlessForest<float>>("TestRBDT6.root");
+   CheckLargeBatch<BranchlessJittedForest<float>>("TestRBDT6.root");
+   ROOT::DisableImplicitMT();
+#endif
+}
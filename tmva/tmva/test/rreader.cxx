@@ -175,6 +175,24 @@ TEST(RReader, ClassificationComputeTensor)
    EXPECT_EQ(shapeY[0], shapeX[0]);
 }
 
+TEST(RReader, ClassificationComputeTensorMatchesVector)
+{
+   TrainClassificationModel();
+   ROOT::RDataFrame df("TreeS", filenameClassification);
+   auto dfRange = df.Range(100);
+   auto x = AsTensor<float>(dfRange, variablesClassification);
+
+   RReader model(modelClassification);
+   auto y = model.Compute(x);
+
+   const auto numEntries = x.GetShape()[0];
+   ASSERT_EQ(y.GetShape()[0], numEntries);
+   for (std::size_t i = 0; i < numEntries; i++) {
+      const std::vector<float> event = {x(i, 0), x(i, 1), x(i, 2), x(i, 3)};
+      EXPECT_FLOAT_EQ(y(i), model.Compute(event)[0]);
+   }
+}
+
 TEST(RReader, ClassificationComputeDataFrame)
 {
    TrainClassificationModel();
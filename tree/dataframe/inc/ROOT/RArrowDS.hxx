@@ -54,6 +54,8 @@ public:
 
 RDataFrame FromArrow(std::shared_ptr<arrow::Table> table, std::vector<std::string> const &columnNames);
 
+RDataFrame FromArrowIPC(std::string_view fileName, std::vector<std::string> const &columnNames);
+
 } // namespace RDF
 
 } // namespace ROOT
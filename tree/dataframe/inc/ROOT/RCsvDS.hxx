@@ -63,6 +63,20 @@ private:
    // work given that the pointer to the boolean in that case cannot be taken
    std::vector<std::deque<bool>> fBoolEvtValues; // one per column per slot
 
+   /// Size in bytes of the chunks of the file that are read and parsed in parallel, or -1 to read the lines with
+   /// GetEntryRanges (see fLinesChunkSize).
+   const Long64_t fBytesChunkSize;
+   /// A part of the file made of whole lines, processed as one entry range.
+   struct RByteChunk {
+      std::uint64_t fBegin;    ///< Position in the file of the first line of the chunk
+      std::uint64_t fEnd;      ///< Position in the file after the last line of the chunk
+      ULong64_t fFirstEntry;   ///< Entry number of the first non-empty line of the chunk
+      ULong64_t fNEntries = 0; ///< Number of non-empty lines
+   };
+   std::vector<RByteChunk> fByteChunks;
+   struct RSlotChunk;
+   std::vector<std::unique_ptr<RSlotChunk>> fSlotChunks; // the byte chunk being processed by each slot
+
    void FillHeaders(const std::string &);
    void FillRecord(const std::string &, Record_t &);
    void GenerateHeaders(size_t);
@@ -74,13 +88,17 @@ private:
    size_t ParseValue(const std::string &, std::vector<std::string> &, size_t);
    ColType_t GetType(std::string_view colName) const;
    void FreeRecords();
+   void ScanByteChunks();
+   void LoadByteChunk(unsigned int slot, ULong64_t entry);
+   void FillSlotValues(const std::string &line, unsigned int slot);
+   void WarnAboutEmptyCells() const;
 
 protected:
    std::string AsString() final;
 
 public:
    RCsvDS(std::string_view fileName, bool readHeaders = true, char delimiter = ',', Long64_t linesChunkSize = -1LL,
-          std::unordered_map<std::string, char> &&colTypes = {});
+          std::unordered_map<std::string, char> &&colTypes = {}, Long64_t bytesChunkSize = -1LL);
    void Finalize() final;
    ~RCsvDS();
    const std::vector<std::string> &GetColumnNames() const final;
@@ -89,6 +107,8 @@ public:
    bool HasColumn(std::string_view colName) const final;
    bool SetEntry(unsigned int slot, ULong64_t entry) final;
    void SetNSlots(unsigned int nSlots) final;
+   void InitSlot(unsigned int slot, ULong64_t firstEntry) final;
+   void FinalizeSlot(unsigned int slot) final;
    std::string GetLabel() final;
 };
 
@@ -102,8 +122,11 @@ public:
 /// \param[in] colTypes Allow user to specify custom column types, accepts an unordered map with keys being
 ///                      column type, values being type alias ('O' for boolean, 'D' for double, 'L' for
 ///                      Long64_t, 'T' for std::string)
+/// \param[in] bytesChunkSize size in bytes of the chunks of the file that are read and parsed in parallel during the
+///                           event loop, use -1 to read the lines before the event loop (see linesChunkSize)
 RDataFrame FromCSV(std::string_view fileName, bool readHeaders = true, char delimiter = ',',
-                   Long64_t linesChunkSize = -1LL, std::unordered_map<std::string, char> &&colTypes = {});
+                   Long64_t linesChunkSize = -1LL, std::unordered_map<std::string, char> &&colTypes = {},
+                   Long64_t bytesChunkSize = -1LL);
 
 } // ns RDF
 
@@ -24,6 +24,7 @@
 #include "ROOT/RVec.hxx"
 #include "ROOT/TBufferMerger.hxx" // for SnapshotHelper
 #include "ROOT/RDF/RCutFlowReport.hxx"
+#include "ROOT/RDF/RMaskedEntryRange.hxx"
 #include "ROOT/RDF/RSampleInfo.hxx"
 #include "ROOT/RDF/Utils.hxx"
 #include "ROOT/RSnapshotOptions.hxx"
@@ -46,6 +47,15 @@
 #include "TStatistic.h"
 #include "ROOT/RDF/RActionImpl.hxx"
 #include "ROOT/RDF/RMergeableValue.hxx"
+#include "RConfigure.h" // R__HAS_ROOT7
+
+#ifdef R__HAS_ROOT7
+#include "ROOT/REntry.hxx"
+#include "ROOT/RField.hxx"
+#include "ROOT/RNTupleModel.hxx"
+#include "ROOT/RNTupleOptions.hxx"
+#include "ROOT/RNTupleParallelWriter.hxx"
+#endif
 
 #include <algorithm>
 #include <functional>
@@ -313,6 +323,33 @@ public:
       thisWBuf.insert(thisWBuf.end(), ws.begin(), ws.end());
    }
 
+   template <typename T, std::enable_if_t<std::is_arithmetic<T>::value, int> = 0>
+   void ExecBulk(unsigned int slot, const RMaskedEntryRange &mask, const T *vs)
+   {
+      auto &thisBuf = fBuffers[slot];
+      for (std::size_t i = 0; i < mask.Size(); ++i) {
+         if (mask[i]) {
+            UpdateMinMax(slot, vs[i]);
+            thisBuf.emplace_back(vs[i]);
+         }
+      }
+   }
+
+   template <typename T, typename W,
+             std::enable_if_t<std::is_arithmetic<T>::value && std::is_arithmetic<W>::value, int> = 0>
+   void ExecBulk(unsigned int slot, const RMaskedEntryRange &mask, const T *vs, const W *ws)
+   {
+      auto &thisBuf = fBuffers[slot];
+      auto &thisWBuf = fWBuffers[slot];
+      for (std::size_t i = 0; i < mask.Size(); ++i) {
+         if (mask[i]) {
+            UpdateMinMax(slot, vs[i]);
+            thisBuf.emplace_back(vs[i]);
+            thisWBuf.emplace_back(ws[i]);
+         }
+      }
+   }
+
    Hist_t &PartialUpdate(unsigned int);
 
    void Initialize() { /* noop */}
@@ -344,6 +381,9 @@ public:
 template <typename HIST = Hist_t>
 class R__CLING_PTRCHECK(off) FillHelper : public RActionImpl<FillHelper<HIST>> {
    std::vector<HIST *> fObjects;
+   /// Per-slot buffers of the values (and weights) of a block that pass the mask, only used in bulk mode
+   std::vector<std::vector<double>> fBulkValues;
+   std::vector<std::vector<double>> fBulkWeights;
 
    template <typename H = HIST, typename = decltype(std::declval<H>().Reset())>
    void ResetIfPossible(H *h)
@@ -457,7 +497,8 @@ public:
    FillHelper(FillHelper &&) = default;
    FillHelper(const FillHelper &) = delete;
 
-   FillHelper(const std::shared_ptr<HIST> &h, const unsigned int nSlots) : fObjects(nSlots, nullptr)
+   FillHelper(const std::shared_ptr<HIST> &h, const unsigned int nSlots)
+      : fObjects(nSlots, nullptr), fBulkValues(nSlots), fBulkWeights(nSlots)
    {
       fObjects[0] = h.get();
       // Initialize all other slots
@@ -503,6 +544,39 @@ public:
       ExecLoop<colidx>(slot, xrefend, MakeBegin(xs)...);
    }
 
+   // bulk kernels for one-dimensional histograms: compact the values that pass the mask and fill them at once
+   template <typename X, typename H = HIST,
+             std::enable_if_t<std::is_same<H, ::TH1D>::value && std::is_arithmetic<X>::value, int> = 0>
+   void ExecBulk(unsigned int slot, const RMaskedEntryRange &mask, const X *xs)
+   {
+      auto &values = fBulkValues[slot];
+      values.clear();
+      for (std::size_t i = 0; i < mask.Size(); ++i) {
+         if (mask[i])
+            values.emplace_back(xs[i]);
+      }
+      fObjects[slot]->FillN(values.size(), values.data(), nullptr);
+   }
+
+   template <typename X, typename W, typename H = HIST,
+             std::enable_if_t<std::is_same<H, ::TH1D>::value && std::is_arithmetic<X>::value &&
+                                 std::is_arithmetic<W>::value,
+                              int> = 0>
+   void ExecBulk(unsigned int slot, const RMaskedEntryRange &mask, const X *xs, const W *ws)
+   {
+      auto &values = fBulkValues[slot];
+      auto &weights = fBulkWeights[slot];
+      values.clear();
+      weights.clear();
+      for (std::size_t i = 0; i < mask.Size(); ++i) {
+         if (mask[i]) {
+            values.emplace_back(xs[i]);
+            weights.emplace_back(ws[i]);
+         }
+      }
+      fObjects[slot]->FillN(values.size(), values.data(), weights.data());
+   }
+
    template <typename T = HIST>
    void Exec(...)
    {
@@ -1152,6 +1226,25 @@ public:
       }
    }
 
+   template <typename T, typename R = ResultType,
+             std::enable_if_t<std::is_arithmetic<T>::value && std::is_arithmetic<R>::value, int> = 0>
+   void ExecBulk(unsigned int slot, const RMaskedEntryRange &mask, const T *xs)
+   {
+      // Kahan Sum over the block, with the running sum and compensation kept in local variables
+      ResultType sum = fSums[slot];
+      ResultType compensation = fCompensations[slot];
+      for (std::size_t i = 0; i < mask.Size(); ++i) {
+         if (mask[i]) {
+            const ResultType y = static_cast<ResultType>(xs[i]) - compensation;
+            const ResultType t = sum + y;
+            compensation = (t - sum) - y;
+            sum = t;
+         }
+      }
+      fSums[slot] = sum;
+      fCompensations[slot] = compensation;
+   }
+
    void Initialize() { /* noop */}
 
    void Finalize()
@@ -1548,6 +1641,9 @@ public:
          Warning("Snapshot", "A lazy Snapshot action was booked but never triggered.");
    }
 
+   // the output branches point to the addresses of the input values, which are not stable in bulk mode
+   bool SupportsBulk() const final { return false; }
+
    void InitTask(TTreeReader *r, unsigned int /* slot */)
    {
       if (r)
@@ -1703,6 +1799,9 @@ public:
          Warning("Snapshot", "A lazy Snapshot action was booked but never triggered.");
    }
 
+   // the output branches point to the addresses of the input values, which are not stable in bulk mode
+   bool SupportsBulk() const final { return false; }
+
    void InitTask(TTreeReader *r, unsigned int slot)
    {
       ::TDirectory::TContext c; // do not let tasks change the thread-local gDirectory
@@ -1843,6 +1942,142 @@ public:
    }
 };
 
+#ifdef R__HAS_ROOT7
+/// Helper object for a Snapshot action that writes an RNTuple, both in single-thread and multi-thread runs.
+///
+/// All slots fill the same RNTuple through an RNTupleParallelWriter, each slot with its own fill context. The fill
+/// contexts commit their open cluster at the end of every task, so that each cluster holds entries of a single task.
+/// No intermediate in-memory files and no merging are needed, differently from SnapshotHelperMT.
+template <typename... ColTypes>
+class R__CLING_PTRCHECK(off) SnapshotRNTupleHelper : public RActionImpl<SnapshotRNTupleHelper<ColTypes...>> {
+   unsigned int fNSlots;
+   std::string fFileName;
+   std::string fNTupleName;
+   RSnapshotOptions fOptions;
+   ColumnNames_t fInputFieldNames; // This contains the resolved aliases
+   ColumnNames_t fOutputFieldNames;
+   std::function<void()> fOnOutputWritten; // Called once the RNTuple has been written, possibly empty
+   std::unique_ptr<ROOT::Experimental::RNTupleParallelWriter> fWriter;
+   std::vector<std::shared_ptr<ROOT::Experimental::RNTupleFillContext>> fFillContexts; // One per slot
+   // Entries of the fill contexts, per slot. They do not own their values: they point to the input values directly.
+   std::vector<std::unique_ptr<ROOT::Experimental::REntry>> fEntries;
+   // Addresses of the input values the entries point to, per slot. Values are only re-bound when their address changes
+   std::vector<std::vector<void *>> fBoundAddresses;
+   bool fIsInitialized = false;
+
+public:
+   using ColumnTypes_t = TypeList<ColTypes...>;
+   SnapshotRNTupleHelper(unsigned int nSlots, std::string_view filename, std::string_view dirname,
+                         std::string_view ntuplename, const ColumnNames_t &vbnames, const ColumnNames_t &bnames,
+                         const RSnapshotOptions &options, std::function<void()> onOutputWritten)
+      : fNSlots(nSlots), fFileName(filename), fNTupleName(ntuplename), fOptions(options), fInputFieldNames(vbnames),
+        fOutputFieldNames(ReplaceDotWithUnderscore(bnames)), fOnOutputWritten(std::move(onOutputWritten)),
+        fFillContexts(fNSlots), fEntries(fNSlots), fBoundAddresses(fNSlots, std::vector<void *>(vbnames.size()))
+   {
+      if (!dirname.empty())
+         throw std::invalid_argument("Snapshot: RNTuple output cannot be written into a sub-directory (\"" +
+                                     std::string(dirname) + "\" was requested)");
+      TString fileMode = fOptions.fMode;
+      fileMode.ToLower();
+      if (fileMode != "recreate")
+         throw std::invalid_argument("Snapshot: RNTuple output only supports the RECREATE file mode");
+   }
+   SnapshotRNTupleHelper(const SnapshotRNTupleHelper &) = delete;
+   SnapshotRNTupleHelper(SnapshotRNTupleHelper &&) = default;
+   ~SnapshotRNTupleHelper()
+   {
+      if (!fNTupleName.empty() /*not moved from*/ && !fIsInitialized /* did not run */ && fOptions.fLazy)
+         Warning("Snapshot", "A lazy Snapshot action was booked but never triggered.");
+   }
+
+   // in bulk mode the input values live in buffers, so they would have to be re-bound at every entry
+   bool SupportsBulk() const final { return false; }
+
+   void InitTask(TTreeReader *, unsigned int slot)
+   {
+      if (!fFillContexts[slot]) {
+         fFillContexts[slot] = fWriter->CreateFillContext();
+         fEntries[slot] = fFillContexts[slot]->GetModel()->CreateBareEntry();
+      }
+      // the input values of a new task can live at different addresses
+      std::fill(fBoundAddresses[slot].begin(), fBoundAddresses[slot].end(), nullptr);
+   }
+
+   void FinalizeTask(unsigned int slot)
+   {
+      if (fFillContexts[slot])
+         fFillContexts[slot]->CommitCluster();
+   }
+
+   void Exec(unsigned int slot, ColTypes &...values)
+   {
+      BindValues(slot, values..., std::index_sequence_for<ColTypes...>{});
+      fFillContexts[slot]->Fill(*fEntries[slot]);
+   }
+
+   template <std::size_t... S>
+   void BindValues(unsigned int slot, ColTypes &...values, std::index_sequence<S...> /*dummy*/)
+   {
+      auto &entry = *fEntries[slot];
+      auto &addresses = fBoundAddresses[slot];
+      int expander[] = {(addresses[S] != static_cast<void *>(&values)
+                            ? entry.CaptureValueUnsafe(fOutputFieldNames[S], &values),
+                         addresses[S] = &values, 0 : 0, 0)...,
+                        0};
+      (void)expander; // avoid unused variable warnings for older compilers such as gcc 4.9
+   }
+
+   template <std::size_t... S>
+   void AddFields(ROOT::Experimental::RNTupleModel &model, std::index_sequence<S...> /*dummy*/)
+   {
+      int expander[] = {
+         (model.AddField(std::make_unique<ROOT::Experimental::RField<ColTypes>>(fOutputFieldNames[S])), 0)..., 0};
+      (void)expander; // avoid unused variable warnings for older compilers such as gcc 4.9
+   }
+
+   void Initialize()
+   {
+      auto model = ROOT::Experimental::RNTupleModel::CreateBare();
+      AddFields(*model, std::index_sequence_for<ColTypes...>{});
+      ROOT::Experimental::RNTupleWriteOptions writeOptions;
+      writeOptions.SetCompression(
+         ROOT::CompressionSettings(fOptions.fCompressionAlgorithm, fOptions.fCompressionLevel));
+      fWriter = ROOT::Experimental::RNTupleParallelWriter::Recreate(std::move(model), fNTupleName, fFileName,
+                                                                    writeOptions);
+      fIsInitialized = true;
+   }
+
+   void Finalize()
+   {
+      assert(fWriter != nullptr);
+      // the fill contexts commit their last cluster when they are destructed, and they must go before the writer,
+      // which writes the footer of the RNTuple
+      fEntries.clear();
+      fFillContexts.clear();
+      fWriter.reset();
+      if (fOnOutputWritten)
+         fOnOutputWritten();
+   }
+
+   std::string GetActionName() { return "Snapshot"; }
+
+   /**
+    * @brief Create a new SnapshotRNTupleHelper with a different output file name
+    *
+    * @param newName A type-erased string with the output file name
+    * @return SnapshotRNTupleHelper
+    *
+    * See SnapshotHelper::MakeNew. The RDataFrame returned by the original Snapshot is not updated by the clone.
+    */
+   SnapshotRNTupleHelper MakeNew(void *newName)
+   {
+      const std::string finalName = *reinterpret_cast<const std::string *>(newName);
+      return SnapshotRNTupleHelper{fNSlots,          finalName,         /*dirname=*/"", fNTupleName,
+                                   fInputFieldNames, fOutputFieldNames, fOptions,       /*onOutputWritten=*/{}};
+   }
+};
+#endif // R__HAS_ROOT7
+
 template <typename Acc, typename Merge, typename R, typename T, typename U,
           bool MustCopyAssign = std::is_same<R, U>::value>
 class R__CLING_PTRCHECK(off) AggregateHelper
@@ -17,6 +17,9 @@
 #include "RDefineReader.hxx"
 #include "RDSColumnReader.hxx"
 #include "RLoopManager.hxx"
+#include "RMaskedEntryRange.hxx"
+#include "RProfiler.hxx"
+#include "RStagedColumnReader.hxx"
 #include "RTreeColumnReader.hxx"
 #include "RVariationBase.hxx"
 #include "RVariationReader.hxx"
@@ -30,6 +33,7 @@
 #include <map>
 #include <memory>
 #include <string>
+#include <type_traits>
 #include <typeinfo> // for typeid
 #include <vector>
 
@@ -40,6 +44,46 @@ namespace RDF {
 using namespace ROOT::TypeTraits;
 namespace RDFDetail = ROOT::Detail::RDF;
 
+/// In bulk mode, wrap the dataset column reader in a reader that stages its values for the entries of a block.
+template <typename T>
+RDFDetail::RColumnReaderBase *GetStagedColumnReader(unsigned int slot, RColumnReaderBase *datasetColReader,
+                                                    RLoopManager &lm, const std::string &colName,
+                                                    std::true_type /*isBulkType*/)
+{
+   if (lm.GetBulkSize() == 0)
+      return datasetColReader;
+
+   auto *stagedColReader = lm.GetStagedColumnReader(slot, colName, typeid(T));
+   if (stagedColReader != nullptr)
+      return stagedColReader;
+
+   auto newReader = std::make_unique<RStagedColumnReader<T>>(*datasetColReader, lm.GetBulkSize());
+   return lm.AddStagedColumnReader(slot, colName, std::move(newReader), typeid(T));
+}
+
+// Types that cannot be staged never reach the bulk code paths: RLoopManager falls back to entry-by-entry processing
+template <typename T>
+RDFDetail::RColumnReaderBase *GetStagedColumnReader(unsigned int, RColumnReaderBase *datasetColReader, RLoopManager &,
+                                                    const std::string &, std::false_type /*isBulkType*/)
+{
+   return datasetColReader;
+}
+
+/// When profiling, wrap the dataset column reader in a reader that times the reads of the column values.
+template <typename T>
+RDFDetail::RColumnReaderBase *
+GetProfiledColumnReader(unsigned int slot, RColumnReaderBase *datasetColReader, RProfiler &profiler,
+                        const std::string &colName)
+{
+   const auto key = colName + ':' + typeid(T).name();
+   if (auto *profiledColReader = profiler.GetColumnReader(slot, key))
+      return profiledColReader;
+
+   auto newReader = std::make_unique<RProfiledColumnReader<T>>(*datasetColReader, profiler, slot,
+                                                               profiler.RegisterColumn(colName));
+   return profiler.AddColumnReader(slot, key, std::move(newReader));
+}
+
 template <typename T>
 RDFDetail::RColumnReaderBase *GetColumnReader(unsigned int slot, RColumnReaderBase *defineOrVariationReader,
                                               RLoopManager &lm, TTreeReader *r, const std::string &colName)
@@ -50,14 +94,18 @@ RDFDetail::RColumnReaderBase *GetColumnReader(unsigned int slot, RColumnReaderBa
    // Check if we already inserted a reader for this column in the dataset column readers (RDataSource or Tree/TChain
    // readers)
    auto *datasetColReader = lm.GetDatasetColumnReader(slot, colName, typeid(T));
-   if (datasetColReader != nullptr)
-      return datasetColReader;
+   if (datasetColReader == nullptr) {
+      assert(r != nullptr && "We could not find a reader for this column, this should never happen at this point.");
+
+      // Make a RTreeColumnReader for this column and insert it in RLoopManager's map
+      auto treeColReader = std::make_unique<RTreeColumnReader<T>>(*r, colName);
+      datasetColReader = lm.AddTreeColumnReader(slot, colName, std::move(treeColReader), typeid(T));
+   }
 
-   assert(r != nullptr && "We could not find a reader for this column, this should never happen at this point.");
+   if (auto *profiler = lm.GetProfiler())
+      return GetProfiledColumnReader<T>(slot, datasetColReader, *profiler, colName);
 
-   // Make a RTreeColumnReader for this column and insert it in RLoopManager's map
-   auto treeColReader = std::make_unique<RTreeColumnReader<T>>(*r, colName);
-   return lm.AddTreeColumnReader(slot, colName, std::move(treeColReader), typeid(T));
+   return GetStagedColumnReader<T>(slot, datasetColReader, lm, colName, IsBulkType<T>{});
 }
 
 /// This type aggregates some of the arguments passed to GetColumnReaders.
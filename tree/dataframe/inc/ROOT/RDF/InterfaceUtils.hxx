@@ -27,6 +27,7 @@
 #include <ROOT/RStringView.hxx>
 #include <ROOT/RDF/RVariation.hxx>
 #include <ROOT/TypeTraits.hxx>
+#include <RConfigure.h> // R__HAS_ROOT7
 #include <TError.h> // gErrorIgnoreLevel
 #include <TH1.h>
 #include <TROOT.h> // IsImplicitMTEnabled
@@ -44,6 +45,7 @@
 class TObjArray;
 class TTree;
 namespace ROOT {
+class RDataFrame;
 namespace Detail {
 namespace RDF {
 class RNodeBase;
@@ -250,8 +252,20 @@ struct SnapshotHelperArgs {
    std::string fTreeName;
    std::vector<std::string> fOutputColNames;
    ROOT::RDF::RSnapshotOptions fOptions;
+   /// Called by RNTuple Snapshots once the output has been written, to point the returned RDataFrame to it
+   std::function<void()> fOnOutputWritten;
 };
 
+#ifdef R__HAS_ROOT7
+/// Make `df` read the RNTuple `ntupleName` in file `fileName`.
+void ResetToRNTuple(ROOT::RDataFrame &df, std::string_view ntupleName, std::string_view fileName);
+
+/// Return a loop manager that reads the on-disk Cache of `columns`, i.e. the RNTuple `ntupleName` in file `fileName`,
+/// or nullptr if the file does not exist or the RNTuple lacks some of the columns and the Cache must be written anew.
+std::shared_ptr<RLoopManager>
+OpenDiskCache(std::string_view ntupleName, std::string_view fileName, const ColumnNames_t &columns);
+#endif
+
 // Snapshot action
 template <typename... ColTypes, typename PrevNodeType>
 std::unique_ptr<RActionBase>
@@ -275,6 +289,17 @@ BuildAction(const ColumnNames_t &colNames, const std::shared_ptr<SnapshotHelperA
    std::vector<bool> isDefine = makeIsDefine();
 
    std::unique_ptr<RActionBase> actionPtr;
+#ifdef R__HAS_ROOT7
+   if (options.fOutputFormat == ROOT::RDF::ESnapshotOutputFormat::kRNTuple) {
+      // the same helper serves single-thread and multi-thread runs
+      using Helper_t = SnapshotRNTupleHelper<ColTypes...>;
+      using Action_t = RAction<Helper_t, PrevNodeType>;
+      actionPtr.reset(new Action_t(Helper_t(nSlots, filename, dirname, treename, colNames, outputColNames, options,
+                                            snapHelperArgs->fOnOutputWritten),
+                                   colNames, prevNode, colRegister));
+      return actionPtr;
+   }
+#endif
    if (!ROOT::IsImplicitMTEnabled()) {
       // single-thread snapshot
       using Helper_t = SnapshotHelper<ColTypes...>;
@@ -17,12 +17,15 @@
 #include "ROOT/RDF/RColumnReaderBase.hxx"
 #include "ROOT/RDF/Utils.hxx" // ColumnNames_t, IsInternalColumn
 #include "ROOT/RDF/RLoopManager.hxx"
+#include "ROOT/RDF/RMaskedEntryRange.hxx"
 #include "ROOT/RDF/RVariedAction.hxx"
 
 #include <array>
 #include <cstddef> // std::size_t
 #include <memory>
 #include <string>
+#include <tuple>
+#include <type_traits>
 #include <vector>
 
 namespace ROOT {
@@ -52,6 +55,7 @@ std::shared_ptr<GraphNode> AddDefinesToGraph(std::shared_ptr<GraphNode> node, co
 template <typename Helper, typename PrevNode, typename ColumnTypes_t = typename Helper::ColumnTypes_t>
 class R__CLING_PTRCHECK(off) RAction : public RActionBase {
    using TypeInd_t = std::make_index_sequence<ColumnTypes_t::list_size>;
+   using SupportsBulk_t = RDFInternal::AreBulkTypes<ColumnTypes_t>;
 
    Helper fHelper;
    const std::shared_ptr<PrevNode> fPrevNodePtr;
@@ -107,11 +111,54 @@ public:
 
    void Run(unsigned int slot, Long64_t entry) final
    {
+      RDFInternal::RProfileScope profileScope(fLoopManager->GetProfiler(), slot, this);
       // check if entry passes all filters
       if (fPrevNode.CheckFilters(slot, entry))
          CallExec(slot, entry, ColumnTypes_t{}, TypeInd_t{});
    }
 
+   // the helper provides a bulk kernel: hand the values of the whole block to it
+   // (H is a template parameter so that the expression in the return type is subject to SFINAE)
+   template <typename... ColTypes, std::size_t... S, typename H = Helper>
+   auto CallExecBulk(unsigned int slot, const RMaskedEntryRange &mask, TypeList<ColTypes...>,
+                     std::index_sequence<S...>, int /*overloadresolver*/)
+      -> decltype(std::declval<H &>().ExecBulk(slot, mask, std::declval<const ColTypes *>()...), void())
+   {
+      fHelper.ExecBulk(slot, mask, fValues[slot][S]->template GetBulk<ColTypes>(mask)...);
+   }
+
+   // no bulk kernel: call Exec for each entry of the block that passes the mask
+   template <typename... ColTypes, std::size_t... S>
+   void CallExecBulk(unsigned int slot, const RMaskedEntryRange &mask, TypeList<ColTypes...>,
+                     std::index_sequence<S...>, long /*overloadresolver*/)
+   {
+      auto values = std::make_tuple(fValues[slot][S]->template GetBulk<ColTypes>(mask)...);
+      for (std::size_t i = 0; i < mask.Size(); ++i) {
+         if (mask[i])
+            fHelper.Exec(slot, std::get<S>(values)[i]...);
+      }
+      (void)values; // avoid unused variable warnings in case of no input columns
+   }
+
+   void RunBulkHelper(unsigned int slot, const RMaskedEntryRange &mask, std::true_type /*supportsBulk*/)
+   {
+      const auto &passed = fPrevNode.CheckFiltersBulk(slot, mask);
+      if (passed.Count() > 0)
+         CallExecBulk(slot, passed, ColumnTypes_t{}, TypeInd_t{}, 0);
+   }
+
+   void RunBulkHelper(unsigned int, const RMaskedEntryRange &, std::false_type /*supportsBulk*/)
+   {
+      R__ASSERT(false && "Bulk processing was requested for an action that does not support it.");
+   }
+
+   void RunBulk(unsigned int slot, const RMaskedEntryRange &mask) final
+   {
+      RunBulkHelper(slot, mask, SupportsBulk_t{});
+   }
+
+   bool SupportsBulk() const final { return SupportsBulk_t::value && fHelper.SupportsBulk(); }
+
    void TriggerChildrenCount() final { fPrevNode.IncrChildrenCount(); }
 
    /// Clean-up operations to be performed at the end of a task.
@@ -152,6 +199,8 @@ public:
    /// user-defined callback registered via RResultPtr::RegisterCallback
    void *PartialUpdate(unsigned int slot) final { return fHelper.CallPartialUpdate(slot); }
 
+   std::string GetActionName() final { return fHelper.GetActionName(); }
+
    std::unique_ptr<RActionBase> MakeVariedAction(std::vector<void *> &&results) final
    {
       const auto nVariations = GetVariations().size();
@@ -34,6 +34,7 @@ namespace RDF {
 namespace GraphDrawing {
 class GraphNode;
 }
+class RMaskedEntryRange;
 
 using namespace ROOT::Detail::RDF;
 
@@ -64,6 +65,10 @@ public:
    RLoopManager *GetLoopManager() { return fLoopManager; }
    unsigned int GetNSlots() const { return fNSlots; }
    virtual void Run(unsigned int slot, Long64_t entry) = 0;
+   /// Run the action on the entries of the block that pass all upstream filters. Only called if SupportsBulk().
+   virtual void RunBulk(unsigned int slot, const RMaskedEntryRange &mask);
+   /// Whether this action can be run in bulk mode, see RLoopManager::SetBulkSize().
+   virtual bool SupportsBulk() const { return false; }
    virtual void Initialize() = 0;
    virtual void InitSlot(TTreeReader *r, unsigned int slot) = 0;
    virtual void TriggerChildrenCount() = 0;
@@ -77,6 +82,9 @@ public:
    virtual bool HasRun() const { return fHasRun; }
    virtual void SetHasRun() { fHasRun = true; }
 
+   /// Name of the action, as it appears in the computation graph drawn by SaveGraph and in profiles.
+   virtual std::string GetActionName() { return "Action"; }
+
    virtual std::shared_ptr<ROOT::Internal::RDF::GraphDrawing::GraphNode>
    GetGraph(std::unordered_map<void *, std::shared_ptr<ROOT::Internal::RDF::GraphDrawing::GraphNode>> &visitedMap) = 0;
 
@@ -68,6 +68,14 @@ public:
       throw std::logic_error("`GetMergeableValue` is not implemented for this type of action.");
    }
 
+   /// Override this method to return false if the helper cannot be run in bulk mode (see
+   /// ROOT::RDF::Experimental::EnableBulkProcessing()), e.g. because it keeps the addresses of the input values:
+   /// in bulk mode, the values passed to Exec are stored in per-block buffers, at a different address for every entry.
+   /// Helpers can provide a bulk kernel with signature
+   /// `ExecBulk(unsigned int slot, const ROOT::Internal::RDF::RMaskedEntryRange &mask, const ColTypes *...values)`,
+   /// otherwise Exec is called for every entry that passes the mask.
+   virtual bool SupportsBulk() const { return true; }
+
    /// Override this method to register a callback that is executed before the processing a new data sample starts.
    /// The callback will be invoked in the same conditions as with DefinePerSample().
    virtual ROOT::RDF::SampleCallback_t GetSampleCallback() { return {}; }
@@ -0,0 +1,89 @@
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_RDF_RCODERECORDER
+#define ROOT_RDF_RCODERECORDER
+
+#include <memory>
+#include <string>
+#include <typeinfo>
+#include <vector>
+
+namespace ROOT {
+namespace Detail {
+namespace RDF {
+class RLoopManager;
+class RNodeBase;
+} // namespace RDF
+} // namespace Detail
+
+namespace Internal {
+namespace RDF {
+
+class RActionBase;
+class RColumnRegister;
+
+/**
+\class ROOT::Internal::RDF::RCodeRecorder
+\ingroup dataframe
+\brief Records the operations booked with string expressions, to emit the computation graph as compiled C++ code.
+
+Every Filter, Define and Redefine booked with a string expression, every Alias and Range, every Count and every action
+whose column types are inferred is recorded as the C++ code of the equivalent fully typed RInterface call. Each record
+also holds the state of the computation graph that the operation is called on and, for transformations, the state it
+produces. A state is identified by a node of the graph together with the defines and aliases visible at that node.
+See ROOT::RDF::Experimental::GenerateStandaloneSource.
+**/
+class RCodeRecorder {
+   /// How the generated program reports the result of an action
+   enum class EResultKind { kObject, kValue };
+
+   struct RStatement {
+      std::string fInput;  ///< The state of the graph the operation is called on
+      std::string fOutput; ///< The state of the graph produced by a transformation, empty for actions
+      std::string fCode;   ///< The typed call, e.g. `.Filter([](const float var0){return var0 > 0;}, {"x"}, "cut")`
+      bool fIsAction = false;
+      /// Expires when the result of the action is discarded, in which case the action is not emitted
+      std::weak_ptr<RActionBase> fAction;
+      EResultKind fResultKind = EResultKind::kValue;
+      std::string fResultName; ///< Key of the result in the output file or label on the standard output
+      std::string fUnsupported; ///< Non-empty if the action cannot be emitted, e.g. "Snapshot"
+   };
+
+   std::vector<RStatement> fStatements;
+   /// Operations that change the values of the graph but cannot be emitted, e.g. "Vary"
+   std::vector<std::string> fUnsupported;
+
+   void AddTransformation(std::string input, std::string output, std::string code);
+
+public:
+   static std::string GetStateKey(const ROOT::Detail::RDF::RNodeBase *node, const RColumnRegister &colRegister);
+
+   /// \param[in] function The parameter list and body of the jitted function, e.g. `(const float var0){return var0 > 0;}`
+   void AddFilter(std::string input, std::string output, const std::string &function,
+                  const std::vector<std::string> &columns, const std::string &name);
+   void AddDefine(std::string input, std::string output, bool isRedefine, const std::string &name,
+                  const std::string &function, const std::vector<std::string> &columns);
+   void AddAlias(std::string input, std::string output, const std::string &alias, const std::string &column);
+   void AddRange(std::string input, std::string output, unsigned int begin, unsigned int end, unsigned int stride);
+   void AddCount(std::string input, std::weak_ptr<RActionBase> action);
+   void AddJittedAction(std::string input, std::weak_ptr<RActionBase> action, const std::string &actionName,
+                        const std::type_info &helperArgType, void *helperArgOnHeap,
+                        const std::vector<std::string> &columns, const std::vector<std::string> &columnTypes);
+   void AddUnsupported(const std::string &operation) { fUnsupported.emplace_back(operation); }
+
+   /// Returns the source of a program that runs the recorded computation graph. Jits the graph, to find out whether
+   /// it contains actions that were not recorded. Throws if the graph contains operations that cannot be emitted.
+   std::string GenerateSource(ROOT::Detail::RDF::RLoopManager &lm, const std::vector<std::string> &includes) const;
+};
+
+} // namespace RDF
+} // namespace Internal
+} // namespace ROOT
+
+#endif
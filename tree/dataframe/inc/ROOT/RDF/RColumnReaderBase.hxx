@@ -11,8 +11,12 @@
 #ifndef ROOT_INTERNAL_RDF_RCOLUMNREADERBASE
 #define ROOT_INTERNAL_RDF_RCOLUMNREADERBASE
 
+#include "ROOT/RDF/RMaskedEntryRange.hxx"
 #include <Rtypes.h>
 
+#include <cstddef> // std::size_t
+#include <memory>
+
 namespace ROOT {
 namespace Detail {
 namespace RDF {
@@ -38,8 +42,37 @@ public:
       return *static_cast<T *>(GetImpl(entry));
    }
 
+   /// Return the column values for all entries of the given block, in an array indexed like the block.
+   /// Only the elements corresponding to entries that pass the mask are guaranteed to be valid.
+   /// \tparam T The column type
+   /// \param mask The block of entries that is being processed
+   template <typename T>
+   T *GetBulk(const ROOT::Internal::RDF::RMaskedEntryRange &mask)
+   {
+      if (auto *values = GetBulkImpl(mask))
+         return static_cast<T *>(values);
+
+      // Readers without native bulk support: gather the values of the single entries
+      if (fBulkBufferSize < mask.Capacity()) {
+         fBulkBuffer = std::shared_ptr<void>(new T[mask.Capacity()], [](void *p) { delete[] static_cast<T *>(p); });
+         fBulkBufferSize = mask.Capacity();
+      }
+      auto *buffer = static_cast<T *>(fBulkBuffer.get());
+      for (std::size_t i = 0; i < mask.Size(); ++i) {
+         if (mask[i])
+            buffer[i] = Get<T>(mask.GetEntry(i));
+      }
+      return buffer;
+   }
+
 private:
+   /// Type-erased buffer used by GetBulk for readers that do not implement GetBulkImpl
+   std::shared_ptr<void> fBulkBuffer;
+   std::size_t fBulkBufferSize = 0;
+
    virtual void *GetImpl(Long64_t entry) = 0;
+   /// Return the address of the array of values for the given block, or nullptr if the reader has no bulk support.
+   virtual void *GetBulkImpl(const ROOT::Internal::RDF::RMaskedEntryRange &) { return nullptr; }
 };
 
 } // namespace RDF
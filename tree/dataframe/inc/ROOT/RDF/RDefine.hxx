@@ -15,6 +15,7 @@
 #include "ROOT/RDF/RColumnReaderBase.hxx"
 #include "ROOT/RDF/RDefineBase.hxx"
 #include "ROOT/RDF/RLoopManager.hxx"
+#include "ROOT/RDF/RMaskedEntryRange.hxx"
 #include "ROOT/RDF/Utils.hxx"
 #include "ROOT/RStringView.hxx"
 #include "ROOT/TypeTraits.hxx"
@@ -22,6 +23,8 @@
 
 #include <array>
 #include <deque>
+#include <memory>
+#include <tuple>
 #include <type_traits>
 #include <utility> // std::index_sequence
 #include <vector>
@@ -59,6 +62,8 @@ class R__CLING_PTRCHECK(off) RDefine final : public RDefineBase {
    // Avoid instantiating vector<bool> as `operator[]` returns temporaries in that case. Use std::deque instead.
    using ValuesPerSlot_t =
       std::conditional_t<std::is_same<ret_type, bool>::value, std::deque<ret_type>, std::vector<ret_type>>;
+   using SupportsBulk_t = std::integral_constant<bool, RDFInternal::AreBulkTypes<ColumnTypes_t>::value &&
+                                                          RDFInternal::IsBulkType<ret_type>::value>;
 
    F fExpression;
    ValuesPerSlot_t fLastResults;
@@ -70,6 +75,11 @@ class R__CLING_PTRCHECK(off) RDefine final : public RDefineBase {
    /// The map key is the full variation name, e.g. "pt:up".
    std::unordered_map<std::string, std::unique_ptr<RDefineBase>> fVariedDefines;
 
+   /// Per-slot values for the entries of the current block, only used in bulk mode
+   std::vector<std::unique_ptr<ret_type[]>> fBulkResults;
+   /// Per-slot masks of the entries of the current block for which fBulkResults have already been evaluated
+   std::vector<RDFInternal::RMaskedEntryRange> fBulkEvaluated;
+
    template <typename... ColTypes, std::size_t... S>
    void UpdateHelper(unsigned int slot, Long64_t entry, TypeList<ColTypes...>, std::index_sequence<S...>, NoneTag)
    {
@@ -94,12 +104,64 @@ class R__CLING_PTRCHECK(off) RDefine final : public RDefineBase {
          fExpression(slot, entry, fValues[slot][S]->template Get<ColTypes>(entry)...);
    }
 
+   template <typename... Args>
+   ret_type CallExpression(unsigned int, Long64_t, NoneTag, Args &...args)
+   {
+      return fExpression(args...);
+   }
+
+   template <typename... Args>
+   ret_type CallExpression(unsigned int slot, Long64_t, SlotTag, Args &...args)
+   {
+      return fExpression(slot, args...);
+   }
+
+   template <typename... Args>
+   ret_type CallExpression(unsigned int slot, Long64_t entry, SlotAndEntryTag, Args &...args)
+   {
+      return fExpression(slot, entry, args...);
+   }
+
+   template <typename... ColTypes, std::size_t... S>
+   void *UpdateBulkHelper(unsigned int slot, const RDFInternal::RMaskedEntryRange &mask, TypeList<ColTypes...>,
+                          std::index_sequence<S...>, std::true_type /*supportsBulk*/)
+   {
+      auto &results = fBulkResults[slot];
+      auto &evaluated = fBulkEvaluated[slot];
+      if (evaluated.GetBlockId() != mask.GetBlockId()) {
+         if (evaluated.Capacity() < mask.Capacity())
+            results.reset(new ret_type[mask.Capacity()]);
+         evaluated = mask;
+         evaluated.SetAll(false);
+      }
+
+      // Different branches of the computation graph can request values for different subsets of the block
+      auto values = std::make_tuple(fValues[slot][S]->template GetBulk<ColTypes>(mask)...);
+      for (std::size_t i = 0; i < mask.Size(); ++i) {
+         if (!mask[i] || evaluated[i])
+            continue;
+         results[i] = CallExpression(slot, mask.GetEntry(i), ExtraArgsTag{}, std::get<S>(values)[i]...);
+         evaluated.Set(i, true);
+      }
+      (void)values; // avoid unused variable warnings in case of no input columns
+      return static_cast<void *>(results.get());
+   }
+
+   template <typename... ColTypes, std::size_t... S>
+   void *UpdateBulkHelper(unsigned int, const RDFInternal::RMaskedEntryRange &, TypeList<ColTypes...>,
+                          std::index_sequence<S...>, std::false_type /*supportsBulk*/)
+   {
+      R__ASSERT(false && "Bulk evaluation was requested for a Define that does not support it.");
+      return nullptr;
+   }
+
 public:
    RDefine(std::string_view name, std::string_view type, F expression, const ROOT::RDF::ColumnNames_t &columns,
            const RDFInternal::RColumnRegister &colRegister, RLoopManager &lm,
            const std::string &variationName = "nominal")
       : RDefineBase(name, type, colRegister, lm, columns, variationName), fExpression(std::move(expression)),
-        fLastResults(lm.GetNSlots() * RDFInternal::CacheLineStep<ret_type>()), fValues(lm.GetNSlots())
+        fLastResults(lm.GetNSlots() * RDFInternal::CacheLineStep<ret_type>()), fValues(lm.GetNSlots()),
+        fBulkResults(lm.GetNSlots()), fBulkEvaluated(lm.GetNSlots())
    {
       fLoopManager->Register(this);
    }
@@ -113,6 +175,7 @@ public:
       RDFInternal::RColumnReadersInfo info{fColumnNames, fColRegister, fIsDefine.data(), *fLoopManager};
       fValues[slot] = RDFInternal::GetColumnReaders(slot, r, ColumnTypes_t{}, info, fVariation);
       fLastCheckedEntry[slot * RDFInternal::CacheLineStep<Long64_t>()] = -1;
+      fBulkEvaluated[slot].Invalidate();
    }
 
    /// Return the (type-erased) address of the Define'd value for the given processing slot.
@@ -125,12 +188,20 @@ public:
    void Update(unsigned int slot, Long64_t entry) final
    {
       if (entry != fLastCheckedEntry[slot * RDFInternal::CacheLineStep<Long64_t>()]) {
+         RDFInternal::RProfileScope profileScope(fLoopManager->GetProfiler(), slot, this);
          // evaluate this define expression, cache the result
          UpdateHelper(slot, entry, ColumnTypes_t{}, TypeInd_t{}, ExtraArgsTag{});
          fLastCheckedEntry[slot * RDFInternal::CacheLineStep<Long64_t>()] = entry;
       }
    }
 
+   void *UpdateBulk(unsigned int slot, const RDFInternal::RMaskedEntryRange &mask) final
+   {
+      return UpdateBulkHelper(slot, mask, ColumnTypes_t{}, TypeInd_t{}, SupportsBulk_t{});
+   }
+
+   bool SupportsBulk() const final { return SupportsBulk_t::value; }
+
    void Update(unsigned int /*slot*/, const ROOT::RDF::RSampleInfo &/*id*/) final {}
 
    const std::type_info &GetTypeId() const final { return typeid(ret_type); }
@@ -36,6 +36,18 @@ class RLoopManager;
 
 namespace RDFInternal = ROOT::Internal::RDF;
 
+} // ns RDF
+} // ns Detail
+
+namespace Internal {
+namespace RDF {
+class RMaskedEntryRange;
+} // ns RDF
+} // ns Internal
+
+namespace Detail {
+namespace RDF {
+
 class RDefineBase {
 protected:
    const std::string fName; ///< The name of the custom column
@@ -64,6 +76,12 @@ public:
    std::string GetTypeName() const;
    /// Update the value at the address returned by GetValuePtr with the content corresponding to the given entry
    virtual void Update(unsigned int slot, Long64_t entry) = 0;
+   /// Bulk version of Update: evaluate the values for the entries of the block that pass the mask and return the
+   /// (type-erased) address of the array of values, indexed like the block.
+   /// Returns nullptr if the values can be obtained entry by entry via GetValuePtr, as for a RDefinePerSample.
+   virtual void *UpdateBulk(unsigned int /*slot*/, const RDFInternal::RMaskedEntryRange & /*mask*/) { return nullptr; }
+   /// Whether this define can be evaluated in bulk mode, see RLoopManager::SetBulkSize().
+   virtual bool SupportsBulk() const { return true; }
    /// Update function to be called once per sample, used if the derived type is a RDefinePerSample
    virtual void Update(unsigned int /*slot*/, const ROOT::RDF::RSampleInfo &/*id*/) {}
    /// Clean-up operations to be performed at the end of a task.
@@ -16,7 +16,9 @@
 #include "ROOT/RDF/RCutFlowReport.hxx"
 #include "ROOT/RDF/Utils.hxx"
 #include "ROOT/RDF/RFilterBase.hxx"
+#include "ROOT/RDF/RFilterDecisionCache.hxx"
 #include "ROOT/RDF/RLoopManager.hxx"
+#include "ROOT/RDF/RMaskedEntryRange.hxx"
 #include "ROOT/TypeTraits.hxx"
 #include "RtypesCore.h"
 
@@ -24,6 +26,7 @@
 #include <cassert>
 #include <memory>
 #include <string>
+#include <tuple>
 #include <unordered_map>
 #include <utility> // std::index_sequence
 #include <vector>
@@ -61,12 +64,42 @@ class R__CLING_PTRCHECK(off) RFilter final : public RFilterBase {
    // variations we'll have a RJittedFilter node for the nominal case but other "universes" will use concrete filters,
    // so we normalize the "previous node type" to the base type RFilterBase.
    using PrevNode_t = std::conditional_t<std::is_same<PrevNodeRaw, RJittedFilter>::value, RFilterBase, PrevNodeRaw>;
+   using SupportsBulk_t = RDFInternal::AreBulkTypes<ColumnTypes_t>;
 
    FilterF fFilter;
    /// Column readers per slot and per input column
    std::vector<std::array<RColumnReaderBase *, ColumnTypes_t::list_size>> fValues;
    const std::shared_ptr<PrevNode_t> fPrevNodePtr;
    PrevNode_t &fPrevNode;
+   /// Per-slot masks of the entries of the current block that pass this filter, only used in bulk mode
+   std::vector<RDFInternal::RMaskedEntryRange> fBulkMasks;
+
+   template <typename... ColTypes, std::size_t... S>
+   void CheckFilterBulkHelper(unsigned int slot, RDFInternal::RMaskedEntryRange &mask, TypeList<ColTypes...>,
+                              std::index_sequence<S...>, std::true_type /*supportsBulk*/)
+   {
+      // on input, the mask flags the entries that passed the upstream filters: only those are evaluated
+      auto values = std::make_tuple(fValues[slot][S]->template GetBulk<ColTypes>(mask)...);
+      ULong64_t nAccepted = 0;
+      ULong64_t nRejected = 0;
+      for (std::size_t i = 0; i < mask.Size(); ++i) {
+         if (!mask[i])
+            continue;
+         const bool passed = fFilter(std::get<S>(values)[i]...);
+         mask.Set(i, passed);
+         passed ? ++nAccepted : ++nRejected;
+      }
+      fAccepted[slot * RDFInternal::CacheLineStep<ULong64_t>()] += nAccepted;
+      fRejected[slot * RDFInternal::CacheLineStep<ULong64_t>()] += nRejected;
+      (void)values; // avoid unused variable warnings in case of no input columns
+   }
+
+   template <typename... ColTypes, std::size_t... S>
+   void CheckFilterBulkHelper(unsigned int, RDFInternal::RMaskedEntryRange &, TypeList<ColTypes...>,
+                              std::index_sequence<S...>, std::false_type /*supportsBulk*/)
+   {
+      R__ASSERT(false && "Bulk evaluation was requested for a filter that does not support it.");
+   }
 
 public:
    RFilter(FilterF f, const ROOT::RDF::ColumnNames_t &columns, std::shared_ptr<PrevNode_t> pd,
@@ -75,7 +108,7 @@ public:
       : RFilterBase(pd->GetLoopManagerUnchecked(), name, pd->GetLoopManagerUnchecked()->GetNSlots(), colRegister,
                     columns, pd->GetVariations(), variationName),
         fFilter(std::move(f)), fValues(pd->GetLoopManagerUnchecked()->GetNSlots()), fPrevNodePtr(std::move(pd)),
-        fPrevNode(*fPrevNodePtr)
+        fPrevNode(*fPrevNodePtr), fBulkMasks(fLoopManager->GetNSlots())
    {
       fLoopManager->Register(this);
    }
@@ -91,12 +124,23 @@ public:
    bool CheckFilters(unsigned int slot, Long64_t entry) final
    {
       if (entry != fLastCheckedEntry[slot * RDFInternal::CacheLineStep<Long64_t>()]) {
+         RDFInternal::RProfileScope profileScope(fLoopManager->GetProfiler(), slot, this);
          if (!fPrevNode.CheckFilters(slot, entry)) {
             // a filter upstream returned false, cache the result
             fLastResult[slot * RDFInternal::CacheLineStep<int>()] = false;
          } else {
-            // evaluate this filter, cache the result
-            auto passed = CheckFilterHelper(slot, entry, ColumnTypes_t{}, TypeInd_t{});
+            // evaluate this filter, or take its decision from a previous event loop, and cache the result
+            auto *decisions = fCachedDecisions[slot];
+            const auto treeEntry = decisions ? fLoopManager->GetFilterCacheEntry(slot) : 0;
+            bool passed;
+            if (decisions && decisions[treeEntry] != RDFInternal::RFilterDecisionCache::kUnknown) {
+               passed = decisions[treeEntry] == RDFInternal::RFilterDecisionCache::kAccepted;
+            } else {
+               passed = CheckFilterHelper(slot, entry, ColumnTypes_t{}, TypeInd_t{});
+               if (decisions)
+                  decisions[treeEntry] = passed ? RDFInternal::RFilterDecisionCache::kAccepted
+                                                : RDFInternal::RFilterDecisionCache::kRejected;
+            }
             passed ? ++fAccepted[slot * RDFInternal::CacheLineStep<ULong64_t>()]
                    : ++fRejected[slot * RDFInternal::CacheLineStep<ULong64_t>()];
             fLastResult[slot * RDFInternal::CacheLineStep<int>()] = passed;
@@ -106,6 +150,19 @@ public:
       return fLastResult[slot * RDFInternal::CacheLineStep<int>()];
    }
 
+   const RDFInternal::RMaskedEntryRange &
+   CheckFiltersBulk(unsigned int slot, const RDFInternal::RMaskedEntryRange &mask) final
+   {
+      auto &result = fBulkMasks[slot];
+      if (result.GetBlockId() != mask.GetBlockId()) {
+         result = fPrevNode.CheckFiltersBulk(slot, mask);
+         CheckFilterBulkHelper(slot, result, ColumnTypes_t{}, TypeInd_t{}, SupportsBulk_t{});
+      }
+      return result;
+   }
+
+   bool SupportsBulk() const final { return SupportsBulk_t::value; }
+
    template <typename... ColTypes, std::size_t... S>
    bool CheckFilterHelper(unsigned int slot, Long64_t entry, TypeList<ColTypes...>, std::index_sequence<S...>)
    {
@@ -120,6 +177,7 @@ public:
       RDFInternal::RColumnReadersInfo info{fColumnNames, fColRegister, fIsDefine.data(), *fLoopManager};
       fValues[slot] = RDFInternal::GetColumnReaders(slot, r, ColumnTypes_t{}, info, fVariation);
       fLastCheckedEntry[slot * RDFInternal::CacheLineStep<Long64_t>()] = -1;
+      fBulkMasks[slot].Invalidate();
    }
 
    // recursive chain of `Report`s
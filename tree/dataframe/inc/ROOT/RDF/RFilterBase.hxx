@@ -18,6 +18,7 @@
 #include "RtypesCore.h"
 
 #include <cassert>
+#include <cstdint>
 #include <string>
 #include <vector>
 
@@ -48,6 +49,10 @@ protected:
    ROOT::RVecB fIsDefine;
    std::string fVariation; ///< This indicates for what variation this filter evaluates values.
    std::unordered_map<std::string, std::shared_ptr<RFilterBase>> fVariedFilters;
+   std::string fExpression; ///< The expression of filters defined by a string, part of the key of cached decisions
+   /// Per-slot decisions of this filter for the entries of the current tree, null if they are not cached.
+   /// See RDFInternal::RFilterDecisionCache.
+   std::vector<std::uint8_t *> fCachedDecisions;
 
 public:
    RFilterBase(RLoopManager *df, std::string_view name, const unsigned int nSlots,
@@ -58,8 +63,16 @@ public:
    ~RFilterBase() override;
 
    virtual void InitSlot(TTreeReader *r, unsigned int slot) = 0;
+   /// Whether this filter can be evaluated in bulk mode, see RLoopManager::SetBulkSize().
+   virtual bool SupportsBulk() const { return false; }
    bool HasName() const;
    std::string GetName() const;
+   void SetExpression(std::string_view expression) { fExpression = std::string(expression); }
+   /// Whether the decisions of this filter can be cached across event loops, see RDFInternal::RFilterDecisionCache.
+   bool IsCacheable() const { return HasName() && fVariation == "nominal"; }
+   /// Identifies the filter in the cache of filter decisions.
+   std::string GetCacheKey() const { return fName + '\n' + fExpression; }
+   void SetCachedDecisions(unsigned int slot, std::uint8_t *decisions) { fCachedDecisions[slot] = decisions; }
    virtual void FillReport(ROOT::RDF::RCutFlowReport &) const;
    virtual void TriggerChildrenCount() = 0;
    virtual void ResetReportCount()
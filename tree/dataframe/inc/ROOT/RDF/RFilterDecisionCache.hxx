@@ -0,0 +1,75 @@
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_RDF_RFILTERDECISIONCACHE
+#define ROOT_RDF_RFILTERDECISIONCACHE
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+class TTree;
+
+namespace ROOT {
+namespace Internal {
+namespace RDF {
+
+/**
+\class ROOT::Internal::RDF::RFilterDecisionCache
+\ingroup dataframe
+\brief Keeps the decisions of named Filters per input tree, and persists them across processes in a directory.
+
+For every cached filter and every input tree, the cache holds one byte per tree entry, which tells whether the filter
+accepted or rejected the entry or whether the filter did not evaluate it yet (e.g. because an upstream filter rejected
+the entry). Filters look up the decision before evaluating an entry and store it after evaluation.
+Different slots may process different entries of the same tree at the same time: they write to different bytes of
+the same array.
+
+The decisions are stored in files whose names derive from the filter name, the filter expression (for jitted filters),
+the UUID of the file that contains the tree, and the tree name. Trees that do not live in a file are not cached.
+See ROOT::RDF::Experimental::SetFilterCacheDir.
+**/
+class RFilterDecisionCache {
+public:
+   enum EDecision : std::uint8_t { kUnknown = 0, kRejected = 1, kAccepted = 2 };
+
+private:
+   struct RDecisions {
+      std::string fPath;
+      std::vector<std::uint8_t> fValues;
+      /// Whether the decisions were handed out to a filter since the last Save()
+      bool fIsUsed = false;
+   };
+
+   std::string fDir;
+   std::mutex fMutex;
+   /// Keys are the paths of the cache files
+   std::unordered_map<std::string, std::unique_ptr<RDecisions>> fDecisions;
+
+public:
+   explicit RFilterDecisionCache(std::string_view dir) : fDir(dir) {}
+   RFilterDecisionCache(const RFilterDecisionCache &) = delete;
+   RFilterDecisionCache &operator=(const RFilterDecisionCache &) = delete;
+
+   const std::string &GetDir() const { return fDir; }
+   /// Returns the array of decisions of the filter with the given key for the entries of the given tree, loading
+   /// them from the cache directory if they are not yet in memory. Returns nullptr if the tree cannot be cached.
+   std::uint8_t *GetDecisions(const std::string &filterKey, TTree &tree);
+   /// Writes the decisions that were used since the last call to the cache directory.
+   void Save();
+};
+
+} // namespace RDF
+} // namespace Internal
+} // namespace ROOT
+
+#endif
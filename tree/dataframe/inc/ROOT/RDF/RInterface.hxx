@@ -32,6 +32,7 @@
 #include "ROOT/RStringView.hxx"
 #include "ROOT/RVec.hxx"
 #include "ROOT/TypeTraits.hxx"
+#include "RConfigure.h" // R__HAS_ROOT7
 #include "RtypesCore.h" // for ULong64_t
 #include "TDirectory.h"
 #include "TH1.h" // For Histo actions
@@ -89,6 +90,10 @@ class GraphCreatorHelper;
 void ChangeEmptyEntryRange(const ROOT::RDF::RNode &node, std::pair<ULong64_t, ULong64_t> &&newRange);
 void ChangeSpec(const ROOT::RDF::RNode &node, ROOT::RDF::Experimental::RDatasetSpec &&spec);
 void TriggerRun(ROOT::RDF::RNode node);
+void SetBulkSize(const ROOT::RDF::RNode &node, unsigned int bulkSize);
+void EnableProfiling(const ROOT::RDF::RNode &node, unsigned int samplingPeriod);
+RProfiler *GetProfiler(const ROOT::RDF::RNode &node);
+std::string GenerateStandaloneSource(const ROOT::RDF::RNode &node, const std::vector<std::string> &includes);
 } // namespace RDF
 } // namespace Internal
 
@@ -121,6 +126,11 @@ class RInterface : public RInterfaceBase {
    friend void RDFInternal::TriggerRun(RNode node);
    friend void RDFInternal::ChangeEmptyEntryRange(const RNode &node, std::pair<ULong64_t, ULong64_t> &&newRange);
    friend void RDFInternal::ChangeSpec(const RNode &node, ROOT::RDF::Experimental::RDatasetSpec &&spec);
+   friend void RDFInternal::SetBulkSize(const RNode &node, unsigned int bulkSize);
+   friend void RDFInternal::EnableProfiling(const RNode &node, unsigned int samplingPeriod);
+   friend RDFInternal::RProfiler *RDFInternal::GetProfiler(const RNode &node);
+   friend std::string
+   RDFInternal::GenerateStandaloneSource(const RNode &node, const std::vector<std::string> &includes);
 
    std::shared_ptr<Proxied> fProxiedPtr; ///< Smart pointer to the graph node encapsulated by this RInterface.
 
@@ -910,6 +920,9 @@ public:
 
       RDFInternal::RColumnRegister newCols(fColRegister);
       newCols.AddAlias(alias, validColumnName);
+      fLoopManager->GetCodeRecorder().AddAlias(RDFInternal::RCodeRecorder::GetStateKey(fProxiedPtr.get(), fColRegister),
+                                               RDFInternal::RCodeRecorder::GetStateKey(fProxiedPtr.get(), newCols),
+                                               std::string(alias), validColumnName);
 
       RInterface<Proxied, DS_t> newInterface(fProxiedPtr, *fLoopManager, std::move(newCols));
 
@@ -953,6 +966,20 @@ public:
    /// single-thread and multi-thread runs is different: in single-thread runs, Snapshot will write out a TTree with
    /// the specified name and zero entries; in multi-thread runs, no TTree object will be written out to disk.
    ///
+   /// ### Writing RNTuple
+   ///
+   /// Setting `RSnapshotOptions::fOutputFormat` to `ESnapshotOutputFormat::kRNTuple` writes an RNTuple instead of a
+   /// TTree (this requires ROOT to be built with `root7`). In multi-thread runs all threads fill the same RNTuple
+   /// directly through a RNTupleParallelWriter, without the intermediate in-memory files used for TTree output:
+   /// each task writes its own clusters, so entries are shuffled with cluster granularity as in the TTree case.
+   /// RNTuple output only supports the `RECREATE` file mode and cannot be written into a sub-directory. The
+   /// RDataFrame returned by an RNTuple Snapshot has no default columns.
+   /// ~~~{.cpp}
+   /// ROOT::RDF::RSnapshotOptions opts;
+   /// opts.fOutputFormat = ROOT::RDF::ESnapshotOutputFormat::kRNTuple;
+   /// df.Snapshot("ntuple", "outputFile.root", {"x", "y"}, opts);
+   /// ~~~
+   ///
    /// \note Snapshot will refuse to process columns with names of the form `#columnname`. These are special columns
    /// made available by some data sources (e.g. RNTupleDS) that represent the size of column `columnname`, and are
    /// not meant to be written out with that name (which is not a valid C++ variable name). Instead, go through an
@@ -1022,7 +1049,7 @@ public:
                                          colListWithAliasesAndSizeBranches, options});
 
       ::TDirectory::TContext ctxt;
-      auto newRDF = std::make_shared<ROOT::RDataFrame>(fullTreeName, filename, colListNoAliasesWithSizeBranches);
+      auto newRDF = MakeSnapshotOutputDF(fullTreeName, filename, colListNoAliasesWithSizeBranches, *snapHelperArgs);
 
       auto resPtr = CreateAction<RDFInternal::ActionTags::Snapshot, RDFDetail::RInferredType>(
          colListNoAliasesWithSizeBranches, newRDF, snapHelperArgs, fProxiedPtr,
@@ -1223,6 +1250,48 @@ public:
       return Cache(selectedColumns);
    }
 
+   ////////////////////////////////////////////////////////////////////////////
+   /// \brief Save selected columns in a local file.
+   /// \tparam ColumnTypes variadic list of branch/column types.
+   /// \param[in] columnList columns to be cached.
+   /// \param[in] fileName the scratch file that stores the cached columns as an RNTuple.
+   /// \return a `RDataFrame` that wraps the cached dataset.
+   ///
+   /// This overload works like the in-memory Cache, but the selected columns of the entries that pass the filters are
+   /// written to an RNTuple in `fileName`, so that datasets larger than the available memory can be cached.
+   /// If `fileName` already contains a cache with all the requested columns, e.g. written by a previous session, no
+   /// event loop is run: the returned `RDataFrame` reads the existing cache. It is up to the user to delete the file
+   /// when the computation graph or its input data change.
+   ///
+   /// This feature requires ROOT to be built with root7.
+   ///
+   /// ### Example usage:
+   /// ~~~{.cpp}
+   /// // the first session reads the remote files, later ones only read the local cache
+   /// auto cached_df = df.Filter("pt > 10").Cache<float, int>({"pt", "n"}, "/tmp/my_cache.root");
+   /// ~~~
+   template <typename... ColumnTypes>
+   RInterface<RLoopManager> Cache(const ColumnNames_t &columnList, std::string_view fileName)
+   {
+      return CacheToDiskImpl(columnList, fileName, [&](const RSnapshotOptions &options) {
+         return Snapshot<ColumnTypes...>(kDiskCacheName, fileName, columnList, options);
+      });
+   }
+
+   ////////////////////////////////////////////////////////////////////////////
+   /// \brief Save selected columns in a local file.
+   /// \param[in] columnList columns to be cached.
+   /// \param[in] fileName the scratch file that stores the cached columns as an RNTuple.
+   /// \return a `RDataFrame` that wraps the cached dataset.
+   ///
+   /// See the previous overload for more information. This overload relies on jitting.
+   RInterface<RLoopManager> Cache(const ColumnNames_t &columnList, std::string_view fileName)
+   {
+      return CacheToDiskImpl(columnList, fileName, [&](const RSnapshotOptions &options) {
+         return Snapshot(kDiskCacheName, fileName, columnList, options);
+      });
+   }
+
    // clang-format off
    ////////////////////////////////////////////////////////////////////////////
    /// \brief Creates a node that filters entries based on range: [begin, end).
@@ -1250,6 +1319,9 @@ public:
 
       using Range_t = RDFDetail::RRange<Proxied>;
       auto rangePtr = std::make_shared<Range_t>(begin, end, stride, fProxiedPtr);
+      fLoopManager->GetCodeRecorder().AddRange(RDFInternal::RCodeRecorder::GetStateKey(fProxiedPtr.get(), fColRegister),
+                                               RDFInternal::RCodeRecorder::GetStateKey(rangePtr.get(), fColRegister),
+                                               begin, end, stride);
       RInterface<RDFDetail::RRange<Proxied>, DS_t> newInterface(std::move(rangePtr), *fLoopManager, fColRegister);
       return newInterface;
    }
@@ -1406,8 +1478,10 @@ public:
       auto cSPtr = std::make_shared<ULong64_t>(0);
       using Helper_t = RDFInternal::CountHelper;
       using Action_t = RDFInternal::RAction<Helper_t, Proxied>;
-      auto action = std::make_unique<Action_t>(Helper_t(cSPtr, nSlots), ColumnNames_t({}), fProxiedPtr,
+      auto action = std::make_shared<Action_t>(Helper_t(cSPtr, nSlots), ColumnNames_t({}), fProxiedPtr,
                                                RDFInternal::RColumnRegister(fColRegister));
+      fLoopManager->GetCodeRecorder().AddCount(RDFInternal::RCodeRecorder::GetStateKey(fProxiedPtr.get(), fColRegister),
+                                               action);
       return MakeResultPtr(cSPtr, *fLoopManager, std::move(action));
    }
 
@@ -2849,8 +2923,8 @@ private:
          std::string(filename), std::string(dirname), std::string(treename), columnListWithoutSizeColumns, options});
 
       ::TDirectory::TContext ctxt;
-      auto newRDF =
-         std::make_shared<ROOT::RDataFrame>(fullTreeName, filename, /*defaultColumns=*/columnListWithoutSizeColumns);
+      auto newRDF = MakeSnapshotOutputDF(fullTreeName, filename, /*defaultColumns=*/columnListWithoutSizeColumns,
+                                         *snapHelperArgs);
 
       // The Snapshot helper will use validCols (with aliases resolved) as input columns, and
       // columnListWithoutSizeColumns (still with aliases in it, passed through snapHelperArgs) as output column names.
@@ -2862,6 +2936,56 @@ private:
       return resPtr;
    }
 
+   ////////////////////////////////////////////////////////////////////////////
+   /// \brief Create the RDataFrame returned by Snapshot, which reads the dataset written by the Snapshot.
+   std::shared_ptr<ROOT::RDataFrame> MakeSnapshotOutputDF(std::string_view fullTreeName, std::string_view filename,
+                                                          const ColumnNames_t &defaultColumns,
+                                                          RDFInternal::SnapshotHelperArgs &snapHelperArgs)
+   {
+      if (snapHelperArgs.fOptions.fOutputFormat != ROOT::RDF::ESnapshotOutputFormat::kRNTuple)
+         return std::make_shared<ROOT::RDataFrame>(fullTreeName, filename, defaultColumns);
+#ifdef R__HAS_ROOT7
+      // An RNTuple can only be opened after it has been written: the returned RDataFrame starts out without entries
+      // and the Snapshot action points it to the RNTuple at the end of the event loop.
+      auto newRDF = std::make_shared<ROOT::RDataFrame>(0ull);
+      std::weak_ptr<ROOT::RDataFrame> weakRDF = newRDF;
+      snapHelperArgs.fOnOutputWritten = [weakRDF, ntupleName = snapHelperArgs.fTreeName,
+                                         fileName = snapHelperArgs.fFileName] {
+         if (auto df = weakRDF.lock())
+            RDFInternal::ResetToRNTuple(*df, ntupleName, fileName);
+      };
+      return newRDF;
+#else
+      (void)defaultColumns;
+      throw std::runtime_error("Snapshot: writing RNTuple output requires ROOT to be built with root7.");
+#endif
+   }
+
+   /// Name of the RNTuple written by the on-disk Cache.
+   static constexpr const char *kDiskCacheName = "RDFCache";
+
+   ////////////////////////////////////////////////////////////////////////////
+   /// \brief Implementation of the on-disk cache: `snapshot` writes the cache if `fileName` does not contain it yet.
+   template <typename SnapshotFn>
+   RInterface<RLoopManager>
+   CacheToDiskImpl(const ColumnNames_t &columnList, std::string_view fileName, SnapshotFn &&snapshot)
+   {
+#ifdef R__HAS_ROOT7
+      const auto columnListWithoutSizeColumns = RDFInternal::FilterArraySizeColNames(columnList, "Cache");
+      if (auto lm = RDFInternal::OpenDiskCache(kDiskCacheName, fileName, columnListWithoutSizeColumns))
+         return RInterface<RLoopManager>(std::move(lm));
+
+      RSnapshotOptions options;
+      options.fOutputFormat = ROOT::RDF::ESnapshotOutputFormat::kRNTuple;
+      return *snapshot(options);
+#else
+      (void)columnList;
+      (void)fileName;
+      (void)snapshot;
+      throw std::runtime_error("Cache: caching to disk requires ROOT to be built with root7.");
+#endif
+   }
+
    ////////////////////////////////////////////////////////////////////////////
    /// \brief Implementation of cache.
    template <typename... ColTypes, std::size_t... S>
@@ -2914,6 +3038,7 @@ private:
 
       RDFInternal::RColumnRegister newCols(fColRegister);
       newCols.AddVariation(std::move(variation));
+      fLoopManager->GetCodeRecorder().AddUnsupported("Vary");
 
       RInterface<Proxied> newInterface(fProxiedPtr, *fLoopManager, std::move(newCols));
 
@@ -2949,6 +3074,7 @@ private:
 
       RDFInternal::RColumnRegister newColRegister(fColRegister);
       newColRegister.AddVariation(std::move(jittedVariation));
+      fLoopManager->GetCodeRecorder().AddUnsupported("Vary");
 
       RInterface<Proxied, DS_t> newInterface(fProxiedPtr, *fLoopManager, std::move(newColRegister));
 
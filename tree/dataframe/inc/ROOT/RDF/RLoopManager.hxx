@@ -12,11 +12,16 @@
 #define ROOT_RLOOPMANAGER
 
 #include "ROOT/InternalTreeUtils.hxx" // RNoCleanupNotifier
+#include "ROOT/RDF/RCodeRecorder.hxx"
 #include "ROOT/RDF/RColumnReaderBase.hxx"
 #include "ROOT/RDF/RDatasetSpec.hxx"
+#include "ROOT/RDF/RFilterDecisionCache.hxx"
+#include "ROOT/RDF/RMaskedEntryRange.hxx"
 #include "ROOT/RDF/RNodeBase.hxx"
 #include "ROOT/RDF/RNewSampleNotifier.hxx"
 #include "ROOT/RDF/RSampleInfo.hxx"
+#include "ROOT/RDF/RProfiler.hxx"
+#include "ROOT/RDF/RStagedColumnReader.hxx"
 
 #include <functional>
 #include <limits>
@@ -32,6 +37,7 @@ class TTreeReader;
 class TDirectory;
 
 namespace ROOT {
+class TTreeProcessorMT;
 namespace RDF {
 class RCutFlowReport;
 class RDataSource;
@@ -152,6 +158,34 @@ class RLoopManager : public RNodeBase {
    /// Readers for TTree/RDataSource columns (one per slot), shared by all nodes in the computation graph.
    std::vector<std::unordered_map<std::string, std::unique_ptr<RColumnReaderBase>>> fDatasetColumnReaders;
 
+   /// Number of entries processed together in bulk mode, zero if bulk processing was not requested.
+   unsigned int fBulkSize{0};
+   /// Whether the current event loop runs in bulk mode, i.e. bulk processing was requested and is supported by all
+   /// nodes of the computation graph.
+   bool fIsBulkActive{false};
+   /// Readers that stage the values of dataset columns in bulk mode (one map per slot), re-created at every task.
+   std::vector<std::unordered_map<std::string, std::unique_ptr<RDFInternal::RStagedColumnReaderBase>>>
+      fStagedColumnReaders;
+   /// The trees whose unused branches were deactivated by PruneBranches (one per slot), null if none was.
+   std::vector<TTree *> fPrunedTrees;
+   /// Loop managers of other computation graphs over the same dataset, which the next event loop runs together with
+   /// this one. Their nodes read the dataset through the TTreeReaders of this loop manager. See FuseEventLoopWith.
+   std::vector<RLoopManager *> fFusedLoops;
+   /// Collects the time spent in the nodes of the computation graph, null if profiling is disabled.
+   std::unique_ptr<RDFInternal::RProfiler> fProfiler;
+   /// Decisions of the named filters recorded in previous event loops, null if the filter cache is disabled or not
+   /// applicable to the current event loop. See ROOT::RDF::Experimental::SetFilterCacheDir.
+   std::unique_ptr<RDFInternal::RFilterDecisionCache> fFilterDecisionCache;
+   /// The trees whose entries the cached filter decisions refer to (one per slot).
+   std::vector<TTree *> fFilterCacheTrees;
+
+   /// Processor of the next multi-thread event loop over TTrees. It is created before jitting, so that it retrieves the
+   /// clusters of the first input files while the computation graph is being compiled. Null outside of Run().
+   std::shared_ptr<ROOT::TTreeProcessorMT> fTreeProcessor;
+
+   /// The operations booked with string expressions, see ROOT::RDF::Experimental::GenerateStandaloneSource.
+   RDFInternal::RCodeRecorder fCodeRecorder;
+
    /// Cache of the tree/chain branch names. Never access directy, always use GetBranchNames().
    ColumnNames_t fValidBranchNames;
 
@@ -159,19 +193,28 @@ class RLoopManager : public RNodeBase {
 
    void RunEmptySourceMT();
    void RunEmptySource();
+   std::shared_ptr<ROOT::TTreeProcessorMT> MakeTreeProcessor();
    void RunTreeProcessorMT();
    void RunTreeReader();
    void RunDataSourceMT();
    void RunDataSource();
    void RunAndCheckFilters(unsigned int slot, Long64_t entry);
+   void RunAndCheckFiltersBulk(unsigned int slot, RDFInternal::RMaskedEntryRange &block);
+   void ProcessEntry(unsigned int slot, Long64_t entry, RDFInternal::RMaskedEntryRange &block);
+   void RunSampleCallbacks(unsigned int slot);
+   bool CheckBulkSupport();
    void InitNodeSlots(TTreeReader *r, unsigned int slot);
    void InitNodes();
+   void InitProfiler();
    void CleanUpNodes();
    void CleanUpTask(TTreeReader *r, unsigned int slot);
    void EvalChildrenCounts();
    void SetupSampleCallbacks(TTreeReader *r, unsigned int slot);
    void UpdateSampleInfo(unsigned int slot, const std::pair<ULong64_t, ULong64_t> &range);
    void UpdateSampleInfo(unsigned int slot, TTreeReader &r);
+   void PruneBranches(unsigned int slot, TTreeReader &r);
+   void InitFilterDecisionCache();
+   void UpdateFilterDecisions(unsigned int slot, TTreeReader &r);
 
 public:
    RLoopManager(TTree *tree, const ColumnNames_t &defaultBranches);
@@ -185,6 +228,8 @@ public:
    void Jit();
    RLoopManager *GetLoopManagerUnchecked() final { return this; }
    void Run(bool jit = true);
+   bool HasSameDataset(const RLoopManager &other) const;
+   void FuseEventLoopWith(RLoopManager &other);
    const ColumnNames_t &GetDefaultColumnNames() const;
    TTree *GetTree() const;
    ::TDirectory *GetDirectory() const;
@@ -201,6 +246,12 @@ public:
    void Register(RDFInternal::RVariationBase *varPtr);
    void Deregister(RDFInternal::RVariationBase *varPtr);
    bool CheckFilters(unsigned int, Long64_t) final;
+   /// End of the recursive chain of calls: all entries of the block pass
+   const RDFInternal::RMaskedEntryRange &
+   CheckFiltersBulk(unsigned int, const RDFInternal::RMaskedEntryRange &mask) final
+   {
+      return mask;
+   }
    unsigned int GetNSlots() const { return fNSlots; }
    void Report(ROOT::RDF::RCutFlowReport &rep) const final;
    /// End of recursive chain of calls, does nothing
@@ -217,6 +268,21 @@ public:
    RColumnReaderBase *AddTreeColumnReader(unsigned int slot, const std::string &col,
                                           std::unique_ptr<RColumnReaderBase> &&reader, const std::type_info &ti);
    RColumnReaderBase *GetDatasetColumnReader(unsigned int slot, const std::string &col, const std::type_info &ti) const;
+   RColumnReaderBase *AddStagedColumnReader(unsigned int slot, const std::string &col,
+                                            std::unique_ptr<RDFInternal::RStagedColumnReaderBase> &&reader,
+                                            const std::type_info &ti);
+   RColumnReaderBase *GetStagedColumnReader(unsigned int slot, const std::string &col, const std::type_info &ti) const;
+
+   /// Request that the event loop processes blocks of bulkSize entries at a time (zero disables bulk processing).
+   void SetBulkSize(unsigned int bulkSize) { fBulkSize = bulkSize; }
+   /// The number of entries per block if the current event loop runs in bulk mode, zero otherwise.
+   unsigned int GetBulkSize() const { return fIsBulkActive ? fBulkSize : 0u; }
+   void EnableProfiling(unsigned int samplingPeriod);
+   RDFInternal::RProfiler *GetProfiler() const { return fProfiler.get(); }
+   RDFInternal::RCodeRecorder &GetCodeRecorder() { return fCodeRecorder; }
+   /// The entry number, within the current tree, of the entry that `slot` is processing. Used by the filters whose
+   /// decisions are cached.
+   Long64_t GetFilterCacheEntry(unsigned int slot) const;
 
    /// End of recursive chain of calls, does nothing
    void AddFilterName(std::vector<std::string> &) final {}
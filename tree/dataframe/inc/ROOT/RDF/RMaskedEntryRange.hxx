@@ -0,0 +1,103 @@
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_RDF_RMASKEDENTRYRANGE
+#define ROOT_RDF_RMASKEDENTRYRANGE
+
+#include <ROOT/TypeTraits.hxx>
+#include <RtypesCore.h> // Long64_t, ULong64_t
+
+#include <algorithm>
+#include <cstddef> // std::size_t
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+namespace ROOT {
+namespace Internal {
+namespace RDF {
+
+/// Whether values of type T can be processed in bulk, i.e. stored in contiguous per-block buffers.
+template <typename T>
+struct IsBulkType
+   : std::integral_constant<bool, std::is_default_constructible<T>::value && std::is_copy_assignable<T>::value> {
+};
+
+template <bool...>
+struct RBoolPack {
+};
+
+/// Whether all the types in the TypeList can be processed in bulk.
+template <typename TypeList>
+struct AreBulkTypes;
+
+template <typename... Ts>
+struct AreBulkTypes<ROOT::TypeTraits::TypeList<Ts...>>
+   : std::is_same<RBoolPack<true, IsBulkType<Ts>::value...>, RBoolPack<IsBulkType<Ts>::value..., true>> {
+};
+
+/**
+\class ROOT::Internal::RDF::RMaskedEntryRange
+\ingroup dataframe
+\brief A block of entries processed together in bulk mode, with a mask that flags the entries still "alive".
+
+The block stores the entry numbers explicitly, as the entries processed by a task are not necessarily contiguous
+(e.g. in presence of entry lists). The mask element i refers to the i-th entry of the block. Bulk values
+returned by column readers are arrays of the same size as the block, indexed in the same way.
+Every block has an identifier, unique within the task that processes it, that nodes use to cache their results.
+**/
+class RMaskedEntryRange {
+public:
+   static constexpr ULong64_t kInvalidBlockId = std::numeric_limits<ULong64_t>::max();
+
+private:
+   std::vector<Long64_t> fEntries;
+   std::vector<char> fMask; // std::vector<bool> is slow to access element-wise
+   std::size_t fSize = 0;
+   ULong64_t fBlockId = kInvalidBlockId;
+
+public:
+   explicit RMaskedEntryRange(std::size_t capacity = 0, ULong64_t blockId = kInvalidBlockId)
+      : fEntries(capacity), fMask(capacity), fBlockId(blockId)
+   {
+   }
+
+   std::size_t Size() const { return fSize; }
+   std::size_t Capacity() const { return fEntries.size(); }
+   bool IsFull() const { return fSize == fEntries.size(); }
+   ULong64_t GetBlockId() const { return fBlockId; }
+   Long64_t GetEntry(std::size_t i) const { return fEntries[i]; }
+   bool operator[](std::size_t i) const { return fMask[i] != 0; }
+   void Set(std::size_t i, bool value) { fMask[i] = value; }
+   /// Set all mask elements of the block to the given value.
+   void SetAll(bool value) { std::fill(fMask.begin(), fMask.begin() + fSize, value); }
+   /// Return the number of entries that pass the mask.
+   std::size_t Count() const { return std::count(fMask.begin(), fMask.begin() + fSize, 1); }
+
+   /// Empty the block and assign it a new identifier.
+   void Reset(ULong64_t blockId)
+   {
+      fSize = 0;
+      fBlockId = blockId;
+   }
+   /// Append an entry to the block, initially passing the mask. The block must not be full.
+   void Push(Long64_t entry)
+   {
+      fEntries[fSize] = entry;
+      fMask[fSize] = 1;
+      ++fSize;
+   }
+   /// Forget the block identifier, e.g. to invalidate results cached by a node at the beginning of a task.
+   void Invalidate() { fBlockId = kInvalidBlockId; }
+};
+
+} // namespace RDF
+} // namespace Internal
+} // namespace ROOT
+
+#endif // ROOT_RDF_RMASKEDENTRYRANGE
@@ -29,6 +29,7 @@ namespace RDF {
 namespace GraphDrawing {
 class GraphNode;
 }
+class RMaskedEntryRange;
 }
 }
 
@@ -54,6 +55,15 @@ public:
    }
    virtual ~RNodeBase() {}
    virtual bool CheckFilters(unsigned int, Long64_t) = 0;
+   /// Bulk version of CheckFilters: return the mask of the entries of the block that pass this node and all upstream
+   /// filters. The returned object is only valid until the next block is processed.
+   virtual const ROOT::Internal::RDF::RMaskedEntryRange &
+   CheckFiltersBulk(unsigned int, const ROOT::Internal::RDF::RMaskedEntryRange &mask)
+   {
+      R__ASSERT(false && "CheckFiltersBulk was called on a node type that does not implement it. This should never "
+                         "happen.");
+      return mask;
+   }
    virtual void Report(ROOT::RDF::RCutFlowReport &) const = 0;
    virtual void PartialReport(ROOT::RDF::RCutFlowReport &) const = 0;
    virtual void IncrChildrenCount() = 0;
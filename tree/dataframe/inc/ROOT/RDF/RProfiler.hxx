@@ -0,0 +1,194 @@
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_RDF_RPROFILER
+#define ROOT_RDF_RPROFILER
+
+#include "RColumnReaderBase.hxx"
+#include <Rtypes.h> // Long64_t, ULong64_t, R__CLING_PTRCHECK
+
+#include <chrono>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility> // std::pair
+#include <vector>
+
+namespace ROOT {
+namespace Internal {
+namespace RDF {
+
+/**
+\class ROOT::Internal::RDF::RProfiler
+\ingroup dataframe
+\brief Collects the time spent in the nodes of a computation graph during an event loop.
+
+One entry every `samplingPeriod` entries of each slot is timed: the nodes record when they start and stop working on
+it, and the time between the two calls is attributed to the node, minus the time spent in the nodes it called in the
+meantime (e.g. the Defines and the column readers that provide its inputs). Every slot records its own timings, so
+timing an entry takes no locks. Results are kept per call stack, which gives both the per-node times and the "folded
+stacks" used to draw flame graphs.
+
+Nodes are identified by their address: Filters, Defines and actions are registered by RLoopManager before the event
+loop starts, while column readers, which are created during the event loop, register by column name.
+**/
+class RProfiler {
+public:
+   using Clock_t = std::chrono::steady_clock;
+   static constexpr unsigned int kInvalidNode = unsigned(-1);
+
+private:
+   struct RNodeInfo {
+      std::string fKind;
+      std::string fName;
+   };
+   /// A call stack, stored as its innermost node plus the call stack of the caller.
+   struct RCallStack {
+      unsigned int fParent;
+      unsigned int fNode;
+      ULong64_t fTimeNs = 0; ///< Time spent in fNode when called from this call stack, not counting its callees.
+      ULong64_t fCalls = 0;
+   };
+   struct RFrame {
+      unsigned int fCallStack;
+      Clock_t::time_point fStart;
+   };
+   struct RSlotData {
+      bool fIsSampled = false;
+      ULong64_t fNEntries = 0;
+      ULong64_t fNSampledEntries = 0;
+      /// Element 0 is the empty call stack.
+      std::vector<RCallStack> fCallStacks{RCallStack{0u, kInvalidNode}};
+      std::map<std::pair<unsigned int, unsigned int>, unsigned int> fCallStackIds;
+      std::vector<RFrame> fFrames;
+      /// Profiled column readers of the current task, see AddColumnReader.
+      std::unordered_map<std::string, std::unique_ptr<ROOT::Detail::RDF::RColumnReaderBase>> fColumnReaders;
+   };
+
+   unsigned int fSamplingPeriod;
+   /// One element per slot. Slots only touch their own data, allocated separately to avoid false sharing.
+   std::vector<std::unique_ptr<RSlotData>> fSlots;
+   std::vector<RNodeInfo> fNodes;
+   std::unordered_map<const void *, unsigned int> fNodeIds;
+   std::unordered_map<std::string, unsigned int> fColumnIds;
+   std::mutex fColumnIdsMutex; ///< Column readers register concurrently from different slots.
+   double fJitTime = 0.;
+   double fEventLoopRealTime = 0.;
+   double fEventLoopCpuTime = 0.;
+
+   unsigned int AddNode(std::string kind, std::string name);
+   double GetEstimatedTime(unsigned int node, unsigned int slot) const;
+
+public:
+   explicit RProfiler(unsigned int samplingPeriod) : fSamplingPeriod(samplingPeriod > 0u ? samplingPeriod : 1u) {}
+
+   /// Forget the timings of the previous event loop and the nodes it ran. Called at the beginning of each event loop.
+   void Reset(unsigned int nSlots);
+   /// Register a node of the computation graph. Must not be called during the event loop.
+   void RegisterNode(const void *node, std::string kind, std::string name);
+   /// Return the identifier of the column reader of column `colName`, registering it if needed. Thread-safe.
+   unsigned int RegisterColumn(const std::string &colName);
+
+   /// Decide whether the next entry of the slot is timed.
+   void StartEntry(unsigned int slot)
+   {
+      auto &data = *fSlots[slot];
+      data.fIsSampled = data.fNEntries++ % fSamplingPeriod == 0;
+      data.fNSampledEntries += data.fIsSampled;
+   }
+   bool IsSampled(unsigned int slot) const { return fSlots[slot]->fIsSampled; }
+
+   unsigned int GetNodeId(const void *node) const
+   {
+      auto it = fNodeIds.find(node);
+      return it == fNodeIds.end() ? kInvalidNode : it->second;
+   }
+   void Enter(unsigned int slot, unsigned int node);
+   void Exit(unsigned int slot);
+
+   ROOT::Detail::RDF::RColumnReaderBase *GetColumnReader(unsigned int slot, const std::string &key) const;
+   ROOT::Detail::RDF::RColumnReaderBase *
+   AddColumnReader(unsigned int slot, const std::string &key,
+                   std::unique_ptr<ROOT::Detail::RDF::RColumnReaderBase> &&reader);
+   /// Destroy the profiled column readers of the slot. They refer to dataset column readers that only live as long as
+   /// the task that created them.
+   void ClearColumnReaders(unsigned int slot) { fSlots[slot]->fColumnReaders.clear(); }
+
+   /// Jitting happens before the event loop starts, so Reset does not clear the jitting time.
+   void SetJitTime(double seconds) { fJitTime = seconds; }
+   void SetEventLoopTime(double realTime, double cpuTime)
+   {
+      fEventLoopRealTime = realTime;
+      fEventLoopCpuTime = cpuTime;
+   }
+
+   std::string ToJSON() const;
+   std::string ToFoldedStacks() const;
+};
+
+/// RAII helper that times the work of a node on the current entry, if the entry is sampled.
+class RProfileScope {
+   RProfiler *fProfiler = nullptr;
+   unsigned int fSlot = 0u;
+
+public:
+   RProfileScope(RProfiler *profiler, unsigned int slot, const void *node)
+   {
+      if (profiler == nullptr || !profiler->IsSampled(slot))
+         return;
+      const auto id = profiler->GetNodeId(node);
+      if (id == RProfiler::kInvalidNode)
+         return;
+      fProfiler = profiler;
+      fSlot = slot;
+      fProfiler->Enter(slot, id);
+   }
+   RProfileScope(const RProfileScope &) = delete;
+   RProfileScope &operator=(const RProfileScope &) = delete;
+   ~RProfileScope()
+   {
+      if (fProfiler != nullptr)
+         fProfiler->Exit(fSlot);
+   }
+};
+
+/// Column reader that times the reads of the values of a dataset column, used when profiling is enabled.
+/// The time spent here is the time needed to read and decompress the data.
+template <typename T>
+class R__CLING_PTRCHECK(off) RProfiledColumnReader final : public ROOT::Detail::RDF::RColumnReaderBase {
+   /// Non-owning reference to the dataset column reader, owned by RLoopManager.
+   ROOT::Detail::RDF::RColumnReaderBase &fReader;
+   RProfiler &fProfiler;
+   unsigned int fSlot;
+   unsigned int fId;
+
+   void *GetImpl(Long64_t entry) final
+   {
+      if (!fProfiler.IsSampled(fSlot))
+         return &fReader.Get<T>(entry);
+      fProfiler.Enter(fSlot, fId);
+      auto *value = &fReader.Get<T>(entry);
+      fProfiler.Exit(fSlot);
+      return value;
+   }
+
+public:
+   RProfiledColumnReader(ROOT::Detail::RDF::RColumnReaderBase &reader, RProfiler &profiler, unsigned int slot,
+                         unsigned int id)
+      : fReader(reader), fProfiler(profiler), fSlot(slot), fId(id)
+   {
+   }
+};
+
+} // namespace RDF
+} // namespace Internal
+} // namespace ROOT
+
+#endif // ROOT_RDF_RPROFILER
@@ -0,0 +1,58 @@
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_RDF_RSTAGEDCOLUMNREADER
+#define ROOT_RDF_RSTAGEDCOLUMNREADER
+
+#include "RColumnReaderBase.hxx"
+#include "RMaskedEntryRange.hxx"
+#include <Rtypes.h> // Long64_t, R__CLING_PTRCHECK
+
+#include <cstddef> // std::size_t
+#include <memory>
+
+namespace ROOT {
+namespace Internal {
+namespace RDF {
+
+/// Base class of the column readers that collect the values of a dataset column for a block of entries.
+class R__CLING_PTRCHECK(off) RStagedColumnReaderBase : public ROOT::Detail::RDF::RColumnReaderBase {
+public:
+   /// Copy the value of the current entry into the idx-th element of the block buffer.
+   virtual void Stage(std::size_t idx, Long64_t entry) = 0;
+};
+
+/// Column reader used in bulk mode for TTree and RDataSource columns.
+///
+/// TTree and data source readers only expose the value of the current entry. While the loop advances through the
+/// entries of a block, RLoopManager stages the values read by the wrapped reader into a contiguous buffer, which then
+/// serves the bulk requests of the nodes of the computation graph.
+template <typename T>
+class R__CLING_PTRCHECK(off) RStagedColumnReader final : public RStagedColumnReaderBase {
+   /// Non-owning reference to the dataset column reader, owned by RLoopManager.
+   ROOT::Detail::RDF::RColumnReaderBase &fReader;
+   std::unique_ptr<T[]> fValues;
+
+   /// Only the bulk values are staged: per-entry accesses go to the value of the current entry.
+   void *GetImpl(Long64_t entry) final { return &fReader.Get<T>(entry); }
+   void *GetBulkImpl(const RMaskedEntryRange &) final { return fValues.get(); }
+
+public:
+   RStagedColumnReader(ROOT::Detail::RDF::RColumnReaderBase &reader, std::size_t bulkSize)
+      : fReader(reader), fValues(new T[bulkSize])
+   {
+   }
+
+   void Stage(std::size_t idx, Long64_t entry) final { fValues[idx] = fReader.Get<T>(entry); }
+};
+
+} // namespace RDF
+} // namespace Internal
+} // namespace ROOT
+
+#endif // ROOT_RDF_RSTAGEDCOLUMNREADER
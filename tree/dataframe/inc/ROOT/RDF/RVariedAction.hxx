@@ -21,6 +21,7 @@
 #include "ROOT/RDF/RSampleInfo.hxx"
 
 #include <Rtypes.h> // R__CLING_PTRCHECK
+#include <ROOT/RVec.hxx>
 #include <ROOT/TypeTraits.hxx>
 
 #include <algorithm>
@@ -46,6 +47,12 @@ class R__CLING_PTRCHECK(off) RVariedAction final : public RActionBase {
    std::vector<Helper> fHelpers; ///< Action helpers per variation.
    /// Owning pointers to upstream nodes for each systematic variation.
    std::vector<std::shared_ptr<PrevNodeType>> fPrevNodes;
+   /// For each variation, the index of the first variation with the same upstream node. Most variations typically
+   /// share the nominal upstream node, whose filters are then checked once per entry rather than once per variation.
+   std::vector<std::size_t> fFirstVarWithPrevNode;
+   /// Per-slot results of the upstream filters for each variation, only filled for the first variation of each
+   /// upstream node.
+   std::vector<ROOT::RVecB> fPassed;
 
    /// Column readers per slot (outer dimension), per variation and per input column (inner dimension, std::array).
    std::vector<std::vector<std::array<RColumnReaderBase *, ColumnTypes_t::list_size>>> fInputValues;
@@ -89,6 +96,13 @@ class R__CLING_PTRCHECK(off) RVariedAction final : public RActionBase {
 
       fLoopManager->Register(this);
 
+      fFirstVarWithPrevNode.resize(fPrevNodes.size());
+      for (auto varIdx = 0u; varIdx < fPrevNodes.size(); ++varIdx) {
+         const auto firstIt = std::find(fPrevNodes.begin(), fPrevNodes.begin() + varIdx, fPrevNodes[varIdx]);
+         fFirstVarWithPrevNode[varIdx] = std::distance(fPrevNodes.begin(), firstIt);
+      }
+      fPassed.assign(GetNSlots(), ROOT::RVecB(fPrevNodes.size()));
+
       for (auto i = 0u; i < columnNames.size(); ++i) {
          auto *define = colRegister.GetDefine(columnNames[i]);
          fIsDefine[i] = define != nullptr;
@@ -150,8 +164,13 @@ public:
 
    void Run(unsigned int slot, Long64_t entry) final
    {
-      for (auto varIdx = 0u; varIdx < GetVariations().size(); ++varIdx) {
-         if (fPrevNodes[varIdx]->CheckFilters(slot, entry))
+      RDFInternal::RProfileScope profileScope(fLoopManager->GetProfiler(), slot, this);
+      auto &passed = fPassed[slot];
+      for (auto varIdx = 0u; varIdx < fPrevNodes.size(); ++varIdx) {
+         const auto firstVarIdx = fFirstVarWithPrevNode[varIdx];
+         if (firstVarIdx == varIdx)
+            passed[varIdx] = fPrevNodes[varIdx]->CheckFilters(slot, entry);
+         if (passed[firstVarIdx])
             CallExec(slot, varIdx, entry, ColumnTypes_t{}, TypeInd_t{});
       }
    }
@@ -198,6 +217,8 @@ public:
       return {};
    }
 
+   std::string GetActionName() final { return fHelpers[0].GetActionName(); }
+
    std::shared_ptr<RDFGraphDrawing::GraphNode>
    GetGraph(std::unordered_map<void *, std::shared_ptr<RDFGraphDrawing::GraphNode>> &visitedMap) final
    {
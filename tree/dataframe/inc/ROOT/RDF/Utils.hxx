@@ -24,6 +24,7 @@
 #include <new> // std::hardware_destructive_interference_size
 #include <string>
 #include <type_traits> // std::decay, std::false_type
+#include <unordered_map>
 #include <vector>
 
 class TTree;
@@ -197,6 +198,27 @@ void InterpreterDeclare(const std::string &code);
 /// The pointer returned by the call to TInterpreter::Calc is returned in case of success.
 Long64_t InterpreterCalc(const std::string &code, const std::string &context = "");
 
+/// Directory of the on-disk cache of jitted code, empty if the cache is disabled.
+/// See ROOT::RDF::Experimental::SetJitCacheDir.
+std::string GetJitCacheDir();
+void SetJitCacheDir(std::string_view dir);
+
+/// Directory of the on-disk cache of filter decisions, empty if the cache is disabled.
+/// See ROOT::RDF::Experimental::SetFilterCacheDir.
+std::string GetFilterCacheDir();
+void SetFilterCacheDir(std::string_view dir);
+
+/// Parameter lists and bodies of the functions declared to the interpreter for the jitted expressions, by function
+/// name, e.g. `R_rdf::func0`. The libraries of the jit cache are compiled outside of the interpreter, so they need
+/// their own copy of the functions they call. Protected by gROOTMutex.
+std::unordered_map<std::string, std::string> &GetJittedFunctions();
+
+/// Run jitted code through a shared library that is compiled with ACLiC and cached in `cacheDir`, keyed by the hash
+/// of the code and of the ROOT build. Processes that jit the same code load the library instead of jitting it again.
+/// Return false, without running any code, if the library cannot be built: callers should then fall back to
+/// InterpreterCalc.
+bool InterpreterCalcCached(const std::string &code, const std::string &cacheDir);
+
 /// Whether custom column with name colName is an "internal" column such as rdfentry_ or rdfslot_
 bool IsInternalColumn(std::string_view colName);
 
@@ -18,10 +18,12 @@
 #include <ROOT/RDF/RResultMap.hxx>
 #include <ROOT/RResultHandle.hxx> // users of RunGraphs might rely on this transitive include
 #include <ROOT/TypeTraits.hxx>
+#include <TList.h> // MergePartialResults
 
 #include <fstream>
 #include <functional>
 #include <memory>
+#include <mutex>
 #include <type_traits>
 #include <utility> // std::index_sequence
 #include <vector>
@@ -61,6 +63,62 @@ auto PassAsVec(F &&f) -> PassAsVecHelper<std::make_index_sequence<N>, T, F>
    return PassAsVecHelper<std::make_index_sequence<N>, T, F>(std::forward<F>(f));
 }
 
+/// The partial results published by the slots of an event loop for a ROOT::RDF::Experimental::RProgressiveResult.
+template <typename T>
+struct RProgressiveState {
+   struct RSlotValue {
+      std::mutex fMutex;
+      std::unique_ptr<T> fValue; ///< Copy of the partial result of the slot, null until the slot first publishes.
+      ULong64_t fNEntries = 0;   ///< Number of entries processed by the slot when fValue was copied.
+   };
+   /// One element per slot. Slots only lock their own element, allocated separately to avoid false sharing.
+   std::vector<std::unique_ptr<RSlotValue>> fSlots;
+   ULong64_t fEveryNEntries;
+   std::function<void(T &, const T &)> fMerge;
+
+   RProgressiveState(unsigned int nSlots, ULong64_t everyNEntries, std::function<void(T &, const T &)> merge)
+      : fEveryNEntries(everyNEntries), fMerge(std::move(merge))
+   {
+      for (auto i = 0u; i < nSlots; ++i)
+         fSlots.emplace_back(std::make_unique<RSlotValue>());
+   }
+
+   /// Called by each slot every fEveryNEntries entries, in the thread that runs the slot.
+   void Publish(unsigned int slot, const T &partialResult)
+   {
+      auto &slotValue = *fSlots[slot];
+      std::lock_guard<std::mutex> lock(slotValue.fMutex);
+      if (slotValue.fValue)
+         *slotValue.fValue = partialResult; // reuse the storage of the previous copy
+      else
+         slotValue.fValue = std::make_unique<T>(partialResult);
+      slotValue.fNEntries += fEveryNEntries;
+   }
+};
+
+// Same as RMergeableFill: merge objects that provide either Merge(TCollection *)...
+template <typename T>
+auto MergePartialResults(T &out, const T &in, int) -> decltype(out.Merge((TCollection *)nullptr), void())
+{
+   TList l;
+   l.Add(const_cast<T *>(&in));
+   out.Merge(&l);
+}
+
+// ...or Merge(const std::vector<T *> &)...
+template <typename T>
+auto MergePartialResults(T &out, const T &in, double) -> decltype(out.Merge(std::vector<T *>{}), void())
+{
+   out.Merge({const_cast<T *>(&in)});
+}
+
+// ...and sum arithmetic values, as RMergeableCount and RMergeableSum do.
+template <typename T, std::enable_if_t<std::is_arithmetic<T>::value, int> = 0>
+void MergePartialResults(T &out, const T &in, int)
+{
+   out += in;
+}
+
 } // namespace RDF
 } // namespace Internal
 
@@ -167,6 +225,11 @@ RNode AsRNode(NodeType node)
 /// computation of all results is generally more efficient.
 /// It should be noted that user-defined operations (e.g., Filters and Defines) of the different RDataFrame graphs are assumed to be safe to call concurrently.
 ///
+/// Computation graphs that process the same entries of the same dataset, e.g. RDataFrames constructed from the same
+/// tree name and files or from the same number of empty entries, share a single event loop: the data is read and
+/// decompressed once and every entry is then processed by all the graphs of the group. Graphs that read from an
+/// RDataSource, that contain a Range or that process trees with friends or entry lists always run their own event loop.
+///
 /// ~~~{.cpp}
 /// ROOT::RDataFrame df1("tree1", "file1.root");
 /// auto r1 = df1.Histo1D("var1");
@@ -252,6 +315,236 @@ RResultMap<T> VariationsFor(RResultPtr<T> resPtr)
 using SnapshotPtr_t = ROOT::RDF::RResultPtr<ROOT::RDF::RInterface<ROOT::Detail::RDF::RLoopManager, void>>;
 SnapshotPtr_t VariationsFor(SnapshotPtr_t resPtr);
 
+/**
+\class ROOT::RDF::Experimental::RProgressiveResult
+\ingroup dataframe
+\brief A merged snapshot of the partial results of an action, that can be retrieved while the event loop runs.
+
+Created by MakeProgressiveResult(). Every slot copies its own partial result every N entries; Get() merges the last
+copy of each slot. Each copy is a complete state of the slot's result, so the snapshot is always consistent, but it
+lags behind the event loop by up to N entries per slot. The event loop never waits for Get() for longer than the
+merge of one slot's copy, and only when it publishes a new copy.
+**/
+template <typename T>
+class RProgressiveResult {
+   std::shared_ptr<RDFInternal::RProgressiveState<T>> fState;
+   ULong64_t fNEntries = 0;
+
+public:
+   explicit RProgressiveResult(std::shared_ptr<RDFInternal::RProgressiveState<T>> state) : fState(std::move(state)) {}
+
+   /// \brief Merge the partial results published so far by the slots of the event loop.
+   /// \return The merged result, or a null pointer if no slot published a partial result yet.
+   ///
+   /// Get() can be called from any thread, but not concurrently on the same RProgressiveResult. After the event loop,
+   /// it returns the partial results of the last publication of every slot: only the RResultPtr holds the full result.
+   std::unique_ptr<T> Get()
+   {
+      std::unique_ptr<T> merged;
+      ULong64_t nEntries = 0;
+      for (auto &slotValue : fState->fSlots) {
+         std::lock_guard<std::mutex> lock(slotValue->fMutex);
+         if (!slotValue->fValue)
+            continue;
+         if (merged)
+            fState->fMerge(*merged, *slotValue->fValue);
+         else
+            merged = std::make_unique<T>(*slotValue->fValue);
+         nEntries += slotValue->fNEntries;
+      }
+      fNEntries = nEntries;
+      return merged;
+   }
+
+   /// Number of entries processed by the event loop at the time of the partial results merged by the last Get().
+   ULong64_t GetNEntries() const { return fNEntries; }
+};
+
+/// \brief Make the partial results of an action available, merged, while the event loop runs.
+/// \param[in] resPtr The result to monitor. Its action must support callbacks, see RResultPtr::OnPartialResult().
+/// \param[in] everyNEntries How often each slot publishes its partial result, in entries processed by the slot.
+/// \param[in] merge A callable `void(T &out, const T &in)` that adds the partial result `in` to `out`.
+/// \return An RProgressiveResult that merges the published partial results on demand.
+///
+/// Worker threads only copy their own partial result every `everyNEntries` entries; merging happens in the thread
+/// that calls RProgressiveResult::Get(), e.g. a monitoring thread or a timer that updates a histogram served by
+/// THttpServer. Must be called before the event loop runs.
+///
+/// ~~~{.cpp}
+/// auto h = df.Histo1D("x");
+/// auto progressive = ROOT::RDF::Experimental::MakeProgressiveResult(h, 100000);
+/// std::thread monitor([&] {
+///    while (!h.IsReady()) {
+///       if (auto snapshot = progressive.Get())
+///          std::cout << progressive.GetNEntries() << " entries, mean " << snapshot->GetMean() << '\n';
+///       std::this_thread::sleep_for(std::chrono::seconds(1));
+///    }
+/// });
+/// h->Draw(); // runs the event loop
+/// monitor.join();
+/// ~~~
+template <typename T, typename F>
+RProgressiveResult<T> MakeProgressiveResult(RResultPtr<T> resPtr, ULong64_t everyNEntries, F &&merge)
+{
+   R__ASSERT(resPtr != nullptr && "Calling MakeProgressiveResult on an empty RResultPtr");
+   if (everyNEntries == 0)
+      throw std::invalid_argument("MakeProgressiveResult: the number of entries between updates must be positive.");
+
+   auto state = std::make_shared<RDFInternal::RProgressiveState<T>>(resPtr.fLoopManager->GetNSlots(), everyNEntries,
+                                                                     std::forward<F>(merge));
+   resPtr.OnPartialResultSlot(everyNEntries,
+                              [state](unsigned int slot, T &partialResult) { state->Publish(slot, partialResult); });
+   return RProgressiveResult<T>(std::move(state));
+}
+
+/// \brief Make the partial results of an action available, merged, while the event loop runs.
+///
+/// This overload merges histograms and other objects with a `Merge` method, like RDataFrame does for distributed
+/// execution, and sums arithmetic results, e.g. those of Count and Sum. Results that cannot be merged by summing
+/// them, e.g. Min, Max and Mean, require the overload that takes a merge function.
+template <typename T>
+RProgressiveResult<T> MakeProgressiveResult(RResultPtr<T> resPtr, ULong64_t everyNEntries)
+{
+   return MakeProgressiveResult(std::move(resPtr), everyNEntries, [](T &out, const T &in) {
+      RDFInternal::MergePartialResults(out, in, /*toselecttherightoverload=*/0);
+   });
+}
+
+/// \brief Process the entries of the dataset in blocks in the next event loops of the computation graph.
+/// \param[in] node Any node of the computation graph.
+/// \param[in] bulkSize The number of entries per block. Zero switches back to entry-by-entry processing.
+///
+/// In bulk mode, the event loop collects blocks of entries and then runs the computation graph once per block:
+/// filters produce a mask of the entries that pass them, defined columns are evaluated for all the entries of the
+/// mask and actions receive the values of the whole block. Actions with a bulk kernel (currently Sum, and Histo1D
+/// with scalar inputs) process the block in a tight loop; the others call their per-entry method for each entry
+/// that passes the filters. The values of TTree and data source columns are copied into per-block buffers while
+/// the entries are read.
+///
+/// Bulk processing is a pure optimization: results are the same as with entry-by-entry processing. Callbacks
+/// registered with RResultPtr::OnPartialResult() are invoked at the end of each block.
+/// The event loop falls back to entry-by-entry processing, with a warning, if the computation graph contains Range,
+/// Vary or Snapshot calls, or columns of types that are not default-constructible and copy-assignable.
+///
+/// ~~~{.cpp}
+/// ROOT::RDataFrame df("tree", "file.root");
+/// ROOT::RDF::Experimental::EnableBulkProcessing(df);
+/// auto h = df.Filter("x > 0").Histo1D({"h", "h", 100, 0., 10.}, "x");
+/// ~~~
+void EnableBulkProcessing(ROOT::RDF::RNode node, unsigned int bulkSize = 256);
+
+/// \brief Measure the time spent in the nodes of the computation graph in the next event loops.
+/// \param[in] node Any node of the computation graph.
+/// \param[in] samplingPeriod One entry every `samplingPeriod` entries of each slot is timed.
+///
+/// The profile of the last event loop reports, for each Filter, Define, action and dataset column, the time spent
+/// evaluating it, excluding the time spent in the nodes it requested values from: the time of a Define does not
+/// include the time needed to read its input columns, which is reported as the time of the "Read" node of each column
+/// and covers reading and decompressing the data. Times are given in total and per slot, together with the time spent
+/// jitting the computation graph and the duration of the event loop. Only sampled entries are timed, which keeps the
+/// overhead low; the reported node times are extrapolated to all entries.
+/// Profiling disables bulk processing. The profile is available through GetProfileJSON() and
+/// GetProfileFoldedStacks().
+///
+/// ~~~{.cpp}
+/// ROOT::RDataFrame df("tree", "file.root");
+/// ROOT::RDF::Experimental::EnableProfiling(df);
+/// auto h = df.Define("y", "x * x").Filter("y > 4").Histo1D("y");
+/// h->Draw();
+/// std::cout << ROOT::RDF::Experimental::GetProfileJSON(df) << '\n';
+/// ~~~
+void EnableProfiling(ROOT::RDF::RNode node, unsigned int samplingPeriod = 16);
+
+/// \brief Return the profile of the last event loop of the computation graph as a JSON object.
+/// \param[in] node Any node of the computation graph.
+///
+/// The object contains the sampling period, the jitting time and the real and CPU time of the event loop, a "slots"
+/// array with the number of entries and sampled entries processed by each slot, and a "nodes" array with, for every
+/// node, its kind ("Filter", "Define", "Action" or "Read"), its name, the number of calls on sampled entries, the time
+/// spent in it and the same time per slot. Times are in seconds.
+/// Throws if profiling was not enabled with EnableProfiling().
+std::string GetProfileJSON(ROOT::RDF::RNode node);
+
+/// \brief Return the profile of the last event loop of the computation graph in the folded stacks format.
+/// \param[in] node Any node of the computation graph.
+///
+/// Each line contains a call stack, e.g. `Action Histo1D;Filter;Define y;Read x`, followed by the time in
+/// nanoseconds measured on the sampled entries for the innermost node of that stack. This is the input format of
+/// flame graph tools such as `flamegraph.pl`.
+/// Throws if profiling was not enabled with EnableProfiling().
+std::string GetProfileFoldedStacks(ROOT::RDF::RNode node);
+
+/// \brief Cache the code that RDataFrame compiles just-in-time in a directory, to share it across processes.
+/// \param[in] dir The cache directory, created if needed. An empty string disables the cache.
+///
+/// RDataFrame compiles the code for string expressions (e.g. in Filter and Define calls) and for actions that are not
+/// fully typed right before the event loop. With the cache enabled, that code, together with the expressions it
+/// depends on, is compiled with ACLiC into a shared library that is stored in `dir` with a name derived from the hash
+/// of the code and of the ROOT build. Later processes that book the same computation graph load the library instead
+/// of compiling the code again. This is useful when many identical jobs run over different inputs.
+///
+/// The default cache directory is taken from the `ROOT_RDF_JIT_CACHE_DIR` environment variable, so existing
+/// applications can use the cache without changes.
+/// If the library cannot be built, e.g. because the expressions use functions or types that are only known to the
+/// interpreter, RDataFrame falls back to regular just-in-time compilation, and does not retry building that library
+/// for an hour. The cache is best populated by running one job before starting many of them in parallel.
+///
+/// ~~~{.cpp}
+/// ROOT::RDF::Experimental::SetJitCacheDir("/scratch/rdfjitcache");
+/// ROOT::RDataFrame df("tree", "file.root");
+/// auto h = df.Define("y", "x * x").Filter("y > 4").Histo1D("y");
+/// ~~~
+void SetJitCacheDir(std::string_view dir);
+
+/// \brief Cache the decisions of named Filters in a directory, to skip their evaluation in later event loops.
+/// \param[in] dir The cache directory, created if needed. An empty string disables the cache.
+///
+/// With the cache enabled, every named Filter of an event loop over TTrees or TChains records, for every entry of
+/// every input file, whether it accepted or rejected the entry. Later event loops, in the same or in other processes,
+/// take the recorded decision instead of evaluating the filter again. As the column values are read lazily, the
+/// inputs of the filter are then not read either. This is useful when the same expensive selection is run many times
+/// over the same inputs, with only the downstream actions changing.
+///
+/// The decisions are keyed by the filter name, the filter expression for filters defined by a string, the UUID of
+/// the input file and the tree name. Filters defined by a C++ callable must thus be renamed when their logic changes.
+/// Unnamed filters, filters in systematic variations and event loops in bulk mode are not cached. The cut-flow
+/// report is unaffected.
+///
+/// The default cache directory is taken from the `ROOT_RDF_FILTER_CACHE_DIR` environment variable.
+///
+/// ~~~{.cpp}
+/// ROOT::RDF::Experimental::SetFilterCacheDir("/scratch/rdffiltercache");
+/// ROOT::RDataFrame df("tree", "file.root");
+/// auto h = df.Filter("ExpensiveSelection(x, y)", "selection").Histo1D("x");
+/// ~~~
+void SetFilterCacheDir(std::string_view dir);
+
+/// \brief Return the source of a standalone C++ program that runs the computation graph without jitting.
+/// \param[in] node Any node of the computation graph. The program runs the entire graph.
+/// \param[in] includes Headers to include in the program, e.g. those that declare the functions and types used in
+/// the string expressions. Names in angle brackets are included as such, the others in quotes.
+///
+/// RDataFrame compiles string expressions and actions with inferred column types just in time, in every process
+/// that runs the computation graph. The program returned by this function books the same graph through the fully
+/// typed RDataFrame interface instead: every string expression becomes a lambda with the parameter types that
+/// jitting inferred, and every action gets the column types as template parameters. Compiled once, e.g. with
+/// `g++ -O3 -march=native analysis.cxx $(root-config --cflags --libs)`, it runs on the grid without
+/// the interpreter. The program takes the name of the output file as optional argument, writes the histograms to
+/// it and prints the other results on the standard output.
+///
+/// Supported are: TTrees, TChains and empty sources as input; Filter, Define and Redefine with string expressions;
+/// Alias and Range; Count; and Histo1D, Histo2D, Min, Max, Sum, Mean and StdDev with inferred column types. As for
+/// the typed Sum, sums are accumulated in the type of the column. The function throws if the graph contains other
+/// operations, e.g. Defines with C++ callables, Vary calls or Snapshots. It jits the computation graph, like
+/// SaveGraph().
+///
+/// ~~~{.cpp}
+/// ROOT::RDataFrame df("tree", "file.root");
+/// auto h = df.Define("y", "x * x").Filter("y > 4", "cut").Histo1D({"h", "h", 64, 0., 16.}, "y");
+/// std::ofstream("analysis.cxx") << ROOT::RDF::Experimental::GenerateStandaloneSource(df);
+/// ~~~
+std::string GenerateStandaloneSource(ROOT::RDF::RNode node, const std::vector<std::string> &includes = {});
+
 } // namespace Experimental
 } // namespace RDF
 } // namespace ROOT
@@ -55,6 +55,18 @@ class RNTupleDS final : public ROOT::RDF::RDataSource {
    std::vector<std::string> fColumnTypes;
    std::vector<size_t> fActiveColumns;
 
+   /// Cluster-aligned entry ranges, sorted by their first entry. Every range is handed out to exactly one slot,
+   /// so that every cluster is read and unzipped only once across the page source clones.
+   std::vector<std::pair<ULong64_t, ULong64_t>> fClusterRanges;
+   /// Value cuts on the physical column of a field, checked against the cluster column statistics
+   struct RClusterRangeFilter {
+      DescriptorId_t fPhysicalColumnId;
+      double fMin;
+      double fMax;
+   };
+   /// Clusters that cannot pass all of these filters are not handed out to RDataFrame
+   std::vector<RClusterRangeFilter> fClusterRangeFilters;
+
    unsigned fNSlots = 0;
    bool fHasSeenAllRanges = false;
 
@@ -79,10 +91,16 @@ public:
    bool HasColumn(std::string_view colName) const final;
    std::string GetTypeName(std::string_view colName) const final;
    std::vector<std::pair<ULong64_t, ULong64_t>> GetEntryRanges() final;
+   /// Skip the clusters whose column statistics show that no value of the given field lies within [min, max].
+   /// This is an I/O optimization only: the surviving clusters still contain non-matching entries, so the same cut
+   /// needs to be applied with RDataFrame::Filter(). Throws if the field does not exist or has no columns.
+   void AddClusterRangeFilter(std::string_view fieldName, double min, double max);
    std::string GetLabel() final { return "RNTupleDS"; }
 
    bool SetEntry(unsigned int slot, ULong64_t entry) final;
 
+   void InitSlot(unsigned int slot, ULong64_t firstEntry) final;
+   void FinalizeSlot(unsigned int slot) final;
    void Initialize() final;
    void Finalize() final;
 
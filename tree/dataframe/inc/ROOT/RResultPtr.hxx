@@ -32,6 +32,12 @@ class RResultMap;
 
 template <typename T>
 RResultMap<T> VariationsFor(RResultPtr<T> resPtr);
+
+template <typename T>
+class RProgressiveResult;
+
+template <typename T, typename F>
+RProgressiveResult<T> MakeProgressiveResult(RResultPtr<T> resPtr, ULong64_t everyNEntries, F &&merge);
 } // namespace Experimental
 
 template <typename Proxied, typename DataSource>
@@ -131,6 +137,10 @@ class RResultPtr {
    template <typename T1>
    friend ROOT::RDF::Experimental::RResultMap<T1> ROOT::RDF::Experimental::VariationsFor(RResultPtr<T1> resPtr);
 
+   template <typename T1, typename F>
+   friend ROOT::RDF::Experimental::RProgressiveResult<T1>
+   ROOT::RDF::Experimental::MakeProgressiveResult(RResultPtr<T1> resPtr, ULong64_t everyNEntries, F &&merge);
+
    template <class T1, class T2>
    friend bool operator==(const RResultPtr<T1> &lhs, const RResultPtr<T2> &rhs);
    template <class T1, class T2>
@@ -47,6 +47,9 @@ is used:
   - For expressions ("SELECT 1+1 FROM table"), the type of the first row of the result set determines the column type.
     That can result in a column to be of thought of type NULL where subsequent rows actually have meaningful values.
     The provided SELECT query can be used to avoid such ambiguities.
+
+The rows of the result set are stepped through sequentially, in batches of kBatchSizePerSlot rows per slot. With
+implicit multi-threading, the rows of a batch are then processed by the slots in parallel.
 */
 class RSqliteDS final : public ROOT::RDF::RDataSource {
 private:
@@ -61,28 +64,33 @@ private:
    };
    // clang-format on
 
-   /// Used to hold a single "cell" of the SELECT query's result table. Can be changed to std::variant once available.
+   /// Used to hold the "cells" of a column of the SELECT query's result table for the rows of the current batch.
+   /// Only the vector corresponding to fType is used.
    struct Value_t {
       explicit Value_t(ETypes type);
 
       ETypes fType;
       bool fIsActive; ///< Not all columns of the query are necessarily used by the RDF. Allows for skipping them.
-      Long64_t fInteger;
-      double fReal;
-      std::string fText;
-      std::vector<unsigned char> fBlob;
+      std::vector<Long64_t> fIntegers;
+      std::vector<double> fReals;
+      std::vector<std::string> fTexts;
+      std::vector<std::vector<unsigned char>> fBlobs;
       void *fNull;
-      void *fPtr; ///< Points to one of the values; an address to this pointer is returned by GetColumnReadersImpl.
+      /// Per slot, points to the value of the current entry; addresses to these pointers are returned by
+      /// GetColumnReadersImpl.
+      std::vector<void *> fPtrs;
    };
 
    void SqliteError(int errcode);
 
    std::unique_ptr<Internal::RSqliteDSDataSet> fDataSet;
    unsigned int fNSlots;
-   ULong64_t fNRow;
+   ULong64_t fNRow;       ///< Number of rows stepped through so far
+   ULong64_t fBatchFirst; ///< Entry number of the first row of the current batch
+   bool fIsDone;          ///< Whether the end of the result set was reached
    std::vector<std::string> fColumnNames;
    std::vector<ETypes> fColumnTypes;
-   /// The data source is inherently single-threaded and returns only one row at a time. This vector holds the results.
+   /// The values of the rows of the current batch, one element per column
    std::vector<Value_t> fValues;
 
    // clang-format off
@@ -97,6 +105,9 @@ private:
    // clang-format on
 
 public:
+   /// The number of rows read at once by GetEntryRanges(), per slot
+   static constexpr unsigned int kBatchSizePerSlot = 1024;
+
    RSqliteDS(const std::string &fileName, const std::string &query);
    ~RSqliteDS();
    void SetNSlots(unsigned int nSlots) final;
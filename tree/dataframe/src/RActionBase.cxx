@@ -11,6 +11,7 @@
 #include "ROOT/RDF/RActionBase.hxx"
 #include "ROOT/RDF/RLoopManager.hxx"
 #include "ROOT/RDF/Utils.hxx"
+#include "TError.h" // R__ASSERT
 
 using namespace ROOT::Internal::RDF;
 
@@ -23,3 +24,9 @@ RActionBase::RActionBase(RLoopManager *lm, const ColumnNames_t &colNames, const
 
 // outlined to pin virtual table
 RActionBase::~RActionBase() = default;
+
+void RActionBase::RunBulk(unsigned int, const RMaskedEntryRange &)
+{
+   R__ASSERT(false &&
+             "RunBulk was called on an action that does not support bulk processing. This should never happen.");
+}
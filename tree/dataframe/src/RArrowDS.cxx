@@ -20,8 +20,15 @@ A RDataFrame that adapts an arrow::Table class can be constructed using the fact
 ROOT::RDF::FromArrow, which accepts one parameter:
 1. An arrow::Table smart pointer.
 
+Files in the Arrow IPC (a.k.a. Feather v2) format can be read with ROOT::RDF::FromArrowIPC. The file is memory-mapped
+and its record batches are used in place, without copies.
+
 The types of the columns are derived from the types in the associated
-arrow::Schema.
+arrow::Schema. Columns of primitive types are read in place, and list columns are exposed as RVecs that
+view the Arrow buffers.
+
+When the table is made of at least as many chunks (e.g. the record batches of an IPC file) as there are processing
+slots, every chunk is processed as a separate entry range, so that each task reads whole chunks.
 
 */
 // clang-format on
@@ -41,6 +48,8 @@ arrow::Schema.
 #pragma GCC diagnostic ignored "-Wshadow"
 #pragma GCC diagnostic ignored "-Wunused-parameter"
 #endif
+#include <arrow/io/file.h>
+#include <arrow/ipc/reader.h>
 #include <arrow/table.h>
 #include <arrow/stl.h>
 #if defined(__GNUC__)
@@ -200,6 +209,20 @@ public:
    using ::arrow::ArrayVisitor::Visit;
 };
 
+/// Size of the values of the fixed-width types that ArrayPtrVisitor reads in place, zero for the other types.
+std::size_t getFixedValueSize(const arrow::DataType &type)
+{
+   switch (type.id()) {
+   case arrow::Type::INT32:
+   case arrow::Type::UINT32:
+   case arrow::Type::FLOAT: return 4;
+   case arrow::Type::INT64:
+   case arrow::Type::UINT64:
+   case arrow::Type::DOUBLE: return 8;
+   default: return 0;
+   }
+}
+
 /// Helper class which keeps track for each slot where to get the entry.
 class TValueGetter {
 private:
@@ -208,6 +231,10 @@ private:
    std::vector<ULong64_t> fLastChunkPerSlot;
    std::vector<ULong64_t> fFirstEntryPerChunk;
    std::vector<ArrayPtrVisitor> fArrayVisitorPerSlot;
+   /// For columns of fixed-width types, the values of the chunk each slot is reading: moving to another entry of the
+   /// same chunk is then a pointer increment instead of a visit of the array.
+   std::vector<unsigned char *> fChunkValuesPerSlot;
+   std::size_t fValueSize = 0;
    /// Since data can be chunked in different arrays we need to construct an
    /// index which contains the first element of each chunk, so that we can
    /// quickly move to the correct chunk.
@@ -216,8 +243,14 @@ private:
 
 public:
    TValueGetter(size_t slots, arrow::ArrayVector chunks)
-      : fValuesPtrPerSlot(slots, nullptr), fLastEntryPerSlot(slots, 0), fLastChunkPerSlot(slots, 0), fChunks{chunks}
+      : fValuesPtrPerSlot(slots, nullptr),
+        fLastEntryPerSlot(slots, 0),
+        fLastChunkPerSlot(slots, 0),
+        fChunkValuesPerSlot(slots, nullptr),
+        fChunks{chunks}
    {
+      if (!fChunks.empty())
+         fValueSize = getFixedValueSize(*fChunks.front()->type());
       fChunkIndex.reserve(fChunks.size());
       size_t next = 0;
       for (auto &chunk : chunks) {
@@ -273,6 +306,12 @@ public:
          msg += std::to_string(slot) + " looking at entry " + std::to_string(entry);
          throw std::runtime_error(msg);
       }
+
+      const auto &buffers = chunk->data()->buffers;
+      if (fValueSize > 0 && buffers.size() > 1 && buffers[1])
+         fChunkValuesPerSlot[slot] = const_cast<unsigned char *>(buffers[1]->data()) + chunk->offset() * fValueSize;
+      else
+         fChunkValuesPerSlot[slot] = nullptr;
    }
 
    /// Set the current entry to be retrieved
@@ -282,6 +321,12 @@ public:
       if (fLastEntryPerSlot[slot] == entry) {
          return;
       }
+      const auto chunk = fLastChunkPerSlot[slot];
+      if (fChunkValuesPerSlot[slot] != nullptr && entry >= fFirstEntryPerChunk[chunk] && entry < fChunkIndex[chunk]) {
+         fValuesPtrPerSlot[slot] = fChunkValuesPerSlot[slot] + (entry - fFirstEntryPerChunk[chunk]) * fValueSize;
+         fLastEntryPerSlot[slot] = entry;
+         return;
+      }
       UncachedSlotLookup(slot, entry);
    }
 };
@@ -586,10 +631,27 @@ std::vector<void *> RArrowDS::GetColumnReadersImpl(std::string_view colName, con
    return fValueGetters[getterIdx]->SlotPtrs();
 }
 
+/// Add one entry range per non-empty chunk of the column.
+void splitAtChunkBoundaries(std::vector<std::pair<ULong64_t, ULong64_t>> &ranges, const arrow::ChunkedArray &column)
+{
+   ranges.clear();
+   ULong64_t start = 0;
+   for (const auto &chunk : column.chunks()) {
+      const ULong64_t end = start + chunk->length();
+      if (end > start)
+         ranges.emplace_back(start, end);
+      start = end;
+   }
+}
+
 void RArrowDS::Initialize()
 {
    auto nRecords = getNRecords(fTable, fColumnNames);
-   splitInEqualRanges(fEntryRanges, nRecords, fNSlots);
+   auto chunkedArray = getData(fTable->column(fTable->schema()->GetFieldIndex(fColumnNames.front())));
+   if (chunkedArray->num_chunks() >= static_cast<int>(fNSlots))
+      splitAtChunkBoundaries(fEntryRanges, *chunkedArray);
+   else
+      splitInEqualRanges(fEntryRanges, nRecords, fNSlots);
 }
 
 std::string RArrowDS::GetLabel()
@@ -609,6 +671,39 @@ RDataFrame FromArrow(std::shared_ptr<arrow::Table> table, std::vector<std::strin
    return tdf;
 }
 
+/// \brief Factory method to create a RDataFrame that reads a file in the Arrow IPC format.
+///
+/// The file is memory-mapped: the record batches are not copied into memory, their data is read from the file
+/// when it is accessed. Each record batch is processed as one entry range, if there are at least as many record
+/// batches as processing slots.
+/// \param[in] fileName the path of the Arrow IPC file
+/// \param[in] columnNames the name of the columns to use
+/// In case columnNames is empty, we use all the columns found in the file
+RDataFrame FromArrowIPC(std::string_view fileName, std::vector<std::string> const &columnNames)
+{
+   const std::string fileNameStr(fileName);
+   auto throwOnError = [&fileNameStr](const arrow::Status &status) {
+      if (!status.ok())
+         throw std::runtime_error("Cannot read Arrow IPC file " + fileNameStr + ": " + status.ToString());
+   };
+
+   auto file = arrow::io::MemoryMappedFile::Open(fileNameStr, arrow::io::FileMode::READ);
+   throwOnError(file.status());
+   auto reader = arrow::ipc::RecordBatchFileReader::Open(*file);
+   throwOnError(reader.status());
+
+   std::vector<std::shared_ptr<arrow::RecordBatch>> batches;
+   for (int i = 0; i < (*reader)->num_record_batches(); ++i) {
+      auto batch = (*reader)->ReadRecordBatch(i);
+      throwOnError(batch.status());
+      batches.emplace_back(*batch);
+   }
+   auto table = arrow::Table::FromRecordBatches((*reader)->schema(), batches);
+   throwOnError(table.status());
+
+   return FromArrow(*table, columnNames);
+}
+
 } // namespace RDF
 
 } // namespace ROOT
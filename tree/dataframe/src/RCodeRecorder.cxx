@@ -0,0 +1,356 @@
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include "ROOT/RDF/RCodeRecorder.hxx"
+#include "ROOT/RDF/RColumnRegister.hxx"
+#include "ROOT/RDF/RLoopManager.hxx"
+#include "ROOT/RDF/Utils.hxx" // IsInternalColumn
+#include "ROOT/InternalTreeUtils.hxx"
+#include "TAxis.h"
+#include "TH1D.h"
+#include "TH2D.h"
+#include "TTree.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <unordered_map>
+#include <utility>
+
+namespace {
+
+/// Return the C++ string literal for the given string
+std::string Quote(const std::string &str)
+{
+   std::string result = "\"";
+   for (char c : str) {
+      switch (c) {
+      case '"': result += "\\\""; break;
+      case '\\': result += "\\\\"; break;
+      case '\n': result += "\\n"; break;
+      case '\t': result += "\\t"; break;
+      default: result += c;
+      }
+   }
+   return result + '"';
+}
+
+std::string QuoteList(const std::vector<std::string> &strs)
+{
+   std::string result = "{";
+   for (const auto &str : strs)
+      result += (result.size() > 1 ? ", " : "") + Quote(str);
+   return result + '}';
+}
+
+std::string FormatDouble(double value)
+{
+   char buffer[32];
+   snprintf(buffer, sizeof(buffer), "%.17g", value);
+   std::string result = buffer;
+   // keep the literal a double, e.g. "0." rather than "0"
+   if (result.find_first_of(".eEn") == std::string::npos)
+      result += '.';
+   return result;
+}
+
+/// The binning arguments of a histogram model for the given axis: either the number of bins and the limits or the
+/// number of bins and the bin edges.
+std::string AxisArgs(const TAxis &axis)
+{
+   const auto nBins = axis.GetNbins();
+   if (axis.GetXbins()->GetSize() == 0)
+      return std::to_string(nBins) + ", " + FormatDouble(axis.GetXmin()) + ", " + FormatDouble(axis.GetXmax());
+   std::string edges;
+   for (int i = 0; i <= nBins; ++i)
+      edges += (i > 0 ? ", " : "") + FormatDouble(axis.GetXbins()->At(i));
+   return std::to_string(nBins) + ", std::vector<double>{" + edges + "}.data()";
+}
+
+std::string TemplateArgs(const std::vector<std::string> &types)
+{
+   std::string result = "<";
+   for (const auto &type : types)
+      result += (result.size() > 1 ? ", " : "") + type;
+   return result + '>';
+}
+
+std::string ColumnArgs(const std::vector<std::string> &columns)
+{
+   std::string result;
+   for (const auto &column : columns)
+      result += ", " + Quote(column);
+   return result;
+}
+
+std::string JoinUnique(std::vector<std::string> strs)
+{
+   std::sort(strs.begin(), strs.end());
+   strs.erase(std::unique(strs.begin(), strs.end()), strs.end());
+   std::string result;
+   for (const auto &str : strs)
+      result += (result.empty() ? "" : ", ") + str;
+   return result;
+}
+
+/// The declaration of the RDataFrame that reads the same dataset as the given loop manager
+std::string MakeDataFrameDeclaration(ROOT::Detail::RDF::RLoopManager &lm)
+{
+   if (lm.GetDataSource())
+      throw std::runtime_error("GenerateStandaloneSource: computation graphs that read from an RDataSource are not "
+                               "supported, only TTrees, TChains and empty sources are.");
+
+   auto *tree = lm.GetTree();
+   if (!tree)
+      return "   ROOT::RDataFrame df(ULong64_t{" + std::to_string(lm.GetNEmptyEntries()) + "});\n";
+
+   if (!ROOT::Internal::TreeUtils::GetFriendInfo(*tree).fFriendNames.empty())
+      throw std::runtime_error("GenerateStandaloneSource: input trees with friends are not supported.");
+   const auto fileNames = ROOT::Internal::TreeUtils::GetFileNamesFromTree(*tree);
+   if (fileNames.empty())
+      throw std::runtime_error("GenerateStandaloneSource: the input tree is not stored in a file.");
+   const auto treePaths = ROOT::Internal::TreeUtils::GetTreeFullPaths(*tree);
+
+   if (std::all_of(treePaths.begin(), treePaths.end(), [&](const std::string &p) { return p == treePaths[0]; }))
+      return "   ROOT::RDataFrame df(" + Quote(treePaths[0]) + ", std::vector<std::string>" + QuoteList(fileNames) +
+             ");\n";
+
+   // The trees have different names in different files
+   std::string code = "   TChain chain;\n";
+   for (std::size_t i = 0; i < fileNames.size(); ++i)
+      code += "   chain.Add(" + Quote(fileNames[i] + "?#" + treePaths[i]) + ");\n";
+   return code + "   ROOT::RDataFrame df(chain);\n";
+}
+
+} // anonymous namespace
+
+namespace ROOT {
+namespace Internal {
+namespace RDF {
+
+/// Identify a state of the computation graph by the node and by the defines and aliases visible at that node.
+/// The internal columns, e.g. rdfentry_, are the same for all the states of a graph and do not enter the key.
+std::string RCodeRecorder::GetStateKey(const ROOT::Detail::RDF::RNodeBase *node, const RColumnRegister &colRegister)
+{
+   std::string key = std::to_string(reinterpret_cast<std::uintptr_t>(node));
+   for (const auto &name : colRegister.GetNames()) {
+      if (IsInternalColumn(name))
+         continue;
+      key += ' ' + name + '=';
+      if (const auto *define = colRegister.GetDefine(name))
+         key += std::to_string(reinterpret_cast<std::uintptr_t>(define));
+      else
+         key += colRegister.ResolveAlias(name);
+   }
+   return key;
+}
+
+void RCodeRecorder::AddTransformation(std::string input, std::string output, std::string code)
+{
+   RStatement statement;
+   statement.fInput = std::move(input);
+   statement.fOutput = std::move(output);
+   statement.fCode = std::move(code);
+   fStatements.emplace_back(std::move(statement));
+}
+
+void RCodeRecorder::AddFilter(std::string input, std::string output, const std::string &function,
+                              const std::vector<std::string> &columns, const std::string &name)
+{
+   AddTransformation(std::move(input), std::move(output),
+                     ".Filter([]" + function + ", " + QuoteList(columns) + (name.empty() ? "" : ", " + Quote(name)) +
+                        ")");
+}
+
+void RCodeRecorder::AddDefine(std::string input, std::string output, bool isRedefine, const std::string &name,
+                              const std::string &function, const std::vector<std::string> &columns)
+{
+   AddTransformation(std::move(input), std::move(output),
+                     std::string(isRedefine ? ".Redefine(" : ".Define(") + Quote(name) + ", []" + function + ", " +
+                        QuoteList(columns) + ")");
+}
+
+void RCodeRecorder::AddAlias(std::string input, std::string output, const std::string &alias,
+                             const std::string &column)
+{
+   AddTransformation(std::move(input), std::move(output), ".Alias(" + Quote(alias) + ", " + Quote(column) + ")");
+}
+
+void RCodeRecorder::AddRange(std::string input, std::string output, unsigned int begin, unsigned int end,
+                             unsigned int stride)
+{
+   AddTransformation(std::move(input), std::move(output),
+                     ".Range(" + std::to_string(begin) + ", " + std::to_string(end) + ", " + std::to_string(stride) +
+                        ")");
+}
+
+void RCodeRecorder::AddCount(std::string input, std::weak_ptr<RActionBase> action)
+{
+   RStatement statement;
+   statement.fInput = std::move(input);
+   statement.fCode = ".Count()";
+   statement.fIsAction = true;
+   statement.fAction = std::move(action);
+   statement.fResultName = "Count";
+   fStatements.emplace_back(std::move(statement));
+}
+
+void RCodeRecorder::AddJittedAction(std::string input, std::weak_ptr<RActionBase> action,
+                                    const std::string &actionName,
+                                    const std::type_info &helperArgType, void *helperArgOnHeap,
+                                    const std::vector<std::string> &columns,
+                                    const std::vector<std::string> &columnTypes)
+{
+   RStatement statement;
+   statement.fInput = std::move(input);
+   statement.fIsAction = true;
+   statement.fAction = std::move(action);
+   const auto templateArgs = TemplateArgs(columnTypes);
+
+   if (actionName == "Histo1D" && helperArgType == typeid(::TH1D)) {
+      const auto &h = **static_cast<std::shared_ptr<::TH1D> *>(helperArgOnHeap);
+      statement.fCode = ".Histo1D" + templateArgs + "(ROOT::RDF::TH1DModel(" + Quote(h.GetName()) + ", " +
+                        Quote(h.GetTitle()) + ", " + AxisArgs(*h.GetXaxis()) + ")" + ColumnArgs(columns) + ")";
+      statement.fResultKind = EResultKind::kObject;
+      statement.fResultName = h.GetName();
+   } else if (actionName == "Histo2D" && helperArgType == typeid(::TH2D)) {
+      const auto &h = **static_cast<std::shared_ptr<::TH2D> *>(helperArgOnHeap);
+      statement.fCode = ".Histo2D" + templateArgs + "(ROOT::RDF::TH2DModel(" + Quote(h.GetName()) + ", " +
+                        Quote(h.GetTitle()) + ", " + AxisArgs(*h.GetXaxis()) + ", " + AxisArgs(*h.GetYaxis()) + ")" +
+                        ColumnArgs(columns) + ")";
+      statement.fResultKind = EResultKind::kObject;
+      statement.fResultName = h.GetName();
+   } else if ((actionName == "Min" || actionName == "Max" || actionName == "Mean" || actionName == "StdDev") &&
+              columns.size() == 1) {
+      statement.fCode = "." + actionName + templateArgs + "(" + Quote(columns[0]) + ")";
+      statement.fResultName = actionName + "(" + columns[0] + ")";
+   } else if (actionName == "Sum" && helperArgType == typeid(double) && columns.size() == 1) {
+      const auto initValue = **static_cast<std::shared_ptr<double> *>(helperArgOnHeap);
+      statement.fCode = ".Sum" + templateArgs + "(" + Quote(columns[0]) +
+                        (initValue != 0. ? ", " + FormatDouble(initValue) : std::string()) + ")";
+      statement.fResultName = "Sum(" + columns[0] + ")";
+   } else {
+      statement.fUnsupported = actionName;
+   }
+
+   fStatements.emplace_back(std::move(statement));
+}
+
+std::string RCodeRecorder::GenerateSource(ROOT::Detail::RDF::RLoopManager &lm,
+                                          const std::vector<std::string> &includes) const
+{
+   if (!fUnsupported.empty())
+      throw std::runtime_error("GenerateStandaloneSource: the computation graph contains operations that cannot be "
+                               "emitted as C++ code: " +
+                               JoinUnique(fUnsupported) + ".");
+
+   // Jitting creates and registers the actual actions of the jitted actions
+   lm.Jit();
+   std::vector<std::string> unsupportedActions;
+   std::size_t nEmittedActions = 0;
+   for (const auto &statement : fStatements) {
+      if (statement.fIsAction && !statement.fAction.expired()) {
+         ++nEmittedActions;
+         if (!statement.fUnsupported.empty())
+            unsupportedActions.emplace_back(statement.fUnsupported);
+      }
+   }
+   if (!unsupportedActions.empty())
+      throw std::runtime_error("GenerateStandaloneSource: the following actions cannot be emitted as C++ code: " +
+                               JoinUnique(unsupportedActions) + ".");
+
+   const std::string notRecordedError =
+      "GenerateStandaloneSource: the computation graph contains operations that were booked with C++ callables or "
+      "with explicit template parameters, or that were booked in a way that cannot be emitted as C++ code. Only "
+      "Filters, Defines and Redefines with string expressions, Aliases, Ranges, Counts and Histo1D, Histo2D, Min, "
+      "Max, Sum, Mean and StdDev actions with inferred column types are supported.";
+   if (nEmittedActions != lm.GetAllActions().size())
+      throw std::runtime_error(notRecordedError);
+
+   std::stringstream body;
+   std::stringstream report;
+   bool hasObjectResults = false;
+   // Map the states of the graph to the names of the variables that hold them. Newer states with the same key
+   // replace older ones, whose nodes were destroyed.
+   // The head node has no defines or aliases other than the internal columns.
+   const ROOT::Detail::RDF::RNodeBase *head = &lm;
+   std::unordered_map<std::string, std::string> variables{
+      {std::to_string(reinterpret_cast<std::uintptr_t>(head)), "df"}};
+   unsigned int nNodes = 0;
+   unsigned int nResults = 0;
+   for (const auto &statement : fStatements) {
+      if (statement.fIsAction && statement.fAction.expired())
+         continue;
+      const auto inputIt = variables.find(statement.fInput);
+      if (inputIt == variables.end())
+         throw std::runtime_error(notRecordedError);
+
+      if (!statement.fIsAction) {
+         const auto name = "node" + std::to_string(++nNodes);
+         body << "   auto " << name << " = " << inputIt->second << statement.fCode << ";\n";
+         variables[statement.fOutput] = name;
+         continue;
+      }
+
+      const auto name = "result" + std::to_string(++nResults);
+      body << "   auto " << name << " = " << inputIt->second << statement.fCode << ";\n";
+      if (statement.fResultKind == EResultKind::kObject) {
+         hasObjectResults = true;
+         report << "   outputFile.WriteObject(" << name << ".GetPtr(), "
+                << Quote(statement.fResultName.empty() ? name : statement.fResultName) << ");\n";
+      } else {
+         report << "   std::cout << " << Quote(statement.fResultName + " = ") << " << *" << name << " << '\\n';\n";
+      }
+   }
+
+   std::stringstream code;
+   code << "// Generated by ROOT::RDF::Experimental::GenerateStandaloneSource\n"
+        << "\n"
+        << "#include <ROOT/RDataFrame.hxx>\n"
+        << "#include <ROOT/RVec.hxx>\n"
+        << "#include <TChain.h>\n"
+        << "#include <TFile.h>\n"
+        << "#include <TH1D.h>\n"
+        << "#include <TH2D.h>\n"
+        << "#include <TMath.h>\n"
+        << "#include <TROOT.h>\n"
+        << "\n"
+        << "#include <cmath>\n"
+        << "#include <iostream>\n"
+        << "#include <string>\n"
+        << "#include <vector>\n";
+   for (const auto &include : includes) {
+      if (!include.empty())
+         code << "#include " << (include.front() == '<' ? include : Quote(include)) << "\n";
+   }
+   code << "\n"
+        << "// The expressions were written for the interpreter, where these namespaces are available\n"
+        << "using namespace std;\n"
+        << "using namespace ROOT::VecOps;\n"
+        << "\n"
+        << "int main(int argc, char **argv)\n"
+        << "{\n"
+        << "   const char *outputFileName = argc > 1 ? argv[1] : \"rdf_standalone_output.root\";\n";
+   if (lm.GetNSlots() > 1)
+      code << "   ROOT::EnableImplicitMT();\n";
+   code << MakeDataFrameDeclaration(lm) << body.str();
+   if (hasObjectResults)
+      code << "\n   TFile outputFile(outputFileName, \"RECREATE\");\n";
+   else
+      code << "\n   (void)outputFileName;\n";
+   code << report.str() << "   return 0;\n"
+        << "}\n";
+   return code.str();
+}
+
+} // namespace RDF
+} // namespace Internal
+} // namespace ROOT
@@ -68,10 +68,19 @@ double-quote characters must be represented by a pair of double-quote characters
     2000,Mercury,Cougar
 ~~~
 
-The current implementation of RCsvDS reads the entire CSV file content into memory before
+By default, RCsvDS reads the entire CSV file content into memory before
 RDataFrame starts processing it. Therefore, before creating a CSV RDataFrame, it is
 important to check both how much memory is available and the size of the CSV file.
 
+Large files can instead be processed in chunks of a given number of bytes (the sixth, optional parameter of
+ROOT::RDF::FromCSV). A first pass over the file splits it in chunks of whole lines and counts their records, without
+parsing them. Each chunk is then an entry range, read and parsed by the slot that processes it, in parallel if
+implicit multi-threading is enabled: only the chunks being processed are held in memory.
+~~~{.cpp}
+// process the file in chunks of 64 MB
+auto df = ROOT::RDF::FromCSV("calibration.csv", true, ',', -1LL, {}, 64 * 1024 * 1024);
+~~~
+
 RCsvDS can handle empty cells and also allows the usage of the special keywords "NaN" and "nan" to
 indicate `nan` values. If the column is of type double, these cells are stored internally as `nan`.
 Empty cells and explicit `nan`-s inside columns of type Long64_t/bool are stored as zeros.
@@ -84,6 +93,7 @@ Empty cells and explicit `nan`-s inside columns of type Long64_t/bool are stored
 #include <TError.h>
 
 #include <algorithm>
+#include <cstring>
 #include <memory>
 #include <sstream>
 #include <string>
@@ -92,6 +102,14 @@ namespace ROOT {
 
 namespace RDF {
 
+/// The lines of the byte chunk processed by a slot, see RCsvDS::InitSlot.
+struct RCsvDS::RSlotChunk {
+   std::unique_ptr<ROOT::Internal::RRawFile> fFile; // each slot reads the file independently
+   ULong64_t fFirstEntry = 0;
+   std::vector<std::string> fLines; // the non-empty lines of the chunk
+   std::set<std::string> fColContainingEmpty;
+};
+
 std::string RCsvDS::AsString()
 {
    return "CSV data source";
@@ -329,10 +347,14 @@ size_t RCsvDS::ParseValue(const std::string &line, std::vector<std::string> &col
 ///                     column names, values being type specifiers ('O' for boolean, 'D' for double, 'L' for
 ///                     Long64_t, 'T' for std::string)
 RCsvDS::RCsvDS(std::string_view fileName, bool readHeaders, char delimiter, Long64_t linesChunkSize,
-               std::unordered_map<std::string, char> &&colTypes)
+               std::unordered_map<std::string, char> &&colTypes, Long64_t bytesChunkSize)
    : fReadHeaders(readHeaders), fCsvFile(ROOT::Internal::RRawFile::Create(fileName)), fDelimiter(delimiter),
-     fLinesChunkSize(linesChunkSize), fColTypes(std::move(colTypes))
+     fLinesChunkSize(linesChunkSize), fColTypes(std::move(colTypes)), fBytesChunkSize(bytesChunkSize)
 {
+   if (fBytesChunkSize != -1LL && (fBytesChunkSize <= 0 || fLinesChunkSize != -1LL))
+      throw std::runtime_error("RCsvDS: the size of the byte chunks must be positive, and cannot be used together "
+                               "with a lines chunk size.");
+
    std::string line;
 
    // Read the headers if present
@@ -403,6 +425,124 @@ void RCsvDS::FreeRecords()
    fRecords.clear();
 }
 
+////////////////////////////////////////////////////////////////////////
+/// Split the data in chunks of whole lines, of about fBytesChunkSize bytes, and count their non-empty lines.
+/// Lines are only searched for, not parsed, so that the scan runs at the speed of reading the file.
+void RCsvDS::ScanByteChunks()
+{
+   fByteChunks.clear();
+   // lines that are empty once the break is removed are skipped, as in Readln
+   auto file = fCsvFile->Clone();
+   const bool isWindows = file->GetOptions().fLineBreak == ROOT::Internal::RRawFile::ELineBreaks::kWindows;
+
+   ULong64_t nEntries = 0;
+   auto addLine = [&](std::uint64_t lineStart, std::uint64_t lineLength) {
+      if (fByteChunks.empty() || lineStart >= fByteChunks.back().fBegin + fBytesChunkSize) {
+         if (!fByteChunks.empty())
+            fByteChunks.back().fEnd = lineStart;
+         fByteChunks.push_back(RByteChunk{lineStart, lineStart, nEntries});
+      }
+      if (lineLength > 0) {
+         ++fByteChunks.back().fNEntries;
+         ++nEntries;
+      }
+   };
+
+   std::vector<char> buffer(std::min<Long64_t>(fBytesChunkSize, 8 * 1024 * 1024));
+   std::uint64_t pos = fDataPos;
+   std::uint64_t lineStart = fDataPos;
+   std::uint64_t lineLength = 0;
+   char lastChar = '\0';
+   while (auto nRead = file->ReadAt(buffer.data(), buffer.size(), pos)) {
+      const char *begin = buffer.data();
+      const char *end = begin + nRead;
+      while (begin < end) {
+         const char *lineBreak = static_cast<const char *>(std::memchr(begin, '\n', end - begin));
+         const char *segmentEnd = lineBreak ? lineBreak : end;
+         if (segmentEnd > begin) {
+            lineLength += segmentEnd - begin;
+            lastChar = *(segmentEnd - 1);
+         }
+         if (!lineBreak)
+            break;
+         addLine(lineStart, lineLength - (isWindows && lineLength > 0 && lastChar == '\r'));
+         lineStart = pos + (lineBreak - buffer.data()) + 1;
+         lineLength = 0;
+         begin = lineBreak + 1;
+      }
+      pos += nRead;
+   }
+   if (lineLength > 0)
+      addLine(lineStart, lineLength);
+   if (!fByteChunks.empty())
+      fByteChunks.back().fEnd = pos;
+
+   fByteChunks.erase(std::remove_if(fByteChunks.begin(), fByteChunks.end(),
+                                    [](const RByteChunk &chunk) { return chunk.fNEntries == 0; }),
+                     fByteChunks.end());
+}
+
+/// Parse a line and store its values in the per-slot values of the columns.
+void RCsvDS::FillSlotValues(const std::string &line, unsigned int slot)
+{
+   const auto columns = ParseColumns(line);
+   if (columns.size() != fHeaders.size()) {
+      throw std::runtime_error("RCsvDS: the line \"" + line + "\" has " + std::to_string(columns.size()) +
+                               " fields instead of " + std::to_string(fHeaders.size()) + ".");
+   }
+
+   auto &colContainingEmpty = fSlotChunks[slot]->fColContainingEmpty;
+   auto colIndex = 0u;
+   for (const auto colType : fColTypesList) {
+      const auto &col = columns[colIndex];
+      switch (colType) {
+      case 'D': {
+         fDoubleEvtValues[colIndex][slot] = (col != "nan") ? std::stod(col) : std::numeric_limits<double>::quiet_NaN();
+         break;
+      }
+      case 'L': {
+         if (col != "nan") {
+            fLong64EvtValues[colIndex][slot] = std::stoll(col);
+         } else {
+            colContainingEmpty.insert(fHeaders[colIndex]);
+            fLong64EvtValues[colIndex][slot] = 0;
+         }
+         break;
+      }
+      case 'O': {
+         bool b = false;
+         if (col != "nan")
+            std::istringstream(col) >> std::boolalpha >> b;
+         else
+            colContainingEmpty.insert(fHeaders[colIndex]);
+         fBoolEvtValues[colIndex][slot] = b;
+         break;
+      }
+      case 'T': {
+         fStringEvtValues[colIndex][slot] = col;
+         break;
+      }
+      }
+      ++colIndex;
+   }
+}
+
+void RCsvDS::WarnAboutEmptyCells() const
+{
+   if (fColContainingEmpty.empty())
+      return;
+
+   std::string msg = "";
+   for (const auto &col : fColContainingEmpty) {
+      const auto colT = GetTypeName(col);
+      msg += "Column \"" + col + "\" of type " + colT + " contains empty cell(s) or NaN(s).\n";
+      msg += "There is no `nan` equivalent for type " + colT + ", hence ";
+      msg += std::string(colT == "Long64_t" ? "`0`" : "`false`") + " is stored.\n";
+   }
+   msg += "Please manually set the column type to `double` (with `D`) in `FromCSV` to read NaNs instead.\n";
+   Warning("RCsvDS", "%s", msg.c_str());
+}
+
 ////////////////////////////////////////////////////////////////////////
 /// Destructor.
 RCsvDS::~RCsvDS()
@@ -416,6 +556,15 @@ void RCsvDS::Finalize()
    fProcessedLines = 0ULL;
    fEntryRangesRequested = 0ULL;
    FreeRecords();
+
+   if (fBytesChunkSize != -1LL) {
+      // in the other modes the warning is issued when the lines are read, before the event loop
+      for (auto &slotChunk : fSlotChunks) {
+         fColContainingEmpty.insert(slotChunk->fColContainingEmpty.begin(), slotChunk->fColContainingEmpty.end());
+         slotChunk->fColContainingEmpty.clear();
+      }
+      WarnAboutEmptyCells();
+   }
 }
 
 const std::vector<std::string> &RCsvDS::GetColumnNames() const
@@ -425,6 +574,18 @@ const std::vector<std::string> &RCsvDS::GetColumnNames() const
 
 std::vector<std::pair<ULong64_t, ULong64_t>> RCsvDS::GetEntryRanges()
 {
+   if (fBytesChunkSize != -1LL) {
+      // the lines are read by the slots, in InitSlot: return all the chunks at once
+      std::vector<std::pair<ULong64_t, ULong64_t>> entryRanges;
+      if (fEntryRangesRequested++ > 0)
+         return entryRanges;
+      if (fByteChunks.empty())
+         ScanByteChunks();
+      for (const auto &chunk : fByteChunks)
+         entryRanges.emplace_back(chunk.fFirstEntry, chunk.fFirstEntry + chunk.fNEntries);
+      return entryRanges;
+   }
+
    // Read records and store them in memory
    auto linesToRead = fLinesChunkSize;
    FreeRecords();
@@ -437,17 +598,7 @@ std::vector<std::pair<ULong64_t, ULong64_t>> RCsvDS::GetEntryRanges()
       --linesToRead;
    }
 
-   if (!fColContainingEmpty.empty()) {
-      std::string msg = "";
-      for (const auto &col : fColContainingEmpty) {
-         const auto colT = GetTypeName(col);
-         msg += "Column \"" + col + "\" of type " + colT + " contains empty cell(s) or NaN(s).\n";
-         msg += "There is no `nan` equivalent for type " + colT + ", hence ";
-         msg += std::string(colT == "Long64_t" ? "`0`" : "`false`") + " is stored.\n";
-      }
-      msg += "Please manually set the column type to `double` (with `D`) in `FromCSV` to read NaNs instead.\n";
-      Warning("RCsvDS", "%s", msg.c_str());
-   }
+   WarnAboutEmptyCells();
 
    if (gDebug > 0) {
       if (fLinesChunkSize == -1LL) {
@@ -504,6 +655,15 @@ bool RCsvDS::HasColumn(std::string_view colName) const
 
 bool RCsvDS::SetEntry(unsigned int slot, ULong64_t entry)
 {
+   if (fBytesChunkSize != -1LL) {
+      const auto &slotChunk = *fSlotChunks[slot];
+      // sequential event loops process all the entry ranges in the same task
+      if (entry < slotChunk.fFirstEntry || entry >= slotChunk.fFirstEntry + slotChunk.fLines.size())
+         LoadByteChunk(slot, entry);
+      FillSlotValues(slotChunk.fLines[entry - slotChunk.fFirstEntry], slot);
+      return true;
+   }
+
    // Here we need to normalise the entry to the number of lines we already processed.
    const auto offset = (fEntryRangesRequested - 1) * fLinesChunkSize;
    const auto recordPos = entry - offset;
@@ -548,6 +708,54 @@ void RCsvDS::SetNSlots(unsigned int nSlots)
    fLong64EvtValues.resize(nColumns, std::vector<Long64_t>(fNSlots));
    fStringEvtValues.resize(nColumns, std::vector<std::string>(fNSlots));
    fBoolEvtValues.resize(nColumns, std::deque<bool>(fNSlots));
+
+   if (fBytesChunkSize != -1LL) {
+      for (auto i = 0u; i < fNSlots; ++i)
+         fSlotChunks.emplace_back(std::make_unique<RSlotChunk>());
+   }
+}
+
+////////////////////////////////////////////////////////////////////////
+/// Read the lines of the byte chunk that contains the entry into the memory of the slot.
+void RCsvDS::LoadByteChunk(unsigned int slot, ULong64_t entry)
+{
+   auto chunk = std::upper_bound(fByteChunks.begin(), fByteChunks.end(), entry,
+                                 [](ULong64_t e, const RByteChunk &c) { return e < c.fFirstEntry; });
+   R__ASSERT(chunk != fByteChunks.begin());
+   --chunk;
+   R__ASSERT(entry < chunk->fFirstEntry + chunk->fNEntries);
+
+   auto &slotChunk = *fSlotChunks[slot];
+   if (!slotChunk.fFile)
+      slotChunk.fFile = fCsvFile->Clone();
+   slotChunk.fFirstEntry = chunk->fFirstEntry;
+   slotChunk.fLines.clear();
+   slotChunk.fLines.reserve(chunk->fNEntries);
+
+   auto &file = *slotChunk.fFile;
+   file.Seek(chunk->fBegin);
+   std::string line;
+   while (file.GetFilePos() < chunk->fEnd && file.Readln(line)) {
+      if (!line.empty())
+         slotChunk.fLines.emplace_back(std::move(line));
+   }
+   if (slotChunk.fLines.size() != chunk->fNEntries)
+      throw std::runtime_error("RCsvDS: the CSV file changed while it was being read.");
+}
+
+/// If the file is processed in byte chunks, read the chunk that starts at `firstEntry`.
+void RCsvDS::InitSlot(unsigned int slot, ULong64_t firstEntry)
+{
+   if (fBytesChunkSize != -1LL && !fByteChunks.empty())
+      LoadByteChunk(slot, firstEntry);
+}
+
+void RCsvDS::FinalizeSlot(unsigned int slot)
+{
+   if (fBytesChunkSize == -1LL)
+      return;
+   // release the memory of the chunk
+   std::vector<std::string>().swap(fSlotChunks[slot]->fLines);
 }
 
 std::string RCsvDS::GetLabel()
@@ -556,10 +764,10 @@ std::string RCsvDS::GetLabel()
 }
 
 RDataFrame FromCSV(std::string_view fileName, bool readHeaders, char delimiter, Long64_t linesChunkSize,
-                   std::unordered_map<std::string, char> &&colTypes)
+                   std::unordered_map<std::string, char> &&colTypes, Long64_t bytesChunkSize)
 {
-   ROOT::RDataFrame rdf(
-      std::make_unique<RCsvDS>(fileName, readHeaders, delimiter, linesChunkSize, std::move(colTypes)));
+   ROOT::RDataFrame rdf(std::make_unique<RCsvDS>(fileName, readHeaders, delimiter, linesChunkSize,
+                                                 std::move(colTypes), bytesChunkSize));
    return rdf;
 }
 
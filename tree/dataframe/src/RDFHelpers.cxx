@@ -23,6 +23,7 @@
 
 #include <algorithm>
 #include <set>
+#include <stdexcept>
 
 using ROOT::RDF::RResultHandle;
 
@@ -71,26 +72,37 @@ unsigned int ROOT::RDF::RunGraphs(std::vector<RResultHandle> handles)
       << " unique computation graphs) completed"
       << (sw.RealTime() > 1e-3 ? " in " + std::to_string(sw.RealTime()) + " seconds." : " in less than 1ms.");
 
+   // Computation graphs that process the same dataset share one event loop, so that the data is only read once:
+   // the event loop of the first graph of each group also runs the other graphs of the group.
+   std::vector<RResultHandle> eventLoops;
+   for (auto &h : uniqueLoops) {
+      if (!h.fLoopManager)
+         continue;
+      auto sameDataset = [&h](const RResultHandle &l) { return l.fLoopManager->HasSameDataset(*h.fLoopManager); };
+      auto it = std::find_if(eventLoops.begin(), eventLoops.end(), sameDataset);
+      if (it == eventLoops.end())
+         eventLoops.emplace_back(h);
+      else
+         it->fLoopManager->FuseEventLoopWith(*h.fLoopManager);
+   }
+
    // Trigger the unique event loops
-   auto run = [](RResultHandle &h) {
-      if (h.fLoopManager)
-         h.fLoopManager->Run(/*jit=*/false);
-   };
+   auto run = [](RResultHandle &h) { h.fLoopManager->Run(/*jit=*/false); };
 
    sw.Start();
 #ifdef R__USE_IMT
    if (ROOT::IsImplicitMTEnabled()) {
-      ROOT::TThreadExecutor{}.Foreach(run, uniqueLoops);
+      ROOT::TThreadExecutor{}.Foreach(run, eventLoops);
    } else {
 #endif
-      std::for_each(uniqueLoops.begin(), uniqueLoops.end(), run);
+      std::for_each(eventLoops.begin(), eventLoops.end(), run);
 #ifdef R__USE_IMT
    }
 #endif
    sw.Stop();
    R__LOG_INFO(ROOT::Detail::RDF::RDFLogChannel())
-      << "Finished RunGraphs run (" << uniqueLoops.size() << " unique computation graphs, " << sw.CpuTime() << "s CPU, "
-      << sw.RealTime() << "s elapsed).";
+      << "Finished RunGraphs run (" << uniqueLoops.size() << " unique computation graphs, " << eventLoops.size()
+      << " event loops, " << sw.CpuTime() << "s CPU, " << sw.RealTime() << "s elapsed).";
 
    return uniqueLoops.size();
 }
@@ -99,3 +111,50 @@ ROOT::RDF::Experimental::SnapshotPtr_t ROOT::RDF::Experimental::VariationsFor(RO
 {
    throw std::logic_error("Varying a Snapshot result is not implemented yet.");
 }
+
+void ROOT::RDF::Experimental::EnableBulkProcessing(ROOT::RDF::RNode node, unsigned int bulkSize)
+{
+   ROOT::Internal::RDF::SetBulkSize(node, bulkSize);
+}
+
+void ROOT::RDF::Experimental::EnableProfiling(ROOT::RDF::RNode node, unsigned int samplingPeriod)
+{
+   ROOT::Internal::RDF::EnableProfiling(node, samplingPeriod);
+}
+
+namespace {
+const ROOT::Internal::RDF::RProfiler &GetProfilerOrThrow(const ROOT::RDF::RNode &node)
+{
+   const auto *profiler = ROOT::Internal::RDF::GetProfiler(node);
+   if (!profiler)
+      throw std::runtime_error("Profiling was not enabled for this computation graph: call "
+                               "ROOT::RDF::Experimental::EnableProfiling before running the event loop.");
+   return *profiler;
+}
+} // anonymous namespace
+
+std::string ROOT::RDF::Experimental::GetProfileJSON(ROOT::RDF::RNode node)
+{
+   return GetProfilerOrThrow(node).ToJSON();
+}
+
+std::string ROOT::RDF::Experimental::GetProfileFoldedStacks(ROOT::RDF::RNode node)
+{
+   return GetProfilerOrThrow(node).ToFoldedStacks();
+}
+
+void ROOT::RDF::Experimental::SetJitCacheDir(std::string_view dir)
+{
+   ROOT::Internal::RDF::SetJitCacheDir(dir);
+}
+
+void ROOT::RDF::Experimental::SetFilterCacheDir(std::string_view dir)
+{
+   ROOT::Internal::RDF::SetFilterCacheDir(dir);
+}
+
+std::string
+ROOT::RDF::Experimental::GenerateStandaloneSource(ROOT::RDF::RNode node, const std::vector<std::string> &includes)
+{
+   return ROOT::Internal::RDF::GenerateStandaloneSource(node, includes);
+}
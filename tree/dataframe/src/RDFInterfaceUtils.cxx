@@ -20,6 +20,7 @@
 #include <ROOT/RDF/RNodeBase.hxx>
 #include <ROOT/RDF/Utils.hxx>
 #include <ROOT/RStringView.hxx>
+#include <RConfigure.h> // R__HAS_ROOT7
 #include <TBranch.h>
 #include <TClass.h>
 #include <TClassEdit.h>
@@ -30,9 +31,15 @@
 #include <TPRegexp.h>
 #include <TROOT.h>
 #include <TString.h>
+#include <TSystem.h> // AccessPathName
 #include <TTree.h>
 #include <TVirtualMutex.h>
 
+#ifdef R__HAS_ROOT7
+#include <ROOT/RNTuple.hxx>   // RNTupleReader
+#include <ROOT/RNTupleDS.hxx> // FromRNTuple
+#endif
+
 // pragma to disable warnings on Rcpp which have
 // so many noise compiling
 #if defined(__GNUC__)
@@ -325,6 +332,7 @@ static std::string DeclareFunction(const std::string &expr, const ColumnNames_t
 
    // InterpreterDeclare could throw. If it doesn't, mark the function as already jitted
    exprMap.insert({funcCode, funcFullName});
+   ROOT::Internal::RDF::GetJittedFunctions()[funcFullName] = funcCode;
 
    return funcFullName;
 }
@@ -661,6 +669,12 @@ BookFilterJit(std::shared_ptr<RDFDetail::RNodeBase> *prevNodeOnHeap, std::string
    const auto jittedFilter = std::make_shared<RDFDetail::RJittedFilter>(
       (*prevNodeOnHeap)->GetLoopManagerUnchecked(), name,
       Union(colRegister.GetVariationDeps(parsedExpr.fUsedCols), (*prevNodeOnHeap)->GetVariations()));
+   jittedFilter->SetExpression(expression);
+   jittedFilter->GetLoopManagerUnchecked()->GetCodeRecorder().AddFilter(
+      RCodeRecorder::GetStateKey(prevNodeOnHeap->get(), colRegister),
+      RCodeRecorder::GetStateKey(jittedFilter.get(), colRegister),
+      BuildFunctionString(parsedExpr.fExpr, parsedExpr.fVarNames, exprVarTypes), parsedExpr.fUsedCols,
+      std::string(name));
 
    // Produce code snippet that creates the filter and registers it with the corresponding RJittedFilter
    // Windows requires std::hex << std::showbase << (size_t)pointer to produce notation "0x1234"
@@ -707,6 +721,20 @@ std::shared_ptr<RJittedDefine> BookDefineJit(std::string_view name, std::string_
    auto definesAddr = PrettyPrintAddr(definesCopy);
    auto jittedDefine = std::make_shared<RDFDetail::RJittedDefine>(name, type, lm, colRegister, parsedExpr.fUsedCols);
 
+   // The state produced by the Define is the one of the column register that RInterface builds from jittedDefine
+   {
+      const std::string nameStr(name);
+      const bool isRedefine = colRegister.IsDefineOrAlias(nameStr) ||
+                              std::find(branches.begin(), branches.end(), nameStr) != branches.end() ||
+                              std::find(dsColumns.begin(), dsColumns.end(), nameStr) != dsColumns.end();
+      RColumnRegister newCols(colRegister);
+      newCols.AddDefine(jittedDefine);
+      lm.GetCodeRecorder().AddDefine(RCodeRecorder::GetStateKey(upcastNodeOnHeap->get(), colRegister),
+                                     RCodeRecorder::GetStateKey(upcastNodeOnHeap->get(), newCols), isRedefine, nameStr,
+                                     BuildFunctionString(parsedExpr.fExpr, parsedExpr.fVarNames, exprVarTypes),
+                                     parsedExpr.fUsedCols);
+   }
+
    std::stringstream defineInvocation;
    defineInvocation << "ROOT::Internal::RDF::JitDefineHelper<ROOT::Internal::RDF::DefineTypes::RDefineTag>(" << funcName
                     << ", new const char*[" << parsedExpr.fUsedCols.size() << "]{";
@@ -867,11 +895,16 @@ std::string JitBuildAction(const ColumnNames_t &cols, std::shared_ptr<RDFDetail:
          createAction_str << ", ";
       createAction_str << '"' << cols[i] << '"';
    }
-   createAction_str << "}, " << cols.size() << ", " << nSlots << ", reinterpret_cast<shared_ptr<" << helperArgTypeName
-                    << ">*>(" << PrettyPrintAddr(helperArgOnHeap)
+   createAction_str << "}, " << cols.size() << ", " << nSlots << ", reinterpret_cast<std::shared_ptr<"
+                    << helperArgTypeName << ">*>(" << PrettyPrintAddr(helperArgOnHeap)
                     << "), reinterpret_cast<std::weak_ptr<ROOT::Internal::RDF::RJittedAction>*>("
                     << PrettyPrintAddr(jittedActionOnHeap)
                     << "), reinterpret_cast<ROOT::Internal::RDF::RColumnRegister*>(" << definesAddr << "));";
+
+   (*prevNode)->GetLoopManagerUnchecked()->GetCodeRecorder().AddJittedAction(
+      RCodeRecorder::GetStateKey(prevNode->get(), colRegister), *jittedActionOnHeap, actionTypeNameBase,
+      helperArgType, helperArgOnHeap, cols, columnTypeNames);
+
    return createAction_str.str();
 }
 
@@ -966,6 +999,37 @@ void CheckForDuplicateSnapshotColumns(const ColumnNames_t &cols)
    }
 }
 
+#ifdef R__HAS_ROOT7
+void ResetToRNTuple(ROOT::RDataFrame &df, std::string_view ntupleName, std::string_view fileName)
+{
+   df = ROOT::RDF::Experimental::FromRNTuple(ntupleName, fileName);
+}
+
+std::shared_ptr<RLoopManager>
+OpenDiskCache(std::string_view ntupleName, std::string_view fileName, const ColumnNames_t &columns)
+{
+   if (gSystem->AccessPathName(std::string(fileName).c_str()))
+      return nullptr; // the file does not exist
+   std::unique_ptr<ROOT::Experimental::RNTupleReader> reader;
+   try {
+      reader = ROOT::Experimental::RNTupleReader::Open(ntupleName, fileName);
+   } catch (const ROOT::Experimental::RException &) {
+      return nullptr; // not a file written by a disk Cache, it will be overwritten
+   }
+   const auto *descriptor = reader->GetDescriptor();
+   const bool hasAllColumns = std::all_of(columns.begin(), columns.end(), [descriptor](const std::string &col) {
+      return descriptor->FindFieldId(col) != ROOT::Experimental::kInvalidDescriptorId;
+   });
+   if (!hasAllColumns)
+      return nullptr;
+   reader.reset();
+
+   auto pageSource = ROOT::Experimental::Detail::RPageSource::Create(ntupleName, fileName);
+   return std::make_shared<RLoopManager>(std::make_unique<ROOT::Experimental::RNTupleDS>(std::move(pageSource)),
+                                         columns);
+}
+#endif
+
 /// Return copies of colsWithoutAliases and colsWithAliases with size branches for variable-sized array branches added
 /// in the right positions (i.e. before the array branches that need them).
 std::pair<std::vector<std::string>, std::vector<std::string>>
@@ -23,13 +23,24 @@
 #include "TError.h" // Info
 #include "TInterpreter.h"
 #include "TLeaf.h"
+#include "TMD5.h"
 #include "TROOT.h" // IsImplicitMTEnabled, GetThreadPoolSize
+#include "TSystem.h"
 #include "TTree.h"
-
+#include "TVirtualMutex.h"
+
+#include <algorithm>
+#include <cctype> // std::isxdigit
+#include <cstdint>
+#include <ctime>
+#include <fstream>
+#include <sstream>
 #include <stdexcept>
 #include <string>
 #include <cstring>
 #include <typeinfo>
+#include <unordered_map>
+#include <vector>
 
 using namespace ROOT::Detail::RDF;
 using namespace ROOT::RDF;
@@ -360,6 +371,237 @@ Long64_t InterpreterCalc(const std::string &code, const std::string &context)
    return 0; // we used to forward the return value of Calc, but that's not possible anymore.
 }
 
+namespace {
+std::string &JitCacheDir()
+{
+   static std::string dir = [] {
+      const char *env = gSystem->Getenv("ROOT_RDF_JIT_CACHE_DIR");
+      return env ? std::string(env) : std::string();
+   }();
+   return dir;
+}
+
+std::string &FilterCacheDir()
+{
+   static std::string dir = [] {
+      const char *env = gSystem->Getenv("ROOT_RDF_FILTER_CACHE_DIR");
+      return env ? std::string(env) : std::string();
+   }();
+   return dir;
+}
+
+bool IsAddressLiteral(const std::string &s)
+{
+   if (s == "0")
+      return true;
+   if (s.size() < 3 || s.compare(0, 2, "0x") != 0)
+      return false;
+   return std::all_of(s.begin() + 2, s.end(), [](char c) { return std::isxdigit(static_cast<unsigned char>(c)); });
+}
+
+/// Replace the addresses in the `reinterpret_cast<T *>(0x...)` expressions of jitted code with elements of an array
+/// `addrs`, whose values are appended to `addrs`. The resulting code does not depend on the memory layout of the
+/// process that booked it.
+std::string ReplaceAddresses(const std::string &code, std::vector<std::uintptr_t> &addrs)
+{
+   static const std::string castBegin = "reinterpret_cast<";
+   std::string result;
+   result.reserve(code.size());
+
+   bool inString = false;
+   std::size_t i = 0;
+   while (i < code.size()) {
+      const char c = code[i];
+      if (inString || c == '"' || code.compare(i, castBegin.size(), castBegin) != 0) {
+         if (inString && c == '\\' && i + 1 < code.size()) {
+            result.append(code, i, 2);
+            i += 2;
+            continue;
+         }
+         if (c == '"')
+            inString = !inString;
+         result += c;
+         ++i;
+         continue;
+      }
+
+      // skip the target type of the cast, which can contain template arguments
+      std::size_t pos = i + castBegin.size();
+      for (int depth = 1; pos < code.size() && depth > 0; ++pos) {
+         if (code[pos] == '<')
+            ++depth;
+         else if (code[pos] == '>')
+            --depth;
+      }
+      const auto argEnd = code.find(')', pos);
+      if (pos < code.size() && code[pos] == '(' && argEnd != std::string::npos) {
+         const auto arg = code.substr(pos + 1, argEnd - pos - 1);
+         if (IsAddressLiteral(arg)) {
+            result.append(code, i, pos + 1 - i);
+            result += "addrs[" + std::to_string(addrs.size()) + "]";
+            addrs.push_back(std::stoull(arg, nullptr, 16));
+            i = argEnd;
+            continue;
+         }
+      }
+      result.append(code, i, pos - i);
+      i = pos;
+   }
+
+   return result;
+}
+} // anonymous namespace
+
+std::string GetJitCacheDir()
+{
+   R__LOCKGUARD(gROOTMutex);
+   return JitCacheDir();
+}
+
+void SetJitCacheDir(std::string_view dir)
+{
+   R__LOCKGUARD(gROOTMutex);
+   JitCacheDir() = std::string(dir);
+}
+
+std::string GetFilterCacheDir()
+{
+   R__LOCKGUARD(gROOTMutex);
+   return FilterCacheDir();
+}
+
+void SetFilterCacheDir(std::string_view dir)
+{
+   R__LOCKGUARD(gROOTMutex);
+   FilterCacheDir() = std::string(dir);
+}
+
+std::unordered_map<std::string, std::string> &GetJittedFunctions()
+{
+   static std::unordered_map<std::string, std::string> functions;
+   return functions;
+}
+
+namespace {
+/// A marker of a failed build of the jit cache expires after this many seconds, so that a transient failure, e.g. a
+/// full disk or an interrupted compiler, does not disable the cache for that code forever.
+constexpr long kJitCacheFailureLifetime = 3600;
+
+/// Rename the jitted functions called by `body`, e.g. `R_rdf::func12`, in order of their first call, to `R_rdf::f0`,
+/// `R_rdf::f1`, ... and append their declarations to `declarations`. The code of the cached library then only depends
+/// on the computation graph, not on what else the process jitted before. Must be called with gROOTMutex held.
+/// Return false if a called function is unknown.
+bool RenameJittedFunctions(std::string &body, std::string &declarations)
+{
+   static const std::string prefix = "R_rdf::func";
+   const auto &functions = GetJittedFunctions();
+   std::vector<std::string> renamed;
+   std::string result;
+   result.reserve(body.size());
+   std::size_t begin = 0;
+   for (auto pos = body.find(prefix); pos != std::string::npos; pos = body.find(prefix, begin)) {
+      auto end = pos + prefix.size();
+      while (end < body.size() && std::isdigit(static_cast<unsigned char>(body[end])))
+         ++end;
+      result.append(body, begin, pos - begin);
+      begin = end;
+      const auto name = body.substr(pos, end - pos);
+      auto it = std::find(renamed.begin(), renamed.end(), name);
+      if (it == renamed.end()) {
+         const auto function = functions.find(name);
+         if (function == functions.end())
+            return false;
+         declarations += "auto f" + std::to_string(renamed.size()) + function->second + '\n';
+         it = renamed.insert(renamed.end(), name);
+      }
+      result += "R_rdf::f" + std::to_string(it - renamed.begin());
+   }
+   result.append(body, begin, std::string::npos);
+   body = std::move(result);
+   return true;
+}
+} // anonymous namespace
+
+bool InterpreterCalcCached(const std::string &code, const std::string &cacheDir)
+{
+   std::vector<std::uintptr_t> addrs;
+   auto body = ReplaceAddresses(code, addrs);
+   std::string functions;
+   {
+      // DeclareFunction adds to the jitted functions concurrently
+      R__LOCKGUARD(gROOTMutex);
+      if (!RenameJittedFunctions(body, functions))
+         return false;
+   }
+
+   const std::string key = std::string(gROOT->GetVersion()) + ' ' + gROOT->GetGitCommit() + '\n' + functions + body;
+   TMD5 md5;
+   md5.Update(reinterpret_cast<const UChar_t *>(key.data()), key.size());
+   md5.Final();
+   const std::string name = std::string("rdfjit_") + md5.AsString();
+   const std::string srcPath = cacheDir + "/" + name + ".cxx";
+   const std::string libPath = cacheDir + "/" + name;
+   const std::string failedPath = cacheDir + "/" + name + ".failed";
+
+   // a recent process could not build this library: do not pay for a failing compilation again
+   FileStat_t failedStat;
+   if (gSystem->GetPathInfo(failedPath.c_str(), failedStat) == 0) {
+      if (std::time(nullptr) - failedStat.fMtime < kJitCacheFailureLifetime)
+         return false;
+      gSystem->Unlink(failedPath.c_str());
+   }
+
+   if (gSystem->AccessPathName(srcPath.c_str())) {
+      std::stringstream source;
+      source << "// Code generated by RDataFrame for its on-disk jit cache\n"
+             << "#include <ROOT/RDataFrame.hxx>\n"
+             << "#include <cstdint>\n\n"
+             << "namespace " << name << " {\n"
+             << "using namespace std;\n"
+             << "namespace R_rdf {\n"
+             << functions << "}\n"
+             << "void Calc(const std::uintptr_t *addrs)\n{\n"
+             << body << "\n}\n"
+             << "} // namespace " << name << "\n\n"
+             << "extern \"C\" void " << name << "_calc(const std::uintptr_t *addrs)\n{\n"
+             << "   " << name << "::Calc(addrs);\n}\n";
+
+      // write a temporary file first, so that concurrent processes never see a partially written source
+      gSystem->mkdir(cacheDir.c_str(), /*recursive=*/true);
+      const std::string tmpPath = srcPath + "." + std::to_string(gSystem->GetPid()) + ".tmp";
+      {
+         std::ofstream out(tmpPath);
+         out << source.str();
+         if (!out)
+            return false;
+      }
+      if (gSystem->Rename(tmpPath.c_str(), srcPath.c_str()) != 0) {
+         gSystem->Unlink(tmpPath.c_str());
+         return false;
+      }
+   }
+
+   // ACLiC only compiles the library if it does not exist or is older than the source, otherwise it just loads it
+   const bool isBuilt = !gSystem->AccessPathName((libPath + "." + gSystem->GetSoExt()).c_str());
+   if (!isBuilt)
+      R__LOG_INFO(RDFLogChannel()) << "Compiling " << srcPath << " for the jit cache.";
+   if (!gSystem->CompileMacro(srcPath.c_str(), "kOs", libPath.c_str())) {
+      R__LOG_WARNING(RDFLogChannel()) << "Could not compile " << srcPath
+                                      << " for the jit cache, falling back to just-in-time compilation.";
+      std::ofstream marker(failedPath);
+      return false;
+   }
+
+   using Calc_t = void (*)(const std::uintptr_t *);
+   auto calc = reinterpret_cast<Calc_t>(gSystem->DynFindSymbol(name.c_str(), (name + "_calc").c_str()));
+   if (!calc)
+      return false;
+
+   R__LOG_INFO(RDFLogChannel()) << "Loaded the jitted code from " << srcPath << '.';
+   calc(addrs.data());
+   return true;
+}
+
 bool IsInternalColumn(std::string_view colName)
 {
    const auto str = colName.data();
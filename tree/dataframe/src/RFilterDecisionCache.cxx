@@ -0,0 +1,104 @@
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include "ROOT/RDF/RFilterDecisionCache.hxx"
+#include "ROOT/RDF/Utils.hxx" // RDFLogChannel
+#include "ROOT/InternalTreeUtils.hxx" // GetTreeFullPaths
+#include "ROOT/RLogger.hxx"
+#include "TFile.h"
+#include "TMD5.h"
+#include "TSystem.h"
+#include "TTree.h"
+#include "TUUID.h"
+
+#include <algorithm>
+#include <fstream>
+
+namespace {
+/// Identifies the format of the cache files
+constexpr char kMagic[8] = {'R', 'D', 'F', 'F', 'L', 'T', '0', '1'};
+} // anonymous namespace
+
+namespace ROOT {
+namespace Internal {
+namespace RDF {
+
+std::uint8_t *RFilterDecisionCache::GetDecisions(const std::string &filterKey, TTree &tree)
+{
+   auto *file = tree.GetCurrentFile();
+   if (file == nullptr)
+      return nullptr;
+
+   // The file UUID is generated when the file is created, so it identifies the content of the file without the need
+   // to checksum it
+   const std::string key = filterKey + '\n' + file->GetUUID().AsString() + '\n' +
+                           ROOT::Internal::TreeUtils::GetTreeFullPaths(tree)[0];
+   TMD5 md5;
+   md5.Update(reinterpret_cast<const UChar_t *>(key.data()), key.size());
+   md5.Final();
+   const std::string path = fDir + "/rdffilter_" + md5.AsString() + ".bin";
+   const auto nEntries = tree.GetEntries();
+
+   std::lock_guard<std::mutex> lock(fMutex);
+   auto &decisions = fDecisions[path];
+   if (!decisions) {
+      decisions = std::make_unique<RDecisions>();
+      decisions->fPath = path;
+      decisions->fValues.resize(nEntries, kUnknown);
+
+      std::ifstream in(path, std::ios::binary);
+      char magic[sizeof(kMagic)];
+      std::uint64_t nStored = 0;
+      if (in.read(magic, sizeof(magic)) && std::equal(magic, magic + sizeof(magic), kMagic) &&
+          in.read(reinterpret_cast<char *>(&nStored), sizeof(nStored)) && nStored == std::uint64_t(nEntries)) {
+         if (!in.read(reinterpret_cast<char *>(decisions->fValues.data()), nEntries))
+            std::fill(decisions->fValues.begin(), decisions->fValues.end(), kUnknown);
+      }
+   }
+   if (decisions->fValues.size() != std::size_t(nEntries))
+      return nullptr;
+   decisions->fIsUsed = true;
+   return decisions->fValues.data();
+}
+
+void RFilterDecisionCache::Save()
+{
+   std::lock_guard<std::mutex> lock(fMutex);
+   bool isDirCreated = false;
+   for (auto &keyAndDecisions : fDecisions) {
+      auto &decisions = *keyAndDecisions.second;
+      if (!decisions.fIsUsed)
+         continue;
+      decisions.fIsUsed = false;
+
+      if (!isDirCreated) {
+         gSystem->mkdir(fDir.c_str(), /*recursive=*/true);
+         isDirCreated = true;
+      }
+      // write a temporary file first, so that concurrent processes never see a partially written file
+      const std::string tmpPath = decisions.fPath + "." + std::to_string(gSystem->GetPid()) + ".tmp";
+      {
+         std::ofstream out(tmpPath, std::ios::binary);
+         const std::uint64_t nEntries = decisions.fValues.size();
+         out.write(kMagic, sizeof(kMagic));
+         out.write(reinterpret_cast<const char *>(&nEntries), sizeof(nEntries));
+         out.write(reinterpret_cast<const char *>(decisions.fValues.data()), nEntries);
+         if (!out) {
+            R__LOG_WARNING(RDFLogChannel()) << "Could not write the filter decisions to " << tmpPath << '.';
+            gSystem->Unlink(tmpPath.c_str());
+            continue;
+         }
+      }
+      if (gSystem->Rename(tmpPath.c_str(), decisions.fPath.c_str()) != 0)
+         gSystem->Unlink(tmpPath.c_str());
+   }
+}
+
+} // namespace RDF
+} // namespace Internal
+} // namespace ROOT
@@ -28,6 +28,51 @@ void ROOT::Internal::RDF::ChangeSpec(const ROOT::RDF::RNode &node, ROOT::RDF::Ex
    node.GetLoopManager()->ChangeSpec(std::move(spec));
 }
 
+/**
+ * \brief Changes the number of entries that the event loop processes at a time in bulk mode.
+ *
+ * \param node Any node of the computation graph.
+ * \param bulkSize The number of entries per block, zero disables bulk processing.
+ */
+void ROOT::Internal::RDF::SetBulkSize(const ROOT::RDF::RNode &node, unsigned int bulkSize)
+{
+   node.GetLoopManager()->SetBulkSize(bulkSize);
+}
+
+/**
+ * \brief Time the nodes of the computation graph in the next event loops.
+ *
+ * \param node Any node of the computation graph.
+ * \param samplingPeriod One entry every samplingPeriod entries of each slot is timed.
+ */
+void ROOT::Internal::RDF::EnableProfiling(const ROOT::RDF::RNode &node, unsigned int samplingPeriod)
+{
+   node.GetLoopManager()->EnableProfiling(samplingPeriod);
+}
+
+/**
+ * \brief Return the profiler of the computation graph, null if profiling was not enabled.
+ *
+ * \param node Any node of the computation graph.
+ */
+ROOT::Internal::RDF::RProfiler *ROOT::Internal::RDF::GetProfiler(const ROOT::RDF::RNode &node)
+{
+   return node.GetLoopManager()->GetProfiler();
+}
+
+/**
+ * \brief Return the source of a standalone program that runs the computation graph without jitting.
+ *
+ * \param node Any node of the computation graph.
+ * \param includes Headers to include in the program, e.g. those that declare functions used in the expressions.
+ */
+std::string
+ROOT::Internal::RDF::GenerateStandaloneSource(const ROOT::RDF::RNode &node, const std::vector<std::string> &includes)
+{
+   auto &lm = *node.GetLoopManager();
+   return lm.GetCodeRecorder().GenerateSource(lm, includes);
+}
+
 /**
  * \brief Trigger the execution of an RDataFrame computation graph.
  * \param[in] node A node of the computation graph (not a result).
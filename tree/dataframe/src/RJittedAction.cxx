@@ -73,6 +73,18 @@ void RJittedAction::Run(unsigned int slot, Long64_t entry)
    fConcreteAction->Run(slot, entry);
 }
 
+void RJittedAction::RunBulk(unsigned int slot, const RMaskedEntryRange &mask)
+{
+   assert(fConcreteAction != nullptr);
+   fConcreteAction->RunBulk(slot, mask);
+}
+
+bool RJittedAction::SupportsBulk() const
+{
+   assert(fConcreteAction != nullptr);
+   return fConcreteAction->SupportsBulk();
+}
+
 void RJittedAction::Initialize()
 {
    assert(fConcreteAction != nullptr);
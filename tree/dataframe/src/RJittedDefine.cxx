@@ -45,6 +45,18 @@ void RJittedDefine::Update(unsigned int slot, Long64_t entry)
    fConcreteDefine->Update(slot, entry);
 }
 
+void *RJittedDefine::UpdateBulk(unsigned int slot, const RDFInternal::RMaskedEntryRange &mask)
+{
+   assert(fConcreteDefine != nullptr);
+   return fConcreteDefine->UpdateBulk(slot, mask);
+}
+
+bool RJittedDefine::SupportsBulk() const
+{
+   assert(fConcreteDefine != nullptr);
+   return fConcreteDefine->SupportsBulk();
+}
+
 void RJittedDefine::Update(unsigned int slot, const ROOT::RDF::RSampleInfo &id)
 {
    assert(fConcreteDefine != nullptr);
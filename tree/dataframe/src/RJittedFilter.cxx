@@ -45,6 +45,7 @@ void RJittedFilter::SetFilter(std::unique_ptr<RFilterBase> f)
    // the concrete filter has been registered with RLoopManager on creation, so let's deregister ourselves
    fLoopManager->Deregister(this);
    fConcreteFilter = std::move(f);
+   fConcreteFilter->SetExpression(fExpression);
 }
 
 void RJittedFilter::InitSlot(TTreeReader *r, unsigned int slot)
@@ -59,6 +60,19 @@ bool RJittedFilter::CheckFilters(unsigned int slot, Long64_t entry)
    return fConcreteFilter->CheckFilters(slot, entry);
 }
 
+const RDFInternal::RMaskedEntryRange &
+RJittedFilter::CheckFiltersBulk(unsigned int slot, const RDFInternal::RMaskedEntryRange &mask)
+{
+   assert(fConcreteFilter != nullptr);
+   return fConcreteFilter->CheckFiltersBulk(slot, mask);
+}
+
+bool RJittedFilter::SupportsBulk() const
+{
+   assert(fConcreteFilter != nullptr);
+   return fConcreteFilter->SupportsBulk();
+}
+
 void RJittedFilter::Report(ROOT::RDF::RCutFlowReport &cr) const
 {
    assert(fConcreteFilter != nullptr);
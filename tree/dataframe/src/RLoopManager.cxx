@@ -17,6 +17,7 @@
 #include "ROOT/RDF/RRangeBase.hxx"
 #include "ROOT/RDF/RVariationBase.hxx"
 #include "ROOT/RLogger.hxx"
+#include "ROOT/RVec.hxx" // EnableBufferPool
 #include "RtypesCore.h" // Long64_t
 #include "TStopwatch.h"
 #include "TBranchElement.h"
@@ -25,14 +26,17 @@
 #include "TEntryList.h"
 #include "TFile.h"
 #include "TFriendElement.h"
+#include "TLeaf.h"
 #include "TROOT.h" // IsImplicitMTEnabled
 #include "TTreeReader.h"
 #include "TTree.h" // For MaxTreeSizeRAII. Revert when #6640 will be solved.
+#include "TTreeCache.h"
 
 #ifdef R__USE_IMT
 #include "ROOT/TThreadExecutor.hxx"
 #include "ROOT/TTreeProcessorMT.hxx"
 #include "ROOT/RSlotStack.hxx"
+#include "ROOT/RTaskTracer.hxx"
 #endif
 
 #include <algorithm>
@@ -307,13 +311,57 @@ static auto MakeDatasetColReadersKey(const std::string &colName, const std::type
    //    df.Sum<RVecI>("stdVectorBranch");
    return colName + ':' + ti.name();
 }
+
+/// Whether RDataFrame can deactivate the unused branches of the tree. This is not the case if users deactivate some
+/// branches themselves, or if some friends are indexed, as the indices read arbitrary branches of the main tree.
+bool CanPruneBranches(TTree &t)
+{
+   for (TObject *leaf : *t.GetListOfLeaves()) {
+      if (static_cast<TLeaf *>(leaf)->GetBranch()->TestBit(kDoNotProcess))
+         return false;
+   }
+   if (auto *friends = t.GetListOfFriends()) {
+      for (TObject *fe : *friends) {
+         auto *friendTree = static_cast<TFriendElement *>(fe)->GetTree();
+         if (friendTree == nullptr)
+            continue;
+         if (friendTree->GetTreeIndex() != nullptr)
+            return false;
+         if (friendTree->GetTree() != nullptr && !CanPruneBranches(*friendTree->GetTree()))
+            return false;
+      }
+   }
+   return true;
+}
+
+/// Activate branch `b` together with everything that is needed to read it: its sub-branches, the branches it is a
+/// sub-branch of and the branches that store the sizes of its leaves.
+void ActivateBranch(TBranch &b)
+{
+   b.ResetBit(kDoNotProcess);
+   for (TObject *leaf : *b.GetListOfLeaves()) {
+      if (auto *leafCount = static_cast<TLeaf *>(leaf)->GetLeafCount())
+         leafCount->GetBranch()->ResetBit(kDoNotProcess);
+   }
+   for (TObject *subBranch : *b.GetListOfBranches())
+      ActivateBranch(*static_cast<TBranch *>(subBranch));
+
+   TBranch *mother = b.GetMother();
+   for (TBranch *parent = &b; mother && parent && parent != mother;) {
+      parent = mother->GetSubBranch(parent);
+      if (parent)
+         parent->ResetBit(kDoNotProcess);
+   }
+}
 } // anonymous namespace
 
 namespace ROOT {
 namespace Detail {
 namespace RDF {
 
-/// A RAII object that calls RLoopManager::CleanUpTask at destruction
+/// A RAII object that calls RLoopManager::CleanUpTask at destruction.
+/// It also enables the RVec buffer pool of the thread for the duration of the task, so that the RVecs created and
+/// destroyed at every entry (e.g. the results of Defines and their temporaries) reuse their heap buffers.
 struct RCallCleanUpTask {
    RLoopManager &fLoopManager;
    unsigned int fArg;
@@ -322,8 +370,13 @@ struct RCallCleanUpTask {
    RCallCleanUpTask(RLoopManager &lm, unsigned int arg = 0u, TTreeReader *reader = nullptr)
       : fLoopManager(lm), fArg(arg), fReader(reader)
    {
+      ROOT::Internal::VecOps::EnableBufferPool();
+   }
+   ~RCallCleanUpTask()
+   {
+      fLoopManager.CleanUpTask(fReader, fArg);
+      ROOT::Internal::VecOps::DisableBufferPool();
    }
-   ~RCallCleanUpTask() { fLoopManager.CleanUpTask(fReader, fArg); }
 };
 
 } // namespace RDF
@@ -453,16 +506,19 @@ void RLoopManager::RunEmptySourceMT()
 
    // Each task will generate a subrange of entries
    auto genFunction = [this, &slotStack](const std::pair<ULong64_t, ULong64_t> &range) {
+      ROOT::Experimental::RTaskTracer::RScope traceScope("RDataFrame", "ProcessEntryRange", range.second - range.first);
       ROOT::Internal::RSlotStackRAII slotRAII(slotStack);
       auto slot = slotRAII.fSlot;
       RCallCleanUpTask cleanup(*this, slot);
       InitNodeSlots(nullptr, slot);
       R__LOG_DEBUG(0, RDFLogChannel()) << LogRangeProcessing({"an empty source", range.first, range.second, slot});
+      RMaskedEntryRange block(GetBulkSize(), /*blockId=*/0);
       try {
          UpdateSampleInfo(slot, range);
          for (auto currEntry = range.first; currEntry < range.second; ++currEntry) {
-            RunAndCheckFilters(slot, currEntry);
+            ProcessEntry(slot, currEntry, block);
          }
+         RunAndCheckFiltersBulk(slot, block);
       } catch (...) {
          // Error might throw in experiment frameworks like CMSSW
          std::cerr << "RDataFrame::Run: event loop was interrupted\n";
@@ -483,12 +539,14 @@ void RLoopManager::RunEmptySource()
    R__LOG_DEBUG(0, RDFLogChannel()) << LogRangeProcessing(
       {"an empty source", fEmptyEntryRange.first, fEmptyEntryRange.second, 0u});
    RCallCleanUpTask cleanup(*this);
+   RMaskedEntryRange block(GetBulkSize(), /*blockId=*/0);
    try {
       UpdateSampleInfo(/*slot*/ 0, fEmptyEntryRange);
       for (ULong64_t currEntry = fEmptyEntryRange.first;
            currEntry < fEmptyEntryRange.second && fNStopsReceived < fNChildren; ++currEntry) {
-         RunAndCheckFilters(0, currEntry);
+         ProcessEntry(0, currEntry, block);
       }
+      RunAndCheckFiltersBulk(0, block);
    } catch (...) {
       std::cerr << "RDataFrame::Run: event loop was interrupted\n";
       throw;
@@ -502,14 +560,15 @@ void RLoopManager::RunTreeProcessorMT()
    if (fEndEntry == fBeginEntry) // empty range => no work needed
       return;
    ROOT::Internal::RSlotStack slotStack(fNSlots);
-   const auto &entryList = fTree->GetEntryList() ? *fTree->GetEntryList() : TEntryList();
-   auto tp = (fBeginEntry != 0 || fEndEntry != std::numeric_limits<Long64_t>::max())
-                ? std::make_unique<ROOT::TTreeProcessorMT>(*fTree, fNSlots, std::make_pair(fBeginEntry, fEndEntry))
-                : std::make_unique<ROOT::TTreeProcessorMT>(*fTree, entryList, fNSlots);
+   // the processor was possibly created already by Run(), to retrieve clusters while jitting
+   auto tp = std::move(fTreeProcessor);
+   if (!tp)
+      tp = MakeTreeProcessor();
 
    std::atomic<ULong64_t> entryCount(0ull);
 
    tp->Process([this, &slotStack, &entryCount](TTreeReader &r) -> void {
+      ROOT::Experimental::RTaskTracer::RScope traceScope("RDataFrame", "ProcessEntryRange");
       ROOT::Internal::RSlotStackRAII slotRAII(slotStack);
       auto slot = slotRAII.fSlot;
       RCallCleanUpTask cleanup(*this, slot, &r);
@@ -517,15 +576,20 @@ void RLoopManager::RunTreeProcessorMT()
       R__LOG_DEBUG(0, RDFLogChannel()) << LogRangeProcessing(TreeDatasetLogInfo(r, slot));
       const auto entryRange = r.GetEntriesRange(); // we trust TTreeProcessorMT to call SetEntriesRange
       const auto nEntries = entryRange.second - entryRange.first;
+      traceScope.SetPayload(nEntries);
       auto count = entryCount.fetch_add(nEntries);
+      RMaskedEntryRange block(GetBulkSize(), /*blockId=*/0);
       try {
          // recursive call to check filters and conditionally execute actions
          while (r.Next()) {
             if (fNewSampleNotifier.CheckFlag(slot)) {
                UpdateSampleInfo(slot, r);
+               PruneBranches(slot, r);
+               UpdateFilterDecisions(slot, r);
             }
-            RunAndCheckFilters(slot, count++);
+            ProcessEntry(slot, count++, block);
          }
+         RunAndCheckFiltersBulk(slot, block);
       } catch (...) {
          std::cerr << "RDataFrame::Run: event loop was interrupted\n";
          throw;
@@ -541,6 +605,17 @@ void RLoopManager::RunTreeProcessorMT()
 #endif // no-op otherwise (will not be called)
 }
 
+#ifdef R__USE_IMT
+/// Create the TTreeProcessorMT that runs the multi-thread event loop over the input TTree or TChain.
+std::shared_ptr<ROOT::TTreeProcessorMT> RLoopManager::MakeTreeProcessor()
+{
+   const auto &entryList = fTree->GetEntryList() ? *fTree->GetEntryList() : TEntryList();
+   return (fBeginEntry != 0 || fEndEntry != std::numeric_limits<Long64_t>::max())
+             ? std::make_shared<ROOT::TTreeProcessorMT>(*fTree, fNSlots, std::make_pair(fBeginEntry, fEndEntry))
+             : std::make_shared<ROOT::TTreeProcessorMT>(*fTree, entryList, fNSlots);
+}
+#endif
+
 /// Run event loop over one or multiple ROOT files, in sequence.
 void RLoopManager::RunTreeReader()
 {
@@ -560,13 +635,17 @@ void RLoopManager::RunTreeReader()
 
    // recursive call to check filters and conditionally execute actions
    // in the non-MT case processing can be stopped early by ranges, hence the check on fNStopsReceived
+   RMaskedEntryRange block(GetBulkSize(), /*blockId=*/0);
    try {
       while (r.Next() && fNStopsReceived < fNChildren) {
          if (fNewSampleNotifier.CheckFlag(0)) {
             UpdateSampleInfo(/*slot*/0, r);
+            PruneBranches(/*slot*/0, r);
+            UpdateFilterDecisions(/*slot*/0, r);
          }
-         RunAndCheckFilters(0, r.GetCurrentEntry());
+         ProcessEntry(0, r.GetCurrentEntry(), block);
       }
+      RunAndCheckFiltersBulk(0, block);
    } catch (...) {
       std::cerr << "RDataFrame::Run: event loop was interrupted\n";
       throw;
@@ -588,6 +667,7 @@ void RLoopManager::RunDataSource()
       InitNodeSlots(nullptr, 0u);
       fDataSource->InitSlot(0u, 0ull);
       RCallCleanUpTask cleanup(*this);
+      RMaskedEntryRange block(GetBulkSize(), /*blockId=*/0);
       try {
          for (const auto &range : ranges) {
             const auto start = range.first;
@@ -595,10 +675,11 @@ void RLoopManager::RunDataSource()
             R__LOG_DEBUG(0, RDFLogChannel()) << LogRangeProcessing({fDataSource->GetLabel(), start, end, 0u});
             for (auto entry = start; entry < end && fNStopsReceived < fNChildren; ++entry) {
                if (fDataSource->SetEntry(0u, entry)) {
-                  RunAndCheckFilters(0u, entry);
+                  ProcessEntry(0u, entry, block);
                }
             }
          }
+         RunAndCheckFiltersBulk(0u, block);
       } catch (...) {
          std::cerr << "RDataFrame::Run: event loop was interrupted\n";
          throw;
@@ -619,6 +700,7 @@ void RLoopManager::RunDataSourceMT()
 
    // Each task works on a subrange of entries
    auto runOnRange = [this, &slotStack](const std::pair<ULong64_t, ULong64_t> &range) {
+      ROOT::Experimental::RTaskTracer::RScope traceScope("RDataFrame", "ProcessEntryRange", range.second - range.first);
       ROOT::Internal::RSlotStackRAII slotRAII(slotStack);
       const auto slot = slotRAII.fSlot;
       InitNodeSlots(nullptr, slot);
@@ -627,12 +709,14 @@ void RLoopManager::RunDataSourceMT()
       const auto start = range.first;
       const auto end = range.second;
       R__LOG_DEBUG(0, RDFLogChannel()) << LogRangeProcessing({fDataSource->GetLabel(), start, end, slot});
+      RMaskedEntryRange block(GetBulkSize(), /*blockId=*/0);
       try {
          for (auto entry = start; entry < end; ++entry) {
             if (fDataSource->SetEntry(slot, entry)) {
-               RunAndCheckFilters(slot, entry);
+               ProcessEntry(slot, entry, block);
             }
          }
+         RunAndCheckFiltersBulk(slot, block);
       } catch (...) {
          std::cerr << "RDataFrame::Run: event loop was interrupted\n";
          throw;
@@ -654,12 +738,12 @@ void RLoopManager::RunDataSourceMT()
 /// Named filters must be called even if the analysis logic would not require it, lest they report confusing results.
 void RLoopManager::RunAndCheckFilters(unsigned int slot, Long64_t entry)
 {
+   if (fProfiler)
+      fProfiler->StartEntry(slot);
+
    // data-block callbacks run before the rest of the graph
-   if (fNewSampleNotifier.CheckFlag(slot)) {
-      for (auto &callback : fSampleCallbacks)
-         callback.second(slot, fSampleInfos[slot]);
-      fNewSampleNotifier.UnsetFlag(slot);
-   }
+   if (fNewSampleNotifier.CheckFlag(slot))
+      RunSampleCallbacks(slot);
 
    for (auto *actionPtr : fBookedActions)
       actionPtr->Run(slot, entry);
@@ -669,6 +753,91 @@ void RLoopManager::RunAndCheckFilters(unsigned int slot, Long64_t entry)
       callback(slot);
 }
 
+/// Bulk version of RunAndCheckFilters: run the computation graph on the entries collected in the block, then empty
+/// the block. Callbacks registered with RegisterCallback are invoked after the whole block has been processed.
+void RLoopManager::RunAndCheckFiltersBulk(unsigned int slot, RMaskedEntryRange &block)
+{
+   if (block.Size() == 0)
+      return;
+
+   for (auto *actionPtr : fBookedActions)
+      actionPtr->RunBulk(slot, block);
+   for (auto *namedFilterPtr : fBookedNamedFilters)
+      namedFilterPtr->CheckFiltersBulk(slot, block);
+   for (auto &callback : fCallbacks) {
+      for (std::size_t i = 0; i < block.Size(); ++i)
+         callback(slot);
+   }
+
+   block.Reset(block.GetBlockId() + 1);
+}
+
+/// Process the current entry of the dataset: run the computation graph on it or, in bulk mode, stage the values of
+/// the dataset columns and add the entry to the block, which is processed as soon as it is full.
+/// Blocks never span multiple samples: the sample callbacks run between two blocks.
+void RLoopManager::ProcessEntry(unsigned int slot, Long64_t entry, RMaskedEntryRange &block)
+{
+   // fused event loops never run in bulk mode, so they do not need a block of their own
+   for (auto *lm : fFusedLoops)
+      lm->RunAndCheckFilters(slot, entry);
+
+   if (!fIsBulkActive) {
+      RunAndCheckFilters(slot, entry);
+      return;
+   }
+
+   if (fNewSampleNotifier.CheckFlag(slot)) {
+      RunAndCheckFiltersBulk(slot, block);
+      RunSampleCallbacks(slot);
+   }
+
+   block.Push(entry);
+   const auto idx = block.Size() - 1;
+   for (auto &reader : fStagedColumnReaders[slot])
+      reader.second->Stage(idx, entry);
+
+   if (block.IsFull())
+      RunAndCheckFiltersBulk(slot, block);
+}
+
+void RLoopManager::RunSampleCallbacks(unsigned int slot)
+{
+   for (auto &callback : fSampleCallbacks)
+      callback.second(slot, fSampleInfos[slot]);
+   fNewSampleNotifier.UnsetFlag(slot);
+}
+
+/// Check whether the event loop can run in bulk mode, if requested. Bulk processing falls back to entry-by-entry
+/// processing if the computation graph contains Ranges, systematic variations or nodes that cannot be evaluated in
+/// bulk, e.g. because the types of their input columns are not copy-assignable.
+bool RLoopManager::CheckBulkSupport()
+{
+   if (fBulkSize == 0)
+      return false;
+
+   auto noBulk = [](const auto *node) { return !node->SupportsBulk(); };
+   std::string reason;
+   if (fProfiler)
+      reason = "profiling is enabled";
+   else if (!fBookedRanges.empty())
+      reason = "Range is used";
+   else if (!fBookedVariations.empty())
+      reason = "systematic variations are used";
+   else if (std::any_of(fBookedActions.begin(), fBookedActions.end(), noBulk))
+      reason = "an action does not support it";
+   else if (std::any_of(fBookedFilters.begin(), fBookedFilters.end(), noBulk))
+      reason = "a Filter does not support it";
+   else if (std::any_of(fBookedDefines.begin(), fBookedDefines.end(), noBulk))
+      reason = "a Define does not support it";
+
+   if (!reason.empty()) {
+      R__LOG_WARNING(RDFLogChannel()) << "Bulk processing was requested but " << reason
+                                      << ": falling back to entry-by-entry processing.";
+      return false;
+   }
+   return true;
+}
+
 /// Build TTreeReaderValues for all nodes
 /// This method loops over all filters, actions and other booked objects and
 /// calls their `InitSlot` method, to get them ready for running a task.
@@ -686,6 +855,9 @@ void RLoopManager::InitNodeSlots(TTreeReader *r, unsigned int slot)
 
    for (auto &callback : fCallbacksOnce)
       callback(slot);
+
+   for (auto *lm : fFusedLoops)
+      lm->InitNodeSlots(r, slot);
 }
 
 void RLoopManager::SetupSampleCallbacks(TTreeReader *r, unsigned int slot) {
@@ -705,6 +877,109 @@ void RLoopManager::SetupSampleCallbacks(TTreeReader *r, unsigned int slot) {
 void RLoopManager::UpdateSampleInfo(unsigned int slot, const std::pair<ULong64_t, ULong64_t> &range) {
    fSampleInfos[slot] = RSampleInfo(
       "Empty source, range: {" + std::to_string(range.first) + ", " + std::to_string(range.second) + "}", range);
+   for (auto *lm : fFusedLoops)
+      lm->UpdateSampleInfo(slot, range);
+}
+
+/// Deactivate the branches of the current tree of the TTreeReader, and of its friends, that are not read by the
+/// computation graph. The branches that are needed are the ones of the dataset column readers created by the nodes
+/// in InitNodeSlots, so this must be called after that and every time the TTreeReader switches to a new tree.
+/// TTreeReader already adds the branches it reads to the TTreeCache of the main tree and stops its learning phase:
+/// here we do the same for the caches of friend trees that live in other files, which would otherwise train over
+/// the first entries. Branch statuses are restored at the end of the task.
+void RLoopManager::PruneBranches(unsigned int slot, TTreeReader &r)
+{
+   fPrunedTrees[slot] = nullptr;
+   auto *tree = r.GetTree()->GetTree();
+   if (tree == nullptr || !CanPruneBranches(*tree))
+      return;
+
+   // the fused event loops read the dataset through the same TTreeReader
+   std::vector<const RLoopManager *> loops{this};
+   loops.insert(loops.end(), fFusedLoops.begin(), fFusedLoops.end());
+   std::vector<TBranch *> usedBranches;
+   for (const auto *lm : loops) {
+      for (const auto &keyAndReader : lm->fDatasetColumnReaders[slot]) {
+         if (keyAndReader.second == nullptr) // a reader from a previous task
+            continue;
+         const auto &key = keyAndReader.first;
+         const auto colName = key.substr(0, key.rfind(':'));
+         TBranch *branch = tree->GetBranch(colName.c_str());
+         if (branch == nullptr) {
+            auto *leaf = tree->GetLeaf(colName.c_str());
+            branch = leaf ? leaf->GetBranch() : nullptr;
+         }
+         if (branch == nullptr) // we don't know what this column needs, better to read everything
+            return;
+         usedBranches.emplace_back(branch);
+      }
+   }
+
+   tree->SetBranchStatus("*", false); // this also deactivates the branches of the friends
+   for (auto *branch : usedBranches)
+      ActivateBranch(*branch);
+   fPrunedTrees[slot] = tree;
+
+   auto *friends = tree->GetListOfFriends();
+   if (friends == nullptr)
+      return;
+   for (TObject *fe : *friends) {
+      auto *friendTree = static_cast<TFriendElement *>(fe)->GetTree();
+      friendTree = friendTree ? friendTree->GetTree() : nullptr;
+      auto *friendFile = friendTree ? friendTree->GetCurrentFile() : nullptr;
+      if (friendFile == nullptr || friendFile == tree->GetCurrentFile())
+         continue;
+      auto *cache = friendTree->GetReadCache(friendFile, kTRUE);
+      if (cache == nullptr)
+         continue;
+      for (auto *branch : usedBranches)
+         if (branch->GetTree() == friendTree)
+            cache->AddBranch(branch, kTRUE);
+      friendTree->StopCacheLearningPhase();
+   }
+}
+
+/// Enable the cache of filter decisions for the next event loop, if a cache directory is set and the event loop can use
+/// it: the decisions are stored per entry of the input trees, so only event loops over TTrees are cached. Bulk event
+/// loops are not cached either, as their filters evaluate whole blocks of entries at once.
+void RLoopManager::InitFilterDecisionCache()
+{
+   const auto cacheDir = RDFInternal::GetFilterCacheDir();
+   const bool isTreeLoop = fLoopType == ELoopType::kROOTFiles || fLoopType == ELoopType::kROOTFilesMT;
+   const bool hasCacheableFilters = std::any_of(fBookedNamedFilters.begin(), fBookedNamedFilters.end(),
+                                                [](const RFilterBase *f) { return f->IsCacheable(); });
+   if (cacheDir.empty() || !isTreeLoop || fIsBulkActive || !hasCacheableFilters) {
+      fFilterDecisionCache.reset();
+      return;
+   }
+   // keep the decisions in memory across event loops, unless the cache directory changed
+   if (!fFilterDecisionCache || fFilterDecisionCache->GetDir() != cacheDir)
+      fFilterDecisionCache = std::make_unique<RDFInternal::RFilterDecisionCache>(cacheDir);
+   fFilterCacheTrees.assign(fNSlots, nullptr);
+}
+
+/// Hand the cached decisions for the entries of the current tree of the TTreeReader to the named filters.
+/// As PruneBranches, this must be called every time the TTreeReader switches to a new tree.
+void RLoopManager::UpdateFilterDecisions(unsigned int slot, TTreeReader &r)
+{
+   for (auto *lm : fFusedLoops)
+      lm->UpdateFilterDecisions(slot, r);
+   if (!fFilterDecisionCache)
+      return;
+
+   auto *tree = r.GetTree()->GetTree();
+   fFilterCacheTrees[slot] = tree;
+   for (auto *filter : fBookedNamedFilters) {
+      if (filter->IsCacheable())
+         filter->SetCachedDecisions(slot, tree ? fFilterDecisionCache->GetDecisions(filter->GetCacheKey(), *tree)
+                                               : nullptr);
+   }
+}
+
+Long64_t RLoopManager::GetFilterCacheEntry(unsigned int slot) const
+{
+   // the TTreeReader loads the entry in the current tree, also when reading a TChain
+   return fFilterCacheTrees[slot]->GetReadEntry();
 }
 
 void RLoopManager::UpdateSampleInfo(unsigned int slot, TTreeReader &r) {
@@ -722,6 +997,8 @@ void RLoopManager::UpdateSampleInfo(unsigned int slot, TTreeReader &r) {
    }
    const std::string &id = fname + '/' + treename;
    fSampleInfos[slot] = fSampleMap.empty() ? RSampleInfo(id, range) : RSampleInfo(id, range, fSampleMap[id]);
+   for (auto *lm : fFusedLoops)
+      lm->UpdateSampleInfo(slot, r);
 }
 
 /// Initialize all nodes of the functional graph before running the event loop.
@@ -737,6 +1014,21 @@ void RLoopManager::InitNodes()
       range->InitNode();
    for (auto *ptr : fBookedActions)
       ptr->Initialize();
+   InitProfiler();
+}
+
+/// Prepare the profiler, if profiling is enabled, to time the nodes of the computation graph in the next event loop.
+void RLoopManager::InitProfiler()
+{
+   if (!fProfiler)
+      return;
+   fProfiler->Reset(fNSlots);
+   for (auto *ptr : fBookedActions)
+      fProfiler->RegisterNode(ptr, "Action", ptr->GetActionName());
+   for (auto *ptr : fBookedFilters)
+      fProfiler->RegisterNode(ptr, "Filter", ptr->GetName());
+   for (auto *ptr : fBookedDefines)
+      fProfiler->RegisterNode(ptr, "Define", ptr->GetName());
 }
 
 /// Perform clean-up operations. To be called at the end of each event loop.
@@ -762,13 +1054,26 @@ void RLoopManager::CleanUpNodes()
    fCallbacks.clear();
    fCallbacksOnce.clear();
    fSampleCallbacks.clear();
+   fIsBulkActive = false;
 }
 
 /// Perform clean-up operations. To be called at the end of each task execution.
 void RLoopManager::CleanUpTask(TTreeReader *r, unsigned int slot)
 {
-   if (r != nullptr)
+   if (r != nullptr) {
       fNewSampleNotifier.GetChainNotifyLink(slot).RemoveLink(*r->GetTree());
+      // the tree we pruned might have been deleted in the meantime if the TChain moved past its last entry,
+      // so we only compare the pointers before touching it
+      if (!fPrunedTrees.empty() && fPrunedTrees[slot] != nullptr && fPrunedTrees[slot] == r->GetTree()->GetTree())
+         fPrunedTrees[slot]->SetBranchStatus("*", true);
+   }
+   if (!fPrunedTrees.empty())
+      fPrunedTrees[slot] = nullptr;
+   if (fFilterDecisionCache) {
+      fFilterCacheTrees[slot] = nullptr;
+      for (auto *filter : fBookedNamedFilters)
+         filter->SetCachedDecisions(slot, nullptr);
+   }
    for (auto *ptr : fBookedActions)
       ptr->FinalizeSlot(slot);
    for (auto *ptr : fBookedFilters)
@@ -776,12 +1081,21 @@ void RLoopManager::CleanUpTask(TTreeReader *r, unsigned int slot)
    for (auto *ptr : fBookedDefines)
       ptr->FinalizeSlot(slot);
 
+   // the staged and profiled readers refer to the dataset column readers of this task
+   if (fIsBulkActive)
+      fStagedColumnReaders[slot].clear();
+   if (fProfiler)
+      fProfiler->ClearColumnReaders(slot);
+
    if (fLoopType == ELoopType::kROOTFiles || fLoopType == ELoopType::kROOTFilesMT) {
       // we are reading from a tree/chain and we need to re-create the RTreeColumnReaders at every task
       // because the TTreeReader object changes at every task
       for (auto &v : fDatasetColumnReaders[slot])
          v.second.reset();
    }
+
+   for (auto *lm : fFusedLoops)
+      lm->CleanUpTask(r, slot);
 }
 
 /// Add RDF nodes that require just-in-time compilation to the computation graph.
@@ -794,13 +1108,19 @@ void RLoopManager::Jit()
    const std::string code = std::move(GetCodeToJit());
    if (code.empty()) {
       R__LOG_INFO(RDFLogChannel()) << "Nothing to jit and execute.";
+      if (fProfiler)
+         fProfiler->SetJitTime(0.);
       return;
    }
 
    TStopwatch s;
    s.Start();
-   RDFInternal::InterpreterCalc(code, "RLoopManager::Run");
+   const auto cacheDir = RDFInternal::GetJitCacheDir();
+   if (cacheDir.empty() || !RDFInternal::InterpreterCalcCached(code, cacheDir))
+      RDFInternal::InterpreterCalc(code, "RLoopManager::Run");
    s.Stop();
+   if (fProfiler)
+      fProfiler->SetJitTime(s.RealTime());
    R__LOG_INFO(RDFLogChannel()) << "Just-in-time compilation phase completed"
                                 << (s.RealTime() > 1e-3 ? " in " + std::to_string(s.RealTime()) + " seconds."
                                                         : " in less than 1ms.");
@@ -832,10 +1152,39 @@ void RLoopManager::Run(bool jit)
 
    ThrowIfNSlotsChanged(GetNSlots());
 
+   fTreeProcessor.reset();
+#ifdef R__USE_IMT
+   // jitting can take long: in the meantime, open the first input files and retrieve their clusters
+   if (jit && fLoopType == ELoopType::kROOTFilesMT && fBeginEntry != fEndEntry) {
+      bool hasCodeToJit = false;
+      {
+         R__LOCKGUARD(gROOTMutex);
+         hasCodeToJit = !GetCodeToJit().empty();
+      }
+      if (hasCodeToJit) {
+         fTreeProcessor = MakeTreeProcessor();
+         fTreeProcessor->Prefetch();
+      }
+   }
+#endif
+
    if (jit)
       Jit();
 
+   fIsBulkActive = CheckBulkSupport();
+   if (fIsBulkActive)
+      fStagedColumnReaders.resize(fNSlots);
+   if (fLoopType == ELoopType::kROOTFiles || fLoopType == ELoopType::kROOTFilesMT)
+      fPrunedTrees.assign(fNSlots, nullptr);
+
    InitNodes();
+   InitFilterDecisionCache();
+   for (auto *lm : fFusedLoops) {
+      ThrowIfNSlotsChanged(lm->GetNSlots());
+      lm->fIsBulkActive = false;
+      lm->InitNodes();
+      lm->InitFilterDecisionCache();
+   }
 
    TStopwatch s;
    s.Start();
@@ -848,8 +1197,21 @@ void RLoopManager::Run(bool jit)
    case ELoopType::kDataSource: RunDataSource(); break;
    }
    s.Stop();
+   if (fProfiler)
+      fProfiler->SetEventLoopTime(s.RealTime(), s.CpuTime());
+   if (fFilterDecisionCache)
+      fFilterDecisionCache->Save();
 
    CleanUpNodes();
+   for (auto *lm : fFusedLoops) {
+      if (lm->fProfiler)
+         lm->fProfiler->SetEventLoopTime(s.RealTime(), s.CpuTime());
+      if (lm->fFilterDecisionCache)
+         lm->fFilterDecisionCache->Save();
+      lm->CleanUpNodes();
+      lm->fNRuns++;
+   }
+   fFusedLoops.clear();
 
    fNRuns++;
 
@@ -857,6 +1219,50 @@ void RLoopManager::Run(bool jit)
                                 << s.RealTime() << "s elapsed).";
 }
 
+/// Whether the event loop of `other` can be fused with the one of this loop manager, i.e. whether the two loop
+/// managers process the same entries of the same TTree/TChain or empty source. Data sources are not supported, as
+/// their column readers cannot be shared, nor are Ranges, which can stop the event loop early.
+bool RLoopManager::HasSameDataset(const RLoopManager &other) const
+{
+   if (this == &other || fLoopType != other.fLoopType || fDataSource || other.fDataSource)
+      return false;
+   if (!fBookedRanges.empty() || !other.fBookedRanges.empty())
+      return false;
+   if (!fTree || !other.fTree)
+      return !fTree && !other.fTree && fEmptyEntryRange == other.fEmptyEntryRange;
+
+   if (fBeginEntry != other.fBeginEntry || fEndEntry != other.fEndEntry)
+      return false;
+   if (fTree == other.fTree)
+      return true;
+   auto hasFriendsOrEntryList = [](TTree &t) {
+      return t.GetEntryList() != nullptr || (t.GetListOfFriends() && t.GetListOfFriends()->GetEntries() > 0);
+   };
+   if (hasFriendsOrEntryList(*fTree) || hasFriendsOrEntryList(*other.fTree))
+      return false;
+   return ROOT::Internal::TreeUtils::GetTreeFullPaths(*fTree) ==
+             ROOT::Internal::TreeUtils::GetTreeFullPaths(*other.fTree) &&
+          ROOT::Internal::TreeUtils::GetFileNamesFromTree(*fTree) ==
+             ROOT::Internal::TreeUtils::GetFileNamesFromTree(*other.fTree);
+}
+
+/// Run the next event loop of `other` together with the next event loop of this loop manager, reading the dataset
+/// only once: the nodes of `other` are initialized with the TTreeReaders of this loop manager and every entry is
+/// processed by both computation graphs. `other` must not be run on its own until Run has been called on this loop
+/// manager. Precondition: HasSameDataset(other) is true.
+void RLoopManager::FuseEventLoopWith(RLoopManager &other)
+{
+   R__ASSERT(HasSameDataset(other) && other.fFusedLoops.empty());
+   fFusedLoops.emplace_back(&other);
+}
+
+/// Time the nodes of the computation graph in the next event loops, one entry every `samplingPeriod` entries of each
+/// slot. Profiling disables bulk processing. See ROOT::RDF::Experimental::EnableProfiling.
+void RLoopManager::EnableProfiling(unsigned int samplingPeriod)
+{
+   fProfiler = std::make_unique<RDFInternal::RProfiler>(samplingPeriod);
+}
+
 /// Return the list of default columns -- empty if none was provided when constructing the RDataFrame
 const ColumnNames_t &RLoopManager::GetDefaultColumnNames() const
 {
@@ -1072,6 +1478,31 @@ RLoopManager::GetDatasetColumnReader(unsigned int slot, const std::string &col,
       return nullptr;
 }
 
+/// \brief Register a new RStagedColumnReader with this RLoopManager, used in bulk mode.
+/// \return A pointer to the inserted column reader.
+RColumnReaderBase *RLoopManager::AddStagedColumnReader(unsigned int slot, const std::string &col,
+                                                       std::unique_ptr<RStagedColumnReaderBase> &&reader,
+                                                       const std::type_info &ti)
+{
+   auto &readers = fStagedColumnReaders[slot];
+   const auto key = MakeDatasetColReadersKey(col, ti);
+   assert(readers.find(key) == readers.end());
+   auto *rptr = reader.get();
+   readers[key] = std::move(reader);
+   return rptr;
+}
+
+RColumnReaderBase *
+RLoopManager::GetStagedColumnReader(unsigned int slot, const std::string &col, const std::type_info &ti) const
+{
+   const auto key = MakeDatasetColReadersKey(col, ti);
+   auto it = fStagedColumnReaders[slot].find(key);
+   if (it != fStagedColumnReaders[slot].end())
+      return it->second.get();
+   else
+      return nullptr;
+}
+
 void RLoopManager::AddSampleCallback(void *nodePtr, SampleCallback_t &&callback)
 {
    if (callback)
@@ -25,6 +25,7 @@
 
 #include <TError.h>
 
+#include <algorithm>
 #include <string>
 #include <vector>
 #include <typeinfo>
@@ -117,11 +118,21 @@ class RNTupleColumnReader : public ROOT::Detail::RDF::RColumnReaderBase {
    std::unique_ptr<RFieldBase> fField; ///< The field backing the RDF column
    RFieldBase::RValue fValue;          ///< The memory location used to read from fField
    Long64_t fLastEntry;                ///< Last entry number that was read
+   /// Set if fField is an RVec of a simple item type, whose items can be handed out without copying
+   ROOT::Experimental::RRVecField *fRVecField = nullptr;
+   /// Non-owning RVec pointing into the current page of the item column; used instead of fValue if fLastIsView
+   std::unique_ptr<RFieldBase::RValue> fViewValue;
+   bool fLastIsView = false;
 
 public:
    RNTupleColumnReader(std::unique_ptr<RFieldBase> f)
       : fField(std::move(f)), fValue(fField->GenerateValue()), fLastEntry(-1)
    {
+      auto rvecField = dynamic_cast<ROOT::Experimental::RRVecField *>(fField.get());
+      if (rvecField && rvecField->GetSubFields()[0]->IsSimple()) {
+         fRVecField = rvecField;
+         fViewValue = std::make_unique<RFieldBase::RValue>(fField->GenerateValue());
+      }
    }
    ~RNTupleColumnReader() = default;
 
@@ -142,10 +153,13 @@ public:
    void *GetImpl(Long64_t entry) final
    {
       if (entry != fLastEntry) {
-         fValue.Read(entry);
+         // Collections of simple types that do not cross a page boundary are exposed as RVec views into the page
+         fLastIsView = fRVecField && fRVecField->ReadAsView(entry, fViewValue->GetRawPtr());
+         if (!fLastIsView)
+            fValue.Read(entry);
          fLastEntry = entry;
       }
-      return fValue.GetRawPtr();
+      return fLastIsView ? fViewValue->GetRawPtr() : fValue.GetRawPtr();
    }
 };
 
@@ -300,27 +314,73 @@ bool RNTupleDS::SetEntry(unsigned int, ULong64_t)
 
 std::vector<std::pair<ULong64_t, ULong64_t>> RNTupleDS::GetEntryRanges()
 {
-   // TODO(jblomer): use cluster boundaries for the entry ranges
    std::vector<std::pair<ULong64_t, ULong64_t>> ranges;
    if (fHasSeenAllRanges)
       return ranges;
 
-   auto nEntries = fSources[0]->GetNEntries();
-   const auto chunkSize = nEntries / fNSlots;
-   const auto reminder = 1U == fNSlots ? 0 : nEntries % fNSlots;
-   auto start = 0UL;
-   auto end = 0UL;
-   for (auto i : ROOT::TSeqU(fNSlots)) {
-      start = end;
-      end += chunkSize;
-      ranges.emplace_back(start, end);
-      (void)i;
+   // One range per cluster: the ranges are distributed dynamically among the slots by RDataFrame's task
+   // scheduler, which balances the load if some clusters are slower to process than others.
+   fClusterRanges.clear();
+   {
+      auto descriptorGuard = fSources[0]->GetSharedDescriptorGuard();
+      for (const auto &clusterDesc : descriptorGuard->GetClusterIterable()) {
+         if (clusterDesc.GetNEntries() == 0)
+            continue;
+         const bool isSkipped = std::any_of(
+            fClusterRangeFilters.begin(), fClusterRangeFilters.end(), [&clusterDesc](const RClusterRangeFilter &f) {
+               return clusterDesc.ContainsColumn(f.fPhysicalColumnId) &&
+                      !clusterDesc.GetColumnRange(f.fPhysicalColumnId).fStatistics.MayContain(f.fMin, f.fMax);
+            });
+         if (isSkipped)
+            continue;
+         const ULong64_t first = clusterDesc.GetFirstEntryIndex();
+         fClusterRanges.emplace_back(first, first + clusterDesc.GetNEntries());
+      }
    }
-   ranges.back().second += reminder;
+   std::sort(fClusterRanges.begin(), fClusterRanges.end());
+
+   ranges = fClusterRanges;
    fHasSeenAllRanges = true;
    return ranges;
 }
 
+void RNTupleDS::AddClusterRangeFilter(std::string_view fieldName, double min, double max)
+{
+   auto descriptorGuard = fSources[0]->GetSharedDescriptorGuard();
+   const auto fieldId = descriptorGuard->FindFieldId(fieldName);
+   if (fieldId == kInvalidDescriptorId)
+      throw RException(R__FAIL("no field named '" + std::string(fieldName) + "' in RNTuple"));
+   const auto columnId = descriptorGuard->FindPhysicalColumnId(fieldId, 0);
+   if (columnId == kInvalidDescriptorId)
+      throw RException(R__FAIL("field '" + std::string(fieldName) + "' has no columns"));
+   fClusterRangeFilters.push_back({columnId, min, max});
+}
+
+void RNTupleDS::InitSlot(unsigned int slot, ULong64_t firstEntry)
+{
+   // With a single slot, there is only one page source and read-ahead across ranges is beneficial, unless clusters
+   // are skipped
+   if (fNSlots < 2 && fClusterRangeFilters.empty())
+      return;
+
+   auto itr = std::lower_bound(fClusterRanges.begin(), fClusterRanges.end(), firstEntry,
+                               [](const std::pair<ULong64_t, ULong64_t> &range, ULong64_t entry) {
+                                  return range.first < entry;
+                               });
+   if (itr == fClusterRanges.end() || itr->first != firstEntry)
+      return;
+
+   Detail::RPageSource::REntryRange entryRange;
+   entryRange.fFirstEntry = itr->first;
+   entryRange.fNEntries = itr->second - itr->first;
+   fSources[slot]->SetEntryRange(entryRange);
+}
+
+void RNTupleDS::FinalizeSlot(unsigned int slot)
+{
+   fSources[slot]->SetEntryRange(Detail::RPageSource::REntryRange());
+}
+
 std::string RNTupleDS::GetTypeName(std::string_view colName) const
 {
    const auto index = std::distance(fColumnNames.begin(), std::find(fColumnNames.begin(), fColumnNames.end(), colName));
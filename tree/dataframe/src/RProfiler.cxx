@@ -0,0 +1,218 @@
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include "ROOT/RDF/RProfiler.hxx"
+
+#include <algorithm>
+#include <sstream>
+
+namespace {
+std::string EscapeJSON(const std::string &s)
+{
+   std::string res;
+   res.reserve(s.size());
+   for (const char c : s) {
+      if (c == '"' || c == '\\')
+         res += '\\';
+      if (c == '\n')
+         res += "\\n";
+      else
+         res += c;
+   }
+   return res;
+}
+
+/// Frame names of folded stacks cannot contain the frame separator.
+std::string MakeFrameName(const std::string &kind, const std::string &name)
+{
+   auto frame = name.empty() ? kind : kind + " " + name;
+   std::replace(frame.begin(), frame.end(), ';', ',');
+   std::replace(frame.begin(), frame.end(), '\n', ' ');
+   return frame;
+}
+} // anonymous namespace
+
+namespace ROOT {
+namespace Internal {
+namespace RDF {
+
+void RProfiler::Reset(unsigned int nSlots)
+{
+   fSlots.clear();
+   for (auto i = 0u; i < nSlots; ++i)
+      fSlots.emplace_back(std::make_unique<RSlotData>());
+   fNodes.clear();
+   fNodeIds.clear();
+   fColumnIds.clear();
+   fEventLoopRealTime = 0.;
+   fEventLoopCpuTime = 0.;
+}
+
+unsigned int RProfiler::AddNode(std::string kind, std::string name)
+{
+   fNodes.emplace_back(RNodeInfo{std::move(kind), std::move(name)});
+   return fNodes.size() - 1;
+}
+
+void RProfiler::RegisterNode(const void *node, std::string kind, std::string name)
+{
+   if (fNodeIds.find(node) == fNodeIds.end())
+      fNodeIds[node] = AddNode(std::move(kind), std::move(name));
+}
+
+unsigned int RProfiler::RegisterColumn(const std::string &colName)
+{
+   std::lock_guard<std::mutex> lock(fColumnIdsMutex);
+   auto it = fColumnIds.find(colName);
+   if (it != fColumnIds.end())
+      return it->second;
+   const auto id = AddNode("Read", colName);
+   fColumnIds[colName] = id;
+   return id;
+}
+
+void RProfiler::Enter(unsigned int slot, unsigned int node)
+{
+   auto &data = *fSlots[slot];
+   const auto now = Clock_t::now();
+   unsigned int parent = 0u;
+   if (!data.fFrames.empty()) {
+      // the caller stops working until we return
+      auto &caller = data.fFrames.back();
+      data.fCallStacks[caller.fCallStack].fTimeNs +=
+         std::chrono::duration_cast<std::chrono::nanoseconds>(now - caller.fStart).count();
+      parent = caller.fCallStack;
+   }
+
+   const auto key = std::make_pair(parent, node);
+   auto it = data.fCallStackIds.find(key);
+   unsigned int callStack = 0u;
+   if (it == data.fCallStackIds.end()) {
+      callStack = data.fCallStacks.size();
+      data.fCallStacks.emplace_back(RCallStack{parent, node});
+      data.fCallStackIds.emplace(key, callStack);
+   } else {
+      callStack = it->second;
+   }
+   ++data.fCallStacks[callStack].fCalls;
+   data.fFrames.emplace_back(RFrame{callStack, Clock_t::now()});
+}
+
+void RProfiler::Exit(unsigned int slot)
+{
+   auto &data = *fSlots[slot];
+   const auto now = Clock_t::now();
+   const auto &frame = data.fFrames.back();
+   data.fCallStacks[frame.fCallStack].fTimeNs +=
+      std::chrono::duration_cast<std::chrono::nanoseconds>(now - frame.fStart).count();
+   data.fFrames.pop_back();
+   if (!data.fFrames.empty())
+      data.fFrames.back().fStart = now; // the caller resumes working
+}
+
+ROOT::Detail::RDF::RColumnReaderBase *RProfiler::GetColumnReader(unsigned int slot, const std::string &key) const
+{
+   const auto &readers = fSlots[slot]->fColumnReaders;
+   auto it = readers.find(key);
+   return it == readers.end() ? nullptr : it->second.get();
+}
+
+ROOT::Detail::RDF::RColumnReaderBase *
+RProfiler::AddColumnReader(unsigned int slot, const std::string &key,
+                           std::unique_ptr<ROOT::Detail::RDF::RColumnReaderBase> &&reader)
+{
+   auto *rptr = reader.get();
+   fSlots[slot]->fColumnReaders[key] = std::move(reader);
+   return rptr;
+}
+
+/// Time spent in the node by the slot, extrapolated from the sampled entries to all the entries of the slot.
+double RProfiler::GetEstimatedTime(unsigned int node, unsigned int slot) const
+{
+   const auto &data = *fSlots[slot];
+   if (data.fNSampledEntries == 0)
+      return 0.;
+   ULong64_t timeNs = 0;
+   for (const auto &callStack : data.fCallStacks) {
+      if (callStack.fNode == node)
+         timeNs += callStack.fTimeNs;
+   }
+   return timeNs * 1e-9 * data.fNEntries / data.fNSampledEntries;
+}
+
+/// Return the profile of the last event loop as a JSON object. Times are in seconds. The times of the nodes, which
+/// exclude the time spent in the nodes they call, are extrapolated from the sampled entries to all entries; "calls"
+/// counts the calls on sampled entries only.
+std::string RProfiler::ToJSON() const
+{
+   std::ostringstream os;
+   os << "{\"samplingPeriod\": " << fSamplingPeriod << ", \"jitTime\": " << fJitTime
+      << ", \"eventLoopRealTime\": " << fEventLoopRealTime << ", \"eventLoopCpuTime\": " << fEventLoopCpuTime
+      << ", \"slots\": [";
+   for (auto slot = 0u; slot < fSlots.size(); ++slot) {
+      os << (slot > 0 ? ", " : "") << "{\"entries\": " << fSlots[slot]->fNEntries
+         << ", \"sampledEntries\": " << fSlots[slot]->fNSampledEntries << "}";
+   }
+   os << "], \"nodes\": [";
+   bool isFirstNode = true;
+   for (auto node = 0u; node < fNodes.size(); ++node) {
+      ULong64_t calls = 0;
+      std::vector<double> slotTimes;
+      for (auto slot = 0u; slot < fSlots.size(); ++slot) {
+         for (const auto &callStack : fSlots[slot]->fCallStacks)
+            calls += callStack.fNode == node ? callStack.fCalls : 0;
+         slotTimes.emplace_back(GetEstimatedTime(node, slot));
+      }
+      if (calls == 0)
+         continue; // e.g. the placeholder of a jitted node: the actual node is profiled instead
+
+      os << (isFirstNode ? "" : ", ") << "{\"kind\": \"" << fNodes[node].fKind << "\", \"name\": \""
+         << EscapeJSON(fNodes[node].fName) << "\", \"calls\": " << calls;
+      double time = 0.;
+      for (const auto t : slotTimes)
+         time += t;
+      os << ", \"time\": " << time << ", \"slotTimes\": [";
+      for (auto slot = 0u; slot < slotTimes.size(); ++slot)
+         os << (slot > 0 ? ", " : "") << slotTimes[slot];
+      os << "]}";
+      isFirstNode = false;
+   }
+   os << "]}";
+   return os.str();
+}
+
+/// Return the profile of the last event loop in the "folded stacks" format of flame graph tools: one line per call
+/// stack, with the frames separated by semicolons, followed by the time spent in the innermost frame in nanoseconds.
+/// Only the time measured on sampled entries is reported.
+std::string RProfiler::ToFoldedStacks() const
+{
+   std::map<std::string, ULong64_t> stacks;
+   for (const auto &slotData : fSlots) {
+      const auto &callStacks = slotData->fCallStacks;
+      for (auto i = 1u; i < callStacks.size(); ++i) {
+         if (callStacks[i].fTimeNs == 0)
+            continue;
+         std::string stack;
+         for (auto cs = i; cs != 0u; cs = callStacks[cs].fParent) {
+            const auto &node = fNodes[callStacks[cs].fNode];
+            const auto frame = MakeFrameName(node.fKind, node.fName);
+            stack = stack.empty() ? frame : frame + ";" + stack;
+         }
+         stacks[stack] += callStacks[i].fTimeNs;
+      }
+   }
+
+   std::ostringstream os;
+   for (const auto &stack : stacks)
+      os << stack.first << ' ' << stack.second << '\n';
+   return os.str();
+}
+
+} // namespace RDF
+} // namespace Internal
+} // namespace ROOT
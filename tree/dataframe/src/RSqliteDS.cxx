@@ -333,20 +333,10 @@ struct RSqliteDSDataSet {
 };
 }
 
-RSqliteDS::Value_t::Value_t(RSqliteDS::ETypes type)
-   : fType(type), fIsActive(false), fInteger(0), fReal(0.0), fText(), fBlob(), fNull(nullptr)
-{
-   switch (type) {
-   case ETypes::kInteger: fPtr = &fInteger; break;
-   case ETypes::kReal: fPtr = &fReal; break;
-   case ETypes::kText: fPtr = &fText; break;
-   case ETypes::kBlob: fPtr = &fBlob; break;
-   case ETypes::kNull: fPtr = &fNull; break;
-   default: throw std::runtime_error("Internal error");
-   }
-}
+RSqliteDS::Value_t::Value_t(RSqliteDS::ETypes type) : fType(type), fIsActive(false), fNull(nullptr) {}
 
 constexpr char const *RSqliteDS::fgTypeNames[];
+constexpr unsigned int RSqliteDS::kBatchSizePerSlot;
 
 ////////////////////////////////////////////////////////////////////////////
 /// \brief Build the dataframe
@@ -355,7 +345,7 @@ constexpr char const *RSqliteDS::fgTypeNames[];
 ///
 /// The constructor opens the sqlite file, prepares the query engine and determines the column names and types.
 RSqliteDS::RSqliteDS(const std::string &fileName, const std::string &query)
-   : fDataSet(std::make_unique<Internal::RSqliteDSDataSet>()), fNSlots(0), fNRow(0)
+   : fDataSet(std::make_unique<Internal::RSqliteDSDataSet>()), fNSlots(0), fNRow(0), fBatchFirst(0), fIsDone(false)
 {
    static bool hasSqliteVfs = RegisterSqliteVfs();
    if (!hasSqliteVfs)
@@ -476,28 +466,84 @@ RDataSource::Record_t RSqliteDS::GetColumnReadersImpl(std::string_view name, con
       throw std::runtime_error(errmsg);
    }
 
-   fValues[index].fIsActive = true;
-   return std::vector<void *>{fNSlots, &fValues[index].fPtr};
+   auto &value = fValues[index];
+   value.fIsActive = true;
+   if (value.fPtrs.size() < fNSlots)
+      value.fPtrs.resize(fNSlots, nullptr);
+   std::vector<void *> ptrs;
+   for (unsigned int slot = 0; slot < fNSlots; ++slot)
+      ptrs.emplace_back(&value.fPtrs[slot]);
+   return ptrs;
 }
 
 ////////////////////////////////////////////////////////////////////////////
-/// Returns a range of size 1 as long as more rows are available in the SQL result set.
-/// This inherently serialized the RDF independent of the number of slots.
+/// Steps through the next batch of rows of the SQL result set and stores the values of the active columns.
+/// The batch is split in one range per slot.
 std::vector<std::pair<ULong64_t, ULong64_t>> RSqliteDS::GetEntryRanges()
 {
    std::vector<std::pair<ULong64_t, ULong64_t>> entryRanges;
-   int retval = sqlite3_step(fDataSet->fQuery);
-   switch (retval) {
-   case SQLITE_DONE: return entryRanges;
-   case SQLITE_ROW:
-      entryRanges.emplace_back(fNRow, fNRow + 1);
-      fNRow++;
+   // After SQLITE_DONE, a further sqlite3_step() would restart the query
+   if (fIsDone)
       return entryRanges;
-   default:
-      SqliteError(retval);
-      // Never here
-      abort();
+
+   const unsigned int nSlots = std::max(fNSlots, 1U);
+   const unsigned int maxRows = nSlots * kBatchSizePerSlot;
+   unsigned int nRows = 0;
+   while (nRows < maxRows) {
+      int retval = sqlite3_step(fDataSet->fQuery);
+      if (retval == SQLITE_DONE) {
+         fIsDone = true;
+         break;
+      }
+      if (retval != SQLITE_ROW)
+         SqliteError(retval);
+
+      const unsigned N = fValues.size();
+      for (unsigned i = 0; i < N; ++i) {
+         auto &value = fValues[i];
+         if (!value.fIsActive)
+            continue;
+
+         int nbytes;
+         switch (value.fType) {
+         case ETypes::kInteger:
+            value.fIntegers.resize(std::max<std::size_t>(value.fIntegers.size(), nRows + 1));
+            value.fIntegers[nRows] = sqlite3_column_int64(fDataSet->fQuery, i);
+            break;
+         case ETypes::kReal:
+            value.fReals.resize(std::max<std::size_t>(value.fReals.size(), nRows + 1));
+            value.fReals[nRows] = sqlite3_column_double(fDataSet->fQuery, i);
+            break;
+         case ETypes::kText:
+            value.fTexts.resize(std::max<std::size_t>(value.fTexts.size(), nRows + 1));
+            nbytes = sqlite3_column_bytes(fDataSet->fQuery, i);
+            if (nbytes == 0) {
+               value.fTexts[nRows] = "";
+            } else {
+               value.fTexts[nRows] = reinterpret_cast<const char *>(sqlite3_column_text(fDataSet->fQuery, i));
+            }
+            break;
+         case ETypes::kBlob:
+            value.fBlobs.resize(std::max<std::size_t>(value.fBlobs.size(), nRows + 1));
+            nbytes = sqlite3_column_bytes(fDataSet->fQuery, i);
+            value.fBlobs[nRows].resize(nbytes);
+            if (nbytes > 0) {
+               std::memcpy(value.fBlobs[nRows].data(), sqlite3_column_blob(fDataSet->fQuery, i), nbytes);
+            }
+            break;
+         case ETypes::kNull: break;
+         default: throw std::runtime_error("Unhandled column type");
+         }
+      }
+      ++nRows;
    }
+
+   fBatchFirst = fNRow;
+   fNRow += nRows;
+   const unsigned int rangeSize = (nRows + nSlots - 1) / nSlots;
+   for (ULong64_t start = fBatchFirst; start < fNRow; start += rangeSize)
+      entryRanges.emplace_back(start, std::min<ULong64_t>(start + rangeSize, fNRow));
+   return entryRanges;
 }
 
 ////////////////////////////////////////////////////////////////////////////
@@ -526,6 +572,8 @@ bool RSqliteDS::HasColumn(std::string_view colName) const
 void RSqliteDS::Initialize()
 {
    fNRow = 0;
+   fBatchFirst = 0;
+   fIsDone = false;
    int retval = sqlite3_reset(fDataSet->fQuery);
    if (retval != SQLITE_OK)
       throw std::runtime_error("SQlite error, reset");
@@ -547,36 +595,21 @@ RDataFrame FromSqlite(std::string_view fileName, std::string_view query)
 }
 
 ////////////////////////////////////////////////////////////////////////////
-/// Stores the result of the current active sqlite query row as a C++ value.
-bool RSqliteDS::SetEntry(unsigned int /* slot */, ULong64_t entry)
+/// Points the column readers of the slot to the values of the given row of the current batch.
+bool RSqliteDS::SetEntry(unsigned int slot, ULong64_t entry)
 {
-   assert(entry + 1 == fNRow);
-   (void)entry;
-   unsigned N = fValues.size();
-   for (unsigned i = 0; i < N; ++i) {
-      if (!fValues[i].fIsActive)
+   assert(entry >= fBatchFirst && entry < fNRow);
+   const auto row = entry - fBatchFirst;
+   for (auto &value : fValues) {
+      if (!value.fIsActive)
          continue;
 
-      int nbytes;
-      switch (fValues[i].fType) {
-      case ETypes::kInteger: fValues[i].fInteger = sqlite3_column_int64(fDataSet->fQuery, i); break;
-      case ETypes::kReal: fValues[i].fReal = sqlite3_column_double(fDataSet->fQuery, i); break;
-      case ETypes::kText:
-         nbytes = sqlite3_column_bytes(fDataSet->fQuery, i);
-         if (nbytes == 0) {
-            fValues[i].fText = "";
-         } else {
-            fValues[i].fText = reinterpret_cast<const char *>(sqlite3_column_text(fDataSet->fQuery, i));
-         }
-         break;
-      case ETypes::kBlob:
-         nbytes = sqlite3_column_bytes(fDataSet->fQuery, i);
-         fValues[i].fBlob.resize(nbytes);
-         if (nbytes > 0) {
-            std::memcpy(fValues[i].fBlob.data(), sqlite3_column_blob(fDataSet->fQuery, i), nbytes);
-         }
-         break;
-      case ETypes::kNull: break;
+      switch (value.fType) {
+      case ETypes::kInteger: value.fPtrs[slot] = &value.fIntegers[row]; break;
+      case ETypes::kReal: value.fPtrs[slot] = &value.fReals[row]; break;
+      case ETypes::kText: value.fPtrs[slot] = &value.fTexts[row]; break;
+      case ETypes::kBlob: value.fPtrs[slot] = &value.fBlobs[row]; break;
+      case ETypes::kNull: value.fPtrs[slot] = &value.fNull; break;
       default: throw std::runtime_error("Unhandled column type");
       }
    }
@@ -584,13 +617,9 @@ bool RSqliteDS::SetEntry(unsigned int /* slot */, ULong64_t entry)
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////
-/// Almost a no-op, many slots can in fact reduce the performance due to thread synchronization.
+/// Sets the number of slots among which the rows of a batch are distributed.
 void RSqliteDS::SetNSlots(unsigned int nSlots)
 {
-   if (nSlots > 1) {
-      ::Warning("SetNSlots", "Currently the SQlite data source faces performance degradation in multi-threaded mode. "
-                             "Consider turning off IMT.");
-   }
    fNSlots = nSlots;
 }
 
@@ -0,0 +1,193 @@
+#include <ROOT/RDataFrame.hxx>
+#include <ROOT/RDFHelpers.hxx>
+#include <TFile.h>
+#include <TSystem.h>
+#include <TTree.h>
+
+#include <gtest/gtest.h>
+
+// Backward compatibility for gtest version < 1.10.0
+#ifndef INSTANTIATE_TEST_SUITE_P
+#define INSTANTIATE_TEST_SUITE_P INSTANTIATE_TEST_CASE_P
+#endif
+
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
+// fixture that runs every test with and without implicit multi-threading
+struct RDFBulk : ::testing::TestWithParam<bool> {
+   // not a multiple of the bulk sizes used in the tests, so that the last block of each task is partially filled
+   static constexpr ULong64_t NENTRIES = 1001;
+
+   RDFBulk()
+   {
+      if (GetParam())
+         ROOT::EnableImplicitMT(4);
+   }
+
+   ~RDFBulk() override
+   {
+      if (GetParam())
+         ROOT::DisableImplicitMT();
+   }
+};
+
+// A RAII object that ensures the existence of a ROOT file with a TTree "t" with a `double` branch "x" and a `int`
+// branch "i", with values increasing with the entry number
+struct InputFileRAII {
+   std::string fFileName;
+
+   InputFileRAII(std::string fileName, ULong64_t nEntries) : fFileName(std::move(fileName))
+   {
+      TFile f(fFileName.c_str(), "recreate");
+      TTree t("t", "t");
+      double x = 0.;
+      int i = 0;
+      t.Branch("x", &x);
+      t.Branch("i", &i);
+      for (ULong64_t e = 0; e < nEntries; ++e) {
+         x = e * 0.5;
+         i = e;
+         t.Fill();
+      }
+      t.Write();
+   }
+
+   ~InputFileRAII() { gSystem->Unlink(fFileName.c_str()); }
+};
+
+TEST_P(RDFBulk, SumAndFilter)
+{
+   ROOT::RDataFrame df(NENTRIES);
+   ROOT::RDF::Experimental::EnableBulkProcessing(df, 16);
+   auto d = df.Define("x", [](ULong64_t e) { return double(e); }, {"rdfentry_"});
+   auto sum = d.Sum<double>("x");
+   auto sumEven = d.Filter([](double x) { return int(x) % 2 == 0; }, {"x"}).Sum<double>("x");
+   auto count = d.Filter([](double x) { return x > 100.; }, {"x"}).Count();
+
+   EXPECT_DOUBLE_EQ(*sum, NENTRIES * (NENTRIES - 1) / 2.);
+   EXPECT_DOUBLE_EQ(*sumEven, 500. * 501.);
+   EXPECT_EQ(*count, NENTRIES - 101);
+}
+
+TEST_P(RDFBulk, Histo1D)
+{
+   ROOT::RDataFrame df(NENTRIES);
+   ROOT::RDF::Experimental::EnableBulkProcessing(df, 64);
+   auto d = df.Define("x", [](ULong64_t e) { return double(e % 10); }, {"rdfentry_"})
+               .Define("w", [](double x) { return 2. * x; }, {"x"});
+   auto h = d.Histo1D<double>({"h", "h", 10, 0., 10.}, "x");
+   auto hw = d.Histo1D<double, double>({"hw", "hw", 10, 0., 10.}, "x", "w");
+   auto hNoModel = d.Filter([](double x) { return x < 5.; }, {"x"}).Histo1D<double>("x");
+
+   EXPECT_EQ(h->GetEntries(), NENTRIES);
+   EXPECT_EQ(h->GetBinContent(1), 101.);
+   EXPECT_EQ(h->GetBinContent(10), 100.);
+   EXPECT_DOUBLE_EQ(hw->GetBinContent(4), 6. * 100.);
+   EXPECT_EQ(hNoModel->GetEntries(), 501);
+   EXPECT_DOUBLE_EQ(hNoModel->GetMean(), (0. * 101 + (1. + 2. + 3. + 4.) * 100) / 501.);
+}
+
+TEST_P(RDFBulk, DefinesAreEvaluatedOnce)
+{
+   ROOT::RDataFrame df(NENTRIES);
+   ROOT::RDF::Experimental::EnableBulkProcessing(df, 32);
+   std::vector<ULong64_t> nCalls(df.GetNSlots(), 0);
+   auto d = df.DefineSlotEntry("x",
+                               [&nCalls](unsigned int slot, ULong64_t e) {
+                                  ++nCalls[slot];
+                                  return double(e);
+                               })
+               .Filter([](double x) { return x < 500.; }, {"x"});
+   // the two actions and the filter require the same values of x, that must be computed once per entry
+   auto sum = d.Sum<double>("x");
+   auto max = d.Max<double>("x");
+   auto xs = d.Take<double>("x");
+
+   EXPECT_DOUBLE_EQ(*sum, 500. * 499. / 2.);
+   EXPECT_DOUBLE_EQ(*max, 499.);
+   auto sorted = *xs;
+   std::sort(sorted.begin(), sorted.end());
+   ASSERT_EQ(sorted.size(), 500u);
+   for (std::size_t i = 0; i < sorted.size(); ++i)
+      EXPECT_DOUBLE_EQ(sorted[i], double(i));
+   EXPECT_EQ(std::accumulate(nCalls.begin(), nCalls.end(), ULong64_t(0)), NENTRIES);
+}
+
+TEST_P(RDFBulk, Report)
+{
+   ROOT::RDataFrame df(NENTRIES);
+   ROOT::RDF::Experimental::EnableBulkProcessing(df, 100);
+   auto d = df.Define("x", [](ULong64_t e) { return int(e); }, {"rdfentry_"})
+               .Filter([](int x) { return x % 2 == 0; }, {"x"}, "even")
+               .Filter([](int x) { return x % 3 == 0; }, {"x"}, "multipleOf3");
+   auto count = d.Count();
+   auto report = d.Report();
+
+   EXPECT_EQ(*count, 167u);
+   const auto &even = report->At("even");
+   EXPECT_EQ(even.GetAll(), NENTRIES);
+   EXPECT_EQ(even.GetPass(), 501u);
+   const auto &multipleOf3 = report->At("multipleOf3");
+   EXPECT_EQ(multipleOf3.GetAll(), 501u);
+   EXPECT_EQ(multipleOf3.GetPass(), 167u);
+}
+
+TEST_P(RDFBulk, DefinePerSample)
+{
+   ROOT::RDataFrame df(NENTRIES);
+   ROOT::RDF::Experimental::EnableBulkProcessing(df, 16);
+   auto sum = df.DefinePerSample("y", [](unsigned int, const ROOT::RDF::RSampleInfo &) { return 3; }).Sum<int>("y");
+   EXPECT_EQ(*sum, 3 * int(NENTRIES));
+}
+
+TEST_P(RDFBulk, TTree)
+{
+   InputFileRAII file("dataframe_bulk_ttree.root", NENTRIES);
+   ROOT::RDataFrame df("t", file.fFileName);
+   ROOT::RDF::Experimental::EnableBulkProcessing(df, 128);
+   auto f = df.Filter([](int i) { return i >= 10; }, {"i"});
+   auto sum = f.Sum<double>("x");
+   auto h = f.Histo1D<double>({"h", "h", 10, 0., 500.}, "x");
+   auto jittedSum = df.Filter("i < 10").Sum<int>("i");
+
+   EXPECT_DOUBLE_EQ(*sum, 0.5 * (NENTRIES * (NENTRIES - 1) / 2. - 45.));
+   EXPECT_EQ(h->GetEntries(), NENTRIES - 10);
+   EXPECT_EQ(*jittedSum, 45);
+}
+
+TEST_P(RDFBulk, FallbackToEntryByEntry)
+{
+   ROOT::RDataFrame df(NENTRIES);
+   ROOT::RDF::Experimental::EnableBulkProcessing(df, 16);
+   auto d = df.Define("x", [](ULong64_t e) { return double(e); }, {"rdfentry_"});
+   auto sum = d.Sum<double>("x");
+   auto count = d.Count();
+   // Ranges are not supported in bulk mode (and in multi-thread runs), the event loop must process entries one by one
+   if (!GetParam()) {
+      auto rangeSum = d.Range(10).Sum<double>("x");
+      EXPECT_DOUBLE_EQ(*rangeSum, 45.);
+   }
+   EXPECT_DOUBLE_EQ(*sum, NENTRIES * (NENTRIES - 1) / 2.);
+   EXPECT_EQ(*count, NENTRIES);
+}
+
+TEST_P(RDFBulk, MultipleRuns)
+{
+   ROOT::RDataFrame df(NENTRIES);
+   ROOT::RDF::Experimental::EnableBulkProcessing(df, 16);
+   auto d = df.Define("x", [](ULong64_t e) { return double(e); }, {"rdfentry_"});
+   auto sum1 = d.Sum<double>("x");
+   EXPECT_DOUBLE_EQ(*sum1, NENTRIES * (NENTRIES - 1) / 2.);
+   auto sum2 = d.Filter([](double x) { return x < 10.; }, {"x"}).Sum<double>("x");
+   EXPECT_DOUBLE_EQ(*sum2, 45.);
+}
+
+// run single-thread tests
+INSTANTIATE_TEST_SUITE_P(Seq, RDFBulk, ::testing::Values(false));
+
+// run multi-thread tests
+#ifdef R__USE_IMT
+INSTANTIATE_TEST_SUITE_P(MT, RDFBulk, ::testing::Values(true));
+#endif
@@ -136,6 +136,42 @@ TEST_F(RDFAndFriends, QualifiedBranchName)
       EXPECT_EQ(v, 2);
 }
 
+// The branches that are not read by the computation graph, in the main tree and in its friends, must be deactivated
+// during the event loop, and re-activated afterwards
+TEST_F(RDFAndFriends, UnusedBranchesAreInactive)
+{
+   TFile f1(kFile1);
+   auto t1 = f1.Get<TTree>("t");
+   t1->AddFriend("t2", kFile2);
+   t1->AddFriend("t3", kFile3);
+   ROOT::RDataFrame d(*t1);
+
+   std::vector<bool> statuses;
+   d.Define("first", [](const ROOT::RVecF &arr) { return arr[0]; }, {"arr"})
+      .Foreach(
+         [&](int x, float first) {
+            EXPECT_EQ(x, 1);
+            EXPECT_EQ(first, float(statuses.size() / 3));
+            statuses.push_back(t1->GetBranchStatus("x"));
+            statuses.push_back(t1->GetBranchStatus("arr"));
+            statuses.push_back(t1->GetBranchStatus("t2.y"));
+         },
+         {"x", "first"});
+   ASSERT_EQ(statuses.size(), 3 * kSizeSmall);
+   for (auto i = 0u; i < statuses.size(); i += 3) {
+      EXPECT_TRUE(statuses[i]);
+      EXPECT_TRUE(statuses[i + 1]);
+      EXPECT_FALSE(statuses[i + 2]);
+   }
+   EXPECT_TRUE(t1->GetBranchStatus("t2.y"));
+
+   // branches deactivated by users are left alone
+   t1->SetBranchStatus("t2.y", false);
+   EXPECT_EQ(*d.Max<int>("x"), 1);
+   EXPECT_TRUE(t1->GetBranchStatus("arr"));
+   EXPECT_FALSE(t1->GetBranchStatus("t2.y"));
+}
+
 TEST_F(RDFAndFriends, FromDefine)
 {
    TFile f1(kFile1);
@@ -3,7 +3,11 @@
 #include <ROOT/RDFHelpers.hxx>
 #include <ROOT/RVec.hxx>
 #include <ROOT/RDFHelpers.hxx>
+#include <ROOT/RLogger.hxx>
 #include <ROOT/RResultHandle.hxx>
+#include <TFile.h>
+#include <TH1D.h>
+#include <TInterpreter.h>
 #include <TSystem.h>
 #include <RConfigure.h>
 
@@ -656,6 +660,57 @@ TEST(RunGraphs, RunGraphsWithDisabledIMT)
    EXPECT_EQ(*r2, 3u);
 }
 
+TEST(RunGraphs, SharedEventLoop)
+{
+#ifdef R__USE_IMT
+   ROOT::EnableImplicitMT();
+#endif // R__USE_IMT
+
+   const auto fileName = "dataframe_helpers_rungraphs_shared.root";
+   ROOT::RDataFrame(10)
+      .Define("x", [](ULong64_t e) { return int(e); }, {"rdfentry_"})
+      .Snapshot<int>("t", fileName, {"x"});
+
+   // the two graphs read the same dataset and share an event loop, the third one reads only part of it
+   ROOT::RDataFrame df1("t", fileName);
+   ROOT::RDataFrame df2("t", fileName);
+   ROOT::RDataFrame df3("t", fileName);
+   auto r1 = df1.Sum<int>("x");
+   auto r2 = df2.Filter([](int x) { return x > 4; }, {"x"}).Count();
+   auto r3 = df3.Range(2).Sum<int>("x");
+   ROOT::RDataFrame df4(10);
+   auto r4 = df4.Count();
+
+   std::vector<RResultHandle> v;
+   v.emplace_back(r1);
+   v.emplace_back(r2);
+#ifdef R__USE_IMT
+   // Ranges are not supported in multi-thread event loops
+   if (!ROOT::IsImplicitMTEnabled())
+#endif
+      v.emplace_back(r3);
+   v.emplace_back(r4);
+   EXPECT_EQ(ROOT::RDF::RunGraphs(v), v.size());
+
+   for (auto &h : v)
+      EXPECT_TRUE(h.IsReady());
+   EXPECT_EQ(df1.GetNRuns(), 1u);
+   EXPECT_EQ(df2.GetNRuns(), 1u);
+   EXPECT_EQ(*r1, 45);
+   EXPECT_EQ(*r2, 5u);
+   if (r3.IsReady())
+      EXPECT_EQ(*r3, 1);
+   EXPECT_EQ(*r4, 10u);
+
+   // the graphs can still run their own event loops afterwards
+   auto r5 = df2.Sum<int>("x");
+   EXPECT_EQ(*r5, 45);
+   EXPECT_EQ(df1.GetNRuns(), 1u);
+   EXPECT_EQ(df2.GetNRuns(), 2u);
+
+   gSystem->Unlink(fileName);
+}
+
 TEST(RunGraphs, EmptyListOfHandles)
 {
 #ifdef R__USE_IMT
@@ -682,3 +737,257 @@ TEST(RunGraphs, AlreadyRun)
    ROOT_EXPECT_WARNING(ROOT::RDF::RunGraphs({r1, r2, r3, r4}), "RunGraphs",
                        "Got 4 handles from which 2 link to results which are already ready.");
 }
+
+TEST(RDFHelpers, Profiling)
+{
+   ROOT::RDataFrame df(100);
+   EXPECT_THROW(ROOT::RDF::Experimental::GetProfileJSON(df), std::runtime_error);
+
+   ROOT::RDF::Experimental::EnableProfiling(df, 4);
+   auto sum = df.Define("x", [](ULong64_t e) { return double(e); }, {"rdfentry_"})
+                 .Filter([](double x) { return x < 50.; }, {"x"}, "lowx")
+                 .Sum<double>("x");
+   EXPECT_DOUBLE_EQ(*sum, 49. * 50. / 2.);
+
+   const auto json = ROOT::RDF::Experimental::GetProfileJSON(df);
+   EXPECT_NE(json.find("\"samplingPeriod\": 4"), std::string::npos) << json;
+   EXPECT_NE(json.find("\"kind\": \"Define\", \"name\": \"x\""), std::string::npos) << json;
+   EXPECT_NE(json.find("\"kind\": \"Filter\", \"name\": \"lowx\""), std::string::npos) << json;
+   EXPECT_NE(json.find("\"kind\": \"Action\", \"name\": \"Sum\""), std::string::npos) << json;
+   // entries 0, 4, ..., 96 are sampled
+   EXPECT_NE(json.find("\"name\": \"x\", \"calls\": 25"), std::string::npos) << json;
+
+   // the Define is called by the Filter, which is called by the action
+   const auto stacks = ROOT::RDF::Experimental::GetProfileFoldedStacks(df);
+   EXPECT_NE(stacks.find("Action Sum;Filter lowx;Define x "), std::string::npos) << stacks;
+}
+
+namespace {
+/// Records the messages of the RDataFrame log channel
+class RRDFLogRecorder : public ROOT::Experimental::RLogHandler {
+public:
+   std::vector<std::string> fMessages;
+   bool Emit(const ROOT::Experimental::RLogEntry &entry) final
+   {
+      if (entry.fChannel != &ROOT::Detail::RDF::RDFLogChannel())
+         return true;
+      fMessages.emplace_back(entry.fMessage);
+      return false;
+   }
+   std::vector<std::string> Filter(const std::string &prefix) const
+   {
+      std::vector<std::string> result;
+      for (const auto &msg : fMessages) {
+         if (msg.rfind(prefix, 0) == 0)
+            result.emplace_back(msg.substr(prefix.size()));
+      }
+      return result;
+   }
+};
+} // anonymous namespace
+
+TEST(RDFHelpers, JitCache)
+{
+   const std::string cacheDir = "dataframe_helpers_jitcache";
+   ROOT::RDF::Experimental::SetJitCacheDir(cacheDir);
+   auto recorderPtr = std::make_unique<RRDFLogRecorder>();
+   auto recorder = recorderPtr.get();
+   ROOT::Experimental::RLogManager::Get().PushFront(std::move(recorderPtr));
+   ROOT::Experimental::RLogScopedVerbosity verbosity(ROOT::Detail::RDF::RDFLogChannel(),
+                                                     ROOT::Experimental::ELogLevel::kInfo);
+
+   auto runGraph = [] {
+      ROOT::RDataFrame df(10);
+      auto dfx = df.Define("jitcache_x", "rdfentry_ * 3.").Filter("jitcache_x > 10.");
+      auto sum = dfx.Sum<double>("jitcache_x");
+      auto count = dfx.Count();
+      EXPECT_DOUBLE_EQ(*sum, 3. * (4 + 5 + 6 + 7 + 8 + 9));
+      EXPECT_EQ(*count, 6u);
+   };
+
+   runGraph();
+   EXPECT_EQ(recorder->Filter("Compiling ").size(), 1u);
+   EXPECT_EQ(recorder->Filter("Loaded the jitted code from ").size(), 1u);
+
+   // an unrelated graph in between jits other functions, and gets its own library
+   EXPECT_DOUBLE_EQ(*ROOT::RDataFrame(4).Define("jitcache_y", "rdfentry_ + 1.").Sum<double>("jitcache_y"), 10.);
+   EXPECT_EQ(recorder->Filter("Compiling ").size(), 2u);
+
+   // the same graph as the first one loads the library compiled for it instead of compiling its code again
+   runGraph();
+   EXPECT_EQ(recorder->Filter("Compiling ").size(), 2u);
+   const auto loaded = recorder->Filter("Loaded the jitted code from ");
+   ASSERT_EQ(loaded.size(), 3u);
+   EXPECT_EQ(loaded[2], loaded[0]);
+   EXPECT_NE(loaded[1], loaded[0]);
+
+   ROOT::Experimental::RLogManager::Get().Remove(recorder);
+   ROOT::RDF::Experimental::SetJitCacheDir("");
+
+   std::vector<std::string> sources;
+   void *dir = gSystem->OpenDirectory(cacheDir.c_str());
+   ASSERT_NE(dir, nullptr);
+   std::vector<std::string> entries;
+   while (const char *entry = gSystem->GetDirEntry(dir)) {
+      const std::string name = entry;
+      if (name == "." || name == "..")
+         continue;
+      entries.emplace_back(cacheDir + "/" + name);
+      if (name.size() > 4 && name.compare(name.size() - 4, 4, ".cxx") == 0)
+         sources.emplace_back(name);
+   }
+   gSystem->FreeDirectory(dir);
+   EXPECT_EQ(sources.size(), 2u);
+
+   for (const auto &entry : entries)
+      gSystem->Unlink(entry.c_str());
+   gSystem->Unlink(cacheDir.c_str());
+}
+
+TEST(RDFHelpers, FilterCache)
+{
+   const std::string cacheDir = "dataframe_helpers_filtercache";
+   const std::string fileName = "dataframe_helpers_filtercache.root";
+   ROOT::RDataFrame(10)
+      .Define("x", [](ULong64_t e) { return int(e); }, {"rdfentry_"})
+      .Snapshot<int>("t", fileName, {"x"});
+   ROOT::RDF::Experimental::SetFilterCacheDir(cacheDir);
+
+   // the second event loop takes the decisions recorded by the first one, in a new computation graph
+   std::vector<int> nEvaluations;
+   for (int i = 0; i < 2; ++i) {
+      int n = 0;
+      ROOT::RDataFrame df("t", fileName);
+      auto dfx = df.Filter(
+         [&n](int x) {
+            ++n;
+            return x % 3 == 0;
+         },
+         {"x"}, "multipleOf3");
+      auto sum = dfx.Sum<int>("x");
+      auto count = dfx.Count();
+      EXPECT_EQ(*sum, 0 + 3 + 6 + 9);
+      EXPECT_EQ(*count, 4u);
+      nEvaluations.emplace_back(n);
+   }
+   ROOT::RDF::Experimental::SetFilterCacheDir("");
+   EXPECT_EQ(nEvaluations, std::vector<int>({10, 0}));
+
+   void *dir = gSystem->OpenDirectory(cacheDir.c_str());
+   ASSERT_NE(dir, nullptr);
+   std::vector<std::string> entries;
+   while (const char *entry = gSystem->GetDirEntry(dir)) {
+      const std::string name = entry;
+      if (name != "." && name != "..")
+         entries.emplace_back(cacheDir + "/" + name);
+   }
+   gSystem->FreeDirectory(dir);
+   EXPECT_EQ(entries.size(), 1u);
+
+   for (const auto &entry : entries)
+      gSystem->Unlink(entry.c_str());
+   gSystem->Unlink(cacheDir.c_str());
+   gSystem->Unlink(fileName.c_str());
+}
+
+TEST(RDFHelpers, GenerateStandaloneSource)
+{
+   const std::string fileName = "dataframe_helpers_standalone.root";
+   ROOT::RDataFrame(10)
+      .Define("x", [](ULong64_t e) { return float(e); }, {"rdfentry_"})
+      .Snapshot<float>("t", fileName, {"x"});
+
+   ROOT::RDataFrame df("t", fileName);
+   auto dfy = df.Define("y", "x * x").Filter("y > 4", "cut").Alias("z", "y");
+   auto h = dfy.Histo1D({"h", "h", 10, 0., 100.}, "z");
+   auto count = dfy.Count();
+   auto max = df.Range(5).Max("x");
+
+   const auto code = ROOT::RDF::Experimental::GenerateStandaloneSource(df);
+   const auto npos = std::string::npos;
+   EXPECT_NE(code.find("ROOT::RDataFrame df(\"t\", std::vector<std::string>{\"" + fileName + "\"});"), npos) << code;
+   EXPECT_NE(code.find(".Define(\"y\", [](const float var0)"), npos) << code;
+   EXPECT_NE(code.find(", \"cut\")"), npos) << code;
+   EXPECT_NE(code.find(".Alias(\"z\", \"y\")"), npos) << code;
+   EXPECT_NE(code.find(".Histo1D<float>(ROOT::RDF::TH1DModel(\"h\", \"h\", 10, 0., 100.)"), npos) << code;
+   EXPECT_NE(code.find("df.Range(0, 5, 1)"), npos) << code;
+   EXPECT_NE(code.find(".Max<float>(\"x\")"), npos) << code;
+
+   // run the generated program through the interpreter, it writes the histogram to its default output file
+   auto program = code;
+   program.replace(program.find("int main("), 9, "int rdf_standalone_main(");
+   ASSERT_TRUE(gInterpreter->Declare(program.c_str()));
+   gInterpreter->ProcessLine("rdf_standalone_main(1, nullptr);");
+   EXPECT_EQ(*count, 7u);
+   EXPECT_FLOAT_EQ(*max, 4.f);
+   {
+      TFile f("rdf_standalone_output.root");
+      auto *hStandalone = f.Get<TH1D>("h");
+      ASSERT_NE(hStandalone, nullptr);
+      EXPECT_EQ(hStandalone->GetEntries(), h->GetEntries());
+      for (int i = 0; i <= h->GetNbinsX() + 1; ++i)
+         EXPECT_EQ(hStandalone->GetBinContent(i), h->GetBinContent(i));
+   }
+
+   // operations booked with C++ callables cannot be emitted
+   ROOT::RDataFrame df2(10);
+   auto typed = df2.Define("x", [] { return 1; }).Histo1D<int>("x");
+   EXPECT_THROW(ROOT::RDF::Experimental::GenerateStandaloneSource(df2), std::runtime_error);
+
+   gSystem->Unlink("rdf_standalone_output.root");
+   gSystem->Unlink(fileName.c_str());
+}
+
+TEST(RDFHelpers, ProgressiveResult)
+{
+   ROOT::RDataFrame df(100);
+   auto dfx = df.Define("x", [](ULong64_t e) { return double(e); }, {"rdfentry_"});
+   auto count = dfx.Count();
+   auto h = dfx.Histo1D<double>({"h", "h", 100, 0., 100.}, "x");
+   auto max = dfx.Max<double>("x");
+   auto progressiveCount = ROOT::RDF::Experimental::MakeProgressiveResult(count, 10);
+   auto progressiveH = ROOT::RDF::Experimental::MakeProgressiveResult(h, 10);
+   auto maxOf = [](double &out, const double &in) { out = std::max(out, in); };
+   auto progressiveMax = ROOT::RDF::Experimental::MakeProgressiveResult(max, 10, maxOf);
+   EXPECT_EQ(progressiveCount.Get(), nullptr);
+
+   // the callbacks registered by MakeProgressiveResult run first, so snapshots taken here are up to date
+   std::vector<ULong64_t> counts;
+   std::vector<ULong64_t> nEntries;
+   std::vector<double> histoEntries;
+   count.OnPartialResult(25, [&](ULong64_t &) {
+      counts.emplace_back(*progressiveCount.Get());
+      nEntries.emplace_back(progressiveCount.GetNEntries());
+      histoEntries.emplace_back(progressiveH.Get()->GetEntries());
+   });
+
+   EXPECT_EQ(*count, 100u);
+   EXPECT_EQ(counts, std::vector<ULong64_t>({20u, 50u, 70u, 100u}));
+   EXPECT_EQ(nEntries, counts);
+   EXPECT_EQ(histoEntries, std::vector<double>({20., 50., 70., 100.}));
+
+   EXPECT_EQ(*progressiveCount.Get(), 100u);
+   EXPECT_EQ(progressiveH.Get()->GetEntries(), h->GetEntries());
+   EXPECT_DOUBLE_EQ(*progressiveMax.Get(), 99.);
+
+   EXPECT_THROW(ROOT::RDF::Experimental::MakeProgressiveResult(count, 0), std::invalid_argument);
+}
+
+#ifdef R__USE_IMT
+TEST(RDFHelpers, ProgressiveResultMT)
+{
+   ROOT::EnableImplicitMT(4);
+   ROOT::RDataFrame df(100000);
+   auto h = df.Define("x", [](ULong64_t e) { return double(e % 100); }, {"rdfentry_"})
+               .Histo1D<double>({"h", "h", 100, 0., 100.}, "x");
+   auto progressive = ROOT::RDF::Experimental::MakeProgressiveResult(h, 1000);
+   EXPECT_EQ(h->GetEntries(), 100000.);
+   // every slot publishes its partial result at least once and lags behind by less than 1000 entries
+   auto snapshot = progressive.Get();
+   ASSERT_NE(snapshot, nullptr);
+   EXPECT_EQ(snapshot->GetEntries(), double(progressive.GetNEntries()));
+   EXPECT_LE(progressive.GetNEntries(), 100000u);
+   EXPECT_GT(progressive.GetNEntries(), 100000u - 1000u * ROOT::GetThreadPoolSize());
+   ROOT::DisableImplicitMT();
+}
+#endif
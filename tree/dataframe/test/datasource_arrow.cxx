@@ -2,12 +2,15 @@
 #include <ROOT/RArrowDS.hxx>
 #include <ROOT/TSeq.hxx>
 #include <TROOT.h>
+#include <TSystem.h>
 
 #if defined(__GNUC__)
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wshadow"
 #endif
 #include <arrow/builder.h>
+#include <arrow/io/file.h>
+#include <arrow/ipc/writer.h>
 #include <arrow/memory_pool.h>
 #include <arrow/record_batch.h>
 #include <arrow/table.h>
@@ -20,6 +23,7 @@
 #include <gtest/gtest.h>
 
 #include <iostream>
+#include <numeric>
 
 using namespace ROOT;
 using namespace ROOT::RDF;
@@ -203,6 +207,82 @@ TEST(RArrowDS, FromARDFWithJitting)
 }
 
 // NOW MT!-------------
+// A table with column "x" (int64, x = entry number) and "y" (double, y = x / 2) split in record batches of the given
+// sizes.
+std::vector<std::shared_ptr<arrow::RecordBatch>> createTestBatches(const std::vector<int64_t> &sizes)
+{
+   auto schema_ = schema({field("x", arrow::int64()), field("y", arrow::float64())});
+   std::vector<std::shared_ptr<arrow::RecordBatch>> batches;
+   int64_t entry = 0;
+   for (const auto size : sizes) {
+      std::vector<int64_t> xs(size);
+      std::iota(xs.begin(), xs.end(), entry);
+      std::vector<double> ys;
+      for (const auto x : xs)
+         ys.push_back(x / 2.);
+      entry += size;
+      std::shared_ptr<Array> x, y;
+      arrow::ArrayFromVector<Int64Type, int64_t>(xs, &x);
+      arrow::ArrayFromVector<DoubleType, double>(ys, &y);
+      batches.emplace_back(arrow::RecordBatch::Make(schema_, size, {x, y}));
+   }
+   return batches;
+}
+
+TEST(RArrowDS, ChunkedTable)
+{
+   auto batches = createTestBatches({4, 0, 5, 3});
+   auto table = arrow::Table::FromRecordBatches(batches).ValueOrDie();
+   RArrowDS tds(table, {});
+   tds.SetNSlots(2U);
+   auto valsX = tds.GetColumnReaders<Long64_t>("x");
+   auto valsY = tds.GetColumnReaders<double>("y");
+   tds.Initialize();
+
+   // one range per non-empty chunk
+   auto ranges = tds.GetEntryRanges();
+   const std::vector<std::pair<ULong64_t, ULong64_t>> expected{{0, 4}, {4, 9}, {9, 12}};
+   EXPECT_EQ(ranges, expected);
+
+   for (auto &&range : ranges) {
+      tds.InitSlot(1U, range.first);
+      for (auto i : ROOT::TSeq<ULong64_t>(range.first, range.second)) {
+         tds.SetEntry(1U, i);
+         EXPECT_EQ(Long64_t(i), **valsX[1]);
+         EXPECT_DOUBLE_EQ(i / 2., **valsY[1]);
+      }
+   }
+}
+
+TEST(RArrowDS, FromArrowIPC)
+{
+   const auto fileName = "datasource_arrow_fromipc.arrow";
+   auto batches = createTestBatches({10, 7, 13});
+   {
+      auto output = arrow::io::FileOutputStream::Open(fileName).ValueOrDie();
+      auto writer = arrow::ipc::MakeFileWriter(output, batches.front()->schema()).ValueOrDie();
+      for (const auto &batch : batches)
+         ASSERT_TRUE(writer->WriteRecordBatch(*batch).ok());
+      ASSERT_TRUE(writer->Close().ok());
+      ASSERT_TRUE(output->Close().ok());
+   }
+
+   auto df = FromArrowIPC(fileName, {});
+   auto count = df.Count();
+   auto sumX = df.Sum<Long64_t>("x");
+   auto maxY = df.Max<double>("y");
+   auto xs = df.Take<Long64_t>("x");
+   EXPECT_EQ(30U, *count);
+   EXPECT_EQ(29 * 30 / 2, *sumX);
+   EXPECT_DOUBLE_EQ(14.5, *maxY);
+   std::vector<Long64_t> expectedXs(30);
+   std::iota(expectedXs.begin(), expectedXs.end(), 0);
+   EXPECT_EQ(expectedXs, *xs);
+
+   EXPECT_THROW(FromArrowIPC("does_not_exist.arrow", {}), std::runtime_error);
+   gSystem->Unlink(fileName);
+}
+
 #ifdef R__USE_IMT
 
 TEST(RArrowDS, DefineSlotCheckMT)
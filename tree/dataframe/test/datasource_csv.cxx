@@ -249,6 +249,37 @@ TEST(RCsvDS, WindowsLinebreaks)
    EXPECT_EQ(6U, *tdf.Count());
 }
 
+// the results of the event loops over byte chunks must not depend on the chunk size
+void CheckByteChunks()
+{
+   auto ref = ROOT::RDF::FromCSV(fileName0);
+   auto refNames = ref.Take<std::string>("Name");
+   auto refAges = ref.Take<Long64_t>("Age");
+   auto refMarried = ref.Take<bool>("Married");
+   for (auto bytesChunkSize : {1LL, 20LL, 40LL, 1000LL}) {
+      auto df = ROOT::RDF::FromCSV(fileName0, true, ',', -1LL, {}, bytesChunkSize);
+      auto names = df.Take<std::string>("Name");
+      auto ages = df.Take<Long64_t>("Age");
+      auto married = df.Take<bool>("Married");
+      auto sumHeight = df.Sum<double>("Height");
+      EXPECT_EQ(*names, *refNames) << bytesChunkSize;
+      EXPECT_EQ(*ages, *refAges) << bytesChunkSize;
+      EXPECT_EQ(*married, *refMarried) << bytesChunkSize;
+      EXPECT_DOUBLE_EQ(*sumHeight, 185.2 + 180. + 200.5 + 170. + .7 + .7) << bytesChunkSize;
+      EXPECT_EQ(*df.Count(), 6u) << bytesChunkSize; // a second event loop
+   }
+
+   EXPECT_EQ(*ROOT::RDF::FromCSV(fileName3, true, ',', -1LL, {}, 10LL).Count(), 6u);
+}
+
+TEST(RCsvDS, ByteChunks)
+{
+   CheckByteChunks();
+
+   EXPECT_THROW(ROOT::RDF::FromCSV(fileName0, true, ',', -1LL, {}, 0LL), std::runtime_error);
+   EXPECT_THROW(ROOT::RDF::FromCSV(fileName0, true, ',', 2LL, {}, 100LL), std::runtime_error);
+}
+
 TEST(RCsvDS, Remote)
 {
 #ifdef R__HAS_DAVIX
@@ -305,6 +336,11 @@ TEST(RCsvDS, FromARDFWithJittingMT)
    EXPECT_EQ(40, *min);
 }
 
+TEST(RCsvDS, ByteChunksMT)
+{
+   CheckByteChunks();
+}
+
 TEST(RCsvDS, ProgressiveReadingRDFMT)
 {
    // Even chunks
@@ -147,6 +147,110 @@ TEST_F(RNTupleDSTest, Read)
    ReadTest(fNtplName, fFileName);
 }
 
+void SnapshotTest(const std::string &fileName)
+{
+   ROOT::RDF::RSnapshotOptions opts;
+   opts.fOutputFormat = ROOT::RDF::ESnapshotOutputFormat::kRNTuple;
+   ROOT::RDataFrame df(1000);
+   auto d = df.Define("x", [](ULong64_t e) { return int(e); }, {"rdfentry_"})
+               .Define("v", [](int x) { return ROOT::RVecF(x % 3, float(x)); }, {"x"})
+               .Filter([](int x) { return x % 2 == 0; }, {"x"});
+   auto out = d.Snapshot<int, ROOT::RVecF>("ntuple", fileName, {"x", "v"}, opts);
+   EXPECT_EQ(500u, *out->Count());
+   EXPECT_EQ(249500, *out->Sum<int>("x"));
+   float expectedSumV = 0.f;
+   for (int x = 0; x < 1000; x += 2)
+      expectedSumV += (x % 3) * float(x);
+   EXPECT_FLOAT_EQ(expectedSumV, *out->Define("sumv", [](const ROOT::RVecF &v) { return Sum(v); }, {"v"})
+                                      .Sum<float>("sumv"));
+
+   // jitted Snapshot
+   const auto jittedFileName = "jitted_" + fileName;
+   auto outJitted = d.Snapshot("ntuple", jittedFileName, {"x"}, opts);
+   EXPECT_EQ(500u, *outJitted->Count());
+   EXPECT_EQ(249500, *outJitted->Sum<int>("x"));
+
+   // the output is a regular RNTuple
+   auto reread = ROOT::RDF::Experimental::FromRNTuple("ntuple", jittedFileName);
+   EXPECT_EQ(std::vector<std::string>{"x"}, reread.GetColumnNames());
+   EXPECT_EQ(249500, *reread.Sum<int>("x"));
+
+   std::remove(fileName.c_str());
+   std::remove(jittedFileName.c_str());
+}
+
+TEST(RNTupleDS, Snapshot)
+{
+   SnapshotTest("RNTupleDS_test_snapshot.root");
+}
+
+TEST(RNTupleDS, CacheToDisk)
+{
+   const std::string fileName = "RNTupleDS_test_cache.root";
+   int nCalls = 0;
+   auto makeCache = [&](bool jitted) {
+      ROOT::RDataFrame df(100);
+      auto d = df.Define("x",
+                         [&nCalls](ULong64_t e) {
+                            ++nCalls;
+                            return int(e);
+                         },
+                         {"rdfentry_"})
+                  .Filter([](int x) { return x >= 90; }, {"x"});
+      return jitted ? d.Cache({"x"}, fileName) : d.Cache<int>({"x"}, fileName);
+   };
+
+   auto cached = makeCache(/*jitted=*/false);
+   EXPECT_EQ(100, nCalls);
+   EXPECT_EQ(10u, *cached.Count());
+   EXPECT_EQ(945, *cached.Sum<int>("x"));
+
+   // the second cache is read back from the file, the original computation graph does not run
+   auto reread = makeCache(/*jitted=*/true);
+   EXPECT_EQ(100, nCalls);
+   EXPECT_EQ(std::vector<std::string>{"x"}, reread.GetColumnNames());
+   EXPECT_EQ(945, *reread.Sum<int>("x"));
+
+   std::remove(fileName.c_str());
+}
+
+TEST(RNTupleDS, RVecViews)
+{
+   const std::string fileName = "RNTupleDS_test_rvecviews.root";
+   {
+      auto model = RNTupleModel::Create();
+      auto fldJets = model->MakeField<std::vector<float>>("jets");
+      // Small pages, so that some of the collections cross a page boundary and are copied instead
+      ROOT::Experimental::RNTupleWriteOptions options;
+      options.SetApproxUnzippedPageSize(64);
+      auto ntuple = RNTupleWriter::Recreate(std::move(model), "ntuple", fileName, options);
+      for (int i = 0; i < 100; ++i) {
+         fldJets->clear();
+         for (int j = 0; j < i % 7; ++j)
+            fldJets->push_back(i + j);
+         ntuple->Fill();
+      }
+   }
+
+   auto df = ROOT::RDF::Experimental::FromRNTuple("ntuple", fileName);
+   auto nMismatches = df.Define("n", [](const ROOT::RVecF &jets, ULong64_t entry) {
+                           int n = 0;
+                           if (jets.size() != entry % 7)
+                              return 1;
+                           for (std::size_t j = 0; j < jets.size(); ++j)
+                              n += (jets[j] != float(entry + j));
+                           return n;
+                        }, {"jets", "rdfentry_"})
+                         .Sum<int>("n");
+   EXPECT_EQ(0, *nMismatches);
+   auto jets = df.Take<ROOT::RVecF>("jets");
+   ASSERT_EQ(100u, jets->size());
+   ASSERT_EQ(1u, (*jets)[99].size());
+   EXPECT_FLOAT_EQ(99.f, (*jets)[99][0]);
+
+   std::remove(fileName.c_str());
+}
+
 #ifdef R__USE_IMT
 struct IMTRAII {
    IMTRAII() { ROOT::EnableImplicitMT(); }
@@ -159,4 +263,47 @@ TEST_F(RNTupleDSTest, ReadMT)
 
    ReadTest(fNtplName, fFileName);
 }
+
+TEST(RNTupleDS, SnapshotMT)
+{
+   IMTRAII _;
+
+   SnapshotTest("RNTupleDS_test_snapshotmt.root");
+}
+
+TEST(RNTupleDS, ClusterRangesMT)
+{
+   IMTRAII _;
+
+   const std::string fileName = "RNTupleDS_test_clusters.root";
+   {
+      auto model = RNTupleModel::Create();
+      auto fldX = model->MakeField<std::uint32_t>("x");
+      auto ntuple = RNTupleWriter::Recreate(std::move(model), "ntuple", fileName);
+      for (std::uint32_t i = 0; i < 100; ++i) {
+         *fldX = i;
+         ntuple->Fill();
+         if (i % 10 == 9)
+            ntuple->CommitCluster();
+      }
+   }
+
+   RNTupleDS ds(RPageSource::Create("ntuple", fileName));
+   ds.SetNSlots(4);
+   ds.Initialize();
+   auto ranges = ds.GetEntryRanges();
+   ASSERT_EQ(10u, ranges.size());
+   for (std::size_t i = 0; i < ranges.size(); ++i) {
+      EXPECT_EQ(10u * i, ranges[i].first);
+      EXPECT_EQ(10u * (i + 1), ranges[i].second);
+   }
+   EXPECT_TRUE(ds.GetEntryRanges().empty());
+   ds.Finalize();
+
+   auto df = ROOT::RDF::Experimental::FromRNTuple("ntuple", fileName);
+   EXPECT_EQ(100u, *df.Count());
+   EXPECT_EQ(4950u, *df.Sum<std::uint32_t>("x"));
+
+   std::remove(fileName.c_str());
+}
 #endif
@@ -124,17 +124,15 @@ TEST(RSqliteDS, ColumnReaders)
 {
    RSqliteDS rds(fileName0, query0);
    const auto nSlots = 2U;
-   ROOT_EXPECT_WARNING(rds.SetNSlots(nSlots), "SetNSlots",
-                       "Currently the SQlite data source faces performance degradation in multi-threaded mode. "
-                       "Consider turning off IMT.");
+   rds.SetNSlots(nSlots);
    auto vals = rds.GetColumnReaders<Long64_t>("fint");
    rds.Initialize();
    auto ranges = rds.GetEntryRanges();
-   EXPECT_EQ(1U, ranges.size());
+   ASSERT_EQ(2U, ranges.size());
    for (auto i : ROOT::TSeq<unsigned>(0, nSlots)) {
-      EXPECT_TRUE(rds.SetEntry(i, ranges[0].first));
+      EXPECT_TRUE(rds.SetEntry(i, ranges[i].first));
       auto val = **vals[i];
-      EXPECT_EQ(1, val);
+      EXPECT_EQ(Long64_t(i + 1), val);
    }
 
    EXPECT_THROW(rds.GetColumnReaders<double>("fint"), std::runtime_error);
@@ -144,23 +142,51 @@ TEST(RSqliteDS, GetEntryRanges)
 {
    RSqliteDS rds(fileName0, query0);
    rds.Initialize();
+   // Both rows fit in one batch
    auto ranges = rds.GetEntryRanges();
    ASSERT_EQ(1U, ranges.size());
    EXPECT_EQ(0U, ranges[0].first);
-   EXPECT_EQ(1U, ranges[0].second);
-   ranges = rds.GetEntryRanges();
-   ASSERT_EQ(1U, ranges.size());
-   EXPECT_EQ(1U, ranges[0].first);
    EXPECT_EQ(2U, ranges[0].second);
    ranges = rds.GetEntryRanges();
    EXPECT_EQ(0U, ranges.size());
+   ranges = rds.GetEntryRanges();
+   EXPECT_EQ(0U, ranges.size());
 
    // New event loop
    rds.Initialize();
    ranges = rds.GetEntryRanges();
    EXPECT_EQ(1U, ranges.size());
    EXPECT_EQ(0U, ranges[0].first);
-   EXPECT_EQ(1U, ranges[0].second);
+   EXPECT_EQ(2U, ranges[0].second);
+}
+
+TEST(RSqliteDS, Batches)
+{
+   RSqliteDS rds(fileName0, "WITH RECURSIVE c(x) AS (SELECT 0 UNION ALL SELECT x + 1 FROM c WHERE x < 4999) "
+                            "SELECT x FROM c");
+   const auto nSlots = 2U;
+   rds.SetNSlots(nSlots);
+   auto vals = rds.GetColumnReaders<Long64_t>("x");
+   rds.Initialize();
+
+   ULong64_t nEntries = 0;
+   auto ranges = rds.GetEntryRanges();
+   ASSERT_EQ(nSlots, ranges.size());
+   EXPECT_EQ(0U, ranges[0].first);
+   EXPECT_EQ(RSqliteDS::kBatchSizePerSlot, ranges[0].second);
+   EXPECT_EQ(RSqliteDS::kBatchSizePerSlot, ranges[1].first);
+   while (!ranges.empty()) {
+      for (auto i : ROOT::TSeq<unsigned>(0, ranges.size())) {
+         EXPECT_EQ(nEntries, ranges[i].first);
+         for (auto entry = ranges[i].first; entry < ranges[i].second; ++entry) {
+            EXPECT_TRUE(rds.SetEntry(i % nSlots, entry));
+            EXPECT_EQ(Long64_t(entry), **vals[i % nSlots]);
+         }
+         nEntries = ranges[i].second;
+      }
+      ranges = rds.GetEntryRanges();
+   }
+   EXPECT_EQ(5000U, nEntries);
 }
 
 TEST(RSqliteDS, SetEntry)
@@ -175,7 +201,9 @@ TEST(RSqliteDS, SetEntry)
 
    rds.Initialize();
 
-   rds.GetEntryRanges();
+   auto ranges = rds.GetEntryRanges();
+   ASSERT_EQ(1U, ranges.size());
+   EXPECT_EQ(2U, ranges[0].second);
    EXPECT_TRUE(rds.SetEntry(0, 0));
    EXPECT_EQ(1, **vint[0]);
    EXPECT_NEAR(1.0, **vreal[0], epsilon);
@@ -184,7 +212,6 @@ TEST(RSqliteDS, SetEntry)
    EXPECT_EQ('1', (**vblob[0])[0]);
    EXPECT_EQ(nullptr, **vnull[0]);
 
-   rds.GetEntryRanges();
    EXPECT_TRUE(rds.SetEntry(0, 1));
    EXPECT_EQ(2, **vint[0]);
    EXPECT_NEAR(2.0, **vreal[0], epsilon);
@@ -202,7 +229,6 @@ TEST(RSqliteDS, IMT)
    const auto nSlots = 4U;
    ROOT::EnableImplicitMT(nSlots);
 
-   ROOT::TestSupport::CheckDiagsRAII diagRAII{kWarning, "SetNSlots", "Currently the SQlite data source faces performance degradation in multi-threaded mode. Consider turning off IMT."};
    auto rdf = ROOT::RDF::FromSqlite(fileName0, query0);
    EXPECT_EQ(3, *rdf.Sum("fint"));
    EXPECT_NEAR(3.0, *rdf.Sum("freal"), epsilon);
@@ -199,6 +199,8 @@ public:
    const ColumnSet_t &GetAvailPhysicalColumns() const { return fAvailPhysicalColumns; }
    bool ContainsColumn(DescriptorId_t colId) const { return fAvailPhysicalColumns.count(colId) > 0; }
    size_t GetNOnDiskPages() const { return fOnDiskPages.size(); }
+   /// The sum of the packed and compressed sizes of all the on-disk pages of the cluster
+   std::size_t GetOnDiskSize() const;
 };
 
 } // namespace Detail
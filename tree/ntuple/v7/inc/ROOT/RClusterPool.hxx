@@ -17,9 +17,13 @@
 #define ROOT7_RClusterPool
 
 #include <ROOT/RCluster.hxx>
+#include <ROOT/RNTupleMetrics.hxx>
 #include <ROOT/RNTupleUtil.hxx>
 
+#include <atomic>
+#include <chrono>
 #include <condition_variable>
+#include <cstdint>
 #include <deque>
 #include <memory>
 #include <mutex>
@@ -50,6 +54,11 @@ the unzip thread is supposed to submit multi-threaded, CPU heavy work to the app
 The unzipping step of the pipeline therefore behaves differently depending on whether or not implicit multi-threadin
 is turned on. If it is turned off, i.e. in a single-threaded environment, the cluster pool will only read the
 compressed pages and the page source has to uncompresses pages at a later point when data from the page is requested.
+
+If the page source's read options request an adaptive cluster bunch size, the cluster pool measures the wall time
+of the vector reads and the time the consumer spends on a cluster between two GetCluster() calls. The bunch size is
+then adjusted such that loading the next bunch takes about as long as consuming the current one, within the
+limits of the maximum bunch size and of the memory budget for the compressed clusters held by the pool.
 */
 // clang-format on
 class RClusterPool {
@@ -96,6 +105,23 @@ private:
    unsigned int fWindowPre = 0;
    /// The number of clusters that are being read in a single vector read.
    unsigned int fClusterBunchSize;
+   /// If set, fClusterBunchSize is adjusted in GetCluster() according to the measured load and consumption times
+   bool fIsAdaptive = false;
+   /// Upper limit of fClusterBunchSize; the pool has space for two bunches of maximum size
+   unsigned int fMaxClusterBunchSize;
+   /// Upper limit for the compressed size of two bunches of clusters in adaptive mode
+   std::uint64_t fMemoryBudget = 0;
+   /// Moving average of the wall time of a LoadClusters() call, set by the I/O thread
+   std::atomic<std::int64_t> fLoadTimePerBunch{0};
+   /// Moving average of the on-disk size of a loaded cluster, set by the I/O thread
+   std::atomic<std::int64_t> fSizePerCluster{0};
+   /// Moving average of the time that the consumer spends on a cluster, i.e. the time between returning from
+   /// GetCluster() and the request of the next cluster
+   std::int64_t fConsumeTimePerCluster = 0;
+   /// The cluster that has been returned by the last GetCluster() call
+   DescriptorId_t fLastClusterId = kInvalidDescriptorId;
+   /// The time when the last cluster has been handed out for the first time
+   std::chrono::steady_clock::time_point fLastClusterTime;
    /// Used as an ever-growing counter in GetCluster() to separate bunches of clusters from each other
    std::int64_t fBunchId = 0;
    /// The cache of clusters around the currently active cluster
@@ -106,6 +132,16 @@ private:
    std::mutex fLockWorkQueue;
    /// The clusters that were handed off to the I/O thread
    std::vector<RInFlightCluster> fInFlightClusters;
+   // Counters are accessed by the main and by the I/O thread
+   struct RCounters {
+      RNTupleAtomicCounter &fClusterBunchSize;
+      RNTupleAtomicCounter &fTimeWallLoadBunch;
+      RNTupleAtomicCounter &fTimeWallConsumeCluster;
+      RNTupleAtomicCounter &fSzCluster;
+   };
+   RNTupleMetrics fMetrics;
+   std::unique_ptr<RCounters> fCounters;
+
    /// Signals a non-empty I/O work queue
    std::condition_variable fCvHasReadWork;
    /// The communication channel to the I/O thread
@@ -140,6 +176,9 @@ private:
    /// Executed at the end of GetCluster when all missing data pieces have been sent to the load queue.
    /// Ideally, the function returns without blocking if the cluster is already in the pool.
    RCluster *WaitFor(DescriptorId_t clusterId, const RCluster::ColumnSet_t &physicalColumns);
+   /// Called by GetCluster() if a new cluster is requested; updates the consumption time and, in adaptive mode,
+   /// the cluster bunch size
+   void UpdateClusterBunchSize();
 
 public:
    static constexpr unsigned int kDefaultClusterBunchSize = 1;
@@ -149,6 +188,14 @@ public:
    RClusterPool &operator =(const RClusterPool &other) = delete;
    ~RClusterPool();
 
+   /// Given the wall time for loading a bunch of clusters and the wall time for consuming one cluster (both in ns),
+   /// returns the bunch size that hides the load time behind the consumption of the current bunch. The result is
+   /// clamped to [1, maxBunchSize] and such that two bunches of clusters of the given size stay within the memory
+   /// budget. Starting from the current bunch size, the bunch size changes at most by a factor of two.
+   static unsigned int ComputeAdaptiveBunchSize(unsigned int currentBunchSize, unsigned int maxBunchSize,
+                                                std::int64_t loadTimePerBunch, std::int64_t consumeTimePerCluster,
+                                                std::uint64_t sizePerCluster, std::uint64_t memoryBudget);
+
    /// Returns the requested cluster either from the pool or, in case of a cache miss, lets the I/O thread load
    /// the cluster in the pool, blocks until done, and then returns it.  Triggers along the way the background loading
    /// of the following fWindowPost number of clusters.  The returned cluster has at least all the pages of
@@ -159,6 +206,9 @@ public:
 
    /// Used by the unit tests to drain the queue of clusters to be preloaded
    void WaitForInFlightClusters();
+
+   unsigned int GetClusterBunchSize() const { return fClusterBunchSize; }
+   RNTupleMetrics &GetMetrics() { return fMetrics; }
 }; // class RClusterPool
 
 } // namespace Detail
@@ -104,7 +104,7 @@ public:
    static std::unique_ptr<RColumn> Create(const RColumnModel &model, std::uint32_t index)
    {
       auto column = std::unique_ptr<RColumn>(new RColumn(model, index));
-      column->fElement = RColumnElementBase::Generate<CppT>(model.GetType());
+      column->fElement = RColumnElementBase::Generate<CppT>(model);
       return column;
    }
 
@@ -261,6 +261,17 @@ public:
          (clusterIndex.GetIndex() - fReadPage.GetClusterRangeFirst()) * RColumnElement<CppT>::kSize);
    }
 
+   /// Type-erased version of MapV(), for callers that only know the in-memory element size of the column
+   void *MapV(const RClusterIndex &clusterIndex, NTupleSize_t &nItems) {
+      if (!fReadPage.Contains(clusterIndex)) {
+         MapPage(clusterIndex);
+      }
+      // +1 to go from 0-based indexing to 1-based number of items
+      nItems = fReadPage.GetClusterRangeLast() - clusterIndex.GetIndex() + 1;
+      return static_cast<unsigned char *>(fReadPage.GetBuffer()) +
+             (clusterIndex.GetIndex() - fReadPage.GetClusterRangeFirst()) * fElement->GetSize();
+   }
+
    NTupleSize_t GetGlobalIndex(const RClusterIndex &clusterIndex) {
       if (!fReadPage.Contains(clusterIndex)) {
          MapPage(clusterIndex);
@@ -24,8 +24,11 @@
 #include <Byteswap.h>
 #include <TError.h>
 
+#include <algorithm>
+#include <cmath>
 #include <cstring> // for memcpy
 #include <cstdint>
+#include <limits>
 #include <memory>
 #include <string>
 #include <type_traits>
@@ -46,8 +49,10 @@ namespace {
 // The following conversions and encodings exist:
 //
 //   - Byteswap:  on big endian machines, ints and floats are byte-swapped to the little endian on-disk format
-//   - Cast:      in-memory values can be stored in narrower on-disk columns.  Currently without bounds checks.
-//                For instance, for Double32_t, an in-memory double value is stored as a float on disk.
+//   - Cast:      in-memory values can be stored in narrower on-disk columns.  The casts are not bounds checked; the
+//                integer fields check the value range when a value is appended to a narrower column, e.g. when
+//                small-range std::uint32_t detector ids are stored in 16 bit columns.  For Double32_t, an in-memory
+//                double value is stored as a float on disk.
 //   - Split:     rearranges the bytes of an array of elements such that all the first bytes are stored first,
 //                followed by all the second bytes, etc. This often clusters similar values, e.g. all the zero bytes
 //                for arrays of small integers.
@@ -84,10 +89,13 @@ template <typename T>
 void ByteSwapIfNecessary(T &value)
 {
    constexpr auto N = sizeof(T);
-   using bswap_value_type = typename RByteSwap<N>::value_type;
-   void *valuePtr = &value;
-   auto swapped = RByteSwap<N>::bswap(*reinterpret_cast<bswap_value_type *>(valuePtr));
-   *reinterpret_cast<bswap_value_type *>(valuePtr) = swapped;
+   // Single-byte values, e.g. of narrow 8 bit integer columns, need no swapping
+   if constexpr (N > 1) {
+      using bswap_value_type = typename RByteSwap<N>::value_type;
+      void *valuePtr = &value;
+      auto swapped = RByteSwap<N>::bswap(*reinterpret_cast<bswap_value_type *>(valuePtr));
+      *reinterpret_cast<bswap_value_type *>(valuePtr) = swapped;
+   }
 }
 #else
 #define ByteSwapIfNecessary(x) ((void)0)
@@ -239,6 +247,51 @@ static void CastZigzagSplitUnpack(void *destination, const void *source, std::si
    }
 }
 
+/// \brief Computes the smallest and the largest value of `count` in-memory elements, used for column statistics
+///
+/// The values are converted to double and rounded outwards where needed, so that [min, max] contains all the values.
+/// NaN values are ignored. For zero elements, the range is empty (min > max). Returns false for types without a
+/// meaningful value range, such as characters of strings.
+template <typename CppT>
+static bool ComputeValueRange(const void *source, std::size_t count, double &min, double &max)
+{
+   if constexpr (std::is_arithmetic_v<CppT> && !std::is_same_v<CppT, bool> && !std::is_same_v<CppT, char>) {
+      min = std::numeric_limits<double>::infinity();
+      max = -std::numeric_limits<double>::infinity();
+      if (count == 0)
+         return true;
+
+      auto src = reinterpret_cast<const CppT *>(source);
+      CppT lo;
+      CppT hi;
+      if constexpr (std::is_floating_point_v<CppT>) {
+         lo = std::numeric_limits<CppT>::infinity();
+         hi = -std::numeric_limits<CppT>::infinity();
+      } else {
+         lo = std::numeric_limits<CppT>::max();
+         hi = std::numeric_limits<CppT>::lowest();
+      }
+      for (std::size_t i = 0; i < count; ++i) {
+         lo = (src[i] < lo) ? src[i] : lo;
+         hi = (src[i] > hi) ? src[i] : hi;
+      }
+      min = static_cast<double>(lo);
+      max = static_cast<double>(hi);
+      if constexpr (std::is_integral_v<CppT> && (std::numeric_limits<CppT>::digits > 53)) {
+         // Integers beyond 2^53 are not necessarily representable as double
+         min = std::nextafter(min, -std::numeric_limits<double>::infinity());
+         max = std::nextafter(max, std::numeric_limits<double>::infinity());
+      }
+      return true;
+   } else {
+      (void)source;
+      (void)count;
+      (void)min;
+      (void)max;
+      return false;
+   }
+}
+
 } // anonymous namespace
 
 namespace ROOT {
@@ -277,12 +330,35 @@ public:
    /// If CppT == void, use the default C++ type for the given column type
    template <typename CppT = void>
    static std::unique_ptr<RColumnElementBase> Generate(EColumnType type);
+   /// Like Generate(EColumnType) but also applies the element parameters of the column model, e.g. the value range
+   /// of quantized columns
+   template <typename CppT = void>
+   static std::unique_ptr<RColumnElementBase> Generate(const RColumnModel &model);
+   /// For column types with a configurable element width, returns the maximum width
    static std::size_t GetBitsOnStorage(EColumnType type);
+   /// Takes into account the element width of columns whose element width is configurable
+   static std::size_t GetBitsOnStorage(const RColumnModel &model)
+   {
+      return model.GetBitsOnStorage() ? model.GetBitsOnStorage() : GetBitsOnStorage(model.GetType());
+   }
    static std::string GetTypeName(EColumnType type);
 
    /// Derived, typed classes tell whether the on-storage layout is bitwise identical to the memory layout
    virtual bool IsMappable() const { R__ASSERT(false); return false; }
    virtual std::size_t GetBitsOnStorage() const { R__ASSERT(false); return 0; }
+   /// Computes the value range of `count` in-memory elements for the column statistics. Returns false if the element
+   /// type does not support value statistics.
+   virtual bool GetValueRange(const void * /* source */, std::size_t /* count */, double & /* min */,
+                              double & /* max */) const
+   {
+      return false;
+   }
+   /// Only supported by quantized column elements: sets the number of bits per element and the value range
+   /// that is mapped to the integers [0, 2^bitsOnStorage - 1]
+   virtual void SetQuantization(std::size_t /* bitsOnStorage */, double /* valueMin */, double /* valueMax */)
+   {
+      throw RException(R__FAIL("internal error: column element does not support quantization"));
+   }
 
    /// If the on-storage layout and the in-memory layout differ, packing creates an on-disk page from an in-memory page
    virtual void Pack(void *destination, void *source, std::size_t count) const
@@ -409,6 +485,109 @@ public:
    }
 }; // class RColumnElementZigzagSplitLE
 
+/**
+ * Base class for floating point columns that are stored as unsigned integers of configurable bit width. The range
+ * [fValueMin, fValueMax] is mapped to the integers [0, 2^fBitsOnStorage - 1] in equidistant steps. Values outside the
+ * range are clamped, as it is the case for Double32_t with a range specification. The integers are bit-packed
+ * (little-endian bit order).
+ */
+template <typename CppT>
+class RColumnElementQuantized : public RColumnElementBase {
+   /// Number of elements that are converted in one go before they are bit-packed. The conversion loops have no
+   /// dependencies between iterations and can thus be vectorized by the compiler.
+   static constexpr std::size_t kBatchSize = 64;
+
+   std::size_t fBitsOnStorage = 32;
+   double fValueMin = 0.0;
+   double fValueMax = 1.0;
+
+   std::uint32_t GetMaxQuantizedValue() const
+   {
+      return static_cast<std::uint32_t>((std::uint64_t(1) << fBitsOnStorage) - 1);
+   }
+
+protected:
+   explicit RColumnElementQuantized(std::size_t size) : RColumnElementBase(size) {}
+
+public:
+   static constexpr bool kIsMappable = false;
+   static constexpr std::size_t kMaxBitsOnStorage = 32;
+
+   bool IsMappable() const final { return kIsMappable; }
+   std::size_t GetBitsOnStorage() const final { return fBitsOnStorage; }
+   bool GetValueRange(const void *source, std::size_t count, double &min, double &max) const final
+   {
+      return ComputeValueRange<CppT>(source, count, min, max);
+   }
+
+   void SetQuantization(std::size_t bitsOnStorage, double valueMin, double valueMax) final
+   {
+      if (bitsOnStorage < 1 || bitsOnStorage > kMaxBitsOnStorage)
+         throw RException(R__FAIL("invalid number of bits for quantized column: " + std::to_string(bitsOnStorage)));
+      if (!(valueMin < valueMax))
+         throw RException(R__FAIL("invalid value range for quantized column"));
+      fBitsOnStorage = bitsOnStorage;
+      fValueMin = valueMin;
+      fValueMax = valueMax;
+   }
+
+   void Pack(void *dst, void *src, std::size_t count) const final
+   {
+      auto srcArray = reinterpret_cast<const CppT *>(src);
+      auto bytes = reinterpret_cast<unsigned char *>(dst);
+      const double scale = GetMaxQuantizedValue() / (fValueMax - fValueMin);
+
+      std::uint32_t quantized[kBatchSize];
+      std::uint64_t accu = 0;
+      std::size_t nAccuBits = 0;
+      for (std::size_t i = 0; i < count; i += kBatchSize) {
+         const std::size_t n = std::min(kBatchSize, count - i);
+         for (std::size_t j = 0; j < n; ++j) {
+            double val = srcArray[i + j];
+            // Written such that NaN is mapped to the lower end of the range
+            val = (val >= fValueMin) ? val : fValueMin;
+            val = (val <= fValueMax) ? val : fValueMax;
+            quantized[j] = static_cast<std::uint32_t>((val - fValueMin) * scale + 0.5);
+         }
+         for (std::size_t j = 0; j < n; ++j) {
+            accu |= static_cast<std::uint64_t>(quantized[j]) << nAccuBits;
+            nAccuBits += fBitsOnStorage;
+            for (; nAccuBits >= 8; nAccuBits -= 8) {
+               *bytes++ = static_cast<unsigned char>(accu & 0xff);
+               accu >>= 8;
+            }
+         }
+      }
+      if (nAccuBits > 0)
+         *bytes = static_cast<unsigned char>(accu & 0xff);
+   }
+
+   void Unpack(void *dst, void *src, std::size_t count) const final
+   {
+      auto bytes = reinterpret_cast<const unsigned char *>(src);
+      auto dstArray = reinterpret_cast<CppT *>(dst);
+      const std::uint64_t mask = GetMaxQuantizedValue();
+      const double scale = (fValueMax - fValueMin) / GetMaxQuantizedValue();
+
+      std::uint32_t quantized[kBatchSize];
+      std::uint64_t accu = 0;
+      std::size_t nAccuBits = 0;
+      for (std::size_t i = 0; i < count; i += kBatchSize) {
+         const std::size_t n = std::min(kBatchSize, count - i);
+         for (std::size_t j = 0; j < n; ++j) {
+            for (; nAccuBits < fBitsOnStorage; nAccuBits += 8)
+               accu |= static_cast<std::uint64_t>(*bytes++) << nAccuBits;
+            quantized[j] = static_cast<std::uint32_t>(accu & mask);
+            accu >>= fBitsOnStorage;
+            nAccuBits -= fBitsOnStorage;
+         }
+         for (std::size_t j = 0; j < n; ++j) {
+            dstArray[i + j] = static_cast<CppT>(fValueMin + quantized[j] * scale);
+         }
+      }
+   }
+}; // class RColumnElementQuantized
+
 ////////////////////////////////////////////////////////////////////////////////
 // Pairs of C++ type and column type, like float and EColumnType::kReal32
 ////////////////////////////////////////////////////////////////////////////////
@@ -583,17 +762,21 @@ public:
    void Unpack(void *dst, void *src, std::size_t count) const final;
 };
 
-#define __RCOLUMNELEMENT_SPEC_BODY(CppT, BaseT, BitsOnStorage)  \
-   static constexpr std::size_t kSize = sizeof(CppT);           \
-   static constexpr std::size_t kBitsOnStorage = BitsOnStorage; \
-   RColumnElement() : BaseT(kSize) {}                           \
-   bool IsMappable() const final                                \
-   {                                                            \
-      return kIsMappable;                                       \
-   }                                                            \
-   std::size_t GetBitsOnStorage() const final                   \
-   {                                                            \
-      return kBitsOnStorage;                                    \
+#define __RCOLUMNELEMENT_SPEC_BODY(CppT, BaseT, BitsOnStorage)                                     \
+   static constexpr std::size_t kSize = sizeof(CppT);                                              \
+   static constexpr std::size_t kBitsOnStorage = BitsOnStorage;                                    \
+   RColumnElement() : BaseT(kSize) {}                                                              \
+   bool IsMappable() const final                                                                   \
+   {                                                                                               \
+      return kIsMappable;                                                                          \
+   }                                                                                               \
+   std::size_t GetBitsOnStorage() const final                                                      \
+   {                                                                                               \
+      return kBitsOnStorage;                                                                       \
+   }                                                                                               \
+   bool GetValueRange(const void *source, std::size_t count, double &min, double &max) const final \
+   {                                                                                               \
+      return ComputeValueRange<CppT>(source, count, min, max);                                     \
    }
 /// These macros are used to declare `RColumnElement` template specializations below.  Additional arguments can be used
 /// to forward template parameters to the base class, e.g.
@@ -632,6 +815,7 @@ DECLARE_RCOLUMNELEMENT_SPEC(std::int16_t, EColumnType::kSplitInt16, 16, RColumnE
                             <std::int16_t, std::int16_t>);
 DECLARE_RCOLUMNELEMENT_SPEC(std::int16_t, EColumnType::kSplitUInt16, 16, RColumnElementSplitLE,
                             <std::int16_t, std::uint16_t>);
+DECLARE_RCOLUMNELEMENT_SPEC(std::int16_t, EColumnType::kInt8, 8, RColumnElementCastLE, <std::int16_t, std::int8_t>);
 
 DECLARE_RCOLUMNELEMENT_SPEC(std::uint16_t, EColumnType::kUInt16, 16, RColumnElementLE, <std::uint16_t>);
 DECLARE_RCOLUMNELEMENT_SPEC(std::uint16_t, EColumnType::kInt16, 16, RColumnElementLE, <std::uint16_t>);
@@ -639,6 +823,8 @@ DECLARE_RCOLUMNELEMENT_SPEC(std::uint16_t, EColumnType::kSplitUInt16, 16, RColum
                             <std::uint16_t, std::uint16_t>);
 DECLARE_RCOLUMNELEMENT_SPEC(std::uint16_t, EColumnType::kSplitInt16, 16, RColumnElementZigzagSplitLE,
                             <std::uint16_t, std::int16_t>);
+DECLARE_RCOLUMNELEMENT_SPEC(std::uint16_t, EColumnType::kUInt8, 8, RColumnElementCastLE,
+                            <std::uint16_t, std::uint8_t>);
 
 DECLARE_RCOLUMNELEMENT_SPEC(std::int32_t, EColumnType::kInt32, 32, RColumnElementLE, <std::int32_t>);
 DECLARE_RCOLUMNELEMENT_SPEC(std::int32_t, EColumnType::kUInt32, 32, RColumnElementLE, <std::int32_t>);
@@ -646,6 +832,10 @@ DECLARE_RCOLUMNELEMENT_SPEC(std::int32_t, EColumnType::kSplitInt32, 32, RColumnE
                             <std::int32_t, std::int32_t>);
 DECLARE_RCOLUMNELEMENT_SPEC(std::int32_t, EColumnType::kSplitUInt32, 32, RColumnElementSplitLE,
                             <std::int32_t, std::uint32_t>);
+DECLARE_RCOLUMNELEMENT_SPEC(std::int32_t, EColumnType::kInt16, 16, RColumnElementCastLE, <std::int32_t, std::int16_t>);
+DECLARE_RCOLUMNELEMENT_SPEC(std::int32_t, EColumnType::kSplitInt16, 16, RColumnElementZigzagSplitLE,
+                            <std::int32_t, std::int16_t>);
+DECLARE_RCOLUMNELEMENT_SPEC(std::int32_t, EColumnType::kInt8, 8, RColumnElementCastLE, <std::int32_t, std::int8_t>);
 
 DECLARE_RCOLUMNELEMENT_SPEC(std::uint32_t, EColumnType::kUInt32, 32, RColumnElementLE, <std::uint32_t>);
 DECLARE_RCOLUMNELEMENT_SPEC(std::uint32_t, EColumnType::kInt32, 32, RColumnElementLE, <std::uint32_t>);
@@ -653,6 +843,12 @@ DECLARE_RCOLUMNELEMENT_SPEC(std::uint32_t, EColumnType::kSplitUInt32, 32, RColum
                             <std::uint32_t, std::uint32_t>);
 DECLARE_RCOLUMNELEMENT_SPEC(std::uint32_t, EColumnType::kSplitInt32, 32, RColumnElementZigzagSplitLE,
                             <std::uint32_t, std::int32_t>);
+DECLARE_RCOLUMNELEMENT_SPEC(std::uint32_t, EColumnType::kUInt16, 16, RColumnElementCastLE,
+                            <std::uint32_t, std::uint16_t>);
+DECLARE_RCOLUMNELEMENT_SPEC(std::uint32_t, EColumnType::kSplitUInt16, 16, RColumnElementSplitLE,
+                            <std::uint32_t, std::uint16_t>);
+DECLARE_RCOLUMNELEMENT_SPEC(std::uint32_t, EColumnType::kUInt8, 8, RColumnElementCastLE,
+                            <std::uint32_t, std::uint8_t>);
 
 DECLARE_RCOLUMNELEMENT_SPEC(std::int64_t, EColumnType::kInt64, 64, RColumnElementLE, <std::int64_t>);
 DECLARE_RCOLUMNELEMENT_SPEC(std::int64_t, EColumnType::kUInt64, 64, RColumnElementLE, <std::int64_t>);
@@ -674,15 +870,35 @@ DECLARE_RCOLUMNELEMENT_SPEC(std::uint64_t, EColumnType::kSplitUInt64, 64, RColum
                             <std::uint64_t, std::uint64_t>);
 DECLARE_RCOLUMNELEMENT_SPEC(std::uint64_t, EColumnType::kSplitInt64, 64, RColumnElementZigzagSplitLE,
                             <std::uint64_t, std::int64_t>);
+DECLARE_RCOLUMNELEMENT_SPEC(std::uint64_t, EColumnType::kUInt32, 32, RColumnElementCastLE,
+                            <std::uint64_t, std::uint32_t>);
+DECLARE_RCOLUMNELEMENT_SPEC(std::uint64_t, EColumnType::kSplitUInt32, 32, RColumnElementSplitLE,
+                            <std::uint64_t, std::uint32_t>);
 
 DECLARE_RCOLUMNELEMENT_SPEC(float, EColumnType::kReal32, 32, RColumnElementLE, <float>);
 DECLARE_RCOLUMNELEMENT_SPEC(float, EColumnType::kSplitReal32, 32, RColumnElementSplitLE, <float, float>);
 
+template <>
+class RColumnElement<float, EColumnType::kReal32Quant> : public RColumnElementQuantized<float> {
+public:
+   static constexpr std::size_t kSize = sizeof(float);
+   static constexpr std::size_t kBitsOnStorage = kMaxBitsOnStorage;
+   RColumnElement() : RColumnElementQuantized(kSize) {}
+};
+
 DECLARE_RCOLUMNELEMENT_SPEC(double, EColumnType::kReal64, 64, RColumnElementLE, <double>);
 DECLARE_RCOLUMNELEMENT_SPEC(double, EColumnType::kSplitReal64, 64, RColumnElementSplitLE, <double, double>);
 DECLARE_RCOLUMNELEMENT_SPEC(double, EColumnType::kReal32, 32, RColumnElementCastLE, <double, float>);
 DECLARE_RCOLUMNELEMENT_SPEC(double, EColumnType::kSplitReal32, 32, RColumnElementSplitLE, <double, float>);
 
+template <>
+class RColumnElement<double, EColumnType::kReal32Quant> : public RColumnElementQuantized<double> {
+public:
+   static constexpr std::size_t kSize = sizeof(double);
+   static constexpr std::size_t kBitsOnStorage = kMaxBitsOnStorage;
+   RColumnElement() : RColumnElementQuantized(kSize) {}
+};
+
 DECLARE_RCOLUMNELEMENT_SPEC(ClusterSize_t, EColumnType::kIndex64, 64, RColumnElementLE, <std::uint64_t>);
 DECLARE_RCOLUMNELEMENT_SPEC(ClusterSize_t, EColumnType::kIndex32, 32, RColumnElementCastLE,
                             <std::uint64_t, std::uint32_t>);
@@ -721,6 +937,7 @@ std::unique_ptr<RColumnElementBase> RColumnElementBase::Generate(EColumnType typ
    case EColumnType::kSplitUInt32: return std::make_unique<RColumnElement<CppT, EColumnType::kSplitUInt32>>();
    case EColumnType::kSplitInt16: return std::make_unique<RColumnElement<CppT, EColumnType::kSplitInt16>>();
    case EColumnType::kSplitUInt16: return std::make_unique<RColumnElement<CppT, EColumnType::kSplitUInt16>>();
+   case EColumnType::kReal32Quant: return std::make_unique<RColumnElement<CppT, EColumnType::kReal32Quant>>();
    default: R__ASSERT(false);
    }
    // never here
@@ -730,6 +947,15 @@ std::unique_ptr<RColumnElementBase> RColumnElementBase::Generate(EColumnType typ
 template <>
 std::unique_ptr<RColumnElementBase> RColumnElementBase::Generate<void>(EColumnType type);
 
+template <typename CppT>
+std::unique_ptr<RColumnElementBase> RColumnElementBase::Generate(const RColumnModel &model)
+{
+   auto element = Generate<CppT>(model.GetType());
+   if (model.HasValueRange())
+      element->SetQuantization(model.GetBitsOnStorage(), model.GetValueMin(), model.GetValueMax());
+   return element;
+}
+
 } // namespace Detail
 } // namespace Experimental
 } // namespace ROOT
@@ -18,6 +18,7 @@
 
 #include <ROOT/RStringView.hxx>
 
+#include <cstdint>
 #include <string>
 
 namespace ROOT {
@@ -72,6 +73,9 @@ enum class EColumnType {
    kSplitUInt32,
    kSplitInt16,
    kSplitUInt16,
+   // Floating point values mapped to unsigned integers with a configurable number of bits (1 to 32) equally
+   // distributed over a fixed value range, cf. Double32_t[min,max,nbits].  The element values are bit-packed.
+   kReal32Quant,
    kMax,
 };
 
@@ -86,6 +90,11 @@ class RColumnModel {
 private:
    EColumnType fType;
    bool fIsSorted;
+   /// Only set for column types with a configurable element width (kReal32Quant); zero otherwise
+   std::uint16_t fBitsOnStorage = 0;
+   /// Only used for quantized columns: the value range that is mapped to the integers [0, 2^fBitsOnStorage - 1]
+   double fValueMin = 0.0;
+   double fValueMax = 0.0;
 
 public:
    RColumnModel() : fType(EColumnType::kUnknown), fIsSorted(false) {}
@@ -94,12 +103,23 @@ public:
    {
    }
    RColumnModel(EColumnType type, bool isSorted) : fType(type), fIsSorted(isSorted) {}
+   /// Model of a column with parametrized elements, i.e. a kReal32Quant column
+   RColumnModel(EColumnType type, std::uint16_t bitsOnStorage, double valueMin, double valueMax)
+      : fType(type), fIsSorted(false), fBitsOnStorage(bitsOnStorage), fValueMin(valueMin), fValueMax(valueMax)
+   {
+   }
 
    EColumnType GetType() const { return fType; }
    bool GetIsSorted() const { return fIsSorted; }
+   /// Returns zero if the element width is given by the column type
+   std::uint16_t GetBitsOnStorage() const { return fBitsOnStorage; }
+   bool HasValueRange() const { return fBitsOnStorage > 0; }
+   double GetValueMin() const { return fValueMin; }
+   double GetValueMax() const { return fValueMax; }
 
    bool operator ==(const RColumnModel &other) const {
-      return (fType == other.fType) && (fIsSorted == other.fIsSorted);
+      return (fType == other.fType) && (fIsSorted == other.fIsSorted) && (fBitsOnStorage == other.fBitsOnStorage) &&
+             (fValueMin == other.fValueMin) && (fValueMax == other.fValueMax);
    }
    bool operator!=(const RColumnModel &other) const { return !(other == *this); }
 };
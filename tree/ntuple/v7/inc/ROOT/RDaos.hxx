@@ -230,6 +230,14 @@ public:
 
    using MultiObjectRWOperation_t = std::unordered_map<ROidDkeyPair, RWOperation, ROidDkeyPair::Hash>;
 
+   /// \brief Describes the read/write operations on one of several containers of the same pool that are issued
+   /// together, see the static `ReadV`/`WriteV` functions.
+   struct RContainerRWOperation {
+      RDaosContainer *fContainer = nullptr;
+      MultiObjectRWOperation_t *fMap = nullptr;
+      ObjClassId_t fCid{OC_SX};
+   };
+
    std::string GetContainerUuid();
 
 private:
@@ -248,11 +256,21 @@ private:
      */
    int VectorReadWrite(MultiObjectRWOperation_t &map, ObjClassId_t cid,
                        int (RDaosObject::*fn)(RDaosObject::FetchUpdateArgs &));
+   /**
+     \brief Perform vector read/write operations on several containers of the same pool. All the requests are launched
+     before waiting for any of them, so that they are in flight at the same time.
+     \param ops The containers, each with a `MultiObjectRWOperation_t` and the object class used to qualify OIDs.
+     \param fn Either `&RDaosObject::Fetch` (read) or `&RDaosObject::Update` (write).
+     \return 0 if the operation succeeded; a negative DAOS error number otherwise.
+     */
+   static int VectorReadWrite(std::span<RContainerRWOperation> ops,
+                              int (RDaosObject::*fn)(RDaosObject::FetchUpdateArgs &));
 
 public:
    RDaosContainer(std::shared_ptr<RDaosPool> pool, std::string_view containerId, bool create = false);
    ~RDaosContainer();
 
+   std::shared_ptr<RDaosPool> GetPool() const { return fPool; }
    ObjClassId_t GetDefaultObjectClass() const { return fDefaultObjectClass; }
    void SetDefaultObjectClass(const ObjClassId_t cid) { fDefaultObjectClass = cid; }
 
@@ -308,6 +326,20 @@ public:
       return VectorReadWrite(map, cid, &RDaosObject::Update);
    }
    int WriteV(MultiObjectRWOperation_t &map) { return WriteV(map, fDefaultObjectClass); }
+
+   /**
+     \brief Perform vector read operations on multiple objects of several containers that share the same pool.
+     \param ops The read operations to perform, grouped by container.
+     \return 0 if the operation succeeded; a negative DAOS error number otherwise.
+     */
+   static int ReadV(std::span<RContainerRWOperation> ops) { return VectorReadWrite(ops, &RDaosObject::Fetch); }
+
+   /**
+     \brief Perform vector write operations on multiple objects of several containers that share the same pool.
+     \param ops The write operations to perform, grouped by container.
+     \return 0 if the operation succeeded; a negative DAOS error number otherwise.
+     */
+   static int WriteV(std::span<RContainerRWOperation> ops) { return VectorReadWrite(ops, &RDaosObject::Update); }
 };
 
 } // namespace Detail
@@ -256,6 +256,8 @@ protected:
    {
       other.DestroyValue(objPtr, dtorOnly);
    }
+   /// Allow derived classes to access the principal column of other (sub) fields, e.g. to map item pages
+   static RColumn *GetPrincipalColumnOf(const RFieldBase &other) { return other.fPrincipalColumn; }
 
    /// Operations on values of complex types, e.g. ones that involve multiple columns or for which no direct
    /// column type exists.
@@ -856,6 +858,11 @@ public:
    {
       fPrincipalColumn->GetCollectionInfo(clusterIndex, collectionStart, size);
    }
+   /// Lets the RVec at `to` adopt the items of the collection at globalIndex in the page buffer of the item column,
+   /// without copying. This requires a simple item field and all items of the collection to be on the same page;
+   /// otherwise, `to` is left unchanged and false is returned. `to` must not own memory, e.g. it is a value that
+   /// is only ever read through this method. The adopted memory is valid until the item column maps another page.
+   bool ReadAsView(NTupleSize_t globalIndex, void *to);
 };
 
 /// The generic field for fixed size arrays, which do not need an offset column
@@ -1393,9 +1400,20 @@ public:
 
 template <>
 class RField<float> : public Detail::RFieldBase {
+private:
+   /// Set by SetQuantized(); zero unless the field is written to a kReal32Quant column
+   std::uint16_t fQuantizedBits = 0;
+   double fQuantizedMin = 0.0;
+   double fQuantizedMax = 0.0;
+
 protected:
-   std::unique_ptr<Detail::RFieldBase> CloneImpl(std::string_view newName) const final {
-      return std::make_unique<RField>(newName);
+   std::unique_ptr<Detail::RFieldBase> CloneImpl(std::string_view newName) const final
+   {
+      auto clone = std::make_unique<RField>(newName);
+      clone->fQuantizedBits = fQuantizedBits;
+      clone->fQuantizedMin = fQuantizedMin;
+      clone->fQuantizedMax = fQuantizedMax;
+      return clone;
    }
 
    const RColumnRepresentations &GetColumnRepresentations() const final;
@@ -1431,14 +1449,29 @@ public:
    size_t GetValueSize() const final { return sizeof(float); }
    size_t GetAlignment() const final { return alignof(float); }
    void AcceptVisitor(Detail::RFieldVisitor &visitor) const final;
+
+   /// Store the values as `nBits` wide unsigned integers that are equally distributed over [minValue, maxValue],
+   /// like for Double32_t[minValue, maxValue, nBits]. Values outside the range are clamped. Only valid for writing.
+   void SetQuantized(std::uint16_t nBits, double minValue, double maxValue);
 };
 
 
 template <>
 class RField<double> : public Detail::RFieldBase {
+private:
+   /// Set by SetQuantized(); zero unless the field is written to a kReal32Quant column
+   std::uint16_t fQuantizedBits = 0;
+   double fQuantizedMin = 0.0;
+   double fQuantizedMax = 0.0;
+
 protected:
-   std::unique_ptr<Detail::RFieldBase> CloneImpl(std::string_view newName) const final {
-      return std::make_unique<RField>(newName);
+   std::unique_ptr<Detail::RFieldBase> CloneImpl(std::string_view newName) const final
+   {
+      auto clone = std::make_unique<RField>(newName);
+      clone->fQuantizedBits = fQuantizedBits;
+      clone->fQuantizedMin = fQuantizedMin;
+      clone->fQuantizedMax = fQuantizedMax;
+      return clone;
    }
 
    const RColumnRepresentations &GetColumnRepresentations() const final;
@@ -1477,6 +1510,9 @@ public:
 
    // Set the column representation to 32 bit floating point and the type alias to Double32_t
    void SetDouble32();
+   /// Store the values as `nBits` wide unsigned integers that are equally distributed over [minValue, maxValue],
+   /// like for Double32_t[minValue, maxValue, nBits]. Values outside the range are clamped. Only valid for writing.
+   void SetQuantized(std::uint16_t nBits, double minValue, double maxValue);
 };
 
 template <>
@@ -1607,6 +1643,11 @@ public:
 
 template <>
 class RField<std::int16_t> : public Detail::RFieldBase {
+private:
+   /// Value range of the on-disk column if it is an integer column narrower than std::int16_t, see AppendImpl()
+   std::int16_t fMinValue = 0;
+   std::int16_t fMaxValue = 0;
+
 protected:
    std::unique_ptr<Detail::RFieldBase> CloneImpl(std::string_view newName) const final {
       return std::make_unique<RField>(newName);
@@ -1616,6 +1657,7 @@ protected:
    void GenerateColumnsImpl() final;
    void GenerateColumnsImpl(const RNTupleDescriptor &desc) final;
    void GenerateValue(void *where) final { new (where) int16_t(0); }
+   std::size_t AppendImpl(const void *from) final;
 
 public:
    static std::string TypeName() { return "std::int16_t"; }
@@ -1649,6 +1691,11 @@ public:
 
 template <>
 class RField<std::uint16_t> : public Detail::RFieldBase {
+private:
+   /// Value range of the on-disk column if it is an integer column narrower than std::uint16_t, see AppendImpl()
+   std::uint16_t fMinValue = 0;
+   std::uint16_t fMaxValue = 0;
+
 protected:
    std::unique_ptr<Detail::RFieldBase> CloneImpl(std::string_view newName) const final {
       return std::make_unique<RField>(newName);
@@ -1658,6 +1705,7 @@ protected:
    void GenerateColumnsImpl() final;
    void GenerateColumnsImpl(const RNTupleDescriptor &desc) final;
    void GenerateValue(void *where) final { new (where) int16_t(0); }
+   std::size_t AppendImpl(const void *from) final;
 
 public:
    static std::string TypeName() { return "std::uint16_t"; }
@@ -1691,6 +1739,11 @@ public:
 
 template <>
 class RField<std::int32_t> : public Detail::RFieldBase {
+private:
+   /// Value range of the on-disk column if it is an integer column narrower than std::int32_t, see AppendImpl()
+   std::int32_t fMinValue = 0;
+   std::int32_t fMaxValue = 0;
+
 protected:
    std::unique_ptr<Detail::RFieldBase> CloneImpl(std::string_view newName) const final {
       return std::make_unique<RField>(newName);
@@ -1700,6 +1753,7 @@ protected:
    void GenerateColumnsImpl() final;
    void GenerateColumnsImpl(const RNTupleDescriptor &desc) final;
    void GenerateValue(void *where) final { new (where) int32_t(0); }
+   std::size_t AppendImpl(const void *from) final;
 
 public:
    static std::string TypeName() { return "std::int32_t"; }
@@ -1733,6 +1787,11 @@ public:
 
 template <>
 class RField<std::uint32_t> : public Detail::RFieldBase {
+private:
+   /// Value range of the on-disk column if it is an integer column narrower than std::uint32_t, see AppendImpl()
+   std::uint32_t fMinValue = 0;
+   std::uint32_t fMaxValue = 0;
+
 protected:
    std::unique_ptr<Detail::RFieldBase> CloneImpl(std::string_view newName) const final {
       return std::make_unique<RField>(newName);
@@ -1742,6 +1801,7 @@ protected:
    void GenerateColumnsImpl() final;
    void GenerateColumnsImpl(const RNTupleDescriptor &desc) final;
    void GenerateValue(void *where) final { new (where) uint32_t(0); }
+   std::size_t AppendImpl(const void *from) final;
 
 public:
    static std::string TypeName() { return "std::uint32_t"; }
@@ -1775,6 +1835,11 @@ public:
 
 template <>
 class RField<std::uint64_t> : public Detail::RFieldBase {
+private:
+   /// Value range of the on-disk column if it is an integer column narrower than std::uint64_t, see AppendImpl()
+   std::uint64_t fMinValue = 0;
+   std::uint64_t fMaxValue = 0;
+
 protected:
    std::unique_ptr<Detail::RFieldBase> CloneImpl(std::string_view newName) const final {
       return std::make_unique<RField>(newName);
@@ -1784,6 +1849,7 @@ protected:
    void GenerateColumnsImpl() final;
    void GenerateColumnsImpl(const RNTupleDescriptor &desc) final;
    void GenerateValue(void *where) final { new (where) uint64_t(0); }
+   std::size_t AppendImpl(const void *from) final;
 
 public:
    static std::string TypeName() { return "std::uint64_t"; }
@@ -1817,6 +1883,11 @@ public:
 
 template <>
 class RField<std::int64_t> : public Detail::RFieldBase {
+private:
+   /// Value range of the on-disk column if it is an integer column narrower than std::int64_t, see AppendImpl()
+   std::int64_t fMinValue = 0;
+   std::int64_t fMaxValue = 0;
+
 protected:
    std::unique_ptr<Detail::RFieldBase> CloneImpl(std::string_view newName) const final {
       return std::make_unique<RField>(newName);
@@ -1826,6 +1897,7 @@ protected:
    void GenerateColumnsImpl() final;
    void GenerateColumnsImpl(const RNTupleDescriptor &desc) final;
    void GenerateValue(void *where) final { new (where) int64_t(0); }
+   std::size_t AppendImpl(const void *from) final;
 
 public:
    static std::string TypeName() { return "std::int64_t"; }
@@ -34,6 +34,7 @@
 #include <memory>
 #include <sstream>
 #include <utility>
+#include <vector>
 
 class TFile;
 
@@ -186,6 +187,11 @@ public:
    /// have an identical number of entries.  Fields in the combined RNTuple are named with the ntuple name
    /// as a prefix, e.g. myNTuple1.px and myNTuple2.pt (see tutorial ntpl006_friends)
    static std::unique_ptr<RNTupleReader> OpenFriends(std::span<ROpenSpec> ntuples);
+   /// Open an RNTuple that was written in several shard files (see RNTupleWriteOptions::SetMaxShardSize() and
+   /// RNTupleWriteOptions::SetNShards()) as one virtual, vertically combined ntuple. The storage is the path
+   /// that was given to the writer; it holds the index of the shard files.
+   static std::unique_ptr<RNTupleReader> OpenShards(std::string_view ntupleName, std::string_view storage,
+                                                    const RNTupleReadOptions &options = RNTupleReadOptions());
 
    /// The user imposes an ntuple model, which must be compatible with the model found in the data on
    /// storage.
@@ -275,6 +281,15 @@ public:
    /// ~~~
    RNTupleGlobalRange GetEntryRange() { return RNTupleGlobalRange(0, GetNEntries()); }
 
+   /// Returns the entry ranges of the clusters that may contain values of the given field within [min, max], in
+   /// ascending entry order and with adjacent ranges coalesced. Uses the cluster column statistics written with
+   /// RNTupleWriteOptions::SetHasColumnStatistics(); clusters without statistics are always included. The field must
+   /// have a numerical, single-column representation (e.g. float or std::int32_t). The entries of the returned
+   /// ranges still need to be checked against the cut.
+   ///
+   /// Raises an exception if there is no field with the given name.
+   std::vector<RNTupleGlobalRange> GetMatchingClusterRanges(std::string_view fieldName, double min, double max);
+
    /// Provides access to an individual field that can contain either a scalar value or a collection, e.g.
    /// GetView<double>("particles.pt") or GetView<std::vector<double>>("particle").  It can as well be the index
    /// field of a collection itself, like GetView<NTupleSize_t>("particle").
@@ -380,9 +395,17 @@ private:
    std::size_t fMaxUnzippedClusterSize;
    /// Estimator of uncompressed cluster size, taking into account the estimated compression ratio
    NTupleSize_t fUnzippedClusterSizeEst;
+   /// The maximum number of entries buffered by FillSorted() before they are written
+   std::size_t fSortWindowSize = 0;
+   /// Entries passed to FillSorted() that are not yet written, together with their sort key
+   std::vector<std::pair<double, std::unique_ptr<REntry>>> fSortBuffer;
+   /// Entries written by FillSorted() that are recycled by CreateSortEntry()
+   std::vector<std::unique_ptr<REntry>> fSortFreeEntries;
 
    // Helper function that is called from CommitCluster() when necessary
    void CommitClusterGroup();
+   /// Writes the entries buffered by FillSorted() in ascending order of their sort key
+   void FlushSortBuffer();
 
 public:
    /// Throws an exception if the model is null.
@@ -421,6 +444,18 @@ public:
          CommitCluster();
       return bytesWritten;
    }
+   /// Buffers the entry instead of writing it immediately. Once the number of buffered entries reaches the sort
+   /// window size, they are written in ascending order of their sort key, e.g. the run number or a bucketed physics
+   /// variable. Clusters then span tight ranges of the sort key, which improves the compression and lets readers skip
+   /// clusters based on the column statistics. Buffered entries are also written by CommitCluster() and on
+   /// destruction. Entries with equal keys keep their fill order.
+   void FillSorted(std::unique_ptr<REntry> entry, double sortKey);
+   /// Sets the number of entries that FillSorted() buffers before sorting and writing them; 0 sorts all entries
+   /// until the next CommitCluster(). The window should span at least a few clusters. Buffered entries are kept in
+   /// memory in their deserialized form.
+   void SetSortWindowSize(std::size_t nEntries);
+   /// Returns an entry for FillSorted(), recycling the entries that FillSorted() already wrote
+   std::unique_ptr<REntry> CreateSortEntry();
    /// Ensure that the data from the so far seen Fill calls has been written to storage
    void CommitCluster(bool commitClusterGroup = false);
 
@@ -28,6 +28,7 @@
 #include <chrono>
 #include <functional>
 #include <iterator>
+#include <limits>
 #include <map>
 #include <memory>
 #include <ostream>
@@ -212,6 +213,44 @@ class RClusterDescriptor {
    friend class RClusterDescriptorBuilder;
 
 public:
+   /// Optional summary of the values of a column in a cluster, which allows for skipping clusters whose values cannot
+   /// pass a range cut. All values are converted to double and [fMin, fMax] is guaranteed to contain every (non-NaN)
+   /// value of the column range. Invalid statistics mean "unknown" and match any range.
+   struct RColumnStatistics {
+      bool fIsValid = false;
+      double fMin = std::numeric_limits<double>::infinity();
+      double fMax = -std::numeric_limits<double>::infinity();
+
+      /// Valid statistics of zero elements, the neutral element for Merge()
+      static RColumnStatistics MakeEmpty()
+      {
+         RColumnStatistics stats;
+         stats.fIsValid = true;
+         return stats;
+      }
+
+      /// Widens the statistics by the ones of another set of values; unknown statistics make the result unknown.
+      void Merge(const RColumnStatistics &other)
+      {
+         if (!other.fIsValid) {
+            *this = RColumnStatistics();
+            return;
+         }
+         fMin = std::min(fMin, other.fMin);
+         fMax = std::max(fMax, other.fMax);
+      }
+
+      /// Returns false only if it is certain that no value lies in [min, max]
+      bool MayContain(double min, double max) const { return !fIsValid || (fMin <= max && fMax >= min); }
+
+      bool operator==(const RColumnStatistics &other) const
+      {
+         if (fIsValid != other.fIsValid)
+            return false;
+         return !fIsValid || (fMin == other.fMin && fMax == other.fMax);
+      }
+   };
+
    /// The window of element indexes of a particular column in a particular cluster
    struct RColumnRange {
       DescriptorId_t fPhysicalColumnId = kInvalidDescriptorId;
@@ -222,13 +261,13 @@ public:
       /// The usual format for ROOT compression settings (see Compression.h).
       /// The pages of a particular column in a particular cluster are all compressed with the same settings.
       std::int64_t fCompressionSettings = 0;
-
-      // TODO(jblomer): we perhaps want to store summary information, such as average, min/max, etc.
-      // Should this be done on the field level?
+      /// Only set if the writer collected column statistics (see RNTupleWriteOptions::SetHasColumnStatistics())
+      RColumnStatistics fStatistics;
 
       bool operator==(const RColumnRange &other) const {
          return fPhysicalColumnId == other.fPhysicalColumnId && fFirstElementIndex == other.fFirstElementIndex &&
-                fNElements == other.fNElements && fCompressionSettings == other.fCompressionSettings;
+                fNElements == other.fNElements && fCompressionSettings == other.fCompressionSettings &&
+                fStatistics == other.fStatistics;
       }
 
       bool Contains(NTupleSize_t index) const {
@@ -760,6 +799,7 @@ public:
 
    /// We know the number of entries from adding the cluster summaries
    NTupleSize_t GetNEntries() const { return fNEntries; }
+   /// Only takes into account clusters with page locations
    NTupleSize_t GetNElements(DescriptorId_t physicalColumnId) const;
 
    /// Returns the logical parent of all top-level NTuple data fields.
@@ -770,6 +810,7 @@ public:
    DescriptorId_t FindFieldId(std::string_view fieldName) const;
    DescriptorId_t FindLogicalColumnId(DescriptorId_t fieldId, std::uint32_t columnIndex) const;
    DescriptorId_t FindPhysicalColumnId(DescriptorId_t fieldId, std::uint32_t columnIndex) const;
+   /// Only finds clusters with page locations, i.e. not the summary-only clusters of cluster groups not yet loaded
    DescriptorId_t FindClusterId(DescriptorId_t physicalColumnId, NTupleSize_t index) const;
    DescriptorId_t FindNextClusterId(DescriptorId_t clusterId) const;
    DescriptorId_t FindPrevClusterId(DescriptorId_t clusterId) const;
@@ -949,7 +990,8 @@ public:
    }
 
    RResult<void> CommitColumnRange(DescriptorId_t physicalId, std::uint64_t firstElementIndex,
-                                   std::uint32_t compressionSettings, const RClusterDescriptor::RPageRange &pageRange);
+                                   std::uint32_t compressionSettings, const RClusterDescriptor::RPageRange &pageRange,
+                                   const RClusterDescriptor::RColumnStatistics &statistics = {});
 
    /// Add column and page ranges for deferred columns missing in this cluster.  The locator type for the synthesized
    /// page ranges is `kTypePageZero`.  All the page sources must be able to populate the 'zero' page from such locator.
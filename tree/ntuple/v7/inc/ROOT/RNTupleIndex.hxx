@@ -0,0 +1,121 @@
+/// \file ROOT/RNTupleIndex.hxx
+/// \ingroup NTuple ROOT7
+/// \date 2026-10-14
+/// \warning This is part of the ROOT 7 prototype! It will change without notice. It might trigger earthquakes. Feedback
+/// is welcome!
+
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT7_RNTupleIndex
+#define ROOT7_RNTupleIndex
+
+#include <ROOT/RNTupleUtil.hxx>
+#include <ROOT/RStringView.hxx>
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <tuple>
+#include <vector>
+
+class TFile;
+
+namespace ROOT {
+namespace Experimental {
+
+namespace Detail {
+class RPageSource;
+} // namespace Detail
+
+// clang-format off
+/**
+\class ROOT::Experimental::RNTupleIndex
+\ingroup NTuple
+\brief A sorted index that maps (major, minor) keys, such as (run, event), to entry numbers of an RNTuple
+
+The index is the RNTuple counterpart of TTreeIndex. It is built from one or two top-level integer fields of an
+ntuple. With implicit multi-threading enabled, the clusters are read in parallel. The keys are kept in memory in
+sorted order, so that lookups take O(log n) time. If several entries have the same key, the lookup returns the
+smallest entry number.
+
+The index can be stored as an auxiliary RNTuple next to the indexed ntuple in the same ROOT file and opened later
+without scanning the indexed ntuple again.
+
+~~~ {.cpp}
+auto index = RNTupleIndex::Build("run", "event", "ntpl", "data.root");
+auto file = std::unique_ptr<TFile>(TFile::Open("data.root", "UPDATE"));
+index->Write(RNTupleIndex::GetDefaultName("ntpl"), *file);
+...
+auto index = RNTupleIndex::Open(RNTupleIndex::GetDefaultName("ntpl"), "data.root");
+auto entry = index->GetEntryNumber(run, event);
+~~~
+*/
+// clang-format on
+class RNTupleIndex {
+public:
+   /// Keys are signed or unsigned integers of at most 64 bit; signed values are stored with their two's complement
+   /// bit pattern
+   using Key_t = std::uint64_t;
+
+private:
+   struct RIndexEntry {
+      Key_t fMajor = 0;
+      Key_t fMinor = 0;
+      NTupleSize_t fEntry = kInvalidNTupleIndex;
+
+      bool operator<(const RIndexEntry &other) const
+      {
+         return std::tie(fMajor, fMinor, fEntry) < std::tie(other.fMajor, other.fMinor, other.fEntry);
+      }
+   };
+
+   std::string fMajorFieldName;
+   /// Empty for an index over a single field
+   std::string fMinorFieldName;
+   /// Sorted by key and entry number
+   std::vector<RIndexEntry> fEntries;
+
+   RNTupleIndex(std::string_view majorFieldName, std::string_view minorFieldName);
+
+public:
+   /// Builds the index from the given top-level integer fields of the ntuple attached to `source`. The `minorField`
+   /// can be empty, in which case all minor keys are zero. Throws an exception if the fields are missing or are not
+   /// of integer type.
+   static std::unique_ptr<RNTupleIndex>
+   Build(std::string_view majorField, std::string_view minorField, Detail::RPageSource &source);
+   static std::unique_ptr<RNTupleIndex> Build(std::string_view majorField, std::string_view minorField,
+                                              std::string_view ntupleName, std::string_view storage);
+   /// Reads an index that has been stored with Write()
+   static std::unique_ptr<RNTupleIndex> Open(std::string_view indexName, std::string_view storage);
+   /// The name under which the index of the given ntuple is stored by convention
+   static std::string GetDefaultName(std::string_view ntupleName) { return std::string(ntupleName) + ".index"; }
+
+   RNTupleIndex(const RNTupleIndex &other) = delete;
+   RNTupleIndex &operator=(const RNTupleIndex &other) = delete;
+   RNTupleIndex(RNTupleIndex &&other) = default;
+   RNTupleIndex &operator=(RNTupleIndex &&other) = default;
+   ~RNTupleIndex() = default;
+
+   /// Stores the index as an RNTuple with the given name in an open, writable file
+   void Write(std::string_view indexName, TFile &file) const;
+
+   /// Returns the smallest entry number with the given key or kInvalidNTupleIndex if there is no such entry
+   NTupleSize_t GetEntryNumber(Key_t major, Key_t minor = 0) const;
+   /// Returns all the entry numbers with the given key in ascending order
+   std::vector<NTupleSize_t> GetEntryNumbers(Key_t major, Key_t minor = 0) const;
+
+   std::size_t GetNKeys() const { return fEntries.size(); }
+   const std::string &GetMajorFieldName() const { return fMajorFieldName; }
+   const std::string &GetMinorFieldName() const { return fMinorFieldName; }
+};
+
+} // namespace Experimental
+} // namespace ROOT
+
+#endif
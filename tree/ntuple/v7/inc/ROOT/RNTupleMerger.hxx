@@ -19,10 +19,16 @@
 #include <ROOT/RError.hxx>
 #include <ROOT/RNTupleDescriptor.hxx>
 #include <ROOT/RNTupleUtil.hxx>
+#include <ROOT/RSpan.hxx>
 
 namespace ROOT {
 namespace Experimental {
 
+namespace Detail {
+class RPageSink;
+class RPageSource;
+} // namespace Detail
+
 // clang-format off
 /**
 \class ROOT::Experimental::RFieldMerger
@@ -38,6 +44,27 @@ public:
    static RResult<RFieldMerger> Merge(const RFieldDescriptor &lhs, const RFieldDescriptor &rhs);
 };
 
+// clang-format off
+/**
+\class ROOT::Experimental::RNTupleMerger
+\ingroup NTuple
+\brief Concatenates RNTuples of identical schema by copying their clusters page by page
+
+The pages are copied verbatim, i.e. without decompression and unpacking, if the compression settings of a source
+column range match the ones of the destination. Otherwise, the pages are decompressed and compressed again with the
+settings of the destination, which is still much faster than a full read and write cycle. Only the ntuple meta-data,
+i.e. header, footer and page lists, are written anew. Every cluster of a source becomes a cluster of the merged
+ntuple; the clusters of every source form one cluster group.
+*/
+// clang-format on
+class RNTupleMerger {
+public:
+   /// Appends the entries of all the sources, in order, to the destination and commits the dataset. The sources get
+   /// attached by the merger. The destination must not have been created; it is created with the schema and the
+   /// column representations of the first source. Throws an exception if the schema of any source differs.
+   void Merge(std::span<Detail::RPageSource *> sources, Detail::RPageSink &destination);
+};
+
 } // namespace Experimental
 } // namespace ROOT
 
@@ -19,6 +19,7 @@
 #include <Compression.h>
 #include <ROOT/RNTupleUtil.hxx>
 
+#include <cstdint>
 #include <memory>
 
 namespace ROOT {
@@ -64,6 +65,18 @@ protected:
    /// If set, 64bit index columns are replaced by 32bit index columns. This limits the cluster size to 512MB
    /// but it can result in smaller file sizes for data sets with many collections and lz4 or no compression.
    bool fHasSmallClusters = false;
+   /// If set, the page sink records the minimum and maximum value of every numerical column in every cluster.
+   /// Readers can use these statistics to skip clusters that cannot pass a range cut.
+   bool fHasColumnStatistics = false;
+   /// With parallel compression in a buffered sink, the maximum number of pages that are queued for or under
+   /// compression. Once the limit is reached, the filling thread joins the compression of the queued pages. This
+   /// bounds the amount of uncompressed data held in memory. Zero means unbounded.
+   std::size_t fMaxUnsealedPages = 256;
+   /// If non-zero, the ntuple is written as a series of shard files, each of which is closed and replaced by a new
+   /// one once it holds approximately this many compressed bytes.
+   std::uint64_t fMaxShardSize = 0;
+   /// If larger than one, clusters are written round-robin to this many shard files
+   std::size_t fNShards = 1;
 
 public:
    /// A maximum size of 512MB still allows for a vector of bool to be stored in a small cluster.  This is the
@@ -97,6 +110,21 @@ public:
 
    bool GetHasSmallClusters() const { return fHasSmallClusters; }
    void SetHasSmallClusters(bool val) { fHasSmallClusters = val; }
+
+   bool GetHasColumnStatistics() const { return fHasColumnStatistics; }
+   void SetHasColumnStatistics(bool val) { fHasColumnStatistics = val; }
+
+   std::size_t GetMaxUnsealedPages() const { return fMaxUnsealedPages; }
+   void SetMaxUnsealedPages(std::size_t val) { fMaxUnsealedPages = val; }
+
+   std::uint64_t GetMaxShardSize() const { return fMaxShardSize; }
+   /// Roll over to a new shard file once a shard exceeds the given number of bytes (0 turns it off). Sharded ntuples
+   /// are read back with RNTupleReader::OpenShards(). See RPageSinkShards.
+   void SetMaxShardSize(std::uint64_t val) { fMaxShardSize = val; }
+
+   std::size_t GetNShards() const { return fNShards; }
+   /// Write clusters round-robin to the given number of shard files (1 turns it off). See RPageSinkShards.
+   void SetNShards(std::size_t val);
 };
 
 // clang-format off
@@ -112,6 +140,8 @@ class RNTupleWriteOptionsDaos : public RNTupleWriteOptions {
    /// cage size yields acceptable results in throughput and page granularity for most use cases. A `fMaxCageSize` of 0
    /// disables the caging mechanism.
    uint32_t fMaxCageSize = 16 * RNTupleWriteOptions::fApproxUnzippedPageSize;
+   /// The number of containers across which the pages are striped; 1 by default, i.e. no striping
+   uint32_t fNStripes = 1;
 
 public:
    ~RNTupleWriteOptionsDaos() override = default;
@@ -129,6 +159,13 @@ public:
    /// that cage size will be no smaller than the approximate uncompressed page size.
    /// To disable page concatenation, set this value to 0.
    void SetMaxCageSize(uint32_t cageSz) { fMaxCageSize = cageSz; }
+
+   uint32_t GetNStripes() const { return fNStripes; }
+   /// Stripe the pages across the given number of containers of the pool, for higher aggregate bandwidth.
+   /// The first container is the one in the URI and also holds the ntuple meta-data. The others are created
+   /// with the label of the first one followed by `-1`, `-2`, etc. The pages of a column in a cluster are
+   /// stored in the same container. Readers find the number of stripes in the ntuple anchor.
+   void SetNStripes(uint32_t val);
 };
 
 // clang-format off
@@ -151,12 +188,37 @@ public:
 private:
    EClusterCache fClusterCache = EClusterCache::kDefault;
    unsigned int fClusterBunchSize = 1;
+   /// If set, the cluster pool adapts the cluster bunch size at run time, starting from fClusterBunchSize, such that
+   /// the read-ahead window hides the measured storage latency given the measured processing time per cluster.
+   bool fUseAdaptiveClusterBunchSize = false;
+   /// Upper bound for the cluster bunch size in adaptive mode
+   unsigned int fMaxClusterBunchSize = 64;
+   /// In adaptive mode, the cluster bunch size is reduced such that the clusters of the current and the next
+   /// bunch fit into the given budget for compressed cluster data, in bytes
+   std::uint64_t fClusterPoolMemoryBudget = 512 * 1024 * 1024;
+   /// If set and if the storage supports memory mapping, uncompressed pages of columns whose on-disk representation
+   /// matches the in-memory representation are served directly from a memory mapped region of the file
+   bool fUseMmap = false;
+   /// If set, the page lists of the cluster groups are read when one of their clusters is first accessed instead of
+   /// when the page source is attached. Opening a large ntuple then only reads the header, the footer and the page list
+   /// of the last cluster group. Supported by the file backend; other backends read all page lists on attach.
+   bool fLoadClusterGroupsOnDemand = false;
 
 public:
    EClusterCache GetClusterCache() const { return fClusterCache; }
    void SetClusterCache(EClusterCache val) { fClusterCache = val; }
    unsigned int GetClusterBunchSize() const  { return fClusterBunchSize; }
    void SetClusterBunchSize(unsigned int val) { fClusterBunchSize = val; }
+   bool GetUseAdaptiveClusterBunchSize() const { return fUseAdaptiveClusterBunchSize; }
+   void SetUseAdaptiveClusterBunchSize(bool val) { fUseAdaptiveClusterBunchSize = val; }
+   unsigned int GetMaxClusterBunchSize() const { return fMaxClusterBunchSize; }
+   void SetMaxClusterBunchSize(unsigned int val) { fMaxClusterBunchSize = val; }
+   std::uint64_t GetClusterPoolMemoryBudget() const { return fClusterPoolMemoryBudget; }
+   void SetClusterPoolMemoryBudget(std::uint64_t val) { fClusterPoolMemoryBudget = val; }
+   bool GetUseMmap() const { return fUseMmap; }
+   void SetUseMmap(bool val) { fUseMmap = val; }
+   bool GetLoadClusterGroupsOnDemand() const { return fLoadClusterGroupsOnDemand; }
+   void SetLoadClusterGroupsOnDemand(bool val) { fLoadClusterGroupsOnDemand = val; }
 };
 
 } // namespace Experimental
@@ -0,0 +1,183 @@
+/// \file ROOT/RNTupleParallelWriter.hxx
+/// \ingroup NTuple ROOT7
+/// \date 2026-10-14
+/// \warning This is part of the ROOT 7 prototype! It will change without notice. It might trigger earthquakes. Feedback
+/// is welcome!
+
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT7_RNTupleParallelWriter
+#define ROOT7_RNTupleParallelWriter
+
+#include <ROOT/RConfig.hxx> // for R__unlikely
+#include <ROOT/REntry.hxx>
+#include <ROOT/RError.hxx>
+#include <ROOT/RNTupleMetrics.hxx>
+#include <ROOT/RNTupleModel.hxx>
+#include <ROOT/RNTupleOptions.hxx>
+#include <ROOT/RNTupleUtil.hxx>
+#include <ROOT/RPageStorage.hxx>
+#include <ROOT/RStringView.hxx>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace ROOT {
+namespace Experimental {
+
+class RNTupleParallelWriter;
+
+// clang-format off
+/**
+\class ROOT::Experimental::RNTupleFillContext
+\ingroup NTuple
+\brief A context for filling entries into an RNTuple that is written by an RNTupleParallelWriter
+
+Every fill context has its own copy of the ntuple model and its own page buffers. Entries are filled into private
+clusters which are committed to the parallel writer's page sink under a short critical section.
+A fill context must only be used by one thread at a time. The fill context needs to be destructed before its
+parallel writer. Upon destruction, the fill context commits its open cluster.
+*/
+// clang-format on
+class RNTupleFillContext {
+   friend class RNTupleParallelWriter;
+
+private:
+   /// The page sink's parallel page compression scheduler. If IMT is off, pages are compressed by the filling thread.
+   /// Needs to be destructed after the page sink is destructed and so declared before.
+   std::unique_ptr<Detail::RPageStorage::RTaskScheduler> fZipTasks;
+   /// A buffered sink that wraps the parallel writer's page sink
+   std::unique_ptr<Detail::RPageSink> fSink;
+   /// Needs to be destructed before fSink
+   std::unique_ptr<RNTupleModel> fModel;
+   NTupleSize_t fLastCommitted = 0;
+   NTupleSize_t fNEntries = 0;
+   /// Keeps track of the number of bytes written into the current cluster
+   std::size_t fUnzippedClusterSize = 0;
+   /// The total number of bytes written to storage (i.e., after compression)
+   std::uint64_t fNBytesCommitted = 0;
+   /// The total number of bytes filled into all the so far committed clusters,
+   /// i.e. the uncompressed size of the written clusters
+   std::uint64_t fNBytesFilled = 0;
+   /// Limit for committing cluster no matter the other tunables
+   std::size_t fMaxUnzippedClusterSize;
+   /// Estimator of uncompressed cluster size, taking into account the estimated compression ratio
+   NTupleSize_t fUnzippedClusterSizeEst;
+
+   RNTupleFillContext(std::unique_ptr<RNTupleModel> model, std::unique_ptr<Detail::RPageSink> sink);
+
+public:
+   RNTupleFillContext(const RNTupleFillContext &) = delete;
+   RNTupleFillContext &operator=(const RNTupleFillContext &) = delete;
+   ~RNTupleFillContext();
+
+   /// Fill the default entry of the fill context's model.
+   /// \return The number of uncompressed bytes written.
+   std::size_t Fill() { return Fill(*fModel->GetDefaultEntry()); }
+   /// Fill an entry created by CreateEntry() of this fill context.
+   /// \return The number of uncompressed bytes written.
+   std::size_t Fill(REntry &entry)
+   {
+      if (R__unlikely(entry.GetModelId() != fModel->GetModelId()))
+         throw RException(R__FAIL("mismatch between entry and model"));
+
+      std::size_t bytesWritten = 0;
+      for (auto &value : entry) {
+         bytesWritten += value.Append();
+      }
+      fUnzippedClusterSize += bytesWritten;
+      fNEntries++;
+      if ((fUnzippedClusterSize >= fMaxUnzippedClusterSize) || (fUnzippedClusterSize >= fUnzippedClusterSizeEst))
+         CommitCluster();
+      return bytesWritten;
+   }
+   /// Commit the so far filled entries of this fill context as a new cluster of the ntuple
+   void CommitCluster();
+
+   std::unique_ptr<REntry> CreateEntry() { return fModel->CreateEntry(); }
+   /// An entry of the fill context's model without values, to be bound with REntry::CaptureValueUnsafe()
+   std::unique_ptr<REntry> CreateBareEntry() { return fModel->CreateBareEntry(); }
+   REntry *GetDefaultEntry() { return fModel->GetDefaultEntry(); }
+   const RNTupleModel *GetModel() const { return fModel.get(); }
+   /// The number of entries filled through this fill context
+   NTupleSize_t GetNEntries() const { return fNEntries; }
+};
+
+// clang-format off
+/**
+\class ROOT::Experimental::RNTupleParallelWriter
+\ingroup NTuple
+\brief A writer to fill an RNTuple from multiple threads
+
+The parallel writer hands out fill contexts, typically one per thread. Each fill context fills its own clusters;
+the clusters are appended to the shared page sink in the order in which they are committed. Thus the order of
+entries across different fill contexts is not defined. Within one fill context, the order of entries is preserved.
+
+~~~ {.cpp}
+auto model = RNTupleModel::Create();
+model->MakeField<float>("pt");
+auto writer = RNTupleParallelWriter::Recreate(std::move(model), "ntpl", "data.root");
+
+auto work = [&writer]() {
+   auto fillContext = writer->CreateFillContext();
+   auto pt = fillContext->GetDefaultEntry()->Get<float>("pt");
+   for (int i = 0; i < 1000; ++i) {
+      *pt = i;
+      fillContext->Fill();
+   }
+};
+std::vector<std::thread> threads;
+for (int i = 0; i < 4; ++i)
+   threads.emplace_back(work);
+for (auto &t : threads)
+   t.join();
+~~~
+
+The ntuple is finalized (cluster group and footer are written) when the parallel writer is destructed.
+All fill contexts must be destructed before.
+*/
+// clang-format on
+class RNTupleParallelWriter {
+private:
+   /// Protects fSink during the commit of clusters by the fill contexts and fFillContexts
+   std::mutex fMutex;
+   /// The page sink shared by all fill contexts; it must not be a buffered sink
+   std::unique_ptr<Detail::RPageSink> fSink;
+   /// The original model, which the fill context models are cloned from. Needs to be destructed before fSink.
+   std::unique_ptr<RNTupleModel> fModel;
+   Detail::RNTupleMetrics fMetrics;
+   /// Used to check that all the fill contexts are destructed before the parallel writer
+   std::vector<std::weak_ptr<RNTupleFillContext>> fFillContexts;
+
+public:
+   /// Throws an exception if the model is null.
+   static std::unique_ptr<RNTupleParallelWriter>
+   Recreate(std::unique_ptr<RNTupleModel> model, std::string_view ntupleName, std::string_view storage,
+            const RNTupleWriteOptions &options = RNTupleWriteOptions());
+   /// Throws an exception if the model or the sink is null or if the sink is buffered
+   RNTupleParallelWriter(std::unique_ptr<RNTupleModel> model, std::unique_ptr<Detail::RPageSink> sink);
+   RNTupleParallelWriter(const RNTupleParallelWriter &) = delete;
+   RNTupleParallelWriter &operator=(const RNTupleParallelWriter &) = delete;
+   ~RNTupleParallelWriter();
+
+   /// Create a new fill context. Thread-safe.
+   std::shared_ptr<RNTupleFillContext> CreateFillContext();
+
+   const RNTupleModel *GetModel() const { return fModel.get(); }
+   void EnableMetrics() { fMetrics.Enable(); }
+   const Detail::RNTupleMetrics &GetMetrics() const { return fMetrics; }
+};
+
+} // namespace Experimental
+} // namespace ROOT
+
+#endif
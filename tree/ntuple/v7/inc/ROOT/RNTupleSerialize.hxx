@@ -65,6 +65,9 @@ public:
    static constexpr std::uint32_t kFlagSortDesColumn     = 0x02;
    static constexpr std::uint32_t kFlagNonNegativeColumn = 0x04;
    static constexpr std::uint32_t kFlagDeferredColumn    = 0x08;
+   static constexpr std::uint32_t kFlagHasValueRange     = 0x10;
+
+   static constexpr std::uint32_t kFlagColumnRangeHasMinMax = 0x01;
 
    static constexpr DescriptorId_t kZeroFieldId = std::uint64_t(-2);
 
@@ -16,10 +16,13 @@
 #ifndef ROOT7_RNTupleView
 #define ROOT7_RNTupleView
 
+#include <ROOT/RError.hxx>
 #include <ROOT/RField.hxx>
 #include <ROOT/RNTupleUtil.hxx>
+#include <ROOT/RSpan.hxx>
 #include <ROOT/RStringView.hxx>
 
+#include <algorithm>
 #include <iterator>
 #include <memory>
 #include <type_traits>
@@ -209,6 +212,24 @@ public:
    {
       return fField.MapV(clusterIndex, nItems);
    }
+
+   /// Copies the values of the elements [globalIndex, globalIndex + values.size()) into the given buffer. Unlike
+   /// MapV(), the range may span several pages. Throws an exception if the range exceeds the field range.
+   // TODO(bgruber): turn enable_if into requires clause with C++20
+   template <typename C = T, std::enable_if_t<Internal::isMappable<FieldT>, C *> = nullptr>
+   void ReadV(NTupleSize_t globalIndex, std::span<C> values)
+   {
+      if (globalIndex + values.size() > fField.GetNElements())
+         throw RException(R__FAIL("bulk read beyond the field range"));
+      std::size_t nRead = 0;
+      while (nRead < values.size()) {
+         NTupleSize_t nItems;
+         const C *buf = fField.MapV(globalIndex + nRead, nItems);
+         const auto nCopy = std::min<std::size_t>(nItems, values.size() - nRead);
+         std::copy(buf, buf + nCopy, values.begin() + nRead);
+         nRead += nCopy;
+      }
+   }
 };
 
 
@@ -21,6 +21,7 @@
 #include <ROOT/RNTupleUtil.hxx>
 
 #include <cstddef>
+#include <cstdint>
 #include <mutex>
 #include <vector>
 
@@ -40,6 +41,11 @@ pages is thread-safe. The page pool does not allocate the memory -- allocation a
 page storage, which might do it in a way optimized to the backing store (e.g., mmap()).
 Multiple page caches can coexist.
 
+All page pools of the process share a memory budget, which is unlimited by default. If the unzipped pages of all
+the page pools exceed the budget, pages that are not in use (i.e., preloaded pages with a reference counter of zero)
+are evicted in least-recently-used order across all the pools. Pages that are in use are never evicted, so the budget
+can be exceeded temporarily. An evicted page is unzipped again from its cluster when it is requested.
+
 TODO(jblomer): it should be possible to register pages and to find them by column and index; this would
 facilitate pre-filling a cache, e.g. by read-ahead.
 */
@@ -54,13 +60,35 @@ private:
    std::vector<RPage> fPages;
    std::vector<std::int32_t> fReferences;
    std::vector<RPageDeleter> fDeleters;
-   std::mutex fLock;
+   /// The value of a process-wide counter at the last registration or lookup of the page, for LRU eviction
+   std::vector<std::uint64_t> fLastUse;
+   /// The memory allocated by the pages of this pool
+   std::size_t fMemoryUsage = 0;
+   mutable std::mutex fLock;
+
+   /// Removes the page at position i; the caller must hold fLock
+   void ErasePage(unsigned int i);
+   /// Deletes the unused pages whose last use is not after the given tick; returns the number of freed bytes
+   std::size_t EvictUnusedPages(std::uint64_t lastUse);
+   /// Evicts unused pages from all the page pools if the memory budget is exceeded. Must not be called while
+   /// holding fLock.
+   static void EnforceMemoryBudget();
 
 public:
-   RPagePool() = default;
+   RPagePool();
    RPagePool(const RPagePool&) = delete;
    RPagePool& operator =(const RPagePool&) = delete;
-   ~RPagePool() = default;
+   /// Deletes the pages that are not in use
+   ~RPagePool();
+
+   /// Sets the process-wide memory budget for the unzipped pages of all page pools, in bytes. Zero means unlimited.
+   /// Lowering the budget immediately evicts unused pages.
+   static void SetMemoryBudget(std::size_t nbytes);
+   static std::size_t GetMemoryBudget();
+   /// The memory allocated by the pages of all the page pools of the process
+   static std::size_t GetGlobalMemoryUsage();
+   /// The memory allocated by the pages of this page pool
+   std::size_t GetMemoryUsage() const;
 
    /// Adds a new page to the pool together with the function to free its space. Upon registration,
    /// the page pool takes ownership of the page's memory. The new page has its reference counter set to 1.
@@ -21,6 +21,8 @@
 #include <ROOT/RNTupleMetrics.hxx>
 #include <ROOT/RPageStorage.hxx>
 
+#include <atomic>
+#include <cstddef>
 #include <deque>
 #include <iterator>
 #include <memory>
@@ -36,6 +38,11 @@ namespace Detail {
 \ingroup NTuple
 \brief Wrapper sink that coalesces cluster column page writes
 *
+* If a task scheduler is set (implicit multi-threading), pages are sealed in parallel tasks as soon as they are
+* committed by the columns, such that compression overlaps with filling. A sealed page takes the place of the
+* uncompressed page in the buffer. The number of pages waiting for compression is bounded by
+* RNTupleWriteOptions::GetMaxUnsealedPages().
+*
 * TODO(jblomer): The interplay of derived class and RPageSink is not yet optimally designed for page storage wrapper
 * classes like this one. Header and footer serialization, e.g., are done twice.  To be revised.
 */
@@ -120,6 +127,7 @@ private:
    /// I/O performance counters that get registered in fMetrics
    struct RCounters {
       RNTuplePlainCounter &fParallelZip;
+      RNTuplePlainCounter &fNZipQueueFull;
    };
    std::unique_ptr<RCounters> fCounters;
    RNTupleMetrics fMetrics;
@@ -130,6 +138,8 @@ private:
    std::unique_ptr<RNTupleModel> fInnerModel;
    /// Vector of buffered column pages. Indexed by column id.
    std::vector<RColumnBuf> fBufferedColumns;
+   /// The number of buffered pages whose compression task has not yet finished
+   std::atomic<std::size_t> fNUnsealedPages{0};
 
 protected:
    void CreateImpl(const RNTupleModel &model, unsigned char *serializedHeader, std::uint32_t length) final;
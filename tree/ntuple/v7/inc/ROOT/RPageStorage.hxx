@@ -31,6 +31,7 @@
 #include <deque>
 #include <functional>
 #include <memory>
+#include <mutex>
 #include <shared_mutex>
 #include <unordered_set>
 #include <vector>
@@ -88,6 +89,8 @@ public:
       const void *fBuffer = nullptr;
       std::uint32_t fSize = 0;
       std::uint32_t fNElements = 0;
+      /// Value range of the page's elements; only set by sinks that collect column statistics
+      RClusterDescriptor::RColumnStatistics fStatistics;
 
       RSealedPage() = default;
       RSealedPage(const void *b, std::uint32_t s, std::uint32_t n) : fBuffer(b), fSize(s), fNElements(n) {}
@@ -175,6 +178,28 @@ up to the given entry number are committed.
 */
 // clang-format on
 class RPageSink : public RPageStorage {
+public:
+   /// An RAII wrapper used to synchronize a page sink that is shared among several writers. See GetSinkGuard().
+   class RSinkGuard {
+      std::mutex *fLock;
+
+   public:
+      explicit RSinkGuard(std::mutex *lock) : fLock(lock)
+      {
+         if (fLock)
+            fLock->lock();
+      }
+      RSinkGuard(const RSinkGuard &) = delete;
+      RSinkGuard &operator=(const RSinkGuard &) = delete;
+      RSinkGuard(RSinkGuard &&) = delete;
+      RSinkGuard &operator=(RSinkGuard &&) = delete;
+      ~RSinkGuard()
+      {
+         if (fLock)
+            fLock->unlock();
+      }
+   };
+
 private:
    /// Used to map the IDs of the descriptor to the physical IDs issued during header/footer serialization
    Internal::RNTupleSerializer::RContext fSerializationContext;
@@ -209,6 +234,10 @@ protected:
    /// Keeps track of the written pages in the currently open cluster. Indexed by column id.
    std::vector<RClusterDescriptor::RPageRange> fOpenPageRanges;
    RNTupleDescriptorBuilder fDescriptorBuilder;
+   /// Whether CommitPage() computes the value range of the committed pages. Initialized from the write options;
+   /// sinks that forward pages to an inner sink turn it off and leave the work to the inner sink or to the page
+   /// sealing. Statistics of sealed pages are always taken over.
+   bool fCollectColumnStatistics = false;
 
    virtual void CreateImpl(const RNTupleModel &model, unsigned char *serializedHeader, std::uint32_t length) = 0;
    virtual RNTupleLocator CommitPageImpl(ColumnHandle_t columnHandle, const RPage &page) = 0;
@@ -239,6 +268,10 @@ protected:
    static RSealedPage SealPage(const RPage &page, const RColumnElementBase &element,
       int compressionSetting, void *buf);
 
+   /// Computes the value range of the elements of an unsealed page. The returned statistics are invalid if the
+   /// element type does not support value statistics.
+   static RClusterDescriptor::RColumnStatistics ComputeStatistics(const RPage &page, const RColumnElementBase &element);
+
    /// Enables the default set of metrics provided by RPageSink. `prefix` will be used as the prefix for
    /// the counters registered in the internal RNTupleMetrics object.
    /// This set of counters can be extended by a subclass by calling `fMetrics.MakeCounter<...>()`.
@@ -265,6 +298,8 @@ public:
    EPageStorageType GetType() final { return EPageStorageType::kSink; }
    /// Returns the sink's write options.
    const RNTupleWriteOptions &GetWriteOptions() const { return *fOptions; }
+   /// Returns the descriptor of the so far committed schema and clusters
+   const RNTupleDescriptor &GetDescriptor() const { return fDescriptorBuilder.GetDescriptor(); }
 
    ColumnHandle_t AddColumn(DescriptorId_t fieldId, const RColumn &column) final;
    void DropColumn(ColumnHandle_t /*columnHandle*/) final {}
@@ -293,6 +328,14 @@ public:
    /// Finalize the current cluster and the entrire data set.
    void CommitDataset();
 
+   /// The number of entries in the so far committed clusters
+   NTupleSize_t GetNEntries() const { return fPrevClusterNEntries; }
+
+   /// Returns a guard that must be held by wrapper sinks (such as RPageSinkBuf) while committing the pages and the
+   /// cluster, such that the operation appears atomic with respect to other writers of the same underlying sink.
+   /// By default, the sink is not shared and the guard is a no-op.
+   virtual RSinkGuard GetSinkGuard() { return RSinkGuard(nullptr); }
+
    /// Get a new, empty page for the given column that can be filled with up to nElements.  If nElements is zero,
    /// the page sink picks an appropriate size.
    virtual RPage ReservePage(ColumnHandle_t columnHandle, std::size_t nElements) = 0;
@@ -356,9 +399,26 @@ public:
       void MoveIn(RNTupleDescriptor &&desc) { fDescriptor = std::move(desc); }
    };
 
+   /// A contiguous range of entries that the user of the page source promises to stay within, see SetEntryRange()
+   struct REntryRange {
+      NTupleSize_t fFirstEntry = kInvalidNTupleIndex;
+      NTupleSize_t fNEntries = 0;
+
+      /// Returns true if the given cluster has entries within the entry range. An unset range
+      /// (fFirstEntry == kInvalidNTupleIndex) intersects with every cluster.
+      bool IntersectsWith(const RClusterDescriptor &clusterDesc) const;
+   };
+
 private:
    RNTupleDescriptor fDescriptor;
    mutable std::shared_mutex fDescriptorLock;
+   /// The entry range that the page source is restricted to; by default, the full ntuple
+   REntryRange fEntryRange;
+   /// Serializes the on-demand loading of cluster groups, see RNTupleReadOptions::SetLoadClusterGroupsOnDemand()
+   std::mutex fClusterGroupLoadMutex;
+
+   /// Loads the page list of the given cluster group unless it is already in the descriptor
+   void EnsureClusterGroupDetails(DescriptorId_t clusterGroupId);
 
 protected:
    /// Default I/O performance counters that get registered in fMetrics
@@ -409,6 +469,13 @@ protected:
    std::unique_ptr<RNTupleDecompressor> fDecompressor;
 
    virtual RNTupleDescriptor AttachImpl() = 0;
+   /// Reads and deserializes the page list of the given cluster group and returns the cluster descriptors with page
+   /// locations. Only called for page sources that do not load all the page lists in AttachImpl(). Must not be called
+   /// while holding a descriptor guard.
+   virtual std::vector<RClusterDescriptor> LoadClusterGroupImpl(DescriptorId_t clusterGroupId);
+   /// Makes sure that the page locations of the cluster containing the given element of the column are in the
+   /// descriptor, if cluster groups are loaded on demand. The cluster group is found by bisection.
+   void EnsureClusterDetailsOfElement(DescriptorId_t physicalColumnId, NTupleSize_t index);
    // Only called if a task scheduler is set. No-op be default.
    virtual void UnzipClusterImpl(RCluster * /* cluster */)
       { }
@@ -468,6 +535,19 @@ public:
    NTupleSize_t GetNElements(ColumnHandle_t columnHandle);
    ColumnId_t GetColumnId(ColumnHandle_t columnHandle);
 
+   /// Promise to only read from the given entry range. If set, prevents the cluster pool from reading-ahead beyond
+   /// the given range. The range needs to be within [0, GetNEntries()). Used, e.g., by RNTupleDS in order to
+   /// let every cluster be read and unzipped by only one of the page source clones.
+   void SetEntryRange(const REntryRange &range);
+   REntryRange GetEntryRange() const { return fEntryRange; }
+
+   /// If cluster groups are loaded on demand, makes sure that the page locations of the given cluster are in the
+   /// descriptor. Must not be called while holding a descriptor guard.
+   void EnsureClusterDetails(DescriptorId_t clusterId);
+   /// Loads the page lists of all the cluster groups that are not yet loaded, e.g. before iterating over the column
+   /// ranges of all the clusters. No-op unless cluster groups are loaded on demand.
+   void EnsureAllClusterDetails();
+
    /// Allocates and fills a page that contains the index-th element
    virtual RPage PopulatePage(ColumnHandle_t columnHandle, NTupleSize_t globalIndex) = 0;
    /// Another version of PopulatePage that allows to specify cluster-relative indexes
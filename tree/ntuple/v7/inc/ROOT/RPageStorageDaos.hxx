@@ -28,6 +28,7 @@
 #include <memory>
 #include <string>
 #include <optional>
+#include <vector>
 
 namespace ROOT {
 namespace Experimental {
@@ -56,13 +57,14 @@ using ntuple_index_t = std::uint32_t;
 \ingroup NTuple
 \brief Entry point for an RNTuple in a DAOS container. It encodes essential
 information to read the ntuple; currently, it contains (un)compressed size of
-the header/footer blobs and the object class for user data OIDs.
+the header/footer blobs, the object class for user data OIDs, and the number of containers across which the pages
+are striped.
 The length of a serialized anchor cannot be greater than the value returned by the `GetSize` function.
 */
 // clang-format on
 struct RDaosNTupleAnchor {
-   /// Allows for evolving the struct in future versions
-   std::uint32_t fVersion = 0;
+   /// Allows for evolving the struct in future versions; version 1 adds `fNStripes`
+   std::uint32_t fVersion = 1;
    /// The size of the compressed ntuple header
    std::uint32_t fNBytesHeader = 0;
    /// The size of the uncompressed ntuple header
@@ -73,6 +75,8 @@ struct RDaosNTupleAnchor {
    std::uint32_t fLenFooter = 0;
    /// The object class for user data OIDs, e.g. `SX`
    std::string fObjClass{};
+   /// The number of containers holding the pages, see `RNTupleWriteOptionsDaos::SetNStripes()`
+   std::uint32_t fNStripes = 1;
 
    bool operator ==(const RDaosNTupleAnchor &other) const {
       return fVersion == other.fVersion &&
@@ -80,7 +84,8 @@ struct RDaosNTupleAnchor {
          fLenHeader == other.fLenHeader &&
          fNBytesFooter == other.fNBytesFooter &&
          fLenFooter == other.fLenFooter &&
-         fObjClass == other.fObjClass;
+         fObjClass == other.fObjClass &&
+         fNStripes == other.fNStripes;
    }
 
    std::uint32_t Serialize(void *buffer) const;
@@ -138,6 +143,7 @@ struct RDaosContainerNTupleLocator {
 
 Currently, an object is allocated for ntuple metadata (anchor/header/footer).
 Objects can correspond to pages or clusters of pages depending on the RNTuple-DAOS mapping strategy.
+Optionally, the pages are striped across several containers of the same pool, see `RNTupleWriteOptionsDaos::SetNStripes()`.
 */
 // clang-format on
 class RPageSinkDaos : public RPageSink {
@@ -149,6 +155,8 @@ private:
    /// (which calls `daos_cont_close()`; the destructor for the `std::shared_ptr<RDaosPool>` is invoked
    /// after (which calls `daos_pool_disconect()`).
    std::unique_ptr<RDaosContainer> fDaosContainer;
+   /// The containers of stripes 1 to n-1, if pages are striped; stripe 0 is `fDaosContainer`
+   std::vector<std::unique_ptr<RDaosContainer>> fStripeContainers;
    /// Page identifier for the next committed page; it is automatically incremented in `CommitSealedPageImpl()`
    std::atomic<std::uint64_t> fPageId{0};
    /// Cluster group counter for the next committed cluster pagelist; incremented in `CommitClusterGroupImpl()`
@@ -174,6 +182,7 @@ protected:
    void WriteNTupleHeader(const void *data, size_t nbytes, size_t lenHeader);
    void WriteNTupleFooter(const void *data, size_t nbytes, size_t lenFooter);
    void WriteNTupleAnchor();
+   RDaosContainer &GetStripeContainer(std::size_t stripe);
 
 public:
    RPageSinkDaos(std::string_view ntupleName, std::string_view uri, const RNTupleWriteOptions &options);
@@ -210,6 +219,8 @@ private:
    RCluster *fCurrentCluster = nullptr;
    /// A container that stores object data (header/footer, pages, etc.)
    std::unique_ptr<RDaosContainer> fDaosContainer;
+   /// The containers of stripes 1 to n-1, if pages are striped; stripe 0 is `fDaosContainer`
+   std::vector<std::unique_ptr<RDaosContainer>> fStripeContainers;
    /// A URI to a DAOS pool of the form 'daos://pool-label/container-label'
    std::string fURI;
    /// The cluster pool asynchronously preloads the next few clusters
@@ -219,6 +230,7 @@ private:
 
    RPage PopulatePageFromCluster(ColumnHandle_t columnHandle, const RClusterInfo &clusterInfo,
                                  ClusterSize_t::ValueType idxInCluster);
+   RDaosContainer &GetStripeContainer(std::size_t stripe);
 
 protected:
    RNTupleDescriptor AttachImpl() final;
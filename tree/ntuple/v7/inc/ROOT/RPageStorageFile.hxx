@@ -39,6 +39,7 @@ class RRawFile;
 
 namespace Experimental {
 class RNTuple; // for making RPageSourceFile a friend of RNTuple
+class RIOFileMetrics;
 
 namespace Detail {
 
@@ -113,21 +114,30 @@ private:
       std::uint64_t fColumnOffset = 0;
    };
 
+   /// An RRawFile is used to request the necessary byte ranges from a local or a remote file.
+   /// Declared before the page pool because memory mapped pages are unmapped through the raw file.
+   std::unique_ptr<ROOT::Internal::RRawFile> fFile;
    /// Populated pages might be shared; the page pool might, at some point, be used by multiple page sources
    std::shared_ptr<RPagePool> fPagePool;
    /// The last cluster from which a page got populated.  Points into fClusterPool->fPool
    RCluster *fCurrentCluster = nullptr;
-   /// An RRawFile is used to request the necessary byte ranges from a local or a remote file
-   std::unique_ptr<ROOT::Internal::RRawFile> fFile;
    /// Takes the fFile to read ntuple blobs from it
    Internal::RMiniFileReader fReader;
    /// The descriptor is created from the header and footer either in AttachImpl or in CreateFromAnchor
    RNTupleDescriptorBuilder fDescriptorBuilder;
    /// The cluster pool asynchronously preloads the next few clusters
    std::unique_ptr<RClusterPool> fClusterPool;
+   /// Set on attaching if the read options request mmap'ed pages and the raw file supports memory mapping
+   bool fUseMmap = false;
+   /// Records the page decompression if RIOMetrics was enabled when the page source was created. The reads are
+   /// recorded by fFile.
+   RIOFileMetrics *fIOMetrics = nullptr;
 
    /// Deserialized header and footer into a minimal descriptor held by fDescriptorBuilder
    void InitDescriptor(const Internal::RFileNTupleAnchor &anchor);
+   /// Reads and deserializes the page list of the given cluster group of `desc`
+   std::vector<RClusterDescriptor> ReadPageList(const RNTupleDescriptor &desc, DescriptorId_t clusterGroupId,
+                                                RNTupleDecompressor &decompressor);
 
    RPageSourceFile(std::string_view ntupleName, const RNTupleReadOptions &options);
    /// Used from the RNTuple class to build a datasource if the anchor is already available
@@ -135,6 +145,11 @@ private:
                                                             std::string_view path, const RNTupleReadOptions &options);
    RPage PopulatePageFromCluster(ColumnHandle_t columnHandle, const RClusterInfo &clusterInfo,
                                  ClusterSize_t::ValueType idxInCluster);
+   /// Returns true if the page can be served directly from a memory mapped region of the file, i.e. if mmap is in use,
+   /// the page is stored uncompressed, suitably aligned, and its on-disk representation is the in-memory one
+   bool CanMapPage(const RClusterDescriptor::RPageRange::RPageInfo &pageInfo, const RColumnElementBase &element) const;
+   /// Maps the page from the file and registers it with the page pool; the page deleter unmaps the region
+   RPage MapPage(ColumnHandle_t columnHandle, const RClusterInfo &clusterInfo);
 
    /// Helper function for LoadClusters: it prepares the memory buffer (page map) and the
    /// read requests for a given cluster and columns.  The reead requests are appended to
@@ -146,6 +161,7 @@ private:
 
 protected:
    RNTupleDescriptor AttachImpl() final;
+   std::vector<RClusterDescriptor> LoadClusterGroupImpl(DescriptorId_t clusterGroupId) final;
    void UnzipClusterImpl(RCluster *cluster) final;
 
 public:
@@ -0,0 +1,172 @@
+/// \file ROOT/RPageStorageShards.hxx
+/// \ingroup NTuple ROOT7
+/// \date 2026-10-15
+/// \warning This is part of the ROOT 7 prototype! It will change without notice. It might trigger earthquakes. Feedback
+/// is welcome!
+
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT7_RPageStorageShards
+#define ROOT7_RPageStorageShards
+
+#include <ROOT/RNTupleMetrics.hxx>
+#include <ROOT/RPageStorage.hxx>
+#include <ROOT/RSpan.hxx>
+#include <ROOT/RStringView.hxx>
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace ROOT {
+namespace Experimental {
+
+class RNTupleModel;
+
+namespace Detail {
+
+// clang-format off
+/**
+\class ROOT::Experimental::Detail::RPageSinkShards
+\ingroup NTuple
+\brief Storage provider that distributes the clusters of an ntuple over several files
+
+Used by RPageSink::Create() if the write options ask for a maximum shard size or for more than one shard. The clusters
+are written round-robin to GetNShards() shard files. A shard file that grows beyond GetMaxShardSize() is finalized and
+replaced by a new one. Every shard file holds a complete, self-contained ntuple with the name of the sharded ntuple.
+The shard files are named after the given storage path with the shard number appended to the file stem,
+e.g. `data.root` is sharded into `data_0.root`, `data_1.root`, etc.
+
+On CommitDataset(), a small index ntuple named GetIndexName() is written to the given storage path. It lists the
+shard file names, relative to the index, and their number of entries. The index is used by RNTupleReader::OpenShards()
+to read back the shards as one logical ntuple. Note that with more than one shard, the entries are read back shard
+after shard and not in the order in which they were filled. Model extensions after the initial Create() are not
+supported.
+*/
+// clang-format on
+class RPageSinkShards : public RPageSink {
+private:
+   /// A shard that is currently open for writing. The shard files are opened on demand.
+   struct RShard {
+      std::unique_ptr<RNTupleModel> fModel;
+      std::unique_ptr<RPageSink> fSink;
+      /// Index of the shard file in fShardFileNames
+      std::size_t fFileIdx = 0;
+      /// Number of bytes written to the shard file so far
+      std::uint64_t fNBytes = 0;
+      /// Whether there are clusters that are not yet part of a cluster group
+      bool fHasPendingClusters = false;
+   };
+
+   /// The path of the index file; the shard file names are derived from it
+   std::string fStorage;
+   /// Write options of the shard sinks
+   std::unique_ptr<RNTupleWriteOptions> fShardOptions;
+   /// Copy of the model given to Create(), from which the models of new shards are cloned
+   std::unique_ptr<RNTupleModel> fModel;
+   std::vector<RShard> fShards;
+   /// The shard that receives the pages of the currently open cluster
+   std::size_t fCurrentShard = 0;
+   std::vector<std::string> fShardFileNames;
+   /// Indexed like fShardFileNames; set when the shard file is finalized
+   std::vector<NTupleSize_t> fShardNEntries;
+
+   /// Returns the sink of the current shard, opening a new shard file if necessary
+   RPageSink &GetCurrentSink();
+   /// Finalizes the shard file, if any, such that the next cluster committed to the shard opens a new file
+   void CloseShard(RShard &shard);
+
+protected:
+   void CreateImpl(const RNTupleModel &model, unsigned char *serializedHeader, std::uint32_t length) final;
+   RNTupleLocator CommitPageImpl(ColumnHandle_t columnHandle, const RPage &page) final;
+   RNTupleLocator CommitSealedPageImpl(DescriptorId_t physicalColumnId, const RSealedPage &sealedPage) final;
+   std::vector<RNTupleLocator> CommitSealedPageVImpl(std::span<RSealedPageGroup> ranges) final;
+   std::uint64_t CommitClusterImpl(NTupleSize_t nEntries) final;
+   RNTupleLocator CommitClusterGroupImpl(unsigned char *serializedPageList, std::uint32_t length) final;
+   void CommitDatasetImpl(unsigned char *serializedFooter, std::uint32_t length) final;
+
+public:
+   RPageSinkShards(std::string_view ntupleName, std::string_view storage, const RNTupleWriteOptions &options);
+   RPageSinkShards(const RPageSinkShards &) = delete;
+   RPageSinkShards &operator=(const RPageSinkShards &) = delete;
+   RPageSinkShards(RPageSinkShards &&) = default;
+   RPageSinkShards &operator=(RPageSinkShards &&) = default;
+   ~RPageSinkShards() override;
+
+   /// The name of the index ntuple of the sharded ntuple `ntupleName`
+   static std::string GetIndexName(std::string_view ntupleName);
+   /// The path of the shard file number `idx` for the index at `storage`
+   static std::string GetShardFileName(std::string_view storage, std::size_t idx);
+
+   /// Throws if called after the initial Create(): sharded ntuples cannot be extended.
+   void UpdateSchema(const RNTupleModelChangeset &changeset, NTupleSize_t firstEntry) final;
+
+   RPage ReservePage(ColumnHandle_t columnHandle, std::size_t nElements) final;
+   void ReleasePage(RPage &page) final;
+};
+
+// clang-format off
+/**
+\class ROOT::Experimental::Detail::RPageSourceShards
+\ingroup NTuple
+\brief Virtual storage that combines several other sources vertically
+
+The shards must have the same schema. The entries of the first shard come first, followed by the entries of the second
+shard, etc. Cluster IDs, entry numbers, and element numbers are translated between the combined ntuple and the shards.
+Physical column IDs and field IDs are the same in the combined ntuple and in the shards. Every shard source prefetches
+and unzips its own clusters, so that the shards are read in parallel by clones of the combined source.
+*/
+// clang-format on
+class RPageSourceShards final : public RPageSource {
+private:
+   RNTupleMetrics fMetrics;
+   std::vector<std::unique_ptr<RPageSource>> fSources;
+   /// Indexed by physical column ID, then by shard: the number of elements of the column in the previous shards.
+   /// The last element of every vector is the total number of elements of the column.
+   std::vector<std::vector<NTupleSize_t>> fElementOffsets;
+   /// Indexed by the cluster ID of the combined ntuple: the shard index and the cluster ID in the shard
+   std::vector<std::pair<std::size_t, DescriptorId_t>> fVirtual2Origin;
+   /// Indexed by shard: maps the cluster IDs of the shard to the cluster IDs of the combined ntuple
+   std::vector<std::unordered_map<DescriptorId_t, DescriptorId_t>> fOrigin2Virtual;
+
+   /// Translates the element range and the cluster of a page populated by the given shard to the combined ntuple
+   void ShiftPage(std::size_t sourceIdx, RPage &page) const;
+
+protected:
+   RNTupleDescriptor AttachImpl() final;
+
+public:
+   RPageSourceShards(std::string_view ntupleName, std::span<std::unique_ptr<RPageSource>> sources);
+
+   std::unique_ptr<RPageSource> Clone() const final;
+   ~RPageSourceShards() final;
+
+   ColumnHandle_t AddColumn(DescriptorId_t fieldId, const RColumn &column) final;
+   void DropColumn(ColumnHandle_t columnHandle) final;
+
+   RPage PopulatePage(ColumnHandle_t columnHandle, NTupleSize_t globalIndex) final;
+   RPage PopulatePage(ColumnHandle_t columnHandle, const RClusterIndex &clusterIndex) final;
+   void ReleasePage(RPage &page) final;
+
+   void
+   LoadSealedPage(DescriptorId_t physicalColumnId, const RClusterIndex &clusterIndex, RSealedPage &sealedPage) final;
+
+   std::vector<std::unique_ptr<RCluster>> LoadClusters(std::span<RCluster::RKey> clusterKeys) final;
+
+   RNTupleMetrics &GetMetrics() final { return fMetrics; }
+};
+
+} // namespace Detail
+} // namespace Experimental
+} // namespace ROOT
+
+#endif
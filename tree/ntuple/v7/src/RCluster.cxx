@@ -42,6 +42,14 @@ ROOT::Experimental::Detail::RCluster::GetOnDiskPage(const ROnDiskPage::Key &key)
    return nullptr;
 }
 
+std::size_t ROOT::Experimental::Detail::RCluster::GetOnDiskSize() const
+{
+   std::size_t size = 0;
+   for (const auto &kv : fOnDiskPages)
+      size += kv.second.GetSize();
+   return size;
+}
+
 void ROOT::Experimental::Detail::RCluster::Adopt(std::unique_ptr<ROnDiskPageMap> pageMap)
 {
    auto &pages = pageMap->fOnDiskPages;
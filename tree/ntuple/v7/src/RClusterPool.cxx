@@ -48,12 +48,37 @@ bool ROOT::Experimental::Detail::RClusterPool::RInFlightCluster::operator <(cons
    return fClusterKey.fClusterId < other.fClusterKey.fClusterId;
 }
 
+namespace {
+
+/// Exponentially weighted moving average that gives the new sample a weight of 1/4
+std::int64_t UpdateMovingAverage(std::int64_t average, std::int64_t sample)
+{
+   if (average == 0)
+      return sample;
+   return (3 * average + sample) / 4;
+}
+
+} // anonymous namespace
+
 ROOT::Experimental::Detail::RClusterPool::RClusterPool(RPageSource &pageSource, unsigned int clusterBunchSize)
-   : fPageSource(pageSource)
-   , fClusterBunchSize(clusterBunchSize)
-   , fPool(2 * clusterBunchSize)
-   , fThreadIo(&RClusterPool::ExecReadClusters, this)
-   , fThreadUnzip(&RClusterPool::ExecUnzipClusters, this)
+   : fPageSource(pageSource),
+     fClusterBunchSize(clusterBunchSize),
+     fIsAdaptive(pageSource.GetReadOptions().GetUseAdaptiveClusterBunchSize()),
+     fMaxClusterBunchSize(fIsAdaptive
+                             ? std::max(clusterBunchSize, pageSource.GetReadOptions().GetMaxClusterBunchSize())
+                             : clusterBunchSize),
+     fMemoryBudget(pageSource.GetReadOptions().GetClusterPoolMemoryBudget()),
+     fPool(2 * fMaxClusterBunchSize),
+     fMetrics("RClusterPool"),
+     fCounters(std::unique_ptr<RCounters>(new RCounters{
+        *fMetrics.MakeCounter<RNTupleAtomicCounter *>("nClusterBunchSize", "", "current cluster bunch size"),
+        *fMetrics.MakeCounter<RNTupleAtomicCounter *>("timeWallLoadBunch", "ns",
+                                                      "average wall clock time for loading a bunch of clusters"),
+        *fMetrics.MakeCounter<RNTupleAtomicCounter *>("timeWallConsumeCluster", "ns",
+                                                      "average wall clock time spent by the consumer on a cluster"),
+        *fMetrics.MakeCounter<RNTupleAtomicCounter *>("szCluster", "B", "average on-disk size of a loaded cluster")})),
+     fThreadIo(&RClusterPool::ExecReadClusters, this),
+     fThreadUnzip(&RClusterPool::ExecUnzipClusters, this)
 {
    R__ASSERT(clusterBunchSize > 0);
 }
@@ -131,7 +156,17 @@ void ROOT::Experimental::Detail::RClusterPool::ExecReadClusters()
             clusterKeys.emplace_back(item.fClusterKey);
          }
 
+         const auto tsLoadStart = std::chrono::steady_clock::now();
          auto clusters = fPageSource.LoadClusters(clusterKeys);
+         const auto loadTime =
+            std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - tsLoadStart);
+         fLoadTimePerBunch.store(UpdateMovingAverage(fLoadTimePerBunch.load(), loadTime.count()));
+         fCounters->fTimeWallLoadBunch.SetValue(fLoadTimePerBunch.load());
+         for (const auto &c : clusters) {
+            fSizePerCluster.store(UpdateMovingAverage(fSizePerCluster.load(), c->GetOnDiskSize()));
+         }
+         fCounters->fSzCluster.SetValue(fSizePerCluster.load());
+
          bool unzipQueueDirty = false;
          for (std::size_t i = 0; i < clusters.size(); ++i) {
             // Meanwhile, the user might have requested clusters outside the look-ahead window, so that we don't
@@ -238,10 +273,55 @@ public:
 
 } // anonymous namespace
 
+unsigned int ROOT::Experimental::Detail::RClusterPool::ComputeAdaptiveBunchSize(
+   unsigned int currentBunchSize, unsigned int maxBunchSize, std::int64_t loadTimePerBunch,
+   std::int64_t consumeTimePerCluster, std::uint64_t sizePerCluster, std::uint64_t memoryBudget)
+{
+   R__ASSERT(currentBunchSize > 0);
+   R__ASSERT(maxBunchSize > 0);
+
+   // The pool holds up to two bunches: the one currently being consumed and the one being loaded
+   std::uint64_t limit = maxBunchSize;
+   if (sizePerCluster > 0)
+      limit = std::min(limit, std::max<std::uint64_t>(1, memoryBudget / (2 * sizePerCluster)));
+
+   std::uint64_t target = currentBunchSize;
+   if ((loadTimePerBunch > 0) && (consumeTimePerCluster > 0)) {
+      // Loading the next bunch should not take longer than consuming the current one
+      target = (loadTimePerBunch + consumeTimePerCluster - 1) / consumeTimePerCluster;
+      target = std::max<std::uint64_t>(target, 1);
+      // Dampen the adjustment to at most a factor of two per step
+      target = std::min<std::uint64_t>(target, 2 * std::uint64_t(currentBunchSize));
+      target = std::max<std::uint64_t>(target, std::max(1u, currentBunchSize / 2));
+   }
+
+   return static_cast<unsigned int>(std::clamp<std::uint64_t>(target, 1, limit));
+}
+
+void ROOT::Experimental::Detail::RClusterPool::UpdateClusterBunchSize()
+{
+   const auto now = std::chrono::steady_clock::now();
+   if (fLastClusterId != kInvalidDescriptorId) {
+      const auto consumeTime = std::chrono::duration_cast<std::chrono::nanoseconds>(now - fLastClusterTime);
+      fConsumeTimePerCluster =
+         UpdateMovingAverage(fConsumeTimePerCluster, std::max<std::int64_t>(1, consumeTime.count()));
+      fCounters->fTimeWallConsumeCluster.SetValue(fConsumeTimePerCluster);
+   }
+   if (fIsAdaptive) {
+      fClusterBunchSize = ComputeAdaptiveBunchSize(fClusterBunchSize, fMaxClusterBunchSize, fLoadTimePerBunch.load(),
+                                                   fConsumeTimePerCluster, fSizePerCluster.load(), fMemoryBudget);
+   }
+   fCounters->fClusterBunchSize.SetValue(fClusterBunchSize);
+}
+
 ROOT::Experimental::Detail::RCluster *
 ROOT::Experimental::Detail::RClusterPool::GetCluster(DescriptorId_t clusterId,
                                                      const RCluster::ColumnSet_t &physicalColumns)
 {
+   const bool isNewCluster = (clusterId != fLastClusterId);
+   if (isNewCluster)
+      UpdateClusterBunchSize();
+
    std::set<DescriptorId_t> keep;
    RProvides provide;
    {
@@ -267,6 +347,11 @@ ROOT::Experimental::Detail::RClusterPool::GetCluster(DescriptorId_t clusterId,
 
          auto cid = next;
          next = descriptorGuard->FindNextClusterId(cid);
+         // Don't read ahead beyond the entry range that the page source promised to stay within
+         if (next != kInvalidDescriptorId &&
+             !fPageSource.GetEntryRange().IntersectsWith(descriptorGuard->GetClusterDescriptor(next))) {
+            next = kInvalidDescriptorId;
+         }
          if (next == kInvalidDescriptorId)
             provideInfo.fFlags |= RProvides::kFlagLast;
 
@@ -374,7 +459,13 @@ ROOT::Experimental::Detail::RClusterPool::GetCluster(DescriptorId_t clusterId,
       }
    } // work queue lock guard
 
-   return WaitFor(clusterId, physicalColumns);
+   auto result = WaitFor(clusterId, physicalColumns);
+   if (isNewCluster) {
+      // The consumption time of the cluster is measured from the moment it becomes available
+      fLastClusterId = clusterId;
+      fLastClusterTime = std::chrono::steady_clock::now();
+   }
+   return result;
 }
 
 ROOT::Experimental::Detail::RCluster *
@@ -16,6 +16,8 @@
 #include <ROOT/RDaos.hxx>
 #include <ROOT/RError.hxx>
 
+#include <TError.h>
+
 #include <numeric>
 #include <stdexcept>
 
@@ -230,35 +232,52 @@ int ROOT::Experimental::Detail::RDaosContainer::WriteSingleAkey(const void *buff
 
 int ROOT::Experimental::Detail::RDaosContainer::VectorReadWrite(MultiObjectRWOperation_t &map, ObjClassId_t cid,
                                                                 int (RDaosObject::*fn)(RDaosObject::FetchUpdateArgs &))
+{
+   RContainerRWOperation op{this, &map, cid};
+   return VectorReadWrite(std::span<RContainerRWOperation>(&op, 1), fn);
+}
+
+int ROOT::Experimental::Detail::RDaosContainer::VectorReadWrite(std::span<RContainerRWOperation> ops,
+                                                                int (RDaosObject::*fn)(RDaosObject::FetchUpdateArgs &))
 {
    using request_t = std::tuple<std::unique_ptr<RDaosObject>, RDaosObject::FetchUpdateArgs>;
 
+   if (ops.empty())
+      return 0;
+   auto &eventQueue = ops[0].fContainer->fPool->fEventQueue;
+
    int ret;
    std::vector<request_t> requests{};
-   requests.reserve(map.size());
+   // The event of every request is referenced by the event queue; the vector must not reallocate
+   std::size_t nRequests = 0;
+   for (const auto &op : ops)
+      nRequests += op.fMap->size();
+   requests.reserve(nRequests);
 
    // Initialize parent event used for grouping and waiting for completion of all requests
    daos_event_t parent_event{};
-   if ((ret = fPool->fEventQueue->InitializeEvent(&parent_event)) < 0)
+   if ((ret = eventQueue->InitializeEvent(&parent_event)) < 0)
       return ret;
 
-   for (auto &[key, batch] : map) {
-      requests.emplace_back(
-         std::make_unique<RDaosObject>(*this, batch.fOid, cid.fCid),
-         RDaosObject::FetchUpdateArgs{batch.fDistributionKey, batch.fDataRequests, /*is_async=*/true});
+   for (auto &op : ops) {
+      R__ASSERT(op.fContainer->fPool->fEventQueue == eventQueue);
+      for (auto &[key, batch] : *op.fMap) {
+         requests.emplace_back(
+            std::make_unique<RDaosObject>(*op.fContainer, batch.fOid, op.fCid.fCid),
+            RDaosObject::FetchUpdateArgs{batch.fDistributionKey, batch.fDataRequests, /*is_async=*/true});
 
-      if ((ret = fPool->fEventQueue->InitializeEvent(std::get<1>(requests.back()).GetEventPointer(), &parent_event)) <
-          0)
-         return ret;
+         if ((ret = eventQueue->InitializeEvent(std::get<1>(requests.back()).GetEventPointer(), &parent_event)) < 0)
+            return ret;
 
-      // Launch operation
-      if ((ret = (std::get<0>(requests.back()).get()->*fn)(std::get<1>(requests.back()))) < 0)
-         return ret;
+         // Launch operation
+         if ((ret = (std::get<0>(requests.back()).get()->*fn)(std::get<1>(requests.back()))) < 0)
+            return ret;
+      }
    }
 
    // Sets parent barrier and waits for all children launched before it.
-   if ((ret = fPool->fEventQueue->WaitOnParentBarrier(&parent_event)) < 0)
+   if ((ret = eventQueue->WaitOnParentBarrier(&parent_event)) < 0)
       return ret;
 
-   return fPool->fEventQueue->FinalizeEvent(&parent_event);
+   return eventQueue->FinalizeEvent(&parent_event);
 }
@@ -46,6 +46,7 @@
 #include <cstring> // for memset
 #include <exception>
 #include <iostream>
+#include <limits>
 #include <new> // hardware_destructive_interference_size
 #include <type_traits>
 #include <unordered_map>
@@ -218,6 +219,74 @@ void SyncFieldIDs(const ROOT::Experimental::Detail::RFieldBase &from, ROOT::Expe
    }
 }
 
+/// Used by RField<float>::SetQuantized() and RField<double>::SetQuantized()
+void EnsureValidQuantization(std::uint16_t nBits, double minValue, double maxValue)
+{
+   if (nBits < 1 || nBits > ROOT::Experimental::Detail::RColumnElementBase::GetBitsOnStorage(
+                               ROOT::Experimental::EColumnType::kReal32Quant)) {
+      throw ROOT::Experimental::RException(R__FAIL("invalid number of bits for quantized field: " +
+                                                   std::to_string(nBits)));
+   }
+   if (!(minValue < maxValue))
+      throw ROOT::Experimental::RException(R__FAIL("invalid value range for quantized field"));
+}
+
+/// Creates the column model of floating point fields, including the value range in case of a quantized column.
+ROOT::Experimental::RColumnModel
+CreateRealColumnModel(ROOT::Experimental::EColumnType type, std::uint16_t nBits, double minValue, double maxValue)
+{
+   if (type != ROOT::Experimental::EColumnType::kReal32Quant)
+      return ROOT::Experimental::RColumnModel(type);
+   if (nBits == 0)
+      throw ROOT::Experimental::RException(R__FAIL("quantized column representation requires SetQuantized()"));
+   return ROOT::Experimental::RColumnModel(type, nBits, minValue, maxValue);
+}
+
+template <typename T, typename ColumnT>
+bool SetNarrowColumnRange(T &minValue, T &maxValue)
+{
+   if constexpr (sizeof(ColumnT) < sizeof(T) && std::is_signed_v<ColumnT> == std::is_signed_v<T>) {
+      minValue = std::numeric_limits<ColumnT>::min();
+      maxValue = std::numeric_limits<ColumnT>::max();
+      return true;
+   }
+   return false;
+}
+
+/// Used by the integer fields on connecting to a page sink. If the integer column type is narrower than the in-memory
+/// type T, sets the value range of the column type and returns true. In this case, the field appends the values through
+/// AppendImpl(), which rejects values that do not fit into the column, before they enter a page. Packing the pages on
+/// committing a cluster is then a plain cast.
+template <typename T>
+bool GetNarrowColumnRange(ROOT::Experimental::EColumnType type, T &minValue, T &maxValue)
+{
+   using ROOT::Experimental::EColumnType;
+   switch (type) {
+   case EColumnType::kInt8: return SetNarrowColumnRange<T, std::int8_t>(minValue, maxValue);
+   case EColumnType::kUInt8: return SetNarrowColumnRange<T, std::uint8_t>(minValue, maxValue);
+   case EColumnType::kInt16:
+   case EColumnType::kSplitInt16: return SetNarrowColumnRange<T, std::int16_t>(minValue, maxValue);
+   case EColumnType::kUInt16:
+   case EColumnType::kSplitUInt16: return SetNarrowColumnRange<T, std::uint16_t>(minValue, maxValue);
+   case EColumnType::kInt32:
+   case EColumnType::kSplitInt32: return SetNarrowColumnRange<T, std::int32_t>(minValue, maxValue);
+   case EColumnType::kUInt32:
+   case EColumnType::kSplitUInt32: return SetNarrowColumnRange<T, std::uint32_t>(minValue, maxValue);
+   default: return false;
+   }
+}
+
+/// Used by the AppendImpl() of the integer fields written to a narrower integer column
+template <typename T>
+void EnsureValueInColumnRange(T value, T minValue, T maxValue, const ROOT::Experimental::Detail::RFieldBase &field)
+{
+   if (R__unlikely(value < minValue || value > maxValue)) {
+      throw ROOT::Experimental::RException(R__FAIL("value " + std::to_string(value) + " of field `" +
+                                                   field.GetQualifiedFieldName() +
+                                                   "` out of range of the on-disk column type"));
+   }
+}
+
 } // anonymous namespace
 
 //------------------------------------------------------------------------------
@@ -592,7 +661,7 @@ void ROOT::Experimental::Detail::RFieldBase::AutoAdjustColumnTypes(const RNTuple
       SetColumnRepresentative(rep);
    }
 
-   if (fTypeAlias == "Double32_t")
+   if ((fTypeAlias == "Double32_t") && (GetColumnRepresentative()[0] != EColumnType::kReal32Quant))
       SetColumnRepresentative({EColumnType::kSplitReal32});
 }
 
@@ -831,19 +900,32 @@ void ROOT::Experimental::RField<bool>::AcceptVisitor(Detail::RFieldVisitor &visi
 const ROOT::Experimental::Detail::RFieldBase::RColumnRepresentations &
 ROOT::Experimental::RField<float>::GetColumnRepresentations() const
 {
-   static RColumnRepresentations representations({{EColumnType::kSplitReal32}, {EColumnType::kReal32}}, {});
+   static RColumnRepresentations representations(
+      {{EColumnType::kSplitReal32}, {EColumnType::kReal32}, {EColumnType::kReal32Quant}}, {});
    return representations;
 }
 
 void ROOT::Experimental::RField<float>::GenerateColumnsImpl()
 {
-   fColumns.emplace_back(Detail::RColumn::Create<float>(RColumnModel(GetColumnRepresentative()[0]), 0));
+   fColumns.emplace_back(Detail::RColumn::Create<float>(
+      CreateRealColumnModel(GetColumnRepresentative()[0], fQuantizedBits, fQuantizedMin, fQuantizedMax), 0));
 }
 
 void ROOT::Experimental::RField<float>::GenerateColumnsImpl(const RNTupleDescriptor &desc)
 {
-   auto onDiskTypes = EnsureCompatibleColumnTypes(desc);
-   fColumns.emplace_back(Detail::RColumn::Create<float>(RColumnModel(onDiskTypes[0]), 0));
+   EnsureCompatibleColumnTypes(desc);
+   // Take the column model from the descriptor, which also contains the value range of quantized columns
+   const auto &columnDesc = *desc.GetColumnIterable(GetOnDiskId()).begin();
+   fColumns.emplace_back(Detail::RColumn::Create<float>(columnDesc.GetModel(), 0));
+}
+
+void ROOT::Experimental::RField<float>::SetQuantized(std::uint16_t nBits, double minValue, double maxValue)
+{
+   EnsureValidQuantization(nBits, minValue, maxValue);
+   SetColumnRepresentative({EColumnType::kReal32Quant});
+   fQuantizedBits = nBits;
+   fQuantizedMin = minValue;
+   fQuantizedMax = maxValue;
 }
 
 void ROOT::Experimental::RField<float>::AcceptVisitor(Detail::RFieldVisitor &visitor) const
@@ -857,20 +939,27 @@ void ROOT::Experimental::RField<float>::AcceptVisitor(Detail::RFieldVisitor &vis
 const ROOT::Experimental::Detail::RFieldBase::RColumnRepresentations &
 ROOT::Experimental::RField<double>::GetColumnRepresentations() const
 {
-   static RColumnRepresentations representations(
-      {{EColumnType::kSplitReal64}, {EColumnType::kReal64}, {EColumnType::kSplitReal32}, {EColumnType::kReal32}}, {});
+   static RColumnRepresentations representations({{EColumnType::kSplitReal64},
+                                                  {EColumnType::kReal64},
+                                                  {EColumnType::kSplitReal32},
+                                                  {EColumnType::kReal32},
+                                                  {EColumnType::kReal32Quant}},
+                                                 {});
    return representations;
 }
 
 void ROOT::Experimental::RField<double>::GenerateColumnsImpl()
 {
-   fColumns.emplace_back(Detail::RColumn::Create<double>(RColumnModel(GetColumnRepresentative()[0]), 0));
+   fColumns.emplace_back(Detail::RColumn::Create<double>(
+      CreateRealColumnModel(GetColumnRepresentative()[0], fQuantizedBits, fQuantizedMin, fQuantizedMax), 0));
 }
 
 void ROOT::Experimental::RField<double>::GenerateColumnsImpl(const RNTupleDescriptor &desc)
 {
-   auto onDiskTypes = EnsureCompatibleColumnTypes(desc);
-   fColumns.emplace_back(Detail::RColumn::Create<double>(RColumnModel(onDiskTypes[0]), 0));
+   EnsureCompatibleColumnTypes(desc);
+   // Take the column model from the descriptor, which also contains the value range of quantized columns
+   const auto &columnDesc = *desc.GetColumnIterable(GetOnDiskId()).begin();
+   fColumns.emplace_back(Detail::RColumn::Create<double>(columnDesc.GetModel(), 0));
 }
 
 void ROOT::Experimental::RField<double>::AcceptVisitor(Detail::RFieldVisitor &visitor) const
@@ -883,19 +972,31 @@ void ROOT::Experimental::RField<double>::SetDouble32()
    fTypeAlias = "Double32_t";
 }
 
+void ROOT::Experimental::RField<double>::SetQuantized(std::uint16_t nBits, double minValue, double maxValue)
+{
+   EnsureValidQuantization(nBits, minValue, maxValue);
+   SetColumnRepresentative({EColumnType::kReal32Quant});
+   fQuantizedBits = nBits;
+   fQuantizedMin = minValue;
+   fQuantizedMax = maxValue;
+}
+
 //------------------------------------------------------------------------------
 
 const ROOT::Experimental::Detail::RFieldBase::RColumnRepresentations &
 ROOT::Experimental::RField<std::int16_t>::GetColumnRepresentations() const
 {
-   static RColumnRepresentations representations({{EColumnType::kSplitInt16}, {EColumnType::kInt16}},
-                                                 {{EColumnType::kSplitUInt16}, {EColumnType::kUInt16}});
+   static RColumnRepresentations representations(
+      {{EColumnType::kSplitInt16}, {EColumnType::kInt16}, {EColumnType::kInt8}},
+      {{EColumnType::kSplitUInt16}, {EColumnType::kUInt16}});
    return representations;
 }
 
 void ROOT::Experimental::RField<std::int16_t>::GenerateColumnsImpl()
 {
    fColumns.emplace_back(Detail::RColumn::Create<std::int16_t>(RColumnModel(GetColumnRepresentative()[0]), 0));
+   if (GetNarrowColumnRange(GetColumnRepresentative()[0], fMinValue, fMaxValue))
+      fTraits &= ~kTraitMappable;
 }
 
 void ROOT::Experimental::RField<std::int16_t>::GenerateColumnsImpl(const RNTupleDescriptor &desc)
@@ -904,6 +1005,13 @@ void ROOT::Experimental::RField<std::int16_t>::GenerateColumnsImpl(const RNTuple
    fColumns.emplace_back(Detail::RColumn::Create<std::int16_t>(RColumnModel(onDiskTypes[0]), 0));
 }
 
+std::size_t ROOT::Experimental::RField<std::int16_t>::AppendImpl(const void *from)
+{
+   EnsureValueInColumnRange(*static_cast<const std::int16_t *>(from), fMinValue, fMaxValue, *this);
+   fPrincipalColumn->Append(from);
+   return fPrincipalColumn->GetElement()->GetPackedSize();
+}
+
 void ROOT::Experimental::RField<std::int16_t>::AcceptVisitor(Detail::RFieldVisitor &visitor) const
 {
    visitor.VisitInt16Field(*this);
@@ -914,14 +1022,17 @@ void ROOT::Experimental::RField<std::int16_t>::AcceptVisitor(Detail::RFieldVisit
 const ROOT::Experimental::Detail::RFieldBase::RColumnRepresentations &
 ROOT::Experimental::RField<std::uint16_t>::GetColumnRepresentations() const
 {
-   static RColumnRepresentations representations({{EColumnType::kSplitUInt16}, {EColumnType::kUInt16}},
-                                                 {{EColumnType::kSplitInt16}, {EColumnType::kInt16}});
+   static RColumnRepresentations representations(
+      {{EColumnType::kSplitUInt16}, {EColumnType::kUInt16}, {EColumnType::kUInt8}},
+      {{EColumnType::kSplitInt16}, {EColumnType::kInt16}});
    return representations;
 }
 
 void ROOT::Experimental::RField<std::uint16_t>::GenerateColumnsImpl()
 {
    fColumns.emplace_back(Detail::RColumn::Create<std::uint16_t>(RColumnModel(GetColumnRepresentative()[0]), 0));
+   if (GetNarrowColumnRange(GetColumnRepresentative()[0], fMinValue, fMaxValue))
+      fTraits &= ~kTraitMappable;
 }
 
 void ROOT::Experimental::RField<std::uint16_t>::GenerateColumnsImpl(const RNTupleDescriptor &desc)
@@ -930,6 +1041,13 @@ void ROOT::Experimental::RField<std::uint16_t>::GenerateColumnsImpl(const RNTupl
    fColumns.emplace_back(Detail::RColumn::Create<std::uint16_t>(RColumnModel(onDiskTypes[0]), 0));
 }
 
+std::size_t ROOT::Experimental::RField<std::uint16_t>::AppendImpl(const void *from)
+{
+   EnsureValueInColumnRange(*static_cast<const std::uint16_t *>(from), fMinValue, fMaxValue, *this);
+   fPrincipalColumn->Append(from);
+   return fPrincipalColumn->GetElement()->GetPackedSize();
+}
+
 void ROOT::Experimental::RField<std::uint16_t>::AcceptVisitor(Detail::RFieldVisitor &visitor) const
 {
    visitor.VisitUInt16Field(*this);
@@ -940,7 +1058,11 @@ void ROOT::Experimental::RField<std::uint16_t>::AcceptVisitor(Detail::RFieldVisi
 const ROOT::Experimental::Detail::RFieldBase::RColumnRepresentations &
 ROOT::Experimental::RField<std::int32_t>::GetColumnRepresentations() const
 {
-   static RColumnRepresentations representations({{EColumnType::kSplitInt32}, {EColumnType::kInt32}},
+   static RColumnRepresentations representations({{EColumnType::kSplitInt32},
+                                                  {EColumnType::kInt32},
+                                                  {EColumnType::kSplitInt16},
+                                                  {EColumnType::kInt16},
+                                                  {EColumnType::kInt8}},
                                                  {{EColumnType::kSplitUInt32}, {EColumnType::kUInt32}});
    return representations;
 }
@@ -948,6 +1070,8 @@ ROOT::Experimental::RField<std::int32_t>::GetColumnRepresentations() const
 void ROOT::Experimental::RField<std::int32_t>::GenerateColumnsImpl()
 {
    fColumns.emplace_back(Detail::RColumn::Create<std::int32_t>(RColumnModel(GetColumnRepresentative()[0]), 0));
+   if (GetNarrowColumnRange(GetColumnRepresentative()[0], fMinValue, fMaxValue))
+      fTraits &= ~kTraitMappable;
 }
 
 void ROOT::Experimental::RField<std::int32_t>::GenerateColumnsImpl(const RNTupleDescriptor &desc)
@@ -956,6 +1080,13 @@ void ROOT::Experimental::RField<std::int32_t>::GenerateColumnsImpl(const RNTuple
    fColumns.emplace_back(Detail::RColumn::Create<std::int32_t>(RColumnModel(onDiskTypes[0]), 0));
 }
 
+std::size_t ROOT::Experimental::RField<std::int32_t>::AppendImpl(const void *from)
+{
+   EnsureValueInColumnRange(*static_cast<const std::int32_t *>(from), fMinValue, fMaxValue, *this);
+   fPrincipalColumn->Append(from);
+   return fPrincipalColumn->GetElement()->GetPackedSize();
+}
+
 void ROOT::Experimental::RField<std::int32_t>::AcceptVisitor(Detail::RFieldVisitor &visitor) const
 {
    visitor.VisitIntField(*this);
@@ -966,7 +1097,11 @@ void ROOT::Experimental::RField<std::int32_t>::AcceptVisitor(Detail::RFieldVisit
 const ROOT::Experimental::Detail::RFieldBase::RColumnRepresentations &
 ROOT::Experimental::RField<std::uint32_t>::GetColumnRepresentations() const
 {
-   static RColumnRepresentations representations({{EColumnType::kSplitUInt32}, {EColumnType::kUInt32}},
+   static RColumnRepresentations representations({{EColumnType::kSplitUInt32},
+                                                  {EColumnType::kUInt32},
+                                                  {EColumnType::kSplitUInt16},
+                                                  {EColumnType::kUInt16},
+                                                  {EColumnType::kUInt8}},
                                                  {{EColumnType::kSplitInt32}, {EColumnType::kInt32}});
    return representations;
 }
@@ -974,6 +1109,8 @@ ROOT::Experimental::RField<std::uint32_t>::GetColumnRepresentations() const
 void ROOT::Experimental::RField<std::uint32_t>::GenerateColumnsImpl()
 {
    fColumns.emplace_back(Detail::RColumn::Create<std::uint32_t>(RColumnModel(GetColumnRepresentative()[0]), 0));
+   if (GetNarrowColumnRange(GetColumnRepresentative()[0], fMinValue, fMaxValue))
+      fTraits &= ~kTraitMappable;
 }
 
 void ROOT::Experimental::RField<std::uint32_t>::GenerateColumnsImpl(const RNTupleDescriptor &desc)
@@ -982,6 +1119,13 @@ void ROOT::Experimental::RField<std::uint32_t>::GenerateColumnsImpl(const RNTupl
    fColumns.emplace_back(Detail::RColumn::Create<std::uint32_t>(RColumnModel(onDiskTypes[0]), 0));
 }
 
+std::size_t ROOT::Experimental::RField<std::uint32_t>::AppendImpl(const void *from)
+{
+   EnsureValueInColumnRange(*static_cast<const std::uint32_t *>(from), fMinValue, fMaxValue, *this);
+   fPrincipalColumn->Append(from);
+   return fPrincipalColumn->GetElement()->GetPackedSize();
+}
+
 void ROOT::Experimental::RField<std::uint32_t>::AcceptVisitor(Detail::RFieldVisitor &visitor) const
 {
    visitor.VisitUInt32Field(*this);
@@ -992,14 +1136,17 @@ void ROOT::Experimental::RField<std::uint32_t>::AcceptVisitor(Detail::RFieldVisi
 const ROOT::Experimental::Detail::RFieldBase::RColumnRepresentations &
 ROOT::Experimental::RField<std::uint64_t>::GetColumnRepresentations() const
 {
-   static RColumnRepresentations representations({{EColumnType::kSplitUInt64}, {EColumnType::kUInt64}},
-                                                 {{EColumnType::kSplitInt64}, {EColumnType::kInt64}});
+   static RColumnRepresentations representations(
+      {{EColumnType::kSplitUInt64}, {EColumnType::kUInt64}, {EColumnType::kSplitUInt32}, {EColumnType::kUInt32}},
+      {{EColumnType::kSplitInt64}, {EColumnType::kInt64}});
    return representations;
 }
 
 void ROOT::Experimental::RField<std::uint64_t>::GenerateColumnsImpl()
 {
    fColumns.emplace_back(Detail::RColumn::Create<std::uint64_t>(RColumnModel(GetColumnRepresentative()[0]), 0));
+   if (GetNarrowColumnRange(GetColumnRepresentative()[0], fMinValue, fMaxValue))
+      fTraits &= ~kTraitMappable;
 }
 
 void ROOT::Experimental::RField<std::uint64_t>::GenerateColumnsImpl(const RNTupleDescriptor &desc)
@@ -1008,6 +1155,13 @@ void ROOT::Experimental::RField<std::uint64_t>::GenerateColumnsImpl(const RNTupl
    fColumns.emplace_back(Detail::RColumn::Create<std::uint64_t>(RColumnModel(onDiskTypes[0]), 0));
 }
 
+std::size_t ROOT::Experimental::RField<std::uint64_t>::AppendImpl(const void *from)
+{
+   EnsureValueInColumnRange(*static_cast<const std::uint64_t *>(from), fMinValue, fMaxValue, *this);
+   fPrincipalColumn->Append(from);
+   return fPrincipalColumn->GetElement()->GetPackedSize();
+}
+
 void ROOT::Experimental::RField<std::uint64_t>::AcceptVisitor(Detail::RFieldVisitor &visitor) const
 {
    visitor.VisitUInt64Field(*this);
@@ -1018,19 +1172,17 @@ void ROOT::Experimental::RField<std::uint64_t>::AcceptVisitor(Detail::RFieldVisi
 const ROOT::Experimental::Detail::RFieldBase::RColumnRepresentations &
 ROOT::Experimental::RField<std::int64_t>::GetColumnRepresentations() const
 {
-   static RColumnRepresentations representations({{EColumnType::kSplitInt64}, {EColumnType::kInt64}},
-                                                 {{EColumnType::kSplitUInt64},
-                                                  {EColumnType::kUInt64},
-                                                  {EColumnType::kInt32},
-                                                  {EColumnType::kSplitInt32},
-                                                  {EColumnType::kUInt32},
-                                                  {EColumnType::kSplitUInt32}});
+   static RColumnRepresentations representations(
+      {{EColumnType::kSplitInt64}, {EColumnType::kInt64}, {EColumnType::kSplitInt32}, {EColumnType::kInt32}},
+      {{EColumnType::kSplitUInt64}, {EColumnType::kUInt64}, {EColumnType::kUInt32}, {EColumnType::kSplitUInt32}});
    return representations;
 }
 
 void ROOT::Experimental::RField<std::int64_t>::GenerateColumnsImpl()
 {
    fColumns.emplace_back(Detail::RColumn::Create<std::int64_t>(RColumnModel(GetColumnRepresentative()[0]), 0));
+   if (GetNarrowColumnRange(GetColumnRepresentative()[0], fMinValue, fMaxValue))
+      fTraits &= ~kTraitMappable;
 }
 
 void ROOT::Experimental::RField<std::int64_t>::GenerateColumnsImpl(const RNTupleDescriptor &desc)
@@ -1039,6 +1191,13 @@ void ROOT::Experimental::RField<std::int64_t>::GenerateColumnsImpl(const RNTuple
    fColumns.emplace_back(Detail::RColumn::Create<std::int64_t>(RColumnModel(onDiskTypes[0]), 0));
 }
 
+std::size_t ROOT::Experimental::RField<std::int64_t>::AppendImpl(const void *from)
+{
+   EnsureValueInColumnRange(*static_cast<const std::int64_t *>(from), fMinValue, fMaxValue, *this);
+   fPrincipalColumn->Append(from);
+   return fPrincipalColumn->GetElement()->GetPackedSize();
+}
+
 void ROOT::Experimental::RField<std::int64_t>::AcceptVisitor(Detail::RFieldVisitor &visitor) const
 {
    visitor.VisitInt64Field(*this);
@@ -1872,6 +2031,33 @@ void ROOT::Experimental::RRVecField::ReadGlobalImpl(NTupleSize_t globalIndex, vo
    }
 }
 
+bool ROOT::Experimental::RRVecField::ReadAsView(NTupleSize_t globalIndex, void *to)
+{
+   // Simple fields store their values in the page with the in-memory layout of the C++ type
+   if (!fSubFields[0]->IsSimple())
+      return false;
+
+   ClusterSize_t nItems;
+   RClusterIndex collectionStart;
+   fPrincipalColumn->GetCollectionInfo(globalIndex, &collectionStart, &nItems);
+
+   void *items = nullptr;
+   if (nItems > 0) {
+      NTupleSize_t nItemsInPage;
+      items = GetPrincipalColumnOf(*fSubFields[0])->MapV(collectionStart, nItemsInPage);
+      if (nItemsInPage < nItems)
+         return false;
+   }
+
+   auto [beginPtr, sizePtr, capacityPtr] = GetRVecDataMembers(to);
+   R__ASSERT(*capacityPtr <= 0);
+   *beginPtr = items;
+   *sizePtr = nItems;
+   // A capacity of -1 marks the RVec as non-owning
+   *capacityPtr = -1;
+   return true;
+}
+
 const ROOT::Experimental::Detail::RFieldBase::RColumnRepresentations &
 ROOT::Experimental::RRVecField::GetColumnRepresentations() const
 {
@@ -21,6 +21,7 @@
 #include <ROOT/RPageStorage.hxx>
 #include <ROOT/RPageSinkBuf.hxx>
 #include <ROOT/RPageStorageFile.hxx>
+#include <ROOT/RPageStorageShards.hxx>
 #ifdef R__USE_IMT
 #include <ROOT/TTaskGroup.hxx>
 #endif
@@ -150,6 +151,28 @@ ROOT::Experimental::RNTupleReader::OpenFriends(std::span<ROpenSpec> ntuples)
    return std::make_unique<RNTupleReader>(std::make_unique<Detail::RPageSourceFriends>("_friends", sources));
 }
 
+std::unique_ptr<ROOT::Experimental::RNTupleReader>
+ROOT::Experimental::RNTupleReader::OpenShards(std::string_view ntupleName, std::string_view storage,
+                                              const RNTupleReadOptions &options)
+{
+   auto index = Open(Detail::RPageSinkShards::GetIndexName(ntupleName), storage);
+   auto viewPath = index->GetView<std::string>("path");
+   auto viewNEntries = index->GetView<std::uint64_t>("nEntries");
+
+   // The shard file names are relative to the index
+   const std::string location(storage);
+   const auto posSlash = location.rfind('/');
+   const std::string directory = (posSlash == std::string::npos) ? "" : location.substr(0, posSlash + 1);
+
+   std::vector<std::unique_ptr<Detail::RPageSource>> sources;
+   for (auto i : index->GetEntryRange()) {
+      if (viewNEntries(i) == 0)
+         continue;
+      sources.emplace_back(Detail::RPageSource::Create(ntupleName, directory + viewPath(i), options));
+   }
+   return std::make_unique<RNTupleReader>(std::make_unique<Detail::RPageSourceShards>(ntupleName, sources));
+}
+
 ROOT::Experimental::RNTupleModel *ROOT::Experimental::RNTupleReader::GetModel()
 {
    if (!fModel) {
@@ -215,7 +238,10 @@ void ROOT::Experimental::RNTupleReader::PrintInfo(const ENTupleInfo what, std::o
       output << std::endl;
       break;
    }
-   case ENTupleInfo::kStorageDetails: fSource->GetSharedDescriptorGuard()->PrintInfo(output); break;
+   case ENTupleInfo::kStorageDetails:
+      fSource->EnsureAllClusterDetails();
+      fSource->GetSharedDescriptorGuard()->PrintInfo(output);
+      break;
    case ENTupleInfo::kMetrics: fMetrics.Print(output); break;
    default:
       // Unhandled case, internal error
@@ -260,6 +286,41 @@ const ROOT::Experimental::RNTupleDescriptor *ROOT::Experimental::RNTupleReader::
    return fCachedDescriptor.get();
 }
 
+std::vector<ROOT::Experimental::RNTupleGlobalRange>
+ROOT::Experimental::RNTupleReader::GetMatchingClusterRanges(std::string_view fieldName, double min, double max)
+{
+   // The column statistics are part of the page lists
+   fSource->EnsureAllClusterDetails();
+   auto descriptorGuard = fSource->GetSharedDescriptorGuard();
+   const auto fieldId = descriptorGuard->FindFieldId(fieldName);
+   if (fieldId == kInvalidDescriptorId)
+      throw RException(R__FAIL("no field named '" + std::string(fieldName) + "' in RNTuple '" +
+                               descriptorGuard->GetName() + "'"));
+   const auto columnId = descriptorGuard->FindPhysicalColumnId(fieldId, 0);
+   if (columnId == kInvalidDescriptorId)
+      throw RException(R__FAIL("field '" + std::string(fieldName) + "' has no columns"));
+
+   std::vector<std::pair<NTupleSize_t, NTupleSize_t>> matching;
+   for (const auto &clusterDesc : descriptorGuard->GetClusterIterable()) {
+      if (clusterDesc.ContainsColumn(columnId) &&
+          !clusterDesc.GetColumnRange(columnId).fStatistics.MayContain(min, max)) {
+         continue;
+      }
+      matching.emplace_back(clusterDesc.GetFirstEntryIndex(),
+                            clusterDesc.GetFirstEntryIndex() + clusterDesc.GetNEntries());
+   }
+   std::sort(matching.begin(), matching.end());
+
+   std::vector<RNTupleGlobalRange> result;
+   for (std::size_t i = 0; i < matching.size(); ++i) {
+      auto first = matching[i].first;
+      while ((i + 1 < matching.size()) && (matching[i + 1].first == matching[i].second))
+         ++i;
+      result.emplace_back(first, matching[i].second);
+   }
+   return result;
+}
+
 //------------------------------------------------------------------------------
 
 ROOT::Experimental::RNTupleWriter::RNTupleWriter(std::unique_ptr<ROOT::Experimental::RNTupleModel> model,
@@ -318,6 +379,46 @@ ROOT::Experimental::RNTupleWriter::Append(std::unique_ptr<RNTupleModel> model, s
    return std::make_unique<RNTupleWriter>(std::move(model), std::move(sink));
 }
 
+void ROOT::Experimental::RNTupleWriter::SetSortWindowSize(std::size_t nEntries)
+{
+   fSortWindowSize = nEntries;
+   if (fSortWindowSize > 0 && fSortBuffer.size() >= fSortWindowSize)
+      FlushSortBuffer();
+}
+
+std::unique_ptr<ROOT::Experimental::REntry> ROOT::Experimental::RNTupleWriter::CreateSortEntry()
+{
+   if (fSortFreeEntries.empty())
+      return CreateEntry();
+   auto entry = std::move(fSortFreeEntries.back());
+   fSortFreeEntries.pop_back();
+   return entry;
+}
+
+void ROOT::Experimental::RNTupleWriter::FillSorted(std::unique_ptr<REntry> entry, double sortKey)
+{
+   if (!entry)
+      throw RException(R__FAIL("null entry"));
+   if (R__unlikely(entry->GetModelId() != fModel->GetModelId()))
+      throw RException(R__FAIL("mismatch between entry and model"));
+   fSortBuffer.emplace_back(sortKey, std::move(entry));
+   if (fSortWindowSize > 0 && fSortBuffer.size() >= fSortWindowSize)
+      FlushSortBuffer();
+}
+
+void ROOT::Experimental::RNTupleWriter::FlushSortBuffer()
+{
+   // Fill() may commit a cluster, which flushes the sort buffer again; take the buffered entries out first
+   auto sortBuffer = std::move(fSortBuffer);
+   fSortBuffer.clear();
+   std::stable_sort(sortBuffer.begin(), sortBuffer.end(),
+                    [](const auto &a, const auto &b) { return a.first < b.first; });
+   for (auto &[_, entry] : sortBuffer) {
+      Fill(*entry);
+      fSortFreeEntries.emplace_back(std::move(entry));
+   }
+}
+
 void ROOT::Experimental::RNTupleWriter::CommitClusterGroup()
 {
    if (fNEntries == fLastCommittedClusterGroup)
@@ -328,6 +429,8 @@ void ROOT::Experimental::RNTupleWriter::CommitClusterGroup()
 
 void ROOT::Experimental::RNTupleWriter::CommitCluster(bool commitClusterGroup)
 {
+   if (!fSortBuffer.empty())
+      FlushSortBuffer();
    if (fNEntries == fLastCommitted) {
       if (commitClusterGroup)
          CommitClusterGroup();
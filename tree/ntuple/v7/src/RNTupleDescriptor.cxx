@@ -243,7 +243,8 @@ ROOT::Experimental::RNTupleDescriptor::GetNElements(DescriptorId_t physicalColum
 {
    NTupleSize_t result = 0;
    for (const auto &cd : fClusterDescriptors) {
-      if (!cd.second.ContainsColumn(physicalColumnId))
+      // Summary-only clusters are skipped; the page source makes sure that the last clusters have page locations
+      if (!cd.second.HasPageLocations() || !cd.second.ContainsColumn(physicalColumnId))
          continue;
       auto columnRange = cd.second.GetColumnRange(physicalColumnId);
       result = std::max(result, columnRange.fFirstElementIndex + columnRange.fNElements);
@@ -320,7 +321,8 @@ ROOT::Experimental::RNTupleDescriptor::FindClusterId(DescriptorId_t physicalColu
 {
    // TODO(jblomer): binary search?
    for (const auto &cd : fClusterDescriptors) {
-      if (!cd.second.ContainsColumn(physicalColumnId))
+      // The element ranges of summary-only clusters are unknown
+      if (!cd.second.HasPageLocations() || !cd.second.ContainsColumn(physicalColumnId))
          continue;
       auto columnRange = cd.second.GetColumnRange(physicalColumnId);
       if (columnRange.Contains(index))
@@ -491,10 +493,9 @@ ROOT::Experimental::RClusterGroupDescriptor ROOT::Experimental::RClusterGroupDes
 ////////////////////////////////////////////////////////////////////////////////
 
 ROOT::Experimental::RResult<void>
-ROOT::Experimental::RClusterDescriptorBuilder::CommitColumnRange(DescriptorId_t physicalId,
-                                                                 std::uint64_t firstElementIndex,
-                                                                 std::uint32_t compressionSettings,
-                                                                 const RClusterDescriptor::RPageRange &pageRange)
+ROOT::Experimental::RClusterDescriptorBuilder::CommitColumnRange(
+   DescriptorId_t physicalId, std::uint64_t firstElementIndex, std::uint32_t compressionSettings,
+   const RClusterDescriptor::RPageRange &pageRange, const RClusterDescriptor::RColumnStatistics &statistics)
 {
    if (physicalId != pageRange.fPhysicalColumnId)
       return R__FAIL("column ID mismatch");
@@ -502,6 +503,7 @@ ROOT::Experimental::RClusterDescriptorBuilder::CommitColumnRange(DescriptorId_t
       return R__FAIL("column ID conflict");
    RClusterDescriptor::RColumnRange columnRange{physicalId, firstElementIndex, RClusterSize(0)};
    columnRange.fCompressionSettings = compressionSettings;
+   columnRange.fStatistics = statistics;
    for (const auto &pi : pageRange.fPageInfos) {
       columnRange.fNElements += pi.fNElements;
    }
@@ -553,7 +555,7 @@ ROOT::Experimental::RClusterDescriptorBuilder::AddDeferredColumnRanges(const RNT
                if (c.IsDeferredColumn()) {
                   columnRange.fFirstElementIndex = fCluster.GetFirstEntryIndex() * nRepetitions;
                   columnRange.fNElements = fCluster.GetNEntries() * nRepetitions;
-                  const auto element = Detail::RColumnElementBase::Generate<void>(c.GetModel().GetType());
+                  const auto element = Detail::RColumnElementBase::Generate<void>(c.GetModel());
                   pageRange.ExtendToFitColumnRange(columnRange, *element, Detail::RPage::kPageZeroSize);
                }
             }
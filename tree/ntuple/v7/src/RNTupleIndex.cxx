@@ -0,0 +1,283 @@
+/// \file RNTupleIndex.cxx
+/// \ingroup NTuple ROOT7
+/// \date 2026-10-14
+/// \warning This is part of the ROOT 7 prototype! It will change without notice. It might trigger earthquakes. Feedback
+/// is welcome!
+
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include <ROOT/RError.hxx>
+#include <ROOT/RField.hxx>
+#include <ROOT/RNTuple.hxx>
+#include <ROOT/RNTupleIndex.hxx>
+#include <ROOT/RNTupleModel.hxx>
+#include <ROOT/RPageStorage.hxx>
+#ifdef R__USE_IMT
+#include <ROOT/TTaskGroup.hxx>
+#endif
+
+#include <TROOT.h> // for IsImplicitMTEnabled()
+
+#include <algorithm>
+#include <exception>
+#include <utility>
+
+namespace {
+
+using ROOT::Experimental::DescriptorId_t;
+using ROOT::Experimental::NTupleSize_t;
+using ROOT::Experimental::RException;
+using ROOT::Experimental::RNTupleIndex;
+using ROOT::Experimental::Detail::RPageSource;
+
+/// The on-disk field of an index key
+struct RKeyField {
+   DescriptorId_t fFieldId = ROOT::Experimental::kInvalidDescriptorId;
+   std::string fFieldName;
+   std::string fTypeName;
+};
+
+RKeyField FindKeyField(std::string_view fieldName, RPageSource &source)
+{
+   auto descriptorGuard = source.GetSharedDescriptorGuard();
+   RKeyField keyField;
+   keyField.fFieldId = descriptorGuard->FindFieldId(fieldName);
+   if (keyField.fFieldId == ROOT::Experimental::kInvalidDescriptorId)
+      throw RException(R__FAIL("no field named '" + std::string(fieldName) + "' in RNTuple '" +
+                               descriptorGuard->GetName() + "'"));
+   const auto &fieldDesc = descriptorGuard->GetFieldDescriptor(keyField.fFieldId);
+   if (fieldDesc.GetParentId() != descriptorGuard->GetFieldZeroId())
+      throw RException(R__FAIL("index field '" + std::string(fieldName) + "' is not a top-level field"));
+   keyField.fFieldName = fieldDesc.GetFieldName();
+   keyField.fTypeName = fieldDesc.GetTypeName();
+   return keyField;
+}
+
+template <typename T>
+void ReadKeysAs(const RKeyField &keyField, RPageSource &source, NTupleSize_t firstEntry, NTupleSize_t nEntries,
+                std::vector<RNTupleIndex::Key_t> &keys)
+{
+   ROOT::Experimental::RField<T> field(keyField.fFieldName);
+   field.SetOnDiskId(keyField.fFieldId);
+   field.ConnectPageSource(source);
+   auto value = field.GenerateValue();
+   keys.reserve(nEntries);
+   for (auto i = firstEntry; i < firstEntry + nEntries; ++i) {
+      value.Read(i);
+      keys.emplace_back(static_cast<RNTupleIndex::Key_t>(*value.template Get<T>()));
+   }
+}
+
+/// Index keys can be read from fields of these types
+bool IsSupportedKeyType(const std::string &typeName)
+{
+   static const std::vector<std::string> kKeyTypes{
+      "bool", "char", "std::int8_t", "std::uint8_t", "std::int16_t", "std::uint16_t",
+      "std::int32_t", "std::uint32_t", "std::int64_t", "std::uint64_t"};
+   return std::find(kKeyTypes.begin(), kKeyTypes.end(), typeName) != kKeyTypes.end();
+}
+
+/// Returns the key values of the given entry range
+std::vector<RNTupleIndex::Key_t>
+ReadKeys(const RKeyField &keyField, RPageSource &source, NTupleSize_t firstEntry, NTupleSize_t nEntries)
+{
+   std::vector<RNTupleIndex::Key_t> keys;
+   const auto &typeName = keyField.fTypeName;
+   if (typeName == "bool") {
+      ReadKeysAs<bool>(keyField, source, firstEntry, nEntries, keys);
+   } else if (typeName == "char") {
+      ReadKeysAs<char>(keyField, source, firstEntry, nEntries, keys);
+   } else if (typeName == "std::int8_t") {
+      ReadKeysAs<std::int8_t>(keyField, source, firstEntry, nEntries, keys);
+   } else if (typeName == "std::uint8_t") {
+      ReadKeysAs<std::uint8_t>(keyField, source, firstEntry, nEntries, keys);
+   } else if (typeName == "std::int16_t") {
+      ReadKeysAs<std::int16_t>(keyField, source, firstEntry, nEntries, keys);
+   } else if (typeName == "std::uint16_t") {
+      ReadKeysAs<std::uint16_t>(keyField, source, firstEntry, nEntries, keys);
+   } else if (typeName == "std::int32_t") {
+      ReadKeysAs<std::int32_t>(keyField, source, firstEntry, nEntries, keys);
+   } else if (typeName == "std::uint32_t") {
+      ReadKeysAs<std::uint32_t>(keyField, source, firstEntry, nEntries, keys);
+   } else if (typeName == "std::int64_t") {
+      ReadKeysAs<std::int64_t>(keyField, source, firstEntry, nEntries, keys);
+   } else if (typeName == "std::uint64_t") {
+      ReadKeysAs<std::uint64_t>(keyField, source, firstEntry, nEntries, keys);
+   } else {
+      R__ASSERT(false);
+   }
+   return keys;
+}
+
+} // anonymous namespace
+
+ROOT::Experimental::RNTupleIndex::RNTupleIndex(std::string_view majorFieldName, std::string_view minorFieldName)
+   : fMajorFieldName(majorFieldName), fMinorFieldName(minorFieldName)
+{
+}
+
+std::unique_ptr<ROOT::Experimental::RNTupleIndex>
+ROOT::Experimental::RNTupleIndex::Build(std::string_view majorField, std::string_view minorField,
+                                        Detail::RPageSource &source)
+{
+   auto majorKeyField = FindKeyField(majorField, source);
+   RKeyField minorKeyField;
+   if (!minorField.empty())
+      minorKeyField = FindKeyField(minorField, source);
+   for (const auto *keyField : {&majorKeyField, &minorKeyField}) {
+      if (keyField->fFieldId != kInvalidDescriptorId && !IsSupportedKeyType(keyField->fTypeName)) {
+         throw RException(R__FAIL("index field '" + keyField->fFieldName + "' has unsupported type '" +
+                                  keyField->fTypeName + "'"));
+      }
+   }
+
+   // Entry ranges of the clusters, sorted by the first entry
+   std::vector<std::pair<NTupleSize_t, NTupleSize_t>> clusterRanges;
+   {
+      auto descriptorGuard = source.GetSharedDescriptorGuard();
+      for (const auto &clusterDesc : descriptorGuard->GetClusterIterable()) {
+         if (clusterDesc.GetNEntries() > 0)
+            clusterRanges.emplace_back(clusterDesc.GetFirstEntryIndex(), clusterDesc.GetNEntries());
+      }
+   }
+   std::sort(clusterRanges.begin(), clusterRanges.end());
+
+   // Reads the keys of a contiguous block of clusters [firstCluster, lastCluster)
+   auto fnIndexClusters = [&](RPageSource &src, std::size_t firstCluster, std::size_t lastCluster) {
+      std::vector<RIndexEntry> entries;
+      for (auto i = firstCluster; i < lastCluster; ++i) {
+         const auto [firstEntry, nEntries] = clusterRanges[i];
+         const auto majorKeys = ReadKeys(majorKeyField, src, firstEntry, nEntries);
+         std::vector<Key_t> minorKeys;
+         if (minorKeyField.fFieldId != kInvalidDescriptorId)
+            minorKeys = ReadKeys(minorKeyField, src, firstEntry, nEntries);
+         for (NTupleSize_t j = 0; j < nEntries; ++j)
+            entries.push_back({majorKeys[j], minorKeys.empty() ? 0 : minorKeys[j], firstEntry + j});
+      }
+      std::sort(entries.begin(), entries.end());
+      return entries;
+   };
+
+   std::unique_ptr<RNTupleIndex> index(new RNTupleIndex(majorField, minorField));
+   std::size_t nTasks = 1;
+#ifdef R__USE_IMT
+   if (IsImplicitMTEnabled())
+      nTasks = std::min<std::size_t>(ROOT::GetThreadPoolSize(), clusterRanges.size());
+#endif
+   if (nTasks <= 1) {
+      index->fEntries = fnIndexClusters(source, 0, clusterRanges.size());
+      return index;
+   }
+
+#ifdef R__USE_IMT
+   // Every task works on its own clone of the page source on a contiguous block of clusters
+   std::vector<std::vector<RIndexEntry>> partialEntries(nTasks);
+   std::vector<std::exception_ptr> errors(nTasks);
+   TTaskGroup taskGroup;
+   for (std::size_t t = 0; t < nTasks; ++t) {
+      taskGroup.Run([&, t]() {
+         try {
+            auto clone = source.Clone();
+            clone->Attach();
+            partialEntries[t] = fnIndexClusters(*clone, clusterRanges.size() * t / nTasks,
+                                                clusterRanges.size() * (t + 1) / nTasks);
+         } catch (...) {
+            errors[t] = std::current_exception();
+         }
+      });
+   }
+   taskGroup.Wait();
+   for (const auto &e : errors) {
+      if (e)
+         std::rethrow_exception(e);
+   }
+
+   for (auto &p : partialEntries) {
+      const auto nSorted = index->fEntries.size();
+      index->fEntries.insert(index->fEntries.end(), p.begin(), p.end());
+      std::inplace_merge(index->fEntries.begin(), index->fEntries.begin() + nSorted, index->fEntries.end());
+   }
+#endif
+   return index;
+}
+
+std::unique_ptr<ROOT::Experimental::RNTupleIndex>
+ROOT::Experimental::RNTupleIndex::Build(std::string_view majorField, std::string_view minorField,
+                                        std::string_view ntupleName, std::string_view storage)
+{
+   auto source = Detail::RPageSource::Create(ntupleName, storage);
+   source->Attach();
+   return Build(majorField, minorField, *source);
+}
+
+std::unique_ptr<ROOT::Experimental::RNTupleIndex>
+ROOT::Experimental::RNTupleIndex::Open(std::string_view indexName, std::string_view storage)
+{
+   auto reader = RNTupleReader::Open(indexName, storage);
+   const auto *desc = reader->GetDescriptor();
+   for (const auto &name : {"major", "minor", "entry"}) {
+      const auto fieldId = desc->FindFieldId(name);
+      if (fieldId == kInvalidDescriptorId || desc->GetFieldDescriptor(fieldId).GetTypeName() != "std::uint64_t")
+         throw RException(R__FAIL("'" + std::string(indexName) + "' is not an RNTuple index"));
+   }
+   const auto majorFieldName = desc->GetFieldDescriptor(desc->FindFieldId("major")).GetFieldDescription();
+   const auto minorFieldName = desc->GetFieldDescriptor(desc->FindFieldId("minor")).GetFieldDescription();
+
+   std::unique_ptr<RNTupleIndex> index(new RNTupleIndex(majorFieldName, minorFieldName));
+   const auto nEntries = reader->GetNEntries();
+   std::vector<std::uint64_t> majors(nEntries);
+   std::vector<std::uint64_t> minors(nEntries);
+   std::vector<std::uint64_t> entries(nEntries);
+   reader->GetView<std::uint64_t>("major").ReadV(0, std::span<std::uint64_t>(majors.data(), majors.size()));
+   reader->GetView<std::uint64_t>("minor").ReadV(0, std::span<std::uint64_t>(minors.data(), minors.size()));
+   reader->GetView<std::uint64_t>("entry").ReadV(0, std::span<std::uint64_t>(entries.data(), entries.size()));
+   index->fEntries.reserve(nEntries);
+   for (std::size_t i = 0; i < nEntries; ++i)
+      index->fEntries.push_back({majors[i], minors[i], entries[i]});
+   if (!std::is_sorted(index->fEntries.begin(), index->fEntries.end()))
+      throw RException(R__FAIL("corrupt RNTuple index '" + std::string(indexName) + "': keys are not sorted"));
+   return index;
+}
+
+void ROOT::Experimental::RNTupleIndex::Write(std::string_view indexName, TFile &file) const
+{
+   auto model = RNTupleModel::Create();
+   auto major = model->MakeField<std::uint64_t>({"major", fMajorFieldName});
+   auto minor = model->MakeField<std::uint64_t>({"minor", fMinorFieldName});
+   auto entry = model->MakeField<std::uint64_t>({"entry", ""});
+   model->SetDescription("RNTupleIndex");
+   auto writer = RNTupleWriter::Append(std::move(model), indexName, file);
+   for (const auto &e : fEntries) {
+      *major = e.fMajor;
+      *minor = e.fMinor;
+      *entry = e.fEntry;
+      writer->Fill();
+   }
+}
+
+ROOT::Experimental::NTupleSize_t ROOT::Experimental::RNTupleIndex::GetEntryNumber(Key_t major, Key_t minor) const
+{
+   const RIndexEntry probe{major, minor, 0};
+   auto itr = std::lower_bound(fEntries.begin(), fEntries.end(), probe);
+   if (itr == fEntries.end() || itr->fMajor != major || itr->fMinor != minor)
+      return kInvalidNTupleIndex;
+   return itr->fEntry;
+}
+
+std::vector<ROOT::Experimental::NTupleSize_t>
+ROOT::Experimental::RNTupleIndex::GetEntryNumbers(Key_t major, Key_t minor) const
+{
+   std::vector<NTupleSize_t> result;
+   const RIndexEntry probe{major, minor, 0};
+   for (auto itr = std::lower_bound(fEntries.begin(), fEntries.end(), probe);
+        itr != fEntries.end() && itr->fMajor == major && itr->fMinor == minor; ++itr) {
+      result.push_back(itr->fEntry);
+   }
+   return result;
+}
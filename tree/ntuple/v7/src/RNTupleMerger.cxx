@@ -13,17 +13,271 @@
  * For the list of contributors see $ROOTSYS/README/CREDITS.             *
  *************************************************************************/
 
+#include <ROOT/RColumnElement.hxx>
 #include <ROOT/RError.hxx>
+#include <ROOT/RField.hxx>
+#include <ROOT/RLogger.hxx>
 #include <ROOT/RNTuple.hxx>
 #include <ROOT/RNTupleDescriptor.hxx>
 #include <ROOT/RNTupleMerger.hxx>
+#include <ROOT/RNTupleModel.hxx>
+#include <ROOT/RNTupleOptions.hxx>
 #include <ROOT/RNTupleUtil.hxx>
+#include <ROOT/RNTupleZip.hxx>
+#include <ROOT/RPageStorage.hxx>
+#include <ROOT/RPageStorageFile.hxx>
 
-Long64_t ROOT::Experimental::RNTuple::Merge(TCollection* inputs, TFileMergeInfo* mergeInfo) {
-   if (inputs == nullptr || mergeInfo == nullptr) {
+#include <TCollection.h>
+#include <TDirectory.h>
+#include <TFile.h>
+#include <TFileMergeInfo.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <deque>
+#include <map>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace {
+
+using ROOT::Experimental::DescriptorId_t;
+using ROOT::Experimental::EColumnType;
+using ROOT::Experimental::RColumnDescriptor;
+using ROOT::Experimental::RColumnModel;
+using ROOT::Experimental::RException;
+using ROOT::Experimental::RField;
+using ROOT::Experimental::RNTupleDescriptor;
+using ROOT::Experimental::RNTupleModel;
+
+/// Identifies a column across ntuples by the qualified name of its field and its index within the field
+using ColumnKey_t = std::pair<std::string, std::uint32_t>;
+/// The physical column ID and the column model of a column
+using ColumnInfo_t = std::pair<DescriptorId_t, RColumnModel>;
+
+/// Collects the physical columns of the ntuple. Alias columns are skipped because they have no pages.
+std::map<ColumnKey_t, ColumnInfo_t> GetColumnInfos(const RNTupleDescriptor &desc)
+{
+   std::map<ColumnKey_t, ColumnInfo_t> result;
+   for (const auto &c : desc.GetColumnIterable()) {
+      if (c.IsAliasColumn())
+         continue;
+      result.emplace(ColumnKey_t(desc.GetQualifiedFieldName(c.GetFieldId()), c.GetIndex()),
+                     ColumnInfo_t(c.GetPhysicalId(), c.GetModel()));
+   }
+   return result;
+}
+
+/// A column of a source and the corresponding column of the destination
+struct RColumnMapping {
+   DescriptorId_t fSourceId;
+   DescriptorId_t fDestId;
+   /// Used to compute the packed size of pages that need to be recompressed
+   std::unique_ptr<ROOT::Experimental::Detail::RColumnElementBase> fElement;
+};
+
+/// Maps the qualified names of all the fields to their type names
+void CollectFieldTypes(const RNTupleDescriptor &desc, DescriptorId_t fieldId,
+                       std::map<std::string, std::string> &fieldTypes)
+{
+   for (const auto &f : desc.GetFieldIterable(fieldId)) {
+      fieldTypes.emplace(desc.GetQualifiedFieldName(f.GetId()), f.GetTypeName());
+      CollectFieldTypes(desc, f.GetId(), fieldTypes);
+   }
+}
+
+std::map<std::string, std::string> GetFieldTypes(const RNTupleDescriptor &desc)
+{
+   std::map<std::string, std::string> fieldTypes;
+   CollectFieldTypes(desc, desc.GetFieldZeroId(), fieldTypes);
+   return fieldTypes;
+}
+
+/// Creates the model of the merged ntuple such that the fields are written with the same column types, and in the
+/// case of quantized columns with the same value range, as the given source. Only then, pages can be copied
+/// verbatim.
+std::unique_ptr<RNTupleModel> CreateMergedModel(const RNTupleDescriptor &desc)
+{
+   auto model = desc.GenerateModel();
+   for (auto &f : *model->GetFieldZero()) {
+      std::vector<const RColumnDescriptor *> columns;
+      for (const auto &c : desc.GetColumnIterable(f.GetOnDiskId()))
+         columns.emplace_back(&c);
+      if (columns.empty())
+         continue;
+      std::sort(columns.begin(), columns.end(),
+                [](const RColumnDescriptor *a, const RColumnDescriptor *b) { return a->GetIndex() < b->GetIndex(); });
+
+      ROOT::Experimental::Detail::RFieldBase::ColumnRepresentation_t representation;
+      for (auto c : columns) {
+         if (c->IsAliasColumn()) {
+            throw RException(R__FAIL("merging ntuples with projected fields is unsupported: " +
+                                     f.GetQualifiedFieldName()));
+         }
+         representation.emplace_back(c->GetModel().GetType());
+      }
+
+      const auto &columnModel = columns[0]->GetModel();
+      if (columnModel.GetType() == EColumnType::kReal32Quant) {
+         const auto nBits = columnModel.GetBitsOnStorage();
+         if (auto floatField = dynamic_cast<RField<float> *>(&f)) {
+            floatField->SetQuantized(nBits, columnModel.GetValueMin(), columnModel.GetValueMax());
+         } else if (auto doubleField = dynamic_cast<RField<double> *>(&f)) {
+            doubleField->SetQuantized(nBits, columnModel.GetValueMin(), columnModel.GetValueMax());
+         } else {
+            throw RException(R__FAIL("unexpected quantized column of field " + f.GetQualifiedFieldName()));
+         }
+      } else {
+         f.SetColumnRepresentative(representation);
+      }
+   }
+   return model;
+}
+
+} // anonymous namespace
+
+void ROOT::Experimental::RNTupleMerger::Merge(std::span<Detail::RPageSource *> sources, Detail::RPageSink &destination)
+{
+   if (sources.empty())
+      throw RException(R__FAIL("no sources to merge"));
+
+   const auto compression = destination.GetWriteOptions().GetCompression();
+   Detail::RNTupleDecompressor decompressor;
+   std::map<ColumnKey_t, ColumnInfo_t> destColumns;
+   std::map<std::string, std::string> destFieldTypes;
+   // Needs to be kept alive until the destination is destructed
+   std::unique_ptr<RNTupleModel> model;
+   NTupleSize_t nEntries = 0;
+
+   for (auto source : sources) {
+      source->Attach();
+      // Work on a copy of the descriptor so that no lock is held while the sealed pages are loaded
+      const auto desc = source->GetSharedDescriptorGuard()->Clone();
+
+      if (!model) {
+         model = CreateMergedModel(*desc);
+         destination.Create(*model);
+         destColumns = GetColumnInfos(destination.GetDescriptor());
+         destFieldTypes = GetFieldTypes(destination.GetDescriptor());
+      }
+
+      const auto sourceColumns = GetColumnInfos(*desc);
+      if (GetFieldTypes(*desc) != destFieldTypes || sourceColumns.size() != destColumns.size()) {
+         throw RException(R__FAIL("incompatible schema of ntuple '" + desc->GetName() + "'"));
+      }
+      std::vector<RColumnMapping> columnMap;
+      for (const auto &[key, info] : sourceColumns) {
+         auto itDest = destColumns.find(key);
+         if (itDest == destColumns.end() || itDest->second.second != info.second)
+            throw RException(R__FAIL("incompatible schema of ntuple '" + desc->GetName() + "'"));
+         columnMap.push_back({info.first, itDest->second.first, Detail::RColumnElementBase::Generate(info.second)});
+      }
+
+      std::vector<const RClusterDescriptor *> clusters;
+      for (const auto &c : desc->GetClusterIterable())
+         clusters.emplace_back(&c);
+      std::sort(clusters.begin(), clusters.end(), [](const RClusterDescriptor *a, const RClusterDescriptor *b) {
+         return a->GetFirstEntryIndex() < b->GetFirstEntryIndex();
+      });
+
+      for (auto cluster : clusters) {
+         std::vector<std::unique_ptr<unsigned char[]>> buffers;
+         std::vector<Detail::RPageStorage::SealedPageSequence_t> sealedPages(columnMap.size());
+         std::vector<Detail::RPageStorage::RSealedPageGroup> sealedPageGroups;
+
+         for (std::size_t i = 0; i < columnMap.size(); ++i) {
+            const auto sourceColumnId = columnMap[i].fSourceId;
+            if (!cluster->ContainsColumn(sourceColumnId))
+               continue;
+            const auto &columnRange = cluster->GetColumnRange(sourceColumnId);
+            const bool needsRecompression = columnRange.fCompressionSettings != compression;
+
+            RClusterSize::ValueType firstInPage = 0;
+            for (const auto &pageInfo : cluster->GetPageRange(sourceColumnId).fPageInfos) {
+               Detail::RPageStorage::RSealedPage sealedPage;
+               source->LoadSealedPage(sourceColumnId, RClusterIndex(cluster->GetId(), firstInPage), sealedPage);
+               auto buffer = std::make_unique<unsigned char[]>(sealedPage.fSize);
+               sealedPage.fBuffer = buffer.get();
+               source->LoadSealedPage(sourceColumnId, RClusterIndex(cluster->GetId(), firstInPage), sealedPage);
+
+               const auto packedSize = columnMap[i].fElement->GetPackedSize(sealedPage.fNElements);
+               if (needsRecompression && packedSize > 0) {
+                  auto unzipped = std::make_unique<unsigned char[]>(packedSize);
+                  decompressor.Unzip(sealedPage.fBuffer, sealedPage.fSize, packedSize, unzipped.get());
+                  buffer = std::make_unique<unsigned char[]>(packedSize);
+                  sealedPage.fSize =
+                     Detail::RNTupleCompressor::Zip(unzipped.get(), packedSize, compression, buffer.get());
+                  sealedPage.fBuffer = buffer.get();
+               }
+               sealedPage.fStatistics = columnRange.fStatistics;
+               buffers.emplace_back(std::move(buffer));
+
+               firstInPage += pageInfo.fNElements;
+               sealedPages[i].emplace_back(std::move(sealedPage));
+            }
+            sealedPageGroups.emplace_back(columnMap[i].fDestId, sealedPages[i].cbegin(), sealedPages[i].cend());
+         }
+
+         destination.CommitSealedPageV(sealedPageGroups);
+         nEntries += cluster->GetNEntries();
+         destination.CommitCluster(nEntries);
+      }
+      destination.CommitClusterGroup();
+   }
+   destination.CommitDataset();
+}
+
+Long64_t ROOT::Experimental::RNTuple::Merge(TCollection *inputs, TFileMergeInfo *mergeInfo)
+{
+   // The input list starts with the name of the ntuple and the output file, followed by the source directories
+   if (inputs == nullptr || mergeInfo == nullptr || inputs->GetEntries() < 2)
+      return -1;
+
+   TIter itInputs(inputs);
+   const std::string ntupleName = itInputs()->GetName();
+   auto outFile = dynamic_cast<TFile *>(itInputs());
+   if (!outFile) {
+      R__LOG_ERROR(NTupleLog()) << "RNTuple '" << ntupleName << "' can only be merged into the top-level directory";
+      return -1;
+   }
+   if (outFile->FindKey(ntupleName.c_str())) {
+      R__LOG_ERROR(NTupleLog()) << "RNTuple '" << ntupleName << "' already exists in the output file; "
+                                << "incremental merging is unsupported";
+      return -1;
+   }
+
+   std::vector<std::unique_ptr<RNTuple>> anchors;
+   std::vector<std::unique_ptr<Detail::RPageSource>> sources;
+   while (auto obj = itInputs()) {
+      auto dir = dynamic_cast<TDirectory *>(obj);
+      if (!dir)
+         return -1;
+      anchors.emplace_back(dir->Get<RNTuple>(ntupleName.c_str()));
+      if (!anchors.back()) {
+         R__LOG_ERROR(NTupleLog()) << "cannot find RNTuple '" << ntupleName << "' in " << dir->GetPath();
+         return -1;
+      }
+      sources.emplace_back(anchors.back()->MakePageSource());
+   }
+   std::vector<Detail::RPageSource *> sourcePtrs;
+   for (const auto &s : sources)
+      sourcePtrs.emplace_back(s.get());
+
+   RNTupleWriteOptions options;
+   options.SetCompression(outFile->GetCompressionSettings());
+   // Column statistics of the sources are copied along with the pages
+   options.SetHasColumnStatistics(true);
+   try {
+      Detail::RPageSinkFile destination(ntupleName, *outFile, options);
+      RNTupleMerger merger;
+      merger.Merge(sourcePtrs, destination);
+   } catch (const RException &err) {
+      R__LOG_ERROR(NTupleLog()) << "failure merging RNTuple '" << ntupleName << "': " << err.GetError().GetReport();
       return -1;
    }
-   return -1;
+   return 0;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -64,3 +64,19 @@ void ROOT::Experimental::RNTupleWriteOptions::SetApproxUnzippedPageSize(std::siz
    EnsureValidTunables(fApproxZippedClusterSize, fMaxUnzippedClusterSize, val);
    fApproxUnzippedPageSize = val;
 }
+
+void ROOT::Experimental::RNTupleWriteOptions::SetNShards(std::size_t val)
+{
+   if (val == 0) {
+      throw RException(R__FAIL("invalid number of shards: 0"));
+   }
+   fNShards = val;
+}
+
+void ROOT::Experimental::RNTupleWriteOptionsDaos::SetNStripes(uint32_t val)
+{
+   if (val == 0) {
+      throw RException(R__FAIL("invalid number of stripes: 0"));
+   }
+   fNStripes = val;
+}
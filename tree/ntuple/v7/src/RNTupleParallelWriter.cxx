@@ -0,0 +1,242 @@
+/// \file RNTupleParallelWriter.cxx
+/// \ingroup NTuple ROOT7
+/// \date 2026-10-14
+/// \warning This is part of the ROOT 7 prototype! It will change without notice. It might trigger earthquakes. Feedback
+/// is welcome!
+
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include <ROOT/RLogger.hxx>
+#include <ROOT/RNTuple.hxx>
+#include <ROOT/RNTupleModel.hxx>
+#include <ROOT/RNTupleParallelWriter.hxx>
+#include <ROOT/RPageSinkBuf.hxx>
+#include <ROOT/RPageStorage.hxx>
+#ifdef R__USE_IMT
+#include <ROOT/TTaskGroup.hxx>
+#endif
+
+#include <TROOT.h> // for IsImplicitMTEnabled()
+
+#include <algorithm>
+#include <utility>
+
+namespace {
+
+using ROOT::Experimental::DescriptorId_t;
+using ROOT::Experimental::NTupleSize_t;
+using ROOT::Experimental::RException;
+using ROOT::Experimental::RNTupleLocator;
+using ROOT::Experimental::RNTupleModel;
+using ROOT::Experimental::Detail::RPage;
+using ROOT::Experimental::Detail::RPageSink;
+
+/// A task scheduler that runs the tasks immediately in the calling thread. It is used by the fill contexts if
+/// implicit multi-threading is turned off, so that pages are compressed by the filling thread and not while holding
+/// the lock of the shared page sink.
+class RInlineTaskScheduler : public ROOT::Experimental::Detail::RPageStorage::RTaskScheduler {
+public:
+   void Reset() final {}
+   void AddTask(const std::function<void(void)> &taskFunc) final { taskFunc(); }
+   void Wait() final {}
+};
+
+/// A page sink that forwards all operations to the shared page sink of an RNTupleParallelWriter. The enclosing
+/// RPageSinkBuf of a fill context takes the sink guard while it commits the buffered pages and the cluster.
+/// Cluster commits are translated from the entry numbers of the fill context to the entry numbers of the shared sink.
+class RPageSynchronizingSink : public RPageSink {
+private:
+   /// The shared inner sink, owned by the parallel writer
+   RPageSink &fInnerSink;
+   /// The mutex of the parallel writer that protects fInnerSink
+   std::mutex &fMutex;
+
+protected:
+   void CreateImpl(const RNTupleModel &, unsigned char *, std::uint32_t) final
+   {
+      // The shared sink has been created by the parallel writer
+   }
+   RNTupleLocator CommitPageImpl(ColumnHandle_t columnHandle, const RPage &page) final
+   {
+      fInnerSink.CommitPage(columnHandle, page);
+      return RNTupleLocator{};
+   }
+   RNTupleLocator CommitSealedPageImpl(DescriptorId_t physicalColumnId, const RSealedPage &sealedPage) final
+   {
+      fInnerSink.CommitSealedPage(physicalColumnId, sealedPage);
+      return RNTupleLocator{};
+   }
+   std::vector<RNTupleLocator> CommitSealedPageVImpl(std::span<RSealedPageGroup> ranges) final
+   {
+      fInnerSink.CommitSealedPageV(ranges);
+      std::size_t nPages = 0;
+      for (const auto &range : ranges)
+         nPages += std::distance(range.fFirst, range.fLast);
+      return std::vector<RNTupleLocator>(nPages);
+   }
+   std::uint64_t CommitClusterImpl(NTupleSize_t nEntries) final
+   {
+      // fPrevClusterNEntries is only updated after CommitClusterImpl() returns
+      return fInnerSink.CommitCluster(fInnerSink.GetNEntries() + (nEntries - fPrevClusterNEntries));
+   }
+   RNTupleLocator CommitClusterGroupImpl(unsigned char *, std::uint32_t) final
+   {
+      throw RException(R__FAIL("cluster groups must be committed through the parallel writer"));
+   }
+   void CommitDatasetImpl(unsigned char *, std::uint32_t) final
+   {
+      throw RException(R__FAIL("the dataset must be committed through the parallel writer"));
+   }
+
+public:
+   RPageSynchronizingSink(RPageSink &inner, std::mutex &mutex)
+      : RPageSink(inner.GetNTupleName(), inner.GetWriteOptions()), fInnerSink(inner), fMutex(mutex)
+   {
+      // Column statistics are collected by the shared sink
+      fCollectColumnStatistics = false;
+   }
+
+   RSinkGuard GetSinkGuard() final { return RSinkGuard(&fMutex); }
+
+   RPage ReservePage(ColumnHandle_t columnHandle, std::size_t nElements) final
+   {
+      // Page allocation in the shared sink does not touch shared state
+      return fInnerSink.ReservePage(columnHandle, nElements);
+   }
+   void ReleasePage(RPage &page) final { fInnerSink.ReleasePage(page); }
+};
+
+} // anonymous namespace
+
+ROOT::Experimental::RNTupleFillContext::RNTupleFillContext(std::unique_ptr<RNTupleModel> model,
+                                                           std::unique_ptr<Detail::RPageSink> sink)
+   : fSink(std::move(sink)), fModel(std::move(model))
+{
+#ifdef R__USE_IMT
+   if (IsImplicitMTEnabled())
+      fZipTasks = std::make_unique<RNTupleImtTaskScheduler>();
+#endif
+   if (!fZipTasks)
+      fZipTasks = std::make_unique<RInlineTaskScheduler>();
+   fSink->SetTaskScheduler(fZipTasks.get());
+   fSink->Create(*fModel);
+
+   const auto &writeOpts = fSink->GetWriteOptions();
+   fMaxUnzippedClusterSize = writeOpts.GetMaxUnzippedClusterSize();
+   // First estimate is a factor 2 compression if compression is used at all
+   const int scale = writeOpts.GetCompression() ? 2 : 1;
+   fUnzippedClusterSizeEst = scale * writeOpts.GetApproxZippedClusterSize();
+}
+
+ROOT::Experimental::RNTupleFillContext::~RNTupleFillContext()
+{
+   try {
+      CommitCluster();
+   } catch (const RException &err) {
+      R__LOG_ERROR(NTupleLog()) << "failure committing cluster: " << err.GetError().GetReport();
+   }
+}
+
+void ROOT::Experimental::RNTupleFillContext::CommitCluster()
+{
+   if (fNEntries == fLastCommitted)
+      return;
+   if (fSink->GetWriteOptions().GetHasSmallClusters() &&
+       (fUnzippedClusterSize > RNTupleWriteOptions::kMaxSmallClusterSize)) {
+      throw RException(R__FAIL("invalid attempt to write a cluster > 512MiB with 'small clusters' option enabled"));
+   }
+   for (auto &field : *fModel->GetFieldZero()) {
+      field.Flush();
+      field.CommitCluster();
+   }
+   fNBytesCommitted += fSink->CommitCluster(fNEntries);
+   fNBytesFilled += fUnzippedClusterSize;
+
+   // Cap the compression factor at 1000 to prevent overflow of fUnzippedClusterSizeEst
+   const float compressionFactor =
+      std::min(1000.f, static_cast<float>(fNBytesFilled) / static_cast<float>(fNBytesCommitted));
+   fUnzippedClusterSizeEst =
+      compressionFactor * static_cast<float>(fSink->GetWriteOptions().GetApproxZippedClusterSize());
+
+   fLastCommitted = fNEntries;
+   fUnzippedClusterSize = 0;
+}
+
+//------------------------------------------------------------------------------
+
+ROOT::Experimental::RNTupleParallelWriter::RNTupleParallelWriter(std::unique_ptr<RNTupleModel> model,
+                                                                 std::unique_ptr<Detail::RPageSink> sink)
+   : fSink(std::move(sink)), fModel(std::move(model)), fMetrics("RNTupleParallelWriter")
+{
+   if (!fModel) {
+      throw RException(R__FAIL("null model"));
+   }
+   if (!fSink) {
+      throw RException(R__FAIL("null sink"));
+   }
+   if (dynamic_cast<Detail::RPageSinkBuf *>(fSink.get())) {
+      throw RException(R__FAIL("the parallel writer requires an unbuffered page sink"));
+   }
+   fModel->Freeze();
+   fSink->Create(*fModel);
+   fMetrics.ObserveMetrics(fSink->GetMetrics());
+}
+
+ROOT::Experimental::RNTupleParallelWriter::~RNTupleParallelWriter()
+{
+   for (const auto &context : fFillContexts) {
+      if (!context.expired()) {
+         R__LOG_ERROR(NTupleLog()) << "RNTupleFillContext has not been destructed before its parallel writer";
+         break;
+      }
+   }
+
+   try {
+      fSink->CommitClusterGroup();
+      fSink->CommitDataset();
+   } catch (const RException &err) {
+      R__LOG_ERROR(NTupleLog()) << "failure committing ntuple: " << err.GetError().GetReport();
+   }
+}
+
+std::unique_ptr<ROOT::Experimental::RNTupleParallelWriter>
+ROOT::Experimental::RNTupleParallelWriter::Recreate(std::unique_ptr<RNTupleModel> model, std::string_view ntupleName,
+                                                    std::string_view storage, const RNTupleWriteOptions &options)
+{
+   // Page buffering is done by the fill contexts
+   auto innerOptions = options.Clone();
+   innerOptions->SetUseBufferedWrite(false);
+   return std::make_unique<RNTupleParallelWriter>(std::move(model),
+                                                  Detail::RPageSink::Create(ntupleName, storage, *innerOptions));
+}
+
+std::shared_ptr<ROOT::Experimental::RNTupleFillContext>
+ROOT::Experimental::RNTupleParallelWriter::CreateFillContext()
+{
+   // Every fill context gets its own copy of the model with a new model id, such that entries of different fill
+   // contexts cannot be mixed up
+   auto model = fModel->Clone();
+   model->Unfreeze();
+   model->Freeze();
+
+   auto syncSink = std::make_unique<RPageSynchronizingSink>(*fSink, fMutex);
+   auto sink = std::make_unique<Detail::RPageSinkBuf>(std::move(syncSink));
+
+   // The fill context constructor registers the columns with the sink; the physical column IDs are assigned in the
+   // same order as in the shared sink because the model is an identical copy.
+   std::shared_ptr<RNTupleFillContext> context(new RNTupleFillContext(std::move(model), std::move(sink)));
+
+   std::lock_guard<std::mutex> g(fMutex);
+   // Purge expired fill contexts from the list
+   fFillContexts.erase(std::remove_if(fFillContexts.begin(), fFillContexts.end(),
+                                      [](const std::weak_ptr<RNTupleFillContext> &c) { return c.expired(); }),
+                       fFillContexts.end());
+   fFillContexts.emplace_back(context);
+   return context;
+}
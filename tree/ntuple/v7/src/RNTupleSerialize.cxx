@@ -187,7 +187,7 @@ std::uint32_t SerializeColumnListV1(const ROOT::Experimental::RNTupleDescriptor
 
          auto type = c.GetModel().GetType();
          pos += RNTupleSerializer::SerializeColumnType(type, *where);
-         pos += RNTupleSerializer::SerializeUInt16(RColumnElementBase::GetBitsOnStorage(type), *where);
+         pos += RNTupleSerializer::SerializeUInt16(RColumnElementBase::GetBitsOnStorage(c.GetModel()), *where);
          pos += RNTupleSerializer::SerializeUInt32(context.GetOnDiskFieldId(c.GetFieldId()), *where);
          std::uint32_t flags = 0;
          // TODO(jblomer): add support for descending columns in the column model
@@ -199,9 +199,22 @@ std::uint32_t SerializeColumnListV1(const ROOT::Experimental::RNTupleDescriptor
          const std::uint64_t firstElementIdx = c.GetFirstElementIndex();
          if (firstElementIdx > 0)
             flags |= RNTupleSerializer::kFlagDeferredColumn;
+         if (c.GetModel().HasValueRange())
+            flags |= RNTupleSerializer::kFlagHasValueRange;
          pos += RNTupleSerializer::SerializeUInt32(flags, *where);
          if (flags & RNTupleSerializer::kFlagDeferredColumn)
             pos += RNTupleSerializer::SerializeUInt64(firstElementIdx, *where);
+         if (flags & RNTupleSerializer::kFlagHasValueRange) {
+            // The value range is stored as the bit patterns of two IEEE-754 double precision floats
+            std::uint64_t valueMin;
+            std::uint64_t valueMax;
+            const double modelMin = c.GetModel().GetValueMin();
+            const double modelMax = c.GetModel().GetValueMax();
+            std::memcpy(&valueMin, &modelMin, sizeof(valueMin));
+            std::memcpy(&valueMax, &modelMax, sizeof(valueMax));
+            pos += RNTupleSerializer::SerializeUInt64(valueMin, *where);
+            pos += RNTupleSerializer::SerializeUInt64(valueMax, *where);
+         }
 
          pos += RNTupleSerializer::SerializeFramePostscript(buffer ? frame : nullptr, pos - frame);
       }
@@ -249,6 +262,31 @@ RResult<std::uint32_t> DeserializeColumnV1(
          return R__FAIL("column record frame too short");
       bytes += RNTupleSerializer::DeserializeUInt64(bytes, firstElementIdx);
    }
+   double valueMin = 0.0;
+   double valueMax = 0.0;
+   if (flags & RNTupleSerializer::kFlagHasValueRange) {
+      if (fnFrameSizeLeft() < 2 * sizeof(std::uint64_t))
+         return R__FAIL("column record frame too short");
+      std::uint64_t bitsMin;
+      std::uint64_t bitsMax;
+      bytes += RNTupleSerializer::DeserializeUInt64(bytes, bitsMin);
+      bytes += RNTupleSerializer::DeserializeUInt64(bytes, bitsMax);
+      std::memcpy(&valueMin, &bitsMin, sizeof(valueMin));
+      std::memcpy(&valueMax, &bitsMax, sizeof(valueMax));
+   }
+
+   if (type == EColumnType::kReal32Quant) {
+      if (!(flags & RNTupleSerializer::kFlagHasValueRange))
+         return R__FAIL("missing value range for quantized column");
+      if (bitsOnStorage < 1 || bitsOnStorage > ROOT::Experimental::Detail::RColumnElementBase::GetBitsOnStorage(type))
+         return R__FAIL("invalid element size of quantized column");
+      if (!(valueMin < valueMax))
+         return R__FAIL("invalid value range of quantized column");
+      columnDesc.FieldId(fieldId)
+         .Model({type, bitsOnStorage, valueMin, valueMax})
+         .FirstElementIndex(firstElementIdx);
+      return frameSize;
+   }
 
    if (ROOT::Experimental::Detail::RColumnElementBase::GetBitsOnStorage(type) != bitsOnStorage)
       return R__FAIL("column element size mismatch");
@@ -533,6 +571,7 @@ std::uint16_t ROOT::Experimental::Internal::RNTupleSerializer::SerializeColumnTy
    case EColumnType::kSplitUInt32: return SerializeUInt16(0x14, buffer);
    case EColumnType::kSplitInt16: return SerializeUInt16(0x1C, buffer);
    case EColumnType::kSplitUInt16: return SerializeUInt16(0x15, buffer);
+   case EColumnType::kReal32Quant: return SerializeUInt16(0x1D, buffer);
    default: throw RException(R__FAIL("ROOT bug: unexpected column type"));
    }
 }
@@ -572,6 +611,7 @@ RResult<std::uint16_t> ROOT::Experimental::Internal::RNTupleSerializer::Deserial
    case 0x14: type = EColumnType::kSplitUInt32; break;
    case 0x1C: type = EColumnType::kSplitInt16; break;
    case 0x15: type = EColumnType::kSplitUInt16; break;
+   case 0x1D: type = EColumnType::kReal32Quant; break;
    default: return R__FAIL("unexpected on-disk column type");
    }
    return result;
@@ -1283,6 +1323,17 @@ std::uint32_t ROOT::Experimental::Internal::RNTupleSerializer::SerializePageList
          }
          pos += SerializeUInt64(columnRange.fFirstElementIndex, *where);
          pos += SerializeUInt32(columnRange.fCompressionSettings, *where);
+         // Optional trailer, skipped by readers that do not know about column statistics
+         const auto &stats = columnRange.fStatistics;
+         if (stats.fIsValid) {
+            std::uint64_t bitsMin;
+            std::uint64_t bitsMax;
+            std::memcpy(&bitsMin, &stats.fMin, sizeof(bitsMin));
+            std::memcpy(&bitsMax, &stats.fMax, sizeof(bitsMax));
+            pos += SerializeUInt32(kFlagColumnRangeHasMinMax, *where);
+            pos += SerializeUInt64(bitsMin, *where);
+            pos += SerializeUInt64(bitsMax, *where);
+         }
 
          pos += SerializeFramePostscript(buffer ? innerFrame : nullptr, pos - innerFrame);
       }
@@ -1606,7 +1657,24 @@ ROOT::Experimental::RResult<void> ROOT::Experimental::Internal::RNTupleSerialize
          std::uint32_t compressionSettings;
          bytes += DeserializeUInt32(bytes, compressionSettings);
 
-         clusters[i].CommitColumnRange(j, columnOffset, compressionSettings, pageRange);
+         RClusterDescriptor::RColumnStatistics stats;
+         if (fnInnerFrameSizeLeft() >= static_cast<int>(sizeof(std::uint32_t))) {
+            std::uint32_t flags;
+            bytes += DeserializeUInt32(bytes, flags);
+            if (flags & kFlagColumnRangeHasMinMax) {
+               if (fnInnerFrameSizeLeft() < static_cast<int>(2 * sizeof(std::uint64_t)))
+                  return R__FAIL("page list frame too short");
+               std::uint64_t bitsMin;
+               std::uint64_t bitsMax;
+               bytes += DeserializeUInt64(bytes, bitsMin);
+               bytes += DeserializeUInt64(bytes, bitsMax);
+               stats.fIsValid = true;
+               std::memcpy(&stats.fMin, &bitsMin, sizeof(bitsMin));
+               std::memcpy(&stats.fMax, &bitsMax, sizeof(bitsMax));
+            }
+         }
+
+         clusters[i].CommitColumnRange(j, columnOffset, compressionSettings, pageRange, stats);
          bytes = innerFrame + innerFrameSize;
       }
 
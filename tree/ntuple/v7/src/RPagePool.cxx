@@ -18,22 +18,188 @@
 
 #include <TError.h>
 
+#include <algorithm>
+#include <atomic>
 #include <cstdlib>
+#include <map>
+#include <set>
+#include <utility>
 
-void ROOT::Experimental::Detail::RPagePool::RegisterPage(const RPage &page, const RPageDeleter &deleter)
+namespace {
+
+using ROOT::Experimental::Detail::RPagePool;
+
+/// Process-wide bookkeeping of all the page pools, used to enforce the shared memory budget
+struct RPagePoolRegistry {
+   /// Protects fPools. Taken before the lock of any individual page pool, never the other way round.
+   std::mutex fLock;
+   std::set<RPagePool *> fPools;
+   std::atomic<std::size_t> fMemoryUsage{0};
+   std::atomic<std::size_t> fMemoryBudget{0};
+   /// Ever-increasing counter that provides the order of page accesses across all the pools
+   std::atomic<std::uint64_t> fClock{0};
+};
+
+RPagePoolRegistry &GetRegistry()
+{
+   static RPagePoolRegistry registry;
+   return registry;
+}
+
+std::size_t GetPageMemory(const ROOT::Experimental::Detail::RPage &page)
+{
+   if (page.IsPageZero())
+      return 0;
+   return std::size_t(page.GetMaxElements()) * page.GetElementSize();
+}
+
+} // anonymous namespace
+
+ROOT::Experimental::Detail::RPagePool::RPagePool()
+{
+   auto &registry = GetRegistry();
+   std::lock_guard<std::mutex> lockGuard(registry.fLock);
+   registry.fPools.insert(this);
+}
+
+ROOT::Experimental::Detail::RPagePool::~RPagePool()
+{
+   auto &registry = GetRegistry();
+   {
+      std::lock_guard<std::mutex> lockGuard(registry.fLock);
+      registry.fPools.erase(this);
+   }
+   EvictUnusedPages(registry.fClock.load());
+   // Pages still in use are not owned by the pool anymore
+   registry.fMemoryUsage -= fMemoryUsage;
+}
+
+void ROOT::Experimental::Detail::RPagePool::SetMemoryBudget(std::size_t nbytes)
+{
+   GetRegistry().fMemoryBudget = nbytes;
+   EnforceMemoryBudget();
+}
+
+std::size_t ROOT::Experimental::Detail::RPagePool::GetMemoryBudget()
+{
+   return GetRegistry().fMemoryBudget.load();
+}
+
+std::size_t ROOT::Experimental::Detail::RPagePool::GetGlobalMemoryUsage()
+{
+   return GetRegistry().fMemoryUsage.load();
+}
+
+std::size_t ROOT::Experimental::Detail::RPagePool::GetMemoryUsage() const
 {
    std::lock_guard<std::mutex> lockGuard(fLock);
-   fPages.emplace_back(page);
-   fReferences.emplace_back(1);
-   fDeleters.emplace_back(deleter);
+   return fMemoryUsage;
 }
 
-void ROOT::Experimental::Detail::RPagePool::PreloadPage(const RPage &page, const RPageDeleter &deleter)
+void ROOT::Experimental::Detail::RPagePool::ErasePage(unsigned int i)
 {
+   const auto nbytes = GetPageMemory(fPages[i]);
+   fMemoryUsage -= nbytes;
+   GetRegistry().fMemoryUsage -= nbytes;
+
+   unsigned int N = fPages.size();
+   fPages[i] = fPages[N - 1];
+   fReferences[i] = fReferences[N - 1];
+   fDeleters[i] = fDeleters[N - 1];
+   fLastUse[i] = fLastUse[N - 1];
+   fPages.resize(N - 1);
+   fReferences.resize(N - 1);
+   fDeleters.resize(N - 1);
+   fLastUse.resize(N - 1);
+}
+
+std::size_t ROOT::Experimental::Detail::RPagePool::EvictUnusedPages(std::uint64_t lastUse)
+{
+   std::size_t nbytesFreed = 0;
    std::lock_guard<std::mutex> lockGuard(fLock);
-   fPages.emplace_back(page);
-   fReferences.emplace_back(0);
-   fDeleters.emplace_back(deleter);
+   for (unsigned int i = 0; i < fPages.size();) {
+      if ((fReferences[i] != 0) || (fLastUse[i] > lastUse)) {
+         ++i;
+         continue;
+      }
+      nbytesFreed += GetPageMemory(fPages[i]);
+      fDeleters[i](fPages[i]);
+      ErasePage(i);
+   }
+   return nbytesFreed;
+}
+
+void ROOT::Experimental::Detail::RPagePool::EnforceMemoryBudget()
+{
+   auto &registry = GetRegistry();
+   const auto budget = registry.fMemoryBudget.load();
+   if ((budget == 0) || (registry.fMemoryUsage.load() <= budget))
+      return;
+
+   std::lock_guard<std::mutex> lockGuard(registry.fLock);
+   const auto usage = registry.fMemoryUsage.load();
+   if (usage <= budget)
+      return;
+
+   // Collect the unused pages of all the pools and determine, per pool, the most recent use that gets evicted
+   // such that the least-recently-used pages across all pools are freed first
+   struct RCandidate {
+      std::uint64_t fLastUse;
+      std::size_t fNBytes;
+      RPagePool *fPool;
+   };
+   std::vector<RCandidate> candidates;
+   for (auto pool : registry.fPools) {
+      std::lock_guard<std::mutex> lockGuardPool(pool->fLock);
+      for (unsigned int i = 0; i < pool->fPages.size(); ++i) {
+         if (pool->fReferences[i] == 0)
+            candidates.push_back({pool->fLastUse[i], GetPageMemory(pool->fPages[i]), pool});
+      }
+   }
+   std::sort(candidates.begin(), candidates.end(),
+             [](const RCandidate &a, const RCandidate &b) { return a.fLastUse < b.fLastUse; });
+
+   std::map<RPagePool *, std::uint64_t> evictUntil;
+   std::size_t nbytesToFree = usage - budget;
+   for (const auto &c : candidates) {
+      evictUntil[c.fPool] = c.fLastUse;
+      if (c.fNBytes >= nbytesToFree)
+         break;
+      nbytesToFree -= c.fNBytes;
+   }
+
+   for (const auto &kv : evictUntil)
+      kv.first->EvictUnusedPages(kv.second);
+}
+
+void ROOT::Experimental::Detail::RPagePool::RegisterPage(const RPage &page, const RPageDeleter &deleter)
+{
+   auto &registry = GetRegistry();
+   {
+      std::lock_guard<std::mutex> lockGuard(fLock);
+      fPages.emplace_back(page);
+      fReferences.emplace_back(1);
+      fDeleters.emplace_back(deleter);
+      fLastUse.emplace_back(++registry.fClock);
+      fMemoryUsage += GetPageMemory(page);
+      registry.fMemoryUsage += GetPageMemory(page);
+   }
+   EnforceMemoryBudget();
+}
+
+void ROOT::Experimental::Detail::RPagePool::PreloadPage(const RPage &page, const RPageDeleter &deleter)
+{
+   auto &registry = GetRegistry();
+   {
+      std::lock_guard<std::mutex> lockGuard(fLock);
+      fPages.emplace_back(page);
+      fReferences.emplace_back(0);
+      fDeleters.emplace_back(deleter);
+      fLastUse.emplace_back(++registry.fClock);
+      fMemoryUsage += GetPageMemory(page);
+      registry.fMemoryUsage += GetPageMemory(page);
+   }
+   EnforceMemoryBudget();
 }
 
 void ROOT::Experimental::Detail::RPagePool::ReturnPage(const RPage& page)
@@ -47,12 +213,7 @@ void ROOT::Experimental::Detail::RPagePool::ReturnPage(const RPage& page)
 
       if (--fReferences[i] == 0) {
          fDeleters[i](fPages[i]);
-         fPages[i] = fPages[N-1];
-         fReferences[i] = fReferences[N-1];
-         fDeleters[i] = fDeleters[N-1];
-         fPages.resize(N-1);
-         fReferences.resize(N-1);
-         fDeleters.resize(N-1);
+         ErasePage(i);
       }
       return;
    }
@@ -69,6 +230,7 @@ ROOT::Experimental::Detail::RPage ROOT::Experimental::Detail::RPagePool::GetPage
       if (fPages[i].GetColumnId() != columnId) continue;
       if (!fPages[i].Contains(globalIndex)) continue;
       fReferences[i]++;
+      fLastUse[i] = ++GetRegistry().fClock;
       return fPages[i];
    }
    return RPage();
@@ -84,6 +246,7 @@ ROOT::Experimental::Detail::RPage ROOT::Experimental::Detail::RPagePool::GetPage
       if (fPages[i].GetColumnId() != columnId) continue;
       if (!fPages[i].Contains(clusterIndex)) continue;
       fReferences[i]++;
+      fLastUse[i] = ++GetRegistry().fClock;
       return fPages[i];
    }
    return RPage();
@@ -19,13 +19,17 @@
 #include <ROOT/RNTupleModel.hxx>
 #include <ROOT/RNTupleZip.hxx>
 #include <ROOT/RPageSinkBuf.hxx>
+#include <ROOT/RTaskTracer.hxx>
 
 #include <algorithm>
+#include <cstring>
 
 void ROOT::Experimental::Detail::RPageSinkBuf::RColumnBuf::DropBufferedPages()
 {
    for (auto &bufPage : fBufferedPages) {
-      fCol.fColumn->GetPageSink()->ReleasePage(bufPage.fPage);
+      // The uncompressed page may have been released already after sealing
+      if (!bufPage.fPage.IsNull())
+         fCol.fColumn->GetPageSink()->ReleasePage(bufPage.fPage);
    }
    fBufferedPages.clear();
    // Each RSealedPage points to the same region as `fBuf` for some element in `fBufferedPages`; thus, no further
@@ -40,9 +44,13 @@ ROOT::Experimental::Detail::RPageSinkBuf::RPageSinkBuf(std::unique_ptr<RPageSink
 {
    fCounters = std::unique_ptr<RCounters>(new RCounters{
       *fMetrics.MakeCounter<RNTuplePlainCounter*>("ParallelZip", "",
-         "compressing pages in parallel")
+         "compressing pages in parallel"),
+      *fMetrics.MakeCounter<RNTuplePlainCounter*>("nZipQueueFull", "",
+         "number of times filling waited for queued page compression tasks")
    });
    fMetrics.ObserveMetrics(fInnerSink->GetMetrics());
+   // Statistics are computed when the pages are sealed or, for unsealed pages, by the inner sink
+   fCollectColumnStatistics = false;
 }
 
 ROOT::Experimental::Detail::RPageSinkBuf::~RPageSinkBuf()
@@ -117,15 +125,39 @@ ROOT::Experimental::Detail::RPageSinkBuf::CommitPageImpl(ColumnHandle_t columnHa
       return RNTupleLocator{};
    }
    fCounters->fParallelZip.SetValue(1);
+   // Bound the number of uncompressed pages in flight. Waiting for all the tasks (rather than for a free slot) lets
+   // the filling thread work on the queued tasks, which is deadlock-free even with a single worker thread.
+   const auto maxUnsealedPages = GetWriteOptions().GetMaxUnsealedPages();
+   if (maxUnsealedPages > 0 && fNUnsealedPages >= maxUnsealedPages) {
+      fCounters->fNZipQueueFull.Inc();
+      WaitForAllTasks();
+   }
    // Thread safety: Each thread works on a distinct zipItem which owns its
    // compression buffer.
    zipItem.AllocateSealedPageBuf();
    R__ASSERT(zipItem.fBuf);
    auto &sealedPage = fBufferedColumns.at(columnHandle.fPhysicalId).RegisterSealedPage();
+   fNUnsealedPages++;
    fTaskScheduler->AddTask([this, &zipItem, &sealedPage, colId = columnHandle.fPhysicalId] {
-      sealedPage = SealPage(zipItem.fPage, *fBufferedColumns.at(colId).GetHandle().fColumn->GetElement(),
-                            GetWriteOptions().GetCompression(), zipItem.fBuf.get());
+      RTaskTracer::RScope traceScope("RNTuple", "ZipPage", zipItem.fPage.GetNBytes());
+      const auto &element = *fBufferedColumns.at(colId).GetHandle().fColumn->GetElement();
+      sealedPage = SealPage(zipItem.fPage, element, GetWriteOptions().GetCompression(), zipItem.fBuf.get());
+      if (GetWriteOptions().GetHasColumnStatistics())
+         sealedPage.fStatistics = ComputeStatistics(zipItem.fPage, element);
+      // Unless the sealed page is the uncompressed page itself, keep only the sealed bytes in memory until the
+      // cluster is committed. The page allocators release pages with a plain delete, which is thread-safe.
+      if (sealedPage.fBuffer == zipItem.fBuf.get()) {
+         if (sealedPage.fSize < zipItem.fPage.GetNBytes()) {
+            auto shrunkBuf = std::unique_ptr<unsigned char[]>(new unsigned char[sealedPage.fSize]);
+            memcpy(shrunkBuf.get(), zipItem.fBuf.get(), sealedPage.fSize);
+            std::swap(zipItem.fBuf, shrunkBuf);
+            sealedPage.fBuffer = zipItem.fBuf.get();
+         }
+         ReleasePage(zipItem.fPage);
+         zipItem.fPage = RPage();
+      }
       zipItem.fSealedPage = &sealedPage;
+      fNUnsealedPages--;
    });
 
    // we're feeding bad locators to fOpenPageRanges but it should not matter
@@ -147,6 +179,11 @@ std::uint64_t
 ROOT::Experimental::Detail::RPageSinkBuf::CommitClusterImpl(ROOT::Experimental::NTupleSize_t nEntries)
 {
    WaitForAllTasks();
+   R__ASSERT(fNUnsealedPages == 0);
+
+   // If the inner sink is shared with other writers, the pages of this cluster and the cluster itself need to be
+   // committed in one go
+   auto sinkGuard = fInnerSink->GetSinkGuard();
 
    // If we have only sealed pages in all buffered columns, commit them in a single `CommitSealedPageV()` call
    bool singleCommitCall = std::all_of(fBufferedColumns.begin(), fBufferedColumns.end(),
@@ -182,7 +219,8 @@ ROOT::Experimental::Detail::RPageSinkBuf::CommitClusterImpl(ROOT::Experimental::
          } else {
             fInnerSink->CommitPage(bufColumn.GetHandle(), bufPage.fPage);
          }
-         ReleasePage(bufPage.fPage);
+         if (!bufPage.fPage.IsNull())
+            ReleasePage(bufPage.fPage);
       }
    }
    return fInnerSink->CommitCluster(nEntries);
@@ -72,6 +72,8 @@ ROOT::Experimental::RNTupleDescriptor ROOT::Experimental::Detail::RPageSourceFri
 
    for (std::size_t i = 0; i < fSources.size(); ++i) {
       fSources[i]->Attach();
+      // The cluster ranges of the friends are combined eagerly
+      fSources[i]->EnsureAllClusterDetails();
 
       if (fSources[i]->GetNEntries() != fSources[0]->GetNEntries()) {
          fNextId = 1;
@@ -99,10 +101,9 @@ ROOT::Experimental::RNTupleDescriptor ROOT::Experimental::Detail::RPageSourceFri
             auto pageRange = c.GetPageRange(originColumnId).Clone();
             pageRange.fPhysicalColumnId = virtualColumnId;
 
-            auto firstElementIndex = c.GetColumnRange(originColumnId).fFirstElementIndex;
-            auto compressionSettings = c.GetColumnRange(originColumnId).fCompressionSettings;
-
-            clusterBuilder.CommitColumnRange(virtualColumnId, firstElementIndex, compressionSettings, pageRange);
+            const auto &columnRange = c.GetColumnRange(originColumnId);
+            clusterBuilder.CommitColumnRange(virtualColumnId, columnRange.fFirstElementIndex,
+                                             columnRange.fCompressionSettings, pageRange, columnRange.fStatistics);
          }
          fBuilder.AddClusterWithDetails(clusterBuilder.MoveDescriptor().Unwrap());
          fIdBiMap.Insert({i, c.GetId()}, fNextId);
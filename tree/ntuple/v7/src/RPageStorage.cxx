@@ -23,6 +23,7 @@
 #include <ROOT/RPagePool.hxx>
 #include <ROOT/RPageSinkBuf.hxx>
 #include <ROOT/RPageStorageFile.hxx>
+#include <ROOT/RPageStorageShards.hxx>
 #include <ROOT/RStringView.hxx>
 #ifdef R__ENABLE_DAOS
 # include <ROOT/RPageStorageDaos.hxx>
@@ -31,6 +32,8 @@
 #include <Compression.h>
 #include <TError.h>
 
+#include <algorithm>
+#include <string>
 #include <utility>
 
 
@@ -119,6 +122,27 @@ void ROOT::Experimental::Detail::RPageSource::DropColumn(ColumnHandle_t columnHa
    fActivePhysicalColumns.Erase(columnHandle.fPhysicalId);
 }
 
+bool ROOT::Experimental::Detail::RPageSource::REntryRange::IntersectsWith(const RClusterDescriptor &clusterDesc) const
+{
+   if (fFirstEntry == kInvalidNTupleIndex)
+      return true;
+   if (clusterDesc.GetNEntries() == 0)
+      return false;
+   if ((clusterDesc.GetFirstEntryIndex() + clusterDesc.GetNEntries()) <= fFirstEntry)
+      return false;
+   if (clusterDesc.GetFirstEntryIndex() >= (fFirstEntry + fNEntries))
+      return false;
+   return true;
+}
+
+void ROOT::Experimental::Detail::RPageSource::SetEntryRange(const REntryRange &range)
+{
+   if ((range.fFirstEntry != kInvalidNTupleIndex) && ((range.fFirstEntry + range.fNEntries) > GetNEntries())) {
+      throw RException(R__FAIL("invalid entry range"));
+   }
+   fEntryRange = range;
+}
+
 ROOT::Experimental::NTupleSize_t ROOT::Experimental::Detail::RPageSource::GetNEntries()
 {
    return GetSharedDescriptorGuard()->GetNEntries();
@@ -129,6 +153,124 @@ ROOT::Experimental::NTupleSize_t ROOT::Experimental::Detail::RPageSource::GetNEl
    return GetSharedDescriptorGuard()->GetNElements(columnHandle.fPhysicalId);
 }
 
+std::vector<ROOT::Experimental::RClusterDescriptor>
+ROOT::Experimental::Detail::RPageSource::LoadClusterGroupImpl(DescriptorId_t /* clusterGroupId */)
+{
+   throw RException(R__FAIL("this page source cannot load cluster groups on demand"));
+}
+
+void ROOT::Experimental::Detail::RPageSource::EnsureClusterGroupDetails(DescriptorId_t clusterGroupId)
+{
+   std::lock_guard<std::mutex> lockGuard(fClusterGroupLoadMutex);
+   {
+      auto descriptorGuard = GetSharedDescriptorGuard();
+      const auto &clusterIds = descriptorGuard->GetClusterGroupDescriptor(clusterGroupId).GetClusterIds();
+      // Cluster groups are always loaded as a whole
+      if (clusterIds.empty() || descriptorGuard->GetClusterDescriptor(clusterIds[0]).HasPageLocations())
+         return;
+   }
+
+   auto clusters = LoadClusterGroupImpl(clusterGroupId);
+   auto descriptorGuard = GetExclDescriptorGuard();
+   for (auto &c : clusters)
+      descriptorGuard->AddClusterDetails(std::move(c)).ThrowOnError();
+}
+
+void ROOT::Experimental::Detail::RPageSource::EnsureClusterDetails(DescriptorId_t clusterId)
+{
+   if (!fOptions.GetLoadClusterGroupsOnDemand())
+      return;
+
+   DescriptorId_t clusterGroupId = kInvalidDescriptorId;
+   {
+      auto descriptorGuard = GetSharedDescriptorGuard();
+      if (descriptorGuard->GetClusterDescriptor(clusterId).HasPageLocations())
+         return;
+      for (const auto &cgDesc : descriptorGuard->GetClusterGroupIterable()) {
+         const auto &clusterIds = cgDesc.GetClusterIds();
+         if (std::find(clusterIds.begin(), clusterIds.end(), clusterId) != clusterIds.end()) {
+            clusterGroupId = cgDesc.GetId();
+            break;
+         }
+      }
+   }
+   if (clusterGroupId == kInvalidDescriptorId)
+      throw RException(R__FAIL("cluster " + std::to_string(clusterId) + " is not part of any cluster group"));
+   EnsureClusterGroupDetails(clusterGroupId);
+}
+
+void ROOT::Experimental::Detail::RPageSource::EnsureAllClusterDetails()
+{
+   if (!fOptions.GetLoadClusterGroupsOnDemand())
+      return;
+
+   std::vector<DescriptorId_t> clusterGroupIds;
+   {
+      auto descriptorGuard = GetSharedDescriptorGuard();
+      for (const auto &cgDesc : descriptorGuard->GetClusterGroupIterable())
+         clusterGroupIds.emplace_back(cgDesc.GetId());
+   }
+   for (auto id : clusterGroupIds)
+      EnsureClusterGroupDetails(id);
+}
+
+void ROOT::Experimental::Detail::RPageSource::EnsureClusterDetailsOfElement(DescriptorId_t physicalColumnId,
+                                                                            NTupleSize_t index)
+{
+   if (!fOptions.GetLoadClusterGroupsOnDemand())
+      return;
+
+   // The non-empty cluster groups, ordered by their first entry
+   std::vector<DescriptorId_t> clusterGroupIds;
+   {
+      auto descriptorGuard = GetSharedDescriptorGuard();
+      if (descriptorGuard->FindClusterId(physicalColumnId, index) != kInvalidDescriptorId)
+         return;
+
+      std::vector<std::pair<NTupleSize_t, DescriptorId_t>> firstEntries;
+      for (const auto &cgDesc : descriptorGuard->GetClusterGroupIterable()) {
+         NTupleSize_t firstEntry = kInvalidNTupleIndex;
+         for (auto clusterId : cgDesc.GetClusterIds())
+            firstEntry = std::min(firstEntry, descriptorGuard->GetClusterDescriptor(clusterId).GetFirstEntryIndex());
+         if (firstEntry != kInvalidNTupleIndex)
+            firstEntries.emplace_back(firstEntry, cgDesc.GetId());
+      }
+      std::sort(firstEntries.begin(), firstEntries.end());
+      for (const auto &[_, id] : firstEntries)
+         clusterGroupIds.emplace_back(id);
+   }
+
+   // The element indexes of a column increase with the entry numbers, so that the element ranges of the column in
+   // the cluster groups are ordered like the cluster groups themselves
+   std::size_t lo = 0;
+   std::size_t hi = clusterGroupIds.size();
+   while (lo < hi) {
+      const auto mid = lo + (hi - lo) / 2;
+      EnsureClusterGroupDetails(clusterGroupIds[mid]);
+
+      NTupleSize_t firstElement = kInvalidNTupleIndex;
+      NTupleSize_t endElement = 0;
+      {
+         auto descriptorGuard = GetSharedDescriptorGuard();
+         for (auto clusterId : descriptorGuard->GetClusterGroupDescriptor(clusterGroupIds[mid]).GetClusterIds()) {
+            const auto &clusterDesc = descriptorGuard->GetClusterDescriptor(clusterId);
+            if (!clusterDesc.ContainsColumn(physicalColumnId))
+               continue;
+            const auto &columnRange = clusterDesc.GetColumnRange(physicalColumnId);
+            firstElement = std::min(firstElement, columnRange.fFirstElementIndex);
+            endElement = std::max(endElement, columnRange.fFirstElementIndex + columnRange.fNElements);
+         }
+      }
+      if (firstElement == kInvalidNTupleIndex || index >= endElement) {
+         lo = mid + 1;
+      } else if (index < firstElement) {
+         hi = mid;
+      } else {
+         return;
+      }
+   }
+}
+
 ROOT::Experimental::ColumnId_t ROOT::Experimental::Detail::RPageSource::GetColumnId(ColumnHandle_t columnHandle)
 {
    // TODO(jblomer) distinguish trees
@@ -272,7 +414,8 @@ void ROOT::Experimental::Detail::RPageSource::EnableDefaultMetrics(const std::st
 
 
 ROOT::Experimental::Detail::RPageSink::RPageSink(std::string_view name, const RNTupleWriteOptions &options)
-   : RPageStorage(name), fMetrics(""), fOptions(options.Clone())
+   : RPageStorage(name), fMetrics(""), fOptions(options.Clone()),
+     fCollectColumnStatistics(options.GetHasColumnStatistics())
 {
 }
 
@@ -289,13 +432,18 @@ std::unique_ptr<ROOT::Experimental::Detail::RPageSink> ROOT::Experimental::Detai
    if (location.empty()) {
       throw RException(R__FAIL("empty storage location"));
    }
+   const bool isSharded = (options.GetMaxShardSize() > 0) || (options.GetNShards() > 1);
    std::unique_ptr<ROOT::Experimental::Detail::RPageSink> realSink;
    if (location.find("daos://") == 0) {
+      if (isSharded)
+         throw RException(R__FAIL("sharded output is only supported for files"));
 #ifdef R__ENABLE_DAOS
       realSink = std::make_unique<RPageSinkDaos>(ntupleName, location, options);
 #else
       throw RException(R__FAIL("This RNTuple build does not support DAOS."));
 #endif
+   } else if (isSharded) {
+      realSink = std::make_unique<RPageSinkShards>(ntupleName, location, options);
    } else {
       realSink = std::make_unique<RPageSinkFile>(ntupleName, location, options);
    }
@@ -360,6 +508,8 @@ void ROOT::Experimental::Detail::RPageSink::UpdateSchema(const RNTupleModelChang
       columnRange.fFirstElementIndex = descriptor.GetColumnDescriptor(i).GetFirstElementIndex();
       columnRange.fNElements = 0;
       columnRange.fCompressionSettings = GetWriteOptions().GetCompression();
+      if (GetWriteOptions().GetHasColumnStatistics())
+         columnRange.fStatistics = RClusterDescriptor::RColumnStatistics::MakeEmpty();
       fOpenColumnRanges.emplace_back(columnRange);
       RClusterDescriptor::RPageRange pageRange;
       pageRange.fPhysicalColumnId = i;
@@ -399,7 +549,10 @@ void ROOT::Experimental::Detail::RPageSink::Create(RNTupleModel &model)
 
 void ROOT::Experimental::Detail::RPageSink::CommitPage(ColumnHandle_t columnHandle, const RPage &page)
 {
-   fOpenColumnRanges.at(columnHandle.fPhysicalId).fNElements += page.GetNElements();
+   auto &columnRange = fOpenColumnRanges.at(columnHandle.fPhysicalId);
+   columnRange.fNElements += page.GetNElements();
+   if (fCollectColumnStatistics)
+      columnRange.fStatistics.Merge(ComputeStatistics(page, *columnHandle.fColumn->GetElement()));
 
    RClusterDescriptor::RPageRange::RPageInfo pageInfo;
    pageInfo.fNElements = page.GetNElements();
@@ -411,7 +564,9 @@ void ROOT::Experimental::Detail::RPageSink::CommitSealedPage(
    ROOT::Experimental::DescriptorId_t physicalColumnId,
    const ROOT::Experimental::Detail::RPageStorage::RSealedPage &sealedPage)
 {
-   fOpenColumnRanges.at(physicalColumnId).fNElements += sealedPage.fNElements;
+   auto &columnRange = fOpenColumnRanges.at(physicalColumnId);
+   columnRange.fNElements += sealedPage.fNElements;
+   columnRange.fStatistics.Merge(sealedPage.fStatistics);
 
    RClusterDescriptor::RPageRange::RPageInfo pageInfo;
    pageInfo.fNElements = sealedPage.fNElements;
@@ -437,7 +592,9 @@ void ROOT::Experimental::Detail::RPageSink::CommitSealedPageV(std::span<RPageSto
 
    for (auto &range : ranges) {
       for (auto sealedPageIt = range.fFirst; sealedPageIt != range.fLast; ++sealedPageIt) {
-         fOpenColumnRanges.at(range.fPhysicalColumnId).fNElements += sealedPageIt->fNElements;
+         auto &columnRange = fOpenColumnRanges.at(range.fPhysicalColumnId);
+         columnRange.fNElements += sealedPageIt->fNElements;
+         columnRange.fStatistics.Merge(sealedPageIt->fStatistics);
 
          RClusterDescriptor::RPageRange::RPageInfo pageInfo;
          pageInfo.fNElements = sealedPageIt->fNElements;
@@ -460,9 +617,14 @@ std::uint64_t ROOT::Experimental::Detail::RPageSink::CommitCluster(ROOT::Experim
       fullRange.fPhysicalColumnId = i;
       std::swap(fullRange, fOpenPageRanges[i]);
       clusterBuilder.CommitColumnRange(i, fOpenColumnRanges[i].fFirstElementIndex,
-                                       fOpenColumnRanges[i].fCompressionSettings, fullRange);
+                                       fOpenColumnRanges[i].fCompressionSettings, fullRange,
+                                       fOpenColumnRanges[i].fStatistics);
       fOpenColumnRanges[i].fFirstElementIndex += fOpenColumnRanges[i].fNElements;
       fOpenColumnRanges[i].fNElements = 0;
+      if (GetWriteOptions().GetHasColumnStatistics())
+         fOpenColumnRanges[i].fStatistics = RClusterDescriptor::RColumnStatistics::MakeEmpty();
+      else
+         fOpenColumnRanges[i].fStatistics = RClusterDescriptor::RColumnStatistics();
    }
    fDescriptorBuilder.AddClusterWithDetails(clusterBuilder.MoveDescriptor().Unwrap());
    fPrevClusterNEntries = nEntries;
@@ -538,6 +700,16 @@ ROOT::Experimental::Detail::RPageSink::SealPage(const RPage &page,
    return RSealedPage{pageBuf, static_cast<std::uint32_t>(zippedBytes), page.GetNElements()};
 }
 
+ROOT::Experimental::RClusterDescriptor::RColumnStatistics
+ROOT::Experimental::Detail::RPageSink::ComputeStatistics(const RPage &page, const RColumnElementBase &element)
+{
+   RClusterDescriptor::RColumnStatistics stats;
+   stats.fIsValid = element.GetValueRange(page.GetBuffer(), page.GetNElements(), stats.fMin, stats.fMax);
+   if (!stats.fIsValid)
+      return RClusterDescriptor::RColumnStatistics();
+   return stats;
+}
+
 ROOT::Experimental::Detail::RPageStorage::RSealedPage
 ROOT::Experimental::Detail::RPageSink::SealPage(
    const RPage &page, const RColumnElementBase &element, int compressionSetting)
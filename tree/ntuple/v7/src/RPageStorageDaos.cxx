@@ -27,6 +27,7 @@
 #include <ROOT/RPagePool.hxx>
 #include <ROOT/RDaos.hxx>
 #include <ROOT/RPageStorageDaos.hxx>
+#include <ROOT/RTaskTracer.hxx>
 
 #include <RVersion.h>
 #include <TError.h>
@@ -34,6 +35,7 @@
 #include <algorithm>
 #include <cstdio>
 #include <cstdlib>
+#include <functional>
 #include <limits>
 #include <utility>
 #include <regex>
@@ -85,6 +87,21 @@ RDaosKey GetPageDaosKey(ROOT::Experimental::Detail::ntuple_index_t ntplId, long
    }
 }
 
+/// \brief Returns the stripe, i.e. the index of the container, that holds the pages of the given column and cluster.
+/// Consecutive clusters of a column as well as the columns of a cluster are spread round-robin across the stripes,
+/// so that both reading a bunch of clusters and reading many columns of a single cluster involve all containers.
+std::size_t GetPageStripe(ROOT::Experimental::DescriptorId_t clusterId,
+                          ROOT::Experimental::DescriptorId_t physicalColumnId, std::size_t nStripes)
+{
+   return (clusterId + physicalColumnId) % nStripes;
+}
+
+/// \brief Returns the label of the container that holds the given stripe; stripe 0 is the container of the URI.
+std::string GetStripeContainerLabel(const std::string &containerLabel, std::size_t stripe)
+{
+   return (stripe == 0) ? containerLabel : containerLabel + "-" + std::to_string(stripe);
+}
+
 struct RDaosURI {
    /// \brief Label of the DAOS pool
    std::string fPoolLabel;
@@ -135,8 +152,9 @@ std::uint32_t ROOT::Experimental::Detail::RDaosNTupleAnchor::Serialize(void *buf
       bytes += RNTupleSerializer::SerializeUInt32(fNBytesFooter, bytes);
       bytes += RNTupleSerializer::SerializeUInt32(fLenFooter, bytes);
       bytes += RNTupleSerializer::SerializeString(fObjClass, bytes);
+      bytes += RNTupleSerializer::SerializeUInt32(fNStripes, bytes);
    }
-   return RNTupleSerializer::SerializeString(fObjClass, nullptr) + 20;
+   return RNTupleSerializer::SerializeString(fObjClass, nullptr) + 24;
 }
 
 ROOT::Experimental::RResult<std::uint32_t>
@@ -155,7 +173,15 @@ ROOT::Experimental::Detail::RDaosNTupleAnchor::Deserialize(const void *buffer, s
    auto result = RNTupleSerializer::DeserializeString(bytes, bufSize - 20, fObjClass);
    if (!result)
       return R__FORWARD_ERROR(result);
-   return result.Unwrap() + 20;
+   const auto szObjClass = result.Unwrap();
+   bytes += szObjClass;
+   fNStripes = 1;
+   if (fVersion < 1)
+      return szObjClass + 20;
+   if (bufSize < szObjClass + 24)
+      return R__FAIL("DAOS anchor too short");
+   RNTupleSerializer::DeserializeUInt32(bytes, fNStripes);
+   return szObjClass + 24;
 }
 
 std::uint32_t ROOT::Experimental::Detail::RDaosNTupleAnchor::GetSize()
@@ -256,6 +282,13 @@ void ROOT::Experimental::Detail::RPageSinkDaos::CreateImpl(const RNTupleModel &
    fDaosContainer = std::make_unique<RDaosContainer>(pool, args.fContainerLabel, /*create =*/true);
    fDaosContainer->SetDefaultObjectClass(oclass);
 
+   fNTupleAnchor.fNStripes = opts ? opts->GetNStripes() : RNTupleWriteOptionsDaos().GetNStripes();
+   for (std::size_t i = 1; i < fNTupleAnchor.fNStripes; ++i) {
+      fStripeContainers.emplace_back(std::make_unique<RDaosContainer>(
+         pool, GetStripeContainerLabel(args.fContainerLabel, i), /*create =*/true));
+      fStripeContainers.back()->SetDefaultObjectClass(oclass);
+   }
+
    RNTupleDecompressor decompressor;
    auto [locator, _] = RDaosContainerNTupleLocator::LocateNTuple(*fDaosContainer, fNTupleName, decompressor);
    fNTupleIndex = locator.GetIndex();
@@ -290,7 +323,8 @@ ROOT::Experimental::Detail::RPageSinkDaos::CommitSealedPageImpl(DescriptorId_t p
    {
       RNTupleAtomicTimer timer(fCounters->fTimeWallWrite, fCounters->fTimeCpuWrite);
       RDaosKey daosKey = GetPageDaosKey<kDefaultDaosMapping>(fNTupleIndex, clusterId, physicalColumnId, offsetData);
-      fDaosContainer->WriteSingleAkey(sealedPage.fBuffer, sealedPage.fSize, daosKey.fOid, daosKey.fDkey, daosKey.fAkey);
+      GetStripeContainer(GetPageStripe(clusterId, physicalColumnId, fNTupleAnchor.fNStripes))
+         .WriteSingleAkey(sealedPage.fBuffer, sealedPage.fSize, daosKey.fOid, daosKey.fDkey, daosKey.fAkey);
    }
 
    RNTupleLocator result;
@@ -306,7 +340,8 @@ ROOT::Experimental::Detail::RPageSinkDaos::CommitSealedPageImpl(DescriptorId_t p
 std::vector<ROOT::Experimental::RNTupleLocator>
 ROOT::Experimental::Detail::RPageSinkDaos::CommitSealedPageVImpl(std::span<RPageStorage::RSealedPageGroup> ranges)
 {
-   RDaosContainer::MultiObjectRWOperation_t writeRequests;
+   // One batch of write requests per stripe
+   std::vector<RDaosContainer::MultiObjectRWOperation_t> writeRequests(fNTupleAnchor.fNStripes);
    std::vector<ROOT::Experimental::RNTupleLocator> locators;
    int64_t nPages =
       std::accumulate(ranges.begin(), ranges.end(), 0, [](int64_t c, const RPageStorage::RSealedPageGroup &r) {
@@ -346,7 +381,9 @@ ROOT::Experimental::Detail::RPageSinkDaos::CommitSealedPageVImpl(std::span<RPage
          RDaosKey daosKey =
             GetPageDaosKey<kDefaultDaosMapping>(fNTupleIndex, clusterId, range.fPhysicalColumnId, positionIndex);
          auto odPair = RDaosContainer::ROidDkeyPair{daosKey.fOid, daosKey.fDkey};
-         auto [it, ret] = writeRequests.emplace(odPair, RDaosContainer::RWOperation(odPair));
+         auto &stripeRequests =
+            writeRequests[GetPageStripe(clusterId, range.fPhysicalColumnId, fNTupleAnchor.fNStripes)];
+         auto [it, ret] = stripeRequests.emplace(odPair, RDaosContainer::RWOperation(odPair));
          it->second.Insert(daosKey.fAkey, pageIov);
 
          RNTupleLocator locator;
@@ -364,7 +401,12 @@ ROOT::Experimental::Detail::RPageSinkDaos::CommitSealedPageVImpl(std::span<RPage
 
    {
       RNTupleAtomicTimer timer(fCounters->fTimeWallWrite, fCounters->fTimeCpuWrite);
-      if (int err = fDaosContainer->WriteV(writeRequests))
+      std::vector<RDaosContainer::RContainerRWOperation> ops;
+      for (std::size_t i = 0; i < writeRequests.size(); ++i) {
+         auto &container = GetStripeContainer(i);
+         ops.push_back({&container, &writeRequests[i], container.GetDefaultObjectClass()});
+      }
+      if (int err = RDaosContainer::WriteV(ops))
          throw ROOT::Experimental::RException(R__FAIL("WriteV: error" + std::string(d_errstr(err))));
    }
 
@@ -452,6 +494,12 @@ void ROOT::Experimental::Detail::RPageSinkDaos::ReleasePage(RPage &page)
    fPageAllocator->DeletePage(page);
 }
 
+ROOT::Experimental::Detail::RDaosContainer &
+ROOT::Experimental::Detail::RPageSinkDaos::GetStripeContainer(std::size_t stripe)
+{
+   return (stripe == 0) ? *fDaosContainer : *fStripeContainers[stripe - 1];
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 
 ROOT::Experimental::Detail::RPageSourceDaos::RPageSourceDaos(std::string_view ntupleName, std::string_view uri,
@@ -463,6 +511,7 @@ ROOT::Experimental::Detail::RPageSourceDaos::RPageSourceDaos(std::string_view nt
 {
    fDecompressor = std::make_unique<RNTupleDecompressor>();
    EnableDefaultMetrics("RPageSourceDaos");
+   fMetrics.ObserveMetrics(fClusterPool->GetMetrics());
 
    auto args = ParseDaosURI(uri);
    auto pool = std::make_shared<RDaosPool>(args.fPoolLabel);
@@ -489,6 +538,14 @@ ROOT::Experimental::RNTupleDescriptor ROOT::Experimental::Detail::RPageSourceDao
    fDaosContainer->SetDefaultObjectClass(oclass);
    fNTupleIndex = locator.GetIndex();
 
+   const auto containerLabel = ParseDaosURI(fURI).fContainerLabel;
+   fStripeContainers.clear();
+   for (std::size_t i = 1; i < locator.fAnchor->fNStripes; ++i) {
+      fStripeContainers.emplace_back(
+         std::make_unique<RDaosContainer>(fDaosContainer->GetPool(), GetStripeContainerLabel(containerLabel, i)));
+      fStripeContainers.back()->SetDefaultObjectClass(oclass);
+   }
+
    ntplDesc = descBuilder.MoveDescriptor();
    daos_obj_id_t oidPageList{kOidLowPageList, static_cast<decltype(daos_obj_id_t::hi)>(fNTupleIndex)};
 
@@ -516,6 +573,12 @@ std::string ROOT::Experimental::Detail::RPageSourceDaos::GetObjectClass() const
    return fDaosContainer->GetDefaultObjectClass().ToString();
 }
 
+ROOT::Experimental::Detail::RDaosContainer &
+ROOT::Experimental::Detail::RPageSourceDaos::GetStripeContainer(std::size_t stripe)
+{
+   return (stripe == 0) ? *fDaosContainer : *fStripeContainers[stripe - 1];
+}
+
 void ROOT::Experimental::Detail::RPageSourceDaos::LoadSealedPage(DescriptorId_t physicalColumnId,
                                                                  const RClusterIndex &clusterIndex,
                                                                  RSealedPage &sealedPage)
@@ -540,8 +603,9 @@ void ROOT::Experimental::Detail::RPageSourceDaos::LoadSealedPage(DescriptorId_t
    if (sealedPage.fBuffer) {
       RDaosKey daosKey = GetPageDaosKey<kDefaultDaosMapping>(
          fNTupleIndex, clusterId, physicalColumnId, pageInfo.fLocator.GetPosition<RNTupleLocatorObject64>().fLocation);
-      fDaosContainer->ReadSingleAkey(const_cast<void *>(sealedPage.fBuffer), bytesOnStorage, daosKey.fOid,
-                                     daosKey.fDkey, daosKey.fAkey);
+      GetStripeContainer(GetPageStripe(clusterId, physicalColumnId, fStripeContainers.size() + 1))
+         .ReadSingleAkey(const_cast<void *>(sealedPage.fBuffer), bytesOnStorage, daosKey.fOid, daosKey.fDkey,
+                         daosKey.fAkey);
    }
 }
 
@@ -570,8 +634,8 @@ ROOT::Experimental::Detail::RPageSourceDaos::PopulatePageFromCluster(ColumnHandl
       directReadBuffer = std::unique_ptr<unsigned char[]>(new unsigned char[bytesOnStorage]);
       RDaosKey daosKey = GetPageDaosKey<kDefaultDaosMapping>(
          fNTupleIndex, clusterId, columnId, pageInfo.fLocator.GetPosition<RNTupleLocatorObject64>().fLocation);
-      fDaosContainer->ReadSingleAkey(directReadBuffer.get(), bytesOnStorage, daosKey.fOid, daosKey.fDkey,
-                                     daosKey.fAkey);
+      GetStripeContainer(GetPageStripe(clusterId, columnId, fStripeContainers.size() + 1))
+         .ReadSingleAkey(directReadBuffer.get(), bytesOnStorage, daosKey.fOid, daosKey.fDkey, daosKey.fAkey);
       fCounters->fNPageLoaded.Inc();
       fCounters->fNRead.Inc();
       fCounters->fSzReadPayload.Add(bytesOnStorage);
@@ -688,7 +752,9 @@ ROOT::Experimental::Detail::RPageSourceDaos::LoadClusters(std::span<RCluster::RK
 
    std::vector<unsigned char *> clusterBuffers(clusterKeys.size());
    std::vector<std::unique_ptr<ROnDiskPageMapHeap>> pageMaps(clusterKeys.size());
-   RDaosContainer::MultiObjectRWOperation_t readRequests;
+   // The requests of all the clusters, batched per stripe; they are issued together in a single ReadV() call
+   const auto nStripes = fStripeContainers.size() + 1;
+   std::vector<RDaosContainer::MultiObjectRWOperation_t> readRequests(nStripes);
 
    int64_t szPayload = 0;
    unsigned nPages = 0;
@@ -753,7 +819,8 @@ ROOT::Experimental::Detail::RPageSourceDaos::LoadClusters(std::span<RCluster::RK
 
          RDaosKey daosKey = GetPageDaosKey<kDefaultDaosMapping>(fNTupleIndex, clusterId, columnId, cageIndex);
          auto odPair = RDaosContainer::ROidDkeyPair{daosKey.fOid, daosKey.fDkey};
-         auto [itReq, ret] = readRequests.emplace(odPair, RDaosContainer::RWOperation(odPair));
+         auto &stripeRequests = readRequests[GetPageStripe(clusterId, columnId, nStripes)];
+         auto [itReq, ret] = stripeRequests.emplace(odPair, RDaosContainer::RWOperation(odPair));
          itReq->second.Insert(daosKey.fAkey, iov);
 
          cageBuffer += cageSz;
@@ -764,7 +831,12 @@ ROOT::Experimental::Detail::RPageSourceDaos::LoadClusters(std::span<RCluster::RK
 
    {
       RNTupleAtomicTimer timer(fCounters->fTimeWallRead, fCounters->fTimeCpuRead);
-      if (int err = fDaosContainer->ReadV(readRequests))
+      std::vector<RDaosContainer::RContainerRWOperation> ops;
+      for (std::size_t i = 0; i < nStripes; ++i) {
+         auto &container = GetStripeContainer(i);
+         ops.push_back({&container, &readRequests[i], container.GetDefaultObjectClass()});
+      }
+      if (int err = RDaosContainer::ReadV(ops))
          throw ROOT::Experimental::RException(R__FAIL("ReadV: error" + std::string(d_errstr(err))));
    }
    fCounters->fNReadV.Inc();
@@ -792,14 +864,24 @@ void ROOT::Experimental::Detail::RPageSourceDaos::UnzipClusterImpl(RCluster *clu
    const auto &clusterDescriptor = descriptorGuard->GetClusterDescriptor(clusterId);
 
    std::vector<std::unique_ptr<RColumnElementBase>> allElements;
+   // The unzip tasks of all the columns, annotated with the relative position of the page's first element in the
+   // cluster. Tasks are scheduled in this order so that the pages covering the first entries of the cluster in all
+   // the columns become available first.
+   struct RUnzipTask {
+      double fPosition;
+      std::function<void(void)> fTaskFunc;
+   };
+   std::vector<RUnzipTask> unzipTasks;
 
    const auto &columnsInCluster = cluster->GetAvailPhysicalColumns();
    for (const auto columnId : columnsInCluster) {
       const auto &columnDesc = descriptorGuard->GetColumnDescriptor(columnId);
 
-      allElements.emplace_back(RColumnElementBase::Generate(columnDesc.GetModel().GetType()));
+      allElements.emplace_back(RColumnElementBase::Generate(columnDesc.GetModel()));
 
       const auto &pageRange = clusterDescriptor.GetPageRange(columnId);
+      const double nElementsInCluster =
+         std::max<std::uint64_t>(1, clusterDescriptor.GetColumnRange(columnId).fNElements);
       std::uint64_t pageNo = 0;
       std::uint64_t firstInPage = 0;
       for (const auto &pi : pageRange.fPageInfos) {
@@ -810,6 +892,7 @@ void ROOT::Experimental::Detail::RPageSourceDaos::UnzipClusterImpl(RCluster *clu
          auto taskFunc = [this, columnId, clusterId, firstInPage, onDiskPage, element = allElements.back().get(),
                           nElements = pi.fNElements,
                           indexOffset = clusterDescriptor.GetColumnRange(columnId).fFirstElementIndex]() {
+            RTaskTracer::RScope traceScope("RNTuple", "UnzipPage", onDiskPage->GetSize());
             auto newPage = UnsealPage({onDiskPage->GetAddress(), onDiskPage->GetSize(), nElements}, *element, columnId);
             fCounters->fSzUnzip.Add(element->GetSize() * nElements);
 
@@ -820,13 +903,18 @@ void ROOT::Experimental::Detail::RPageSourceDaos::UnzipClusterImpl(RCluster *clu
                             nullptr));
          };
 
-         fTaskScheduler->AddTask(taskFunc);
+         unzipTasks.push_back({firstInPage / nElementsInCluster, taskFunc});
 
          firstInPage += pi.fNElements;
          pageNo++;
       } // for all pages in column
    }    // for all columns in cluster
 
+   std::stable_sort(unzipTasks.begin(), unzipTasks.end(),
+                    [](const RUnzipTask &a, const RUnzipTask &b) { return a.fPosition < b.fPosition; });
+   for (const auto &task : unzipTasks)
+      fTaskScheduler->AddTask(task.fTaskFunc);
+
    fCounters->fNPagePopulated.Add(cluster->GetNOnDiskPages());
 
    fTaskScheduler->Wait();
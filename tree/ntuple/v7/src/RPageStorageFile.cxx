@@ -16,6 +16,7 @@
 #include <ROOT/RCluster.hxx>
 #include <ROOT/RClusterPool.hxx>
 #include <ROOT/RField.hxx>
+#include <ROOT/RIOMetrics.hxx>
 #include <ROOT/RLogger.hxx>
 #include <ROOT/RNTupleDescriptor.hxx>
 #include <ROOT/RNTupleModel.hxx>
@@ -26,6 +27,7 @@
 #include <ROOT/RPagePool.hxx>
 #include <ROOT/RPageStorageFile.hxx>
 #include <ROOT/RRawFile.hxx>
+#include <ROOT/RTaskTracer.hxx>
 
 #include <RVersion.h>
 #include <TError.h>
@@ -135,7 +137,7 @@ ROOT::Experimental::Detail::RPageSinkFile::CommitSealedPageImpl(DescriptorId_t p
                                                                 const RPageStorage::RSealedPage &sealedPage)
 {
    const auto bitsOnStorage = RColumnElementBase::GetBitsOnStorage(
-      fDescriptorBuilder.GetDescriptor().GetColumnDescriptor(physicalColumnId).GetModel().GetType());
+      fDescriptorBuilder.GetDescriptor().GetColumnDescriptor(physicalColumnId).GetModel());
    const auto bytesPacked = (bitsOnStorage * sealedPage.fNElements + 7) / 8;
 
    return WriteSealedPage(sealedPage, bytesPacked);
@@ -198,6 +200,7 @@ ROOT::Experimental::Detail::RPageSourceFile::RPageSourceFile(std::string_view nt
 {
    fDecompressor = std::make_unique<RNTupleDecompressor>();
    EnableDefaultMetrics("RPageSourceFile");
+   fMetrics.ObserveMetrics(fClusterPool->GetMetrics());
 }
 
 
@@ -208,6 +211,7 @@ ROOT::Experimental::Detail::RPageSourceFile::RPageSourceFile(std::string_view nt
    fFile = ROOT::Internal::RRawFile::Create(path);
    R__ASSERT(fFile);
    fReader = Internal::RMiniFileReader(fFile.get());
+   fIOMetrics = RIOMetrics::GetFileMetricsIfEnabled("RNTuple", fFile->GetUrl());
 }
 
 void ROOT::Experimental::Detail::RPageSourceFile::InitDescriptor(const Internal::RFileNTupleAnchor &anchor)
@@ -250,30 +254,73 @@ ROOT::Experimental::RNTupleDescriptor ROOT::Experimental::Detail::RPageSourceFil
    }
 
    auto ntplDesc = fDescriptorBuilder.MoveDescriptor();
-
-   for (const auto &cgDesc : ntplDesc.GetClusterGroupIterable()) {
-      auto buffer = std::make_unique<unsigned char[]>(cgDesc.GetPageListLength());
-      auto zipBuffer = std::make_unique<unsigned char[]>(cgDesc.GetPageListLocator().fBytesOnStorage);
-      fReader.ReadBuffer(zipBuffer.get(), cgDesc.GetPageListLocator().fBytesOnStorage,
-                         cgDesc.GetPageListLocator().GetPosition<std::uint64_t>());
-      fDecompressor->Unzip(zipBuffer.get(), cgDesc.GetPageListLocator().fBytesOnStorage, cgDesc.GetPageListLength(),
-                           buffer.get());
-
-      auto clusters = RClusterGroupDescriptorBuilder::GetClusterSummaries(ntplDesc, cgDesc.GetId());
-      Internal::RNTupleSerializer::DeserializePageListV1(buffer.get(), cgDesc.GetPageListLength(), clusters);
-      for (std::size_t i = 0; i < clusters.size(); ++i) {
-         ntplDesc.AddClusterDetails(clusters[i].AddDeferredColumnRanges(ntplDesc).MoveDescriptor().Unwrap());
+   fUseMmap = fOptions.GetUseMmap() && (fFile->GetFeatures() & ROOT::Internal::RRawFile::kFeatureHasMmap);
+
+   std::vector<DescriptorId_t> clusterGroupIds;
+   if (fOptions.GetLoadClusterGroupsOnDemand()) {
+      // Only the cluster group of the last cluster is needed up front: it determines the number of elements of the
+      // columns (see RNTupleDescriptor::GetNElements())
+      DescriptorId_t lastClusterId = kInvalidDescriptorId;
+      NTupleSize_t lastFirstEntry = 0;
+      for (const auto &c : ntplDesc.GetClusterIterable()) {
+         if (lastClusterId == kInvalidDescriptorId || c.GetFirstEntryIndex() >= lastFirstEntry) {
+            lastClusterId = c.GetId();
+            lastFirstEntry = c.GetFirstEntryIndex();
+         }
       }
+      for (const auto &cgDesc : ntplDesc.GetClusterGroupIterable()) {
+         const auto &clusterIds = cgDesc.GetClusterIds();
+         if (std::find(clusterIds.begin(), clusterIds.end(), lastClusterId) != clusterIds.end())
+            clusterGroupIds.emplace_back(cgDesc.GetId());
+      }
+   } else {
+      for (const auto &cgDesc : ntplDesc.GetClusterGroupIterable())
+         clusterGroupIds.emplace_back(cgDesc.GetId());
+   }
+
+   for (auto clusterGroupId : clusterGroupIds) {
+      for (auto &clusterDesc : ReadPageList(ntplDesc, clusterGroupId, *fDecompressor))
+         ntplDesc.AddClusterDetails(std::move(clusterDesc)).ThrowOnError();
    }
 
    return ntplDesc;
 }
 
+std::vector<ROOT::Experimental::RClusterDescriptor>
+ROOT::Experimental::Detail::RPageSourceFile::ReadPageList(const RNTupleDescriptor &desc, DescriptorId_t clusterGroupId,
+                                                          RNTupleDecompressor &decompressor)
+{
+   const auto &cgDesc = desc.GetClusterGroupDescriptor(clusterGroupId);
+   auto buffer = std::make_unique<unsigned char[]>(cgDesc.GetPageListLength());
+   auto zipBuffer = std::make_unique<unsigned char[]>(cgDesc.GetPageListLocator().fBytesOnStorage);
+   fReader.ReadBuffer(zipBuffer.get(), cgDesc.GetPageListLocator().fBytesOnStorage,
+                      cgDesc.GetPageListLocator().GetPosition<std::uint64_t>());
+   decompressor.Unzip(zipBuffer.get(), cgDesc.GetPageListLocator().fBytesOnStorage, cgDesc.GetPageListLength(),
+                      buffer.get());
+
+   auto clusters = RClusterGroupDescriptorBuilder::GetClusterSummaries(desc, clusterGroupId);
+   Internal::RNTupleSerializer::DeserializePageListV1(buffer.get(), cgDesc.GetPageListLength(), clusters);
+   std::vector<RClusterDescriptor> result;
+   for (std::size_t i = 0; i < clusters.size(); ++i)
+      result.emplace_back(clusters[i].AddDeferredColumnRanges(desc).MoveDescriptor().Unwrap());
+   return result;
+}
+
+std::vector<ROOT::Experimental::RClusterDescriptor>
+ROOT::Experimental::Detail::RPageSourceFile::LoadClusterGroupImpl(DescriptorId_t clusterGroupId)
+{
+   // The member decompressor is used by the thread that populates pages; loading can happen from the I/O thread
+   RNTupleDecompressor decompressor;
+   auto descriptorGuard = GetSharedDescriptorGuard();
+   return ReadPageList(descriptorGuard.GetRef(), clusterGroupId, decompressor);
+}
+
 void ROOT::Experimental::Detail::RPageSourceFile::LoadSealedPage(DescriptorId_t physicalColumnId,
                                                                  const RClusterIndex &clusterIndex,
                                                                  RSealedPage &sealedPage)
 {
    const auto clusterId = clusterIndex.GetClusterId();
+   EnsureClusterDetails(clusterId);
 
    RClusterDescriptor::RPageRange::RPageInfo pageInfo;
    {
@@ -295,6 +342,52 @@ void ROOT::Experimental::Detail::RPageSourceFile::LoadSealedPage(DescriptorId_t
    }
 }
 
+bool ROOT::Experimental::Detail::RPageSourceFile::CanMapPage(const RClusterDescriptor::RPageRange::RPageInfo &pageInfo,
+                                                             const RColumnElementBase &element) const
+{
+   if (!fUseMmap || !element.IsMappable())
+      return false;
+   if (pageInfo.fLocator.fType != RNTupleLocator::kTypeFile)
+      return false;
+   // A compressed page is smaller than its packed size
+   if (pageInfo.fLocator.fBytesOnStorage != element.GetPackedSize(pageInfo.fNElements))
+      return false;
+   // The mapped page is accessed through typed pointers
+   return (pageInfo.fLocator.GetPosition<std::uint64_t>() % element.GetSize()) == 0;
+}
+
+ROOT::Experimental::Detail::RPage
+ROOT::Experimental::Detail::RPageSourceFile::MapPage(ColumnHandle_t columnHandle, const RClusterInfo &clusterInfo)
+{
+   const auto columnId = columnHandle.fPhysicalId;
+   const auto clusterId = clusterInfo.fClusterId;
+   const auto &pageInfo = clusterInfo.fPageInfo;
+   const auto elementSize = columnHandle.fColumn->GetElement()->GetSize();
+   const auto offset = pageInfo.fLocator.GetPosition<std::uint64_t>();
+   const std::size_t nbytes = pageInfo.fLocator.fBytesOnStorage;
+
+   std::uint64_t mapdOffset;
+   void *region;
+   {
+      RNTupleAtomicTimer timer(fCounters->fTimeWallRead, fCounters->fTimeCpuRead);
+      region = fFile->Map(nbytes, offset, mapdOffset);
+   }
+   fCounters->fNPageLoaded.Inc();
+   fCounters->fSzReadPayload.Add(nbytes);
+   const std::size_t szRegion = nbytes + (offset - mapdOffset);
+
+   RPage newPage(columnId, reinterpret_cast<unsigned char *>(region) + (offset - mapdOffset), elementSize,
+                 pageInfo.fNElements);
+   newPage.GrowUnchecked(pageInfo.fNElements);
+   newPage.SetWindow(clusterInfo.fColumnOffset + pageInfo.fFirstInPage,
+                     RPage::RClusterInfo(clusterId, clusterInfo.fColumnOffset));
+   fPagePool->RegisterPage(newPage, RPageDeleter([file = fFile.get(), region, szRegion](const RPage &, void *) {
+                              file->Unmap(region, szRegion);
+                           }));
+   fCounters->fNPagePopulated.Inc();
+   return newPage;
+}
+
 ROOT::Experimental::Detail::RPage
 ROOT::Experimental::Detail::RPageSourceFile::PopulatePageFromCluster(ColumnHandle_t columnHandle,
                                                                      const RClusterInfo &clusterInfo,
@@ -309,7 +402,7 @@ ROOT::Experimental::Detail::RPageSourceFile::PopulatePageFromCluster(ColumnHandl
    const auto bytesOnStorage = pageInfo.fLocator.fBytesOnStorage;
 
    const void *sealedPageBuffer = nullptr; // points either to directReadBuffer or to a read-only page in the cluster
-   std::unique_ptr<unsigned char []> directReadBuffer; // only used if cluster pool is turned off
+   std::unique_ptr<unsigned char []> directReadBuffer; // only used for pages that are not part of a cluster
 
    if (pageInfo.fLocator.fType == RNTupleLocator::kTypePageZero) {
       auto pageZero = RPage::MakePageZero(columnId, elementSize);
@@ -320,14 +413,10 @@ ROOT::Experimental::Detail::RPageSourceFile::PopulatePageFromCluster(ColumnHandl
       return pageZero;
    }
 
-   if (fOptions.GetClusterCache() == RNTupleReadOptions::EClusterCache::kOff) {
-      directReadBuffer = std::unique_ptr<unsigned char[]>(new unsigned char[bytesOnStorage]);
-      fReader.ReadBuffer(directReadBuffer.get(), bytesOnStorage, pageInfo.fLocator.GetPosition<std::uint64_t>());
-      fCounters->fNPageLoaded.Inc();
-      fCounters->fNRead.Inc();
-      fCounters->fSzReadPayload.Add(bytesOnStorage);
-      sealedPageBuffer = directReadBuffer.get();
-   } else {
+   if (CanMapPage(pageInfo, *element))
+      return MapPage(columnHandle, clusterInfo);
+
+   if (fOptions.GetClusterCache() != RNTupleReadOptions::EClusterCache::kOff) {
       if (!fCurrentCluster || (fCurrentCluster->GetId() != clusterId) || !fCurrentCluster->ContainsColumn(columnId))
          fCurrentCluster = fClusterPool->GetCluster(clusterId, fActivePhysicalColumns.ToColumnSet());
       R__ASSERT(fCurrentCluster->ContainsColumn(columnId));
@@ -338,15 +427,34 @@ ROOT::Experimental::Detail::RPageSourceFile::PopulatePageFromCluster(ColumnHandl
 
       ROnDiskPage::Key key(columnId, pageInfo.fPageNo);
       auto onDiskPage = fCurrentCluster->GetOnDiskPage(key);
-      R__ASSERT(onDiskPage && (bytesOnStorage == onDiskPage->GetSize()));
-      sealedPageBuffer = onDiskPage->GetAddress();
+      // With mmap, pages that are mappable on disk are not part of the cluster. They are read directly if the
+      // in-memory type of the column does not allow for mapping.
+      R__ASSERT(onDiskPage || fUseMmap);
+      if (onDiskPage) {
+         R__ASSERT(bytesOnStorage == onDiskPage->GetSize());
+         sealedPageBuffer = onDiskPage->GetAddress();
+      }
+   }
+
+   if (!sealedPageBuffer) {
+      directReadBuffer = std::unique_ptr<unsigned char[]>(new unsigned char[bytesOnStorage]);
+      fReader.ReadBuffer(directReadBuffer.get(), bytesOnStorage, pageInfo.fLocator.GetPosition<std::uint64_t>());
+      fCounters->fNPageLoaded.Inc();
+      fCounters->fNRead.Inc();
+      fCounters->fSzReadPayload.Add(bytesOnStorage);
+      sealedPageBuffer = directReadBuffer.get();
    }
 
    RPage newPage;
    {
       RNTupleAtomicTimer timer(fCounters->fTimeWallUnzip, fCounters->fTimeCpuUnzip);
+      RIOFileMetrics::Clock_t::time_point unzipStart;
+      if (fIOMetrics)
+         unzipStart = RIOFileMetrics::Now();
       newPage = UnsealPage({sealedPageBuffer, bytesOnStorage, pageInfo.fNElements}, *element, columnId);
       fCounters->fSzUnzip.Add(elementSize * pageInfo.fNElements);
+      if (fIOMetrics)
+         fIOMetrics->AddUnzip(elementSize * pageInfo.fNElements, unzipStart);
    }
 
    newPage.SetWindow(clusterInfo.fColumnOffset + pageInfo.fFirstInPage,
@@ -367,6 +475,7 @@ ROOT::Experimental::Detail::RPage ROOT::Experimental::Detail::RPageSourceFile::P
    if (!cachedPage.IsNull())
       return cachedPage;
 
+   EnsureClusterDetailsOfElement(columnId, globalIndex);
    std::uint64_t idxInCluster;
    RClusterInfo clusterInfo;
    {
@@ -396,6 +505,7 @@ ROOT::Experimental::Detail::RPage ROOT::Experimental::Detail::RPageSourceFile::P
       return cachedPage;
 
    R__ASSERT(clusterId != kInvalidDescriptorId);
+   EnsureClusterDetails(clusterId);
    RClusterInfo clusterInfo;
    {
       auto descriptorGuard = GetSharedDescriptorGuard();
@@ -418,6 +528,7 @@ std::unique_ptr<ROOT::Experimental::Detail::RPageSource> ROOT::Experimental::Det
    auto clone = new RPageSourceFile(fNTupleName, fOptions);
    clone->fFile = fFile->Clone();
    clone->fReader = Internal::RMiniFileReader(clone->fFile.get());
+   clone->fIOMetrics = fIOMetrics;
    return std::unique_ptr<RPageSourceFile>(clone);
 }
 
@@ -443,11 +554,17 @@ ROOT::Experimental::Detail::RPageSourceFile::PrepareSingleCluster(
 
       // Collect the page necessary page meta-data and sum up the total size of the compressed and packed pages
       for (auto physicalColumnId : clusterKey.fPhysicalColumnSet) {
+         std::unique_ptr<RColumnElementBase> element;
+         if (fUseMmap) {
+            element = RColumnElementBase::Generate(descriptorGuard->GetColumnDescriptor(physicalColumnId).GetModel());
+         }
          const auto &pageRange = clusterDesc.GetPageRange(physicalColumnId);
          NTupleSize_t pageNo = 0;
          for (const auto &pageInfo : pageRange.fPageInfos) {
             const auto &pageLocator = pageInfo.fLocator;
-            if (pageLocator.fType == RNTupleLocator::kTypePageZero) {
+            if (element && CanMapPage(pageInfo, *element)) {
+               // Mappable pages are not read into the cluster but mapped on demand by PopulatePageFromCluster()
+            } else if (pageLocator.fType == RNTupleLocator::kTypePageZero) {
                // Zero pages can be directly inserted into a page map that will be adopted below
                ROnDiskPage::Key key(physicalColumnId, pageNo);
                pageZeroMap->Register(
@@ -557,6 +674,7 @@ ROOT::Experimental::Detail::RPageSourceFile::LoadClusters(std::span<RCluster::RK
    std::vector<ROOT::Internal::RRawFile::RIOVec> readRequests;
 
    for (auto key: clusterKeys) {
+      EnsureClusterDetails(key.fClusterId);
       clusters.emplace_back(PrepareSingleCluster(key, readRequests));
    }
 
@@ -582,26 +700,49 @@ void ROOT::Experimental::Detail::RPageSourceFile::UnzipClusterImpl(RCluster *clu
    const auto &clusterDescriptor = descriptorGuard->GetClusterDescriptor(clusterId);
 
    std::vector<std::unique_ptr<RColumnElementBase>> allElements;
+   // The unzip tasks of all the columns, annotated with the relative position of the page's first element in the
+   // cluster. Tasks are scheduled in this order so that the pages covering the first entries of the cluster in all
+   // the columns become available first.
+   struct RUnzipTask {
+      double fPosition;
+      std::function<void(void)> fTaskFunc;
+   };
+   std::vector<RUnzipTask> unzipTasks;
 
    const auto &columnsInCluster = cluster->GetAvailPhysicalColumns();
    for (const auto columnId : columnsInCluster) {
       const auto &columnDesc = descriptorGuard->GetColumnDescriptor(columnId);
 
-      allElements.emplace_back(RColumnElementBase::Generate(columnDesc.GetModel().GetType()));
+      allElements.emplace_back(RColumnElementBase::Generate(columnDesc.GetModel()));
 
       const auto &pageRange = clusterDescriptor.GetPageRange(columnId);
+      const double nElementsInCluster =
+         std::max<std::uint64_t>(1, clusterDescriptor.GetColumnRange(columnId).fNElements);
       std::uint64_t pageNo = 0;
       std::uint64_t firstInPage = 0;
       for (const auto &pi : pageRange.fPageInfos) {
          ROnDiskPage::Key key(columnId, pageNo);
          auto onDiskPage = cluster->GetOnDiskPage(key);
-         R__ASSERT(onDiskPage && (onDiskPage->GetSize() == pi.fLocator.fBytesOnStorage));
+         if (!onDiskPage) {
+            // Mappable page that is mapped on demand
+            R__ASSERT(fUseMmap);
+            firstInPage += pi.fNElements;
+            pageNo++;
+            continue;
+         }
+         R__ASSERT(onDiskPage->GetSize() == pi.fLocator.fBytesOnStorage);
 
          auto taskFunc = [this, columnId, clusterId, firstInPage, onDiskPage, element = allElements.back().get(),
                           nElements = pi.fNElements,
                           indexOffset = clusterDescriptor.GetColumnRange(columnId).fFirstElementIndex]() {
+            RTaskTracer::RScope traceScope("RNTuple", "UnzipPage", onDiskPage->GetSize());
+            RIOFileMetrics::Clock_t::time_point unzipStart;
+            if (fIOMetrics)
+               unzipStart = RIOFileMetrics::Now();
             auto newPage = UnsealPage({onDiskPage->GetAddress(), onDiskPage->GetSize(), nElements}, *element, columnId);
             fCounters->fSzUnzip.Add(element->GetSize() * nElements);
+            if (fIOMetrics)
+               fIOMetrics->AddUnzip(element->GetSize() * nElements, unzipStart);
 
             newPage.SetWindow(indexOffset + firstInPage, RPage::RClusterInfo(clusterId, indexOffset));
             fPagePool->PreloadPage(
@@ -610,13 +751,18 @@ void ROOT::Experimental::Detail::RPageSourceFile::UnzipClusterImpl(RCluster *clu
                             nullptr));
          };
 
-         fTaskScheduler->AddTask(taskFunc);
+         unzipTasks.push_back({firstInPage / nElementsInCluster, taskFunc});
 
          firstInPage += pi.fNElements;
          pageNo++;
       } // for all pages in column
    } // for all columns in cluster
 
+   std::stable_sort(unzipTasks.begin(), unzipTasks.end(),
+                    [](const RUnzipTask &a, const RUnzipTask &b) { return a.fPosition < b.fPosition; });
+   for (const auto &task : unzipTasks)
+      fTaskScheduler->AddTask(task.fTaskFunc);
+
    fCounters->fNPagePopulated.Add(cluster->GetNOnDiskPages());
 
    fTaskScheduler->Wait();
@@ -0,0 +1,389 @@
+/// \file RPageStorageShards.cxx
+/// \ingroup NTuple ROOT7
+/// \date 2026-10-15
+/// \warning This is part of the ROOT 7 prototype! It will change without notice. It might trigger earthquakes. Feedback
+/// is welcome!
+
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include <ROOT/RCluster.hxx>
+#include <ROOT/RColumn.hxx>
+#include <ROOT/RError.hxx>
+#include <ROOT/RNTuple.hxx>
+#include <ROOT/RNTupleDescriptor.hxx>
+#include <ROOT/RNTupleModel.hxx>
+#include <ROOT/RNTupleOptions.hxx>
+#include <ROOT/RPage.hxx>
+#include <ROOT/RPageAllocator.hxx>
+#include <ROOT/RPageStorageFile.hxx>
+#include <ROOT/RPageStorageShards.hxx>
+#ifdef R__USE_IMT
+#include <ROOT/TTaskGroup.hxx>
+#endif
+
+#include <TROOT.h> // for IsImplicitMTEnabled()
+
+#include <algorithm>
+#include <iterator>
+#include <utility>
+
+ROOT::Experimental::Detail::RPageSinkShards::RPageSinkShards(std::string_view ntupleName, std::string_view storage,
+                                                             const RNTupleWriteOptions &options)
+   : RPageSink(ntupleName, options), fStorage(storage), fShardOptions(options.Clone())
+{
+   // The shard sinks are used directly; page buffering, if requested, wraps the sharded sink as a whole
+   fShardOptions->SetUseBufferedWrite(false);
+   fShardOptions->SetMaxShardSize(0);
+   fShardOptions->SetNShards(1);
+   // Column statistics are collected by the shard sinks
+   fCollectColumnStatistics = false;
+}
+
+ROOT::Experimental::Detail::RPageSinkShards::~RPageSinkShards() = default;
+
+std::string ROOT::Experimental::Detail::RPageSinkShards::GetIndexName(std::string_view ntupleName)
+{
+   return std::string(ntupleName) + "_shards";
+}
+
+std::string ROOT::Experimental::Detail::RPageSinkShards::GetShardFileName(std::string_view storage, std::size_t idx)
+{
+   const std::string path(storage);
+   const auto posSlash = path.rfind('/');
+   auto posDot = path.rfind('.');
+   if (posDot == std::string::npos || (posSlash != std::string::npos && posDot < posSlash))
+      posDot = path.length();
+   return path.substr(0, posDot) + "_" + std::to_string(idx) + path.substr(posDot);
+}
+
+void ROOT::Experimental::Detail::RPageSinkShards::UpdateSchema(const RNTupleModelChangeset &changeset,
+                                                               NTupleSize_t firstEntry)
+{
+   if (fModel)
+      throw RException(R__FAIL("model extension is not supported for sharded ntuples"));
+   RPageSink::UpdateSchema(changeset, firstEntry);
+}
+
+void ROOT::Experimental::Detail::RPageSinkShards::CreateImpl(const RNTupleModel &model,
+                                                             unsigned char * /* serializedHeader */,
+                                                             std::uint32_t /* length */)
+{
+   fModel = model.Clone();
+   fShards.resize(GetWriteOptions().GetNShards());
+}
+
+ROOT::Experimental::Detail::RPageSink &ROOT::Experimental::Detail::RPageSinkShards::GetCurrentSink()
+{
+   auto &shard = fShards[fCurrentShard];
+   if (!shard.fSink) {
+      shard.fFileIdx = fShardFileNames.size();
+      fShardFileNames.emplace_back(GetShardFileName(fStorage, shard.fFileIdx));
+      fShardNEntries.emplace_back(0);
+      // The physical column IDs of the shard are the same as ours because the model is an identical copy
+      shard.fModel = fModel->Clone();
+      shard.fSink = std::make_unique<RPageSinkFile>(fNTupleName, fShardFileNames.back(), *fShardOptions);
+      shard.fSink->Create(*shard.fModel);
+   }
+   return *shard.fSink;
+}
+
+void ROOT::Experimental::Detail::RPageSinkShards::CloseShard(RShard &shard)
+{
+   if (!shard.fSink)
+      return;
+   if (shard.fHasPendingClusters)
+      shard.fSink->CommitClusterGroup();
+   shard.fSink->CommitDataset();
+   fShardNEntries[shard.fFileIdx] = shard.fSink->GetNEntries();
+
+   shard.fSink.reset();
+   shard.fModel.reset();
+   shard.fNBytes = 0;
+   shard.fHasPendingClusters = false;
+}
+
+ROOT::Experimental::RNTupleLocator
+ROOT::Experimental::Detail::RPageSinkShards::CommitPageImpl(ColumnHandle_t columnHandle, const RPage &page)
+{
+   GetCurrentSink().CommitPage(columnHandle, page);
+   // The locators are stored by the shard sinks
+   return RNTupleLocator{};
+}
+
+ROOT::Experimental::RNTupleLocator
+ROOT::Experimental::Detail::RPageSinkShards::CommitSealedPageImpl(DescriptorId_t physicalColumnId,
+                                                                  const RSealedPage &sealedPage)
+{
+   GetCurrentSink().CommitSealedPage(physicalColumnId, sealedPage);
+   return RNTupleLocator{};
+}
+
+std::vector<ROOT::Experimental::RNTupleLocator>
+ROOT::Experimental::Detail::RPageSinkShards::CommitSealedPageVImpl(std::span<RSealedPageGroup> ranges)
+{
+   GetCurrentSink().CommitSealedPageV(ranges);
+   std::size_t nPages = 0;
+   for (const auto &range : ranges)
+      nPages += std::distance(range.fFirst, range.fLast);
+   return std::vector<RNTupleLocator>(nPages);
+}
+
+std::uint64_t ROOT::Experimental::Detail::RPageSinkShards::CommitClusterImpl(NTupleSize_t nEntries)
+{
+   auto &shard = fShards[fCurrentShard];
+   auto &sink = GetCurrentSink();
+   // fPrevClusterNEntries is only updated after CommitClusterImpl() returns
+   const auto nBytes = sink.CommitCluster(sink.GetNEntries() + (nEntries - fPrevClusterNEntries));
+   shard.fNBytes += nBytes;
+   shard.fHasPendingClusters = true;
+
+   const auto maxShardSize = GetWriteOptions().GetMaxShardSize();
+   if (maxShardSize > 0 && shard.fNBytes >= maxShardSize)
+      CloseShard(shard);
+   fCurrentShard = (fCurrentShard + 1) % fShards.size();
+   return nBytes;
+}
+
+ROOT::Experimental::RNTupleLocator
+ROOT::Experimental::Detail::RPageSinkShards::CommitClusterGroupImpl(unsigned char * /* serializedPageList */,
+                                                                    std::uint32_t /* length */)
+{
+   for (auto &shard : fShards) {
+      if (!shard.fHasPendingClusters)
+         continue;
+      shard.fSink->CommitClusterGroup();
+      shard.fHasPendingClusters = false;
+   }
+   // The page lists are stored by the shard sinks, so it is safe to return a dummy locator
+   return RNTupleLocator{};
+}
+
+void ROOT::Experimental::Detail::RPageSinkShards::CommitDatasetImpl(unsigned char * /* serializedFooter */,
+                                                                    std::uint32_t /* length */)
+{
+   for (auto &shard : fShards)
+      CloseShard(shard);
+
+   auto indexModel = RNTupleModel::Create();
+   auto path = indexModel->MakeField<std::string>("path");
+   auto nEntries = indexModel->MakeField<std::uint64_t>("nEntries");
+   auto writer = RNTupleWriter::Recreate(std::move(indexModel), GetIndexName(fNTupleName), fStorage);
+   for (std::size_t i = 0; i < fShardFileNames.size(); ++i) {
+      // Shard file names are stored relative to the index, such that sharded ntuples can be moved around
+      const auto posSlash = fShardFileNames[i].rfind('/');
+      *path = (posSlash == std::string::npos) ? fShardFileNames[i] : fShardFileNames[i].substr(posSlash + 1);
+      *nEntries = fShardNEntries[i];
+      writer->Fill();
+   }
+}
+
+ROOT::Experimental::Detail::RPage
+ROOT::Experimental::Detail::RPageSinkShards::ReservePage(ColumnHandle_t columnHandle, std::size_t nElements)
+{
+   if (nElements == 0)
+      throw RException(R__FAIL("invalid call: request empty page"));
+   auto elementSize = columnHandle.fColumn->GetElement()->GetSize();
+   return RPageAllocatorHeap::NewPage(columnHandle.fPhysicalId, elementSize, nElements);
+}
+
+void ROOT::Experimental::Detail::RPageSinkShards::ReleasePage(RPage &page)
+{
+   RPageAllocatorHeap::DeletePage(page);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+ROOT::Experimental::Detail::RPageSourceShards::RPageSourceShards(std::string_view ntupleName,
+                                                                 std::span<std::unique_ptr<RPageSource>> sources)
+   : RPageSource(ntupleName, RNTupleReadOptions()), fMetrics(std::string(ntupleName))
+{
+   for (auto &s : sources) {
+      fSources.emplace_back(std::move(s));
+      fMetrics.ObserveMetrics(fSources.back()->GetMetrics());
+   }
+}
+
+ROOT::Experimental::Detail::RPageSourceShards::~RPageSourceShards() = default;
+
+ROOT::Experimental::RNTupleDescriptor ROOT::Experimental::Detail::RPageSourceShards::AttachImpl()
+{
+   if (fSources.empty())
+      throw RException(R__FAIL("sharded RNTuple '" + fNTupleName + "' has no shards"));
+
+   // Opening the shards is dominated by the latency of reading the anchors, headers and footers
+   auto fnAttach = [](RPageSource &source) {
+      source.Attach();
+      // The cluster ranges of the shards are combined eagerly
+      source.EnsureAllClusterDetails();
+   };
+#ifdef R__USE_IMT
+   if (IsImplicitMTEnabled() && fSources.size() > 1) {
+      TTaskGroup taskGroup;
+      for (auto &s : fSources)
+         taskGroup.Run([&fnAttach, &s] { fnAttach(*s); });
+      taskGroup.Wait();
+   } else
+#endif
+   {
+      for (auto &s : fSources)
+         fnAttach(*s);
+   }
+
+   RNTupleDescriptorBuilder builder;
+   {
+      // The schema is taken from the first shard; the other shards have to match it
+      auto firstDesc = fSources[0]->GetSharedDescriptorGuard();
+      for (std::size_t i = 1; i < fSources.size(); ++i) {
+         auto desc = fSources[i]->GetSharedDescriptorGuard();
+         bool isCompatible = (desc->GetNFields() == firstDesc->GetNFields()) &&
+                             (desc->GetNLogicalColumns() == firstDesc->GetNLogicalColumns());
+         for (DescriptorId_t id = 0; isCompatible && (id < firstDesc->GetNFields()); ++id)
+            isCompatible = (desc->GetFieldDescriptor(id) == firstDesc->GetFieldDescriptor(id));
+         for (DescriptorId_t id = 0; isCompatible && (id < firstDesc->GetNLogicalColumns()); ++id)
+            isCompatible = (desc->GetColumnDescriptor(id) == firstDesc->GetColumnDescriptor(id));
+         if (!isCompatible)
+            throw RException(R__FAIL("schema mismatch between the shards of RNTuple '" + fNTupleName + "'"));
+      }
+
+      builder.SetNTuple(fNTupleName, firstDesc->GetDescription());
+      for (DescriptorId_t id = 0; id < firstDesc->GetNFields(); ++id)
+         builder.AddField(RFieldDescriptorBuilder(firstDesc->GetFieldDescriptor(id)).MakeDescriptor().Unwrap());
+      for (DescriptorId_t id = 0; id < firstDesc->GetNFields(); ++id) {
+         for (auto linkId : firstDesc->GetFieldDescriptor(id).GetLinkIds())
+            builder.AddFieldLink(id, linkId).ThrowOnError();
+      }
+      for (DescriptorId_t id = 0; id < firstDesc->GetNLogicalColumns(); ++id) {
+         const auto &c = firstDesc->GetColumnDescriptor(id);
+         builder.AddColumn(c.GetLogicalId(), c.GetPhysicalId(), c.GetFieldId(), c.GetModel(), c.GetIndex(),
+                           c.GetFirstElementIndex());
+      }
+      fElementOffsets.assign(firstDesc->GetNPhysicalColumns(), std::vector<NTupleSize_t>(fSources.size() + 1, 0));
+   }
+
+   fVirtual2Origin.clear();
+   fOrigin2Virtual.assign(fSources.size(), {});
+   NTupleSize_t entryOffset = 0;
+   for (std::size_t i = 0; i < fSources.size(); ++i) {
+      auto desc = fSources[i]->GetSharedDescriptorGuard();
+
+      std::vector<DescriptorId_t> clusterIds;
+      for (const auto &c : desc->GetClusterIterable())
+         clusterIds.emplace_back(c.GetId());
+      std::sort(clusterIds.begin(), clusterIds.end(), [&desc](DescriptorId_t a, DescriptorId_t b) {
+         return desc->GetClusterDescriptor(a).GetFirstEntryIndex() < desc->GetClusterDescriptor(b).GetFirstEntryIndex();
+      });
+
+      for (auto &offsets : fElementOffsets)
+         offsets[i + 1] = offsets[i];
+
+      for (auto originClusterId : clusterIds) {
+         const auto &c = desc->GetClusterDescriptor(originClusterId);
+         const DescriptorId_t virtualClusterId = fVirtual2Origin.size();
+         RClusterDescriptorBuilder clusterBuilder(virtualClusterId, c.GetFirstEntryIndex() + entryOffset,
+                                                  c.GetNEntries());
+         for (auto physicalColumnId : c.GetColumnIds()) {
+            const auto &columnRange = c.GetColumnRange(physicalColumnId);
+            const auto elementOffset = fElementOffsets[physicalColumnId][i];
+            clusterBuilder.CommitColumnRange(physicalColumnId, columnRange.fFirstElementIndex + elementOffset,
+                                             columnRange.fCompressionSettings,
+                                             c.GetPageRange(physicalColumnId).Clone(), columnRange.fStatistics);
+            fElementOffsets[physicalColumnId][i + 1] += columnRange.fNElements;
+         }
+         builder.AddClusterWithDetails(clusterBuilder.MoveDescriptor().Unwrap());
+         fVirtual2Origin.emplace_back(i, originClusterId);
+         fOrigin2Virtual[i][originClusterId] = virtualClusterId;
+      }
+      entryOffset += desc->GetNEntries();
+   }
+
+   builder.EnsureValidDescriptor();
+   return builder.MoveDescriptor();
+}
+
+std::unique_ptr<ROOT::Experimental::Detail::RPageSource> ROOT::Experimental::Detail::RPageSourceShards::Clone() const
+{
+   std::vector<std::unique_ptr<RPageSource>> cloneSources;
+   for (const auto &s : fSources)
+      cloneSources.emplace_back(s->Clone());
+   return std::make_unique<RPageSourceShards>(fNTupleName, cloneSources);
+}
+
+ROOT::Experimental::Detail::RPageStorage::ColumnHandle_t
+ROOT::Experimental::Detail::RPageSourceShards::AddColumn(DescriptorId_t fieldId, const RColumn &column)
+{
+   for (auto &s : fSources)
+      s->AddColumn(fieldId, column);
+   return RPageSource::AddColumn(fieldId, column);
+}
+
+void ROOT::Experimental::Detail::RPageSourceShards::DropColumn(ColumnHandle_t columnHandle)
+{
+   RPageSource::DropColumn(columnHandle);
+   for (auto &s : fSources)
+      s->DropColumn(columnHandle);
+}
+
+void ROOT::Experimental::Detail::RPageSourceShards::ShiftPage(std::size_t sourceIdx, RPage &page) const
+{
+   if (page.IsNull())
+      return;
+   const auto elementOffset = fElementOffsets[page.GetColumnId()][sourceIdx];
+   const auto virtualClusterId = fOrigin2Virtual[sourceIdx].at(page.GetClusterInfo().GetId());
+   page.SetWindow(page.GetGlobalRangeFirst() + elementOffset,
+                  RPage::RClusterInfo(virtualClusterId, page.GetClusterInfo().GetIndexOffset() + elementOffset));
+}
+
+ROOT::Experimental::Detail::RPage
+ROOT::Experimental::Detail::RPageSourceShards::PopulatePage(ColumnHandle_t columnHandle, NTupleSize_t globalIndex)
+{
+   // Find the last shard whose first element is not after globalIndex; shards without elements of the column are
+   // thereby skipped
+   const auto &offsets = fElementOffsets[columnHandle.fPhysicalId];
+   const auto itShard = std::upper_bound(offsets.begin(), offsets.begin() + fSources.size(), globalIndex);
+   const std::size_t sourceIdx = std::distance(offsets.begin(), itShard) - 1;
+
+   auto page = fSources[sourceIdx]->PopulatePage(columnHandle, globalIndex - offsets[sourceIdx]);
+   ShiftPage(sourceIdx, page);
+   return page;
+}
+
+ROOT::Experimental::Detail::RPage
+ROOT::Experimental::Detail::RPageSourceShards::PopulatePage(ColumnHandle_t columnHandle,
+                                                            const RClusterIndex &clusterIndex)
+{
+   const auto &origin = fVirtual2Origin.at(clusterIndex.GetClusterId());
+   auto page = fSources[origin.first]->PopulatePage(columnHandle, RClusterIndex(origin.second, clusterIndex.GetIndex()));
+   ShiftPage(origin.first, page);
+   return page;
+}
+
+void ROOT::Experimental::Detail::RPageSourceShards::ReleasePage(RPage &page)
+{
+   if (page.IsNull())
+      return;
+   // The page pools of the shards identify pages by their buffer, so the shifted window does not matter
+   fSources[fVirtual2Origin.at(page.GetClusterInfo().GetId()).first]->ReleasePage(page);
+}
+
+void ROOT::Experimental::Detail::RPageSourceShards::LoadSealedPage(DescriptorId_t physicalColumnId,
+                                                                   const RClusterIndex &clusterIndex,
+                                                                   RSealedPage &sealedPage)
+{
+   const auto &origin = fVirtual2Origin.at(clusterIndex.GetClusterId());
+   fSources[origin.first]->LoadSealedPage(physicalColumnId, RClusterIndex(origin.second, clusterIndex.GetIndex()),
+                                          sealedPage);
+}
+
+std::vector<std::unique_ptr<ROOT::Experimental::Detail::RCluster>>
+ROOT::Experimental::Detail::RPageSourceShards::LoadClusters(std::span<RCluster::RKey> clusterKeys)
+{
+   // Like the friends page source, the virtual shards page source does not pre-load any clusters itself. The shard
+   // page sources do it for the clusters they own.
+   return std::vector<std::unique_ptr<ROOT::Experimental::Detail::RCluster>>(clusterKeys.size());
+}
@@ -732,3 +732,44 @@ TEST(RNTuple, FillBytesWritten)
    optsSmall.SetHasSmallClusters(true);
    checkFillReturnValue(optsSmall);
 }
+
+TEST(RNTuple, FillSorted)
+{
+   FileRaii fileGuard("test_ntuple_fillsorted.root");
+
+   {
+      auto model = RNTupleModel::Create();
+      model->MakeField<std::int32_t>("run");
+      model->MakeField<std::int32_t>("event");
+      auto ntuple = RNTupleWriter::Recreate(std::move(model), "ntpl", fileGuard.GetPath());
+      ntuple->SetSortWindowSize(10);
+      for (std::int32_t i = 0; i < 25; ++i) {
+         auto entry = ntuple->CreateSortEntry();
+         *entry->Get<std::int32_t>("run") = (i * 7) % 3;
+         *entry->Get<std::int32_t>("event") = i;
+         ntuple->FillSorted(std::move(entry), (i * 7) % 3);
+      }
+      // The last 5 entries are written sorted on commit
+      ntuple->CommitCluster();
+      EXPECT_THROW(ntuple->FillSorted(nullptr, 0.), RException);
+   }
+
+   auto ntuple = RNTupleReader::Open("ntpl", fileGuard.GetPath());
+   ASSERT_EQ(25U, ntuple->GetNEntries());
+   auto viewRun = ntuple->GetView<std::int32_t>("run");
+   auto viewEvent = ntuple->GetView<std::int32_t>("event");
+   for (std::int32_t window = 0; window < 3; ++window) {
+      const NTupleSize_t first = window * 10;
+      const NTupleSize_t last = std::min<NTupleSize_t>(first + 10, 25);
+      for (auto i = first + 1; i < last; ++i) {
+         EXPECT_LE(viewRun(i - 1), viewRun(i));
+         // Stable sort: entries with equal keys keep their fill order
+         if (viewRun(i - 1) == viewRun(i))
+            EXPECT_LT(viewEvent(i - 1), viewEvent(i));
+      }
+      for (auto i = first; i < last; ++i) {
+         EXPECT_GE(viewEvent(i), std::int32_t(first));
+         EXPECT_LT(viewEvent(i), std::int32_t(last));
+      }
+   }
+}
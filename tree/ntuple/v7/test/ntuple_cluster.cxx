@@ -56,7 +56,10 @@ public:
    std::vector<ROOT::Experimental::DescriptorId_t> fReqsClusterIds;
    std::vector<ROOT::Experimental::Detail::RCluster::ColumnSet_t> fReqsColumns;
 
-   RPageSourceMock() : RPageSource("test", ROOT::Experimental::RNTupleReadOptions()) {
+   explicit RPageSourceMock(const ROOT::Experimental::RNTupleReadOptions &options =
+                               ROOT::Experimental::RNTupleReadOptions())
+      : RPageSource("test", options)
+   {
       ROOT::Experimental::RNTupleDescriptorBuilder descBuilder;
       for (unsigned i = 0; i <= 5; ++i) {
          descBuilder.AddClusterSummary(i, i, 1);
@@ -263,6 +266,76 @@ TEST(ClusterPool, GetClusterBasics)
 }
 
 
+TEST(ClusterPool, GetClusterEntryRange)
+{
+   RPageSourceMock p1;
+   RPageSource::REntryRange entryRange;
+   entryRange.fFirstEntry = 1;
+   entryRange.fNEntries = 2;
+   p1.SetEntryRange(entryRange);
+   {
+      RClusterPool c1(p1, 2);
+      c1.GetCluster(1, {0});
+      c1.WaitForInFlightClusters();
+   }
+   // No read-ahead beyond cluster 2, which contains the last entry of the range
+   ASSERT_EQ(2U, p1.fReqsClusterIds.size());
+   EXPECT_EQ(1U, p1.fReqsClusterIds[0]);
+   EXPECT_EQ(2U, p1.fReqsClusterIds[1]);
+
+   entryRange.fNEntries = 6;
+   EXPECT_THROW(p1.SetEntryRange(entryRange), ROOT::Experimental::RException);
+}
+
+
+TEST(ClusterPool, AdaptiveBunchSize)
+{
+   // No measurements yet: keep the current bunch size
+   EXPECT_EQ(1U, RClusterPool::ComputeAdaptiveBunchSize(1, 64, 0, 0, 0, 1000));
+   EXPECT_EQ(4U, RClusterPool::ComputeAdaptiveBunchSize(4, 64, 0, 100, 0, 1000));
+   // Loading is slower than consuming: grow by at most a factor of two
+   EXPECT_EQ(2U, RClusterPool::ComputeAdaptiveBunchSize(1, 64, 1000, 10, 0, 1000));
+   EXPECT_EQ(3U, RClusterPool::ComputeAdaptiveBunchSize(2, 64, 25, 10, 0, 1000));
+   // Capped by the maximum bunch size
+   EXPECT_EQ(5U, RClusterPool::ComputeAdaptiveBunchSize(4, 5, 1000, 10, 0, 1000));
+   // Capped by the memory budget for two bunches
+   EXPECT_EQ(5U, RClusterPool::ComputeAdaptiveBunchSize(8, 64, 1000, 10, 100, 1000));
+   EXPECT_EQ(1U, RClusterPool::ComputeAdaptiveBunchSize(8, 64, 1000, 10, 2000, 1000));
+   // Loading is faster than consuming: shrink by at most a factor of two
+   EXPECT_EQ(4U, RClusterPool::ComputeAdaptiveBunchSize(8, 64, 1, 1000, 0, 1000));
+   EXPECT_EQ(1U, RClusterPool::ComputeAdaptiveBunchSize(1, 64, 1, 1000, 0, 1000));
+}
+
+
+TEST(ClusterPool, AdaptiveBunchSizeGetCluster)
+{
+   ROOT::Experimental::RNTupleReadOptions options;
+   options.SetUseAdaptiveClusterBunchSize(true);
+   options.SetMaxClusterBunchSize(3);
+   RPageSourceMock p1(options);
+   RClusterPool c1(p1, 1);
+   c1.GetMetrics().Enable();
+   EXPECT_EQ(1U, c1.GetClusterBunchSize());
+   for (ROOT::Experimental::DescriptorId_t i = 0; i <= 5; ++i) {
+      auto cluster = c1.GetCluster(i, {0});
+      ASSERT_NE(nullptr, cluster);
+      EXPECT_EQ(i, cluster->GetId());
+      EXPECT_GE(c1.GetClusterBunchSize(), 1U);
+      EXPECT_LE(c1.GetClusterBunchSize(), 3U);
+   }
+   c1.WaitForInFlightClusters();
+   EXPECT_EQ(static_cast<std::int64_t>(c1.GetClusterBunchSize()),
+             c1.GetMetrics().GetLocalCounter("nClusterBunchSize")->GetValueAsInt());
+
+   // Non-adaptive mode keeps the bunch size
+   RPageSourceMock p2;
+   RClusterPool c2(p2, 2);
+   for (ROOT::Experimental::DescriptorId_t i = 0; i <= 5; ++i)
+      c2.GetCluster(i, {0});
+   EXPECT_EQ(2U, c2.GetClusterBunchSize());
+}
+
+
 TEST(ClusterPool, GetClusterIncrementally)
 {
    RPageSourceMock p1;
@@ -0,0 +1,91 @@
+#include "ntuple_test.hxx"
+
+#include "TROOT.h"
+
+namespace {
+/// Writes 3 clusters of 10 entries with (run, event) = (i / 10, 100 - i); entry 29 duplicates the key of entry 28
+void WriteRunEvent(const std::string &path)
+{
+   auto model = RNTupleModel::Create();
+   auto run = model->MakeField<std::uint32_t>("run");
+   auto event = model->MakeField<std::int64_t>("event");
+   auto pt = model->MakeField<float>("pt");
+   auto writer = RNTupleWriter::Recreate(std::move(model), "ntpl", path);
+   for (int i = 0; i < 30; ++i) {
+      *run = i / 10;
+      *event = (i == 29) ? 100 - 28 : 100 - i;
+      *pt = i;
+      writer->Fill();
+      if (i % 10 == 9)
+         writer->CommitCluster();
+   }
+}
+} // anonymous namespace
+
+TEST(RNTupleIndex, Basics)
+{
+   FileRaii fileGuard("test_ntuple_index_basics.root");
+   WriteRunEvent(fileGuard.GetPath());
+
+   auto index = RNTupleIndex::Build("run", "event", "ntpl", fileGuard.GetPath());
+   EXPECT_EQ(30U, index->GetNKeys());
+   EXPECT_EQ("run", index->GetMajorFieldName());
+   EXPECT_EQ("event", index->GetMinorFieldName());
+   EXPECT_EQ(0U, index->GetEntryNumber(0, 100));
+   EXPECT_EQ(15U, index->GetEntryNumber(1, 85));
+   EXPECT_EQ(28U, index->GetEntryNumber(2, 72));
+   EXPECT_EQ(std::vector<NTupleSize_t>({28, 29}), index->GetEntryNumbers(2, 72));
+   EXPECT_EQ(ROOT::Experimental::kInvalidNTupleIndex, index->GetEntryNumber(0, 85));
+   EXPECT_EQ(ROOT::Experimental::kInvalidNTupleIndex, index->GetEntryNumber(3, 0));
+   EXPECT_TRUE(index->GetEntryNumbers(3, 0).empty());
+
+   auto majorOnly = RNTupleIndex::Build("run", "", "ntpl", fileGuard.GetPath());
+   EXPECT_EQ(10U, majorOnly->GetEntryNumber(1));
+   EXPECT_EQ(10U, majorOnly->GetEntryNumbers(2).size());
+
+   EXPECT_THROW(RNTupleIndex::Build("missing", "", "ntpl", fileGuard.GetPath()), RException);
+   EXPECT_THROW(RNTupleIndex::Build("pt", "", "ntpl", fileGuard.GetPath()), RException);
+}
+
+TEST(RNTupleIndex, Persistence)
+{
+   FileRaii fileGuard("test_ntuple_index_persistence.root");
+   WriteRunEvent(fileGuard.GetPath());
+
+   {
+      auto index = RNTupleIndex::Build("run", "event", "ntpl", fileGuard.GetPath());
+      auto file = std::unique_ptr<TFile>(TFile::Open(fileGuard.GetPath().c_str(), "UPDATE"));
+      index->Write(RNTupleIndex::GetDefaultName("ntpl"), *file);
+   }
+
+   auto index = RNTupleIndex::Open(RNTupleIndex::GetDefaultName("ntpl"), fileGuard.GetPath());
+   EXPECT_EQ(30U, index->GetNKeys());
+   EXPECT_EQ("run", index->GetMajorFieldName());
+   EXPECT_EQ("event", index->GetMinorFieldName());
+   EXPECT_EQ(15U, index->GetEntryNumber(1, 85));
+   EXPECT_EQ(ROOT::Experimental::kInvalidNTupleIndex, index->GetEntryNumber(0, 85));
+
+   // The indexed ntuple is still readable
+   auto reader = RNTupleReader::Open("ntpl", fileGuard.GetPath());
+   EXPECT_EQ(30U, reader->GetNEntries());
+   EXPECT_THROW(RNTupleIndex::Open("ntpl", fileGuard.GetPath()), RException);
+}
+
+#ifdef R__USE_IMT
+TEST(RNTupleIndex, Parallel)
+{
+   FileRaii fileGuard("test_ntuple_index_parallel.root");
+   WriteRunEvent(fileGuard.GetPath());
+
+   auto sequential = RNTupleIndex::Build("run", "event", "ntpl", fileGuard.GetPath());
+   ROOT::EnableImplicitMT(2);
+   auto parallel = RNTupleIndex::Build("run", "event", "ntpl", fileGuard.GetPath());
+   ROOT::DisableImplicitMT();
+
+   ASSERT_EQ(sequential->GetNKeys(), parallel->GetNKeys());
+   for (int i = 0; i < 30; ++i) {
+      const auto event = (i == 29) ? 100 - 28 : 100 - i;
+      EXPECT_EQ(sequential->GetEntryNumbers(i / 10, event), parallel->GetEntryNumbers(i / 10, event));
+   }
+}
+#endif
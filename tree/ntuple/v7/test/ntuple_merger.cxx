@@ -79,3 +79,111 @@ TEST(RFieldMerger, Merge)
    auto mergeResult = RFieldMerger::Merge(RFieldDescriptor(), RFieldDescriptor());
    EXPECT_FALSE(mergeResult);
 }
+
+namespace {
+
+void WriteMergerInput(const std::string &path, int first, int compression)
+{
+   auto model = RNTupleModel::Create();
+   auto fldPt = model->MakeField<float>("pt");
+   auto fldVec = model->MakeField<std::vector<std::int32_t>>("vec");
+   RNTupleWriteOptions options;
+   options.SetCompression(compression);
+   auto writer = RNTupleWriter::Recreate(std::move(model), "ntpl", path, options);
+   for (int i = first; i < first + 10; ++i) {
+      *fldPt = i;
+      *fldVec = {i, 2 * i};
+      writer->Fill();
+      if (i % 5 == 4)
+         writer->CommitCluster();
+   }
+}
+
+} // anonymous namespace
+
+TEST(RNTupleMerger, MergeSealedPages)
+{
+   FileRaii fileGuard1("test_ntuple_merger_in1.root");
+   FileRaii fileGuard2("test_ntuple_merger_in2.root");
+   FileRaii fileGuard3("test_ntuple_merger_in3.root");
+   FileRaii fileGuardOut("test_ntuple_merger_out.root");
+   WriteMergerInput(fileGuard1.GetPath(), 0, 505);
+   WriteMergerInput(fileGuard2.GetPath(), 10, 505);
+   // Pages of this source need to be recompressed
+   WriteMergerInput(fileGuard3.GetPath(), 20, 0);
+
+   {
+      std::vector<std::unique_ptr<RPageSource>> sources;
+      sources.emplace_back(RPageSource::Create("ntpl", fileGuard1.GetPath()));
+      sources.emplace_back(RPageSource::Create("ntpl", fileGuard2.GetPath()));
+      sources.emplace_back(RPageSource::Create("ntpl", fileGuard3.GetPath()));
+      std::vector<RPageSource *> sourcePtrs;
+      for (const auto &s : sources)
+         sourcePtrs.emplace_back(s.get());
+
+      RNTupleWriteOptions options;
+      options.SetCompression(505);
+      RPageSinkFile destination("ntpl", fileGuardOut.GetPath(), options);
+      RNTupleMerger merger;
+      merger.Merge(sourcePtrs, destination);
+   }
+
+   auto source1 = RPageSource::Create("ntpl", fileGuard1.GetPath());
+   source1->Attach();
+   auto reader = RNTupleReader::Open("ntpl", fileGuardOut.GetPath());
+   EXPECT_EQ(30U, reader->GetNEntries());
+   const auto &desc = *reader->GetDescriptor();
+   EXPECT_EQ(6U, desc.GetNClusters());
+   EXPECT_EQ(3U, desc.GetNClusterGroups());
+
+   // The pages of the first source are copied verbatim
+   const auto columnId = desc.FindPhysicalColumnId(desc.FindFieldId("pt"), 0);
+   const auto clusterId = desc.FindClusterId(columnId, 0);
+   const auto &pageRange = desc.GetClusterDescriptor(clusterId).GetPageRange(columnId);
+   {
+      auto descGuard = source1->GetSharedDescriptorGuard();
+      const auto sourceColumnId = descGuard->FindPhysicalColumnId(descGuard->FindFieldId("pt"), 0);
+      const auto &sourcePageRange =
+         descGuard->GetClusterDescriptor(descGuard->FindClusterId(sourceColumnId, 0)).GetPageRange(sourceColumnId);
+      ASSERT_EQ(sourcePageRange.fPageInfos.size(), pageRange.fPageInfos.size());
+      for (std::size_t i = 0; i < pageRange.fPageInfos.size(); ++i) {
+         EXPECT_EQ(sourcePageRange.fPageInfos[i].fLocator.fBytesOnStorage,
+                   pageRange.fPageInfos[i].fLocator.fBytesOnStorage);
+      }
+   }
+   for (const auto &c : desc.GetClusterIterable())
+      EXPECT_EQ(505, c.GetColumnRange(columnId).fCompressionSettings);
+
+   auto pt = reader->GetView<float>("pt");
+   auto vec = reader->GetView<std::vector<std::int32_t>>("vec");
+   for (auto i : reader->GetEntryRange()) {
+      EXPECT_FLOAT_EQ(static_cast<float>(i), pt(i));
+      EXPECT_EQ(std::vector<std::int32_t>({static_cast<std::int32_t>(i), static_cast<std::int32_t>(2 * i)}), vec(i));
+   }
+}
+
+TEST(RNTupleMerger, IncompatibleSchema)
+{
+   FileRaii fileGuard1("test_ntuple_merger_incompatible_in1.root");
+   FileRaii fileGuard2("test_ntuple_merger_incompatible_in2.root");
+   FileRaii fileGuardOut("test_ntuple_merger_incompatible_out.root");
+   WriteMergerInput(fileGuard1.GetPath(), 0, 505);
+   {
+      auto model = RNTupleModel::Create();
+      auto fldPt = model->MakeField<double>("pt");
+      auto writer = RNTupleWriter::Recreate(std::move(model), "ntpl", fileGuard2.GetPath());
+      writer->Fill();
+   }
+
+   auto source1 = RPageSource::Create("ntpl", fileGuard1.GetPath());
+   auto source2 = RPageSource::Create("ntpl", fileGuard2.GetPath());
+   std::vector<RPageSource *> sourcePtrs{source1.get(), source2.get()};
+   RPageSinkFile destination("ntpl", fileGuardOut.GetPath(), RNTupleWriteOptions());
+   RNTupleMerger merger;
+   try {
+      merger.Merge(sourcePtrs, destination);
+      FAIL() << "merging ntuples with different schemas should throw";
+   } catch (const RException &err) {
+      EXPECT_THAT(err.what(), testing::HasSubstr("incompatible schema"));
+   }
+}
@@ -6,6 +6,7 @@
 #include <limits>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 template <typename PodT, typename NarrowT, ROOT::Experimental::EColumnType ColumnT>
 struct Helper {
@@ -108,6 +109,55 @@ TEST(Packing, RColumnSwitch)
    EXPECT_EQ(0x55, s2.GetTag());
 }
 
+TEST(Packing, Real32Quant)
+{
+   ROOT::Experimental::Detail::RColumnElement<double, ROOT::Experimental::EColumnType::kReal32Quant> element;
+   element.Pack(nullptr, nullptr, 0);
+   element.Unpack(nullptr, nullptr, 0);
+
+   EXPECT_THROW(element.SetQuantization(0, 0., 1.), RException);
+   EXPECT_THROW(element.SetQuantization(33, 0., 1.), RException);
+   EXPECT_THROW(element.SetQuantization(12, 1., 1.), RException);
+
+   // 3 bits over [0, 7] represent the integers 0 to 7 exactly
+   element.SetQuantization(3, 0., 7.);
+   EXPECT_EQ(3u, element.GetBitsOnStorage());
+   EXPECT_EQ(3u, element.GetPackedSize(8));
+   std::array<double, 8> mem{0., 1., 2., 3., 4., 5., 6., 7.};
+   unsigned char packed[3] = {0, 0, 0};
+   element.Pack(packed, mem.data(), mem.size());
+   // Little-endian bit order: 000 001 010 011 100 101 110 111
+   EXPECT_EQ(0x88, packed[0]);
+   EXPECT_EQ(0xc6, packed[1]);
+   EXPECT_EQ(0xfa, packed[2]);
+   std::array<double, 8> cmp;
+   element.Unpack(cmp.data(), packed, cmp.size());
+   EXPECT_EQ(mem, cmp);
+
+   // Values outside the range and NaN are clamped
+   std::array<double, 3> outOfRange{-1., 8., std::numeric_limits<double>::quiet_NaN()};
+   element.Pack(packed, outOfRange.data(), outOfRange.size());
+   std::array<double, 3> clamped;
+   element.Unpack(clamped.data(), packed, clamped.size());
+   EXPECT_EQ(0., clamped[0]);
+   EXPECT_EQ(7., clamped[1]);
+   EXPECT_EQ(0., clamped[2]);
+
+   // The quantization error is at most half a step
+   element.SetQuantization(13, -1., 1.);
+   constexpr std::size_t kNElements = 1000;
+   std::array<double, kNElements> values;
+   for (std::size_t i = 0; i < kNElements; ++i)
+      values[i] = -1. + 2. * i / (kNElements - 1);
+   std::vector<unsigned char> buffer(element.GetPackedSize(kNElements));
+   element.Pack(buffer.data(), values.data(), kNElements);
+   std::array<double, kNElements> unpacked;
+   element.Unpack(unpacked.data(), buffer.data(), kNElements);
+   const double halfStep = 1. / ((1 << 13) - 1);
+   for (std::size_t i = 0; i < kNElements; ++i)
+      EXPECT_NEAR(values[i], unpacked[i], halfStep * (1 + 1e-9));
+}
+
 TYPED_TEST(PackingReal, SplitReal)
 {
    using Pod_t = typename TestFixture::Helper_t::Pod_t;
@@ -56,3 +56,52 @@ TEST(Pages, Pool)
    page = pool.GetPage(1, 55);
    EXPECT_TRUE(page.IsNull());
 }
+
+TEST(Pages, PoolMemoryBudget)
+{
+   const auto globalUsage = RPagePool::GetGlobalMemoryUsage();
+   unsigned char buffer[40];
+   unsigned int nCallDeleter = 0;
+   auto deleter = RPageDeleter([&nCallDeleter](const RPage & /*page*/, void * /*userData*/) { nCallDeleter++; });
+
+   RPagePool pool1;
+   RPagePool pool2;
+   // Four pages of 10 bytes in two different pools, used in the order page0, page1, page2, page3
+   std::vector<RPage> pages;
+   for (unsigned int i = 0; i < 4; ++i) {
+      pages.emplace_back(RPage(1, &buffer[10 * i], 1, 10));
+      pages.back().GrowUnchecked(10);
+      pages.back().SetWindow(10 * i, RPage::RClusterInfo(0, 0));
+   }
+   pool1.PreloadPage(pages[0], deleter);
+   pool2.PreloadPage(pages[1], deleter);
+   pool1.PreloadPage(pages[2], deleter);
+   pool2.RegisterPage(pages[3], deleter);
+   EXPECT_EQ(20U, pool1.GetMemoryUsage());
+   EXPECT_EQ(20U, pool2.GetMemoryUsage());
+   EXPECT_EQ(globalUsage + 40U, RPagePool::GetGlobalMemoryUsage());
+
+   auto page = pool1.GetPage(1, 5);
+   EXPECT_EQ(pages[0], page);
+   pool1.ReturnPage(page);
+   EXPECT_EQ(1U, nCallDeleter);
+   // Page 0 has been deleted after use, thus page1 is the least-recently used one
+   RPagePool::SetMemoryBudget(globalUsage + 20U);
+   EXPECT_EQ(globalUsage + 20U, RPagePool::GetMemoryBudget());
+   EXPECT_EQ(2U, nCallDeleter);
+   EXPECT_TRUE(pool2.GetPage(1, 15).IsNull());
+   EXPECT_EQ(10U, pool1.GetMemoryUsage());
+   EXPECT_EQ(10U, pool2.GetMemoryUsage());
+
+   // Pages in use are never evicted
+   RPagePool::SetMemoryBudget(1);
+   EXPECT_EQ(3U, nCallDeleter);
+   EXPECT_TRUE(pool1.GetPage(1, 25).IsNull());
+   EXPECT_EQ(10U, pool2.GetMemoryUsage());
+   page = pool2.GetPage(1, 35);
+   EXPECT_EQ(pages[3], page);
+   pool2.ReturnPage(page);
+   EXPECT_EQ(3U, nCallDeleter);
+
+   RPagePool::SetMemoryBudget(0);
+}
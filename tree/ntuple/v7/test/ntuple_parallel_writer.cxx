@@ -0,0 +1,105 @@
+#include "ntuple_test.hxx"
+
+TEST(RNTupleParallelWriter, Basics)
+{
+   FileRaii fileGuard("test_ntuple_parallel_writer_basics.root");
+
+   auto model = RNTupleModel::Create();
+   model->MakeField<float>("pt");
+   model->MakeField<std::vector<int>>("vec");
+
+   {
+      auto writer = RNTupleParallelWriter::Recreate(std::move(model), "ntpl", fileGuard.GetPath());
+      auto context1 = writer->CreateFillContext();
+      auto context2 = writer->CreateFillContext();
+
+      auto entry1 = context1->CreateEntry();
+      *entry1->Get<float>("pt") = 1.0;
+      *entry1->Get<std::vector<int>>("vec") = {1, 2};
+      context1->Fill(*entry1);
+
+      auto pt2 = context2->GetDefaultEntry()->Get<float>("pt");
+      auto vec2 = context2->GetDefaultEntry()->Get<std::vector<int>>("vec");
+      *pt2 = 2.0;
+      *vec2 = {3};
+      context2->Fill();
+      context2->CommitCluster();
+      context1->CommitCluster();
+
+      // Entries of one fill context cannot be filled through another fill context
+      EXPECT_THROW(context2->Fill(*entry1), RException);
+   }
+
+   auto reader = RNTupleReader::Open("ntpl", fileGuard.GetPath());
+   EXPECT_EQ(2u, reader->GetNEntries());
+   EXPECT_EQ(2u, reader->GetDescriptor()->GetNClusters());
+   auto viewPt = reader->GetView<float>("pt");
+   auto viewVec = reader->GetView<std::vector<int>>("vec");
+   // context2 committed its cluster first
+   EXPECT_FLOAT_EQ(2.0, viewPt(0));
+   EXPECT_EQ(std::vector<int>{3}, viewVec(0));
+   EXPECT_FLOAT_EQ(1.0, viewPt(1));
+   EXPECT_EQ((std::vector<int>{1, 2}), viewVec(1));
+}
+
+TEST(RNTupleParallelWriter, RejectBufferedSink)
+{
+   FileRaii fileGuard("test_ntuple_parallel_writer_buffered.root");
+
+   auto model = RNTupleModel::Create();
+   auto sink = std::make_unique<RPageSinkBuf>(
+      std::make_unique<RPageSinkFile>("ntpl", fileGuard.GetPath(), RNTupleWriteOptions()));
+   EXPECT_THROW(RNTupleParallelWriter(std::move(model), std::move(sink)), RException);
+}
+
+TEST(RNTupleParallelWriter, Threads)
+{
+   FileRaii fileGuard("test_ntuple_parallel_writer_threads.root");
+
+   constexpr int kNThreads = 4;
+   constexpr int kNEntriesPerThread = 10000;
+
+   auto model = RNTupleModel::Create();
+   model->MakeField<int>("thread");
+   model->MakeField<int>("i");
+
+   {
+      RNTupleWriteOptions options;
+      options.SetApproxZippedClusterSize(4096);
+      auto writer = RNTupleParallelWriter::Recreate(std::move(model), "ntpl", fileGuard.GetPath(), options);
+
+      std::vector<std::thread> threads;
+      for (int t = 0; t < kNThreads; ++t) {
+         threads.emplace_back([&writer, t]() {
+            auto context = writer->CreateFillContext();
+            auto fldThread = context->GetDefaultEntry()->Get<int>("thread");
+            auto fldI = context->GetDefaultEntry()->Get<int>("i");
+            for (int i = 0; i < kNEntriesPerThread; ++i) {
+               *fldThread = t;
+               *fldI = i;
+               context->Fill();
+            }
+         });
+      }
+      for (auto &t : threads)
+         t.join();
+   }
+
+   auto reader = RNTupleReader::Open("ntpl", fileGuard.GetPath());
+   ASSERT_EQ(static_cast<NTupleSize_t>(kNThreads * kNEntriesPerThread), reader->GetNEntries());
+   EXPECT_GT(reader->GetDescriptor()->GetNClusters(), static_cast<std::size_t>(kNThreads));
+
+   auto viewThread = reader->GetView<int>("thread");
+   auto viewI = reader->GetView<int>("i");
+   // Within one fill context, the order of entries is preserved
+   std::vector<int> expectedNext(kNThreads, 0);
+   for (auto idx : reader->GetEntryRange()) {
+      const auto t = viewThread(idx);
+      ASSERT_GE(t, 0);
+      ASSERT_LT(t, kNThreads);
+      EXPECT_EQ(expectedNext[t], viewI(idx));
+      expectedNext[t]++;
+   }
+   for (int t = 0; t < kNThreads; ++t)
+      EXPECT_EQ(kNEntriesPerThread, expectedNext[t]);
+}
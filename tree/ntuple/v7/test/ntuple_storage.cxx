@@ -1,5 +1,7 @@
 #include "ntuple_test.hxx"
 
+#include <limits>
+
 namespace {
 /// An RPageSink that keeps counters of (vector) commit of (sealed) pages; used to test RPageSinkBuf
 class RPageSinkMock : public RPageSink {
@@ -120,6 +122,41 @@ TEST(RNTuple, Extended)
    EXPECT_EQ(chksumRead, chksumWrite);
 }
 
+TEST(RNTuple, Mmap)
+{
+   FileRaii fileGuard("test_ntuple_mmap.root");
+
+   auto model = RNTupleModel::Create();
+   auto wrPt = model->MakeField<float>("pt");
+   auto wrVector = model->MakeField<std::vector<double>>("vector");
+   {
+      RNTupleWriteOptions options;
+      options.SetCompression(0);
+      auto ntuple = RNTupleWriter::Recreate(std::move(model), "ntpl", fileGuard.GetPath(), options);
+      for (unsigned int i = 0; i < 1000; ++i) {
+         *wrPt = i;
+         wrVector->assign(i % 10, i);
+         ntuple->Fill();
+         if (i % 100 == 0)
+            ntuple->CommitCluster();
+      }
+   }
+
+   for (auto clusterCache : {RNTupleReadOptions::EClusterCache::kOn, RNTupleReadOptions::EClusterCache::kOff}) {
+      RNTupleReadOptions options;
+      options.SetUseMmap(true);
+      options.SetClusterCache(clusterCache);
+      auto ntuple = RNTupleReader::Open("ntpl", fileGuard.GetPath(), options);
+      auto rdPt = ntuple->GetModel()->GetDefaultEntry()->Get<float>("pt");
+      auto rdVector = ntuple->GetModel()->GetDefaultEntry()->Get<std::vector<double>>("vector");
+      for (auto i : ntuple->GetEntryRange()) {
+         ntuple->LoadEntry(i);
+         EXPECT_FLOAT_EQ(static_cast<float>(i), *rdPt);
+         EXPECT_EQ(std::vector<double>(i % 10, i), *rdVector);
+      }
+   }
+}
+
 TEST(RNTuple, InvalidWriteOptions) {
    RNTupleWriteOptions options;
    try {
@@ -423,6 +460,50 @@ TEST(RPageSinkBuf, ParallelZip) {
    }
 }
 
+TEST(RPageSinkBuf, MaxUnsealedPages)
+{
+#ifdef R__USE_IMT
+   ROOT::EnableImplicitMT();
+#endif
+
+   FileRaii fileGuard("test_ntuple_sinkbuf_max_unsealed.root");
+   {
+      auto model = RNTupleModel::Create();
+      auto fldPt = model->MakeField<float>("pt");
+      auto fldStr = model->MakeField<std::string>("str");
+      RNTupleWriteOptions options;
+      options.SetApproxUnzippedPageSize(64);
+      options.SetMaxUnsealedPages(2);
+      auto ntuple = std::make_unique<RNTupleWriter>(
+         std::move(model),
+         std::make_unique<RPageSinkBuf>(std::make_unique<RPageSinkFile>("ntpl", fileGuard.GetPath(), options)));
+      ntuple->EnableMetrics();
+      for (int i = 0; i < 1000; i++) {
+         *fldPt = static_cast<float>(i);
+         *fldStr = std::to_string(i);
+         ntuple->Fill();
+      }
+      ntuple->CommitCluster();
+      auto *queueFull = ntuple->GetMetrics().GetCounter("RNTupleWriter.RPageSinkBuf.nZipQueueFull");
+      ASSERT_FALSE(queueFull == nullptr);
+#ifdef R__USE_IMT
+      EXPECT_GT(queueFull->GetValueAsInt(), 0);
+#else
+      EXPECT_EQ(0, queueFull->GetValueAsInt());
+#endif
+   }
+
+   auto ntuple = RNTupleReader::Open("ntpl", fileGuard.GetPath());
+   EXPECT_EQ(1000U, ntuple->GetNEntries());
+   EXPECT_EQ(1U, ntuple->GetDescriptor()->GetNClusters());
+   auto viewPt = ntuple->GetView<float>("pt");
+   auto viewStr = ntuple->GetView<std::string>("str");
+   for (auto i : ntuple->GetEntryRange()) {
+      EXPECT_FLOAT_EQ(static_cast<float>(i), viewPt(i));
+      EXPECT_EQ(std::to_string(i), viewStr(i));
+   }
+}
+
 TEST(RPageSinkBuf, CommitSealedPageV)
 {
    RNTupleWriteOptions options;
@@ -527,3 +608,194 @@ TEST(RPageSink, MultipleClusterGroups)
    ntuple->LoadEntry(2);
    EXPECT_EQ(12.0, *rdPt);
 }
+
+TEST(RPageSourceFile, LoadClusterGroupsOnDemand)
+{
+   FileRaii fileGuard("test_ntuple_cluster_groups_on_demand.ntuple");
+
+   auto model = RNTupleModel::Create();
+   auto wrPt = model->MakeField<float>("pt");
+
+   {
+      auto ntuple = RNTupleWriter::Recreate(std::move(model), "f", fileGuard.GetPath());
+      for (int i = 0; i < 3; ++i) {
+         *wrPt = i;
+         ntuple->Fill();
+         ntuple->CommitCluster(true /* commitClusterGroup */);
+      }
+   }
+
+   RNTupleReadOptions options;
+   options.SetLoadClusterGroupsOnDemand(true);
+   RPageSourceFile source("f", fileGuard.GetPath(), options);
+   source.Attach();
+   {
+      auto descriptorGuard = source.GetSharedDescriptorGuard();
+      EXPECT_EQ(3U, descriptorGuard->GetNClusterGroups());
+      EXPECT_EQ(3U, descriptorGuard->GetNClusters());
+      EXPECT_EQ(3U, descriptorGuard->GetNEntries());
+      EXPECT_FALSE(descriptorGuard->GetClusterDescriptor(0).HasPageLocations());
+      EXPECT_FALSE(descriptorGuard->GetClusterDescriptor(1).HasPageLocations());
+      EXPECT_TRUE(descriptorGuard->GetClusterDescriptor(2).HasPageLocations());
+   }
+
+   source.EnsureClusterDetails(1);
+   {
+      auto descriptorGuard = source.GetSharedDescriptorGuard();
+      EXPECT_FALSE(descriptorGuard->GetClusterDescriptor(0).HasPageLocations());
+      EXPECT_TRUE(descriptorGuard->GetClusterDescriptor(1).HasPageLocations());
+   }
+
+   auto ntuple = RNTupleReader::Open("f", fileGuard.GetPath(), options);
+   EXPECT_EQ(3U, ntuple->GetNEntries());
+   auto rdPt = ntuple->GetModel()->GetDefaultEntry()->Get<float>("pt");
+   ntuple->LoadEntry(0);
+   EXPECT_EQ(0.0, *rdPt);
+   ntuple->LoadEntry(2);
+   EXPECT_EQ(2.0, *rdPt);
+   ntuple->LoadEntry(1);
+   EXPECT_EQ(1.0, *rdPt);
+   EXPECT_TRUE(ntuple->GetDescriptor()->GetClusterDescriptor(0).HasPageLocations());
+}
+
+TEST(RPageSink, ColumnStatistics)
+{
+   FileRaii fileGuard("test_ntuple_column_statistics.ntuple");
+
+   for (bool useBufferedWrite : {false, true}) {
+      auto model = RNTupleModel::Create();
+      auto wrPt = model->MakeField<float>("pt");
+      auto wrN = model->MakeField<std::int64_t>("n");
+      auto wrTag = model->MakeField<std::string>("tag");
+
+      RNTupleWriteOptions options;
+      options.SetHasColumnStatistics(true);
+      options.SetUseBufferedWrite(useBufferedWrite);
+      {
+         auto ntuple = RNTupleWriter::Recreate(std::move(model), "ntpl", fileGuard.GetPath(), options);
+         // Cluster 0: pt in [1, 3], cluster 1: pt in [10, 12], cluster 2: pt in [-5, -5] and NaN
+         for (int c = 0; c < 2; ++c) {
+            for (int i = 1; i <= 3; ++i) {
+               *wrPt = 9.0 * c + i;
+               *wrN = -i;
+               *wrTag = "x";
+               ntuple->Fill();
+            }
+            ntuple->CommitCluster();
+         }
+         *wrPt = -5.0;
+         ntuple->Fill();
+         *wrPt = std::numeric_limits<float>::quiet_NaN();
+         ntuple->Fill();
+      }
+
+      auto ntuple = RNTupleReader::Open("ntpl", fileGuard.GetPath());
+      const auto *desc = ntuple->GetDescriptor();
+      ASSERT_EQ(3U, desc->GetNClusters());
+      const auto ptColumnId = desc->FindPhysicalColumnId(desc->FindFieldId("pt"), 0);
+      const auto nColumnId = desc->FindPhysicalColumnId(desc->FindFieldId("n"), 0);
+      const auto tagColumnId = desc->FindPhysicalColumnId(desc->FindFieldId("tag"), 1);
+
+      const auto &stats0 = desc->GetClusterDescriptor(0).GetColumnRange(ptColumnId).fStatistics;
+      EXPECT_TRUE(stats0.fIsValid);
+      EXPECT_EQ(1.0, stats0.fMin);
+      EXPECT_EQ(3.0, stats0.fMax);
+      const auto &stats2 = desc->GetClusterDescriptor(2).GetColumnRange(ptColumnId).fStatistics;
+      EXPECT_TRUE(stats2.fIsValid);
+      EXPECT_EQ(-5.0, stats2.fMin);
+      EXPECT_EQ(-5.0, stats2.fMax);
+      const auto &statsN = desc->GetClusterDescriptor(1).GetColumnRange(nColumnId).fStatistics;
+      EXPECT_TRUE(statsN.fIsValid);
+      EXPECT_LE(statsN.fMin, -3.0);
+      EXPECT_GE(statsN.fMax, -1.0);
+      // No value statistics for characters
+      EXPECT_FALSE(desc->GetClusterDescriptor(0).GetColumnRange(tagColumnId).fStatistics.fIsValid);
+
+      auto ranges = ntuple->GetMatchingClusterRanges("pt", 11.5, 20.0);
+      ASSERT_EQ(1U, ranges.size());
+      EXPECT_EQ(3U, *ranges[0].begin());
+      EXPECT_EQ(6U, *ranges[0].end());
+      // Adjacent matching clusters are coalesced
+      ranges = ntuple->GetMatchingClusterRanges("pt", 2.0, 10.0);
+      ASSERT_EQ(1U, ranges.size());
+      EXPECT_EQ(0U, *ranges[0].begin());
+      EXPECT_EQ(6U, *ranges[0].end());
+      EXPECT_TRUE(ntuple->GetMatchingClusterRanges("pt", 4.0, 9.0).empty());
+      // Clusters without statistics always match
+      EXPECT_EQ(1U, ntuple->GetMatchingClusterRanges("tag", 100.0, 200.0).size());
+      EXPECT_THROW(ntuple->GetMatchingClusterRanges("missing", 0.0, 1.0), RException);
+   }
+}
+
+TEST(RPageSinkShards, RoundRobin)
+{
+   FileRaii fileGuard("test_ntuple_shards_rr.root");
+   FileRaii shardGuard0(RPageSinkShards::GetShardFileName(fileGuard.GetPath(), 0));
+   FileRaii shardGuard1(RPageSinkShards::GetShardFileName(fileGuard.GetPath(), 1));
+   EXPECT_EQ("test_ntuple_shards_rr_1.root", shardGuard1.GetPath());
+
+   {
+      auto model = RNTupleModel::Create();
+      auto wrPt = model->MakeField<float>("pt");
+      auto wrJets = model->MakeField<std::vector<float>>("jets");
+      RNTupleWriteOptions options;
+      options.SetNShards(2);
+      auto writer = RNTupleWriter::Recreate(std::move(model), "ntpl", fileGuard.GetPath(), options);
+      for (int i = 0; i < 6; ++i) {
+         *wrPt = i;
+         wrJets->assign(i, static_cast<float>(i));
+         writer->Fill();
+         if (i % 2 == 1)
+            writer->CommitCluster();
+      }
+   }
+
+   // Clusters 0 and 2 went to the first shard, cluster 1 to the second one
+   auto shard0 = RNTupleReader::Open("ntpl", shardGuard0.GetPath());
+   EXPECT_EQ(4U, shard0->GetNEntries());
+   auto shard1 = RNTupleReader::Open("ntpl", shardGuard1.GetPath());
+   EXPECT_EQ(2U, shard1->GetNEntries());
+
+   auto reader = RNTupleReader::OpenShards("ntpl", fileGuard.GetPath());
+   ASSERT_EQ(6U, reader->GetNEntries());
+   EXPECT_EQ(3U, reader->GetDescriptor()->GetNClusters());
+   auto viewPt = reader->GetView<float>("pt");
+   auto viewJets = reader->GetView<std::vector<float>>("jets");
+   const std::vector<float> expected{0, 1, 4, 5, 2, 3};
+   for (auto i : reader->GetEntryRange()) {
+      EXPECT_FLOAT_EQ(expected[i], viewPt(i));
+      ASSERT_EQ(static_cast<std::size_t>(expected[i]), viewJets(i).size());
+      for (auto v : viewJets(i))
+         EXPECT_FLOAT_EQ(expected[i], v);
+   }
+}
+
+TEST(RPageSinkShards, Rollover)
+{
+   FileRaii fileGuard("test_ntuple_shards_rollover.root");
+   std::vector<std::unique_ptr<FileRaii>> shardGuards;
+   for (int i = 0; i < 3; ++i)
+      shardGuards.emplace_back(std::make_unique<FileRaii>(RPageSinkShards::GetShardFileName(fileGuard.GetPath(), i)));
+
+   {
+      auto model = RNTupleModel::Create();
+      auto wrPt = model->MakeField<float>("pt");
+      RNTupleWriteOptions options;
+      options.SetMaxShardSize(1);
+      auto writer = RNTupleWriter::Recreate(std::move(model), "ntpl", fileGuard.GetPath(), options);
+      for (int i = 0; i < 3; ++i) {
+         *wrPt = i;
+         writer->Fill();
+         writer->CommitCluster();
+      }
+   }
+
+   auto reader = RNTupleReader::OpenShards("ntpl", fileGuard.GetPath());
+   ASSERT_EQ(3U, reader->GetNEntries());
+   auto viewPt = reader->GetView<float>("pt");
+   for (auto i : reader->GetEntryRange())
+      EXPECT_FLOAT_EQ(static_cast<float>(i), viewPt(i));
+
+   RNTupleWriteOptions options;
+   EXPECT_THROW(options.SetNShards(0), RException);
+}
@@ -154,6 +154,44 @@ TEST_F(RPageStorageDaos, Options)
    EXPECT_EQ(1U, source.GetNEntries());
 }
 
+TEST_F(RPageStorageDaos, StripedContainers)
+{
+   std::string daosUri = RegisterLabel("ntuple-test-striped");
+   RegisterLabel("ntuple-test-striped-1");
+   RegisterLabel("ntuple-test-striped-2");
+   const std::string_view ntupleName("ntuple");
+   auto model = RNTupleModel::Create();
+   auto wrPt = model->MakeField<float>("pt");
+   auto wrVector = model->MakeField<std::vector<double>>("vector");
+
+   {
+      RNTupleWriteOptionsDaos options;
+      EXPECT_THROW(options.SetNStripes(0), RException);
+      options.SetNStripes(3);
+      auto ntuple = RNTupleWriter::Recreate(std::move(model), ntupleName, daosUri, options);
+      for (unsigned int i = 0; i < 100; ++i) {
+         *wrPt = i;
+         wrVector->assign(i % 5, i);
+         ntuple->Fill();
+         if (i % 10 == 9)
+            ntuple->CommitCluster();
+      }
+   }
+
+   RNTupleReadOptions options;
+   options.SetClusterBunchSize(4);
+   auto ntuple = RNTupleReader::Open(ntupleName, daosUri, options);
+   EXPECT_EQ(100U, ntuple->GetNEntries());
+   EXPECT_EQ(10U, ntuple->GetDescriptor()->GetNClusters());
+   auto rdPt = ntuple->GetModel()->GetDefaultEntry()->Get<float>("pt");
+   auto rdVector = ntuple->GetModel()->GetDefaultEntry()->Get<std::vector<double>>("vector");
+   for (auto i : *ntuple) {
+      ntuple->LoadEntry(i);
+      EXPECT_EQ(static_cast<float>(i), *rdPt);
+      EXPECT_EQ(std::vector<double>(i % 5, i), *rdVector);
+   }
+}
+
 TEST_F(RPageStorageDaos, MultipleNTuplesPerContainer)
 {
    std::string daosUri = RegisterLabel("ntuple-test-multiple");
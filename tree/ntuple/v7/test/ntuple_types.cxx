@@ -818,6 +818,87 @@ TEST(RNTuple, Casting)
    EXPECT_EQ(137, *fieldCast2);
 }
 
+TEST(RNTuple, NarrowIntegerColumns)
+{
+   FileRaii fileGuard("test_ntuple_narrow_integer_columns.root");
+
+   auto fldU32 = RFieldBase::Create("u32", "std::uint32_t").Unwrap();
+   fldU32->SetColumnRepresentative({EColumnType::kSplitUInt16});
+   auto fldI32 = RFieldBase::Create("i32", "std::int32_t").Unwrap();
+   fldI32->SetColumnRepresentative({EColumnType::kSplitInt16});
+   auto fldU64 = RFieldBase::Create("u64", "std::uint64_t").Unwrap();
+   fldU64->SetColumnRepresentative({EColumnType::kUInt32});
+   auto fldI16 = RFieldBase::Create("i16", "std::int16_t").Unwrap();
+   fldI16->SetColumnRepresentative({EColumnType::kInt8});
+
+   auto model = RNTupleModel::Create();
+   model->AddField(std::move(fldU32));
+   model->AddField(std::move(fldI32));
+   model->AddField(std::move(fldU64));
+   model->AddField(std::move(fldI16));
+   {
+      auto writer = RNTupleWriter::Recreate(std::move(model), "ntuple", fileGuard.GetPath());
+      auto entry = writer->GetModel()->GetDefaultEntry();
+      for (int i = 0; i < 100; ++i) {
+         *entry->Get<std::uint32_t>("u32") = 60000 + i;
+         *entry->Get<std::int32_t>("i32") = -100 * i;
+         *entry->Get<std::uint64_t>("u64") = 4000000000ULL + i;
+         *entry->Get<std::int16_t>("i16") = i - 50;
+         writer->Fill();
+      }
+   }
+
+   auto reader = RNTupleReader::Open("ntuple", fileGuard.GetPath());
+   const auto *desc = reader->GetDescriptor();
+   auto columnTypeOf = [desc](const std::string &fieldName) {
+      return (*desc->GetColumnIterable(desc->FindFieldId(fieldName)).begin()).GetModel().GetType();
+   };
+   EXPECT_EQ(EColumnType::kSplitUInt16, columnTypeOf("u32"));
+   EXPECT_EQ(EColumnType::kSplitInt16, columnTypeOf("i32"));
+   EXPECT_EQ(EColumnType::kUInt32, columnTypeOf("u64"));
+   EXPECT_EQ(EColumnType::kInt8, columnTypeOf("i16"));
+
+   auto u32 = reader->GetModel()->GetDefaultEntry()->Get<std::uint32_t>("u32");
+   auto i32 = reader->GetModel()->GetDefaultEntry()->Get<std::int32_t>("i32");
+   auto u64 = reader->GetModel()->GetDefaultEntry()->Get<std::uint64_t>("u64");
+   auto i16 = reader->GetModel()->GetDefaultEntry()->Get<std::int16_t>("i16");
+   EXPECT_EQ(100U, reader->GetNEntries());
+   for (int i = 0; i < 100; ++i) {
+      reader->LoadEntry(i);
+      EXPECT_EQ(60000U + i, *u32);
+      EXPECT_EQ(-100 * i, *i32);
+      EXPECT_EQ(4000000000ULL + i, *u64);
+      EXPECT_EQ(i - 50, *i16);
+   }
+
+   FileRaii fileGuardOverflow("test_ntuple_narrow_integer_columns_overflow.root");
+   auto fldOverflow = RFieldBase::Create("u32", "std::uint32_t").Unwrap();
+   fldOverflow->SetColumnRepresentative({EColumnType::kUInt16});
+   auto modelOverflow = RNTupleModel::Create();
+   modelOverflow->AddField(std::move(fldOverflow));
+   auto writer = RNTupleWriter::Recreate(std::move(modelOverflow), "ntuple", fileGuardOverflow.GetPath());
+   *writer->GetModel()->GetDefaultEntry()->Get<std::uint32_t>("u32") = 65535;
+   writer->Fill();
+   *writer->GetModel()->GetDefaultEntry()->Get<std::uint32_t>("u32") = 70000;
+   // The value is rejected on filling, not only later on packing the page when committing the cluster
+   try {
+      writer->Fill();
+      FAIL() << "storing an out-of-range value in a narrow column should throw";
+   } catch (const RException &err) {
+      EXPECT_THAT(err.what(), testing::HasSubstr("out of range"));
+   }
+
+   // Values of collection items are checked in the same way
+   FileRaii fileGuardItems("test_ntuple_narrow_integer_columns_items.root");
+   auto fldItems = RFieldBase::Create("v", "std::vector<std::int32_t>").Unwrap();
+   fldItems->begin()->SetColumnRepresentative({EColumnType::kInt8});
+   auto modelItems = RNTupleModel::Create();
+   modelItems->AddField(std::move(fldItems));
+   auto writerItems = RNTupleWriter::Recreate(std::move(modelItems), "ntuple", fileGuardItems.GetPath());
+   *writerItems->GetModel()->GetDefaultEntry()->Get<std::vector<std::int32_t>>("v") = {-128, 127, 128};
+   EXPECT_THROW(writerItems->Fill(), RException);
+}
+
 TEST(RNTuple, Double32)
 {
    FileRaii fileGuard("test_ntuple_double32.root");
@@ -898,6 +979,54 @@ TEST(RNTuple, Double32)
    EXPECT_DOUBLE_EQ(std::numeric_limits<float>::denorm_min(), *d2Float);
 }
 
+TEST(RNTuple, Quantized)
+{
+   FileRaii fileGuard("test_ntuple_quantized.root");
+
+   auto model = RNTupleModel::Create();
+   auto fldFloat = std::make_unique<RField<float>>("f");
+   fldFloat->SetQuantized(12, 0., 1.);
+   auto fldDouble = std::make_unique<RField<double>>("d");
+   fldDouble->SetQuantized(20, -100., 100.);
+   EXPECT_THROW(fldDouble->SetQuantized(0, -100., 100.), RException);
+   EXPECT_THROW(fldDouble->SetQuantized(20, 100., -100.), RException);
+   model->AddField(std::move(fldFloat));
+   model->AddField(std::move(fldDouble));
+   auto fldUnset = std::make_unique<RField<float>>("unset");
+   fldUnset->SetColumnRepresentative({EColumnType::kReal32Quant});
+   {
+      auto modelUnset = RNTupleModel::Create();
+      modelUnset->AddField(std::move(fldUnset));
+      FileRaii fileGuardUnset("test_ntuple_quantized_unset.root");
+      EXPECT_THROW(RNTupleWriter::Recreate(std::move(modelUnset), "ntuple", fileGuardUnset.GetPath()), RException);
+   }
+
+   {
+      auto writer = RNTupleWriter::Recreate(std::move(model), "ntuple", fileGuard.GetPath());
+      auto entry = writer->GetModel()->GetDefaultEntry();
+      for (int i = 0; i < 1000; ++i) {
+         *entry->Get<float>("f") = i / 999.f;
+         *entry->Get<double>("d") = -100. + i * 0.2;
+         writer->Fill();
+      }
+   }
+
+   auto reader = RNTupleReader::Open("ntuple", fileGuard.GetPath());
+   const auto *desc = reader->GetDescriptor();
+   const auto &columnDesc = *desc->GetColumnIterable(desc->FindFieldId("d")).begin();
+   EXPECT_EQ(EColumnType::kReal32Quant, columnDesc.GetModel().GetType());
+   EXPECT_EQ(20u, columnDesc.GetModel().GetBitsOnStorage());
+   EXPECT_EQ(-100., columnDesc.GetModel().GetValueMin());
+   EXPECT_EQ(100., columnDesc.GetModel().GetValueMax());
+
+   auto viewFloat = reader->GetView<float>("f");
+   auto viewDouble = reader->GetView<double>("d");
+   for (auto i : reader->GetEntryRange()) {
+      EXPECT_NEAR(i / 999.f, viewFloat(i), 0.5 / 4095 + 1e-7);
+      EXPECT_NEAR(-100. + i * 0.2, viewDouble(i), 100. / ((1 << 20) - 1));
+   }
+}
+
 TEST(RNTuple, Double32Extended)
 {
    FileRaii fileGuard("test_ntuple_double32_extended.root");
@@ -93,6 +93,40 @@ TEST(RNTuple, BulkView)
    }
 }
 
+TEST(RNTuple, BulkViewReadV)
+{
+   FileRaii fileGuard("test_ntuple_bulk_view_readv.root");
+
+   auto model = RNTupleModel::Create();
+   auto fieldPt = model->MakeField<float>("pt");
+   auto eltsPerPage = 1000;
+   {
+      RNTupleWriteOptions opt;
+      opt.SetApproxUnzippedPageSize(eltsPerPage * sizeof(float));
+      auto ntuple = RNTupleWriter::Recreate(std::move(model), "myNTuple", fileGuard.GetPath(), opt);
+      for (int i = 0; i < 10'000; i++) {
+         *fieldPt = i;
+         ntuple->Fill();
+         if (i == 4321)
+            ntuple->CommitCluster();
+      }
+   }
+   auto ntuple = RNTupleReader::Open("myNTuple", fileGuard.GetPath());
+   auto viewPt = ntuple->GetView<float>("pt");
+
+   // The range spans several pages and a cluster boundary
+   std::vector<float> values(5000);
+   viewPt.ReadV(2000, std::span<float>(values.data(), values.size()));
+   for (std::size_t i = 0; i < values.size(); i++) {
+      ASSERT_EQ(static_cast<float>(2000 + i), values[i]) << i;
+   }
+
+   viewPt.ReadV(9999, std::span<float>(values.data(), 1));
+   EXPECT_EQ(9999.f, values[0]);
+   viewPt.ReadV(0, std::span<float>(values.data(), 0));
+   EXPECT_THROW(viewPt.ReadV(9999, std::span<float>(values.data(), 2)), ROOT::Experimental::RException);
+}
+
 TEST(RNTuple, BulkViewCollection)
 {
    FileRaii fileGuard("test_ntuple_bulk_view_collection.root");
@@ -37,6 +37,9 @@ class TLeaf;
 namespace ROOT {
 namespace Experimental {
 
+class RNTupleFillContext;
+class RNTupleParallelWriter;
+
 // clang-format off
 /**
 \class ROOT::Experimental::RNTupleImporter
@@ -87,6 +90,11 @@ Most RNTuple fields have a type identical to the corresponding TTree input branc
       ROOT::RVec<float> jet_eta (projected from _collection0.jet_eta)
     These projections are meta-data only operations and don't involve duplicating the data.
 
+With implicit multi-threading enabled, the pages of the RNTuple are compressed in parallel. In addition, the clusters
+of the TTree can be imported in parallel with `SetUseParallelImport(true)`: every task reads its own copy of the tree
+and fills its own RNTuple clusters through an RNTupleParallelWriter. The entries of different clusters may then be
+written in a different order than in the tree. Chains and trees with leaf count arrays are imported sequentially.
+
 Current limitations of the importer:
   - No support for trees containing TObject (or derived classes) or TClonesArray collections
   - Due to RNTuple currently storing data fully split, "don't split" markers are ignored
@@ -151,6 +159,14 @@ private:
       virtual void ResetEntry() = 0; // called at the end of an entry
    };
 
+   /// The state of a task of the parallel import: a copy of the source tree with its own import buffers, and the
+   /// fill context into which the entries are written
+   struct RImportWorker {
+      std::unique_ptr<RNTupleImporter> fImporter;
+      std::shared_ptr<RNTupleFillContext> fFillContext;
+      std::unique_ptr<REntry> fEntry; ///< An entry of the fill context's model bound to the buffers of fImporter
+   };
+
    /// When the schema is set up and the import started, it needs to be reset before the next Import() call
    /// can start.  This RAII guard ensures that ResetSchema is called.
    struct RImportGuard {
@@ -223,6 +239,8 @@ private:
 
    /// No standard output, conversely if set to false, schema information and progress is printed.
    bool fIsQuiet = false;
+   /// Whether the clusters of the source tree are imported in parallel if IMT is enabled
+   bool fUseParallelImport = false;
    std::unique_ptr<RProgressCallback> fProgressCallback;
 
    std::unique_ptr<RNTupleModel> fModel;
@@ -241,6 +259,11 @@ private:
    /// buffers used for reading and writing.
    RResult<void> PrepareSchema();
    void ReportSchema();
+   /// Binds the values of the entry to the import buffers
+   void CaptureEntryValues(REntry &entry) const;
+   bool CanImportParallel() const;
+   std::unique_ptr<RImportWorker> CreateImportWorker(RNTupleParallelWriter &writer) const;
+   void ImportParallel(std::int64_t nEntries);
 
 public:
    RNTupleImporter(const RNTupleImporter &other) = delete;
@@ -268,6 +291,10 @@ public:
    /// Whether or not information and progress is printed to stdout.
    void SetIsQuiet(bool value) { fIsQuiet = value; }
 
+   /// Whether the clusters of the tree are imported in parallel if implicit multi-threading is enabled. The entries of
+   /// different clusters may then be written in a different order than in the tree.
+   void SetUseParallelImport(bool value) { fUseParallelImport = value; }
+
    /// Import works in two steps:
    /// 1. PrepareSchema() calls SetBranchAddress() on all the TTree branches and creates the corresponding RNTuple
    ///    fields and the model
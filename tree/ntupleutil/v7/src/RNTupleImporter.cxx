@@ -18,7 +18,9 @@
 #include <ROOT/RNTuple.hxx>
 #include <ROOT/RNTupleImporter.hxx>
 #include <ROOT/RNTupleOptions.hxx>
+#include <ROOT/RNTupleParallelWriter.hxx>
 #include <ROOT/RNTupleUtil.hxx>
+#include <ROOT/RPageSinkBuf.hxx>
 #include <ROOT/RPageStorage.hxx>
 #include <ROOT/RPageStorageFile.hxx>
 #include <ROOT/RStringView.hxx>
@@ -31,12 +33,19 @@
 #include <TLeafC.h>
 #include <TLeafElement.h>
 #include <TLeafObject.h>
+#ifdef R__USE_IMT
+#include <ROOT/TThreadExecutor.hxx>
+#include <TROOT.h>
+#endif
 
+#include <algorithm>
 #include <cassert>
 #include <cstdint>
 #include <cstring>
 #include <iostream>
+#include <mutex>
 #include <utility>
+#include <vector>
 
 namespace {
 
@@ -351,37 +360,140 @@ ROOT::Experimental::RResult<void> ROOT::Experimental::RNTupleImporter::PrepareSc
 
    fModel->Freeze();
    fEntry = fModel->CreateBareEntry();
+   CaptureEntryValues(*fEntry);
+
+   if (!fIsQuiet)
+      ReportSchema();
+
+   return RResult<void>::Success();
+}
+
+void ROOT::Experimental::RNTupleImporter::CaptureEntryValues(REntry &entry) const
+{
    for (const auto &f : fImportFields) {
       if (f.fIsInUntypedCollection)
          continue;
-      fEntry->CaptureValueUnsafe(f.fField->GetName(), f.fFieldBuffer);
+      entry.CaptureValueUnsafe(f.fField->GetName(), f.fFieldBuffer);
    }
    for (const auto &[_, c] : fLeafCountCollections) {
-      fEntry->CaptureValueUnsafe(c.fFieldName, c.fCollectionWriter->GetOffsetPtr());
+      entry.CaptureValueUnsafe(c.fFieldName, c.fCollectionWriter->GetOffsetPtr());
    }
+}
 
-   if (!fIsQuiet)
-      ReportSchema();
-
-   return RResult<void>::Success();
+bool ROOT::Experimental::RNTupleImporter::CanImportParallel() const
+{
+#ifdef R__USE_IMT
+   // Every task reads its own copy of the tree, which needs to be reopened from its file. The collection writers of
+   // leaf count arrays are bound to a single ntuple writer.
+   return fUseParallelImport && ROOT::IsImplicitMTEnabled() && fSourceTree->IsA() != TChain::Class() &&
+          fSourceTree->GetCurrentFile() && fSourceTree->GetDirectory() && fLeafCountCollections.empty();
+#else
+   return false;
+#endif
 }
 
-void ROOT::Experimental::RNTupleImporter::Import()
+std::unique_ptr<ROOT::Experimental::RNTupleImporter::RImportWorker>
+ROOT::Experimental::RNTupleImporter::CreateImportWorker(RNTupleParallelWriter &writer) const
 {
-   if (fDestFile->FindKey(fNTupleName.c_str()) != nullptr)
-      throw RException(R__FAIL("Key '" + fNTupleName + "' already exists in file " + fDestFileName));
+   // The path of the tree within its file, e.g. "dir/tree" for a directory path "file.root:/dir"
+   std::string treePath = fSourceTree->GetDirectory()->GetPath();
+   auto posRoot = treePath.find(":/");
+   treePath = (posRoot == std::string::npos) ? "" : treePath.substr(posRoot + 2);
+   treePath += (treePath.empty() ? "" : "/") + std::string(fSourceTree->GetName());
+   const std::string fileName = fSourceTree->GetCurrentFile()->GetName();
+
+   auto worker = std::make_unique<RImportWorker>();
+   worker->fImporter = std::unique_ptr<RNTupleImporter>(new RNTupleImporter());
+   auto &importer = *worker->fImporter;
+   importer.fSourceFile = std::unique_ptr<TFile>(TFile::Open(fileName.c_str()));
+   if (!importer.fSourceFile || importer.fSourceFile->IsZombie())
+      throw RException(R__FAIL("cannot open source file " + fileName));
+   importer.fSourceTree = importer.fSourceFile->Get<TTree>(treePath.c_str());
+   if (!importer.fSourceTree)
+      throw RException(R__FAIL("cannot read TTree " + treePath + " from " + fileName));
+   importer.fSourceTree->SetImplicitMT(false);
+   importer.fIsQuiet = true;
+   importer.fConvertDotsInBranchNames = fConvertDotsInBranchNames;
+   auto result = importer.PrepareSchema();
+   if (!result)
+      throw RException(R__FORWARD_ERROR(result));
 
-   PrepareSchema();
+   worker->fFillContext = writer.CreateFillContext();
+   worker->fEntry = worker->fFillContext->CreateBareEntry();
+   importer.CaptureEntryValues(*worker->fEntry);
+   return worker;
+}
 
+void ROOT::Experimental::RNTupleImporter::ImportParallel(std::int64_t nEntries)
+{
+#ifdef R__USE_IMT
    auto sink = std::make_unique<Detail::RPageSinkFile>(fNTupleName, *fDestFile, fWriteOptions);
    sink->GetMetrics().Enable();
    auto ctrZippedBytes = sink->GetMetrics().GetCounter("RPageSinkFile.szWritePayload");
+   auto writer = std::make_unique<RNTupleParallelWriter>(std::move(fModel), std::move(sink));
+
+   std::vector<std::pair<Long64_t, Long64_t>> clusterRanges;
+   auto clusterIter = fSourceTree->GetClusterIterator(0);
+   for (Long64_t start = clusterIter(); start < nEntries; start = clusterIter())
+      clusterRanges.emplace_back(start, std::min<Long64_t>(clusterIter.GetNextEntry(), nEntries));
+
+   // Workers are created on demand and reused by the following tasks. They need to be destructed before the writer.
+   std::mutex mutex;
+   std::vector<std::unique_ptr<RImportWorker>> workers;
+   std::vector<RImportWorker *> idleWorkers;
+   std::uint64_t nEntriesWritten = 0;
+
+   auto fnImportCluster = [&](const std::pair<Long64_t, Long64_t> &range) {
+      RImportWorker *worker = nullptr;
+      {
+         std::lock_guard<std::mutex> lock(mutex);
+         if (idleWorkers.empty()) {
+            workers.emplace_back(CreateImportWorker(*writer));
+            idleWorkers.emplace_back(workers.back().get());
+         }
+         worker = idleWorkers.back();
+         idleWorkers.pop_back();
+      }
 
-   auto ntplWriter = std::make_unique<RNTupleWriter>(std::move(fModel), std::move(sink));
-   // The guard needs to be destructed before the writer goes out of scope
-   RImportGuard importGuard(*this);
+      auto &importer = *worker->fImporter;
+      for (auto i = range.first; i < range.second; ++i) {
+         importer.fSourceTree->GetEntry(i);
+         for (auto &t : importer.fImportTransformations) {
+            auto result = t->Transform(importer.fImportBranches[t->fImportBranchIdx],
+                                       importer.fImportFields[t->fImportFieldIdx]);
+            if (!result)
+               throw RException(R__FORWARD_ERROR(result));
+            t->ResetEntry();
+         }
+         worker->fFillContext->Fill(*worker->fEntry);
+      }
 
-   fProgressCallback = fIsQuiet ? nullptr : std::make_unique<RDefaultProgressCallback>();
+      std::lock_guard<std::mutex> lock(mutex);
+      idleWorkers.emplace_back(worker);
+      nEntriesWritten += range.second - range.first;
+      if (fProgressCallback)
+         fProgressCallback->Call(ctrZippedBytes->GetValueAsInt(), nEntriesWritten);
+   };
+
+   ROOT::TThreadExecutor pool;
+   pool.Foreach(fnImportCluster, clusterRanges);
+
+   workers.clear();
+   writer.reset();
+   if (fProgressCallback)
+      fProgressCallback->Finish(ctrZippedBytes->GetValueAsInt(), nEntries);
+#else
+   (void)nEntries;
+   throw RException(R__FAIL("parallel import requires IMT"));
+#endif
+}
+
+void ROOT::Experimental::RNTupleImporter::Import()
+{
+   if (fDestFile->FindKey(fNTupleName.c_str()) != nullptr)
+      throw RException(R__FAIL("Key '" + fNTupleName + "' already exists in file " + fDestFileName));
+
+   PrepareSchema();
 
    auto nEntries = fSourceTree->GetEntries();
 
@@ -389,6 +501,27 @@ void ROOT::Experimental::RNTupleImporter::Import()
       nEntries = fMaxEntries;
    }
 
+   if (CanImportParallel()) {
+      RImportGuard importGuard(*this);
+      fProgressCallback = fIsQuiet ? nullptr : std::make_unique<RDefaultProgressCallback>();
+      ImportParallel(nEntries);
+      return;
+   }
+
+   auto fileSink = std::make_unique<Detail::RPageSinkFile>(fNTupleName, *fDestFile, fWriteOptions);
+   fileSink->GetMetrics().Enable();
+   auto ctrZippedBytes = fileSink->GetMetrics().GetCounter("RPageSinkFile.szWritePayload");
+   // With IMT enabled, the buffered sink compresses the pages of a cluster in parallel
+   std::unique_ptr<Detail::RPageSink> sink = std::move(fileSink);
+   if (fWriteOptions.GetUseBufferedWrite())
+      sink = std::make_unique<Detail::RPageSinkBuf>(std::move(sink));
+
+   auto ntplWriter = std::make_unique<RNTupleWriter>(std::move(fModel), std::move(sink));
+   // The guard needs to be destructed before the writer goes out of scope
+   RImportGuard importGuard(*this);
+
+   fProgressCallback = fIsQuiet ? nullptr : std::make_unique<RDefaultProgressCallback>();
+
    for (decltype(nEntries) i = 0; i < nEntries; ++i) {
       fSourceTree->GetEntry(i);
 
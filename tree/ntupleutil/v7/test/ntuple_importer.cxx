@@ -1,9 +1,11 @@
 #include <ROOT/RNTupleImporter.hxx>
 
 #include <TFile.h>
+#include <TROOT.h>
 #include <TTree.h>
 #include <TChain.h>
 
+#include <cstdint>
 #include <cstdio>
 #include <string>
 #include <tuple>
@@ -656,3 +658,54 @@ TEST(RNTUpleImporter, MaxEntries)
    reader = RNTupleReader::Open("ntuple4", fileGuard.GetPath());
    EXPECT_EQ(5U, reader->GetNEntries());
 }
+
+TEST(RNTupleImporter, Parallel)
+{
+#ifdef R__USE_IMT
+   ROOT::EnableImplicitMT(4);
+#endif
+   FileRaii fileGuard("test_ntuple_importer_parallel.root");
+   {
+      std::unique_ptr<TFile> file(TFile::Open(fileGuard.GetPath().c_str(), "RECREATE"));
+      file->mkdir("dir")->cd();
+      auto tree = std::make_unique<TTree>("tree", "");
+      tree->SetAutoFlush(100);
+      Int_t a = 0;
+      std::vector<float> v;
+      tree->Branch("a", &a);
+      tree->Branch("v", &v);
+      for (int i = 0; i < 1000; ++i) {
+         a = i;
+         v.assign(i % 3, i);
+         tree->Fill();
+      }
+      tree->Write();
+   }
+
+   auto importer = RNTupleImporter::Create(fileGuard.GetPath(), "dir/tree", fileGuard.GetPath());
+   importer->SetIsQuiet(true);
+   importer->SetNTupleName("ntuple");
+   importer->SetUseParallelImport(true);
+   importer->SetMaxEntries(950);
+   importer->Import();
+#ifdef R__USE_IMT
+   ROOT::DisableImplicitMT();
+#endif
+
+   // The order of the clusters may differ from the tree but every entry is imported once
+   auto reader = RNTupleReader::Open("ntuple", fileGuard.GetPath());
+   ASSERT_EQ(950U, reader->GetNEntries());
+   auto viewA = reader->GetView<std::int32_t>("a");
+   auto viewV = reader->GetView<std::vector<float>>("v");
+   std::vector<bool> seen(950, false);
+   for (auto i : reader->GetEntryRange()) {
+      const auto val = viewA(i);
+      ASSERT_GE(val, 0);
+      ASSERT_LT(val, 950);
+      EXPECT_FALSE(seen[val]);
+      seen[val] = true;
+      ASSERT_EQ(static_cast<std::size_t>(val % 3), viewV(i).size());
+      for (auto f : viewV(i))
+         EXPECT_FLOAT_EQ(val, f);
+   }
+}
@@ -13,10 +13,17 @@
 
 #include <TFile.h>
 
+#include <memory>
 #include <string>
 #include <vector>
 #include <regex>
 
+namespace ROOT {
+namespace Experimental {
+class RNTupleModel;
+} // namespace Experimental
+} // namespace ROOT
+
 namespace ReadSpeed {
 
 struct Data {
@@ -28,6 +35,23 @@ struct Data {
    std::vector<std::string> fBranchNames;
    /// If the branch names should use regex matching.
    bool fUseRegex = false;
+   /// If the tree names are RNTuple names. The branch names are then the names of top-level fields.
+   bool fUseRNTuple = false;
+   /// RNTuple only: additionally measure the throughput of every field on its own, single-threaded.
+   bool fPerFieldThroughput = false;
+};
+
+struct FieldResult {
+   /// Name of the top-level field.
+   std::string fFieldName;
+   /// Real time spent reading and decompressing the field in all files, in seconds.
+   double fRealTime;
+   /// CPU time spent reading and decompressing the field in all files, in seconds.
+   double fCpuTime;
+   /// Number of bytes of the field's pages after decompression.
+   ULong64_t fUncompressedBytesRead;
+   /// Number of bytes of the field's pages on storage.
+   ULong64_t fCompressedBytesRead;
 };
 
 struct Result {
@@ -45,6 +69,16 @@ struct Result {
    ULong64_t fCompressedBytesRead;
    /// Size of ROOT's thread pool for the run (0 indicates a single-thread run with no thread pool present).
    unsigned int fThreadPoolSize;
+   /// RNTuple only: real time spent by the cluster pool I/O threads reading from storage, in seconds.
+   double fIORealTime = 0.;
+   /// RNTuple only: CPU time spent by the cluster pool I/O threads reading from storage, in seconds.
+   double fIOCpuTime = 0.;
+   /// RNTuple only: real time spent decompressing pages, summed over all unzip tasks, in seconds.
+   double fUnzipRealTime = 0.;
+   /// RNTuple only: CPU time spent decompressing pages, summed over all unzip tasks, in seconds.
+   double fUnzipCpuTime = 0.;
+   /// RNTuple only: per-field results, filled if Data::fPerFieldThroughput is set.
+   std::vector<FieldResult> fFieldResults;
 };
 
 struct EntryRange {
@@ -57,6 +91,15 @@ struct ByteData {
    ULong64_t fCompressedBytesRead;
 };
 
+// Bytes read and time spent by the page source when reading an RNTuple, the times are in nanoseconds.
+struct NTupleData {
+   ByteData fBytes{0, 0};
+   ULong64_t fIORealTime = 0;
+   ULong64_t fIOCpuTime = 0;
+   ULong64_t fUnzipRealTime = 0;
+   ULong64_t fUnzipCpuTime = 0;
+};
+
 struct ReadSpeedRegex {
    std::string text;
    std::regex regex;
@@ -64,9 +107,17 @@ struct ReadSpeedRegex {
    bool operator<(const ReadSpeedRegex &other) const { return text < other.text; }
 };
 
+// Return the names in unfilteredNames that match any of the regexes; terminates if a regex matches no name.
+std::vector<std::string> FilterMatchingNames(const std::vector<std::string> &unfilteredNames,
+                                             const std::vector<ReadSpeedRegex> &regexes, const std::string &treeName,
+                                             const std::string &fileName);
+
 std::vector<std::string> GetMatchingBranchNames(const std::string &fileName, const std::string &treeName,
                                                 const std::vector<ReadSpeedRegex> &regexes);
 
+// Return the branch (or, for RNTuples, the field) names to read per file, with the regexes resolved if needed.
+std::vector<std::vector<std::string>> GetPerFileBranchNames(const Data &d);
+
 // Read branches listed in branchNames in tree treeName in file fileName, return number of uncompressed bytes read.
 ByteData ReadTree(TFile *file, const std::string &treeName, const std::vector<std::string> &branchNames,
                   EntryRange range = {-1, -1});
@@ -87,6 +138,29 @@ Result EvalThroughputMT(const Data &d, unsigned nThreads);
 
 Result EvalThroughput(const Data &d, unsigned nThreads);
 
+std::vector<std::string> GetMatchingFieldNames(const std::string &fileName, const std::string &ntupleName,
+                                               const std::vector<ReadSpeedRegex> &regexes);
+
+// Create a model with the top-level fields listed in fieldNames of the RNTuple ntupleName in file fileName.
+std::unique_ptr<ROOT::Experimental::RNTupleModel> MakeNTupleModel(const std::string &fileName,
+                                                                  const std::string &ntupleName,
+                                                                  const std::vector<std::string> &fieldNames);
+
+// Read the fields of model from the RNTuple ntupleName in file fileName. The byte counts are the sizes of the pages
+// of the clusters in range, before and after decompression.
+NTupleData ReadNTuple(const ROOT::Experimental::RNTupleModel &model, const std::string &fileName,
+                      const std::string &ntupleName, EntryRange range = {-1, -1});
+
+Result EvalThroughputNTupleST(const Data &d);
+
+// Return the cluster boundaries of the RNTuples per file, analogous to GetClusters.
+std::vector<std::vector<EntryRange>> GetNTupleClusters(const Data &d);
+
+Result EvalThroughputNTupleMT(const Data &d, unsigned nThreads);
+
+// Read each field on its own, single-threaded, and return one result per field.
+std::vector<FieldResult> EvalFieldThroughputNTuple(const Data &d);
+
 } // namespace ReadSpeed
 
 #endif // ROOTREADSPEED
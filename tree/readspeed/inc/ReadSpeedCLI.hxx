@@ -22,11 +22,16 @@ namespace ReadSpeed {
 
 void PrintThroughput(const Result &r);
 
+// Print the throughput of runs with different numbers of threads, relative to the first run.
+void PrintScaling(const std::vector<Result> &results);
+
 struct Args {
    Data fData;
    unsigned int fNThreads = 0;
    bool fAllBranches = false;
    bool fShouldRun = false;
+   /// Thread counts of a scaling run; if not empty, the data is read once per thread count.
+   std::vector<unsigned int> fScalingNThreads;
 };
 
 Args ParseArgs(const std::vector<std::string> &args);
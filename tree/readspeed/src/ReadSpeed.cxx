@@ -34,17 +34,10 @@
 
 using namespace ReadSpeed;
 
-std::vector<std::string> ReadSpeed::GetMatchingBranchNames(const std::string &fileName, const std::string &treeName,
-                                                           const std::vector<ReadSpeedRegex> &regexes)
+std::vector<std::string> ReadSpeed::FilterMatchingNames(const std::vector<std::string> &unfilteredNames,
+                                                       const std::vector<ReadSpeedRegex> &regexes,
+                                                       const std::string &treeName, const std::string &fileName)
 {
-   const auto f = std::unique_ptr<TFile>(TFile::Open(fileName.c_str(), "READ_WITHOUT_GLOBALREGISTRATION"));
-   if (f == nullptr || f->IsZombie())
-      throw std::runtime_error("Could not open file '" + fileName + '\'');
-   std::unique_ptr<TTree> t(f->Get<TTree>(treeName.c_str()));
-   if (t == nullptr)
-      throw std::runtime_error("Could not retrieve tree '" + treeName + "' from file '" + fileName + '\'');
-
-   const auto unfilteredBranchNames = ROOT::Internal::TreeUtils::GetTopLevelBranchNames(*t);
    std::set<ReadSpeedRegex> usedRegexes;
    std::vector<std::string> branchNames;
 
@@ -66,8 +59,7 @@ std::vector<std::string> ReadSpeed::GetMatchingBranchNames(const std::string &fi
       const auto iterator = std::find_if(regexes.begin(), regexes.end(), matchBranch);
       return iterator != regexes.end();
    };
-   std::copy_if(unfilteredBranchNames.begin(), unfilteredBranchNames.end(), std::back_inserter(branchNames),
-                filterBranchName);
+   std::copy_if(unfilteredNames.begin(), unfilteredNames.end(), std::back_inserter(branchNames), filterBranchName);
 
    if (branchNames.empty()) {
       std::cerr << "Provided branch regexes didn't match any branches in tree '" + treeName + "' from file '" +
@@ -88,7 +80,21 @@ std::vector<std::string> ReadSpeed::GetMatchingBranchNames(const std::string &fi
    return branchNames;
 }
 
-std::vector<std::vector<std::string>> GetPerFileBranchNames(const Data &d)
+std::vector<std::string> ReadSpeed::GetMatchingBranchNames(const std::string &fileName, const std::string &treeName,
+                                                           const std::vector<ReadSpeedRegex> &regexes)
+{
+   const auto f = std::unique_ptr<TFile>(TFile::Open(fileName.c_str(), "READ_WITHOUT_GLOBALREGISTRATION"));
+   if (f == nullptr || f->IsZombie())
+      throw std::runtime_error("Could not open file '" + fileName + '\'');
+   std::unique_ptr<TTree> t(f->Get<TTree>(treeName.c_str()));
+   if (t == nullptr)
+      throw std::runtime_error("Could not retrieve tree '" + treeName + "' from file '" + fileName + '\'');
+
+   const auto unfilteredBranchNames = ROOT::Internal::TreeUtils::GetTopLevelBranchNames(*t);
+   return FilterMatchingNames(unfilteredBranchNames, regexes, treeName, fileName);
+}
+
+std::vector<std::vector<std::string>> ReadSpeed::GetPerFileBranchNames(const Data &d)
 {
    auto treeIdx = 0;
    std::vector<std::vector<std::string>> fileBranchNames;
@@ -101,10 +107,14 @@ std::vector<std::vector<std::string>> GetPerFileBranchNames(const Data &d)
 
    for (const auto &fName : d.fFileNames) {
       std::vector<std::string> branchNames;
-      if (d.fUseRegex)
-         branchNames = GetMatchingBranchNames(fName, d.fTreeNames[treeIdx], regexes);
-      else
+      if (!d.fUseRegex)
          branchNames = d.fBranchNames;
+#ifdef R__HAS_RNTUPLE
+      else if (d.fUseRNTuple)
+         branchNames = GetMatchingFieldNames(fName, d.fTreeNames[treeIdx], regexes);
+#endif
+      else
+         branchNames = GetMatchingBranchNames(fName, d.fTreeNames[treeIdx], regexes);
 
       fileBranchNames.push_back(branchNames);
 
@@ -359,14 +369,25 @@ Result ReadSpeed::EvalThroughput(const Data &d, unsigned nThreads)
       std::terminate();
    }
 
-#ifdef R__USE_IMT
-   return nThreads > 0 ? EvalThroughputMT(d, nThreads) : EvalThroughputST(d);
-#else
+#ifndef R__USE_IMT
    if (nThreads > 0) {
       std::cerr << nThreads
                 << " threads were requested, but ROOT was built without implicit multi-threading (IMT) support.\n";
       std::terminate();
    }
-   return EvalThroughputST(d);
 #endif
+
+   if (d.fUseRNTuple) {
+#ifdef R__HAS_RNTUPLE
+      auto result = nThreads > 0 ? EvalThroughputNTupleMT(d, nThreads) : EvalThroughputNTupleST(d);
+      if (d.fPerFieldThroughput)
+         result.fFieldResults = EvalFieldThroughputNTuple(d);
+      return result;
+#else
+      std::cerr << "RNTuples were requested, but ROOT was built without RNTuple (root7) support.\n";
+      std::terminate();
+#endif
+   }
+
+   return nThreads > 0 ? EvalThroughputMT(d, nThreads) : EvalThroughputST(d);
 }
@@ -21,10 +21,12 @@ using namespace ReadSpeed;
 
 const auto usageText = "Usage:\n"
                        " rootreadspeed --files fname1 [fname2 ...]\n"
-                       "               --trees tname1 [tname2 ...]\n"
+                       "               (--trees tname1 [tname2 ...] | --ntuples nname1 [nname2 ...])\n"
                        "               (--all-branches | --branches bname1 [bname2 ...] | --branches-regex bregex1 "
                        "[bregex2 ...])\n"
                        "               [--threads nthreads]\n"
+                       "               [--scaling nthreads1 [nthreads2 ...]]\n"
+                       "               [--per-field]\n"
                        "               [--tasks-per-worker ntasks]\n"
                        " rootreadspeed (--help|-h)\n"
                        " \n"
@@ -42,6 +44,11 @@ const auto argUsageText =
    "    respective file."
    "\n"
    "\n"
+   "   --ntuples nname1 [nname2...]\n"
+   "    The list of RNTuples to read from the files, used instead of --trees. The branch options"
+   "    then refer to the top-level fields of the RNTuples."
+   "\n"
+   "\n"
    " Specifying branches:\n"
    "  Branches can be specified using one of the following flags. Currently only one can be used"
    "  at a time.\n"
@@ -62,7 +69,15 @@ const auto argUsageText =
    "    available threads on the machine."
    "\n"
    "   --tasks-per-worker ntasks\n"
-   "    The number of tasks to generate for each worker thread when using multithreading.";
+   "    The number of tasks to generate for each worker thread when using multithreading."
+   "\n"
+   "   --scaling nthreads1 [nthreads2...]\n"
+   "    Reads the data once for every given number of threads (0 for a single-thread run) and prints"
+   "    the throughput and the speedup with respect to the first run."
+   "\n"
+   "   --per-field\n"
+   "    RNTuple only: additionally reads every field on its own in a single thread and prints the"
+   "    decompressed throughput per field.";
 
 const auto fullUsageText =
    "Description:\n"
@@ -83,7 +98,14 @@ const auto fullUsageText =
    " decompression time) in the uncompressed and compressed cases."
    "\n"
    "\n"
-   "Interpreting results:\n"
+   "RNTuple I/O and decompression times:\n"
+   " For RNTuples, the time spent by the cluster pool I/O threads reading from storage and the time spent"
+   " decompressing pages are reported separately, both as real and as CPU time. The decompression times are"
+   " summed over all parallel decompression tasks. The byte counts are the sizes of the pages of the read"
+   " fields before and after decompression."
+   "\n"
+   "\n"
+      "Interpreting results:\n"
    " \n"
    " There are three possible scenarios when using rootreadspeed, namely:"
    " \n"
@@ -172,6 +194,23 @@ void ReadSpeed::PrintThroughput(const Result &r)
 
    const float cpuEfficiency = (r.fCpuTime / effectiveThreads) / r.fRealTime;
 
+   if (r.fIORealTime > 0. || r.fUnzipRealTime > 0.) {
+      std::cout << "Real time reading (I/O):\t" << r.fIORealTime << " s\n";
+      std::cout << "CPU time reading (I/O):\t\t" << r.fIOCpuTime << " s\n";
+      std::cout << "Real time decompressing:\t" << r.fUnzipRealTime << " s\n";
+      std::cout << "CPU time decompressing:\t\t" << r.fUnzipCpuTime << " s\n\n";
+   }
+
+   if (!r.fFieldResults.empty()) {
+      std::cout << "Per-field throughput (single thread):\n";
+      for (const auto &f : r.fFieldResults) {
+         std::cout << "  " << f.fFieldName << ":\t" << f.fUncompressedBytesRead / f.fRealTime / 1024 / 1024
+                   << " MB/s uncompressed, " << f.fCompressedBytesRead / f.fRealTime / 1024 / 1024
+                   << " MB/s compressed (real time " << f.fRealTime << " s, CPU time " << f.fCpuTime << " s)\n";
+      }
+      std::cout << '\n';
+   }
+
    std::cout << "CPU Efficiency: \t\t" << (cpuEfficiency * 100) << "%\n";
    std::cout << "Reading data is ";
    if (cpuEfficiency > 0.80f) {
@@ -184,6 +223,20 @@ void ReadSpeed::PrintThroughput(const Result &r)
    std::cout << "For details run with the --help command.\n";
 }
 
+void ReadSpeed::PrintScaling(const std::vector<Result> &results)
+{
+   if (results.empty())
+      return;
+
+   std::cout << "Threads\tReal time [s]\tCPU time [s]\tUncompressed [MB/s]\tCompressed [MB/s]\tSpeedup\n";
+   for (const auto &r : results) {
+      std::cout << r.fThreadPoolSize << '\t' << r.fRealTime << "\t\t" << r.fCpuTime << "\t\t"
+                << r.fUncompressedBytesRead / r.fRealTime / 1024 / 1024 << "\t\t\t"
+                << r.fCompressedBytesRead / r.fRealTime / 1024 / 1024 << "\t\t\t"
+                << results[0].fRealTime / r.fRealTime << '\n';
+   }
+}
+
 Args ReadSpeed::ParseArgs(const std::vector<std::string> &args)
 {
    // Print help message and exit if "--help"
@@ -205,7 +258,18 @@ Args ReadSpeed::ParseArgs(const std::vector<std::string> &args)
    Data d;
    unsigned int nThreads = 0;
 
-   enum class EArgState { kNone, kTrees, kFiles, kBranches, kThreads, kTasksPerWorkerHint } argState = EArgState::kNone;
+   std::vector<unsigned int> scalingNThreads;
+
+   enum class EArgState {
+      kNone,
+      kTrees,
+      kFiles,
+      kBranches,
+      kThreads,
+      kTasksPerWorkerHint,
+      kScalingThreads
+   } argState = EArgState::kNone;
+   enum class ETreeState { kNone, kTTree, kRNTuple } treeState = ETreeState::kNone;
    enum class EBranchState { kNone, kRegular, kRegex, kAll } branchState = EBranchState::kNone;
    const auto branchOptionsErrMsg =
       "Options --all-branches, --branches, and --branches-regex are mutually exclusive. You can use only one.\n";
@@ -213,8 +277,15 @@ Args ReadSpeed::ParseArgs(const std::vector<std::string> &args)
    for (size_t i = 1; i < args.size(); ++i) {
       const auto &arg = args[i];
 
-      if (arg == "--trees") {
+      if (arg == "--trees" || arg == "--ntuples") {
          argState = EArgState::kTrees;
+         const auto newTreeState = arg == "--trees" ? ETreeState::kTTree : ETreeState::kRNTuple;
+         if (treeState != ETreeState::kNone && treeState != newTreeState) {
+            std::cerr << "Options --trees and --ntuples are mutually exclusive. You can use only one.\n";
+            return {};
+         }
+         treeState = newTreeState;
+         d.fUseRNTuple = treeState == ETreeState::kRNTuple;
       } else if (arg == "--files") {
          argState = EArgState::kFiles;
       } else if (arg == "--all-branches") {
@@ -245,6 +316,11 @@ Args ReadSpeed::ParseArgs(const std::vector<std::string> &args)
          argState = EArgState::kThreads;
       } else if (arg == "--tasks-per-worker") {
          argState = EArgState::kTasksPerWorkerHint;
+      } else if (arg == "--scaling") {
+         argState = EArgState::kScalingThreads;
+      } else if (arg == "--per-field") {
+         argState = EArgState::kNone;
+         d.fPerFieldThroughput = true;
       } else if (arg[0] == '-') {
          std::cerr << "Unrecognized option '" << arg << "'\n";
          return {};
@@ -266,12 +342,19 @@ Args ReadSpeed::ParseArgs(const std::vector<std::string> &args)
                          "will be ignored.\n";
 #endif
             break;
+         case EArgState::kScalingThreads: scalingNThreads.emplace_back(std::stoi(arg)); break;
          default: std::cerr << "Unrecognized option '" << arg << "'\n"; return {};
          }
       }
    }
 
-   return Args{std::move(d), nThreads, branchState == EBranchState::kAll, /*fShouldRun=*/true};
+   if (d.fPerFieldThroughput && !d.fUseRNTuple) {
+      std::cerr << "Option --per-field can only be used together with --ntuples.\n";
+      return {};
+   }
+
+   return Args{std::move(d), nThreads, branchState == EBranchState::kAll, /*fShouldRun=*/true,
+               std::move(scalingNThreads)};
 }
 
 Args ReadSpeed::ParseArgs(int argc, char **argv)
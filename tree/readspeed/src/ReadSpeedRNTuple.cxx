@@ -0,0 +1,321 @@
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include "ReadSpeed.hxx"
+
+#include <ROOT/RColumnElement.hxx>
+#include <ROOT/RNTuple.hxx>
+#include <ROOT/RNTupleDescriptor.hxx>
+#include <ROOT/RNTupleMetrics.hxx>
+#include <ROOT/RNTupleModel.hxx>
+#include <ROOT/TSeq.hxx>
+
+#ifdef R__USE_IMT
+#include <ROOT/TThreadExecutor.hxx>
+#include <ROOT/TTreeProcessorMT.hxx> // for TTreeProcessorMT::GetTasksPerWorkerHint
+#endif
+
+#include <TStopwatch.h>
+
+#include <algorithm>
+#include <cmath> // std::ceil
+#include <iostream>
+#include <numeric> // std::accumulate
+#include <set>
+#include <stdexcept>
+
+using namespace ReadSpeed;
+
+using ROOT::Experimental::DescriptorId_t;
+using ROOT::Experimental::RNTupleDescriptor;
+using ROOT::Experimental::RNTupleModel;
+using ROOT::Experimental::RNTupleReader;
+
+namespace {
+
+// Collect the physical columns of a field and all its subfields; alias columns are resolved to the physical columns
+// that they point to.
+void CollectPhysicalColumnIds(const RNTupleDescriptor &desc, DescriptorId_t fieldId, std::set<DescriptorId_t> &ids)
+{
+   for (const auto &columnDesc : desc.GetColumnIterable(fieldId))
+      ids.insert(columnDesc.GetPhysicalId());
+   for (const auto &subFieldDesc : desc.GetFieldIterable(fieldId))
+      CollectPhysicalColumnIds(desc, subFieldDesc.GetId(), ids);
+}
+
+// Sum up the page sizes of the given fields in the clusters that start within the entry range.
+ByteData GetPageBytes(const RNTupleDescriptor &desc, const std::vector<std::string> &fieldNames, EntryRange range)
+{
+   std::set<DescriptorId_t> columnIds;
+   for (const auto &fieldName : fieldNames)
+      CollectPhysicalColumnIds(desc, desc.FindFieldId(fieldName), columnIds);
+
+   ULong64_t uncompressedBytes = 0;
+   ULong64_t compressedBytes = 0;
+   for (const auto &clusterDesc : desc.GetClusterIterable()) {
+      const auto firstEntry = static_cast<Long64_t>(clusterDesc.GetFirstEntryIndex());
+      if (firstEntry < range.fStart || firstEntry >= range.fEnd)
+         continue;
+      for (auto columnId : columnIds) {
+         if (!clusterDesc.ContainsColumn(columnId))
+            continue;
+         const auto &columnModel = desc.GetColumnDescriptor(columnId).GetModel();
+         const auto bitsOnStorage = ROOT::Experimental::Detail::RColumnElementBase::GetBitsOnStorage(columnModel);
+         for (const auto &pageInfo : clusterDesc.GetPageRange(columnId).fPageInfos) {
+            uncompressedBytes += (pageInfo.fNElements * bitsOnStorage + 7) / 8;
+            compressedBytes += pageInfo.fLocator.fBytesOnStorage;
+         }
+      }
+   }
+   return {uncompressedBytes, compressedBytes};
+}
+
+ULong64_t GetCounterValue(const ROOT::Experimental::Detail::RNTupleMetrics &metrics, const std::string &name)
+{
+   const auto *counter = metrics.GetCounter("RNTupleReader.RPageSourceFile." + name);
+   return counter ? counter->GetValueAsInt() : 0;
+}
+
+NTupleData SumNTupleData(const std::vector<NTupleData> &ntupleData)
+{
+   NTupleData sum;
+   for (const auto &d : ntupleData) {
+      sum.fBytes.fUncompressedBytesRead += d.fBytes.fUncompressedBytesRead;
+      sum.fBytes.fCompressedBytesRead += d.fBytes.fCompressedBytesRead;
+      sum.fIORealTime += d.fIORealTime;
+      sum.fIOCpuTime += d.fIOCpuTime;
+      sum.fUnzipRealTime += d.fUnzipRealTime;
+      sum.fUnzipCpuTime += d.fUnzipCpuTime;
+   }
+   return sum;
+}
+
+Result MakeResult(TStopwatch &sw, const NTupleData &ntupleData, unsigned int threadPoolSize)
+{
+   Result result{sw.RealTime(),
+                 sw.CpuTime(),
+                 0.,
+                 0.,
+                 ntupleData.fBytes.fUncompressedBytesRead,
+                 ntupleData.fBytes.fCompressedBytesRead,
+                 threadPoolSize};
+   result.fIORealTime = ntupleData.fIORealTime / 1e9;
+   result.fIOCpuTime = ntupleData.fIOCpuTime / 1e9;
+   result.fUnzipRealTime = ntupleData.fUnzipRealTime / 1e9;
+   result.fUnzipCpuTime = ntupleData.fUnzipCpuTime / 1e9;
+   return result;
+}
+
+// Create one model per file with the fields to be read.
+std::vector<std::unique_ptr<RNTupleModel>> MakePerFileModels(const Data &d)
+{
+   const auto fileFieldNames = GetPerFileBranchNames(d);
+   std::vector<std::unique_ptr<RNTupleModel>> models;
+   for (auto fileIdx = 0u; fileIdx < d.fFileNames.size(); ++fileIdx) {
+      const auto &ntupleName = d.fTreeNames.size() > 1 ? d.fTreeNames[fileIdx] : d.fTreeNames[0];
+      models.emplace_back(MakeNTupleModel(d.fFileNames[fileIdx], ntupleName, fileFieldNames[fileIdx]));
+   }
+   return models;
+}
+
+std::unique_ptr<RNTupleReader> OpenNTuple(const std::string &fileName, const std::string &ntupleName)
+{
+   try {
+      return RNTupleReader::Open(ntupleName, fileName);
+   } catch (const ROOT::Experimental::RException &e) {
+      throw std::runtime_error("Could not open RNTuple '" + ntupleName + "' from file '" + fileName +
+                               "': " + e.GetError().GetReport());
+   }
+}
+
+} // anonymous namespace
+
+std::vector<std::string> ReadSpeed::GetMatchingFieldNames(const std::string &fileName, const std::string &ntupleName,
+                                                          const std::vector<ReadSpeedRegex> &regexes)
+{
+   const auto reader = OpenNTuple(fileName, ntupleName);
+   const auto &desc = *reader->GetDescriptor();
+
+   std::vector<std::string> unfilteredFieldNames;
+   for (const auto &fieldDesc : desc.GetTopLevelFields())
+      unfilteredFieldNames.emplace_back(fieldDesc.GetFieldName());
+   return FilterMatchingNames(unfilteredFieldNames, regexes, ntupleName, fileName);
+}
+
+std::unique_ptr<RNTupleModel> ReadSpeed::MakeNTupleModel(const std::string &fileName, const std::string &ntupleName,
+                                                         const std::vector<std::string> &fieldNames)
+{
+   const auto reader = OpenNTuple(fileName, ntupleName);
+   const auto &desc = *reader->GetDescriptor();
+
+   auto model = RNTupleModel::CreateBare();
+   for (const auto &fieldName : fieldNames) {
+      const auto fieldId = desc.FindFieldId(fieldName);
+      if (fieldId == ROOT::Experimental::kInvalidDescriptorId)
+         throw std::runtime_error("Could not retrieve field '" + fieldName + "' from RNTuple '" + ntupleName +
+                                  "' in file '" + fileName + '\'');
+      model->AddField(desc.GetFieldDescriptor(fieldId).CreateField(desc));
+   }
+   return model;
+}
+
+NTupleData ReadSpeed::ReadNTuple(const RNTupleModel &model, const std::string &fileName,
+                                 const std::string &ntupleName, EntryRange range)
+{
+   std::unique_ptr<RNTupleReader> reader;
+   try {
+      reader = RNTupleReader::Open(model.Clone(), ntupleName, fileName);
+   } catch (const ROOT::Experimental::RException &e) {
+      throw std::runtime_error("Could not open RNTuple '" + ntupleName + "' from file '" + fileName +
+                               "': " + e.GetError().GetReport());
+   }
+   reader->EnableMetrics();
+
+   const auto nEntries = static_cast<Long64_t>(reader->GetNEntries());
+   if (range.fStart == -1ll)
+      range = EntryRange{0ll, nEntries};
+   else if (range.fEnd > nEntries)
+      throw std::runtime_error("Range end (" + std::to_string(range.fEnd) + ") is beyond the end of RNTuple '" +
+                               ntupleName + "' in file '" + fileName + "' with " + std::to_string(nEntries) +
+                               " entries.");
+
+   auto entry = reader->GetModel()->CreateEntry();
+   for (auto e = range.fStart; e < range.fEnd; ++e)
+      reader->LoadEntry(e, *entry);
+
+   std::vector<std::string> fieldNames;
+   for (const auto &value : *entry)
+      fieldNames.emplace_back(value.GetField()->GetName());
+
+   NTupleData result;
+   result.fBytes = GetPageBytes(*reader->GetDescriptor(), fieldNames, range);
+   const auto &metrics = reader->GetMetrics();
+   result.fIORealTime = GetCounterValue(metrics, "timeWallRead");
+   result.fIOCpuTime = GetCounterValue(metrics, "timeCpuRead");
+   result.fUnzipRealTime = GetCounterValue(metrics, "timeWallUnzip");
+   result.fUnzipCpuTime = GetCounterValue(metrics, "timeCpuUnzip");
+   return result;
+}
+
+Result ReadSpeed::EvalThroughputNTupleST(const Data &d)
+{
+   const auto models = MakePerFileModels(d);
+
+   TStopwatch sw;
+   std::vector<NTupleData> ntupleData;
+   for (auto fileIdx = 0u; fileIdx < d.fFileNames.size(); ++fileIdx) {
+      const auto &ntupleName = d.fTreeNames.size() > 1 ? d.fTreeNames[fileIdx] : d.fTreeNames[0];
+      sw.Start(kFALSE);
+      ntupleData.emplace_back(ReadNTuple(*models[fileIdx], d.fFileNames[fileIdx], ntupleName));
+      sw.Stop();
+   }
+
+   return MakeResult(sw, SumNTupleData(ntupleData), 0);
+}
+
+std::vector<std::vector<EntryRange>> ReadSpeed::GetNTupleClusters(const Data &d)
+{
+   const auto nFiles = d.fFileNames.size();
+   std::vector<std::vector<EntryRange>> ranges(nFiles);
+   for (auto fileIdx = 0u; fileIdx < nFiles; ++fileIdx) {
+      const auto &ntupleName = d.fTreeNames.size() > 1 ? d.fTreeNames[fileIdx] : d.fTreeNames[0];
+      const auto reader = OpenNTuple(d.fFileNames[fileIdx], ntupleName);
+
+      std::vector<EntryRange> rangesInFile;
+      for (const auto &clusterDesc : reader->GetDescriptor()->GetClusterIterable()) {
+         const auto start = static_cast<Long64_t>(clusterDesc.GetFirstEntryIndex());
+         rangesInFile.emplace_back(EntryRange{start, start + static_cast<Long64_t>(clusterDesc.GetNEntries())});
+      }
+      std::sort(rangesInFile.begin(), rangesInFile.end(),
+                [](const EntryRange &a, const EntryRange &b) { return a.fStart < b.fStart; });
+      ranges[fileIdx] = std::move(rangesInFile);
+   }
+   return ranges;
+}
+
+Result ReadSpeed::EvalThroughputNTupleMT(const Data &d, unsigned nThreads)
+{
+#ifdef R__USE_IMT
+   ROOT::TThreadExecutor pool(nThreads);
+   const auto actualThreads = ROOT::GetThreadPoolSize();
+   if (actualThreads != nThreads)
+      std::cerr << "Running with " << actualThreads << " threads even though " << nThreads << " were requested.\n";
+
+   TStopwatch clsw;
+   clsw.Start();
+   const unsigned int maxTasksPerFile =
+      std::ceil(float(ROOT::TTreeProcessorMT::GetTasksPerWorkerHint() * actualThreads) / float(d.fFileNames.size()));
+
+   const auto rangesPerFile = MergeClusters(GetNTupleClusters(d), maxTasksPerFile);
+   const auto models = MakePerFileModels(d);
+   clsw.Stop();
+
+   const size_t nranges =
+      std::accumulate(rangesPerFile.begin(), rangesPerFile.end(), 0u, [](size_t s, auto &r) { return s + r.size(); });
+   std::cout << "Total number of tasks: " << nranges << '\n';
+
+   auto processFile = [&](int fileIdx) {
+      const auto &fileName = d.fFileNames[fileIdx];
+      const auto &ntupleName = d.fTreeNames.size() > 1 ? d.fTreeNames[fileIdx] : d.fTreeNames[0];
+      const auto &model = *models[fileIdx];
+
+      auto readRange = [&](const EntryRange &range) { return ReadNTuple(model, fileName, ntupleName, range); };
+
+      return pool.MapReduce(readRange, rangesPerFile[fileIdx], SumNTupleData);
+   };
+
+   TStopwatch sw;
+   sw.Start();
+   const auto totalData = pool.MapReduce(processFile, ROOT::TSeqUL(d.fFileNames.size()), SumNTupleData);
+   sw.Stop();
+
+   auto result = MakeResult(sw, totalData, actualThreads);
+   result.fMTSetupRealTime = clsw.RealTime();
+   result.fMTSetupCpuTime = clsw.CpuTime();
+   return result;
+#else
+   (void)d;
+   (void)nThreads;
+   return {};
+#endif // R__USE_IMT
+}
+
+std::vector<FieldResult> ReadSpeed::EvalFieldThroughputNTuple(const Data &d)
+{
+   const auto fileFieldNames = GetPerFileBranchNames(d);
+
+   // Fields are reported in the order in which they first appear in the files
+   std::vector<std::string> fieldNames;
+   for (const auto &names : fileFieldNames) {
+      for (const auto &name : names) {
+         if (std::find(fieldNames.begin(), fieldNames.end(), name) == fieldNames.end())
+            fieldNames.emplace_back(name);
+      }
+   }
+
+   std::vector<FieldResult> results;
+   for (const auto &fieldName : fieldNames) {
+      TStopwatch sw;
+      std::vector<NTupleData> ntupleData;
+      for (auto fileIdx = 0u; fileIdx < d.fFileNames.size(); ++fileIdx) {
+         const auto &names = fileFieldNames[fileIdx];
+         if (std::find(names.begin(), names.end(), fieldName) == names.end())
+            continue;
+         const auto &fileName = d.fFileNames[fileIdx];
+         const auto &ntupleName = d.fTreeNames.size() > 1 ? d.fTreeNames[fileIdx] : d.fTreeNames[0];
+         const auto model = MakeNTupleModel(fileName, ntupleName, {fieldName});
+         sw.Start(kFALSE);
+         ntupleData.emplace_back(ReadNTuple(*model, fileName, ntupleName));
+         sw.Stop();
+      }
+      const auto sum = SumNTupleData(ntupleData);
+      results.emplace_back(FieldResult{fieldName, sw.RealTime(), sw.CpuTime(), sum.fBytes.fUncompressedBytesRead,
+                                       sum.fBytes.fCompressedBytesRead});
+   }
+   return results;
+}
@@ -18,6 +18,11 @@
 #include "TSystem.h"
 #include "TTree.h"
 
+#ifdef R__HAS_RNTUPLE
+#include <ROOT/RNTuple.hxx>
+#include <ROOT/RNTupleModel.hxx>
+#endif
+
 using namespace ReadSpeed;
 
 // Helper function to generate a .root file with some dummy data in it.
@@ -39,6 +44,27 @@ void RequireFile(const std::string &fname, const std::vector<std::string> &branc
    t.Write();
 }
 
+#ifdef R__HAS_RNTUPLE
+// Helper function to generate a .root file with an RNTuple "n" with some dummy data in it.
+void RequireNTupleFile(const std::string &fname, const std::vector<std::string> &fieldNames = {"x"})
+{
+   if (gSystem->AccessPathName(fname.c_str()) == false)
+      return;
+
+   auto model = ROOT::Experimental::RNTupleModel::Create();
+   std::vector<std::shared_ptr<int>> values;
+   for (const auto &f : fieldNames)
+      values.emplace_back(model->MakeField<int>(std::string_view(f), 42));
+
+   auto writer = ROOT::Experimental::RNTupleWriter::Recreate(std::move(model), "n", fname);
+   for (int i = 0; i < 1000000; ++i) {
+      writer->Fill();
+      if (i % 100000 == 99999)
+         writer->CommitCluster();
+   }
+}
+#endif
+
 // Helper function to concatenate two vectors of strings.
 std::vector<std::string> ConcatVectors(const std::vector<std::string> &first, const std::vector<std::string> &second)
 {
@@ -144,6 +170,78 @@ TEST_F(ReadSpeedIntegration, AllBranches)
    EXPECT_EQ(result.fCompressedBytesRead, 1316837) << "Wrong number of compressed bytes read";
 }
 
+#ifdef R__HAS_RNTUPLE
+class ReadSpeedNTupleIntegration : public ::testing::Test {
+protected:
+   static void SetUpTestSuite()
+   {
+      RequireNTupleFile("readspeedntuple1.root");
+      RequireNTupleFile("readspeedntuple2.root", {"x", "x_field", "y"});
+   }
+
+   static void TearDownTestSuite()
+   {
+      gSystem->Unlink("readspeedntuple1.root");
+      gSystem->Unlink("readspeedntuple2.root");
+   }
+};
+
+TEST_F(ReadSpeedNTupleIntegration, SingleThread)
+{
+   Data d{{"n"}, {"readspeedntuple1.root", "readspeedntuple2.root"}, {"x"}};
+   d.fUseRNTuple = true;
+   const auto result = EvalThroughput(d, 0);
+
+   EXPECT_EQ(result.fUncompressedBytesRead, 8000000) << "Wrong number of uncompressed bytes read";
+   EXPECT_GT(result.fCompressedBytesRead, 0) << "Wrong number of compressed bytes read";
+   EXPECT_TRUE(result.fFieldResults.empty());
+}
+
+#ifdef R__USE_IMT
+TEST_F(ReadSpeedNTupleIntegration, MultiThread)
+{
+   Data d{{"n"}, {"readspeedntuple1.root", "readspeedntuple2.root"}, {"x"}};
+   d.fUseRNTuple = true;
+   const auto resultST = EvalThroughput(d, 0);
+   const auto resultMT = EvalThroughput(d, 2);
+
+   EXPECT_EQ(resultMT.fUncompressedBytesRead, 8000000) << "Wrong number of uncompressed bytes read";
+   EXPECT_EQ(resultMT.fCompressedBytesRead, resultST.fCompressedBytesRead) << "Wrong number of compressed bytes read";
+}
+#endif
+
+TEST_F(ReadSpeedNTupleIntegration, PerField)
+{
+   Data d{{"n"}, {"readspeedntuple2.root"}, {"x.*"}, true};
+   d.fUseRNTuple = true;
+   d.fPerFieldThroughput = true;
+   const auto result = EvalThroughput(d, 0);
+
+   EXPECT_EQ(result.fUncompressedBytesRead, 8000000) << "Wrong number of uncompressed bytes read";
+   ASSERT_EQ(result.fFieldResults.size(), 2u);
+   EXPECT_EQ(result.fFieldResults[0].fFieldName, "x");
+   EXPECT_EQ(result.fFieldResults[1].fFieldName, "x_field");
+   EXPECT_EQ(result.fFieldResults[0].fUncompressedBytesRead + result.fFieldResults[1].fUncompressedBytesRead,
+             result.fUncompressedBytesRead);
+   EXPECT_EQ(result.fFieldResults[0].fCompressedBytesRead + result.fFieldResults[1].fCompressedBytesRead,
+             result.fCompressedBytesRead);
+}
+
+TEST_F(ReadSpeedNTupleIntegration, NonExistentField)
+{
+   Data d{{"n"}, {"readspeedntuple1.root"}, {"z"}};
+   d.fUseRNTuple = true;
+   EXPECT_THROW(EvalThroughput(d, 0), std::runtime_error) << "Should throw for non-existent field";
+}
+
+TEST_F(ReadSpeedNTupleIntegration, NonExistentNTuple)
+{
+   Data d{{"n_fake"}, {"readspeedntuple1.root"}, {"x"}};
+   d.fUseRNTuple = true;
+   EXPECT_THROW(EvalThroughput(d, 0), std::runtime_error) << "Should throw for non-existent RNTuple";
+}
+#endif
+
 TEST(ReadSpeedCLI, CheckFilenames)
 {
    const std::vector<std::string> baseArgs{"root-readspeed", "--trees", "t", "--branches", "x", "--files"};
@@ -295,3 +393,52 @@ TEST(ReadSpeedCLI, WorkerThreadsHint)
    EXPECT_EQ(newTasksPerWorker, oldTasksPerWorker + 10) << "Tasks per worker hint not updated correctly";
 }
 #endif
+
+TEST(ReadSpeedCLI, NTupleArgs)
+{
+   const std::vector<std::string> allArgs{
+      "root-readspeed", "--files", "doesnotexist.root", "--ntuples", "n", "--branches", "x", "--per-field",
+   };
+
+   const auto parsedArgs = ParseArgs(allArgs);
+
+   EXPECT_TRUE(parsedArgs.fShouldRun) << "Program not running when given valid arguments";
+   EXPECT_TRUE(parsedArgs.fData.fUseRNTuple) << "Program not reading RNTuples when it should";
+   EXPECT_TRUE(parsedArgs.fData.fPerFieldThroughput) << "Program not measuring fields separately when it should";
+   EXPECT_EQ(parsedArgs.fData.fTreeNames, std::vector<std::string>{"n"}) << "List of parsed RNTuples not correct";
+}
+
+TEST(ReadSpeedCLI, TreesAndNTuples)
+{
+   const std::vector<std::string> allArgs{
+      "root-readspeed", "--files", "doesnotexist.root", "--trees", "t", "--ntuples", "n", "--branches", "x",
+   };
+
+   const auto parsedArgs = ParseArgs(allArgs);
+
+   EXPECT_TRUE(!parsedArgs.fShouldRun) << "Program running when using both trees and RNTuples";
+}
+
+TEST(ReadSpeedCLI, PerFieldWithTrees)
+{
+   const std::vector<std::string> allArgs{
+      "root-readspeed", "--files", "doesnotexist.root", "--trees", "t", "--branches", "x", "--per-field",
+   };
+
+   const auto parsedArgs = ParseArgs(allArgs);
+
+   EXPECT_TRUE(!parsedArgs.fShouldRun) << "Program running when using --per-field with trees";
+}
+
+TEST(ReadSpeedCLI, ScalingThreads)
+{
+   const std::vector<std::string> allArgs{
+      "root-readspeed", "--files", "doesnotexist.root", "--trees", "t", "--branches", "x", "--scaling", "0", "2", "4",
+   };
+   const std::vector<unsigned int> threads{0, 2, 4};
+
+   const auto parsedArgs = ParseArgs(allArgs);
+
+   EXPECT_TRUE(parsedArgs.fShouldRun) << "Program not running when given valid arguments";
+   EXPECT_EQ(parsedArgs.fScalingNThreads, threads) << "Program not using the correct thread counts for scaling";
+}
@@ -24,6 +24,7 @@
 #include "TObjArray.h"
 #include "ROOT/RFriendInfo.hxx"
 
+#include <functional>
 #include <memory>
 #include <string>
 #include <utility> // std::pair
@@ -80,6 +81,10 @@ std::vector<std::unique_ptr<TChain>> MakeFriends(const ROOT::TreeUtils::RFriendI
 
 std::vector<std::string> ExpandGlob(const std::string &glob);
 
+unsigned int GetMetadataConcurrency();
+void ForEachIndexConcurrently(std::size_t n, unsigned int maxConcurrency,
+                              const std::function<void(std::size_t)> &func);
+
 } // namespace TreeUtils
 } // namespace Internal
 } // namespace ROOT
@@ -31,6 +31,8 @@
 #include "Compression.h"
 #include "ROOT/TIOFeatures.hxx"
 
+#include <vector>
+
 class TTree;
 class TBasket;
 class TBranchElement;
@@ -49,6 +51,7 @@ class TBulkBranchRead;
 }
 }
 namespace Internal {
+class TBasketCompressor; ///< Compresses full baskets in the background, see TTree::SetMaxBasketsInFlight().
 class TBranchIMTHelper; ///< A helper class for managing IMT work during TTree:Fill operations.
 }
 }
@@ -76,8 +79,12 @@ public:
    Int_t GetEntriesSerialized(Long64_t evt, TBuffer &user_buf);
    /// See TBranch::GetEntriesSerialized(Long64_t evt, TBuffer &user_buf, TBuffer *count_buf);
    Int_t GetEntriesSerialized(Long64_t evt, TBuffer &user_buf, TBuffer *count_buf);
+   /// See TBranch::GetBulkEntries(Long64_t evt, TBuffer &user_buf, std::vector<Int_t> &offsets);
+   Int_t GetBulkEntries(Long64_t evt, TBuffer &user_buf, std::vector<Int_t> &offsets);
    /// Return true if the branch can be read through the bulk interfaces.
    Bool_t SupportsBulkRead() const;
+   /// Return true if the branch can be read through the bulk interface that returns the offsets of the entries.
+   Bool_t SupportsBulkReadWithOffsets() const;
 
 private:
    TBulkBranchRead(TBranch &parent)
@@ -182,10 +189,16 @@ private:
    Int_t    GetBasketAndFirst(TBasket*& basket, Long64_t& first, TBuffer* user_buffer);
    TBasket *GetBasketImpl(Int_t basket, TBuffer* user_buffer);
    Int_t    GetBulkEntries(Long64_t, TBuffer&);
+   Int_t    GetBulkEntries(Long64_t, TBuffer&, std::vector<Int_t>&);
+   Bool_t   GetBulkEntryLayout(Int_t &elementSize, Int_t &headerSize) const;
    Int_t    GetEntriesSerialized(Long64_t N, TBuffer& user_buf) {return GetEntriesSerialized(N, user_buf, nullptr);}
    Int_t    GetEntriesSerialized(Long64_t, TBuffer&, TBuffer*);
    Int_t    FillEntryBuffer(TBasket* basket,TBuffer* buf, Int_t& lnew);
+   Int_t    FillBulkImpl(Long64_t first, Long64_t n, ROOT::Internal::TBranchIMTHelper *imtHelper);
    Int_t    WriteBasketImpl(TBasket* basket, Int_t where, ROOT::Internal::TBranchIMTHelper *);
+   Int_t    WriteBasketAsync(TBasket* basket, TFile *file, ROOT::Internal::TBasketCompressor &compressor);
+   Int_t    FinishAsyncBasket(TBasket* basket, Int_t where, TFile *file, Int_t nout);
+   void     UpdateEntryOffsetLen(Int_t nevbuf);
    TBranch(const TBranch&) = delete;             // not implemented
    TBranch& operator=(const TBranch&) = delete;  // not implemented
 
@@ -287,6 +300,8 @@ public:
    virtual void      SetTree(TTree *tree) { fTree = tree; }
    virtual void      SetupAddresses();
            Bool_t    SupportsBulkRead() const;
+           Bool_t    SupportsBulkReadWithOffsets() const;
+           Bool_t    SupportsBulkWrite() const;
    virtual void      UpdateAddress() {}
    virtual void      UpdateFile();
 
@@ -320,7 +335,9 @@ namespace Internal {
 inline Int_t  TBulkBranchRead::GetBulkEntries(Long64_t evt, TBuffer& user_buf) { return fParent.GetBulkEntries(evt, user_buf); }
 inline Int_t  TBulkBranchRead::GetEntriesSerialized(Long64_t evt, TBuffer& user_buf) { return fParent.GetEntriesSerialized(evt, user_buf); }
 inline Int_t  TBulkBranchRead::GetEntriesSerialized(Long64_t evt, TBuffer& user_buf, TBuffer* count_buf) { return fParent.GetEntriesSerialized(evt, user_buf, count_buf); }
+inline Int_t  TBulkBranchRead::GetBulkEntries(Long64_t evt, TBuffer& user_buf, std::vector<Int_t>& offsets) { return fParent.GetBulkEntries(evt, user_buf, offsets); }
 inline Bool_t TBulkBranchRead::SupportsBulkRead() const { return fParent.SupportsBulkRead(); }
+inline Bool_t TBulkBranchRead::SupportsBulkReadWithOffsets() const { return fParent.SupportsBulkReadWithOffsets(); }
 
 }  // Internal
 }  // Experimental
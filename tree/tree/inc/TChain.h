@@ -54,6 +54,7 @@ private:
 protected:
    void InvalidateCurrentTree();
    void ReleaseChainProof();
+   void LoadEntriesConcurrently();
 
 public:
    // TChain constants
@@ -14,11 +14,13 @@
 //
 // Used internally in TEntryList to store the entry numbers.
 //
-// There are 2 ways to represent entry numbers in a TEntryListBlock:
+// There are 3 ways to represent entry numbers in a TEntryListBlock:
 // 1) as bits, where passing entry numbers are assigned 1, not passing - 0
 // 2) as a simple array of entry numbers
-// In both cases, a UShort_t* is used. The second option is better in case
-// less than 1/16 of entries passes the selection, and the representation can be
+// 3) as ranges of consecutive passing entries (pairs of first and last entry)
+// In all cases, a UShort_t* is used. The second option is better in case
+// less than 1/16 of entries passes the selection, the third one in case the
+// passing entries come in long runs, and the representation can be
 // changed by calling OptimizeStorage() function.
 // When the block is being filled, it's always stored as bits, and the OptimizeStorage()
 // function is called by TEntryList when it starts filling the next block. If
@@ -26,9 +28,9 @@
 // again changed to 1).
 //
 // Operations on blocks (see also function comments):
-// - Merge() - adds all entries from one block to the other. If the first block
-//             uses array representation, it's changed to bits representation only
-//             if the total number of passing entries is still less than kBlockSize
+// - Merge() - adds all entries from one block to the other. Unless both blocks
+//             are short lists, the union is computed on the bits
+// - Subtract() - removes all entries of one block from the other
 // - GetEntry(n) - returns n-th non-zero entry.
 // - Next()      - return next non-zero entry. In case of representation 1), Next()
 //                 is faster than GetEntry()
@@ -47,7 +49,7 @@ class TEntryListBlock:public TObject
                                 ///< not in the entry list
    Int_t    fN;                 ///< size of fIndices for I/O  =fNPassed for list, fBlockSize for bits
    UShort_t *fIndices;          ///<[fN]
-   Int_t    fType;              ///<0 - bits, 1 - list
+   Int_t    fType;              ///<0 - bits, 1 - list, 2 - ranges
    Bool_t   fPassing;           ///<1 - stores entries that belong to the list
                                 ///<0 - stores entries that don't belong to the list
    UShort_t fCurrent;           ///<! to fasten  Contains() in list mode
@@ -55,6 +57,9 @@ class TEntryListBlock:public TObject
    Int_t    fLastIndexReturned; ///<! to optimize GetEntry() in a loop
 
    void Transform(Bool_t dir, UShort_t *indexnew);
+   void TransformToRanges(Int_t nranges);
+   void GetBits(UShort_t *bits) const;
+   Int_t GetNRanges() const;
 
  public:
 
@@ -69,15 +74,17 @@ class TEntryListBlock:public TObject
    Int_t   Contains(Int_t entry);
    void    OptimizeStorage();
    Int_t   Merge(TEntryListBlock *block);
+   Int_t   Subtract(TEntryListBlock *block);
    Int_t   Next();
    Int_t   GetEntry(Int_t entry);
    void    ResetIndices() {fLastIndexQueried = -1, fLastIndexReturned = -1;}
    Int_t   GetType() { return fType; }
    Int_t   GetNPassed();
+   Int_t   GetNPassedBefore(Int_t entry);
    void Print(const Option_t *option = "") const override;
    void    PrintWithShift(Int_t shift) const;
 
-   ClassDefOverride(TEntryListBlock, 1) //Used internally in TEntryList to store the entry numbers
+   ClassDefOverride(TEntryListBlock, 2) //Used internally in TEntryList to store the entry numbers
 
 };
 
@@ -28,6 +28,7 @@
 
 #include "Compression.h"
 #include "ROOT/TIOFeatures.hxx"
+#include "TArrayC.h"
 #include "TArrayD.h"
 #include "TArrayI.h"
 #include "TAttFill.h"
@@ -76,6 +77,12 @@ class TTreeCloner;
 class TFileMergeInfo;
 class TVirtualPerfStats;
 
+namespace ROOT {
+namespace Internal {
+class TBasketCompressor;
+}
+} // namespace ROOT
+
 class TTree : public TNamed, public TAttLine, public TAttFill, public TAttMarker {
 
    using TIOFeatures = ROOT::TIOFeatures;
@@ -126,6 +133,9 @@ protected:
    TEntryList    *fEntryList;             ///<! Pointer to event selection list (if one)
    TArrayD        fIndexValues;           ///<  Sorted index values
    TArrayI        fIndex;                 ///<  Index of sorted values
+   TArrayC        fCompressionDictionary; ///<  ZSTD dictionary used to compress the baskets (if any)
+   UInt_t         fCompressionDictionaryId{0};   ///<! ZSTD ID of fCompressionDictionary once registered
+   Int_t          fCompressionDictionarySize{0}; ///<! Size of the dictionary trained at the first flush (if any)
    TVirtualIndex *fTreeIndex;             ///<  Pointer to the tree Index (if any)
    TList         *fFriends;               ///<  pointer to list of friend elements
    TList         *fExternalFriends;       ///<! List of TFriendsElement pointing to us and need to be notified of LoadTree.  Content not owned.
@@ -153,18 +163,24 @@ protected:
 
    static Int_t     fgBranchStyle;        ///<  Old/New branch style
    static Long64_t  fgMaxTreeSize;        ///<  Maximum size of a file containing a Tree
+   static std::atomic<TVirtualPerfStats *> fgDefaultPerfStats; ///<! Perf stats of the trees without their own
 
 private:
    // For simplicity, although fIMTFlush is always disabled in non-IMT builds, we don't #ifdef it out.
    mutable Bool_t fIMTFlush{false};               ///<! True if we are doing a multithreaded flush.
    mutable std::atomic<Long64_t> fIMTTotBytes;    ///<! Total bytes for the IMT flush baskets
    mutable std::atomic<Long64_t> fIMTZipBytes;    ///<! Zip bytes for the IMT flush baskets.
+   Int_t fMaxBasketsInFlight{0};                  ///<! Max baskets compressed during Fill, see SetMaxBasketsInFlight()
+   ROOT::Internal::TBasketCompressor *fBasketCompressor{nullptr}; ///<! Baskets compressed during Fill, if any
 
    void             InitializeBranchLists(bool checkLeafCount);
    void             SortBranchesByTime();
+   Int_t            FinishAsyncBaskets(Int_t maxInFlight, Bool_t write = kTRUE) const;
    Int_t            FlushBasketsImpl() const;
    void             MarkEventCluster();
    Long64_t         GetMedianClusterSize();
+   void             FillFriendCache(TTree *friendTree, Long64_t entry);
+   void             FlushAndSaveIfNeeded();
 
 protected:
    virtual void     KeepCircular();
@@ -311,6 +327,43 @@ public:
       Long64_t operator()() { return Next(); }
    };
 
+   /// How well the clusters and baskets written with SetClusterTuning() met their target sizes
+   struct TClusterTuningStats {
+      Long64_t fTargetClusterBytes = 0;    ///< Target compressed size of the clusters
+      Int_t    fTargetBasketBytes = 0;     ///< Target size of the baskets, 0 if they are not tuned
+      Long64_t fNClusters = 0;             ///< Number of clusters written since the tuning was enabled
+      Long64_t fNClustersOnTarget = 0;     ///< Number of clusters within 25% of the target size
+      Long64_t fMinClusterBytes = 0;       ///< Compressed size of the smallest cluster
+      Long64_t fMaxClusterBytes = 0;       ///< Compressed size of the largest cluster
+      Double_t fMeanClusterBytes = 0;      ///< Mean compressed size of the clusters
+      Double_t fMeanClusterDeviation = 0;  ///< Mean of |cluster size / target size - 1|
+      Long64_t fNClusterSizeChanges = 0;   ///< Number of times the number of entries per cluster was changed
+      Long64_t fNBaskets = 0;              ///< Number of baskets written in these clusters
+      Long64_t fNSmallBaskets = 0;         ///< Baskets of the branches that wrote several baskets per cluster, with a mean size below half the target
+      Double_t fMeanBasketBytes = 0;       ///< Mean size of the baskets
+      Double_t fMaxBasketBytes = 0;        ///< Largest mean size of the baskets of a branch in a cluster
+   };
+
+private:
+   /// The bytes and baskets written by a branch up to the end of the previous cluster
+   struct TTuningBranchState {
+      TBranch *fBranch = nullptr;
+      Long64_t fTotBytes = 0;
+      Int_t    fBaskets = 0;
+   };
+
+   Long64_t fTuningClusterBytes{0};       ///<! Target compressed size of the clusters, 0 if the tuning is disabled
+   Int_t    fTuningBasketBytes{0};        ///<! Target size of the baskets, 0 if they are not tuned
+   Long64_t fTuningClusterStart{0};       ///<! First entry of the current cluster, -1 if not known yet
+   Long64_t fTuningZipBytes{0};           ///<! Compressed bytes written before the current cluster
+   Double_t fTuningBytesPerEntry{0};      ///<! Smoothed compressed size of an entry
+   std::vector<TTuningBranchState> fTuningBranches; ///<! State of the branches with data, in the order of the leaves
+   TClusterTuningStats fTuningStats;      ///<! Statistics of the clusters written while tuning
+
+   void             TuneClusterSizes();
+
+public:
+
    TTree();
    TTree(const char* name, const char* title, Int_t splitlevel = 99, TDirectory* dir = gDirectory);
    ~TTree() override;
@@ -435,6 +488,7 @@ public:
    virtual void            DropBuffers(Int_t nbytes);
            Bool_t          EnableCache();
    virtual Int_t           Fill();
+   virtual Int_t           FillBulk(Long64_t nEntries);
    virtual TBranch        *FindBranch(const char* name);
    virtual TLeaf          *FindLeaf(const char* name);
    virtual Int_t           Fit(const char* funcname, const char* varexp, const char* selection = "", Option_t* option = "", Option_t* goption = "", Long64_t nentries = kMaxEntries, Long64_t firstentry = 0); // *MENU*
@@ -452,9 +506,13 @@ public:
    static  Int_t           GetBranchStyle();
    virtual Long64_t        GetCacheSize() const { return fCacheSize; }
    virtual TClusterIterator GetClusterIterator(Long64_t firstentry);
+   const TClusterTuningStats &GetClusterTuningStats() const { return fTuningStats; }
    virtual Long64_t        GetChainEntryNumber(Long64_t entry) const { return entry; }
    virtual Long64_t        GetChainOffset() const { return fChainOffset; }
    virtual Bool_t          GetClusterPrefetch() const { return fCacheDoClusterPrefetch; }
+           const TArrayC  &GetCompressionDictionary() const { return fCompressionDictionary; }
+           UInt_t          GetCompressionDictionaryId() const { return fCompressionDictionaryId; }
+           Int_t           GetCompressionDictionarySize() const { return fCompressionDictionarySize; }
            TFile          *GetCurrentFile() const;
            Int_t           GetDefaultEntryOffsetLen() const {return fDefaultEntryOffsetLen;}
            Long64_t        GetDebugMax()  const { return fDebugMax; }
@@ -478,6 +536,7 @@ public:
    virtual const char     *GetFriendAlias(TTree*) const;
            TH1            *GetHistogram() { return GetPlayer()->GetHistogram(); }
    virtual Bool_t          GetImplicitMT() { return fIMTEnabled; }
+           Int_t           GetMaxBasketsInFlight() const { return fMaxBasketsInFlight; }
    virtual Int_t          *GetIndex() { return &fIndex.fArray[0]; }
    virtual Double_t       *GetIndexValues() { return &fIndexValues.fArray[0]; }
            ROOT::TIOFeatures GetIOFeatures() const;
@@ -503,7 +562,8 @@ public:
            TObject        *GetNotify() const { return fNotify; }
    TVirtualTreePlayer     *GetPlayer();
    virtual Int_t           GetPacketSize() const { return fPacketSize; }
-   virtual TVirtualPerfStats *GetPerfStats() const { return fPerfStats; }
+   virtual TVirtualPerfStats *GetPerfStats() const { return fPerfStats ? fPerfStats : GetDefaultPerfStats(); }
+   static  TVirtualPerfStats *GetDefaultPerfStats() { return fgDefaultPerfStats.load(std::memory_order_acquire); }
            TTreeCache     *GetReadCache(TFile *file) const;
            TTreeCache     *GetReadCache(TFile *file, Bool_t create);
    virtual Long64_t        GetReadEntry()  const { return fReadEntry; }
@@ -609,6 +669,9 @@ public:
    virtual void            SetChainOffset(Long64_t offset = 0) { fChainOffset=offset; }
    virtual void            SetCircular(Long64_t maxEntries);
    virtual void            SetClusterPrefetch(Bool_t enabled) { fCacheDoClusterPrefetch = enabled; }
+           void            SetClusterTuning(Long64_t clusterBytes = 30000000, Int_t basketBytes = 256000);
+           Bool_t          SetCompressionDictionary(const char *dict, Int_t size);
+           void            SetCompressionDictionarySize(Int_t size) { fCompressionDictionarySize = size; }
    virtual void            SetDebug(Int_t level = 1, Long64_t min = 0, Long64_t max = 9999999); // *MENU*
    virtual void            SetDefaultEntryOffsetLen(Int_t newdefault, Bool_t updateExisting = kFALSE);
    virtual void            SetDirectory(TDirectory* dir);
@@ -619,6 +682,7 @@ public:
    virtual void            SetEventList(TEventList* list);
    virtual void            SetEntryList(TEntryList* list, Option_t *opt="");
    virtual void            SetImplicitMT(Bool_t enabled) { fIMTEnabled = enabled; }
+           void            SetMaxBasketsInFlight(Int_t n);
    virtual void            SetMakeClass(Int_t make);
    virtual void            SetMaxEntryLoop(Long64_t maxev = kMaxEntries) { fMaxEntryLoop = maxev; } // *MENU*
    static  void            SetMaxTreeSize(Long64_t maxsize = 100000000000LL);
@@ -642,6 +706,7 @@ public:
    virtual void            SetObject(const char* name, const char* title);
    virtual void            SetParallelUnzip(Bool_t opt=kTRUE, Float_t RelSize=-1);
    virtual void            SetPerfStats(TVirtualPerfStats* perf);
+   static  void            SetDefaultPerfStats(TVirtualPerfStats *perf);
    virtual void            SetScanField(Int_t n = 50) { fScanField = n; } // *MENU*
    void SetTargetMemoryRatio(Float_t ratio) { fTargetMemoryRatio = ratio; }
    virtual void            SetTimerInterval(Int_t msec = 333) { fTimerInterval=msec; }
@@ -651,12 +716,13 @@ public:
    virtual void            Show(Long64_t entry = -1, Int_t lenmax = 20);
    virtual void            StartViewer(); // *MENU*
    virtual Int_t           StopCacheLearningPhase();
+           Int_t           TrainCompressionDictionary(Int_t maxSize = 16384);
    virtual Int_t           UnbinnedFit(const char* funcname, const char* varexp, const char* selection = "", Option_t* option = "", Long64_t nentries = kMaxEntries, Long64_t firstentry = 0);
            void            UseCurrentStyle() override;
            Int_t           Write(const char *name=nullptr, Int_t option=0, Int_t bufsize=0) override;
            Int_t           Write(const char *name=nullptr, Int_t option=0, Int_t bufsize=0) const override;
 
-   ClassDefOverride(TTree, 20) // Tree descriptor (the main ROOT I/O class)
+   ClassDefOverride(TTree, 21) // Tree descriptor (the main ROOT I/O class)
 };
 
 //////////////////////////////////////////////////////////////////////////
@@ -22,11 +22,18 @@
 //////////////////////////////////////////////////////////////////////////
 
 #include "TFileCacheRead.h"
+#include <string>
 
 #include <vector>
 
 class TTree;
 class TBranch;
+
+namespace ROOT {
+namespace Experimental {
+class RIOFileMetrics;
+}
+}
 class TObjArray;
 
 class TTreeCache : public TFileCacheRead {
@@ -41,6 +48,8 @@ protected:
    Long64_t     fEntryNext{-1};       ///<! next entry number where cache must be filled
    Long64_t     fCurrentClusterStart{-1}; ///<! Start of the cluster(s) where the current content was picked out
    Long64_t     fNextClusterStart{-1};    ///<! End+1 of the cluster(s) where the current content was picked out
+   Long64_t     fFriendMasterStart{-1};   ///<! First entry of the main tree whose friend entries were prefetched
+   Long64_t     fFriendMasterNext{-1};    ///<! End+1 of the entries of the main tree whose friend entries were prefetched
    Int_t        fNbranches{0};        ///<! Number of branches in the cache
    Int_t        fNReadOk{0};          ///<  Number of blocks read and found in the cache
    Int_t        fNMissReadOk{0};      ///<  Number of blocks read, not found in the primary cache, and found in the secondary cache.
@@ -66,6 +75,9 @@ protected:
    Bool_t       fAutoCreated{kFALSE}; ///<! true if cache was automatically created
 
    Bool_t       fLearnPrefilling{kFALSE}; ///<! true if we are in the process of executing LearnPrefill
+   std::string  fTrainingProfile;     ///<! file the learned branches are loaded from and saved to, if any
+   /// Cache hits and misses, and decompression by TTreeCacheUnzip, if ROOT::Experimental::RIOMetrics is enabled
+   ROOT::Experimental::RIOFileMetrics *fIOMetrics{nullptr}; ///<!
 
    // These members hold cached data for missed branches when miss optimization
    // is enabled.  Pointers are only initialized if the miss cache is enabled.
@@ -104,6 +116,8 @@ protected:
 
    std::unique_ptr<MissCache> fMissCache; ///<! Cache contents for misses
 
+   void SaveLearnedBranches() const;
+
 private:
    TTreeCache(const TTreeCache &) = delete; ///< this class cannot be copied
    TTreeCache &operator=(const TTreeCache &) = delete;
@@ -138,6 +152,7 @@ public:
    Bool_t               GetOptimizeMisses() const { return fOptimizeMisses; }
    const TObjArray     *GetCachedBranches() const { return fBranches; }
    EPrefillType         GetConfiguredPrefillType() const;
+   std::string          GetConfiguredTrainingProfile() const;
    Double_t             GetEfficiency() const;
    Double_t             GetEfficiencyRel() const;
    virtual Int_t        GetEntryMin() const {return fEntryMin;}
@@ -146,14 +161,22 @@ public:
    virtual EPrefillType GetLearnPrefill() const {return fPrefillType;}
    Double_t             GetMissEfficiency() const;
    Double_t             GetMissEfficiencyRel() const;
+   const char          *GetTrainingProfile() const { return fTrainingProfile.c_str(); }
    TTree               *GetTree() const {return fTree;}
    Bool_t               IsAutoCreated() const {return fAutoCreated;}
    virtual Bool_t       IsEnabled() const {return fEnabled;}
    Bool_t               IsLearning() const override {return fIsLearning;}
 
    virtual Bool_t       FillBuffer();
+   Bool_t               FillBufferFriend(std::vector<Long64_t> entries, Long64_t masterStart, Long64_t masterNext);
+   /// Whether FillBufferFriend() was called for the range of the main tree holding masterEntry
+   Bool_t               HasFriendEntries(Long64_t masterEntry) const
+   {
+      return fFriendMasterStart <= masterEntry && masterEntry < fFriendMasterNext;
+   }
    Int_t                LearnBranch(TBranch *b, Bool_t subgbranches = kFALSE) override;
    virtual void         LearnPrefill();
+   Int_t                LoadTrainingProfile(const char *filename);
 
    void                 Print(Option_t *option="") const override;
    Int_t                ReadBuffer(char *buf, Long64_t pos, Int_t len) override;
@@ -161,6 +184,7 @@ public:
    virtual Int_t        ReadBufferPrefetch(char *buf, Long64_t pos, Int_t len);
    virtual void         ResetCache();
    void                 ResetMissCache(); // Reset the miss cache.
+   Int_t                SaveTrainingProfile(const char *filename) const;
    void                 SetAutoCreated(Bool_t val) {fAutoCreated = val;}
    Int_t                SetBufferSize(Int_t buffersize) override;
    virtual void         SetEntryRange(Long64_t emin,   Long64_t emax);
@@ -168,6 +192,7 @@ public:
    virtual void         SetLearnPrefill(EPrefillType type = kNoPrefill);
    static void          SetLearnEntries(Int_t n = 10);
    void                 SetOptimizeMisses(Bool_t opt);
+   void                 SetTrainingProfile(const char *filename) { fTrainingProfile = filename ? filename : ""; }
    void                 StartLearningPhase();
    virtual void         StopLearningPhase();
    virtual void         UpdateBranches(TTree *tree);
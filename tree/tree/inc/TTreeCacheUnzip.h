@@ -77,11 +77,27 @@ protected:
    typedef struct UnzipState UnzipState_t;
    UnzipState_t fUnzipState;
 
+   // Compressed baskets of the cluster following the one in the cache, read ahead
+   // while the baskets of the current cluster are being unzipped
+   struct NextCluster {
+      Long64_t                fEntryStart;   ///<! First entry of the cluster, -1 if nothing was read ahead
+      Long64_t                fEntryEnd;     ///<! First entry after the cluster
+      std::vector<Long64_t>   fSeekSort;     ///<! Sorted positions of the baskets on file
+      std::vector<Int_t>      fSeekSortLen;  ///<! Lengths of the baskets, in the order of fSeekSort
+      std::unique_ptr<char[]> fBuffer;       ///<! The baskets, back to back in the order of fSeekSort
+      Int_t                   fBufferSize;   ///<! Allocated size of fBuffer
+
+      NextCluster() : fEntryStart(-1), fEntryEnd(-1), fBufferSize(0) {}
+   };
+
+   NextCluster fNextCluster;
+
    // Members for paral. managing
    Bool_t      fAsyncReading;
    Bool_t      fEmpty;
    Int_t       fCycle;
    Bool_t      fParallel; ///< Indicate if we want to activate the parallelism (for this instance)
+   Bool_t      fPrefetchNextCluster; ///< Read the next cluster while the current one is being unzipped
 
    std::unique_ptr<TMutex> fIOMutex;
 
@@ -104,6 +120,7 @@ protected:
    Int_t       fNMissed;          ///<! number of blocks that were not found in the cache and were unzipped
    Int_t       fNStalls;          ///<! number of hits which caused a stall
    Int_t       fNUnzip;           ///<! number of blocks that were unzipped
+   Int_t       fNClusterReadAhead; ///<! number of clusters whose baskets were found already read ahead
 
 private:
    TTreeCacheUnzip(const TTreeCacheUnzip &) = delete;
@@ -114,6 +131,9 @@ private:
 
    // Private methods
    void  Init();
+   Bool_t AdoptNextCluster();
+   void  CollectBaskets(Long64_t entry, Long64_t entryEnd, std::vector<Long64_t> &pos, std::vector<Int_t> &len);
+   void  StopUnzipTasks();
 
 public:
    TTreeCacheUnzip();
@@ -140,8 +160,11 @@ public:
    Int_t          GetRecordHeader(char *buf, Int_t maxbytes, Int_t &nbytes, Int_t &objlen, Int_t &keylen);
    Int_t          GetUnzipBuffer(char **buf, Long64_t pos, Int_t len, Bool_t *free) override;
    Int_t          GetUnzipGroupSize() { return fUnzipGroupSize; }
+   Bool_t         IsPrefetchNextCluster() const { return fPrefetchNextCluster; }
+   void           PrefetchNextCluster();
    void           ResetCache() override;
    Int_t          SetBufferSize(Int_t buffersize) override;
+   void           SetPrefetchNextCluster(Bool_t prefetch = kTRUE) { fPrefetchNextCluster = prefetch; }
    void           SetUnzipBufferSize(Long64_t bufferSize);
    void           SetUnzipGroupSize(Int_t groupSize) { fUnzipGroupSize = groupSize; }
    static void    SetUnzipRelBufferSize(Float_t relbufferSize);
@@ -152,6 +175,7 @@ public:
    Int_t  GetNUnzip() { return fNUnzip; }
    Int_t  GetNMissed(){ return fNMissed; }
    Int_t  GetNFound() { return fNFound; }
+   Int_t  GetNClusterReadAhead() { return fNClusterReadAhead; }
 
    void Print(Option_t* option = "") const override;
 
@@ -84,6 +84,7 @@ class TTreeCloner {
    friend class CompareEntry;
 
    void ImportClusterRanges();
+   void ImportCompressionDictionary();
    void CreateCache();
    UInt_t FillCache(UInt_t from);
    void RestoreCache();
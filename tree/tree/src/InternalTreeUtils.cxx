@@ -11,6 +11,7 @@
 #include "TBranch.h" // Usage of TBranch in ClearMustCleanupBits
 #include "TChain.h"
 #include "TCollection.h" // TRangeStaticCast
+#include "TEnv.h"
 #include "TFile.h"
 #include "TFriendElement.h"
 #include "TObjString.h"
@@ -20,8 +21,13 @@
 #include "TTree.h"
 #include "TVirtualIndex.h"
 
+#include <algorithm>
+#include <atomic>
 #include <cstdint> // std::uint64_t
+#include <exception>
 #include <limits>
+#include <mutex>
+#include <thread>
 #include <utility> // std::pair
 #include <vector>
 #include <stdexcept> // std::runtime_error
@@ -478,6 +484,55 @@ std::vector<std::string> ExpandGlob(const std::string &glob)
    }
 }
 
+/// Return the maximum number of files whose metadata (number of entries, cluster boundaries) are retrieved
+/// concurrently, as set by `TTree.MetadataConcurrency` in the rootrc (default 16).
+unsigned int GetMetadataConcurrency()
+{
+   return std::max(1, gEnv->GetValue("TTree.MetadataConcurrency", 16));
+}
+
+/// Call `func` with every index in [0, n), on up to `maxConcurrency` threads.
+///
+/// This is meant to open the files of a dataset concurrently. Opening remote files is dominated by latency, so these
+/// threads mostly wait: they are plain threads that do not take workers from the implicit multi-threading pool.
+/// The caller must make sure that ROOT is thread-safe if `maxConcurrency` is larger than one. If `func` throws, the
+/// indices that are not started yet are skipped and the first exception is rethrown once all threads are done.
+void ForEachIndexConcurrently(std::size_t n, unsigned int maxConcurrency,
+                              const std::function<void(std::size_t)> &func)
+{
+   const auto nThreads = std::min<std::size_t>(n, maxConcurrency);
+   if (nThreads <= 1) {
+      for (std::size_t i = 0; i < n; ++i)
+         func(i);
+      return;
+   }
+
+   std::atomic<std::size_t> next{0};
+   std::atomic<bool> hasFailed{false};
+   std::exception_ptr error;
+   std::mutex errorMutex;
+   auto work = [&]() {
+      for (auto i = next++; i < n && !hasFailed; i = next++) {
+         try {
+            func(i);
+         } catch (...) {
+            std::lock_guard<std::mutex> lock(errorMutex);
+            if (!error)
+               error = std::current_exception();
+            hasFailed = true;
+         }
+      }
+   };
+   std::vector<std::thread> threads;
+   for (std::size_t i = 1; i < nThreads; ++i)
+      threads.emplace_back(work);
+   work();
+   for (auto &t : threads)
+      t.join();
+   if (error)
+      std::rethrow_exception(error);
+}
+
 } // namespace TreeUtils
 } // namespace Internal
 } // namespace ROOT
@@ -25,8 +25,10 @@
 #include "TTimeStamp.h"
 #include "ROOT/TIOFeatures.hxx"
 #include "RZip.h"
+#include "TEnv.h"
 
 #include <bitset>
+#include <vector>
 
 const UInt_t kDisplacementMask = 0xFF000000;  // In the streamer the two highest bytes of
                                               // the fEntryOffset are used to stored displacement.
@@ -41,6 +43,123 @@ Manages buffers for branches of a Tree.
 See picture in TTree.
 */
 
+namespace {
+
+////////////////////////////////////////////////////////////////////////////////
+/// Per-thread cache of basket buffers, shared by the baskets of all the branches.
+///
+/// Reading a tree with many branches allocates and frees one uncompressed buffer per
+/// basket, and the compressed data only needs to live until it is unzipped. The buffers
+/// of the baskets that are deleted or dropped are kept here, sorted in power-of-two size
+/// classes, and handed out again to the next baskets read on the same thread. The pool
+/// holds at most TTree.BasketBufferPoolSize megabytes (see rootrc); buffers beyond that
+/// are freed.
+
+class TBasketBufferPool {
+   static constexpr int kNSizeClasses = 32;
+   std::vector<TBuffer *> fBuffers[kNSizeClasses]; ///< Free buffers, indexed by floor(log2(buffer size))
+   Long64_t fNBytes = 0;                           ///< Total size of the free buffers
+
+   /// Set once the pool of the thread is destroyed: baskets deleted afterwards, e.g. during
+   /// the tear down of the process, free their buffers directly.
+   static thread_local bool fgIsDestroyed;
+
+   ~TBasketBufferPool()
+   {
+      for (auto &buffers : fBuffers)
+         for (auto buffer : buffers)
+            delete buffer;
+      fgIsDestroyed = true;
+   }
+
+   static TBasketBufferPool *Get()
+   {
+      if (fgIsDestroyed)
+         return nullptr;
+      thread_local TBasketBufferPool pool;
+      return &pool;
+   }
+
+   static Long64_t GetMaxBytes()
+   {
+      static const Long64_t maxBytes = Long64_t(gEnv->GetValue("TTree.BasketBufferPoolSize", 64)) * 1024 * 1024;
+      return maxBytes;
+   }
+
+   /// Returns the index of the highest bit set in `size`.
+   static int GetSizeClass(UInt_t size)
+   {
+      int sizeClass = 0;
+      while (size >>= 1)
+         ++sizeClass;
+      return sizeClass;
+   }
+
+public:
+   /// Returns a buffer of at least `len` bytes, or nullptr if the pool has none.
+   /// Only the two smallest size classes that can serve `len` are searched, to
+   /// bound the memory wasted by a large buffer holding a small basket.
+   static TBuffer *Acquire(Int_t len)
+   {
+      TBasketBufferPool *pool = Get();
+      if (!pool)
+         return nullptr;
+      const UInt_t size = len > 0 ? len : 1;
+      int sizeClass = GetSizeClass(size);
+      if ((1u << sizeClass) < size)
+         ++sizeClass;
+      for (int i = sizeClass; i < kNSizeClasses && i <= sizeClass + 1; ++i) {
+         auto &buffers = pool->fBuffers[i];
+         if (!buffers.empty()) {
+            TBuffer *buffer = buffers.back();
+            buffers.pop_back();
+            pool->fNBytes -= buffer->BufferSize();
+            return buffer;
+         }
+      }
+      return nullptr;
+   }
+
+   /// Takes ownership of `buffer`, keeping it for later use or deleting it.
+   static void Release(TBuffer *buffer)
+   {
+      if (!buffer)
+         return;
+      TBasketBufferPool *pool = Get();
+      const Int_t size = buffer->BufferSize();
+      // Buffers that point to memory they do not own (e.g. the unzipped buffers of
+      // TTreeCacheUnzip) cannot be recycled.
+      if (!pool || !buffer->TestBit(TBuffer::kIsOwner) || !buffer->Buffer() || size <= 0 ||
+          pool->fNBytes + size > GetMaxBytes()) {
+         delete buffer;
+         return;
+      }
+      buffer->ResetBit(TBufferFile::kNotDecompressed);
+      buffer->SetParent(nullptr);
+      pool->fBuffers[GetSizeClass(size)].push_back(buffer);
+      pool->fNBytes += size;
+   }
+};
+
+thread_local bool TBasketBufferPool::fgIsDestroyed = false;
+
+////////////////////////////////////////////////////////////////////////////////
+/// Gives a buffer of the pool back when going out of scope.
+
+class TPooledBasketBuffer {
+   TBuffer *fBuffer = nullptr;
+
+public:
+   TPooledBasketBuffer() = default;
+   TPooledBasketBuffer(const TPooledBasketBuffer &) = delete;
+   TPooledBasketBuffer &operator=(const TPooledBasketBuffer &) = delete;
+   ~TPooledBasketBuffer() { TBasketBufferPool::Release(fBuffer); }
+
+   TBuffer *&Get() { return fBuffer; }
+};
+
+} // anonymous namespace
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Default constructor.
 
@@ -72,18 +191,8 @@ TBasket::TBasket(const char *name, const char *title, TBranch *branch)
       TFile *file = branch->GetFile();
       fBufferRef->SetParent(file);
    }
-   if (branch->GetTree()) {
-#ifdef R__USE_IMT
-      fCompressedBufferRef = branch->GetTransientBuffer(fBufferSize);
-#else
-      fCompressedBufferRef = branch->GetTree()->GetTransientBuffer(fBufferSize);
-#endif
-      fOwnsCompressedBuffer = kFALSE;
-      if (!fCompressedBufferRef) {
-         fCompressedBufferRef = new TBufferFile(TBuffer::kRead, fBufferSize);
-         fOwnsCompressedBuffer = kTRUE;
-      }
-   }
+   // The compressed buffer is only needed to write the basket, see WriteBuffer();
+   // reading uses the buffers of the per-thread pool.
    fBranch = branch;
    Streamer(*fBufferRef);
    fKeylen      = fBufferRef->Length();
@@ -105,13 +214,13 @@ TBasket::~TBasket()
 {
    if (fDisplacement) delete [] fDisplacement;
    ResetEntryOffset();
-   if (fBufferRef) delete fBufferRef;
+   TBasketBufferPool::Release(fBufferRef);
    fBufferRef = 0;
    fBuffer = 0;
    fDisplacement= 0;
    // Note we only delete the compressed buffer if we own it
    if (fCompressedBufferRef && fOwnsCompressedBuffer) {
-      delete fCompressedBufferRef;
+      TBasketBufferPool::Release(fCompressedBufferRef);
       fCompressedBufferRef = 0;
    }
    // TKey::~TKey will use fMotherDir to attempt to remove they key
@@ -176,8 +285,8 @@ Int_t TBasket::DropBuffers()
 
    if (fDisplacement) delete [] fDisplacement;
    ResetEntryOffset();
-   if (fBufferRef)    delete fBufferRef;
-   if (fCompressedBufferRef && fOwnsCompressedBuffer) delete fCompressedBufferRef;
+   TBasketBufferPool::Release(fBufferRef);
+   if (fCompressedBufferRef && fOwnsCompressedBuffer) TBasketBufferPool::Release(fCompressedBufferRef);
    fBufferRef   = 0;
    fCompressedBufferRef = 0;
    fBuffer      = 0;
@@ -419,6 +528,9 @@ static inline TBuffer* R__InitializeReadBasketBuffer(TBuffer* bufferRef, Int_t l
       }
       bufferRef->Reset();
       result = bufferRef;
+   } else if ((result = TBasketBufferPool::Acquire(len))) {
+      result->SetReadMode();
+      result->Reset();
    } else {
       result = new TBufferFile(TBuffer::kRead, len);
    }
@@ -470,6 +582,16 @@ Int_t TBasket::ReadBasketBuffers(Long64_t pos, Int_t len, TFile *file)
    Bool_t oldCase;
    char *rawUncompressedBuffer, *rawCompressedBuffer;
    Int_t uncompressedBufferLen;
+   // The compressed data is only needed until it is unzipped: it is read into a
+   // buffer of the per-thread pool, which gets it back when we return.
+   TPooledBasketBuffer compressedBuffer;
+
+   // Optional monitor for the per-branch read and unzip times.
+   TVirtualPerfStats *treePerfStats = fBranch->GetTree()->GetPerfStats();
+   Double_t readStart = 0;
+   if (R__unlikely(treePerfStats)) {
+      readStart = TTimeStamp();
+   }
 
    // See if the cache has already unzipped the buffer for us.
    TFileCacheRead *pf = nullptr;
@@ -500,8 +622,8 @@ Int_t TBasket::ReadBasketBuffers(Long64_t pos, Int_t len, TFile *file)
       readBufferRef = fBufferRef;
    } else {
       // Initialize the buffer to hold the compressed data.
-      fCompressedBufferRef = R__InitializeReadBasketBuffer(fCompressedBufferRef, len, file);
-      readBufferRef = fCompressedBufferRef;
+      compressedBuffer.Get() = R__InitializeReadBasketBuffer(nullptr, len, file);
+      readBufferRef = compressedBuffer.Get();
    }
 
    // fBufferSize is likely to be change in the Streamer call (below)
@@ -515,7 +637,7 @@ Int_t TBasket::ReadBasketBuffers(Long64_t pos, Int_t len, TFile *file)
 
    if (pf) {
       TVirtualPerfStats* temp = gPerfStats;
-      if (fBranch->GetTree()->GetPerfStats() != 0) gPerfStats = fBranch->GetTree()->GetPerfStats();
+      if (treePerfStats != 0) gPerfStats = treePerfStats;
       Int_t st = 0;
       {
          R__LOCKGUARD_IMT(gROOTMutex); // Lock for parallel TTree I/O
@@ -542,7 +664,7 @@ Int_t TBasket::ReadBasketBuffers(Long64_t pos, Int_t len, TFile *file)
    } else {
       // Read from the file and unstream the header information.
       TVirtualPerfStats* temp = gPerfStats;
-      if (fBranch->GetTree()->GetPerfStats() != 0) gPerfStats = fBranch->GetTree()->GetPerfStats();
+      if (treePerfStats != 0) gPerfStats = treePerfStats;
       R__LOCKGUARD_IMT(gROOTMutex);  // Lock for parallel TTree I/O
       if (file->ReadBuffer(readBufferRef->Buffer(),pos,len)) {
          gPerfStats = temp;
@@ -550,6 +672,9 @@ Int_t TBasket::ReadBasketBuffers(Long64_t pos, Int_t len, TFile *file)
       }
       else gPerfStats = temp;
    }
+   if (R__unlikely(treePerfStats)) {
+      treePerfStats->BasketReadEvent(fBranch, pos, len, readStart);
+   }
    Streamer(*readBufferRef);
    if (IsZombie()) {
       return 1;
@@ -566,13 +691,13 @@ Int_t TBasket::ReadBasketBuffers(Long64_t pos, Int_t len, TFile *file)
       } else {
          // Well, somehow the buffer was compressed anyway, we have the compressed data in the uncompressed buffer
          // Make sure the compressed buffer is initialized, and memcpy.
-         InitializeCompressedBuffer(len, file);
-         if (!fCompressedBufferRef) {
+         compressedBuffer.Get() = R__InitializeReadBasketBuffer(nullptr, len, file);
+         if (!compressedBuffer.Get()) {
             Error("ReadBasketBuffers", "Unable to allocate buffer.");
             return 1;
          }
          fBufferRef->Reset();
-         rawCompressedBuffer = fCompressedBufferRef->Buffer();
+         rawCompressedBuffer = compressedBuffer.Get()->Buffer();
          memcpy(rawCompressedBuffer, fBufferRef->Buffer(), len);
       }
    }
@@ -595,7 +720,7 @@ Int_t TBasket::ReadBasketBuffers(Long64_t pos, Int_t len, TFile *file)
 
       // Optional monitor for zip time profiling.
       Double_t start = 0;
-      if (R__unlikely(gPerfStats)) {
+      if (R__unlikely(gPerfStats || treePerfStats)) {
          start = TTimeStamp();
       }
 
@@ -635,11 +760,14 @@ Int_t TBasket::ReadBasketBuffers(Long64_t pos, Int_t len, TFile *file)
       }
       len = fObjlen+fKeylen;
       TVirtualPerfStats* temp = gPerfStats;
-      if (fBranch->GetTree()->GetPerfStats() != 0) gPerfStats = fBranch->GetTree()->GetPerfStats();
+      if (treePerfStats != 0) gPerfStats = treePerfStats;
       if (R__unlikely(gPerfStats)) {
          gPerfStats->UnzipEvent(fBranch->GetTree(),pos,start,nintot,fObjlen);
       }
       gPerfStats = temp;
+      if (R__unlikely(treePerfStats)) {
+         treePerfStats->BasketUnzipEvent(fBranch, pos, start, nintot, fObjlen);
+      }
    } else {
       // Nothing is compressed - copy over wholesale.
       memcpy(rawUncompressedBuffer, rawCompressedBuffer, len);
@@ -720,7 +848,7 @@ void TBasket::DisownBuffer()
 /// Adopt a buffer from an external entity
 void TBasket::AdoptBuffer(TBuffer *user_buffer)
 {
-   delete fBufferRef;
+   TBasketBufferPool::Release(fBufferRef);
    fBufferRef = user_buffer;
 }
 
@@ -1170,6 +1298,41 @@ Int_t TBasket::WriteBuffer()
       return nBytes>0 ? fKeylen+nout : -1;
    }
 
+   if (!fCompressedBufferRef) {
+#ifdef R__USE_IMT
+      fCompressedBufferRef = fBranch->GetTransientBuffer(fBufferSize);
+#else
+      fCompressedBufferRef = fBranch->GetTree()->GetTransientBuffer(fBufferSize);
+#endif
+      fOwnsCompressedBuffer = kFALSE;
+   }
+
+#ifdef R__USE_IMT
+   // Note that we allow multiple TBasket compressions to occur at once for a given TFile: that's
+   // because the compression buffer when we use IMT is no longer shared amongst several threads.
+   sentry.unlock();
+#endif  // R__USE_IMT
+   Int_t nout = CompressBuffer(file, fBranch->GetWriteBasket());
+#ifdef R__USE_IMT
+   sentry.lock();
+#endif  // R__USE_IMT
+   if (nout < 0)
+      return -1;
+
+   return WriteCompressedBuffer(file, nout);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Prepare the basket to be written to the file: transfer the entry offsets
+/// to the buffer and compress it according to the settings of the branch and
+/// of the file.
+///
+/// This does not write anything to the file, hence can run concurrently with
+/// writes to the file, see TBranch::WriteBasketAsync. Returns the size of the
+/// data to be written, without the key header, or -1 in case of error.
+
+Int_t TBasket::CompressBuffer(TFile *file, Int_t cycle)
+{
    // Transfer fEntryOffset table at the end of fBuffer.
    fLast = fBufferRef->Length();
    Int_t *entryOffset = GetEntryOffset();
@@ -1209,13 +1372,15 @@ Int_t TBasket::WriteBuffer()
    fObjlen = fBufferRef->Length() - fKeylen;
 
    fHeaderOnly = kTRUE;
-   fCycle = fBranch->GetWriteBasket();
+   fCycle = cycle;
    Int_t cxlevel = fBranch->GetCompressionLevel();
    if (cxlevel == ROOT::RCompressionSetting::ELevel::kInherit)
       cxlevel = file->GetCompressionLevel();
    ROOT::RCompressionSetting::EAlgorithm::EValues cxAlgorithm = static_cast<ROOT::RCompressionSetting::EAlgorithm::EValues>(fBranch->GetCompressionAlgorithm());
    if (cxAlgorithm == ROOT::RCompressionSetting::EAlgorithm::kInherit)
       cxAlgorithm = static_cast<ROOT::RCompressionSetting::EAlgorithm::EValues>(file->GetCompressionAlgorithm());
+   // Baskets of trees with a dictionary are compressed with it, see TTree::SetCompressionDictionary()
+   const UInt_t dictId = fBranch->GetTree()->GetCompressionDictionaryId();
    if (cxlevel > 0) {
       Int_t nbuffers = 1 + (fObjlen - 1) / kMAXZIPBUF;
       Int_t buflen = fKeylen + fObjlen + 9 * nbuffers + 28; //add 28 bytes in case object is placed in a deleted gap
@@ -1233,19 +1398,11 @@ Int_t TBasket::WriteBuffer()
       for (Int_t i = 0; i < nbuffers; ++i) {
          if (i == nbuffers - 1) bufmax = fObjlen - nzip;
          else bufmax = kMAXZIPBUF;
-         // Compress the buffer.  Note that we allow multiple TBasket compressions to occur at once
-         // for a given TFile: that's because the compression buffer when we use IMT is no longer
-         // shared amongst several threads.
-#ifdef R__USE_IMT
-         sentry.unlock();
-#endif  // R__USE_IMT
+         // Compress the buffer.
          // NOTE this is declared with C linkage, so it shouldn't except.  Also, when
          // USE_IMT is defined, we are guaranteed that the compression buffer is unique per-branch.
-         // (see fCompressedBufferRef in constructor).
-         R__zipMultipleAlgorithm(cxlevel, &bufmax, objbuf, &bufmax, bufcur, &nout, cxAlgorithm);
-#ifdef R__USE_IMT
-         sentry.lock();
-#endif  // R__USE_IMT
+         // (see fCompressedBufferRef in WriteBuffer()).
+         R__zipMultipleAlgorithmDictionary(cxlevel, &bufmax, objbuf, &bufmax, bufcur, &nout, cxAlgorithm, dictId);
 
          // test if buffer has really been compressed. In case of small buffers
          // when the buffer contains random data, it may happen that the compressed
@@ -1255,15 +1412,11 @@ Int_t TBasket::WriteBuffer()
             // We used to delete fBuffer here, we no longer want to since
             // the buffer (held by fCompressedBufferRef) might be re-used later.
             fBuffer = fBufferRef->Buffer();
-            Create(fObjlen,file);
-            fBufferRef->SetBufferOffset(0);
-
-            Streamer(*fBufferRef);         //write key itself again
             if ((nout+fKeylen)>buflen) {
                Warning("WriteBuffer","Possible memory corruption due to compression algorithm, wrote %d bytes past the end of a block of %d bytes. fNbytes=%d, fObjLen=%d, fKeylen=%d",
                   (nout+fKeylen-buflen),buflen,fNbytes,fObjlen,fKeylen);
             }
-            goto WriteFile;
+            return nout;
          }
          bufcur += nout;
          noutot += nout;
@@ -1271,21 +1424,27 @@ Int_t TBasket::WriteBuffer()
          nzip   += kMAXZIPBUF;
       }
       nout = noutot;
-      Create(noutot,file);
-      fBufferRef->SetBufferOffset(0);
-
-      Streamer(*fBufferRef);         //write key itself again
-      memcpy(fBuffer,fBufferRef->Buffer(),fKeylen);
    } else {
       fBuffer = fBufferRef->Buffer();
-      Create(fObjlen,file);
-      fBufferRef->SetBufferOffset(0);
-
-      Streamer(*fBufferRef);         //write key itself again
       nout = fObjlen;
    }
+   return nout;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Write the basket prepared by CompressBuffer() to the file, `nout` being the
+/// value it returned. Returns the number of bytes written, or -1 in case of
+/// error.
+
+Int_t TBasket::WriteCompressedBuffer(TFile *file, Int_t nout)
+{
+   Create(nout,file);
+   fBufferRef->SetBufferOffset(0);
+
+   Streamer(*fBufferRef);         //write key itself again
+   if (fBuffer != fBufferRef->Buffer())
+      memcpy(fBuffer,fBufferRef->Buffer(),fKeylen);
 
-WriteFile:
    Int_t nBytes = WriteFileKeepBuffer();
    fHeaderOnly = kFALSE;
    return nBytes>0 ? fKeylen+nout : -1;
@@ -43,6 +43,7 @@
 #include "TTree.h"
 #include "TTreeCache.h"
 #include "TTreeCacheUnzip.h"
+#include "TVirtualCollectionProxy.h"
 #include "TVirtualMutex.h"
 #include "TVirtualPad.h"
 #include "TVirtualPerfStats.h"
@@ -53,6 +54,7 @@
 
 #include "ROOT/TIOFeatures.hxx"
 
+#include <algorithm>
 #include <atomic>
 #include <cstddef>
 #include <cstring>
@@ -929,6 +931,92 @@ Int_t TBranch::FillImpl(ROOT::Internal::TBranchIMTHelper *imtHelper)
    return nbytes;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Returns true if this branch can be filled with TTree::FillBulk().
+///
+/// This is the case for TBranch objects (not derived classes) with a single leaf of a fixed-size arithmetic
+/// type (`B`, `b`, `S`, `s`, `I`, `i`, `L`, `l`, `F`, `D` or `O`), possibly a fixed-size array, that is not used
+/// as the counter of another leaf. For these, the content of the basket is just the byte-swapped values.
+
+Bool_t TBranch::SupportsBulkWrite() const
+{
+   if (IsA() != TBranch::Class() || fNleaves != 1 || fEntryOffsetLen != 0 || fEntryBuffer)
+      return kFALSE;
+   auto *leaf = static_cast<TLeaf *>(fLeaves.UncheckedAt(0));
+   if (leaf->GetLeafCount() || leaf->IsRange())
+      return kFALSE;
+   const TClass *leafClass = leaf->IsA();
+   return leafClass == TLeafB::Class() || leafClass == TLeafS::Class() || leafClass == TLeafI::Class() ||
+          leafClass == TLeafL::Class() || leafClass == TLeafF::Class() || leafClass == TLeafD::Class() ||
+          leafClass == TLeafO::Class();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Append the entries [first, first + n) of the array at the branch address to the baskets, see TTree::FillBulk().
+///
+/// The values are copied, and byte-swapped if needed, with one call per basket. Full baskets are written out
+/// like in FillImpl(). Returns the number of bytes filled or -1 in case of error.
+
+Int_t TBranch::FillBulkImpl(Long64_t first, Long64_t n, ROOT::Internal::TBranchIMTHelper *imtHelper)
+{
+   if (TestBit(kDoNotProcess))
+      return 0;
+
+   auto *leaf = static_cast<TLeaf *>(fLeaves.UncheckedAt(0));
+   const Int_t typeSize = leaf->GetLenType();
+   const Int_t nValuesPerEntry = leaf->GetLenStatic();
+   const Int_t entrySize = typeSize * nValuesPerEntry;
+   const char *values = fAddress + first * entrySize;
+   const bool noFlushAtCluster = !fTree->TestBit(TTree::kOnlyFlushAtCluster) || (fTree->GetAutoFlush() < 0);
+
+   Int_t nbytes = 0;
+   while (n > 0) {
+      TBasket *basket = (TBasket *)fBaskets.UncheckedAt(fWriteBasket);
+      if (!basket) {
+         basket = fTree->CreateBasket(this);
+         if (!basket)
+            return -1;
+         ++fNBaskets;
+         fBaskets.AddAtAndExpand(basket, fWriteBasket);
+      }
+      TBuffer *buf = basket->GetBufferRef();
+      if (buf->IsReading())
+         basket->SetWriteMode();
+
+      // as many entries as fit in the basket, but at least one, like FillImpl()
+      const Int_t lold = buf->Length();
+      const Long64_t nFit = std::max<Long64_t>(1, (fBasketSize - lold) / entrySize);
+      const Int_t nChunk = std::min(n, nFit);
+      for (Int_t i = 0; i < nChunk; ++i)
+         basket->Update(lold + i * entrySize);
+      const Int_t nValues = nChunk * nValuesPerEntry;
+      switch (typeSize) {
+      case 1: buf->WriteFastArray(reinterpret_cast<const Char_t *>(values), nValues); break;
+      case 2: buf->WriteFastArray(reinterpret_cast<const Short_t *>(values), nValues); break;
+      case 4: buf->WriteFastArray(reinterpret_cast<const Int_t *>(values), nValues); break;
+      case 8: buf->WriteFastArray(reinterpret_cast<const Long64_t *>(values), nValues); break;
+      default: Error("FillBulk", "Unsupported type size %d for branch %s", typeSize, GetName()); return -1;
+      }
+      if (!basket->GetNevBufSize())
+         basket->SetNevBufSize(entrySize);
+      fEntries += nChunk;
+      fEntryNumber += nChunk;
+      values += nChunk * entrySize;
+      n -= nChunk;
+      nbytes += nChunk * entrySize;
+
+      const Int_t lnew = buf->Length();
+      if (noFlushAtCluster && !fTree->TestBit(TTree::kCircular) && (lnew + entrySize) >= fBasketSize) {
+         Int_t nout = WriteBasketImpl(basket, fWriteBasket, imtHelper);
+         if (nout < 0) {
+            Error("TBranch::FillBulk", "Failed to write out basket.\n");
+            return -1;
+         }
+      }
+   }
+   return nbytes;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Copy the data from fEntryBuffer into the current basket.
 
@@ -1684,6 +1772,159 @@ Int_t TBranch::GetEntriesSerialized(Long64_t entry, TBuffer &user_buf, TBuffer *
    return N;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Determine how the values of this branch are laid out in its baskets, for
+/// GetBulkEntries(Long64_t, TBuffer&, std::vector<Int_t>&).
+///
+/// `elementSize` is set to the size of a single value and `headerSize` to the
+/// number of bytes that precede the values of every entry: 0 for leaves of
+/// fundamental types, including variable-size arrays with a counter leaf, and
+/// 10 (byte count, version and size) for `std::vector`s of fundamental types
+/// stored in a TBranchElement.
+///
+/// Returns false if the branch cannot be read in bulk with offsets.
+
+Bool_t TBranch::GetBulkEntryLayout(Int_t &elementSize, Int_t &headerSize) const
+{
+   if (fNleaves != 1)
+      return kFALSE;
+   TLeaf *leaf = static_cast<TLeaf*>(fLeaves.UncheckedAt(0));
+   const auto deserializeType = leaf->GetDeserializeType();
+   if (deserializeType == TLeaf::DeserializeType::kInPlace || deserializeType == TLeaf::DeserializeType::kZeroCopy) {
+      elementSize = leaf->GetLenType();
+      headerSize = 0;
+      return elementSize > 0;
+   }
+
+   TClass *cl = nullptr;
+   EDataType type = kOther_t;
+   if (const_cast<TBranch *>(this)->GetExpectedType(cl, type) || !cl)
+      return kFALSE;
+   TVirtualCollectionProxy *proxy = cl->GetCollectionProxy();
+   if (!proxy || proxy->GetCollectionType() != ROOT::kSTLvector || proxy->HasPointers() || proxy->GetValueClass())
+      return kFALSE;
+   // std::vector<bool> is not stored as an array of bools
+   TDataType *valueType = TDataType::GetDataType(proxy->GetType());
+   if (!valueType || proxy->GetType() == kBool_t)
+      return kFALSE;
+   elementSize = valueType->Size();
+   headerSize = sizeof(UInt_t) + sizeof(Version_t) + sizeof(Int_t);
+   return kTRUE;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Returns true if this branch can be read with
+/// GetBulkEntries(Long64_t, TBuffer&, std::vector<Int_t>&), false otherwise.
+///
+/// On top of the branches supported by SupportsBulkRead(), this includes
+/// variable-size arrays of fundamental types (with a counter leaf or in a split
+/// collection) and `std::vector`s of fundamental types, also as data members of
+/// split objects.
+
+Bool_t TBranch::SupportsBulkReadWithOffsets() const
+{
+   Int_t elementSize = 0;
+   Int_t headerSize = 0;
+   return GetBulkEntryLayout(elementSize, headerSize);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Read a basket of events into the given buffer with byte swapping,
+///        together with the offsets of the values of each event.
+///
+/// \return On success, the number of events that have been read into the
+///         buffer. -1 on failure.
+///
+/// On success, the values of all the events are stored back to back in the
+/// buffer, starting at `buf.GetCurrent()`, and `offsets` holds one element
+/// more than the number of events: the values of event `i` are
+///
+/// ~~~{.cpp}
+/// auto values = reinterpret_cast<T*>(buf.GetCurrent());
+/// for (Int_t j = offsets[i]; j < offsets[i + 1]; ++j)
+///    use(values[j]);
+/// ~~~
+///
+/// where T is the fundamental type of the values stored on this branch.
+/// Unlike GetBulkEntries(Long64_t, TBuffer&), this also supports branches whose
+/// events have a different number of values, see SupportsBulkReadWithOffsets().
+/// The offsets are computed from the entry offsets of the basket, so the
+/// counter branch of variable-size arrays does not need to be read.
+///
+/// \note This interface is not meant to be exposed to end users, but rather it should
+///       be wrapped by higher-level interfaces.
+
+Int_t TBranch::GetBulkEntries(Long64_t entry, TBuffer &user_buf, std::vector<Int_t> &offsets)
+{
+   const UInt_t kByteCountMask = 0x40000000;  // OR the byte count with this
+
+   Int_t elementSize = 0;
+   Int_t headerSize = 0;
+   if (R__unlikely(!GetBulkEntryLayout(elementSize, headerSize))) return -1;
+
+   // Load the basket in the user buffer, without touching its content.
+   const Int_t N = GetEntriesSerialized(entry, user_buf, nullptr);
+   if (R__unlikely(N < 0)) return -1;
+   TBasket *basket = fCurrentBasket ? fCurrentBasket : fExtraBasket;
+   R__ASSERT(basket);
+
+   offsets.resize(N + 1);
+   offsets[0] = 0;
+   const Int_t *entryOffset = basket->GetEntryOffset();
+   if (!entryOffset) {
+      // All entries have the same size.
+      const Int_t entrySize = basket->GetNevBufSize();
+      if (R__unlikely(headerSize != 0 || entrySize % elementSize != 0)) {
+         Error("GetBulkEntries", "Unexpected size of the entries of the basket: %d bytes.\n", entrySize);
+         return -1;
+      }
+      for (Int_t idx = 0; idx < N; ++idx)
+         offsets[idx + 1] = offsets[idx] + entrySize / elementSize;
+   } else {
+      // Pack the values of all the entries at the beginning of the buffer, dropping the headers.
+      // Baskets that are still being filled have not recorded where their data ends yet.
+      const Int_t last = fBasketSeek[fReadBasket] ? basket->GetLast() : basket->GetBufferRef()->Length();
+      char *dest = user_buf.GetCurrent();
+      for (Int_t idx = 0; idx < N; ++idx) {
+         const Int_t entryBegin = entryOffset[idx];
+         const Int_t entryEnd = (idx + 1 < N) ? entryOffset[idx + 1] : last;
+         const Int_t nBytes = entryEnd - entryBegin - headerSize;
+         if (R__unlikely(nBytes < 0 || nBytes % elementSize != 0)) {
+            Error("GetBulkEntries", "Unexpected size of entry %lld: %d bytes.\n", entry + idx, entryEnd - entryBegin);
+            return -1;
+         }
+         char *src = user_buf.Buffer() + entryBegin;
+         if (headerSize) {
+            UInt_t byteCount;
+            Version_t version;
+            Int_t size;
+            frombuf(src, &byteCount);
+            frombuf(src, &version);
+            frombuf(src, &size);
+            if (R__unlikely(!(byteCount & kByteCountMask) ||
+                            (byteCount & ~kByteCountMask) != UInt_t(entryEnd - entryBegin) - sizeof(UInt_t) ||
+                            size * elementSize != nBytes)) {
+               Error("GetBulkEntries", "Unexpected layout of entry %lld.\n", entry + idx);
+               return -1;
+            }
+         }
+         memmove(dest, src, nBytes);
+         dest += nBytes;
+         offsets[idx + 1] = offsets[idx] + nBytes / elementSize;
+      }
+   }
+
+   static const EDataType kSwapTypes[] = {kOther_t, kOther_t, kShort_t, kOther_t, kInt_t,
+                                          kOther_t, kOther_t, kOther_t, kLong64_t};
+   if (elementSize > 1 &&
+       R__unlikely(elementSize > 8 || !user_buf.ByteSwapBuffer(offsets[N], kSwapTypes[elementSize]))) {
+      Error("GetBulkEntries", "Cannot byte-swap values of %d bytes.\n", elementSize);
+      return -1;
+   }
+
+   return N;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Read all leaves of entry and return total number of bytes read.
 ///
@@ -3201,15 +3442,15 @@ void TBranch::Streamer(TBuffer& b)
 
 Int_t TBranch::WriteBasketImpl(TBasket* basket, Int_t where, ROOT::Internal::TBranchIMTHelper *imtHelper)
 {
-   Int_t nevbuf = basket->GetNevBuf();
-   if (fEntryOffsetLen > 10 &&  (4*nevbuf) < fEntryOffsetLen ) {
-      // Make sure that the fEntryOffset array does not stay large unnecessarily.
-      fEntryOffsetLen = nevbuf < 3 ? 10 : 4*nevbuf; // assume some fluctuations.
-   } else if (fEntryOffsetLen && nevbuf > fEntryOffsetLen) {
-      // Increase the array ...
-      fEntryOffsetLen = 2*nevbuf; // assume some fluctuations.
+   if (imtHelper && imtHelper->GetCompressor() && where == fWriteBasket && basket->IsA() == TBasket::Class() &&
+       !basket->GetBufferRef()->TestBit(TBufferFile::kNotDecompressed)) {
+      TFile *file = GetFile(1);
+      if (file && file->IsWritable())
+         return WriteBasketAsync(basket, file, *imtHelper->GetCompressor());
    }
 
+   UpdateEntryOffsetLen(basket->GetNevBuf());
+
    // Note: captures `basket`, `where`, and `this` by value; modifies the TBranch and basket,
    // as we make a copy of the pointer.  We cannot capture `basket` by reference as the pointer
    // itself might be modified after `WriteBasketImpl` exits.
@@ -3273,6 +3514,95 @@ Int_t TBranch::WriteBasketImpl(TBasket* basket, Int_t where, ROOT::Internal::TBr
    }
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Adapt the size of the entry offset arrays of the next baskets to the number
+/// of entries `nevbuf` of the basket being written.
+
+void TBranch::UpdateEntryOffsetLen(Int_t nevbuf)
+{
+   if (fEntryOffsetLen > 10 &&  (4*nevbuf) < fEntryOffsetLen ) {
+      // Make sure that the fEntryOffset array does not stay large unnecessarily.
+      fEntryOffsetLen = nevbuf < 3 ? 10 : 4*nevbuf; // assume some fluctuations.
+   } else if (fEntryOffsetLen && nevbuf > fEntryOffsetLen) {
+      // Increase the array ...
+      fEntryOffsetLen = 2*nevbuf; // assume some fluctuations.
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Hand the full write basket over to `compressor`, which compresses it in the
+/// task arena, and go on filling a fresh basket.
+///
+/// The basket leaves fBaskets until it is written by FinishAsyncBasket(), which
+/// TTree calls from the filling thread. Returns 0: the bytes written are
+/// accounted for when the basket is finished.
+
+Int_t TBranch::WriteBasketAsync(TBasket* basket, TFile *file, ROOT::Internal::TBasketCompressor &compressor)
+{
+   UpdateEntryOffsetLen(basket->GetNevBuf());
+
+   const Int_t where = fWriteBasket;
+   fBaskets[where] = 0;
+   --fNBaskets;
+   if (basket == fCurrentBasket) {
+      fCurrentBasket    = 0;
+      fFirstBasketEntry = -1;
+      fNextBasketEntry  = -1;
+   }
+   ++fWriteBasket;
+   if (fWriteBasket >= fMaxBaskets) {
+      ExpandBasketArrays();
+   }
+   // Reuse the basket left by the last finished write, if any
+   if (fExtraBasket)
+      ++fNBaskets;
+   fBaskets.AddAtAndExpand(fExtraBasket, fWriteBasket);
+   fExtraBasket = nullptr;
+   fBasketEntry[fWriteBasket] = fEntryNumber;
+
+   // The compression buffer of the branch is shared by its baskets, but several of them can be in flight.
+   if (!basket->fOwnsCompressedBuffer)
+      basket->fCompressedBufferRef = nullptr;
+   basket->fMotherDir = file;
+   compressor.Run(this, basket, where, file, [=]() { return basket->CompressBuffer(file, where); });
+   return 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Write to the file a basket compressed in the background, see
+/// WriteBasketAsync(), `nout` being the result of its compression.
+/// Returns the number of bytes written, or -1 in case of error.
+
+Int_t TBranch::FinishAsyncBasket(TBasket* basket, Int_t where, TFile *file, Int_t nout)
+{
+   if (nout >= 0)
+      nout = basket->WriteCompressedBuffer(file, nout);
+   if (nout < 0)
+      Error("WriteBasketImpl", "basket's WriteBuffer failed.");
+   fBasketBytes[where]  = basket->GetNbytes();
+   fBasketSeek[where]   = basket->GetSeekKey();
+   if (nout > 0) {
+      Int_t addbytes = basket->GetObjlen() + basket->GetKeylen();
+      basket->WriteReset();
+      fZipBytes += nout;
+      fTotBytes += addbytes;
+      fTree->AddTotBytes(addbytes);
+      fTree->AddZipBytes(nout);
+#ifdef R__TRACK_BASKET_ALLOC_TIME
+      fTree->AddAllocationTime(basket->GetResetAllocationTime());
+#endif
+      fTree->AddAllocationCount(basket->GetResetAllocationCount());
+      if (!fExtraBasket) {
+         // Kept for the next basket handed over
+         fExtraBasket = basket;
+         return nout;
+      }
+   }
+   basket->DropBuffers();
+   delete basket;
+   return nout;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 ///set the first entry number (case of TBranchSTL)
 
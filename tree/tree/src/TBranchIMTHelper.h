@@ -14,17 +14,85 @@
 
 #include "RtypesCore.h"
 
+#include <atomic>
+#include <deque>
+#include <memory>
+
 #ifdef R__USE_IMT
 #include "ROOT/TTaskGroup.hxx"
 #endif
 
-/** \class ROOT::Internal::TBranchIMTHelper
- A helper class for managing IMT work during TTree:Fill operations.
-*/
+class TBasket;
+class TBranch;
+class TFile;
 
 namespace ROOT {
 namespace Internal {
 
+/** \class ROOT::Internal::TBasketCompressor
+ Compresses the full baskets of a TTree in the task arena while TTree::Fill
+ goes on, see TTree::SetMaxBasketsInFlight(). The compressed baskets are
+ written to the file by the filling thread, in the order in which they were
+ handed over, so tasks never access the file.
+*/
+
+class TBasketCompressor {
+
+#ifdef R__USE_IMT
+using TaskGroup_t = ROOT::Experimental::TTaskGroup;
+#endif
+
+public:
+   struct TPendingBasket {
+      TBranch *fBranch;
+      TBasket *fBasket;
+      Int_t    fWhere;             ///< Index of the basket in the branch
+      TFile   *fFile;              ///< File the basket is written to
+      Int_t    fNout{0};           ///< Result of the compression, see TBasket::CompressBuffer()
+      std::atomic<bool> fDone{false};
+
+      TPendingBasket(TBranch *branch, TBasket *basket, Int_t where, TFile *file)
+         : fBranch(branch), fBasket(basket), fWhere(where), fFile(file) {}
+   };
+
+   /// Compress the basket in a task; `compress` returns the result of the compression.
+   template<typename FN> void Run(TBranch *branch, TBasket *basket, Int_t where, TFile *file, const FN &compress) {
+      fPending.emplace_back(new TPendingBasket(branch, basket, where, file));
+      auto pending = fPending.back().get();
+#ifdef R__USE_IMT
+      fGroup.Run([=]() {
+         pending->fNout = compress();
+         pending->fDone = true;
+      });
+#else
+      pending->fNout = compress();
+      pending->fDone = true;
+#endif
+   }
+
+   /// Wait for all the compressions in flight.
+   void Wait() {
+#ifdef R__USE_IMT
+      fGroup.Wait();
+#endif
+   }
+
+   Int_t GetNPending() const { return fPending.size(); }
+   /// The oldest basket in flight, nullptr if none.
+   TPendingBasket *Front() { return fPending.empty() ? nullptr : fPending.front().get(); }
+   void PopFront() { fPending.pop_front(); }
+
+private:
+   std::deque<std::unique_ptr<TPendingBasket>> fPending; ///< Baskets in flight, oldest first.
+#ifdef R__USE_IMT
+   TaskGroup_t fGroup;
+#endif
+};
+
+/** \class ROOT::Internal::TBranchIMTHelper
+ A helper class for managing IMT work during TTree:Fill operations.
+*/
+
 class TBranchIMTHelper {
 
 #ifdef R__USE_IMT
@@ -32,6 +100,12 @@ using TaskGroup_t = ROOT::Experimental::TTaskGroup;
 #endif
 
 public:
+   TBranchIMTHelper() = default;
+   /// Hand the full baskets over to `compressor` instead of writing them before TTree::Fill returns.
+   explicit TBranchIMTHelper(TBasketCompressor *compressor) : fCompressor(compressor) {}
+
+   TBasketCompressor *GetCompressor() const { return fCompressor; }
+
    template<typename FN> void Run(const FN &lambda) {
 #ifdef R__USE_IMT
       if (!fGroup) { fGroup.reset(new TaskGroup_t()); }
@@ -60,6 +134,7 @@ public:
 private:
    std::atomic<Long64_t> fBytes{0};   ///< Total number of bytes written by this helper.
    std::atomic<Int_t>    fNerrors{0}; ///< Total error count of all tasks done by this helper.
+   TBasketCompressor    *fCompressor{nullptr}; ///< Compressor of the full baskets, if any.
 #ifdef R__USE_IMT
    std::unique_ptr<TaskGroup_t> fGroup;
 #endif
@@ -29,7 +29,9 @@ the trees in the chain.
 
 #include <iostream>
 #include <cfloat>
+#include <memory>
 #include <string>
+#include <vector>
 
 #include "TBranch.h"
 #include "TBrowser.h"
@@ -956,12 +958,63 @@ Long64_t TChain::GetEntries() const
                                " run TChain::SetProof(kTRUE, kTRUE) first");
       return fProofChain->GetEntries();
    }
+   if (fEntries == TTree::kMaxEntries) {
+      const_cast<TChain*>(this)->LoadEntriesConcurrently();
+   }
    if (fEntries == TTree::kMaxEntries) {
       const_cast<TChain*>(this)->LoadTree(TTree::kMaxEntries-1);
    }
    return fEntries;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Retrieve the number of entries of the trees whose number of entries is not known yet, opening their files
+/// concurrently, and update the tree offsets accordingly.
+///
+/// This only happens if implicit multi-threading is enabled (which makes ROOT thread-safe). At most
+/// `TTree.MetadataConcurrency` files (see the rootrc) are opened at the same time. Files that cannot be opened or
+/// do not contain the tree are left to LoadTree(), which reports the error.
+
+void TChain::LoadEntriesConcurrently()
+{
+   if (!ROOT::IsImplicitMTEnabled() || fProofChain)
+      return;
+
+   std::vector<Int_t> unknownTrees;
+   for (Int_t i = 0; i < fNtrees; ++i) {
+      auto *element = static_cast<TChainElement *>(fFiles->UncheckedAt(i));
+      if (element->GetEntries() == TTree::kMaxEntries)
+         unknownTrees.emplace_back(i);
+   }
+   if (unknownTrees.size() < 2)
+      return;
+
+   std::vector<Long64_t> entries(unknownTrees.size(), TTree::kMaxEntries);
+   ROOT::Internal::TreeUtils::ForEachIndexConcurrently(
+      unknownTrees.size(), ROOT::Internal::TreeUtils::GetMetadataConcurrency(), [&](std::size_t i) {
+         auto *element = static_cast<TChainElement *>(fFiles->UncheckedAt(unknownTrees[i]));
+         TDirectory::TContext ctxt;
+         std::unique_ptr<TFile> file(TFile::Open(element->GetTitle(), "READ_WITHOUT_GLOBALREGISTRATION"));
+         if (!file || file->IsZombie())
+            return;
+         if (auto *tree = dynamic_cast<TTree *>(file->Get(element->GetName())))
+            entries[i] = tree->GetEntries();
+      });
+
+   for (std::size_t i = 0; i < unknownTrees.size(); ++i) {
+      if (entries[i] != TTree::kMaxEntries)
+         static_cast<TChainElement *>(fFiles->UncheckedAt(unknownTrees[i]))->SetNumberEntries(entries[i]);
+   }
+   // the offsets are known up to the first tree whose number of entries is still unknown
+   for (Int_t i = 0; i < fNtrees; ++i) {
+      const auto nEntries = static_cast<TChainElement *>(fFiles->UncheckedAt(i))->GetEntries();
+      if (nEntries == TTree::kMaxEntries)
+         return;
+      fTreeOffset[i + 1] = fTreeOffset[i] + nEntries;
+   }
+   fEntries = fTreeOffset[fNtrees];
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Get entry from the file to memory.
 ///
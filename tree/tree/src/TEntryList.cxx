@@ -54,11 +54,14 @@ End_Macro
           in the first TEntryList
 - __Subtract__() - if the lists are for the same TTree, removes the entries of the second
                list from the first list. If the lists are for TChains, loops over all
-               sub-lists
+               sub-lists. Both Add() and Subtract() work block by block, on the bits
+               of 16 entries at a time
 - __GetEntry(n)__ - returns the n-th entry number
 - __Next__()      - returns next entry number. Note, that this function is
                 much faster than GetEntry, and it's called when GetEntry() is called
                 for 2 or more indices in a row.
+- __GetNInRange(start, end)__ - returns the number of entries in [start, end),
+                e.g. to convert the clusters of a TTree to ranges of indices in the list
 
 ## TTree::Draw() and TChain::Draw()
 
@@ -748,6 +751,34 @@ Bool_t TEntryList::Remove(Long64_t entry, TTree *tree)
    return 0;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Return the number of entries of the list in the range [start, end), i.e. the
+/// difference of the indices in the list of the first entries not smaller than
+/// end and start.
+/// Only the blocks overlapping the range are visited, so that consecutive ranges
+/// (e.g. the clusters of a tree) are converted to ranges of indices in the list
+/// in linear time. Returns -1 for a list with sub-lists.
+
+Long64_t TEntryList::GetNInRange(Long64_t start, Long64_t end) const
+{
+   if (fLists) return -1;
+   if (start < 0) start = 0;
+   if (!fBlocks || start >= end) return 0;
+   Long64_t n = 0;
+   const Long64_t lastblock = TMath::Min((end - 1) / kBlockSize, (Long64_t)fNBlocks - 1);
+   for (Long64_t i = start / kBlockSize; i <= lastblock; i++) {
+      TEntryListBlock *block = (TEntryListBlock*)fBlocks->UncheckedAt(i);
+      const Long64_t shift = i * kBlockSize;
+      const Int_t first = TMath::Max(start - shift, (Long64_t)0);
+      const Int_t last = TMath::Min(end - shift, (Long64_t)kBlockSize);
+      if (first == 0 && last == kBlockSize)
+         n += block->GetNPassed();
+      else
+         n += block->GetNPassedBefore(last) - block->GetNPassedBefore(first);
+   }
+   return n;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Return the number of the entry \#index of this TEntryList in the TTree or TChain
 /// See also Next().
@@ -1335,13 +1366,20 @@ void TEntryList::Subtract(const TEntryList *elist)
          //second list is also only for 1 tree
          if (!strcmp(elist->fTreeName.Data(),fTreeName.Data()) &&
              !strcmp(elist->fFileName.Data(),fFileName.Data())){
-            //same tree
-            Long64_t n2 = elist->GetN();
-            Long64_t entry;
-            for (Int_t i=0; i<n2; i++){
-               entry = (const_cast<TEntryList*>(elist))->GetEntry(i);
-               Remove(entry);
+            //same tree, subtract block by block
+            if (!elist->fBlocks) return;
+            Int_t nmin = TMath::Min(fNBlocks, elist->fNBlocks);
+            TEntryListBlock *block1 = 0;
+            TEntryListBlock *block2 = 0;
+            Long64_t nold;
+            for (Int_t i=0; i<nmin; i++){
+               block1 = (TEntryListBlock*)fBlocks->UncheckedAt(i);
+               block2 = (TEntryListBlock*)elist->fBlocks->UncheckedAt(i);
+               nold = block1->GetNPassed();
+               fN = fN - nold + block1->Subtract(block2);
             }
+            fLastIndexQueried = -1;
+            fLastIndexReturned = 0;
          } else {
             //different trees
             return;
@@ -14,16 +14,20 @@
 
 Used by TEntryList to store the entry numbers.
 
-There are 2 ways to represent entry numbers in a TEntryListBlock:
+There are 3 ways to represent entry numbers in a TEntryListBlock:
 
  1. as bits, where passing entry numbers are assigned 1, not passing - 0
  2. as a simple array of entry numbers
   - storing the numbers of entries that pass
   - storing the numbers of entries that don't pass
-
-In both cases, a UShort_t* is used. The second option is better in case
-less than 1/16 or more than 15/16 of entries pass the selection, and the representation can be
-changed by calling OptimizeStorage() function.
+ 3. as ranges of consecutive passing entries, stored as pairs of the first
+    and of the last entry of each range
+
+In all cases, a UShort_t* is used. The second option is better in case
+less than 1/16 or more than 15/16 of entries pass the selection, the third one
+when the passing entries come in long runs, e.g. for skims of sorted data.
+The representation can be changed by calling OptimizeStorage() function, which
+picks the smallest one.
 When the block is being filled, it's always stored as bits, and the OptimizeStorage()
 function is called by TEntryList when it starts filling the next block. If
 Enter() or Remove() is called after OptimizeStorage(), representation is
@@ -35,9 +39,10 @@ End_Macro
 
 ## Operations on blocks (see also function comments)
 
- - __Merge__() - adds all entries from one block to the other. If the first block
-             uses array representation, it's changed to bits representation only
-             if the total number of passing entries is still less than kBlockSize
+ - __Merge__() - adds all entries from one block to the other. If both blocks
+             are lists of passing entries that fit in a list, the lists are merged,
+             otherwise the union is computed on the bits, 16 entries at a time
+ - __Subtract__() - removes the entries of one block from the other, on the bits
  - __GetEntry(n)__ - returns n-th non-zero entry.
  - __Next__()      - return next non-zero entry. In case of representation 1), Next()
                  is faster than GetEntry()
@@ -46,8 +51,19 @@ End_Macro
 #include "TEntryListBlock.h"
 #include "TString.h"
 
+#include <algorithm>
+#include <bitset>
+#include <cstring>
+
 ClassImp(TEntryListBlock);
 
+namespace {
+inline Int_t CountBits(UShort_t bits)
+{
+   return std::bitset<16>(bits).count();
+}
+} // anonymous namespace
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Default c-tor
 
@@ -153,8 +169,7 @@ Bool_t TEntryListBlock::Enter(Int_t entry)
    //change to bits
    UShort_t *bits = new UShort_t[kBlockSize];
    Transform(1, bits);
-   Enter(entry);
-   return 0;
+   return Enter(entry);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -206,6 +221,17 @@ Int_t TEntryListBlock::Contains(Int_t entry)
       Bool_t result = (fIndices[i] & (1<<j))!=0;
       return result;
    }
+   if (fType==2){
+      //ranges, find the first range that does not end before entry
+      const UShort_t *last = fIndices + 1;
+      Int_t lo = 0, hi = fN/2;
+      while (lo < hi) {
+         Int_t mid = (lo + hi) / 2;
+         if (last[2*mid] < entry) lo = mid + 1;
+         else hi = mid;
+      }
+      return lo < fN/2 && fIndices[2*lo] <= entry;
+   }
    //list
    if (entry < fCurrent) fCurrent = 0;
    if (fPassing && fIndices){
@@ -242,10 +268,12 @@ Int_t TEntryListBlock::Contains(Int_t entry)
 
 Int_t TEntryListBlock::Merge(TEntryListBlock *block)
 {
-   Int_t i, j;
+   Int_t i;
    if (block->GetNPassed() == 0) return GetNPassed();
    if (GetNPassed() == 0){
       //this block is empty
+      if (fIndices)
+         delete [] fIndices;
       fN = block->fN;
       fIndices = new UShort_t[fN];
       for (i=0; i<fN; i++)
@@ -258,104 +286,71 @@ Int_t TEntryListBlock::Merge(TEntryListBlock *block)
       fLastIndexQueried = -1;
       return fNPassed;
    }
-   if (fType==0){
-      //stored as bits
-      if (block->fType == 0){
-         for (i=0; i<kBlockSize*16; i++){
-            if (block->Contains(i))
-               Enter(i);
-         }
-      } else {
-         if (block->fPassing){
-            //the other block stores entries that pass
-            for (i=0; i<block->fNPassed; i++){
-               Enter(block->fIndices[i]);
-            }
-         } else {
-            //the other block stores entries that don't pass
-            if (block->fNPassed==0){
-               for (i=0; i<kBlockSize*16; i++){
-                  Enter(i);
-               }
-            }
-            for (j=0; j<block->fIndices[0]; j++)
-               Enter(j);
-            for (i=0; i<block->fNPassed-1; i++){
-               for (j=block->fIndices[i]+1; j<block->fIndices[i+1]; j++){
-                  Enter(j);
-               }
-            }
-            for (j=block->fIndices[block->fNPassed-1]+1; j<kBlockSize*16; j++)
-               Enter(j);
+   if (fType==1 && fPassing && block->fType==1 && block->fPassing &&
+       GetNPassed() + block->GetNPassed() <= kBlockSize){
+      //both blocks are short lists of passing entries, make a bigger list
+      Int_t en = block->fNPassed;
+      Int_t newsize = fNPassed + en;
+      UShort_t *newlist = new UShort_t[newsize];
+      UShort_t *elst = block->fIndices;
+      Int_t newpos, elpos;
+      newpos = elpos = 0;
+      for (i=0; i<fNPassed; i++) {
+         while (elpos < en && fIndices[i] > elst[elpos]) {
+            newlist[newpos] = elst[elpos];
+            newpos++;
+            elpos++;
          }
+         if (elpos < en && fIndices[i] == elst[elpos]) elpos++;
+         newlist[newpos] = fIndices[i];
+         newpos++;
+      }
+      while (elpos < en) {
+         newlist[newpos] = elst[elpos];
+         newpos++;
+         elpos++;
       }
+      delete [] fIndices;
+      fIndices = newlist;
+      fNPassed = newpos;
+      fN = fNPassed;
    } else {
-      //stored as a list
-      if (GetNPassed() + block->GetNPassed() > kBlockSize){
-         //change to bits
+      //union of the bits
+      if (fType!=0){
          UShort_t *bits = new UShort_t[kBlockSize];
          Transform(1, bits);
-         Merge(block);
-      } else {
-         //this is only possible if fPassing=1 in both blocks
-         if (block->fType==1){
-            //second block stored as a list
-            //make a bigger list
-            Int_t en = block->fNPassed;
-            Int_t newsize = fNPassed + en;
-            UShort_t *newlist = new UShort_t[newsize];
-            UShort_t *elst = block->fIndices;
-            Int_t newpos, elpos;
-            newpos = elpos = 0;
-            for (i=0; i<fNPassed; i++) {
-               while (elpos < en && fIndices[i] > elst[elpos]) {
-                  newlist[newpos] = elst[elpos];
-                  newpos++;
-                  elpos++;
-               }
-               if (fIndices[i] == elst[elpos]) elpos++;
-               newlist[newpos] = fIndices[i];
-               newpos++;
-            }
-            while (elpos < en) {
-               newlist[newpos] = elst[elpos];
-               newpos++;
-               elpos++;
-            }
-            delete [] fIndices;
-            fIndices = newlist;
-            fNPassed = newpos;
-            fN = fNPassed;
-         } else {
-            //second block is stored as bits
-
-            Int_t en = block->fNPassed;
-            Int_t newsize = fNPassed + en;
-            UShort_t *newlist = new UShort_t[newsize];
-            Int_t newpos, current;
-            newpos = current = 0;
-            for (i=0; i<kBlockSize*16; i++){
-               if (!block->Contains(i)) continue;
-               while(current < fNPassed && fIndices[current]<i){
-                  newlist[newpos] = fIndices[current];
-                  current++;
-                  newpos++;
-               }
-               if (fIndices[current]==i) current++;
-               newlist[newpos] = i;
-               newpos++;
-            }
-            while(current<fNPassed){
-               newlist[newpos] = fIndices[current];
-               newpos++;
-               current++;
-            }
-            delete [] fIndices;
-            fIndices = newlist;
-            fNPassed = newpos;
-            fN = fNPassed;
-         }
       }
+      UShort_t other[kBlockSize];
+      block->GetBits(other);
+      fNPassed = 0;
+      for (i=0; i<kBlockSize; i++){
+         fIndices[i] |= other[i];
+         fNPassed += CountBits(fIndices[i]);
+      }
+   }
+   fLastIndexQueried = -1;
+   fLastIndexReturned = -1;
+   OptimizeStorage();
+   return GetNPassed();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Remove the entries of the other block from this block
+/// Returns the resulting number of entries in the block
+
+Int_t TEntryListBlock::Subtract(TEntryListBlock *block)
+{
+   if (GetNPassed() == 0 || block->GetNPassed() == 0) return GetNPassed();
+   if (fType!=0){
+      UShort_t *bits = new UShort_t[kBlockSize];
+      Transform(1, bits);
+   }
+   UShort_t other[kBlockSize];
+   block->GetBits(other);
+   fNPassed = 0;
+   for (Int_t i=0; i<kBlockSize; i++){
+      fIndices[i] &= ~other[i];
+      fNPassed += CountBits(fIndices[i]);
    }
    fLastIndexQueried = -1;
    fLastIndexReturned = -1;
@@ -375,6 +370,32 @@ Int_t TEntryListBlock::GetNPassed()
       return kBlockSize*16-fNPassed;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Returns the number of passing entries smaller than \#entry
+
+Int_t TEntryListBlock::GetNPassedBefore(Int_t entry)
+{
+   if (entry <= 0 || GetNPassed() == 0) return 0;
+   if (entry >= kBlockSize*16) return GetNPassed();
+   Int_t i, n = 0;
+   if (fType==0){
+      //bits
+      for (i=0; i<(entry>>4); i++)
+         n += CountBits(fIndices[i]);
+      return n + CountBits(fIndices[entry>>4] & ((1<<(entry & 15))-1));
+   }
+   if (fType==2){
+      //ranges
+      for (i=0; i<fN && fIndices[i]<entry; i+=2)
+         n += std::min<Int_t>(fIndices[i+1]+1, entry) - fIndices[i];
+      return n;
+   }
+   //list
+   if (fIndices)
+      n = std::lower_bound(fIndices, fIndices + fNPassed, entry) - fIndices;
+   return fPassing ? n : entry - n;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Return entry \#entry.
 /// See also Next()
@@ -382,23 +403,43 @@ Int_t TEntryListBlock::GetNPassed()
 Int_t TEntryListBlock::GetEntry(Int_t entry)
 {
    if (entry > kBlockSize*16) return -1;
-   if (entry > GetNPassed()) return -1;
+   if (entry >= GetNPassed()) return -1;
    if (entry == fLastIndexQueried+1) return Next();
    else {
       Int_t i=0; Int_t j=0; Int_t entries_found=0;
       if (fType==0){
-         if ((fIndices[i] & (1<<j))!=0)
-            entries_found++;
-         while (entries_found<entry+1){
-            if (j==15){i++; j=0;}
-            else j++;
-            if ((fIndices[i] & (1<<j))!=0)
-               entries_found++;
+         //skip the words before the one holding the entry
+         Int_t remaining = entry;
+         Int_t nbits = CountBits(fIndices[i]);
+         while (remaining >= nbits){
+            remaining -= nbits;
+            i++;
+            nbits = CountBits(fIndices[i]);
+         }
+         for (j=0; j<16; j++){
+            if ((fIndices[i] & (1<<j))!=0){
+               if (remaining==0) break;
+               remaining--;
+            }
          }
          fLastIndexQueried = entry;
          fLastIndexReturned = i*16+j;
          return fLastIndexReturned;
       }
+      if (fType==2){
+         Int_t remaining = entry;
+         for (i=0; i<fN; i+=2){
+            Int_t len = fIndices[i+1] - fIndices[i] + 1;
+            if (remaining < len) {
+               fCurrent = i/2;
+               fLastIndexQueried = entry;
+               fLastIndexReturned = fIndices[i] + remaining;
+               return fLastIndexReturned;
+            }
+            remaining -= len;
+         }
+         return -1;
+      }
       if (fType==1){
          if (fPassing){
             fLastIndexQueried = entry;
@@ -461,7 +502,11 @@ Int_t TEntryListBlock::Next()
       j = fLastIndexReturned & 15;
       Bool_t result=(fIndices[i] & (1<<j))!=0;
       while (!result) {
-         if (j==15) {j=0; i++;}
+         if (j==15) {
+            j=0; i++;
+            //skip the words without passing entries
+            while (fIndices[i]==0) i++;
+         }
          else j++;
          result = (fIndices[i] & (1<<j)) != 0;
       }
@@ -470,6 +515,16 @@ Int_t TEntryListBlock::Next()
       return fLastIndexReturned;
 
    }
+   if (fType==2) {
+      //fCurrent is the range of the last returned entry
+      Int_t next = fLastIndexReturned + 1;
+      if (fCurrent >= fN/2 || fIndices[2*fCurrent] > next) fCurrent = 0;
+      while (fIndices[2*fCurrent+1] < next) fCurrent++;
+      if (next < fIndices[2*fCurrent]) next = fIndices[2*fCurrent];
+      fLastIndexQueried++;
+      fLastIndexReturned = next;
+      return fLastIndexReturned;
+   }
    if (fType==1) {
       fLastIndexQueried++;
       if (fPassing){
@@ -514,6 +569,11 @@ void TEntryListBlock::PrintWithShift(Int_t shift) const
          if (result)
             printf("%d\n", i+shift);
       }
+   } else if (fType==2){
+      for (i=0; i<fN; i+=2){
+         for (Int_t j=fIndices[i]; j<=fIndices[i+1]; j++)
+            printf("%d\n", j+shift);
+      }
    } else {
       if (fPassing){
          for (i=0; i<fNPassed; i++){
@@ -547,6 +607,17 @@ void TEntryListBlock::PrintWithShift(Int_t shift) const
 void TEntryListBlock::OptimizeStorage()
 {
    if (fType!=0) return;
+   //size of the list representation, or of the bits if the list is not smaller
+   Int_t listsize = kBlockSize;
+   if (fNPassed < kBlockSize)
+      listsize = fNPassed;
+   else if (fNPassed > kBlockSize*15)
+      listsize = kBlockSize*16-fNPassed;
+   Int_t nranges = GetNRanges();
+   if (2*nranges < listsize){
+      TransformToRanges(nranges);
+      return;
+   }
    if (fNPassed > kBlockSize*15)
       fPassing = 0;
    if (fNPassed<kBlockSize || !fPassing){
@@ -556,10 +627,79 @@ void TEntryListBlock::OptimizeStorage()
    }
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Returns the number of ranges of consecutive passing entries, for the bits
+/// representation
+
+Int_t TEntryListBlock::GetNRanges() const
+{
+   Int_t nranges = 0;
+   UShort_t carry = 0;
+   for (Int_t i=0; i<kBlockSize; i++){
+      //bits that start a range: set, with the previous bit not set
+      UShort_t starts = fIndices[i] & ~((fIndices[i] << 1) | carry);
+      nranges += CountBits(starts);
+      carry = fIndices[i] >> 15;
+   }
+   return nranges;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Transform the bits into nranges ranges of consecutive entries
+
+void TEntryListBlock::TransformToRanges(Int_t nranges)
+{
+   UShort_t *indexnew = new UShort_t[2*nranges];
+   Int_t irange = 0;
+   Bool_t previous = kFALSE;
+   for (Int_t i=0; i<kBlockSize*16; i++){
+      Bool_t result = (fIndices[i>>4] & (1<<(i & 15)))!=0;
+      if (result && !previous)
+         indexnew[2*irange] = i;
+      else if (!result && previous)
+         indexnew[2*(irange++)+1] = i-1;
+      previous = result;
+   }
+   if (previous)
+      indexnew[2*irange+1] = kBlockSize*16-1;
+   delete [] fIndices;
+   fIndices = indexnew;
+   fType = 2;
+   fN = 2*nranges;
+   fPassing = 1;
+   fCurrent = 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Fill bits, an array of kBlockSize UShort_ts, with the bits representation
+/// of this block
+
+void TEntryListBlock::GetBits(UShort_t *bits) const
+{
+   Int_t i;
+   if (fType==0 && fIndices){
+      memcpy(bits, fIndices, kBlockSize*sizeof(UShort_t));
+      return;
+   }
+   const UShort_t fill = (fType==1 && !fPassing) ? 0xFFFF : 0;
+   for (i=0; i<kBlockSize; i++)
+      bits[i] = fill;
+   if (!fIndices) return;
+   if (fType==2){
+      for (i=0; i<fN; i+=2){
+         for (Int_t j=fIndices[i]; j<=fIndices[i+1]; j++)
+            bits[j>>4] |= 1<<(j & 15);
+      }
+   } else if (fType==1){
+      for (i=0; i<fNPassed; i++)
+         bits[fIndices[i]>>4] ^= 1<<(fIndices[i] & 15);
+   }
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Transform the existing fIndices
 /// - dir=0 - transform from bits to a list
-/// - dir=1 - tranform from a list to bits
+/// - dir=1 - tranform from a list or from ranges to bits
 
 void TEntryListBlock::Transform(Bool_t dir, UShort_t *indexnew)
 {
@@ -592,24 +732,8 @@ void TEntryListBlock::Transform(Bool_t dir, UShort_t *indexnew)
       return;
    }
 
-   if (fPassing){
-      for (i=0; i<kBlockSize; i++)
-         indexnew[i] = 0;
-      for (i=0; i<fNPassed; i++){
-         ibite = fIndices[i]>>4;
-         ibit = fIndices[i] & 15;
-         indexnew[ibite] |= 1<<ibit;
-      }
-   } else {
-      for (i=0; i<kBlockSize; i++)
-         indexnew[i] = 65535;
-      for (i=0; i<fNPassed; i++){
-         ibite = fIndices[i]>>4;
-         ibit = fIndices[i] & 15;
-         indexnew[ibite] ^= 1<<ibit;
-      }
-      fNPassed = kBlockSize*16-fNPassed;
-   }
+   GetBits(indexnew);
+   fNPassed = GetNPassed();
    if (fIndices)
       delete [] fIndices;
    fIndices = indexnew;
@@ -431,6 +431,7 @@ End_Macro
 
 #include "TBranchIMTHelper.h"
 #include "TNotifyLink.h"
+#include "ZipZSTD.h"
 
 #include <chrono>
 #include <cstddef>
@@ -440,10 +441,12 @@ End_Macro
 #include <string>
 #include <cstdio>
 #include <climits>
+#include <cmath>
 #include <algorithm>
 #include <set>
 
 #ifdef R__USE_IMT
+#include "ROOT/RTaskTracer.hxx"
 #include "ROOT/TThreadExecutor.hxx"
 #include <thread>
 #endif
@@ -453,6 +456,7 @@ constexpr Float_t kNEntriesResortInv = 1.f/kNEntriesResort;
 
 Int_t    TTree::fgBranchStyle = 1;  // Use new TBranch style with TBranchElement.
 Long64_t TTree::fgMaxTreeSize = 100000000000LL;
+std::atomic<TVirtualPerfStats *> TTree::fgDefaultPerfStats{nullptr};
 
 ClassImp(TTree);
 
@@ -920,6 +924,11 @@ TTree::TTree(const char* name, const char* title, Int_t splitlevel /* = 99 */,
 
 TTree::~TTree()
 {
+   if (fBasketCompressor) {
+      FinishAsyncBaskets(0, kFALSE);
+      delete fBasketCompressor;
+      fBasketCompressor = nullptr;
+   }
    if (auto link = dynamic_cast<TNotifyLinkBase*>(fNotify)) {
       link->Clear();
    }
@@ -3527,6 +3536,12 @@ namespace {
 /// - AsIsIndexOnError [default]: In case of missing TTreeIndex, the resulting TTree index has gaps.
 /// - BuildIndexOnError : If any of the underlying TTree objects do not have a TTreeIndex,
 ///                          all TTreeIndex are 'ignored' and the missing piece are rebuilt.
+///
+/// When the entries are copied one by one (without 'fast', or when the compression
+/// of the baskets must change) and implicit multi-threading is enabled, the baskets
+/// of the source are unzipped in parallel by GetEntry and, unless SetMaxBasketsInFlight()
+/// was called, the full baskets of this tree are compressed in the background while
+/// the next entries are copied. They are written in order by the calling thread.
 
 Long64_t TTree::CopyEntries(TTree* tree, Long64_t nentries /* = -1 */, Option_t* option /* = "" */, Bool_t needCopyAddresses /* = false */)
 {
@@ -3575,6 +3590,11 @@ Long64_t TTree::CopyEntries(TTree* tree, Long64_t nentries /* = -1 */, Option_t*
       nentries = treeEntries;
    }
 
+   // Entries that are not fast cloned are recompressed: let tasks do that.
+   const Int_t storeMaxBasketsInFlight = fMaxBasketsInFlight;
+   if (fMaxBasketsInFlight == 0 && fIMTEnabled && ROOT::IsImplicitMTEnabled())
+      SetMaxBasketsInFlight(2 * ROOT::GetThreadPoolSize());
+
    if (fastClone && (nentries < 0 || nentries == tree->GetEntriesFast())) {
       // Quickly copy the basket without decompression and streaming.
       Long64_t totbytes = GetTotBytes();
@@ -3603,6 +3623,7 @@ Long64_t TTree::CopyEntries(TTree* tree, Long64_t nentries /* = -1 */, Option_t*
                Warning("CopyEntries","%s",cloner.GetWarning());
                // If the first cloning does not work, something is really wrong
                // (since apriori the source and target are exactly the same structure!)
+               SetMaxBasketsInFlight(storeMaxBasketsInFlight);
                return -1;
             } else {
                if (cloner.NeedConversion()) {
@@ -3675,6 +3696,8 @@ Long64_t TTree::CopyEntries(TTree* tree, Long64_t nentries /* = -1 */, Option_t*
          this->GetTreeIndex()->Append(0,kFALSE); // Force the sorting
       }
    }
+   // Write the baskets still in flight, if any.
+   SetMaxBasketsInFlight(storeMaxBasketsInFlight);
    return nbytes;
 }
 
@@ -4614,7 +4637,9 @@ Int_t TTree::Fill()
 
 #ifdef R__USE_IMT
    const auto useIMT = ROOT::IsImplicitMTEnabled() && fIMTEnabled;
-   ROOT::Internal::TBranchIMTHelper imtHelper;
+   if (useIMT && fMaxBasketsInFlight > 0 && !fBasketCompressor)
+      fBasketCompressor = new ROOT::Internal::TBasketCompressor();
+   ROOT::Internal::TBranchIMTHelper imtHelper(useIMT && fMaxBasketsInFlight > 0 ? fBasketCompressor : nullptr);
    if (useIMT) {
       fIMTFlush = true;
       fIMTZipBytes.store(0);
@@ -4664,6 +4689,9 @@ Int_t TTree::Fill()
       nbytes += imtHelper.GetNbytes();
       nerror += imtHelper.GetNerrors();
    }
+   // Write the baskets compressed in the meantime, waiting if too many are in flight.
+   if (fBasketCompressor && FinishAsyncBaskets(fMaxBasketsInFlight) > 0)
+      ++nerror;
 #endif
 
    if (fBranchRef)
@@ -4678,8 +4706,21 @@ Int_t TTree::Fill()
       Info("TTree::Fill", " - A: %d %lld %lld %lld %lld %lld %lld \n", nbytes, fEntries, fAutoFlush, fAutoSave,
            GetZipBytes(), fFlushedBytes, fSavedBytes);
 
+   FlushAndSaveIfNeeded();
+
+   return nerror == 0 ? nbytes : -1;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Flush the baskets and autosave the tree if the entries filled so far call for it, according to the AutoFlush
+/// and AutoSave settings, and continue on a new file if the current one exceeds the maximum tree size.
+/// Called after every Fill() and after every chunk of entries filled by FillBulk().
+
+void TTree::FlushAndSaveIfNeeded()
+{
    bool autoFlush = false;
    bool autoSave = false;
+   bool firstFlush = false;
 
    if (fAutoFlush != 0 || fAutoSave != 0) {
       // Is it time to flush or autosave baskets?
@@ -4701,11 +4742,13 @@ Int_t TTree::Fill()
             // First call FlushBasket to make sure that fTotBytes is up to date.
             FlushBasketsImpl();
             autoFlush = false; // avoid auto flushing again later
+            firstFlush = true;
 
             // When we are in one-basket-per-cluster mode, there is no need to optimize basket:
             // they will automatically grow to the size needed for an event cluster (with the basket
             // shrinking preventing them from growing too much larger than the actually-used space).
-            if (!TestBit(TTree::kOnlyFlushAtCluster)) {
+            // When the basket sizes are tuned, TuneClusterSizes() takes care of them.
+            if (!TestBit(TTree::kOnlyFlushAtCluster) && !(fTuningClusterBytes > 0 && fTuningBasketBytes > 0)) {
                OptimizeBaskets(GetTotBytes(), 1, "");
                if (gDebug > 0)
                   Info("TTree::Fill", "OptimizeBaskets called at entry %lld, fZipBytes=%lld, fFlushedBytes=%lld\n",
@@ -4762,6 +4805,9 @@ Int_t TTree::Fill()
       fFlushedBytes = GetZipBytes();
    }
 
+   if ((firstFlush || autoFlush) && fTuningClusterBytes > 0)
+      TuneClusterSizes();
+
    if (autoSave) {
       AutoSave(); // does not call FlushBasketsImpl() again
       if (gDebug > 0)
@@ -4779,6 +4825,214 @@ Int_t TTree::Fill()
             // Changing file clashes with the design of TMemFile and derivates, see #6523.
             if (!(dynamic_cast<TMemFile *>(file)))
                ChangeFile(file);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Adapt the number of entries of the next clusters and the basket sizes of the
+/// branches to the cluster that was just flushed, see SetClusterTuning().
+
+void TTree::TuneClusterSizes()
+{
+   auto &stats = fTuningStats;
+   const Long64_t nEntries = fEntries - fTuningClusterStart;
+   const Long64_t clusterBytes = GetZipBytes() - fTuningZipBytes;
+   const bool measured = fTuningClusterStart >= 0 && nEntries > 0;
+   fTuningClusterStart = fEntries;
+   fTuningZipBytes = GetZipBytes();
+
+   if (measured) {
+      ++stats.fNClusters;
+      const Double_t deviation = std::abs(Double_t(clusterBytes) / fTuningClusterBytes - 1);
+      if (deviation <= 0.25)
+         ++stats.fNClustersOnTarget;
+      if (stats.fNClusters == 1 || clusterBytes < stats.fMinClusterBytes)
+         stats.fMinClusterBytes = clusterBytes;
+      if (clusterBytes > stats.fMaxClusterBytes)
+         stats.fMaxClusterBytes = clusterBytes;
+      stats.fMeanClusterBytes += (clusterBytes - stats.fMeanClusterBytes) / stats.fNClusters;
+      stats.fMeanClusterDeviation += (deviation - stats.fMeanClusterDeviation) / stats.fNClusters;
+   }
+
+   // The number of entries of the next clusters follows the compressed size of the entries, averaged such that
+   // the last cluster weighs as much as all the previous ones. The number only changes by more than 10%, and at
+   // most by a factor 2, to avoid recording a new cluster range after every cluster.
+   if (measured && clusterBytes > 0 && fAutoFlush > 0) {
+      const Double_t bytesPerEntry = Double_t(clusterBytes) / nEntries;
+      fTuningBytesPerEntry =
+         fTuningBytesPerEntry > 0 ? 0.5 * (fTuningBytesPerEntry + bytesPerEntry) : bytesPerEntry;
+      Long64_t clusterEntries = std::llround(fTuningClusterBytes / fTuningBytesPerEntry);
+      clusterEntries = std::max(fAutoFlush / 2, std::min(2 * fAutoFlush, clusterEntries));
+      clusterEntries = std::max(clusterEntries, Long64_t(1));
+      if (std::abs(clusterEntries - fAutoFlush) * 10 > fAutoFlush) {
+         if (gDebug > 0)
+            Info("TuneClusterSizes", "Changing the cluster size from %lld to %lld entries at entry %lld", fAutoFlush,
+                 clusterEntries, fEntries);
+         SetAutoFlush(clusterEntries);
+         ++stats.fNClusterSizeChanges;
+      }
+   }
+
+   // The branches with data, as in OptimizeBaskets()
+   TObjArray *leaves = GetListOfLeaves();
+   const Int_t nleaves = leaves->GetEntriesFast();
+   std::size_t nbranches = 0;
+   for (Int_t i = 0; i < nleaves; ++i) {
+      TBranch *branch = static_cast<TLeaf *>(leaves->UncheckedAt(i))->GetBranch();
+      if (branch->GetListOfBranches()->GetEntriesFast() > 0)
+         continue;
+      if (nbranches > 0 && fTuningBranches[nbranches - 1].fBranch == branch)
+         continue; // another leaf of the same branch
+      if (nbranches == fTuningBranches.size())
+         fTuningBranches.emplace_back();
+      auto &state = fTuningBranches[nbranches++];
+      if (state.fBranch != branch)
+         state = TTuningBranchState{branch, 0, 0};
+
+      const Long64_t branchBytes = branch->GetTotBytes() - state.fTotBytes;
+      const Int_t branchBaskets = branch->GetWriteBasket() - state.fBaskets;
+      state.fTotBytes = branch->GetTotBytes();
+      state.fBaskets = branch->GetWriteBasket();
+
+      if (measured && branchBaskets > 0) {
+         const Double_t basketBytes = Double_t(branchBytes) / branchBaskets;
+         stats.fNBaskets += branchBaskets;
+         stats.fMeanBasketBytes += (branchBytes - branchBaskets * stats.fMeanBasketBytes) / stats.fNBaskets;
+         stats.fMaxBasketBytes = std::max(stats.fMaxBasketBytes, basketBytes);
+         if (fTuningBasketBytes > 0 && branchBaskets > 1 && 2 * basketBytes < fTuningBasketBytes)
+            stats.fNSmallBaskets += branchBaskets;
+      }
+
+      if (fTuningBasketBytes <= 0 || fAutoFlush <= 0 || branch->GetEntries() == 0)
+         continue;
+      // The branches whose data of a cluster fit in the target size write one basket per cluster, with some room
+      // for the fluctuations of the entry sizes; the others write baskets of the target size.
+      const Double_t bytesPerEntry = (measured && branchBaskets > 0 && nEntries > 0)
+                                        ? Double_t(branchBytes) / nEntries
+                                        : Double_t(branch->GetTotBytes()) / branch->GetEntries();
+      Double_t branchClusterBytes = 1.1 * bytesPerEntry * fAutoFlush;
+      if (branch->GetEntryOffsetLen())
+         branchClusterBytes += fAutoFlush * sizeof(Int_t) * 2;
+      Long64_t newBsize = std::min(Long64_t(branchClusterBytes), Long64_t(fTuningBasketBytes));
+      newBsize = std::max(newBsize - newBsize % 512 + 512, Long64_t(1 + bytesPerEntry));
+      if (newBsize != branch->GetBasketSize()) {
+         if (gDebug > 0)
+            Info("TuneClusterSizes", "Changing buffer size from %6d to %6lld bytes for %s", branch->GetBasketSize(),
+                 newBsize, branch->GetName());
+         branch->SetBasketSize(Int_t(newBsize));
+      }
+   }
+   fTuningBranches.resize(nbranches);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Fill nEntries entries at once, reading the values of each branch from an array.
+///
+/// The address of every branch (e.g. as set with SetBranchAddress()) must point to an array holding the values of
+/// the nEntries entries, one after the other, instead of the value of a single entry. The values are appended to the
+/// baskets with one copy, byte-swapped if needed, per basket instead of one serialization per entry and branch, which
+/// makes this much faster than nEntries calls to Fill() for trees with many branches.
+///
+/// All branches must support bulk filling, see TBranch::SupportsBulkWrite(): this is the case for branches of
+/// fixed-size arithmetic types created from a leaf list or from the address of a variable. Trees with a TBranchRef
+/// and circular trees are not supported. Baskets are flushed and the tree is autosaved at the same entries as if the
+/// entries were filled one by one with Fill(), except for the first flush of trees with a (default) AutoFlush in
+/// bytes, which is only checked after each basket-worth of entries.
+///
+/// ~~~ {.cpp}
+/// std::vector<float> px(n), py(n);
+/// TTree t("t", "t");
+/// t.Branch("px", px.data(), "px/F");
+/// t.Branch("py", py.data(), "py/F");
+/// // ... fill px and py ...
+/// t.FillBulk(n);
+/// ~~~
+///
+/// Returns the number of bytes committed to the baskets, or -1 in case of error.
+
+Int_t TTree::FillBulk(Long64_t nEntries)
+{
+   if (nEntries <= 0)
+      return 0;
+   if (fBranchRef || TestBit(kCircular)) {
+      Error("FillBulk", "Bulk filling is not supported for trees with a TBranchRef or circular trees.");
+      return -1;
+   }
+   std::vector<TBranch *> branches;
+   // a chunk of entries between two checks of the AutoFlush in bytes: one basket of the branch with the largest
+   // entries, which is thus the branch that fills its baskets and compresses them the most often
+   Long64_t entriesPerBasket = nEntries;
+   for (auto *branch : TRangeDynCast<TBranch>(fBranches)) {
+      if (!branch || branch->TestBit(kDoNotProcess))
+         continue;
+      if (!branch->SupportsBulkWrite() || !branch->GetAddress()) {
+         Error("FillBulk", "Branch %s does not support bulk filling or has no address.", branch->GetName());
+         return -1;
+      }
+      auto *leaf = static_cast<TLeaf *>(branch->GetListOfLeaves()->UncheckedAt(0));
+      const Int_t entrySize = leaf->GetLenType() * leaf->GetLenStatic();
+      entriesPerBasket = std::min<Long64_t>(entriesPerBasket, std::max(1, branch->GetBasketSize() / entrySize));
+      branches.emplace_back(branch);
+   }
+
+#ifdef R__USE_IMT
+   const auto useIMT = ROOT::IsImplicitMTEnabled() && fIMTEnabled;
+   if (useIMT && fMaxBasketsInFlight > 0 && !fBasketCompressor)
+      fBasketCompressor = new ROOT::Internal::TBasketCompressor();
+   ROOT::Internal::TBranchIMTHelper imtHelper(useIMT && fMaxBasketsInFlight > 0 ? fBasketCompressor : nullptr);
+#endif
+
+   Int_t nbytes = 0;
+   Int_t nerror = 0;
+   for (Long64_t first = 0; first < nEntries;) {
+      // fill up to the next entry at which Fill() would flush the baskets or autosave the tree
+      Long64_t n = nEntries - first;
+      if (fAutoFlush > 0) {
+         const Long64_t clusterStart =
+            (fFlushedBytes == 0 || fNClusterRange == 0) ? 0 : fClusterRangeEnd[fNClusterRange - 1] + 1;
+         n = std::min(n, fAutoFlush - (fEntries - clusterStart) % fAutoFlush);
+      } else if (fAutoFlush < 0 && fFlushedBytes == 0) {
+         n = std::min(n, entriesPerBasket);
+      }
+      if (fAutoSave > 0)
+         n = std::min(n, fAutoSave - fEntries % fAutoSave);
+
+#ifdef R__USE_IMT
+      if (useIMT) {
+         fIMTFlush = true;
+         fIMTZipBytes.store(0);
+         fIMTTotBytes.store(0);
+      }
+#endif
+      for (auto *branch : branches) {
+#ifndef R__USE_IMT
+         const Int_t nwrite = branch->FillBulkImpl(first, n, nullptr);
+#else
+         const Int_t nwrite = branch->FillBulkImpl(first, n, useIMT ? &imtHelper : nullptr);
+#endif
+         if (nwrite < 0) {
+            Error("FillBulk", "Failed filling branch:%s.%s, entry=%lld", GetName(), branch->GetName(), fEntries + 1);
+            ++nerror;
+         } else {
+            nbytes += nwrite;
+         }
+      }
+#ifdef R__USE_IMT
+      if (fIMTFlush) {
+         imtHelper.Wait();
+         fIMTFlush = false;
+         AddTotBytes(fIMTTotBytes);
+         AddZipBytes(fIMTZipBytes);
+         nbytes += imtHelper.GetNbytes();
+         nerror += imtHelper.GetNerrors();
+      }
+      if (fBasketCompressor && FinishAsyncBaskets(fMaxBasketsInFlight) > 0)
+         ++nerror;
+#endif
+
+      fEntries += n;
+      first += n;
+      FlushAndSaveIfNeeded();
+   }
 
    return nerror == 0 ? nbytes : -1;
 }
@@ -5148,7 +5402,19 @@ Int_t TTree::FlushBasketsImpl() const
    TObjArray *lb = const_cast<TTree*>(this)->GetListOfBranches();
    Int_t nb = lb->GetEntriesFast();
 
+   if (fCompressionDictionarySize > 0) {
+      // Trained once, from the baskets of the first cluster
+      auto self = const_cast<TTree *>(this);
+      if (!fCompressionDictionary.GetSize())
+         self->TrainCompressionDictionary(fCompressionDictionarySize);
+      self->fCompressionDictionarySize = 0;
+   }
+
 #ifdef R__USE_IMT
+   // The baskets compressed during Fill must be written before the baskets being filled.
+   if (fBasketCompressor && FinishAsyncBaskets(0) > 0)
+      ++nerror;
+
    const auto useIMT = ROOT::IsImplicitMTEnabled() && fIMTEnabled;
    if (useIMT) {
       // ROOT-9668: here we need to check if the size of fSortedBranches is different from the
@@ -5183,7 +5449,9 @@ Int_t TTree::FlushBasketsImpl() const
             Info("FlushBaskets", "[IMT] Running task for branch #%d: %s", j, branch->GetName());
         }
 
+        ROOT::Experimental::RTaskTracer::RScope traceScope("TTree", "FlushBaskets");
         Int_t nbtask = branch->FlushBaskets();
+        traceScope.SetPayload(nbtask > 0 ? nbtask : 0);
 
         if (nbtask < 0) { nerrpar++; }
         else            { nbpar += nbtask; }
@@ -5196,7 +5464,7 @@ Int_t TTree::FlushBasketsImpl() const
       const_cast<TTree*>(this)->AddTotBytes(fIMTTotBytes);
       const_cast<TTree*>(this)->AddZipBytes(fIMTZipBytes);
 
-      return nerrpar ? -1 : nbpar.load();
+      return (nerrpar || nerror) ? -1 : nbpar.load();
    }
 #endif
    for (Int_t j = 0; j < nb; j++) {
@@ -5217,6 +5485,38 @@ Int_t TTree::FlushBasketsImpl() const
    }
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Write the baskets compressed in the background during Fill, see
+/// SetMaxBasketsInFlight(), in the order in which they were filled.
+///
+/// If more than `maxInFlight` baskets are in flight, wait for all of them to
+/// be compressed; otherwise only write those that are already compressed, up
+/// to the first one that is not. If `write` is false, the baskets are deleted
+/// instead of being written, once their compression is done.
+/// Returns the number of baskets that could not be written.
+
+Int_t TTree::FinishAsyncBaskets(Int_t maxInFlight, Bool_t write) const
+{
+   if (!fBasketCompressor)
+      return 0;
+   if (!write || fBasketCompressor->GetNPending() > maxInFlight)
+      fBasketCompressor->Wait();
+
+   Int_t nerror = 0;
+   while (auto pending = fBasketCompressor->Front()) {
+      if (!pending->fDone)
+         break;
+      if (!write) {
+         delete pending->fBasket;
+      } else if (pending->fBranch->FinishAsyncBasket(pending->fBasket, pending->fWhere, pending->fFile,
+                                                     pending->fNout) < 0) {
+         ++nerror;
+      }
+      fBasketCompressor->PopFront();
+   }
+   return nerror;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Returns the expanded value of the alias.  Search in the friends if any.
 
@@ -5638,6 +5938,12 @@ Int_t TTree::GetEntry(Long64_t entry, Int_t getall)
    // through the friends tree, let return
    if (kGetEntry & fFriendLockStatus) return 0;
 
+#ifdef R__USE_IMT
+   // The baskets compressed during Fill are only readable once written.
+   if (fBasketCompressor)
+      FinishAsyncBaskets(0);
+#endif
+
    if (entry < 0 || entry >= fEntries) return 0;
    Int_t i;
    Int_t nbytes = 0;
@@ -6508,6 +6814,8 @@ Long64_t TTree::LoadTree(Long64_t entry)
             }
             TTree* friendTree = fe->GetTree();
             if (friendTree) {
+               if (friendTree->GetTreeIndex())
+                  FillFriendCache(friendTree, entry);
                if (friendTree->LoadTreeFriend(entry, this) >= 0) {
                   friendHasEntry = kTRUE;
                }
@@ -6537,6 +6845,39 @@ Long64_t TTree::LoadTree(Long64_t entry)
    return fReadEntry;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Prefetch the baskets of a friend tree attached with an index.
+///
+/// When entering a new cluster of this tree, the entries of friendTree
+/// matching all the entries of the cluster are looked up in its index and the
+/// TTreeCache of friendTree is filled with the baskets holding them, see
+/// TTreeCache::FillBufferFriend(). Otherwise the friend entries, which are not
+/// sequential, would each be read with its own request. Friends that are
+/// chains or have no cache out of its learning phase are left alone.
+
+void TTree::FillFriendCache(TTree *friendTree, Long64_t entry)
+{
+   if (entry < 0 || entry >= fEntries || friendTree->GetTree() != friendTree)
+      return;
+   TTreeCache *cache = friendTree->GetReadCache(friendTree->GetCurrentFile());
+   if (!cache || cache->IsLearning() || cache->HasFriendEntries(entry))
+      return;
+
+   TClusterIterator clusterIter = GetClusterIterator(entry);
+   const Long64_t start = clusterIter();
+   const Long64_t next = std::min(clusterIter.GetNextEntry(), fEntries);
+   TVirtualIndex *index = friendTree->GetTreeIndex();
+   std::vector<Long64_t> friendEntries;
+   friendEntries.reserve(next - start);
+   // The index evaluates its expressions for the read entry of this tree
+   for (Long64_t e = start; e < next; ++e) {
+      fReadEntry = e;
+      friendEntries.push_back(index->GetEntryNumberFriend(this));
+   }
+   fReadEntry = entry;
+   cache->FillBufferFriend(std::move(friendEntries), start, next);
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Load entry on behalf of our master tree, we may use an index.
 ///
@@ -8010,6 +8351,11 @@ void TTree::Reset(Option_t* option)
    fChainOffset   = 0;
    fReadEntry     = -1;
 
+#ifdef R__USE_IMT
+   if (fBasketCompressor)
+      FinishAsyncBaskets(0, kFALSE);
+#endif
+
    delete fTreeIndex;
    fTreeIndex = 0;
 
@@ -8040,6 +8386,11 @@ void TTree::ResetAfterMerge(TFileMergeInfo *info)
    fChainOffset   = 0;
    fReadEntry     = -1;
 
+#ifdef R__USE_IMT
+   if (fBasketCompressor)
+      FinishAsyncBaskets(0, kFALSE);
+#endif
+
    delete fTreeIndex;
    fTreeIndex     = 0;
 
@@ -8905,6 +9256,78 @@ void TTree::SetCircular(Long64_t maxEntries)
    }
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Compress the baskets written from now on with the ZSTD dictionary `dict` of
+/// `size` bytes, e.g. trained by TrainCompressionDictionary().
+///
+/// The dictionary is only used with the ZSTD compression algorithm. It is
+/// stored with the tree, which registers it when read back. Since the baskets
+/// written with a dictionary cannot be read without it, the dictionary of a
+/// tree cannot be changed: returns false if the tree already has one, or if
+/// `dict` is not a ZSTD dictionary.
+
+Bool_t TTree::SetCompressionDictionary(const char *dict, Int_t size)
+{
+   if (fCompressionDictionary.GetSize()) {
+      Error("SetCompressionDictionary", "The tree %s already has a compression dictionary.", GetName());
+      return kFALSE;
+   }
+   const UInt_t id = R__registerZSTDDictionary(dict, size);
+   if (id == 0) {
+      Error("SetCompressionDictionary", "Invalid ZSTD dictionary for the tree %s.", GetName());
+      return kFALSE;
+   }
+   fCompressionDictionary.Set(size, dict);
+   fCompressionDictionaryId = id;
+   return kTRUE;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Continuously adapt the clusters and the baskets written by Fill() to target
+/// sizes, instead of deriving them once from the first cluster.
+///
+/// The first cluster is flushed when clusterBytes compressed bytes have been
+/// written, as with SetAutoFlush(-clusterBytes). After every cluster, the
+/// number of entries of the next clusters is adapted to the compressed size of
+/// the entries written so far, such that the clusters keep close to
+/// clusterBytes when the size of the entries changes along the tree. This
+/// records a new cluster range whenever the number of entries per cluster
+/// changes by more than 10%.
+///
+/// If basketBytes is positive, the basket sizes of the branches are adapted
+/// after every cluster too, replacing OptimizeBaskets(): the branches whose
+/// data of a cluster fit in basketBytes write one basket per cluster, the
+/// others write baskets of basketBytes. This avoids both the many tiny
+/// baskets of sparse branches and the huge baskets of dense ones.
+///
+/// GetClusterTuningStats() reports how well the clusters and baskets written
+/// since this call met the targets. Passing clusterBytes <= 0 disables the
+/// tuning; the current cluster size is kept.
+
+void TTree::SetClusterTuning(Long64_t clusterBytes, Int_t basketBytes)
+{
+   if (clusterBytes <= 0) {
+      fTuningClusterBytes = 0;
+      fTuningBasketBytes = 0;
+      return;
+   }
+   fTuningClusterBytes = clusterBytes;
+   fTuningBasketBytes = basketBytes > 0 ? basketBytes : 0;
+   fTuningStats = TClusterTuningStats();
+   fTuningStats.fTargetClusterBytes = fTuningClusterBytes;
+   fTuningStats.fTargetBasketBytes = fTuningBasketBytes;
+   fTuningBytesPerEntry = 0;
+   fTuningBranches.clear();
+   fTuningZipBytes = 0;
+   if (fFlushedBytes == 0) {
+      SetAutoFlush(-clusterBytes);
+      fTuningClusterStart = 0;
+   } else {
+      // The start of the current cluster is known at its end, the statistics begin with the next cluster
+      fTuningClusterStart = -1;
+   }
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Set the debug level and the debug range.
 ///
@@ -9172,6 +9595,36 @@ void TTree::SetMakeClass(Int_t make)
    }
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Set the maximum number of full baskets compressed in the background while
+/// TTree::Fill goes on.
+///
+/// By default (n = 0), when a basket is full, TTree::Fill compresses and
+/// writes it before returning, possibly in parallel with the baskets of the
+/// other branches filled by the same entry. With n > 0 and implicit
+/// multi-threading enabled (see ROOT::EnableImplicitMT() and SetImplicitMT()),
+/// the full baskets are compressed by tasks while the following entries are
+/// filled. They are written to the file by TTree::Fill itself, in the order in
+/// which they were filled, as soon as their compression is done: the file is
+/// only accessed from the filling thread. TTree::Fill waits for the
+/// compression of all the baskets in flight when there are more than n of
+/// them; each basket in flight holds an uncompressed and a compressed buffer.
+///
+/// The baskets in flight are written by FlushBaskets(), and so by Write() and
+/// AutoSave(), and when reading an entry with GetEntry().
+/// Passing n <= 0 writes them and goes back to the default behaviour.
+
+void TTree::SetMaxBasketsInFlight(Int_t n)
+{
+   fMaxBasketsInFlight = n > 0 ? n : 0;
+   if (fMaxBasketsInFlight == 0 && fBasketCompressor) {
+      if (FinishAsyncBaskets(0) > 0)
+         Error("SetMaxBasketsInFlight", "Failed writing the baskets compressed in the background.");
+      delete fBasketCompressor;
+      fBasketCompressor = nullptr;
+   }
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Set the maximum size in bytes of a Tree file (static function).
 /// The default size is 100000000000LL, ie 100 Gigabytes.
@@ -9318,6 +9771,17 @@ void TTree::SetPerfStats(TVirtualPerfStats *perf)
    fPerfStats = perf;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Static function to set the perf stats used by the trees that have none of their
+/// own (see SetPerfStats()), e.g. the trees that the tasks of TTreeProcessorMT or
+/// RDataFrame create on their own. The perf stats object must be thread safe, like
+/// TTreePerfStatsMT, and must outlive its use; pass nullptr to stop monitoring.
+
+void TTree::SetDefaultPerfStats(TVirtualPerfStats *perf)
+{
+   fgDefaultPerfStats.store(perf, std::memory_order_release);
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// The current TreeIndex is replaced by the new index.
 /// Note that this function does not delete the previous index.
@@ -9489,6 +9953,60 @@ Int_t TTree::StopCacheLearningPhase()
    return 0;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Train a ZSTD dictionary of at most `maxSize` bytes from the content of the
+/// baskets not yet written to the file, and compress all the baskets written
+/// from now on with it, see SetCompressionDictionary().
+///
+/// Dictionaries mostly help with small baskets, e.g. those of branches with few
+/// bytes per entry: they are typically trained after filling the first
+/// entries, before the first flush. Calling SetCompressionDictionarySize()
+/// trains one automatically at the first FlushBaskets().
+///
+/// Returns the size of the dictionary, or 0 if there is not enough data to
+/// train one or if the tree already has a dictionary.
+
+Int_t TTree::TrainCompressionDictionary(Int_t maxSize)
+{
+   if (fCompressionDictionary.GetSize()) {
+      Warning("TrainCompressionDictionary", "The tree %s already has a compression dictionary.", GetName());
+      return 0;
+   }
+   if (maxSize <= 0)
+      return 0;
+
+   // Each basket is split into samples, as ZSTD needs many of them.
+   const Int_t kMaxSampleSize = 4096;
+   std::string samples;
+   std::vector<Int_t> sampleSizes;
+   std::set<TBranch *> visited;
+   TIter next(GetListOfLeaves());
+   while (auto leaf = static_cast<TLeaf *>(next())) {
+      TBranch *branch = leaf->GetBranch();
+      if (!branch || !visited.insert(branch).second || branch->GetWriteBasket() < 0)
+         continue;
+      auto basket = static_cast<TBasket *>(branch->GetListOfBaskets()->UncheckedAt(branch->GetWriteBasket()));
+      if (!basket || !basket->GetBufferRef())
+         continue;
+      const char *data = basket->GetBufferRef()->Buffer() + basket->GetKeylen();
+      const Int_t len = basket->GetBufferRef()->Length() - basket->GetKeylen();
+      for (Int_t pos = 0; pos < len; pos += kMaxSampleSize) {
+         sampleSizes.push_back(std::min(kMaxSampleSize, len - pos));
+         samples.append(data + pos, sampleSizes.back());
+      }
+   }
+
+   std::vector<char> dict(maxSize);
+   const Int_t size = R__trainZSTDDictionary(dict.data(), maxSize, samples.data(), sampleSizes.data(),
+                                             sampleSizes.size());
+   if (size <= 0) {
+      Warning("TrainCompressionDictionary", "Not enough data to train a compression dictionary for the tree %s.",
+              GetName());
+      return 0;
+   }
+   return SetCompressionDictionary(dict.data(), size) ? size : 0;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Set the fTree member for all branches and sub branches.
 
@@ -9548,6 +10066,13 @@ void TTree::Streamer(TBuffer& b)
 
          fBranches.SetOwner(kTRUE); // True needed only for R__v < 19 and most R__v == 19
 
+         if (fCompressionDictionary.GetSize()) {
+            fCompressionDictionaryId =
+               R__registerZSTDDictionary(fCompressionDictionary.GetArray(), fCompressionDictionary.GetSize());
+            if (!fCompressionDictionaryId)
+               Error("Streamer", "Invalid compression dictionary in the tree %s.", GetName());
+         }
+
          if (fBranchRef) fBranchRef->SetTree(this);
          TBranch__SetTree(this,fBranches);
          TFriendElement__SetTree(this,fFriends);
@@ -9619,6 +10144,12 @@ void TTree::Streamer(TBuffer& b)
       TRefTable *table  = TRefTable::GetRefTable();
       if (table) TRefTable::SetRefTable(0);
 
+#ifdef R__USE_IMT
+      // The branches store where their baskets are: those compressed during Fill must be written first.
+      if (fBasketCompressor)
+         FinishAsyncBaskets(0);
+#endif
+
       b.WriteClassBuffer(TTree::Class(), this);
 
       if (table) TRefTable::SetRefTable(table);
@@ -266,6 +266,19 @@ rely on the system to cache the right branches.
     }
 ~~~
 
+### Reusing what was learned in previous jobs
+
+Jobs reading the same tree usually read the same branches: the branches learned
+by one job can be saved to a small training profile and used by the next jobs,
+which then skip the learning phase and prefetch the first cluster at once.
+~~~ {.cpp}
+    T->SetCacheSize(cachesize);
+    T->GetReadCache(f)->SetTrainingProfile("mytree.cacheprofile"); // saved or loaded as needed
+~~~
+The profile can also be set for all caches with the TTreeCache.TrainingProfile
+resource or the ROOT_TTREECACHE_TRAININGPROFILE environment variable; see also
+TTreeCache::SaveTrainingProfile and TTreeCache::LoadTrainingProfile.
+
 \anchor checkPerf
 ## How can the usage and performance of TTreeCache be verified?
 
@@ -299,7 +312,11 @@ myTreeOrChain.GetTree()->PrintCacheStats();
 #include "TMath.h"
 #include "TBranchCacheInfo.h"
 #include "TVirtualPerfStats.h"
+#include "ROOT/RIOMetrics.hxx"
 #include <limits.h>
+#include <algorithm>
+#include <fstream>
+#include <vector>
 
 Int_t TTreeCache::fgLearnEntries = 100;
 
@@ -308,7 +325,8 @@ ClassImp(TTreeCache);
 ////////////////////////////////////////////////////////////////////////////////
 /// Default Constructor.
 
-TTreeCache::TTreeCache() : TFileCacheRead(), fPrefillType(GetConfiguredPrefillType())
+TTreeCache::TTreeCache()
+   : TFileCacheRead(), fPrefillType(GetConfiguredPrefillType()), fTrainingProfile(GetConfiguredTrainingProfile())
 {
 }
 
@@ -317,11 +335,14 @@ TTreeCache::TTreeCache() : TFileCacheRead(), fPrefillType(GetConfiguredPrefillTy
 
 TTreeCache::TTreeCache(TTree *tree, Int_t buffersize)
    : TFileCacheRead(tree->GetCurrentFile(), buffersize, tree), fEntryMax(tree->GetEntriesFast()), fEntryNext(0),
-     fBrNames(new TList), fTree(tree), fPrefillType(GetConfiguredPrefillType())
+     fBrNames(new TList), fTree(tree), fPrefillType(GetConfiguredPrefillType()),
+     fTrainingProfile(GetConfiguredTrainingProfile())
 {
    fEntryNext = fEntryMin + fgLearnEntries;
    Int_t nleaves = tree->GetListOfLeaves()->GetEntriesFast();
    fBranches = new TObjArray(nleaves);
+   if (fFile)
+      fIOMetrics = ROOT::Experimental::RIOMetrics::GetFileMetricsIfEnabled("TTreeCache", fFile->GetName());
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -358,7 +379,13 @@ Int_t TTreeCache::LearnBranch(TBranch *b, Bool_t subbranches /*= kFALSE*/)
    // the expected TTree), then prefill the cache.  (We expect that in future
    // release the Prefill-ing will be the default so we test for that inside the
    // LearnPrefill call).
-   if (!fLearnPrefilling && fNbranches == 0) LearnPrefill();
+   // A training profile saved by a previous job replaces the learning phase.
+   if (!fLearnPrefilling && fNbranches == 0) {
+      if (!fTrainingProfile.empty() && !gSystem->AccessPathName(fTrainingProfile.c_str()) &&
+          LoadTrainingProfile(fTrainingProfile.c_str()) > 0)
+         return AddBranch(b, subbranches);
+      LearnPrefill();
+   }
 
    return AddBranch(b, subbranches);
 }
@@ -1788,10 +1815,103 @@ Bool_t TTreeCache::FillBuffer()
          fFirstTime = kFALSE;
       }
    }
+   // The learning phase ends here: keep what was learned for the next jobs
+   if (fIsLearning)
+      SaveLearnedBranches();
    fIsLearning = kFALSE;
    return kTRUE;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Fill the cache with the baskets holding the given entries, which do not need
+/// to be contiguous.
+///
+/// This is used when the tree of this cache is the friend of a main tree
+/// through a TTreeIndex: the entries of the friend matching the cluster
+/// [masterStart, masterNext) of the main tree are computed in advance (see
+/// TTree::LoadTree) and their baskets are read in one sorted vector read,
+/// instead of one read per basket as the friend entries jump around. Negative
+/// entries, i.e. entries of the main tree without a match, are ignored.
+///
+/// Baskets are added in the order of the entries until the cache is full; the
+/// entries after that are read through the regular FillBuffer(). Nothing is
+/// done during the learning phase or with the asynchronous prefetching.
+/// Returns kTRUE if some baskets were added to the cache.
+
+Bool_t TTreeCache::FillBufferFriend(std::vector<Long64_t> entries, Long64_t masterStart, Long64_t masterNext)
+{
+   // Also on failure, so that the same range of the main tree is not retried for each of its entries
+   fFriendMasterStart = masterStart;
+   fFriendMasterNext = masterNext;
+   if (fNbranches <= 0 || fIsLearning || fEnablePrefetching || !fEnabled)
+      return kFALSE;
+
+   const Long64_t entryMax = fEntryMax > 0 ? fEntryMax : fTree->GetEntries();
+   entries.erase(std::remove_if(entries.begin(), entries.end(),
+                                [this, entryMax](Long64_t e) { return e < fEntryMin || e >= entryMax; }),
+                 entries.end());
+   std::sort(entries.begin(), entries.end());
+   entries.erase(std::unique(entries.begin(), entries.end()), entries.end());
+   if (entries.empty())
+      return kFALSE;
+
+   TFileCacheRead::Prefetch(0, 0);
+   std::vector<TBranch *> branches;
+   for (Int_t i = 0; i < fNbranches; ++i) {
+      TBranch *b = (TBranch *)fBranches->UncheckedAt(i);
+      if (b->GetDirectory() == 0 || b->TestBit(TBranch::kDoNotProcess))
+         continue;
+      if (b->GetDirectory()->GetFile() != fFile)
+         continue;
+      b->fCacheInfo.Reset();
+      branches.push_back(b);
+   }
+
+   Int_t nReadPrefRequest = 0;
+   Long64_t entryNext = entries.back() + 1;
+   std::vector<Int_t> lastBasket(branches.size(), -1);
+   for (auto entry : entries) {
+      Bool_t full = kFALSE;
+      for (std::size_t i = 0; i < branches.size(); ++i) {
+         TBranch *b = branches[i];
+         Int_t *lbaskets = b->GetBasketBytes();
+         Long64_t *basketEntries = b->GetBasketEntry();
+         if (!lbaskets || !basketEntries)
+            continue;
+         const Int_t j = TMath::BinarySearch(b->GetWriteBasket() + 1, basketEntries, entry);
+         if (j < 0 || j == lastBasket[i])
+            continue;
+         lastBasket[i] = j;
+         // Already in memory
+         if (j < b->GetListOfBaskets()->GetSize() && b->GetListOfBaskets()->UncheckedAt(j))
+            continue;
+         const Long64_t pos = b->GetBasketSeek(j);
+         const Int_t len = lbaskets[j];
+         if (pos <= 0 || len <= 0 || len > fBufferSizeMin)
+            continue;
+         if (fNtot + len > fBufferSizeMin) {
+            full = kTRUE;
+            break;
+         }
+         b->fCacheInfo.SetIsInCache(j);
+         TFileCacheRead::Prefetch(pos, len);
+         ++nReadPrefRequest;
+      }
+      if (full) {
+         entryNext = entry;
+         break;
+      }
+   }
+
+   fNReadPref += nReadPrefRequest;
+   fEntryCurrent = entries.front();
+   fEntryNext = entryNext;
+   // The content does not follow the clusters, the next FillBuffer() starts afresh
+   fCurrentClusterStart = -1;
+   fNextClusterStart = -1;
+   return nReadPrefRequest > 0;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Return the desired prefill type from the environment or resource variable
 /// - 0 - No prefill
@@ -1811,6 +1931,18 @@ TTreeCache::EPrefillType TTreeCache::GetConfiguredPrefillType() const
    return static_cast<TTreeCache::EPrefillType>(s);
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Return the training profile file from the environment or resource variable,
+/// see SetTrainingProfile(). An empty string means that no profile is used.
+
+std::string TTreeCache::GetConfiguredTrainingProfile() const
+{
+   const char *stcp = gSystem->Getenv("ROOT_TTREECACHE_TRAININGPROFILE");
+   if (!stcp || !*stcp)
+      stcp = gEnv->GetValue("TTreeCache.TrainingProfile", "");
+   return stcp ? stcp : "";
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Give the total efficiency of the primary cache... defined as the ratio
 /// of blocks found in the cache vs. the number of blocks prefetched
@@ -2026,10 +2158,18 @@ Int_t TTreeCache::ReadBuffer(char *buf, Long64_t pos, Int_t len)
 {
    if (!fEnabled) return 0;
 
+   Int_t res;
    if (fEnablePrefetching)
-      return TTreeCache::ReadBufferPrefetch(buf, pos, len);
+      res = TTreeCache::ReadBufferPrefetch(buf, pos, len);
    else
-      return TTreeCache::ReadBufferNormal(buf, pos, len);
+      res = TTreeCache::ReadBufferNormal(buf, pos, len);
+   if (fIOMetrics) {
+      if (res == 1)
+         fIOMetrics->AddCacheHit();
+      else if (res == 0)
+         fIOMetrics->AddCacheMiss();
+   }
+   return res;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -2049,6 +2189,8 @@ void TTreeCache::ResetCache()
    fEntryNext = -1;
    fCurrentClusterStart = -1;
    fNextClusterStart = -1;
+   fFriendMasterStart = -1;
+   fFriendMasterNext = -1;
 
    TFileCacheRead::Prefetch(0,0);
 
@@ -2133,6 +2275,7 @@ void TTreeCache::SetFile(TFile *file, TFile::ECacheAction action)
       prevFile->SetCacheRead(0, fTree, action);
    }
    TFileCacheRead::SetFile(file, action);
+   fIOMetrics = file ? ROOT::Experimental::RIOMetrics::GetFileMetricsIfEnabled("TTreeCache", file->GetName()) : nullptr;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -2145,6 +2288,120 @@ void TTreeCache::SetLearnEntries(Int_t n)
    fgLearnEntries = n;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// \fn void TTreeCache::SetTrainingProfile(const char *filename)
+/// Set the file holding the training profile of this cache. If the file exists
+/// when the first branch is read, the branches listed there are added to the
+/// cache and the learning phase is skipped, such that the first cluster is
+/// read with a single vectored read. Otherwise the branches learned at the
+/// end of the learning phase are saved to the file, for the next jobs.
+/// The default is taken from TTreeCache.TrainingProfile or the environment
+/// variable ROOT_TTREECACHE_TRAININGPROFILE; an empty name disables the profile.
+
+////////////////////////////////////////////////////////////////////////////////
+/// Save the list of branches in the cache to a small text file, so that a later
+/// job reading the same tree can skip the learning phase with
+/// LoadTrainingProfile().
+/// Returns:
+///  - 0 on success
+///  - -1 on error
+
+Int_t TTreeCache::SaveTrainingProfile(const char *filename) const
+{
+   if (!fTree || !fBrNames || fBrNames->GetEntries() == 0) {
+      Error("SaveTrainingProfile", "there are no branches in the cache");
+      return -1;
+   }
+
+   TString path(filename);
+   gSystem->ExpandPathName(path);
+   std::ofstream out(path.Data());
+   if (!out) {
+      Error("SaveTrainingProfile", "cannot open %s for writing", path.Data());
+      return -1;
+   }
+   out << "# TTreeCache training profile\n";
+   out << "tree " << fTree->GetName() << "\n";
+   TIter next(fBrNames);
+   while (auto os = static_cast<TObjString *>(next()))
+      out << "branch " << os->GetName() << "\n";
+   out.close();
+   if (!out) {
+      Error("SaveTrainingProfile", "cannot write %s", path.Data());
+      return -1;
+   }
+   return 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Save the branches learned to the training profile set for this cache, unless
+/// there is none or it exists already. Called when the learning phase ends.
+
+void TTreeCache::SaveLearnedBranches() const
+{
+   if (!fTrainingProfile.empty() && gSystem->AccessPathName(fTrainingProfile.c_str()))
+      SaveTrainingProfile(fTrainingProfile.c_str());
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Add to the cache the branches listed in a training profile written by
+/// SaveTrainingProfile() and stop the learning phase. The next fill of the
+/// cache then prefetches all of them at once.
+/// Branches of the profile that do not exist in the tree are skipped.
+/// Returns:
+///  - the number of branches added on success
+///  - -1 on error
+
+Int_t TTreeCache::LoadTrainingProfile(const char *filename)
+{
+   if (!fTree)
+      return -1;
+
+   TString path(filename);
+   gSystem->ExpandPathName(path);
+   std::ifstream in(path.Data());
+   if (!in) {
+      Error("LoadTrainingProfile", "cannot open %s", path.Data());
+      return -1;
+   }
+
+   std::string treeName;
+   std::vector<std::string> branchNames;
+   std::string line;
+   while (std::getline(in, line)) {
+      if (line.empty() || line[0] == '#')
+         continue;
+      if (line.compare(0, 5, "tree ") == 0) {
+         treeName = line.substr(5);
+      } else if (line.compare(0, 7, "branch ") == 0) {
+         branchNames.emplace_back(line.substr(7));
+      } else {
+         Error("LoadTrainingProfile", "%s is not a training profile: unexpected line '%s'", path.Data(), line.c_str());
+         return -1;
+      }
+   }
+   if (treeName != fTree->GetName()) {
+      Warning("LoadTrainingProfile", "%s is the training profile of tree '%s', not of '%s': ignored", path.Data(),
+              treeName.c_str(), fTree->GetName());
+      return -1;
+   }
+
+   Int_t nAdded = 0;
+   for (const auto &name : branchNames) {
+      TBranch *b = fTree->GetBranch(name.c_str());
+      if (!b) {
+         if (gDebug > 0)
+            Info("LoadTrainingProfile", "branch %s of the profile is not in the tree, skipping it", name.c_str());
+         continue;
+      }
+      if (AddBranch(b, kFALSE) == 0)
+         ++nAdded;
+   }
+   if (nAdded > 0)
+      StopLearningPhase();
+   return nAdded;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Set whether the learning period is started with a prefilling of the
 /// cache and which type of prefilling is used.
@@ -16,6 +16,12 @@
 
 A TTreeCache which exploits parallelized decompression of its own content.
 
+With implicit multi-threading enabled, the baskets of the cluster in the cache
+are unzipped by tasks while the main thread reads the baskets of the next
+cluster, so that reading a cluster overlaps with unzipping the previous one.
+This can be disabled with SetPrefetchNextCluster() or with the resource
+TTreeCacheUnzip.PrefetchNextCluster.
+
 */
 
 #include "TTreeCacheUnzip.h"
@@ -27,13 +33,17 @@ A TTreeCache which exploits parallelized decompression of its own content.
 #include "TMath.h"
 #include "TROOT.h"
 #include "TMutex.h"
+#include "ROOT/RIOMetrics.hxx"
 
 #ifdef R__USE_IMT
 #include "ROOT/TThreadExecutor.hxx"
+#include "ROOT/RTaskTracer.hxx"
 #include "ROOT/TTaskGroup.hxx"
 #endif
 
+#include <algorithm>
 #include <memory>
+#include <utility>
 
 extern "C" void R__unzip(Int_t *nin, UChar_t *bufin, Int_t *lout, char *bufout, Int_t *nout);
 extern "C" int R__unzip_header(Int_t *nin, UChar_t *bufin, Int_t *lout);
@@ -160,13 +170,15 @@ TTreeCacheUnzip::TTreeCacheUnzip() : TTreeCache(),
    fAsyncReading(kFALSE),
    fEmpty(kTRUE),
    fCycle(0),
+   fPrefetchNextCluster(kTRUE),
    fNseekMax(0),
    fUnzipGroupSize(0),
    fUnzipBufferSize(0),
    fNFound(0),
    fNMissed(0),
    fNStalls(0),
-   fNUnzip(0)
+   fNUnzip(0),
+   fNClusterReadAhead(0)
 {
    // Default Constructor.
    Init();
@@ -179,13 +191,15 @@ TTreeCacheUnzip::TTreeCacheUnzip(TTree *tree, Int_t buffersize) : TTreeCache(tre
    fAsyncReading(kFALSE),
    fEmpty(kTRUE),
    fCycle(0),
+   fPrefetchNextCluster(kTRUE),
    fNseekMax(0),
    fUnzipGroupSize(0),
    fUnzipBufferSize(0),
    fNFound(0),
    fNMissed(0),
    fNStalls(0),
-   fNUnzip(0)
+   fNUnzip(0),
+   fNClusterReadAhead(0)
 {
    Init();
 }
@@ -205,6 +219,8 @@ void TTreeCacheUnzip::Init()
 
    fUnzipGroupSize = 102400; // Each task unzips at least 100 KB
 
+   fPrefetchNextCluster = gEnv->GetValue("TTreeCacheUnzip.PrefetchNextCluster", 1);
+
    if (fgParallel == kDisable) {
       fParallel = kFALSE;
    }
@@ -234,6 +250,7 @@ void TTreeCacheUnzip::Init()
 
 TTreeCacheUnzip::~TTreeCacheUnzip()
 {
+   StopUnzipTasks();
    ResetCache();
    fUnzipState.Clear(fNseekMax);
 }
@@ -284,6 +301,9 @@ Bool_t TTreeCacheUnzip::FillBuffer()
    // Triggered by the user, not the learning phase
    if (entry == -1)  entry = 0;
 
+   // The unzipping tasks read the baskets straight from the cache buffer
+   StopUnzipTasks();
+
    TTree::TClusterIterator clusterIter = tree->GetClusterIterator(entry);
    fEntryCurrent = clusterIter();
    fEntryNext = clusterIter.GetNextEntry();
@@ -292,6 +312,43 @@ Bool_t TTreeCacheUnzip::FillBuffer()
    if (fEntryMax <= 0) fEntryMax = tree->GetEntries();
    if (fEntryNext > fEntryMax) fEntryNext = fEntryMax;
 
+   //clear cache buffer
+   TFileCacheRead::Prefetch(0,0);
+
+   //store baskets
+   std::vector<Long64_t> pos;
+   std::vector<Int_t> len;
+   CollectBaskets(entry, fEntryNext, pos, len);
+   for (std::size_t i = 0; i < pos.size(); ++i) {
+      fNReadPref++;
+      TFileCacheRead::Prefetch(pos[i], len[i]);
+   }
+   if (gDebug > 0)
+      printf("Entry: %lld, registered baskets, fEntryNext=%lld, fNseek=%d, fNtot=%d\n", entry, fEntryNext, fNseek, fNtot);
+
+   // The baskets may have been read already while the previous cluster was unzipped
+   if (fNextCluster.fEntryStart == fEntryCurrent && fNextCluster.fEntryEnd == fEntryNext && AdoptNextCluster())
+      fNClusterReadAhead++;
+   fNextCluster.fEntryStart = -1;
+
+   // Now fix the size of the status arrays
+   ResetCache();
+   // The learning phase ends here: keep what was learned for the next jobs
+   if (fIsLearning)
+      SaveLearnedBranches();
+   fIsLearning = kFALSE;
+
+   return kTRUE;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Collect position and length on file of the baskets of the cached branches
+/// which are needed to read the entries from entry to entryEnd (excluded) and
+/// which have not been read yet.
+
+void TTreeCacheUnzip::CollectBaskets(Long64_t entry, Long64_t entryEnd, std::vector<Long64_t> &pos,
+                                     std::vector<Int_t> &len)
+{
    // Check if owner has a TEventList set. If yes we optimize for this
    // Special case reading only the baskets containing entries in the
    // list.
@@ -305,10 +362,6 @@ Bool_t TTreeCacheUnzip::FillBuffer()
       }
    }
 
-   //clear cache buffer
-   TFileCacheRead::Prefetch(0,0);
-
-   //store baskets
    for (Int_t i = 0; i < fNbranches; i++) {
       TBranch *b = (TBranch*)fBranches->UncheckedAt(i);
       if (b->GetDirectory() == 0) continue;
@@ -318,37 +371,157 @@ Bool_t TTreeCacheUnzip::FillBuffer()
       Long64_t *entries = b->GetBasketEntry();
       if (!lbaskets || !entries) continue;
       //we have found the branch. We now register all its baskets
-      //from the requested offset to the basket below fEntrymax
+      //from the requested offset to the basket below entryEnd
       Int_t blistsize = b->GetListOfBaskets()->GetSize();
       for (Int_t j=0;j<nb;j++) {
          // This basket has already been read, skip it
          if (j<blistsize && b->GetListOfBaskets()->UncheckedAt(j)) continue;
 
-         Long64_t pos = b->GetBasketSeek(j);
-         Int_t len = lbaskets[j];
-         if (pos <= 0 || len <= 0) continue;
-         //important: do not try to read fEntryNext, otherwise you jump to the next autoflush
-         if (entries[j] >= fEntryNext) continue;
+         Long64_t bpos = b->GetBasketSeek(j);
+         Int_t blen = lbaskets[j];
+         if (bpos <= 0 || blen <= 0) continue;
+         //important: do not try to read entryEnd, otherwise you jump to the next autoflush
+         if (entries[j] >= entryEnd) continue;
          if (entries[j] < entry && (j < nb - 1 && entries[j+1] <= entry)) continue;
          if (elist) {
             Long64_t emax = fEntryMax;
             if (j < nb - 1) emax = entries[j+1] - 1;
             if (!elist->ContainsRange(entries[j] + chainOffset, emax + chainOffset)) continue;
          }
-         fNReadPref++;
-
-         TFileCacheRead::Prefetch(pos, len);
+         pos.push_back(bpos);
+         len.push_back(blen);
       }
-      if (gDebug > 0) printf("Entry: %lld, registering baskets branch %s, fEntryNext=%lld, fNseek=%d, fNtot=%d\n", entry, ((TBranch*)fBranches->UncheckedAt(i))->GetName(), fEntryNext, fNseek, fNtot);
    }
+}
 
-   // Now fix the size of the status arrays
-   ResetCache();
-   fIsLearning = kFALSE;
+////////////////////////////////////////////////////////////////////////////////
+/// Use the baskets read ahead by PrefetchNextCluster() as content of the cache,
+/// if they are exactly the baskets just registered by FillBuffer().
+/// Returns kTRUE if the cache content was adopted, in which case no further
+/// read is needed.
 
+Bool_t TTreeCacheUnzip::AdoptNextCluster()
+{
+   if (fNseek <= 0 || IsAsyncReading())
+      return kFALSE;
+
+   // Same sorting and merging of duplicates as TFileCacheRead::Sort()
+   std::vector<std::pair<Long64_t, Int_t>> baskets;
+   for (Int_t i = 0; i < fNseek; ++i)
+      baskets.emplace_back(fSeek[i], fSeekLen[i]);
+   std::sort(baskets.begin(), baskets.end());
+   std::size_t nSorted = 0;
+   for (std::size_t i = 0; i < baskets.size(); ++i) {
+      if (nSorted > 0 && baskets[i].first == baskets[nSorted - 1].first) {
+         baskets[nSorted - 1].second = std::max(baskets[nSorted - 1].second, baskets[i].second);
+         continue;
+      }
+      baskets[nSorted++] = baskets[i];
+   }
+   if (nSorted != fNextCluster.fSeekSort.size())
+      return kFALSE;
+   for (std::size_t i = 0; i < nSorted; ++i) {
+      if (baskets[i].first != fNextCluster.fSeekSort[i] || baskets[i].second != fNextCluster.fSeekSortLen[i])
+         return kFALSE;
+   }
+
+   Sort();
+   // Sort() laid out the baskets in fBuffer exactly as they are in the read-ahead buffer: swap them
+   char *buffer = fBuffer;
+   fBuffer = fNextCluster.fBuffer.release();
+   fNextCluster.fBuffer.reset(buffer);
+   std::swap(fBufferSize, fNextCluster.fBufferSize);
+   fIsTransferred = kTRUE;
    return kTRUE;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Read the baskets of the cluster following the one in the cache, so that they
+/// are available when FillBuffer() moves to that cluster. This is called by the
+/// main thread right after starting the tasks that unzip the current cluster,
+/// such that reading the next cluster overlaps with unzipping the current one.
+/// The read is skipped for asynchronous reading, which does not use the cache
+/// buffer, and when the TFileCacheRead prefetching is enabled.
+
+void TTreeCacheUnzip::PrefetchNextCluster()
+{
+   if (fNextCluster.fEntryStart >= 0 && fNextCluster.fEntryStart == fEntryNext)
+      return; // already read
+   fNextCluster.fEntryStart = -1;
+   if (!fPrefetchNextCluster || fIsLearning || fNbranches <= 0 || IsAsyncReading() || fEnablePrefetching)
+      return;
+   if (fEntryNext <= 0 || fEntryNext >= fEntryMax)
+      return;
+
+   TTree *tree = ((TBranch*)fBranches->UncheckedAt(0))->GetTree();
+   TTree::TClusterIterator clusterIter = tree->GetClusterIterator(fEntryNext);
+   Long64_t entryStart = clusterIter();
+   Long64_t entryEnd = std::min(clusterIter.GetNextEntry(), fEntryMax);
+   if (entryStart != fEntryNext || entryEnd <= entryStart)
+      return;
+
+   std::vector<Long64_t> pos;
+   std::vector<Int_t> len;
+   CollectBaskets(entryStart, entryEnd, pos, len);
+   if (pos.empty())
+      return;
+
+   std::vector<std::pair<Long64_t, Int_t>> baskets;
+   for (std::size_t i = 0; i < pos.size(); ++i)
+      baskets.emplace_back(pos[i], len[i]);
+   std::sort(baskets.begin(), baskets.end());
+
+   auto &seekSort = fNextCluster.fSeekSort;
+   auto &seekSortLen = fNextCluster.fSeekSortLen;
+   seekSort.clear();
+   seekSortLen.clear();
+   Long64_t ntot = 0;
+   for (const auto &basket : baskets) {
+      if (!seekSort.empty() && basket.first == seekSort.back()) {
+         seekSortLen.back() = std::max(seekSortLen.back(), basket.second);
+         continue;
+      }
+      seekSort.push_back(basket.first);
+      seekSortLen.push_back(basket.second);
+   }
+   for (auto basketLen : seekSortLen)
+      ntot += basketLen;
+   if (ntot > kMaxInt - 100)
+      return;
+
+   // Merge consecutive baskets in long reads, as TFileCacheRead::Sort() does
+   std::vector<Long64_t> readPos{seekSort[0]};
+   std::vector<Int_t> readLen{seekSortLen[0]};
+   for (std::size_t i = 1; i < seekSort.size(); ++i) {
+      if (seekSort[i] != seekSort[i - 1] + seekSortLen[i - 1] || readLen.back() > 16000000) {
+         readPos.push_back(seekSort[i]);
+         readLen.push_back(seekSortLen[i]);
+      } else {
+         readLen.back() += seekSortLen[i];
+      }
+   }
+
+   // Once adopted, the buffer must be at least as large as the cache buffer it replaces
+   if (fNextCluster.fBufferSize < ntot || fNextCluster.fBufferSize < fBufferSizeMin) {
+      fNextCluster.fBufferSize = std::max(Int_t(ntot) + 100, fBufferSizeMin);
+      fNextCluster.fBuffer.reset(new char[fNextCluster.fBufferSize]);
+   }
+
+   Bool_t failed = kFALSE;
+   {
+      R__LOCKGUARD(fIOMutex.get());
+      failed = fFile->ReadBuffers(fNextCluster.fBuffer.get(), readPos.data(), readLen.data(), (Int_t)readPos.size());
+   }
+   if (failed) {
+      if (gDebug > 0)
+         Info("PrefetchNextCluster", "Failed to read ahead the cluster starting at entry %lld", entryStart);
+      return;
+   }
+
+   fNextCluster.fEntryStart = entryStart;
+   fNextCluster.fEntryEnd = entryEnd;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Change the underlying buffer size of the cache.
 /// Returns:
@@ -358,6 +531,10 @@ Bool_t TTreeCacheUnzip::FillBuffer()
 
 Int_t TTreeCacheUnzip::SetBufferSize(Int_t buffersize)
 {
+   StopUnzipTasks();
+   fNextCluster.fEntryStart = -1;
+   fNextCluster.fBuffer.reset();
+   fNextCluster.fBufferSize = 0;
    Int_t res = TTreeCache::SetBufferSize(buffersize);
    if (res < 0) {
       return res;
@@ -391,6 +568,8 @@ void TTreeCacheUnzip::StopLearningPhase()
 
 void TTreeCacheUnzip::UpdateBranches(TTree *tree)
 {
+   StopUnzipTasks();
+   fNextCluster.fEntryStart = -1;
    TTreeCache::UpdateBranches(tree);
 }
 
@@ -549,22 +728,35 @@ Int_t TTreeCacheUnzip::UnzipCache(Int_t index)
       return 1;
    }
 
-   // Prepare a memory buffer of adequate size
+   // Unzip straight from the cache buffer if it holds the basket: the main thread
+   // stops the unzipping tasks before changing its content.
    char* locbuff = 0;
-   if (rdlen > 16384) {
-      locbuff = new char[rdlen];
-   } else if (rdlen * 3 < 16384) {
-      locbuff = new char[rdlen * 2];
-   } else {
-      locbuff = new char[16384];
+   Bool_t ownBuffer = kFALSE;
+   if (fBuffer && !IsAsyncReading()) {
+      loc = (Int_t)TMath::BinarySearch(fNseek, fSeekSort, rdoffs);
+      if (loc >= 0 && loc < fNseek && rdoffs == fSeekSort[loc] && rdlen <= fSeekSortLen[loc])
+         locbuff = &fBuffer[fSeekPos[loc]];
+      loc = -1;
    }
 
-   readbuf = ReadBufferExt(locbuff, rdoffs, rdlen, loc);
+   if (!locbuff) {
+      // Prepare a memory buffer of adequate size
+      ownBuffer = kTRUE;
+      if (rdlen > 16384) {
+         locbuff = new char[rdlen];
+      } else if (rdlen * 3 < 16384) {
+         locbuff = new char[rdlen * 2];
+      } else {
+         locbuff = new char[16384];
+      }
 
-   if (readbuf <= 0) {
-      fUnzipState.SetFinished(index); // Set it as not done, main thread will take charge
-      if (locbuff) delete [] locbuff;
-      return -1;
+      readbuf = ReadBufferExt(locbuff, rdoffs, rdlen, loc);
+
+      if (readbuf <= 0) {
+         fUnzipState.SetFinished(index); // Set it as not done, main thread will take charge
+         delete [] locbuff;
+         return -1;
+      }
    }
 
    GetRecordHeader(locbuff, hlen, nbytes, objlen, keylen);
@@ -579,17 +771,22 @@ Int_t TTreeCacheUnzip::UnzipCache(Int_t index)
                    Info("UnzipCache", "Block %d is too big, skipping.", index);
 
            fUnzipState.SetFinished(index); // Set it as not done, main thread will take charge
-           if (locbuff) delete [] locbuff;
+           if (ownBuffer) delete [] locbuff;
            return 0;
    }
 
    // Unzip it into a new blk
    char *ptr = nullptr;
+   ROOT::Experimental::RIOFileMetrics::Clock_t::time_point unzipStart;
+   if (fIOMetrics)
+      unzipStart = ROOT::Experimental::RIOFileMetrics::Now();
    Int_t loclen = UnzipBuffer(&ptr, locbuff);
+   if (fIOMetrics && loclen > 0)
+      fIOMetrics->AddUnzip(loclen, unzipStart);
    if ((loclen > 0) && (loclen == objlen + keylen)) {
       if ((myCycle != fCycle) || !fIsTransferred) {
          fUnzipState.SetFinished(index); // Set it as not done, main thread will take charge
-         if (locbuff) delete [] locbuff;
+         if (ownBuffer) delete [] locbuff;
          delete [] ptr;
          return 1;
       }
@@ -600,7 +797,7 @@ Int_t TTreeCacheUnzip::UnzipCache(Int_t index)
       delete [] ptr;
    }
 
-   if (locbuff) delete [] locbuff;
+   if (ownBuffer) delete [] locbuff;
    return 0;
 }
 
@@ -617,7 +814,10 @@ Int_t TTreeCacheUnzip::CreateTasks()
          // If cache is invalidated and we should return immediately.
          if (!fIsTransferred) return nullptr;
 
+         ROOT::Experimental::RTaskTracer::RScope traceScope("TTreeCacheUnzip", "UnzipBaskets");
+         Long64_t nBytes = 0;
          for (auto ii : indices) {
+            nBytes += fSeekLen[ii];
             if(fUnzipState.TryUnzipping(ii)) {
                Int_t res = UnzipCache(ii);
                if(res)
@@ -625,6 +825,7 @@ Int_t TTreeCacheUnzip::CreateTasks()
                      Info("UnzipCache", "Unzipping failed or cache is in learning state");
             }
          }
+         traceScope.SetPayload(nBytes);
          return nullptr;
       };
 
@@ -655,6 +856,20 @@ Int_t TTreeCacheUnzip::CreateTasks()
 }
 #endif
 
+////////////////////////////////////////////////////////////////////////////////
+/// Cancel the unzipping tasks and wait for the running ones to finish. Must be
+/// called before the content of the cache buffer is changed.
+
+void TTreeCacheUnzip::StopUnzipTasks()
+{
+#ifdef R__USE_IMT
+   if (fUnzipTaskGroup) {
+      fUnzipTaskGroup->Cancel();
+      fUnzipTaskGroup.reset();
+   }
+#endif
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// We try to read a buffer that has already been unzipped
 /// Returns -1 in case of read failure, 0 in case it's not in the
@@ -715,6 +930,8 @@ Int_t TTreeCacheUnzip::GetUnzipBuffer(char **buf, Long64_t pos, Int_t len, Bool_
                }
 
                fNFound++;
+               if (fIOMetrics)
+                  fIOMetrics->AddCacheHit();
                return fUnzipState.fUnzipLen[seekidx];
             }
 
@@ -764,6 +981,8 @@ Int_t TTreeCacheUnzip::GetUnzipBuffer(char **buf, Long64_t pos, Int_t len, Bool_
             }
 
             fNStalls++;
+            if (fIOMetrics)
+               fIOMetrics->AddCacheHit();
             return fUnzipState.fUnzipLen[seekidx];
          } else {
             // This is a complete miss. We want to avoid the background tasks
@@ -791,12 +1010,7 @@ Int_t TTreeCacheUnzip::GetUnzipBuffer(char **buf, Long64_t pos, Int_t len, Bool_
    res = 0;
    if (!ReadBufferExt(fCompBuffer, pos, len, loc)) {
       // Cache is invalidated and we need to wait for all unzipping tasks to be finished before fill new baskets in cache.
-#ifdef R__USE_IMT
-      if(ROOT::IsImplicitMTEnabled() && fUnzipTaskGroup) {
-         fUnzipTaskGroup->Cancel();
-         fUnzipTaskGroup.reset();
-      }
-#endif
+      StopUnzipTasks();
       {
          // Fill new baskets into cache.
          R__LOCKGUARD(fIOMutex.get());
@@ -806,6 +1020,8 @@ Int_t TTreeCacheUnzip::GetUnzipBuffer(char **buf, Long64_t pos, Int_t len, Bool_
 #ifdef R__USE_IMT
       if(ROOT::IsImplicitMTEnabled()) {
          CreateTasks();
+         // Read the next cluster while the tasks unzip this one
+         PrefetchNextCluster();
       }
 #endif
    }
@@ -813,12 +1029,19 @@ Int_t TTreeCacheUnzip::GetUnzipBuffer(char **buf, Long64_t pos, Int_t len, Bool_
    if (res) res = -1;
 
    if (!res) {
+      ROOT::Experimental::RIOFileMetrics::Clock_t::time_point unzipStart;
+      if (fIOMetrics)
+         unzipStart = ROOT::Experimental::RIOFileMetrics::Now();
       res = UnzipBuffer(buf, fCompBuffer);
       *free = kTRUE;
+      if (fIOMetrics && res > 0)
+         fIOMetrics->AddUnzip(res, unzipStart);
    }
 
    if (!fIsLearning) {
       fNMissed++;
+      if (fIOMetrics)
+         fIOMetrics->AddCacheMiss();
    }
 
    return res;
@@ -952,6 +1175,7 @@ void  TTreeCacheUnzip::Print(Option_t* option) const {
    printf("Number of hits: %d\n", fNFound);
    printf("Number of stalls: %d\n", fNStalls);
    printf("Number of misses: %d\n", fNMissed);
+   printf("Number of clusters read ahead: %d\n", fNClusterReadAhead);
 
    TTreeCache::Print(option);
 }
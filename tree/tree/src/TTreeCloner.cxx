@@ -209,6 +209,18 @@ TTreeCloner::TTreeCloner(TTree *from, TTree *to, TDirectory *newdirectory, Optio
       fIsValid = kFALSE;
    }
 
+   const UInt_t fromDictId =
+      (fIsValid && fFromTree->GetTree()) ? fFromTree->GetTree()->GetCompressionDictionaryId() : 0;
+   if (fromDictId && fToTree->GetCompressionDictionaryId() && fromDictId != fToTree->GetCompressionDictionaryId()) {
+      // The copied baskets can only be read with the dictionary they were compressed with.
+      fWarningMsg.Form("The input TTree (%s) and the output TTree (%s) have different compression dictionaries.",
+                       fFromTree->GetName(), fToTree->GetName());
+      if (!(fOptions & kNoWarnings)) {
+         Warning("TTreeCloner::TTreeCloner", "%s", fWarningMsg.Data());
+      }
+      fIsValid = kFALSE;
+   }
+
    if (fIsValid && (!(fOptions & kNoFileCache))) {
       fCacheSize = fFromTree->GetCacheAutoSize();
    }
@@ -226,6 +238,7 @@ Bool_t TTreeCloner::Exec()
    }
    CreateCache();
    ImportClusterRanges();
+   ImportCompressionDictionary();
    CopyStreamerInfos();
    CopyProcessIds();
    CloseOutWriteBaskets();
@@ -643,6 +656,20 @@ void TTreeCloner::ImportClusterRanges()
    fToTree->SetEntries(fToTree->GetEntries() + fFromTree->GetTree()->GetEntries());
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Give the output tree the compression dictionary of the input tree, if any:
+/// the copied baskets can only be read with it.
+
+void TTreeCloner::ImportCompressionDictionary()
+{
+   if (IsInPlace())
+      return;
+
+   const TArrayC &dict = fFromTree->GetTree()->GetCompressionDictionary();
+   if (dict.GetSize() && !fToTree->GetCompressionDictionaryId())
+      fToTree->SetCompressionDictionary(dict.GetArray(), dict.GetSize());
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Set the TFile cache size to be used.
 /// Note that the default is to use the same size as the default TTreeCache for
@@ -6,6 +6,7 @@
 #include "TFile.h"
 #include "TTree.h"
 #include "TStopwatch.h"
+#include "TSystem.h"
 #include "TTreeReader.h"
 #include "TTreeReaderValue.h"
 #include "TTreeReaderArray.h"
@@ -15,6 +16,9 @@
 
 #include "gtest/gtest.h"
 
+#include <memory>
+#include <vector>
+
 class BulkApiVariableTest : public ::testing::Test {
 public:
    static constexpr Long64_t fClusterSize = 1e5;
@@ -236,3 +240,108 @@ TEST_F(BulkApiVariableTest, serializedRead)
    printf("Bulk Serialized API: Successful read of all events.\n");
    printf("Bulk Serialized API: Total elapsed time (seconds) for API: %.2f\n", sw.RealTime());
 }
+
+TEST_F(BulkApiVariableTest, offsetsRead)
+{
+   std::unique_ptr<TFile> hfile(TFile::Open(fFileName.c_str()));
+   auto tree = hfile->Get<TTree>("T");
+   ASSERT_TRUE(tree);
+   auto branchFloat = tree->GetBranch("f");
+   ASSERT_TRUE(branchFloat);
+   auto branchDouble = tree->GetBranch("d");
+   ASSERT_TRUE(branchDouble);
+   auto branchLen = tree->GetBranch("myLen");
+   ASSERT_TRUE(branchLen);
+   EXPECT_TRUE(branchFloat->GetBulkRead().SupportsBulkReadWithOffsets());
+   EXPECT_TRUE(branchLen->GetBulkRead().SupportsBulkReadWithOffsets());
+
+   float idx_f = 0;
+   double idx_d = 2;
+   Long64_t evt_idx = 0;
+   TBufferFile floatBuf(TBuffer::kWrite, 32 * 1024);
+   TBufferFile doubleBuf(TBuffer::kWrite, 32 * 1024);
+   TBufferFile lenBuf(TBuffer::kWrite, 32 * 1024);
+   std::vector<Int_t> floatOffsets, doubleOffsets, lenOffsets;
+
+   while (evt_idx < fEventCount) {
+      auto count = branchFloat->GetBulkRead().GetBulkEntries(evt_idx, floatBuf, floatOffsets);
+      ASSERT_EQ(count, fClusterSize);
+      ASSERT_EQ(branchDouble->GetBulkRead().GetBulkEntries(evt_idx, doubleBuf, doubleOffsets), count);
+      // fixed-size entries: one value per entry
+      ASSERT_EQ(branchLen->GetBulkRead().GetBulkEntries(evt_idx, lenBuf, lenOffsets), count);
+      ASSERT_EQ(floatOffsets.size(), static_cast<size_t>(count + 1));
+      ASSERT_EQ(lenOffsets.back(), count);
+
+      auto floats = reinterpret_cast<float *>(floatBuf.GetCurrent());
+      auto doubles = reinterpret_cast<double *>(doubleBuf.GetCurrent());
+      auto lens = reinterpret_cast<int *>(lenBuf.GetCurrent());
+      for (Int_t idx = 0; idx < count; idx++) {
+         const auto expectedLen = (evt_idx + idx + 1) % 10;
+         ASSERT_EQ(lens[idx], expectedLen);
+         ASSERT_EQ(floatOffsets[idx + 1] - floatOffsets[idx], expectedLen);
+         ASSERT_EQ(doubleOffsets[idx + 1] - doubleOffsets[idx], expectedLen);
+         for (Int_t j = floatOffsets[idx]; j < floatOffsets[idx + 1]; j++)
+            ASSERT_EQ(floats[j], idx_f++);
+         for (Int_t j = doubleOffsets[idx]; j < doubleOffsets[idx + 1]; j++)
+            ASSERT_EQ(doubles[j], idx_d++);
+      }
+      evt_idx += count;
+   }
+   ASSERT_EQ(evt_idx, fEventCount);
+}
+
+TEST(BulkApiVector, offsetsRead)
+{
+   const auto fileName = "BulkApiTestVector.root";
+   constexpr Long64_t clusterSize = 1000;
+   constexpr Long64_t eventCount = 10000;
+   {
+      TFile f(fileName, "RECREATE");
+      TTree tree("T", "A ROOT tree with std::vector branches.");
+      tree.SetBit(TTree::kOnlyFlushAtCluster);
+      tree.SetAutoFlush(clusterSize);
+      std::vector<float> vf;
+      std::vector<Long64_t> vl;
+      tree.Branch("vf", &vf);
+      tree.Branch("vl", &vl);
+      for (Long64_t ev = 0; ev < eventCount; ev++) {
+         vf.assign(ev % 7, ev * 0.5f);
+         vl.assign(ev % 3, ev);
+         tree.Fill();
+      }
+      f.Write();
+   }
+
+   std::unique_ptr<TFile> hfile(TFile::Open(fileName));
+   auto tree = hfile->Get<TTree>("T");
+   ASSERT_TRUE(tree);
+   auto branchFloat = tree->GetBranch("vf");
+   auto branchLong = tree->GetBranch("vl");
+   ASSERT_TRUE(branchFloat && branchLong);
+   EXPECT_FALSE(branchFloat->GetBulkRead().SupportsBulkRead());
+   EXPECT_TRUE(branchFloat->GetBulkRead().SupportsBulkReadWithOffsets());
+
+   TBufferFile floatBuf(TBuffer::kWrite, 32 * 1024);
+   TBufferFile longBuf(TBuffer::kWrite, 32 * 1024);
+   std::vector<Int_t> floatOffsets, longOffsets;
+   Long64_t evt_idx = 0;
+   while (evt_idx < eventCount) {
+      auto count = branchFloat->GetBulkRead().GetBulkEntries(evt_idx, floatBuf, floatOffsets);
+      ASSERT_EQ(count, clusterSize);
+      ASSERT_EQ(branchLong->GetBulkRead().GetBulkEntries(evt_idx, longBuf, longOffsets), count);
+      auto floats = reinterpret_cast<float *>(floatBuf.GetCurrent());
+      auto longs = reinterpret_cast<Long64_t *>(longBuf.GetCurrent());
+      for (Int_t idx = 0; idx < count; idx++) {
+         const auto ev = evt_idx + idx;
+         ASSERT_EQ(floatOffsets[idx + 1] - floatOffsets[idx], ev % 7);
+         ASSERT_EQ(longOffsets[idx + 1] - longOffsets[idx], ev % 3);
+         for (Int_t j = floatOffsets[idx]; j < floatOffsets[idx + 1]; j++)
+            ASSERT_EQ(floats[j], ev * 0.5f);
+         for (Int_t j = longOffsets[idx]; j < longOffsets[idx + 1]; j++)
+            ASSERT_EQ(longs[j], ev);
+      }
+      evt_idx += count;
+   }
+   hfile.reset();
+   gSystem->Unlink(fileName);
+}
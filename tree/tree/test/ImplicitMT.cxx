@@ -1,10 +1,16 @@
+#include "TBranch.h"
+#include "TChain.h"
 #include "TFile.h"
 #include "TROOT.h"
 #include "TSystem.h"
 #include "TTree.h"
+#include "TTreeCacheUnzip.h"
 
 #include "gtest/gtest.h"
 
+#include <string>
+#include <vector>
+
 #ifdef R__USE_IMT
 
 // ROOT-9668
@@ -28,4 +34,123 @@ TEST(TTreeImplicitMT, flushBaskets)
    gSystem->Unlink(ofileName);
 }
 
+TEST(TTreeImplicitMT, unzipCacheReadAhead)
+{
+   ROOT::EnableImplicitMT();
+   const auto ofileName = "unzipCacheReadAheadMT.root";
+   {
+      TFile f(ofileName, "RECREATE");
+      TTree t("t", "t");
+      t.SetAutoFlush(1000);
+      int i = 0;
+      double x = 0.;
+      t.Branch("i", &i);
+      t.Branch("x", &x);
+      for (i = 0; i < 10000; ++i) {
+         x = i * 0.5;
+         t.Fill();
+      }
+      t.Write();
+   }
+
+   const auto oldMode = TTreeCacheUnzip::GetParallelUnzip();
+   TTreeCacheUnzip::SetParallelUnzip(TTreeCacheUnzip::kEnable);
+   {
+      TFile f(ofileName);
+      auto t = f.Get<TTree>("t");
+      t->SetCacheSize(10000000);
+      int i = -1;
+      double x = -1.;
+      t->SetBranchAddress("i", &i);
+      t->SetBranchAddress("x", &x);
+      for (Long64_t e = 0; e < t->GetEntries(); ++e) {
+         t->GetEntry(e);
+         ASSERT_EQ(i, e);
+         ASSERT_EQ(x, e * 0.5);
+      }
+      auto cache = dynamic_cast<TTreeCacheUnzip *>(t->GetReadCache(&f));
+      ASSERT_NE(cache, nullptr);
+      EXPECT_GT(cache->GetNClusterReadAhead(), 0);
+   }
+   TTreeCacheUnzip::SetParallelUnzip(oldMode);
+   gSystem->Unlink(ofileName);
+}
+
+TEST(TTreeImplicitMT, basketsInFlight)
+{
+   ROOT::EnableImplicitMT();
+   const auto ofileName = "basketsInFlightMT.root";
+   {
+      TFile f(ofileName, "RECREATE");
+      TTree t("t", "t");
+      t.SetAutoFlush(-10000000); // many small baskets per cluster
+      t.SetMaxBasketsInFlight(4);
+      EXPECT_EQ(t.GetMaxBasketsInFlight(), 4);
+      int i = 0;
+      double x = 0.;
+      t.Branch("i", &i, 1000);
+      t.Branch("x", &x, 1000);
+      for (i = 0; i < 20000; ++i) {
+         x = i * 0.5;
+         t.Fill();
+      }
+      t.Write();
+      EXPECT_GT(t.GetBranch("x")->GetWriteBasket(), 10);
+      EXPECT_GT(t.GetZipBytes(), 0);
+   }
+   {
+      TFile f(ofileName);
+      auto t = f.Get<TTree>("t");
+      ASSERT_EQ(t->GetEntries(), 20000);
+      int i = -1;
+      double x = -1.;
+      t->SetBranchAddress("i", &i);
+      t->SetBranchAddress("x", &x);
+      for (Long64_t e = 0; e < t->GetEntries(); ++e) {
+         t->GetEntry(e);
+         ASSERT_EQ(i, e);
+         ASSERT_EQ(x, e * 0.5);
+      }
+   }
+   gSystem->Unlink(ofileName);
+}
+
+
+TEST(TTreeImplicitMT, chainGetEntries)
+{
+   ROOT::EnableImplicitMT();
+   const auto nFiles = 20;
+   std::vector<std::string> fileNames;
+   for (int f = 0; f < nFiles; ++f) {
+      fileNames.emplace_back("ttreeimt_chaingetentries" + std::to_string(f) + ".root");
+      TFile file(fileNames.back().c_str(), "RECREATE");
+      TTree t("t", "t");
+      int i = 0;
+      t.Branch("i", &i);
+      for (i = 0; i <= f; ++i)
+         t.Fill();
+      t.Write();
+   }
+
+   // the number of entries of the files is retrieved concurrently, except for the first file which has a known size
+   TChain c("t");
+   c.Add(fileNames[0].c_str(), 0);
+   for (int f = 1; f < nFiles; ++f)
+      c.Add(fileNames[f].c_str());
+   EXPECT_EQ(c.GetEntries(), nFiles * (nFiles + 1) / 2);
+   Long64_t offset = 0;
+   for (int f = 0; f < nFiles; ++f) {
+      EXPECT_EQ(c.GetTreeOffset()[f], offset);
+      offset += f + 1;
+   }
+   int i = -1;
+   c.SetBranchAddress("i", &i);
+   c.GetEntry(offset - 1);
+   EXPECT_EQ(i, nFiles - 1);
+   c.ResetBranchAddresses();
+
+   for (const auto &f : fileNames)
+      gSystem->Unlink(f.c_str());
+}
+
 #endif // R__USE_IMT
@@ -10,6 +10,7 @@
 #include "ROOT/TestSupport.hxx"
 #include "gtest/gtest.h"
 
+#include <string>
 #include <vector>
 
 static const Int_t gSampleEvents = 100;
@@ -411,3 +412,97 @@ TEST(TBasket, TestSettingIOBits)
    readEntryOffset = reinterpret_cast<Bool_t *>(reinterpret_cast<char *>(basket2) + offset);
    EXPECT_EQ(*readEntryOffset, kTRUE);
 }
+
+TEST(TBasket, CompressionDictionary)
+{
+   const Int_t nEntries = 50000;
+   TMemFile f("tbasket_dictionary.root", "RECREATE");
+   f.SetCompressionAlgorithm(ROOT::RCompressionSetting::EAlgorithm::kZSTD);
+   {
+      TTree t("t", "t");
+      Int_t idx = 0;
+      Double_t x = 0.;
+      Short_t flag = 0;
+      // Large baskets, so that the training data is not written before the training
+      t.Branch("idx", &idx, 256000);
+      t.Branch("x", &x, 512000);
+      t.Branch("flag", &flag, 256000);
+      for (idx = 0; idx < nEntries; ++idx) {
+         x = (idx % 1000) * 0.25;
+         flag = idx % 7;
+         if (idx == nEntries / 2)
+            ASSERT_GT(t.TrainCompressionDictionary(4096), 0);
+         t.Fill();
+      }
+      EXPECT_NE(t.GetCompressionDictionaryId(), 0u);
+      ROOT_EXPECT_WARNING(EXPECT_EQ(t.TrainCompressionDictionary(4096), 0), "TTree::TrainCompressionDictionary",
+                          "The tree t already has a compression dictionary.");
+      t.Write();
+   }
+
+   TTree *t = nullptr;
+   f.GetObject("t", t);
+   ASSERT_NE(t, nullptr);
+   EXPECT_NE(t->GetCompressionDictionaryId(), 0u);
+   Int_t idx = -1;
+   Double_t x = -1.;
+   Short_t flag = -1;
+   t->SetBranchAddress("idx", &idx);
+   t->SetBranchAddress("x", &x);
+   t->SetBranchAddress("flag", &flag);
+   ASSERT_EQ(t->GetEntries(), nEntries);
+   for (Long64_t e = 0; e < nEntries; ++e) {
+      ASSERT_GT(t->GetEntry(e), 0);
+      ASSERT_EQ(idx, e);
+      ASSERT_EQ(x, (e % 1000) * 0.25);
+      ASSERT_EQ(flag, e % 7);
+   }
+   delete t;
+}
+
+TEST(TBasket, ReuseBuffersAcrossBranches)
+{
+   const Int_t nEntries = 20000;
+   const Int_t nBranches = 20;
+   TMemFile f("tbasket_reuse.root", "RECREATE");
+   {
+      TTree t("t", "t");
+      std::vector<Int_t> values(nBranches);
+      for (Int_t i = 0; i < nBranches; ++i) {
+         // Different basket sizes, so that the buffers of the baskets fall in different size classes
+         auto branch = t.Branch(("b" + std::to_string(i)).c_str(), &values[i], 1000 * (1 + i % 5));
+         // Baskets that are not compressed read their data directly into the uncompressed buffer
+         if (i % 7 == 0)
+            branch->SetCompressionLevel(0);
+      }
+      for (Int_t e = 0; e < nEntries; ++e) {
+         for (Int_t i = 0; i < nBranches; ++i)
+            values[i] = e * nBranches + i;
+         t.Fill();
+      }
+      t.Write();
+   }
+
+   TTree *t = nullptr;
+   f.GetObject("t", t);
+   ASSERT_NE(t, nullptr);
+   // Keep as few baskets as possible in memory, so that their buffers are released and reused
+   t->SetMaxVirtualSize(1);
+   std::vector<Int_t> values(nBranches, -1);
+   for (Int_t i = 0; i < nBranches; ++i)
+      t->SetBranchAddress(("b" + std::to_string(i)).c_str(), &values[i]);
+   for (Long64_t e = 0; e < nEntries; ++e) {
+      ASSERT_GT(t->GetEntry(e), 0);
+      for (Int_t i = 0; i < nBranches; ++i)
+         ASSERT_EQ(values[i], e * nBranches + i);
+      if (e % 5000 == 0)
+         t->DropBaskets();
+   }
+   // Read backwards, so that the baskets are read again with buffers released by other branches
+   for (Long64_t e = nEntries - 1; e >= 0; e -= 997) {
+      ASSERT_GT(t->GetEntry(e), 0);
+      for (Int_t i = 0; i < nBranches; ++i)
+         ASSERT_EQ(values[i], e * nBranches + i);
+   }
+   delete t;
+}
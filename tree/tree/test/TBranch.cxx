@@ -2,6 +2,10 @@
 #include "TTree.h"
 #include "TBranch.h"
 #include "TRandom.h"
+#include "TSystem.h"
+
+#include <numeric>
+#include <vector>
 
 #include "gtest/gtest.h"
 
@@ -229,4 +233,42 @@ TEST_F(TBranchTest, branchInheritsCompression)
 {
    for(int mode = 4; mode >= 0; --mode)
       ASSERT_TRUE(nocomp(mode)) << "Failed for mode: " << mode;
-}
\ No newline at end of file
+}
+TEST(TBranch, FillBulk)
+{
+   const Long64_t n = 10000;
+   std::vector<Float_t> px(n);
+   std::vector<Long64_t> idx(n);
+   std::iota(px.begin(), px.end(), 0.5f);
+   std::iota(idx.begin(), idx.end(), 0);
+   {
+      TFile f("TBranchFillBulk.root", "RECREATE");
+      TTree t("t", "t");
+      t.SetAutoFlush(3000);
+      t.Branch("px", px.data(), "px/F");
+      t.Branch("idx", idx.data(), "idx/L");
+      EXPECT_TRUE(t.GetBranch("px")->SupportsBulkWrite());
+      EXPECT_GT(t.FillBulk(n), 0);
+      EXPECT_EQ(t.GetEntries(), n);
+      t.Write();
+   }
+
+   TFile f("TBranchFillBulk.root");
+   auto t = f.Get<TTree>("t");
+   ASSERT_NE(t, nullptr);
+   ASSERT_EQ(t->GetEntries(), n);
+   // the clusters are the same as if the entries were filled one by one
+   auto clusters = t->GetClusterIterator(0);
+   EXPECT_EQ(clusters(), 0);
+   EXPECT_EQ(clusters(), 3000);
+   Float_t pxRead = 0;
+   Long64_t idxRead = 0;
+   t->SetBranchAddress("px", &pxRead);
+   t->SetBranchAddress("idx", &idxRead);
+   for (Long64_t i = 0; i < n; ++i) {
+      t->GetEntry(i);
+      EXPECT_EQ(pxRead, px[i]);
+      EXPECT_EQ(idxRead, i);
+   }
+   gSystem->Unlink("TBranchFillBulk.root");
+}
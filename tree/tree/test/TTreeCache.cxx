@@ -0,0 +1,156 @@
+#include "ROOT/TestSupport.hxx"
+#include "TFile.h"
+#include "TSystem.h"
+#include "TTree.h"
+#include "TTreeCache.h"
+
+#include "gtest/gtest.h"
+
+#include <fstream>
+
+class TTreeCacheTrainingProfile : public ::testing::Test {
+protected:
+   static constexpr auto fFileName = "TTreeCacheTrainingProfile.root";
+   static constexpr auto fProfileName = "TTreeCacheTrainingProfile.txt";
+
+   static void SetUpTestSuite()
+   {
+      TFile f(fFileName, "RECREATE");
+      TTree t("t", "t");
+      t.SetAutoFlush(1000);
+      int a = 0, b = 0, c = 0;
+      t.Branch("a", &a);
+      t.Branch("b", &b);
+      t.Branch("c", &c);
+      for (int i = 0; i < 5000; ++i) {
+         a = i;
+         b = 2 * i;
+         c = 3 * i;
+         t.Fill();
+      }
+      t.Write();
+   }
+
+   static void TearDownTestSuite() { gSystem->Unlink(fFileName); }
+
+   void TearDown() override { gSystem->Unlink(fProfileName); }
+};
+
+TEST_F(TTreeCacheTrainingProfile, SaveAndReuse)
+{
+   // The first job learns which branches are read and saves them
+   {
+      TFile f(fFileName);
+      auto t = f.Get<TTree>("t");
+      t->SetCacheSize(1000000);
+      auto cache = t->GetReadCache(&f);
+      ASSERT_NE(cache, nullptr);
+      cache->SetTrainingProfile(fProfileName);
+      t->SetBranchStatus("*", false);
+      t->SetBranchStatus("a", true);
+      t->SetBranchStatus("c", true);
+      for (Long64_t e = 0; e < 2000; ++e)
+         t->GetEntry(e);
+      EXPECT_FALSE(cache->IsLearning());
+   }
+   ASSERT_FALSE(gSystem->AccessPathName(fProfileName));
+
+   // The next job skips the learning phase
+   {
+      TFile f(fFileName);
+      auto t = f.Get<TTree>("t");
+      t->SetCacheSize(1000000);
+      auto cache = t->GetReadCache(&f);
+      ASSERT_NE(cache, nullptr);
+      cache->SetTrainingProfile(fProfileName);
+      EXPECT_TRUE(cache->IsLearning());
+      int a = -1, c = -1;
+      t->SetBranchStatus("*", false);
+      t->SetBranchStatus("a", true);
+      t->SetBranchStatus("c", true);
+      t->SetBranchAddress("a", &a);
+      t->SetBranchAddress("c", &c);
+      t->GetEntry(0);
+      EXPECT_FALSE(cache->IsLearning());
+      EXPECT_EQ(cache->GetCachedBranches()->GetEntries(), 2);
+      for (Long64_t e = 0; e < t->GetEntries(); ++e) {
+         t->GetEntry(e);
+         EXPECT_EQ(a, e);
+         EXPECT_EQ(c, 3 * e);
+      }
+   }
+}
+
+TEST_F(TTreeCacheTrainingProfile, OtherTree)
+{
+   {
+      std::ofstream out(fProfileName);
+      out << "# TTreeCache training profile\ntree other\nbranch a\n";
+   }
+   TFile f(fFileName);
+   auto t = f.Get<TTree>("t");
+   t->SetCacheSize(1000000);
+   auto cache = t->GetReadCache(&f);
+   ASSERT_NE(cache, nullptr);
+   ROOT_EXPECT_WARNING(EXPECT_EQ(cache->LoadTrainingProfile(fProfileName), -1), "LoadTrainingProfile",
+                       "TTreeCacheTrainingProfile.txt is the training profile of tree 'other', not of 't': ignored");
+   EXPECT_TRUE(cache->IsLearning());
+}
+
+TEST(TTreeCache, FriendWithIndex)
+{
+   const auto mainFileName = "TTreeCacheFriendWithIndex_main.root";
+   const auto friendFileName = "TTreeCacheFriendWithIndex_friend.root";
+   const int nEntries = 10000;
+   {
+      TFile f(mainFileName, "RECREATE");
+      TTree t("m", "m");
+      t.SetAutoFlush(1000);
+      int key = 0;
+      t.Branch("key", &key);
+      for (int i = 0; i < nEntries; ++i) {
+         key = (i * 7919) % nEntries; // a permutation of the keys of the friend
+         t.Fill();
+      }
+      t.Write();
+   }
+   {
+      TFile f(friendFileName, "RECREATE");
+      TTree t("fr", "fr");
+      t.SetAutoFlush(500);
+      int key = 0, val = 0;
+      t.Branch("key", &key);
+      t.Branch("val", &val);
+      for (int i = 0; i < nEntries; ++i) {
+         key = i;
+         val = 2 * i;
+         t.Fill();
+      }
+      t.Write();
+   }
+
+   TFile mainFile(mainFileName);
+   TFile friendFile(friendFileName);
+   auto mainTree = mainFile.Get<TTree>("m");
+   auto friendTree = friendFile.Get<TTree>("fr");
+   ASSERT_EQ(friendTree->BuildIndex("key"), nEntries);
+   friendTree->SetCacheSize(10000000);
+   friendTree->AddBranchToCache("val");
+   friendTree->StopCacheLearningPhase();
+   mainTree->AddFriend(friendTree);
+
+   int key = -1, val = -1;
+   mainTree->SetBranchAddress("key", &key);
+   mainTree->SetBranchAddress("fr.val", &val);
+   for (Long64_t e = 0; e < nEntries; ++e) {
+      mainTree->GetEntry(e);
+      ASSERT_EQ(val, 2 * key);
+   }
+   auto cache = friendTree->GetReadCache(&friendFile);
+   ASSERT_NE(cache, nullptr);
+   // All the baskets of the friend are prefetched, although its entries are read in random order
+   EXPECT_GT(cache->GetEfficiencyRel(), 0.9);
+
+   gSystem->Unlink(mainFileName);
+   gSystem->Unlink(friendFileName);
+}
@@ -2,6 +2,9 @@
 #include "TTree.h"
 #include "TBranch.h"
 #include "TRandom.h"
+#include "TSystem.h"
+
+#include <vector>
 
 #include "gtest/gtest.h"
 
@@ -53,3 +56,52 @@ TEST_F(TTreeClusterTest, countBaskets)
 
    delete file;
 }
+
+TEST(TTreeClusterTuning, AdaptsToEntrySize)
+{
+   const char *fileName = "TTreeClusterTuning.root";
+   const Long64_t targetClusterBytes = 200000;
+   const Int_t targetBasketBytes = 32000;
+   {
+      TRandom random(836);
+      TFile file(fileName, "RECREATE");
+      TTree tree("tree", "A tree whose entries grow tenfold halfway");
+      tree.SetClusterTuning(targetClusterBytes, targetBasketBytes);
+      Int_t n = 0;
+      Double_t dense[100];
+      Char_t sparse = 0;
+      tree.Branch("n", &n);
+      tree.Branch("dense", dense, "dense[n]/D");
+      tree.Branch("sparse", &sparse);
+      for (Int_t ev = 0; ev < 40000; ev++) {
+         n = ev < 20000 ? 10 : 100;
+         for (Int_t i = 0; i < n; ++i)
+            dense[i] = random.Gaus(100, 7);
+         sparse = ev % 2;
+         tree.Fill();
+      }
+      tree.Write();
+
+      const auto &stats = tree.GetClusterTuningStats();
+      EXPECT_EQ(stats.fTargetClusterBytes, targetClusterBytes);
+      EXPECT_GT(stats.fNClusters, 10);
+      EXPECT_GE(stats.fNClusterSizeChanges, 1);
+      EXPECT_GT(2 * stats.fNClustersOnTarget, stats.fNClusters);
+      EXPECT_GT(stats.fNBaskets, stats.fNClusters);
+      EXPECT_LT(stats.fMaxBasketBytes, 2 * targetBasketBytes);
+   }
+
+   TFile file(fileName);
+   auto tree = file.Get<TTree>("tree");
+   ASSERT_NE(tree, nullptr);
+   std::vector<Long64_t> clusterEntries;
+   auto clusters = tree->GetClusterIterator(0);
+   for (Long64_t start = clusters(); start < tree->GetEntries(); start = clusters())
+      clusterEntries.push_back(clusters.GetNextEntry() - start);
+   ASSERT_GT(clusterEntries.size(), 2u);
+   // The clusters of the large entries hold fewer entries
+   EXPECT_GT(clusterEntries.front(), 4 * clusterEntries[clusterEntries.size() - 2]);
+   // The sparse branch writes one basket per cluster
+   EXPECT_LE(tree->GetBranch("sparse")->GetWriteBasket(), Int_t(clusterEntries.size()) + 1);
+   gSystem->Unlink(fileName);
+}
@@ -0,0 +1,93 @@
+#include "TEntryList.h"
+#include "TEntryListBlock.h"
+
+#include "gtest/gtest.h"
+
+#include <vector>
+
+namespace {
+std::vector<Long64_t> GetEntries(TEntryList &elist)
+{
+   std::vector<Long64_t> entries;
+   for (Long64_t entry = elist.GetEntry(0); entry >= 0; entry = elist.Next())
+      entries.push_back(entry);
+   return entries;
+}
+} // anonymous namespace
+
+TEST(TEntryListBlock, Ranges)
+{
+   TEntryListBlock block;
+   for (Int_t i = 100; i < 30000; ++i)
+      block.Enter(i);
+   for (Int_t i = 40000; i < 64000; ++i)
+      block.Enter(i);
+   block.OptimizeStorage();
+   EXPECT_EQ(2, block.GetType());
+   EXPECT_EQ(29900 + 24000, block.GetNPassed());
+
+   EXPECT_FALSE(block.Contains(99));
+   EXPECT_TRUE(block.Contains(100));
+   EXPECT_TRUE(block.Contains(29999));
+   EXPECT_FALSE(block.Contains(30000));
+   EXPECT_TRUE(block.Contains(63999));
+
+   EXPECT_EQ(100, block.GetEntry(0));
+   EXPECT_EQ(40000, block.GetEntry(29900));
+   EXPECT_EQ(40001, block.Next());
+   EXPECT_EQ(29900, block.GetNPassedBefore(40000));
+   EXPECT_EQ(0, block.GetNPassedBefore(100));
+   EXPECT_EQ(1, block.GetNPassedBefore(101));
+
+   // Entering an entry switches back to the bits
+   block.Enter(35000);
+   EXPECT_EQ(0, block.GetType());
+   EXPECT_TRUE(block.Contains(35000));
+   EXPECT_EQ(29900 + 24000 + 1, block.GetNPassed());
+}
+
+TEST(TEntryList, AddSubtract)
+{
+   TEntryList elist1("elist1", "", "t", "f.root");
+   elist1.EnterRange(0, 200000);
+   elist1.OptimizeStorage();
+   TEntryList elist2("elist2", "", "t", "f.root");
+   for (Long64_t i = 1; i < 300000; i += 3)
+      elist2.Enter(i);
+   elist2.OptimizeStorage();
+
+   TEntryList difference(elist1);
+   difference.Subtract(&elist2);
+   std::vector<Long64_t> expected;
+   for (Long64_t i = 0; i < 200000; ++i) {
+      if (i % 3 != 1)
+         expected.push_back(i);
+   }
+   EXPECT_EQ((Long64_t)expected.size(), difference.GetN());
+   EXPECT_EQ(expected, GetEntries(difference));
+
+   TEntryList sum(difference);
+   sum.Add(&elist2);
+   expected.clear();
+   for (Long64_t i = 0; i < 300000; ++i) {
+      if (i < 200000 || i % 3 == 1)
+         expected.push_back(i);
+   }
+   EXPECT_EQ((Long64_t)expected.size(), sum.GetN());
+   EXPECT_EQ(expected, GetEntries(sum));
+}
+
+TEST(TEntryList, GetNInRange)
+{
+   TEntryList elist("elist", "", "t", "f.root");
+   for (Long64_t i = 0; i < 500000; i += 2)
+      elist.Enter(i);
+   elist.OptimizeStorage();
+
+   EXPECT_EQ(elist.GetN(), elist.GetNInRange(0, 500000));
+   EXPECT_EQ(0, elist.GetNInRange(1, 2));
+   EXPECT_EQ(1, elist.GetNInRange(63999, 64001));
+   EXPECT_EQ(50000, elist.GetNInRange(100000, 200000));
+   EXPECT_EQ(10, elist.GetNInRange(499980, 600000));
+   EXPECT_EQ(0, elist.GetNInRange(200000, 100000));
+}
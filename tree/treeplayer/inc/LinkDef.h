@@ -25,6 +25,7 @@
 #pragma link C++ class TTreeDrawArgsParser+;
 #pragma link C++ class TTreePerfStats+;
 #pragma link C++ class TTreePerfStats::BasketInfo+;
+#pragma link C++ class TTreePerfStatsMT-;
 #pragma link C++ class TTreeReader+;
 #pragma link C++ class ROOT::Experimental::TTreeReaderFast+;
 #pragma link C++ class TTreeTableInterface;
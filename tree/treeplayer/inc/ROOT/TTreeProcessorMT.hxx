@@ -26,6 +26,7 @@
 #include "ROOT/RFriendInfo.hxx"
 
 #include <functional>
+#include <future>
 #include <memory>
 #include <vector>
 #include <limits>
@@ -77,6 +78,16 @@ public:
 } // End of namespace Internal
 
 class TTreeProcessorMT {
+public:
+   /// Statistics on the load balancing of a call to Process()
+   struct RProcessStats {
+      std::size_t fNTasks = 0;      ///< Number of tasks, i.e. calls to the user function
+      unsigned int fNWorkers = 0;   ///< Number of threads that processed at least one task
+      double fWallTime = 0.;        ///< Duration of the processing, in seconds
+      double fTailIdleTime = 0.;    ///< Sum over the workers of their idle time after their last task, in seconds
+      double fMaxTailIdleTime = 0.; ///< Longest idle time of a worker after its last task, in seconds
+   };
+
 private:
    const std::vector<std::string> fFileNames; ///< Names of the files
    const std::vector<std::string> fTreeNames; ///< TTree names (always same size and ordering as fFileNames)
@@ -91,9 +102,25 @@ private:
 
    std::vector<std::string> FindTreeNames();
    static unsigned int fgTasksPerWorkerHint;
+   static unsigned int fgFilePrefetchDepth;
+   static bool fgUseGlobalTaskQueue;
+
+   RProcessStats fLastProcessStats;
 
    std::pair<Long64_t, Long64_t> fGlobalRange{0, std::numeric_limits<Long64_t>::max()};
 
+   /// Cluster boundaries, per file, and number of entries, per file
+   using ClustersAndEntries_t =
+      std::pair<std::vector<std::vector<std::pair<Long64_t, Long64_t>>>, std::vector<Long64_t>>;
+   /// Cluster info of the first files, retrieved by Prefetch() for the next call to Process()
+   std::vector<std::future<ClustersAndEntries_t>> fPrefetchedClusters;
+   /// Cluster info of all files, retrieved by Prefetch() if Process() needs it upfront
+   std::future<ClustersAndEntries_t> fPrefetchedAllClusters;
+
+   bool ShouldRetrieveAllClusters() const;
+   unsigned int GetMaxTasksPerFile() const;
+   unsigned int GetMaxTasks() const;
+
 public:
    TTreeProcessorMT(std::string_view filename, std::string_view treename = "", UInt_t nThreads = 0u,
                     const std::pair<Long64_t, Long64_t> &globalRange = {0, std::numeric_limits<Long64_t>::max()});
@@ -107,10 +134,18 @@ public:
    TTreeProcessorMT(TTree &tree, UInt_t nThreads = 0u,
                     const std::pair<Long64_t, Long64_t> &globalRange = {0, std::numeric_limits<Long64_t>::max()});
 
+   void Prefetch();
    void Process(std::function<void(TTreeReader &)> func);
 
    static void SetTasksPerWorkerHint(unsigned int m);
    static unsigned int GetTasksPerWorkerHint();
+   static void SetFilePrefetchDepth(unsigned int depth);
+   static unsigned int GetFilePrefetchDepth();
+   static void SetUseGlobalTaskQueue(bool useGlobalQueue);
+   static bool GetUseGlobalTaskQueue();
+
+   /// Load-balancing statistics of the last call to Process()
+   const RProcessStats &GetLastProcessStats() const { return fLastProcessStats; }
 };
 
 } // End of namespace ROOT
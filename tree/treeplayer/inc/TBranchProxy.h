@@ -120,6 +120,10 @@ namespace Detail {
 
       TBranchProxy* GetProxy() { return this; }
       const char* GetBranchName() const { return fBranchName; }
+      /// The branch read by this proxy, nullptr before Setup()
+      TBranch *GetBranch() const { return fBranch; }
+      /// The entry of the (friend) tree to be read, -1 without a director
+      Long64_t GetReadEntry() const { return fDirector ? fDirector->GetReadEntry() : -1; }
 
       void Reset();
 
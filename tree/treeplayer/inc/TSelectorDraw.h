@@ -22,6 +22,7 @@
 //////////////////////////////////////////////////////////////////////////
 
 #include "TSelector.h"
+#include "TString.h"
 
 #include <vector>
 
@@ -62,11 +63,15 @@ protected:
    Bool_t         fCleanElist;       ///<  True if original Tree elist must be saved
    Bool_t         fObjEval;          ///<  True if fVar1 returns an object (or pointer to).
    Long64_t       fCurrentSubEntry;  ///<  Current subentry when fSelectMultiple is true. Used to fill TEntryListArray
+   std::vector<TString> fVarExpressions; ///<! Expressions of the compiled variables
+   TString        fSelectExpression; ///<! Expression of the compiled selection
+   TString        fTreeState;        ///<! State of the tree the formulas were compiled for, empty if none are cached
 
 protected:
    virtual void      ClearFormula();
    virtual Bool_t    CompileVariables(const char *varexp="", const char *selection="");
    virtual void      InitArrays(Int_t newsize);
+   TString           GetTreeState() const;
 
 private:
    TSelectorDraw(const TSelectorDraw&);             // not implemented
@@ -110,6 +115,7 @@ public:
    Bool_t    Notify() override;
    Bool_t    Process(Long64_t /*entry*/) override { return kFALSE; }
    void      ProcessFill(Long64_t entry) override;
+   virtual Bool_t    ProcessMT(Long64_t firstentry, Long64_t nentries);
    virtual void      ProcessFillMultiple(Long64_t entry);
    virtual void      ProcessFillObject(Long64_t entry);
    virtual void      SetEstimate(Long64_t n);
@@ -46,6 +46,8 @@ protected:
 private:
    TTreeIndex(const TTreeIndex&) = delete;            // Not implemented.
    TTreeIndex &operator=(const TTreeIndex&) = delete; // Not implemented.
+   LongDouble_t   EvalAndRangeCheck(TTreeFormula *formula, Bool_t isMajor, Long64_t entry) const;
+   Bool_t         FillIndexValuesMT(Long64_t *major, Long64_t *minor);
 
 public:
    TTreeIndex();
@@ -0,0 +1,135 @@
+// @(#)root/treeplayer:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_TTreePerfStatsMT
+#define ROOT_TTreePerfStatsMT
+
+//////////////////////////////////////////////////////////////////////////
+//                                                                      //
+// TTreePerfStatsMT                                                     //
+//                                                                      //
+// Thread-safe TTree I/O performance measurement for multi-threaded     //
+// event loops, with per-thread, per-branch and per-cluster breakdown.  //
+//                                                                      //
+//////////////////////////////////////////////////////////////////////////
+
+#include "TVirtualPerfStats.h"
+
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+class TBranch;
+class TFile;
+
+class TTreePerfStatsMT : public TVirtualPerfStats {
+
+public:
+   /// The I/O of one thread
+   struct ThreadStats {
+      UInt_t    fThread = 0;        ///< Index of the thread, in the order of their first I/O
+      ULong64_t fReadCalls = 0;     ///< Number of TFile read calls
+      ULong64_t fBytesRead = 0;     ///< Number of bytes read from the files
+      Double_t  fIOWaitTime = 0;    ///< Time spent waiting for the file reads, in seconds
+      ULong64_t fUnzipCalls = 0;    ///< Number of baskets uncompressed
+      Double_t  fUnzipTime = 0;     ///< Time spent uncompressing baskets, in seconds
+   };
+
+   /// The I/O of one branch, summed over all the trees and threads that read it
+   struct BranchStats {
+      std::string fName;            ///< Full name of the branch
+      ULong64_t fBasketReads = 0;   ///< Number of baskets read, from the TTreeCache or the file
+      ULong64_t fBytesRead = 0;     ///< Compressed bytes of the baskets read
+      Double_t  fReadTime = 0;      ///< Time spent reading the baskets, in seconds
+      ULong64_t fBasketMisses = 0;  ///< Number of baskets that were not found in the TTreeCache
+      ULong64_t fUnzipCalls = 0;    ///< Number of baskets uncompressed
+      ULong64_t fBytesUnzipped = 0; ///< Uncompressed bytes of the baskets
+      Double_t  fUnzipTime = 0;     ///< Time spent uncompressing the baskets, in seconds
+   };
+
+   /// The I/O of the baskets of one cluster of one file
+   struct ClusterStats {
+      std::string fFile;            ///< Name of the file
+      Long64_t  fFirstEntry = 0;    ///< First entry of the cluster, in the tree of the file
+      Long64_t  fEndEntry = 0;      ///< One past the last entry of the cluster
+      Double_t  fBegin = 0;         ///< Start of the first basket read, in seconds since Start()
+      Double_t  fEnd = 0;           ///< End of the last basket read or unzip, in seconds since Start()
+      ULong64_t fBytesRead = 0;     ///< Compressed bytes of the baskets read
+      Double_t  fReadTime = 0;      ///< Time spent reading the baskets, in seconds
+      Double_t  fUnzipTime = 0;     ///< Time spent uncompressing the baskets, in seconds
+      std::vector<UInt_t> fThreads; ///< Threads that read baskets of the cluster
+   };
+
+private:
+   mutable std::mutex fMutex;                                    ///<! Protects all the statistics
+   Bool_t   fIsStarted = kFALSE;                                 ///<! Whether this is the default TTree perf stats
+   Double_t fStartTime = 0;                                      ///<! TTimeStamp of Start()
+   Double_t fStopTime = 0;                                       ///<! TTimeStamp of Stop()
+   Long64_t fNumEvents = 0;                                      ///<! Number of events, set by the user
+   std::unordered_map<std::thread::id, ThreadStats> fThreads;    ///<! Statistics per thread
+   std::map<std::string, BranchStats> fBranches;                 ///<! Statistics per branch full name
+   std::map<std::pair<std::string, Long64_t>, ClusterStats> fClusters; ///<! Statistics per file and cluster
+
+   ThreadStats &FindThreadStats();
+   BranchStats &FindBranchStats(TBranch *b);
+   ClusterStats &FindClusterStats(TBranch *b, Double_t start);
+
+   void SetFile(TFile *) override {}
+
+public:
+   TTreePerfStatsMT() = default;
+   ~TTreePerfStatsMT() override;
+
+   void Start();
+   void Stop();
+   void Reset();
+
+   std::vector<ThreadStats>  GetThreadStats() const;
+   std::vector<BranchStats>  GetBranchStats() const;
+   std::vector<ClusterStats> GetClusterStats() const;
+   Double_t GetRealTime() const;
+
+   void Print(Option_t *option = "") const override;
+
+   void SimpleEvent(EEventType) override {}
+   void PacketEvent(const char *, const char *, const char *, Long64_t, Double_t, Double_t, Double_t,
+                    Long64_t) override {}
+   void FileEvent(const char *, const char *, const char *, const char *, Bool_t) override {}
+   void FileOpenEvent(TFile *, const char *, Double_t) override {}
+   void FileReadEvent(TFile *file, Int_t len, Double_t start) override;
+   void UnzipEvent(TObject *tree, Long64_t pos, Double_t start, Int_t complen, Int_t objlen) override;
+   void RateEvent(Double_t, Double_t, Long64_t, Long64_t) override {}
+   void BasketReadEvent(TBranch *b, Long64_t pos, Int_t len, Double_t start) override;
+   void BasketUnzipEvent(TBranch *b, Long64_t pos, Double_t start, Int_t complen, Int_t objlen) override;
+
+   void SetBytesRead(Long64_t) override {}
+   Long64_t GetBytesRead() const override;
+   void SetNumEvents(Long64_t num) override { fNumEvents = num; }
+   Long64_t GetNumEvents() const override { return fNumEvents; }
+
+   void PrintBasketInfo(Option_t *option = "") const override { Print(option); }
+   void SetLoaded(TBranch *, size_t) override {}
+   void SetLoaded(size_t, size_t) override {}
+   void SetLoadedMiss(TBranch *, size_t) override {}
+   void SetLoadedMiss(size_t, size_t) override {}
+   void SetMissed(TBranch *b, size_t basketNumber) override;
+   void SetMissed(size_t, size_t) override {}
+   void SetUsed(TBranch *, size_t) override {}
+   void SetUsed(size_t, size_t) override {}
+   void UpdateBranchIndices(TObjArray *) override {}
+
+   ClassDefOverride(TTreePerfStatsMT, 0) // Thread-safe TTree I/O performance measurement
+};
+
+#endif
@@ -25,11 +25,13 @@
 #include "TDictionary.h"
 #include "TBranchProxy.h"
 
+#include <memory>
 #include <type_traits>
 #include <vector>
 #include <string>
 
 class TBranch;
+class TBufferFile;
 class TBranchElement;
 class TLeaf;
 class TTreeReader;
@@ -74,6 +76,8 @@ Base class of TTreeReaderValue.
 
       EReadStatus ProxyReadDefaultImpl();
 
+      EReadStatus ProxyReadBulk();
+
       typedef Bool_t (ROOT::Detail::TBranchProxy::*BranchProxyRead_t)();
       template <BranchProxyRead_t Func>
       ROOT::Internal::TTreeReaderValueBase::EReadStatus ProxyReadTemplate();
@@ -93,6 +97,12 @@ Base class of TTreeReaderValue.
 
       const char* GetBranchName() const { return fBranchName; }
 
+      /// Whether eligible branches are read a basket at a time through the bulk I/O interface (default: true).
+      /// Takes effect when the next tree is loaded.
+      void SetBulkRead(Bool_t enable = kTRUE) { fBulkReadEnabled = enable; }
+      /// Return true if the values of the current tree are read a basket at a time.
+      Bool_t IsBulkRead() const { return fProxyReadFunc == &TTreeReaderValueBase::ProxyReadBulk; }
+
       virtual ~TTreeReaderValueBase();
 
    protected:
@@ -113,6 +123,10 @@ Base class of TTreeReaderValue.
 
       Detail::TBranchProxy* GetProxy() const { return fProxy; }
 
+      Bool_t SetupBulkRead();
+      Bool_t ReadBulkBasket(Long64_t entry);
+      const void *GetBulkValues(Long64_t &firstEntry, Long64_t &nEntries);
+
       void MarkTreeReaderUnavailable() { fTreeReader = nullptr; fSetupStatus = kSetupTreeDestructed; }
 
       /// Stringify the template argument.
@@ -131,6 +145,12 @@ Base class of TTreeReaderValue.
       std::vector<Long64_t> fStaticClassOffsets;
       typedef EReadStatus (TTreeReaderValueBase::*Read_t)();
       Read_t fProxyReadFunc = &TTreeReaderValueBase::ProxyReadDefaultImpl;      ///<! Pointer to the Read implementation to use.
+      Bool_t fBulkReadEnabled = kTRUE;            ///<! Whether to read eligible branches in bulk
+      std::unique_ptr<TBufferFile> fBulkBuffer;   ///<! Basket read in bulk
+      const char *fBulkValues = nullptr;          ///<! Address of the first value in fBulkBuffer
+      Long64_t fBulkFirstEntry = -1;              ///<! Tree entry of the first value in fBulkBuffer
+      Long64_t fBulkNEntries = 0;                 ///<! Number of values in fBulkBuffer
+      Int_t fBulkValueSize = 0;                   ///<! Size in bytes of one value
 
       // FIXME: re-introduce once we have ClassDefInline!
       //ClassDefOverride(TTreeReaderValueBase, 0);//Base class for accessors to data via TTreeReader
@@ -178,6 +198,15 @@ public:
    /// Most likely a crash will occur.
    T& operator*() { return *Get(); }
 
+   /// Return the values of all the entries of the basket that contains the current entry, if the branch is read in
+   /// bulk (see IsBulkRead()), and nullptr otherwise. On success, firstEntry is set to the entry number, in the
+   /// current tree, of the first returned value and nEntries to the number of values; they are contiguous in memory.
+   /// The values stay valid until the reader moves to an entry outside of this range.
+   const T *GetBulkValues(Long64_t &firstEntry, Long64_t &nEntries)
+   {
+      return static_cast<const T *>(TTreeReaderValueBase::GetBulkValues(firstEntry, nEntries));
+   }
+
 protected:
    // FIXME: use IsA() instead once we have ClassDefTInline
    /// Get the template argument as a string.
@@ -17,7 +17,22 @@ a new index.
 The index values from the first tree should be less then
 all the index values from the second tree, and so on.
 If a tree in the chain doesn't have an index the index will be created
-and kept inside this chain index.
+and kept inside this chain index. With ROOT::EnableImplicitMT(), each of
+these indices is built in parallel (see TTreeIndex::TTreeIndex).
+
+Building the index of a large chain is expensive. A TChainIndex can be
+written to a file and reused in later sessions with a chain of the same
+trees, in the same order:
+~~~ {.cpp}
+   chain.BuildIndex("run", "event");
+   chain.GetTreeIndex()->Write("chainIndex");
+   ...
+   auto index = indexFile->Get<TChainIndex>("chainIndex");
+   chain.SetTreeIndex(index);
+   index->SetTree(&chain);
+~~~
+The indices created by the TChainIndex are written along with it, the
+indices that the trees already had are read from the files of the trees.
 */
 
 #include "TChainIndex.h"
@@ -223,6 +238,9 @@ std::pair<TVirtualIndex*, Int_t> TChainIndex::GetSubTreeIndex(Long64_t major, Lo
    }
    TChain* chain = dynamic_cast<TChain*> (fTree);
    R__ASSERT(chain);
+   // The offsets of a chain to which a stored index was attached may not be known yet
+   if (chain->GetTreeOffset()[treeNo] == TTree::kMaxEntries)
+      chain->GetEntries();
    chain->LoadTree(chain->GetTreeOffset()[treeNo]);
    TVirtualIndex* index =  fTree->GetTree()->GetTreeIndex();
    if (index)
@@ -405,5 +423,9 @@ void TChainIndex::SetTree(TTree *T)
 {
    R__ASSERT(fTree == 0 || fTree == T || T==0);
    fTree = T;
+   auto chain = dynamic_cast<TChain *>(T);
+   if (chain && chain->GetNtrees() != (Int_t)fEntries.size())
+      Warning("SetTree", "The index was built for a chain of %d trees, this chain has %d trees",
+              (Int_t)fEntries.size(), chain->GetNtrees());
 }
 
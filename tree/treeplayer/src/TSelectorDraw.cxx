@@ -35,8 +35,20 @@ A specialized TSelector for TTree::Draw.
 #include "TStyle.h"
 #include "TClass.h"
 #include "TColor.h"
+#include "TChain.h"
+#include "TFile.h"
 #include "strlcpy.h"
 
+#ifdef R__USE_IMT
+#include "ROOT/TTreeProcessorMT.hxx"
+#include "TTreeReader.h"
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#endif
+
 ClassImp(TSelectorDraw);
 
 const Int_t kCustomHistogram = BIT(17);
@@ -948,6 +960,27 @@ void TSelectorDraw::ClearFormula()
    delete fSelect; fSelect = 0;
    fManager = 0;
    fMultiplicity = 0;
+   fVarExpressions.clear();
+   fSelectExpression.Clear();
+   fTreeState.Clear();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return a description of the tree properties the compiled formulas depend on:
+/// the tree itself, its branches, friends and aliases.
+
+TString TSelectorDraw::GetTreeState() const
+{
+   TString state = TString::Format("%p:%d", (void *)fTree, fTree->GetNbranches());
+   if (fTree->GetListOfFriends()) {
+      for (TObject *fe : *fTree->GetListOfFriends())
+         state += TString::Format("\n%s:%p", fe->GetName(), (void *)fe);
+   }
+   if (fTree->GetListOfAliases()) {
+      for (TObject *alias : *fTree->GetListOfAliases())
+         state += TString::Format("\n%s=%s", alias->GetName(), alias->GetTitle());
+   }
+   return state;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -972,11 +1005,40 @@ void TSelectorDraw::ClearFormula()
 /// in a selection all the C++ operators are authorized
 ///
 /// Return kFALSE if any of the variable is not compilable.
+///
+/// The formulas of the previous call are reused if the expressions are the
+/// same and if the branches, friends and aliases of the tree did not change,
+/// which avoids parsing them again for repeated draws of the same expressions.
 
 Bool_t TSelectorDraw::CompileVariables(const char *varexp, const char *selection)
 {
    Int_t i, nch, ncols;
 
+   std::vector<TString> varnames;
+   if (strlen(varexp))
+      SplitNames(varexp, varnames);
+   const TString treeState = GetTreeState();
+
+   if (!fTreeState.IsNull() && fTreeState == treeState && fSelectExpression == selection &&
+       fVarExpressions == varnames) {
+      ResetBit(kWarn);
+      fDimension = varnames.size();
+      for (i = 0; i < fDimension; ++i) {
+         fVar[i]->UpdateFormulaLeaves();
+         fVar[i]->SetAxis(nullptr);
+      }
+      if (fSelect) fSelect->UpdateFormulaLeaves();
+      fMultiplicity = 0;
+      fTree->ResetBit(TTree::kForceRead);
+      if (fManager) {
+         fManager->Sync();
+         if (fManager->GetMultiplicity() == -1) fTree->SetBit(TTree::kForceRead);
+         if (fManager->GetMultiplicity() >= 1) fMultiplicity = fManager->GetMultiplicity();
+      }
+      fObjEval = (fDimension == 1 && fVar[0]->EvalClass());
+      return kTRUE;
+   }
+
    // Compile selection expression if there is one
    fDimension = 0;
    ClearFormula();
@@ -1009,12 +1071,13 @@ Bool_t TSelectorDraw::CompileVariables(const char *varexp, const char *selection
          if (fManager->GetMultiplicity() >= 1) fMultiplicity = fManager->GetMultiplicity();
       }
 
+      fSelectExpression = selection;
+      fTreeState = treeState;
       return kTRUE;
    }
 
    // otherwise select only the specified columns
-   std::vector<TString> varnames;
-   ncols  = SplitNames(varexp, varnames);
+   ncols  = varnames.size();
 
    InitArrays(ncols);
 
@@ -1040,6 +1103,10 @@ Bool_t TSelectorDraw::CompileVariables(const char *varexp, const char *selection
          fObjEval = kTRUE;
       }
    }
+
+   fVarExpressions = varnames;
+   fSelectExpression = selection;
+   fTreeState = treeState;
    return kTRUE;
 }
 
@@ -1345,6 +1412,197 @@ void TSelectorDraw::ProcessFillObject(Long64_t /*entry*/)
 
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Fill the histogram from the entries [firstentry, firstentry + nentries) in
+/// parallel, if implicit multi-threading is enabled and the draw allows it.
+/// Called by TTreePlayer::Process() after Begin(), instead of the entry loop.
+///
+/// Each task reads a range of clusters with its own copy of the tree, of the
+/// formulas and of the histogram, the copies of the histogram are merged at
+/// the end. This is possible for 1D and 2D histograms and profiles whose axis
+/// ranges are known before the loop (an existing histogram or explicit limits
+/// as in `"x>>h(100,0,10)"`), for a tree read from a file that is not open
+/// for writing, without entry or event list and for expressions that do not
+/// depend on the global entry number or on strings. Otherwise, or without
+/// ROOT::EnableImplicitMT(), kFALSE is returned and nothing is processed.
+
+Bool_t TSelectorDraw::ProcessMT(Long64_t firstentry, Long64_t nentries)
+{
+#ifdef R__USE_IMT
+   if (!ROOT::IsImplicitMTEnabled() || nentries <= 0)
+      return kFALSE;
+   if ((fAction != 1 && fAction != 2 && fAction != 4) || fObjEval || !fObject || !fObject->InheritsFrom(TH1::Class()))
+      return kFALSE;
+   if (fTree->GetEntryList() || fTree->GetEventList() || fTreeElist || fTreeElistArray)
+      return kFALSE;
+   TFile *file = fTree->GetCurrentFile();
+   if (!file || file->IsWritable())
+      return kFALSE;
+   auto isEntryDependent = [](const TString &expr) { return expr.Contains("Entry$") || expr.Contains("Entries$"); };
+   if (isEntryDependent(fSelectExpression) || (fSelect && fSelect->IsString()))
+      return kFALSE;
+   for (Int_t i = 0; i < fDimension; ++i) {
+      if (isEntryDependent(fVarExpressions[i]) || fVar[i]->IsString())
+         return kFALSE;
+   }
+
+   std::unique_ptr<ROOT::TTreeProcessorMT> processor;
+   try {
+      processor.reset(new ROOT::TTreeProcessorMT(*fTree, 0u, {firstentry, firstentry + nentries}));
+   } catch (const std::exception &) {
+      // e.g. friends that are not read from a file
+      return kFALSE;
+   }
+
+   // The weight of a chain is the weight of its current tree, unless it was set globally
+   const Bool_t globalWeight = !fTree->InheritsFrom(TChain::Class()) || fTree->TestBit(TChain::kGlobalWeight);
+   const Double_t weight = fTree->GetWeight();
+
+   TH1 *hist = (TH1 *)fObject;
+   std::mutex mutex;
+   std::vector<std::unique_ptr<TH1>> partials;
+   std::vector<TH1 *> freePartials;
+   std::atomic<Long64_t> nfill{0};
+   std::atomic<Bool_t> failed{kFALSE};
+
+   processor->Process([&](TTreeReader &reader) {
+      TTree *tree = reader.GetTree();
+      TH1 *partial = nullptr;
+      std::vector<std::unique_ptr<TTreeFormula>> vars;
+      std::unique_ptr<TTreeFormula> select;
+      TTreeFormulaManager *manager = nullptr;
+      Int_t treeNumber = -1;
+      Double_t w = weight;
+      Long64_t ntaskfill = 0;
+
+      auto fill = [&](const Double_t *v, Double_t ww) {
+         if (fAction == 1)
+            partial->Fill(v[0], ww);
+         else if (fAction == 2)
+            ((TH2 *)partial)->Fill(v[1], v[0], ww);
+         else
+            ((TProfile *)partial)->Fill(v[1], v[0], ww);
+         ++ntaskfill;
+      };
+
+      while (reader.Next()) {
+         if (!partial) {
+            // The formulas are compiled once the first tree is loaded; parsing them uses global state
+            std::lock_guard<std::mutex> lock(mutex);
+            if (freePartials.empty()) {
+               TDirectory::TContext ctxt(nullptr);
+               partials.emplace_back((TH1 *)hist->Clone());
+               partials.back()->SetDirectory(nullptr);
+               partials.back()->Reset();
+               freePartials.push_back(partials.back().get());
+            }
+            partial = freePartials.back();
+            freePartials.pop_back();
+
+            if (fTree->GetListOfAliases()) {
+               for (TObject *alias : *fTree->GetListOfAliases()) {
+                  if (!tree->GetAlias(alias->GetName()))
+                     tree->SetAlias(alias->GetName(), alias->GetTitle());
+               }
+            }
+            manager = new TTreeFormulaManager();
+            if (!fSelectExpression.IsNull()) {
+               select.reset(new TTreeFormula("Selection", fSelectExpression, tree));
+               select->SetQuickLoad(kTRUE);
+               manager->Add(select.get());
+            }
+            for (const auto &expr : fVarExpressions) {
+               vars.emplace_back(new TTreeFormula(TString::Format("Var%zu", vars.size() + 1), expr, tree));
+               vars.back()->SetQuickLoad(kTRUE);
+               manager->Add(vars.back().get());
+            }
+            manager->Sync();
+            Bool_t ok = !select || select->GetNdim();
+            for (const auto &var : vars)
+               ok = ok && var->GetNdim();
+            if (!ok) {
+               failed = kTRUE;
+               select.reset();
+               vars.clear();
+               freePartials.push_back(partial);
+               return;
+            }
+            treeNumber = tree->GetTreeNumber();
+            if (!globalWeight)
+               w = tree->GetWeight();
+         } else if (tree->GetTreeNumber() != treeNumber) {
+            treeNumber = tree->GetTreeNumber();
+            if (select)
+               select->UpdateFormulaLeaves();
+            for (auto &var : vars)
+               var->UpdateFormulaLeaves();
+            if (!globalWeight)
+               w = tree->GetWeight();
+         }
+
+         // Same logic as ProcessFill() and ProcessFillMultiple()
+         const Int_t ndata = fMultiplicity ? manager->GetNdata() : 1;
+         if ((fForceRead && manager->GetNdata() <= 0) || !ndata)
+            continue;
+         Double_t val0[3], val[3];
+         Bool_t hasVal0 = kFALSE;
+
+         Double_t ww = select ? w * select->EvalInstance(0) : w;
+         if (ww) {
+            for (Int_t k = 0; k < fDimension; ++k)
+               val0[k] = vars[k]->EvalInstance(0);
+            hasVal0 = kTRUE;
+            fill(val0, ww);
+         } else if (!fMultiplicity || !fSelectMultiple) {
+            continue;
+         } else {
+            for (auto &var : vars)
+               var->ResetLoading();
+         }
+         for (Int_t i = 1; i < ndata; ++i) {
+            if (fSelectMultiple) {
+               ww = w * select->EvalInstance(i);
+               if (ww == 0)
+                  continue;
+               if (!hasVal0) {
+                  for (Int_t k = 0; k < fDimension; ++k) {
+                     if (!fVarMultiple[k])
+                        val0[k] = vars[k]->EvalInstance(0);
+                  }
+                  hasVal0 = kTRUE;
+               }
+            }
+            for (Int_t k = 0; k < fDimension; ++k)
+               val[k] = fVarMultiple[k] ? vars[k]->EvalInstance(i) : val0[k];
+            fill(val, ww);
+         }
+      }
+
+      nfill += ntaskfill;
+      std::lock_guard<std::mutex> lock(mutex);
+      select.reset();
+      vars.clear();
+      if (partial)
+         freePartials.push_back(partial);
+   });
+
+   if (failed)
+      Error("ProcessMT", "the expressions could not be compiled for all the trees, the histogram is incomplete");
+   TList list;
+   for (auto &partial : partials)
+      list.Add(partial.get());
+   hist->Merge(&list);
+
+   fNfill = 0;
+   fSelectedRows += nfill;
+   return kTRUE;
+#else
+   (void)firstentry;
+   (void)nentries;
+   return kFALSE;
+#endif
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Set number of entries to estimate variable limits.
 
@@ -20,6 +20,24 @@ A Tree Index with majorname and minorname.
 #include "TBuffer.h"
 #include "TMath.h"
 
+#include <algorithm>
+
+#ifdef R__USE_IMT
+#include "ROOT/TSeq.hxx"
+#include "ROOT/TThreadExecutor.hxx"
+#include "ROOT/TTreeProcessorMT.hxx"
+#include "TChain.h"
+#include "TFile.h"
+#include "TList.h"
+#include "TTreeReader.h"
+
+#include <atomic>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <vector>
+#endif
+
 ClassImp(TTreeIndex);
 
 
@@ -42,6 +60,45 @@ struct IndexSortComparator {
   Long64_t *fValMajor, *fValMinor;
 };
 
+namespace {
+/// Below this number of entries, the index is built serially
+constexpr Long64_t kMinEntriesMT = 100000;
+
+////////////////////////////////////////////////////////////////////////////////
+/// Sort the n entry numbers of index by their major and minor values. With
+/// ROOT::EnableImplicitMT(), chunks are sorted in parallel and then merged
+/// pairwise, the merges of each level also running in parallel.
+
+void SortIndex(Long64_t *index, Long64_t n, Long64_t *major, Long64_t *minor)
+{
+   IndexSortComparator comp(major, minor);
+#ifdef R__USE_IMT
+   if (ROOT::IsImplicitMTEnabled() && n >= kMinEntriesMT) {
+      ROOT::TThreadExecutor pool;
+      const unsigned nChunks = std::max<Long64_t>(1, std::min<Long64_t>(pool.GetPoolSize(), n / kMinEntriesMT));
+      std::vector<Long64_t> bounds(nChunks + 1);
+      for (unsigned i = 0; i <= nChunks; ++i)
+         bounds[i] = n * i / nChunks;
+      pool.Foreach([&](unsigned i) { std::sort(index + bounds[i], index + bounds[i + 1], comp); },
+                   ROOT::TSeqU(nChunks));
+      for (unsigned width = 1; width < nChunks; width *= 2) {
+         std::vector<unsigned> firsts;
+         for (unsigned i = 0; i + width < nChunks; i += 2 * width)
+            firsts.push_back(i);
+         pool.Foreach(
+            [&](unsigned i) {
+               std::inplace_merge(index + bounds[i], index + bounds[i + width],
+                                  index + bounds[std::min(i + 2 * width, nChunks)], comp);
+            },
+            firsts);
+      }
+      return;
+   }
+#endif
+   std::sort(index, index + n, comp);
+}
+} // anonymous namespace
+
 
 ////////////////////////////////////////////////////////////////////////////////
 /// Default constructor for TTreeIndex
@@ -118,6 +175,15 @@ TTreeIndex::TTreeIndex(): TVirtualIndex()
 ///
 /// Note that this function can also be applied to a TChain.
 ///
+/// ## Building the TreeIndex in parallel
+///
+/// If ROOT::EnableImplicitMT() was called, the index of a TTree from a file
+/// open for reading with a large number of entries is built in parallel:
+/// the clusters of the tree are read and the major and minor values are
+/// evaluated by concurrent tasks, then the entries are sorted in parallel.
+/// The index of a TChain is built from the indices of its trees, each one
+/// being built in parallel (see TChainIndex).
+///
 /// The return value is the number of entries in the Index (< 0 indicates failure)
 ///
 /// It is possible to play with different TreeIndex in the same Tree.
@@ -168,40 +234,23 @@ TTreeIndex::TTreeIndex(const TTree *T, const char *majorname, const char *minorn
    Long64_t *tmp_minor = new Long64_t[fN];
    Long64_t i;
    Long64_t oldEntry = fTree->GetReadEntry();
-   Int_t current = -1;
-   for (i=0;i<fN;i++) {
-      Long64_t centry = fTree->LoadTree(i);
-      if (centry < 0) break;
-      if (fTree->GetTreeNumber() != current) {
-         current = fTree->GetTreeNumber();
-         fMajorFormula->UpdateFormulaLeaves();
-         fMinorFormula->UpdateFormulaLeaves();
-      }
-      auto GetAndRangeCheck = [this](bool isMajor, Long64_t entry) {
-         LongDouble_t ret = (isMajor ? fMajorFormula : fMinorFormula)->EvalInstance<LongDouble_t>();
-         // Check whether the value (vs significant bits) of ldRet can represent
-         // the full precision of the returned value. If we return 10^60, the
-         // value fits into a long double, but if sizeof(long double) ==
-         // sizeof(double) it cannot store the ones: the value returned by
-         // EvalInstance() only stores the higher bits.
-         LongDouble_t retCloserToZero = ret;
-         if (ret > 0)
-            retCloserToZero -= 1;
-         else
-            retCloserToZero += 1;
-         if (retCloserToZero == ret) {
-            Warning("TTreeIndex",
-                    "In tree entry %lld, %s value %s=%Lf possibly out of range for internal `long double`", entry,
-                    isMajor ? "major" : "minor", isMajor ? fMajorName.Data() : fMinorName.Data(), ret);
+   if (!FillIndexValuesMT(tmp_major, tmp_minor)) {
+      Int_t current = -1;
+      for (i=0;i<fN;i++) {
+         Long64_t centry = fTree->LoadTree(i);
+         if (centry < 0) break;
+         if (fTree->GetTreeNumber() != current) {
+            current = fTree->GetTreeNumber();
+            fMajorFormula->UpdateFormulaLeaves();
+            fMinorFormula->UpdateFormulaLeaves();
          }
-         return ret;
-      };
-      tmp_major[i] = GetAndRangeCheck(true, i);
-      tmp_minor[i] = GetAndRangeCheck(false, i);
+         tmp_major[i] = EvalAndRangeCheck(fMajorFormula, kTRUE, i);
+         tmp_minor[i] = EvalAndRangeCheck(fMinorFormula, kFALSE, i);
+      }
    }
    fIndex = new Long64_t[fN];
    for(i = 0; i < fN; i++) { fIndex[i] = i; }
-   std::sort(fIndex, fIndex + fN, IndexSortComparator(tmp_major, tmp_minor) );
+   SortIndex(fIndex, fN, tmp_major, tmp_minor);
    //TMath::Sort(fN,w,fIndex,0);
    fIndexValues = new Long64_t[fN];
    fIndexValuesMinor = new Long64_t[fN];
@@ -215,6 +264,97 @@ TTreeIndex::TTreeIndex(const TTree *T, const char *majorname, const char *minorn
    fTree->LoadTree(oldEntry);
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Evaluate formula for the current entry, warning if the value cannot be
+/// represented with full precision by a `long double`.
+
+LongDouble_t TTreeIndex::EvalAndRangeCheck(TTreeFormula *formula, Bool_t isMajor, Long64_t entry) const
+{
+   LongDouble_t ret = formula->EvalInstance<LongDouble_t>();
+   // Check whether the value (vs significant bits) of ldRet can represent
+   // the full precision of the returned value. If we return 10^60, the
+   // value fits into a long double, but if sizeof(long double) ==
+   // sizeof(double) it cannot store the ones: the value returned by
+   // EvalInstance() only stores the higher bits.
+   LongDouble_t retCloserToZero = ret;
+   if (ret > 0)
+      retCloserToZero -= 1;
+   else
+      retCloserToZero += 1;
+   if (retCloserToZero == ret) {
+      Warning("TTreeIndex",
+              "In tree entry %lld, %s value %s=%Lf possibly out of range for internal `long double`", entry,
+              isMajor ? "major" : "minor", isMajor ? fMajorName.Data() : fMinorName.Data(), ret);
+   }
+   return ret;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Fill the major and minor values of all the entries of fTree, processing
+/// its clusters in parallel with a ROOT::TTreeProcessorMT. Each task uses its
+/// own copy of the formulas. Returns kFALSE, without filling anything, if the
+/// implicit multi-threading is disabled, if the tree is too small, is a
+/// TChain or is not read from a file, in which case the values must be
+/// filled serially.
+
+Bool_t TTreeIndex::FillIndexValuesMT(Long64_t *major, Long64_t *minor)
+{
+#ifdef R__USE_IMT
+   if (!ROOT::IsImplicitMTEnabled() || fN < kMinEntriesMT || fTree->InheritsFrom(TChain::Class()))
+      return kFALSE;
+   TFile *file = fTree->GetCurrentFile();
+   if (!file || file->IsWritable() || fTree->GetEntryList() || fTree->GetListOfFriends())
+      return kFALSE;
+
+   std::unique_ptr<ROOT::TTreeProcessorMT> processor;
+   try {
+      processor.reset(new ROOT::TTreeProcessorMT(*fTree));
+   } catch (const std::exception &) {
+      return kFALSE;
+   }
+
+   std::mutex formulaMutex;
+   std::atomic<Long64_t> nFilled(0);
+   auto fillTask = [&](TTreeReader &reader) {
+      TTree *tree = reader.GetTree();
+      std::unique_ptr<TTreeFormula> majorFormula, minorFormula;
+      {
+         // The creation of formulas accesses the interpreter and the aliases of the tree
+         std::lock_guard<std::mutex> lock(formulaMutex);
+         if (fTree->GetListOfAliases()) {
+            for (TObject *alias : *fTree->GetListOfAliases()) {
+               if (!tree->GetAlias(alias->GetName()))
+                  tree->SetAlias(alias->GetName(), alias->GetTitle());
+            }
+         }
+         majorFormula.reset(new TTreeFormula("Major", fMajorName.Data(), tree));
+         minorFormula.reset(new TTreeFormula("Minor", fMinorName.Data(), tree));
+         majorFormula->SetQuickLoad(kTRUE);
+         minorFormula->SetQuickLoad(kTRUE);
+      }
+      Long64_t n = 0;
+      while (reader.Next()) {
+         const Long64_t entry = reader.GetCurrentEntry();
+         major[entry] = EvalAndRangeCheck(majorFormula.get(), kTRUE, entry);
+         minor[entry] = EvalAndRangeCheck(minorFormula.get(), kFALSE, entry);
+         ++n;
+      }
+      nFilled += n;
+   };
+
+   try {
+      processor->Process(fillTask);
+   } catch (const std::exception &) {
+      return kFALSE;
+   }
+   return nFilled == fN;
+#else
+   (void)major;
+   (void)minor;
+   return kFALSE;
+#endif
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Destructor.
 
@@ -273,7 +413,7 @@ void TTreeIndex::Append(const TVirtualIndex *add, Bool_t delaySort )
       memcpy(fIndex + oldn, addIndex, add_size);
       memcpy(fIndexValues + oldn, addValues, add_size);
       memcpy(fIndexValuesMinor + oldn, addValues2, add_size);
-      for(Int_t i = 0; i < add->GetN(); i++) {
+      for(Long64_t i = 0; i < add->GetN(); i++) {
          fIndex[oldn + i] += oldn;
       }
 
@@ -290,7 +430,7 @@ void TTreeIndex::Append(const TVirtualIndex *add, Bool_t delaySort )
       Long64_t *conv = new Long64_t[fN];
 
       for(Long64_t i = 0; i < fN; i++) { conv[i] = i; }
-      std::sort(conv, conv+fN, IndexSortComparator(addValues, addValues2) );
+      SortIndex(conv, fN, addValues, addValues2);
       //Long64_t *w = fIndexValues;
       //TMath::Sort(fN,w,conv,0);
 
@@ -0,0 +1,350 @@
+// @(#)root/treeplayer:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+/** \class TTreePerfStatsMT
+
+Thread-safe TTree I/O performance measurement, for the multi-threaded event
+loops of TTreeProcessorMT and RDataFrame.
+
+TTreePerfStats monitors a single tree. The tasks of a multi-threaded event
+loop however create their own trees, so TTreePerfStatsMT is installed by
+Start() as the default perf stats of all the trees (see
+TTree::SetDefaultPerfStats()) and aggregates the I/O of all of them:
+ - per thread: the time spent waiting for TFile reads ("I/O wait") and the
+   time spent uncompressing baskets (CPU);
+ - per branch: the number, size and read time of the baskets read, the number
+   of baskets not found in the TTreeCache, and the time spent uncompressing
+   them;
+ - per cluster of every file: when its baskets were read, by which threads,
+   and how long the reads and the decompression took. This timeline shows how
+   the clusters are spread over the threads.
+
+The read time of a basket is the wall time of the read from the TTreeCache
+or the file, so it includes the I/O wait of the cache fill that the read
+triggered, if any. All the times are in seconds.
+
+Example of use:
+~~~{.cpp}
+ROOT::EnableImplicitMT();
+TTreePerfStatsMT ps;
+ps.Start();
+ROOT::RDataFrame df("Events", "data_*.root");
+df.Histo1D("pt")->Draw();
+ps.Stop();
+ps.Print("clusters");
+~~~
+*/
+
+#include "TTreePerfStatsMT.h"
+
+#include "TBranch.h"
+#include "TFile.h"
+#include "TString.h"
+#include "TTimeStamp.h"
+#include "TTree.h"
+
+#include <algorithm>
+#include <cstdio>
+
+ClassImp(TTreePerfStatsMT);
+
+////////////////////////////////////////////////////////////////////////////////
+/// Destructor, uninstalls the perf stats from the trees if needed.
+
+TTreePerfStatsMT::~TTreePerfStatsMT()
+{
+   Stop();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Resets the statistics and starts monitoring the trees without perf stats
+/// of their own.
+
+void TTreePerfStatsMT::Start()
+{
+   Reset();
+   {
+      std::lock_guard<std::mutex> lock(fMutex);
+      fStartTime = TTimeStamp();
+      fStopTime = 0;
+      fIsStarted = kTRUE;
+   }
+   TTree::SetDefaultPerfStats(this);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Stops monitoring the trees. Must be called after the end of the event loop.
+
+void TTreePerfStatsMT::Stop()
+{
+   std::lock_guard<std::mutex> lock(fMutex);
+   if (!fIsStarted)
+      return;
+   if (TTree::GetDefaultPerfStats() == this)
+      TTree::SetDefaultPerfStats(nullptr);
+   fStopTime = TTimeStamp();
+   fIsStarted = kFALSE;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Clears the statistics.
+
+void TTreePerfStatsMT::Reset()
+{
+   std::lock_guard<std::mutex> lock(fMutex);
+   fThreads.clear();
+   fBranches.clear();
+   fClusters.clear();
+   fNumEvents = 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Returns the statistics of the calling thread; fMutex must be locked.
+
+TTreePerfStatsMT::ThreadStats &TTreePerfStatsMT::FindThreadStats()
+{
+   auto it = fThreads.find(std::this_thread::get_id());
+   if (it == fThreads.end()) {
+      it = fThreads.emplace(std::this_thread::get_id(), ThreadStats()).first;
+      it->second.fThread = fThreads.size() - 1;
+   }
+   return it->second;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Returns the statistics of the branch; fMutex must be locked.
+
+TTreePerfStatsMT::BranchStats &TTreePerfStatsMT::FindBranchStats(TBranch *b)
+{
+   std::string name = b->GetFullName().Data();
+   auto &stats = fBranches[name];
+   if (stats.fName.empty())
+      stats.fName = std::move(name);
+   return stats;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Returns the statistics of the cluster that contains the entry read by the
+/// branch, which began reading or unzipping a basket at start; fMutex must be
+/// locked.
+
+TTreePerfStatsMT::ClusterStats &TTreePerfStatsMT::FindClusterStats(TBranch *b, Double_t start)
+{
+   TTree *tree = b->GetTree();
+   TFile *file = b->GetFile();
+   Long64_t entry = b->GetReadEntry();
+   if (entry < 0)
+      entry = std::max(tree->GetReadEntry(), 0LL);
+   auto clusterIt = tree->GetClusterIterator(entry);
+   const Long64_t firstEntry = clusterIt.Next();
+
+   std::string fileName = file ? file->GetName() : "";
+   auto &stats = fClusters[{fileName, firstEntry}];
+   if (stats.fFile.empty()) {
+      stats.fFile = std::move(fileName);
+      stats.fFirstEntry = firstEntry;
+      stats.fEndEntry = clusterIt.GetNextEntry();
+      stats.fBegin = start - fStartTime;
+   }
+   stats.fBegin = std::min(stats.fBegin, start - fStartTime);
+   const UInt_t thread = FindThreadStats().fThread;
+   if (std::find(stats.fThreads.begin(), stats.fThreads.end(), thread) == stats.fThreads.end())
+      stats.fThreads.emplace_back(thread);
+   return stats;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Called by TFile::ReadBuffer(s) of the monitored trees; accounts the I/O wait
+/// of the calling thread.
+
+void TTreePerfStatsMT::FileReadEvent(TFile * /*file*/, Int_t len, Double_t start)
+{
+   const Double_t now = TTimeStamp();
+   std::lock_guard<std::mutex> lock(fMutex);
+   auto &stats = FindThreadStats();
+   stats.fReadCalls++;
+   stats.fBytesRead += len;
+   stats.fIOWaitTime += now - start;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Called when a basket of a monitored tree was uncompressed, also by the
+/// helper threads of TTreeCacheUnzip; accounts the CPU time of the calling
+/// thread.
+
+void TTreePerfStatsMT::UnzipEvent(TObject * /*tree*/, Long64_t /*pos*/, Double_t start, Int_t /*complen*/,
+                                  Int_t /*objlen*/)
+{
+   const Double_t now = TTimeStamp();
+   std::lock_guard<std::mutex> lock(fMutex);
+   auto &stats = FindThreadStats();
+   stats.fUnzipCalls++;
+   stats.fUnzipTime += now - start;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Called by TBasket::ReadBasketBuffers when a basket was read.
+
+void TTreePerfStatsMT::BasketReadEvent(TBranch *b, Long64_t /*pos*/, Int_t len, Double_t start)
+{
+   const Double_t now = TTimeStamp();
+   std::lock_guard<std::mutex> lock(fMutex);
+   auto &branch = FindBranchStats(b);
+   branch.fBasketReads++;
+   branch.fBytesRead += len;
+   branch.fReadTime += now - start;
+
+   auto &cluster = FindClusterStats(b, start);
+   cluster.fEnd = std::max(cluster.fEnd, now - fStartTime);
+   cluster.fBytesRead += len;
+   cluster.fReadTime += now - start;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Called by TBasket::ReadBasketBuffers when a basket was uncompressed.
+
+void TTreePerfStatsMT::BasketUnzipEvent(TBranch *b, Long64_t /*pos*/, Double_t start, Int_t /*complen*/,
+                                        Int_t objlen)
+{
+   const Double_t now = TTimeStamp();
+   std::lock_guard<std::mutex> lock(fMutex);
+   auto &branch = FindBranchStats(b);
+   branch.fUnzipCalls++;
+   branch.fBytesUnzipped += objlen;
+   branch.fUnzipTime += now - start;
+
+   auto &cluster = FindClusterStats(b, start);
+   cluster.fEnd = std::max(cluster.fEnd, now - fStartTime);
+   cluster.fUnzipTime += now - start;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Called when a basket was not found in the TTreeCache.
+
+void TTreePerfStatsMT::SetMissed(TBranch *b, size_t /*basketNumber*/)
+{
+   std::lock_guard<std::mutex> lock(fMutex);
+   FindBranchStats(b).fBasketMisses++;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Returns the number of bytes read from the files by all the threads.
+
+Long64_t TTreePerfStatsMT::GetBytesRead() const
+{
+   std::lock_guard<std::mutex> lock(fMutex);
+   Long64_t bytes = 0;
+   for (const auto &thread : fThreads)
+      bytes += thread.second.fBytesRead;
+   return bytes;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Returns the wall time between Start() and Stop(), or now if still running.
+
+Double_t TTreePerfStatsMT::GetRealTime() const
+{
+   std::lock_guard<std::mutex> lock(fMutex);
+   if (fStartTime == 0)
+      return 0;
+   return (fIsStarted ? Double_t(TTimeStamp()) : fStopTime) - fStartTime;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Returns the statistics of every thread, in the order of their first I/O.
+
+std::vector<TTreePerfStatsMT::ThreadStats> TTreePerfStatsMT::GetThreadStats() const
+{
+   std::vector<ThreadStats> result;
+   {
+      std::lock_guard<std::mutex> lock(fMutex);
+      for (const auto &thread : fThreads)
+         result.emplace_back(thread.second);
+   }
+   std::sort(result.begin(), result.end(),
+             [](const ThreadStats &a, const ThreadStats &b) { return a.fThread < b.fThread; });
+   return result;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Returns the statistics of every branch, sorted by name.
+
+std::vector<TTreePerfStatsMT::BranchStats> TTreePerfStatsMT::GetBranchStats() const
+{
+   std::vector<BranchStats> result;
+   std::lock_guard<std::mutex> lock(fMutex);
+   for (const auto &branch : fBranches)
+      result.emplace_back(branch.second);
+   return result;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Returns the statistics of every cluster, in the order of their first read.
+
+std::vector<TTreePerfStatsMT::ClusterStats> TTreePerfStatsMT::GetClusterStats() const
+{
+   std::vector<ClusterStats> result;
+   {
+      std::lock_guard<std::mutex> lock(fMutex);
+      for (const auto &cluster : fClusters)
+         result.emplace_back(cluster.second);
+   }
+   std::stable_sort(result.begin(), result.end(),
+                    [](const ClusterStats &a, const ClusterStats &b) { return a.fBegin < b.fBegin; });
+   return result;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Prints the per-thread and per-branch statistics. With option "clusters",
+/// also prints the timeline of the cluster reads.
+
+void TTreePerfStatsMT::Print(Option_t *option) const
+{
+   TString opt = option;
+   opt.ToLower();
+
+   const auto threads = GetThreadStats();
+   printf("TTreePerfStatsMT: %zu threads, real time = %.3f s\n", threads.size(), GetRealTime());
+
+   printf("%8s %12s %12s %14s %12s %14s\n", "Thread", "ReadCalls", "MB read", "I/O wait [s]", "Unzips",
+          "Unzip CPU [s]");
+   ThreadStats total;
+   for (const auto &t : threads) {
+      printf("%8u %12llu %12.3f %14.3f %12llu %14.3f\n", t.fThread, t.fReadCalls, 1e-6 * t.fBytesRead,
+             t.fIOWaitTime, t.fUnzipCalls, t.fUnzipTime);
+      total.fReadCalls += t.fReadCalls;
+      total.fBytesRead += t.fBytesRead;
+      total.fIOWaitTime += t.fIOWaitTime;
+      total.fUnzipCalls += t.fUnzipCalls;
+      total.fUnzipTime += t.fUnzipTime;
+   }
+   printf("%8s %12llu %12.3f %14.3f %12llu %14.3f\n", "Total", total.fReadCalls, 1e-6 * total.fBytesRead,
+          total.fIOWaitTime, total.fUnzipCalls, total.fUnzipTime);
+
+   printf("\n%-40s %10s %10s %10s %10s %10s %12s\n", "Branch", "Baskets", "Misses", "MB zipped", "Read [s]",
+          "MB unzip", "Unzip [s]");
+   for (const auto &b : GetBranchStats()) {
+      printf("%-40s %10llu %10llu %10.3f %10.3f %10.3f %12.3f\n", b.fName.c_str(), b.fBasketReads, b.fBasketMisses,
+             1e-6 * b.fBytesRead, b.fReadTime, 1e-6 * b.fBytesUnzipped, b.fUnzipTime);
+   }
+
+   if (!opt.Contains("clusters"))
+      return;
+
+   printf("\n%-40s %22s %10s %10s %10s %10s %10s  %s\n", "File", "Entries", "Begin [s]", "End [s]", "MB zipped",
+          "Read [s]", "Unzip [s]", "Threads");
+   for (const auto &c : GetClusterStats()) {
+      std::string threadList;
+      for (auto t : c.fThreads)
+         threadList += (threadList.empty() ? "" : ",") + std::to_string(t);
+      printf("%-40s %10lld-%-11lld %10.3f %10.3f %10.3f %10.3f %10.3f  %s\n", c.fFile.c_str(), c.fFirstEntry,
+             c.fEndEntry, c.fBegin, c.fEnd, 1e-6 * c.fBytesRead, c.fReadTime, c.fUnzipTime, threadList.c_str());
+   }
+}
@@ -2245,6 +2245,9 @@ Long64_t TTreePlayer::Process(TSelector *selector,Option_t *option, Long64_t nen
 
    Bool_t process = (selector->GetAbort() != TSelector::kAbortProcess &&
                     (selector->Version() != 0 || selector->GetStatus() != -1)) ? kTRUE : kFALSE;
+   // TTree::Draw into a histogram can run the entry loop in parallel, see TSelectorDraw::ProcessMT()
+   if (process && selector == fSelector && fSelector->ProcessMT(firstentry, nentries))
+      process = kFALSE;
    if (process) {
 
       Long64_t readbytesatstart = 0;
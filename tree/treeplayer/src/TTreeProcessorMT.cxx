@@ -24,8 +24,20 @@ of a ROOT::TThreadedObject, so that each thread works with its own TFile and TTr
 objects.
 */
 
+#include "TEntryList.h"
+#include "TList.h"
 #include "TROOT.h"
+#include "TTreeCache.h"
+#include "TUrl.h"
 #include "ROOT/TTreeProcessorMT.hxx"
+#include "ROOT/RTaskArena.hxx"
+
+#include <chrono>
+#include <cstring> // std::strcmp
+#include <future>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
 
 using namespace ROOT;
 
@@ -47,6 +59,48 @@ static bool ClustersAreSortedAndContiguous(const std::vector<std::vector<EntryRa
    return true;
 }
 
+/// Convert the clusters to ranges of TEntryList indices by counting the entries of the list in each cluster, which
+/// only visits the blocks of the list that overlap with the clusters instead of every entry of the list.
+/// The sub-lists of a list without global entry numbers are looked up by tree and file name: the conversion fails,
+/// returning false, unless they are in the order of the files and every entry of the list is in some cluster.
+static bool CountElistClusters(const std::vector<std::vector<EntryRange>> &clusters, TEntryList &entryList,
+                               const std::vector<std::string> &treeNames, const std::vector<std::string> &fileNames,
+                               const std::vector<Long64_t> &entriesPerFile,
+                               std::vector<std::vector<EntryRange>> &elistClusters)
+{
+   const bool listHasGlobalEntryNumbers = entryList.GetLists() == nullptr;
+   Long64_t elistEntry = 0ll;
+   Long64_t fileOffset = 0ll;
+   Int_t lastSubListIdx = -1;
+   for (auto fileN = 0u; fileN < clusters.size(); ++fileN) {
+      TEntryList *fileList = &entryList;
+      Long64_t shift = 0ll;
+      if (!listHasGlobalEntryNumbers) {
+         fileList = entryList.GetEntryList(treeNames[fileN].c_str(), fileNames[fileN].c_str());
+         if (fileList) {
+            const Int_t subListIdx = entryList.GetLists()->IndexOf(fileList);
+            if (subListIdx <= lastSubListIdx)
+               return false;
+            lastSubListIdx = subListIdx;
+            if (fileList->GetLists())
+               return false;
+         }
+         shift = fileOffset;
+      }
+      std::vector<EntryRange> elistClustersForFile;
+      for (const auto &c : clusters[fileN]) {
+         const Long64_t n = fileList ? fileList->GetNInRange(c.first - shift, c.second - shift) : 0ll;
+         if (n <= 0)
+            continue;
+         elistClustersForFile.emplace_back(EntryRange{elistEntry, elistEntry + n});
+         elistEntry += n;
+      }
+      elistClusters.emplace_back(std::move(elistClustersForFile));
+      fileOffset += entriesPerFile[fileN];
+   }
+   return elistEntry == entryList.GetN();
+}
+
 /// Take a vector of vectors of EntryRanges (a vector per file), filter the entries according to entryList, and
 /// and return a new vector of vectors of EntryRanges where cluster start/end entry numbers have been converted to
 /// TEntryList-local entry numbers.
@@ -62,6 +116,15 @@ ConvertToElistClusters(std::vector<std::vector<EntryRange>> &&clusters, TEntryLi
    R__ASSERT(entryList.GetN() > 0); // wasteful to call this function if it has nothing to do
    R__ASSERT(ClustersAreSortedAndContiguous(clusters));
 
+   {
+      std::vector<std::vector<EntryRange>> elistClusters;
+      if (CountElistClusters(clusters, entryList, treeNames, fileNames, entriesPerFile, elistClusters)) {
+         R__ASSERT(ClustersAreSortedAndContiguous(elistClusters));
+         return elistClusters;
+      }
+   }
+
+   // Otherwise walk through the entries of the list
    const bool listHasGlobalEntryNumbers = entryList.GetLists() == nullptr;
    const auto nFiles = clusters.size();
 
@@ -122,25 +185,43 @@ ConvertToElistClusters(std::vector<std::vector<EntryRange>> &&clusters, TEntryLi
 // EntryRanges and number of entries per file
 using ClustersAndEntries = std::pair<std::vector<std::vector<EntryRange>>, std::vector<Long64_t>>;
 
+////////////////////////////////////////////////////////////////////////
+/// Read the baskets of the first cluster of a tree through a TTreeCache.
+/// Nothing is kept in memory: the goal is to warm up the caches between the storage and the tasks that are going
+/// to process the tree (disk caches, proxies, caching of remote files with TFile::SetCacheFileDir).
+static void ReadAheadFirstCluster(TTree &t, Long64_t clusterEnd)
+{
+   if (t.SetCacheSize() != 0 || t.SetCacheEntryRange(0, clusterEnd) != 0)
+      return;
+   t.AddBranchToCache("*", /*subbranches=*/true);
+   t.StopCacheLearningPhase();
+   if (t.LoadTree(0) < 0)
+      return;
+   if (auto *cache = t.GetReadCache(t.GetCurrentFile()))
+      cache->FillBuffer();
+}
+
 ////////////////////////////////////////////////////////////////////////
 /// Return a vector of cluster boundaries for the given tree and files.
+/// If `readAhead` is true, the first cluster of each remote file is also read.
 static ClustersAndEntries MakeClusters(const std::vector<std::string> &treeNames,
                                        const std::vector<std::string> &fileNames, const unsigned int maxTasksPerFile,
-                                       const EntryRange &range = {0, std::numeric_limits<Long64_t>::max()})
+                                       const EntryRange &range = {0, std::numeric_limits<Long64_t>::max()},
+                                       bool readAhead = false)
 {
    // Note that as a side-effect of opening all files that are going to be used in the
    // analysis once, all necessary streamers will be loaded into memory.
-   TDirectory::TContext c;
    const auto nFileNames = fileNames.size();
    std::vector<std::vector<EntryRange>> clustersPerFile;
    std::vector<Long64_t> entriesPerFile;
    entriesPerFile.reserve(nFileNames);
-   Long64_t offset = 0ll;
-   bool rangeEndReached = false; // flag to break the outer loop
-   for (auto i = 0u; i < nFileNames && !rangeEndReached; ++i) {
+
+   // Retrieve the cluster boundaries, with local entry numbers, and the number of entries of a file
+   auto getFileClusters = [&](std::size_t i) {
       const auto &fileName = fileNames[i];
       const auto &treeName = treeNames[i];
 
+      TDirectory::TContext c;
       std::unique_ptr<TFile> f(TFile::Open(
          fileName.c_str(), "READ_WITHOUT_GLOBALREGISTRATION")); // need TFile::Open to load plugins if need be
       if (!f || f->IsZombie()) {
@@ -159,34 +240,60 @@ static ClustersAndEntries MakeClusters(const std::vector<std::string> &treeNames
       t->ResetBit(kMustCleanup);
       ROOT::Internal::TreeUtils::ClearMustCleanupBits(*t->GetListOfBranches());
       auto clusterIter = t->GetClusterIterator(0);
-      Long64_t clusterStart = 0ll, clusterEnd = 0ll;
+      Long64_t clusterStart = 0ll;
       const Long64_t entries = t->GetEntries();
-      // Iterate over the clusters in the current file
-      std::vector<EntryRange> entryRanges;
-      while ((clusterStart = clusterIter()) < entries && !rangeEndReached) {
-         clusterEnd = clusterIter.GetNextEntry();
-         // Currently, if a user specified a range, the clusters will be only globally obtained
-         // Assume that there are 3 files with entries: [0, 100], [0, 150], [0, 200] (in this order)
-         // Since the cluster boundaries are obtained sequentially, applying the offsets, the boundaries
-         // would be: 0, 100, 250, 450. Now assume that the user provided the range (150, 300)
-         // Then, in the first iteration, nothing is going to be added to entryRanges since:
-         // std::max(0, 150) < std::min(100, max). Then, by the same logic only a subset of the second
-         // tree is added, i.e.: currentStart is now 200 and currentEnd is 250 (locally from 100 to 150).
-         // Lastly, the last tree would take entries from 250 to 300 (or from 0 to 50 locally).
-         // The current file's offset to start and end is added to make them (chain) global
-         const auto currentStart = std::max(clusterStart + offset, range.first);
-         const auto currentEnd = std::min(clusterEnd + offset, range.second);
-         // This is not satified if the desired start is larger than the last entry of some cluster
-         // In this case, this cluster is not going to be processes further
-         if (currentStart < currentEnd)
-            entryRanges.emplace_back(EntryRange{currentStart, currentEnd});
-         if (currentEnd == range.second) // if the desired end is reached, stop reading further
-            rangeEndReached = true;
+      std::vector<EntryRange> clusters;
+      while ((clusterStart = clusterIter()) < entries)
+         clusters.emplace_back(EntryRange{clusterStart, clusterIter.GetNextEntry()});
+      const bool isLocal = std::strcmp(f->GetEndpointUrl()->GetProtocol(), "file") == 0;
+      if (readAhead && !isLocal && entries > 0)
+         ReadAheadFirstCluster(*t, clusters[0].second);
+      return std::make_pair(std::move(clusters), entries);
+   };
+
+   // Opening remote files is dominated by latency, so the files are opened concurrently, in batches: the files
+   // after the batch that reaches the end of the range are not opened.
+   const auto batchSize = ROOT::Internal::TreeUtils::GetMetadataConcurrency();
+   std::vector<std::pair<std::vector<EntryRange>, Long64_t>> batch;
+   Long64_t offset = 0ll;
+   bool rangeEndReached = false; // flag to break the outer loop
+   for (std::size_t batchStart = 0u; batchStart < nFileNames && !rangeEndReached; batchStart += batchSize) {
+      batch.clear();
+      batch.resize(std::min<std::size_t>(batchSize, nFileNames - batchStart));
+      ROOT::Internal::TreeUtils::ForEachIndexConcurrently(
+         batch.size(), batchSize, [&](std::size_t i) { batch[i] = getFileClusters(batchStart + i); });
+
+      for (auto i = 0u; i < batch.size() && !rangeEndReached; ++i) {
+         const auto &clusters = batch[i].first;
+         const auto entries = batch[i].second;
+         // Iterate over the clusters in the current file
+         std::vector<EntryRange> entryRanges;
+         for (const auto &cluster : clusters) {
+            // Currently, if a user specified a range, the clusters will be only globally obtained
+            // Assume that there are 3 files with entries: [0, 100], [0, 150], [0, 200] (in this order)
+            // Since the cluster boundaries are obtained sequentially, applying the offsets, the boundaries
+            // would be: 0, 100, 250, 450. Now assume that the user provided the range (150, 300)
+            // Then, in the first iteration, nothing is going to be added to entryRanges since:
+            // std::max(0, 150) < std::min(100, max). Then, by the same logic only a subset of the second
+            // tree is added, i.e.: currentStart is now 200 and currentEnd is 250 (locally from 100 to 150).
+            // Lastly, the last tree would take entries from 250 to 300 (or from 0 to 50 locally).
+            // The current file's offset to start and end is added to make them (chain) global
+            const auto currentStart = std::max(cluster.first + offset, range.first);
+            const auto currentEnd = std::min(cluster.second + offset, range.second);
+            // This is not satified if the desired start is larger than the last entry of some cluster
+            // In this case, this cluster is not going to be processes further
+            if (currentStart < currentEnd)
+               entryRanges.emplace_back(EntryRange{currentStart, currentEnd});
+            if (currentEnd == range.second) { // if the desired end is reached, stop reading further
+               rangeEndReached = true;
+               break;
+            }
+         }
+         offset += entries; // consistently keep track of the total number of entries
+         clustersPerFile.emplace_back(std::move(entryRanges));
+         // Keep track of the entries, even if their corresponding tree is out of the range, e.g. entryRanges is empty
+         entriesPerFile.emplace_back(entries);
       }
-      offset += entries; // consistently keep track of the total number of entries
-      clustersPerFile.emplace_back(std::move(entryRanges));
-      // Keep track of the entries, even if their corresponding tree is out of the range, e.g. entryRanges is empty
-      entriesPerFile.emplace_back(entries);
    }
    if (range.first >= offset && offset > 0) // do not error out on an empty tree
       throw std::logic_error(std::string("A range of entries was passed in the creation of the TTreeProcessorMT, ") +
@@ -242,11 +349,89 @@ static ClustersAndEntries MakeClusters(const std::vector<std::string> &treeNames
    return std::make_pair(std::move(eventRangesPerFile), std::move(entriesPerFile));
 }
 
+/// A range of entries of one of the files, processed by a single task.
+struct RClusterTask {
+   std::size_t fFileIdx;
+   EntryRange fRange;
+
+   Long64_t GetNEntries() const { return fRange.second - fRange.first; }
+};
+
+////////////////////////////////////////////////////////////////////////
+/// Merge consecutive clusters of each file into tasks of about the same size, for a total of about nTasks tasks, and
+/// return the tasks of all files ordered by decreasing number of entries.
+static std::vector<RClusterTask>
+MakeTaskQueue(const std::vector<std::vector<EntryRange>> &clustersPerFile, unsigned int nTasks)
+{
+   Long64_t nEntries = 0ll;
+   for (const auto &clusters : clustersPerFile)
+      for (const auto &c : clusters)
+         nEntries += c.second - c.first;
+   const Long64_t targetSize = std::max(1ll, nEntries / std::max(1u, nTasks));
+
+   std::vector<RClusterTask> tasks;
+   for (std::size_t fileIdx = 0u; fileIdx < clustersPerFile.size(); ++fileIdx) {
+      bool canExtend = false; // whether the last task belongs to this file and can be extended
+      for (const auto &c : clustersPerFile[fileIdx]) {
+         if (canExtend && tasks.back().fRange.second == c.first && tasks.back().GetNEntries() < targetSize) {
+            tasks.back().fRange.second = c.second;
+         } else {
+            tasks.push_back(RClusterTask{fileIdx, c});
+            canExtend = true;
+         }
+      }
+   }
+
+   // ties are broken by file and entry order, so that tasks on the same file stay close to each other
+   std::stable_sort(tasks.begin(), tasks.end(), [](const RClusterTask &a, const RClusterTask &b) {
+      return a.GetNEntries() > b.GetNEntries();
+   });
+   return tasks;
+}
+
+/// Keeps track of when the workers complete their last task, to measure how long they stay idle at the end of the
+/// processing while other workers are still busy.
+class RLoadMonitor {
+   using Clock_t = std::chrono::steady_clock;
+   const Clock_t::time_point fStart = Clock_t::now();
+   std::mutex fMutex;
+   std::unordered_map<std::thread::id, Clock_t::time_point> fLastTaskEnd;
+   std::size_t fNTasks = 0u;
+
+public:
+   void TaskDone()
+   {
+      const auto now = Clock_t::now();
+      std::lock_guard<std::mutex> lock(fMutex);
+      fLastTaskEnd[std::this_thread::get_id()] = now;
+      ++fNTasks;
+   }
+
+   ROOT::TTreeProcessorMT::RProcessStats GetStats()
+   {
+      using Seconds_t = std::chrono::duration<double>;
+      const auto end = Clock_t::now();
+      std::lock_guard<std::mutex> lock(fMutex);
+      ROOT::TTreeProcessorMT::RProcessStats stats;
+      stats.fNTasks = fNTasks;
+      stats.fNWorkers = fLastTaskEnd.size();
+      stats.fWallTime = Seconds_t(end - fStart).count();
+      for (const auto &workerAndEnd : fLastTaskEnd) {
+         const auto idleTime = Seconds_t(end - workerAndEnd.second).count();
+         stats.fTailIdleTime += idleTime;
+         stats.fMaxTailIdleTime = std::max(stats.fMaxTailIdleTime, idleTime);
+      }
+      return stats;
+   }
+};
+
 } // anonymous namespace
 
 namespace ROOT {
 
 unsigned int TTreeProcessorMT::fgTasksPerWorkerHint = 10U;
+bool TTreeProcessorMT::fgUseGlobalTaskQueue = false;
+unsigned int TTreeProcessorMT::fgFilePrefetchDepth = 1U;
 
 namespace Internal {
 
@@ -432,6 +617,67 @@ TTreeProcessorMT::TTreeProcessorMT(TTree &tree, UInt_t nThreads, const EntryRang
 {
 }
 
+////////////////////////////////////////////////////////////////////////
+/// Whether the clusters of all files must be retrieved before processing starts. If an entry list or friend trees
+/// are present, we need to generate clusters with global entry numbers. Otherwise clusters are retrieved per file,
+/// concurrently, and contain local entry numbers.
+// TODO: in practice we could also find clusters per-file in the case of no friends and a TEntryList with
+// sub-entrylists.
+bool TTreeProcessorMT::ShouldRetrieveAllClusters() const
+{
+   return !fFriendInfo.fFriendNames.empty() || fEntryList.GetN() > 0 || fGlobalRange.first > 0 ||
+          fGlobalRange.second != std::numeric_limits<Long64_t>::max();
+}
+
+////////////////////////////////////////////////////////////////////////
+/// Maximum number of tasks per file when tasks are created per file.
+unsigned int TTreeProcessorMT::GetMaxTasksPerFile() const
+{
+   return std::ceil(float(GetTasksPerWorkerHint() * fPool.GetPoolSize()) / float(fFileNames.size()));
+}
+
+////////////////////////////////////////////////////////////////////////
+/// Maximum number of tasks for the whole dataset when using the global task queue.
+unsigned int TTreeProcessorMT::GetMaxTasks() const
+{
+   return std::max(1u, GetTasksPerWorkerHint() * fPool.GetPoolSize());
+}
+
+////////////////////////////////////////////////////////////////////////
+/// \brief Start retrieving the cluster information needed by the next call to Process() in the background.
+///
+/// This opens the first files of the dataset (at least one, or as many as GetFilePrefetchDepth()), reads their
+/// metadata and retrieves their clusters, while the caller prepares the processing, e.g. by just-in-time compiling
+/// the code that is going to run in the tasks. Process() then starts from the retrieved information instead of
+/// opening the files itself. If friend trees, an entry list or a global entry range are present, the clusters of
+/// all files are retrieved. The task settings (SetTasksPerWorkerHint(), SetUseGlobalTaskQueue()) must not be
+/// changed between the calls to Prefetch() and Process().
+void TTreeProcessorMT::Prefetch()
+{
+   const bool useGlobalTaskQueue = GetUseGlobalTaskQueue();
+   const unsigned int maxTasks = useGlobalTaskQueue ? GetMaxTasks() : GetMaxTasksPerFile();
+   if (ShouldRetrieveAllClusters()) {
+      if (!fPrefetchedAllClusters.valid())
+         fPrefetchedAllClusters = std::async(std::launch::async, [this, maxTasks] {
+            return MakeClusters(fTreeNames, fFileNames, maxTasks, fGlobalRange);
+         });
+      return;
+   }
+
+   fPrefetchedClusters.resize(fFileNames.size());
+   const auto nFiles = std::min<std::size_t>(fFileNames.size(), std::max(1u, GetFilePrefetchDepth()));
+   for (std::size_t fileIdx = 0; fileIdx < nFiles; ++fileIdx) {
+      if (fPrefetchedClusters[fileIdx].valid())
+         continue;
+      fPrefetchedClusters[fileIdx] =
+         std::async(std::launch::async, [treeName = fTreeNames[fileIdx], fileName = fFileNames[fileIdx], maxTasks,
+                                         readAhead = !useGlobalTaskQueue] {
+            return MakeClusters({treeName}, {fileName}, maxTasks, {0, std::numeric_limits<Long64_t>::max()},
+                                readAhead);
+         });
+   }
+}
+
 //////////////////////////////////////////////////////////////////////////////
 /// Process the entries of a TTree in parallel. The user-provided function
 /// receives a TTreeReader which can be used to iterate on a subrange of
@@ -451,24 +697,35 @@ TTreeProcessorMT::TTreeProcessorMT(TTree &tree, UInt_t nThreads, const EntryRang
 /// \param[in] func User-defined function that processes a subrange of entries
 void TTreeProcessorMT::Process(std::function<void(TTreeReader &)> func)
 {
+   RLoadMonitor monitor;
+
    // compute number of tasks per file
-   const unsigned int maxTasksPerFile =
-      std::ceil(float(GetTasksPerWorkerHint() * fPool.GetPoolSize()) / float(fFileNames.size()));
-
-   // If an entry list or friend trees are present, we need to generate clusters with global entry numbers,
-   // so we do it here for all files.
-   // Otherwise we can do it later, concurrently for each file, and clusters will contain local entry numbers.
-   // TODO: in practice we could also find clusters per-file in the case of no friends and a TEntryList with
-   // sub-entrylists.
-   const bool hasFriends = !fFriendInfo.fFriendNames.empty();
+   const unsigned int maxTasksPerFile = GetMaxTasksPerFile();
+   // with a global task queue, the number of tasks is capped for the whole dataset instead: a single large file
+   // can then be split into as many tasks as needed
+   const bool useGlobalTaskQueue = GetUseGlobalTaskQueue();
+   const unsigned int maxTasks = GetMaxTasks();
+
+   // With friends, an entry list or a global range, the clusters of all files are retrieved here, with global entry
+   // numbers. Otherwise they are retrieved later, concurrently for each file, with local entry numbers.
    const bool hasEntryList = fEntryList.GetN() > 0;
-   const bool shouldRetrieveAllClusters = hasFriends || hasEntryList || fGlobalRange.first > 0 ||
-                                          fGlobalRange.second != std::numeric_limits<Long64_t>::max();
+   const bool shouldRetrieveAllClusters = ShouldRetrieveAllClusters();
+   // With NUMA aware task arenas, successive tasks are dispatched round robin to the NUMA domains: reading,
+   // decompressing and processing the entries of a task then happen on the threads of a single domain
+   auto taskArena = ROOT::Internal::GetGlobalTaskArena();
+   std::atomic<unsigned> nextDomainHint{0u};
+   auto runInNumaDomain = [&](const std::function<void()> &task) {
+      taskArena->ExecuteInNumaDomain(nextDomainHint++, task);
+   };
+
    ClustersAndEntries allClusterAndEntries{};
    auto &allClusters = allClusterAndEntries.first;
    const auto &allEntries = allClusterAndEntries.second;
    if (shouldRetrieveAllClusters) {
-      allClusterAndEntries = MakeClusters(fTreeNames, fFileNames, maxTasksPerFile, fGlobalRange);
+      allClusterAndEntries =
+         fPrefetchedAllClusters.valid()
+            ? fPrefetchedAllClusters.get()
+            : MakeClusters(fTreeNames, fFileNames, useGlobalTaskQueue ? maxTasks : maxTasksPerFile, fGlobalRange);
       if (hasEntryList)
          allClusters = ConvertToElistClusters(std::move(allClusters), fEntryList, fTreeNames, fFileNames, allEntries);
    }
@@ -476,24 +733,64 @@ void TTreeProcessorMT::Process(std::function<void(TTreeReader &)> func)
    // Per-file processing in case we retrieved all cluster info upfront
    auto processFileUsingGlobalClusters = [&](std::size_t fileIdx) {
       auto processCluster = [&](const EntryRange &c) {
-         auto r =
-            fTreeView->GetTreeReader(c.first, c.second, fTreeNames, fFileNames, fFriendInfo, fEntryList, allEntries);
-         func(*r);
+         runInNumaDomain([&] {
+            auto r = fTreeView->GetTreeReader(c.first, c.second, fTreeNames, fFileNames, fFriendInfo, fEntryList,
+                                              allEntries);
+            func(*r);
+         });
+         monitor.TaskDone();
       };
       fPool.Foreach(processCluster, allClusters[fileIdx]);
    };
 
+   // Cluster info of the files that are going to be processed next, retrieved in the background while the current
+   // files are processed, so that tasks do not wait for the files to be opened at every file boundary
+   const auto prefetchDepth = GetFilePrefetchDepth();
+   // the first files might have been prefetched already by Prefetch()
+   std::vector<std::future<ClustersAndEntries>> prefetchedClusters = std::move(fPrefetchedClusters);
+   fPrefetchedClusters.clear();
+   prefetchedClusters.resize(fFileNames.size());
+   std::vector<char> isRequested(fFileNames.size(), false); // whether a file was prefetched or its processing started
+   for (std::size_t fileIdx = 0; fileIdx < fFileNames.size(); ++fileIdx)
+      isRequested[fileIdx] = prefetchedClusters[fileIdx].valid();
+   std::mutex prefetchMutex;
+   auto prefetchFile = [&](std::size_t fileIdx) {
+      // must be called with prefetchMutex locked
+      if (fileIdx >= prefetchedClusters.size() || isRequested[fileIdx])
+         return;
+      isRequested[fileIdx] = true;
+      prefetchedClusters[fileIdx] = std::async(
+         std::launch::async, [treeName = fTreeNames[fileIdx], fileName = fFileNames[fileIdx], maxTasksPerFile] {
+            return MakeClusters({treeName}, {fileName}, maxTasksPerFile, {0, std::numeric_limits<Long64_t>::max()},
+                                /*readAhead=*/true);
+         });
+   };
+
    // Per-file processing that also retrieves cluster info for a file
    auto processFileRetrievingClusters = [&](std::size_t fileIdx) {
+      std::future<ClustersAndEntries> prefetched;
+      {
+         std::lock_guard<std::mutex> lock(prefetchMutex);
+         isRequested[fileIdx] = true;
+         prefetched = std::move(prefetchedClusters[fileIdx]);
+         for (auto i = 1u; i <= prefetchDepth; ++i)
+            prefetchFile(fileIdx + i);
+      }
+
       // Evaluate clusters (with local entry numbers) and number of entries for this file
       const auto &treeNames = std::vector<std::string>({fTreeNames[fileIdx]});
       const auto &fileNames = std::vector<std::string>({fFileNames[fileIdx]});
-      const auto clustersAndEntries = MakeClusters(treeNames, fileNames, maxTasksPerFile);
+      const auto clustersAndEntries =
+         prefetched.valid() ? prefetched.get() : MakeClusters(treeNames, fileNames, maxTasksPerFile);
       const auto &clusters = clustersAndEntries.first[0];
       const auto &entries = clustersAndEntries.second[0];
       auto processCluster = [&](const EntryRange &c) {
-         auto r = fTreeView->GetTreeReader(c.first, c.second, treeNames, fileNames, fFriendInfo, fEntryList, {entries});
-         func(*r);
+         runInNumaDomain([&] {
+            auto r =
+               fTreeView->GetTreeReader(c.first, c.second, treeNames, fileNames, fFriendInfo, fEntryList, {entries});
+            func(*r);
+         });
+         monitor.TaskDone();
       };
       fPool.Foreach(processCluster, clusters);
    };
@@ -506,10 +803,56 @@ void TTreeProcessorMT::Process(std::function<void(TTreeReader &)> func)
    std::vector<std::size_t> fileIdxs(allEntries.empty() ? fFileNames.size() : allEntries.size() - firstNonEmpty);
    std::iota(fileIdxs.begin(), fileIdxs.end(), firstNonEmpty);
 
-   if (shouldRetrieveAllClusters)
+   // Processing of the clusters of all files through a single queue, ordered by decreasing task size: the largest
+   // tasks start first and each worker picks the next task as soon as it is done with the previous one, so that
+   // workers do not stay idle at the end of the processing while the remaining clusters of a large file are processed
+   auto processGlobalTaskQueue = [&]() {
+      std::vector<ClustersAndEntries> perFileClustersAndEntries;
+      if (!shouldRetrieveAllClusters) {
+         perFileClustersAndEntries = fPool.Map(
+            [&](std::size_t fileIdx) {
+               // each file is handled by one task, so the prefetched futures are not accessed concurrently
+               auto &prefetched = prefetchedClusters[fileIdx];
+               return prefetched.valid() ? prefetched.get()
+                                         : MakeClusters({fTreeNames[fileIdx]}, {fFileNames[fileIdx]}, maxTasks);
+            },
+            fileIdxs);
+         allClusters.clear();
+         for (auto &clustersAndEntries : perFileClustersAndEntries)
+            allClusters.emplace_back(std::move(clustersAndEntries.first[0]));
+      }
+
+      const auto tasks = MakeTaskQueue(allClusters, maxTasks);
+      auto processTask = [&](const RClusterTask &t) {
+         const auto &range = t.fRange;
+         runInNumaDomain([&] {
+            auto r = shouldRetrieveAllClusters
+                        ? fTreeView->GetTreeReader(range.first, range.second, fTreeNames, fFileNames, fFriendInfo,
+                                                   fEntryList, allEntries)
+                        : fTreeView->GetTreeReader(range.first, range.second, {fTreeNames[t.fFileIdx]},
+                                                   {fFileNames[t.fFileIdx]}, fFriendInfo, fEntryList,
+                                                   perFileClustersAndEntries[t.fFileIdx].second);
+            func(*r);
+         });
+         monitor.TaskDone();
+      };
+
+      std::atomic<std::size_t> nextTask{0u};
+      fPool.Foreach(
+         [&]() {
+            for (auto i = nextTask++; i < tasks.size(); i = nextTask++)
+               processTask(tasks[i]);
+         },
+         fPool.GetPoolSize());
+   };
+
+   if (useGlobalTaskQueue)
+      processGlobalTaskQueue();
+   else if (shouldRetrieveAllClusters)
       fPool.Foreach(processFileUsingGlobalClusters, fileIdxs);
    else
       fPool.Foreach(processFileRetrievingClusters, fileIdxs);
+   fLastProcessStats = monitor.GetStats();
 
    // make sure TChains and TFiles are cleaned up since they are not globally tracked
    for (unsigned int islot = 0; islot < fTreeView.GetNSlots(); ++islot) {
@@ -528,6 +871,55 @@ unsigned int TTreeProcessorMT::GetTasksPerWorkerHint()
    return fgTasksPerWorkerHint;
 }
 
+////////////////////////////////////////////////////////////////////////
+/// \brief Whether the clusters of all files are processed through a single task queue.
+bool TTreeProcessorMT::GetUseGlobalTaskQueue()
+{
+   return fgUseGlobalTaskQueue;
+}
+
+////////////////////////////////////////////////////////////////////////
+/// \brief Process the clusters of all files through a single task queue.
+/// \param[in] useGlobalQueue Whether to use the global task queue.
+///
+/// By default, TTreeProcessorMT creates tasks per file: the clusters of each file are merged into at most
+/// ceil(GetTasksPerWorkerHint() * nWorkers / nFiles) tasks. With files of very different sizes, the few large tasks
+/// of the large files can keep a handful of workers busy at the end of the processing while the others are idle.
+///
+/// With the global task queue, the clusters of all files are merged into tasks of about the same number of entries,
+/// about GetTasksPerWorkerHint() * nWorkers tasks in total. The tasks are ordered by decreasing size and each worker
+/// takes the next task from the queue as soon as it is done with the previous one. The cluster boundaries of all
+/// files are retrieved, in parallel, before the processing starts; since workers switch between files more often,
+/// this mode is mostly useful for datasets of few, unevenly sized files.
+/// GetLastProcessStats() reports how long the workers stayed idle at the end of the processing.
+void TTreeProcessorMT::SetUseGlobalTaskQueue(bool useGlobalQueue)
+{
+   fgUseGlobalTaskQueue = useGlobalQueue;
+}
+
+////////////////////////////////////////////////////////////////////////
+/// \brief Retrieve the number of files whose processing is prepared in advance.
+/// \return The number of files prefetched by TTreeProcessorMT while the current files are processed.
+unsigned int TTreeProcessorMT::GetFilePrefetchDepth()
+{
+   return fgFilePrefetchDepth;
+}
+
+////////////////////////////////////////////////////////////////////////
+/// \brief Set the number of files whose processing is prepared in advance.
+/// \param[in] depth Number of files, following the ones being processed, to prefetch. Zero disables prefetching.
+///
+/// When a dataset consists of several files, the tasks that process a new file have to wait until the file is
+/// opened, its metadata are read and its clusters are retrieved. With a prefetch depth larger than zero, this is
+/// done in the background for the next files while the current ones are being processed. For remote files, the
+/// baskets of the first cluster are also read ahead, warming up any cache between the storage and the tasks.
+/// Prefetching currently only applies to datasets without friends, entry lists or global entry ranges, for which
+/// cluster information is retrieved file by file during processing.
+void TTreeProcessorMT::SetFilePrefetchDepth(unsigned int depth)
+{
+   fgFilePrefetchDepth = depth;
+}
+
 ////////////////////////////////////////////////////////////////////////
 /// \brief Set the hint for the desired number of tasks created per worker.
 /// \param[in] tasksPerWorkerHint Desired number of tasks per worker.
@@ -18,17 +18,21 @@
 #include "TBranchSTL.h"
 #include "TBranchObject.h"
 #include "TBranchProxyDirector.h"
+#include "TBufferFile.h"
 #include "TClassEdit.h"
 #include "TEnum.h"
 #include "TFriendElement.h"
 #include "TFriendProxy.h"
 #include "TLeaf.h"
+#include "TMath.h"
 #include "TTreeProxyGenerator.h"
 #include "TRegexp.h"
 #include "TStreamerInfo.h"
 #include "TStreamerElement.h"
 #include "TNtuple.h"
 #include "TROOT.h"
+#include "TDataType.h"
+#include <cstring>
 #include <vector>
 
 // clang-format off
@@ -43,6 +47,11 @@
  * stored in columnar datasets but it is recommended to use TTreeReaderArray instead as it offers
  * several advantages.
  *
+ * Top-level branches holding a single number per entry are read a basket at a time through the bulk I/O
+ * interface of TBranch, which avoids the per-entry overhead of TBranch::GetEntry(). This is transparent: the value
+ * of the current entry is still copied to the address returned by Get(). The values of the whole basket can be
+ * accessed with GetBulkValues(); SetBulkRead(false) restores the entry by entry reading.
+ *
  * See the documentation of TTreeReader for more details and examples.
 */
 // clang-format on
@@ -79,7 +88,8 @@ ROOT::Internal::TTreeReaderValueBase::TTreeReaderValueBase(const TTreeReaderValu
    fDict(rhs.fDict),
    fProxy(rhs.fProxy),
    fLeaf(rhs.fLeaf),
-   fStaticClassOffsets(rhs.fStaticClassOffsets)
+   fStaticClassOffsets(rhs.fStaticClassOffsets),
+   fBulkReadEnabled(rhs.fBulkReadEnabled)
 {
    RegisterWithTreeReader();
 }
@@ -106,6 +116,8 @@ ROOT::Internal::TTreeReaderValueBase::operator=(const TTreeReaderValueBase& rhs)
       fSetupStatus = rhs.fSetupStatus;
       fReadStatus = rhs.fReadStatus;
       fStaticClassOffsets = rhs.fStaticClassOffsets;
+      fBulkReadEnabled = rhs.fBulkReadEnabled;
+      fProxyReadFunc = &TTreeReaderValueBase::ProxyReadDefaultImpl;
    }
    return *this;
 }
@@ -181,7 +193,10 @@ ROOT::Internal::TTreeReaderValueBase::ProxyReadDefaultImpl() {
             fProxyReadFunc = &TTreeReaderValueBase::ProxyReadTemplate<&TBranchPoxy::ReadNoParentNoBranchCountCollectionNoPointer>;
             break;
          case EReadType::kReadNoParentNoBranchCountNoCollection:
-            fProxyReadFunc = &TTreeReaderValueBase::ProxyReadTemplate<&TBranchPoxy::ReadNoParentNoBranchCountNoCollection>;
+            if (SetupBulkRead())
+               fProxyReadFunc = &TTreeReaderValueBase::ProxyReadBulk;
+            else
+               fProxyReadFunc = &TTreeReaderValueBase::ProxyReadTemplate<&TBranchPoxy::ReadNoParentNoBranchCountNoCollection>;
             break;
          case EReadType::kReadNoParentBranchCountCollectionPointer:
             fProxyReadFunc = &TTreeReaderValueBase::ProxyReadTemplate<&TBranchPoxy::ReadNoParentBranchCountCollectionPointer>;
@@ -210,6 +225,87 @@ ROOT::Internal::TTreeReaderValueBase::ProxyReadDefaultImpl() {
    return fReadStatus;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Copy the value of the current entry from the basket read in bulk, reading the basket that contains it if needed.
+/// If the basket cannot be read in bulk, the rest of the tree is read entry by entry.
+
+ROOT::Internal::TTreeReaderValueBase::EReadStatus ROOT::Internal::TTreeReaderValueBase::ProxyReadBulk()
+{
+   const Long64_t entry = fProxy->GetReadEntry();
+   if (R__unlikely(entry < fBulkFirstEntry || entry >= fBulkFirstEntry + fBulkNEntries) && !ReadBulkBasket(entry)) {
+      using TBranchProxy = ROOT::Detail::TBranchProxy;
+      fProxyReadFunc = &TTreeReaderValueBase::ProxyReadTemplate<&TBranchProxy::ReadNoParentNoBranchCountNoCollection>;
+      return ProxyRead();
+   }
+   memcpy(fProxy->GetWhere(), fBulkValues + (entry - fBulkFirstEntry) * fBulkValueSize, fBulkValueSize);
+   fReadStatus = kReadSuccess;
+   return fReadStatus;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Decide whether the branch of the proxy, which has been set up, can be read in bulk: it must be a TBranch
+/// with a single leaf holding one number of the type of the reader per entry, read into the proxy's buffer.
+
+Bool_t ROOT::Internal::TTreeReaderValueBase::SetupBulkRead()
+{
+   fBulkFirstEntry = -1;
+   fBulkNEntries = 0;
+   if (!fBulkReadEnabled || fHaveLeaf || fHaveStaticClassOffsets || fProxy->IsaPointer() || !fProxy->GetWhere())
+      return false;
+   TBranch *branch = fProxy->GetBranch();
+   auto dataType = dynamic_cast<TDataType *>(fDict);
+   if (!branch || branch->IsA() != TBranch::Class() || !dataType || !branch->SupportsBulkRead())
+      return false;
+   auto leaf = static_cast<TLeaf *>(branch->GetListOfLeaves()->UncheckedAt(0));
+   if (leaf->GetLeafCount() || leaf->GetLen() != 1 || leaf->GetLenType() != dataType->Size())
+      return false;
+
+   if (!fBulkBuffer)
+      fBulkBuffer = std::make_unique<TBufferFile>(TBuffer::kWrite, 32 * 1024);
+   fBulkValueSize = dataType->Size();
+   return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Read in bulk the basket of the branch that contains the given entry of its tree.
+
+Bool_t ROOT::Internal::TTreeReaderValueBase::ReadBulkBasket(Long64_t entry)
+{
+   fBulkFirstEntry = -1;
+   fBulkNEntries = 0;
+   TBranch *branch = fProxy->GetBranch();
+   if (entry < 0 || entry >= branch->GetEntries())
+      return false;
+   // GetBulkEntries() only reads from the first entry of a basket
+   const Int_t basket = TMath::BinarySearch(branch->GetWriteBasket() + 1, branch->GetBasketEntry(), entry);
+   if (basket < 0)
+      return false;
+   const Long64_t first = branch->GetBasketEntry()[basket];
+   const Int_t nEntries = branch->GetBulkRead().GetBulkEntries(first, *fBulkBuffer);
+   if (nEntries <= 0 || entry >= first + nEntries)
+      return false;
+
+   fBulkValues = fBulkBuffer->GetCurrent();
+   fBulkFirstEntry = first;
+   fBulkNEntries = nEntries;
+   return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return the values of the basket read in bulk that contains the current entry, nullptr if the branch is not
+/// read in bulk. See TTreeReaderValue::GetBulkValues().
+
+const void *ROOT::Internal::TTreeReaderValueBase::GetBulkValues(Long64_t &firstEntry, Long64_t &nEntries)
+{
+   firstEntry = -1;
+   nEntries = 0;
+   if (!fProxy || ProxyRead() != kReadSuccess || !IsBulkRead())
+      return nullptr;
+   firstEntry = fBulkFirstEntry;
+   nEntries = fBulkNEntries;
+   return fBulkValues;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Stringify the template argument.
 std::string ROOT::Internal::TTreeReaderValueBase::GetElementTypeName(const std::type_info& ti) {
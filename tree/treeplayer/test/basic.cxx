@@ -456,6 +456,63 @@ TEST(TTreeReaderBasic, Values) {
    EXPECT_FLOAT_EQ(-12, *f16);
 }
 
+TEST(TTreeReaderBasic, BulkRead)
+{
+   const auto fname = "TTreeReaderBasicBulkRead.root";
+   {
+      TFile f(fname, "RECREATE");
+      TTree t("t", "t");
+      int i = 0;
+      float z = 0.f;
+      t.Branch("i", &i, 64);
+      t.Branch("z", &z);
+      for (i = 0; i < 1000; ++i) {
+         z = i / 2.f;
+         t.Fill();
+      }
+      t.Write();
+   }
+
+   TFile f(fname);
+   auto t = f.Get<TTree>("t");
+   TTreeReader tr(t);
+   TTreeReaderValue<int> i(tr, "i");
+   TTreeReaderValue<float> z(tr, "z");
+   // Start in the middle of a basket
+   tr.SetEntriesRange(123, 1000);
+   int expected = 123;
+   int *address = nullptr;
+   while (tr.Next()) {
+      EXPECT_EQ(expected, *i);
+      EXPECT_TRUE(i.IsBulkRead());
+      EXPECT_FLOAT_EQ(expected / 2.f, *z);
+      if (!address)
+         address = i.Get();
+      EXPECT_EQ(address, i.Get());
+
+      Long64_t first = -1, n = 0;
+      const int *values = i.GetBulkValues(first, n);
+      ASSERT_NE(nullptr, values);
+      EXPECT_LE(first, expected);
+      EXPECT_LT(expected, first + n);
+      EXPECT_EQ(first, values[0]);
+      EXPECT_EQ(expected, values[expected - first]);
+      ++expected;
+   }
+   EXPECT_EQ(1000, expected);
+
+   TTreeReader trNoBulk(t);
+   TTreeReaderValue<int> iNoBulk(trNoBulk, "i");
+   iNoBulk.SetBulkRead(false);
+   trNoBulk.SetEntry(42);
+   EXPECT_EQ(42, *iNoBulk);
+   EXPECT_FALSE(iNoBulk.IsBulkRead());
+   Long64_t first = -1, n = 0;
+   EXPECT_EQ(nullptr, iNoBulk.GetBulkValues(first, n));
+
+   gSystem->Unlink(fname);
+}
+
 // #PR 3692
 TEST(TTreeReaderBasic, InfLoop)
 {
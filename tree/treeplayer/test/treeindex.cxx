@@ -0,0 +1,94 @@
+#include "TChain.h"
+#include "TChainIndex.h"
+#include "TFile.h"
+#include "TROOT.h"
+#include "TSystem.h"
+#include "TTree.h"
+#include "TTreeIndex.h"
+
+#include "gtest/gtest.h"
+
+#include <memory>
+#include <string>
+
+namespace {
+void WriteIndexTree(const char *fname, int nEntries, int firstRun)
+{
+   TFile f(fname, "recreate");
+   TTree t("t", "t");
+   int run, event;
+   t.Branch("run", &run);
+   t.Branch("event", &event);
+   t.SetAutoFlush(1000);
+   for (int i = 0; i < nEntries; ++i) {
+      run = firstRun + (i % 7);
+      event = nEntries - i;
+      t.Fill();
+   }
+   t.Write();
+}
+} // anonymous namespace
+
+TEST(TTreeIndex, ParallelBuild)
+{
+   const auto fname = "treeindex_parallelbuild.root";
+   const int nEntries = 300000;
+   WriteIndexTree(fname, nEntries, 0);
+
+   TFile f(fname);
+   auto t = f.Get<TTree>("t");
+   TTreeIndex serial(t, "run", "event");
+#ifdef R__USE_IMT
+   ROOT::EnableImplicitMT(4);
+#endif
+   TTreeIndex parallel(t, "run", "event");
+#ifdef R__USE_IMT
+   ROOT::DisableImplicitMT();
+#endif
+
+   ASSERT_EQ(serial.GetN(), nEntries);
+   ASSERT_EQ(parallel.GetN(), nEntries);
+   for (Long64_t i = 0; i < nEntries; ++i) {
+      EXPECT_EQ(serial.GetIndexValues()[i], parallel.GetIndexValues()[i]);
+      EXPECT_EQ(serial.GetIndexValuesMinor()[i], parallel.GetIndexValuesMinor()[i]);
+      EXPECT_EQ(serial.GetIndex()[i], parallel.GetIndex()[i]);
+   }
+   EXPECT_EQ(parallel.GetEntryNumberWithIndex(3, nEntries - 3), 3);
+
+   gSystem->Unlink(fname);
+}
+
+TEST(TChainIndex, WriteAndReuse)
+{
+   const char *fnames[] = {"chainindex_reuse_0.root", "chainindex_reuse_1.root"};
+   const auto indexFname = "chainindex_reuse_index.root";
+   WriteIndexTree(fnames[0], 100, 0);
+   WriteIndexTree(fnames[1], 100, 10);
+
+   {
+      TChain chain("t");
+      chain.Add(fnames[0]);
+      chain.Add(fnames[1]);
+      ASSERT_EQ(chain.BuildIndex("run", "event"), 200);
+      TFile f(indexFname, "recreate");
+      chain.GetTreeIndex()->Write("chainIndex");
+   }
+
+   TChain chain("t");
+   chain.Add(fnames[0]);
+   chain.Add(fnames[1]);
+   TFile f(indexFname);
+   auto index = f.Get<TChainIndex>("chainIndex");
+   ASSERT_NE(index, nullptr);
+   chain.SetTreeIndex(index);
+   index->SetTree(&chain);
+   // In the second tree, run 11 is held by the entries i with i % 7 == 1, event is 100 - i
+   EXPECT_EQ(chain.GetEntryNumberWithIndex(11, 99), 101);
+   EXPECT_EQ(chain.GetEntryNumberWithIndex(0, 100), 0);
+   EXPECT_EQ(chain.GetEntryNumberWithIndex(10, 98), -1);
+
+   chain.SetTreeIndex(nullptr);
+   for (auto fname : fnames)
+      gSystem->Unlink(fname);
+   gSystem->Unlink(indexFname);
+}
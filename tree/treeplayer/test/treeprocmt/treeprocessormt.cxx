@@ -1,17 +1,20 @@
 #include <algorithm>
 #include <atomic>
 #include <chrono>
+#include <numeric>
 #include <random>
 #include <string>
 #include <thread>
 #include <utility>
 
 #include <TFile.h>
+#include <TH1D.h>
 #include <TTree.h>
 #include <TSystem.h>
 #include <TTreeReader.h>
 #include <TTreeReaderValue.h>
 #include <ROOT/TTreeProcessorMT.hxx>
+#include <TTreePerfStatsMT.h>
 
 #include "gtest/gtest.h"
 
@@ -106,6 +109,128 @@ TEST(TreeProcessorMT, ManyFiles)
    DeleteFiles(filenames);
 }
 
+TEST(TreeProcessorMT, FilePrefetchDepth)
+{
+   const auto nFiles = 20u;
+   const std::string treename = "t";
+   std::vector<std::string> filenames;
+   for (auto i = 0u; i < nFiles; ++i)
+      filenames.emplace_back("treeprocmt_fileprefetch" + std::to_string(i) + ".root");
+
+   WriteFiles(std::vector<std::string>(nFiles, treename), filenames);
+
+   std::vector<std::string_view> fnames;
+   for (const auto &f : filenames)
+      fnames.emplace_back(f);
+
+   const auto defaultDepth = ROOT::TTreeProcessorMT::GetFilePrefetchDepth();
+   for (auto depth : {0u, 1u, 4u, 2 * nFiles}) {
+      ROOT::TTreeProcessorMT::SetFilePrefetchDepth(depth);
+      EXPECT_EQ(ROOT::TTreeProcessorMT::GetFilePrefetchDepth(), depth);
+
+      std::atomic_int sum(0);
+      std::atomic_int count(0);
+      ROOT::TTreeProcessorMT proc(fnames, treename);
+      proc.Process([&sum, &count](TTreeReader &r) {
+         TTreeReaderValue<int> v(r, "v");
+         while (r.Next()) {
+            sum += *v;
+            ++count;
+         }
+      });
+
+      EXPECT_EQ(count.load(), int(nFiles * 10)) << "prefetch depth " << depth;
+      EXPECT_EQ(sum.load(), 20100) << "prefetch depth " << depth; // sum of [1..nFiles*nEntriesPerFile] inclusive
+   }
+   ROOT::TTreeProcessorMT::SetFilePrefetchDepth(defaultDepth);
+
+   DeleteFiles(filenames);
+}
+
+TEST(TreeProcessorMT, Prefetch)
+{
+   const auto nFiles = 5u;
+   const std::string treename = "t";
+   std::vector<std::string> filenames;
+   for (auto i = 0u; i < nFiles; ++i)
+      filenames.emplace_back("treeprocmt_prefetch" + std::to_string(i) + ".root");
+
+   WriteFiles(std::vector<std::string>(nFiles, treename), filenames);
+
+   std::vector<std::string_view> fnames;
+   for (const auto &f : filenames)
+      fnames.emplace_back(f);
+
+   auto sumValues = [](ROOT::TTreeProcessorMT &proc) {
+      std::atomic_int sum(0);
+      proc.Process([&sum](TTreeReader &r) {
+         TTreeReaderValue<int> v(r, "v");
+         while (r.Next())
+            sum += *v;
+      });
+      return sum.load();
+   };
+
+   // clusters of the first files retrieved in the background, then clusters of all files with a global range
+   ROOT::TTreeProcessorMT proc(fnames, treename);
+   proc.Prefetch();
+   EXPECT_EQ(sumValues(proc), 1275); // sum of [1..nFiles*nEntriesPerFile] inclusive
+   // nothing is left from the previous Prefetch()
+   EXPECT_EQ(sumValues(proc), 1275);
+
+   ROOT::TTreeProcessorMT procWithRange(fnames, treename, 0u, {5, 15});
+   procWithRange.Prefetch();
+   EXPECT_EQ(sumValues(procWithRange), 105); // sum of [6..15] inclusive
+
+   DeleteFiles(filenames);
+}
+
+TEST(TreeProcessorMT, GlobalTaskQueue)
+{
+   // files of very different sizes, each entry in its own cluster
+   const std::vector<unsigned int> nEntries{1000u, 10u, 200u, 1u, 50u};
+   const std::string treename = "t";
+   std::vector<std::string> filenames;
+   for (auto i = 0u; i < nEntries.size(); ++i) {
+      filenames.emplace_back("treeprocmt_globaltaskqueue" + std::to_string(i) + ".root");
+      WriteFileManyClusters(nEntries[i], treename.c_str(), filenames.back().c_str());
+   }
+   const auto nTotalEntries = std::accumulate(nEntries.begin(), nEntries.end(), 0u);
+
+   std::vector<std::string_view> fnames;
+   for (const auto &f : filenames)
+      fnames.emplace_back(f);
+
+   const auto defaultUseGlobalQueue = ROOT::TTreeProcessorMT::GetUseGlobalTaskQueue();
+   ROOT::TTreeProcessorMT::SetUseGlobalTaskQueue(true);
+   EXPECT_TRUE(ROOT::TTreeProcessorMT::GetUseGlobalTaskQueue());
+
+   auto countEntries = [](ROOT::TTreeProcessorMT &proc) {
+      std::atomic_uint count(0u);
+      proc.Process([&count](TTreeReader &r) {
+         while (r.Next())
+            ++count;
+      });
+      return count.load();
+   };
+
+   // clusters are retrieved per file during processing
+   ROOT::TTreeProcessorMT proc(fnames, treename);
+   EXPECT_EQ(countEntries(proc), nTotalEntries);
+   const auto &stats = proc.GetLastProcessStats();
+   EXPECT_GT(stats.fNTasks, 0u);
+   EXPECT_GT(stats.fNWorkers, 0u);
+   EXPECT_GE(stats.fTailIdleTime, 0.);
+   EXPECT_LE(stats.fMaxTailIdleTime, stats.fWallTime);
+
+   // clusters with global entry numbers are retrieved before processing
+   ROOT::TTreeProcessorMT procWithRange(fnames, treename, 0u, {5, 1100});
+   EXPECT_EQ(countEntries(procWithRange), 1095u);
+
+   ROOT::TTreeProcessorMT::SetUseGlobalTaskQueue(defaultUseGlobalQueue);
+   DeleteFiles(filenames);
+}
+
 TEST(TreeProcessorMT, TreesWithDifferentNamesChainCtor)
 {
    const std::vector<std::string> treenames{"t0","t1","t2"};
@@ -518,3 +643,102 @@ TEST(TreeProcessorMT, TreesInSameFile)
    gSystem->Unlink(fname.c_str());
    ROOT::DisableImplicitMT();
 }
+
+TEST(TreeProcessorMT, ParallelDraw)
+{
+   const auto fname = "treeprocmt_paralleldraw.root";
+   {
+      TFile file(fname, "recreate");
+      TTree t("t", "t");
+      int v = 0;
+      t.Branch("v", &v);
+      t.SetAutoFlush(100);
+      for (v = 0; v < 1000; ++v)
+         t.Fill();
+      t.Write();
+   }
+
+   TFile f(fname);
+   auto t = f.Get<TTree>("t");
+   ASSERT_NE(t, nullptr);
+   TH1D hseq("hseq", "hseq", 10, 0, 1000);
+   t->Draw("Entry$*2>>hseq", "Entry$%3==0", "goff");
+
+   ROOT::EnableImplicitMT(2);
+   // Entry$ forces the sequential path, the same expression on v runs in parallel
+   TH1D hmt("hmt", "hmt", 10, 0, 1000);
+   t->SetAlias("twice", "v*2");
+   const auto nsel = t->Draw("twice>>hmt", "v%3==0", "goff");
+   ROOT::DisableImplicitMT();
+
+   EXPECT_EQ(nsel, 334);
+   EXPECT_EQ(hmt.GetEntries(), 334);
+   for (int i = 0; i <= hseq.GetNbinsX() + 1; ++i)
+      EXPECT_EQ(hmt.GetBinContent(i), hseq.GetBinContent(i)) << "bin " << i;
+
+   f.Close();
+   gSystem->Unlink(fname);
+}
+
+TEST(TreeProcessorMT, PerfStatsMT)
+{
+   const auto fname = "treeprocmt_perfstatsmt.root";
+   {
+      TFile f(fname, "recreate");
+      TTree t("t", "t");
+      int a = 0, b = 0;
+      t.Branch("a", &a);
+      t.Branch("b", &b);
+      t.SetAutoFlush(100);
+      for (a = 0; a < 1000; ++a) {
+         b = 2 * a;
+         t.Fill();
+      }
+      t.Write();
+   }
+
+   ROOT::EnableImplicitMT(2);
+   TTreePerfStatsMT ps;
+   ps.Start();
+   ROOT::TTreeProcessorMT tp(fname, "t");
+   std::atomic<int> sum{0};
+   tp.Process([&sum](TTreeReader &r) {
+      TTreeReaderValue<int> a(r, "a"), b(r, "b");
+      while (r.Next())
+         sum += *b - *a;
+   });
+   ps.Stop();
+   ROOT::DisableImplicitMT();
+   EXPECT_EQ(sum, 999 * 1000 / 2);
+   EXPECT_EQ(TTree::GetDefaultPerfStats(), nullptr);
+
+   const auto branches = ps.GetBranchStats();
+   ASSERT_EQ(branches.size(), 2u);
+   EXPECT_EQ(branches[0].fName, "a");
+   EXPECT_EQ(branches[1].fName, "b");
+   for (const auto &branch : branches) {
+      EXPECT_EQ(branch.fBasketReads, 10u);
+      EXPECT_GT(branch.fBytesRead, 0u);
+      EXPECT_LE(branch.fUnzipCalls, branch.fBasketReads);
+   }
+
+   const auto clusters = ps.GetClusterStats();
+   ASSERT_EQ(clusters.size(), 10u);
+   std::vector<Long64_t> firstEntries;
+   for (const auto &cluster : clusters) {
+      EXPECT_EQ(cluster.fFile, fname);
+      EXPECT_EQ(cluster.fEndEntry - cluster.fFirstEntry, 100);
+      EXPECT_LE(cluster.fBegin, cluster.fEnd);
+      EXPECT_FALSE(cluster.fThreads.empty());
+      firstEntries.emplace_back(cluster.fFirstEntry);
+   }
+   std::sort(firstEntries.begin(), firstEntries.end());
+   for (auto i = 0u; i < firstEntries.size(); ++i)
+      EXPECT_EQ(firstEntries[i], 100 * Long64_t(i));
+
+   const auto threads = ps.GetThreadStats();
+   EXPECT_GE(threads.size(), 1u);
+   EXPECT_GT(ps.GetBytesRead(), 0);
+
+   gSystem->Unlink(fname);
+}